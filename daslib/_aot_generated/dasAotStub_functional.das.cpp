@@ -0,0 +1,460 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require functional
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+ // require templates
+ // require contracts
+ // require array_boost
+ // require algorithm
+ // require templates_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12443345011102171143 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace functional { struct FusionMacro; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace templates { struct DecltypeMacro; };
+namespace templates { struct DecltypeNoRefMacro; };
+namespace templates { struct TemplateMacro; };
+namespace contracts { struct IsAnyType; };
+namespace contracts { struct IsAnyArrayMacro; };
+namespace contracts { struct IsDimMacro; };
+namespace contracts { struct IsNotDimMacro; };
+namespace contracts { struct IsAnyEnumMacro; };
+namespace contracts { struct IsAnyVectorType; };
+namespace contracts { struct IsAnyStructMacro; };
+namespace contracts { struct IsAnyNumericMacro; };
+namespace contracts { struct IsAnyWorkhorse; };
+namespace contracts { struct IsAnyWorkhorseNonPtrMacro; };
+namespace contracts { struct IsAnyTupleNonPtrMacro; };
+namespace contracts { struct IsAnyVariantNonPtrMacro; };
+namespace contracts { struct IsAnyFunctionNonPtrMacro; };
+namespace templates_boost { struct Template; };
+namespace templates_boost { struct TemplateVisitor; };
+namespace templates_boost { struct RemoveDerefVisitor; };
+namespace templates_boost { struct QRulesVisitor; };
+namespace templates_boost { struct AstQCallMacro; };
+namespace templates_boost { struct QMacro; };
+namespace templates_boost { struct QBlockMacro; };
+namespace templates_boost { struct QBlockExprMacro; };
+namespace templates_boost { struct QTypeMacro; };
+namespace templates_boost { struct AstQNamedMacro; };
+namespace templates_boost { struct AstQFunctionMacro; };
+namespace templates_boost { struct AstQVariableMacro; };
+namespace templates_boost { struct AstQNamedClassMacro; };
+namespace templates_boost { struct AstQMethodMacro; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+namespace ast {
+
+struct AstFunctionAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(AstFunctionAnnotation)==104,"structure size mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,finish)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,patch)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,fixup)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,lint)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,complete)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,isCompatible)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,isSpecialized)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,appendToMangledName)==96,"structure field offset mismatch with DAS");
+}
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+// unused structure DecltypeMacro
+// unused structure DecltypeNoRefMacro
+// unused structure TemplateMacro
+// unused structure IsAnyType
+// unused structure IsAnyArrayMacro
+// unused structure IsDimMacro
+// unused structure IsNotDimMacro
+// unused structure IsAnyEnumMacro
+// unused structure IsAnyVectorType
+// unused structure IsAnyStructMacro
+// unused structure IsAnyNumericMacro
+// unused structure IsAnyWorkhorse
+// unused structure IsAnyWorkhorseNonPtrMacro
+// unused structure IsAnyTupleNonPtrMacro
+// unused structure IsAnyVariantNonPtrMacro
+// unused structure IsAnyFunctionNonPtrMacro
+// unused structure Template
+// unused structure TemplateVisitor
+// unused structure RemoveDerefVisitor
+// unused structure QRulesVisitor
+// unused structure AstQCallMacro
+// unused structure QMacro
+// unused structure QBlockMacro
+// unused structure QBlockExprMacro
+// unused structure QTypeMacro
+// unused structure AstQNamedMacro
+// unused structure AstQFunctionMacro
+// unused structure AstQVariableMacro
+// unused structure AstQNamedClassMacro
+// unused structure AstQMethodMacro
+namespace functional {
+
+struct FusionMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(FusionMacro)==104,"structure size mismatch with DAS");
+static_assert(offsetof(FusionMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(FusionMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(FusionMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(FusionMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(FusionMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(FusionMacro,finish)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(FusionMacro,patch)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(FusionMacro,fixup)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(FusionMacro,lint)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(FusionMacro,complete)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(FusionMacro,isCompatible)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(FusionMacro,isSpecialized)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(FusionMacro,appendToMangledName)==96,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_push_77e666e24c6da292 ( Context * __context__, TArray<ast::AstFunctionAnnotation *> & __Arr_rename_at_75, ast::AstFunctionAnnotation * const  __value_rename_at_75 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_5c7628e5e8cbbf47 ( Context * __context__, functional::FusionMacro const  & __cl_rename_at_86 );
+inline smart_ptr_raw<Expression> _Funcbuiltin_0x60_clone_to_move_7d9d004bbe5f56ce ( Context * __context__, smart_ptr_raw<Expression> const  __clone_src_rename_at_325 );
+inline smart_ptr_raw<ExprMakeBlock> _Funcbuiltin_0x60_clone_to_move_6ccaa4fcfb2c0aee ( Context * __context__, smart_ptr_raw<ExprMakeBlock> const  __clone_src_rename_at_325 );
+inline void _Funcbuiltin_0x60_push_f20d93c61f930b74 ( Context * __context__, TArray<ExprCall *> & __Arr_rename_at_75, ExprCall * const  __value_rename_at_75 );
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_cd12ff9a49bafefc ( Context * __context__, char * const  __name_rename_at_547, functional::FusionMacro * const  __someClassPtr_rename_at_547 );
+inline TypeDecl * _Funcbuiltin_0x60_get_ptr_1d506cf3da127565 ( Context * __context__, smart_ptr<TypeDecl> const  __src_rename_at_725 );
+inline smart_ptr_raw<Expression> _Funcbuiltin_0x60_add_ptr_ref_1f3fb24ca30c5309 ( Context * __context__, smart_ptr_raw<Expression> const  __src_rename_at_733 );
+inline void _Funcbuiltin_0x60_emplace_a05f9d2248c600b ( Context * __context__, TArray<smart_ptr_raw<Expression>> & __Arr_rename_at_120, smart_ptr_raw<Expression> __value_rename_at_120 );
+inline void clone_d438e697fb3099ef ( Context * __context__, smart_ptr<TypeDecl> & __dest_rename_at_395, smart_ptr_raw<TypeDecl> const  __src_rename_at_395 );
+inline smart_ptr_raw<Expression> _Funcast_boost_0x60_convert_to_expression_58fcb600880064d9 ( Context * __context__, bool __value_rename_at_607 );
+inline void clone_b39c30844f6e73f0 ( Context * __context__, smart_ptr<Expression> & __dest_rename_at_414, smart_ptr<Expression> const  __src_rename_at_414 );
+inline smart_ptr_raw<ExprMakeBlock> _Funcbuiltin_0x60_add_ptr_ref_b6494a0c741123d1 ( Context * __context__, smart_ptr_raw<ExprMakeBlock> const  __src_rename_at_733 );
+inline Expression * _Funcbuiltin_0x60_get_ptr_98dd15e167848d85 ( Context * __context__, smart_ptr<Expression> const  __src_rename_at_725 );
+inline void _Funcast_boost_0x60_setup_tag_annotation_4c090233d6550e84 ( Context * __context__, char * const  __name_rename_at_192, char * const  __tag_rename_at_192, functional::FusionMacro * const  __classPtr_rename_at_192 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_push_77e666e24c6da292 ( Context * __context__, TArray<ast::AstFunctionAnnotation *> &  __Arr_rename_at_75, ast::AstFunctionAnnotation * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<ast::AstFunctionAnnotation *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_5c7628e5e8cbbf47 ( Context * __context__, functional::FusionMacro const  &  __cl_rename_at_86 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo const  *>::cast(__cl_rename_at_86.__rtti)->structType /*structType*/));
+}
+
+inline smart_ptr_raw<Expression> _Funcbuiltin_0x60_clone_to_move_7d9d004bbe5f56ce ( Context * __context__, smart_ptr_raw<Expression> const  __clone_src_rename_at_325 )
+{
+	smart_ptr_raw<Expression> __clone_dest_rename_at_327; das_zero(__clone_dest_rename_at_327);
+	clone_b39c30844f6e73f0(__context__,__clone_dest_rename_at_327,__clone_src_rename_at_325);
+	return /* <- */ das_auto_cast_move<smart_ptr_raw<Expression>>::cast(__clone_dest_rename_at_327);
+}
+
+inline smart_ptr_raw<ExprMakeBlock> _Funcbuiltin_0x60_clone_to_move_6ccaa4fcfb2c0aee ( Context * __context__, smart_ptr_raw<ExprMakeBlock> const  __clone_src_rename_at_325 )
+{
+	smart_ptr_raw<ExprMakeBlock> __clone_dest_rename_at_327; das_zero(__clone_dest_rename_at_327);
+	clone_b39c30844f6e73f0(__context__,das_reinterpret<smart_ptr<Expression>>::pass(__clone_dest_rename_at_327),das_reinterpret<smart_ptr<Expression> const >::pass(__clone_src_rename_at_325));
+	return /* <- */ das_auto_cast_move<smart_ptr_raw<ExprMakeBlock>>::cast(__clone_dest_rename_at_327);
+}
+
+inline void _Funcbuiltin_0x60_push_f20d93c61f930b74 ( Context * __context__, TArray<ExprCall *> &  __Arr_rename_at_75, ExprCall * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<ExprCall *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_cd12ff9a49bafefc ( Context * __context__, char * const  __name_rename_at_547, functional::FusionMacro * const  __someClassPtr_rename_at_547 )
+{
+	_Funcbuiltin_0x60_push_77e666e24c6da292(__context__,das_arg<TArray<ast::AstFunctionAnnotation *>>::pass(das_global<TArray<ast::AstFunctionAnnotation *>,0x38365ed8629b5584>(__context__) /*gc_root_AstFunctionAnnotation*/),das_reinterpret<ast::AstFunctionAnnotation * const >::pass(__someClassPtr_rename_at_547));
+	StructInfo const  * __classInfo_rename_at_550 = ((StructInfo const  *)_Funcrtti_0x60_class_info_5c7628e5e8cbbf47(__context__,das_deref(__context__,__someClassPtr_rename_at_547)));
+	return das_auto_cast<smart_ptr_raw<FunctionAnnotation>>::cast(makeFunctionAnnotation(__name_rename_at_547,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_547),__classInfo_rename_at_550,__context__));
+}
+
+inline TypeDecl * _Funcbuiltin_0x60_get_ptr_1d506cf3da127565 ( Context * __context__, smart_ptr<TypeDecl> const  __src_rename_at_725 )
+{
+	return das_auto_cast<TypeDecl *>::cast(das_cast<TypeDecl *>::cast(__src_rename_at_725));
+}
+
+inline smart_ptr_raw<Expression> _Funcbuiltin_0x60_add_ptr_ref_1f3fb24ca30c5309 ( Context * __context__, smart_ptr_raw<Expression> const  __src_rename_at_733 )
+{
+	smart_ptr_raw<Expression> __dst_rename_at_734; das_zero(__dst_rename_at_734); das_move(__dst_rename_at_734, _Funcbuiltin_0x60_clone_to_move_7d9d004bbe5f56ce(__context__,__src_rename_at_733));
+	return das_auto_cast<smart_ptr_raw<Expression>>::cast(__dst_rename_at_734);
+}
+
+inline void _Funcbuiltin_0x60_emplace_a05f9d2248c600b ( Context * __context__, TArray<smart_ptr_raw<Expression>> &  __Arr_rename_at_120, smart_ptr_raw<Expression> __value_rename_at_120 )
+{
+	das_move(__Arr_rename_at_120(builtin_array_push_back(das_arg<TArray<smart_ptr_raw<Expression>>>::pass(__Arr_rename_at_120),8,__context__),__context__),__value_rename_at_120);
+}
+
+inline void clone_d438e697fb3099ef ( Context * __context__, smart_ptr<TypeDecl> & __dest_rename_at_395, smart_ptr_raw<TypeDecl> const  __src_rename_at_395 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_395),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_395));
+}
+
+inline smart_ptr_raw<Expression> _Funcast_boost_0x60_convert_to_expression_58fcb600880064d9 ( Context * __context__, bool __value_rename_at_607 )
+{
+	LineInfo _temp_make_local_608_32;
+	return das_auto_cast<smart_ptr_raw<Expression>>::cast(das_invoke_function<smart_ptr_raw<Expression>>::invoke<bool &,LineInfo const  &>(__context__,nullptr,Func(__context__->fnByMangledName(/*@functional::ast_boost`convert_to_expression &=Xb CH<rtti::LineInfo>*/ 8347046315356894331u)),__value_rename_at_607,das_arg<LineInfo>::pass((([&]() -> LineInfo& {
+		das_zero(_temp_make_local_608_32);
+		return _temp_make_local_608_32;
+	})()))));
+}
+
+inline void clone_b39c30844f6e73f0 ( Context * __context__, smart_ptr<Expression> & __dest_rename_at_414, smart_ptr<Expression> const  __src_rename_at_414 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_414),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_414));
+}
+
+inline smart_ptr_raw<ExprMakeBlock> _Funcbuiltin_0x60_add_ptr_ref_b6494a0c741123d1 ( Context * __context__, smart_ptr_raw<ExprMakeBlock> const  __src_rename_at_733 )
+{
+	smart_ptr_raw<ExprMakeBlock> __dst_rename_at_734; das_zero(__dst_rename_at_734); das_move(__dst_rename_at_734, _Funcbuiltin_0x60_clone_to_move_6ccaa4fcfb2c0aee(__context__,__src_rename_at_733));
+	return das_auto_cast<smart_ptr_raw<ExprMakeBlock>>::cast(__dst_rename_at_734);
+}
+
+inline Expression * _Funcbuiltin_0x60_get_ptr_98dd15e167848d85 ( Context * __context__, smart_ptr<Expression> const  __src_rename_at_725 )
+{
+	return das_auto_cast<Expression *>::cast(das_cast<Expression *>::cast(__src_rename_at_725));
+}
+
+inline void _Funcast_boost_0x60_setup_tag_annotation_4c090233d6550e84 ( Context * __context__, char * const  __name_rename_at_192, char * const  __tag_rename_at_192, functional::FusionMacro * const  __classPtr_rename_at_192 )
+{
+	smart_ptr_raw<FunctionAnnotation> __ann_rename_at_193; das_zero(__ann_rename_at_193); das_move(__ann_rename_at_193, _Funcast_0x60_make_function_annotation_cd12ff9a49bafefc(__context__,__name_rename_at_192,__classPtr_rename_at_192));
+	das_invoke_function<void>::invoke<char * const ,smart_ptr_raw<FunctionAnnotation> const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@ast_boost::apply_tag_annotation Cs CY<FunctionAnnotationPtr>1<H<ast::FunctionAnnotation>>?M*/ 12615543767023261603u)),__tag_rename_at_192,__ann_rename_at_193);
+	addModuleFunctionAnnotation(thisModule(__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__ann_rename_at_193,__context__);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_push_77e666e24c6da292
+	aotLib[0xcc96233b05094c31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<ast::AstFunctionAnnotation *> & , ast::AstFunctionAnnotation * const   ),&_Funcbuiltin_0x60_push_77e666e24c6da292>>();
+	};
+	// _Funcrtti_0x60_class_info_5c7628e5e8cbbf47
+	aotLib[0xc92100062bb9dc91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, functional::FusionMacro const  &  ),&_Funcrtti_0x60_class_info_5c7628e5e8cbbf47>>();
+	};
+	// _Funcbuiltin_0x60_clone_to_move_7d9d004bbe5f56ce
+	aotLib[0xb12e7cf399c7de7e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, smart_ptr_raw<Expression> const   ),&_Funcbuiltin_0x60_clone_to_move_7d9d004bbe5f56ce>>();
+	};
+	// _Funcbuiltin_0x60_clone_to_move_6ccaa4fcfb2c0aee
+	aotLib[0xa61d8d580197bd0e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ExprMakeBlock> (*) ( Context * __context__, smart_ptr_raw<ExprMakeBlock> const   ),&_Funcbuiltin_0x60_clone_to_move_6ccaa4fcfb2c0aee>>();
+	};
+	// _Funcbuiltin_0x60_push_f20d93c61f930b74
+	aotLib[0xe4d7759dbbbe9bbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<ExprCall *> & , ExprCall * const   ),&_Funcbuiltin_0x60_push_f20d93c61f930b74>>();
+	};
+	// _Funcast_0x60_make_function_annotation_cd12ff9a49bafefc
+	aotLib[0x67cefb2fd3d144e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<FunctionAnnotation> (*) ( Context * __context__, char * const  , functional::FusionMacro * const   ),&_Funcast_0x60_make_function_annotation_cd12ff9a49bafefc>>();
+	};
+	// _Funcbuiltin_0x60_get_ptr_1d506cf3da127565
+	aotLib[0x4781158f1af7dcc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TypeDecl * (*) ( Context * __context__, smart_ptr<TypeDecl> const   ),&_Funcbuiltin_0x60_get_ptr_1d506cf3da127565>>();
+	};
+	// _Funcbuiltin_0x60_add_ptr_ref_1f3fb24ca30c5309
+	aotLib[0x812402a97ec7d4a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, smart_ptr_raw<Expression> const   ),&_Funcbuiltin_0x60_add_ptr_ref_1f3fb24ca30c5309>>();
+	};
+	// _Funcbuiltin_0x60_emplace_a05f9d2248c600b
+	aotLib[0x5e417a340cf8959d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<smart_ptr_raw<Expression>> & , smart_ptr_raw<Expression>  ),&_Funcbuiltin_0x60_emplace_a05f9d2248c600b>>();
+	};
+	// clone_d438e697fb3099ef
+	aotLib[0x1ff0b535db99a18d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr<TypeDecl> & , smart_ptr_raw<TypeDecl> const   ),&clone_d438e697fb3099ef>>();
+	};
+	// _Funcast_boost_0x60_convert_to_expression_58fcb600880064d9
+	aotLib[0x8032e379edb8dad1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, bool  ),&_Funcast_boost_0x60_convert_to_expression_58fcb600880064d9>>();
+	};
+	// clone_b39c30844f6e73f0
+	aotLib[0xd452a6a2baae4df1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr<Expression> & , smart_ptr<Expression> const   ),&clone_b39c30844f6e73f0>>();
+	};
+	// _Funcbuiltin_0x60_add_ptr_ref_b6494a0c741123d1
+	aotLib[0x508301ba3d3e5365] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ExprMakeBlock> (*) ( Context * __context__, smart_ptr_raw<ExprMakeBlock> const   ),&_Funcbuiltin_0x60_add_ptr_ref_b6494a0c741123d1>>();
+	};
+	// _Funcbuiltin_0x60_get_ptr_98dd15e167848d85
+	aotLib[0xfbfa2e866537498d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Expression * (*) ( Context * __context__, smart_ptr<Expression> const   ),&_Funcbuiltin_0x60_get_ptr_98dd15e167848d85>>();
+	};
+	// _Funcast_boost_0x60_setup_tag_annotation_4c090233d6550e84
+	aotLib[0x1c1a77c89a877884] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , char * const  , functional::FusionMacro * const   ),&_Funcast_boost_0x60_setup_tag_annotation_4c090233d6550e84>>();
+	};
+	// [[ init script ]]
+	aotLib[0xa1070f039aea2388] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
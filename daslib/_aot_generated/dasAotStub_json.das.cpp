@@ -0,0 +1,264 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require json
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require json_native
+#include "daScript/simulate/aot_builtin_json.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_2195075843105426692 {
+
+extern StructInfo __struct_info__61572b475354632e;
+extern TypeInfo __type_info__94f292fe71b59ea3;
+extern TypeInfo __type_info__af63df4c8601f1a5;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__af63d94c8601e773;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__fca5b632243378fb;
+extern TypeInfo __type_info__38850d126de4e5b1;
+extern TypeInfo __type_info__d8105ae0a96b94f9;
+extern TypeInfo __type_info__3e2a885481f71e6f;
+extern VarInfo __var_info__37c215ee4ef41c03;
+
+TypeInfo * __type_info__37c215ee4ef41c03_arg_types_var_7014122529993548590[6] = { &__type_info__3e2a885481f71e6f, &__type_info__fca5b632243378fb, &__type_info__af63ee4c86020b22, &__type_info__af63d94c8601e773, &__type_info__af63df4c8601f1a5, &__type_info__38850d126de4e5b1 };
+const char * __type_info__37c215ee4ef41c03_arg_names_var_7014122529993548590[6] = { "_object", "_array", "_string", "_number", "_bool", "_null" };
+VarInfo __struct_info__61572b475354632e_field_0 =  { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__37c215ee4ef41c03_arg_types_var_7014122529993548590, __type_info__37c215ee4ef41c03_arg_names_var_7014122529993548590, 6, 0, nullptr, 57346, 56, UINT64_C(0x37c215ee4ef41c03), "value", 0 };
+VarInfo * __struct_info__61572b475354632e_fields[1] =  { &__struct_info__61572b475354632e_field_0 };
+StructInfo __struct_info__61572b475354632e = {"JsonValue", "json", 28, __struct_info__61572b475354632e_fields, 1, 56, UINT64_C(0x0), nullptr, UINT64_C(0x61572b475354632e) };
+TypeInfo __type_info__94f292fe71b59ea3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d8105ae0a96b94f9, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x94f292fe71b59ea3) };
+TypeInfo __type_info__af63df4c8601f1a5 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf63df4c8601f1a5) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__af63d94c8601e773 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xaf63d94c8601e773) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__fca5b632243378fb = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__94f292fe71b59ea3, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, UINT64_C(0xfca5b632243378fb) };
+TypeInfo __type_info__38850d126de4e5b1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x38850d126de4e5b1) };
+TypeInfo __type_info__d8105ae0a96b94f9 = { Type::tStructure, &__struct_info__61572b475354632e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 56, UINT64_C(0xd8105ae0a96b94f9) };
+TypeInfo __type_info__3e2a885481f71e6f = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, &__type_info__94f292fe71b59ea3, nullptr, nullptr, 0, 0, nullptr, 57346, 48, UINT64_C(0x3e2a885481f71e6f) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace json { struct JsonValue; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+namespace json {
+
+struct JsonValue {
+	TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> value;
+};
+static_assert(sizeof(JsonValue)==56,"structure size mismatch with DAS");
+static_assert(offsetof(JsonValue,value)==0,"structure field offset mismatch with DAS");
+}
+
+inline json::JsonValue * JV_1cc2097e3455dd19 ( Context * __context__, char * const  __v_rename_at_24 );
+inline json::JsonValue * JV_5559450ff1b4e5a ( Context * __context__, double __v_rename_at_28 );
+inline json::JsonValue * JV_5d1e4ba7e85883b7 ( Context * __context__, bool __v_rename_at_31 );
+inline json::JsonValue * JVNull_f69e3effb8bc1460 ( Context * __context__ );
+inline json::JsonValue * JV_f17b12e37633850f ( Context * __context__, TTable<char *,json::JsonValue *> & __v_rename_at_38 );
+inline json::JsonValue * JV_bfd94f47b31832f5 ( Context * __context__, TArray<json::JsonValue *> & __v_rename_at_41 );
+inline json::JsonValue * read_json_504e61402cb5bc42 ( Context * __context__, char * const  __text_rename_at_44, char * & __error_rename_at_44 );
+inline json::JsonValue * read_json_816b5ecda3866125 ( Context * __context__, TArray<uint8_t> const  & __text_rename_at_53, char * & __error_rename_at_53 );
+inline char * write_json_a6ac510beadabf63 ( Context * __context__, json::JsonValue * const  __val_rename_at_72 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline json::JsonValue * JV_1cc2097e3455dd19 ( Context * __context__, char * const  __v_rename_at_24 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_26;
+		das_zero(__mks_26);
+		das_move((__mks_26.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_26;
+			das_get_variant_field<char *,8,2>::set(__mkv_26) = __v_rename_at_24;
+			return __mkv_26;
+		})())));
+		return __mks_26;
+	})())));
+}
+
+inline json::JsonValue * JV_5559450ff1b4e5a ( Context * __context__, double __v_rename_at_28 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_29;
+		das_zero(__mks_29);
+		das_move((__mks_29.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_29;
+			das_get_variant_field<double,8,3>::set(__mkv_29) = __v_rename_at_28;
+			return __mkv_29;
+		})())));
+		return __mks_29;
+	})())));
+}
+
+inline json::JsonValue * JV_5d1e4ba7e85883b7 ( Context * __context__, bool __v_rename_at_31 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_32;
+		das_zero(__mks_32);
+		das_move((__mks_32.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_32;
+			das_get_variant_field<bool,8,4>::set(__mkv_32) = __v_rename_at_31;
+			return __mkv_32;
+		})())));
+		return __mks_32;
+	})())));
+}
+
+inline json::JsonValue * JVNull_f69e3effb8bc1460 ( Context * __context__ )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_36;
+		das_zero(__mks_36);
+		das_move((__mks_36.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_36;
+			das_get_variant_field<void *,8,5>::set(__mkv_36) = nullptr;
+			return __mkv_36;
+		})())));
+		return __mks_36;
+	})())));
+}
+
+inline json::JsonValue * JV_f17b12e37633850f ( Context * __context__, TTable<char *,json::JsonValue *> &  __v_rename_at_38 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_39;
+		das_zero(__mks_39);
+		das_move((__mks_39.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_39;
+			das_get_variant_field<TTable<char *,json::JsonValue *>,8,0>::set(__mkv_39) = __v_rename_at_38;
+			return __mkv_39;
+		})())));
+		return __mks_39;
+	})())));
+}
+
+inline json::JsonValue * JV_bfd94f47b31832f5 ( Context * __context__, TArray<json::JsonValue *> &  __v_rename_at_41 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_42;
+		das_zero(__mks_42);
+		das_move((__mks_42.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_42;
+			das_get_variant_field<TArray<json::JsonValue *>,8,1>::set(__mkv_42) = __v_rename_at_41;
+			return __mkv_42;
+		})())));
+		return __mks_42;
+	})())));
+}
+
+inline json::JsonValue * read_json_504e61402cb5bc42 ( Context * __context__, char * const  __text_rename_at_44, char * & __error_rename_at_44 )
+{
+	json::JsonValue * __res_rename_at_47 = 0;
+	return das_auto_cast<json::JsonValue *>::cast(!(builtin_json_decode(__text_rename_at_44,das_auto_cast<void * const >::cast(das_ref(__context__,__res_rename_at_47)),das_ref(__context__,(__type_info__94f292fe71b59ea3)),__error_rename_at_44,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))) ? das_auto_cast<void * const >::cast(nullptr) : das_auto_cast<void * const >::cast(__res_rename_at_47));
+}
+
+inline json::JsonValue * read_json_816b5ecda3866125 ( Context * __context__, TArray<uint8_t> const  &  __text_rename_at_53, char * & __error_rename_at_53 )
+{
+	json::JsonValue * __res_rename_at_54 = 0;
+	return das_auto_cast<json::JsonValue *>::cast(!(builtin_json_decode_bytes(__text_rename_at_53,das_auto_cast<void * const >::cast(das_ref(__context__,__res_rename_at_54)),das_ref(__context__,(__type_info__94f292fe71b59ea3)),__error_rename_at_53,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))) ? das_auto_cast<void * const >::cast(nullptr) : das_auto_cast<void * const >::cast(__res_rename_at_54));
+}
+
+inline char * write_json_a6ac510beadabf63 ( Context * __context__, json::JsonValue * const  __val_rename_at_72 )
+{
+	return das_auto_cast<char *>::cast(((char *)(builtin_json_encode(das_auto_cast<void * const >::cast(das_ref(__context__,__val_rename_at_72)),das_ref(__context__,(__type_info__94f292fe71b59ea3)),true,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// JV_1cc2097e3455dd19
+	aotLib[0xb79a3c364bb743d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, char * const   ),&JV_1cc2097e3455dd19>>();
+	};
+	// JV_5559450ff1b4e5a
+	aotLib[0xb925a0a214114425] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, double  ),&JV_5559450ff1b4e5a>>();
+	};
+	// JV_5d1e4ba7e85883b7
+	aotLib[0x590b0ea26c22d371] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, bool  ),&JV_5d1e4ba7e85883b7>>();
+	};
+	// JVNull_f69e3effb8bc1460
+	aotLib[0xd098378fe88b722d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__ ),&JVNull_f69e3effb8bc1460>>();
+	};
+	// JV_f17b12e37633850f
+	aotLib[0xd5124109bd7c8175] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, TTable<char *,json::JsonValue *> &  ),&JV_f17b12e37633850f>>();
+	};
+	// JV_bfd94f47b31832f5
+	aotLib[0x21e9b1e35f7128a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, TArray<json::JsonValue *> &  ),&JV_bfd94f47b31832f5>>();
+	};
+	// read_json_504e61402cb5bc42
+	aotLib[0x1d594c55ce2fedb9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, char * const  , char * &  ),&read_json_504e61402cb5bc42>>();
+	};
+	// read_json_816b5ecda3866125
+	aotLib[0xf6e911bfaa7931c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, TArray<uint8_t> const  & , char * &  ),&read_json_816b5ecda3866125>>();
+	};
+	// write_json_a6ac510beadabf63
+	aotLib[0x4e4b93c4b80e05a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, json::JsonValue * const   ),&write_json_a6ac510beadabf63>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
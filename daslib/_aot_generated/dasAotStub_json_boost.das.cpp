@@ -0,0 +1,642 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require json_boost
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require json_native
+#include "daScript/simulate/aot_builtin_json.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require json
+ // require strings_boost
+ // require ast_boost
+ // require contracts
+ // require templates
+ // require array_boost
+ // require algorithm
+ // require templates_boost
+ // require macro_boost
+ // require defer
+ // require apply
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10221818404346577020 {
+
+extern TypeInfo __type_info__77efc39caeffeb07;
+extern TypeInfo __type_info__2548679d1136a5b3;
+
+TypeInfo __type_info__77efc39caeffeb07 = { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0x77efc39caeffeb07) };
+TypeInfo __type_info__2548679d1136a5b3 = { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0x2548679d1136a5b3) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__2548679d1136a5b3 };
+TypeInfo * __tinfo_1[1] = { &__type_info__77efc39caeffeb07 };
+namespace json_boost { struct BetterJsonMacro; };
+namespace json_boost { struct JsonReader; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace json { struct JsonValue; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace contracts { struct IsAnyType; };
+namespace contracts { struct IsAnyArrayMacro; };
+namespace contracts { struct IsDimMacro; };
+namespace contracts { struct IsNotDimMacro; };
+namespace contracts { struct IsAnyEnumMacro; };
+namespace contracts { struct IsAnyVectorType; };
+namespace contracts { struct IsAnyStructMacro; };
+namespace contracts { struct IsAnyNumericMacro; };
+namespace contracts { struct IsAnyWorkhorse; };
+namespace contracts { struct IsAnyWorkhorseNonPtrMacro; };
+namespace contracts { struct IsAnyTupleNonPtrMacro; };
+namespace contracts { struct IsAnyVariantNonPtrMacro; };
+namespace contracts { struct IsAnyFunctionNonPtrMacro; };
+namespace templates { struct DecltypeMacro; };
+namespace templates { struct DecltypeNoRefMacro; };
+namespace templates { struct TemplateMacro; };
+namespace templates_boost { struct Template; };
+namespace templates_boost { struct TemplateVisitor; };
+namespace templates_boost { struct RemoveDerefVisitor; };
+namespace templates_boost { struct QRulesVisitor; };
+namespace templates_boost { struct AstQCallMacro; };
+namespace templates_boost { struct QMacro; };
+namespace templates_boost { struct QBlockMacro; };
+namespace templates_boost { struct QBlockExprMacro; };
+namespace templates_boost { struct QTypeMacro; };
+namespace templates_boost { struct AstQNamedMacro; };
+namespace templates_boost { struct AstQFunctionMacro; };
+namespace templates_boost { struct AstQVariableMacro; };
+namespace templates_boost { struct AstQNamedClassMacro; };
+namespace templates_boost { struct AstQMethodMacro; };
+namespace macro_boost { struct MacroVerifyMacro; };
+namespace defer { struct DeferMacro; };
+namespace defer { struct DeferDeleteMacro; };
+namespace apply { struct ApplyMacro; };
+// unused enumeration CompilationError
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+	none = int32_t(INT64_C(0)),
+	autoinfer = int32_t(INT64_C(1)),
+	alias = int32_t(INT64_C(2)),
+	fakeContext = int32_t(INT64_C(3)),
+	fakeLineInfo = int32_t(INT64_C(4)),
+	anyArgument = int32_t(INT64_C(5)),
+	tVoid = int32_t(INT64_C(6)),
+	tBool = int32_t(INT64_C(7)),
+	tInt64 = int32_t(INT64_C(12)),
+	tUInt64 = int32_t(INT64_C(13)),
+	tInt = int32_t(INT64_C(14)),
+	tInt2 = int32_t(INT64_C(15)),
+	tInt3 = int32_t(INT64_C(16)),
+	tInt4 = int32_t(INT64_C(17)),
+	tUInt = int32_t(INT64_C(18)),
+	tUInt2 = int32_t(INT64_C(19)),
+	tUInt3 = int32_t(INT64_C(20)),
+	tUInt4 = int32_t(INT64_C(21)),
+	tFloat = int32_t(INT64_C(22)),
+	tFloat2 = int32_t(INT64_C(23)),
+	tFloat3 = int32_t(INT64_C(24)),
+	tFloat4 = int32_t(INT64_C(25)),
+	tDouble = int32_t(INT64_C(26)),
+	tRange = int32_t(INT64_C(27)),
+	tURange = int32_t(INT64_C(28)),
+	tString = int32_t(INT64_C(29)),
+	tStructure = int32_t(INT64_C(30)),
+	tHandle = int32_t(INT64_C(31)),
+	tEnumeration = int32_t(INT64_C(32)),
+	tPointer = int32_t(INT64_C(36)),
+	tFunction = int32_t(INT64_C(37)),
+	tLambda = int32_t(INT64_C(38)),
+	tIterator = int32_t(INT64_C(39)),
+	tArray = int32_t(INT64_C(40)),
+	tTable = int32_t(INT64_C(41)),
+	tBlock = int32_t(INT64_C(42)),
+	tInt8 = int32_t(INT64_C(8)),
+	tUInt8 = int32_t(INT64_C(9)),
+	tInt16 = int32_t(INT64_C(10)),
+	tUInt16 = int32_t(INT64_C(11)),
+	tTuple = int32_t(INT64_C(43)),
+	tEnumeration8 = int32_t(INT64_C(33)),
+	tEnumeration16 = int32_t(INT64_C(34)),
+	tVariant = int32_t(INT64_C(44)),
+	tBitfield = int32_t(INT64_C(35)),
+};
+}
+#endif // external enum
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+namespace ast {
+
+struct AstVariantMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstVariantMacro)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+};
+static_assert(sizeof(AstVariantMacro)==40,"structure size mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprIsVariant)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprAsVariant)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprSafeAsVariant)==32,"structure field offset mismatch with DAS");
+}
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+namespace ast {
+
+struct AstReaderMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstReaderMacro)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(AstReaderMacro)==32,"structure size mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,accept)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,visit)==24,"structure field offset mismatch with DAS");
+}
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+namespace json {
+
+struct JsonValue {
+	TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> value;
+};
+static_assert(sizeof(JsonValue)==56,"structure size mismatch with DAS");
+static_assert(offsetof(JsonValue,value)==0,"structure field offset mismatch with DAS");
+}
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+// unused structure IsAnyType
+// unused structure IsAnyArrayMacro
+// unused structure IsDimMacro
+// unused structure IsNotDimMacro
+// unused structure IsAnyEnumMacro
+// unused structure IsAnyVectorType
+// unused structure IsAnyStructMacro
+// unused structure IsAnyNumericMacro
+// unused structure IsAnyWorkhorse
+// unused structure IsAnyWorkhorseNonPtrMacro
+// unused structure IsAnyTupleNonPtrMacro
+// unused structure IsAnyVariantNonPtrMacro
+// unused structure IsAnyFunctionNonPtrMacro
+// unused structure DecltypeMacro
+// unused structure DecltypeNoRefMacro
+// unused structure TemplateMacro
+// unused structure Template
+// unused structure TemplateVisitor
+// unused structure RemoveDerefVisitor
+// unused structure QRulesVisitor
+// unused structure AstQCallMacro
+// unused structure QMacro
+// unused structure QBlockMacro
+// unused structure QBlockExprMacro
+// unused structure QTypeMacro
+// unused structure AstQNamedMacro
+// unused structure AstQFunctionMacro
+// unused structure AstQVariableMacro
+// unused structure AstQNamedClassMacro
+// unused structure AstQMethodMacro
+// unused structure MacroVerifyMacro
+// unused structure DeferMacro
+// unused structure DeferDeleteMacro
+// unused structure ApplyMacro
+namespace json_boost {
+
+struct BetterJsonMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstVariantMacro)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+};
+static_assert(sizeof(BetterJsonMacro)==40,"structure size mismatch with DAS");
+static_assert(offsetof(BetterJsonMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterJsonMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterJsonMacro,visitExprIsVariant)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterJsonMacro,visitExprAsVariant)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterJsonMacro,visitExprSafeAsVariant)==32,"structure field offset mismatch with DAS");
+}
+namespace json_boost {
+
+struct JsonReader {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstReaderMacro)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(JsonReader)==32,"structure size mismatch with DAS");
+static_assert(offsetof(JsonReader,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(JsonReader,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(JsonReader,accept)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(JsonReader,visit)==24,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_push_8a912cf78b25d2e6 ( Context * __context__, TArray<ast::AstVariantMacro *> & __Arr_rename_at_75, ast::AstVariantMacro * const  __value_rename_at_75 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_51a3ef2ecd81979a ( Context * __context__, json_boost::BetterJsonMacro const  & __cl_rename_at_86 );
+inline void _Funcbuiltin_0x60_push_3829c23a64340ec ( Context * __context__, TArray<ast::AstReaderMacro *> & __Arr_rename_at_75, ast::AstReaderMacro * const  __value_rename_at_75 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_83dd752c41dcab69 ( Context * __context__, json_boost::JsonReader const  & __cl_rename_at_86 );
+inline bool is_json_ptr_value_3d160b055d6ea055 ( Context * __context__, smart_ptr_raw<TypeDecl> const  __td_rename_at_18 );
+inline json::JsonValue * JV_29c2b5b33818b86c ( Context * __context__, float __v_rename_at_276 );
+inline json::JsonValue * JV_6622951aed6ee0ee ( Context * __context__, int32_t __v_rename_at_279 );
+inline json::JsonValue * JV_49f2b952a360e00c ( Context * __context__, Bitfield __v_rename_at_282 );
+inline json::JsonValue * JV_34967019502a64e7 ( Context * __context__, int8_t __val_rename_at_285 );
+inline json::JsonValue * JV_39223a40f88cc681 ( Context * __context__, uint8_t __val_rename_at_288 );
+inline json::JsonValue * JV_3942d24d3c8451ca ( Context * __context__, int16_t __val_rename_at_291 );
+inline json::JsonValue * JV_164b1e3e11380406 ( Context * __context__, uint16_t __val_rename_at_294 );
+inline json::JsonValue * JV_ff440a0f393eb30c ( Context * __context__, uint32_t __val_rename_at_297 );
+inline json::JsonValue * JV_a57c1fbeff8905d8 ( Context * __context__, int64_t __val_rename_at_300 );
+inline json::JsonValue * JV_cf8fa87a30edfe8 ( Context * __context__, uint64_t __val_rename_at_306 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_push_8a912cf78b25d2e6 ( Context * __context__, TArray<ast::AstVariantMacro *> &  __Arr_rename_at_75, ast::AstVariantMacro * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<ast::AstVariantMacro *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_51a3ef2ecd81979a ( Context * __context__, json_boost::BetterJsonMacro const  &  __cl_rename_at_86 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo const  *>::cast(__cl_rename_at_86.__rtti)->structType /*structType*/));
+}
+
+inline void _Funcbuiltin_0x60_push_3829c23a64340ec ( Context * __context__, TArray<ast::AstReaderMacro *> &  __Arr_rename_at_75, ast::AstReaderMacro * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<ast::AstReaderMacro *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_83dd752c41dcab69 ( Context * __context__, json_boost::JsonReader const  &  __cl_rename_at_86 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo const  *>::cast(__cl_rename_at_86.__rtti)->structType /*structType*/));
+}
+
+inline bool is_json_ptr_value_3d160b055d6ea055 ( Context * __context__, smart_ptr_raw<TypeDecl> const  __td_rename_at_18 )
+{
+	if ( __td_rename_at_18->baseType /*baseType*/ != DAS_COMMENT(bound_enum) das::Type::tPointer )
+	{
+		return das_auto_cast<bool>::cast(false);
+	} else {
+		if ( equ_sptr_ptr(das_auto_cast<smart_ptr_raw<void> const  &>::cast(__td_rename_at_18->firstType /*firstType*/),das_auto_cast<void * const >::cast(nullptr)) )
+		{
+			return das_auto_cast<bool>::cast(false);
+		} else {
+			if ( __td_rename_at_18->firstType /*firstType*/->baseType /*baseType*/ != DAS_COMMENT(bound_enum) das::Type::tStructure )
+			{
+				return das_auto_cast<bool>::cast(false);
+			} else {
+				Structure * __st_rename_at_25 = ((Structure *)__td_rename_at_18->firstType /*firstType*/->structType /*structType*/);
+				return das_auto_cast<bool>::cast(((neq_dstr_str(__st_rename_at_25->name /*name*/,((char *) "JsonValue"))) && (neq_dstr_str(__st_rename_at_25->module /*_module*/->name /*name*/,((char *) "json")))) ? das_auto_cast<bool>::cast(false) : das_auto_cast<bool>::cast(true));
+			};
+		};
+	};
+}
+
+inline json::JsonValue * JV_29c2b5b33818b86c ( Context * __context__, float __v_rename_at_276 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_277;
+		das_zero(__mks_277);
+		das_move((__mks_277.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_277;
+			das_get_variant_field<double,8,3>::set(__mkv_277) = double(__v_rename_at_276);
+			return __mkv_277;
+		})())));
+		return __mks_277;
+	})())));
+}
+
+inline json::JsonValue * JV_6622951aed6ee0ee ( Context * __context__, int32_t __v_rename_at_279 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_280;
+		das_zero(__mks_280);
+		das_move((__mks_280.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_280;
+			das_get_variant_field<double,8,3>::set(__mkv_280) = double(__v_rename_at_279);
+			return __mkv_280;
+		})())));
+		return __mks_280;
+	})())));
+}
+
+inline json::JsonValue * JV_49f2b952a360e00c ( Context * __context__, Bitfield __v_rename_at_282 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_283;
+		das_zero(__mks_283);
+		das_move((__mks_283.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_283;
+			das_get_variant_field<double,8,3>::set(__mkv_283) = double(__v_rename_at_282);
+			return __mkv_283;
+		})())));
+		return __mks_283;
+	})())));
+}
+
+inline json::JsonValue * JV_34967019502a64e7 ( Context * __context__, int8_t __val_rename_at_285 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_286;
+		das_zero(__mks_286);
+		das_move((__mks_286.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_286;
+			das_get_variant_field<double,8,3>::set(__mkv_286) = double(__val_rename_at_285);
+			return __mkv_286;
+		})())));
+		return __mks_286;
+	})())));
+}
+
+inline json::JsonValue * JV_39223a40f88cc681 ( Context * __context__, uint8_t __val_rename_at_288 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_289;
+		das_zero(__mks_289);
+		das_move((__mks_289.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_289;
+			das_get_variant_field<double,8,3>::set(__mkv_289) = double(__val_rename_at_288);
+			return __mkv_289;
+		})())));
+		return __mks_289;
+	})())));
+}
+
+inline json::JsonValue * JV_3942d24d3c8451ca ( Context * __context__, int16_t __val_rename_at_291 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_292;
+		das_zero(__mks_292);
+		das_move((__mks_292.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_292;
+			das_get_variant_field<double,8,3>::set(__mkv_292) = double(__val_rename_at_291);
+			return __mkv_292;
+		})())));
+		return __mks_292;
+	})())));
+}
+
+inline json::JsonValue * JV_164b1e3e11380406 ( Context * __context__, uint16_t __val_rename_at_294 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_295;
+		das_zero(__mks_295);
+		das_move((__mks_295.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_295;
+			das_get_variant_field<double,8,3>::set(__mkv_295) = double(__val_rename_at_294);
+			return __mkv_295;
+		})())));
+		return __mks_295;
+	})())));
+}
+
+inline json::JsonValue * JV_ff440a0f393eb30c ( Context * __context__, uint32_t __val_rename_at_297 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_298;
+		das_zero(__mks_298);
+		das_move((__mks_298.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_298;
+			das_get_variant_field<double,8,3>::set(__mkv_298) = double(__val_rename_at_297);
+			return __mkv_298;
+		})())));
+		return __mks_298;
+	})())));
+}
+
+inline json::JsonValue * JV_a57c1fbeff8905d8 ( Context * __context__, int64_t __val_rename_at_300 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(((__val_rename_at_300 < INT64_C(-2147483648)) || (__val_rename_at_300 > INT64_C(2147483647))) ? das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_302;
+		das_zero(__mks_302);
+		das_move((__mks_302.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_302;
+			das_get_variant_field<char *,8,2>::set(__mkv_302) = das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<int64_t>::from(__val_rename_at_300)));
+			return __mkv_302;
+		})())));
+		return __mks_302;
+	})()))) : das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_304;
+		das_zero(__mks_304);
+		das_move((__mks_304.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_304;
+			das_get_variant_field<double,8,3>::set(__mkv_304) = double(__val_rename_at_300);
+			return __mkv_304;
+		})())));
+		return __mks_304;
+	})()))));
+}
+
+inline json::JsonValue * JV_cf8fa87a30edfe8 ( Context * __context__, uint64_t __val_rename_at_306 )
+{
+	return das_auto_cast<json::JsonValue *>::cast((__val_rename_at_306 > UINT64_C(0xffffffff)) ? das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_308;
+		das_zero(__mks_308);
+		das_move((__mks_308.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_308;
+			das_get_variant_field<char *,8,2>::set(__mkv_308) = das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<uint64_t>::from(__val_rename_at_306)));
+			return __mkv_308;
+		})())));
+		return __mks_308;
+	})()))) : das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_310;
+		das_zero(__mks_310);
+		das_move((__mks_310.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_310;
+			das_get_variant_field<double,8,3>::set(__mkv_310) = double(__val_rename_at_306);
+			return __mkv_310;
+		})())));
+		return __mks_310;
+	})()))));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_push_8a912cf78b25d2e6
+	aotLib[0x5d076123f48d8965] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<ast::AstVariantMacro *> & , ast::AstVariantMacro * const   ),&_Funcbuiltin_0x60_push_8a912cf78b25d2e6>>();
+	};
+	// _Funcrtti_0x60_class_info_51a3ef2ecd81979a
+	aotLib[0xd8338058e7cc1af5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, json_boost::BetterJsonMacro const  &  ),&_Funcrtti_0x60_class_info_51a3ef2ecd81979a>>();
+	};
+	// _Funcbuiltin_0x60_push_3829c23a64340ec
+	aotLib[0x879f8f534dcbbee9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<ast::AstReaderMacro *> & , ast::AstReaderMacro * const   ),&_Funcbuiltin_0x60_push_3829c23a64340ec>>();
+	};
+	// _Funcrtti_0x60_class_info_83dd752c41dcab69
+	aotLib[0x8a6e44d1d5548de5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, json_boost::JsonReader const  &  ),&_Funcrtti_0x60_class_info_83dd752c41dcab69>>();
+	};
+	// is_json_ptr_value_3d160b055d6ea055
+	aotLib[0x5ee8eaee540bc565] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, smart_ptr_raw<TypeDecl> const   ),&is_json_ptr_value_3d160b055d6ea055>>();
+	};
+	// JV_29c2b5b33818b86c
+	aotLib[0xdb4b89ea070189d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, float  ),&JV_29c2b5b33818b86c>>();
+	};
+	// JV_6622951aed6ee0ee
+	aotLib[0xe2a2a72bc6de3d9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, int32_t  ),&JV_6622951aed6ee0ee>>();
+	};
+	// JV_49f2b952a360e00c
+	aotLib[0x8d7688522291e485] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, Bitfield  ),&JV_49f2b952a360e00c>>();
+	};
+	// JV_34967019502a64e7
+	aotLib[0xcdbb03ae885436d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, int8_t  ),&JV_34967019502a64e7>>();
+	};
+	// JV_39223a40f88cc681
+	aotLib[0xf611094afcf16dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, uint8_t  ),&JV_39223a40f88cc681>>();
+	};
+	// JV_3942d24d3c8451ca
+	aotLib[0x89cf0b7cd8adcf11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, int16_t  ),&JV_3942d24d3c8451ca>>();
+	};
+	// JV_164b1e3e11380406
+	aotLib[0xc7a02924f27ebb25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, uint16_t  ),&JV_164b1e3e11380406>>();
+	};
+	// JV_ff440a0f393eb30c
+	aotLib[0x4537ba0f2a49fa05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, uint32_t  ),&JV_ff440a0f393eb30c>>();
+	};
+	// JV_a57c1fbeff8905d8
+	aotLib[0xfcd7582ebdd9728d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, int64_t  ),&JV_a57c1fbeff8905d8>>();
+	};
+	// JV_cf8fa87a30edfe8
+	aotLib[0xec8b8feaecd64b99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, uint64_t  ),&JV_cf8fa87a30edfe8>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
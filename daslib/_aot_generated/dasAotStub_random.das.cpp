@@ -0,0 +1,341 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require random
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9039956065963159497 {
+
+extern StructInfo __struct_info__33f02245ac379824;
+extern TypeInfo __type_info__90f4c07b5a6e390;
+extern TypeInfo __type_info__bd1ca1a12326f62c;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__7bf4f07b489d184;
+extern TypeInfo __type_info__625436de3da05672;
+extern VarInfo __var_info__b9fabb68d396fb30;
+extern VarInfo __var_info__d3edcc52aea8a6c5;
+extern VarInfo __var_info__d98124f72663189c;
+extern VarInfo __var_info__115d64b2fa417165;
+extern VarInfo __var_info__58142e5f92354853;
+
+TypeInfo * __type_info__115d64b2fa417165_arg_types_var_3742528972982294564[2] = { &__type_info__625436de3da05672, &__type_info__7bf4f07b489d184 };
+VarInfo __struct_info__33f02245ac379824_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__115d64b2fa417165_arg_types_var_3742528972982294564, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x115d64b2fa417165), "__lambda", 0 };
+TypeInfo * __type_info__d98124f72663189c_arg_types_var_3742528972982294564[1] = { &__type_info__bd1ca1a12326f62c };
+VarInfo __struct_info__33f02245ac379824_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__d98124f72663189c_arg_types_var_3742528972982294564, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xd98124f72663189c), "__finalize", 8 };
+VarInfo __struct_info__33f02245ac379824_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x58142e5f92354853), "__yield", 16 };
+VarInfo __struct_info__33f02245ac379824_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xb9fabb68d396fb30), "rnd_seed", 20 };
+VarInfo __struct_info__33f02245ac379824_field_4 =  { Type::tInt4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 16, UINT64_C(0xd3edcc52aea8a6c5), "seed", 24 };
+VarInfo * __struct_info__33f02245ac379824_fields[5] =  { &__struct_info__33f02245ac379824_field_0, &__struct_info__33f02245ac379824_field_1, &__struct_info__33f02245ac379824_field_2, &__struct_info__33f02245ac379824_field_3, &__struct_info__33f02245ac379824_field_4 };
+StructInfo __struct_info__33f02245ac379824 = {"_lambda_random_84_8_1", "random", 6, __struct_info__33f02245ac379824_fields, 5, 40, UINT64_C(0x0), nullptr, UINT64_C(0x33f02245ac379824) };
+TypeInfo __type_info__90f4c07b5a6e390 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0x90f4c07b5a6e390) };
+TypeInfo __type_info__bd1ca1a12326f62c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__625436de3da05672, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xbd1ca1a12326f62c) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__7bf4f07b489d184 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0x7bf4f07b489d184) };
+TypeInfo __type_info__625436de3da05672 = { Type::tStructure, &__struct_info__33f02245ac379824, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 40, UINT64_C(0x625436de3da05672) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace random { struct _lambda_random_84_8_1; };
+namespace random {
+
+struct _lambda_random_84_8_1 {
+	Func DAS_COMMENT((bool,random::_lambda_random_84_8_1,uint32_t &)) __lambda;
+	Func DAS_COMMENT((void,random::_lambda_random_84_8_1 *)) __finalize;
+	int32_t __yield;
+	int32_t rnd_seed;
+	int4 seed;
+};
+static_assert(sizeof(_lambda_random_84_8_1)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_random_84_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_random_84_8_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_random_84_8_1,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_random_84_8_1,rnd_seed)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_random_84_8_1,seed)==24,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_dd7c6f2936b0a6f8 ( Context * __context__, random::_lambda_random_84_8_1 & ____this_rename_at_84 );
+inline Sequence DAS_COMMENT((uint32_t)) _Funcbuiltin_0x60_each_2ec1343166f40d4f ( Context * __context__, Lambda DAS_COMMENT((bool,uint32_t &)) const  __lam_rename_at_480 );
+inline bool _Func_lambda_random_84_8_1_0x60_function_aa0b4bb585a6e5f8 ( Context * __context__, random::_lambda_random_84_8_1 & ____this_rename_at_84, uint32_t & ___yield_84_rename_at_84 );
+inline void _Func_lambda_random_84_8_1_0x60_finalizer_608cd370d113af88 ( Context * __context__, random::_lambda_random_84_8_1 * ____this_rename_at_84 );
+inline int4 random_seed_40d32f1495a9708e ( Context * __context__, int32_t __seed_rename_at_13 );
+inline float4 random_seed2D_ae989717cef1a9 ( Context * __context__, int4 & __seed_rename_at_17, int2 __co_rename_at_17, int32_t __cf_rename_at_17 );
+inline int32_t random_int_146f4cbc5aba3b21 ( Context * __context__, int4 & __seed_rename_at_23 );
+inline int32_t random_big_int_1121aa31acceffb7 ( Context * __context__, int4 & __seed_rename_at_28 );
+inline uint32_t random_uint_a20ddd90c3d8cc59 ( Context * __context__, int4 & __seed_rename_at_34 );
+inline int4 random_int4_328b2382cfdb0a5d ( Context * __context__, int4 & __seed_rename_at_40 );
+inline float random_float_d52cfc74a117bcdc ( Context * __context__, int4 & __seed_rename_at_45 );
+inline float4 random_float4_8045f5bc0acfeef2 ( Context * __context__, int4 & __seed_rename_at_49 );
+inline float3 random_unit_vector_fbd4a09c103a1d75 ( Context * __context__, int4 & __seed_rename_at_53 );
+inline float3 random_in_unit_sphere_825789d047fbf19b ( Context * __context__, int4 & __seed_rename_at_63 );
+inline float3 random_in_unit_disk_d059eebe79cc7bca ( Context * __context__, int4 & __seed_rename_at_72 );
+inline Sequence DAS_COMMENT((uint32_t)) each_random_uint_4dcf9ef186eae7be ( Context * __context__, int32_t __rnd_seed_rename_at_82 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x631b65186da051bd>(__context__) = 32767;/*LCG_RAND_MAX*/
+	das_global<int32_t,0x12e504fdf70159ba>(__context__) = 1073741823;/*LCG_RAND_MAX_BIG*/
+	das_global<float,0x4ad3ade19e4ca1c8>(__context__) = 3.05185094e-05f;/*LCG_IRAND_MAX_FLT*/
+}
+
+inline void finalize_dd7c6f2936b0a6f8 ( Context * __context__, random::_lambda_random_84_8_1 &  ____this_rename_at_84 )
+{
+	memset(&(____this_rename_at_84), 0, 40);
+}
+
+inline Sequence DAS_COMMENT((uint32_t)) _Funcbuiltin_0x60_each_2ec1343166f40d4f ( Context * __context__, Lambda DAS_COMMENT((bool,uint32_t &)) const  __lam_rename_at_480 )
+{
+	Sequence DAS_COMMENT((uint32_t)) __it_rename_at_482; das_zero(__it_rename_at_482);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__it_rename_at_482),__lam_rename_at_480,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((uint32_t))>::cast(__it_rename_at_482);
+}
+
+inline bool _Func_lambda_random_84_8_1_0x60_function_aa0b4bb585a6e5f8 ( Context * __context__, random::_lambda_random_84_8_1 &  ____this_rename_at_84, uint32_t & ___yield_84_rename_at_84 )
+{
+	switch (____this_rename_at_84.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_84.seed,random_seed_40d32f1495a9708e(__context__,____this_rename_at_84.rnd_seed));
+	label_2:;;
+	das_copy(___yield_84_rename_at_84,random_uint_a20ddd90c3d8cc59(__context__,____this_rename_at_84.seed));
+	das_copy(____this_rename_at_84.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	goto label_2;
+	label_3:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_random_84_8_1_0x60_finalizer_608cd370d113af88 ( Context * __context__, random::_lambda_random_84_8_1 * ____this_rename_at_84 )
+{
+	finalize_dd7c6f2936b0a6f8(__context__,das_arg<random::_lambda_random_84_8_1>::pass(das_deref(__context__,____this_rename_at_84)));
+	das_delete_lambda_struct<random::_lambda_random_84_8_1 *>::clear(__context__,____this_rename_at_84);
+}
+
+inline int4 random_seed_40d32f1495a9708e ( Context * __context__, int32_t __seed_rename_at_13 )
+{
+	return das_auto_cast<int4>::cast(int4(__seed_rename_at_13,__seed_rename_at_13 + 1,__seed_rename_at_13 + 2,__seed_rename_at_13 + 3));
+}
+
+inline float4 random_seed2D_ae989717cef1a9 ( Context * __context__, int4 & __seed_rename_at_17, int2 __co_rename_at_17, int32_t __cf_rename_at_17 )
+{
+	float __prnd_rename_at_19 = ((float)(SimPolicy<float>::Sin(dot2(cvt_ifloat2(das_swizzle_seq<int2,int2 const ,0>::swizzle(__co_rename_at_17) /*xy*/),v_make_vec4f(12.9898005f,78.2330017f,0.f,0.f)),*__context__,nullptr) * 43758.5469f));
+	das_copy(__seed_rename_at_17,random_seed_40d32f1495a9708e(__context__,int32_t(__prnd_rename_at_19) + __cf_rename_at_17));
+	return das_auto_cast<float4>::cast(random_float4_8045f5bc0acfeef2(__context__,__seed_rename_at_17));
+}
+
+inline int32_t random_int_146f4cbc5aba3b21 ( Context * __context__, int4 & __seed_rename_at_23 )
+{
+	das_copy(das_swizzle_ref<int32_t,int4,0>::swizzle(__seed_rename_at_23) /*x*/,(v_extract_xi(v_cast_vec4i(__seed_rename_at_23)) /*x*/ * 214013) + 2531011);
+	return das_auto_cast<int32_t>::cast(int32_t((v_extract_xi(v_cast_vec4i(__seed_rename_at_23)) /*x*/ >> 16) & 32767));
+}
+
+inline int32_t random_big_int_1121aa31acceffb7 ( Context * __context__, int4 & __seed_rename_at_28 )
+{
+	das_copy(__seed_rename_at_28,SimPolicy<int4>::Add((SimPolicy<int4>::Mul(int4(214013,214013,214013,214013),__seed_rename_at_28,*__context__,nullptr)),int4(2531011,2531011,2531011,2531011),*__context__,nullptr));
+	int2 __i12_rename_at_31 = ((int2)(SimPolicy<int2>::BinAnd((SimPolicy<int2>::BinShr(das_swizzle_seq<int2,int4,0>::swizzle(__seed_rename_at_28) /*xy*/,cast<int32_t>::from(16),*__context__,nullptr)),int2(32767,32767),*__context__,nullptr)));
+	return das_auto_cast<int32_t>::cast(v_extract_xi(v_cast_vec4i(__i12_rename_at_31)) /*x*/ + (v_extract_yi(v_cast_vec4i(__i12_rename_at_31)) /*y*/ * 32768));
+}
+
+inline uint32_t random_uint_a20ddd90c3d8cc59 ( Context * __context__, int4 & __seed_rename_at_34 )
+{
+	das_copy(__seed_rename_at_34,SimPolicy<int4>::Add((SimPolicy<int4>::Mul(int4(214013,214013,214013,214013),__seed_rename_at_34,*__context__,nullptr)),int4(2531011,2531011,2531011,2531011),*__context__,nullptr));
+	int3 __i123_rename_at_37 = ((int3)(SimPolicy<int3>::BinAnd((SimPolicy<int3>::BinShr(das_swizzle_seq<int3,int4,0>::swizzle(__seed_rename_at_34) /*xyz*/,cast<int32_t>::from(16),*__context__,nullptr)),int3(32767,32767,32767),*__context__,nullptr)));
+	return das_auto_cast<uint32_t>::cast((uint32_t(v_extract_xi(v_cast_vec4i(__i123_rename_at_37)) /*x*/) ^ (uint32_t(v_extract_yi(v_cast_vec4i(__i123_rename_at_37)) /*y*/) << 0xfu)) ^ (uint32_t(v_extract_zi(v_cast_vec4i(__i123_rename_at_37)) /*z*/) << 0x1eu));
+}
+
+inline int4 random_int4_328b2382cfdb0a5d ( Context * __context__, int4 & __seed_rename_at_40 )
+{
+	das_copy(__seed_rename_at_40,SimPolicy<int4>::Add((SimPolicy<int4>::Mul(int4(214013,214013,214013,214013),__seed_rename_at_40,*__context__,nullptr)),int4(2531011,2531011,2531011,2531011),*__context__,nullptr));
+	return das_auto_cast<int4>::cast(SimPolicy<int4>::BinAnd((SimPolicy<int4>::BinShr(__seed_rename_at_40,cast<int32_t>::from(16),*__context__,nullptr)),int4(32767,32767,32767,32767),*__context__,nullptr));
+}
+
+inline float random_float_d52cfc74a117bcdc ( Context * __context__, int4 & __seed_rename_at_45 )
+{
+	return das_auto_cast<float>::cast(float(random_int_146f4cbc5aba3b21(__context__,__seed_rename_at_45)) * 3.05185094e-05f);
+}
+
+inline float4 random_float4_8045f5bc0acfeef2 ( Context * __context__, int4 & __seed_rename_at_49 )
+{
+	return das_auto_cast<float4>::cast(SimPolicy<float4>::Mul(cvt_ifloat4(random_int4_328b2382cfdb0a5d(__context__,__seed_rename_at_49)),v_splats(3.05185094e-05f),*__context__,nullptr));
+}
+
+inline float3 random_unit_vector_fbd4a09c103a1d75 ( Context * __context__, int4 & __seed_rename_at_53 )
+{
+	float4 __zz_rename_at_55 = ((float4)random_float4_8045f5bc0acfeef2(__context__,__seed_rename_at_53));
+	float __z_rename_at_56 = ((float)((v_extract_x(__zz_rename_at_55) /*x*/ * 2.f) - 1.f));
+	float __a_rename_at_57 = ((float)(v_extract_y(__zz_rename_at_55) /*y*/ * 6.28318548f));
+	float __r_rename_at_58 = ((float)SimPolicy<float>::Sqrt(1.f - (__z_rename_at_56 * __z_rename_at_56),*__context__,nullptr));
+	float __x_rename_at_59 = 0; float __y_rename_at_59 = 0;
+	sincosF(__a_rename_at_57,__x_rename_at_59,__y_rename_at_59);
+	return das_auto_cast<float3>::cast(float3(__r_rename_at_58 * __x_rename_at_59,__r_rename_at_58 * __y_rename_at_59,__z_rename_at_56));
+}
+
+inline float3 random_in_unit_sphere_825789d047fbf19b ( Context * __context__, int4 & __seed_rename_at_63 )
+{
+	while ( true )
+	{
+		float3 __r_rename_at_66 = ((float3)das_swizzle_seq<float3,float4,0>::swizzle(random_float4_8045f5bc0acfeef2(__context__,__seed_rename_at_63)) /*xyz*/);
+		float3 __p_rename_at_67 = ((float3)(SimPolicy<float3>::Sub((SimPolicy<float3>::Mul(v_splats(2.f),__r_rename_at_66,*__context__,nullptr)),v_splats(1.f),*__context__,nullptr)));
+		if ( lengthSq3(__p_rename_at_67) <= 1.f )
+		{
+			return das_auto_cast<float3>::cast(__p_rename_at_67);
+		};
+	};
+	return das_auto_cast<float3>::cast(v_zero());
+}
+
+inline float3 random_in_unit_disk_d059eebe79cc7bca ( Context * __context__, int4 & __seed_rename_at_72 )
+{
+	while ( true )
+	{
+		float2 __R_rename_at_75 = ((float2)das_swizzle_seq<float2,float4,0>::swizzle(random_float4_8045f5bc0acfeef2(__context__,__seed_rename_at_72)) /*xy*/);
+		float3 __r_rename_at_76 = ((float3)float3(v_extract_x(__R_rename_at_75) /*x*/,v_extract_y(__R_rename_at_75) /*y*/,0.f));
+		float3 __p_rename_at_77 = ((float3)(SimPolicy<float3>::Sub((SimPolicy<float3>::Mul(v_splats(2.f),__r_rename_at_76,*__context__,nullptr)),v_make_vec4f(1.f,1.f,0.f,0.f),*__context__,nullptr)));
+		if ( lengthSq3(__p_rename_at_77) <= 1.f )
+		{
+			return das_auto_cast<float3>::cast(__p_rename_at_77);
+		};
+	};
+	return das_auto_cast<float3>::cast(v_zero());
+}
+
+inline Sequence DAS_COMMENT((uint32_t)) each_random_uint_4dcf9ef186eae7be ( Context * __context__, int32_t __rnd_seed_rename_at_82 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((uint32_t))>::cast(_Funcbuiltin_0x60_each_2ec1343166f40d4f(__context__,das_ascend<bool,random::_lambda_random_84_8_1>::make(__context__,&__type_info__625436de3da05672,(([&]() -> random::_lambda_random_84_8_1 {
+		random::_lambda_random_84_8_1 __mks_83;
+		das_zero(__mks_83);
+		das_copy((__mks_83.__lambda),(Func(__context__->fnByMangledName(/*@random::_lambda_random_84_8_1`function XS<_lambda_random_84_8_1> &u*/ 13849164179585251330u))));
+		das_copy((__mks_83.__finalize),(Func(__context__->fnByMangledName(/*@random::_lambda_random_84_8_1`finalizer X1<S<_lambda_random_84_8_1>>?*/ 8988228662111869439u))));
+		das_copy((__mks_83.rnd_seed),(__rnd_seed_rename_at_82));
+		return __mks_83;
+	})()))));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_dd7c6f2936b0a6f8
+	aotLib[0x776cb5b9675496d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, random::_lambda_random_84_8_1 &  ),&finalize_dd7c6f2936b0a6f8>>();
+	};
+	// _Funcbuiltin_0x60_each_2ec1343166f40d4f
+	aotLib[0x8574a9fcf4b0693d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((uint32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,uint32_t &)) const   ),&_Funcbuiltin_0x60_each_2ec1343166f40d4f>>();
+	};
+	// _Func_lambda_random_84_8_1_0x60_function_aa0b4bb585a6e5f8
+	aotLib[0xbb3bbf684d78207b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, random::_lambda_random_84_8_1 & , uint32_t &  ),&_Func_lambda_random_84_8_1_0x60_function_aa0b4bb585a6e5f8>>();
+	};
+	// _Func_lambda_random_84_8_1_0x60_finalizer_608cd370d113af88
+	aotLib[0xcdff1aa0d560be16] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, random::_lambda_random_84_8_1 *  ),&_Func_lambda_random_84_8_1_0x60_finalizer_608cd370d113af88>>();
+	};
+	// random_seed_40d32f1495a9708e
+	aotLib[0xa88480072784083d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int4 (*) ( Context * __context__, int32_t  ),&random_seed_40d32f1495a9708e>>();
+	};
+	// random_seed2D_ae989717cef1a9
+	aotLib[0xa778f5b98b84cb5f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float4 (*) ( Context * __context__, int4 & , int2 , int32_t  ),&random_seed2D_ae989717cef1a9>>();
+	};
+	// random_int_146f4cbc5aba3b21
+	aotLib[0xf5dca9731782be0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int4 &  ),&random_int_146f4cbc5aba3b21>>();
+	};
+	// random_big_int_1121aa31acceffb7
+	aotLib[0x6bb9cb8d4ef64d3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int4 &  ),&random_big_int_1121aa31acceffb7>>();
+	};
+	// random_uint_a20ddd90c3d8cc59
+	aotLib[0xf7c045896d1ea645] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, int4 &  ),&random_uint_a20ddd90c3d8cc59>>();
+	};
+	// random_int4_328b2382cfdb0a5d
+	aotLib[0x3dd1ad6cd8e12835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int4 (*) ( Context * __context__, int4 &  ),&random_int4_328b2382cfdb0a5d>>();
+	};
+	// random_float_d52cfc74a117bcdc
+	aotLib[0x3f7c461c2a4651d6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, int4 &  ),&random_float_d52cfc74a117bcdc>>();
+	};
+	// random_float4_8045f5bc0acfeef2
+	aotLib[0x756fea66bd1726c2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float4 (*) ( Context * __context__, int4 &  ),&random_float4_8045f5bc0acfeef2>>();
+	};
+	// random_unit_vector_fbd4a09c103a1d75
+	aotLib[0xf43b622361dfa7d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, int4 &  ),&random_unit_vector_fbd4a09c103a1d75>>();
+	};
+	// random_in_unit_sphere_825789d047fbf19b
+	aotLib[0xeda5e88ef87ec6f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, int4 &  ),&random_in_unit_sphere_825789d047fbf19b>>();
+	};
+	// random_in_unit_disk_d059eebe79cc7bca
+	aotLib[0xd431f41429660665] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, int4 &  ),&random_in_unit_disk_d059eebe79cc7bca>>();
+	};
+	// each_random_uint_4dcf9ef186eae7be
+	aotLib[0xdefbfb9f57a9ca1b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((uint32_t)) (*) ( Context * __context__, int32_t  ),&each_random_uint_4dcf9ef186eae7be>>();
+	};
+	// [[ init script ]]
+	aotLib[0xb10e493287e21043] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
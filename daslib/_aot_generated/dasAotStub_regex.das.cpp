@@ -0,0 +1,2057 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require regex
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require regex_native
+#include "daScript/simulate/aot_builtin_regex.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9878276369668962785 {
+
+extern StructInfo __struct_info__90edff79ff0df263;
+extern StructInfo __struct_info__290109a00f355a1d;
+extern TypeInfo __type_info__af63e84c860200f0;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__5bbf416596e6e12a;
+extern TypeInfo __type_info__e375858168db8b63;
+extern TypeInfo __type_info__df1d79dec7ea1f1f;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__4ae00d463a05655b;
+extern TypeInfo __type_info__1dafad4a6313ad41;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__945d78d752024f5c;
+extern TypeInfo __type_info__f95678735cf0e442;
+extern TypeInfo __type_info__6ee471041d873632;
+extern TypeInfo __type_info__af63ef4c86020cd5;
+extern VarInfo __var_info__801eea2cbd01ab82;
+extern VarInfo __var_info__46c4aae68974013c;
+extern VarInfo __var_info__f125177ee5074a2c;
+extern VarInfo __var_info__aaae75eb4558282c;
+extern VarInfo __var_info__ca591566b6160624;
+extern VarInfo __var_info__6f2a8bb3467ac7d1;
+extern VarInfo __var_info__12d7fe1ad414e6f2;
+extern VarInfo __var_info__5a36e0359ac4e7fc;
+extern VarInfo __var_info__20ea36bbd9f9b28f;
+extern VarInfo __var_info__99c9e869cdf5f631;
+extern VarInfo __var_info__332d1622b8fd2ba3;
+extern VarInfo __var_info__e08612711dd137b5;
+extern VarInfo __var_info__ca6d1566b626af2e;
+extern VarInfo __var_info__afb12e56747735bf;
+extern VarInfo __var_info__1db89f878375c2fe;
+extern VarInfo __var_info__44afa437fceca048;
+extern VarInfo __var_info__f875633c0f2dbe29;
+extern VarInfo __var_info__ca521566b60fe776;
+extern VarInfo __var_info__12760fc2ef803fc6;
+extern FuncInfo __func_info__87bf23f355201ee1;
+extern EnumInfo __enum_info__c6a7b3ce425cb39a;
+
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_0 = { "Char", 0 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_1 = { "Set", 1 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_2 = { "Any", 2 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_3 = { "Eos", 3 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_4 = { "Group", 4 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_5 = { "Plus", 5 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_6 = { "Star", 6 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_7 = { "Question", 7 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_8 = { "Concat", 8 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_9 = { "Union", 9 };
+EnumValueInfo * __enum_info__c6a7b3ce425cb39a_values [] = { &__enum_info__c6a7b3ce425cb39a_value_0, &__enum_info__c6a7b3ce425cb39a_value_1, &__enum_info__c6a7b3ce425cb39a_value_2, &__enum_info__c6a7b3ce425cb39a_value_3, &__enum_info__c6a7b3ce425cb39a_value_4, &__enum_info__c6a7b3ce425cb39a_value_5, &__enum_info__c6a7b3ce425cb39a_value_6, &__enum_info__c6a7b3ce425cb39a_value_7, &__enum_info__c6a7b3ce425cb39a_value_8, &__enum_info__c6a7b3ce425cb39a_value_9 };
+EnumInfo __enum_info__c6a7b3ce425cb39a = { "ReOp", "regex", __enum_info__c6a7b3ce425cb39a_values, 10, UINT64_C(0xc6a7b3ce425cb39a) };
+VarInfo __struct_info__90edff79ff0df263_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x6f2a8bb3467ac7d1), "root", 0 };
+VarInfo __struct_info__90edff79ff0df263_field_1 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__5bbf416596e6e12a, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, UINT64_C(0xf875633c0f2dbe29), "groups", 8 };
+uint32_t __type_info__f125177ee5074a2c_dim_var_10443284010377278051[1] = { 8 };
+VarInfo __struct_info__90edff79ff0df263_field_2 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__f125177ee5074a2c_dim_var_10443284010377278051, 30, 32, UINT64_C(0xf125177ee5074a2c), "earlyOut", 32 };
+VarInfo __struct_info__90edff79ff0df263_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x46c4aae68974013c), "canEarlyOut", 64 };
+VarInfo __struct_info__90edff79ff0df263_field_4 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__945d78d752024f5c, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x12760fc2ef803fc6), "dfa", 72 };
+VarInfo * __struct_info__90edff79ff0df263_fields[5] =  { &__struct_info__90edff79ff0df263_field_0, &__struct_info__90edff79ff0df263_field_1, &__struct_info__90edff79ff0df263_field_2, &__struct_info__90edff79ff0df263_field_3, &__struct_info__90edff79ff0df263_field_4 };
+StructInfo __struct_info__90edff79ff0df263 = {"Regex", "regex", 28, __struct_info__90edff79ff0df263_fields, 5, 80, UINT64_C(0x0), nullptr, UINT64_C(0x90edff79ff0df263) };
+VarInfo __struct_info__290109a00f355a1d_field_0 =  { Type::tEnumeration, nullptr, &__enum_info__c6a7b3ce425cb39a, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xca591566b6160624), "op", 0 };
+VarInfo __struct_info__290109a00f355a1d_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xca521566b60fe776), "id", 4 };
+TypeInfo * __type_info__afb12e56747735bf_arg_types_var_2954653413586328093[3] = { &__type_info__e375858168db8b63, &__type_info__df1d79dec7ea1f1f, &__type_info__f95678735cf0e442 };
+VarInfo __struct_info__290109a00f355a1d_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__afb12e56747735bf_arg_types_var_2954653413586328093, nullptr, 3, 0, nullptr, 28, 8, UINT64_C(0xafb12e56747735bf), "gen2", 8 };
+VarInfo __struct_info__290109a00f355a1d_field_3 =  { Type::tRange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xca6d1566b626af2e), "at", 16 };
+VarInfo __struct_info__290109a00f355a1d_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaaae75eb4558282c), "text", 24 };
+VarInfo __struct_info__290109a00f355a1d_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x332d1622b8fd2ba3), "textLen", 32 };
+VarInfo __struct_info__290109a00f355a1d_field_6 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__e375858168db8b63, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, UINT64_C(0x1db89f878375c2fe), "all", 40 };
+VarInfo __struct_info__290109a00f355a1d_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x801eea2cbd01ab82), "left", 64 };
+VarInfo __struct_info__290109a00f355a1d_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x20ea36bbd9f9b28f), "right", 72 };
+VarInfo __struct_info__290109a00f355a1d_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x5a36e0359ac4e7fc), "subexpr", 80 };
+VarInfo __struct_info__290109a00f355a1d_field_10 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x12d7fe1ad414e6f2), "next", 88 };
+uint32_t __type_info__44afa437fceca048_dim_var_2954653413586328093[1] = { 8 };
+VarInfo __struct_info__290109a00f355a1d_field_11 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__44afa437fceca048_dim_var_2954653413586328093, 30, 32, UINT64_C(0x44afa437fceca048), "cset", 96 };
+VarInfo __struct_info__290109a00f355a1d_field_12 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x99c9e869cdf5f631), "index", 128 };
+VarInfo * __struct_info__290109a00f355a1d_fields[13] =  { &__struct_info__290109a00f355a1d_field_0, &__struct_info__290109a00f355a1d_field_1, &__struct_info__290109a00f355a1d_field_2, &__struct_info__290109a00f355a1d_field_3, &__struct_info__290109a00f355a1d_field_4, &__struct_info__290109a00f355a1d_field_5, &__struct_info__290109a00f355a1d_field_6, &__struct_info__290109a00f355a1d_field_7, &__struct_info__290109a00f355a1d_field_8, &__struct_info__290109a00f355a1d_field_9, &__struct_info__290109a00f355a1d_field_10, &__struct_info__290109a00f355a1d_field_11, &__struct_info__290109a00f355a1d_field_12 };
+StructInfo __struct_info__290109a00f355a1d = {"ReNode", "regex", 28, __struct_info__290109a00f355a1d_fields, 13, 136, UINT64_C(0x0), nullptr, UINT64_C(0x290109a00f355a1d) };
+VarInfo __func_info__87bf23f355201ee1_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe08612711dd137b5), "node", 0 };
+VarInfo * __func_info__87bf23f355201ee1_fields[1] =  { &__func_info__87bf23f355201ee1_field_0 };
+FuncInfo __func_info__87bf23f355201ee1 = {"invoke block<(node:regex::ReNode?):void> const", "", __func_info__87bf23f355201ee1_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x87bf23f355201ee1), 0x0 };
+TypeInfo __type_info__af63e84c860200f0 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e84c860200f0) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo * __type_info__5bbf416596e6e12a_arg_types[2] = { &__type_info__af63ef4c86020cd5, &__type_info__af63ee4c86020b22 };
+TypeInfo __type_info__5bbf416596e6e12a = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__5bbf416596e6e12a_arg_types, nullptr, 2, 0, nullptr, 16390, 16, UINT64_C(0x5bbf416596e6e12a) };
+TypeInfo __type_info__e375858168db8b63 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe375858168db8b63) };
+TypeInfo __type_info__df1d79dec7ea1f1f = { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e84c860200f0, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xdf1d79dec7ea1f1f) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__4ae00d463a05655b = { Type::tStructure, &__struct_info__290109a00f355a1d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 136, UINT64_C(0x4ae00d463a05655b) };
+TypeInfo __type_info__1dafad4a6313ad41 = { Type::tEnumeration, nullptr, &__enum_info__c6a7b3ce425cb39a, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x1dafad4a6313ad41) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+TypeInfo __type_info__945d78d752024f5c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~regex_native::RegexDfa"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 1056, UINT64_C(0x945d78d752024f5c) };
+TypeInfo __type_info__f95678735cf0e442 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 40, UINT64_C(0xf95678735cf0e442) };
+TypeInfo __type_info__6ee471041d873632 = { Type::tStructure, &__struct_info__90edff79ff0df263, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 80, UINT64_C(0x6ee471041d873632) };
+TypeInfo __type_info__af63ef4c86020cd5 = { Type::tRange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xaf63ef4c86020cd5) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__945d78d752024f5c.resolveAnnotation();
+	__type_info__f95678735cf0e442.resolveAnnotation();
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__6ee471041d873632 };
+TypeInfo * __tinfo_1[1] = { &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_2[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__1dafad4a6313ad41 };
+TypeInfo * __tinfo_3[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_4[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63e44c8601fa24, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_5[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_6[1] = { &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_7[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_8[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_9[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_10[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_11[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_12[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_13[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_14[1] = { &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_15[2] = { &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_16[2] = { &__type_info__f95678735cf0e442, &__type_info__af63ee4c86020b22 };
+namespace regex { struct ReNode; };
+namespace regex { struct Regex; };
+namespace regex {
+
+enum class ReOp : int32_t {
+	Char = int32_t(0),
+	Set = int32_t(1),
+	Any = int32_t(2),
+	Eos = int32_t(3),
+	Group = int32_t(4),
+	Plus = int32_t(5),
+	Star = int32_t(6),
+	Question = int32_t(7),
+	Concat = int32_t(8),
+	Union = int32_t(9),
+};
+}
+}
+template <> struct cast< das::_anon_9878276369668962785::regex::ReOp > : cast_enum < das::_anon_9878276369668962785::regex::ReOp > {};
+namespace _anon_9878276369668962785 {
+namespace regex {
+
+struct ReNode {
+	DAS_COMMENT(enum) regex::ReOp op;
+	int32_t id;
+	Func DAS_COMMENT((void,regex::ReNode *,Sequence DAS_COMMENT((uint32_t)),StringBuilderWriter)) gen2;
+	range at;
+	char * text;
+	int32_t textLen;
+	TArray<regex::ReNode *> all;
+	regex::ReNode * left;
+	regex::ReNode * right;
+	regex::ReNode * subexpr;
+	regex::ReNode * next;
+	TDim<uint32_t,8> cset;
+	int32_t index;
+};
+static_assert(sizeof(ReNode)==136,"structure size mismatch with DAS");
+static_assert(offsetof(ReNode,op)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,id)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,gen2)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,at)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,text)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,textLen)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,all)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,left)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,right)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,subexpr)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,next)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,cset)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,index)==128,"structure field offset mismatch with DAS");
+}
+namespace regex {
+
+struct Regex {
+	regex::ReNode * root;
+	TArray<TTuple<16,range,char *>> groups;
+	TDim<uint32_t,8> earlyOut;
+	bool canEarlyOut;
+	das::RegexDfa * dfa;
+};
+static_assert(sizeof(Regex)==80,"structure size mismatch with DAS");
+static_assert(offsetof(Regex,root)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,groups)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,earlyOut)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,canEarlyOut)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,dfa)==72,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_13e4a05653768251 ( Context * __context__, TArray<regex::ReNode *> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_finalize_b7deb464a4f8e41c ( Context * __context__, TArray<regex::ReNode *> & __a_rename_at_399 );
+inline int32_t _Funcbuiltin_0x60_length_7938efcc1bc3eff1 ( Context * __context__, TDim<regex::ReNode *,2> const  & __a_rename_at_221 );
+inline void finalize_7420a122bf22c777 ( Context * __context__, regex::ReNode & ____this_rename_at_27 );
+inline void _Funcbuiltin_0x60_push_5459a94d4bd9a32f ( Context * __context__, TArray<TTuple<16,range,char *>> & __Arr_rename_at_75, TTuple<16,range,char *> const  & __value_rename_at_75 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_399 );
+inline void _Funcbuiltin_0x60_finalize_421bbf7456f4209b ( Context * __context__, TArray<uint32_t> & __a_rename_at_399 );
+inline regex::Regex & _Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd ( Context * __context__, regex::Regex & __a_rename_at_42 );
+inline void finalize_6293242d2ef1254f ( Context * __context__, TVariant<16,regex::ReNode *,void *> & ____this_rename_at_260 );
+inline void finalize_e041fb14490aa83b ( Context * __context__, regex::ReNode * & ____this_rename_at_335 );
+inline void _Funcbuiltin_0x60_push_5dc212b561cc93c2 ( Context * __context__, TArray<regex::ReNode *> & __Arr_rename_at_75, regex::ReNode * const  __value_rename_at_75 );
+inline TArray<regex::ReNode *> _Funcbuiltin_0x60_to_array_move_1a55d1eab5baa002 ( Context * __context__, TDim<regex::ReNode *,2> & __a_rename_at_518 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline void _Funcbuiltin_0x60_push_b1b73bc5bfdbac10 ( Context * __context__, TArray<uint32_t> & __Arr_rename_at_75, uint32_t __value_rename_at_75 );
+inline bool _Funcbuiltin_0x60_next_160159e214cdd056 ( Context * __context__, Sequence DAS_COMMENT((uint32_t)) const  & __it_rename_at_431, uint32_t & __value_rename_at_431 );
+inline uint32_t re_gen_get_rep_limit_aad39a472678db9d ( Context * __context__ );
+inline void trace_89f6695f8909b072 ( Context * __context__, char * const  __msg_rename_at_71, int32_t __offset_rename_at_71 );
+inline void note_89f6695f8909b072 ( Context * __context__, char * const  __msg_rename_at_76, int32_t __offset_rename_at_76 );
+inline void trace_backtrack_c77fe5b3ac1a6a7c ( Context * __context__ );
+inline void trace_value_4739abdd3b0a7208 ( Context * __context__, regex::ReNode * const  __value_rename_at_85 );
+inline TVariant<16,regex::ReNode *,void *> nada_5086bd0a540f8186 ( Context * __context__ );
+inline TVariant<16,regex::ReNode *,void *> maybe_4cddd0f3894095b8 ( Context * __context__, regex::ReNode * const  __value_rename_at_96 );
+inline bool eos_dde6e11fd3802ac8 ( Context * __context__, char * const  __expr_rename_at_100, int32_t __offset_rename_at_100 );
+inline int32_t at_c9bade5ff7edd57d ( Context * __context__, char * const  __expr_rename_at_103, int32_t __offset_rename_at_103 );
+inline int32_t next_47eaeae3973f3d0a ( Context * __context__, TVariant<16,regex::ReNode *,void *> const  & __re_rename_at_118 );
+inline bool is_set_empty_fb12252b2129800d ( Context * __context__, TDim<uint32_t,8> const  & __cset_rename_at_124 );
+inline void set_or_char_471888d9ed78efab ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_130, int32_t __ch_rename_at_130 );
+inline void set_or_range_a7ad44e8ef1ec07c ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_133, range __bits_rename_at_133 );
+inline void set_invert_be791c77bc6b6a11 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_137 );
+inline void set_or_set_9609a9e932b32815 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_141, TDim<uint32_t,8> const  & __eset_rename_at_141 );
+inline void set_negative_7a1fcd94df7d5358 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_145 );
+inline void set_meta_2f4780f8ef5a2b6d ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_149, int32_t __che_rename_at_149 );
+inline bool is_meta_character_24d3d25015b1373f ( Context * __context__, int32_t __ch_rename_at_178 );
+inline bool is_set_character_11f8fcca4329c870 ( Context * __context__, int32_t __ch_rename_at_181 );
+inline TVariant<16,regex::ReNode *,void *> re_char_82ce59dc4838976a ( Context * __context__, char * const  __expr_rename_at_185, int32_t __offset_rename_at_185 );
+inline TVariant<16,regex::ReNode *,void *> re_set_items_39e8d6427890060c ( Context * __context__, char * const  __expr_rename_at_208, int32_t __offset_rename_at_208 );
+inline TVariant<16,regex::ReNode *,void *> re_set_4203278ac10d8cd6 ( Context * __context__, char * const  __expr_rename_at_247, int32_t __offset_rename_at_247 );
+inline TVariant<16,regex::ReNode *,void *> re_any_effdf3f7b62b2ac1 ( Context * __context__, char * const  __expr_rename_at_272, int32_t __offset_rename_at_272 );
+inline TVariant<16,regex::ReNode *,void *> re_eos_fe251bbc0838f42e ( Context * __context__, char * const  __expr_rename_at_281, int32_t __offset_rename_at_281 );
+inline TVariant<16,regex::ReNode *,void *> re_group_3a964ad67daa5bc1 ( Context * __context__, char * const  __expr_rename_at_290, int32_t __offset_rename_at_290 );
+inline TVariant<16,regex::ReNode *,void *> re_elementary_44bc08d3b62d065a ( Context * __context__, char * const  __expr_rename_at_305, int32_t __offset_rename_at_305 );
+inline regex::ReNode * mk_concat_2c96f9e344dd637b ( Context * __context__, regex::ReNode * __left_rename_at_326, regex::ReNode * __right_rename_at_326 );
+inline regex::ReNode * mk_union_ecbeb7e14987ecd7 ( Context * __context__, regex::ReNode * __left_rename_at_350, regex::ReNode * __right_rename_at_350 );
+inline TVariant<16,regex::ReNode *,void *> re_re_ace328bebb48ab0d ( Context * __context__, char * const  __expr_rename_at_372, int32_t __offset_rename_at_372 );
+inline TVariant<16,regex::ReNode *,void *> re_basic_3a34fb27b8e53d4a ( Context * __context__, char * const  __expr_rename_at_400, int32_t __offset_rename_at_400 );
+inline regex::ReNode * re_parse_3d6f9a305b851160 ( Context * __context__, char * const  __expr_rename_at_416 );
+inline void visit_top_down_ac4526f0a41e9d37 ( Context * __context__, regex::ReNode * __node_rename_at_426, Block DAS_COMMENT((void,regex::ReNode *)) const  & __blk_rename_at_426 );
+inline void re_assign_next_1e223575dac53267 ( Context * __context__, regex::Regex & __re_rename_at_437 );
+inline void re_assign_groups_be595a29146e390c ( Context * __context__, regex::Regex & __re_rename_at_450 );
+inline void re_assign_gen_functions_e944f4542bc4b4fb ( Context * __context__, regex::Regex & __re_rename_at_462 );
+inline void re_flatten_d993754aea5776e3 ( Context * __context__, regex::ReNode * const  __node_rename_at_488, TArray<int32_t> & __code_rename_at_488, TArray<uint32_t> & __sets_rename_at_488 );
+inline void re_assign_dfa_4a49a17b076d9d70 ( Context * __context__, regex::Regex & __re_rename_at_511 );
+inline void re_update_groups_21e51441caa1c545 ( Context * __context__, regex::Regex & __regex_rename_at_523, range __at_rename_at_523 );
+inline bool re_early_out_7af43e1fb0ced133 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_532, regex::ReNode * const  __node_rename_at_532 );
+inline bool is_valid_f341200a6f682e5a ( Context * __context__, regex::Regex & __re_rename_at_571 );
+inline bool regex_compile_1c6ceefae1029905 ( Context * __context__, regex::Regex & __re_rename_at_575, char * const  __expr_rename_at_575 );
+inline regex::Regex regex_compile_cb440f6619dde35e ( Context * __context__, char * const  __expr_rename_at_588 );
+inline regex::Regex regex_compile_20788d8bca57961d ( Context * __context__, regex::Regex & __re_rename_at_594 );
+inline int32_t regex_match_119cbbc847650282 ( Context * __context__, regex::Regex & __regex_rename_at_601, char * const  __str_rename_at_601, int32_t __offset_rename_at_601 );
+inline char * regex_group_ebcd2fdc1e09d9f2 ( Context * __context__, regex::Regex const  & __regex_rename_at_611, int32_t __index_rename_at_611, char * const  __match_rename_at_611 );
+inline void regex_foreach_28ddee2cdfd7178 ( Context * __context__, regex::Regex & __regex_rename_at_616, char * const  __str_rename_at_616, Block DAS_COMMENT((bool,range)) const  & __blk_rename_at_616 );
+inline void regex_debug_4ee5eac24b27a82d ( Context * __context__, regex::Regex const  & __regex_rename_at_637 );
+inline void debug_set_6a9aba72f1044e9d ( Context * __context__, TDim<uint32_t,8> const  & __cset_rename_at_651 );
+inline void debug_re_6ef8aee9197ccd4d ( Context * __context__, regex::ReNode * const  __node_rename_at_660, int32_t __tab_rename_at_660 );
+inline int32_t rnd_set_character_f49e90c9ced30293 ( Context * __context__, TDim<uint32_t,8> const  & __cset_rename_at_716, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_716 );
+inline void re_gen2_fail_83869989d4feff33 ( Context * __context__, regex::ReNode * __node_rename_at_723, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_723, StringBuilderWriter & __str_rename_at_723 );
+inline void re_gen2_char_370fcc7fc2a0d7da ( Context * __context__, regex::ReNode * __node_rename_at_728, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_728, StringBuilderWriter & __str_rename_at_728 );
+inline void re_gen2_union_33d97a91bd270c92 ( Context * __context__, regex::ReNode * __node_rename_at_736, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_736, StringBuilderWriter & __str_rename_at_736 );
+inline void re_gen2_set_ac6c2c3df070a8b3 ( Context * __context__, regex::ReNode * __node_rename_at_745, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_745, StringBuilderWriter & __str_rename_at_745 );
+inline void re_gen2_any_1b218e3963c72de8 ( Context * __context__, regex::ReNode * __node_rename_at_753, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_753, StringBuilderWriter & __str_rename_at_753 );
+inline void re_gen2_concat_4a5931c710a8a787 ( Context * __context__, regex::ReNode * __node_rename_at_763, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_763, StringBuilderWriter & __str_rename_at_763 );
+inline void re_gen2_eos_d01cc98126afe4e7 ( Context * __context__, regex::ReNode * __node_rename_at_769, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_769, StringBuilderWriter & __str_rename_at_769 );
+inline void re_gen2_question_af2eab39b56e287d ( Context * __context__, regex::ReNode * __node_rename_at_776, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_776, StringBuilderWriter & __str_rename_at_776 );
+inline void re_gen2_plus_76a9bcb3f5e8ce53 ( Context * __context__, regex::ReNode * __node_rename_at_789, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_789, StringBuilderWriter & __str_rename_at_789 );
+inline void re_gen2_star_45edaea538181594 ( Context * __context__, regex::ReNode * __node_rename_at_803, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_803, StringBuilderWriter & __str_rename_at_803 );
+inline void re_gen2_group_9b3a7a90752f4346 ( Context * __context__, regex::ReNode * __node_rename_at_817, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_817, StringBuilderWriter & __str_rename_at_817 );
+inline char * re_gen_fb69f2af2094439b ( Context * __context__, regex::Regex & __re_rename_at_827, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_827 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<bool,0x5f00ae86cba54a79>(__context__) = false;/*log_parse_enabled*/
+	das_global<bool,0xe3b40eebb799db7>(__context__) = false;/*log_match_enabled*/
+	das_global<bool,0xdb2cb78f262cdc25>(__context__) = false;/*range_check_enabled*/
+	das_global<bool,0x65aeb70fb737f14e>(__context__) = false;/*log_gen_enabled*/
+	das_global<int32_t,0x7f437468b6b6a0da>(__context__) = 0;/*trace_tab*/
+	das_global<uint32_t,0x570cc75ae91fa86f>(__context__) = 0x8u;/*re_gen_rep_limit*/
+	das_global<char *,0x810ab8027aecb8a9>(__context__) = ((char *) "\\+-*.()[]|^");/*meta*/
+	das_global<char *,0x2ebc2ae7102a7e3c>(__context__) = ((char *) "wWsSdD");/*meta_set*/
+}
+
+inline void _Funcbuiltin_0x60_resize_13e4a05653768251 ( Context * __context__, TArray<regex::ReNode *> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<regex::ReNode *>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_b7deb464a4f8e41c ( Context * __context__, TArray<regex::ReNode *> &  __a_rename_at_399 )
+{
+	{
+		bool __need_loop_401 = true;
+		// aV : regex::ReNode? aka TT&
+		das_iterator<TArray<regex::ReNode *>> __aV_iterator(__a_rename_at_399);
+		regex::ReNode * * __aV_rename_at_401;
+		__need_loop_401 = __aV_iterator.first(__context__,(__aV_rename_at_401)) && __need_loop_401;
+		for ( ; __need_loop_401 ; __need_loop_401 = __aV_iterator.next(__context__,(__aV_rename_at_401)) )
+		{
+			finalize_e041fb14490aa83b(__context__,(*__aV_rename_at_401));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_401));
+	};
+	builtin_array_free(das_arg<TArray<regex::ReNode *>>::pass(__a_rename_at_399),8,__context__);
+}
+
+inline int32_t _Funcbuiltin_0x60_length_7938efcc1bc3eff1 ( Context * __context__, TDim<regex::ReNode *,2> const  &  __a_rename_at_221 )
+{
+	return das_auto_cast<int32_t>::cast(2);
+}
+
+inline void finalize_7420a122bf22c777 ( Context * __context__, regex::ReNode &  ____this_rename_at_27 )
+{
+	_Funcbuiltin_0x60_finalize_b7deb464a4f8e41c(__context__,das_arg<TArray<regex::ReNode *>>::pass(____this_rename_at_27.all));
+	finalize_e041fb14490aa83b(__context__,____this_rename_at_27.left);
+	finalize_e041fb14490aa83b(__context__,____this_rename_at_27.right);
+	finalize_e041fb14490aa83b(__context__,____this_rename_at_27.subexpr);
+	memset(&(____this_rename_at_27), 0, 136);
+}
+
+inline void _Funcbuiltin_0x60_push_5459a94d4bd9a32f ( Context * __context__, TArray<TTuple<16,range,char *>> &  __Arr_rename_at_75, TTuple<16,range,char *> const  &  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<TTuple<16,range,char *>>>::pass(__Arr_rename_at_75),16,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_399 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_399),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_421bbf7456f4209b ( Context * __context__, TArray<uint32_t> &  __a_rename_at_399 )
+{
+	builtin_array_free(das_arg<TArray<uint32_t>>::pass(__a_rename_at_399),4,__context__);
+}
+
+inline regex::Regex & _Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd ( Context * __context__, regex::Regex &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<regex::Regex &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<regex::Regex &>::cast(__a_rename_at_42);
+}
+
+inline void finalize_6293242d2ef1254f ( Context * __context__, TVariant<16,regex::ReNode *,void *> &  ____this_rename_at_260 )
+{
+	if ( das_get_variant_field<regex::ReNode *,8,0>::is(____this_rename_at_260) )
+	{
+		finalize_e041fb14490aa83b(__context__,das_get_variant_field<regex::ReNode *,8,0>::get(____this_rename_at_260));
+	};
+	memset(&(____this_rename_at_260), 0, 16);
+}
+
+inline void finalize_e041fb14490aa83b ( Context * __context__, regex::ReNode * & ____this_rename_at_335 )
+{
+	if ( ____this_rename_at_335 != nullptr )
+	{
+		finalize_7420a122bf22c777(__context__,das_arg<regex::ReNode>::pass(das_deref(__context__,____this_rename_at_335)));
+		das_delete<regex::ReNode *>::clear(__context__,____this_rename_at_335);
+		das_copy(____this_rename_at_335,nullptr);
+	};
+}
+
+inline void _Funcbuiltin_0x60_push_5dc212b561cc93c2 ( Context * __context__, TArray<regex::ReNode *> &  __Arr_rename_at_75, regex::ReNode * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<regex::ReNode *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline TArray<regex::ReNode *> _Funcbuiltin_0x60_to_array_move_1a55d1eab5baa002 ( Context * __context__, TDim<regex::ReNode *,2> &  __a_rename_at_518 )
+{
+	TArray<regex::ReNode *> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_13e4a05653768251(__context__,das_arg<TArray<regex::ReNode *>>::pass(__arr_rename_at_519),2);
+	das_copy(das_cast<TDim<regex::ReNode *,2>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<regex::ReNode *>>::cast(__arr_rename_at_519);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_push_b1b73bc5bfdbac10 ( Context * __context__, TArray<uint32_t> &  __Arr_rename_at_75, uint32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<uint32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline bool _Funcbuiltin_0x60_next_160159e214cdd056 ( Context * __context__, Sequence DAS_COMMENT((uint32_t)) const  &  __it_rename_at_431, uint32_t & __value_rename_at_431 )
+{
+	return das_auto_cast<bool>::cast(builtin_iterator_iterate(__it_rename_at_431,das_auto_cast<void * const >::cast(das_ref(__context__,__value_rename_at_431)),__context__));
+}
+
+inline uint32_t re_gen_get_rep_limit_aad39a472678db9d ( Context * __context__ )
+{
+	return das_auto_cast<uint32_t>::cast(das_global<uint32_t,0x570cc75ae91fa86f>(__context__) /*re_gen_rep_limit*/);
+}
+
+inline void trace_89f6695f8909b072 ( Context * __context__, char * const  __msg_rename_at_71, int32_t __offset_rename_at_71 )
+{
+}
+
+inline void note_89f6695f8909b072 ( Context * __context__, char * const  __msg_rename_at_76, int32_t __offset_rename_at_76 )
+{
+}
+
+inline void trace_backtrack_c77fe5b3ac1a6a7c ( Context * __context__ )
+{
+}
+
+inline void trace_value_4739abdd3b0a7208 ( Context * __context__, regex::ReNode * const  __value_rename_at_85 )
+{
+}
+
+inline TVariant<16,regex::ReNode *,void *> nada_5086bd0a540f8186 ( Context * __context__ )
+{
+	return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((([&]() -> TVariant<16,regex::ReNode *,void *> {
+		TVariant<16,regex::ReNode *,void *> __mkv_94;
+		das_get_variant_field<void *,8,1>::set(__mkv_94) = nullptr;
+		return __mkv_94;
+	})()));
+}
+
+inline TVariant<16,regex::ReNode *,void *> maybe_4cddd0f3894095b8 ( Context * __context__, regex::ReNode * const  __value_rename_at_96 )
+{
+	return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((([&]() -> TVariant<16,regex::ReNode *,void *> {
+		TVariant<16,regex::ReNode *,void *> __mkv_98;
+		das_get_variant_field<regex::ReNode *,8,0>::set(__mkv_98) = __value_rename_at_96;
+		return __mkv_98;
+	})()));
+}
+
+inline bool eos_dde6e11fd3802ac8 ( Context * __context__, char * const  __expr_rename_at_100, int32_t __offset_rename_at_100 )
+{
+	return das_auto_cast<bool>::cast(__offset_rename_at_100 >= builtin_string_length(__expr_rename_at_100,__context__));
+}
+
+inline int32_t at_c9bade5ff7edd57d ( Context * __context__, char * const  __expr_rename_at_103, int32_t __offset_rename_at_103 )
+{
+	return das_auto_cast<int32_t>::cast(get_character_uat(__expr_rename_at_103,__offset_rename_at_103));
+}
+
+inline int32_t next_47eaeae3973f3d0a ( Context * __context__, TVariant<16,regex::ReNode *,void *> const  &  __re_rename_at_118 )
+{
+	if ( !das_get_variant_field<regex::ReNode *,8,0>::is(__re_rename_at_118) )
+	{
+		builtin_stackwalk(true,true,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		builtin_throw(((char *) "expecting value"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return das_auto_cast<int32_t>::cast(v_extract_yi(v_cast_vec4i(das_get_variant_field<regex::ReNode *,8,0>::as(__re_rename_at_118,__context__)->at)) /*y*/);
+}
+
+inline bool is_set_empty_fb12252b2129800d ( Context * __context__, TDim<uint32_t,8> const  &  __cset_rename_at_124 )
+{
+	{
+		bool __need_loop_125 = true;
+		// x : uint aka CharSet const&
+		das_iterator<TDim<uint32_t,8> const > __x_iterator(__cset_rename_at_124);
+		uint32_t const  * __x_rename_at_125;
+		__need_loop_125 = __x_iterator.first(__context__,(__x_rename_at_125)) && __need_loop_125;
+		for ( ; __need_loop_125 ; __need_loop_125 = __x_iterator.next(__context__,(__x_rename_at_125)) )
+		{
+			if ( (*__x_rename_at_125) != 0x0u )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_125));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void set_or_char_471888d9ed78efab ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_130, int32_t __ch_rename_at_130 )
+{
+	__cset_rename_at_130((__ch_rename_at_130 >> 5),__context__) |= uint32_t(1 << (__ch_rename_at_130 & 31));
+}
+
+inline void set_or_range_a7ad44e8ef1ec07c ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_133, range __bits_rename_at_133 )
+{
+	{
+		bool __need_loop_134 = true;
+		// ch : int const
+		das_iterator<range> __ch_iterator(range(v_extract_xi(v_cast_vec4i(__bits_rename_at_133)) /*x*/,v_extract_yi(v_cast_vec4i(__bits_rename_at_133)) /*y*/ + 1));
+		int32_t __ch_rename_at_134;
+		__need_loop_134 = __ch_iterator.first(__context__,(__ch_rename_at_134)) && __need_loop_134;
+		for ( ; __need_loop_134 ; __need_loop_134 = __ch_iterator.next(__context__,(__ch_rename_at_134)) )
+		{
+			__cset_rename_at_133((__ch_rename_at_134 >> 5),__context__) |= uint32_t(1 << (__ch_rename_at_134 & 31));
+		}
+		__ch_iterator.close(__context__,(__ch_rename_at_134));
+	};
+}
+
+inline void set_invert_be791c77bc6b6a11 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_137 )
+{
+	{
+		bool __need_loop_138 = true;
+		// x : uint aka CharSet& -const
+		das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_137);
+		uint32_t * __x_rename_at_138;
+		__need_loop_138 = __x_iterator.first(__context__,(__x_rename_at_138)) && __need_loop_138;
+		for ( ; __need_loop_138 ; __need_loop_138 = __x_iterator.next(__context__,(__x_rename_at_138)) )
+		{
+			(*__x_rename_at_138) ^= 0xffffffffu;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_138));
+	};
+}
+
+inline void set_or_set_9609a9e932b32815 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_141, TDim<uint32_t,8> const  &  __eset_rename_at_141 )
+{
+	{
+		bool __need_loop_142 = true;
+		// x : uint aka CharSet& -const
+		das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_141);
+		uint32_t * __x_rename_at_142;
+		__need_loop_142 = __x_iterator.first(__context__,(__x_rename_at_142)) && __need_loop_142;
+		// y : uint aka CharSet const&
+		das_iterator<TDim<uint32_t,8> const > __y_iterator(__eset_rename_at_141);
+		uint32_t const  * __y_rename_at_142;
+		__need_loop_142 = __y_iterator.first(__context__,(__y_rename_at_142)) && __need_loop_142;
+		for ( ; __need_loop_142 ; __need_loop_142 = __x_iterator.next(__context__,(__x_rename_at_142)) && __y_iterator.next(__context__,(__y_rename_at_142)) )
+		{
+			(*__x_rename_at_142) |= (*__y_rename_at_142);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_142));
+		__y_iterator.close(__context__,(__y_rename_at_142));
+	};
+}
+
+inline void set_negative_7a1fcd94df7d5358 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_145 )
+{
+	{
+		bool __need_loop_146 = true;
+		// x : uint aka CharSet& -const
+		das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_145);
+		uint32_t * __x_rename_at_146;
+		__need_loop_146 = __x_iterator.first(__context__,(__x_rename_at_146)) && __need_loop_146;
+		for ( ; __need_loop_146 ; __need_loop_146 = __x_iterator.next(__context__,(__x_rename_at_146)) )
+		{
+			das_copy((*__x_rename_at_146),~(*__x_rename_at_146));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_146));
+	};
+}
+
+inline void set_meta_2f4780f8ef5a2b6d ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_149, int32_t __che_rename_at_149 )
+{
+	if ( __che_rename_at_149 == 119 )
+	{
+		set_or_range_a7ad44e8ef1ec07c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_149),range(97,122));
+		set_or_range_a7ad44e8ef1ec07c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_149),range(65,90));
+		set_or_range_a7ad44e8ef1ec07c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_149),range(48,57));
+		set_or_char_471888d9ed78efab(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_149),95);
+	} else if ( __che_rename_at_149 == 87 )
+	{
+		TDim<uint32_t,8> __eset_rename_at_156; das_zero(__eset_rename_at_156);
+		set_meta_2f4780f8ef5a2b6d(__context__,das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_156),119);
+		set_or_set_9609a9e932b32815(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_149),das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_156));
+	} else if ( __che_rename_at_149 == 115 )
+	{
+		set_or_char_471888d9ed78efab(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_149),32);
+		set_or_char_471888d9ed78efab(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_149),9);
+	} else if ( __che_rename_at_149 == 83 )
+	{
+		TDim<uint32_t,8> __eset_rename_at_163; das_zero(__eset_rename_at_163);
+		set_meta_2f4780f8ef5a2b6d(__context__,das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_163),115);
+		set_or_set_9609a9e932b32815(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_149),das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_163));
+	} else if ( __che_rename_at_149 == 100 )
+	{
+		set_or_range_a7ad44e8ef1ec07c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_149),range(48,57));
+	} else if ( __che_rename_at_149 == 68 )
+	{
+		TDim<uint32_t,8> __eset_rename_at_169; das_zero(__eset_rename_at_169);
+		set_meta_2f4780f8ef5a2b6d(__context__,das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_169),100);
+		set_or_set_9609a9e932b32815(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_149),das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_169));
+	} else {
+		set_or_char_471888d9ed78efab(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_149),__che_rename_at_149);
+	};
+}
+
+inline bool is_meta_character_24d3d25015b1373f ( Context * __context__, int32_t __ch_rename_at_178 )
+{
+	return das_auto_cast<bool>::cast(builtin_find_first_char_of(((char *) "\\+-*.()[]|^"),__ch_rename_at_178,__context__) != -1);
+}
+
+inline bool is_set_character_11f8fcca4329c870 ( Context * __context__, int32_t __ch_rename_at_181 )
+{
+	return das_auto_cast<bool>::cast(builtin_find_first_char_of(((char *) "wWsSdD"),__ch_rename_at_181,__context__) != -1);
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_char_82ce59dc4838976a ( Context * __context__, char * const  __expr_rename_at_185, int32_t __offset_rename_at_185 )
+{
+	if ( eos_dde6e11fd3802ac8(__context__,__expr_rename_at_185,__offset_rename_at_185) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		int32_t __ch_rename_at_189 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_185,__offset_rename_at_185));
+		if ( __ch_rename_at_189 == 92 )
+		{
+			int32_t __ech_rename_at_191 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_185,__offset_rename_at_185 + 1));
+			if ( __ech_rename_at_191 == 0 )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+			} else {
+				if ( is_set_character_11f8fcca4329c870(__context__,__ech_rename_at_191) )
+				{
+					TDim<uint32_t,8> __cset_rename_at_196; das_zero(__cset_rename_at_196);
+					set_meta_2f4780f8ef5a2b6d(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_196),__ech_rename_at_191);
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_4cddd0f3894095b8(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+						regex::ReNode __mks_198;
+						das_zero(__mks_198);
+						das_copy((__mks_198.op),(DAS_COMMENT(enum) regex::ReOp::Set));
+						das_copy((__mks_198.cset),(__cset_rename_at_196));
+						das_copy((__mks_198.at),(range(__offset_rename_at_185,__offset_rename_at_185 + 2)));
+						return __mks_198;
+					})()))));
+				} else {
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_4cddd0f3894095b8(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+						regex::ReNode __mks_199;
+						das_zero(__mks_199);
+						das_copy((__mks_199.op),(DAS_COMMENT(enum) regex::ReOp::Char));
+						das_copy((__mks_199.text),(((char *)(to_string_char(__ech_rename_at_191,__context__)))));
+						das_copy((__mks_199.textLen),(1));
+						das_copy((__mks_199.at),(range(__offset_rename_at_185,__offset_rename_at_185 + 2)));
+						return __mks_199;
+					})()))));
+				};
+			};
+		} else if ( is_meta_character_24d3d25015b1373f(__context__,__ch_rename_at_189) )
+		{
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+		};
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_4cddd0f3894095b8(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_202;
+			das_zero(__mks_202);
+			das_copy((__mks_202.op),(DAS_COMMENT(enum) regex::ReOp::Char));
+			das_copy((__mks_202.text),(((char *)(to_string_char(__ch_rename_at_189,__context__)))));
+			das_copy((__mks_202.textLen),(1));
+			das_copy((__mks_202.at),(range(__offset_rename_at_185,__offset_rename_at_185 + 1)));
+			return __mks_202;
+		})()))));
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_set_items_39e8d6427890060c ( Context * __context__, char * const  __expr_rename_at_208, int32_t __offset_rename_at_208 )
+{
+	if ( eos_dde6e11fd3802ac8(__context__,__expr_rename_at_208,__offset_rename_at_208) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		TDim<uint32_t,8> __cset_rename_at_212; das_zero(__cset_rename_at_212);
+		int32_t __iofs_rename_at_213 = __offset_rename_at_208;
+		while ( !eos_dde6e11fd3802ac8(__context__,__expr_rename_at_208,__iofs_rename_at_213) )
+		{
+			int32_t __ch_rename_at_215 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_208,__iofs_rename_at_213));
+			if ( __ch_rename_at_215 == 93 )
+			{
+				break;
+			} else if ( __ch_rename_at_215 == 92 )
+			{
+				int32_t __che_rename_at_220 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_208,__iofs_rename_at_213 + 1));
+				if ( __che_rename_at_220 == 0 )
+				{
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				} else {
+					set_meta_2f4780f8ef5a2b6d(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_212),__che_rename_at_220);
+					__iofs_rename_at_213 += 2;
+				};
+			} else if ( (at_c9bade5ff7edd57d(__context__,__expr_rename_at_208,__iofs_rename_at_213 + 1) == 45) && (at_c9bade5ff7edd57d(__context__,__expr_rename_at_208,__iofs_rename_at_213 + 2) != 93) )
+			{
+				int32_t __che_rename_at_228 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_208,__iofs_rename_at_213 + 2));
+				if ( __che_rename_at_228 == 0 )
+				{
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				} else if ( __ch_rename_at_215 > __che_rename_at_228 )
+				{
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				};
+				set_or_range_a7ad44e8ef1ec07c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_212),range(__ch_rename_at_215,__che_rename_at_228));
+				__iofs_rename_at_213 += 3;
+			} else {
+				set_or_char_471888d9ed78efab(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_212),__ch_rename_at_215);
+				__iofs_rename_at_213 += 1;
+			};
+		};
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_4cddd0f3894095b8(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_242;
+			das_zero(__mks_242);
+			das_copy((__mks_242.op),(DAS_COMMENT(enum) regex::ReOp::Set));
+			das_copy((__mks_242.cset),(__cset_rename_at_212));
+			das_copy((__mks_242.at),(range(__offset_rename_at_208,__iofs_rename_at_213)));
+			return __mks_242;
+		})()))));
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_set_4203278ac10d8cd6 ( Context * __context__, char * const  __expr_rename_at_247, int32_t __offset_rename_at_247 )
+{
+	if ( eos_dde6e11fd3802ac8(__context__,__expr_rename_at_247,__offset_rename_at_247) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_247,__offset_rename_at_247) != 91 )
+		{
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+		} else {
+			bool __negative_rename_at_253 = false;
+			if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_247,__offset_rename_at_247 + 1) == 94 )
+			{
+				das_copy(__negative_rename_at_253,true);
+			};
+			TVariant<16,regex::ReNode *,void *> __oset_rename_at_256 = re_set_items_39e8d6427890060c(__context__,__expr_rename_at_247,__negative_rename_at_253 ? das_auto_cast<int32_t>::cast((__offset_rename_at_247 + 2)) : das_auto_cast<int32_t>::cast((__offset_rename_at_247 + 1)));
+			if ( das_get_variant_field<void *,8,1>::is(__oset_rename_at_256) )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+			} else {
+				if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_247,next_47eaeae3973f3d0a(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oset_rename_at_256))) != 93 )
+				{
+					finalize_6293242d2ef1254f(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oset_rename_at_256));
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				} else {
+					regex::ReNode * __oval_rename_at_262 = das_get_variant_field<regex::ReNode *,8,0>::as(__oset_rename_at_256,__context__);
+					das_copy(das_swizzle_ref<int32_t,range,0>::swizzle(__oval_rename_at_262->at) /*x*/,__offset_rename_at_247);
+					++das_swizzle_ref<int32_t,range,1>::swizzle(__oval_rename_at_262->at) /*y*/;
+					das_copy(__oval_rename_at_262->op,DAS_COMMENT(enum) regex::ReOp::Set);
+					if ( __negative_rename_at_253 )
+					{
+						set_negative_7a1fcd94df7d5358(__context__,das_arg<TDim<uint32_t,8>>::pass(__oval_rename_at_262->cset));
+					};
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__oset_rename_at_256);
+				};
+			};
+		};
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_any_effdf3f7b62b2ac1 ( Context * __context__, char * const  __expr_rename_at_272, int32_t __offset_rename_at_272 )
+{
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_275_32;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_277_48;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_278_80;
+	return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(eos_dde6e11fd3802ac8(__context__,__expr_rename_at_272,__offset_rename_at_272) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_275_32 = (nada_5086bd0a540f8186(__context__)))) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(((at_c9bade5ff7edd57d(__context__,__expr_rename_at_272,__offset_rename_at_272) == 46) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_277_48 = (maybe_4cddd0f3894095b8(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+		regex::ReNode __mks_277;
+		das_zero(__mks_277);
+		das_copy((__mks_277.op),(DAS_COMMENT(enum) regex::ReOp::Any));
+		das_copy((__mks_277.at),(range(__offset_rename_at_272,__offset_rename_at_272 + 1)));
+		return __mks_277;
+	})())))))) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_278_80 = (nada_5086bd0a540f8186(__context__)))))));
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_eos_fe251bbc0838f42e ( Context * __context__, char * const  __expr_rename_at_281, int32_t __offset_rename_at_281 )
+{
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_284_32;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_286_48;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_287_80;
+	return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(eos_dde6e11fd3802ac8(__context__,__expr_rename_at_281,__offset_rename_at_281) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_284_32 = (nada_5086bd0a540f8186(__context__)))) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(((at_c9bade5ff7edd57d(__context__,__expr_rename_at_281,__offset_rename_at_281) == 36) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_286_48 = (maybe_4cddd0f3894095b8(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+		regex::ReNode __mks_286;
+		das_zero(__mks_286);
+		das_copy((__mks_286.op),(DAS_COMMENT(enum) regex::ReOp::Eos));
+		das_copy((__mks_286.at),(range(__offset_rename_at_281,__offset_rename_at_281 + 1)));
+		return __mks_286;
+	})())))))) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_287_80 = (nada_5086bd0a540f8186(__context__)))))));
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_group_3a964ad67daa5bc1 ( Context * __context__, char * const  __expr_rename_at_290, int32_t __offset_rename_at_290 )
+{
+	if ( eos_dde6e11fd3802ac8(__context__,__expr_rename_at_290,__offset_rename_at_290) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_290,__offset_rename_at_290) != 40 )
+		{
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+		} else {
+			TVariant<16,regex::ReNode *,void *> __ore_rename_at_296 = re_re_ace328bebb48ab0d(__context__,__expr_rename_at_290,__offset_rename_at_290 + 1);
+			if ( das_get_variant_field<void *,8,1>::is(__ore_rename_at_296) )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+			} else {
+				if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_290,next_47eaeae3973f3d0a(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_296))) != 41 )
+				{
+					finalize_6293242d2ef1254f(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_296));
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				} else {
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_4cddd0f3894095b8(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+						regex::ReNode __mks_302;
+						das_zero(__mks_302);
+						das_copy((__mks_302.op),(DAS_COMMENT(enum) regex::ReOp::Group));
+						das_copy((__mks_302.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__ore_rename_at_296,__context__)));
+						das_copy((__mks_302.at),(range(__offset_rename_at_290,next_47eaeae3973f3d0a(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_296)) + 1)));
+						return __mks_302;
+					})()))));
+				};
+			};
+		};
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_elementary_44bc08d3b62d065a ( Context * __context__, char * const  __expr_rename_at_305, int32_t __offset_rename_at_305 )
+{
+	if ( eos_dde6e11fd3802ac8(__context__,__expr_rename_at_305,__offset_rename_at_305) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		TVariant<16,regex::ReNode *,void *> __ogr_rename_at_309 = re_group_3a964ad67daa5bc1(__context__,__expr_rename_at_305,__offset_rename_at_305);
+		if ( das_get_variant_field<regex::ReNode *,8,0>::is(__ogr_rename_at_309) )
+		{
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__ogr_rename_at_309);
+		} else {
+			TVariant<16,regex::ReNode *,void *> __oany_rename_at_312 = re_any_effdf3f7b62b2ac1(__context__,__expr_rename_at_305,__offset_rename_at_305);
+			if ( das_get_variant_field<regex::ReNode *,8,0>::is(__oany_rename_at_312) )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__oany_rename_at_312);
+			} else {
+				TVariant<16,regex::ReNode *,void *> __oeos_rename_at_315 = re_eos_fe251bbc0838f42e(__context__,__expr_rename_at_305,__offset_rename_at_305);
+				if ( das_get_variant_field<regex::ReNode *,8,0>::is(__oeos_rename_at_315) )
+				{
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__oeos_rename_at_315);
+				} else {
+					TVariant<16,regex::ReNode *,void *> __oset_rename_at_318 = re_set_4203278ac10d8cd6(__context__,__expr_rename_at_305,__offset_rename_at_305);
+					if ( das_get_variant_field<regex::ReNode *,8,0>::is(__oset_rename_at_318) )
+					{
+						return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__oset_rename_at_318);
+					} else {
+						TVariant<16,regex::ReNode *,void *> _temp_make_local_324_112;
+						TVariant<16,regex::ReNode *,void *> __ochr_rename_at_321 = re_char_82ce59dc4838976a(__context__,__expr_rename_at_305,__offset_rename_at_305);
+						return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(das_get_variant_field<regex::ReNode *,8,0>::is(__ochr_rename_at_321) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *> &>::cast(__ochr_rename_at_321) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *> &>::cast((_temp_make_local_324_112 = (nada_5086bd0a540f8186(__context__)))));
+					};
+				};
+			};
+		};
+	};
+}
+
+inline regex::ReNode * mk_concat_2c96f9e344dd637b ( Context * __context__, regex::ReNode * __left_rename_at_326, regex::ReNode * __right_rename_at_326 )
+{
+	if ( __left_rename_at_326 == nullptr )
+	{
+		return das_auto_cast<regex::ReNode *>::cast(__right_rename_at_326);
+	} else if ( (__left_rename_at_326->op == DAS_COMMENT(enum) regex::ReOp::Char) && (__right_rename_at_326->op == DAS_COMMENT(enum) regex::ReOp::Char) )
+	{
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__left_rename_at_326->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_326->at) /*y*/);
+		SimPolicy<char *>::SetAdd((char *)&(__left_rename_at_326->text),cast<char *>::from(__right_rename_at_326->text),*__context__,nullptr);
+		__left_rename_at_326->textLen += __right_rename_at_326->textLen;
+		finalize_e041fb14490aa83b(__context__,__right_rename_at_326);
+		return das_auto_cast<regex::ReNode *>::cast(__left_rename_at_326);
+	} else if ( ((__left_rename_at_326->op == DAS_COMMENT(enum) regex::ReOp::Concat) && (__left_rename_at_326->right->op == DAS_COMMENT(enum) regex::ReOp::Char)) && (__right_rename_at_326->op == DAS_COMMENT(enum) regex::ReOp::Char) )
+	{
+		regex::ReNode * __lor_rename_at_339 = __left_rename_at_326->right;
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__left_rename_at_326->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_326->at) /*y*/);
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__lor_rename_at_339->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_326->at) /*y*/);
+		SimPolicy<char *>::SetAdd((char *)&(__lor_rename_at_339->text),cast<char *>::from(__right_rename_at_326->text),*__context__,nullptr);
+		__lor_rename_at_339->textLen += __right_rename_at_326->textLen;
+		finalize_e041fb14490aa83b(__context__,__right_rename_at_326);
+		return das_auto_cast<regex::ReNode *>::cast(__left_rename_at_326);
+	} else {
+		return das_auto_cast<regex::ReNode *>::cast(das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_348;
+			das_zero(__mks_348);
+			das_copy((__mks_348.op),(DAS_COMMENT(enum) regex::ReOp::Concat));
+			das_copy((__mks_348.left),(__left_rename_at_326));
+			das_copy((__mks_348.right),(__right_rename_at_326));
+			das_copy((__mks_348.at),(range(v_extract_xi(v_cast_vec4i(__left_rename_at_326->at)) /*x*/,v_extract_yi(v_cast_vec4i(__right_rename_at_326->at)) /*y*/)));
+			return __mks_348;
+		})())));
+	};
+}
+
+inline regex::ReNode * mk_union_ecbeb7e14987ecd7 ( Context * __context__, regex::ReNode * __left_rename_at_350, regex::ReNode * __right_rename_at_350 )
+{
+	if ( __left_rename_at_350->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__left_rename_at_350->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_350->at) /*y*/);
+		if ( __right_rename_at_350->op == DAS_COMMENT(enum) regex::ReOp::Union )
+		{
+			{
+				bool __need_loop_354 = true;
+				// x : regex::ReNode?&
+				das_iterator<TArray<regex::ReNode *>> __x_iterator(__right_rename_at_350->all);
+				regex::ReNode * * __x_rename_at_354;
+				__need_loop_354 = __x_iterator.first(__context__,(__x_rename_at_354)) && __need_loop_354;
+				for ( ; __need_loop_354 ; __need_loop_354 = __x_iterator.next(__context__,(__x_rename_at_354)) )
+				{
+					_Funcbuiltin_0x60_push_5dc212b561cc93c2(__context__,das_arg<TArray<regex::ReNode *>>::pass(__left_rename_at_350->all),(*__x_rename_at_354));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_354));
+			};
+			finalize_e041fb14490aa83b(__context__,__right_rename_at_350);
+		} else {
+			_Funcbuiltin_0x60_push_5dc212b561cc93c2(__context__,das_arg<TArray<regex::ReNode *>>::pass(__left_rename_at_350->all),__right_rename_at_350);
+		};
+		return das_auto_cast<regex::ReNode *>::cast(__left_rename_at_350);
+	} else if ( __right_rename_at_350->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		das_copy(das_swizzle_ref<int32_t,range,0>::swizzle(__right_rename_at_350->at) /*x*/,das_swizzle_ref<int32_t,range,0>::swizzle(__left_rename_at_350->at) /*x*/);
+		_Funcbuiltin_0x60_push_5dc212b561cc93c2(__context__,das_arg<TArray<regex::ReNode *>>::pass(__right_rename_at_350->all),__left_rename_at_350);
+		return das_auto_cast<regex::ReNode *>::cast(__right_rename_at_350);
+	} else {
+		TDim<regex::ReNode *,2> _temp_make_local_366_64;
+		return das_auto_cast<regex::ReNode *>::cast(das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_366;
+			das_zero(__mks_366);
+			das_copy((__mks_366.op),(DAS_COMMENT(enum) regex::ReOp::Union));
+			das_move((__mks_366.all),(_Funcbuiltin_0x60_to_array_move_1a55d1eab5baa002(__context__,das_arg<TDim<regex::ReNode *,2>>::pass((([&]() -> TDim<regex::ReNode *,2>& {
+				_temp_make_local_366_64(0,__context__) = __left_rename_at_350;
+				_temp_make_local_366_64(1,__context__) = __right_rename_at_350;
+				return _temp_make_local_366_64;
+			})())))));
+			das_copy((__mks_366.at),(range(v_extract_xi(v_cast_vec4i(__left_rename_at_350->at)) /*x*/,v_extract_yi(v_cast_vec4i(__right_rename_at_350->at)) /*y*/)));
+			return __mks_366;
+		})())));
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_re_ace328bebb48ab0d ( Context * __context__, char * const  __expr_rename_at_372, int32_t __offset_rename_at_372 )
+{
+	if ( eos_dde6e11fd3802ac8(__context__,__expr_rename_at_372,__offset_rename_at_372) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		int32_t __cofs_rename_at_376 = __offset_rename_at_372;
+		regex::ReNode * __last_rename_at_377 = 0;
+		while ( !eos_dde6e11fd3802ac8(__context__,__expr_rename_at_372,__cofs_rename_at_376) )
+		{
+			if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_372,__cofs_rename_at_376) == 124 )
+			{
+				if ( __last_rename_at_377 == nullptr )
+				{
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				} else {
+					TVariant<16,regex::ReNode *,void *> __oright_rename_at_383 = re_re_ace328bebb48ab0d(__context__,__expr_rename_at_372,__cofs_rename_at_376 + 1);
+					if ( das_get_variant_field<void *,8,1>::is(__oright_rename_at_383) )
+					{
+						return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+					} else {
+						das_copy(__last_rename_at_377,mk_union_ecbeb7e14987ecd7(__context__,__last_rename_at_377,das_get_variant_field<regex::ReNode *,8,0>::as(__oright_rename_at_383,__context__)));
+						das_copy(__cofs_rename_at_376,das_swizzle_ref<int32_t,range,1>::swizzle(__last_rename_at_377->at) /*y*/);
+					};
+				};
+			} else {
+				TVariant<16,regex::ReNode *,void *> __onext_rename_at_390 = re_basic_3a34fb27b8e53d4a(__context__,__expr_rename_at_372,__cofs_rename_at_376);
+				if ( das_get_variant_field<void *,8,1>::is(__onext_rename_at_390) )
+				{
+					TVariant<16,regex::ReNode *,void *> _temp_make_local_392_96;
+					TVariant<16,regex::ReNode *,void *> _temp_make_local_392_112;
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((__last_rename_at_377 == nullptr) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_392_96 = (nada_5086bd0a540f8186(__context__)))) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_392_112 = (maybe_4cddd0f3894095b8(__context__,__last_rename_at_377)))));
+				} else {
+					das_copy(__last_rename_at_377,mk_concat_2c96f9e344dd637b(__context__,__last_rename_at_377,das_get_variant_field<regex::ReNode *,8,0>::as(__onext_rename_at_390,__context__)));
+					das_copy(__cofs_rename_at_376,das_swizzle_ref<int32_t,range,1>::swizzle(__last_rename_at_377->at) /*y*/);
+				};
+			};
+		};
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_4cddd0f3894095b8(__context__,__last_rename_at_377));
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_basic_3a34fb27b8e53d4a ( Context * __context__, char * const  __expr_rename_at_400, int32_t __offset_rename_at_400 )
+{
+	if ( eos_dde6e11fd3802ac8(__context__,__expr_rename_at_400,__offset_rename_at_400) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		TVariant<16,regex::ReNode *,void *> __oelem_rename_at_404 = re_elementary_44bc08d3b62d065a(__context__,__expr_rename_at_400,__offset_rename_at_400);
+		if ( das_get_variant_field<void *,8,1>::is(__oelem_rename_at_404) )
+		{
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+		} else {
+			int32_t __ch_rename_at_407 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_400,next_47eaeae3973f3d0a(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_404))));
+			if ( __ch_rename_at_407 == 42 )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_4cddd0f3894095b8(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+					regex::ReNode __mks_409;
+					das_zero(__mks_409);
+					das_copy((__mks_409.op),(DAS_COMMENT(enum) regex::ReOp::Star));
+					das_copy((__mks_409.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__oelem_rename_at_404,__context__)));
+					das_copy((__mks_409.at),(range(__offset_rename_at_400,next_47eaeae3973f3d0a(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_404)) + 1)));
+					return __mks_409;
+				})()))));
+			} else if ( __ch_rename_at_407 == 43 )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_4cddd0f3894095b8(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+					regex::ReNode __mks_411;
+					das_zero(__mks_411);
+					das_copy((__mks_411.op),(DAS_COMMENT(enum) regex::ReOp::Plus));
+					das_copy((__mks_411.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__oelem_rename_at_404,__context__)));
+					das_copy((__mks_411.at),(range(__offset_rename_at_400,next_47eaeae3973f3d0a(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_404)) + 1)));
+					return __mks_411;
+				})()))));
+			} else if ( __ch_rename_at_407 == 63 )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_4cddd0f3894095b8(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+					regex::ReNode __mks_413;
+					das_zero(__mks_413);
+					das_copy((__mks_413.op),(DAS_COMMENT(enum) regex::ReOp::Question));
+					das_copy((__mks_413.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__oelem_rename_at_404,__context__)));
+					das_copy((__mks_413.at),(range(__offset_rename_at_400,next_47eaeae3973f3d0a(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_404)) + 1)));
+					return __mks_413;
+				})()))));
+			};
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__oelem_rename_at_404);
+		};
+	};
+}
+
+inline regex::ReNode * re_parse_3d6f9a305b851160 ( Context * __context__, char * const  __expr_rename_at_416 )
+{
+	TVariant<16,regex::ReNode *,void *> __ore_rename_at_417 = re_re_ace328bebb48ab0d(__context__,__expr_rename_at_416,0);
+	if ( das_get_variant_field<void *,8,1>::is(__ore_rename_at_417) )
+	{
+		return das_auto_cast<regex::ReNode *>::cast(nullptr);
+	} else {
+		int32_t __at_rename_at_420 = ((int32_t)next_47eaeae3973f3d0a(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_417)));
+		return das_auto_cast<regex::ReNode *>::cast((__at_rename_at_420 != builtin_string_length(__expr_rename_at_416,__context__)) ? das_auto_cast<void * const >::cast(nullptr) : das_auto_cast<void * const >::cast(das_get_variant_field<regex::ReNode *,8,0>::as(__ore_rename_at_417,__context__)));
+	};
+}
+
+inline void visit_top_down_ac4526f0a41e9d37 ( Context * __context__, regex::ReNode * __node_rename_at_426, Block DAS_COMMENT((void,regex::ReNode *)) const  &  __blk_rename_at_426 )
+{
+	das_invoke<void>::invoke<regex::ReNode *>(__context__,nullptr,__blk_rename_at_426,__node_rename_at_426);
+	{
+		bool __need_loop_428 = true;
+		// x : regex::ReNode?&
+		das_iterator<TArray<regex::ReNode *>> __x_iterator(__node_rename_at_426->all);
+		regex::ReNode * * __x_rename_at_428;
+		__need_loop_428 = __x_iterator.first(__context__,(__x_rename_at_428)) && __need_loop_428;
+		for ( ; __need_loop_428 ; __need_loop_428 = __x_iterator.next(__context__,(__x_rename_at_428)) )
+		{
+			visit_top_down_ac4526f0a41e9d37(__context__,(*__x_rename_at_428),__blk_rename_at_426);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_428));
+	};
+	if ( __node_rename_at_426->subexpr != nullptr )
+	{
+		visit_top_down_ac4526f0a41e9d37(__context__,__node_rename_at_426->subexpr,__blk_rename_at_426);
+	};
+	if ( __node_rename_at_426->left != nullptr )
+	{
+		visit_top_down_ac4526f0a41e9d37(__context__,__node_rename_at_426->left,__blk_rename_at_426);
+	};
+	if ( __node_rename_at_426->right != nullptr )
+	{
+		visit_top_down_ac4526f0a41e9d37(__context__,__node_rename_at_426->right,__blk_rename_at_426);
+	};
+}
+
+inline void re_assign_next_1e223575dac53267 ( Context * __context__, regex::Regex &  __re_rename_at_437 ) { das_stack_prologue __prologue(__context__,128,"re_assign_next " DAS_FILE_LINE);
+{
+	int32_t __id_rename_at_438 = 0;
+	visit_top_down_ac4526f0a41e9d37(__context__,__re_rename_at_437.root,das_make_block<void,regex::ReNode *>(__context__,96,0,&__func_info__87bf23f355201ee1,[&](regex::ReNode * __node_rename_at_439)->void{
+		das_copy(__node_rename_at_439->id,__id_rename_at_438++);
+		if ( __node_rename_at_439->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+		{
+			das_copy(__node_rename_at_439->left->next,__node_rename_at_439->right);
+			das_copy(__node_rename_at_439->right->next,__node_rename_at_439->next);
+		} else if ( __node_rename_at_439->op == DAS_COMMENT(enum) regex::ReOp::Group )
+		{
+			das_copy(__node_rename_at_439->subexpr->next,__node_rename_at_439->next);
+		} else if ( __node_rename_at_439->op == DAS_COMMENT(enum) regex::ReOp::Union )
+		{
+			{
+				bool __need_loop_447 = true;
+				// sub : regex::ReNode?&
+				das_iterator<TArray<regex::ReNode *>> __sub_iterator(__node_rename_at_439->all);
+				regex::ReNode * * __sub_rename_at_447;
+				__need_loop_447 = __sub_iterator.first(__context__,(__sub_rename_at_447)) && __need_loop_447;
+				for ( ; __need_loop_447 ; __need_loop_447 = __sub_iterator.next(__context__,(__sub_rename_at_447)) )
+				{
+					das_copy((*__sub_rename_at_447)->next,__node_rename_at_439->next);
+				}
+				__sub_iterator.close(__context__,(__sub_rename_at_447));
+			};
+		};
+	}));
+}}
+
+inline void re_assign_groups_be595a29146e390c ( Context * __context__, regex::Regex &  __re_rename_at_450 ) { das_stack_prologue __prologue(__context__,144,"re_assign_groups " DAS_FILE_LINE);
+{
+	TTuple<16,range,char *> _temp_make_local_451_32;
+	_Funcbuiltin_0x60_push_5459a94d4bd9a32f(__context__,das_arg<TArray<TTuple<16,range,char *>>>::pass(__re_rename_at_450.groups),das_arg<TTuple<16,range,char *>>::pass((([&]() -> TTuple<16,range,char *>& {
+		das_get_tuple_field<range,0>::get(_temp_make_local_451_32) = range(0,0);
+		das_get_tuple_field<char *,8>::get(_temp_make_local_451_32) = nullptr;
+		return _temp_make_local_451_32;
+	})())));
+	visit_top_down_ac4526f0a41e9d37(__context__,__re_rename_at_450.root,das_make_block<void,regex::ReNode *>(__context__,96,0,&__func_info__87bf23f355201ee1,[&](regex::ReNode * __node_rename_at_452)->void{
+		if ( __node_rename_at_452->op == DAS_COMMENT(enum) regex::ReOp::Group )
+		{
+			TTuple<16,range,char *> _temp_make_local_456_128;
+			int32_t __index_rename_at_454 = ((int32_t)builtin_array_size(das_arg<TArray<TTuple<16,range,char *>>>::pass(__re_rename_at_450.groups)));
+			das_copy(__node_rename_at_452->index,__index_rename_at_454);
+			_Funcbuiltin_0x60_push_5459a94d4bd9a32f(__context__,das_arg<TArray<TTuple<16,range,char *>>>::pass(__re_rename_at_450.groups),das_arg<TTuple<16,range,char *>>::pass((([&]() -> TTuple<16,range,char *>& {
+				das_get_tuple_field<range,0>::get(_temp_make_local_456_128) = range(0,0);
+				das_get_tuple_field<char *,8>::get(_temp_make_local_456_128) = das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<int32_t>::from(__index_rename_at_454)));
+				return _temp_make_local_456_128;
+			})())));
+		};
+	}));
+}}
+
+inline void re_assign_gen_functions_e944f4542bc4b4fb ( Context * __context__, regex::Regex &  __re_rename_at_462 ) { das_stack_prologue __prologue(__context__,96,"re_assign_gen_functions " DAS_FILE_LINE);
+{
+	visit_top_down_ac4526f0a41e9d37(__context__,__re_rename_at_462.root,das_make_block<void,regex::ReNode *>(__context__,80,0,&__func_info__87bf23f355201ee1,[&](regex::ReNode * __node_rename_at_463)->void{
+		if ( __node_rename_at_463->op == DAS_COMMENT(enum) regex::ReOp::Char )
+		{
+			das_copy(__node_rename_at_463->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_char 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 8046241476679676768u)));
+		} else if ( __node_rename_at_463->op == DAS_COMMENT(enum) regex::ReOp::Union )
+		{
+			das_copy(__node_rename_at_463->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_union 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 7992248383695919577u)));
+		} else if ( __node_rename_at_463->op == DAS_COMMENT(enum) regex::ReOp::Set )
+		{
+			das_copy(__node_rename_at_463->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_set 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 2691984598421217298u)));
+		} else if ( __node_rename_at_463->op == DAS_COMMENT(enum) regex::ReOp::Any )
+		{
+			das_copy(__node_rename_at_463->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_any 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 8550514668015468720u)));
+		} else if ( __node_rename_at_463->op == DAS_COMMENT(enum) regex::ReOp::Eos )
+		{
+			das_copy(__node_rename_at_463->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_eos 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 15183995938901420027u)));
+		} else if ( __node_rename_at_463->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+		{
+			das_copy(__node_rename_at_463->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_concat 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 595739048345671168u)));
+		} else if ( __node_rename_at_463->op == DAS_COMMENT(enum) regex::ReOp::Plus )
+		{
+			das_copy(__node_rename_at_463->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_plus 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 6368984693552296152u)));
+		} else if ( __node_rename_at_463->op == DAS_COMMENT(enum) regex::ReOp::Star )
+		{
+			das_copy(__node_rename_at_463->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_star 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 7088245411573916908u)));
+		} else if ( __node_rename_at_463->op == DAS_COMMENT(enum) regex::ReOp::Question )
+		{
+			das_copy(__node_rename_at_463->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_question 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 11766828063523245032u)));
+		} else if ( __node_rename_at_463->op == DAS_COMMENT(enum) regex::ReOp::Group )
+		{
+			das_copy(__node_rename_at_463->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_group 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 5538577211413169553u)));
+		} else {
+			builtin_throw(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<char * const >::from(((char *) "unsupported ")), cast<DAS_COMMENT(enum) regex::ReOp>::from(__node_rename_at_463->op))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		};
+	}));
+}}
+
+inline void re_flatten_d993754aea5776e3 ( Context * __context__, regex::ReNode * const  __node_rename_at_488, TArray<int32_t> &  __code_rename_at_488, TArray<uint32_t> &  __sets_rename_at_488 )
+{
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__code_rename_at_488),int32_t(__node_rename_at_488->op));
+	if ( __node_rename_at_488->op == DAS_COMMENT(enum) regex::ReOp::Char )
+	{
+		_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__code_rename_at_488),__node_rename_at_488->textLen);
+		{
+			bool __need_loop_492 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(mk_range(__node_rename_at_488->textLen));
+			int32_t __i_rename_at_492;
+			__need_loop_492 = __i_iterator.first(__context__,(__i_rename_at_492)) && __need_loop_492;
+			for ( ; __need_loop_492 ; __need_loop_492 = __i_iterator.next(__context__,(__i_rename_at_492)) )
+			{
+				_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__code_rename_at_488),get_character_at(__node_rename_at_488->text,__i_rename_at_492,__context__));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_492));
+		};
+	} else if ( __node_rename_at_488->op == DAS_COMMENT(enum) regex::ReOp::Set )
+	{
+		_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__code_rename_at_488),SimPolicy<int32_t>::Div(builtin_array_size(das_arg<TArray<uint32_t>>::pass(__sets_rename_at_488)),8,*__context__,nullptr));
+		{
+			bool __need_loop_496 = true;
+			// x : uint aka CharSet const&
+			das_iterator<TDim<uint32_t,8> const > __x_iterator(__node_rename_at_488->cset);
+			uint32_t const  * __x_rename_at_496;
+			__need_loop_496 = __x_iterator.first(__context__,(__x_rename_at_496)) && __need_loop_496;
+			for ( ; __need_loop_496 ; __need_loop_496 = __x_iterator.next(__context__,(__x_rename_at_496)) )
+			{
+				_Funcbuiltin_0x60_push_b1b73bc5bfdbac10(__context__,das_arg<TArray<uint32_t>>::pass(__sets_rename_at_488),(*__x_rename_at_496));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_496));
+		};
+	} else if ( __node_rename_at_488->op == DAS_COMMENT(enum) regex::ReOp::Group )
+	{
+		_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__code_rename_at_488),__node_rename_at_488->index);
+		re_flatten_d993754aea5776e3(__context__,__node_rename_at_488->subexpr,das_arg<TArray<int32_t>>::pass(__code_rename_at_488),das_arg<TArray<uint32_t>>::pass(__sets_rename_at_488));
+	} else if ( ((__node_rename_at_488->op == DAS_COMMENT(enum) regex::ReOp::Plus) || (__node_rename_at_488->op == DAS_COMMENT(enum) regex::ReOp::Star)) || (__node_rename_at_488->op == DAS_COMMENT(enum) regex::ReOp::Question) )
+	{
+		re_flatten_d993754aea5776e3(__context__,__node_rename_at_488->subexpr,das_arg<TArray<int32_t>>::pass(__code_rename_at_488),das_arg<TArray<uint32_t>>::pass(__sets_rename_at_488));
+	} else if ( __node_rename_at_488->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+	{
+		re_flatten_d993754aea5776e3(__context__,__node_rename_at_488->left,das_arg<TArray<int32_t>>::pass(__code_rename_at_488),das_arg<TArray<uint32_t>>::pass(__sets_rename_at_488));
+		re_flatten_d993754aea5776e3(__context__,__node_rename_at_488->right,das_arg<TArray<int32_t>>::pass(__code_rename_at_488),das_arg<TArray<uint32_t>>::pass(__sets_rename_at_488));
+	} else if ( __node_rename_at_488->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__code_rename_at_488),builtin_array_size(__node_rename_at_488->all));
+		{
+			bool __need_loop_508 = true;
+			// sub : regex::ReNode? const&
+			das_iterator<TArray<regex::ReNode *> const > __sub_iterator(__node_rename_at_488->all);
+			regex::ReNode * const  * __sub_rename_at_508;
+			__need_loop_508 = __sub_iterator.first(__context__,(__sub_rename_at_508)) && __need_loop_508;
+			for ( ; __need_loop_508 ; __need_loop_508 = __sub_iterator.next(__context__,(__sub_rename_at_508)) )
+			{
+				re_flatten_d993754aea5776e3(__context__,(*__sub_rename_at_508),das_arg<TArray<int32_t>>::pass(__code_rename_at_488),das_arg<TArray<uint32_t>>::pass(__sets_rename_at_488));
+			}
+			__sub_iterator.close(__context__,(__sub_rename_at_508));
+		};
+	};
+}
+
+inline void re_assign_dfa_4a49a17b076d9d70 ( Context * __context__, regex::Regex &  __re_rename_at_511 )
+{
+	TArray<int32_t> __code_rename_at_512; das_zero(__code_rename_at_512);
+	TArray<uint32_t> __sets_rename_at_513; das_zero(__sets_rename_at_513);
+	re_flatten_d993754aea5776e3(__context__,__re_rename_at_511.root,das_arg<TArray<int32_t>>::pass(__code_rename_at_512),das_arg<TArray<uint32_t>>::pass(__sets_rename_at_513));
+	das_delete_handle<das::RegexDfa *>::clear(__context__,__re_rename_at_511.dfa);
+	das_copy(__re_rename_at_511.dfa,builtin_regex_dfa_create(das_arg<TArray<int32_t>>::pass(__code_rename_at_512),das_arg<TArray<uint32_t>>::pass(__sets_rename_at_513)));
+	if ( __re_rename_at_511.dfa == nullptr )
+	{
+		builtin_throw(((char *) "regular expression did not compile into dfa"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__code_rename_at_512));
+	_Funcbuiltin_0x60_finalize_421bbf7456f4209b(__context__,das_arg<TArray<uint32_t>>::pass(__sets_rename_at_513));
+}
+
+inline void re_update_groups_21e51441caa1c545 ( Context * __context__, regex::Regex &  __regex_rename_at_523, range __at_rename_at_523 )
+{
+	das_copy(das_get_tuple_field<range,0>::get(__regex_rename_at_523.groups(0,__context__)),__at_rename_at_523);
+	{
+		bool __need_loop_525 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(das_arg<TArray<TTuple<16,range,char *>>>::pass(__regex_rename_at_523.groups))));
+		int32_t __i_rename_at_525;
+		__need_loop_525 = __i_iterator.first(__context__,(__i_rename_at_525)) && __need_loop_525;
+		for ( ; __need_loop_525 ; __need_loop_525 = __i_iterator.next(__context__,(__i_rename_at_525)) )
+		{
+			das_copy(das_get_tuple_field<range,0>::get(__regex_rename_at_523.groups(__i_rename_at_525,__context__)),builtin_regex_dfa_group(das_reinterpret<das::RegexDfa const  * const >::pass(__regex_rename_at_523.dfa),__i_rename_at_525,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_525));
+	};
+}
+
+inline bool re_early_out_7af43e1fb0ced133 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_532, regex::ReNode * const  __node_rename_at_532 )
+{
+	if ( __node_rename_at_532->op == DAS_COMMENT(enum) regex::ReOp::Char )
+	{
+		set_or_char_471888d9ed78efab(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_532),get_character_at(__node_rename_at_532->text,0,__context__));
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_532->op == DAS_COMMENT(enum) regex::ReOp::Set )
+	{
+		set_or_set_9609a9e932b32815(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_532),__node_rename_at_532->cset);
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_532->op == DAS_COMMENT(enum) regex::ReOp::Any )
+	{
+		{
+			bool __need_loop_540 = true;
+			// x : uint aka CharSet& -const
+			das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_532);
+			uint32_t * __x_rename_at_540;
+			__need_loop_540 = __x_iterator.first(__context__,(__x_rename_at_540)) && __need_loop_540;
+			for ( ; __need_loop_540 ; __need_loop_540 = __x_iterator.next(__context__,(__x_rename_at_540)) )
+			{
+				das_copy((*__x_rename_at_540),0xffffffffu);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_540));
+		};
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_532->op == DAS_COMMENT(enum) regex::ReOp::Eos )
+	{
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_532->op == DAS_COMMENT(enum) regex::ReOp::Group )
+	{
+		return das_auto_cast<bool>::cast(re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_532),__node_rename_at_532->subexpr));
+	} else if ( __node_rename_at_532->op == DAS_COMMENT(enum) regex::ReOp::Plus )
+	{
+		return das_auto_cast<bool>::cast(re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_532),__node_rename_at_532->subexpr));
+	} else if ( __node_rename_at_532->op == DAS_COMMENT(enum) regex::ReOp::Star )
+	{
+		re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_532),__node_rename_at_532->subexpr);
+		return das_auto_cast<bool>::cast(true);
+	} else if ( __node_rename_at_532->op == DAS_COMMENT(enum) regex::ReOp::Question )
+	{
+		re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_532),__node_rename_at_532->subexpr);
+		return das_auto_cast<bool>::cast(true);
+	} else if ( __node_rename_at_532->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+	{
+		bool __left_rename_at_556 = ((bool)re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_532),__node_rename_at_532->left));
+		return das_auto_cast<bool>::cast(__left_rename_at_556 ? das_auto_cast<bool>::cast(re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_532),__node_rename_at_532->right)) : das_auto_cast<bool>::cast(false));
+	} else if ( __node_rename_at_532->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		bool __any_rename_at_559 = false;
+		{
+			bool __need_loop_560 = true;
+			// sub : regex::ReNode? const&
+			das_iterator<TArray<regex::ReNode *> const > __sub_iterator(__node_rename_at_532->all);
+			regex::ReNode * const  * __sub_rename_at_560;
+			__need_loop_560 = __sub_iterator.first(__context__,(__sub_rename_at_560)) && __need_loop_560;
+			for ( ; __need_loop_560 ; __need_loop_560 = __sub_iterator.next(__context__,(__sub_rename_at_560)) )
+			{
+				das_copy(__any_rename_at_559,re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_532),(*__sub_rename_at_560)) || __any_rename_at_559);
+			}
+			__sub_iterator.close(__context__,(__sub_rename_at_560));
+		};
+		return das_auto_cast<bool>::cast(__any_rename_at_559);
+	} else {
+		builtin_throw(((char *) "unsupported operation"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		return das_auto_cast<bool>::cast(false);
+	};
+}
+
+inline bool is_valid_f341200a6f682e5a ( Context * __context__, regex::Regex &  __re_rename_at_571 )
+{
+	return das_auto_cast<bool>::cast(__re_rename_at_571.root != nullptr);
+}
+
+inline bool regex_compile_1c6ceefae1029905 ( Context * __context__, regex::Regex &  __re_rename_at_575, char * const  __expr_rename_at_575 )
+{
+	das_copy(__re_rename_at_575.root,re_parse_3d6f9a305b851160(__context__,__expr_rename_at_575));
+	if ( __re_rename_at_575.root != nullptr )
+	{
+		re_assign_next_1e223575dac53267(__context__,das_arg<regex::Regex>::pass(__re_rename_at_575));
+		re_assign_groups_be595a29146e390c(__context__,das_arg<regex::Regex>::pass(__re_rename_at_575));
+		re_assign_gen_functions_e944f4542bc4b4fb(__context__,das_arg<regex::Regex>::pass(__re_rename_at_575));
+		re_assign_dfa_4a49a17b076d9d70(__context__,das_arg<regex::Regex>::pass(__re_rename_at_575));
+		re_early_out_7af43e1fb0ced133(__context__,das_arg<TDim<uint32_t,8>>::pass(__re_rename_at_575.earlyOut),__re_rename_at_575.root);
+		das_copy(__re_rename_at_575.canEarlyOut,!is_set_empty_fb12252b2129800d(__context__,das_arg<TDim<uint32_t,8>>::pass(__re_rename_at_575.earlyOut)));
+	};
+	return das_auto_cast<bool>::cast(__re_rename_at_575.root != nullptr);
+}
+
+inline regex::Regex regex_compile_cb440f6619dde35e ( Context * __context__, char * const  __expr_rename_at_588 )
+{
+	regex::Regex __re_rename_at_589; das_zero(__re_rename_at_589);
+	if ( !regex_compile_1c6ceefae1029905(__context__,das_arg<regex::Regex>::pass(__re_rename_at_589),__expr_rename_at_588) )
+	{
+		builtin_throw(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "regular expression ")), cast<char * const >::from(__expr_rename_at_588), cast<char * const >::from(((char *) " did not compile")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return /* <- */ das_auto_cast_move<regex::Regex>::cast(_Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd(__context__,das_arg<regex::Regex>::pass(__re_rename_at_589)));
+}
+
+inline regex::Regex regex_compile_20788d8bca57961d ( Context * __context__, regex::Regex &  __re_rename_at_594 )
+{
+	if ( __re_rename_at_594.root != nullptr )
+	{
+		re_assign_next_1e223575dac53267(__context__,das_arg<regex::Regex>::pass(__re_rename_at_594));
+		re_assign_gen_functions_e944f4542bc4b4fb(__context__,das_arg<regex::Regex>::pass(__re_rename_at_594));
+		re_assign_dfa_4a49a17b076d9d70(__context__,das_arg<regex::Regex>::pass(__re_rename_at_594));
+	};
+	return /* <- */ das_auto_cast_move<regex::Regex>::cast(_Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd(__context__,das_arg<regex::Regex>::pass(__re_rename_at_594)));
+}
+
+inline int32_t regex_match_119cbbc847650282 ( Context * __context__, regex::Regex &  __regex_rename_at_601, char * const  __str_rename_at_601, int32_t __offset_rename_at_601 )
+{
+	if ( builtin_empty(__str_rename_at_601) )
+	{
+		return das_auto_cast<int32_t>::cast(-1);
+	} else {
+		int32_t __mend_rename_at_606 = ((int32_t)builtin_regex_dfa_match(__regex_rename_at_601.dfa,__str_rename_at_601,__offset_rename_at_601,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+		if ( (__mend_rename_at_606 != -1) && (builtin_array_size(das_arg<TArray<TTuple<16,range,char *>>>::pass(__regex_rename_at_601.groups)) != 0) )
+		{
+			re_update_groups_21e51441caa1c545(__context__,das_arg<regex::Regex>::pass(__regex_rename_at_601),range(__offset_rename_at_601,__mend_rename_at_606));
+		};
+		return das_auto_cast<int32_t>::cast(__mend_rename_at_606);
+	};
+}
+
+inline char * regex_group_ebcd2fdc1e09d9f2 ( Context * __context__, regex::Regex const  &  __regex_rename_at_611, int32_t __index_rename_at_611, char * const  __match_rename_at_611 )
+{
+	range __sub_range_rename_at_613 = ((range)das_get_tuple_field<range,0>::get(__regex_rename_at_611.groups(__index_rename_at_611,__context__)));
+	return das_auto_cast<char *>::cast(((char *)(builtin_string_slice1(__match_rename_at_611,v_extract_xi(v_cast_vec4i(__sub_range_rename_at_613)) /*x*/,v_extract_yi(v_cast_vec4i(__sub_range_rename_at_613)) /*y*/,__context__))));
+}
+
+inline void regex_foreach_28ddee2cdfd7178 ( Context * __context__, regex::Regex &  __regex_rename_at_616, char * const  __str_rename_at_616, Block DAS_COMMENT((bool,range)) const  &  __blk_rename_at_616 )
+{
+	if ( builtin_empty(__str_rename_at_616) )
+	{
+		return ;
+	} else {
+		int32_t __len_rename_at_621 = ((int32_t)builtin_string_length(__str_rename_at_616,__context__));
+		int32_t __pos_rename_at_622 = 0;
+		while ( __pos_rename_at_622 < __len_rename_at_621 )
+		{
+			range __at_rename_at_624 = ((range)builtin_regex_dfa_search_n(__regex_rename_at_616.dfa,__str_rename_at_616,__len_rename_at_621,__pos_rename_at_622,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+			if ( v_extract_xi(v_cast_vec4i(__at_rename_at_624)) /*x*/ == -1 )
+			{
+				break;
+			} else {
+				if ( builtin_array_size(das_arg<TArray<TTuple<16,range,char *>>>::pass(__regex_rename_at_616.groups)) != 0 )
+				{
+					re_update_groups_21e51441caa1c545(__context__,das_arg<regex::Regex>::pass(__regex_rename_at_616),__at_rename_at_624);
+				};
+				if ( !das_invoke<bool>::invoke<range>(__context__,nullptr,__blk_rename_at_616,__at_rename_at_624) )
+				{
+					break;
+				} else {
+					das_copy(__pos_rename_at_622,(v_extract_yi(v_cast_vec4i(__at_rename_at_624)) /*y*/ > v_extract_xi(v_cast_vec4i(__at_rename_at_624)) /*x*/) ? das_auto_cast<int32_t>::cast(v_extract_yi(v_cast_vec4i(__at_rename_at_624)) /*y*/) : das_auto_cast<int32_t>::cast((v_extract_yi(v_cast_vec4i(__at_rename_at_624)) /*y*/ + 1)));
+				};
+			};
+		};
+	};
+}
+
+inline void regex_debug_4ee5eac24b27a82d ( Context * __context__, regex::Regex const  &  __regex_rename_at_637 )
+{
+	debug_re_6ef8aee9197ccd4d(__context__,__regex_rename_at_637.root,1);
+	builtin_print(((char *) "\n"),__context__);
+	if ( __regex_rename_at_637.canEarlyOut )
+	{
+		builtin_print(((char *) "early out: "),__context__);
+		debug_set_6a9aba72f1044e9d(__context__,__regex_rename_at_637.earlyOut);
+		builtin_print(((char *) "\n"),__context__);
+	};
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_4, cast<char * const >::from(((char *) "dfa states: ")), cast<int32_t>::from(builtin_regex_dfa_states(das_reinterpret<das::RegexDfa const  * const >::pass(__regex_rename_at_637.dfa))), cast<char * const >::from(((char *) "\n")))),__context__);
+	if ( builtin_array_size(__regex_rename_at_637.groups) != 0 )
+	{
+		builtin_print(((char *) "groups:"),__context__);
+		{
+			bool __need_loop_648 = true;
+			// g : tuple<range;string> const&
+			das_iterator<TArray<TTuple<16,range,char *>> const > __g_iterator(__regex_rename_at_637.groups);
+			TTuple<16,range,char *> const  * __g_rename_at_648;
+			__need_loop_648 = __g_iterator.first(__context__,(__g_rename_at_648)) && __need_loop_648;
+			for ( ; __need_loop_648 ; __need_loop_648 = __g_iterator.next(__context__,(__g_rename_at_648)) )
+			{
+				builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_5, cast<char * const >::from(((char *) "\t")), cast<char * const >::from(das_get_tuple_field<char *,8>::get((*__g_rename_at_648))), cast<char * const >::from(((char *) "\n")))),__context__);
+			}
+			__g_iterator.close(__context__,(__g_rename_at_648));
+		};
+	};
+}
+
+inline void debug_set_6a9aba72f1044e9d ( Context * __context__, TDim<uint32_t,8> const  &  __cset_rename_at_651 )
+{
+	{
+		bool __need_loop_653 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,256));
+		int32_t __x_rename_at_653;
+		__need_loop_653 = __x_iterator.first(__context__,(__x_rename_at_653)) && __need_loop_653;
+		for ( ; __need_loop_653 ; __need_loop_653 = __x_iterator.next(__context__,(__x_rename_at_653)) )
+		{
+			if ( (__cset_rename_at_651((__x_rename_at_653 >> 5),__context__) & uint32_t(1 << (__x_rename_at_653 & 31))) != 0x0u )
+			{
+				if ( (__x_rename_at_653 >= 32) && (__x_rename_at_653 <= 127) )
+				{
+					builtin_print(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_6, cast<char *>::from(((char *)(to_string_char(__x_rename_at_653,__context__)))))),__context__);
+				} else {
+					builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_7, cast<char * const >::from(((char *) "\\")), cast<int32_t>::from(__x_rename_at_653))),__context__);
+				};
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_653));
+	};
+}
+
+inline void debug_re_6ef8aee9197ccd4d ( Context * __context__, regex::ReNode * const  __node_rename_at_660, int32_t __tab_rename_at_660 )
+{
+	builtin_print(((char *) "("),__context__);
+	if ( __node_rename_at_660 != nullptr )
+	{
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_8, cast<char * const >::from(((char *) "#")), cast<int32_t>::from(__node_rename_at_660->id))),__context__);
+		if ( __node_rename_at_660->next != nullptr )
+		{
+			builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_9, cast<char * const >::from(((char *) "->")), cast<int32_t>::from(__node_rename_at_660->next->id))),__context__);
+		} else {
+			builtin_print(((char *) "->!"),__context__);
+		};
+		builtin_print(((char *) " "),__context__);
+	};
+	if ( __node_rename_at_660 == nullptr )
+	{
+		builtin_print(((char *) "null)"),__context__);
+	} else if ( __node_rename_at_660->op == DAS_COMMENT(enum) regex::ReOp::Char )
+	{
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_10, cast<char * const >::from(((char *) "Char `")), cast<char * const >::from(__node_rename_at_660->text), cast<char * const >::from(((char *) "`)")))),__context__);
+	} else if ( __node_rename_at_660->op == DAS_COMMENT(enum) regex::ReOp::Set )
+	{
+		builtin_print(((char *) "Set "),__context__);
+		debug_set_6a9aba72f1044e9d(__context__,__node_rename_at_660->cset);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_660->op == DAS_COMMENT(enum) regex::ReOp::Any )
+	{
+		builtin_print(((char *) "Any)"),__context__);
+	} else if ( __node_rename_at_660->op == DAS_COMMENT(enum) regex::ReOp::Eos )
+	{
+		builtin_print(((char *) "Eos)"),__context__);
+	} else if ( __node_rename_at_660->op == DAS_COMMENT(enum) regex::ReOp::Group )
+	{
+		builtin_print(((char *) "Group "),__context__);
+		debug_re_6ef8aee9197ccd4d(__context__,__node_rename_at_660->subexpr,__tab_rename_at_660 + 1);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_660->op == DAS_COMMENT(enum) regex::ReOp::Plus )
+	{
+		builtin_print(((char *) "Plus "),__context__);
+		debug_re_6ef8aee9197ccd4d(__context__,__node_rename_at_660->subexpr,__tab_rename_at_660);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_660->op == DAS_COMMENT(enum) regex::ReOp::Star )
+	{
+		builtin_print(((char *) "Star "),__context__);
+		debug_re_6ef8aee9197ccd4d(__context__,__node_rename_at_660->subexpr,__tab_rename_at_660);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_660->op == DAS_COMMENT(enum) regex::ReOp::Question )
+	{
+		builtin_print(((char *) "Question "),__context__);
+		debug_re_6ef8aee9197ccd4d(__context__,__node_rename_at_660->subexpr,__tab_rename_at_660);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_660->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+	{
+		builtin_print(((char *) "Contact"),__context__);
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_11, cast<char * const >::from(((char *) "\n")), cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_660,__context__)))))),__context__);
+		debug_re_6ef8aee9197ccd4d(__context__,__node_rename_at_660->left,__tab_rename_at_660 + 1);
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_12, cast<char * const >::from(((char *) "\n")), cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_660,__context__)))))),__context__);
+		debug_re_6ef8aee9197ccd4d(__context__,__node_rename_at_660->right,__tab_rename_at_660 + 1);
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_13, cast<char * const >::from(((char *) "\n")), cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_660 - 1,__context__)))), cast<char * const >::from(((char *) ")")))),__context__);
+	} else if ( __node_rename_at_660->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		builtin_print(((char *) "Union\n"),__context__);
+		{
+			bool __need_loop_706 = true;
+			// sub : regex::ReNode? const&
+			das_iterator<TArray<regex::ReNode *> const > __sub_iterator(__node_rename_at_660->all);
+			regex::ReNode * const  * __sub_rename_at_706;
+			__need_loop_706 = __sub_iterator.first(__context__,(__sub_rename_at_706)) && __need_loop_706;
+			for ( ; __need_loop_706 ; __need_loop_706 = __sub_iterator.next(__context__,(__sub_rename_at_706)) )
+			{
+				builtin_print(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_14, cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_660,__context__)))))),__context__);
+				debug_re_6ef8aee9197ccd4d(__context__,(*__sub_rename_at_706),__tab_rename_at_660 + 1);
+				builtin_print(((char *) "\n"),__context__);
+			}
+			__sub_iterator.close(__context__,(__sub_rename_at_706));
+		};
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_15, cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_660 - 1,__context__)))), cast<char * const >::from(((char *) ")")))),__context__);
+	} else {
+		builtin_throw(((char *) "unsupported op"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+}
+
+inline int32_t rnd_set_character_f49e90c9ced30293 ( Context * __context__, TDim<uint32_t,8> const  &  __cset_rename_at_716, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_716 )
+{
+	uint32_t __total_rename_at_717 = ((uint32_t)char_set_total(__cset_rename_at_716));
+	uint32_t __idx_rename_at_718 = 0x0u;
+	_Funcbuiltin_0x60_next_160159e214cdd056(__context__,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_716),__idx_rename_at_718);
+	das_copy(__idx_rename_at_718,SimPolicy<uint32_t>::Mod(__idx_rename_at_718,__total_rename_at_717,*__context__,nullptr));
+	return das_auto_cast<int32_t>::cast(char_set_element(int32_t(__idx_rename_at_718),__cset_rename_at_716));
+}
+
+inline void re_gen2_fail_83869989d4feff33 ( Context * __context__, regex::ReNode * __node_rename_at_723, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_723, StringBuilderWriter &  __str_rename_at_723 )
+{
+	DAS_ASSERTF((false),(((char *) "not running generated regex")));
+}
+
+inline void re_gen2_char_370fcc7fc2a0d7da ( Context * __context__, regex::ReNode * __node_rename_at_728, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_728, StringBuilderWriter &  __str_rename_at_728 )
+{
+	das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_16,cast<StringBuilderWriter &>::from(__str_rename_at_728),cast<char *>::from(__node_rename_at_728->text)));
+	regex::ReNode * __node2_rename_at_732 = __node_rename_at_728->next;
+	if ( __node2_rename_at_732 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_732->gen2,__node2_rename_at_732,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_728),das_arg<StringBuilderWriter>::pass(__str_rename_at_728));
+	};
+}
+
+inline void re_gen2_union_33d97a91bd270c92 ( Context * __context__, regex::ReNode * __node_rename_at_736, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_736, StringBuilderWriter &  __str_rename_at_736 )
+{
+	uint32_t __nidx_rename_at_739 = 0x0u;
+	_Funcbuiltin_0x60_next_160159e214cdd056(__context__,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_736),__nidx_rename_at_739);
+	das_copy(__nidx_rename_at_739,SimPolicy<uint32_t>::Mod(__nidx_rename_at_739,uint32_t(builtin_array_size(das_arg<TArray<regex::ReNode *>>::pass(__node_rename_at_736->all))),*__context__,nullptr));
+	regex::ReNode * __sub_rename_at_742 = __node_rename_at_736->all(__nidx_rename_at_739,__context__);
+	das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__sub_rename_at_742->gen2,__sub_rename_at_742,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_736),das_arg<StringBuilderWriter>::pass(__str_rename_at_736));
+}
+
+inline void re_gen2_set_ac6c2c3df070a8b3 ( Context * __context__, regex::ReNode * __node_rename_at_745, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_745, StringBuilderWriter &  __str_rename_at_745 )
+{
+	write_string_char(das_arg<StringBuilderWriter>::pass(__str_rename_at_745),rnd_set_character_f49e90c9ced30293(__context__,das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_745->cset),das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_745)));
+	regex::ReNode * __node2_rename_at_749 = __node_rename_at_745->next;
+	if ( __node2_rename_at_749 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_749->gen2,__node2_rename_at_749,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_745),das_arg<StringBuilderWriter>::pass(__str_rename_at_745));
+	};
+}
+
+inline void re_gen2_any_1b218e3963c72de8 ( Context * __context__, regex::ReNode * __node_rename_at_753, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_753, StringBuilderWriter &  __str_rename_at_753 )
+{
+	uint32_t __ch_rename_at_756 = 0;
+	_Funcbuiltin_0x60_next_160159e214cdd056(__context__,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_753),__ch_rename_at_756);
+	write_string_char(das_arg<StringBuilderWriter>::pass(__str_rename_at_753),int32_t((SimPolicy<uint32_t>::Mod(__ch_rename_at_756,0xffu,*__context__,nullptr)) + 0x1u));
+	regex::ReNode * __node2_rename_at_759 = __node_rename_at_753->next;
+	if ( __node2_rename_at_759 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_759->gen2,__node2_rename_at_759,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_753),das_arg<StringBuilderWriter>::pass(__str_rename_at_753));
+	};
+}
+
+inline void re_gen2_concat_4a5931c710a8a787 ( Context * __context__, regex::ReNode * __node_rename_at_763, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_763, StringBuilderWriter &  __str_rename_at_763 )
+{
+	regex::ReNode * __left_rename_at_766 = __node_rename_at_763->left;
+	das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__left_rename_at_766->gen2,__left_rename_at_766,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_763),das_arg<StringBuilderWriter>::pass(__str_rename_at_763));
+}
+
+inline void re_gen2_eos_d01cc98126afe4e7 ( Context * __context__, regex::ReNode * __node_rename_at_769, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_769, StringBuilderWriter &  __str_rename_at_769 )
+{
+	regex::ReNode * __node2_rename_at_772 = __node_rename_at_769->next;
+	if ( __node2_rename_at_772 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_772->gen2,__node2_rename_at_772,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_769),das_arg<StringBuilderWriter>::pass(__str_rename_at_769));
+	};
+}
+
+inline void re_gen2_question_af2eab39b56e287d ( Context * __context__, regex::ReNode * __node_rename_at_776, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_776, StringBuilderWriter &  __str_rename_at_776 )
+{
+	uint32_t __a_rename_at_779 = 0x0u;
+	_Funcbuiltin_0x60_next_160159e214cdd056(__context__,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_776),__a_rename_at_779);
+	if ( (__a_rename_at_779 & 0x1u) != 0x0u )
+	{
+		regex::ReNode * __nsub_rename_at_782 = __node_rename_at_776->subexpr;
+		if ( __nsub_rename_at_782 != nullptr )
+		{
+			das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__nsub_rename_at_782->gen2,__nsub_rename_at_782,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_776),das_arg<StringBuilderWriter>::pass(__str_rename_at_776));
+		};
+	};
+	regex::ReNode * __node2_rename_at_785 = __node_rename_at_776->next;
+	if ( __node2_rename_at_785 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_785->gen2,__node2_rename_at_785,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_776),das_arg<StringBuilderWriter>::pass(__str_rename_at_776));
+	};
+}
+
+inline void re_gen2_plus_76a9bcb3f5e8ce53 ( Context * __context__, regex::ReNode * __node_rename_at_789, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_789, StringBuilderWriter &  __str_rename_at_789 )
+{
+	uint32_t __cnt_rename_at_792 = 0x0u;
+	_Funcbuiltin_0x60_next_160159e214cdd056(__context__,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_789),__cnt_rename_at_792);
+	das_copy(__cnt_rename_at_792,(SimPolicy<uint32_t>::Mod(__cnt_rename_at_792,das_global<uint32_t,0x570cc75ae91fa86f>(__context__) /*re_gen_rep_limit*/,*__context__,nullptr)) + 0x1u);
+	regex::ReNode * __nsub_rename_at_795 = __node_rename_at_789->subexpr;
+	if ( __nsub_rename_at_795 != nullptr )
+	{
+		{
+			bool __need_loop_797 = true;
+			// i : uint const
+			das_iterator<urange> __i_iterator(mk_urange(__cnt_rename_at_792));
+			uint32_t __i_rename_at_797;
+			__need_loop_797 = __i_iterator.first(__context__,(__i_rename_at_797)) && __need_loop_797;
+			for ( ; __need_loop_797 ; __need_loop_797 = __i_iterator.next(__context__,(__i_rename_at_797)) )
+			{
+				das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__nsub_rename_at_795->gen2,__nsub_rename_at_795,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_789),das_arg<StringBuilderWriter>::pass(__str_rename_at_789));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_797));
+		};
+	};
+	regex::ReNode * __node2_rename_at_799 = __node_rename_at_789->next;
+	if ( __node2_rename_at_799 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_799->gen2,__node2_rename_at_799,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_789),das_arg<StringBuilderWriter>::pass(__str_rename_at_789));
+	};
+}
+
+inline void re_gen2_star_45edaea538181594 ( Context * __context__, regex::ReNode * __node_rename_at_803, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_803, StringBuilderWriter &  __str_rename_at_803 )
+{
+	uint32_t __cnt_rename_at_806 = 0x0u;
+	_Funcbuiltin_0x60_next_160159e214cdd056(__context__,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_803),__cnt_rename_at_806);
+	das_copy(__cnt_rename_at_806,SimPolicy<uint32_t>::Mod(__cnt_rename_at_806,das_global<uint32_t,0x570cc75ae91fa86f>(__context__) /*re_gen_rep_limit*/,*__context__,nullptr));
+	regex::ReNode * __nsub_rename_at_809 = __node_rename_at_803->subexpr;
+	if ( __nsub_rename_at_809 != nullptr )
+	{
+		{
+			bool __need_loop_811 = true;
+			// i : uint const
+			das_iterator<urange> __i_iterator(mk_urange(__cnt_rename_at_806));
+			uint32_t __i_rename_at_811;
+			__need_loop_811 = __i_iterator.first(__context__,(__i_rename_at_811)) && __need_loop_811;
+			for ( ; __need_loop_811 ; __need_loop_811 = __i_iterator.next(__context__,(__i_rename_at_811)) )
+			{
+				das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__nsub_rename_at_809->gen2,__nsub_rename_at_809,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_803),das_arg<StringBuilderWriter>::pass(__str_rename_at_803));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_811));
+		};
+	};
+	regex::ReNode * __node2_rename_at_813 = __node_rename_at_803->next;
+	if ( __node2_rename_at_813 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_813->gen2,__node2_rename_at_813,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_803),das_arg<StringBuilderWriter>::pass(__str_rename_at_803));
+	};
+}
+
+inline void re_gen2_group_9b3a7a90752f4346 ( Context * __context__, regex::ReNode * __node_rename_at_817, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_817, StringBuilderWriter &  __str_rename_at_817 )
+{
+	regex::ReNode * __nsub_rename_at_820 = __node_rename_at_817->subexpr;
+	if ( __nsub_rename_at_820 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__nsub_rename_at_820->gen2,__nsub_rename_at_820,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_817),das_arg<StringBuilderWriter>::pass(__str_rename_at_817));
+	};
+	regex::ReNode * __node2_rename_at_823 = __node_rename_at_817->next;
+	if ( __node2_rename_at_823 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_823->gen2,__node2_rename_at_823,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_817),das_arg<StringBuilderWriter>::pass(__str_rename_at_817));
+	};
+}
+
+inline char * re_gen_fb69f2af2094439b ( Context * __context__, regex::Regex &  __re_rename_at_827, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_827 )
+{
+	return das_auto_cast<char *>::cast(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_828)->void{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__re_rename_at_827.root->gen2,__re_rename_at_827.root,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_827),das_arg<StringBuilderWriter>::pass(__writer_rename_at_828));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_13e4a05653768251
+	aotLib[0xb8d697922f2109d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<regex::ReNode *> & , int32_t  ),&_Funcbuiltin_0x60_resize_13e4a05653768251>>();
+	};
+	// _Funcbuiltin_0x60_finalize_b7deb464a4f8e41c
+	aotLib[0xc597f9731c8fe807] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<regex::ReNode *> &  ),&_Funcbuiltin_0x60_finalize_b7deb464a4f8e41c>>();
+	};
+	// _Funcbuiltin_0x60_length_7938efcc1bc3eff1
+	aotLib[0x494cf457a90783a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<regex::ReNode *,2> const  &  ),&_Funcbuiltin_0x60_length_7938efcc1bc3eff1>>();
+	};
+	// finalize_7420a122bf22c777
+	aotLib[0xa8d619cf3d9026dc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode &  ),&finalize_7420a122bf22c777>>();
+	};
+	// _Funcbuiltin_0x60_push_5459a94d4bd9a32f
+	aotLib[0x18b5b5d03aa848e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<16,range,char *>> & , TTuple<16,range,char *> const  &  ),&_Funcbuiltin_0x60_push_5459a94d4bd9a32f>>();
+	};
+	// _Funcbuiltin_0x60_finalize_c5f896860856389a
+	aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+	// _Funcbuiltin_0x60_finalize_421bbf7456f4209b
+	aotLib[0x69eac962e2793875] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> &  ),&_Funcbuiltin_0x60_finalize_421bbf7456f4209b>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd
+	aotLib[0x15eca16e6b0825d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<regex::Regex & (*) ( Context * __context__, regex::Regex &  ),&_Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd>>();
+	};
+	// finalize_6293242d2ef1254f
+	aotLib[0xd7ddb255c751e160] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TVariant<16,regex::ReNode *,void *> &  ),&finalize_6293242d2ef1254f>>();
+	};
+	// finalize_e041fb14490aa83b
+	aotLib[0xc14ac51bfff26d76] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * &  ),&finalize_e041fb14490aa83b>>();
+	};
+	// _Funcbuiltin_0x60_push_5dc212b561cc93c2
+	aotLib[0x2819a5074444d141] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<regex::ReNode *> & , regex::ReNode * const   ),&_Funcbuiltin_0x60_push_5dc212b561cc93c2>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_1a55d1eab5baa002
+	aotLib[0x55241868c5b1962e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<regex::ReNode *> (*) ( Context * __context__, TDim<regex::ReNode *,2> &  ),&_Funcbuiltin_0x60_to_array_move_1a55d1eab5baa002>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Funcbuiltin_0x60_push_b1b73bc5bfdbac10
+	aotLib[0x3e4b2c826191dba1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> & , uint32_t  ),&_Funcbuiltin_0x60_push_b1b73bc5bfdbac10>>();
+	};
+	// _Funcbuiltin_0x60_next_160159e214cdd056
+	aotLib[0xd6705851b835dfed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((uint32_t)) const  & , uint32_t &  ),&_Funcbuiltin_0x60_next_160159e214cdd056>>();
+	};
+	// re_gen_get_rep_limit_aad39a472678db9d
+	aotLib[0xada002926028ce01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__ ),&re_gen_get_rep_limit_aad39a472678db9d>>();
+	};
+	// trace_89f6695f8909b072
+	aotLib[0x3501f19b79ba4ed9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , int32_t  ),&trace_89f6695f8909b072>>();
+	};
+	// note_89f6695f8909b072
+	aotLib[0x3501f19b79ba4ed9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , int32_t  ),&note_89f6695f8909b072>>();
+	};
+	// trace_backtrack_c77fe5b3ac1a6a7c
+	aotLib[0x474399c20ee853ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&trace_backtrack_c77fe5b3ac1a6a7c>>();
+	};
+	// trace_value_4739abdd3b0a7208
+	aotLib[0xd1da75c466857d11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * const   ),&trace_value_4739abdd3b0a7208>>();
+	};
+	// nada_5086bd0a540f8186
+	aotLib[0x9b6df455d513d23d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__ ),&nada_5086bd0a540f8186>>();
+	};
+	// maybe_4cddd0f3894095b8
+	aotLib[0xeb64f8d42f3fed45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, regex::ReNode * const   ),&maybe_4cddd0f3894095b8>>();
+	};
+	// eos_dde6e11fd3802ac8
+	aotLib[0x961e013842bdd11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, char * const  , int32_t  ),&eos_dde6e11fd3802ac8>>();
+	};
+	// at_c9bade5ff7edd57d
+	aotLib[0x9d976e8cdb634999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, char * const  , int32_t  ),&at_c9bade5ff7edd57d>>();
+	};
+	// next_47eaeae3973f3d0a
+	aotLib[0x6b6e379d5b0da945] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TVariant<16,regex::ReNode *,void *> const  &  ),&next_47eaeae3973f3d0a>>();
+	};
+	// is_set_empty_fb12252b2129800d
+	aotLib[0x920d0936973b20a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TDim<uint32_t,8> const  &  ),&is_set_empty_fb12252b2129800d>>();
+	};
+	// set_or_char_471888d9ed78efab
+	aotLib[0xc4836b64ee70e729] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , int32_t  ),&set_or_char_471888d9ed78efab>>();
+	};
+	// set_or_range_a7ad44e8ef1ec07c
+	aotLib[0xcc4c06a5bc038efd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , range  ),&set_or_range_a7ad44e8ef1ec07c>>();
+	};
+	// set_invert_be791c77bc6b6a11
+	aotLib[0x6dfa45c4c6120e9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> &  ),&set_invert_be791c77bc6b6a11>>();
+	};
+	// set_or_set_9609a9e932b32815
+	aotLib[0xa88845650b665991] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , TDim<uint32_t,8> const  &  ),&set_or_set_9609a9e932b32815>>();
+	};
+	// set_negative_7a1fcd94df7d5358
+	aotLib[0xf2801af36a693199] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> &  ),&set_negative_7a1fcd94df7d5358>>();
+	};
+	// set_meta_2f4780f8ef5a2b6d
+	aotLib[0xea3bb10360256ace] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , int32_t  ),&set_meta_2f4780f8ef5a2b6d>>();
+	};
+	// is_meta_character_24d3d25015b1373f
+	aotLib[0xc2120b306e7bee35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&is_meta_character_24d3d25015b1373f>>();
+	};
+	// is_set_character_11f8fcca4329c870
+	aotLib[0x71b9b841679480a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&is_set_character_11f8fcca4329c870>>();
+	};
+	// re_char_82ce59dc4838976a
+	aotLib[0x844d55935d513940] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_char_82ce59dc4838976a>>();
+	};
+	// re_set_items_39e8d6427890060c
+	aotLib[0x2ede6c0b16b508fc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_set_items_39e8d6427890060c>>();
+	};
+	// re_set_4203278ac10d8cd6
+	aotLib[0x49c48a1d33ca9565] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_set_4203278ac10d8cd6>>();
+	};
+	// re_any_effdf3f7b62b2ac1
+	aotLib[0x15f20d52365d114a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_any_effdf3f7b62b2ac1>>();
+	};
+	// re_eos_fe251bbc0838f42e
+	aotLib[0xb0d3153599756052] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_eos_fe251bbc0838f42e>>();
+	};
+	// re_group_3a964ad67daa5bc1
+	aotLib[0xc4299069455caf77] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_group_3a964ad67daa5bc1>>();
+	};
+	// re_elementary_44bc08d3b62d065a
+	aotLib[0x907c073522188182] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_elementary_44bc08d3b62d065a>>();
+	};
+	// mk_concat_2c96f9e344dd637b
+	aotLib[0xe7fac1541b0df6cc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<regex::ReNode * (*) ( Context * __context__, regex::ReNode * , regex::ReNode *  ),&mk_concat_2c96f9e344dd637b>>();
+	};
+	// mk_union_ecbeb7e14987ecd7
+	aotLib[0x8c9f30ff51289e30] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<regex::ReNode * (*) ( Context * __context__, regex::ReNode * , regex::ReNode *  ),&mk_union_ecbeb7e14987ecd7>>();
+	};
+	// re_re_ace328bebb48ab0d
+	aotLib[0xbcb15c796b2a0ebe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_re_ace328bebb48ab0d>>();
+	};
+	// re_basic_3a34fb27b8e53d4a
+	aotLib[0xe66aed2f044623d6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_basic_3a34fb27b8e53d4a>>();
+	};
+	// re_parse_3d6f9a305b851160
+	aotLib[0x5c09e0c5db75e836] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<regex::ReNode * (*) ( Context * __context__, char * const   ),&re_parse_3d6f9a305b851160>>();
+	};
+	// visit_top_down_ac4526f0a41e9d37
+	aotLib[0x9f6415e6b4b8a2f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Block DAS_COMMENT((void,regex::ReNode *)) const  &  ),&visit_top_down_ac4526f0a41e9d37>>();
+	};
+	// re_assign_next_1e223575dac53267
+	aotLib[0xaace75c377fbafe4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex &  ),&re_assign_next_1e223575dac53267>>();
+	};
+	// re_assign_groups_be595a29146e390c
+	aotLib[0x40542f2e66d3fa79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex &  ),&re_assign_groups_be595a29146e390c>>();
+	};
+	// re_assign_gen_functions_e944f4542bc4b4fb
+	aotLib[0x715e9b5ea5d420c7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex &  ),&re_assign_gen_functions_e944f4542bc4b4fb>>();
+	};
+	// re_flatten_d993754aea5776e3
+	aotLib[0x9dda48b13b9b9bd6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * const  , TArray<int32_t> & , TArray<uint32_t> &  ),&re_flatten_d993754aea5776e3>>();
+	};
+	// re_assign_dfa_4a49a17b076d9d70
+	aotLib[0x1d0928f3837e62d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex &  ),&re_assign_dfa_4a49a17b076d9d70>>();
+	};
+	// re_update_groups_21e51441caa1c545
+	aotLib[0x9ab4277b9285ab55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex & , range  ),&re_update_groups_21e51441caa1c545>>();
+	};
+	// re_early_out_7af43e1fb0ced133
+	aotLib[0x54b205eeccb9c7d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TDim<uint32_t,8> & , regex::ReNode * const   ),&re_early_out_7af43e1fb0ced133>>();
+	};
+	// is_valid_f341200a6f682e5a
+	aotLib[0xb251f5a94789ee91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, regex::Regex &  ),&is_valid_f341200a6f682e5a>>();
+	};
+	// regex_compile_1c6ceefae1029905
+	aotLib[0x2f0f676a8dd1624d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, regex::Regex & , char * const   ),&regex_compile_1c6ceefae1029905>>();
+	};
+	// regex_compile_cb440f6619dde35e
+	aotLib[0x1a4564651b3bb0b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<regex::Regex (*) ( Context * __context__, char * const   ),&regex_compile_cb440f6619dde35e>>();
+	};
+	// regex_compile_20788d8bca57961d
+	aotLib[0x8f63ddcd146b9d3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<regex::Regex (*) ( Context * __context__, regex::Regex &  ),&regex_compile_20788d8bca57961d>>();
+	};
+	// regex_match_119cbbc847650282
+	aotLib[0x219be97225ef7b43] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, regex::Regex & , char * const  , int32_t  ),&regex_match_119cbbc847650282>>();
+	};
+	// regex_group_ebcd2fdc1e09d9f2
+	aotLib[0xfa43ec1ce01d40e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, regex::Regex const  & , int32_t , char * const   ),&regex_group_ebcd2fdc1e09d9f2>>();
+	};
+	// regex_foreach_28ddee2cdfd7178
+	aotLib[0xe15a2ee1a29c639b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex & , char * const  , Block DAS_COMMENT((bool,range)) const  &  ),&regex_foreach_28ddee2cdfd7178>>();
+	};
+	// regex_debug_4ee5eac24b27a82d
+	aotLib[0x24923df3c8fab825] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex const  &  ),&regex_debug_4ee5eac24b27a82d>>();
+	};
+	// debug_set_6a9aba72f1044e9d
+	aotLib[0xb4e4311490eb1b35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> const  &  ),&debug_set_6a9aba72f1044e9d>>();
+	};
+	// debug_re_6ef8aee9197ccd4d
+	aotLib[0xa92c6adbcaca7821] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * const  , int32_t  ),&debug_re_6ef8aee9197ccd4d>>();
+	};
+	// rnd_set_character_f49e90c9ced30293
+	aotLib[0x5b224d81600557d4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<uint32_t,8> const  & , Sequence DAS_COMMENT((uint32_t)) &  ),&rnd_set_character_f49e90c9ced30293>>();
+	};
+	// re_gen2_fail_83869989d4feff33
+	aotLib[0xe9380307d33f83d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_fail_83869989d4feff33>>();
+	};
+	// re_gen2_char_370fcc7fc2a0d7da
+	aotLib[0x54c4e5d936807de5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_char_370fcc7fc2a0d7da>>();
+	};
+	// re_gen2_union_33d97a91bd270c92
+	aotLib[0x7f375ed60c1aba0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_union_33d97a91bd270c92>>();
+	};
+	// re_gen2_set_ac6c2c3df070a8b3
+	aotLib[0x8b4320d6391fca17] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_set_ac6c2c3df070a8b3>>();
+	};
+	// re_gen2_any_1b218e3963c72de8
+	aotLib[0xdff29fa75ff68910] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_any_1b218e3963c72de8>>();
+	};
+	// re_gen2_concat_4a5931c710a8a787
+	aotLib[0xd5bed0e37667373d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_concat_4a5931c710a8a787>>();
+	};
+	// re_gen2_eos_d01cc98126afe4e7
+	aotLib[0x77bdbeb40a40a465] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_eos_d01cc98126afe4e7>>();
+	};
+	// re_gen2_question_af2eab39b56e287d
+	aotLib[0xb5c56654f4682290] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_question_af2eab39b56e287d>>();
+	};
+	// re_gen2_plus_76a9bcb3f5e8ce53
+	aotLib[0x153fdadca485707c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_plus_76a9bcb3f5e8ce53>>();
+	};
+	// re_gen2_star_45edaea538181594
+	aotLib[0x61c281e960ce7030] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_star_45edaea538181594>>();
+	};
+	// re_gen2_group_9b3a7a90752f4346
+	aotLib[0x2944c676df7dfec1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_group_9b3a7a90752f4346>>();
+	};
+	// re_gen_fb69f2af2094439b
+	aotLib[0x7d276caee1471721] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, regex::Regex & , Sequence DAS_COMMENT((uint32_t)) &  ),&re_gen_fb69f2af2094439b>>();
+	};
+	// [[ init script ]]
+	aotLib[0x53f31391d7ece01d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
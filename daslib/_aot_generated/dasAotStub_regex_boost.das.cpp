@@ -0,0 +1,378 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require regex_boost
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require regex_native
+#include "daScript/simulate/aot_builtin_regex.h"
+ // require strings_boost
+ // require ast_boost
+ // require regex
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15020086730213594445 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace regex_boost { struct RegexReader; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace regex { struct ReNode; };
+namespace regex { struct Regex; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+namespace ast {
+
+struct AstReaderMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstReaderMacro)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(AstReaderMacro)==32,"structure size mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,accept)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,visit)==24,"structure field offset mismatch with DAS");
+}
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+namespace regex {
+
+enum class ReOp : int32_t {
+	Char = int32_t(0),
+	Set = int32_t(1),
+	Any = int32_t(2),
+	Eos = int32_t(3),
+	Group = int32_t(4),
+	Plus = int32_t(5),
+	Star = int32_t(6),
+	Question = int32_t(7),
+	Concat = int32_t(8),
+	Union = int32_t(9),
+};
+}
+}
+template <> struct cast< das::_anon_15020086730213594445::regex::ReOp > : cast_enum < das::_anon_15020086730213594445::regex::ReOp > {};
+namespace _anon_15020086730213594445 {
+namespace regex {
+
+struct ReNode {
+	DAS_COMMENT(enum) regex::ReOp op;
+	int32_t id;
+	Func DAS_COMMENT((void,regex::ReNode *,Sequence DAS_COMMENT((uint32_t)),StringBuilderWriter)) gen2;
+	range at;
+	char * text;
+	int32_t textLen;
+	TArray<regex::ReNode *> all;
+	regex::ReNode * left;
+	regex::ReNode * right;
+	regex::ReNode * subexpr;
+	regex::ReNode * next;
+	TDim<uint32_t,8> cset;
+	int32_t index;
+};
+static_assert(sizeof(ReNode)==136,"structure size mismatch with DAS");
+static_assert(offsetof(ReNode,op)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,id)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,gen2)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,at)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,text)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,textLen)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,all)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,left)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,right)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,subexpr)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,next)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,cset)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,index)==128,"structure field offset mismatch with DAS");
+}
+namespace regex {
+
+struct Regex {
+	regex::ReNode * root;
+	TArray<TTuple<16,range,char *>> groups;
+	TDim<uint32_t,8> earlyOut;
+	bool canEarlyOut;
+	das::RegexDfa * dfa;
+};
+static_assert(sizeof(Regex)==80,"structure size mismatch with DAS");
+static_assert(offsetof(Regex,root)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,groups)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,earlyOut)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,canEarlyOut)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,dfa)==72,"structure field offset mismatch with DAS");
+}
+namespace regex_boost {
+
+struct RegexReader {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstReaderMacro)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(RegexReader)==32,"structure size mismatch with DAS");
+static_assert(offsetof(RegexReader,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(RegexReader,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(RegexReader,accept)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(RegexReader,visit)==24,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_1db505b7ad774ab5 ( Context * __context__, TTuple<16,range,char *> & ____this_rename_at_403 );
+inline void _Funcbuiltin_0x60_finalize_60c23d3d85f22938 ( Context * __context__, TArray<regex::ReNode *> & __a_rename_at_399 );
+inline void _Funcbuiltin_0x60_push_3829c23a64340ec ( Context * __context__, TArray<ast::AstReaderMacro *> & __Arr_rename_at_75, ast::AstReaderMacro * const  __value_rename_at_75 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_ab5dd2b7ce1d5817 ( Context * __context__, regex_boost::RegexReader const  & __cl_rename_at_86 );
+inline void finalize_202c8634c7153327 ( Context * __context__, regex::ReNode & ____this_rename_at_27 );
+inline void _Funcbuiltin_0x60_finalize_c94dbb44c55359ce ( Context * __context__, TArray<TTuple<16,range,char *>> & __a_rename_at_399 );
+inline void finalize_bcdf3dabdf9d94bf ( Context * __context__, regex::ReNode * & ____this_rename_at_45 );
+inline void finalize_470d66ad897cf4 ( Context * __context__, regex::Regex & ____this_rename_at_43 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_1db505b7ad774ab5 ( Context * __context__, TTuple<16,range,char *> &  ____this_rename_at_403 )
+{
+	memset(&(____this_rename_at_403), 0, 16);
+}
+
+inline void _Funcbuiltin_0x60_finalize_60c23d3d85f22938 ( Context * __context__, TArray<regex::ReNode *> &  __a_rename_at_399 )
+{
+	{
+		bool __need_loop_401 = true;
+		// aV : regex::ReNode? aka TT&
+		das_iterator<TArray<regex::ReNode *>> __aV_iterator(__a_rename_at_399);
+		regex::ReNode * * __aV_rename_at_401;
+		__need_loop_401 = __aV_iterator.first(__context__,(__aV_rename_at_401)) && __need_loop_401;
+		for ( ; __need_loop_401 ; __need_loop_401 = __aV_iterator.next(__context__,(__aV_rename_at_401)) )
+		{
+			finalize_bcdf3dabdf9d94bf(__context__,(*__aV_rename_at_401));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_401));
+	};
+	builtin_array_free(das_arg<TArray<regex::ReNode *>>::pass(__a_rename_at_399),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_3829c23a64340ec ( Context * __context__, TArray<ast::AstReaderMacro *> &  __Arr_rename_at_75, ast::AstReaderMacro * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<ast::AstReaderMacro *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_ab5dd2b7ce1d5817 ( Context * __context__, regex_boost::RegexReader const  &  __cl_rename_at_86 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo const  *>::cast(__cl_rename_at_86.__rtti)->structType /*structType*/));
+}
+
+inline void finalize_202c8634c7153327 ( Context * __context__, regex::ReNode &  ____this_rename_at_27 )
+{
+	_Funcbuiltin_0x60_finalize_60c23d3d85f22938(__context__,das_arg<TArray<regex::ReNode *>>::pass(____this_rename_at_27.all));
+	finalize_bcdf3dabdf9d94bf(__context__,____this_rename_at_27.left);
+	finalize_bcdf3dabdf9d94bf(__context__,____this_rename_at_27.right);
+	finalize_bcdf3dabdf9d94bf(__context__,____this_rename_at_27.subexpr);
+	memset(&(____this_rename_at_27), 0, 136);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c94dbb44c55359ce ( Context * __context__, TArray<TTuple<16,range,char *>> &  __a_rename_at_399 )
+{
+	{
+		bool __need_loop_401 = true;
+		// aV : tuple<range;string> aka TT&
+		das_iterator<TArray<TTuple<16,range,char *>>> __aV_iterator(__a_rename_at_399);
+		TTuple<16,range,char *> * __aV_rename_at_401;
+		__need_loop_401 = __aV_iterator.first(__context__,(__aV_rename_at_401)) && __need_loop_401;
+		for ( ; __need_loop_401 ; __need_loop_401 = __aV_iterator.next(__context__,(__aV_rename_at_401)) )
+		{
+			finalize_1db505b7ad774ab5(__context__,das_arg<TTuple<16,range,char *>>::pass((*__aV_rename_at_401)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_401));
+	};
+	builtin_array_free(das_arg<TArray<TTuple<16,range,char *>>>::pass(__a_rename_at_399),16,__context__);
+}
+
+inline void finalize_bcdf3dabdf9d94bf ( Context * __context__, regex::ReNode * & ____this_rename_at_45 )
+{
+	if ( ____this_rename_at_45 != nullptr )
+	{
+		finalize_202c8634c7153327(__context__,das_arg<regex::ReNode>::pass(das_deref(__context__,____this_rename_at_45)));
+		das_delete<regex::ReNode *>::clear(__context__,____this_rename_at_45);
+		das_copy(____this_rename_at_45,nullptr);
+	};
+}
+
+inline void finalize_470d66ad897cf4 ( Context * __context__, regex::Regex &  ____this_rename_at_43 )
+{
+	finalize_bcdf3dabdf9d94bf(__context__,____this_rename_at_43.root);
+	_Funcbuiltin_0x60_finalize_c94dbb44c55359ce(__context__,das_arg<TArray<TTuple<16,range,char *>>>::pass(____this_rename_at_43.groups));
+	das_delete_handle<das::RegexDfa *>::clear(__context__,____this_rename_at_43.dfa);
+	memset(&(____this_rename_at_43), 0, 80);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_1db505b7ad774ab5
+	aotLib[0x4bc36dc46e50113d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<16,range,char *> &  ),&finalize_1db505b7ad774ab5>>();
+	};
+	// _Funcbuiltin_0x60_finalize_60c23d3d85f22938
+	aotLib[0x9013f7c3cc9954d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<regex::ReNode *> &  ),&_Funcbuiltin_0x60_finalize_60c23d3d85f22938>>();
+	};
+	// _Funcbuiltin_0x60_push_3829c23a64340ec
+	aotLib[0x879f8f534dcbbee9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<ast::AstReaderMacro *> & , ast::AstReaderMacro * const   ),&_Funcbuiltin_0x60_push_3829c23a64340ec>>();
+	};
+	// _Funcrtti_0x60_class_info_ab5dd2b7ce1d5817
+	aotLib[0xfdb4cc6e1570e0b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, regex_boost::RegexReader const  &  ),&_Funcrtti_0x60_class_info_ab5dd2b7ce1d5817>>();
+	};
+	// finalize_202c8634c7153327
+	aotLib[0x1cbd1e43ab2c989f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode &  ),&finalize_202c8634c7153327>>();
+	};
+	// _Funcbuiltin_0x60_finalize_c94dbb44c55359ce
+	aotLib[0x3c01aad3caa16b14] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<16,range,char *>> &  ),&_Funcbuiltin_0x60_finalize_c94dbb44c55359ce>>();
+	};
+	// finalize_bcdf3dabdf9d94bf
+	aotLib[0xfc969df64ebc9bb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * &  ),&finalize_bcdf3dabdf9d94bf>>();
+	};
+	// finalize_470d66ad897cf4
+	aotLib[0xe7d833b262138190] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex &  ),&finalize_470d66ad897cf4>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
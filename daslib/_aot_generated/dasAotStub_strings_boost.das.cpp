@@ -0,0 +1,385 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings_boost
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5172167967587827064 {
+
+extern TypeInfo __type_info__6f902bb202c1ac85;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__2a6ca4b563f875a3;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__185ee399728dead3;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__e989483f695bcee9;
+extern FuncInfo __func_info__7fac1bd753cba6aa;
+
+VarInfo __func_info__7fac1bd753cba6aa_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57442, 24, UINT64_C(0xe989483f695bcee9), "arr", 0 };
+VarInfo * __func_info__7fac1bd753cba6aa_fields[1] =  { &__func_info__7fac1bd753cba6aa_field_0 };
+FuncInfo __func_info__7fac1bd753cba6aa = {"invoke block<(arr:array<string> const#):void> const", "", __func_info__7fac1bd753cba6aa_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x7fac1bd753cba6aa), 0x0 };
+TypeInfo __type_info__6f902bb202c1ac85 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, UINT64_C(0x6f902bb202c1ac85) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__2a6ca4b563f875a3 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x2a6ca4b563f875a3) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__185ee399728dead3 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__2a6ca4b563f875a3, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x185ee399728dead3) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__6f902bb202c1ac85 };
+TypeInfo * __tinfo_1[1] = { &__type_info__185ee399728dead3 };
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_clone_c4443fdeccc198b5 ( Context * __context__, TArray<char *> & __a_rename_at_343, TArray<char *> const  & __b_rename_at_343 );
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60_finalize_d4b2ca59926b1f5e ( Context * __context__, TArray<TArray<int32_t>> & __a_rename_at_399 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_399 );
+inline void _Funcbuiltin_0x60_resize_587b2aa94c7155cf ( Context * __context__, TArray<TArray<int32_t>> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_swap_9c26497759a39ade ( Context * __context__, TArray<int32_t> & __a_rename_at_761, TArray<int32_t> & __b_rename_at_761 );
+inline char * wide_72fa84e8fbc7a407 ( Context * __context__, char * const  __text_rename_at_10, int32_t __width_rename_at_10 );
+inline TArray<char *> split_9ae7413d8a97c7f9 ( Context * __context__, char * const  __text_rename_at_39, char * const  __delim_rename_at_39 );
+inline TArray<char *> split_by_chars_9aeed0dc41cd9810 ( Context * __context__, char * const  __text_rename_at_48, char * const  __delim_rename_at_48 );
+inline int32_t levenshtein_distance_c28b15a3df2dce46 ( Context * __context__, char * const  __s_rename_at_68, char * const  __t_rename_at_68 );
+inline int32_t levenshtein_distance_fast_66267b9f3a500b64 ( Context * __context__, char * const  __s_rename_at_91, char * const  __t_rename_at_91 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_clone_c4443fdeccc198b5 ( Context * __context__, TArray<char *> &  __a_rename_at_343, TArray<char *> const  &  __b_rename_at_343 )
+{
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_343),builtin_array_size(__b_rename_at_343));
+	{
+		bool __need_loop_345 = true;
+		// aV : string aka TT&
+		das_iterator<TArray<char *>> __aV_iterator(__a_rename_at_343);
+		char * * __aV_rename_at_345;
+		__need_loop_345 = __aV_iterator.first(__context__,(__aV_rename_at_345)) && __need_loop_345;
+		// bV : string const&#
+		das_iterator<TArray<char *> const > __bV_iterator(__b_rename_at_343);
+		char * const  * __bV_rename_at_345;
+		__need_loop_345 = __bV_iterator.first(__context__,(__bV_rename_at_345)) && __need_loop_345;
+		for ( ; __need_loop_345 ; __need_loop_345 = __aV_iterator.next(__context__,(__aV_rename_at_345)) && __bV_iterator.next(__context__,(__bV_rename_at_345)) )
+		{
+			das_copy((*__aV_rename_at_345),((char *)(builtin_string_clone((*__bV_rename_at_345),__context__))));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_345));
+		__bV_iterator.close(__context__,(__bV_rename_at_345));
+	};
+}
+
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<char *> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<char *> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60_finalize_d4b2ca59926b1f5e ( Context * __context__, TArray<TArray<int32_t>> &  __a_rename_at_399 )
+{
+	{
+		bool __need_loop_401 = true;
+		// aV : array<int> aka TT&
+		das_iterator<TArray<TArray<int32_t>>> __aV_iterator(__a_rename_at_399);
+		TArray<int32_t> * __aV_rename_at_401;
+		__need_loop_401 = __aV_iterator.first(__context__,(__aV_rename_at_401)) && __need_loop_401;
+		for ( ; __need_loop_401 ; __need_loop_401 = __aV_iterator.next(__context__,(__aV_rename_at_401)) )
+		{
+			_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass((*__aV_rename_at_401)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_401));
+	};
+	builtin_array_free(das_arg<TArray<TArray<int32_t>>>::pass(__a_rename_at_399),24,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_399 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_399),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_587b2aa94c7155cf ( Context * __context__, TArray<TArray<int32_t>> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<TArray<TArray<int32_t>> &>::from(__Arr_rename_at_54)));
+	builtin_array_resize(das_arg<TArray<TArray<int32_t>>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,24,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_swap_9c26497759a39ade ( Context * __context__, TArray<int32_t> &  __a_rename_at_761, TArray<int32_t> &  __b_rename_at_761 )
+{
+	TArray<int32_t> __t_rename_at_762; das_zero(__t_rename_at_762); das_move(__t_rename_at_762, __a_rename_at_761);
+	das_move(__a_rename_at_761,__b_rename_at_761);
+	das_move(__b_rename_at_761,__t_rename_at_762);
+}
+
+inline char * wide_72fa84e8fbc7a407 ( Context * __context__, char * const  __text_rename_at_10, int32_t __width_rename_at_10 )
+{
+	int32_t __extra_rename_at_11 = ((int32_t)(__width_rename_at_10 - builtin_string_length(__text_rename_at_10,__context__)));
+	return das_auto_cast<char *>::cast((__extra_rename_at_11 > 0) ? das_auto_cast<char *>::cast((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(__text_rename_at_10),cast<char *>::from(((char *)(string_repeat(((char *) " "),__extra_rename_at_11,__context__)))),*__context__,nullptr)))) : das_auto_cast<char *>::cast(__text_rename_at_10));
+}
+
+inline TArray<char *> split_9ae7413d8a97c7f9 ( Context * __context__, char * const  __text_rename_at_39, char * const  __delim_rename_at_39 ) { das_stack_prologue __prologue(__context__,128,"split " DAS_FILE_LINE);
+{
+	TArray<char *> __res_rename_at_40; das_zero(__res_rename_at_40);
+	builtin_string_split(__text_rename_at_39,__delim_rename_at_39,das_make_block<void,TArray<char *> const  &>(__context__,112,0,&__func_info__7fac1bd753cba6aa,[&](TArray<char *> const  & __arr_rename_at_41)->void{
+		_Funcbuiltin_0x60_clone_c4443fdeccc198b5(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_40),__arr_rename_at_41);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_40)));
+}}
+
+inline TArray<char *> split_by_chars_9aeed0dc41cd9810 ( Context * __context__, char * const  __text_rename_at_48, char * const  __delim_rename_at_48 ) { das_stack_prologue __prologue(__context__,128,"split_by_chars " DAS_FILE_LINE);
+{
+	TArray<char *> __res_rename_at_49; das_zero(__res_rename_at_49);
+	builtin_string_split_by_char(__text_rename_at_48,__delim_rename_at_48,das_make_block<void,TArray<char *> const  &>(__context__,112,0,&__func_info__7fac1bd753cba6aa,[&](TArray<char *> const  & __arr_rename_at_50)->void{
+		_Funcbuiltin_0x60_clone_c4443fdeccc198b5(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_49),__arr_rename_at_50);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_49)));
+}}
+
+inline int32_t levenshtein_distance_c28b15a3df2dce46 ( Context * __context__, char * const  __s_rename_at_68, char * const  __t_rename_at_68 )
+{
+	int32_t __sLen_rename_at_69; memset(&__sLen_rename_at_69,0,sizeof(__sLen_rename_at_69));
+	int32_t __tLen_rename_at_70; memset(&__tLen_rename_at_70,0,sizeof(__tLen_rename_at_70));
+	TArray<TArray<int32_t>> __d_rename_at_71; memset(&__d_rename_at_71,0,sizeof(__d_rename_at_71));
+	int32_t __substitutionCost_rename_at_81; memset(&__substitutionCost_rename_at_81,0,sizeof(__substitutionCost_rename_at_81));
+/* finally */ auto __finally_69= das_finally([&](){
+	_Funcbuiltin_0x60_finalize_d4b2ca59926b1f5e(__context__,das_arg<TArray<TArray<int32_t>>>::pass(__d_rename_at_71));
+/* end finally */ });
+	__sLen_rename_at_69 = ((int32_t)builtin_string_length(__s_rename_at_68,__context__));
+	__tLen_rename_at_70 = ((int32_t)builtin_string_length(__t_rename_at_68,__context__));
+	__d_rename_at_71; das_zero(__d_rename_at_71);
+	_Funcbuiltin_0x60_resize_587b2aa94c7155cf(__context__,das_arg<TArray<TArray<int32_t>>>::pass(__d_rename_at_71),__sLen_rename_at_69 + 1);
+	{
+		bool __need_loop_73 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__sLen_rename_at_69 + 1));
+		int32_t __i_rename_at_73;
+		__need_loop_73 = __i_iterator.first(__context__,(__i_rename_at_73)) && __need_loop_73;
+		for ( ; __need_loop_73 ; __need_loop_73 = __i_iterator.next(__context__,(__i_rename_at_73)) )
+		{
+			_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__d_rename_at_71(__i_rename_at_73,__context__)),__tLen_rename_at_70 + 1);
+			das_copy(__d_rename_at_71(__i_rename_at_73,__context__)(0,__context__),__i_rename_at_73);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_73));
+	};
+	{
+		bool __need_loop_76 = true;
+		// j : int const
+		das_iterator<range> __j_iterator(mk_range(__tLen_rename_at_70 + 1));
+		int32_t __j_rename_at_76;
+		__need_loop_76 = __j_iterator.first(__context__,(__j_rename_at_76)) && __need_loop_76;
+		for ( ; __need_loop_76 ; __need_loop_76 = __j_iterator.next(__context__,(__j_rename_at_76)) )
+		{
+			das_copy(__d_rename_at_71(0,__context__)(__j_rename_at_76,__context__),__j_rename_at_76);
+		}
+		__j_iterator.close(__context__,(__j_rename_at_76));
+	};
+	{
+		bool __need_loop_79 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__sLen_rename_at_69 + 1));
+		int32_t __i_rename_at_79;
+		__need_loop_79 = __i_iterator.first(__context__,(__i_rename_at_79)) && __need_loop_79;
+		for ( ; __need_loop_79 ; __need_loop_79 = __i_iterator.next(__context__,(__i_rename_at_79)) )
+		{
+			{
+				bool __need_loop_80 = true;
+				// j : int const
+				das_iterator<range> __j_iterator(range(1,__tLen_rename_at_70 + 1));
+				int32_t __j_rename_at_80;
+				__need_loop_80 = __j_iterator.first(__context__,(__j_rename_at_80)) && __need_loop_80;
+				for ( ; __need_loop_80 ; __need_loop_80 = __j_iterator.next(__context__,(__j_rename_at_80)) )
+				{
+					__substitutionCost_rename_at_81 = ((int32_t)((get_character_uat(__s_rename_at_68,__i_rename_at_79 - 1) == get_character_uat(__t_rename_at_68,__j_rename_at_80 - 1)) ? das_auto_cast<int32_t>::cast(0) : das_auto_cast<int32_t>::cast(1)));
+					das_copy(__d_rename_at_71(__i_rename_at_79,__context__)(__j_rename_at_80,__context__),SimPolicy<int32_t>::Min(__d_rename_at_71((__i_rename_at_79 - 1),__context__)(__j_rename_at_80,__context__) + 1,__d_rename_at_71(__i_rename_at_79,__context__)((__j_rename_at_80 - 1),__context__) + 1,*__context__,nullptr));
+					das_copy(__d_rename_at_71(__i_rename_at_79,__context__)(__j_rename_at_80,__context__),SimPolicy<int32_t>::Min(__d_rename_at_71(__i_rename_at_79,__context__)(__j_rename_at_80,__context__),__d_rename_at_71((__i_rename_at_79 - 1),__context__)((__j_rename_at_80 - 1),__context__) + __substitutionCost_rename_at_81,*__context__,nullptr));
+				}
+				__j_iterator.close(__context__,(__j_rename_at_80));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_79));
+	};
+	return das_auto_cast<int32_t>::cast(__d_rename_at_71(__sLen_rename_at_69,__context__)(__tLen_rename_at_70,__context__));
+}
+
+inline int32_t levenshtein_distance_fast_66267b9f3a500b64 ( Context * __context__, char * const  __s_rename_at_91, char * const  __t_rename_at_91 )
+{
+	int32_t __sLen_rename_at_92; memset(&__sLen_rename_at_92,0,sizeof(__sLen_rename_at_92));
+	int32_t __tLen_rename_at_93; memset(&__tLen_rename_at_93,0,sizeof(__tLen_rename_at_93));
+	TArray<int32_t> __v0_rename_at_94; memset(&__v0_rename_at_94,0,sizeof(__v0_rename_at_94));
+	TArray<int32_t> __v1_rename_at_96; memset(&__v1_rename_at_96,0,sizeof(__v1_rename_at_96));
+	int32_t __deletionCost_rename_at_104; memset(&__deletionCost_rename_at_104,0,sizeof(__deletionCost_rename_at_104));
+	int32_t __insertionCost_rename_at_105; memset(&__insertionCost_rename_at_105,0,sizeof(__insertionCost_rename_at_105));
+	int32_t __substitutionCost_rename_at_106; memset(&__substitutionCost_rename_at_106,0,sizeof(__substitutionCost_rename_at_106));
+/* finally */ auto __finally_92= das_finally([&](){
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__v0_rename_at_94));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__v1_rename_at_96));
+/* end finally */ });
+	__sLen_rename_at_92 = ((int32_t)builtin_string_length(__s_rename_at_91,__context__));
+	__tLen_rename_at_93 = ((int32_t)builtin_string_length(__t_rename_at_91,__context__));
+	__v0_rename_at_94; das_zero(__v0_rename_at_94);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__v0_rename_at_94),__tLen_rename_at_93 + 1);
+	__v1_rename_at_96; das_zero(__v1_rename_at_96);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__v1_rename_at_96),__tLen_rename_at_93 + 1);
+	{
+		bool __need_loop_98 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__tLen_rename_at_93 + 1));
+		int32_t __i_rename_at_98;
+		__need_loop_98 = __i_iterator.first(__context__,(__i_rename_at_98)) && __need_loop_98;
+		for ( ; __need_loop_98 ; __need_loop_98 = __i_iterator.next(__context__,(__i_rename_at_98)) )
+		{
+			das_copy(__v0_rename_at_94(__i_rename_at_98,__context__),__i_rename_at_98);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_98));
+	};
+	{
+		bool __need_loop_101 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__sLen_rename_at_92));
+		int32_t __i_rename_at_101;
+		__need_loop_101 = __i_iterator.first(__context__,(__i_rename_at_101)) && __need_loop_101;
+		for ( ; __need_loop_101 ; __need_loop_101 = __i_iterator.next(__context__,(__i_rename_at_101)) )
+		{
+			das_copy(__v1_rename_at_96(0,__context__),__i_rename_at_101 + 1);
+			{
+				bool __need_loop_103 = true;
+				// j : int const
+				das_iterator<range> __j_iterator(range(0,__tLen_rename_at_93));
+				int32_t __j_rename_at_103;
+				__need_loop_103 = __j_iterator.first(__context__,(__j_rename_at_103)) && __need_loop_103;
+				for ( ; __need_loop_103 ; __need_loop_103 = __j_iterator.next(__context__,(__j_rename_at_103)) )
+				{
+					__deletionCost_rename_at_104 = ((int32_t)(__v0_rename_at_94((__j_rename_at_103 + 1),__context__) + 1));
+					__insertionCost_rename_at_105 = ((int32_t)(__v1_rename_at_96(__j_rename_at_103,__context__) + 1));
+					__substitutionCost_rename_at_106 = ((int32_t)(__v0_rename_at_94(__j_rename_at_103,__context__) + ((get_character_uat(__s_rename_at_91,__i_rename_at_101) == get_character_uat(__t_rename_at_91,__j_rename_at_103)) ? das_auto_cast<int32_t>::cast(0) : das_auto_cast<int32_t>::cast(1))));
+					das_copy(__v1_rename_at_96((__j_rename_at_103 + 1),__context__),SimPolicy<int32_t>::Min(__deletionCost_rename_at_104,__insertionCost_rename_at_105,*__context__,nullptr));
+					das_copy(__v1_rename_at_96((__j_rename_at_103 + 1),__context__),SimPolicy<int32_t>::Min(__v1_rename_at_96((__j_rename_at_103 + 1),__context__),__substitutionCost_rename_at_106,*__context__,nullptr));
+				}
+				__j_iterator.close(__context__,(__j_rename_at_103));
+			};
+			_Funcbuiltin_0x60_swap_9c26497759a39ade(__context__,das_arg<TArray<int32_t>>::pass(__v0_rename_at_94),das_arg<TArray<int32_t>>::pass(__v1_rename_at_96));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_101));
+	};
+	return das_auto_cast<int32_t>::cast(__v0_rename_at_94(__tLen_rename_at_93,__context__));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+	aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+	// _Funcbuiltin_0x60_clone_c4443fdeccc198b5
+	aotLib[0x3d1ffddebc32e5ef] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , TArray<char *> const  &  ),&_Funcbuiltin_0x60_clone_c4443fdeccc198b5>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465
+	aotLib[0xed99ea3c3e04d451] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<char *> & (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465>>();
+	};
+	// _Funcbuiltin_0x60_finalize_d4b2ca59926b1f5e
+	aotLib[0xc5e82360cc790e3e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> &  ),&_Funcbuiltin_0x60_finalize_d4b2ca59926b1f5e>>();
+	};
+	// _Funcbuiltin_0x60_finalize_c5f896860856389a
+	aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+	// _Funcbuiltin_0x60_resize_587b2aa94c7155cf
+	aotLib[0xfdcc4c7d9a23aaad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> & , int32_t  ),&_Funcbuiltin_0x60_resize_587b2aa94c7155cf>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_swap_9c26497759a39ade
+	aotLib[0xf89b2a533457b6a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> &  ),&_Funcbuiltin_0x60_swap_9c26497759a39ade>>();
+	};
+	// wide_72fa84e8fbc7a407
+	aotLib[0x3675f8064d788041] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, char * const  , int32_t  ),&wide_72fa84e8fbc7a407>>();
+	};
+	// split_9ae7413d8a97c7f9
+	aotLib[0x85469d330a844d25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, char * const  , char * const   ),&split_9ae7413d8a97c7f9>>();
+	};
+	// split_by_chars_9aeed0dc41cd9810
+	aotLib[0x849e6f3c02f05ab1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, char * const  , char * const   ),&split_by_chars_9aeed0dc41cd9810>>();
+	};
+	// levenshtein_distance_c28b15a3df2dce46
+	aotLib[0xce1b97707bfd030] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, char * const  , char * const   ),&levenshtein_distance_c28b15a3df2dce46>>();
+	};
+	// levenshtein_distance_fast_66267b9f3a500b64
+	aotLib[0xccdc6e6d6fb42644] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, char * const  , char * const   ),&levenshtein_distance_fast_66267b9f3a500b64>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,930 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require utf8_utils
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1838728779606182871 {
+
+extern TypeInfo __type_info__af63e84c860200f0;
+extern TypeInfo __type_info__8c48207b56753d8;
+extern TypeInfo __type_info__5f3efdb1f9cc45db;
+extern TypeInfo __type_info__d8d2e96b9400a1a7;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__d08bb9f28b4b989b;
+extern FuncInfo __func_info__2c9db26ad0889387;
+
+VarInfo __func_info__2c9db26ad0889387_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 41058, 24, UINT64_C(0xd08bb9f28b4b989b), "arr", 0 };
+VarInfo * __func_info__2c9db26ad0889387_fields[1] =  { &__func_info__2c9db26ad0889387_field_0 };
+FuncInfo __func_info__2c9db26ad0889387 = {"invoke block<(arr:array<uint8> const#):void> const", "", __func_info__2c9db26ad0889387_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x2c9db26ad0889387), 0x0 };
+TypeInfo __type_info__af63e84c860200f0 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e84c860200f0) };
+TypeInfo __type_info__8c48207b56753d8 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x8c48207b56753d8) };
+TypeInfo __type_info__5f3efdb1f9cc45db = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e84c860200f0, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x5f3efdb1f9cc45db) };
+TypeInfo __type_info__d8d2e96b9400a1a7 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xd8d2e96b9400a1a7) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__d8d2e96b9400a1a7 };
+TypeInfo * __tinfo_1[1] = { &__type_info__5f3efdb1f9cc45db };
+
+inline int32_t _Funcbuiltin_0x60_length_59b92f62e07969bc ( Context * __context__, TDim<uint8_t,2> const  & __a_rename_at_221 );
+inline int32_t _Funcbuiltin_0x60_length_1cf5c98666586392 ( Context * __context__, TDim<uint8_t,3> const  & __a_rename_at_221 );
+inline int32_t _Funcbuiltin_0x60_length_7305224819e13b88 ( Context * __context__, TDim<uint8_t,4> const  & __a_rename_at_221 );
+inline void _Funcbuiltin_0x60_resize_8b9bf29a687b3e9d ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline int32_t _Funcbuiltin_0x60_length_34e69ed4aa0e945a ( Context * __context__, TDim<uint8_t,1> const  & __a_rename_at_221 );
+inline TArray<uint8_t> _Funcbuiltin_0x60_to_array_move_7d0624df54389856 ( Context * __context__, TDim<uint8_t,2> & __a_rename_at_518 );
+inline TArray<uint8_t> _Funcbuiltin_0x60_to_array_move_618f3cdd485f0d8d ( Context * __context__, TDim<uint8_t,3> & __a_rename_at_518 );
+inline TArray<uint8_t> _Funcbuiltin_0x60_to_array_move_b20d5fb1f527eaf8 ( Context * __context__, TDim<uint8_t,4> & __a_rename_at_518 );
+inline TArray<uint8_t> _Funcbuiltin_0x60_to_array_move_6baaa07a6c06bca3 ( Context * __context__, TDim<uint8_t,1> & __a_rename_at_518 );
+inline TArray<uint8_t> & _Funcbuiltin_0x60__return_with_lockcheck_900b28d16dcbf899 ( Context * __context__, TArray<uint8_t> & __a_rename_at_42 );
+inline TArray<uint32_t> & _Funcbuiltin_0x60__return_with_lockcheck_ee6ee3616e6876a3 ( Context * __context__, TArray<uint32_t> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60_push_e5de83ceac06608f ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_75, uint8_t __value_rename_at_75 );
+inline void _Funcbuiltin_0x60_reserve_19ebb52049415d3b ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_59, int32_t __newSize_rename_at_59 );
+inline void _Funcbuiltin_0x60_push_b1b73bc5bfdbac10 ( Context * __context__, TArray<uint32_t> & __Arr_rename_at_75, uint32_t __value_rename_at_75 );
+inline void utf8_encode_c4243fca610bfd99 ( Context * __context__, TArray<uint8_t> & __dest_array_rename_at_8, uint32_t __ch_rename_at_8 );
+inline TArray<uint8_t> utf8_encode_88903e9e1d7b09a3 ( Context * __context__, uint32_t __ch_rename_at_26 );
+inline void utf8_encode_95f1494bc2b6ed49 ( Context * __context__, TArray<uint8_t> & __dest_array_rename_at_47, TArray<uint32_t> const  & __source_utf32_string_rename_at_47 );
+inline TArray<uint8_t> utf8_encode_2dfdb6c0c0665fee ( Context * __context__, TArray<uint32_t> const  & __source_utf32_string_rename_at_53 );
+inline int32_t utf8_length_362d2fb098289bdc ( Context * __context__, TArray<uint8_t> const  & __utf8_string_rename_at_62 );
+inline int32_t utf8_length_1e6f8ee224ef4bd2 ( Context * __context__, char * const  __utf8_string_rename_at_71 );
+inline bool is_first_byte_of_utf8_char_ec644bb641f9e7a4 ( Context * __context__, uint8_t __ch_rename_at_80 );
+inline bool contains_utf8_bom_edd144f98283c290 ( Context * __context__, TArray<uint8_t> const  & __utf8_string_rename_at_85 );
+inline bool contains_utf8_bom_8f9915470303f783 ( Context * __context__, char * const  __utf8_string_rename_at_90 );
+inline bool is_utf8_string_valid_525bea3db7bc8208 ( Context * __context__, TArray<uint8_t> const  & __utf8_string_rename_at_126 );
+inline bool is_utf8_string_valid_254a13423df09411 ( Context * __context__, char * const  __utf8_string_rename_at_137 );
+inline void utf8_decode_1ea46aff56c778b ( Context * __context__, TArray<uint32_t> & __dest_utf32_string_rename_at_148, TArray<uint8_t> const  & __source_utf8_string_rename_at_148 );
+inline TArray<uint32_t> utf8_decode_6daf598a4fe1ed4 ( Context * __context__, TArray<uint8_t> const  & __source_utf8_string_rename_at_164 );
+inline TArray<uint32_t> utf8_decode_9bde921137fa170 ( Context * __context__, char * const  __source_utf8_string_rename_at_171 );
+inline void utf8_decode_4f7738d23733680a ( Context * __context__, TArray<uint32_t> & __dest_utf32_string_rename_at_179, char * const  __source_utf8_string_rename_at_179 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	if ( __init_shared ) das_shared<TDim<uint32_t,364>,0xa351d7eca5657a08>(__context__) = (([&]() -> TDim<uint32_t,364> {
+		TDim<uint32_t,364> __mka_102;
+		__mka_102(0,__context__) = 0x0u;
+		__mka_102(1,__context__) = 0x0u;
+		__mka_102(2,__context__) = 0x0u;
+		__mka_102(3,__context__) = 0x0u;
+		__mka_102(4,__context__) = 0x0u;
+		__mka_102(5,__context__) = 0x0u;
+		__mka_102(6,__context__) = 0x0u;
+		__mka_102(7,__context__) = 0x0u;
+		__mka_102(8,__context__) = 0x0u;
+		__mka_102(9,__context__) = 0x0u;
+		__mka_102(10,__context__) = 0x0u;
+		__mka_102(11,__context__) = 0x0u;
+		__mka_102(12,__context__) = 0x0u;
+		__mka_102(13,__context__) = 0x0u;
+		__mka_102(14,__context__) = 0x0u;
+		__mka_102(15,__context__) = 0x0u;
+		__mka_102(16,__context__) = 0x0u;
+		__mka_102(17,__context__) = 0x0u;
+		__mka_102(18,__context__) = 0x0u;
+		__mka_102(19,__context__) = 0x0u;
+		__mka_102(20,__context__) = 0x0u;
+		__mka_102(21,__context__) = 0x0u;
+		__mka_102(22,__context__) = 0x0u;
+		__mka_102(23,__context__) = 0x0u;
+		__mka_102(24,__context__) = 0x0u;
+		__mka_102(25,__context__) = 0x0u;
+		__mka_102(26,__context__) = 0x0u;
+		__mka_102(27,__context__) = 0x0u;
+		__mka_102(28,__context__) = 0x0u;
+		__mka_102(29,__context__) = 0x0u;
+		__mka_102(30,__context__) = 0x0u;
+		__mka_102(31,__context__) = 0x0u;
+		__mka_102(32,__context__) = 0x0u;
+		__mka_102(33,__context__) = 0x0u;
+		__mka_102(34,__context__) = 0x0u;
+		__mka_102(35,__context__) = 0x0u;
+		__mka_102(36,__context__) = 0x0u;
+		__mka_102(37,__context__) = 0x0u;
+		__mka_102(38,__context__) = 0x0u;
+		__mka_102(39,__context__) = 0x0u;
+		__mka_102(40,__context__) = 0x0u;
+		__mka_102(41,__context__) = 0x0u;
+		__mka_102(42,__context__) = 0x0u;
+		__mka_102(43,__context__) = 0x0u;
+		__mka_102(44,__context__) = 0x0u;
+		__mka_102(45,__context__) = 0x0u;
+		__mka_102(46,__context__) = 0x0u;
+		__mka_102(47,__context__) = 0x0u;
+		__mka_102(48,__context__) = 0x0u;
+		__mka_102(49,__context__) = 0x0u;
+		__mka_102(50,__context__) = 0x0u;
+		__mka_102(51,__context__) = 0x0u;
+		__mka_102(52,__context__) = 0x0u;
+		__mka_102(53,__context__) = 0x0u;
+		__mka_102(54,__context__) = 0x0u;
+		__mka_102(55,__context__) = 0x0u;
+		__mka_102(56,__context__) = 0x0u;
+		__mka_102(57,__context__) = 0x0u;
+		__mka_102(58,__context__) = 0x0u;
+		__mka_102(59,__context__) = 0x0u;
+		__mka_102(60,__context__) = 0x0u;
+		__mka_102(61,__context__) = 0x0u;
+		__mka_102(62,__context__) = 0x0u;
+		__mka_102(63,__context__) = 0x0u;
+		__mka_102(64,__context__) = 0x0u;
+		__mka_102(65,__context__) = 0x0u;
+		__mka_102(66,__context__) = 0x0u;
+		__mka_102(67,__context__) = 0x0u;
+		__mka_102(68,__context__) = 0x0u;
+		__mka_102(69,__context__) = 0x0u;
+		__mka_102(70,__context__) = 0x0u;
+		__mka_102(71,__context__) = 0x0u;
+		__mka_102(72,__context__) = 0x0u;
+		__mka_102(73,__context__) = 0x0u;
+		__mka_102(74,__context__) = 0x0u;
+		__mka_102(75,__context__) = 0x0u;
+		__mka_102(76,__context__) = 0x0u;
+		__mka_102(77,__context__) = 0x0u;
+		__mka_102(78,__context__) = 0x0u;
+		__mka_102(79,__context__) = 0x0u;
+		__mka_102(80,__context__) = 0x0u;
+		__mka_102(81,__context__) = 0x0u;
+		__mka_102(82,__context__) = 0x0u;
+		__mka_102(83,__context__) = 0x0u;
+		__mka_102(84,__context__) = 0x0u;
+		__mka_102(85,__context__) = 0x0u;
+		__mka_102(86,__context__) = 0x0u;
+		__mka_102(87,__context__) = 0x0u;
+		__mka_102(88,__context__) = 0x0u;
+		__mka_102(89,__context__) = 0x0u;
+		__mka_102(90,__context__) = 0x0u;
+		__mka_102(91,__context__) = 0x0u;
+		__mka_102(92,__context__) = 0x0u;
+		__mka_102(93,__context__) = 0x0u;
+		__mka_102(94,__context__) = 0x0u;
+		__mka_102(95,__context__) = 0x0u;
+		__mka_102(96,__context__) = 0x0u;
+		__mka_102(97,__context__) = 0x0u;
+		__mka_102(98,__context__) = 0x0u;
+		__mka_102(99,__context__) = 0x0u;
+		__mka_102(100,__context__) = 0x0u;
+		__mka_102(101,__context__) = 0x0u;
+		__mka_102(102,__context__) = 0x0u;
+		__mka_102(103,__context__) = 0x0u;
+		__mka_102(104,__context__) = 0x0u;
+		__mka_102(105,__context__) = 0x0u;
+		__mka_102(106,__context__) = 0x0u;
+		__mka_102(107,__context__) = 0x0u;
+		__mka_102(108,__context__) = 0x0u;
+		__mka_102(109,__context__) = 0x0u;
+		__mka_102(110,__context__) = 0x0u;
+		__mka_102(111,__context__) = 0x0u;
+		__mka_102(112,__context__) = 0x0u;
+		__mka_102(113,__context__) = 0x0u;
+		__mka_102(114,__context__) = 0x0u;
+		__mka_102(115,__context__) = 0x0u;
+		__mka_102(116,__context__) = 0x0u;
+		__mka_102(117,__context__) = 0x0u;
+		__mka_102(118,__context__) = 0x0u;
+		__mka_102(119,__context__) = 0x0u;
+		__mka_102(120,__context__) = 0x0u;
+		__mka_102(121,__context__) = 0x0u;
+		__mka_102(122,__context__) = 0x0u;
+		__mka_102(123,__context__) = 0x0u;
+		__mka_102(124,__context__) = 0x0u;
+		__mka_102(125,__context__) = 0x0u;
+		__mka_102(126,__context__) = 0x0u;
+		__mka_102(127,__context__) = 0x0u;
+		__mka_102(128,__context__) = 0x1u;
+		__mka_102(129,__context__) = 0x1u;
+		__mka_102(130,__context__) = 0x1u;
+		__mka_102(131,__context__) = 0x1u;
+		__mka_102(132,__context__) = 0x1u;
+		__mka_102(133,__context__) = 0x1u;
+		__mka_102(134,__context__) = 0x1u;
+		__mka_102(135,__context__) = 0x1u;
+		__mka_102(136,__context__) = 0x1u;
+		__mka_102(137,__context__) = 0x1u;
+		__mka_102(138,__context__) = 0x1u;
+		__mka_102(139,__context__) = 0x1u;
+		__mka_102(140,__context__) = 0x1u;
+		__mka_102(141,__context__) = 0x1u;
+		__mka_102(142,__context__) = 0x1u;
+		__mka_102(143,__context__) = 0x1u;
+		__mka_102(144,__context__) = 0x9u;
+		__mka_102(145,__context__) = 0x9u;
+		__mka_102(146,__context__) = 0x9u;
+		__mka_102(147,__context__) = 0x9u;
+		__mka_102(148,__context__) = 0x9u;
+		__mka_102(149,__context__) = 0x9u;
+		__mka_102(150,__context__) = 0x9u;
+		__mka_102(151,__context__) = 0x9u;
+		__mka_102(152,__context__) = 0x9u;
+		__mka_102(153,__context__) = 0x9u;
+		__mka_102(154,__context__) = 0x9u;
+		__mka_102(155,__context__) = 0x9u;
+		__mka_102(156,__context__) = 0x9u;
+		__mka_102(157,__context__) = 0x9u;
+		__mka_102(158,__context__) = 0x9u;
+		__mka_102(159,__context__) = 0x9u;
+		__mka_102(160,__context__) = 0x7u;
+		__mka_102(161,__context__) = 0x7u;
+		__mka_102(162,__context__) = 0x7u;
+		__mka_102(163,__context__) = 0x7u;
+		__mka_102(164,__context__) = 0x7u;
+		__mka_102(165,__context__) = 0x7u;
+		__mka_102(166,__context__) = 0x7u;
+		__mka_102(167,__context__) = 0x7u;
+		__mka_102(168,__context__) = 0x7u;
+		__mka_102(169,__context__) = 0x7u;
+		__mka_102(170,__context__) = 0x7u;
+		__mka_102(171,__context__) = 0x7u;
+		__mka_102(172,__context__) = 0x7u;
+		__mka_102(173,__context__) = 0x7u;
+		__mka_102(174,__context__) = 0x7u;
+		__mka_102(175,__context__) = 0x7u;
+		__mka_102(176,__context__) = 0x7u;
+		__mka_102(177,__context__) = 0x7u;
+		__mka_102(178,__context__) = 0x7u;
+		__mka_102(179,__context__) = 0x7u;
+		__mka_102(180,__context__) = 0x7u;
+		__mka_102(181,__context__) = 0x7u;
+		__mka_102(182,__context__) = 0x7u;
+		__mka_102(183,__context__) = 0x7u;
+		__mka_102(184,__context__) = 0x7u;
+		__mka_102(185,__context__) = 0x7u;
+		__mka_102(186,__context__) = 0x7u;
+		__mka_102(187,__context__) = 0x7u;
+		__mka_102(188,__context__) = 0x7u;
+		__mka_102(189,__context__) = 0x7u;
+		__mka_102(190,__context__) = 0x7u;
+		__mka_102(191,__context__) = 0x7u;
+		__mka_102(192,__context__) = 0x8u;
+		__mka_102(193,__context__) = 0x8u;
+		__mka_102(194,__context__) = 0x2u;
+		__mka_102(195,__context__) = 0x2u;
+		__mka_102(196,__context__) = 0x2u;
+		__mka_102(197,__context__) = 0x2u;
+		__mka_102(198,__context__) = 0x2u;
+		__mka_102(199,__context__) = 0x2u;
+		__mka_102(200,__context__) = 0x2u;
+		__mka_102(201,__context__) = 0x2u;
+		__mka_102(202,__context__) = 0x2u;
+		__mka_102(203,__context__) = 0x2u;
+		__mka_102(204,__context__) = 0x2u;
+		__mka_102(205,__context__) = 0x2u;
+		__mka_102(206,__context__) = 0x2u;
+		__mka_102(207,__context__) = 0x2u;
+		__mka_102(208,__context__) = 0x2u;
+		__mka_102(209,__context__) = 0x2u;
+		__mka_102(210,__context__) = 0x2u;
+		__mka_102(211,__context__) = 0x2u;
+		__mka_102(212,__context__) = 0x2u;
+		__mka_102(213,__context__) = 0x2u;
+		__mka_102(214,__context__) = 0x2u;
+		__mka_102(215,__context__) = 0x2u;
+		__mka_102(216,__context__) = 0x2u;
+		__mka_102(217,__context__) = 0x2u;
+		__mka_102(218,__context__) = 0x2u;
+		__mka_102(219,__context__) = 0x2u;
+		__mka_102(220,__context__) = 0x2u;
+		__mka_102(221,__context__) = 0x2u;
+		__mka_102(222,__context__) = 0x2u;
+		__mka_102(223,__context__) = 0x2u;
+		__mka_102(224,__context__) = 0xau;
+		__mka_102(225,__context__) = 0x3u;
+		__mka_102(226,__context__) = 0x3u;
+		__mka_102(227,__context__) = 0x3u;
+		__mka_102(228,__context__) = 0x3u;
+		__mka_102(229,__context__) = 0x3u;
+		__mka_102(230,__context__) = 0x3u;
+		__mka_102(231,__context__) = 0x3u;
+		__mka_102(232,__context__) = 0x3u;
+		__mka_102(233,__context__) = 0x3u;
+		__mka_102(234,__context__) = 0x3u;
+		__mka_102(235,__context__) = 0x3u;
+		__mka_102(236,__context__) = 0x3u;
+		__mka_102(237,__context__) = 0x4u;
+		__mka_102(238,__context__) = 0x3u;
+		__mka_102(239,__context__) = 0x3u;
+		__mka_102(240,__context__) = 0xbu;
+		__mka_102(241,__context__) = 0x6u;
+		__mka_102(242,__context__) = 0x6u;
+		__mka_102(243,__context__) = 0x6u;
+		__mka_102(244,__context__) = 0x5u;
+		__mka_102(245,__context__) = 0x8u;
+		__mka_102(246,__context__) = 0x8u;
+		__mka_102(247,__context__) = 0x8u;
+		__mka_102(248,__context__) = 0x8u;
+		__mka_102(249,__context__) = 0x8u;
+		__mka_102(250,__context__) = 0x8u;
+		__mka_102(251,__context__) = 0x8u;
+		__mka_102(252,__context__) = 0x8u;
+		__mka_102(253,__context__) = 0x8u;
+		__mka_102(254,__context__) = 0x8u;
+		__mka_102(255,__context__) = 0x8u;
+		__mka_102(256,__context__) = 0x0u;
+		__mka_102(257,__context__) = 0xcu;
+		__mka_102(258,__context__) = 0x18u;
+		__mka_102(259,__context__) = 0x24u;
+		__mka_102(260,__context__) = 0x3cu;
+		__mka_102(261,__context__) = 0x60u;
+		__mka_102(262,__context__) = 0x54u;
+		__mka_102(263,__context__) = 0xcu;
+		__mka_102(264,__context__) = 0xcu;
+		__mka_102(265,__context__) = 0xcu;
+		__mka_102(266,__context__) = 0x30u;
+		__mka_102(267,__context__) = 0x48u;
+		__mka_102(268,__context__) = 0xcu;
+		__mka_102(269,__context__) = 0xcu;
+		__mka_102(270,__context__) = 0xcu;
+		__mka_102(271,__context__) = 0xcu;
+		__mka_102(272,__context__) = 0xcu;
+		__mka_102(273,__context__) = 0xcu;
+		__mka_102(274,__context__) = 0xcu;
+		__mka_102(275,__context__) = 0xcu;
+		__mka_102(276,__context__) = 0xcu;
+		__mka_102(277,__context__) = 0xcu;
+		__mka_102(278,__context__) = 0xcu;
+		__mka_102(279,__context__) = 0xcu;
+		__mka_102(280,__context__) = 0xcu;
+		__mka_102(281,__context__) = 0x0u;
+		__mka_102(282,__context__) = 0xcu;
+		__mka_102(283,__context__) = 0xcu;
+		__mka_102(284,__context__) = 0xcu;
+		__mka_102(285,__context__) = 0xcu;
+		__mka_102(286,__context__) = 0xcu;
+		__mka_102(287,__context__) = 0x0u;
+		__mka_102(288,__context__) = 0xcu;
+		__mka_102(289,__context__) = 0x0u;
+		__mka_102(290,__context__) = 0xcu;
+		__mka_102(291,__context__) = 0xcu;
+		__mka_102(292,__context__) = 0xcu;
+		__mka_102(293,__context__) = 0x18u;
+		__mka_102(294,__context__) = 0xcu;
+		__mka_102(295,__context__) = 0xcu;
+		__mka_102(296,__context__) = 0xcu;
+		__mka_102(297,__context__) = 0xcu;
+		__mka_102(298,__context__) = 0xcu;
+		__mka_102(299,__context__) = 0x18u;
+		__mka_102(300,__context__) = 0xcu;
+		__mka_102(301,__context__) = 0x18u;
+		__mka_102(302,__context__) = 0xcu;
+		__mka_102(303,__context__) = 0xcu;
+		__mka_102(304,__context__) = 0xcu;
+		__mka_102(305,__context__) = 0xcu;
+		__mka_102(306,__context__) = 0xcu;
+		__mka_102(307,__context__) = 0xcu;
+		__mka_102(308,__context__) = 0xcu;
+		__mka_102(309,__context__) = 0xcu;
+		__mka_102(310,__context__) = 0xcu;
+		__mka_102(311,__context__) = 0x18u;
+		__mka_102(312,__context__) = 0xcu;
+		__mka_102(313,__context__) = 0xcu;
+		__mka_102(314,__context__) = 0xcu;
+		__mka_102(315,__context__) = 0xcu;
+		__mka_102(316,__context__) = 0xcu;
+		__mka_102(317,__context__) = 0x18u;
+		__mka_102(318,__context__) = 0xcu;
+		__mka_102(319,__context__) = 0xcu;
+		__mka_102(320,__context__) = 0xcu;
+		__mka_102(321,__context__) = 0xcu;
+		__mka_102(322,__context__) = 0xcu;
+		__mka_102(323,__context__) = 0xcu;
+		__mka_102(324,__context__) = 0xcu;
+		__mka_102(325,__context__) = 0x18u;
+		__mka_102(326,__context__) = 0xcu;
+		__mka_102(327,__context__) = 0xcu;
+		__mka_102(328,__context__) = 0xcu;
+		__mka_102(329,__context__) = 0xcu;
+		__mka_102(330,__context__) = 0xcu;
+		__mka_102(331,__context__) = 0xcu;
+		__mka_102(332,__context__) = 0xcu;
+		__mka_102(333,__context__) = 0xcu;
+		__mka_102(334,__context__) = 0xcu;
+		__mka_102(335,__context__) = 0x24u;
+		__mka_102(336,__context__) = 0xcu;
+		__mka_102(337,__context__) = 0x24u;
+		__mka_102(338,__context__) = 0xcu;
+		__mka_102(339,__context__) = 0xcu;
+		__mka_102(340,__context__) = 0xcu;
+		__mka_102(341,__context__) = 0x24u;
+		__mka_102(342,__context__) = 0xcu;
+		__mka_102(343,__context__) = 0xcu;
+		__mka_102(344,__context__) = 0xcu;
+		__mka_102(345,__context__) = 0xcu;
+		__mka_102(346,__context__) = 0xcu;
+		__mka_102(347,__context__) = 0x24u;
+		__mka_102(348,__context__) = 0xcu;
+		__mka_102(349,__context__) = 0x24u;
+		__mka_102(350,__context__) = 0xcu;
+		__mka_102(351,__context__) = 0xcu;
+		__mka_102(352,__context__) = 0xcu;
+		__mka_102(353,__context__) = 0x24u;
+		__mka_102(354,__context__) = 0xcu;
+		__mka_102(355,__context__) = 0xcu;
+		__mka_102(356,__context__) = 0xcu;
+		__mka_102(357,__context__) = 0xcu;
+		__mka_102(358,__context__) = 0xcu;
+		__mka_102(359,__context__) = 0xcu;
+		__mka_102(360,__context__) = 0xcu;
+		__mka_102(361,__context__) = 0xcu;
+		__mka_102(362,__context__) = 0xcu;
+		__mka_102(363,__context__) = 0xcu;
+		return __mka_102;
+	})());/*s_utf8d*/
+	das_global<uint32_t,0x3205246ee9a75968>(__context__) = 0x0u;/*UTF8_ACCEPT*/
+}
+
+inline int32_t _Funcbuiltin_0x60_length_59b92f62e07969bc ( Context * __context__, TDim<uint8_t,2> const  &  __a_rename_at_221 )
+{
+	return das_auto_cast<int32_t>::cast(2);
+}
+
+inline int32_t _Funcbuiltin_0x60_length_1cf5c98666586392 ( Context * __context__, TDim<uint8_t,3> const  &  __a_rename_at_221 )
+{
+	return das_auto_cast<int32_t>::cast(3);
+}
+
+inline int32_t _Funcbuiltin_0x60_length_7305224819e13b88 ( Context * __context__, TDim<uint8_t,4> const  &  __a_rename_at_221 )
+{
+	return das_auto_cast<int32_t>::cast(4);
+}
+
+inline void _Funcbuiltin_0x60_resize_8b9bf29a687b3e9d ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,1,__context__);
+}
+
+inline int32_t _Funcbuiltin_0x60_length_34e69ed4aa0e945a ( Context * __context__, TDim<uint8_t,1> const  &  __a_rename_at_221 )
+{
+	return das_auto_cast<int32_t>::cast(1);
+}
+
+inline TArray<uint8_t> _Funcbuiltin_0x60_to_array_move_7d0624df54389856 ( Context * __context__, TDim<uint8_t,2> &  __a_rename_at_518 )
+{
+	TArray<uint8_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_8b9bf29a687b3e9d(__context__,das_arg<TArray<uint8_t>>::pass(__arr_rename_at_519),2);
+	das_copy(das_cast<TDim<uint8_t,2>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(__arr_rename_at_519);
+}
+
+inline TArray<uint8_t> _Funcbuiltin_0x60_to_array_move_618f3cdd485f0d8d ( Context * __context__, TDim<uint8_t,3> &  __a_rename_at_518 )
+{
+	TArray<uint8_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_8b9bf29a687b3e9d(__context__,das_arg<TArray<uint8_t>>::pass(__arr_rename_at_519),3);
+	das_copy(das_cast<TDim<uint8_t,3>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(__arr_rename_at_519);
+}
+
+inline TArray<uint8_t> _Funcbuiltin_0x60_to_array_move_b20d5fb1f527eaf8 ( Context * __context__, TDim<uint8_t,4> &  __a_rename_at_518 )
+{
+	TArray<uint8_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_8b9bf29a687b3e9d(__context__,das_arg<TArray<uint8_t>>::pass(__arr_rename_at_519),4);
+	das_copy(das_cast<TDim<uint8_t,4>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(__arr_rename_at_519);
+}
+
+inline TArray<uint8_t> _Funcbuiltin_0x60_to_array_move_6baaa07a6c06bca3 ( Context * __context__, TDim<uint8_t,1> &  __a_rename_at_518 )
+{
+	TArray<uint8_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_8b9bf29a687b3e9d(__context__,das_arg<TArray<uint8_t>>::pass(__arr_rename_at_519),1);
+	das_copy(das_cast<TDim<uint8_t,1>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(__arr_rename_at_519);
+}
+
+inline TArray<uint8_t> & _Funcbuiltin_0x60__return_with_lockcheck_900b28d16dcbf899 ( Context * __context__, TArray<uint8_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<uint8_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<uint8_t> &>::cast(__a_rename_at_42);
+}
+
+inline TArray<uint32_t> & _Funcbuiltin_0x60__return_with_lockcheck_ee6ee3616e6876a3 ( Context * __context__, TArray<uint32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<TArray<uint32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<uint32_t> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60_push_e5de83ceac06608f ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_75, uint8_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_75),1,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_reserve_19ebb52049415d3b ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_59, int32_t __newSize_rename_at_59 )
+{
+	builtin_array_reserve(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_59),__newSize_rename_at_59,1,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_b1b73bc5bfdbac10 ( Context * __context__, TArray<uint32_t> &  __Arr_rename_at_75, uint32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<uint32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void utf8_encode_c4243fca610bfd99 ( Context * __context__, TArray<uint8_t> &  __dest_array_rename_at_8, uint32_t __ch_rename_at_8 )
+{
+	if ( __ch_rename_at_8 < 0x80u )
+	{
+		_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(__dest_array_rename_at_8),uint8_t(__ch_rename_at_8));
+	} else if ( __ch_rename_at_8 < 0x800u )
+	{
+		_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(__dest_array_rename_at_8),uint8_t((__ch_rename_at_8 >> 0x6u) + 0xc0u));
+		_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(__dest_array_rename_at_8),uint8_t((__ch_rename_at_8 & 0x3fu) + 0x80u));
+	} else if ( __ch_rename_at_8 < 0x10000u )
+	{
+		_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(__dest_array_rename_at_8),uint8_t((__ch_rename_at_8 >> 0xcu) + 0xe0u));
+		_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(__dest_array_rename_at_8),uint8_t(((__ch_rename_at_8 >> 0x6u) & 0x3fu) + 0x80u));
+		_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(__dest_array_rename_at_8),uint8_t((__ch_rename_at_8 & 0x3fu) + 0x80u));
+	} else {
+		_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(__dest_array_rename_at_8),uint8_t((__ch_rename_at_8 >> 0x12u) + 0xf0u));
+		_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(__dest_array_rename_at_8),uint8_t(((__ch_rename_at_8 >> 0xcu) & 0x3fu) + 0x80u));
+		_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(__dest_array_rename_at_8),uint8_t(((__ch_rename_at_8 >> 0x6u) & 0x3fu) + 0x80u));
+		_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(__dest_array_rename_at_8),uint8_t((__ch_rename_at_8 & 0x3fu) + 0x80u));
+	};
+}
+
+inline TArray<uint8_t> utf8_encode_88903e9e1d7b09a3 ( Context * __context__, uint32_t __ch_rename_at_26 )
+{
+	TArray<uint8_t> _temp_make_local_35_128;
+	TDim<uint8_t,3> _temp_make_local_35_160;
+	TArray<uint8_t> _temp_make_local_40_176;
+	TDim<uint8_t,4> _temp_make_local_40_208;
+	if ( __ch_rename_at_26 < 0x80u )
+	{
+		TArray<uint8_t> _temp_make_local_29_32;
+		TDim<uint8_t,1> _temp_make_local_29_64;
+		return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_900b28d16dcbf899(__context__,das_arg<TArray<uint8_t>>::pass((_temp_make_local_29_32 = (_Funcbuiltin_0x60_to_array_move_6baaa07a6c06bca3(__context__,das_arg<TDim<uint8_t,1>>::pass((([&]() -> TDim<uint8_t,1>& {
+			_temp_make_local_29_64(0,__context__) = uint8_t(__ch_rename_at_26);
+			return _temp_make_local_29_64;
+		})()))))))));
+	} else if ( __ch_rename_at_26 < 0x800u )
+	{
+		TArray<uint8_t> _temp_make_local_31_80;
+		TDim<uint8_t,2> _temp_make_local_31_112;
+		return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_900b28d16dcbf899(__context__,das_arg<TArray<uint8_t>>::pass((_temp_make_local_31_80 = (_Funcbuiltin_0x60_to_array_move_7d0624df54389856(__context__,das_arg<TDim<uint8_t,2>>::pass((([&]() -> TDim<uint8_t,2>& {
+			_temp_make_local_31_112(0,__context__) = uint8_t((__ch_rename_at_26 >> 0x6u) + 0xc0u);
+			_temp_make_local_31_112(1,__context__) = uint8_t((__ch_rename_at_26 & 0x3fu) + 0x80u);
+			return _temp_make_local_31_112;
+		})()))))))));
+	} else return das_auto_cast_ref<TArray<uint8_t>>::cast((__ch_rename_at_26 < 0x10000u) ? das_auto_cast_ref<TArray<uint8_t> &>::cast(_Funcbuiltin_0x60__return_with_lockcheck_900b28d16dcbf899(__context__,das_arg<TArray<uint8_t>>::pass((_temp_make_local_35_128 = (_Funcbuiltin_0x60_to_array_move_618f3cdd485f0d8d(__context__,das_arg<TDim<uint8_t,3>>::pass((([&]() -> TDim<uint8_t,3>& {
+		_temp_make_local_35_160(0,__context__) = uint8_t((__ch_rename_at_26 >> 0xcu) + 0xe0u);
+		_temp_make_local_35_160(1,__context__) = uint8_t(((__ch_rename_at_26 >> 0x6u) & 0x3fu) + 0x80u);
+		_temp_make_local_35_160(2,__context__) = uint8_t((__ch_rename_at_26 & 0x3fu) + 0x80u);
+		return _temp_make_local_35_160;
+	})())))))))) : das_auto_cast_ref<TArray<uint8_t> &>::cast(_Funcbuiltin_0x60__return_with_lockcheck_900b28d16dcbf899(__context__,das_arg<TArray<uint8_t>>::pass((_temp_make_local_40_176 = (_Funcbuiltin_0x60_to_array_move_b20d5fb1f527eaf8(__context__,das_arg<TDim<uint8_t,4>>::pass((([&]() -> TDim<uint8_t,4>& {
+		_temp_make_local_40_208(0,__context__) = uint8_t((__ch_rename_at_26 >> 0x12u) + 0xf0u);
+		_temp_make_local_40_208(1,__context__) = uint8_t(((__ch_rename_at_26 >> 0xcu) & 0x3fu) + 0x80u);
+		_temp_make_local_40_208(2,__context__) = uint8_t(((__ch_rename_at_26 >> 0x6u) & 0x3fu) + 0x80u);
+		_temp_make_local_40_208(3,__context__) = uint8_t((__ch_rename_at_26 & 0x3fu) + 0x80u);
+		return _temp_make_local_40_208;
+	})())))))))));
+}
+
+inline void utf8_encode_95f1494bc2b6ed49 ( Context * __context__, TArray<uint8_t> &  __dest_array_rename_at_47, TArray<uint32_t> const  &  __source_utf32_string_rename_at_47 )
+{
+	{
+		bool __need_loop_49 = true;
+		// ch : uint const&
+		das_iterator<TArray<uint32_t> const > __ch_iterator(__source_utf32_string_rename_at_47);
+		uint32_t const  * __ch_rename_at_49;
+		__need_loop_49 = __ch_iterator.first(__context__,(__ch_rename_at_49)) && __need_loop_49;
+		for ( ; __need_loop_49 ; __need_loop_49 = __ch_iterator.next(__context__,(__ch_rename_at_49)) )
+		{
+			utf8_encode_c4243fca610bfd99(__context__,das_arg<TArray<uint8_t>>::pass(__dest_array_rename_at_47),(*__ch_rename_at_49));
+		}
+		__ch_iterator.close(__context__,(__ch_rename_at_49));
+	};
+}
+
+inline TArray<uint8_t> utf8_encode_2dfdb6c0c0665fee ( Context * __context__, TArray<uint32_t> const  &  __source_utf32_string_rename_at_53 )
+{
+	TArray<uint8_t> __dest_array_rename_at_55; das_zero(__dest_array_rename_at_55);
+	_Funcbuiltin_0x60_reserve_19ebb52049415d3b(__context__,das_arg<TArray<uint8_t>>::pass(__dest_array_rename_at_55),builtin_array_size(__source_utf32_string_rename_at_53));
+	{
+		bool __need_loop_57 = true;
+		// ch : uint const&
+		das_iterator<TArray<uint32_t> const > __ch_iterator(__source_utf32_string_rename_at_53);
+		uint32_t const  * __ch_rename_at_57;
+		__need_loop_57 = __ch_iterator.first(__context__,(__ch_rename_at_57)) && __need_loop_57;
+		for ( ; __need_loop_57 ; __need_loop_57 = __ch_iterator.next(__context__,(__ch_rename_at_57)) )
+		{
+			utf8_encode_c4243fca610bfd99(__context__,das_arg<TArray<uint8_t>>::pass(__dest_array_rename_at_55),(*__ch_rename_at_57));
+		}
+		__ch_iterator.close(__context__,(__ch_rename_at_57));
+	};
+	return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_900b28d16dcbf899(__context__,das_arg<TArray<uint8_t>>::pass(__dest_array_rename_at_55)));
+}
+
+inline int32_t utf8_length_362d2fb098289bdc ( Context * __context__, TArray<uint8_t> const  &  __utf8_string_rename_at_62 )
+{
+	int32_t __length_rename_at_64 = 0;
+	{
+		bool __need_loop_65 = true;
+		// ch : uint8 const&
+		das_iterator<TArray<uint8_t> const > __ch_iterator(__utf8_string_rename_at_62);
+		uint8_t const  * __ch_rename_at_65;
+		__need_loop_65 = __ch_iterator.first(__context__,(__ch_rename_at_65)) && __need_loop_65;
+		for ( ; __need_loop_65 ; __need_loop_65 = __ch_iterator.next(__context__,(__ch_rename_at_65)) )
+		{
+			if ( (uint32_t((*__ch_rename_at_65)) & 0xc0u) != 0x80u )
+			{
+				++__length_rename_at_64;
+			};
+		}
+		__ch_iterator.close(__context__,(__ch_rename_at_65));
+	};
+	return das_auto_cast<int32_t>::cast(__length_rename_at_64);
+}
+
+inline int32_t utf8_length_1e6f8ee224ef4bd2 ( Context * __context__, char * const  __utf8_string_rename_at_71 )
+{
+	int32_t __length_rename_at_73 = 0;
+	{
+		bool __need_loop_74 = true;
+		// ch : int const
+		das_iterator<char * const > __ch_iterator(__utf8_string_rename_at_71);
+		int32_t __ch_rename_at_74;
+		__need_loop_74 = __ch_iterator.first(__context__,(__ch_rename_at_74)) && __need_loop_74;
+		for ( ; __need_loop_74 ; __need_loop_74 = __ch_iterator.next(__context__,(__ch_rename_at_74)) )
+		{
+			if ( (uint32_t(__ch_rename_at_74) & 0xc0u) != 0x80u )
+			{
+				++__length_rename_at_73;
+			};
+		}
+		__ch_iterator.close(__context__,(__ch_rename_at_74));
+	};
+	return das_auto_cast<int32_t>::cast(__length_rename_at_73);
+}
+
+inline bool is_first_byte_of_utf8_char_ec644bb641f9e7a4 ( Context * __context__, uint8_t __ch_rename_at_80 )
+{
+	uint32_t __x_rename_at_81 = ((uint32_t)uint32_t(__ch_rename_at_80));
+	return das_auto_cast<bool>::cast((__x_rename_at_81 > 0x0u) && ((__x_rename_at_81 < 0x80u) || ((__x_rename_at_81 & 0xc0u) == 0xc0u)));
+}
+
+inline bool contains_utf8_bom_edd144f98283c290 ( Context * __context__, TArray<uint8_t> const  &  __utf8_string_rename_at_85 )
+{
+	return das_auto_cast<bool>::cast((((builtin_array_size(__utf8_string_rename_at_85) >= 3) && (uint32_t(__utf8_string_rename_at_85(0,__context__)) == 0xefu)) && (uint32_t(__utf8_string_rename_at_85(1,__context__)) == 0xbbu)) && (uint32_t(__utf8_string_rename_at_85(2,__context__)) == 0xbfu));
+}
+
+inline bool contains_utf8_bom_8f9915470303f783 ( Context * __context__, char * const  __utf8_string_rename_at_90 )
+{
+	return das_auto_cast<bool>::cast(((!(builtin_empty(__utf8_string_rename_at_90)) && (uint32_t(get_character_uat(__utf8_string_rename_at_90,0)) == 0xefu)) && (uint32_t(get_character_uat(__utf8_string_rename_at_90,1)) == 0xbbu)) && (uint32_t(get_character_uat(__utf8_string_rename_at_90,2)) == 0xbfu));
+}
+
+inline bool is_utf8_string_valid_525bea3db7bc8208 ( Context * __context__, TArray<uint8_t> const  &  __utf8_string_rename_at_126 )
+{
+	uint32_t __codepoint_rename_at_127 = 0x0u;
+	uint32_t __state_rename_at_128 = 0x0u;
+	{
+		bool __need_loop_129 = true;
+		// ch : uint8 const&
+		das_iterator<TArray<uint8_t> const > __ch_iterator(__utf8_string_rename_at_126);
+		uint8_t const  * __ch_rename_at_129;
+		__need_loop_129 = __ch_iterator.first(__context__,(__ch_rename_at_129)) && __need_loop_129;
+		for ( ; __need_loop_129 ; __need_loop_129 = __ch_iterator.next(__context__,(__ch_rename_at_129)) )
+		{
+			uint32_t __byte_rename_at_130 = ((uint32_t)uint32_t((*__ch_rename_at_129)));
+			uint32_t __type__rename_at_131 = ((uint32_t)das_shared<TDim<uint32_t,364>,0xa351d7eca5657a08>(__context__) /*s_utf8d*/(__byte_rename_at_130,__context__));
+			das_copy(__codepoint_rename_at_127,(__state_rename_at_128 != 0x0u) ? das_auto_cast<uint32_t>::cast(((__byte_rename_at_130 & 0x3fu) | (__codepoint_rename_at_127 << 0x6u))) : das_auto_cast<uint32_t>::cast(((0xffu >> __type__rename_at_131) & __byte_rename_at_130)));
+			das_copy(__state_rename_at_128,das_shared<TDim<uint32_t,364>,0xa351d7eca5657a08>(__context__) /*s_utf8d*/(((__state_rename_at_128 + 0x100u) + __type__rename_at_131),__context__));
+		}
+		__ch_iterator.close(__context__,(__ch_rename_at_129));
+	};
+	return das_auto_cast<bool>::cast(__state_rename_at_128 == 0x0u);
+}
+
+inline bool is_utf8_string_valid_254a13423df09411 ( Context * __context__, char * const  __utf8_string_rename_at_137 )
+{
+	uint32_t __codepoint_rename_at_138 = 0x0u;
+	uint32_t __state_rename_at_139 = 0x0u;
+	{
+		bool __need_loop_140 = true;
+		// ch : int const
+		das_iterator<char * const > __ch_iterator(__utf8_string_rename_at_137);
+		int32_t __ch_rename_at_140;
+		__need_loop_140 = __ch_iterator.first(__context__,(__ch_rename_at_140)) && __need_loop_140;
+		for ( ; __need_loop_140 ; __need_loop_140 = __ch_iterator.next(__context__,(__ch_rename_at_140)) )
+		{
+			uint32_t __byte_rename_at_141 = ((uint32_t)uint32_t(__ch_rename_at_140));
+			uint32_t __type__rename_at_142 = ((uint32_t)das_shared<TDim<uint32_t,364>,0xa351d7eca5657a08>(__context__) /*s_utf8d*/(__byte_rename_at_141,__context__));
+			das_copy(__codepoint_rename_at_138,(__state_rename_at_139 != 0x0u) ? das_auto_cast<uint32_t>::cast(((__byte_rename_at_141 & 0x3fu) | (__codepoint_rename_at_138 << 0x6u))) : das_auto_cast<uint32_t>::cast(((0xffu >> __type__rename_at_142) & __byte_rename_at_141)));
+			das_copy(__state_rename_at_139,das_shared<TDim<uint32_t,364>,0xa351d7eca5657a08>(__context__) /*s_utf8d*/(((__state_rename_at_139 + 0x100u) + __type__rename_at_142),__context__));
+		}
+		__ch_iterator.close(__context__,(__ch_rename_at_140));
+	};
+	return das_auto_cast<bool>::cast(__state_rename_at_139 == 0x0u);
+}
+
+inline void utf8_decode_1ea46aff56c778b ( Context * __context__, TArray<uint32_t> &  __dest_utf32_string_rename_at_148, TArray<uint8_t> const  &  __source_utf8_string_rename_at_148 )
+{
+	uint32_t __codepoint_rename_at_150 = 0x0u;
+	uint32_t __state_rename_at_151 = 0x0u;
+	int32_t __length_rename_at_152 = ((int32_t)builtin_array_size(__source_utf8_string_rename_at_148));
+	int32_t __i_rename_at_153 = (contains_utf8_bom_edd144f98283c290(__context__,__source_utf8_string_rename_at_148) ? das_auto_cast<int32_t>::cast(3) : das_auto_cast<int32_t>::cast(0));
+	while ( __i_rename_at_153 < __length_rename_at_152 )
+	{
+		uint32_t __byte_rename_at_156 = ((uint32_t)uint32_t(__source_utf8_string_rename_at_148(__i_rename_at_153++,__context__)));
+		uint32_t __type__rename_at_157 = ((uint32_t)das_shared<TDim<uint32_t,364>,0xa351d7eca5657a08>(__context__) /*s_utf8d*/(__byte_rename_at_156,__context__));
+		das_copy(__codepoint_rename_at_150,(__state_rename_at_151 != 0x0u) ? das_auto_cast<uint32_t>::cast(((__byte_rename_at_156 & 0x3fu) | (__codepoint_rename_at_150 << 0x6u))) : das_auto_cast<uint32_t>::cast(((0xffu >> __type__rename_at_157) & __byte_rename_at_156)));
+		das_copy(__state_rename_at_151,das_shared<TDim<uint32_t,364>,0xa351d7eca5657a08>(__context__) /*s_utf8d*/(((__state_rename_at_151 + 0x100u) + __type__rename_at_157),__context__));
+		if ( __state_rename_at_151 == 0x0u )
+		{
+			_Funcbuiltin_0x60_push_b1b73bc5bfdbac10(__context__,das_arg<TArray<uint32_t>>::pass(__dest_utf32_string_rename_at_148),__codepoint_rename_at_150);
+		};
+	};
+}
+
+inline TArray<uint32_t> utf8_decode_6daf598a4fe1ed4 ( Context * __context__, TArray<uint8_t> const  &  __source_utf8_string_rename_at_164 )
+{
+	TArray<uint32_t> __dest_utf32_string_rename_at_166; das_zero(__dest_utf32_string_rename_at_166);
+	utf8_decode_1ea46aff56c778b(__context__,das_arg<TArray<uint32_t>>::pass(__dest_utf32_string_rename_at_166),__source_utf8_string_rename_at_164);
+	return /* <- */ das_auto_cast_move<TArray<uint32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_ee6ee3616e6876a3(__context__,das_arg<TArray<uint32_t>>::pass(__dest_utf32_string_rename_at_166)));
+}
+
+inline TArray<uint32_t> utf8_decode_9bde921137fa170 ( Context * __context__, char * const  __source_utf8_string_rename_at_171 ) { das_stack_prologue __prologue(__context__,128,"utf8_decode " DAS_FILE_LINE);
+{
+	TArray<uint32_t> __dest_utf32_string_rename_at_173; das_zero(__dest_utf32_string_rename_at_173);
+	builtin_string_peek(__source_utf8_string_rename_at_171,das_make_block<void,TArray<uint8_t> const  &>(__context__,112,0,&__func_info__2c9db26ad0889387,[&](TArray<uint8_t> const  & __arr_rename_at_174)->void{
+		utf8_decode_1ea46aff56c778b(__context__,das_arg<TArray<uint32_t>>::pass(__dest_utf32_string_rename_at_173),__arr_rename_at_174);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return /* <- */ das_auto_cast_move<TArray<uint32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_ee6ee3616e6876a3(__context__,das_arg<TArray<uint32_t>>::pass(__dest_utf32_string_rename_at_173)));
+}}
+
+inline void utf8_decode_4f7738d23733680a ( Context * __context__, TArray<uint32_t> &  __dest_utf32_string_rename_at_179, char * const  __source_utf8_string_rename_at_179 ) { das_stack_prologue __prologue(__context__,96,"utf8_decode " DAS_FILE_LINE);
+{
+	builtin_string_peek(__source_utf8_string_rename_at_179,das_make_block<void,TArray<uint8_t> const  &>(__context__,80,0,&__func_info__2c9db26ad0889387,[&](TArray<uint8_t> const  & __arr_rename_at_181)->void{
+		utf8_decode_1ea46aff56c778b(__context__,das_arg<TArray<uint32_t>>::pass(__dest_utf32_string_rename_at_179),__arr_rename_at_181);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_length_59b92f62e07969bc
+	aotLib[0x7869cab063af4651] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<uint8_t,2> const  &  ),&_Funcbuiltin_0x60_length_59b92f62e07969bc>>();
+	};
+	// _Funcbuiltin_0x60_length_1cf5c98666586392
+	aotLib[0xd9abd03093c21f7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<uint8_t,3> const  &  ),&_Funcbuiltin_0x60_length_1cf5c98666586392>>();
+	};
+	// _Funcbuiltin_0x60_length_7305224819e13b88
+	aotLib[0x156410681ebee755] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<uint8_t,4> const  &  ),&_Funcbuiltin_0x60_length_7305224819e13b88>>();
+	};
+	// _Funcbuiltin_0x60_resize_8b9bf29a687b3e9d
+	aotLib[0xd467d57646ae4a91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_8b9bf29a687b3e9d>>();
+	};
+	// _Funcbuiltin_0x60_length_34e69ed4aa0e945a
+	aotLib[0x1a1978a20dd0bf95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<uint8_t,1> const  &  ),&_Funcbuiltin_0x60_length_34e69ed4aa0e945a>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_7d0624df54389856
+	aotLib[0x33d8a53ae3a1e853] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint8_t> (*) ( Context * __context__, TDim<uint8_t,2> &  ),&_Funcbuiltin_0x60_to_array_move_7d0624df54389856>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_618f3cdd485f0d8d
+	aotLib[0x6815bcd3fe7c4bbf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint8_t> (*) ( Context * __context__, TDim<uint8_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_618f3cdd485f0d8d>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_b20d5fb1f527eaf8
+	aotLib[0x27d7ca72fc5016fb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint8_t> (*) ( Context * __context__, TDim<uint8_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_b20d5fb1f527eaf8>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_6baaa07a6c06bca3
+	aotLib[0xe9914074b6cf6f23] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint8_t> (*) ( Context * __context__, TDim<uint8_t,1> &  ),&_Funcbuiltin_0x60_to_array_move_6baaa07a6c06bca3>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_900b28d16dcbf899
+	aotLib[0xde07a94d5505f815] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<uint8_t> & (*) ( Context * __context__, TArray<uint8_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_900b28d16dcbf899>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_ee6ee3616e6876a3
+	aotLib[0x2426f6b4b36a63fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<uint32_t> & (*) ( Context * __context__, TArray<uint32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_ee6ee3616e6876a3>>();
+	};
+	// _Funcbuiltin_0x60_push_e5de83ceac06608f
+	aotLib[0x301df73651096bd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , uint8_t  ),&_Funcbuiltin_0x60_push_e5de83ceac06608f>>();
+	};
+	// _Funcbuiltin_0x60_reserve_19ebb52049415d3b
+	aotLib[0x87a0223316988e7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_19ebb52049415d3b>>();
+	};
+	// _Funcbuiltin_0x60_push_b1b73bc5bfdbac10
+	aotLib[0x3e4b2c826191dba1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> & , uint32_t  ),&_Funcbuiltin_0x60_push_b1b73bc5bfdbac10>>();
+	};
+	// utf8_encode_c4243fca610bfd99
+	aotLib[0xab421c864aac706] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , uint32_t  ),&utf8_encode_c4243fca610bfd99>>();
+	};
+	// utf8_encode_88903e9e1d7b09a3
+	aotLib[0xaba1c5944c456d89] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint8_t> (*) ( Context * __context__, uint32_t  ),&utf8_encode_88903e9e1d7b09a3>>();
+	};
+	// utf8_encode_95f1494bc2b6ed49
+	aotLib[0xaf83d0a378db141f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , TArray<uint32_t> const  &  ),&utf8_encode_95f1494bc2b6ed49>>();
+	};
+	// utf8_encode_2dfdb6c0c0665fee
+	aotLib[0xd326c18a19ee78c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint8_t> (*) ( Context * __context__, TArray<uint32_t> const  &  ),&utf8_encode_2dfdb6c0c0665fee>>();
+	};
+	// utf8_length_362d2fb098289bdc
+	aotLib[0x7b252232b03dc9f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<uint8_t> const  &  ),&utf8_length_362d2fb098289bdc>>();
+	};
+	// utf8_length_1e6f8ee224ef4bd2
+	aotLib[0xebb3e4a1c0eb035d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, char * const   ),&utf8_length_1e6f8ee224ef4bd2>>();
+	};
+	// is_first_byte_of_utf8_char_ec644bb641f9e7a4
+	aotLib[0x8ee2203231b2b145] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, uint8_t  ),&is_first_byte_of_utf8_char_ec644bb641f9e7a4>>();
+	};
+	// contains_utf8_bom_edd144f98283c290
+	aotLib[0x1b5c87de063cc55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<uint8_t> const  &  ),&contains_utf8_bom_edd144f98283c290>>();
+	};
+	// contains_utf8_bom_8f9915470303f783
+	aotLib[0xabb53c82a725e435] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, char * const   ),&contains_utf8_bom_8f9915470303f783>>();
+	};
+	// is_utf8_string_valid_525bea3db7bc8208
+	aotLib[0xf8cacb72ed55fde9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<uint8_t> const  &  ),&is_utf8_string_valid_525bea3db7bc8208>>();
+	};
+	// is_utf8_string_valid_254a13423df09411
+	aotLib[0xa7758643bc6f5e25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, char * const   ),&is_utf8_string_valid_254a13423df09411>>();
+	};
+	// utf8_decode_1ea46aff56c778b
+	aotLib[0xa6cf927af6419643] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> & , TArray<uint8_t> const  &  ),&utf8_decode_1ea46aff56c778b>>();
+	};
+	// utf8_decode_6daf598a4fe1ed4
+	aotLib[0x8dc597f357eaef2d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint32_t> (*) ( Context * __context__, TArray<uint8_t> const  &  ),&utf8_decode_6daf598a4fe1ed4>>();
+	};
+	// utf8_decode_9bde921137fa170
+	aotLib[0x81478685df45d949] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint32_t> (*) ( Context * __context__, char * const   ),&utf8_decode_9bde921137fa170>>();
+	};
+	// utf8_decode_4f7738d23733680a
+	aotLib[0x6e69f13c6265ac6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> & , char * const   ),&utf8_decode_4f7738d23733680a>>();
+	};
+	// [[ init script ]]
+	aotLib[0x4a533d7afee0986e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,62 @@
+#include "daScript/daScript.h"
+#include "daScript/misc/performance_time.h"
+
+using namespace das;
+
+// MemoryModel allocate/free churn, nanoseconds per allocate+free pair
+// live set is a ring of the requested size, every step frees the oldest block and allocates a new one
+// sizes are random in [16..256], same as short lived small arrays and strings
+
+TextPrinter tout;
+
+__forceinline uint64_t splitmix64 ( uint64_t & state ) {
+    uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+struct LiveBlock {
+    char *      ptr = nullptr;
+    uint32_t    size = 0;
+};
+
+double churn ( uint32_t freeListLimit, uint32_t liveSet, uint32_t steps, AllocationStats & stats ) {
+    MemoryModel model;
+    model.freeListLimit = freeListLimit;
+    vector<LiveBlock> ring(liveSet);
+    uint64_t seed = 12345;
+    for ( auto & b : ring ) {
+        b.size = 16 + uint32_t(splitmix64(seed) % 241);
+        b.ptr = model.allocate(b.size);
+    }
+    auto t0 = ref_time_ticks();
+    for ( uint32_t i=0; i!=steps; ++i ) {
+        auto & b = ring[i % liveSet];
+        model.free(b.ptr, b.size);
+        b.size = 16 + uint32_t(splitmix64(seed) % 241);
+        b.ptr = model.allocate(b.size);
+    }
+    double ns = double(get_time_usec(t0)) * 1000.0 / double(max(steps,1u));
+    model.getStats(stats);
+    for ( auto & b : ring ) {
+        model.free(b.ptr, b.size);
+    }
+    return ns;
+}
+
+int main( int argc, char * argv[] ) {
+    uint32_t steps = 10000000;
+    if ( argc==2 ) steps = uint32_t(max(1, atoi(argv[1])));
+    tout << "live set\tfree list\tns per alloc+free\tfree list hits\tdecks\tfragmentation\n";
+    for ( uint32_t liveSet : { 16u, 1024u, 65536u, 1048576u } ) {
+        for ( uint32_t limit : { 0u, uint32_t(DAS_FREE_LIST_LIMIT) } ) {
+            AllocationStats stats;
+            double ns = churn(limit, liveSet, steps, stats);
+            tout << liveSet << "\t" << limit << "\t" << ns << "\t"
+                << (double(stats.freeListHits) / double(max(stats.allocations,uint64_t(1)))) << "\t"
+                << stats.decks << "\t" << stats.fragmentation() << "\n";
+        }
+    }
+    return 0;
+}
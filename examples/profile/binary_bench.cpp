@@ -0,0 +1,169 @@
+#include "daScript/daScript.h"
+#include "daScript/misc/performance_time.h"
+
+using namespace das;
+
+// binary_save / binary_load (DataWalker per element) vs binary_save_versioned / binary_load_versioned
+// 'components' is an array of plain old data, 'entities' has strings and arrays in every element
+// binary_save grows its buffer by 1KB at a time, which is quadratic. its only measured up to the default count
+
+TextPrinter tout;
+
+const char * binary_bench_text = R""""(
+options indenting = 4
+
+require fio
+
+struct Component
+    pos : float3
+    vel : float3
+    id : int
+    alive : bool
+
+struct Entity
+    name : string
+    hp : int
+    path : array<float2>
+
+// binary_load wants exactly the same type, and const array<...> is not array<...>, hence the wrappers
+struct Components
+    data : array<Component>
+
+struct Entities
+    data : array<Entity>
+
+var g_components : Components
+var g_entities : Entities
+
+[export]
+def make_data ( count : int ) : int
+    g_components.data |> resize(count)
+    for c, i in g_components.data, range(count)
+        c.pos = float3(float(i), 1., 2.)
+        c.id = i
+        c.alive = true
+    g_entities.data |> resize(count / 10)
+    for e, i in g_entities.data, range(count)
+        e.name = "entity_{i}"
+        e.hp = i
+        e.path |> resize(i % 8)
+    return count
+
+[export]
+def save_components : int
+    var total = 0
+    binary_save(g_components) <| $ ( data )
+        var copy : Components
+        binary_load(copy, data)
+        total = length(data) + length(copy.data)
+    return total
+
+[export]
+def save_components_versioned : int
+    var total = 0
+    binary_save_versioned(g_components) <| $ ( data )
+        var copy : Components
+        binary_load_versioned(copy, data)
+        total = length(data) + length(copy.data)
+    return total
+
+[export]
+def save_entities : int
+    var total = 0
+    binary_save(g_entities) <| $ ( data )
+        var copy : Entities
+        binary_load(copy, data)
+        total = length(data) + length(copy.data)
+    return total
+
+[export]
+def save_entities_versioned : int
+    var total = 0
+    binary_save_versioned(g_entities) <| $ ( data )
+        var copy : Entities
+        binary_load_versioned(copy, data)
+        total = length(data) + length(copy.data)
+    return total
+
+[export]
+def file_components : int
+    var copy : Components
+    fopen("_binary_bench.bin", "wb") <| $ ( f )
+        fsave(f, g_components)
+    fopen("_binary_bench.bin", "rb") <| $ ( f )
+        fload(f, copy)
+    remove("_binary_bench.bin")
+    return length(copy.data)
+
+[export]
+def file_components_versioned : int
+    var copy : Components
+    fopen("_binary_bench.bin", "wb") <| $ ( f )
+        fsave_versioned(f, g_components)
+    fopen("_binary_bench.bin", "rb") <| $ ( f )
+        fload_versioned(f, copy)
+    remove("_binary_bench.bin")
+    return length(copy.data)
+)"""";
+
+smart_ptr<Program> compileBench ( const char * name, const string & text ) {
+    auto fAccess = make_smart<FsFileAccess>();
+    auto fileInfo = make_unique<TextFileInfo>(text.c_str(), uint32_t(text.length()), false);
+    fAccess->setFileInfo(name, move(fileInfo));
+    ModuleGroup dummyLibGroup;
+    auto program = compileDaScript(name, fAccess, tout, dummyLibGroup);
+    if ( program->failed() ) {
+        for ( auto & err : program->errors ) {
+            tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr);
+        }
+        return nullptr;
+    }
+    return program;
+}
+
+int32_t runTimed ( Context & ctx, const char * fnName, int64_t & usec ) {
+    auto fn = ctx.findFunction(fnName);
+    int32_t res = 0;
+    usec = INT64_MAX;
+    for ( int i=0; i!=5; ++i ) {
+        auto t0 = ref_time_ticks();
+        res = cast<int32_t>::to(ctx.evalWithCatch(fn, nullptr));
+        usec = das::min(usec, int64_t(get_time_usec(t0)));
+        if ( auto ex = ctx.getException() ) {
+            tout << fnName << ": " << ex << "\n";
+            return -1;
+        }
+    }
+    return res;
+}
+
+int main( int argc, char * argv[] ) {
+    NEED_ALL_DEFAULT_MODULES;
+    Module::Initialize();
+    int32_t count = argc>1 ? atoi(argv[1]) : 20000;
+    bool ok = false;
+    if ( auto program = compileBench("binary_bench.das", binary_bench_text) ) {
+        Context ctx(program->getContextStackSize());
+        if ( program->simulate(ctx, tout) ) {
+            vec4f args[1] = { cast<int32_t>::from(count) };
+            ctx.evalWithCatch(ctx.findFunction("make_data"), args);
+            tout << count << " components, " << count/10 << " entities, save and load\n";
+            tout << "test\tusec\tversioned usec\n";
+            const char * tests[] = { "save_components", "save_entities", "file_components" };
+            ok = true;
+            for ( auto test : tests ) {
+                int64_t usec = 0, versionedUsec = 0;
+                int32_t res = count<=20000 ? runTimed(ctx, test, usec) : 0;
+                int32_t versionedRes = runTimed(ctx, (string(test) + "_versioned").c_str(), versionedUsec);
+                tout << test << "\t";
+                if ( count<=20000 ) tout << usec; else tout << "-";
+                tout << "\t" << versionedUsec << "\n";
+                if ( res<0 || versionedRes<0 ) ok = false;
+            }
+        } else {
+            tout << "failed to simulate\n";
+        }
+    }
+    Module::Shutdown();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,101 @@
+#include "daScript/daScript.h"
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_jobque.h"
+
+using namespace das;
+
+// Channel vs LockFreeChannel throughput, messages per second
+// every producer pushes from its own context, same as jobs do
+
+TextPrinter tout;
+
+const int BATCH_SIZE = 64;
+
+template <typename TT>
+void producer ( TT & ch, Context * ctx, int count, int batch );
+
+template <>
+void producer ( Channel & ch, Context * ctx, int count, int ) {
+    for ( int i=0; i!=count; ++i ) {
+        ch.push((void *)intptr_t(i+1), ctx);
+    }
+    ch.notify();
+}
+
+template <>
+void producer ( LockFreeChannel & ch, Context * ctx, int count, int batch ) {
+    if ( batch>1 ) {
+        void * data[BATCH_SIZE];
+        for ( int i=0; i<count; i+=batch ) {
+            int n = min(batch, count-i);
+            for ( int j=0; j!=n; ++j ) data[j] = (void *)intptr_t(i+j+1);
+            ch.pushBatch(data, n, ctx);
+        }
+    } else {
+        for ( int i=0; i!=count; ++i ) {
+            ch.push((void *)intptr_t(i+1), ctx);
+        }
+    }
+    ch.notify();
+}
+
+int64_t consumer ( Channel & ch, int ) {
+    int64_t total = 0;
+    while ( ch.pop() ) total ++;
+    return total;
+}
+
+int64_t consumer ( LockFreeChannel & ch, int batch ) {
+    int64_t total = 0;
+    if ( batch>1 ) {
+        void * data[BATCH_SIZE];
+        while ( int32_t n = ch.popBatch(data, batch) ) total += n;
+    } else {
+        while ( ch.pop() ) total ++;
+    }
+    return total;
+}
+
+template <typename TT, typename MakeChannel>
+double bench ( int producers, int consumers, int count, int batch, MakeChannel && make ) {
+    vector<shared_ptr<Context>> contexts;
+    for ( int i=0; i!=producers; ++i ) contexts.push_back(make_shared<Context>(0));
+    unique_ptr<TT> ch(make(producers));
+    atomic<int64_t> received{0};
+    auto t0 = ref_time_ticks();
+    vector<thread> threads;
+    for ( int i=0; i!=producers; ++i ) {
+        Context * ctx = contexts[i].get();
+        threads.emplace_back([&,ctx](){ producer(*ch, ctx, count, batch); });
+    }
+    for ( int i=0; i!=consumers; ++i ) {
+        threads.emplace_back([&](){ received += consumer(*ch, batch); });
+    }
+    for ( auto & th : threads ) th.join();
+    int usec = get_time_usec(t0);
+    DAS_ASSERT(received==int64_t(producers)*count);
+    ch.reset();
+    return double(received) * 1000000.0 / double(max(usec,1));
+}
+
+int main( int argc, char * argv[] ) {
+    int count = 1000000;
+    if ( argc==2 ) count = max(1, atoi(argv[1]));
+    tout << "producers\tconsumers\tChannel msg/s\tLockFreeChannel msg/s\tLockFreeChannel batch msg/s\n";
+    for ( int producers : { 1, 2, 4 } ) {
+        for ( int consumers : { 1, 2 } ) {
+            double locked = bench<Channel>(producers, consumers, count, 1, [](int n){
+                return new Channel(nullptr, n);
+            });
+            double lockFree = bench<LockFreeChannel>(producers, consumers, count, 1, [](int n){
+                return new LockFreeChannel(nullptr, 4096, n, false);
+            });
+            double lockFreeBatch = bench<LockFreeChannel>(producers, consumers, count, BATCH_SIZE, [](int n){
+                return new LockFreeChannel(nullptr, 4096, n, false);
+            });
+            tout << producers << "\t" << consumers << "\t" << int64_t(locked) << "\t"
+                << int64_t(lockFree) << "\t" << int64_t(lockFreeBatch) << "\n";
+        }
+    }
+    return 0;
+}
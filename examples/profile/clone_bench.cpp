@@ -0,0 +1,89 @@
+#include "daScript/daScript.h"
+#include "daScript/misc/performance_time.h"
+
+using namespace das;
+
+// context clone time, with the init script vs with options clone_snapshot
+// globals are a table and an array with strings, built by the [init] function
+// init clones rebuild them every time, snapshot clones copy them from the parent
+
+TextPrinter tout;
+
+const char * clone_bench_text = R""""(
+var g_table : table<int; string>
+var g_names : array<string>
+var g_values : array<float>
+
+[init]
+def init_globals
+    for i in range(100000)
+        g_table[i] = "name_{i}"
+        g_names |> push("item_{i}")
+        g_values |> push(float(i) * 0.5)
+
+[export]
+def check : int
+    var total = 0
+    for i in range(length(g_names))
+        total += g_table?[i] ?? "" == "name_{i}" ? 1 : 0
+    return total + length(g_values)
+)"""";
+
+smart_ptr<Program> compileBench ( const char * name, const string & text ) {
+    auto fAccess = make_smart<FsFileAccess>();
+    auto fileInfo = make_unique<TextFileInfo>(text.c_str(), uint32_t(text.length()), false);
+    fAccess->setFileInfo(name, move(fileInfo));
+    ModuleGroup dummyLibGroup;
+    auto program = compileDaScript(name, fAccess, tout, dummyLibGroup);
+    if ( program->failed() ) {
+        for ( auto & err : program->errors ) {
+            tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr);
+        }
+        return nullptr;
+    }
+    return program;
+}
+
+bool runBench ( const char * name, const string & text ) {
+    auto program = compileBench(name, text);
+    if ( !program ) return false;
+    Context ctx(program->getContextStackSize());
+    if ( !program->simulate(ctx, tout) ) {
+        tout << "failed to simulate\n";
+        return false;
+    }
+    auto fnCheck = ctx.findFunction("check");
+    int32_t expected = cast<int32_t>::to(ctx.evalWithCatch(fnCheck, nullptr));
+    const int clones = 20;
+    int64_t cloneUsec = INT64_MAX, resetUsec = INT64_MAX;
+    unique_ptr<Context> clone;
+    for ( int i=0; i!=clones; ++i ) {
+        clone.reset();
+        auto t0 = ref_time_ticks();
+        clone.reset(new Context(ctx, uint32_t(ContextCategory::job_clone)));
+        cloneUsec = das::min(cloneUsec, int64_t(get_time_usec(t0)));
+    }
+    for ( int i=0; i!=clones; ++i ) {
+        auto t0 = ref_time_ticks();
+        clone->resetClone(&ctx);
+        resetUsec = das::min(resetUsec, int64_t(get_time_usec(t0)));
+    }
+    int32_t res = cast<int32_t>::to(clone->evalWithCatch(clone->findFunction("check"), nullptr));
+    if ( res!=expected ) {
+        tout << name << ": clone check failed, " << res << " vs " << expected << "\n";
+        return false;
+    }
+    tout << name << "\t" << cloneUsec << "\t" << resetUsec << "\t"
+        << int64_t(clone->heap->bytesAllocated() + clone->stringHeap->bytesAllocated()) << "\n";
+    return true;
+}
+
+int main( int, char * [] ) {
+    NEED_ALL_DEFAULT_MODULES;
+    Module::Initialize();
+    tout << "clone\tclone usec\treset usec\theap bytes\n";
+    bool ok = runBench("init.das", clone_bench_text)
+        && runBench("snapshot.das", string("options clone_snapshot = true\n") + clone_bench_text);
+    Module::Shutdown();
+    return ok ? 0 : 1;
+}
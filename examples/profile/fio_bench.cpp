@@ -0,0 +1,112 @@
+#include "daScript/daScript.h"
+
+using namespace das;
+
+// line reading throughput, fgets loop vs fread_lines vs fread_chunks
+// fgets allocates every line on the string heap, fread_lines passes temporary strings over the reused buffer,
+// fread_chunks is there for the reference, its bytes per second and not lines
+
+TextPrinter tout;
+
+const char * fio_bench_text = R""""(
+require fio
+require strings
+require math
+
+def best_of ( runs : int; blk : block<():int64> ) : tuple<int; int64>
+    var best = INT_MAX
+    var res = 0l
+    for i in range(runs)
+        let t0 = ref_time_ticks()
+        res = invoke(blk)
+        let t = get_time_usec(t0)
+        if t < best
+            best = t
+    return [[auto best, res]]
+
+def report ( name : string; expected : int64; usec_count : tuple<int; int64> )
+    let usec = max(usec_count._0, 1)
+    verify(usec_count._1 == expected)
+    print("{name}\t{usec/1000}\t{int64(double(expected) * 1000000.0lf / double(usec))}\n")
+
+[export]
+def main ( file_name : string; lines : int ) : bool
+    fopen(file_name, "wb") <| $(f)
+        for i in range(lines)
+            fwrite(f, "{i} the quick brown fox jumps over the lazy dog\n")
+        fflush(f)
+    let bytes = stat(file_name).size
+    print("method\tmsec\tper sec\n")
+    let runs = 3
+    let t_fgets = best_of(runs) <| $()
+        var count = 0l
+        fopen(file_name, "rb") <| $(f)
+            while !feof(f)
+                var line = fgets(f)
+                if line != ""
+                    count ++
+                unsafe
+                    delete_string(line)
+        return count
+    report("fgets", int64(lines), t_fgets)
+    let t_lines = best_of(runs) <| $()
+        var count = 0l
+        fopen(file_name, "rb") <| $(f)
+            fadvise(f, fadvise_sequential)
+            count = fread_lines(f) <| $(line)
+                pass
+        return count
+    report("fread_lines", int64(lines), t_lines)
+    let t_length = best_of(runs) <| $()
+        var count = 0l
+        var total = 0
+        fopen(file_name, "rb") <| $(f)
+            fadvise(f, fadvise_sequential)
+            count = fread_lines(f) <| $(line)
+                total += length(line)
+        return count
+    report("fread_lines, length", int64(lines), t_length)
+    let t_chunks = best_of(runs) <| $()
+        var count = 0l
+        fopen(file_name, "rb") <| $(f)
+            fadvise(f, fadvise_sequential)
+            count = fread_chunks(f, 65536) <| $(data)
+                pass
+        return count
+    report("fread_chunks, bytes", int64(bytes), t_chunks)
+    remove(file_name)
+    return true
+)"""";
+
+int main( int argc, char * argv[] ) {
+    int32_t lines = 1000000;
+    if ( argc==2 ) lines = max(1, atoi(argv[1]));
+    NEED_ALL_DEFAULT_MODULES;
+    Module::Initialize();
+    auto fAccess = make_smart<FsFileAccess>();
+    auto fileInfo = make_unique<TextFileInfo>(fio_bench_text, uint32_t(strlen(fio_bench_text)), false);
+    fAccess->setFileInfo("fio_bench.das", move(fileInfo));
+    ModuleGroup dummyLibGroup;
+    auto program = compileDaScript("fio_bench.das", fAccess, tout, dummyLibGroup);
+    if ( program->failed() ) {
+        for ( auto & err : program->errors ) {
+            tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr);
+        }
+        return 1;
+    }
+    Context ctx(program->getContextStackSize());
+    if ( !program->simulate(ctx, tout) ) {
+        tout << "failed to simulate\n";
+        return 1;
+    }
+    const char * fileName = "fio_bench.txt";
+    vec4f args[2] = { cast<const char *>::from(fileName), cast<int32_t>::from(lines) };
+    ctx.evalWithCatch(ctx.findFunction("main"), args);
+    if ( auto ex = ctx.getException() ) {
+        tout << "exception: " << ex << "\n";
+        return 1;
+    }
+    program.reset();
+    Module::Shutdown();
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include "daScript/daScript.h"
+#include "daScript/misc/performance_time.h"
+
+using namespace das;
+
+// daslib/functional map |> filter |> sum chains. sum, reduce, any and all fuse the chain into a single loop,
+// passing the chain through a variable first keeps the generators. hand written loop is the baseline
+
+TextPrinter tout;
+
+const char * functional_bench_text = R""""(
+options indenting = 4
+
+require daslib/functional
+
+var g_data : array<int>
+
+[export]
+def make_data ( count : int ) : int
+    g_data |> resize(count)
+    for x, i in g_data, range(count)
+        x = i * 7 + 3
+    return count
+
+[export]
+def fused : int
+    unsafe
+        return g_data |> each() |> map(@(x : int) => (x & 255) * 3) |> filter(@(x : int) => (x & 1) == 0) |> sum()
+
+[export]
+def generators : int
+    unsafe
+        var it <- g_data |> each() |> map(@(x : int) => (x & 255) * 3) |> filter(@(x : int) => (x & 1) == 0)
+        return sum(it)
+
+[export]
+def hand_loop : int
+    var total = 0
+    for x in g_data
+        let y = (x & 255) * 3
+        if (y & 1) == 0
+            total += y
+    return total
+
+[export]
+def range_fused : int
+    return range(length(g_data)) |> each() |> map(@(x : int) => x & 255) |> islice(0, length(g_data) / 2) |> reduce(@(a, b : int) => a + b)
+
+[export]
+def range_generators : int
+    var it <- range(length(g_data)) |> each() |> map(@(x : int) => x & 255) |> islice(0, length(g_data) / 2)
+    return reduce(it, @(a, b : int) => a + b)
+)"""";
+
+smart_ptr<Program> compileBench ( const char * name, const string & text ) {
+    auto fAccess = make_smart<FsFileAccess>();
+    auto fileInfo = make_unique<TextFileInfo>(text.c_str(), uint32_t(text.length()), false);
+    fAccess->setFileInfo(name, move(fileInfo));
+    ModuleGroup dummyLibGroup;
+    auto program = compileDaScript(name, fAccess, tout, dummyLibGroup);
+    if ( program->failed() ) {
+        for ( auto & err : program->errors ) {
+            tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr);
+        }
+        return nullptr;
+    }
+    return program;
+}
+
+int32_t runTimed ( Context & ctx, const char * fnName, int64_t & usec ) {
+    auto fn = ctx.findFunction(fnName);
+    int32_t res = 0;
+    usec = INT64_MAX;
+    for ( int i=0; i!=5; ++i ) {
+        auto t0 = ref_time_ticks();
+        res = cast<int32_t>::to(ctx.evalWithCatch(fn, nullptr));
+        usec = das::min(usec, int64_t(get_time_usec(t0)));
+        if ( auto ex = ctx.getException() ) {
+            tout << fnName << ": " << ex << "\n";
+            return -1;
+        }
+    }
+    return res;
+}
+
+int main( int argc, char * argv[] ) {
+    NEED_ALL_DEFAULT_MODULES;
+    Module::Initialize();
+    int32_t count = argc>1 ? atoi(argv[1]) : 1000000;
+    bool ok = false;
+    if ( auto program = compileBench("functional_bench.das", functional_bench_text) ) {
+        Context ctx(program->getContextStackSize());
+        if ( program->simulate(ctx, tout) ) {
+            vec4f args[1] = { cast<int32_t>::from(count) };
+            ctx.evalWithCatch(ctx.findFunction("make_data"), args);
+            tout << count << " elements\n";
+            tout << "test\tusec\tresult\n";
+            const char * tests[] = { "fused", "generators", "hand_loop", "range_fused", "range_generators" };
+            int32_t results[5];
+            ok = true;
+            for ( int i=0; i!=5; ++i ) {
+                int64_t usec = 0;
+                results[i] = runTimed(ctx, tests[i], usec);
+                tout << tests[i] << "\t" << usec << "\t" << results[i] << "\n";
+            }
+            if ( results[0]!=results[1] || results[0]!=results[2] || results[3]!=results[4] ) {
+                tout << "fused and generator results do not match\n";
+                ok = false;
+            }
+        } else {
+            tout << "failed to simulate\n";
+        }
+    }
+    Module::Shutdown();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,77 @@
+#include "daScript/daScript.h"
+#include "daScript/misc/performance_time.h"
+#include "daScript/misc/job_que.h"
+
+using namespace das;
+
+// collectHeap mark phase, single threaded vs marked on the job queue
+// heap holds the requested number of objects in a global array, each one with a string
+// caller thread takes part in marking as well, so N job threads mark with N+1 walkers
+
+TextPrinter tout;
+
+const char * gc_bench_text = R""""(
+options persistent_heap = true
+options gc
+
+struct Node
+    value : int
+    name : string
+
+var g_nodes : array<Node?>
+
+[export]
+def init ( count : int )
+    g_nodes |> reserve(count)
+    for i in range(count)
+        g_nodes |> push(new [[Node value=i, name="node {i}"]])
+)"""";
+
+double collectUsec ( Context & ctx, JobQue * jobQue, int runs ) {
+    int bestUsec = INT_MAX;
+    for ( int i=0; i!=runs; ++i ) {
+        auto t0 = ref_time_ticks();
+        ctx.collectHeap(nullptr, true, false, jobQue);
+        bestUsec = min(bestUsec, get_time_usec(t0));
+    }
+    return double(bestUsec);
+}
+
+int main( int argc, char * argv[] ) {
+    int32_t count = 1000000;
+    if ( argc==2 ) count = max(1, atoi(argv[1]));
+    NEED_ALL_DEFAULT_MODULES;
+    Module::Initialize();
+    auto fAccess = make_smart<FsFileAccess>();
+    auto fileInfo = make_unique<TextFileInfo>(gc_bench_text, uint32_t(strlen(gc_bench_text)), false);
+    fAccess->setFileInfo("gc_bench.das", move(fileInfo));
+    ModuleGroup dummyLibGroup;
+    auto program = compileDaScript("gc_bench.das", fAccess, tout, dummyLibGroup);
+    if ( program->failed() ) {
+        for ( auto & err : program->errors ) {
+            tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr);
+        }
+        return 1;
+    }
+    Context ctx(program->getContextStackSize());
+    if ( !program->simulate(ctx, tout) ) {
+        tout << "failed to simulate\n";
+        return 1;
+    }
+    vec4f args[1] = { cast<int32_t>::from(count) };
+    ctx.evalWithCatch(ctx.findFunction("init"), args);
+    tout << count << " objects, " << ctx.heap->bytesAllocated() << " heap bytes, "
+        << ctx.stringHeap->bytesAllocated() << " string heap bytes\n";
+    const int runs = 5;
+    double single = collectUsec(ctx, nullptr, runs);
+    tout << "threads\tcollect usec\tspeedup\n";
+    tout << "single\t" << single << "\t1\n";
+    for ( int threads = 1; threads <= JobQue::get_num_threads(); threads *= 2 ) {
+        JobQue que(threads);
+        double parallel = collectUsec(ctx, &que, runs);
+        tout << threads << "\t" << parallel << "\t" << (single / max(parallel,1.0)) << "\n";
+    }
+    program.reset();
+    Module::Shutdown();
+    return 0;
+}
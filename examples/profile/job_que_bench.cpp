@@ -0,0 +1,81 @@
+#include "daScript/daScript.h"
+#include "daScript/misc/performance_time.h"
+#include "daScript/misc/job_que.h"
+
+using namespace das;
+
+// JobQue throughput, jobs per second for 1..N worker threads
+//  push        - tiny jobs pushed from the main thread
+//  nested      - each job pushes more jobs from the worker thread (local deque + stealing)
+//  parallel_for- small chunks
+
+TextPrinter tout;
+
+volatile int g_sink = 0;
+
+__forceinline void tiny_work() {
+    int s = 0;
+    for ( int i=0; i!=16; ++i ) s += i;
+    g_sink = s;
+}
+
+double bench_push ( int threads, int totalJobs ) {
+    JobQue jq(threads);
+    atomic<int> done{0};
+    auto t0 = ref_time_ticks();
+    for ( int i=0; i!=totalJobs; ++i ) {
+        jq.push([&](){ tiny_work(); done++; }, 0, JobPriority::Default);
+    }
+    jq.wait();
+    int usec = get_time_usec(t0);
+    DAS_ASSERT(done==totalJobs);
+    return double(totalJobs) * 1000000.0 / double(max(usec,1));
+}
+
+void nested_job ( JobQue & jq, atomic<int> & done, int depth ) {
+    tiny_work();
+    done++;
+    if ( depth ) {
+        for ( int i=0; i!=4; ++i ) {
+            jq.push([&jq,&done,depth](){ nested_job(jq, done, depth-1); }, 0, JobPriority::Default);
+        }
+    }
+}
+
+double bench_nested ( int threads, int depth ) {
+    JobQue jq(threads);
+    atomic<int> done{0};
+    auto t0 = ref_time_ticks();
+    jq.push([&](){ nested_job(jq, done, depth); }, 0, JobPriority::Default);
+    jq.wait();
+    int usec = get_time_usec(t0);
+    return double(done) * 1000000.0 / double(max(usec,1));
+}
+
+double bench_parallel_for ( int threads, int total, int chunkSize, int repeat ) {
+    JobQue jq(threads);
+    int jobs = 0;
+    auto t0 = ref_time_ticks();
+    for ( int r=0; r!=repeat; ++r ) {
+        jq.parallel_for(0, total, [&](int i0, int i1){
+            for ( int i=i0; i<i1; ++i ) tiny_work();
+        }, 0, JobPriority::Default, total/chunkSize);
+        jobs += total/chunkSize;
+    }
+    int usec = get_time_usec(t0);
+    return double(jobs) * 1000000.0 / double(max(usec,1));
+}
+
+int main( int argc, char * argv[] ) {
+    int maxThreads = JobQue::get_num_threads();
+    if ( argc==2 ) maxThreads = max(1, atoi(argv[1]));
+    tout << "threads\tpush jobs/s\tnested jobs/s\tparallel_for chunks/s\n";
+    for ( int threads=1; ; threads=min(threads*2,maxThreads) ) {
+        double push = bench_push(threads, 1000000);
+        double nested = bench_nested(threads, 9);
+        double pfor = bench_parallel_for(threads, 1024*64, 16, 64);
+        tout << threads << "\t" << int64_t(push) << "\t" << int64_t(nested) << "\t" << int64_t(pfor) << "\n";
+        if ( threads==maxThreads ) break;
+    }
+    return 0;
+}
@@ -0,0 +1,421 @@
+#include "daScript/daScript.h"
+#include "daScript/misc/performance_time.h"
+
+using namespace das;
+
+// JSON read and write time, old script lexer and parser vs the native json_native module
+// legacy_* is the daslib/json implementation before json_native, kept here for the comparison
+// text is an array of records, which is parsed into the JsonValue tree, or decoded directly into array<Record>
+
+TextPrinter tout;
+
+const char * json_bench_text = R""""(
+options indenting = 4
+options no_unused_block_arguments = false
+options no_unused_function_arguments = false
+
+require daslib/json
+require strings
+
+struct Record
+    id : int
+    name : string
+    score : double
+    active : bool
+    tags : array<string>
+    pos : float3
+
+var g_text : string
+var g_tree : JsonValue?
+var g_records : array<Record>
+
+[export]
+def make_text ( count : int ) : int
+    var records : array<Record>
+    for i in range(count)
+        records |> emplace([[Record id=i, name="record \"{i}\"", score=double(i) * 0.37lf, active=(i % 3)==0,
+            tags <- [{string "alpha"; "beta_{i % 7}"}], pos=float3(float(i), 0.5, -float(i))]])
+    g_text = write_json(records)
+    return length(g_text)
+
+def count_nodes ( js : JsonValue? ) : int
+    if js == null
+        return 0
+    var total = 1
+    if js.value is _array
+        for e in js.value as _array
+            total += count_nodes(e)
+    elif js.value is _object
+        for v in values(js.value as _object)
+            total += count_nodes(v)
+    return total
+
+[export]
+def legacy_parse : int
+    var error = ""
+    unsafe
+        delete g_tree
+    g_tree = legacy_read_json(g_text, error)
+    return count_nodes(g_tree)
+
+[export]
+def native_parse : int
+    var error = ""
+    unsafe
+        delete g_tree
+    g_tree = read_json(g_text, error)
+    return count_nodes(g_tree)
+
+[export]
+def native_decode : int
+    var error = ""
+    if !read_json(g_text, g_records, error)
+        panic(error)
+    var total = 0
+    for r in g_records
+        total += 1 + 4 + (1 + length(r.tags)) + (1 + 3)     // same as count_nodes, object, scalars, tags and pos
+    return total + 1
+
+[export]
+def legacy_write : int
+    let st = build_string() <| $ (var writer)
+        legacy_write_value(writer, g_tree, 0)
+    return length(st)
+
+[export]
+def native_write : int
+    return length(write_json(g_tree))
+
+[export]
+def native_encode : int
+    return length(write_json(g_records))
+
+def legacy_read_json ( text : string implicit; var error : string& ) : JsonValue?
+    var lex <- lexer(text)
+    let res = parse_value(lex,error)
+    delete lex
+    return res
+
+variant Token
+    //! JSON input stream token.
+    _string : string
+    _number : double
+    _bool   : bool
+    _null   : void?
+    _symbol : int
+    _error  : string
+
+let
+    Token_string = typeinfo(variant_index<_string> type<Token>)
+    Token_symbol = typeinfo(variant_index<_symbol> type<Token>)
+
+def lexer ( text : string )
+    let stext = clone_string(text)
+    return <- _lexer(stext)
+
+def _lexer ( var stext : string implicit )
+    return <- generator<Token>() <|
+        var tin : iterator<int>
+        unsafe
+            tin <- each(stext)
+        var ahead : int = ' '
+        var str : array<uint8>
+        while !empty(tin)
+            while is_white_space(ahead) && next(tin,ahead)
+                pass
+            if empty(tin)
+                return false
+            if ahead=='[' || ahead==']' || ahead=='{' || ahead=='}' || ahead==':' || ahead==','
+                yield [[Token _symbol=ahead]]
+                next(tin, ahead)
+            elif ahead=='"'
+                while next(tin,ahead) && ahead!='"'
+                    if ahead == '\\'
+                        if next(tin,ahead)
+                            if ahead=='b'
+                                ahead = '\b'
+                            elif ahead=='f'
+                                ahead = '\f'
+                            elif ahead=='n'
+                                ahead = '\n'
+                            elif ahead=='r'
+                                ahead = '\r'
+                            elif ahead=='t'
+                                ahead = '\t'
+                            push(str,uint8(ahead))
+                        else
+                            yield [[Token _error = "string escape sequence exceeds text"]]
+                            return false
+                    else
+                        push(str,uint8(ahead))
+                if empty(tin)
+                    yield [[Token _error = "string exceeds text"]]
+                    return false
+                yield [[Token _string = string(str)]]
+                clear(str)
+                next(tin, ahead)
+            elif ahead=='+' || ahead=='-' || is_number(ahead)
+                push(str,uint8(ahead))
+                while next(tin,ahead) && is_number(ahead)
+                    push(str,uint8(ahead))
+                if !empty(tin) && ahead=='.'
+                    push(str,uint8(ahead))
+                    while next(tin,ahead) && is_number(ahead)
+                        push(str,uint8(ahead))
+                if !empty(tin) && (ahead=='e' || ahead=='E')
+                    push(str,uint8(ahead))
+                    next(tin,ahead)
+                    if ahead=='+' || ahead=='-' || is_number(ahead)
+                        push(str,uint8(ahead))
+                    while next(tin,ahead) && is_number(ahead)
+                        push(str,uint8(ahead))
+                var num = string(str)
+                yield [[Token _number = double(num)]]
+                clear(str)
+                unsafe
+                    delete_string(num)
+            elif is_alpha(ahead)
+                push(str,uint8(ahead))
+                while next(tin,ahead) && is_alpha(ahead)
+                    push(str,uint8(ahead))
+                var name = string(str)
+                if name == "true"
+                    yield [[Token _bool=true]]
+                elif name == "false"
+                    yield [[Token _bool=false]]
+                elif name == "null"
+                    yield [[Token _null = null]]
+                else
+                    yield [[Token _error = "invalid name {name}"]]
+                    return false
+                unsafe
+                    delete_string(name)
+                clear(str)
+            else
+                yield [[Token _error = "invalid character `{to_char(ahead)}` aka ASCII {ahead}"]]
+                return false
+        return false
+    finally
+        unsafe
+            delete_string(stext)
+
+def expect_token ( var itv : iterator<Token>; var ahead : Token; vindex : int; var error : string & ) : bool
+    if !next(itv, ahead)
+        error = "unexected eos"
+        return false
+    elif variant_index(ahead) != vindex
+        error = "unexpected {ahead}, expecting variant {vindex}"
+        return false
+    else
+        return true
+
+def expect_symbol ( var itv : iterator<Token>; var ahead : Token; sym : int; var error : string & ) : bool
+    if !next(itv, ahead)
+        error = "unexected eos"
+        return false
+    elif ! ahead is _symbol
+        error = "unexpected {ahead}, expecting symbol"
+        return false
+    elif !(ahead as _symbol == sym)
+        error = "unexpected {ahead}, expecting symbol `{to_char(sym)}` aka ASCII {sym}"
+        return true
+    else
+        return true
+
+def parse_value ( var itv : iterator<Token>; var error : string & ) : JsonValue?
+    var ahead : Token
+    if !next(itv, ahead)
+        return null
+    if ahead is _symbol
+        let sym = ahead as _symbol
+        if sym == ']'
+            error = "unexpected ]"
+            return null
+        if sym == '['
+            var arr : array<JsonValue?>
+            while !empty(itv)
+                let value = parse_value(itv, error)
+                if value == null
+                    if error=="unexpected ]" && length(arr)==0
+                        error = ""
+                        return JV(arr)
+                    return null
+                push(arr, value)
+                if !expect_token(itv, ahead, Token_symbol, error)
+                    return null
+                let sepsym = ahead as _symbol
+                if sepsym == ']'
+                    break
+                elif sepsym != ','
+                    error = "unsepected array seaprator symbol `{to_char(sepsym)}` aka ASCII {sepsym}"
+                    return null
+            if empty(itv)
+                error = "unexpected eos"
+                return null
+            return JV(arr)
+        elif sym == '{'
+            var tab : table<string; JsonValue?>
+            while !empty(itv)
+                if !expect_token(itv, ahead, Token_string, error)
+                    if (ahead is _symbol) && (ahead as _symbol)=='}' && length(tab)==0
+                        error = ""
+                        return JV(tab)
+                    return null
+                let key = ahead as _string
+                if !expect_symbol(itv, ahead, ':', error)
+                    return null
+                let value = parse_value(itv, error)
+                if value == null
+                    return null
+                if key_exists(tab,key)
+                    error = "duplicate key {key}"
+                    return null
+                tab[key] = value
+                if !expect_token(itv, ahead, Token_symbol, error)
+                    return null
+                let sepsym = ahead as _symbol
+                if sepsym == '}'
+                    break
+                elif sepsym != ','
+                    error = "unsepected object seaprator symbol `{to_char(sepsym)}` aka ASCII {sepsym}"
+                    return null
+            if empty(itv)
+                error = "unexpected eos"
+                return null
+            return JV(tab)
+        else
+            error = "unexpected symbol `{to_char(sym)}` aka ASCII {sym}"
+            return null
+    elif ahead is _string
+        return JV(ahead as _string)
+    elif ahead is _number
+        return JV(ahead as _number)
+    elif ahead is _bool
+        return JV(ahead as _bool)
+    elif ahead is _null
+        return JVNull()
+    else
+        error = "{ahead}"
+        return null
+
+def legacy_write_value ( var writer : StringBuilderWriter; jsv : JsonValue?; depth : int )
+    if jsv == null
+        write(writer, "null")
+    elif jsv.value is _string
+        write(writer, "\"")
+        write_escape_string(writer, jsv.value as _string)
+        write(writer, "\"")
+    elif jsv.value is _number
+        write(writer, jsv.value as _number)
+    elif jsv.value is _array
+        if length(jsv.value as _array)==0
+            write(writer, "[]")
+        else
+            write(writer, "[\n")
+            var first = true
+            for elem in jsv.value as _array
+                if first
+                    first = false
+                else
+                    write(writer,",\n")
+                write_chars(writer,'\t',depth+1)
+                legacy_write_value(writer, elem, depth+1)
+            write(writer, "\n")
+            write_chars(writer,'\t',depth)
+            write(writer, "]")
+    elif jsv.value is _object
+        if length(jsv.value as _object)==0
+            write(writer, "\{\}")
+        else
+            write(writer, "\{\n")
+            var first = true
+            for elemK, elemV in keys(jsv.value as _object), values(jsv.value as _object)
+                if first
+                    first = false
+                else
+                    write(writer,",\n")
+                write_chars(writer,'\t',depth+1)
+                write(writer, "\"")
+                write_escape_string(writer, elemK)
+                write(writer, "\" : ")
+                legacy_write_value(writer, elemV, depth+1)
+            write(writer, "\n")
+            write_chars(writer,'\t',depth)
+            write(writer, "\}")
+    elif jsv.value is _bool
+        if jsv.value as _bool
+            write(writer, "true")
+        else
+            write(writer, "false")
+    elif jsv.value is _null
+        write(writer, "null")
+    else
+        panic("unexpected {jsv}")
+
+)"""";
+
+smart_ptr<Program> compileBench ( const char * name, const string & text ) {
+    auto fAccess = make_smart<FsFileAccess>();
+    auto fileInfo = make_unique<TextFileInfo>(text.c_str(), uint32_t(text.length()), false);
+    fAccess->setFileInfo(name, move(fileInfo));
+    ModuleGroup dummyLibGroup;
+    auto program = compileDaScript(name, fAccess, tout, dummyLibGroup);
+    if ( program->failed() ) {
+        for ( auto & err : program->errors ) {
+            tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr);
+        }
+        return nullptr;
+    }
+    return program;
+}
+
+int32_t runTimed ( Context & ctx, const char * fnName, int64_t & usec ) {
+    auto fn = ctx.findFunction(fnName);
+    int32_t res = 0;
+    usec = INT64_MAX;
+    for ( int i=0; i!=5; ++i ) {
+        auto t0 = ref_time_ticks();
+        res = cast<int32_t>::to(ctx.evalWithCatch(fn, nullptr));
+        usec = das::min(usec, int64_t(get_time_usec(t0)));
+        if ( auto ex = ctx.getException() ) {
+            tout << fnName << ": " << ex << "\n";
+            return -1;
+        }
+    }
+    return res;
+}
+
+int main( int argc, char * argv[] ) {
+    NEED_ALL_DEFAULT_MODULES;
+    Module::Initialize();
+    int32_t count = argc>1 ? atoi(argv[1]) : 20000;
+    bool ok = false;
+    if ( auto program = compileBench("json_bench.das", json_bench_text) ) {
+        Context ctx(program->getContextStackSize());
+        if ( program->simulate(ctx, tout) ) {
+            vec4f args[1] = { cast<int32_t>::from(count) };
+            int32_t bytes = cast<int32_t>::to(ctx.evalWithCatch(ctx.findFunction("make_text"), args));
+            tout << count << " records, " << bytes << " bytes of json\n";
+            tout << "test\tusec\tMB/s\tresult\n";
+            const char * tests[] = { "legacy_parse", "native_parse", "native_decode", "legacy_write", "native_write", "native_encode" };
+            int32_t results[6];
+            ok = true;
+            for ( int i=0; i!=6; ++i ) {
+                int64_t usec = 0;
+                results[i] = runTimed(ctx, tests[i], usec);
+                ok &= results[i]>=0;
+                tout << tests[i] << "\t" << usec << "\t" << int64_t(double(bytes) / double(das::max(usec,int64_t(1)))) << "\t" << results[i] << "\n";
+            }
+            // same tree out of both parsers, and the same amount of values out of the decoder
+            // legacy writer prints numbers with %.17f, so only the native outputs are expected to match
+            if ( results[0]!=results[1] || results[1]!=results[2] || results[4]!=results[5] ) {
+                tout << "results do not match\n";
+                ok = false;
+            }
+        } else {
+            tout << "failed to simulate\n";
+        }
+    }
+    Module::Shutdown();
+    return ok ? 0 : 1;
+}
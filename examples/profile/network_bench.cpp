@@ -0,0 +1,196 @@
+#include "daScript/daScript.h"
+#include "daScript/misc/performance_time.h"
+#include "daScript/misc/network.h"
+
+#include <thread>
+#include <atomic>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#define closesocket close
+#endif
+
+using namespace das;
+
+// loopback echo throughput of MultiServer, with length32 framing
+// each client thread keeps a window of messages in flight, and waits for all the echoes before sending the next one
+// server is ticked on the main thread, echo is done either in C++, or by the script via the batched onData
+
+TextPrinter tout;
+
+const char * network_bench_text = R""""(
+require network
+
+class EchoServer : MultiServer
+    def EchoServer
+        MultiServer`MultiServer(cast<MultiServer> self)
+    def override onConnect ( connection : int ) : void
+        pass
+    def override onDisconnect ( connection : int ) : void
+        pass
+    def override onData ( messages : array<NetworkMessage> ) : void
+        for m in messages
+            self->send(m.connection, m.data, m.size)
+    def override onError ( msg : string; code : int ) : void
+        print("server error:{code} - {msg}\n")
+
+var g_server : EchoServer?
+
+[export]
+def start : int
+    g_server = new EchoServer()
+    g_server->make_server_adapter()
+    if !g_server->init(0, NetworkFraming length32)
+        return 0
+    return g_server->get_port()
+
+[export]
+def tick : int
+    return g_server->tick(1)
+
+[export]
+def stop
+    unsafe
+        delete g_server
+)"""";
+
+class NativeEchoServer : public MultiServer {
+protected:
+    virtual void onData ( NetworkMessage * messages, int32_t count ) override {
+        for ( int32_t i=0; i!=count; ++i ) {
+            send_msg(messages[i].connection, (const char *)messages[i].data, messages[i].size);
+        }
+    }
+    virtual void onError ( const char * msg, int code ) override {
+        tout << "server error:" << code << " - " << msg << "\n";
+    }
+};
+
+static bool sendAll ( socket_t fd, const char * data, size_t size ) {
+    while ( size ) {
+        auto res = send(fd, data, int(size), 0);
+        if ( res<=0 ) return false;
+        data += res;
+        size -= size_t(res);
+    }
+    return true;
+}
+
+static bool recvAll ( socket_t fd, char * data, size_t size ) {
+    while ( size ) {
+        auto res = recv(fd, data, int(size), 0);
+        if ( res<=0 ) return false;
+        data += res;
+        size -= size_t(res);
+    }
+    return true;
+}
+
+static void runClient ( int port, int msgSize, int window, const atomic<bool> & stop, atomic<uint64_t> & total ) {
+    socket_t fd = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(uint16_t(port));
+    if ( connect(fd, (struct sockaddr *)&address, sizeof(address))<0 ) {
+        closesocket(fd);
+        return;
+    }
+    int val = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (const char *)&val, sizeof(val));
+    vector<char> out;
+    for ( int i=0; i!=window; ++i ) {
+        uint8_t len[4] = { uint8_t(msgSize), uint8_t(msgSize>>8), uint8_t(msgSize>>16), uint8_t(msgSize>>24) };
+        out.insert(out.end(), (char *)len, (char *)len + 4);
+        out.insert(out.end(), size_t(msgSize), char('a' + i % 26));
+    }
+    vector<char> in(out.size());
+    uint64_t messages = 0;
+    while ( !stop ) {
+        if ( !sendAll(fd, out.data(), out.size()) ) break;
+        if ( !recvAll(fd, in.data(), in.size()) ) break;
+        messages += window;
+    }
+    total += messages;
+    closesocket(fd);
+}
+
+template <typename TT>
+void runBench ( const char * name, int port, int clients, int msgSize, TT && tick ) {
+    const int window = 16;
+    const int durationMsec = 1000;
+    atomic<bool> stop{false};
+    atomic<uint64_t> total{0};
+    vector<thread> threads;
+    for ( int i=0; i!=clients; ++i ) {
+        threads.emplace_back([&](){ runClient(port, msgSize, window, stop, total); });
+    }
+    auto t0 = ref_time_ticks();
+    while ( get_time_usec(t0) < durationMsec*1000 ) {
+        tick();
+    }
+    stop = true;
+    // keep echoing, so that clients waiting for the last window can exit
+    atomic<int> running{1};
+    thread joiner([&](){ for ( auto & t : threads ) t.join(); running = 0; });
+    while ( running ) {
+        tick();
+    }
+    joiner.join();
+    double sec = get_time_usec(t0) / 1000000.0;
+    double msgs = double(total) / sec;
+    double mb = msgs * msgSize / (1024.0*1024.0);
+    tout << name << "\t" << clients << "\t" << msgSize << "\t" << int64_t(msgs) << "\t" << mb << "\n";
+}
+
+int main( int, char * [] ) {
+    NEED_ALL_DEFAULT_MODULES;
+    Module::Initialize();
+    Server::startup();
+    auto fAccess = make_smart<FsFileAccess>();
+    auto fileInfo = make_unique<TextFileInfo>(network_bench_text, uint32_t(strlen(network_bench_text)), false);
+    fAccess->setFileInfo("network_bench.das", move(fileInfo));
+    ModuleGroup dummyLibGroup;
+    auto program = compileDaScript("network_bench.das", fAccess, tout, dummyLibGroup);
+    if ( program->failed() ) {
+        for ( auto & err : program->errors ) {
+            tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr);
+        }
+        return 1;
+    }
+    Context ctx(program->getContextStackSize());
+    if ( !program->simulate(ctx, tout) ) {
+        tout << "failed to simulate\n";
+        return 1;
+    }
+    auto fnStart = ctx.findFunction("start");
+    auto fnTick = ctx.findFunction("tick");
+    auto fnStop = ctx.findFunction("stop");
+    int scriptPort = cast<int32_t>::to(ctx.evalWithCatch(fnStart, nullptr));
+    auto native = make_smart<NativeEchoServer>();
+    if ( !scriptPort || !native->init(0, NetworkFraming::length32) ) {
+        tout << "failed to start servers\n";
+        return 1;
+    }
+    tout << "server\tclients\tmsg bytes\tmsg/sec\tMB/sec\n";
+    for ( int clients : { 1, 8, 64 } ) {
+        for ( int msgSize : { 64, 4096 } ) {
+            runBench("native", native->get_port(), clients, msgSize, [&](){ native->tick(1); });
+            runBench("script", scriptPort, clients, msgSize, [&](){ ctx.evalWithCatch(fnTick, nullptr); });
+        }
+    }
+    ctx.evalWithCatch(fnStop, nullptr);
+    native.reset();
+    program.reset();
+    Server::shutdown();
+    Module::Shutdown();
+    return 0;
+}
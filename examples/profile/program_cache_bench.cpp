@@ -0,0 +1,62 @@
+#include "daScript/daScript.h"
+#include "daScript/ast/ast_program_cache.h"
+#include "daScript/misc/performance_time.h"
+
+using namespace das;
+
+// cold vs warm start via ProgramCache, microseconds
+// cold start compiles the script along with its modules, warm start validates sources and reuses the program
+// both simulate a fresh context, which is what it takes to start the script
+
+TextPrinter tout;
+
+int64_t startUsec ( ProgramCache & cache, const string & fn, const FileAccessPtr & access, bool & ok ) {
+    auto t0 = ref_time_ticks();
+    auto entry = cache.compile(fn, access, tout);
+    if ( entry->program->failed() ) {
+        for ( auto & err : entry->program->errors ) {
+            tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr);
+        }
+        ok = false;
+        return 0;
+    }
+    Context ctx(entry->program->getContextStackSize());
+    ok = entry->program->simulate(ctx, tout);
+    return get_time_usec(t0);
+}
+
+int main( int argc, char * argv[] ) {
+    vector<string> files;
+    for ( int i=1; i<argc; ++i ) files.push_back(argv[i]);
+    NEED_ALL_DEFAULT_MODULES;
+    Module::Initialize();
+    if ( files.empty() ) {
+        for ( auto name : { "aonce.das", "check_defer.das", "fun.das", "ifnn.das", "join.das", "bin_serializer.das" } ) {
+            files.push_back(getDasRoot() + "/examples/test/unit_tests/" + name);
+        }
+    }
+    auto access = make_smart<FsFileAccess>();
+    ProgramCache cache;
+    const int runs = 10;
+    tout << "file\tcold usec\twarm usec\tspeedup\n";
+    for ( auto & fn : files ) {
+        bool ok = true;
+        cache.invalidate(fn);
+        auto cold = startUsec(cache, fn, access, ok);
+        int64_t warm = INT64_MAX;
+        for ( int i=0; i!=runs && ok; ++i ) {
+            warm = min(warm, startUsec(cache, fn, access, ok));
+        }
+        if ( !ok ) {
+            tout << fn << "\tfailed\n";
+            continue;
+        }
+        tout << fn << "\t" << cold << "\t" << warm << "\t" << (double(cold) / double(max(warm,int64_t(1)))) << "\n";
+    }
+    auto & stats = cache.getStats();
+    tout << "hits " << stats.hits << ", misses " << stats.misses
+        << ", cold " << stats.coldUsec << " usec, warm " << stats.warmUsec << " usec\n";
+    cache.clear();
+    Module::Shutdown();
+    return 0;
+}
@@ -0,0 +1,130 @@
+#include "daScript/daScript.h"
+#include "daScript/misc/performance_time.h"
+
+using namespace das;
+
+// daslib/regex throughput, with the native lazy DFA matcher (regex_native module)
+// log is a text of mixed lines, every test iterates all matches of a pattern over it
+// 'pathological' has no matches at all, and is exponential for the backtracking matcher
+
+TextPrinter tout;
+
+const char * regex_bench_text = R""""(
+options indenting = 4
+
+require daslib/regex
+require strings
+
+var g_text : string
+
+[export]
+def make_text ( count : int ) : int
+    g_text = build_string() <| $ ( var writer )
+        for i in range(count)
+            if i % 3 == 0
+                write(writer, "2024-01-{i % 28 + 1} user{i}@example.com logged in from 10.0.{i % 256}.{i * 7 % 256}\n")
+            elif i % 3 == 1
+                write(writer, "#define VALUE_{i} ({i * 13})   // some value\n")
+            else
+                write(writer, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa {i}\n")
+    return length(g_text)
+
+def count_matches ( pattern : string ) : int
+    var re <- regex_compile(pattern)
+    var total = 0
+    regex_foreach(re, g_text) <| $ ( at )
+        total ++
+        return true
+    return total
+
+[export]
+def email : int
+    return count_matches("[a-z0-9]+@[a-z]+\\.com")
+
+[export]
+def define_groups : int
+    var re <- regex_compile("#define\\s+(\\w+)\\s+\\((\\d+)\\)")
+    var total = 0
+    regex_foreach(re, g_text) <| $ ( at )
+        total += re.groups[2]._0.y - re.groups[2]._0.x      // regex_group would slice, which is strlen of the whole text
+        return true
+    return total
+
+[export]
+def literal : int
+    return count_matches("logged in")
+
+[export]
+def ip_address : int
+    return count_matches("\\d+\\.\\d+\\.\\d+\\.\\d+")
+
+[export]
+def pathological : int
+    return count_matches("(a*)*b")
+)"""";
+
+smart_ptr<Program> compileBench ( const char * name, const string & text ) {
+    auto fAccess = make_smart<FsFileAccess>();
+    auto fileInfo = make_unique<TextFileInfo>(text.c_str(), uint32_t(text.length()), false);
+    fAccess->setFileInfo(name, move(fileInfo));
+    ModuleGroup dummyLibGroup;
+    auto program = compileDaScript(name, fAccess, tout, dummyLibGroup);
+    if ( program->failed() ) {
+        for ( auto & err : program->errors ) {
+            tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr);
+        }
+        return nullptr;
+    }
+    return program;
+}
+
+int32_t runTimed ( Context & ctx, const char * fnName, int64_t & usec ) {
+    auto fn = ctx.findFunction(fnName);
+    int32_t res = 0;
+    usec = INT64_MAX;
+    for ( int i=0; i!=5; ++i ) {
+        auto t0 = ref_time_ticks();
+        res = cast<int32_t>::to(ctx.evalWithCatch(fn, nullptr));
+        usec = das::min(usec, int64_t(get_time_usec(t0)));
+        if ( auto ex = ctx.getException() ) {
+            tout << fnName << ": " << ex << "\n";
+            return -1;
+        }
+    }
+    return res;
+}
+
+int main( int argc, char * argv[] ) {
+    NEED_ALL_DEFAULT_MODULES;
+    Module::Initialize();
+    int32_t count = argc>1 ? atoi(argv[1]) : 30000;
+    bool ok = false;
+    if ( auto program = compileBench("regex_bench.das", regex_bench_text) ) {
+        Context ctx(program->getContextStackSize());
+        if ( program->simulate(ctx, tout) ) {
+            vec4f args[1] = { cast<int32_t>::from(count) };
+            int32_t bytes = cast<int32_t>::to(ctx.evalWithCatch(ctx.findFunction("make_text"), args));
+            tout << count << " lines, " << bytes << " bytes of text\n";
+            tout << "test\tusec\tMB/s\tresult\n";
+            const char * tests[] = { "email", "define_groups", "literal", "ip_address", "pathological" };
+            int32_t results[5];
+            ok = true;
+            for ( int i=0; i!=5; ++i ) {
+                int64_t usec = 0;
+                results[i] = runTimed(ctx, tests[i], usec);
+                ok &= results[i]>=0;
+                tout << tests[i] << "\t" << usec << "\t" << int64_t(double(bytes) / double(das::max(usec,int64_t(1)))) << "\t" << results[i] << "\n";
+            }
+            // every third line matches email, literal and ip address, the rest has no 'b' at all
+            int32_t expected = (count + 2) / 3;
+            if ( results[0]!=expected || results[2]!=expected || results[3]!=expected || results[4]!=0 ) {
+                tout << "unexpected number of matches\n";
+                ok = false;
+            }
+        } else {
+            tout << "failed to simulate\n";
+        }
+    }
+    Module::Shutdown();
+    return ok ? 0 : 1;
+}
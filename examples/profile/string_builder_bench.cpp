@@ -0,0 +1,135 @@
+#include "daScript/daScript.h"
+#include "daScript/misc/performance_time.h"
+
+using namespace das;
+
+// string interpolation throughput. parts, which are all scalars, strings or vectors, are formatted directly
+// 'walker' variants have an extra fixed array part, which sends the whole interpolation to the DebugDataWalker
+
+TextPrinter tout;
+
+const char * string_builder_bench_text = R""""(
+options indenting = 4
+
+require strings
+
+var g_pad : int[1]
+
+[export]
+def ints ( count : int ) : int
+    var total = 0
+    for id in range(count)
+        let x = id * 3
+        let y = -id
+        total += length("{id}:{x},{y}")
+    return total
+
+[export]
+def ints_walker ( count : int ) : int
+    var total = 0
+    for id in range(count)
+        let x = id * 3
+        let y = -id
+        total += length("{g_pad}{id}:{x},{y}") - 6
+    return total
+
+[export]
+def floats ( count : int ) : int
+    var total = 0
+    for id in range(count)
+        let pos = float3(float(id) * 0.25, 1.5, -float(id))
+        let w = float(id) * 0.001
+        total += length("entity {id} at {pos} weight {w}")
+    return total
+
+[export]
+def floats_walker ( count : int ) : int
+    var total = 0
+    for id in range(count)
+        let pos = float3(float(id) * 0.25, 1.5, -float(id))
+        let w = float(id) * 0.001
+        total += length("{g_pad}entity {id} at {pos} weight {w}") - 6
+    return total
+
+[export]
+def strings ( count : int ) : int
+    var total = 0
+    let name = "player"
+    for id in range(count)
+        let ok = (id & 1) == 0
+        total += length("{name}[{id}] = {ok}")
+    return total
+
+[export]
+def strings_walker ( count : int ) : int
+    var total = 0
+    let name = "player"
+    for id in range(count)
+        let ok = (id & 1) == 0
+        total += length("{g_pad}{name}[{id}] = {ok}") - 6
+    return total
+)"""";
+
+smart_ptr<Program> compileBench ( const char * name, const string & text ) {
+    auto fAccess = make_smart<FsFileAccess>();
+    auto fileInfo = make_unique<TextFileInfo>(text.c_str(), uint32_t(text.length()), false);
+    fAccess->setFileInfo(name, move(fileInfo));
+    ModuleGroup dummyLibGroup;
+    auto program = compileDaScript(name, fAccess, tout, dummyLibGroup);
+    if ( program->failed() ) {
+        for ( auto & err : program->errors ) {
+            tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr);
+        }
+        return nullptr;
+    }
+    return program;
+}
+
+int32_t runTimed ( Context & ctx, const char * fnName, int32_t count, int64_t & usec ) {
+    auto fn = ctx.findFunction(fnName);
+    vec4f args[1] = { cast<int32_t>::from(count) };
+    int32_t res = 0;
+    usec = INT64_MAX;
+    for ( int i=0; i!=5; ++i ) {
+        ctx.restart();
+        ctx.restartHeaps();
+        auto t0 = ref_time_ticks();
+        res = cast<int32_t>::to(ctx.evalWithCatch(fn, args));
+        usec = das::min(usec, int64_t(get_time_usec(t0)));
+        if ( auto ex = ctx.getException() ) {
+            tout << fnName << ": " << ex << "\n";
+            return -1;
+        }
+    }
+    return res;
+}
+
+int main( int argc, char * argv[] ) {
+    NEED_ALL_DEFAULT_MODULES;
+    Module::Initialize();
+    int32_t count = argc>1 ? atoi(argv[1]) : 1000000;
+    bool ok = false;
+    if ( auto program = compileBench("string_builder_bench.das", string_builder_bench_text) ) {
+        Context ctx(program->getContextStackSize());
+        if ( program->simulate(ctx, tout) ) {
+            tout << count << " strings\n";
+            tout << "test\tusec\twalker usec\tcharacters\n";
+            const char * tests[] = { "ints", "floats", "strings" };
+            ok = true;
+            for ( auto test : tests ) {
+                int64_t usec = 0, walkerUsec = 0;
+                int32_t res = runTimed(ctx, test, count, usec);
+                int32_t walkerRes = runTimed(ctx, (string(test) + "_walker").c_str(), count, walkerUsec);
+                tout << test << "\t" << usec << "\t" << walkerUsec << "\t" << res << "\n";
+                if ( res<0 || res!=walkerRes ) {
+                    tout << test << ": walker produced different output\n";
+                    ok = false;
+                }
+            }
+        } else {
+            tout << "failed to simulate\n";
+        }
+    }
+    Module::Shutdown();
+    return ok ? 0 : 1;
+}
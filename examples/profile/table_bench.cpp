@@ -0,0 +1,92 @@
+#include "daScript/daScript.h"
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/runtime_table.h"
+
+using namespace das;
+
+// table<uint64;int> with linear probing vs swiss layout, nanoseconds per operation
+// table is first grown to the requested capacity, then filled to the requested load factor
+
+TextPrinter tout;
+
+struct BenchResult {
+    double  load = 0.;
+    double  insert = 0.;
+    double  hit = 0.;
+    double  miss = 0.;
+    double  erase = 0.;
+};
+
+__forceinline uint64_t splitmix64 ( uint64_t & state ) {
+    uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+double nsPerOp ( int64_t t0, uint32_t count ) {
+    return double(get_time_usec(t0)) * 1000.0 / double(max(count,1u));
+}
+
+BenchResult bench ( bool swiss, uint32_t capacity, double loadFactor ) {
+    Context ctx(0);
+    ctx.heap = make_smart<PersistentHeapAllocator>();
+    ctx.stringHeap = make_smart<PersistentStringAllocator>();
+    ctx.swissTables = swiss;
+    TableHash<uint64_t> thh(&ctx, sizeof(int32_t));
+    Table tab;
+    memset(&tab, 0, sizeof(Table));
+    uint64_t seed = 12345;
+    while ( tab.capacity < capacity ) {
+        uint64_t key = splitmix64(seed);
+        thh.reserve(tab, key, hash_function(ctx, key));
+    }
+    table_clear(ctx, tab);
+    uint32_t count = uint32_t(double(tab.capacity) * loadFactor);
+    vector<uint64_t> keys(count), missing(count);
+    for ( auto & k : keys ) k = splitmix64(seed);
+    for ( auto & k : missing ) k = splitmix64(seed);
+    BenchResult res;
+    auto t0 = ref_time_ticks();
+    for ( auto k : keys ) {
+        int index = thh.reserve(tab, k, hash_function(ctx, k));
+        ((int32_t *)tab.data)[index] = int32_t(k);
+    }
+    res.insert = nsPerOp(t0, count);
+    res.load = double(tab.size) / double(tab.capacity);
+    int64_t sum = 0;
+    t0 = ref_time_ticks();
+    for ( auto k : keys ) {
+        sum += thh.find(tab, k, hash_function(ctx, k));
+    }
+    res.hit = nsPerOp(t0, count);
+    t0 = ref_time_ticks();
+    for ( auto k : missing ) {
+        sum += thh.find(tab, k, hash_function(ctx, k));
+    }
+    res.miss = nsPerOp(t0, count);
+    t0 = ref_time_ticks();
+    for ( auto k : keys ) {
+        sum += thh.erase(tab, k, hash_function(ctx, k));
+    }
+    res.erase = nsPerOp(t0, count);
+    DAS_ASSERT(tab.size==0);
+    if ( sum==0x7fffffffffffffffll ) tout << "";   // keep lookups alive
+    return res;
+}
+
+int main( int argc, char * argv[] ) {
+    uint32_t maxCapacity = 1<<20;
+    if ( argc==2 ) maxCapacity = uint32_t(max(16, atoi(argv[1])));
+    tout << "capacity\trequested load\tlayout\tload\tinsert ns\thit ns\tmiss ns\terase ns\n";
+    for ( uint32_t capacity = 1<<12; capacity <= maxCapacity; capacity *= 16 ) {
+        for ( double loadFactor : { 0.25, 0.5, 0.75, 0.85 } ) {
+            for ( bool swiss : { false, true } ) {
+                auto res = bench(swiss, capacity, loadFactor);
+                tout << capacity << "\t" << loadFactor << "\t" << (swiss ? "swiss" : "linear") << "\t"
+                    << res.load << "\t" << res.insert << "\t" << res.hit << "\t" << res.miss << "\t" << res.erase << "\n";
+            }
+        }
+    }
+    return 0;
+}
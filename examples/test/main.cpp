@@ -339,6 +339,8 @@ int main( int argc, char * argv[] ) {
     NEED_MODULE(Module_Ast);
     NEED_MODULE(Module_Debugger);
     NEED_MODULE(Module_Network);
+    NEED_MODULE(Module_JsonNative);
+    NEED_MODULE(Module_RegexNative);
     NEED_MODULE(Module_UriParser);
     NEED_MODULE(Module_JobQue);
     NEED_MODULE(Module_FIO);
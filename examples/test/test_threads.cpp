@@ -118,6 +118,8 @@ void test_thread(bool useAot) {
     NEED_MODULE(Module_Ast);
     NEED_MODULE(Module_Debugger);
     NEED_MODULE(Module_Network);
+    NEED_MODULE(Module_JsonNative);
+    NEED_MODULE(Module_RegexNative);
     NEED_MODULE(Module_UriParser);
     NEED_MODULE(Module_JobQue);
     NEED_MODULE(Module_FIO);
@@ -0,0 +1,105 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_60210786557159849 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline float3 add_189b7dcb9ec6bbe7 ( Context * __context__, float3 const  & __a_rename_at_3, float3 const  & __b_rename_at_3 );
+inline float3 test_add_d11d8937709b8726 ( Context * __context__, float3x4 const  & __m_rename_at_6 );
+inline bool test_ee16e3d9f2f22b9f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline float3 add_189b7dcb9ec6bbe7 ( Context * __context__, float3 const  & __a_rename_at_3, float3 const  & __b_rename_at_3 )
+{
+	return das_auto_cast<float3>::cast(SimPolicy<float3>::Add(__a_rename_at_3,__b_rename_at_3,*__context__,nullptr));
+}
+
+inline float3 test_add_d11d8937709b8726 ( Context * __context__, float3x4 const  &  __m_rename_at_6 )
+{
+	return das_auto_cast<float3>::cast(add_189b7dcb9ec6bbe7(__context__,das_index<float3x4 const >::at(__m_rename_at_6,3,__context__),das_index<float3x4 const >::at(__m_rename_at_6,3,__context__)));
+}
+
+inline bool test_ee16e3d9f2f22b9f ( Context * __context__ )
+{
+	float3x4 __m_rename_at_11_ConstRef; das_zero(__m_rename_at_11_ConstRef);
+	float3x4 const  & __m_rename_at_11 = __m_rename_at_11_ConstRef; ;
+	DAS_ASSERT((SimPolicy<float3>::Equ(test_add_d11d8937709b8726(__context__,__m_rename_at_11),v_zero(),*__context__,nullptr)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// add_189b7dcb9ec6bbe7
+	aotLib[0x294762c8704e3815] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, float3 const  & , float3 const  &  ),&add_189b7dcb9ec6bbe7>>();
+	};
+	// test_add_d11d8937709b8726
+	aotLib[0x2bef6fb1701c714] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, float3x4 const  &  ),&test_add_d11d8937709b8726>>();
+	};
+	// test_ee16e3d9f2f22b9f
+	aotLib[0xe58c636d10c27d5a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_ee16e3d9f2f22b9f>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,121 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1835575959121076713 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+	int32_t a;
+	int32_t b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+
+inline das::string * _Func_0x60_get_ecs_string_f33337ba155581eb ( Context * __context__, Foo const  & __obj_rename_at_8, char * const  __name_rename_at_8 );
+inline char * const  _Func_0x60_get_string_3001d637c87c41d4 ( Context * __context__, Foo const  & __obj_rename_at_11, char * const  __name_rename_at_11, char * const  __defaultValue_rename_at_11 );
+inline bool test_16e2bdea13acada3 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<das::string *,0xad0dfdecc6afe8cc>(__context__);/*ds*/
+}
+
+inline das::string * _Func_0x60_get_ecs_string_f33337ba155581eb ( Context * __context__, Foo const  &  __obj_rename_at_8, char * const  __name_rename_at_8 )
+{
+	return das_auto_cast<das::string *>::cast(das_global<das::string *,0xad0dfdecc6afe8cc>(__context__) /*ds*/);
+}
+
+inline char * const  _Func_0x60_get_string_3001d637c87c41d4 ( Context * __context__, Foo const  &  __obj_rename_at_11, char * const  __name_rename_at_11, char * const  __defaultValue_rename_at_11 )
+{
+	das::string * __str_rename_at_12 = ((das::string *)_Func_0x60_get_ecs_string_f33337ba155581eb(__context__,__obj_rename_at_11,__name_rename_at_11));
+	return das_auto_cast<char * const >::cast((__str_rename_at_12 != nullptr) ? das_auto_cast<char * const >::cast(((char *)(to_das_string(das_deref(__context__,__str_rename_at_12),__context__)))) : das_auto_cast<char * const >::cast(__defaultValue_rename_at_11));
+}
+
+inline bool test_16e2bdea13acada3 ( Context * __context__ )
+{
+	Foo __abilityObj_rename_at_17_ConstRef; das_zero(__abilityObj_rename_at_17_ConstRef);
+	Foo const  & __abilityObj_rename_at_17 = __abilityObj_rename_at_17_ConstRef; ;
+	char * __name_rename_at_18 = (char *)(_Func_0x60_get_string_3001d637c87c41d4(__context__,__abilityObj_rename_at_17,((char *) "name"),nullptr));
+	das_copy(__name_rename_at_18,_Func_0x60_get_string_3001d637c87c41d4(__context__,__abilityObj_rename_at_17,((char *) "name"),nullptr));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_get_ecs_string_f33337ba155581eb
+	aotLib[0x9aaae81a6ec7f25d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<das::string * (*) ( Context * __context__, Foo const  & , char * const   ),&_Func_0x60_get_ecs_string_f33337ba155581eb>>();
+	};
+	// _Func_0x60_get_string_3001d637c87c41d4
+	aotLib[0xe275cb6b11750a32] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, Foo const  & , char * const  , char * const   ),&_Func_0x60_get_string_3001d637c87c41d4>>();
+	};
+	// test_16e2bdea13acada3
+	aotLib[0xa0d7d62960f28aa1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_16e2bdea13acada3>>();
+	};
+	// [[ init script ]]
+	aotLib[0xeaee62e11a29cdc9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
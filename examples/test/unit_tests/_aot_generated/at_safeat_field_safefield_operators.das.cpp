@@ -0,0 +1,154 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15301569592797542623 {
+
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_1[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+	char * a;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+}
+
+inline char * _FuncSqblSqbr_33e95ce3e7cb5aad ( Context * __context__, Foo const  & __t_rename_at_4, char * const  __cmp_rename_at_4 );
+inline char * const  * _FuncQmarkSqblSqbr_e55bcf5724d5c94e ( Context * __context__, Foo const  & __t_rename_at_7, char * const  __cmp_rename_at_7 );
+inline Foo _FuncDot_d971800005268ba0 ( Context * __context__, Foo const  & __t_rename_at_15, char * const  __name_rename_at_15 );
+inline char * const  * _FuncQmarkDot_7a99972995d6725 ( Context * __context__, Foo const  & __t_rename_at_18, char * const  __name_rename_at_18 );
+inline bool test_3a178dc2c3c5718b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline char * _FuncSqblSqbr_33e95ce3e7cb5aad ( Context * __context__, Foo const  &  __t_rename_at_4, char * const  __cmp_rename_at_4 )
+{
+	return das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(__t_rename_at_4.a), cast<char * const >::from(((char *) "-")), cast<char * const >::from(__cmp_rename_at_4))));
+}
+
+inline char * const  * _FuncQmarkSqblSqbr_e55bcf5724d5c94e ( Context * __context__, Foo const  &  __t_rename_at_7, char * const  __cmp_rename_at_7 )
+{
+	return das_auto_cast<char * const  *>::cast((SimPolicy<char *>::Equ(cast<char *>::from(__cmp_rename_at_7),cast<char *>::from(__t_rename_at_7.a),*__context__,nullptr)) ? das_auto_cast<char * const  *>::cast(das_cast<char * const  *>::cast(das_ref(__context__,__t_rename_at_7.a))) : das_auto_cast<char * const  *>::cast(das_cast<char * const  *>::cast(nullptr)));
+}
+
+inline Foo _FuncDot_d971800005268ba0 ( Context * __context__, Foo const  &  __t_rename_at_15, char * const  __name_rename_at_15 )
+{
+	return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+		Foo __mks_16;
+		das_copy((__mks_16.a),(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(__t_rename_at_15.a), cast<char * const >::from(((char *) ".")), cast<char * const >::from(__name_rename_at_15)))));
+		return __mks_16;
+	})()));
+}
+
+inline char * const  * _FuncQmarkDot_7a99972995d6725 ( Context * __context__, Foo const  &  __t_rename_at_18, char * const  __name_rename_at_18 )
+{
+	return das_auto_cast<char * const  *>::cast((SimPolicy<char *>::Equ(cast<char *>::from(__name_rename_at_18),cast<char *>::from(((char *) "yes")),*__context__,nullptr)) ? das_auto_cast<char * const  *>::cast(das_cast<char * const  *>::cast(das_ref(__context__,__t_rename_at_18.a))) : das_auto_cast<char * const  *>::cast(das_cast<char * const  *>::cast(nullptr)));
+}
+
+inline bool test_3a178dc2c3c5718b ( Context * __context__ )
+{
+	Foo __t_rename_at_27 = (([&]() -> Foo {
+		Foo __mks_27;
+		das_copy((__mks_27.a),(((char *) "hello")));
+		return __mks_27;
+	})());
+	char * __z_rename_at_28 = (char *)(_FuncSqblSqbr_33e95ce3e7cb5aad(__context__,das_arg<Foo>::pass(__t_rename_at_27),((char *) "blah")));
+	char * __w_rename_at_29 = (char *)(das_null_coalescing<char * const >::get(_FuncQmarkSqblSqbr_e55bcf5724d5c94e(__context__,das_arg<Foo>::pass(__t_rename_at_27),((char *) "blah")),((char *) "not_blah")));
+	char * __W_rename_at_30 = (char *)(das_null_coalescing<char * const >::get(_FuncQmarkSqblSqbr_e55bcf5724d5c94e(__context__,das_arg<Foo>::pass(__t_rename_at_27),((char *) "hello")),((char *) "this???")));
+	Foo __EZ_rename_at_31 = _FuncDot_d971800005268ba0(__context__,das_arg<Foo>::pass(__t_rename_at_27),((char *) "fooBar"));
+	char * __HARD_YES_rename_at_32 = (char *)(das_null_coalescing<char * const >::get(_FuncQmarkDot_7a99972995d6725(__context__,das_arg<Foo>::pass(__t_rename_at_27),((char *) "yes")),((char *) "how??")));
+	char * __HARD_NO_rename_at_33 = (char *)(das_null_coalescing<char * const >::get(_FuncQmarkDot_7a99972995d6725(__context__,das_arg<Foo>::pass(__t_rename_at_27),((char *) "no")),((char *) "hard no")));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__z_rename_at_28),cast<char *>::from(((char *) "hello-blah")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__w_rename_at_29),cast<char *>::from(((char *) "not_blah")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__W_rename_at_30),cast<char *>::from(((char *) "hello")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__EZ_rename_at_31.a),cast<char *>::from(((char *) "hello.fooBar")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__HARD_YES_rename_at_32),cast<char *>::from(((char *) "hello")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__HARD_NO_rename_at_33),cast<char *>::from(((char *) "hard no")),*__context__,nullptr)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _FuncSqblSqbr_33e95ce3e7cb5aad
+	aotLib[0x3b6e3d726ec3bb7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, Foo const  & , char * const   ),&_FuncSqblSqbr_33e95ce3e7cb5aad>>();
+	};
+	// _FuncQmarkSqblSqbr_e55bcf5724d5c94e
+	aotLib[0x7b471bcd0c6e1fe9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  * (*) ( Context * __context__, Foo const  & , char * const   ),&_FuncQmarkSqblSqbr_e55bcf5724d5c94e>>();
+	};
+	// _FuncDot_d971800005268ba0
+	aotLib[0x510cff670918e11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, Foo const  & , char * const   ),&_FuncDot_d971800005268ba0>>();
+	};
+	// _FuncQmarkDot_7a99972995d6725
+	aotLib[0x6fc17e4f90031d1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  * (*) ( Context * __context__, Foo const  & , char * const   ),&_FuncQmarkDot_7a99972995d6725>>();
+	};
+	// test_3a178dc2c3c5718b
+	aotLib[0xc7e22f6fd43bdf10] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3a178dc2c3c5718b>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
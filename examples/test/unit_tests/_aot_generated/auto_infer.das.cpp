@@ -0,0 +1,237 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7641098856812697268 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__90f4c07b5a6e390;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern VarInfo __var_info__b62699da566cea22;
+extern VarInfo __var_info__6a1308e1dd52885f;
+extern VarInfo __var_info__fd9a3e4981c56f41;
+extern VarInfo __var_info__bea9792450dc1f0c;
+extern VarInfo __var_info__5e5e3764bced9619;
+extern FuncInfo __func_info__da378525f760494f;
+extern FuncInfo __func_info__e0851e87016e97e7;
+extern FuncInfo __func_info__1d20175e3444f980;
+
+VarInfo __func_info__da378525f760494f_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xfd9a3e4981c56f41), "arg", 0 };
+VarInfo * __func_info__da378525f760494f_fields[1] =  { &__func_info__da378525f760494f_field_0 };
+FuncInfo __func_info__da378525f760494f = {"invoke block<(arg:int const):int> const", "", __func_info__da378525f760494f_fields, 1, 32, &__type_info__af63e44c8601fa24, nullptr,0,UINT64_C(0xda378525f760494f), 0x0 };
+VarInfo __func_info__e0851e87016e97e7_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x5e5e3764bced9619), "ia", 0 };
+VarInfo __func_info__e0851e87016e97e7_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xb62699da566cea22), "fb", 0 };
+VarInfo * __func_info__e0851e87016e97e7_fields[2] =  { &__func_info__e0851e87016e97e7_field_0, &__func_info__e0851e87016e97e7_field_1 };
+FuncInfo __func_info__e0851e87016e97e7 = {"invoke block<(ia:int const;fb:float const):string const> const", "", __func_info__e0851e87016e97e7_fields, 2, 32, &__type_info__90f3d07b5a6ca13, nullptr,0,UINT64_C(0xe0851e87016e97e7), 0x0 };
+VarInfo __func_info__1d20175e3444f980_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x6a1308e1dd52885f), "XX", 0 };
+VarInfo __func_info__1d20175e3444f980_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xbea9792450dc1f0c), "YY", 0 };
+VarInfo * __func_info__1d20175e3444f980_fields[2] =  { &__func_info__1d20175e3444f980_field_0, &__func_info__1d20175e3444f980_field_1 };
+FuncInfo __func_info__1d20175e3444f980 = {"invoke block<(XX:int const explicit;YY:float const):bool const> const", "", __func_info__1d20175e3444f980_fields, 2, 32, &__type_info__90f4c07b5a6e390, nullptr,0,UINT64_C(0x1d20175e3444f980), 0x0 };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__90f4c07b5a6e390 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0x90f4c07b5a6e390) };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+	int32_t bar;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,bar)==0,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline int32_t _Func_0x60_take_arr_797272c2481c4871 ( Context * __context__, TDim<int32_t,4> const  & __a_rename_at_29 );
+inline void _Func_0x60_qq_c7738ec645949e02 ( Context * __context__, int32_t __a_rename_at_51, Block DAS_COMMENT((bool,int32_t,float)) const  & __b_rename_at_51, float __c_rename_at_51 );
+inline int32_t foo_5c792fbfce7236c4 ( Context * __context__, Block DAS_COMMENT((int32_t,int32_t)) const  & __b_rename_at_20 );
+inline char * foobar_c13a61f2b83e9320 ( Context * __context__, Block DAS_COMMENT((char *,int32_t,float)) const  & __b_rename_at_23 );
+inline bool test_7afe94c51e84e2b5 ( Context * __context__ );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_ef283e7163129fb4 ( Context * __context__, TDim<char *,1> & __a_rename_at_518 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	TDim<char *,1> _temp_make_local_18_32;
+	das_global<TArray<char *>,0x3b32a8bcc63fd3b0>(__context__) = _Funcbuiltin_0x60_to_array_move_ef283e7163129fb4(__context__,das_arg<TDim<char *,1>>::pass((([&]() -> TDim<char *,1>& {
+		_temp_make_local_18_32(0,__context__) = ((char *) "test");
+		return _temp_make_local_18_32;
+	})())));/*some_b*/
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,8,__context__);
+}
+
+inline int32_t _Func_0x60_take_arr_797272c2481c4871 ( Context * __context__, TDim<int32_t,4> const  &  __a_rename_at_29 )
+{
+	int32_t __summ_rename_at_30 = 0;
+	{
+		bool __need_loop_31 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,4> const > __x_iterator(__a_rename_at_29);
+		int32_t const  * __x_rename_at_31;
+		__need_loop_31 = __x_iterator.first(__context__,(__x_rename_at_31)) && __need_loop_31;
+		for ( ; __need_loop_31 ; __need_loop_31 = __x_iterator.next(__context__,(__x_rename_at_31)) )
+		{
+			__summ_rename_at_30 += (*__x_rename_at_31);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_31));
+	};
+	return das_auto_cast<int32_t>::cast(__summ_rename_at_30);
+}
+
+inline void _Func_0x60_qq_c7738ec645949e02 ( Context * __context__, int32_t __a_rename_at_51, Block DAS_COMMENT((bool,int32_t,float)) const  &  __b_rename_at_51, float __c_rename_at_51 )
+{
+}
+
+inline int32_t foo_5c792fbfce7236c4 ( Context * __context__, Block DAS_COMMENT((int32_t,int32_t)) const  &  __b_rename_at_20 )
+{
+	return das_auto_cast<int32_t>::cast(das_invoke<int32_t>::invoke<int32_t>(__context__,nullptr,__b_rename_at_20,3));
+}
+
+inline char * foobar_c13a61f2b83e9320 ( Context * __context__, Block DAS_COMMENT((char *,int32_t,float)) const  &  __b_rename_at_23 )
+{
+	return das_auto_cast<char *>::cast(cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(das_invoke<char *>::invoke<int32_t,float>(__context__,nullptr,__b_rename_at_23,1,2.f)),cast<char *>::from(((char *) "bar")),*__context__,nullptr)));
+}
+
+inline bool test_7afe94c51e84e2b5 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,464,"test " DAS_FILE_LINE);
+{
+	TDim<int32_t,4> _temp_make_local_63_32;
+	DAS_ASSERT((builtin_array_size(das_global<TArray<char *>,0x3b32a8bcc63fd3b0>(__context__) /*some_b*/) == 1));
+	DAS_VERIFY((_Func_0x60_take_arr_797272c2481c4871(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_63_32(0,__context__) = 1;
+		_temp_make_local_63_32(1,__context__) = 2;
+		_temp_make_local_63_32(2,__context__) = 3;
+		_temp_make_local_63_32(3,__context__) = 4;
+		return _temp_make_local_63_32;
+	})()))) == 10));
+	Foo * __pFoo_rename_at_67 = das_new<Foo>::make(__context__);
+	Foo * __pFooI_rename_at_68 = __pFoo_rename_at_67;
+	das_copy(__pFooI_rename_at_68->bar,1);
+	das_copy(__pFoo_rename_at_67,__pFooI_rename_at_68);
+	DAS_ASSERT((__pFoo_rename_at_67->bar == 1));
+	int32_t __f1_rename_at_81 = ((int32_t)foo_5c792fbfce7236c4(__context__,das_make_block<int32_t,int32_t>(__context__,144,0,&__func_info__da378525f760494f,[&](int32_t const  __arg_rename_at_81)->int32_t{
+		return das_auto_cast<int32_t>::cast(__arg_rename_at_81 + 1);
+	})));
+	DAS_ASSERT((__f1_rename_at_81 == 4));
+	int32_t __f2_rename_at_85 = ((int32_t)foo_5c792fbfce7236c4(__context__,das_make_block<int32_t,int32_t>(__context__,224,0,&__func_info__da378525f760494f,[&](int32_t const  __arg_rename_at_85)->int32_t{
+
+#if 0
+5
+#endif
+		return das_auto_cast<int32_t>::cast(__arg_rename_at_85 + 2);
+	})));
+	DAS_ASSERT((__f2_rename_at_85 == 5));
+	int32_t __f3_rename_at_89 = ((int32_t)foo_5c792fbfce7236c4(__context__,das_make_block<int32_t,int32_t>(__context__,304,0,&__func_info__da378525f760494f,[&](int32_t const  __arg_rename_at_89)->int32_t{
+		return das_auto_cast<int32_t>::cast(__arg_rename_at_89 + 3);
+	})));
+	DAS_ASSERT((__f3_rename_at_89 == 6));
+	char * __blah_rename_at_93 = ((char *)(char *)(foobar_c13a61f2b83e9320(__context__,das_make_block<char * const ,int32_t,float>(__context__,384,0,&__func_info__e0851e87016e97e7,[&](int32_t const  __ia_rename_at_93, float const  __fb_rename_at_93)->char * const {
+		DAS_ASSERT((__ia_rename_at_93 == 1));
+		DAS_ASSERT((__fb_rename_at_93 == 2.f));
+		return das_auto_cast<char * const >::cast(((char *) "foo"));
+	}))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__blah_rename_at_93),cast<char *>::from(((char *) "foobar")),*__context__,nullptr)));
+	_Func_0x60_qq_c7738ec645949e02(__context__,1,das_make_block<bool,int32_t,float>(__context__,448,0,&__func_info__1d20175e3444f980,[&](int32_t const  __XX_rename_at_113, float const  __YY_rename_at_113)->bool{
+		return das_auto_cast<bool>::cast(true);
+	}),2.f);
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_ef283e7163129fb4 ( Context * __context__, TDim<char *,1> &  __a_rename_at_518 )
+{
+	TArray<char *> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_519),1);
+	das_copy(das_cast<TDim<char *,1>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(__arr_rename_at_519);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+	aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+	// _Func_0x60_take_arr_797272c2481c4871
+	aotLib[0xe264d3dfad911d35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<int32_t,4> const  &  ),&_Func_0x60_take_arr_797272c2481c4871>>();
+	};
+	// _Func_0x60_qq_c7738ec645949e02
+	aotLib[0x352c54e88f5426b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Block DAS_COMMENT((bool,int32_t,float)) const  & , float  ),&_Func_0x60_qq_c7738ec645949e02>>();
+	};
+	// foo_5c792fbfce7236c4
+	aotLib[0x50e2917e52fdf1a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Block DAS_COMMENT((int32_t,int32_t)) const  &  ),&foo_5c792fbfce7236c4>>();
+	};
+	// foobar_c13a61f2b83e9320
+	aotLib[0xd1e3f366fad1b649] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, Block DAS_COMMENT((char *,int32_t,float)) const  &  ),&foobar_c13a61f2b83e9320>>();
+	};
+	// test_7afe94c51e84e2b5
+	aotLib[0xa3e3abc2c254a490] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_7afe94c51e84e2b5>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_ef283e7163129fb4
+	aotLib[0x54e24ab48a6e85d7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,1> &  ),&_Funcbuiltin_0x60_to_array_move_ef283e7163129fb4>>();
+	};
+	// [[ init script ]]
+	aotLib[0x401c4e27eee067dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
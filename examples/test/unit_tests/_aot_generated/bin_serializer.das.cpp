@@ -0,0 +1,308 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_6797513123779340410 {
+
+extern StructInfo __struct_info__145996241021482a;
+extern StructInfo __struct_info__f35ff723fded4627;
+extern TypeInfo __type_info__dfd82b908f3b1490;
+extern TypeInfo __type_info__fd978c5c1218516b;
+extern TypeInfo __type_info__8c48207b56753d8;
+extern TypeInfo __type_info__441f4faaa4ccc2bb;
+extern TypeInfo __type_info__ce34cf44aed6443;
+extern TypeInfo __type_info__cb4000b1a5c381a2;
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__a0ce90235c80549f;
+extern TypeInfo __type_info__29c577ce7b2acb3c;
+extern VarInfo __var_info__17a8e76dfda5fc4d;
+extern VarInfo __var_info__1e87671ff0e91f7;
+extern VarInfo __var_info__8bf04e77b9de08ad;
+extern VarInfo __var_info__82a8d2b484fdb182;
+extern VarInfo __var_info__b20d8b9ea8c03264;
+extern VarInfo __var_info__4ff0e20ca718c27c;
+extern VarInfo __var_info__d6aa9371e695ec1f;
+extern VarInfo __var_info__1e4f399e8f97099e;
+extern FuncInfo __func_info__d3b307c446b1e15e;
+
+VarInfo __struct_info__145996241021482a_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0x1e4f399e8f97099e), "t", 0 };
+VarInfo __struct_info__145996241021482a_field_1 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63db4c8601ead9, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x17a8e76dfda5fc4d), "ta", 8 };
+VarInfo * __struct_info__145996241021482a_fields[2] =  { &__struct_info__145996241021482a_field_0, &__struct_info__145996241021482a_field_1 };
+StructInfo __struct_info__145996241021482a = {"Bar", "", 28, __struct_info__145996241021482a_fields, 2, 32, UINT64_C(0x16415419b0f09f7a), nullptr, UINT64_C(0x145996241021482a) };
+VarInfo __struct_info__f35ff723fded4627_field_0 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x82a8d2b484fdb182), "data_bool", 0 };
+VarInfo __struct_info__f35ff723fded4627_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xd6aa9371e695ec1f), "data_int", 4 };
+VarInfo __struct_info__f35ff723fded4627_field_2 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xb20d8b9ea8c03264), "data_float", 8 };
+VarInfo __struct_info__f35ff723fded4627_field_3 =  { Type::tStructure, &__struct_info__145996241021482a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 32, UINT64_C(0x1e87671ff0e91f7), "data_bar", 16 };
+uint32_t __type_info__4ff0e20ca718c27c_dim_var_17537007207960102439[1] = { 3 };
+VarInfo __struct_info__f35ff723fded4627_field_4 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__4ff0e20ca718c27c_dim_var_17537007207960102439, 30, 12, UINT64_C(0x4ff0e20ca718c27c), "data_uint_3", 48 };
+VarInfo * __struct_info__f35ff723fded4627_fields[5] =  { &__struct_info__f35ff723fded4627_field_0, &__struct_info__f35ff723fded4627_field_1, &__struct_info__f35ff723fded4627_field_2, &__struct_info__f35ff723fded4627_field_3, &__struct_info__f35ff723fded4627_field_4 };
+StructInfo __struct_info__f35ff723fded4627 = {"Foo", "", 28, __struct_info__f35ff723fded4627_fields, 5, 64, UINT64_C(0xf2bb95199c92e1d7), nullptr, UINT64_C(0xf35ff723fded4627) };
+VarInfo __func_info__d3b307c446b1e15e_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 40994, 24, UINT64_C(0x8bf04e77b9de08ad), "data", 0 };
+VarInfo * __func_info__d3b307c446b1e15e_fields[1] =  { &__func_info__d3b307c446b1e15e_field_0 };
+FuncInfo __func_info__d3b307c446b1e15e = {"invoke block<(data:array<uint8> const):void> const", "", __func_info__d3b307c446b1e15e_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xd3b307c446b1e15e), 0x0 };
+TypeInfo __type_info__dfd82b908f3b1490 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 64, UINT64_C(0xdfd82b908f3b1490) };
+TypeInfo * __type_info__fd978c5c1218516b_arg_types[1] = { &__type_info__a0ce90235c80549f };
+TypeInfo __type_info__fd978c5c1218516b = { Type::tBlock, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fd978c5c1218516b_arg_types, nullptr, 1, 0, nullptr, 34, 40, UINT64_C(0xfd978c5c1218516b) };
+TypeInfo __type_info__8c48207b56753d8 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x8c48207b56753d8) };
+TypeInfo __type_info__441f4faaa4ccc2bb = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 64, UINT64_C(0x441f4faaa4ccc2bb) };
+TypeInfo __type_info__ce34cf44aed6443 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57378, 64, UINT64_C(0xce34cf44aed6443) };
+TypeInfo __type_info__cb4000b1a5c381a2 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63db4c8601ead9, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xcb4000b1a5c381a2) };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63db4c8601ead9) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__a0ce90235c80549f = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 40994, 24, UINT64_C(0xa0ce90235c80549f) };
+TypeInfo __type_info__29c577ce7b2acb3c = { Type::tStructure, &__struct_info__145996241021482a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 32, UINT64_C(0x29c577ce7b2acb3c) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__dfd82b908f3b1490, &__type_info__a0ce90235c80549f };
+TypeInfo * __tinfo_1[1] = { &__type_info__29c577ce7b2acb3c };
+TypeInfo * __tinfo_2[1] = { &__type_info__441f4faaa4ccc2bb };
+TypeInfo * __tinfo_3[1] = { &__type_info__cb4000b1a5c381a2 };
+TypeInfo * __tinfo_4[2] = { &__type_info__ce34cf44aed6443, &__type_info__fd978c5c1218516b };
+namespace  { struct Bar; };
+namespace  { struct Foo; };
+namespace  {
+
+struct Bar {
+	char * t;
+	TArray<float> ta;
+};
+static_assert(sizeof(Bar)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,t)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,ta)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo {
+	bool data_bool;
+	int32_t data_int;
+	float data_float;
+	Bar data_bar;
+	TDim<uint32_t,3> data_uint_3;
+};
+static_assert(sizeof(Foo)==64,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,data_bool)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_int)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_float)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_bar)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_uint_3)==48,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_binary_load_43040880b26c4465 ( Context * __context__, Foo & __obj_rename_at_313, TArray<uint8_t> const  & __data_rename_at_313 );
+inline Bar & _Funcbuiltin_0x60__return_with_lockcheck_e865d1b3c99e7037 ( Context * __context__, Bar & __a_rename_at_42 );
+inline Foo & _Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5 ( Context * __context__, Foo & __a_rename_at_42 );
+inline TArray<float> & _Funcbuiltin_0x60__return_with_lockcheck_a1f776f65548652d ( Context * __context__, TArray<float> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60_binary_save_df945637b1078ab2 ( Context * __context__, Foo const  & __obj_rename_at_309, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  & __subexpr_rename_at_309 );
+inline void _Funcbuiltin_0x60_push_e4aecc27f9e903c6 ( Context * __context__, TArray<float> & __Arr_rename_at_75, float __value_rename_at_75 );
+inline TArray<float> make_10_cf6fcb72ee5039fe ( Context * __context__ );
+inline bool test_4d9b4e81d1a58a7b ( Context * __context__ );
+inline Bar Bar_6be92789c83ed52f ( Context * __context__ );
+inline Foo Foo_cbabdebad82dc192 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_binary_load_43040880b26c4465 ( Context * __context__, Foo &  __obj_rename_at_313, TArray<uint8_t> const  &  __data_rename_at_313 )
+{
+	das_call_interop<void>::call(&_builtin_binary_load,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<Foo &>::from(__obj_rename_at_313),cast<TArray<uint8_t> const  &>::from(__data_rename_at_313)));
+}
+
+inline Bar & _Funcbuiltin_0x60__return_with_lockcheck_e865d1b3c99e7037 ( Context * __context__, Bar &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<Bar &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<Bar &>::cast(__a_rename_at_42);
+}
+
+inline Foo & _Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5 ( Context * __context__, Foo &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<Foo &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<Foo &>::cast(__a_rename_at_42);
+}
+
+inline TArray<float> & _Funcbuiltin_0x60__return_with_lockcheck_a1f776f65548652d ( Context * __context__, TArray<float> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_3,cast<TArray<float> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<float> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60_binary_save_df945637b1078ab2 ( Context * __context__, Foo const  &  __obj_rename_at_309, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  __subexpr_rename_at_309 )
+{
+	das_call_interop<void>::call(&_builtin_binary_save,__context__,SimNode_AotInterop<2>(__tinfo_4,cast<Foo const  &>::from(__obj_rename_at_309),cast<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &>::from(__subexpr_rename_at_309)));
+}
+
+inline void _Funcbuiltin_0x60_push_e4aecc27f9e903c6 ( Context * __context__, TArray<float> &  __Arr_rename_at_75, float __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<float>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline TArray<float> make_10_cf6fcb72ee5039fe ( Context * __context__ )
+{
+	TArray<float> __a_rename_at_4; das_zero(__a_rename_at_4);
+	{
+		bool __need_loop_5 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_5;
+		__need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5)) && __need_loop_5;
+		for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5)) )
+		{
+			_Funcbuiltin_0x60_push_e4aecc27f9e903c6(__context__,das_arg<TArray<float>>::pass(__a_rename_at_4),float(__i_rename_at_5));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_5));
+	};
+	return /* <- */ das_auto_cast_move<TArray<float>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_a1f776f65548652d(__context__,das_arg<TArray<float>>::pass(__a_rename_at_4)));
+}
+
+inline bool test_4d9b4e81d1a58a7b ( Context * __context__ ) { das_stack_prologue __prologue(__context__,240,"test " DAS_FILE_LINE);
+{
+	Foo __f0_rename_at_22_ConstRef; das_zero(__f0_rename_at_22_ConstRef); das_move(__f0_rename_at_22_ConstRef, ((Foo)Foo_cbabdebad82dc192(__context__)));
+	Foo const  & __f0_rename_at_22 = __f0_rename_at_22_ConstRef; ;
+	Foo __f1_rename_at_23; das_zero(__f1_rename_at_23);
+	_Funcbuiltin_0x60_binary_save_df945637b1078ab2(__context__,__f0_rename_at_22,das_make_block<void,TArray<uint8_t> const  &>(__context__,208,0,&__func_info__d3b307c446b1e15e,[&](TArray<uint8_t> const  & __data_rename_at_24)->void{
+		_Funcbuiltin_0x60_binary_load_43040880b26c4465(__context__,das_arg<Foo>::pass(__f1_rename_at_23),__data_rename_at_24);
+		DAS_ASSERT((__f1_rename_at_23.data_bool == true));
+		DAS_ASSERT((__f1_rename_at_23.data_int == 1));
+		DAS_ASSERT((__f1_rename_at_23.data_float == 3.1400001f));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__f1_rename_at_23.data_bar.t),cast<char *>::from(((char *) "blah")),*__context__,nullptr)));
+		DAS_ASSERT((((__f1_rename_at_23.data_uint_3(0,__context__) == 0x1u) && (__f1_rename_at_23.data_uint_3(1,__context__) == 0x2u)) && (__f1_rename_at_23.data_uint_3(2,__context__) == 0x3u)));
+		{
+			bool __need_loop_31 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,10));
+			int32_t __i_rename_at_31;
+			__need_loop_31 = __i_iterator.first(__context__,(__i_rename_at_31)) && __need_loop_31;
+			for ( ; __need_loop_31 ; __need_loop_31 = __i_iterator.next(__context__,(__i_rename_at_31)) )
+			{
+				DAS_ASSERT((__f1_rename_at_23.data_bar.ta(__i_rename_at_31,__context__) == float(__i_rename_at_31)));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_31));
+		};
+	}));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline Bar Bar_6be92789c83ed52f ( Context * __context__ )
+{
+	Bar _temp_make_local_9_32;
+	return /* <- */ das_auto_cast_move<Bar>::cast(_Funcbuiltin_0x60__return_with_lockcheck_e865d1b3c99e7037(__context__,das_arg<Bar>::pass((([&]() -> Bar& {
+		das_copy((_temp_make_local_9_32.t),(((char *) "blah")));
+		das_move((_temp_make_local_9_32.ta),(make_10_cf6fcb72ee5039fe(__context__)));
+		return _temp_make_local_9_32;
+	})()))));
+}
+
+inline Foo Foo_cbabdebad82dc192 ( Context * __context__ )
+{
+	Foo _temp_make_local_13_32;
+	return /* <- */ das_auto_cast_move<Foo>::cast(_Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5(__context__,das_arg<Foo>::pass((([&]() -> Foo& {
+		das_copy((_temp_make_local_13_32.data_bool),(true));
+		das_copy((_temp_make_local_13_32.data_int),(1));
+		das_copy((_temp_make_local_13_32.data_float),(3.1400001f));
+		das_move((_temp_make_local_13_32.data_bar),(Bar_6be92789c83ed52f(__context__)));
+		das_copy((_temp_make_local_13_32.data_uint_3),((([&]() -> TDim<uint32_t,3> {
+			TDim<uint32_t,3> __mka_18;
+			__mka_18(0,__context__) = 0x1u;
+			__mka_18(1,__context__) = 0x2u;
+			__mka_18(2,__context__) = 0x3u;
+			return __mka_18;
+		})())));
+		return _temp_make_local_13_32;
+	})()))));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_binary_load_43040880b26c4465
+	aotLib[0x6bdd023c49b23d11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , TArray<uint8_t> const  &  ),&_Funcbuiltin_0x60_binary_load_43040880b26c4465>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_e865d1b3c99e7037
+	aotLib[0x1e9e47642c679125] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Bar & (*) ( Context * __context__, Bar &  ),&_Funcbuiltin_0x60__return_with_lockcheck_e865d1b3c99e7037>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5
+	aotLib[0xb06e2106c303ef51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Foo & (*) ( Context * __context__, Foo &  ),&_Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_a1f776f65548652d
+	aotLib[0x73e4f44d128eebbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<float> & (*) ( Context * __context__, TArray<float> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_a1f776f65548652d>>();
+	};
+	// _Funcbuiltin_0x60_binary_save_df945637b1078ab2
+	aotLib[0xd0fc38c10c0acad5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo const  & , Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  ),&_Funcbuiltin_0x60_binary_save_df945637b1078ab2>>();
+	};
+	// _Funcbuiltin_0x60_push_e4aecc27f9e903c6
+	aotLib[0xea7fed8bbc1a9125] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float  ),&_Funcbuiltin_0x60_push_e4aecc27f9e903c6>>();
+	};
+	// make_10_cf6fcb72ee5039fe
+	aotLib[0x2f26bc30baf52cc4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<float> (*) ( Context * __context__ ),&make_10_cf6fcb72ee5039fe>>();
+	};
+	// test_4d9b4e81d1a58a7b
+	aotLib[0xcb473d2638021a04] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_4d9b4e81d1a58a7b>>();
+	};
+	// Bar_6be92789c83ed52f
+	aotLib[0x5a2991211e2c2ced] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Bar (*) ( Context * __context__ ),&Bar_6be92789c83ed52f>>();
+	};
+	// Foo_cbabdebad82dc192
+	aotLib[0x4e744dd8f17ed2b0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_cbabdebad82dc192>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,359 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15665590463220316680 {
+
+extern StructInfo __struct_info__5e2faec79d58c943;
+extern StructInfo __struct_info__145996241021482a;
+extern StructInfo __struct_info__f35ff723fded4627;
+extern TypeInfo __type_info__dfd82b908f3b1490;
+extern TypeInfo __type_info__cfe6340eb7326a27;
+extern TypeInfo __type_info__8988d07b5422b9e;
+extern TypeInfo __type_info__fd978c5c1218516b;
+extern TypeInfo __type_info__441f4faaa4ccc2bb;
+extern TypeInfo __type_info__8c48207b56753d8;
+extern TypeInfo __type_info__ce34cf44aed6443;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__a0ce90235c80549f;
+extern TypeInfo __type_info__29c577ce7b2acb3c;
+extern TypeInfo __type_info__267ed9f41a25d90;
+extern VarInfo __var_info__17a8e76dfda5fc4d;
+extern VarInfo __var_info__1e87671ff0e91f7;
+extern VarInfo __var_info__9f0560b6f5261c5c;
+extern VarInfo __var_info__8bf04e77b9de08ad;
+extern VarInfo __var_info__82a8d2b484fdb182;
+extern VarInfo __var_info__b15af61b6020d620;
+extern VarInfo __var_info__b20d8b9ea8c03264;
+extern VarInfo __var_info__4ff0e20ca718c27c;
+extern VarInfo __var_info__364771b6b9987ce3;
+extern VarInfo __var_info__976f46b6f1282b8b;
+extern VarInfo __var_info__d6aa9371e695ec1f;
+extern VarInfo __var_info__1e4f399e8f97099e;
+extern FuncInfo __func_info__d3b307c446b1e15e;
+
+uint32_t __type_info__b15af61b6020d620_dim_var_6786835335832193347[1] = { 3 };
+VarInfo __struct_info__5e2faec79d58c943_field_0 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__b15af61b6020d620_dim_var_6786835335832193347, 30, 12, UINT64_C(0xb15af61b6020d620), "data_uint_3", 0 };
+VarInfo __struct_info__5e2faec79d58c943_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x9f0560b6f5261c5c), "data_new", 12 };
+VarInfo __struct_info__5e2faec79d58c943_field_2 =  { Type::tStructure, &__struct_info__145996241021482a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 32, UINT64_C(0x364771b6b9987ce3), "data_bar", 16 };
+VarInfo __struct_info__5e2faec79d58c943_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x976f46b6f1282b8b), "data_int", 48 };
+VarInfo * __struct_info__5e2faec79d58c943_fields[4] =  { &__struct_info__5e2faec79d58c943_field_0, &__struct_info__5e2faec79d58c943_field_1, &__struct_info__5e2faec79d58c943_field_2, &__struct_info__5e2faec79d58c943_field_3 };
+StructInfo __struct_info__5e2faec79d58c943 = {"FooV2", "", 28, __struct_info__5e2faec79d58c943_fields, 4, 56, UINT64_C(0x89d00416147d2bb3), nullptr, UINT64_C(0x5e2faec79d58c943) };
+VarInfo __struct_info__145996241021482a_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0x1e4f399e8f97099e), "t", 0 };
+VarInfo __struct_info__145996241021482a_field_1 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8988d07b5422b9e, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x17a8e76dfda5fc4d), "ta", 8 };
+VarInfo * __struct_info__145996241021482a_fields[2] =  { &__struct_info__145996241021482a_field_0, &__struct_info__145996241021482a_field_1 };
+StructInfo __struct_info__145996241021482a = {"Bar", "", 28, __struct_info__145996241021482a_fields, 2, 32, UINT64_C(0x16415419b0f09f7a), nullptr, UINT64_C(0x145996241021482a) };
+VarInfo __struct_info__f35ff723fded4627_field_0 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x82a8d2b484fdb182), "data_bool", 0 };
+VarInfo __struct_info__f35ff723fded4627_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xd6aa9371e695ec1f), "data_int", 4 };
+VarInfo __struct_info__f35ff723fded4627_field_2 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xb20d8b9ea8c03264), "data_float", 8 };
+VarInfo __struct_info__f35ff723fded4627_field_3 =  { Type::tStructure, &__struct_info__145996241021482a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 32, UINT64_C(0x1e87671ff0e91f7), "data_bar", 16 };
+uint32_t __type_info__4ff0e20ca718c27c_dim_var_17537007207960102439[1] = { 3 };
+VarInfo __struct_info__f35ff723fded4627_field_4 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__4ff0e20ca718c27c_dim_var_17537007207960102439, 30, 12, UINT64_C(0x4ff0e20ca718c27c), "data_uint_3", 48 };
+VarInfo * __struct_info__f35ff723fded4627_fields[5] =  { &__struct_info__f35ff723fded4627_field_0, &__struct_info__f35ff723fded4627_field_1, &__struct_info__f35ff723fded4627_field_2, &__struct_info__f35ff723fded4627_field_3, &__struct_info__f35ff723fded4627_field_4 };
+StructInfo __struct_info__f35ff723fded4627 = {"Foo", "", 28, __struct_info__f35ff723fded4627_fields, 5, 64, UINT64_C(0xf2bb95199c92e1d7), nullptr, UINT64_C(0xf35ff723fded4627) };
+VarInfo __func_info__d3b307c446b1e15e_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 40994, 24, UINT64_C(0x8bf04e77b9de08ad), "data", 0 };
+VarInfo * __func_info__d3b307c446b1e15e_fields[1] =  { &__func_info__d3b307c446b1e15e_field_0 };
+FuncInfo __func_info__d3b307c446b1e15e = {"invoke block<(data:array<uint8> const):void> const", "", __func_info__d3b307c446b1e15e_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xd3b307c446b1e15e), 0x0 };
+TypeInfo __type_info__dfd82b908f3b1490 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 64, UINT64_C(0xdfd82b908f3b1490) };
+TypeInfo __type_info__cfe6340eb7326a27 = { Type::tStructure, &__struct_info__5e2faec79d58c943, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 56, UINT64_C(0xcfe6340eb7326a27) };
+TypeInfo __type_info__8988d07b5422b9e = { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 12, UINT64_C(0x8988d07b5422b9e) };
+TypeInfo * __type_info__fd978c5c1218516b_arg_types[1] = { &__type_info__a0ce90235c80549f };
+TypeInfo __type_info__fd978c5c1218516b = { Type::tBlock, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fd978c5c1218516b_arg_types, nullptr, 1, 0, nullptr, 34, 40, UINT64_C(0xfd978c5c1218516b) };
+TypeInfo __type_info__441f4faaa4ccc2bb = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 64, UINT64_C(0x441f4faaa4ccc2bb) };
+TypeInfo __type_info__8c48207b56753d8 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x8c48207b56753d8) };
+TypeInfo __type_info__ce34cf44aed6443 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57378, 64, UINT64_C(0xce34cf44aed6443) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__a0ce90235c80549f = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 40994, 24, UINT64_C(0xa0ce90235c80549f) };
+TypeInfo __type_info__29c577ce7b2acb3c = { Type::tStructure, &__struct_info__145996241021482a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 32, UINT64_C(0x29c577ce7b2acb3c) };
+TypeInfo __type_info__267ed9f41a25d90 = { Type::tStructure, &__struct_info__5e2faec79d58c943, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 56, UINT64_C(0x267ed9f41a25d90) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__dfd82b908f3b1490, &__type_info__a0ce90235c80549f };
+TypeInfo * __tinfo_1[2] = { &__type_info__267ed9f41a25d90, &__type_info__a0ce90235c80549f };
+TypeInfo * __tinfo_2[1] = { &__type_info__29c577ce7b2acb3c };
+TypeInfo * __tinfo_3[1] = { &__type_info__441f4faaa4ccc2bb };
+TypeInfo * __tinfo_4[1] = { &__type_info__cfe6340eb7326a27 };
+TypeInfo * __tinfo_5[2] = { &__type_info__ce34cf44aed6443, &__type_info__fd978c5c1218516b };
+namespace  { struct Bar; };
+namespace  { struct Foo; };
+namespace  { struct FooV2; };
+namespace  {
+
+struct Bar {
+	char * t;
+	TArray<float3> ta;
+};
+static_assert(sizeof(Bar)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,t)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,ta)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo {
+	bool data_bool;
+	int32_t data_int;
+	float data_float;
+	Bar data_bar;
+	TDim<uint32_t,3> data_uint_3;
+};
+static_assert(sizeof(Foo)==64,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,data_bool)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_int)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_float)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_bar)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_uint_3)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct FooV2 {
+	TDim<uint32_t,3> data_uint_3;
+	int32_t data_new;
+	Bar data_bar;
+	int32_t data_int;
+};
+static_assert(sizeof(FooV2)==56,"structure size mismatch with DAS");
+static_assert(offsetof(FooV2,data_uint_3)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(FooV2,data_new)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(FooV2,data_bar)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(FooV2,data_int)==48,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_binary_load_versioned_3b87131ee7a9f7d3 ( Context * __context__, Foo & __obj_rename_at_321, TArray<uint8_t> const  & __data_rename_at_321 );
+inline void _Funcbuiltin_0x60_binary_load_versioned_f4ad6f6aeeaf3a8f ( Context * __context__, FooV2 & __obj_rename_at_321, TArray<uint8_t> const  & __data_rename_at_321 );
+inline Bar & _Funcbuiltin_0x60__return_with_lockcheck_e865d1b3c99e7037 ( Context * __context__, Bar & __a_rename_at_42 );
+inline Foo & _Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5 ( Context * __context__, Foo & __a_rename_at_42 );
+inline FooV2 & _Funcbuiltin_0x60__return_with_lockcheck_8b17ac81c0df9465 ( Context * __context__, FooV2 & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60_push_6e2c19a869e61aba ( Context * __context__, TArray<float3> & __Arr_rename_at_75, float3 __value_rename_at_75 );
+inline void _Funcbuiltin_0x60_binary_save_versioned_469f8adc61c7cb50 ( Context * __context__, Foo const  & __obj_rename_at_317, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  & __subexpr_rename_at_317 );
+inline bool test_b459231543411e83 ( Context * __context__ );
+inline Bar Bar_e9ad94f64e8bbd4a ( Context * __context__ );
+inline Foo Foo_cbabdebad82dc192 ( Context * __context__ );
+inline FooV2 FooV2_55cdc4496b9bb480 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_binary_load_versioned_3b87131ee7a9f7d3 ( Context * __context__, Foo &  __obj_rename_at_321, TArray<uint8_t> const  &  __data_rename_at_321 )
+{
+	das_call_interop<void>::call(&_builtin_binary_load_versioned,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<Foo &>::from(__obj_rename_at_321),cast<TArray<uint8_t> const  &>::from(__data_rename_at_321)));
+}
+
+inline void _Funcbuiltin_0x60_binary_load_versioned_f4ad6f6aeeaf3a8f ( Context * __context__, FooV2 &  __obj_rename_at_321, TArray<uint8_t> const  &  __data_rename_at_321 )
+{
+	das_call_interop<void>::call(&_builtin_binary_load_versioned,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<FooV2 &>::from(__obj_rename_at_321),cast<TArray<uint8_t> const  &>::from(__data_rename_at_321)));
+}
+
+inline Bar & _Funcbuiltin_0x60__return_with_lockcheck_e865d1b3c99e7037 ( Context * __context__, Bar &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<Bar &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<Bar &>::cast(__a_rename_at_42);
+}
+
+inline Foo & _Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5 ( Context * __context__, Foo &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_3,cast<Foo &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<Foo &>::cast(__a_rename_at_42);
+}
+
+inline FooV2 & _Funcbuiltin_0x60__return_with_lockcheck_8b17ac81c0df9465 ( Context * __context__, FooV2 &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_4,cast<FooV2 &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<FooV2 &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60_push_6e2c19a869e61aba ( Context * __context__, TArray<float3> &  __Arr_rename_at_75, float3 __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<float3>>::pass(__Arr_rename_at_75),12,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_binary_save_versioned_469f8adc61c7cb50 ( Context * __context__, Foo const  &  __obj_rename_at_317, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  __subexpr_rename_at_317 )
+{
+	das_call_interop<void>::call(&_builtin_binary_save_versioned,__context__,SimNode_AotInterop<2>(__tinfo_5,cast<Foo const  &>::from(__obj_rename_at_317),cast<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &>::from(__subexpr_rename_at_317)));
+}
+
+inline bool test_b459231543411e83 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,320,"test " DAS_FILE_LINE);
+{
+	Foo __f0_rename_at_20; das_zero(__f0_rename_at_20); das_move(__f0_rename_at_20, Foo_cbabdebad82dc192(__context__));
+	{
+		bool __need_loop_21 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_21;
+		__need_loop_21 = __i_iterator.first(__context__,(__i_rename_at_21)) && __need_loop_21;
+		for ( ; __need_loop_21 ; __need_loop_21 = __i_iterator.next(__context__,(__i_rename_at_21)) )
+		{
+			_Funcbuiltin_0x60_push_6e2c19a869e61aba(__context__,das_arg<TArray<float3>>::pass(__f0_rename_at_20.data_bar.ta),v_splats(float(__i_rename_at_21)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_21));
+	};
+	Foo __f1_rename_at_23; das_zero(__f1_rename_at_23);
+	FooV2 __f2_rename_at_24; das_zero(__f2_rename_at_24); das_move(__f2_rename_at_24, FooV2_55cdc4496b9bb480(__context__));
+	_Funcbuiltin_0x60_binary_save_versioned_469f8adc61c7cb50(__context__,das_arg<Foo>::pass(__f0_rename_at_20),das_make_block<void,TArray<uint8_t> const  &>(__context__,288,0,&__func_info__d3b307c446b1e15e,[&](TArray<uint8_t> const  & __data_rename_at_25)->void{
+		_Funcbuiltin_0x60_binary_load_versioned_3b87131ee7a9f7d3(__context__,das_arg<Foo>::pass(__f1_rename_at_23),__data_rename_at_25);
+		_Funcbuiltin_0x60_binary_load_versioned_f4ad6f6aeeaf3a8f(__context__,das_arg<FooV2>::pass(__f2_rename_at_24),__data_rename_at_25);
+	}));
+	DAS_ASSERT((__f1_rename_at_23.data_bool == true));
+	DAS_ASSERT((__f1_rename_at_23.data_int == 1));
+	DAS_ASSERT((__f1_rename_at_23.data_float == 3.1400001f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__f1_rename_at_23.data_bar.t),cast<char *>::from(((char *) "blah")),*__context__,nullptr)));
+	DAS_ASSERT((((__f1_rename_at_23.data_uint_3(0,__context__) == 0x1u) && (__f1_rename_at_23.data_uint_3(1,__context__) == 0x2u)) && (__f1_rename_at_23.data_uint_3(2,__context__) == 0x3u)));
+	{
+		bool __need_loop_33 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_33;
+		__need_loop_33 = __i_iterator.first(__context__,(__i_rename_at_33)) && __need_loop_33;
+		for ( ; __need_loop_33 ; __need_loop_33 = __i_iterator.next(__context__,(__i_rename_at_33)) )
+		{
+			DAS_ASSERT((SimPolicy<float3>::Equ(__f1_rename_at_23.data_bar.ta(__i_rename_at_33,__context__),v_splats(float(__i_rename_at_33)),*__context__,nullptr)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_33));
+	};
+	DAS_ASSERT((__f2_rename_at_24.data_int == 1));
+	DAS_ASSERT((__f2_rename_at_24.data_new == 13));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__f2_rename_at_24.data_bar.t),cast<char *>::from(((char *) "blah")),*__context__,nullptr)));
+	DAS_ASSERT((__f2_rename_at_24.data_uint_3(2,__context__) == 0x3u));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<float3>>::pass(__f2_rename_at_24.data_bar.ta)) == 10));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline Bar Bar_e9ad94f64e8bbd4a ( Context * __context__ )
+{
+	Bar _temp_make_local_1_32;
+	return /* <- */ das_auto_cast_move<Bar>::cast(_Funcbuiltin_0x60__return_with_lockcheck_e865d1b3c99e7037(__context__,das_arg<Bar>::pass((([&]() -> Bar& {
+		das_zero(_temp_make_local_1_32);
+		das_copy((_temp_make_local_1_32.t),(((char *) "blah")));
+		return _temp_make_local_1_32;
+	})()))));
+}
+
+inline Foo Foo_cbabdebad82dc192 ( Context * __context__ )
+{
+	Foo _temp_make_local_5_32;
+	return /* <- */ das_auto_cast_move<Foo>::cast(_Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5(__context__,das_arg<Foo>::pass((([&]() -> Foo& {
+		das_copy((_temp_make_local_5_32.data_bool),(true));
+		das_copy((_temp_make_local_5_32.data_int),(1));
+		das_copy((_temp_make_local_5_32.data_float),(3.1400001f));
+		das_move((_temp_make_local_5_32.data_bar),(Bar_e9ad94f64e8bbd4a(__context__)));
+		das_copy((_temp_make_local_5_32.data_uint_3),((([&]() -> TDim<uint32_t,3> {
+			TDim<uint32_t,3> __mka_10;
+			__mka_10(0,__context__) = 0x1u;
+			__mka_10(1,__context__) = 0x2u;
+			__mka_10(2,__context__) = 0x3u;
+			return __mka_10;
+		})())));
+		return _temp_make_local_5_32;
+	})()))));
+}
+
+inline FooV2 FooV2_55cdc4496b9bb480 ( Context * __context__ )
+{
+	FooV2 _temp_make_local_12_32;
+	return /* <- */ das_auto_cast_move<FooV2>::cast(_Funcbuiltin_0x60__return_with_lockcheck_8b17ac81c0df9465(__context__,das_arg<FooV2>::pass((([&]() -> FooV2& {
+		das_zero(_temp_make_local_12_32);
+		das_copy((_temp_make_local_12_32.data_new),(13));
+		das_move((_temp_make_local_12_32.data_bar),(Bar_e9ad94f64e8bbd4a(__context__)));
+		return _temp_make_local_12_32;
+	})()))));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_binary_load_versioned_3b87131ee7a9f7d3
+	aotLib[0xac0bfae69127ab5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , TArray<uint8_t> const  &  ),&_Funcbuiltin_0x60_binary_load_versioned_3b87131ee7a9f7d3>>();
+	};
+	// _Funcbuiltin_0x60_binary_load_versioned_f4ad6f6aeeaf3a8f
+	aotLib[0xb3a136a3223db021] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, FooV2 & , TArray<uint8_t> const  &  ),&_Funcbuiltin_0x60_binary_load_versioned_f4ad6f6aeeaf3a8f>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_e865d1b3c99e7037
+	aotLib[0x1e9e47642c679125] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Bar & (*) ( Context * __context__, Bar &  ),&_Funcbuiltin_0x60__return_with_lockcheck_e865d1b3c99e7037>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5
+	aotLib[0xb06e2106c303ef51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Foo & (*) ( Context * __context__, Foo &  ),&_Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_8b17ac81c0df9465
+	aotLib[0x7c69a6c33de14c4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<FooV2 & (*) ( Context * __context__, FooV2 &  ),&_Funcbuiltin_0x60__return_with_lockcheck_8b17ac81c0df9465>>();
+	};
+	// _Funcbuiltin_0x60_push_6e2c19a869e61aba
+	aotLib[0xf4064c59c4a5bcd5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , float3  ),&_Funcbuiltin_0x60_push_6e2c19a869e61aba>>();
+	};
+	// _Funcbuiltin_0x60_binary_save_versioned_469f8adc61c7cb50
+	aotLib[0xe7ad8a0adb9acb75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo const  & , Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  ),&_Funcbuiltin_0x60_binary_save_versioned_469f8adc61c7cb50>>();
+	};
+	// test_b459231543411e83
+	aotLib[0xf26b96fcc257b284] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b459231543411e83>>();
+	};
+	// Bar_e9ad94f64e8bbd4a
+	aotLib[0x9fbed6c6c81d37a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Bar (*) ( Context * __context__ ),&Bar_e9ad94f64e8bbd4a>>();
+	};
+	// Foo_cbabdebad82dc192
+	aotLib[0xe7d8871fea0bbff5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_cbabdebad82dc192>>();
+	};
+	// FooV2_55cdc4496b9bb480
+	aotLib[0xc867c356523ea15b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<FooV2 (*) ( Context * __context__ ),&FooV2_55cdc4496b9bb480>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
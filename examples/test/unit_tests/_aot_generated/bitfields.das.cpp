@@ -0,0 +1,102 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_17959989178850383650 {
+
+extern TypeInfo __type_info__ad745f226902bced;
+
+const char * __type_info__ad745f226902bced_arg_names[3] = { "one", "two", "three" };
+TypeInfo __type_info__ad745f226902bced = { Type::tBitfield, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, __type_info__ad745f226902bced_arg_names, 3, 0, nullptr, 28, 4, UINT64_C(0xad745f226902bced) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__ad745f226902bced };
+
+inline Bitfield bit_e64f9e45102a8310 ( Context * __context__, int32_t __b_rename_at_7 );
+inline bool test_3330752062a9d32d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Bitfield bit_e64f9e45102a8310 ( Context * __context__, int32_t __b_rename_at_7 )
+{
+	return das_auto_cast<Bitfield>::cast(Bitfield(1 << __b_rename_at_7));
+}
+
+inline bool test_3330752062a9d32d ( Context * __context__ )
+{
+	Bitfield __t_rename_at_12 = (0x2u | bit_e64f9e45102a8310(__context__,2));
+	DAS_ASSERT(((!(das_get_bitfield(__t_rename_at_12,1u << 0)) && das_get_bitfield(__t_rename_at_12,1u << 1)) && das_get_bitfield(__t_rename_at_12,1u << 2)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<Bitfield>::from(__t_rename_at_12)))),cast<char *>::from(((char *) "(two|three)")),*__context__,nullptr)));
+	__t_rename_at_12 ^= 0x2u;
+	DAS_ASSERT(((!(das_get_bitfield(__t_rename_at_12,1u << 0)) && !(das_get_bitfield(__t_rename_at_12,1u << 1))) && das_get_bitfield(__t_rename_at_12,1u << 2)));
+	DAS_ASSERT((__t_rename_at_12 == 0x4u));
+	__t_rename_at_12 |= 0x1u;
+	DAS_ASSERT(((das_get_bitfield(__t_rename_at_12,1u << 0) && !(das_get_bitfield(__t_rename_at_12,1u << 1))) && das_get_bitfield(__t_rename_at_12,1u << 2)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// bit_e64f9e45102a8310
+	aotLib[0x30dcb9bc2933310d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Bitfield (*) ( Context * __context__, int32_t  ),&bit_e64f9e45102a8310>>();
+	};
+	// test_3330752062a9d32d
+	aotLib[0x3202ee62b5012e50] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3330752062a9d32d>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,171 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_16217347889162729018 {
+
+extern StructInfo __struct_info__a1c631859b6506c1;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__eb00593297dd00f8;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__efafc171abc485a6;
+extern VarInfo __var_info__549afca5f79df68a;
+extern VarInfo __var_info__5963a95f8999d006;
+extern VarInfo __var_info__d03a0adb0f3af516;
+extern VarInfo __var_info__cc8069871d1c5f1f;
+extern FuncInfo __func_info__14a3e2db8ef84c66;
+
+TypeInfo * __type_info__549afca5f79df68a_arg_types_var_11657059135402608321[2] = { &__type_info__efafc171abc485a6, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__a1c631859b6506c1_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, (TypeInfo **)__type_info__549afca5f79df68a_arg_types_var_11657059135402608321, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x549afca5f79df68a), "__lambda", 0 };
+TypeInfo * __type_info__cc8069871d1c5f1f_arg_types_var_11657059135402608321[1] = { &__type_info__eb00593297dd00f8 };
+VarInfo __struct_info__a1c631859b6506c1_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__cc8069871d1c5f1f_arg_types_var_11657059135402608321, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xcc8069871d1c5f1f), "__finalize", 8 };
+VarInfo __struct_info__a1c631859b6506c1_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x5963a95f8999d006), "CNT", 16 };
+VarInfo * __struct_info__a1c631859b6506c1_fields[3] =  { &__struct_info__a1c631859b6506c1_field_0, &__struct_info__a1c631859b6506c1_field_1, &__struct_info__a1c631859b6506c1_field_2 };
+StructInfo __struct_info__a1c631859b6506c1 = {"_lambda_thismodule_10_8_1", "", 6, __struct_info__a1c631859b6506c1_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0xa1c631859b6506c1) };
+VarInfo __func_info__14a3e2db8ef84c66_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xd03a0adb0f3af516), "extraBlock", 0 };
+VarInfo * __func_info__14a3e2db8ef84c66_fields[1] =  { &__func_info__14a3e2db8ef84c66_field_0 };
+FuncInfo __func_info__14a3e2db8ef84c66 = {"invoke block<(extraBlock:int const):int> const", "", __func_info__14a3e2db8ef84c66_fields, 1, 32, &__type_info__af63e44c8601fa24, nullptr,0,UINT64_C(0x14a3e2db8ef84c66), 0x0 };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__eb00593297dd00f8 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__efafc171abc485a6, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xeb00593297dd00f8) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+TypeInfo __type_info__efafc171abc485a6 = { Type::tStructure, &__struct_info__a1c631859b6506c1, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 24, UINT64_C(0xefafc171abc485a6) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct _lambda_thismodule_10_8_1; };
+namespace  {
+
+struct _lambda_thismodule_10_8_1 {
+	Func DAS_COMMENT((int32_t,_lambda_thismodule_10_8_1,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_10_8_1 *)) __finalize;
+	int32_t CNT;
+};
+static_assert(sizeof(_lambda_thismodule_10_8_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_8_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_8_1,CNT)==16,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_d5734efadcd19e77 ( Context * __context__, _lambda_thismodule_10_8_1 & ____this_rename_at_10 );
+inline int32_t _Func_lambda_thismodule_10_8_1_0x60_function_5a0031f8685c8130 ( Context * __context__, _lambda_thismodule_10_8_1 & ____this_rename_at_10, int32_t __extra_rename_at_9 );
+inline void _Func_lambda_thismodule_10_8_1_0x60_finalizer_32ba2a6d84098c72 ( Context * __context__, _lambda_thismodule_10_8_1 * ____this_rename_at_10 );
+inline int32_t _Func_0x60_addValue_945c1a1e14d6ff6 ( Context * __context__, int32_t __a_rename_at_3, Block DAS_COMMENT((int32_t,int32_t)) const  & __blk_rename_at_3 );
+inline bool test_537a7c141ea4167b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_d5734efadcd19e77 ( Context * __context__, _lambda_thismodule_10_8_1 &  ____this_rename_at_10 )
+{
+	memset(&(____this_rename_at_10), 0, 24);
+}
+
+inline int32_t _Func_lambda_thismodule_10_8_1_0x60_function_5a0031f8685c8130 ( Context * __context__, _lambda_thismodule_10_8_1 &  ____this_rename_at_10, int32_t __extra_rename_at_9 ) { das_stack_prologue __prologue(__context__,112,"_lambda_thismodule_10_8_1`function " DAS_FILE_LINE);
+{
+	int32_t __e1_rename_at_10 = ((int32_t)_Func_0x60_addValue_945c1a1e14d6ff6(__context__,1,das_make_block<int32_t,int32_t>(__context__,96,0,&__func_info__14a3e2db8ef84c66,[&](int32_t const  __extraBlock_rename_at_10)->int32_t{
+		return das_auto_cast<int32_t>::cast(__extraBlock_rename_at_10 + ____this_rename_at_10.CNT);
+	})));
+	return das_auto_cast<int32_t>::cast((____this_rename_at_10.CNT++) + __e1_rename_at_10);
+}}
+
+inline void _Func_lambda_thismodule_10_8_1_0x60_finalizer_32ba2a6d84098c72 ( Context * __context__, _lambda_thismodule_10_8_1 * ____this_rename_at_10 )
+{
+	finalize_d5734efadcd19e77(__context__,das_arg<_lambda_thismodule_10_8_1>::pass(das_deref(__context__,____this_rename_at_10)));
+	das_delete_lambda_struct<_lambda_thismodule_10_8_1 *>::clear(__context__,____this_rename_at_10);
+}
+
+inline int32_t _Func_0x60_addValue_945c1a1e14d6ff6 ( Context * __context__, int32_t __a_rename_at_3, Block DAS_COMMENT((int32_t,int32_t)) const  &  __blk_rename_at_3 )
+{
+	return das_auto_cast<int32_t>::cast(das_invoke<int32_t>::invoke<int32_t>(__context__,nullptr,__blk_rename_at_3,__a_rename_at_3));
+}
+
+inline bool test_537a7c141ea4167b ( Context * __context__ )
+{
+	Lambda DAS_COMMENT((int32_t,int32_t)) __counter_rename_at_9; das_zero(__counter_rename_at_9); das_move(__counter_rename_at_9, ((Lambda DAS_COMMENT((int32_t,int32_t)))das_ascend<int32_t,_lambda_thismodule_10_8_1>::make(__context__,&__type_info__efafc171abc485a6,(([&]() -> _lambda_thismodule_10_8_1 {
+		_lambda_thismodule_10_8_1 __mks_10;
+		das_copy((__mks_10.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_10_8_1`function XS<::_lambda_thismodule_10_8_1> Ci*/ 16320114016525347956u))));
+		das_copy((__mks_10.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_10_8_1`finalizer X1<S<::_lambda_thismodule_10_8_1>>?*/ 1053697981095341980u))));
+		das_copy((__mks_10.CNT),(0));
+		return __mks_10;
+	})()))));
+	DAS_VERIFY((das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,nullptr,__counter_rename_at_9,0) == 1));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_d5734efadcd19e77
+	aotLib[0x7363f23c3439a585] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_10_8_1 &  ),&finalize_d5734efadcd19e77>>();
+	};
+	// _Func_lambda_thismodule_10_8_1_0x60_function_5a0031f8685c8130
+	aotLib[0x290717fd5320cbc4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, _lambda_thismodule_10_8_1 & , int32_t  ),&_Func_lambda_thismodule_10_8_1_0x60_function_5a0031f8685c8130>>();
+	};
+	// _Func_lambda_thismodule_10_8_1_0x60_finalizer_32ba2a6d84098c72
+	aotLib[0x80784494ae3ebcd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_10_8_1 *  ),&_Func_lambda_thismodule_10_8_1_0x60_finalizer_32ba2a6d84098c72>>();
+	};
+	// _Func_0x60_addValue_945c1a1e14d6ff6
+	aotLib[0x7aa0ae3d441c1911] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , Block DAS_COMMENT((int32_t,int32_t)) const  &  ),&_Func_0x60_addValue_945c1a1e14d6ff6>>();
+	};
+	// test_537a7c141ea4167b
+	aotLib[0x21b09336d2767fb6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_537a7c141ea4167b>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
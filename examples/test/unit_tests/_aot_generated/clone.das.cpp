@@ -0,0 +1,622 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9107795451850489821 {
+
+extern StructInfo __struct_info__f35ff723fded4627;
+extern StructInfo __struct_info__145996241021482a;
+extern TypeInfo __type_info__dfd82b908f3b1490;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__bebb09c577ebf0c0;
+extern TypeInfo __type_info__d20c633bb0be69fe;
+extern TypeInfo __type_info__69bf76040e9bf9ad;
+extern TypeInfo __type_info__c83959e962ee7377;
+extern VarInfo __var_info__a08aad2745ae5bc5;
+extern VarInfo __var_info__a08aaa2745ae56ac;
+extern VarInfo __var_info__1e4f339e8f96ff6c;
+
+VarInfo __struct_info__f35ff723fded4627_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa08aaa2745ae56ac), "a", 0 };
+VarInfo __struct_info__f35ff723fded4627_field_1 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xa08aad2745ae5bc5), "b", 8 };
+VarInfo * __struct_info__f35ff723fded4627_fields[2] =  { &__struct_info__f35ff723fded4627_field_0, &__struct_info__f35ff723fded4627_field_1 };
+StructInfo __struct_info__f35ff723fded4627 = {"Foo", "", 20, __struct_info__f35ff723fded4627_fields, 2, 32, UINT64_C(0x0), nullptr, UINT64_C(0xf35ff723fded4627) };
+VarInfo __struct_info__145996241021482a_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__dfd82b908f3b1490, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x1e4f339e8f96ff6c), "z", 0 };
+VarInfo * __struct_info__145996241021482a_fields[1] =  { &__struct_info__145996241021482a_field_0 };
+StructInfo __struct_info__145996241021482a = {"Bar", "", 20, __struct_info__145996241021482a_fields, 1, 24, UINT64_C(0x0), nullptr, UINT64_C(0x145996241021482a) };
+TypeInfo __type_info__dfd82b908f3b1490 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 32, UINT64_C(0xdfd82b908f3b1490) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__bebb09c577ebf0c0 = { Type::tStructure, &__struct_info__145996241021482a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xbebb09c577ebf0c0) };
+TypeInfo __type_info__d20c633bb0be69fe = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__bebb09c577ebf0c0, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xd20c633bb0be69fe) };
+TypeInfo __type_info__69bf76040e9bf9ad = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__c83959e962ee7377, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x69bf76040e9bf9ad) };
+TypeInfo __type_info__c83959e962ee7377 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 32, UINT64_C(0xc83959e962ee7377) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__d20c633bb0be69fe };
+TypeInfo * __tinfo_1[1] = { &__type_info__69bf76040e9bf9ad };
+namespace  { struct Foo; };
+namespace  { struct Bar; };
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct Foo {
+	int32_t a;
+	TArray<int32_t> b;
+};
+static_assert(sizeof(Foo)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Bar {
+	TArray<Foo> z;
+};
+static_assert(sizeof(Bar)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,z)==0,"structure field offset mismatch with DAS");
+}
+
+inline TestObjectFoo _Funcbuiltin_0x60_clone_to_move_7b6fdaec8fc45a5b ( Context * __context__, TestObjectFoo const  & __clone_src_rename_at_325 );
+inline void _Funcbuiltin_0x60_clone_db640d19fa3ad019 ( Context * __context__, TArray<Foo> & __a_rename_at_338, TArray<Foo> const  & __b_rename_at_338 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_4b0e5a3ba1726cd0 ( Context * __context__, TTable<int32_t,char *> const  & __a_rename_at_370 );
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_values_919927a1c0562562 ( Context * __context__, TTable<int32_t,char *> const  & __a_rename_at_381 );
+inline void _Funcbuiltin_0x60_clone_61ceee925c56f87e ( Context * __context__, TArray<Bar> & __a_rename_at_338, TArray<Bar> const  & __b_rename_at_338 );
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> & __a_rename_at_338, TArray<int32_t> const  & __b_rename_at_338 );
+inline void _Funcbuiltin_0x60_clone_ee419a657d926a66 ( Context * __context__, TTable<int32_t,char *> & __a_rename_at_359, TTable<int32_t,char *> const  & __b_rename_at_359 );
+inline void _Funcbuiltin_0x60_resize_c16f01fd6d208a74 ( Context * __context__, TArray<Bar> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_resize_a9e21d21471bf80d ( Context * __context__, TArray<Foo> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_push_clone_543073cfd297b3d0 ( Context * __context__, das::vector<TestObjectFoo> & __A_rename_at_184, TestObjectFoo const  & __b_rename_at_184 );
+inline void test_clone_complex_5ec1711386116abc ( Context * __context__ );
+inline void test_clone_struct_8a5a4ebf41a6b13c ( Context * __context__ );
+inline void test_clone_array_776de11bedecce23 ( Context * __context__ );
+inline void test_clone_table_c1095dab5e9b6f9d ( Context * __context__ );
+inline bool test_6f2216df10db91a ( Context * __context__ );
+inline void test_if_compiles_66fea59ea2660af0 ( Context * __context__, das::vector<TestObjectFoo> & __a_rename_at_82, TestObjectFoo const  & __b_rename_at_82 );
+inline void clone_e65bfbe52285b9f1 ( Context * __context__, Foo & __a_rename_at_4, Foo const  & __b_rename_at_4 );
+inline void clone_7a40ab073ad58680 ( Context * __context__, Bar & __a_rename_at_8, Bar const  & __b_rename_at_8 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline TestObjectFoo _Funcbuiltin_0x60_clone_to_move_7b6fdaec8fc45a5b ( Context * __context__, TestObjectFoo const  &  __clone_src_rename_at_325 )
+{
+	TestObjectFoo __clone_dest_rename_at_327; das_zero(__clone_dest_rename_at_327);
+	das_clone<TestObjectFoo,TestObjectFoo>::clone(__clone_dest_rename_at_327,__clone_src_rename_at_325);
+	return /* <- */ das_auto_cast_move<TestObjectFoo>::cast(__clone_dest_rename_at_327);
+}
+
+inline void _Funcbuiltin_0x60_clone_db640d19fa3ad019 ( Context * __context__, TArray<Foo> &  __a_rename_at_338, TArray<Foo> const  &  __b_rename_at_338 )
+{
+	_Funcbuiltin_0x60_resize_a9e21d21471bf80d(__context__,das_arg<TArray<Foo>>::pass(__a_rename_at_338),builtin_array_size(__b_rename_at_338));
+	{
+		bool __need_loop_340 = true;
+		// aV : Foo aka TT&
+		das_iterator<TArray<Foo>> __aV_iterator(__a_rename_at_338);
+		Foo * __aV_rename_at_340;
+		__need_loop_340 = __aV_iterator.first(__context__,(__aV_rename_at_340)) && __need_loop_340;
+		// bV : Foo const&
+		das_iterator<TArray<Foo> const > __bV_iterator(__b_rename_at_338);
+		Foo const  * __bV_rename_at_340;
+		__need_loop_340 = __bV_iterator.first(__context__,(__bV_rename_at_340)) && __need_loop_340;
+		for ( ; __need_loop_340 ; __need_loop_340 = __aV_iterator.next(__context__,(__aV_rename_at_340)) && __bV_iterator.next(__context__,(__bV_rename_at_340)) )
+		{
+			clone_e65bfbe52285b9f1(__context__,das_arg<Foo>::pass((*__aV_rename_at_340)),(*__bV_rename_at_340));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_340));
+		__bV_iterator.close(__context__,(__bV_rename_at_340));
+	};
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_4b0e5a3ba1726cd0 ( Context * __context__, TTable<int32_t,char *> const  &  __a_rename_at_370 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_371; das_zero(__it_rename_at_371);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_371),__a_rename_at_370,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t const  &))>::cast(__it_rename_at_371);
+}
+
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_values_919927a1c0562562 ( Context * __context__, TTable<int32_t,char *> const  &  __a_rename_at_381 )
+{
+	Sequence DAS_COMMENT((char * *)) __it_rename_at_382; das_zero(__it_rename_at_382);
+	builtin_table_values(das_arg<Sequence DAS_COMMENT((char * const ))>::pass(__it_rename_at_382),__a_rename_at_381,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char * const  &))>::cast(__it_rename_at_382);
+}
+
+inline void _Funcbuiltin_0x60_clone_61ceee925c56f87e ( Context * __context__, TArray<Bar> &  __a_rename_at_338, TArray<Bar> const  &  __b_rename_at_338 )
+{
+	_Funcbuiltin_0x60_resize_c16f01fd6d208a74(__context__,das_arg<TArray<Bar>>::pass(__a_rename_at_338),builtin_array_size(__b_rename_at_338));
+	{
+		bool __need_loop_340 = true;
+		// aV : Bar aka TT&
+		das_iterator<TArray<Bar>> __aV_iterator(__a_rename_at_338);
+		Bar * __aV_rename_at_340;
+		__need_loop_340 = __aV_iterator.first(__context__,(__aV_rename_at_340)) && __need_loop_340;
+		// bV : Bar const&
+		das_iterator<TArray<Bar> const > __bV_iterator(__b_rename_at_338);
+		Bar const  * __bV_rename_at_340;
+		__need_loop_340 = __bV_iterator.first(__context__,(__bV_rename_at_340)) && __need_loop_340;
+		for ( ; __need_loop_340 ; __need_loop_340 = __aV_iterator.next(__context__,(__aV_rename_at_340)) && __bV_iterator.next(__context__,(__bV_rename_at_340)) )
+		{
+			clone_7a40ab073ad58680(__context__,das_arg<Bar>::pass((*__aV_rename_at_340)),(*__bV_rename_at_340));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_340));
+		__bV_iterator.close(__context__,(__bV_rename_at_340));
+	};
+}
+
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> &  __a_rename_at_338, TArray<int32_t> const  &  __b_rename_at_338 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_338),builtin_array_size(__b_rename_at_338));
+	{
+		bool __need_loop_340 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_338);
+		int32_t * __aV_rename_at_340;
+		__need_loop_340 = __aV_iterator.first(__context__,(__aV_rename_at_340)) && __need_loop_340;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_338);
+		int32_t const  * __bV_rename_at_340;
+		__need_loop_340 = __bV_iterator.first(__context__,(__bV_rename_at_340)) && __need_loop_340;
+		for ( ; __need_loop_340 ; __need_loop_340 = __aV_iterator.next(__context__,(__aV_rename_at_340)) && __bV_iterator.next(__context__,(__bV_rename_at_340)) )
+		{
+			das_copy((*__aV_rename_at_340),(*__bV_rename_at_340));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_340));
+		__bV_iterator.close(__context__,(__bV_rename_at_340));
+	};
+}
+
+inline void _Funcbuiltin_0x60_clone_ee419a657d926a66 ( Context * __context__, TTable<int32_t,char *> &  __a_rename_at_359, TTable<int32_t,char *> const  &  __b_rename_at_359 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_361_32;
+	Sequence DAS_COMMENT((char * *)) _temp_make_local_361_48;
+	builtin_table_clear(das_arg<TTable<int32_t,char *>>::pass(__a_rename_at_359),__context__);
+	{
+		bool __need_loop_361 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_361_32 = (_Funcbuiltin_0x60_keys_4b0e5a3ba1726cd0(__context__,__b_rename_at_359))));
+		int32_t const  * __k_rename_at_361;
+		__need_loop_361 = __k_iterator.first(__context__,(__k_rename_at_361)) && __need_loop_361;
+		// v : string const&
+		das_iterator<Sequence DAS_COMMENT((char * const ))> __v_iterator((_temp_make_local_361_48 = (_Funcbuiltin_0x60_values_919927a1c0562562(__context__,__b_rename_at_359))));
+		char * const  * __v_rename_at_361;
+		__need_loop_361 = __v_iterator.first(__context__,(__v_rename_at_361)) && __need_loop_361;
+		for ( ; __need_loop_361 ; __need_loop_361 = __k_iterator.next(__context__,(__k_rename_at_361)) && __v_iterator.next(__context__,(__v_rename_at_361)) )
+		{
+			das_copy(__a_rename_at_359((*__k_rename_at_361),__context__),(*__v_rename_at_361));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_361));
+		__v_iterator.close(__context__,(__v_rename_at_361));
+	};
+}
+
+inline void _Funcbuiltin_0x60_resize_c16f01fd6d208a74 ( Context * __context__, TArray<Bar> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<Bar> &>::from(__Arr_rename_at_54)));
+	builtin_array_resize(das_arg<TArray<Bar>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,24,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_a9e21d21471bf80d ( Context * __context__, TArray<Foo> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<TArray<Foo> &>::from(__Arr_rename_at_54)));
+	builtin_array_resize(das_arg<TArray<Foo>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,32,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_543073cfd297b3d0 ( Context * __context__, das::vector<TestObjectFoo> &  __A_rename_at_184, TestObjectFoo const  &  __b_rename_at_184 )
+{
+	TestObjectFoo __cb_rename_at_193; das_zero(__cb_rename_at_193); das_move(__cb_rename_at_193, _Funcbuiltin_0x60_clone_to_move_7b6fdaec8fc45a5b(__context__,__b_rename_at_184));
+	das_vector_emplace_back(das_arg<das::vector<TestObjectFoo>>::pass(__A_rename_at_184),das_arg<TestObjectFoo>::pass(__cb_rename_at_193));
+}
+
+inline void test_clone_complex_5ec1711386116abc ( Context * __context__ )
+{
+	TArray<Bar> __x_rename_at_13; das_zero(__x_rename_at_13); TArray<Bar> __y_rename_at_13; das_zero(__y_rename_at_13);
+	_Funcbuiltin_0x60_resize_c16f01fd6d208a74(__context__,das_arg<TArray<Bar>>::pass(__x_rename_at_13),2);
+	{
+		bool __need_loop_15 = true;
+		// xx : Bar&
+		das_iterator<TArray<Bar>> __xx_iterator(__x_rename_at_13);
+		Bar * __xx_rename_at_15;
+		__need_loop_15 = __xx_iterator.first(__context__,(__xx_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __xx_iterator.next(__context__,(__xx_rename_at_15)) )
+		{
+			_Funcbuiltin_0x60_resize_a9e21d21471bf80d(__context__,das_arg<TArray<Foo>>::pass((*__xx_rename_at_15).z),4);
+			{
+				bool __need_loop_17 = true;
+				// xxx : Foo&
+				das_iterator<TArray<Foo>> __xxx_iterator((*__xx_rename_at_15).z);
+				Foo * __xxx_rename_at_17;
+				__need_loop_17 = __xxx_iterator.first(__context__,(__xxx_rename_at_17)) && __need_loop_17;
+				for ( ; __need_loop_17 ; __need_loop_17 = __xxx_iterator.next(__context__,(__xxx_rename_at_17)) )
+				{
+					das_copy((*__xxx_rename_at_17).a,5);
+					_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass((*__xxx_rename_at_17).b),3);
+					{
+						bool __need_loop_20 = true;
+						// t : int const
+						das_iterator<range> __t_iterator(range(0,3));
+						int32_t __t_rename_at_20;
+						__need_loop_20 = __t_iterator.first(__context__,(__t_rename_at_20)) && __need_loop_20;
+						for ( ; __need_loop_20 ; __need_loop_20 = __t_iterator.next(__context__,(__t_rename_at_20)) )
+						{
+							das_copy((*__xxx_rename_at_17).b(__t_rename_at_20,__context__),__t_rename_at_20);
+						}
+						__t_iterator.close(__context__,(__t_rename_at_20));
+					};
+				}
+				__xxx_iterator.close(__context__,(__xxx_rename_at_17));
+			};
+		}
+		__xx_iterator.close(__context__,(__xx_rename_at_15));
+	};
+	_Funcbuiltin_0x60_clone_61ceee925c56f87e(__context__,das_arg<TArray<Bar>>::pass(__y_rename_at_13),das_arg<TArray<Bar>>::pass(__x_rename_at_13));
+	{
+		bool __need_loop_23 = true;
+		// xx : Bar&
+		das_iterator<TArray<Bar>> __xx_iterator(__x_rename_at_13);
+		Bar * __xx_rename_at_23;
+		__need_loop_23 = __xx_iterator.first(__context__,(__xx_rename_at_23)) && __need_loop_23;
+		for ( ; __need_loop_23 ; __need_loop_23 = __xx_iterator.next(__context__,(__xx_rename_at_23)) )
+		{
+			{
+				bool __need_loop_24 = true;
+				// xxx : Foo&
+				das_iterator<TArray<Foo>> __xxx_iterator((*__xx_rename_at_23).z);
+				Foo * __xxx_rename_at_24;
+				__need_loop_24 = __xxx_iterator.first(__context__,(__xxx_rename_at_24)) && __need_loop_24;
+				for ( ; __need_loop_24 ; __need_loop_24 = __xxx_iterator.next(__context__,(__xxx_rename_at_24)) )
+				{
+					das_copy((*__xxx_rename_at_24).a,6);
+					{
+						bool __need_loop_26 = true;
+						// t : int const
+						das_iterator<range> __t_iterator(range(0,3));
+						int32_t __t_rename_at_26;
+						__need_loop_26 = __t_iterator.first(__context__,(__t_rename_at_26)) && __need_loop_26;
+						for ( ; __need_loop_26 ; __need_loop_26 = __t_iterator.next(__context__,(__t_rename_at_26)) )
+						{
+							das_copy((*__xxx_rename_at_24).b(__t_rename_at_26,__context__),__t_rename_at_26 + 1);
+						}
+						__t_iterator.close(__context__,(__t_rename_at_26));
+					};
+				}
+				__xxx_iterator.close(__context__,(__xxx_rename_at_24));
+			};
+		}
+		__xx_iterator.close(__context__,(__xx_rename_at_23));
+	};
+	{
+		bool __need_loop_28 = true;
+		// yy : Bar&
+		das_iterator<TArray<Bar>> __yy_iterator(__y_rename_at_13);
+		Bar * __yy_rename_at_28;
+		__need_loop_28 = __yy_iterator.first(__context__,(__yy_rename_at_28)) && __need_loop_28;
+		for ( ; __need_loop_28 ; __need_loop_28 = __yy_iterator.next(__context__,(__yy_rename_at_28)) )
+		{
+			{
+				bool __need_loop_29 = true;
+				// yyy : Foo&
+				das_iterator<TArray<Foo>> __yyy_iterator((*__yy_rename_at_28).z);
+				Foo * __yyy_rename_at_29;
+				__need_loop_29 = __yyy_iterator.first(__context__,(__yyy_rename_at_29)) && __need_loop_29;
+				for ( ; __need_loop_29 ; __need_loop_29 = __yyy_iterator.next(__context__,(__yyy_rename_at_29)) )
+				{
+					DAS_ASSERT(((*__yyy_rename_at_29).a == 5));
+					{
+						bool __need_loop_31 = true;
+						// t : int const
+						das_iterator<range> __t_iterator(range(0,3));
+						int32_t __t_rename_at_31;
+						__need_loop_31 = __t_iterator.first(__context__,(__t_rename_at_31)) && __need_loop_31;
+						for ( ; __need_loop_31 ; __need_loop_31 = __t_iterator.next(__context__,(__t_rename_at_31)) )
+						{
+							DAS_ASSERT(((*__yyy_rename_at_29).b(__t_rename_at_31,__context__) == __t_rename_at_31));
+						}
+						__t_iterator.close(__context__,(__t_rename_at_31));
+					};
+				}
+				__yyy_iterator.close(__context__,(__yyy_rename_at_29));
+			};
+		}
+		__yy_iterator.close(__context__,(__yy_rename_at_28));
+	};
+}
+
+inline void test_clone_struct_8a5a4ebf41a6b13c ( Context * __context__ )
+{
+	Foo __x_rename_at_36; das_zero(__x_rename_at_36); Foo __y_rename_at_36; das_zero(__y_rename_at_36);
+	das_copy(__x_rename_at_36.a,5);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__x_rename_at_36.b),3);
+	{
+		bool __need_loop_39 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_39;
+		__need_loop_39 = __t_iterator.first(__context__,(__t_rename_at_39)) && __need_loop_39;
+		for ( ; __need_loop_39 ; __need_loop_39 = __t_iterator.next(__context__,(__t_rename_at_39)) )
+		{
+			das_copy(__x_rename_at_36.b(__t_rename_at_39,__context__),__t_rename_at_39);
+		}
+		__t_iterator.close(__context__,(__t_rename_at_39));
+	};
+	clone_e65bfbe52285b9f1(__context__,das_arg<Foo>::pass(__y_rename_at_36),das_arg<Foo>::pass(__x_rename_at_36));
+	das_copy(__x_rename_at_36.a,6);
+	{
+		bool __need_loop_43 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_43;
+		__need_loop_43 = __t_iterator.first(__context__,(__t_rename_at_43)) && __need_loop_43;
+		for ( ; __need_loop_43 ; __need_loop_43 = __t_iterator.next(__context__,(__t_rename_at_43)) )
+		{
+			das_copy(__x_rename_at_36.b(__t_rename_at_43,__context__),__t_rename_at_43 + 1);
+		}
+		__t_iterator.close(__context__,(__t_rename_at_43));
+	};
+	DAS_ASSERT((__y_rename_at_36.a == 5));
+	{
+		bool __need_loop_46 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_46;
+		__need_loop_46 = __t_iterator.first(__context__,(__t_rename_at_46)) && __need_loop_46;
+		for ( ; __need_loop_46 ; __need_loop_46 = __t_iterator.next(__context__,(__t_rename_at_46)) )
+		{
+			DAS_ASSERT((__y_rename_at_36.b(__t_rename_at_46,__context__) == __t_rename_at_46));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_46));
+	};
+}
+
+inline void test_clone_array_776de11bedecce23 ( Context * __context__ )
+{
+	TArray<int32_t> __x_rename_at_51; das_zero(__x_rename_at_51); TArray<int32_t> __y_rename_at_51; das_zero(__y_rename_at_51);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__x_rename_at_51),3);
+	{
+		bool __need_loop_53 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_53;
+		__need_loop_53 = __t_iterator.first(__context__,(__t_rename_at_53)) && __need_loop_53;
+		for ( ; __need_loop_53 ; __need_loop_53 = __t_iterator.next(__context__,(__t_rename_at_53)) )
+		{
+			das_copy(__x_rename_at_51(__t_rename_at_53,__context__),__t_rename_at_53);
+		}
+		__t_iterator.close(__context__,(__t_rename_at_53));
+	};
+	_Funcbuiltin_0x60_clone_7775f70b42a34990(__context__,das_arg<TArray<int32_t>>::pass(__y_rename_at_51),das_arg<TArray<int32_t>>::pass(__x_rename_at_51));
+	{
+		bool __need_loop_56 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_56;
+		__need_loop_56 = __t_iterator.first(__context__,(__t_rename_at_56)) && __need_loop_56;
+		for ( ; __need_loop_56 ; __need_loop_56 = __t_iterator.next(__context__,(__t_rename_at_56)) )
+		{
+			das_copy(__x_rename_at_51(__t_rename_at_56,__context__),__t_rename_at_56 + 1);
+		}
+		__t_iterator.close(__context__,(__t_rename_at_56));
+	};
+	{
+		bool __need_loop_58 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_58;
+		__need_loop_58 = __t_iterator.first(__context__,(__t_rename_at_58)) && __need_loop_58;
+		for ( ; __need_loop_58 ; __need_loop_58 = __t_iterator.next(__context__,(__t_rename_at_58)) )
+		{
+			DAS_VERIFY((__y_rename_at_51(__t_rename_at_58,__context__) == __t_rename_at_58));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_58));
+	};
+}
+
+inline void test_clone_table_c1095dab5e9b6f9d ( Context * __context__ )
+{
+	TTable<int32_t,char *> __x_rename_at_63; das_zero(__x_rename_at_63); TTable<int32_t,char *> __y_rename_at_63; das_zero(__y_rename_at_63);
+	{
+		bool __need_loop_64 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_64;
+		__need_loop_64 = __t_iterator.first(__context__,(__t_rename_at_64)) && __need_loop_64;
+		for ( ; __need_loop_64 ; __need_loop_64 = __t_iterator.next(__context__,(__t_rename_at_64)) )
+		{
+			das_copy(__x_rename_at_63(__t_rename_at_64,__context__),((char *)(das_lexical_cast(__t_rename_at_64,__context__))));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_64));
+	};
+	_Funcbuiltin_0x60_clone_ee419a657d926a66(__context__,das_arg<TTable<int32_t,char *>>::pass(__y_rename_at_63),das_arg<TTable<int32_t,char *>>::pass(__x_rename_at_63));
+	{
+		bool __need_loop_67 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_67;
+		__need_loop_67 = __t_iterator.first(__context__,(__t_rename_at_67)) && __need_loop_67;
+		for ( ; __need_loop_67 ; __need_loop_67 = __t_iterator.next(__context__,(__t_rename_at_67)) )
+		{
+			das_copy(__x_rename_at_63(__t_rename_at_67,__context__),((char *)(das_lexical_cast(__t_rename_at_67 + 1,__context__))));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_67));
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,char *>>::pass(__y_rename_at_63)) == 3));
+	{
+		bool __need_loop_70 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_70;
+		__need_loop_70 = __t_iterator.first(__context__,(__t_rename_at_70)) && __need_loop_70;
+		for ( ; __need_loop_70 ; __need_loop_70 = __t_iterator.next(__context__,(__t_rename_at_70)) )
+		{
+			DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(__y_rename_at_63(__t_rename_at_70,__context__)),cast<char *>::from(((char *)(das_lexical_cast(__t_rename_at_70,__context__)))),*__context__,nullptr)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_70));
+	};
+}
+
+inline bool test_6f2216df10db91a ( Context * __context__ )
+{
+	test_clone_array_776de11bedecce23(__context__);
+	test_clone_table_c1095dab5e9b6f9d(__context__);
+	test_clone_struct_8a5a4ebf41a6b13c(__context__);
+	test_clone_complex_5ec1711386116abc(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void test_if_compiles_66fea59ea2660af0 ( Context * __context__, das::vector<TestObjectFoo> &  __a_rename_at_82, TestObjectFoo const  &  __b_rename_at_82 )
+{
+	_Funcbuiltin_0x60_push_clone_543073cfd297b3d0(__context__,das_arg<das::vector<TestObjectFoo>>::pass(__a_rename_at_82),__b_rename_at_82);
+}
+
+inline void clone_e65bfbe52285b9f1 ( Context * __context__, Foo &  __a_rename_at_4, Foo const  &  __b_rename_at_4 )
+{
+	das_copy(__a_rename_at_4.a,__b_rename_at_4.a);
+	_Funcbuiltin_0x60_clone_7775f70b42a34990(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_4.b),__b_rename_at_4.b);
+}
+
+inline void clone_7a40ab073ad58680 ( Context * __context__, Bar &  __a_rename_at_8, Bar const  &  __b_rename_at_8 )
+{
+	_Funcbuiltin_0x60_clone_db640d19fa3ad019(__context__,das_arg<TArray<Foo>>::pass(__a_rename_at_8.z),__b_rename_at_8.z);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_clone_to_move_7b6fdaec8fc45a5b
+	aotLib[0x38d4c2af5595beed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TestObjectFoo (*) ( Context * __context__, TestObjectFoo const  &  ),&_Funcbuiltin_0x60_clone_to_move_7b6fdaec8fc45a5b>>();
+	};
+	// _Funcbuiltin_0x60_clone_db640d19fa3ad019
+	aotLib[0x23f39ff05ad6f0e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Foo> & , TArray<Foo> const  &  ),&_Funcbuiltin_0x60_clone_db640d19fa3ad019>>();
+	};
+	// _Funcbuiltin_0x60_keys_4b0e5a3ba1726cd0
+	aotLib[0xae941eadb2fd9b7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TTable<int32_t,char *> const  &  ),&_Funcbuiltin_0x60_keys_4b0e5a3ba1726cd0>>();
+	};
+	// _Funcbuiltin_0x60_values_919927a1c0562562
+	aotLib[0x74c36d37cdd00755] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char * const  &)) (*) ( Context * __context__, TTable<int32_t,char *> const  &  ),&_Funcbuiltin_0x60_values_919927a1c0562562>>();
+	};
+	// _Funcbuiltin_0x60_clone_61ceee925c56f87e
+	aotLib[0xbeccc0179683679d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Bar> & , TArray<Bar> const  &  ),&_Funcbuiltin_0x60_clone_61ceee925c56f87e>>();
+	};
+	// _Funcbuiltin_0x60_clone_7775f70b42a34990
+	aotLib[0xbde965effb9cac8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_7775f70b42a34990>>();
+	};
+	// _Funcbuiltin_0x60_clone_ee419a657d926a66
+	aotLib[0xb2decc8405002d17] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,char *> & , TTable<int32_t,char *> const  &  ),&_Funcbuiltin_0x60_clone_ee419a657d926a66>>();
+	};
+	// _Funcbuiltin_0x60_resize_c16f01fd6d208a74
+	aotLib[0x9bc04f7e8f97d571] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Bar> & , int32_t  ),&_Funcbuiltin_0x60_resize_c16f01fd6d208a74>>();
+	};
+	// _Funcbuiltin_0x60_resize_a9e21d21471bf80d
+	aotLib[0xa0b1177f5c7a0955] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Foo> & , int32_t  ),&_Funcbuiltin_0x60_resize_a9e21d21471bf80d>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_push_clone_543073cfd297b3d0
+	aotLib[0x365931fb45205489] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, das::vector<TestObjectFoo> & , TestObjectFoo const  &  ),&_Funcbuiltin_0x60_push_clone_543073cfd297b3d0>>();
+	};
+	// test_clone_complex_5ec1711386116abc
+	aotLib[0x14621648edb0f9a8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_clone_complex_5ec1711386116abc>>();
+	};
+	// test_clone_struct_8a5a4ebf41a6b13c
+	aotLib[0xb75c07651b5668dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_clone_struct_8a5a4ebf41a6b13c>>();
+	};
+	// test_clone_array_776de11bedecce23
+	aotLib[0x10e19b963294c1a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_clone_array_776de11bedecce23>>();
+	};
+	// test_clone_table_c1095dab5e9b6f9d
+	aotLib[0xc4e6256105f60072] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_clone_table_c1095dab5e9b6f9d>>();
+	};
+	// test_6f2216df10db91a
+	aotLib[0x63d05bc9d38f34e3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_6f2216df10db91a>>();
+	};
+	// test_if_compiles_66fea59ea2660af0
+	aotLib[0x89778a8806fecfaf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, das::vector<TestObjectFoo> & , TestObjectFoo const  &  ),&test_if_compiles_66fea59ea2660af0>>();
+	};
+	// clone_e65bfbe52285b9f1
+	aotLib[0x2cd1191f27136185] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , Foo const  &  ),&clone_e65bfbe52285b9f1>>();
+	};
+	// clone_7a40ab073ad58680
+	aotLib[0x42733c9b95cf636f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Bar & , Bar const  &  ),&clone_7a40ab073ad58680>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
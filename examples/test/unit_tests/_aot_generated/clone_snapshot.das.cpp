@@ -0,0 +1,769 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require jobque
+#include "daScript/simulate/aot_builtin_jobque.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+ // require templates
+ // require contracts
+ // require array_boost
+ // require algorithm
+ // require templates_boost
+ // require macro_boost
+ // require jobque_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14280555633328585482 {
+
+extern StructInfo __struct_info__e6c8212658088af3;
+extern StructInfo __struct_info__d2b71f49948c4583;
+extern StructInfo __struct_info__59d54b819dfa3cc0;
+extern StructInfo __struct_info__f1cb2e1499875766;
+extern TypeInfo __type_info__89f87fddfa254636;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63df4c8601f1a5;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__f91883f6c475d097;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__cac3a3d5f4cf9563;
+extern TypeInfo __type_info__1ded84d93070eba;
+extern TypeInfo __type_info__4630f2fae4250c00;
+extern TypeInfo __type_info__eb3b75e283b2a1da;
+extern VarInfo __var_info__93643661d5bb9ea5;
+extern VarInfo __var_info__51645d10530b44d7;
+extern VarInfo __var_info__9a728dffab253280;
+extern VarInfo __var_info__a92c23c677f7d669;
+extern VarInfo __var_info__9ff7fc440bcb18b0;
+extern VarInfo __var_info__89d92102eb1f32d6;
+extern VarInfo __var_info__7acd25fd6657eca0;
+extern VarInfo __var_info__31a87fc2ac27ca15;
+extern VarInfo __var_info__ff59f84717a28521;
+extern VarInfo __var_info__3434fefff2b75a22;
+extern VarInfo __var_info__c68ce48f6c3a8ae9;
+extern VarInfo __var_info__21d72a0780fadd80;
+extern VarInfo __var_info__503fa3545a521adb;
+extern FuncInfo __func_info__9bb9781e74ff2424;
+extern FuncInfo __func_info__cfb81a8365a0ae64;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+VarInfo __struct_info__e6c8212658088af3_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x3434fefff2b75a22), "__rtti", 0 };
+TypeInfo * __type_info__31a87fc2ac27ca15_arg_types_var_16629578072634985203[1] = { &__type_info__4630f2fae4250c00 };
+VarInfo __struct_info__e6c8212658088af3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__31a87fc2ac27ca15_arg_types_var_16629578072634985203, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x31a87fc2ac27ca15), "__finalize", 8 };
+VarInfo __struct_info__e6c8212658088af3_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x21d72a0780fadd80), "count", 16 };
+TypeInfo * __type_info__503fa3545a521adb_arg_types_var_16629578072634985203[1] = { &__type_info__4630f2fae4250c00 };
+VarInfo __struct_info__e6c8212658088af3_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__503fa3545a521adb_arg_types_var_16629578072634985203, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x503fa3545a521adb), "inc", 24 };
+VarInfo * __struct_info__e6c8212658088af3_fields[4] =  { &__struct_info__e6c8212658088af3_field_0, &__struct_info__e6c8212658088af3_field_1, &__struct_info__e6c8212658088af3_field_2, &__struct_info__e6c8212658088af3_field_3 };
+StructInfo __struct_info__e6c8212658088af3 = {"Counter", "", 5, __struct_info__e6c8212658088af3_fields, 4, 32, UINT64_C(0x9d1c372fe94004c3), nullptr, UINT64_C(0xe6c8212658088af3) };
+TypeInfo * __type_info__7acd25fd6657eca0_arg_types_var_15183639069588211075[1] = { &__type_info__eb3b75e283b2a1da };
+VarInfo __struct_info__d2b71f49948c4583_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__7acd25fd6657eca0_arg_types_var_15183639069588211075, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x7acd25fd6657eca0), "__lambda", 0 };
+TypeInfo * __type_info__93643661d5bb9ea5_arg_types_var_15183639069588211075[1] = { &__type_info__1ded84d93070eba };
+VarInfo __struct_info__d2b71f49948c4583_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__93643661d5bb9ea5_arg_types_var_15183639069588211075, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x93643661d5bb9ea5), "__finalize", 8 };
+VarInfo __struct_info__d2b71f49948c4583_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__89f87fddfa254636, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x9a728dffab253280), "channel", 16 };
+VarInfo * __struct_info__d2b71f49948c4583_fields[3] =  { &__struct_info__d2b71f49948c4583_field_0, &__struct_info__d2b71f49948c4583_field_1, &__struct_info__d2b71f49948c4583_field_2 };
+StructInfo __struct_info__d2b71f49948c4583 = {"_lambda_thismodule_56_16_2", "", 6, __struct_info__d2b71f49948c4583_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0xd2b71f49948c4583) };
+TypeInfo * __type_info__ff59f84717a28521_arg_types_var_6473163059488242880[1] = { &__type_info__cac3a3d5f4cf9563 };
+VarInfo __struct_info__59d54b819dfa3cc0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__ff59f84717a28521_arg_types_var_6473163059488242880, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xff59f84717a28521), "__lambda", 0 };
+TypeInfo * __type_info__9ff7fc440bcb18b0_arg_types_var_6473163059488242880[1] = { &__type_info__f91883f6c475d097 };
+VarInfo __struct_info__59d54b819dfa3cc0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__9ff7fc440bcb18b0_arg_types_var_6473163059488242880, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x9ff7fc440bcb18b0), "__finalize", 8 };
+VarInfo __struct_info__59d54b819dfa3cc0_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__89f87fddfa254636, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x51645d10530b44d7), "channel", 16 };
+VarInfo * __struct_info__59d54b819dfa3cc0_fields[3] =  { &__struct_info__59d54b819dfa3cc0_field_0, &__struct_info__59d54b819dfa3cc0_field_1, &__struct_info__59d54b819dfa3cc0_field_2 };
+StructInfo __struct_info__59d54b819dfa3cc0 = {"_lambda_thismodule_50_16_1", "", 6, __struct_info__59d54b819dfa3cc0_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0x59d54b819dfa3cc0) };
+VarInfo __struct_info__f1cb2e1499875766_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xa92c23c677f7d669), "text", 0 };
+VarInfo * __struct_info__f1cb2e1499875766_fields[1] =  { &__struct_info__f1cb2e1499875766_field_0 };
+StructInfo __struct_info__f1cb2e1499875766 = {"State", "", 8, __struct_info__f1cb2e1499875766_fields, 1, 8, UINT64_C(0x0), nullptr, UINT64_C(0xf1cb2e1499875766) };
+VarInfo __func_info__9bb9781e74ff2424_field_0 =  { Type::tStructure, &__struct_info__f1cb2e1499875766, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16486, 8, UINT64_C(0x89d92102eb1f32d6), "s", 0 };
+VarInfo * __func_info__9bb9781e74ff2424_fields[1] =  { &__func_info__9bb9781e74ff2424_field_0 };
+FuncInfo __func_info__9bb9781e74ff2424 = {"invoke block<(s:State const#):void> const", "", __func_info__9bb9781e74ff2424_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x9bb9781e74ff2424), 0x0 };
+VarInfo __func_info__cfb81a8365a0ae64_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__89f87fddfa254636, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xc68ce48f6c3a8ae9), "channel", 0 };
+VarInfo * __func_info__cfb81a8365a0ae64_fields[1] =  { &__func_info__cfb81a8365a0ae64_field_0 };
+FuncInfo __func_info__cfb81a8365a0ae64 = {"invoke block<(channel:jobque::Channel?):void> const", "", __func_info__cfb81a8365a0ae64_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xcfb81a8365a0ae64), 0x0 };
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__89f87fddfa254636 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~jobque::Channel"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 224, UINT64_C(0x89f87fddfa254636) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63df4c8601f1a5 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf63df4c8601f1a5) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__f91883f6c475d097 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cac3a3d5f4cf9563, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xf91883f6c475d097) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+TypeInfo __type_info__cac3a3d5f4cf9563 = { Type::tStructure, &__struct_info__59d54b819dfa3cc0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 24, UINT64_C(0xcac3a3d5f4cf9563) };
+TypeInfo __type_info__1ded84d93070eba = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__eb3b75e283b2a1da, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x1ded84d93070eba) };
+TypeInfo __type_info__4630f2fae4250c00 = { Type::tStructure, &__struct_info__e6c8212658088af3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 32, UINT64_C(0x4630f2fae4250c00) };
+TypeInfo __type_info__eb3b75e283b2a1da = { Type::tStructure, &__struct_info__d2b71f49948c4583, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 24, UINT64_C(0xeb3b75e283b2a1da) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__89f87fddfa254636.resolveAnnotation();
+}
+
+TypeInfo * __tinfo_0[7] = { &__type_info__af63e44c8601fa24, &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13, &__type_info__af63e44c8601fa24, &__type_info__90f3d07b5a6ca13, &__type_info__af63e44c8601fa24 };
+TypeInfo * __tinfo_1[4] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_2[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_3[4] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63df4c8601f1a5, &__type_info__90f3d07b5a6ca13, &__type_info__af63e44c8601fa24 };
+TypeInfo * __tinfo_4[4] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63df4c8601f1a5, &__type_info__90f3d07b5a6ca13, &__type_info__af63e44c8601fa24 };
+TypeInfo * __tinfo_5[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63e44c8601fa24 };
+TypeInfo * __tinfo_6[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_7[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+namespace  { struct Node; };
+namespace  { struct State; };
+namespace  { struct Counter; };
+namespace  { struct _lambda_thismodule_50_16_1; };
+namespace  { struct _lambda_thismodule_56_16_2; };
+namespace  { struct _lambda_thismodule_50_16_1_new_job_clone; };
+namespace  { struct _lambda_thismodule_56_16_2_new_job_clone; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace templates { struct DecltypeMacro; };
+namespace templates { struct DecltypeNoRefMacro; };
+namespace templates { struct TemplateMacro; };
+namespace contracts { struct IsAnyType; };
+namespace contracts { struct IsAnyArrayMacro; };
+namespace contracts { struct IsDimMacro; };
+namespace contracts { struct IsNotDimMacro; };
+namespace contracts { struct IsAnyEnumMacro; };
+namespace contracts { struct IsAnyVectorType; };
+namespace contracts { struct IsAnyStructMacro; };
+namespace contracts { struct IsAnyNumericMacro; };
+namespace contracts { struct IsAnyWorkhorse; };
+namespace contracts { struct IsAnyWorkhorseNonPtrMacro; };
+namespace contracts { struct IsAnyTupleNonPtrMacro; };
+namespace contracts { struct IsAnyVariantNonPtrMacro; };
+namespace contracts { struct IsAnyFunctionNonPtrMacro; };
+namespace templates_boost { struct Template; };
+namespace templates_boost { struct TemplateVisitor; };
+namespace templates_boost { struct RemoveDerefVisitor; };
+namespace templates_boost { struct QRulesVisitor; };
+namespace templates_boost { struct AstQCallMacro; };
+namespace templates_boost { struct QMacro; };
+namespace templates_boost { struct QBlockMacro; };
+namespace templates_boost { struct QBlockExprMacro; };
+namespace templates_boost { struct QTypeMacro; };
+namespace templates_boost { struct AstQNamedMacro; };
+namespace templates_boost { struct AstQFunctionMacro; };
+namespace templates_boost { struct AstQVariableMacro; };
+namespace templates_boost { struct AstQNamedClassMacro; };
+namespace templates_boost { struct AstQMethodMacro; };
+namespace macro_boost { struct MacroVerifyMacro; };
+namespace jobque_boost { struct NewJobMacro; };
+namespace jobque_boost { struct ChannelAndStatusCapture; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+// unused structure DecltypeMacro
+// unused structure DecltypeNoRefMacro
+// unused structure TemplateMacro
+// unused structure IsAnyType
+// unused structure IsAnyArrayMacro
+// unused structure IsDimMacro
+// unused structure IsNotDimMacro
+// unused structure IsAnyEnumMacro
+// unused structure IsAnyVectorType
+// unused structure IsAnyStructMacro
+// unused structure IsAnyNumericMacro
+// unused structure IsAnyWorkhorse
+// unused structure IsAnyWorkhorseNonPtrMacro
+// unused structure IsAnyTupleNonPtrMacro
+// unused structure IsAnyVariantNonPtrMacro
+// unused structure IsAnyFunctionNonPtrMacro
+// unused structure Template
+// unused structure TemplateVisitor
+// unused structure RemoveDerefVisitor
+// unused structure QRulesVisitor
+// unused structure AstQCallMacro
+// unused structure QMacro
+// unused structure QBlockMacro
+// unused structure QBlockExprMacro
+// unused structure QTypeMacro
+// unused structure AstQNamedMacro
+// unused structure AstQFunctionMacro
+// unused structure AstQVariableMacro
+// unused structure AstQNamedClassMacro
+// unused structure AstQMethodMacro
+// unused structure MacroVerifyMacro
+// unused structure NewJobMacro
+// unused structure ChannelAndStatusCapture
+namespace  {
+
+struct Node {
+	char * name;
+	Node * next;
+};
+static_assert(sizeof(Node)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Node,name)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,next)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct State {
+	char * text;
+};
+static_assert(sizeof(State)==8,"structure size mismatch with DAS");
+static_assert(offsetof(State,text)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Counter {
+	void * __rtti;
+	Func DAS_COMMENT((void,Counter)) __finalize;
+	int32_t count;
+	Func DAS_COMMENT((void,Counter)) inc;
+};
+static_assert(sizeof(Counter)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Counter,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Counter,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Counter,count)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Counter,inc)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_50_16_1 {
+	Func DAS_COMMENT((void,_lambda_thismodule_50_16_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_50_16_1 *)) __finalize;
+	Channel * channel;
+};
+static_assert(sizeof(_lambda_thismodule_50_16_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_16_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_16_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_16_1,channel)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_56_16_2 {
+	Func DAS_COMMENT((void,_lambda_thismodule_56_16_2)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_56_16_2 *)) __finalize;
+	Channel * channel;
+};
+static_assert(sizeof(_lambda_thismodule_56_16_2)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_16_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_16_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_16_2,channel)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_50_16_1_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_50_16_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_50_16_1 *)) __finalize;
+	Channel * channel;
+};
+static_assert(sizeof(_lambda_thismodule_50_16_1_new_job_clone)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_16_1_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_16_1_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_16_1_new_job_clone,channel)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_56_16_2_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_56_16_2)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_56_16_2 *)) __finalize;
+	Channel * channel;
+};
+static_assert(sizeof(_lambda_thismodule_56_16_2_new_job_clone)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_16_2_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_16_2_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_16_2_new_job_clone,channel)==16,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_d2e2a1ee13c5ed94 ( Context * __context__, _lambda_thismodule_50_16_1 & ____this_rename_at_50 );
+inline void finalize_c24c493e40e6ae59 ( Context * __context__, _lambda_thismodule_56_16_2 & ____this_rename_at_56 );
+inline void clone_c1053c4f0d20399f ( Context * __context__, _lambda_thismodule_50_16_1_new_job_clone & __a_rename_at_50, _lambda_thismodule_50_16_1_new_job_clone const  & __b_rename_at_50 );
+inline void clone_2b3003409d508b75 ( Context * __context__, _lambda_thismodule_56_16_2_new_job_clone & __a_rename_at_56, _lambda_thismodule_56_16_2_new_job_clone const  & __b_rename_at_56 );
+inline void _Funcjobque_boost_0x60_push_clone_afb84aef53f87c56 ( Context * __context__, Channel * const  __channel_rename_at_81, State const  & __data_rename_at_81 );
+inline void _Func_lambda_thismodule_50_16_1_0x60_function_c58164a35d2aa7fd ( Context * __context__, _lambda_thismodule_50_16_1 & ____this_rename_at_50 );
+inline void _Func_lambda_thismodule_50_16_1_0x60_finalizer_7762cd54f6a25058 ( Context * __context__, _lambda_thismodule_50_16_1 * ____this_rename_at_50 );
+inline void _Func_lambda_thismodule_56_16_2_0x60_function_35b55c9bdf6042bc ( Context * __context__, _lambda_thismodule_56_16_2 & ____this_rename_at_56 );
+inline void _Func_lambda_thismodule_56_16_2_0x60_finalizer_34241ae29dcd385e ( Context * __context__, _lambda_thismodule_56_16_2 * ____this_rename_at_56 );
+inline void _Funcjobque_boost_0x60_for_each_71a633776e4b6fab ( Context * __context__, Channel * const  __channel_rename_at_69, Block DAS_COMMENT((void,State const )) const  & __blk_rename_at_69 );
+inline void finalize_3b7a6918791ddc29 ( Context * __context__, Counter & ____this_rename_at_14 );
+inline void _Funcbuiltin_0x60_push_49bdd408ef1e4c5a ( Context * __context__, TArray<char *> & __Arr_rename_at_75, char * const  __value_rename_at_75 );
+inline void _FuncCounter_0x60_inc_84acc6a1620b7eda ( Context * __context__, Counter & __self_rename_at_16 );
+inline void _FuncCounter_0x27___finalize_c1dee0d3c107623b ( Context * __context__, Counter & __self_rename_at_14 );
+inline void init_globals_9b63c792455e52e5 ( Context * __context__ );
+inline char * snapshot_state_10b4efcd170d95be ( Context * __context__ );
+inline char * run_job_4c498aecec42fcfb ( Context * __context__, bool __thread_rename_at_45 );
+inline bool test_418458ccc019cab4 ( Context * __context__ );
+inline Counter Counter_fe888d3a80b845db ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x4f291c2b68aa5d3f>(__context__) = 1;/*g_int*/
+	das_global<char *,0x3fe49be7ac8554f9>(__context__) = ((char *) "init");/*g_name*/
+	das_global_zero<TArray<char *>,0x137a4c69e89c9a06>(__context__);/*g_names*/
+	das_global_zero<TTable<char *,int32_t>,0x46f095a20ee46842>(__context__);/*g_table*/
+	das_global_zero<Node *,0xb38b985ec3db01fc>(__context__);/*g_list*/
+	das_global_zero<Node *,0x556ac05bb58ef86>(__context__);/*g_same*/
+	das_global_zero<Counter *,0x6e9fb132c44fee1c>(__context__);/*g_counter*/
+	das_global_zero<int32_t *,0x4c4c3e0872d40dd0>(__context__);/*g_ptr*/
+	init_globals_9b63c792455e52e5(__context__);
+}
+
+inline void finalize_d2e2a1ee13c5ed94 ( Context * __context__, _lambda_thismodule_50_16_1 &  ____this_rename_at_50 )
+{
+	memset(&(____this_rename_at_50), 0, 24);
+}
+
+inline void finalize_c24c493e40e6ae59 ( Context * __context__, _lambda_thismodule_56_16_2 &  ____this_rename_at_56 )
+{
+	memset(&(____this_rename_at_56), 0, 24);
+}
+
+inline void clone_c1053c4f0d20399f ( Context * __context__, _lambda_thismodule_50_16_1_new_job_clone &  __a_rename_at_50, _lambda_thismodule_50_16_1_new_job_clone const  &  __b_rename_at_50 )
+{
+	das_copy(__a_rename_at_50.__lambda,__b_rename_at_50.__lambda);
+	das_copy(__a_rename_at_50.__finalize,__b_rename_at_50.__finalize);
+	das_copy(__a_rename_at_50.channel,__b_rename_at_50.channel);
+}
+
+inline void clone_2b3003409d508b75 ( Context * __context__, _lambda_thismodule_56_16_2_new_job_clone &  __a_rename_at_56, _lambda_thismodule_56_16_2_new_job_clone const  &  __b_rename_at_56 )
+{
+	das_copy(__a_rename_at_56.__lambda,__b_rename_at_56.__lambda);
+	das_copy(__a_rename_at_56.__finalize,__b_rename_at_56.__finalize);
+	das_copy(__a_rename_at_56.channel,__b_rename_at_56.channel);
+}
+
+inline void _Funcjobque_boost_0x60_push_clone_afb84aef53f87c56 ( Context * __context__, Channel * const  __channel_rename_at_81, State const  &  __data_rename_at_81 )
+{
+	State * __heap_data_rename_at_83 = das_new<State>::make(__context__);
+	das_copy(das_deref(__context__,__heap_data_rename_at_83),__data_rename_at_81);
+	channelPush(__channel_rename_at_81,das_auto_cast<void * const >::cast(__heap_data_rename_at_83),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_50_16_1_0x60_function_c58164a35d2aa7fd ( Context * __context__, _lambda_thismodule_50_16_1 &  ____this_rename_at_50 )
+{
+	State _temp_make_local_50_32;
+/* finally */ auto __finally_50= das_finally([&](){
+	das_invoke_function<void>::invoke<Channel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::release_capture_jobque_channel C1<H<jobque::Channel>>?*/ 5115173217570402306u)),____this_rename_at_50.channel);
+/* end finally */ });
+	_Funcjobque_boost_0x60_push_clone_afb84aef53f87c56(__context__,____this_rename_at_50.channel,das_arg<State>::pass((([&]() -> State& {
+		das_copy((_temp_make_local_50_32.text),(snapshot_state_10b4efcd170d95be(__context__)));
+		return _temp_make_local_50_32;
+	})())));
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(das_global<TArray<char *>,0x137a4c69e89c9a06>(__context__) /*g_names*/),((char *) "local"));
+	das_invoke_function<void>::invoke<Counter &>(__context__,nullptr,das_global<Counter *,0x6e9fb132c44fee1c>(__context__) /*g_counter*/->inc,das_arg<Counter>::pass(das_cast<Counter>::cast(das_deref(__context__,das_global<Counter *,0x6e9fb132c44fee1c>(__context__) /*g_counter*/))));
+	notifyAndReleaseChannel(____this_rename_at_50.channel,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_50_16_1_0x60_finalizer_7762cd54f6a25058 ( Context * __context__, _lambda_thismodule_50_16_1 * ____this_rename_at_50 )
+{
+	finalize_d2e2a1ee13c5ed94(__context__,das_arg<_lambda_thismodule_50_16_1>::pass(das_deref(__context__,____this_rename_at_50)));
+	das_delete_lambda_struct<_lambda_thismodule_50_16_1 *>::clear(__context__,____this_rename_at_50);
+}
+
+inline void _Func_lambda_thismodule_56_16_2_0x60_function_35b55c9bdf6042bc ( Context * __context__, _lambda_thismodule_56_16_2 &  ____this_rename_at_56 )
+{
+	State _temp_make_local_56_32;
+/* finally */ auto __finally_56= das_finally([&](){
+	das_invoke_function<void>::invoke<Channel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::release_capture_jobque_channel C1<H<jobque::Channel>>?*/ 5115173217570402306u)),____this_rename_at_56.channel);
+/* end finally */ });
+	_Funcjobque_boost_0x60_push_clone_afb84aef53f87c56(__context__,____this_rename_at_56.channel,das_arg<State>::pass((([&]() -> State& {
+		das_copy((_temp_make_local_56_32.text),(snapshot_state_10b4efcd170d95be(__context__)));
+		return _temp_make_local_56_32;
+	})())));
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(das_global<TArray<char *>,0x137a4c69e89c9a06>(__context__) /*g_names*/),((char *) "local"));
+	das_invoke_function<void>::invoke<Counter &>(__context__,nullptr,das_global<Counter *,0x6e9fb132c44fee1c>(__context__) /*g_counter*/->inc,das_arg<Counter>::pass(das_cast<Counter>::cast(das_deref(__context__,das_global<Counter *,0x6e9fb132c44fee1c>(__context__) /*g_counter*/))));
+	notifyAndReleaseChannel(____this_rename_at_56.channel,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_56_16_2_0x60_finalizer_34241ae29dcd385e ( Context * __context__, _lambda_thismodule_56_16_2 * ____this_rename_at_56 )
+{
+	finalize_c24c493e40e6ae59(__context__,das_arg<_lambda_thismodule_56_16_2>::pass(das_deref(__context__,____this_rename_at_56)));
+	das_delete_lambda_struct<_lambda_thismodule_56_16_2 *>::clear(__context__,____this_rename_at_56);
+}
+
+inline void _Funcjobque_boost_0x60_for_each_71a633776e4b6fab ( Context * __context__, Channel * const  __channel_rename_at_69, Block DAS_COMMENT((void,State const )) const  &  __blk_rename_at_69 )
+{
+	while ( true )
+	{
+		void * __void_data_rename_at_74 = ((void *)channelPop(__channel_rename_at_69,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+		if ( __void_data_rename_at_74 == nullptr )
+		{
+			break;
+		} else {
+			State const  * __typed_data_rename_at_78 = ((State const  *)das_cast<State const  *>::cast(__void_data_rename_at_74));
+			das_invoke<void>::invoke<State const  &>(__context__,nullptr,__blk_rename_at_69,das_deref(__context__,__typed_data_rename_at_78));
+		};
+	};
+}
+
+inline void finalize_3b7a6918791ddc29 ( Context * __context__, Counter &  ____this_rename_at_14 )
+{
+	memset(&(____this_rename_at_14), 0, 32);
+}
+
+inline void _Funcbuiltin_0x60_push_49bdd408ef1e4c5a ( Context * __context__, TArray<char *> &  __Arr_rename_at_75, char * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<char *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _FuncCounter_0x60_inc_84acc6a1620b7eda ( Context * __context__, Counter &  __self_rename_at_16 )
+{
+	++__self_rename_at_16.count;
+}
+
+inline void _FuncCounter_0x27___finalize_c1dee0d3c107623b ( Context * __context__, Counter &  __self_rename_at_14 )
+{
+	finalize_3b7a6918791ddc29(__context__,das_arg<Counter>::pass(__self_rename_at_14));
+}
+
+inline void init_globals_9b63c792455e52e5 ( Context * __context__ )
+{
+	das_copy(das_global<int32_t,0x4f291c2b68aa5d3f>(__context__) /*g_int*/,2);
+}
+
+inline char * snapshot_state_10b4efcd170d95be ( Context * __context__ )
+{
+	char * __s_rename_at_33 = (char *)(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_0, cast<int32_t>::from(das_global<int32_t,0x4f291c2b68aa5d3f>(__context__) /*g_int*/), cast<char * const >::from(((char *) " ")), cast<char *>::from(das_global<char *,0x3fe49be7ac8554f9>(__context__) /*g_name*/), cast<char * const >::from(((char *) " ")), cast<int32_t>::from(builtin_array_size(das_arg<TArray<char *>>::pass(das_global<TArray<char *>,0x137a4c69e89c9a06>(__context__) /*g_names*/))), cast<char * const >::from(((char *) " ")), cast<int32_t>::from(builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(das_global<TTable<char *,int32_t>,0x46f095a20ee46842>(__context__) /*g_table*/))))));
+	{
+		bool __need_loop_34 = true;
+		// n : string&
+		das_iterator<TArray<char *>> __n_iterator(das_global<TArray<char *>,0x137a4c69e89c9a06>(__context__) /*g_names*/);
+		char * * __n_rename_at_34;
+		__need_loop_34 = __n_iterator.first(__context__,(__n_rename_at_34)) && __need_loop_34;
+		for ( ; __need_loop_34 ; __need_loop_34 = __n_iterator.next(__context__,(__n_rename_at_34)) )
+		{
+			SimPolicy<char *>::SetAdd((char *)&(__s_rename_at_33),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_1, cast<char * const >::from(((char *) " ")), cast<char *>::from((*__n_rename_at_34)), cast<char * const >::from(((char *) "=")), cast<int32_t>::from(das_null_coalescing<int32_t>::get(TTable<char *,int32_t>::safe_index(&(das_global<TTable<char *,int32_t>,0x46f095a20ee46842>(__context__) /*g_table*/),(*__n_rename_at_34),__context__),-1))))),*__context__,nullptr);
+		}
+		__n_iterator.close(__context__,(__n_rename_at_34));
+	};
+	Node * __n_rename_at_36 = das_global<Node *,0xb38b985ec3db01fc>(__context__) /*g_list*/;
+	while ( __n_rename_at_36 != nullptr )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__s_rename_at_33),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<char * const >::from(((char *) " ")), cast<char *>::from(__n_rename_at_36->name)))),*__context__,nullptr);
+		das_copy(__n_rename_at_36,__n_rename_at_36->next);
+	};
+	SimPolicy<char *>::SetAdd((char *)&(__s_rename_at_33),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_3, cast<char * const >::from(((char *) " ")), cast<bool>::from((das_global<Node *,0x556ac05bb58ef86>(__context__) /*g_same*/ == das_global<Node *,0xb38b985ec3db01fc>(__context__) /*g_list*/->next)), cast<char * const >::from(((char *) " ")), cast<int32_t>::from(das_global<Counter *,0x6e9fb132c44fee1c>(__context__) /*g_counter*/->count)))),*__context__,nullptr);
+	SimPolicy<char *>::SetAdd((char *)&(__s_rename_at_33),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_4, cast<char * const >::from(((char *) " ")), cast<bool>::from((das_global<int32_t *,0x4c4c3e0872d40dd0>(__context__) /*g_ptr*/ == das_ref(__context__,das_global<int32_t,0x4f291c2b68aa5d3f>(__context__) /*g_int*/))), cast<char * const >::from(((char *) " ")), cast<int32_t>::from(das_deref(__context__,das_global<int32_t *,0x4c4c3e0872d40dd0>(__context__) /*g_ptr*/))))),*__context__,nullptr);
+	return das_auto_cast<char *>::cast(__s_rename_at_33);
+}
+
+inline char * run_job_4c498aecec42fcfb ( Context * __context__, bool __thread_rename_at_45 ) { das_stack_prologue __prologue(__context__,208,"run_job " DAS_FILE_LINE);
+{
+	char * __res_rename_at_46 = (char *)(nullptr);
+	withChannelEx(1,das_make_block<void,Channel *>(__context__,96,0,&__func_info__cfb81a8365a0ae64,[&](Channel * __channel_rename_at_47)->void{
+		if ( __thread_rename_at_45 )
+		{
+			new_thread_invoke(das_ascend<void,_lambda_thismodule_50_16_1>::make(__context__,&__type_info__cac3a3d5f4cf9563,(([&]() -> _lambda_thismodule_50_16_1 {
+				_lambda_thismodule_50_16_1 __mks_50;
+				das_copy((__mks_50.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_50_16_1`function XS<::_lambda_thismodule_50_16_1>*/ 9558662328384689576u))));
+				das_copy((__mks_50.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_50_16_1`finalizer X1<S<::_lambda_thismodule_50_16_1>>?*/ 2474329811733319248u))));
+				das_copy((__mks_50.channel),(das_invoke_function<Channel *>::invoke<Channel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::capture_jobque_channel C1<H<jobque::Channel>>?*/ 14129945787985015456u)),__channel_rename_at_47)));
+				return __mks_50;
+			})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_50_16_1_new_job_clone> CIS<::_lambda_thismodule_50_16_1_new_job_clone>*/ 7848840416307563970u)),24,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		} else {
+			new_job_invoke(das_ascend<void,_lambda_thismodule_56_16_2>::make(__context__,&__type_info__eb3b75e283b2a1da,(([&]() -> _lambda_thismodule_56_16_2 {
+				_lambda_thismodule_56_16_2 __mks_56;
+				das_copy((__mks_56.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_56_16_2`function XS<::_lambda_thismodule_56_16_2>*/ 8767060131429847330u))));
+				das_copy((__mks_56.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_56_16_2`finalizer X1<S<::_lambda_thismodule_56_16_2>>?*/ 5319645892030703496u))));
+				das_copy((__mks_56.channel),(das_invoke_function<Channel *>::invoke<Channel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::capture_jobque_channel C1<H<jobque::Channel>>?*/ 14129945787985015456u)),__channel_rename_at_47)));
+				return __mks_56;
+			})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_56_16_2_new_job_clone> CIS<::_lambda_thismodule_56_16_2_new_job_clone>*/ 13382800241547434378u)),24,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		};
+		_Funcjobque_boost_0x60_for_each_71a633776e4b6fab(__context__,__channel_rename_at_47,das_make_block<void,State const  &>(__context__,192,0,&__func_info__9bb9781e74ff2424,[&](State const  & __s_rename_at_60)->void{
+			das_copy(__res_rename_at_46,((char *)(builtin_string_clone(__s_rename_at_60.text,__context__))));
+		}));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<char *>::cast(__res_rename_at_46);
+}}
+
+inline bool test_418458ccc019cab4 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,208,"test " DAS_FILE_LINE);
+{
+	das_copy(das_global<int32_t,0x4f291c2b68aa5d3f>(__context__) /*g_int*/,3);
+	das_copy(das_global<char *,0x3fe49be7ac8554f9>(__context__) /*g_name*/,das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_5, cast<char * const >::from(((char *) "parent_")), cast<int32_t>::from(das_global<int32_t,0x4f291c2b68aa5d3f>(__context__) /*g_int*/))));
+	{
+		bool __need_loop_68 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,3));
+		int32_t __i_rename_at_68;
+		__need_loop_68 = __i_iterator.first(__context__,(__i_rename_at_68)) && __need_loop_68;
+		for ( ; __need_loop_68 ; __need_loop_68 = __i_iterator.next(__context__,(__i_rename_at_68)) )
+		{
+			_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(das_global<TArray<char *>,0x137a4c69e89c9a06>(__context__) /*g_names*/),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_6, cast<char * const >::from(((char *) "n")), cast<int32_t>::from(__i_rename_at_68))));
+			das_copy(das_global<TTable<char *,int32_t>,0x46f095a20ee46842>(__context__) /*g_table*/(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_7, cast<char * const >::from(((char *) "n")), cast<int32_t>::from(__i_rename_at_68))),__context__),__i_rename_at_68 * 10);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_68));
+	};
+	das_copy(das_global<Node *,0xb38b985ec3db01fc>(__context__) /*g_list*/,das_ascend<Node,Node>::make(__context__,nullptr,(([&]() -> Node {
+		Node __mks_71;
+		das_copy((__mks_71.name),(((char *) "a")));
+		das_copy((__mks_71.next),(das_ascend<Node,Node>::make(__context__,nullptr,(([&]() -> Node {
+			Node __mks_71;
+			das_copy((__mks_71.name),(((char *) "b")));
+			das_copy((__mks_71.next),(das_ascend<Node,Node>::make(__context__,nullptr,(([&]() -> Node {
+				Node __mks_71;
+				das_zero(__mks_71);
+				das_copy((__mks_71.name),(((char *) "c")));
+				return __mks_71;
+			})()))));
+			return __mks_71;
+		})()))));
+		return __mks_71;
+	})())));
+	das_copy(das_global<Node *,0x556ac05bb58ef86>(__context__) /*g_same*/,das_global<Node *,0xb38b985ec3db01fc>(__context__) /*g_list*/->next);
+	das_copy(das_global<Counter *,0x6e9fb132c44fee1c>(__context__) /*g_counter*/,das_new<Counter>::make_and_init(__context__,[&]() { return Counter_fe888d3a80b845db(__context__); }));
+	das_invoke_function<void>::invoke<Counter &>(__context__,nullptr,das_global<Counter *,0x6e9fb132c44fee1c>(__context__) /*g_counter*/->inc,das_arg<Counter>::pass(das_cast<Counter>::cast(das_deref(__context__,das_global<Counter *,0x6e9fb132c44fee1c>(__context__) /*g_counter*/))));
+	das_copy(das_global<int32_t *,0x4c4c3e0872d40dd0>(__context__) /*g_ptr*/,das_ref(__context__,das_global<int32_t,0x4f291c2b68aa5d3f>(__context__) /*g_int*/));
+	char * __expected_rename_at_77 = ((char *)(char *)(snapshot_state_10b4efcd170d95be(__context__)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(__expected_rename_at_77),cast<char *>::from(((char *) "3 parent_3 3 3 n0=0 n1=10 n2=20 a b c true 1 true 3")),*__context__,nullptr)));
+	withJobQue(das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		TDim<bool,3> _temp_make_local_80_160;
+		{
+			bool __need_loop_80 = true;
+			// t : bool&
+			das_iterator<TDim<bool,3>> __t_iterator((([&]() -> TDim<bool,3>& {
+				_temp_make_local_80_160(0,__context__) = false;
+				_temp_make_local_80_160(1,__context__) = true;
+				_temp_make_local_80_160(2,__context__) = false;
+				return _temp_make_local_80_160;
+			})()));
+			bool * __t_rename_at_80;
+			__need_loop_80 = __t_iterator.first(__context__,(__t_rename_at_80)) && __need_loop_80;
+			for ( ; __need_loop_80 ; __need_loop_80 = __t_iterator.next(__context__,(__t_rename_at_80)) )
+			{
+				DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(run_job_4c498aecec42fcfb(__context__,(*__t_rename_at_80))),cast<char *>::from(__expected_rename_at_77),*__context__,nullptr)));
+			}
+			__t_iterator.close(__context__,(__t_rename_at_80));
+		};
+		_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(das_global<TArray<char *>,0x137a4c69e89c9a06>(__context__) /*g_names*/),((char *) "n3"));
+		das_copy(das_global<TTable<char *,int32_t>,0x46f095a20ee46842>(__context__) /*g_table*/(((char *) "n3"),__context__),30);
+		das_copy(das_global<int32_t,0x4f291c2b68aa5d3f>(__context__) /*g_int*/,4);
+		das_invoke_function<void>::invoke<Counter &>(__context__,nullptr,das_global<Counter *,0x6e9fb132c44fee1c>(__context__) /*g_counter*/->inc,das_arg<Counter>::pass(das_cast<Counter>::cast(das_deref(__context__,das_global<Counter *,0x6e9fb132c44fee1c>(__context__) /*g_counter*/))));
+		char * __updated_rename_at_87 = ((char *)(char *)(snapshot_state_10b4efcd170d95be(__context__)));
+		DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(__updated_rename_at_87),cast<char *>::from(((char *) "4 parent_3 4 4 n0=0 n1=10 n2=20 n3=30 a b c true 2 true 4")),*__context__,nullptr)));
+		DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(run_job_4c498aecec42fcfb(__context__,false)),cast<char *>::from(__updated_rename_at_87),*__context__,nullptr)));
+		DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(run_job_4c498aecec42fcfb(__context__,true)),cast<char *>::from(__updated_rename_at_87),*__context__,nullptr)));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_VERIFY((builtin_array_size(das_arg<TArray<char *>>::pass(das_global<TArray<char *>,0x137a4c69e89c9a06>(__context__) /*g_names*/)) == 4));
+	DAS_VERIFY((das_global<Counter *,0x6e9fb132c44fee1c>(__context__) /*g_counter*/->count == 2));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline Counter Counter_fe888d3a80b845db ( Context * __context__ )
+{
+	return das_auto_cast_ref<Counter>::cast((([&]() -> Counter {
+		Counter __mks_14;
+		das_copy((__mks_14.__rtti),(((void *)(&__type_info__4630f2fae4250c00))));
+		das_copy((__mks_14.__finalize),(Func(__context__->fnByMangledName(/*Counter'__finalize S<::Counter>*/ 3614264528925086469u))));
+		das_copy((__mks_14.count),(0));
+		das_copy((__mks_14.inc),(Func(__context__->fnByMangledName(/*Counter`inc S<::Counter>*/ 6025700122797439732u))));
+		return __mks_14;
+	})()));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_d2e2a1ee13c5ed94
+	aotLib[0xc2c9393c74eaa399] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_50_16_1 &  ),&finalize_d2e2a1ee13c5ed94>>();
+	};
+	// finalize_c24c493e40e6ae59
+	aotLib[0xe098799b7d412489] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_56_16_2 &  ),&finalize_c24c493e40e6ae59>>();
+	};
+	// clone_c1053c4f0d20399f
+	aotLib[0xe17469fca48620c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_50_16_1_new_job_clone & , _lambda_thismodule_50_16_1_new_job_clone const  &  ),&clone_c1053c4f0d20399f>>();
+	};
+	// clone_2b3003409d508b75
+	aotLib[0x2d140a70ae9ab511] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_56_16_2_new_job_clone & , _lambda_thismodule_56_16_2_new_job_clone const  &  ),&clone_2b3003409d508b75>>();
+	};
+	// _Funcjobque_boost_0x60_push_clone_afb84aef53f87c56
+	aotLib[0x35384aa8c30e8c69] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Channel * const  , State const  &  ),&_Funcjobque_boost_0x60_push_clone_afb84aef53f87c56>>();
+	};
+	// _Func_lambda_thismodule_50_16_1_0x60_function_c58164a35d2aa7fd
+	aotLib[0x5faf5f1c25eaa884] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_50_16_1 &  ),&_Func_lambda_thismodule_50_16_1_0x60_function_c58164a35d2aa7fd>>();
+	};
+	// _Func_lambda_thismodule_50_16_1_0x60_finalizer_7762cd54f6a25058
+	aotLib[0xf6c427cd5beddadf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_50_16_1 *  ),&_Func_lambda_thismodule_50_16_1_0x60_finalizer_7762cd54f6a25058>>();
+	};
+	// _Func_lambda_thismodule_56_16_2_0x60_function_35b55c9bdf6042bc
+	aotLib[0x7be428b54897addc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_56_16_2 &  ),&_Func_lambda_thismodule_56_16_2_0x60_function_35b55c9bdf6042bc>>();
+	};
+	// _Func_lambda_thismodule_56_16_2_0x60_finalizer_34241ae29dcd385e
+	aotLib[0x6e6c05975dbda01f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_56_16_2 *  ),&_Func_lambda_thismodule_56_16_2_0x60_finalizer_34241ae29dcd385e>>();
+	};
+	// _Funcjobque_boost_0x60_for_each_71a633776e4b6fab
+	aotLib[0x5cef7351b3b7a2dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Channel * const  , Block DAS_COMMENT((void,State const )) const  &  ),&_Funcjobque_boost_0x60_for_each_71a633776e4b6fab>>();
+	};
+	// finalize_3b7a6918791ddc29
+	aotLib[0xb2044f443a35fcb1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Counter &  ),&finalize_3b7a6918791ddc29>>();
+	};
+	// _Funcbuiltin_0x60_push_49bdd408ef1e4c5a
+	aotLib[0xb187be2de84ea8d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const   ),&_Funcbuiltin_0x60_push_49bdd408ef1e4c5a>>();
+	};
+	// _FuncCounter_0x60_inc_84acc6a1620b7eda
+	aotLib[0x97829bb790081e95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Counter &  ),&_FuncCounter_0x60_inc_84acc6a1620b7eda>>();
+	};
+	// _FuncCounter_0x27___finalize_c1dee0d3c107623b
+	aotLib[0x40507d1272b5bd36] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Counter &  ),&_FuncCounter_0x27___finalize_c1dee0d3c107623b>>();
+	};
+	// init_globals_9b63c792455e52e5
+	aotLib[0x6382b9031f777bc1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&init_globals_9b63c792455e52e5>>();
+	};
+	// snapshot_state_10b4efcd170d95be
+	aotLib[0xe22394fdca8d7e39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__ ),&snapshot_state_10b4efcd170d95be>>();
+	};
+	// run_job_4c498aecec42fcfb
+	aotLib[0x4e08aa7649499feb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, bool  ),&run_job_4c498aecec42fcfb>>();
+	};
+	// test_418458ccc019cab4
+	aotLib[0xbfda889a111e341c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_418458ccc019cab4>>();
+	};
+	// Counter_fe888d3a80b845db
+	aotLib[0x98d1b14b5b350c97] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Counter (*) ( Context * __context__ ),&Counter_fe888d3a80b845db>>();
+	};
+	// [[ init script ]]
+	aotLib[0x7194b03a26e76745] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
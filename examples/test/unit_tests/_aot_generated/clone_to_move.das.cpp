@@ -0,0 +1,200 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14783573431244908829 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> & __a_rename_at_338, TArray<int32_t> const  & __b_rename_at_338 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline bool test_f1ee6e3a8ffb3252 ( Context * __context__ );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48 ( Context * __context__, TDim<int32_t,3> & __a_rename_at_518 );
+inline TArray<int32_t> _Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec ( Context * __context__, TArray<int32_t> const  & __clone_src_rename_at_325 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	TDim<int32_t,3> _temp_make_local_2_32;
+	das_global<TArray<int32_t>,0x647f922254a5baa8>(__context__) = _Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+		_temp_make_local_2_32(0,__context__) = 1;
+		_temp_make_local_2_32(1,__context__) = 2;
+		_temp_make_local_2_32(2,__context__) = 3;
+		return _temp_make_local_2_32;
+	})())));/*g_a*/
+	das_global<TArray<int32_t>,0x83e188816d7897bb>(__context__) = _Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec(__context__,das_global<TArray<int32_t>,0x647f922254a5baa8>(__context__) /*g_a*/);/*g_b*/
+}
+
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> &  __a_rename_at_338, TArray<int32_t> const  &  __b_rename_at_338 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_338),builtin_array_size(__b_rename_at_338));
+	{
+		bool __need_loop_340 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_338);
+		int32_t * __aV_rename_at_340;
+		__need_loop_340 = __aV_iterator.first(__context__,(__aV_rename_at_340)) && __need_loop_340;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_338);
+		int32_t const  * __bV_rename_at_340;
+		__need_loop_340 = __bV_iterator.first(__context__,(__bV_rename_at_340)) && __need_loop_340;
+		for ( ; __need_loop_340 ; __need_loop_340 = __aV_iterator.next(__context__,(__aV_rename_at_340)) && __bV_iterator.next(__context__,(__bV_rename_at_340)) )
+		{
+			das_copy((*__aV_rename_at_340),(*__bV_rename_at_340));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_340));
+		__bV_iterator.close(__context__,(__bV_rename_at_340));
+	};
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline bool test_f1ee6e3a8ffb3252 ( Context * __context__ )
+{
+	TDim<int32_t,3> _temp_make_local_10_96;
+	DAS_ASSERT(((builtin_array_size(das_global<TArray<int32_t>,0x647f922254a5baa8>(__context__) /*g_a*/) == 3) && (builtin_array_size(das_global<TArray<int32_t>,0x83e188816d7897bb>(__context__) /*g_b*/) == 3)));
+	{
+		bool __need_loop_8 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(das_global<TArray<int32_t>,0x647f922254a5baa8>(__context__) /*g_a*/);
+		int32_t const  * __x_rename_at_8;
+		__need_loop_8 = __x_iterator.first(__context__,(__x_rename_at_8)) && __need_loop_8;
+		// y : int const&
+		das_iterator<TArray<int32_t> const > __y_iterator(das_global<TArray<int32_t>,0x83e188816d7897bb>(__context__) /*g_b*/);
+		int32_t const  * __y_rename_at_8;
+		__need_loop_8 = __y_iterator.first(__context__,(__y_rename_at_8)) && __need_loop_8;
+		for ( ; __need_loop_8 ; __need_loop_8 = __x_iterator.next(__context__,(__x_rename_at_8)) && __y_iterator.next(__context__,(__y_rename_at_8)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_8) == (*__y_rename_at_8)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_8));
+		__y_iterator.close(__context__,(__y_rename_at_8));
+	};
+	TArray<int32_t> __a_rename_at_10_ConstRef; das_zero(__a_rename_at_10_ConstRef); das_move(__a_rename_at_10_ConstRef, ((TArray<int32_t>)_Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+		_temp_make_local_10_96(0,__context__) = 1;
+		_temp_make_local_10_96(1,__context__) = 2;
+		_temp_make_local_10_96(2,__context__) = 3;
+		return _temp_make_local_10_96;
+	})())))));
+	TArray<int32_t> const  & __a_rename_at_10 = __a_rename_at_10_ConstRef; ;
+	TArray<int32_t> __b_rename_at_11_ConstRef; das_zero(__b_rename_at_11_ConstRef); das_move(__b_rename_at_11_ConstRef, ((TArray<int32_t>)_Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec(__context__,__a_rename_at_10)));
+	TArray<int32_t> const  & __b_rename_at_11 = __b_rename_at_11_ConstRef; ;
+	DAS_ASSERT(((builtin_array_size(__a_rename_at_10) == 3) && (builtin_array_size(__b_rename_at_11) == 3)));
+	{
+		bool __need_loop_13 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_10);
+		int32_t const  * __x_rename_at_13;
+		__need_loop_13 = __x_iterator.first(__context__,(__x_rename_at_13)) && __need_loop_13;
+		// y : int const&
+		das_iterator<TArray<int32_t> const > __y_iterator(__b_rename_at_11);
+		int32_t const  * __y_rename_at_13;
+		__need_loop_13 = __y_iterator.first(__context__,(__y_rename_at_13)) && __need_loop_13;
+		for ( ; __need_loop_13 ; __need_loop_13 = __x_iterator.next(__context__,(__x_rename_at_13)) && __y_iterator.next(__context__,(__y_rename_at_13)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_13) == (*__y_rename_at_13)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_13));
+		__y_iterator.close(__context__,(__y_rename_at_13));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48 ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_518 )
+{
+	TArray<int32_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_519),3);
+	das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_519);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec ( Context * __context__, TArray<int32_t> const  &  __clone_src_rename_at_325 )
+{
+	TArray<int32_t> __clone_dest_rename_at_327; das_zero(__clone_dest_rename_at_327);
+	_Funcbuiltin_0x60_clone_7775f70b42a34990(__context__,das_arg<TArray<int32_t>>::pass(__clone_dest_rename_at_327),__clone_src_rename_at_325);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__clone_dest_rename_at_327);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_clone_7775f70b42a34990
+	aotLib[0xbde965effb9cac8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_7775f70b42a34990>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// test_f1ee6e3a8ffb3252
+	aotLib[0x65e152d07f020f09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f1ee6e3a8ffb3252>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48
+	aotLib[0xae43369ad2ed6a9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48>>();
+	};
+	// _Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec
+	aotLib[0xf79a059000c4b1dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec>>();
+	};
+	// [[ init script ]]
+	aotLib[0x964ff682a596e1d6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
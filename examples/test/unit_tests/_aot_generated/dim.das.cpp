@@ -0,0 +1,173 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_16923761888916085938 {
+
+extern TypeInfo __type_info__e3806530be947566;
+extern TypeInfo __type_info__424a5289fc94b1f0;
+
+uint32_t __type_info__e3806530be947566_dim[2] = { 2, 3 };
+TypeInfo __type_info__e3806530be947566 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 2, __type_info__e3806530be947566_dim, 286, 24, UINT64_C(0xe3806530be947566) };
+uint32_t __type_info__424a5289fc94b1f0_dim[1] = { 3 };
+TypeInfo __type_info__424a5289fc94b1f0 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__424a5289fc94b1f0_dim, 286, 12, UINT64_C(0x424a5289fc94b1f0) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__e3806530be947566 };
+TypeInfo * __tinfo_1[1] = { &__type_info__424a5289fc94b1f0 };
+TypeInfo * __tinfo_2[1] = { &__type_info__424a5289fc94b1f0 };
+
+inline bool test_35e2f6eb8a5eb6d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<TDim<TDim<float,3>,2>,0x86e4398085b25055>(__context__);/*a*/
+}
+
+inline bool test_35e2f6eb8a5eb6d ( Context * __context__ )
+{
+	{
+		bool __need_loop_10 = true;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,2));
+		int32_t __y_rename_at_10;
+		__need_loop_10 = __y_iterator.first(__context__,(__y_rename_at_10)) && __need_loop_10;
+		for ( ; __need_loop_10 ; __need_loop_10 = __y_iterator.next(__context__,(__y_rename_at_10)) )
+		{
+			{
+				bool __need_loop_11 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,3));
+				int32_t __x_rename_at_11;
+				__need_loop_11 = __x_iterator.first(__context__,(__x_rename_at_11)) && __need_loop_11;
+				for ( ; __need_loop_11 ; __need_loop_11 = __x_iterator.next(__context__,(__x_rename_at_11)) )
+				{
+					float __f_rename_at_12 = float((__y_rename_at_10 * 10) + __x_rename_at_11);
+					das_copy(das_global<TDim<TDim<float,3>,2>,0x86e4398085b25055>(__context__) /*a*/(__y_rename_at_10,__context__)(__x_rename_at_11,__context__),__f_rename_at_12);
+				}
+				__x_iterator.close(__context__,(__x_rename_at_11));
+			};
+		}
+		__y_iterator.close(__context__,(__y_rename_at_10));
+	};
+	{
+		bool __need_loop_15 = true;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,2));
+		int32_t __y_rename_at_15;
+		__need_loop_15 = __y_iterator.first(__context__,(__y_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __y_iterator.next(__context__,(__y_rename_at_15)) )
+		{
+			{
+				bool __need_loop_16 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,3));
+				int32_t __x_rename_at_16;
+				__need_loop_16 = __x_iterator.first(__context__,(__x_rename_at_16)) && __need_loop_16;
+				for ( ; __need_loop_16 ; __need_loop_16 = __x_iterator.next(__context__,(__x_rename_at_16)) )
+				{
+					float __f_rename_at_17 = float((__y_rename_at_15 * 10) + __x_rename_at_16);
+					DAS_ASSERT((das_global<TDim<TDim<float,3>,2>,0x86e4398085b25055>(__context__) /*a*/(__y_rename_at_15,__context__)(__x_rename_at_16,__context__) == __f_rename_at_17));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_16));
+			};
+		}
+		__y_iterator.close(__context__,(__y_rename_at_15));
+	};
+	float * __pa_rename_at_21 = das_ref(__context__,das_global<TDim<TDim<float,3>,2>,0x86e4398085b25055>(__context__) /*a*/(0,__context__)(0,__context__));
+	{
+		bool __need_loop_22 = true;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,2));
+		int32_t __y_rename_at_22;
+		__need_loop_22 = __y_iterator.first(__context__,(__y_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __y_iterator.next(__context__,(__y_rename_at_22)) )
+		{
+			{
+				bool __need_loop_23 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,3));
+				int32_t __x_rename_at_23;
+				__need_loop_23 = __x_iterator.first(__context__,(__x_rename_at_23)) && __need_loop_23;
+				for ( ; __need_loop_23 ; __need_loop_23 = __x_iterator.next(__context__,(__x_rename_at_23)) )
+				{
+					int32_t __o_rename_at_24 = (__x_rename_at_23 + (__y_rename_at_22 * 3));
+					float __f_rename_at_25 = float((__y_rename_at_22 * 10) + __x_rename_at_23);
+					DAS_ASSERT((das_index<float *>::at(__pa_rename_at_21,__o_rename_at_24,__context__) == __f_rename_at_25));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_23));
+			};
+		}
+		__y_iterator.close(__context__,(__y_rename_at_22));
+	};
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<TDim<TDim<float,3>,2> &>::from(das_global<TDim<TDim<float,3>,2>,0x86e4398085b25055>(__context__) /*a*/)))),cast<char *>::from(((char *) "[[ [[ 0.000000000; 1.000000000; 2.000000000]]; [[ 10.000000000; 11.000000000; 12.000000000]]]]")),*__context__,nullptr)));
+	TDim<float,3> __a0_rename_at_30 = das_global<TDim<TDim<float,3>,2>,0x86e4398085b25055>(__context__) /*a*/(0,__context__);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<TDim<float,3> &>::from(__a0_rename_at_30)))),cast<char *>::from(((char *) "[[ 0.000000000; 1.000000000; 2.000000000]]")),*__context__,nullptr)));
+	TDim<float,3> __a1_rename_at_32 = das_global<TDim<TDim<float,3>,2>,0x86e4398085b25055>(__context__) /*a*/(1,__context__);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_2, cast<TDim<float,3> &>::from(__a1_rename_at_32)))),cast<char *>::from(((char *) "[[ 10.000000000; 11.000000000; 12.000000000]]")),*__context__,nullptr)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// test_35e2f6eb8a5eb6d
+	aotLib[0x63e4da20c222b95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_35e2f6eb8a5eb6d>>();
+	};
+	// [[ init script ]]
+	aotLib[0x67f714d6d6140959] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,137 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10299327077406280167 {
+
+extern TypeInfo __type_info__af63df4c8601f1a5;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__6d462c83122831c9;
+extern VarInfo __var_info__1eea2c9ed711856c;
+extern FuncInfo __func_info__c4f16d6aa7a44ed1;
+extern FuncInfo __func_info__9d58727093f65234;
+
+VarInfo __func_info__c4f16d6aa7a44ed1_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::dasvector`TestObjectFoo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8194, 24, UINT64_C(0x1eea2c9ed711856c), "arr", 0 };
+VarInfo * __func_info__c4f16d6aa7a44ed1_fields[1] =  { &__func_info__c4f16d6aa7a44ed1_field_0 };
+FuncInfo __func_info__c4f16d6aa7a44ed1 = {"invoke block<(arr:$::dasvector`TestObjectFoo):void> const", "", __func_info__c4f16d6aa7a44ed1_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xc4f16d6aa7a44ed1), 0x0 };
+VarInfo __func_info__9d58727093f65234_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~UnitTest::TestObjectFoo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8238, 56, UINT64_C(0x6d462c83122831c9), "foo", 0 };
+VarInfo * __func_info__9d58727093f65234_fields[1] =  { &__func_info__9d58727093f65234_field_0 };
+FuncInfo __func_info__9d58727093f65234 = {"invoke block<(foo:UnitTest::TestObjectFoo const):bool> const", "", __func_info__9d58727093f65234_fields, 1, 32, &__type_info__af63df4c8601f1a5, nullptr,0,UINT64_C(0x9d58727093f65234), 0x0 };
+TypeInfo __type_info__af63df4c8601f1a5 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf63df4c8601f1a5) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline int32_t _Funcbuiltin_0x60_find_index_if_e493d70ea213a168 ( Context * __context__, Sequence DAS_COMMENT((TestObjectFoo &)) const  & __arr_rename_at_709, Block DAS_COMMENT((bool,TestObjectFoo const )) const  & __blk_rename_at_709 );
+inline bool test_80aa6a92f2da2af3 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t _Funcbuiltin_0x60_find_index_if_e493d70ea213a168 ( Context * __context__, Sequence DAS_COMMENT((TestObjectFoo &)) const  &  __arr_rename_at_709, Block DAS_COMMENT((bool,TestObjectFoo const )) const  &  __blk_rename_at_709 )
+{
+	{
+		bool __need_loop_710 = true;
+		// o : UnitTest::TestObjectFoo aka TT const&
+		das_iterator<Sequence DAS_COMMENT((TestObjectFoo)) const > __o_iterator(__arr_rename_at_709);
+		TestObjectFoo const  * __o_rename_at_710;
+		__need_loop_710 = __o_iterator.first(__context__,(__o_rename_at_710)) && __need_loop_710;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,2147483647));
+		int32_t __i_rename_at_710;
+		__need_loop_710 = __i_iterator.first(__context__,(__i_rename_at_710)) && __need_loop_710;
+		for ( ; __need_loop_710 ; __need_loop_710 = __o_iterator.next(__context__,(__o_rename_at_710)) && __i_iterator.next(__context__,(__i_rename_at_710)) )
+		{
+			if ( das_invoke<bool>::invoke<TestObjectFoo const  &>(__context__,nullptr,__blk_rename_at_709,(*__o_rename_at_710)) )
+			{
+				return das_auto_cast<int32_t>::cast(__i_rename_at_710);
+			};
+		}
+		__o_iterator.close(__context__,(__o_rename_at_710));
+		__i_iterator.close(__context__,(__i_rename_at_710));
+	};
+	return das_auto_cast<int32_t>::cast(-1);
+}
+
+inline bool test_80aa6a92f2da2af3 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,192,"test " DAS_FILE_LINE);
+{
+	testFooArray(das_make_block<void,das::vector<TestObjectFoo> &>(__context__,80,0,&__func_info__c4f16d6aa7a44ed1,[&](das::vector<TestObjectFoo> & __arr_rename_at_5)->void{
+		Sequence DAS_COMMENT((TestObjectFoo *)) _temp_make_local_6_112;
+		int32_t __index_rename_at_6 = ((int32_t)_Funcbuiltin_0x60_find_index_if_e493d70ea213a168(__context__,das_arg<Sequence DAS_COMMENT((TestObjectFoo))>::pass((_temp_make_local_6_112 = (das_vector_each(das_arg<das::vector<TestObjectFoo>>::pass(__arr_rename_at_5),__context__)))),das_make_block<bool,TestObjectFoo const  &>(__context__,176,0,&__func_info__9d58727093f65234,[&](TestObjectFoo const  & __foo_rename_at_6)->bool{
+			return das_auto_cast<bool>::cast(__foo_rename_at_6.fooData /*fooData*/ == 5);
+		})));
+		DAS_ASSERT((__index_rename_at_6 == 5));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_find_index_if_e493d70ea213a168
+	aotLib[0x32806a8a4a021eb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((TestObjectFoo &)) const  & , Block DAS_COMMENT((bool,TestObjectFoo const )) const  &  ),&_Funcbuiltin_0x60_find_index_if_e493d70ea213a168>>();
+	};
+	// test_80aa6a92f2da2af3
+	aotLib[0x5159ee612d60bf13] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_80aa6a92f2da2af3>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
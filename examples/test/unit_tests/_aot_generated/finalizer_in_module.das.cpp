@@ -0,0 +1,145 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require haha
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12568815294909301571 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace haha { struct Foo; };
+namespace haha {
+
+struct Foo {
+	int32_t a;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_finalize_d2f2c2427ecab3f1 ( Context * __context__, TArray<haha::Foo> & __a_rename_at_399 );
+inline void _Funcbuiltin_0x60_push_90781c0bfd846e5b ( Context * __context__, TArray<haha::Foo> & __Arr_rename_at_75, haha::Foo const  & __value_rename_at_75 );
+inline void finalize_ceb035f7b61df525 ( Context * __context__, haha::Foo & __f_rename_at_9 );
+inline bool test_17ab6307913b8ba ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<bool,0xcbb1fc99e6d61382>(__context__) = false;/*all_good*/
+}
+
+inline void _Funcbuiltin_0x60_finalize_d2f2c2427ecab3f1 ( Context * __context__, TArray<haha::Foo> &  __a_rename_at_399 )
+{
+	{
+		bool __need_loop_401 = true;
+		// aV : haha::Foo aka TT&
+		das_iterator<TArray<haha::Foo>> __aV_iterator(__a_rename_at_399);
+		haha::Foo * __aV_rename_at_401;
+		__need_loop_401 = __aV_iterator.first(__context__,(__aV_rename_at_401)) && __need_loop_401;
+		for ( ; __need_loop_401 ; __need_loop_401 = __aV_iterator.next(__context__,(__aV_rename_at_401)) )
+		{
+			finalize_ceb035f7b61df525(__context__,das_arg<haha::Foo>::pass((*__aV_rename_at_401)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_401));
+	};
+	builtin_array_free(das_arg<TArray<haha::Foo>>::pass(__a_rename_at_399),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_90781c0bfd846e5b ( Context * __context__, TArray<haha::Foo> &  __Arr_rename_at_75, haha::Foo const  &  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<haha::Foo>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void finalize_ceb035f7b61df525 ( Context * __context__, haha::Foo &  __f_rename_at_9 )
+{
+	das_copy(das_global<bool,0xcbb1fc99e6d61382>(__context__) /*all_good*/,true);
+}
+
+inline bool test_17ab6307913b8ba ( Context * __context__ )
+{
+	haha::Foo _temp_make_local_15_64;
+	TArray<haha::Foo> __arr_rename_at_14; das_zero(__arr_rename_at_14);
+	_Funcbuiltin_0x60_push_90781c0bfd846e5b(__context__,das_arg<TArray<haha::Foo>>::pass(__arr_rename_at_14),das_arg<haha::Foo>::pass((([&]() -> haha::Foo& {
+		das_copy((_temp_make_local_15_64.a),(1));
+		return _temp_make_local_15_64;
+	})())));
+	_Funcbuiltin_0x60_finalize_d2f2c2427ecab3f1(__context__,das_arg<TArray<haha::Foo>>::pass(__arr_rename_at_14));
+	DAS_ASSERT((das_global<bool,0xcbb1fc99e6d61382>(__context__) /*all_good*/));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_finalize_d2f2c2427ecab3f1
+	aotLib[0x60b4c331c39e50ba] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<haha::Foo> &  ),&_Funcbuiltin_0x60_finalize_d2f2c2427ecab3f1>>();
+	};
+	// _Funcbuiltin_0x60_push_90781c0bfd846e5b
+	aotLib[0x9db85eac359134ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<haha::Foo> & , haha::Foo const  &  ),&_Funcbuiltin_0x60_push_90781c0bfd846e5b>>();
+	};
+	// finalize_ceb035f7b61df525
+	aotLib[0x22a2be3fae6faf45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, haha::Foo &  ),&finalize_ceb035f7b61df525>>();
+	};
+	// test_17ab6307913b8ba
+	aotLib[0x2755cb69017aa403] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_17ab6307913b8ba>>();
+	};
+	// [[ init script ]]
+	aotLib[0x6a6ac75e1197d5d3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,407 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15812098553209068267 {
+
+extern TypeInfo __type_info__6f902bb202c1ac85;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__8a677f2ab3b012d0;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__8c48207b56753d8;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__d8d2e96b9400a1a7;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__f95678735cf0e442;
+extern VarInfo __var_info__371ce5264505a1b0;
+extern VarInfo __var_info__646708e744d8b00d;
+extern VarInfo __var_info__8a594fc4a742d2cf;
+extern FuncInfo __func_info__893633418addf9d6;
+extern FuncInfo __func_info__97e90aed55b2517d;
+extern FuncInfo __func_info__15fc9c8b649220ac;
+
+VarInfo __func_info__893633418addf9d6_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 41026, 24, UINT64_C(0x646708e744d8b00d), "data", 0 };
+VarInfo * __func_info__893633418addf9d6_fields[1] =  { &__func_info__893633418addf9d6_field_0 };
+FuncInfo __func_info__893633418addf9d6 = {"invoke block<(data:array<uint8>#):void> const", "", __func_info__893633418addf9d6_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x893633418addf9d6), 0x0 };
+VarInfo __func_info__97e90aed55b2517d_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8a677f2ab3b012d0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, UINT64_C(0x8a594fc4a742d2cf), "f", 0 };
+VarInfo * __func_info__97e90aed55b2517d_fields[1] =  { &__func_info__97e90aed55b2517d_field_0 };
+FuncInfo __func_info__97e90aed55b2517d = {"invoke block<(f:fio::FILE const? const):void> const", "", __func_info__97e90aed55b2517d_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x97e90aed55b2517d), 0x0 };
+VarInfo __func_info__15fc9c8b649220ac_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16484, 8, UINT64_C(0x371ce5264505a1b0), "line", 0 };
+VarInfo * __func_info__15fc9c8b649220ac_fields[1] =  { &__func_info__15fc9c8b649220ac_field_0 };
+FuncInfo __func_info__15fc9c8b649220ac = {"invoke block<(line:string const#):void> const", "", __func_info__15fc9c8b649220ac_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x15fc9c8b649220ac), 0x0 };
+TypeInfo __type_info__6f902bb202c1ac85 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, UINT64_C(0x6f902bb202c1ac85) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__8a677f2ab3b012d0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~fio::FILE"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 16, UINT64_C(0x8a677f2ab3b012d0) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__8c48207b56753d8 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x8c48207b56753d8) };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__d8d2e96b9400a1a7 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xd8d2e96b9400a1a7) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__f95678735cf0e442 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 40, UINT64_C(0xf95678735cf0e442) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__8a677f2ab3b012d0.resolveAnnotation();
+	__type_info__f95678735cf0e442.resolveAnnotation();
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__6f902bb202c1ac85 };
+TypeInfo * __tinfo_1[1] = { &__type_info__d8d2e96b9400a1a7 };
+TypeInfo * __tinfo_2[2] = { &__type_info__f95678735cf0e442, &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_3[1] = { &__type_info__af63e44c8601fa24 };
+TypeInfo * __tinfo_4[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_5[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+namespace fio { struct df_header; };
+// unused structure df_header
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_push_49bdd408ef1e4c5a ( Context * __context__, TArray<char *> & __Arr_rename_at_75, char * const  __value_rename_at_75 );
+inline void _Funcbuiltin_0x60_push_e5de83ceac06608f ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_75, uint8_t __value_rename_at_75 );
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> & __a_rename_at_42 );
+inline TArray<uint8_t> & _Funcbuiltin_0x60__return_with_lockcheck_900b28d16dcbf899 ( Context * __context__, TArray<uint8_t> & __a_rename_at_42 );
+inline void _Funcfio_0x60_fopen_4e6143847f364a84 ( Context * __context__, char * const  __name_rename_at_11, char * const  __mode_rename_at_11, Block DAS_COMMENT((void,FILE const  * const )) const  & __blk_rename_at_11 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_34d5fb4c1af473b4 ( Context * __context__, TDim<char *,4> & __a_rename_at_518 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_861b144ea4bde4ac ( Context * __context__, char * __a_rename_at_532 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_d43dd91861ea4d28 ( Context * __context__, TDim<char *,3> & __a_rename_at_518 );
+inline void write_lines_6c4acab7bae7d5af ( Context * __context__, char * const  __text_rename_at_6 );
+inline TArray<char *> read_lines_cb7be48ee597ce35 ( Context * __context__ );
+inline TArray<uint8_t> read_chunks_80b31c272aeec3d1 ( Context * __context__, int32_t __chunk_size_rename_at_20 );
+inline bool same_a5381ce15de787ae ( Context * __context__, TArray<char *> const  & __a_rename_at_31, TArray<char *> const  & __b_rename_at_31 );
+inline bool test_c7eccade10e966ec ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_49bdd408ef1e4c5a ( Context * __context__, TArray<char *> &  __Arr_rename_at_75, char * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<char *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_push_e5de83ceac06608f ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_75, uint8_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_75),1,__context__),__context__),__value_rename_at_75);
+}
+
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<char *> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<char *> &>::cast(__a_rename_at_42);
+}
+
+inline TArray<uint8_t> & _Funcbuiltin_0x60__return_with_lockcheck_900b28d16dcbf899 ( Context * __context__, TArray<uint8_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<TArray<uint8_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<uint8_t> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcfio_0x60_fopen_4e6143847f364a84 ( Context * __context__, char * const  __name_rename_at_11, char * const  __mode_rename_at_11, Block DAS_COMMENT((void,FILE const  * const )) const  &  __blk_rename_at_11 )
+{
+	FILE const  * __f_rename_at_12 = ((FILE const  *)builtin_fopen(__name_rename_at_11,__mode_rename_at_11));
+	das_invoke<void>::invoke<FILE const  * const >(__context__,nullptr,__blk_rename_at_11,__f_rename_at_12);
+	if ( __f_rename_at_12 != nullptr )
+	{
+		builtin_fclose(__f_rename_at_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_34d5fb4c1af473b4 ( Context * __context__, TDim<char *,4> &  __a_rename_at_518 )
+{
+	TArray<char *> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_519),4);
+	das_copy(das_cast<TDim<char *,4>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(__arr_rename_at_519);
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_861b144ea4bde4ac ( Context * __context__, char * __a_rename_at_532 )
+{
+	TArray<char *> __arr_rename_at_533; das_zero(__arr_rename_at_533);
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_533),__a_rename_at_532);
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(__arr_rename_at_533);
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_d43dd91861ea4d28 ( Context * __context__, TDim<char *,3> &  __a_rename_at_518 )
+{
+	TArray<char *> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_519),3);
+	das_copy(das_cast<TDim<char *,3>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(__arr_rename_at_519);
+}
+
+inline void write_lines_6c4acab7bae7d5af ( Context * __context__, char * const  __text_rename_at_6 ) { das_stack_prologue __prologue(__context__,96,"write_lines " DAS_FILE_LINE);
+{
+	_Funcfio_0x60_fopen_4e6143847f364a84(__context__,((char *) "test_stream.txt"),((char *) "wb"),das_make_block<void,FILE const  * const >(__context__,80,0,&__func_info__97e90aed55b2517d,[&](FILE const  * const  __f_rename_at_7)->void{
+		builtin_fwrite(__f_rename_at_7,__text_rename_at_6,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		builtin_fflush(__f_rename_at_7,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	}));
+}}
+
+inline TArray<char *> read_lines_cb7be48ee597ce35 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,208,"read_lines " DAS_FILE_LINE);
+{
+	TArray<char *> __lines_rename_at_12; das_zero(__lines_rename_at_12);
+	_Funcfio_0x60_fopen_4e6143847f364a84(__context__,((char *) "test_stream.txt"),((char *) "rb"),das_make_block<void,FILE const  * const >(__context__,112,0,&__func_info__97e90aed55b2517d,[&](FILE const  * const  __f_rename_at_13)->void{
+		builtin_fadvise(__f_rename_at_13,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		int64_t __count_rename_at_15 = ((int64_t)builtin_fread_lines(__f_rename_at_13,das_make_block<void,char * const >(__context__,192,0,&__func_info__15fc9c8b649220ac,[&](char * const  __line_rename_at_15)->void{
+			_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_12),((char *)(builtin_string_clone(__line_rename_at_15,__context__))));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+		DAS_VERIFY((__count_rename_at_15 == int64_t(builtin_array_size(das_arg<TArray<char *>>::pass(__lines_rename_at_12)))));
+	}));
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(__lines_rename_at_12)));
+}}
+
+inline TArray<uint8_t> read_chunks_80b31c272aeec3d1 ( Context * __context__, int32_t __chunk_size_rename_at_20 ) { das_stack_prologue __prologue(__context__,224,"read_chunks " DAS_FILE_LINE);
+{
+	TArray<uint8_t> __bytes_rename_at_21; das_zero(__bytes_rename_at_21);
+	int64_t __total_rename_at_22 = INT64_C(0);
+	_Funcfio_0x60_fopen_4e6143847f364a84(__context__,((char *) "test_stream.txt"),((char *) "rb"),das_make_block<void,FILE const  * const >(__context__,128,0,&__func_info__97e90aed55b2517d,[&](FILE const  * const  __f_rename_at_23)->void{
+		das_copy(__total_rename_at_22,builtin_fread_chunks(__f_rename_at_23,__chunk_size_rename_at_20,das_make_block<void,TArray<uint8_t> &>(__context__,192,0,&__func_info__893633418addf9d6,[&](TArray<uint8_t> & __data_rename_at_24)->void{
+			DAS_ASSERT((builtin_array_size(das_arg<TArray<uint8_t>>::pass(__data_rename_at_24)) <= __chunk_size_rename_at_20));
+			{
+				bool __need_loop_26 = true;
+				// c : uint8&#
+				das_iterator<TArray<uint8_t>> __c_iterator(__data_rename_at_24);
+				uint8_t * __c_rename_at_26;
+				__need_loop_26 = __c_iterator.first(__context__,(__c_rename_at_26)) && __need_loop_26;
+				for ( ; __need_loop_26 ; __need_loop_26 = __c_iterator.next(__context__,(__c_rename_at_26)) )
+				{
+					_Funcbuiltin_0x60_push_e5de83ceac06608f(__context__,das_arg<TArray<uint8_t>>::pass(__bytes_rename_at_21),(*__c_rename_at_26));
+				}
+				__c_iterator.close(__context__,(__c_rename_at_26));
+			};
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+	}));
+	DAS_ASSERT((__total_rename_at_22 == int64_t(builtin_array_size(das_arg<TArray<uint8_t>>::pass(__bytes_rename_at_21)))));
+	return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_900b28d16dcbf899(__context__,das_arg<TArray<uint8_t>>::pass(__bytes_rename_at_21)));
+}}
+
+inline bool same_a5381ce15de787ae ( Context * __context__, TArray<char *> const  &  __a_rename_at_31, TArray<char *> const  &  __b_rename_at_31 )
+{
+	if ( builtin_array_size(__a_rename_at_31) != builtin_array_size(__b_rename_at_31) )
+	{
+		return das_auto_cast<bool>::cast(false);
+	} else {
+		{
+			bool __need_loop_34 = true;
+			// x : string const&
+			das_iterator<TArray<char *> const > __x_iterator(__a_rename_at_31);
+			char * const  * __x_rename_at_34;
+			__need_loop_34 = __x_iterator.first(__context__,(__x_rename_at_34)) && __need_loop_34;
+			// y : string const&
+			das_iterator<TArray<char *> const > __y_iterator(__b_rename_at_31);
+			char * const  * __y_rename_at_34;
+			__need_loop_34 = __y_iterator.first(__context__,(__y_rename_at_34)) && __need_loop_34;
+			for ( ; __need_loop_34 ; __need_loop_34 = __x_iterator.next(__context__,(__x_rename_at_34)) && __y_iterator.next(__context__,(__y_rename_at_34)) )
+			{
+				if ( SimPolicy<char *>::NotEqu(cast<char *>::from((*__x_rename_at_34)),cast<char *>::from((*__y_rename_at_34)),*__context__,nullptr) )
+				{
+					return das_auto_cast<bool>::cast(false);
+				};
+			}
+			__x_iterator.close(__context__,(__x_rename_at_34));
+			__y_iterator.close(__context__,(__y_rename_at_34));
+		};
+		return das_auto_cast<bool>::cast(true);
+	};
+}
+
+inline bool test_c7eccade10e966ec ( Context * __context__ ) { das_stack_prologue __prologue(__context__,752,"test " DAS_FILE_LINE);
+{
+	TArray<char *> _temp_make_local_42_32;
+	TArray<char *> _temp_make_local_42_64;
+	TDim<char *,4> _temp_make_local_42_96;
+	TArray<char *> _temp_make_local_44_128;
+	TArray<char *> _temp_make_local_44_160;
+	TArray<char *> _temp_make_local_46_192;
+	TArray<char *> _temp_make_local_52_320;
+	TArray<char *> _temp_make_local_52_352;
+	TDim<char *,3> _temp_make_local_52_384;
+	TDim<int32_t,4> _temp_make_local_56_432;
+	write_lines_6c4acab7bae7d5af(__context__,((char *) "one\ntwo\r\n\nthree"));
+	DAS_VERIFY((same_a5381ce15de787ae(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_42_32 = (read_lines_cb7be48ee597ce35(__context__)))),das_arg<TArray<char *>>::pass((_temp_make_local_42_64 = (_Funcbuiltin_0x60_to_array_move_34d5fb4c1af473b4(__context__,das_arg<TDim<char *,4>>::pass((([&]() -> TDim<char *,4>& {
+		_temp_make_local_42_96(0,__context__) = ((char *) "one");
+		_temp_make_local_42_96(1,__context__) = ((char *) "two");
+		_temp_make_local_42_96(2,__context__) = nullptr;
+		_temp_make_local_42_96(3,__context__) = ((char *) "three");
+		return _temp_make_local_42_96;
+	})())))))))));
+	write_lines_6c4acab7bae7d5af(__context__,((char *) "one\n"));
+	DAS_VERIFY((same_a5381ce15de787ae(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_44_128 = (read_lines_cb7be48ee597ce35(__context__)))),das_arg<TArray<char *>>::pass((_temp_make_local_44_160 = (_Funcbuiltin_0x60_to_array_move_861b144ea4bde4ac(__context__,((char *) "one"))))))));
+	write_lines_6c4acab7bae7d5af(__context__,nullptr);
+	DAS_VERIFY((builtin_array_size(das_arg<TArray<char *>>::pass((_temp_make_local_46_192 = (read_lines_cb7be48ee597ce35(__context__))))) == 0));
+	char * __long_line_rename_at_48 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_48)->void{
+		{
+			bool __need_loop_49 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,100000));
+			int32_t __i_rename_at_49;
+			__need_loop_49 = __i_iterator.first(__context__,(__i_rename_at_49)) && __need_loop_49;
+			for ( ; __need_loop_49 ; __need_loop_49 = __i_iterator.next(__context__,(__i_rename_at_49)) )
+			{
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<StringBuilderWriter &>::from(__writer_rename_at_48),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_3, cast<int32_t>::from((SimPolicy<int32_t>::Mod(__i_rename_at_49,10,*__context__,nullptr))))))));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_49));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	write_lines_6c4acab7bae7d5af(__context__,das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_4, cast<char * const >::from(__long_line_rename_at_48), cast<char * const >::from(((char *) "\nx\n")), cast<char * const >::from(__long_line_rename_at_48))));
+	DAS_VERIFY((same_a5381ce15de787ae(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_52_320 = (read_lines_cb7be48ee597ce35(__context__)))),das_arg<TArray<char *>>::pass((_temp_make_local_52_352 = (_Funcbuiltin_0x60_to_array_move_d43dd91861ea4d28(__context__,das_arg<TDim<char *,3>>::pass((([&]() -> TDim<char *,3>& {
+		_temp_make_local_52_384(0,__context__) = __long_line_rename_at_48;
+		_temp_make_local_52_384(1,__context__) = ((char *) "x");
+		_temp_make_local_52_384(2,__context__) = __long_line_rename_at_48;
+		return _temp_make_local_52_384;
+	})())))))))));
+	char * __text_rename_at_54 = ((char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_5, cast<char * const >::from(__long_line_rename_at_48), cast<char * const >::from(((char *) "\n")), cast<char * const >::from(__long_line_rename_at_48)))));
+	write_lines_6c4acab7bae7d5af(__context__,__text_rename_at_54);
+	{
+		bool __need_loop_56 = true;
+		// chunk_size : int&
+		das_iterator<TDim<int32_t,4>> __chunk_size_iterator((([&]() -> TDim<int32_t,4>& {
+			_temp_make_local_56_432(0,__context__) = 1;
+			_temp_make_local_56_432(1,__context__) = 7;
+			_temp_make_local_56_432(2,__context__) = 4096;
+			_temp_make_local_56_432(3,__context__) = 1000000;
+			return _temp_make_local_56_432;
+		})()));
+		int32_t * __chunk_size_rename_at_56;
+		__need_loop_56 = __chunk_size_iterator.first(__context__,(__chunk_size_rename_at_56)) && __need_loop_56;
+		for ( ; __need_loop_56 ; __need_loop_56 = __chunk_size_iterator.next(__context__,(__chunk_size_rename_at_56)) )
+		{
+			TArray<uint8_t> __bytes_rename_at_57_ConstRef; das_zero(__bytes_rename_at_57_ConstRef); das_move(__bytes_rename_at_57_ConstRef, ((TArray<uint8_t>)read_chunks_80b31c272aeec3d1(__context__,(*__chunk_size_rename_at_56))));
+	TArray<uint8_t> const  & __bytes_rename_at_57 = __bytes_rename_at_57_ConstRef; ;
+			DAS_VERIFY((builtin_array_size(__bytes_rename_at_57) == builtin_string_length(__text_rename_at_54,__context__)));
+			DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(((char *)(builtin_string_from_array(__bytes_rename_at_57,__context__)))),cast<char *>::from(__text_rename_at_54),*__context__,nullptr)));
+		}
+		__chunk_size_iterator.close(__context__,(__chunk_size_rename_at_56));
+	};
+	_Funcfio_0x60_fopen_4e6143847f364a84(__context__,((char *) "test_stream.txt"),((char *) "rb"),das_make_block<void,FILE const  * const >(__context__,544,0,&__func_info__97e90aed55b2517d,[&](FILE const  * const  __f_rename_at_61)->void{
+		builtin_map_file(__f_rename_at_61,das_make_block<void,TArray<uint8_t> &>(__context__,608,0,&__func_info__893633418addf9d6,[&](TArray<uint8_t> & __data_rename_at_62)->void{
+			DAS_VERIFY((builtin_array_size(das_arg<TArray<uint8_t>>::pass(__data_rename_at_62)) == builtin_string_length(__text_rename_at_54,__context__)));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	}));
+	write_lines_6c4acab7bae7d5af(__context__,nullptr);
+	_Funcfio_0x60_fopen_4e6143847f364a84(__context__,((char *) "test_stream.txt"),((char *) "rb"),das_make_block<void,FILE const  * const >(__context__,672,0,&__func_info__97e90aed55b2517d,[&](FILE const  * const  __f_rename_at_65)->void{
+		builtin_map_file(__f_rename_at_65,das_make_block<void,TArray<uint8_t> &>(__context__,736,0,&__func_info__893633418addf9d6,[&](TArray<uint8_t> & __data_rename_at_66)->void{
+			DAS_VERIFY((builtin_array_size(das_arg<TArray<uint8_t>>::pass(__data_rename_at_66)) == 0));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	}));
+	builtin_remove_file(((char *) "test_stream.txt"));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+	aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+	// _Funcbuiltin_0x60_push_49bdd408ef1e4c5a
+	aotLib[0xb187be2de84ea8d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const   ),&_Funcbuiltin_0x60_push_49bdd408ef1e4c5a>>();
+	};
+	// _Funcbuiltin_0x60_push_e5de83ceac06608f
+	aotLib[0x301df73651096bd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , uint8_t  ),&_Funcbuiltin_0x60_push_e5de83ceac06608f>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465
+	aotLib[0xed99ea3c3e04d451] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<char *> & (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_900b28d16dcbf899
+	aotLib[0xde07a94d5505f815] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<uint8_t> & (*) ( Context * __context__, TArray<uint8_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_900b28d16dcbf899>>();
+	};
+	// _Funcfio_0x60_fopen_4e6143847f364a84
+	aotLib[0xb0b10cf2a8d7d46d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , char * const  , Block DAS_COMMENT((void,FILE const  * const )) const  &  ),&_Funcfio_0x60_fopen_4e6143847f364a84>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_34d5fb4c1af473b4
+	aotLib[0xc6874403be41ba5b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,4> &  ),&_Funcbuiltin_0x60_to_array_move_34d5fb4c1af473b4>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_861b144ea4bde4ac
+	aotLib[0x3e59e6daf7e31832] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, char *  ),&_Funcbuiltin_0x60_to_array_move_861b144ea4bde4ac>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_d43dd91861ea4d28
+	aotLib[0x41bac6855bbf997f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,3> &  ),&_Funcbuiltin_0x60_to_array_move_d43dd91861ea4d28>>();
+	};
+	// write_lines_6c4acab7bae7d5af
+	aotLib[0x455d1e4bb119c322] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const   ),&write_lines_6c4acab7bae7d5af>>();
+	};
+	// read_lines_cb7be48ee597ce35
+	aotLib[0x5822f715e71faebc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__ ),&read_lines_cb7be48ee597ce35>>();
+	};
+	// read_chunks_80b31c272aeec3d1
+	aotLib[0xb496f8578e1cdabe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint8_t> (*) ( Context * __context__, int32_t  ),&read_chunks_80b31c272aeec3d1>>();
+	};
+	// same_a5381ce15de787ae
+	aotLib[0xd29f1eb100c5091d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<char *> const  & , TArray<char *> const  &  ),&same_a5381ce15de787ae>>();
+	};
+	// test_c7eccade10e966ec
+	aotLib[0xa2a17324b38f6c3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_c7eccade10e966ec>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,547 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7517222392756243744 {
+
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__90f4307b5a6d445;
+extern TypeInfo __type_info__90f5707b5a6f641;
+
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__90f4307b5a6d445 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f4307b5a6d445) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_1[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f4307b5a6d445, &__type_info__90f3d07b5a6ca13 };
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_451 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void test_from_gte_to_67d57dd0359e1ba1 ( Context * __context__ );
+inline bool test_78f44be1a39a0ab0 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_451 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_452; das_zero(__it_rename_at_452);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_452),__rng_rename_at_451,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_452);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void test_from_gte_to_67d57dd0359e1ba1 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_32_224;
+	{
+		bool __need_loop_3 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(3,2));
+		int32_t __x_rename_at_3;
+		__need_loop_3 = __x_iterator.first(__context__,(__x_rename_at_3)) && __need_loop_3;
+		for ( ; __need_loop_3 ; __need_loop_3 = __x_iterator.next(__context__,(__x_rename_at_3)) )
+		{
+			DAS_ASSERT((false));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_3));
+	};
+	{
+		bool __need_loop_5 = true;
+		// x : uint const
+		das_iterator<urange> __x_iterator(urange(3,2));
+		uint32_t __x_rename_at_5;
+		__need_loop_5 = __x_iterator.first(__context__,(__x_rename_at_5)) && __need_loop_5;
+		for ( ; __need_loop_5 ; __need_loop_5 = __x_iterator.next(__context__,(__x_rename_at_5)) )
+		{
+			DAS_ASSERT((false));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_5));
+	};
+	{
+		bool __need_loop_8 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(3,2));
+		int32_t __x_rename_at_8;
+		__need_loop_8 = __x_iterator.first(__context__,(__x_rename_at_8)) && __need_loop_8;
+		for ( ; __need_loop_8 ; __need_loop_8 = __x_iterator.next(__context__,(__x_rename_at_8)) )
+		{
+			builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "x=")), cast<int32_t>::from(__x_rename_at_8), cast<char * const >::from(((char *) "\n")))),__context__);
+			DAS_ASSERT((false));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_8));
+	};
+	{
+		bool __need_loop_11 = true;
+		// x : uint const
+		das_iterator<urange> __x_iterator(urange(3,2));
+		uint32_t __x_rename_at_11;
+		__need_loop_11 = __x_iterator.first(__context__,(__x_rename_at_11)) && __need_loop_11;
+		for ( ; __need_loop_11 ; __need_loop_11 = __x_iterator.next(__context__,(__x_rename_at_11)) )
+		{
+			builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "x=")), cast<uint32_t>::from(__x_rename_at_11), cast<char * const >::from(((char *) "\n")))),__context__);
+			DAS_ASSERT((false));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_11));
+	};
+	{
+		bool __need_loop_15 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(3,2));
+		int32_t __x_rename_at_15;
+		__need_loop_15 = __x_iterator.first(__context__,(__x_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __x_iterator.next(__context__,(__x_rename_at_15)) )
+		{
+			break;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_15));
+	};
+	{
+		bool __need_loop_17 = true;
+		// x : uint const
+		das_iterator<urange> __x_iterator(urange(3,2));
+		uint32_t __x_rename_at_17;
+		__need_loop_17 = __x_iterator.first(__context__,(__x_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __x_iterator.next(__context__,(__x_rename_at_17)) )
+		{
+			break;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_17));
+	};
+	{
+		bool __need_loop_20 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(3,2));
+		int32_t __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) )
+		{
+			DAS_ASSERT((false));
+			break;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+	};
+	{
+		bool __need_loop_23 = true;
+		// x : uint const
+		das_iterator<urange> __x_iterator(urange(3,2));
+		uint32_t __x_rename_at_23;
+		__need_loop_23 = __x_iterator.first(__context__,(__x_rename_at_23)) && __need_loop_23;
+		for ( ; __need_loop_23 ; __need_loop_23 = __x_iterator.next(__context__,(__x_rename_at_23)) )
+		{
+			DAS_ASSERT((false));
+			break;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_23));
+	};
+	{
+		bool __need_loop_27 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(3,2));
+		int32_t __x_rename_at_27;
+		__need_loop_27 = __x_iterator.first(__context__,(__x_rename_at_27)) && __need_loop_27;
+		// y : uint const
+		das_iterator<urange> __y_iterator(urange(3,2));
+		uint32_t __y_rename_at_27;
+		__need_loop_27 = __y_iterator.first(__context__,(__y_rename_at_27)) && __need_loop_27;
+		for ( ; __need_loop_27 ; __need_loop_27 = __x_iterator.next(__context__,(__x_rename_at_27)) && __y_iterator.next(__context__,(__y_rename_at_27)) )
+		{
+			DAS_ASSERT((false));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_27));
+		__y_iterator.close(__context__,(__y_rename_at_27));
+	};
+	{
+		bool __need_loop_29 = true;
+		// x : uint const
+		das_iterator<urange> __x_iterator(urange(3,2));
+		uint32_t __x_rename_at_29;
+		__need_loop_29 = __x_iterator.first(__context__,(__x_rename_at_29)) && __need_loop_29;
+		// y : uint const
+		das_iterator<urange> __y_iterator(urange(3,2));
+		uint32_t __y_rename_at_29;
+		__need_loop_29 = __y_iterator.first(__context__,(__y_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __x_iterator.next(__context__,(__x_rename_at_29)) && __y_iterator.next(__context__,(__y_rename_at_29)) )
+		{
+			DAS_ASSERT((false));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_29));
+		__y_iterator.close(__context__,(__y_rename_at_29));
+	};
+	{
+		bool __need_loop_32 = true;
+		// x : int
+		das_iterator<Sequence DAS_COMMENT((int32_t))> __x_iterator((_temp_make_local_32_224 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(3,2)))));
+		int32_t __x_rename_at_32;
+		__need_loop_32 = __x_iterator.first(__context__,(__x_rename_at_32)) && __need_loop_32;
+		for ( ; __need_loop_32 ; __need_loop_32 = __x_iterator.next(__context__,(__x_rename_at_32)) )
+		{
+			DAS_ASSERT((false));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_32));
+	};
+}
+
+inline bool test_78f44be1a39a0ab0 ( Context * __context__ )
+{
+	TDim<int32_t,10> __a_rename_at_39; das_zero(__a_rename_at_39);
+	int32_t __i_rename_at_40 = 0;
+	{
+		bool __need_loop_41 = true;
+		// l : int& -const
+		das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_39);
+		int32_t * __l_rename_at_41;
+		__need_loop_41 = __l_iterator.first(__context__,(__l_rename_at_41)) && __need_loop_41;
+		for ( ; __need_loop_41 ; __need_loop_41 = __l_iterator.next(__context__,(__l_rename_at_41)) )
+		{
+			das_copy((*__l_rename_at_41),__i_rename_at_40);
+			++__i_rename_at_40;
+		}
+		__l_iterator.close(__context__,(__l_rename_at_41));
+	};
+	DAS_ASSERT((__i_rename_at_40 == 10));
+	das_copy(__i_rename_at_40,0);
+	{
+		bool __need_loop_46 = true;
+		// l : int& -const
+		das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_39);
+		int32_t * __l_rename_at_46;
+		__need_loop_46 = __l_iterator.first(__context__,(__l_rename_at_46)) && __need_loop_46;
+		for ( ; __need_loop_46 ; __need_loop_46 = __l_iterator.next(__context__,(__l_rename_at_46)) )
+		{
+			DAS_ASSERT(((*__l_rename_at_46) == __i_rename_at_40));
+			++__i_rename_at_40;
+		}
+		__l_iterator.close(__context__,(__l_rename_at_46));
+	};
+	TArray<int32_t> __a_rename_at_51; das_zero(__a_rename_at_51);
+	int32_t __i_rename_at_52 = 0;
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_51),13);
+	{
+		bool __need_loop_54 = true;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_51);
+		int32_t * __l_rename_at_54;
+		__need_loop_54 = __l_iterator.first(__context__,(__l_rename_at_54)) && __need_loop_54;
+		for ( ; __need_loop_54 ; __need_loop_54 = __l_iterator.next(__context__,(__l_rename_at_54)) )
+		{
+			das_copy((*__l_rename_at_54),__i_rename_at_52++);
+		}
+		__l_iterator.close(__context__,(__l_rename_at_54));
+	};
+	DAS_ASSERT((__i_rename_at_52 == 13));
+	das_copy(__i_rename_at_52,0);
+	{
+		bool __need_loop_58 = true;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_51);
+		int32_t * __l_rename_at_58;
+		__need_loop_58 = __l_iterator.first(__context__,(__l_rename_at_58)) && __need_loop_58;
+		for ( ; __need_loop_58 ; __need_loop_58 = __l_iterator.next(__context__,(__l_rename_at_58)) )
+		{
+			DAS_ASSERT(((*__l_rename_at_58) == __i_rename_at_52));
+			++__i_rename_at_52;
+		}
+		__l_iterator.close(__context__,(__l_rename_at_58));
+	};
+	TDim<int32_t,10> __a_rename_at_63; das_zero(__a_rename_at_63); TDim<int32_t,10> __b_rename_at_63; das_zero(__b_rename_at_63);
+	int32_t __i_rename_at_64 = 0;
+	{
+		bool __need_loop_65 = true;
+		// l : int& -const
+		das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_63);
+		int32_t * __l_rename_at_65;
+		__need_loop_65 = __l_iterator.first(__context__,(__l_rename_at_65)) && __need_loop_65;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_63);
+		int32_t * __r_rename_at_65;
+		__need_loop_65 = __r_iterator.first(__context__,(__r_rename_at_65)) && __need_loop_65;
+		for ( ; __need_loop_65 ; __need_loop_65 = __l_iterator.next(__context__,(__l_rename_at_65)) && __r_iterator.next(__context__,(__r_rename_at_65)) )
+		{
+			das_copy((*__r_rename_at_65),(__i_rename_at_64 * 2) - 5);
+			das_copy((*__l_rename_at_65),__i_rename_at_64++);
+		}
+		__l_iterator.close(__context__,(__l_rename_at_65));
+		__r_iterator.close(__context__,(__r_rename_at_65));
+	};
+	DAS_ASSERT((__i_rename_at_64 == 10));
+	das_copy(__i_rename_at_64,0);
+	{
+		bool __need_loop_70 = true;
+		// l : int& -const
+		das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_63);
+		int32_t * __l_rename_at_70;
+		__need_loop_70 = __l_iterator.first(__context__,(__l_rename_at_70)) && __need_loop_70;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_63);
+		int32_t * __r_rename_at_70;
+		__need_loop_70 = __r_iterator.first(__context__,(__r_rename_at_70)) && __need_loop_70;
+		for ( ; __need_loop_70 ; __need_loop_70 = __l_iterator.next(__context__,(__l_rename_at_70)) && __r_iterator.next(__context__,(__r_rename_at_70)) )
+		{
+			DAS_ASSERT(((*__r_rename_at_70) == ((__i_rename_at_64 * 2) - 5)));
+			DAS_VERIFY(((*__l_rename_at_70) == __i_rename_at_64++));
+		}
+		__l_iterator.close(__context__,(__l_rename_at_70));
+		__r_iterator.close(__context__,(__r_rename_at_70));
+	};
+	das_copy(__i_rename_at_64,0);
+	{
+		bool __need_loop_74 = true;
+		// l : int& -const
+		das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_63);
+		int32_t * __l_rename_at_74;
+		__need_loop_74 = __l_iterator.first(__context__,(__l_rename_at_74)) && __need_loop_74;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_63);
+		int32_t * __r_rename_at_74;
+		__need_loop_74 = __r_iterator.first(__context__,(__r_rename_at_74)) && __need_loop_74;
+		for ( ; __need_loop_74 ; __need_loop_74 = __l_iterator.next(__context__,(__l_rename_at_74)) && __r_iterator.next(__context__,(__r_rename_at_74)) )
+		{
+			if ( (*__l_rename_at_74) > (*__r_rename_at_74) )
+			{
+				DAS_ASSERT(((*__l_rename_at_74) > (*__r_rename_at_74)));
+				++__i_rename_at_64;
+			};
+		}
+		__l_iterator.close(__context__,(__l_rename_at_74));
+		__r_iterator.close(__context__,(__r_rename_at_74));
+	};
+	DAS_ASSERT((__i_rename_at_64 == 5));
+	TArray<int32_t> __a_rename_at_81; das_zero(__a_rename_at_81);
+	TDim<int32_t,10> __b_rename_at_82; das_zero(__b_rename_at_82);
+	int32_t __i_rename_at_83 = 0;
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_81),4);
+	{
+		bool __need_loop_85 = true;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_81);
+		int32_t * __l_rename_at_85;
+		__need_loop_85 = __l_iterator.first(__context__,(__l_rename_at_85)) && __need_loop_85;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_82);
+		int32_t * __r_rename_at_85;
+		__need_loop_85 = __r_iterator.first(__context__,(__r_rename_at_85)) && __need_loop_85;
+		for ( ; __need_loop_85 ; __need_loop_85 = __l_iterator.next(__context__,(__l_rename_at_85)) && __r_iterator.next(__context__,(__r_rename_at_85)) )
+		{
+			DAS_ASSERT((__i_rename_at_83 < 4));
+			das_copy((*__r_rename_at_85),(__i_rename_at_83 * 2) - 5);
+			das_copy((*__l_rename_at_85),__i_rename_at_83++);
+		}
+		__l_iterator.close(__context__,(__l_rename_at_85));
+		__r_iterator.close(__context__,(__r_rename_at_85));
+	};
+	DAS_ASSERT((__i_rename_at_83 == 4));
+	das_copy(__i_rename_at_83,0);
+	{
+		bool __need_loop_91 = true;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_81);
+		int32_t * __l_rename_at_91;
+		__need_loop_91 = __l_iterator.first(__context__,(__l_rename_at_91)) && __need_loop_91;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_82);
+		int32_t * __r_rename_at_91;
+		__need_loop_91 = __r_iterator.first(__context__,(__r_rename_at_91)) && __need_loop_91;
+		for ( ; __need_loop_91 ; __need_loop_91 = __l_iterator.next(__context__,(__l_rename_at_91)) && __r_iterator.next(__context__,(__r_rename_at_91)) )
+		{
+			DAS_ASSERT(((*__r_rename_at_91) == ((__i_rename_at_83 * 2) - 5)));
+			DAS_VERIFY(((*__l_rename_at_91) == __i_rename_at_83++));
+		}
+		__l_iterator.close(__context__,(__l_rename_at_91));
+		__r_iterator.close(__context__,(__r_rename_at_91));
+	};
+	DAS_ASSERT((__i_rename_at_83 == 4));
+	das_copy(__i_rename_at_83,0);
+	{
+		bool __need_loop_96 = true;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_81);
+		int32_t * __l_rename_at_96;
+		__need_loop_96 = __l_iterator.first(__context__,(__l_rename_at_96)) && __need_loop_96;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_82);
+		int32_t * __r_rename_at_96;
+		__need_loop_96 = __r_iterator.first(__context__,(__r_rename_at_96)) && __need_loop_96;
+		for ( ; __need_loop_96 ; __need_loop_96 = __l_iterator.next(__context__,(__l_rename_at_96)) && __r_iterator.next(__context__,(__r_rename_at_96)) )
+		{
+			if ( (*__l_rename_at_96) > (*__r_rename_at_96) )
+			{
+				DAS_ASSERT(((*__l_rename_at_96) > (*__r_rename_at_96)));
+				++__i_rename_at_83;
+			};
+		}
+		__l_iterator.close(__context__,(__l_rename_at_96));
+		__r_iterator.close(__context__,(__r_rename_at_96));
+	};
+	DAS_ASSERT((__i_rename_at_83 == 4));
+	int32_t __i_rename_at_103 = 0;
+	{
+		bool __need_loop_104 = true;
+		// a : int const
+		das_iterator<range> __a_iterator(range(0,10));
+		int32_t __a_rename_at_104;
+		__need_loop_104 = __a_iterator.first(__context__,(__a_rename_at_104)) && __need_loop_104;
+		for ( ; __need_loop_104 ; __need_loop_104 = __a_iterator.next(__context__,(__a_rename_at_104)) )
+		{
+			DAS_VERIFY((__a_rename_at_104 == __i_rename_at_103++));
+		}
+		__a_iterator.close(__context__,(__a_rename_at_104));
+	};
+	DAS_ASSERT((__i_rename_at_103 == 10));
+	TDim<int32_t,10> __b_rename_at_109; das_zero(__b_rename_at_109);
+	int32_t __i_rename_at_110 = 0;
+	{
+		bool __need_loop_111 = true;
+		// l : int const
+		das_iterator<range> __l_iterator(range(0,10));
+		int32_t __l_rename_at_111;
+		__need_loop_111 = __l_iterator.first(__context__,(__l_rename_at_111)) && __need_loop_111;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_109);
+		int32_t * __r_rename_at_111;
+		__need_loop_111 = __r_iterator.first(__context__,(__r_rename_at_111)) && __need_loop_111;
+		for ( ; __need_loop_111 ; __need_loop_111 = __l_iterator.next(__context__,(__l_rename_at_111)) && __r_iterator.next(__context__,(__r_rename_at_111)) )
+		{
+			das_copy((*__r_rename_at_111),(__i_rename_at_110++ * 2) - 5);
+		}
+		__l_iterator.close(__context__,(__l_rename_at_111));
+		__r_iterator.close(__context__,(__r_rename_at_111));
+	};
+	DAS_ASSERT((__i_rename_at_110 == 10));
+	das_copy(__i_rename_at_110,0);
+	{
+		bool __need_loop_115 = true;
+		// l : int const
+		das_iterator<range> __l_iterator(range(0,10));
+		int32_t __l_rename_at_115;
+		__need_loop_115 = __l_iterator.first(__context__,(__l_rename_at_115)) && __need_loop_115;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_109);
+		int32_t * __r_rename_at_115;
+		__need_loop_115 = __r_iterator.first(__context__,(__r_rename_at_115)) && __need_loop_115;
+		for ( ; __need_loop_115 ; __need_loop_115 = __l_iterator.next(__context__,(__l_rename_at_115)) && __r_iterator.next(__context__,(__r_rename_at_115)) )
+		{
+			DAS_ASSERT(((*__r_rename_at_115) == ((__i_rename_at_110 * 2) - 5)));
+			DAS_VERIFY((__l_rename_at_115 == __i_rename_at_110++));
+		}
+		__l_iterator.close(__context__,(__l_rename_at_115));
+		__r_iterator.close(__context__,(__r_rename_at_115));
+	};
+	das_copy(__i_rename_at_110,0);
+	{
+		bool __need_loop_119 = true;
+		// l : int const
+		das_iterator<range> __l_iterator(range(0,10));
+		int32_t __l_rename_at_119;
+		__need_loop_119 = __l_iterator.first(__context__,(__l_rename_at_119)) && __need_loop_119;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_109);
+		int32_t * __r_rename_at_119;
+		__need_loop_119 = __r_iterator.first(__context__,(__r_rename_at_119)) && __need_loop_119;
+		for ( ; __need_loop_119 ; __need_loop_119 = __l_iterator.next(__context__,(__l_rename_at_119)) && __r_iterator.next(__context__,(__r_rename_at_119)) )
+		{
+			if ( __l_rename_at_119 > (*__r_rename_at_119) )
+			{
+				DAS_ASSERT((__l_rename_at_119 > (*__r_rename_at_119)));
+				++__i_rename_at_110;
+			};
+		}
+		__l_iterator.close(__context__,(__l_rename_at_119));
+		__r_iterator.close(__context__,(__r_rename_at_119));
+	};
+	DAS_ASSERT((__i_rename_at_110 == 5));
+	uint32_t __u_rename_at_125 = 0x0u;
+	{
+		bool __need_loop_126 = true;
+		// t : uint const
+		das_iterator<urange> __t_iterator(urange(0,3));
+		uint32_t __t_rename_at_126;
+		__need_loop_126 = __t_iterator.first(__context__,(__t_rename_at_126)) && __need_loop_126;
+		for ( ; __need_loop_126 ; __need_loop_126 = __t_iterator.next(__context__,(__t_rename_at_126)) )
+		{
+			__u_rename_at_125 += __t_rename_at_126;
+		}
+		__t_iterator.close(__context__,(__t_rename_at_126));
+	};
+	DAS_ASSERT((__u_rename_at_125 == 0x3u));
+	test_from_gte_to_67d57dd0359e1ba1(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_each_5cbab1dfe9635bc1
+	aotLib[0x8c2bf3089ff8b6f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_5cbab1dfe9635bc1>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// test_from_gte_to_67d57dd0359e1ba1
+	aotLib[0xc856fa2411acc8d3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_from_gte_to_67d57dd0359e1ba1>>();
+	};
+	// test_78f44be1a39a0ab0
+	aotLib[0x1e8e3fc7e08cb269] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_78f44be1a39a0ab0>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,182 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1780950107523045017 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline void test_while_continue_e3fd909602c8a5d6 ( Context * __context__ );
+inline void test_for_continue_8f9304d6d3db568c ( Context * __context__ );
+inline void test_complex_for_continue_319449350152954d ( Context * __context__ );
+inline bool test_25b7d67143a7e0b1 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void test_while_continue_e3fd909602c8a5d6 ( Context * __context__ )
+{
+	int32_t __x_rename_at_3 = 0;
+	int32_t __y_rename_at_4 = 0;
+	while ( __x_rename_at_3 < 10 )
+	{
+		++__x_rename_at_3;
+		if ( (__x_rename_at_3 & 1) == 0 )
+		{
+			continue;
+		} else {
+			__y_rename_at_4 += __x_rename_at_3;
+		};
+	};
+	DAS_ASSERT((__y_rename_at_4 == 25));
+}
+
+inline void test_for_continue_8f9304d6d3db568c ( Context * __context__ )
+{
+	int32_t __y_rename_at_14 = 0;
+	{
+		bool __need_loop_15 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,10));
+		int32_t __x_rename_at_15;
+		__need_loop_15 = __x_iterator.first(__context__,(__x_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __x_iterator.next(__context__,(__x_rename_at_15)) )
+		{
+			if ( (__x_rename_at_15 & 1) == 0 )
+			{
+				continue;
+			} else {
+				__y_rename_at_14 += __x_rename_at_15;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_15));
+	};
+	DAS_ASSERT((__y_rename_at_14 == 25));
+}
+
+inline void test_complex_for_continue_319449350152954d ( Context * __context__ )
+{
+	int32_t __y_rename_at_23 = 0;
+	TDim<int32_t,10> __arr_rename_at_24_ConstRef = ((TDim<int32_t,10>)(([&]() -> TDim<int32_t,10> {
+		TDim<int32_t,10> __mka_24;
+		__mka_24(0,__context__) = 0;
+		__mka_24(1,__context__) = 1;
+		__mka_24(2,__context__) = 2;
+		__mka_24(3,__context__) = 3;
+		__mka_24(4,__context__) = 4;
+		__mka_24(5,__context__) = 5;
+		__mka_24(6,__context__) = 6;
+		__mka_24(7,__context__) = 7;
+		__mka_24(8,__context__) = 8;
+		__mka_24(9,__context__) = 9;
+		return __mka_24;
+	})()));
+	TDim<int32_t,10> const  & __arr_rename_at_24 = __arr_rename_at_24_ConstRef; ;
+	{
+		bool __need_loop_25 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,10));
+		int32_t __x_rename_at_25;
+		__need_loop_25 = __x_iterator.first(__context__,(__x_rename_at_25)) && __need_loop_25;
+		// s : int const&
+		das_iterator<TDim<int32_t,10> const > __s_iterator(__arr_rename_at_24);
+		int32_t const  * __s_rename_at_25;
+		__need_loop_25 = __s_iterator.first(__context__,(__s_rename_at_25)) && __need_loop_25;
+		for ( ; __need_loop_25 ; __need_loop_25 = __x_iterator.next(__context__,(__x_rename_at_25)) && __s_iterator.next(__context__,(__s_rename_at_25)) )
+		{
+			DAS_ASSERT((__x_rename_at_25 == (*__s_rename_at_25)));
+			if ( (__x_rename_at_25 & 1) == 0 )
+			{
+				continue;
+			} else {
+				__y_rename_at_23 += __x_rename_at_25;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_25));
+		__s_iterator.close(__context__,(__s_rename_at_25));
+	};
+	DAS_ASSERT((__y_rename_at_23 == 25));
+}
+
+inline bool test_25b7d67143a7e0b1 ( Context * __context__ )
+{
+	test_while_continue_e3fd909602c8a5d6(__context__);
+	test_for_continue_8f9304d6d3db568c(__context__);
+	test_complex_for_continue_319449350152954d(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// test_while_continue_e3fd909602c8a5d6
+	aotLib[0xfffee20a488f935d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_while_continue_e3fd909602c8a5d6>>();
+	};
+	// test_for_continue_8f9304d6d3db568c
+	aotLib[0x1f43af5daf47ebc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_for_continue_8f9304d6d3db568c>>();
+	};
+	// test_complex_for_continue_319449350152954d
+	aotLib[0x2c81b64f6650945] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_complex_for_continue_319449350152954d>>();
+	};
+	// test_25b7d67143a7e0b1
+	aotLib[0x8d117311af382ad2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_25b7d67143a7e0b1>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,5646 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+ // require templates
+ // require contracts
+ // require array_boost
+ // require algorithm
+ // require templates_boost
+ // require functional
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_18023163524492816917 {
+
+extern StructInfo __struct_info__a85847e7150b5eb8;
+extern StructInfo __struct_info__457a06e6215cbac5;
+extern StructInfo __struct_info__86e12d2ec1a3606a;
+extern StructInfo __struct_info__e06853efcc15cee5;
+extern StructInfo __struct_info__e95a96f774b5ed21;
+extern StructInfo __struct_info__92b50408061416b3;
+extern StructInfo __struct_info__2ce346746a0ac39d;
+extern StructInfo __struct_info__6cd3faceff529fb8;
+extern StructInfo __struct_info__69d04685e0a74560;
+extern StructInfo __struct_info__898e7dd97feabbf5;
+extern StructInfo __struct_info__2243015f6b9fdc53;
+extern StructInfo __struct_info__505118442f85739a;
+extern StructInfo __struct_info__c20bde997ea8ce0c;
+extern StructInfo __struct_info__a48507c33051b48b;
+extern StructInfo __struct_info__ccf8cc02c6c3a4f3;
+extern StructInfo __struct_info__6b2f06a43c338f58;
+extern StructInfo __struct_info__d7b9a3ba8861754d;
+extern StructInfo __struct_info__5379a78d4f0222d0;
+extern StructInfo __struct_info__1f7d25ab09c709ec;
+extern StructInfo __struct_info__e05287b17561f9c7;
+extern StructInfo __struct_info__cc60e6d24de9e46d;
+extern StructInfo __struct_info__e05284b17561f4ae;
+extern StructInfo __struct_info__86e12e2ec1a3621d;
+extern StructInfo __struct_info__9e41a3bdecab19b2;
+extern StructInfo __struct_info__e04ef7b1755ecf40;
+extern StructInfo __struct_info__bf6564276a883dd0;
+extern StructInfo __struct_info__f0c3644e1dd3b80a;
+extern StructInfo __struct_info__ee404e56325864fc;
+extern StructInfo __struct_info__76faad0f01a00c4b;
+extern StructInfo __struct_info__e6264309573020f1;
+extern StructInfo __struct_info__7b560e51625f24ee;
+extern StructInfo __struct_info__505116442f857034;
+extern StructInfo __struct_info__79929d78926b8fa7;
+extern StructInfo __struct_info__1f7d28ab09c70f05;
+extern TypeInfo __type_info__3c6cf2e5c7dde6ad;
+extern TypeInfo __type_info__6f3948a703b89a51;
+extern TypeInfo __type_info__1bdc8d89ade286f;
+extern TypeInfo __type_info__6cde42349a0dc4e2;
+extern TypeInfo __type_info__cd1cc76c0b5b3a3b;
+extern TypeInfo __type_info__a8f3a4fc49b1f977;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__90f4c07b5a6e390;
+extern TypeInfo __type_info__4f1bdf8b4f0601a8;
+extern TypeInfo __type_info__7478fdc114c254be;
+extern TypeInfo __type_info__bc40da34bfd9f5ff;
+extern TypeInfo __type_info__ecf20d246ea2da8d;
+extern TypeInfo __type_info__2f475a6f20815946;
+extern TypeInfo __type_info__4df7545c01645ae1;
+extern TypeInfo __type_info__bb9c492cc91755d5;
+extern TypeInfo __type_info__2a6ca4b563f875a3;
+extern TypeInfo __type_info__a1b1f7687b7fc012;
+extern TypeInfo __type_info__6794cf34222edd2b;
+extern TypeInfo __type_info__af63df4c8601f1a5;
+extern TypeInfo __type_info__98e7065ef71d3cfb;
+extern TypeInfo __type_info__296c1814f03c34e5;
+extern TypeInfo __type_info__1c031d28e891379a;
+extern TypeInfo __type_info__ce32da0418ebc6d6;
+extern TypeInfo __type_info__1dfcb9675860dcfc;
+extern TypeInfo __type_info__60d5936f4e638ac2;
+extern TypeInfo __type_info__24de1aaea8f37bbf;
+extern TypeInfo __type_info__230ec6e68c66775c;
+extern TypeInfo __type_info__d6ada678229fa84;
+extern TypeInfo __type_info__15b5672770fd3027;
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__185ee399728dead3;
+extern TypeInfo __type_info__1377ef38c945836d;
+extern TypeInfo __type_info__4db90dc5fb10ec13;
+extern TypeInfo __type_info__bdf7a1e0681463c1;
+extern TypeInfo __type_info__156ad800a98c62a8;
+extern TypeInfo __type_info__561b702296a83038;
+extern TypeInfo __type_info__1ea30300aeed91a9;
+extern TypeInfo __type_info__fd3623f6e384d1fc;
+extern TypeInfo __type_info__b29301ae75415d99;
+extern TypeInfo __type_info__4da5125fcede02e2;
+extern TypeInfo __type_info__b69bd28e2d842dd9;
+extern TypeInfo __type_info__6a3930e350d8b9e7;
+extern TypeInfo __type_info__3ded19b5586b95b7;
+extern TypeInfo __type_info__e732f984707a7444;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__f4047c7272c4eb5b;
+extern TypeInfo __type_info__c6da56122d36aaea;
+extern TypeInfo __type_info__25a520ad1b30fd9;
+extern TypeInfo __type_info__83c6ce69a67deaf0;
+extern TypeInfo __type_info__c655f0f336e027e9;
+extern TypeInfo __type_info__d727cf470ebcdf10;
+extern TypeInfo __type_info__53c59994f551fa0a;
+extern TypeInfo __type_info__a52e7c07602356af;
+extern TypeInfo __type_info__ade9b1523a00b747;
+extern TypeInfo __type_info__db27357fa3eaaa3e;
+extern TypeInfo __type_info__be0705f80ec4dc07;
+extern TypeInfo __type_info__cb7308b44d3f8ad6;
+extern TypeInfo __type_info__16a32539a1950c90;
+extern TypeInfo __type_info__8875b5a4bb8f230d;
+extern TypeInfo __type_info__fe5a5d63abb87972;
+extern TypeInfo __type_info__7bf5307b489d850;
+extern TypeInfo __type_info__dc109ea7c63e48a;
+extern TypeInfo __type_info__8eea9764bc67c160;
+extern TypeInfo __type_info__ebd3969580ab017b;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__6eaa4ee09cf6186c;
+extern TypeInfo __type_info__c64ef0f336da093b;
+extern TypeInfo __type_info__6d5eace1673c3cd9;
+extern TypeInfo __type_info__6d54aae16733e4ee;
+extern TypeInfo __type_info__bd650e7b2b33be23;
+extern TypeInfo __type_info__388a580cd154083c;
+extern TypeInfo __type_info__64be5dc860f5ba81;
+extern TypeInfo __type_info__d85a88cb0811b649;
+extern TypeInfo __type_info__f4903c6752ec6541;
+extern TypeInfo __type_info__2feb34e5d3529432;
+extern TypeInfo __type_info__3c724274ce6fd088;
+extern TypeInfo __type_info__eaa81096831f6030;
+extern TypeInfo __type_info__287226494776f491;
+extern TypeInfo __type_info__8c109174916e450c;
+extern TypeInfo __type_info__4df3d25c01614824;
+extern TypeInfo __type_info__254c2aebd5a0e423;
+extern TypeInfo __type_info__faa8860665a6a9c9;
+extern TypeInfo __type_info__a177731b62cb70ec;
+extern TypeInfo __type_info__bbbb40b84cc1be8d;
+extern TypeInfo __type_info__5f97da61fb7344c5;
+extern TypeInfo __type_info__772d2adc9dad5ec5;
+extern TypeInfo __type_info__40f0563f55af18bb;
+extern TypeInfo __type_info__6d36f884b58c289e;
+extern TypeInfo __type_info__289c16574f003020;
+extern TypeInfo __type_info__1574da00a994ba93;
+extern TypeInfo __type_info__a3dfaa63decefde;
+extern TypeInfo __type_info__aacae256c3713dd6;
+extern TypeInfo __type_info__40ad0c15d6e5502e;
+extern TypeInfo __type_info__d579d48436105d0b;
+extern TypeInfo __type_info__48dc519e0431cc1c;
+extern TypeInfo __type_info__3ceb21b1e6727087;
+extern VarInfo __var_info__41231575836789c2;
+extern VarInfo __var_info__35c2487ba7ef17fe;
+extern VarInfo __var_info__e12dd4a55be216df;
+extern VarInfo __var_info__bf843d341239202a;
+extern VarInfo __var_info__12e982af3775fae3;
+extern VarInfo __var_info__baa5dd887a9b32c2;
+extern VarInfo __var_info__d6b44798c15cfab2;
+extern VarInfo __var_info__1873c8a855f79b6e;
+extern VarInfo __var_info__9b909e119b9866e0;
+extern VarInfo __var_info__931731041ae25d31;
+extern VarInfo __var_info__2d48786570422ae2;
+extern VarInfo __var_info__a626d4777fa2314;
+extern VarInfo __var_info__c213154ac11a2dcc;
+extern VarInfo __var_info__b464c5bdbd7a130b;
+extern VarInfo __var_info__82c38a7edadf71d3;
+extern VarInfo __var_info__897bb4368f829982;
+extern VarInfo __var_info__2af722ec4562f12;
+extern VarInfo __var_info__64aa7bef173ed259;
+extern VarInfo __var_info__537c6d5ffaf9692a;
+extern VarInfo __var_info__c0394fca1b062f84;
+extern VarInfo __var_info__f459a0f5d7fd1e6b;
+extern VarInfo __var_info__856b5915e3e9f46d;
+extern VarInfo __var_info__fdd2746267d2c809;
+extern VarInfo __var_info__2a80e543fb25fe1d;
+extern VarInfo __var_info__5ba65153a93c6a2f;
+extern VarInfo __var_info__6a08a50c5c0db60a;
+extern VarInfo __var_info__e1ed5cefcddbeb30;
+extern VarInfo __var_info__163cc3683f865ac2;
+extern VarInfo __var_info__4d29bb2ccd97f7d3;
+extern VarInfo __var_info__9caeff022f8dc62f;
+extern VarInfo __var_info__3bf2dc2b5c1215a;
+extern VarInfo __var_info__8994d37c268bbc7;
+extern VarInfo __var_info__a410916d2e6092d3;
+extern VarInfo __var_info__feafe9e27e51081b;
+extern VarInfo __var_info__b09d39a1455a86fb;
+extern VarInfo __var_info__c41beb5df221da95;
+extern VarInfo __var_info__ed5415ff51555740;
+extern VarInfo __var_info__a56319fc1b731951;
+extern VarInfo __var_info__8e0a154d05c65fd0;
+extern VarInfo __var_info__99cdc6fd055b9a5b;
+extern VarInfo __var_info__9f62ab6d76407d27;
+extern VarInfo __var_info__dbb056abc8d03a71;
+extern VarInfo __var_info__3d24db0fed9132fc;
+extern VarInfo __var_info__e5080e4689edc608;
+extern VarInfo __var_info__89c536b99baef1a;
+extern VarInfo __var_info__e27dc4c062dc47a4;
+extern VarInfo __var_info__dce23bef3ff8cd1b;
+extern VarInfo __var_info__133e50273ceb57dc;
+extern VarInfo __var_info__6bc0b0633ab5be61;
+extern VarInfo __var_info__8c1970d0228eff27;
+extern VarInfo __var_info__9ce73ac1ed50da6d;
+extern VarInfo __var_info__6e8dc1e75265ad96;
+extern VarInfo __var_info__ef1777856a6d0029;
+extern VarInfo __var_info__2458bfbb07d8c6d0;
+extern VarInfo __var_info__6054875315d987a1;
+extern VarInfo __var_info__96c75a7a8a97ae9;
+extern VarInfo __var_info__eb3470eb4bf7331b;
+extern VarInfo __var_info__bf9493d0b2f0be00;
+extern VarInfo __var_info__fce032f1e99e61d8;
+extern VarInfo __var_info__ab6d31d2f97e4af7;
+extern VarInfo __var_info__374bc5ace2baf464;
+extern VarInfo __var_info__6b8e51d797ee6341;
+extern VarInfo __var_info__bc76fe9107390716;
+extern VarInfo __var_info__9223ab46decd43db;
+extern VarInfo __var_info__5f488ad817df3de5;
+extern VarInfo __var_info__cfb3cfbed4303855;
+extern VarInfo __var_info__f1f1094e9689c328;
+extern VarInfo __var_info__991dd422f0c17fe9;
+extern VarInfo __var_info__330a446dc9ffd49e;
+extern VarInfo __var_info__4fa697303724052c;
+extern VarInfo __var_info__49329069474a6b5e;
+extern VarInfo __var_info__a15c8318d58250de;
+extern VarInfo __var_info__44f9d2d40a46ea36;
+extern VarInfo __var_info__a76a9520efed719e;
+extern VarInfo __var_info__c9baa23ac99b7b45;
+extern VarInfo __var_info__419b1078ec5c2499;
+extern VarInfo __var_info__ab9451ebc7b57d1e;
+extern VarInfo __var_info__6f5cb03c59af98ed;
+extern VarInfo __var_info__5bfe33da07321ca0;
+extern VarInfo __var_info__6deeb8339a632378;
+extern VarInfo __var_info__818b334628890f2d;
+extern VarInfo __var_info__a5ceab81e3bddf37;
+extern VarInfo __var_info__880f3265823244d2;
+extern VarInfo __var_info__8cc8f0abc3db6e4f;
+extern VarInfo __var_info__f8cefcec84dc5a29;
+extern VarInfo __var_info__ab7074fb9859e492;
+extern VarInfo __var_info__8b3b768da817dba2;
+extern VarInfo __var_info__231a1f3163e7dc36;
+extern VarInfo __var_info__ec26e76da39561d5;
+extern VarInfo __var_info__92a0e0aef0040cc3;
+extern VarInfo __var_info__c136ef23591a4ad1;
+extern VarInfo __var_info__5444c3f5adffa911;
+extern VarInfo __var_info__cb73015c7adfb021;
+extern VarInfo __var_info__7d26b512c5e363ff;
+extern VarInfo __var_info__7299da708df98457;
+extern VarInfo __var_info__7f814b0819b7668c;
+extern VarInfo __var_info__d149c2fe063ed0a3;
+extern VarInfo __var_info__c498ba6c2dacc3b4;
+extern VarInfo __var_info__1f48c8b904d5503;
+extern VarInfo __var_info__708b7b1f4637864b;
+extern VarInfo __var_info__122c87a5ad47aba1;
+extern VarInfo __var_info__87972290f7741d36;
+extern VarInfo __var_info__13c93a11486eb59b;
+extern VarInfo __var_info__3cc04425cbca614;
+extern VarInfo __var_info__425227d8250de85e;
+extern VarInfo __var_info__fcfcb5fad760aa04;
+extern VarInfo __var_info__84282290df3e7891;
+extern VarInfo __var_info__d80749743c69bf50;
+extern VarInfo __var_info__a0ee2674079cb3f3;
+extern VarInfo __var_info__1967dbffe571fc1b;
+extern VarInfo __var_info__f769408d0fc18a8;
+extern VarInfo __var_info__3a99fc763b36bbe6;
+extern VarInfo __var_info__e20ef7ef257d39ea;
+extern VarInfo __var_info__f3e8e880d0eb9dbd;
+extern VarInfo __var_info__ca393ac68b11b641;
+extern VarInfo __var_info__db3bb94fdbe236ac;
+extern VarInfo __var_info__c38ac19d3e7d134d;
+extern VarInfo __var_info__ef09cee91256acaa;
+extern VarInfo __var_info__f239e2fdda1e11d1;
+extern VarInfo __var_info__f768508d0fbff2b;
+extern VarInfo __var_info__c6b59b7e75f59881;
+extern VarInfo __var_info__bf06151889a0f864;
+extern VarInfo __var_info__800fccae2dafff6d;
+extern VarInfo __var_info__42ddb9b88c571654;
+extern VarInfo __var_info__bf91dac1c0424d3e;
+extern VarInfo __var_info__a2bdd742b79f6f0d;
+extern VarInfo __var_info__d07b15afd6632a09;
+extern VarInfo __var_info__d5d7acedf4f52721;
+extern VarInfo __var_info__c145a61aa5ecee30;
+extern VarInfo __var_info__f8588da5193fd51b;
+extern VarInfo __var_info__1b93c462ba49c924;
+extern VarInfo __var_info__adcc850039d0e4ca;
+extern VarInfo __var_info__254713a4a2a82514;
+extern VarInfo __var_info__4d29ca2ccd981150;
+extern VarInfo __var_info__f17fbc91307fb4ad;
+extern VarInfo __var_info__26a01c88268cb5cf;
+extern VarInfo __var_info__6ecb0f443ca8f3c0;
+extern VarInfo __var_info__2fbc78f773d7401d;
+extern VarInfo __var_info__81a08c6de345a68f;
+extern VarInfo __var_info__96e97f1b692dc611;
+extern VarInfo __var_info__347d7050bf525b84;
+extern VarInfo __var_info__5878beb11b9587a6;
+extern VarInfo __var_info__f4d2d236857e8469;
+extern VarInfo __var_info__4e6a96af8cadd9e0;
+extern VarInfo __var_info__a1c5d6da012c442;
+extern VarInfo __var_info__4760267365f86032;
+extern VarInfo __var_info__59b48f0526aedaa0;
+extern VarInfo __var_info__9e81c6e3a7ba927e;
+extern VarInfo __var_info__455fcc757e81028e;
+extern VarInfo __var_info__ab085c80b1ef097d;
+extern VarInfo __var_info__283ff0d6ce83b96f;
+extern VarInfo __var_info__f7a34774dbafdcaa;
+extern VarInfo __var_info__6e7df3a854835bc3;
+extern VarInfo __var_info__2f7403daa0dfe830;
+extern VarInfo __var_info__84f207feddc48571;
+extern VarInfo __var_info__ec9e71652a498b27;
+extern VarInfo __var_info__eff1d041c451a868;
+extern VarInfo __var_info__6f6ef5b6c61adf85;
+extern VarInfo __var_info__3b47a494f348af73;
+extern VarInfo __var_info__b49a4f344acb0e84;
+extern VarInfo __var_info__161d4ca044c366a4;
+extern VarInfo __var_info__eff413641e894799;
+extern VarInfo __var_info__7419090aca2d044d;
+extern VarInfo __var_info__9ac7a3a52e4561a2;
+extern VarInfo __var_info__8d473e4f1ce92dfe;
+extern VarInfo __var_info__5f4899d817df5762;
+extern VarInfo __var_info__d6f2b86016f84622;
+extern VarInfo __var_info__b8f6822dc1884b78;
+extern VarInfo __var_info__e321df23c40fe10c;
+extern VarInfo __var_info__84485af89858e60b;
+extern VarInfo __var_info__5183870d2868632c;
+extern VarInfo __var_info__e211f34da3d67f70;
+extern VarInfo __var_info__8e22436da23cb23d;
+extern VarInfo __var_info__16180a85ae298084;
+extern VarInfo __var_info__b472ea4559b3eeab;
+extern VarInfo __var_info__2267d7b2c69e338;
+extern VarInfo __var_info__ac41e8bd3cbf4ede;
+extern VarInfo __var_info__4c0a2163ff7d4c8f;
+extern VarInfo __var_info__4b8bebd7215be277;
+extern VarInfo __var_info__47b697b226afac6d;
+extern VarInfo __var_info__93ff79d4ff5841eb;
+extern VarInfo __var_info__338dd8063da5b3c5;
+extern VarInfo __var_info__2408ca8a8597af2;
+extern VarInfo __var_info__2306e66be2653640;
+extern VarInfo __var_info__c6711dc6270e4a57;
+extern VarInfo __var_info__c97f3457eb618c7d;
+extern VarInfo __var_info__18d63c276547096;
+extern VarInfo __var_info__307ec46ae406b26a;
+extern VarInfo __var_info__ecc2047731861164;
+extern VarInfo __var_info__86f6ceb928baf727;
+extern VarInfo __var_info__c9cc9ed90fb573c6;
+extern VarInfo __var_info__259e386451885ea4;
+extern VarInfo __var_info__739b51c640158dc3;
+extern VarInfo __var_info__48095b3a80371ec8;
+extern VarInfo __var_info__96372baacac69c85;
+extern VarInfo __var_info__adc9c6d905f2d2ff;
+extern VarInfo __var_info__71433de95c2ee6b7;
+extern VarInfo __var_info__1aaa1511dc425596;
+extern VarInfo __var_info__d9ab86a8a6da2ee3;
+extern VarInfo __var_info__f64e025a6d26c4af;
+extern VarInfo __var_info__15ce4ee826625810;
+extern VarInfo __var_info__2b28cef087294366;
+extern VarInfo __var_info__9c03050f176a361;
+extern VarInfo __var_info__19534cf9d1b07815;
+extern VarInfo __var_info__46fcef6ab54163d9;
+extern VarInfo __var_info__f84bc8e430a5822;
+extern VarInfo __var_info__e88be593a4db34d1;
+extern VarInfo __var_info__9e5b982411f8f7e9;
+extern VarInfo __var_info__589ef7d16f645296;
+extern VarInfo __var_info__47cdcd65e209db68;
+extern VarInfo __var_info__a4bc273a4f6f9e6f;
+extern VarInfo __var_info__1219633e7d186a7;
+extern VarInfo __var_info__2f554df5aa41a39c;
+extern VarInfo __var_info__669132c7c044ead6;
+extern VarInfo __var_info__b7a0b6874528c2f5;
+extern VarInfo __var_info__c27c02167ddba684;
+extern VarInfo __var_info__2508bc17acf0a66a;
+extern VarInfo __var_info__4b683374b4b91f6b;
+extern VarInfo __var_info__a901c7a6cff11d23;
+extern VarInfo __var_info__1c065fb77cbdeed4;
+extern VarInfo __var_info__a22d7f26e5fbda66;
+extern VarInfo __var_info__2029c1490c1ada15;
+extern VarInfo __var_info__c0646b21183db7e;
+extern VarInfo __var_info__9d631da847f747a6;
+extern VarInfo __var_info__816d8a505714855;
+extern VarInfo __var_info__527d4d4089b4faa7;
+extern VarInfo __var_info__12d5070fd1ad752f;
+extern VarInfo __var_info__51b92c8819c648a1;
+extern VarInfo __var_info__f885959092007c0b;
+extern VarInfo __var_info__525157ac5b2e5776;
+extern VarInfo __var_info__e5e769a71281be8c;
+extern VarInfo __var_info__b8aa2266b59867ec;
+extern VarInfo __var_info__95983e212a66912a;
+extern VarInfo __var_info__9b1cd299e7625f53;
+extern VarInfo __var_info__a519df5d65409d2d;
+extern VarInfo __var_info__af0325e33812d1e;
+extern VarInfo __var_info__defc66e2747a5923;
+extern VarInfo __var_info__1f2814e9177d3688;
+extern VarInfo __var_info__b2a19359ea5385b0;
+extern FuncInfo __func_info__d38a664a1724371c;
+
+TypeInfo * __type_info__991dd422f0c17fe9_arg_types_var_12130524654138515128[2] = { &__type_info__bd650e7b2b33be23, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__a85847e7150b5eb8_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__991dd422f0c17fe9_arg_types_var_12130524654138515128, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x991dd422f0c17fe9), "__lambda", 0 };
+TypeInfo * __type_info__eff1d041c451a868_arg_types_var_12130524654138515128[1] = { &__type_info__be0705f80ec4dc07 };
+VarInfo __struct_info__a85847e7150b5eb8_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__eff1d041c451a868_arg_types_var_12130524654138515128, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xeff1d041c451a868), "__finalize", 8 };
+VarInfo * __struct_info__a85847e7150b5eb8_fields[2] =  { &__struct_info__a85847e7150b5eb8_field_0, &__struct_info__a85847e7150b5eb8_field_1 };
+StructInfo __struct_info__a85847e7150b5eb8 = {"_lambda_thismodule_180_30_18", "", 6, __struct_info__a85847e7150b5eb8_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xa85847e7150b5eb8) };
+TypeInfo * __type_info__ac41e8bd3cbf4ede_arg_types_var_5006321521247697605[2] = { &__type_info__2f475a6f20815946, &__type_info__c6da56122d36aaea };
+VarInfo __struct_info__457a06e6215cbac5_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__ac41e8bd3cbf4ede_arg_types_var_5006321521247697605, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xac41e8bd3cbf4ede), "__lambda", 0 };
+TypeInfo * __type_info__99cdc6fd055b9a5b_arg_types_var_5006321521247697605[1] = { &__type_info__d6ada678229fa84 };
+VarInfo __struct_info__457a06e6215cbac5_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__99cdc6fd055b9a5b_arg_types_var_5006321521247697605, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x99cdc6fd055b9a5b), "__finalize", 8 };
+VarInfo __struct_info__457a06e6215cbac5_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xe20ef7ef257d39ea), "__yield", 16 };
+VarInfo __struct_info__457a06e6215cbac5_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x87972290f7741d36), "_loop_at_90", 20 };
+VarInfo __struct_info__457a06e6215cbac5_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa56319fc1b731951), "x", 24 };
+VarInfo __struct_info__457a06e6215cbac5_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8d473e4f1ce92dfe), "_pvar_0_at_90", 32 };
+VarInfo __struct_info__457a06e6215cbac5_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x8b3b768da817dba2), "_source_0_at_90", 40 };
+VarInfo * __struct_info__457a06e6215cbac5_fields[7] =  { &__struct_info__457a06e6215cbac5_field_0, &__struct_info__457a06e6215cbac5_field_1, &__struct_info__457a06e6215cbac5_field_2, &__struct_info__457a06e6215cbac5_field_3, &__struct_info__457a06e6215cbac5_field_4, &__struct_info__457a06e6215cbac5_field_5, &__struct_info__457a06e6215cbac5_field_6 };
+StructInfo __struct_info__457a06e6215cbac5 = {"_lambda_thismodule_90_14_11", "", 14, __struct_info__457a06e6215cbac5_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x457a06e6215cbac5) };
+TypeInfo * __type_info__7299da708df98457_arg_types_var_9719099149682696298[2] = { &__type_info__4df7545c01645ae1, &__type_info__7478fdc114c254be };
+VarInfo __struct_info__86e12d2ec1a3606a_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__7299da708df98457_arg_types_var_9719099149682696298, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x7299da708df98457), "__lambda", 0 };
+TypeInfo * __type_info__a76a9520efed719e_arg_types_var_9719099149682696298[1] = { &__type_info__faa8860665a6a9c9 };
+VarInfo __struct_info__86e12d2ec1a3606a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__a76a9520efed719e_arg_types_var_9719099149682696298, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xa76a9520efed719e), "__finalize", 8 };
+VarInfo __struct_info__86e12d2ec1a3606a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x338dd8063da5b3c5), "__yield", 16 };
+VarInfo __struct_info__86e12d2ec1a3606a_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x3cc04425cbca614), "src", 24 };
+VarInfo __struct_info__86e12d2ec1a3606a_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__c6da56122d36aaea, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xa2bdd742b79f6f0d), "arr", 32 };
+VarInfo __struct_info__86e12d2ec1a3606a_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xa626d4777fa2314), "___loop_at_147_rename_at_147", 56 };
+VarInfo __struct_info__86e12d2ec1a3606a_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c6da56122d36aaea, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xc498ba6c2dacc3b4), "__x_rename_at_147", 64 };
+VarInfo __struct_info__86e12d2ec1a3606a_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xc0394fca1b062f84), "___pvar_0_at_147_rename_at_147", 72 };
+VarInfo __struct_info__86e12d2ec1a3606a_field_8 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x163cc3683f865ac2), "_loop_at_143", 80 };
+VarInfo __struct_info__86e12d2ec1a3606a_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xab7074fb9859e492), "_source_0_at_143", 88 };
+VarInfo __struct_info__86e12d2ec1a3606a_field_10 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x2af722ec4562f12), "x", 96 };
+VarInfo __struct_info__86e12d2ec1a3606a_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x425227d8250de85e), "_pvar_0_at_143", 120 };
+VarInfo __struct_info__86e12d2ec1a3606a_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__ce32da0418ebc6d6, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x8e0a154d05c65fd0), "___source_0_at_147_rename_at_147", 128 };
+VarInfo * __struct_info__86e12d2ec1a3606a_fields[13] =  { &__struct_info__86e12d2ec1a3606a_field_0, &__struct_info__86e12d2ec1a3606a_field_1, &__struct_info__86e12d2ec1a3606a_field_2, &__struct_info__86e12d2ec1a3606a_field_3, &__struct_info__86e12d2ec1a3606a_field_4, &__struct_info__86e12d2ec1a3606a_field_5, &__struct_info__86e12d2ec1a3606a_field_6, &__struct_info__86e12d2ec1a3606a_field_7, &__struct_info__86e12d2ec1a3606a_field_8, &__struct_info__86e12d2ec1a3606a_field_9, &__struct_info__86e12d2ec1a3606a_field_10, &__struct_info__86e12d2ec1a3606a_field_11, &__struct_info__86e12d2ec1a3606a_field_12 };
+StructInfo __struct_info__86e12d2ec1a3606a = {"_lambda_thismodule_142_12_29", "", 30, __struct_info__86e12d2ec1a3606a_fields, 13, 136, UINT64_C(0x0), nullptr, UINT64_C(0x86e12d2ec1a3606a) };
+TypeInfo * __type_info__9e81c6e3a7ba927e_arg_types_var_16170266751460036325[2] = { &__type_info__db27357fa3eaaa3e, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__e06853efcc15cee5_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__9e81c6e3a7ba927e_arg_types_var_16170266751460036325, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x9e81c6e3a7ba927e), "__lambda", 0 };
+TypeInfo * __type_info__b09d39a1455a86fb_arg_types_var_16170266751460036325[1] = { &__type_info__8c109174916e450c };
+VarInfo __struct_info__e06853efcc15cee5_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__b09d39a1455a86fb_arg_types_var_16170266751460036325, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xb09d39a1455a86fb), "__finalize", 8 };
+VarInfo __struct_info__e06853efcc15cee5_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x6a08a50c5c0db60a), "__yield", 16 };
+VarInfo __struct_info__e06853efcc15cee5_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xf1f1094e9689c328), "_loop_at_227", 20 };
+VarInfo __struct_info__e06853efcc15cee5_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x84f207feddc48571), "x", 24 };
+VarInfo __struct_info__e06853efcc15cee5_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xb2a19359ea5385b0), "_pvar_0_at_227", 32 };
+VarInfo __struct_info__e06853efcc15cee5_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xecc2047731861164), "_source_0_at_227", 40 };
+VarInfo * __struct_info__e06853efcc15cee5_fields[7] =  { &__struct_info__e06853efcc15cee5_field_0, &__struct_info__e06853efcc15cee5_field_1, &__struct_info__e06853efcc15cee5_field_2, &__struct_info__e06853efcc15cee5_field_3, &__struct_info__e06853efcc15cee5_field_4, &__struct_info__e06853efcc15cee5_field_5, &__struct_info__e06853efcc15cee5_field_6 };
+StructInfo __struct_info__e06853efcc15cee5 = {"_lambda_thismodule_227_19_7", "", 14, __struct_info__e06853efcc15cee5_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0xe06853efcc15cee5) };
+TypeInfo * __type_info__2508bc17acf0a66a_arg_types_var_16814918148300336417[2] = { &__type_info__3c724274ce6fd088, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__e95a96f774b5ed21_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__2508bc17acf0a66a_arg_types_var_16814918148300336417, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x2508bc17acf0a66a), "__lambda", 0 };
+TypeInfo * __type_info__adc9c6d905f2d2ff_arg_types_var_16814918148300336417[1] = { &__type_info__fd3623f6e384d1fc };
+VarInfo __struct_info__e95a96f774b5ed21_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__adc9c6d905f2d2ff_arg_types_var_16814918148300336417, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xadc9c6d905f2d2ff), "__finalize", 8 };
+VarInfo * __struct_info__e95a96f774b5ed21_fields[2] =  { &__struct_info__e95a96f774b5ed21_field_0, &__struct_info__e95a96f774b5ed21_field_1 };
+StructInfo __struct_info__e95a96f774b5ed21 = {"_lambda_thismodule_163_30_16", "", 6, __struct_info__e95a96f774b5ed21_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xe95a96f774b5ed21) };
+TypeInfo * __type_info__c145a61aa5ecee30_arg_types_var_10571360132830336691[2] = { &__type_info__2feb34e5d3529432, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__92b50408061416b3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, (TypeInfo **)__type_info__c145a61aa5ecee30_arg_types_var_10571360132830336691, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xc145a61aa5ecee30), "__lambda", 0 };
+TypeInfo * __type_info__ec26e76da39561d5_arg_types_var_10571360132830336691[1] = { &__type_info__a1b1f7687b7fc012 };
+VarInfo __struct_info__92b50408061416b3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__ec26e76da39561d5_arg_types_var_10571360132830336691, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xec26e76da39561d5), "__finalize", 8 };
+VarInfo * __struct_info__92b50408061416b3_fields[2] =  { &__struct_info__92b50408061416b3_field_0, &__struct_info__92b50408061416b3_field_1 };
+StructInfo __struct_info__92b50408061416b3 = {"_lambda_thismodule_85_28_1", "", 6, __struct_info__92b50408061416b3_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x92b50408061416b3) };
+TypeInfo * __type_info__3a99fc763b36bbe6_arg_types_var_3234506423191389085[2] = { &__type_info__561b702296a83038, &__type_info__c6da56122d36aaea };
+VarInfo __struct_info__2ce346746a0ac39d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__3a99fc763b36bbe6_arg_types_var_3234506423191389085, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x3a99fc763b36bbe6), "__lambda", 0 };
+TypeInfo * __type_info__9b1cd299e7625f53_arg_types_var_3234506423191389085[1] = { &__type_info__eaa81096831f6030 };
+VarInfo __struct_info__2ce346746a0ac39d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__9b1cd299e7625f53_arg_types_var_3234506423191389085, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x9b1cd299e7625f53), "__finalize", 8 };
+VarInfo __struct_info__2ce346746a0ac39d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x4760267365f86032), "__yield", 16 };
+VarInfo __struct_info__2ce346746a0ac39d_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xdefc66e2747a5923), "_loop_at_240", 20 };
+VarInfo __struct_info__2ce346746a0ac39d_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x46fcef6ab54163d9), "x", 24 };
+VarInfo __struct_info__2ce346746a0ac39d_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x93ff79d4ff5841eb), "_pvar_0_at_240", 32 };
+VarInfo __struct_info__2ce346746a0ac39d_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x7d26b512c5e363ff), "_source_0_at_240", 40 };
+VarInfo * __struct_info__2ce346746a0ac39d_fields[7] =  { &__struct_info__2ce346746a0ac39d_field_0, &__struct_info__2ce346746a0ac39d_field_1, &__struct_info__2ce346746a0ac39d_field_2, &__struct_info__2ce346746a0ac39d_field_3, &__struct_info__2ce346746a0ac39d_field_4, &__struct_info__2ce346746a0ac39d_field_5, &__struct_info__2ce346746a0ac39d_field_6 };
+StructInfo __struct_info__2ce346746a0ac39d = {"_lambda_thismodule_240_10_12", "", 14, __struct_info__2ce346746a0ac39d_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x2ce346746a0ac39d) };
+TypeInfo * __type_info__96c75a7a8a97ae9_arg_types_var_7841887143135977400[2] = { &__type_info__1377ef38c945836d, &__type_info__c6da56122d36aaea };
+VarInfo __struct_info__6cd3faceff529fb8_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__96c75a7a8a97ae9_arg_types_var_7841887143135977400, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x96c75a7a8a97ae9), "__lambda", 0 };
+TypeInfo * __type_info__47cdcd65e209db68_arg_types_var_7841887143135977400[1] = { &__type_info__24de1aaea8f37bbf };
+VarInfo __struct_info__6cd3faceff529fb8_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__47cdcd65e209db68_arg_types_var_7841887143135977400, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x47cdcd65e209db68), "__finalize", 8 };
+VarInfo __struct_info__6cd3faceff529fb8_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x4c0a2163ff7d4c8f), "__yield", 16 };
+TypeInfo * __type_info__1967dbffe571fc1b_arg_types_var_7841887143135977400[1] = { &__type_info__a52e7c07602356af };
+VarInfo __struct_info__6cd3faceff529fb8_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__5f97da61fb7344c5, nullptr, (TypeInfo **)__type_info__1967dbffe571fc1b_arg_types_var_7841887143135977400, nullptr, 1, 0, nullptr, 24576, 8, UINT64_C(0x1967dbffe571fc1b), "blk", 24 };
+VarInfo __struct_info__6cd3faceff529fb8_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6794cf34222edd2b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xadcc850039d0e4ca), "src", 32 };
+VarInfo __struct_info__6cd3faceff529fb8_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x816d8a505714855), "_loop_at_41", 40 };
+VarInfo __struct_info__6cd3faceff529fb8_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6794cf34222edd2b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x84282290df3e7891), "_source_0_at_41", 48 };
+VarInfo __struct_info__6cd3faceff529fb8_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x9c03050f176a361), "w", 56 };
+VarInfo __struct_info__6cd3faceff529fb8_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x6f6ef5b6c61adf85), "_pvar_0_at_41", 64 };
+VarInfo * __struct_info__6cd3faceff529fb8_fields[9] =  { &__struct_info__6cd3faceff529fb8_field_0, &__struct_info__6cd3faceff529fb8_field_1, &__struct_info__6cd3faceff529fb8_field_2, &__struct_info__6cd3faceff529fb8_field_3, &__struct_info__6cd3faceff529fb8_field_4, &__struct_info__6cd3faceff529fb8_field_5, &__struct_info__6cd3faceff529fb8_field_6, &__struct_info__6cd3faceff529fb8_field_7, &__struct_info__6cd3faceff529fb8_field_8 };
+StructInfo __struct_info__6cd3faceff529fb8 = {"_lambda_thismodule_41_12_34", "", 14, __struct_info__6cd3faceff529fb8_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0x6cd3faceff529fb8) };
+TypeInfo * __type_info__ca393ac68b11b641_arg_types_var_7624671709951903072[2] = { &__type_info__25a520ad1b30fd9, &__type_info__a52e7c07602356af };
+VarInfo __struct_info__69d04685e0a74560_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__ca393ac68b11b641_arg_types_var_7624671709951903072, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xca393ac68b11b641), "__lambda", 0 };
+TypeInfo * __type_info__2458bfbb07d8c6d0_arg_types_var_7624671709951903072[1] = { &__type_info__d579d48436105d0b };
+VarInfo __struct_info__69d04685e0a74560_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__2458bfbb07d8c6d0_arg_types_var_7624671709951903072, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x2458bfbb07d8c6d0), "__finalize", 8 };
+VarInfo * __struct_info__69d04685e0a74560_fields[2] =  { &__struct_info__69d04685e0a74560_field_0, &__struct_info__69d04685e0a74560_field_1 };
+StructInfo __struct_info__69d04685e0a74560 = {"_lambda_thismodule_91_25_26", "", 6, __struct_info__69d04685e0a74560_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x69d04685e0a74560) };
+TypeInfo * __type_info__1873c8a855f79b6e_arg_types_var_9911998202996505589[3] = { &__type_info__1dfcb9675860dcfc, &__type_info__90f5707b5a6f641, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__898e7dd97feabbf5_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f5707b5a6f641, nullptr, (TypeInfo **)__type_info__1873c8a855f79b6e_arg_types_var_9911998202996505589, nullptr, 3, 0, nullptr, 28, 8, UINT64_C(0x1873c8a855f79b6e), "__lambda", 0 };
+TypeInfo * __type_info__b464c5bdbd7a130b_arg_types_var_9911998202996505589[1] = { &__type_info__8eea9764bc67c160 };
+VarInfo __struct_info__898e7dd97feabbf5_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__b464c5bdbd7a130b_arg_types_var_9911998202996505589, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xb464c5bdbd7a130b), "__finalize", 8 };
+VarInfo * __struct_info__898e7dd97feabbf5_fields[2] =  { &__struct_info__898e7dd97feabbf5_field_0, &__struct_info__898e7dd97feabbf5_field_1 };
+StructInfo __struct_info__898e7dd97feabbf5 = {"_lambda_thismodule_115_27_15", "", 6, __struct_info__898e7dd97feabbf5_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x898e7dd97feabbf5) };
+TypeInfo * __type_info__d80749743c69bf50_arg_types_var_2468818530068323411[2] = { &__type_info__6eaa4ee09cf6186c, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__2243015f6b9fdc53_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__d80749743c69bf50_arg_types_var_2468818530068323411, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xd80749743c69bf50), "__lambda", 0 };
+TypeInfo * __type_info__b7a0b6874528c2f5_arg_types_var_2468818530068323411[1] = { &__type_info__dc109ea7c63e48a };
+VarInfo __struct_info__2243015f6b9fdc53_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__b7a0b6874528c2f5_arg_types_var_2468818530068323411, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xb7a0b6874528c2f5), "__finalize", 8 };
+VarInfo * __struct_info__2243015f6b9fdc53_fields[2] =  { &__struct_info__2243015f6b9fdc53_field_0, &__struct_info__2243015f6b9fdc53_field_1 };
+StructInfo __struct_info__2243015f6b9fdc53 = {"_lambda_thismodule_71_25_14", "", 6, __struct_info__2243015f6b9fdc53_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x2243015f6b9fdc53) };
+TypeInfo * __type_info__8c1970d0228eff27_arg_types_var_5787433677281915802[2] = { &__type_info__c655f0f336e027e9, &__type_info__d727cf470ebcdf10 };
+VarInfo __struct_info__505118442f85739a_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__8c1970d0228eff27_arg_types_var_5787433677281915802, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x8c1970d0228eff27), "__lambda", 0 };
+TypeInfo * __type_info__455fcc757e81028e_arg_types_var_5787433677281915802[1] = { &__type_info__772d2adc9dad5ec5 };
+VarInfo __struct_info__505118442f85739a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__455fcc757e81028e_arg_types_var_5787433677281915802, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x455fcc757e81028e), "__finalize", 8 };
+VarInfo __struct_info__505118442f85739a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xcfb3cfbed4303855), "__yield", 16 };
+VarInfo __struct_info__505118442f85739a_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__ecf20d246ea2da8d, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x16180a85ae298084), "src", 24 };
+VarInfo __struct_info__505118442f85739a_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa15c8318d58250de), "start", 32 };
+VarInfo __struct_info__505118442f85739a_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa22d7f26e5fbda66), "stop", 36 };
+VarInfo __struct_info__505118442f85739a_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x42ddb9b88c571654), "_loop_at_163", 40 };
+VarInfo __struct_info__505118442f85739a_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__ecf20d246ea2da8d, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x161d4ca044c366a4), "_source_0_at_163", 48 };
+VarInfo __struct_info__505118442f85739a_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b69bd28e2d842dd9, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x5f4899d817df5762), "x", 56 };
+VarInfo __struct_info__505118442f85739a_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x15ce4ee826625810), "_pvar_0_at_163", 64 };
+VarInfo __struct_info__505118442f85739a_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x5f488ad817df3de5), "i", 72 };
+VarInfo __struct_info__505118442f85739a_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xc38ac19d3e7d134d), "_pvar_1_at_163", 80 };
+VarInfo __struct_info__505118442f85739a_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xc6b59b7e75f59881), "_source_1_at_163", 88 };
+VarInfo * __struct_info__505118442f85739a_fields[13] =  { &__struct_info__505118442f85739a_field_0, &__struct_info__505118442f85739a_field_1, &__struct_info__505118442f85739a_field_2, &__struct_info__505118442f85739a_field_3, &__struct_info__505118442f85739a_field_4, &__struct_info__505118442f85739a_field_5, &__struct_info__505118442f85739a_field_6, &__struct_info__505118442f85739a_field_7, &__struct_info__505118442f85739a_field_8, &__struct_info__505118442f85739a_field_9, &__struct_info__505118442f85739a_field_10, &__struct_info__505118442f85739a_field_11, &__struct_info__505118442f85739a_field_12 };
+StructInfo __struct_info__505118442f85739a = {"_lambda_thismodule_163_12_31", "", 14, __struct_info__505118442f85739a_fields, 13, 96, UINT64_C(0x0), nullptr, UINT64_C(0x505118442f85739a) };
+TypeInfo * __type_info__2fbc78f773d7401d_arg_types_var_13982514218938191372[2] = { &__type_info__8875b5a4bb8f230d, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__c20bde997ea8ce0c_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__230ec6e68c66775c, nullptr, (TypeInfo **)__type_info__2fbc78f773d7401d_arg_types_var_13982514218938191372, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x2fbc78f773d7401d), "__lambda", 0 };
+TypeInfo * __type_info__e27dc4c062dc47a4_arg_types_var_13982514218938191372[1] = { &__type_info__a8f3a4fc49b1f977 };
+VarInfo __struct_info__c20bde997ea8ce0c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__e27dc4c062dc47a4_arg_types_var_13982514218938191372, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xe27dc4c062dc47a4), "__finalize", 8 };
+VarInfo * __struct_info__c20bde997ea8ce0c_fields[2] =  { &__struct_info__c20bde997ea8ce0c_field_0, &__struct_info__c20bde997ea8ce0c_field_1 };
+StructInfo __struct_info__c20bde997ea8ce0c = {"_lambda_thismodule_139_28_6", "", 6, __struct_info__c20bde997ea8ce0c_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xc20bde997ea8ce0c) };
+TypeInfo * __type_info__6deeb8339a632378_arg_types_var_11854890129033376907[2] = { &__type_info__a177731b62cb70ec, &__type_info__40f0563f55af18bb };
+VarInfo __struct_info__a48507c33051b48b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__6deeb8339a632378_arg_types_var_11854890129033376907, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x6deeb8339a632378), "__lambda", 0 };
+TypeInfo * __type_info__f17fbc91307fb4ad_arg_types_var_11854890129033376907[1] = { &__type_info__cb7308b44d3f8ad6 };
+VarInfo __struct_info__a48507c33051b48b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f17fbc91307fb4ad_arg_types_var_11854890129033376907, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xf17fbc91307fb4ad), "__finalize", 8 };
+VarInfo __struct_info__a48507c33051b48b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x4fa697303724052c), "__yield", 16 };
+VarInfo __struct_info__a48507c33051b48b_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x44f9d2d40a46ea36), "_loop_at_106", 20 };
+VarInfo __struct_info__a48507c33051b48b_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xfeafe9e27e51081b), "x", 24 };
+VarInfo __struct_info__a48507c33051b48b_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x537c6d5ffaf9692a), "_pvar_0_at_106", 32 };
+VarInfo __struct_info__a48507c33051b48b_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x589ef7d16f645296), "_source_0_at_106", 40 };
+VarInfo * __struct_info__a48507c33051b48b_fields[7] =  { &__struct_info__a48507c33051b48b_field_0, &__struct_info__a48507c33051b48b_field_1, &__struct_info__a48507c33051b48b_field_2, &__struct_info__a48507c33051b48b_field_3, &__struct_info__a48507c33051b48b_field_4, &__struct_info__a48507c33051b48b_field_5, &__struct_info__a48507c33051b48b_field_6 };
+StructInfo __struct_info__a48507c33051b48b = {"_lambda_thismodule_106_15_5", "", 14, __struct_info__a48507c33051b48b_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0xa48507c33051b48b) };
+TypeInfo * __type_info__e211f34da3d67f70_arg_types_var_14769779290258253043[2] = { &__type_info__a3dfaa63decefde, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__ccf8cc02c6c3a4f3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__e211f34da3d67f70_arg_types_var_14769779290258253043, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xe211f34da3d67f70), "__lambda", 0 };
+TypeInfo * __type_info__19534cf9d1b07815_arg_types_var_14769779290258253043[1] = { &__type_info__40ad0c15d6e5502e };
+VarInfo __struct_info__ccf8cc02c6c3a4f3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__19534cf9d1b07815_arg_types_var_14769779290258253043, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x19534cf9d1b07815), "__finalize", 8 };
+VarInfo __struct_info__ccf8cc02c6c3a4f3_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x374bc5ace2baf464), "__yield", 16 };
+VarInfo __struct_info__ccf8cc02c6c3a4f3_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x96372baacac69c85), "src", 24 };
+VarInfo __struct_info__ccf8cc02c6c3a4f3_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf8588da5193fd51b), "start", 32 };
+VarInfo __struct_info__ccf8cc02c6c3a4f3_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf4d2d236857e8469), "stop", 36 };
+VarInfo __struct_info__ccf8cc02c6c3a4f3_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xe5e769a71281be8c), "_loop_at_157", 40 };
+VarInfo __struct_info__ccf8cc02c6c3a4f3_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x133e50273ceb57dc), "_source_0_at_157", 48 };
+VarInfo __struct_info__ccf8cc02c6c3a4f3_field_8 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x4d29bb2ccd97f7d3), "x", 56 };
+VarInfo __struct_info__ccf8cc02c6c3a4f3_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xb8f6822dc1884b78), "_pvar_0_at_157", 64 };
+VarInfo __struct_info__ccf8cc02c6c3a4f3_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x4d29ca2ccd981150), "i", 72 };
+VarInfo __struct_info__ccf8cc02c6c3a4f3_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x47b697b226afac6d), "_pvar_1_at_157", 80 };
+VarInfo __struct_info__ccf8cc02c6c3a4f3_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xe88be593a4db34d1), "_source_1_at_157", 88 };
+VarInfo * __struct_info__ccf8cc02c6c3a4f3_fields[13] =  { &__struct_info__ccf8cc02c6c3a4f3_field_0, &__struct_info__ccf8cc02c6c3a4f3_field_1, &__struct_info__ccf8cc02c6c3a4f3_field_2, &__struct_info__ccf8cc02c6c3a4f3_field_3, &__struct_info__ccf8cc02c6c3a4f3_field_4, &__struct_info__ccf8cc02c6c3a4f3_field_5, &__struct_info__ccf8cc02c6c3a4f3_field_6, &__struct_info__ccf8cc02c6c3a4f3_field_7, &__struct_info__ccf8cc02c6c3a4f3_field_8, &__struct_info__ccf8cc02c6c3a4f3_field_9, &__struct_info__ccf8cc02c6c3a4f3_field_10, &__struct_info__ccf8cc02c6c3a4f3_field_11, &__struct_info__ccf8cc02c6c3a4f3_field_12 };
+StructInfo __struct_info__ccf8cc02c6c3a4f3 = {"_lambda_thismodule_157_12_19", "", 14, __struct_info__ccf8cc02c6c3a4f3_fields, 13, 96, UINT64_C(0x0), nullptr, UINT64_C(0xccf8cc02c6c3a4f3) };
+TypeInfo * __type_info__fdd2746267d2c809_arg_types_var_7723399188418105176[2] = { &__type_info__bbbb40b84cc1be8d, &__type_info__c6da56122d36aaea };
+VarInfo __struct_info__6b2f06a43c338f58_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__fdd2746267d2c809_arg_types_var_7723399188418105176, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xfdd2746267d2c809), "__lambda", 0 };
+TypeInfo * __type_info__1f2814e9177d3688_arg_types_var_7723399188418105176[1] = { &__type_info__ade9b1523a00b747 };
+VarInfo __struct_info__6b2f06a43c338f58_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__1f2814e9177d3688_arg_types_var_7723399188418105176, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x1f2814e9177d3688), "__finalize", 8 };
+VarInfo __struct_info__6b2f06a43c338f58_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x5ba65153a93c6a2f), "__yield", 16 };
+VarInfo __struct_info__6b2f06a43c338f58_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x8e22436da23cb23d), "_loop_at_56", 20 };
+VarInfo __struct_info__6b2f06a43c338f58_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x2f554df5aa41a39c), "x", 24 };
+VarInfo __struct_info__6b2f06a43c338f58_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x818b334628890f2d), "_pvar_0_at_56", 32 };
+VarInfo __struct_info__6b2f06a43c338f58_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x122c87a5ad47aba1), "_source_0_at_56", 40 };
+VarInfo * __struct_info__6b2f06a43c338f58_fields[7] =  { &__struct_info__6b2f06a43c338f58_field_0, &__struct_info__6b2f06a43c338f58_field_1, &__struct_info__6b2f06a43c338f58_field_2, &__struct_info__6b2f06a43c338f58_field_3, &__struct_info__6b2f06a43c338f58_field_4, &__struct_info__6b2f06a43c338f58_field_5, &__struct_info__6b2f06a43c338f58_field_6 };
+StructInfo __struct_info__6b2f06a43c338f58 = {"_lambda_thismodule_56_21_10", "", 14, __struct_info__6b2f06a43c338f58_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x6b2f06a43c338f58) };
+TypeInfo * __type_info__525157ac5b2e5776_arg_types_var_15544635610393310541[2] = { &__type_info__1c031d28e891379a, &__type_info__230ec6e68c66775c };
+VarInfo __struct_info__d7b9a3ba8861754d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__525157ac5b2e5776_arg_types_var_15544635610393310541, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x525157ac5b2e5776), "__lambda", 0 };
+TypeInfo * __type_info__1f48c8b904d5503_arg_types_var_15544635610393310541[1] = { &__type_info__48dc519e0431cc1c };
+VarInfo __struct_info__d7b9a3ba8861754d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__1f48c8b904d5503_arg_types_var_15544635610393310541, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x1f48c8b904d5503), "__finalize", 8 };
+VarInfo __struct_info__d7b9a3ba8861754d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x897bb4368f829982), "__yield", 16 };
+VarInfo __struct_info__d7b9a3ba8861754d_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x12e982af3775fae3), "_loop_at_235", 20 };
+VarInfo __struct_info__d7b9a3ba8861754d_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf8cefcec84dc5a29), "x", 24 };
+VarInfo __struct_info__d7b9a3ba8861754d_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x4b683374b4b91f6b), "_pvar_0_at_235", 32 };
+VarInfo __struct_info__d7b9a3ba8861754d_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xa4bc273a4f6f9e6f), "_source_0_at_235", 40 };
+VarInfo * __struct_info__d7b9a3ba8861754d_fields[7] =  { &__struct_info__d7b9a3ba8861754d_field_0, &__struct_info__d7b9a3ba8861754d_field_1, &__struct_info__d7b9a3ba8861754d_field_2, &__struct_info__d7b9a3ba8861754d_field_3, &__struct_info__d7b9a3ba8861754d_field_4, &__struct_info__d7b9a3ba8861754d_field_5, &__struct_info__d7b9a3ba8861754d_field_6 };
+StructInfo __struct_info__d7b9a3ba8861754d = {"_lambda_thismodule_235_18_9", "", 14, __struct_info__d7b9a3ba8861754d_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0xd7b9a3ba8861754d) };
+TypeInfo * __type_info__f239e2fdda1e11d1_arg_types_var_6015023002687775440[2] = { &__type_info__1bdc8d89ade286f, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__5379a78d4f0222d0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__f239e2fdda1e11d1_arg_types_var_6015023002687775440, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xf239e2fdda1e11d1), "__lambda", 0 };
+TypeInfo * __type_info__2306e66be2653640_arg_types_var_6015023002687775440[1] = { &__type_info__3ded19b5586b95b7 };
+VarInfo __struct_info__5379a78d4f0222d0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__2306e66be2653640_arg_types_var_6015023002687775440, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x2306e66be2653640), "__finalize", 8 };
+VarInfo __struct_info__5379a78d4f0222d0_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xc6711dc6270e4a57), "__yield", 16 };
+VarInfo __struct_info__5379a78d4f0222d0_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xa1c5d6da012c442), "src", 24 };
+VarInfo __struct_info__5379a78d4f0222d0_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x81a08c6de345a68f), "arr", 32 };
+VarInfo __struct_info__5379a78d4f0222d0_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x669132c7c044ead6), "___loop_at_135_rename_at_135", 56 };
+VarInfo __struct_info__5379a78d4f0222d0_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x283ff0d6ce83b96f), "__x_rename_at_135", 64 };
+VarInfo __struct_info__5379a78d4f0222d0_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x2d48786570422ae2), "___pvar_0_at_135_rename_at_135", 72 };
+VarInfo __struct_info__5379a78d4f0222d0_field_8 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x96e97f1b692dc611), "_loop_at_131", 80 };
+VarInfo __struct_info__5379a78d4f0222d0_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xf3e8e880d0eb9dbd), "_source_0_at_131", 88 };
+VarInfo __struct_info__5379a78d4f0222d0_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x259e386451885ea4), "x", 96 };
+VarInfo __struct_info__5379a78d4f0222d0_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x6b8e51d797ee6341), "_pvar_0_at_131", 104 };
+VarInfo __struct_info__5379a78d4f0222d0_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__7bf5307b489d850, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xab9451ebc7b57d1e), "___source_0_at_135_rename_at_135", 112 };
+VarInfo * __struct_info__5379a78d4f0222d0_fields[13] =  { &__struct_info__5379a78d4f0222d0_field_0, &__struct_info__5379a78d4f0222d0_field_1, &__struct_info__5379a78d4f0222d0_field_2, &__struct_info__5379a78d4f0222d0_field_3, &__struct_info__5379a78d4f0222d0_field_4, &__struct_info__5379a78d4f0222d0_field_5, &__struct_info__5379a78d4f0222d0_field_6, &__struct_info__5379a78d4f0222d0_field_7, &__struct_info__5379a78d4f0222d0_field_8, &__struct_info__5379a78d4f0222d0_field_9, &__struct_info__5379a78d4f0222d0_field_10, &__struct_info__5379a78d4f0222d0_field_11, &__struct_info__5379a78d4f0222d0_field_12 };
+StructInfo __struct_info__5379a78d4f0222d0 = {"_lambda_thismodule_130_12_20", "", 30, __struct_info__5379a78d4f0222d0_fields, 13, 120, UINT64_C(0x0), nullptr, UINT64_C(0x5379a78d4f0222d0) };
+TypeInfo * __type_info__c97f3457eb618c7d_arg_types_var_2269011203798272492[2] = { &__type_info__6d5eace1673c3cd9, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__1f7d25ab09c709ec_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__c97f3457eb618c7d_arg_types_var_2269011203798272492, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xc97f3457eb618c7d), "__lambda", 0 };
+TypeInfo * __type_info__fcfcb5fad760aa04_arg_types_var_2269011203798272492[1] = { &__type_info__f4047c7272c4eb5b };
+VarInfo __struct_info__1f7d25ab09c709ec_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fcfcb5fad760aa04_arg_types_var_2269011203798272492, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xfcfcb5fad760aa04), "__finalize", 8 };
+VarInfo __struct_info__1f7d25ab09c709ec_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf459a0f5d7fd1e6b), "__yield", 16 };
+TypeInfo * __type_info__9f62ab6d76407d27_arg_types_var_2269011203798272492[1] = { &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__1f7d25ab09c709ec_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__9f62ab6d76407d27_arg_types_var_2269011203798272492, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x9f62ab6d76407d27), "blk", 24 };
+VarInfo __struct_info__1f7d25ab09c709ec_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x330a446dc9ffd49e), "src", 32 };
+VarInfo __struct_info__1f7d25ab09c709ec_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x4b8bebd7215be277), "_loop_at_14", 40 };
+VarInfo __struct_info__1f7d25ab09c709ec_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xdce23bef3ff8cd1b), "_source_0_at_14", 48 };
+VarInfo __struct_info__1f7d25ab09c709ec_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x856b5915e3e9f46d), "w", 56 };
+VarInfo __struct_info__1f7d25ab09c709ec_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xe12dd4a55be216df), "_pvar_0_at_14", 64 };
+VarInfo * __struct_info__1f7d25ab09c709ec_fields[9] =  { &__struct_info__1f7d25ab09c709ec_field_0, &__struct_info__1f7d25ab09c709ec_field_1, &__struct_info__1f7d25ab09c709ec_field_2, &__struct_info__1f7d25ab09c709ec_field_3, &__struct_info__1f7d25ab09c709ec_field_4, &__struct_info__1f7d25ab09c709ec_field_5, &__struct_info__1f7d25ab09c709ec_field_6, &__struct_info__1f7d25ab09c709ec_field_7, &__struct_info__1f7d25ab09c709ec_field_8 };
+StructInfo __struct_info__1f7d25ab09c709ec = {"_lambda_thismodule_14_12_21", "", 14, __struct_info__1f7d25ab09c709ec_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0x1f7d25ab09c709ec) };
+TypeInfo * __type_info__b49a4f344acb0e84_arg_types_var_16164131208834447815[2] = { &__type_info__156ad800a98c62a8, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__e05287b17561f9c7_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__b49a4f344acb0e84_arg_types_var_16164131208834447815, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xb49a4f344acb0e84), "__lambda", 0 };
+TypeInfo * __type_info__931731041ae25d31_arg_types_var_16164131208834447815[1] = { &__type_info__6d36f884b58c289e };
+VarInfo __struct_info__e05287b17561f9c7_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__931731041ae25d31_arg_types_var_16164131208834447815, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x931731041ae25d31), "__finalize", 8 };
+VarInfo __struct_info__e05287b17561f9c7_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x59b48f0526aedaa0), "__yield", 16 };
+TypeInfo * __type_info__4e6a96af8cadd9e0_arg_types_var_16164131208834447815[1] = { &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__e05287b17561f9c7_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__ebd3969580ab017b, nullptr, (TypeInfo **)__type_info__4e6a96af8cadd9e0_arg_types_var_16164131208834447815, nullptr, 1, 0, nullptr, 24576, 8, UINT64_C(0x4e6a96af8cadd9e0), "blk", 24 };
+VarInfo __struct_info__e05287b17561f9c7_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xd07b15afd6632a09), "src", 32 };
+VarInfo __struct_info__e05287b17561f9c7_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xe5080e4689edc608), "_loop_at_36", 40 };
+VarInfo __struct_info__e05287b17561f9c7_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x9b909e119b9866e0), "_source_0_at_36", 48 };
+VarInfo __struct_info__e05287b17561f9c7_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x1aaa1511dc425596), "w", 56 };
+VarInfo __struct_info__e05287b17561f9c7_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xe321df23c40fe10c), "_pvar_0_at_36", 64 };
+VarInfo * __struct_info__e05287b17561f9c7_fields[9] =  { &__struct_info__e05287b17561f9c7_field_0, &__struct_info__e05287b17561f9c7_field_1, &__struct_info__e05287b17561f9c7_field_2, &__struct_info__e05287b17561f9c7_field_3, &__struct_info__e05287b17561f9c7_field_4, &__struct_info__e05287b17561f9c7_field_5, &__struct_info__e05287b17561f9c7_field_6, &__struct_info__e05287b17561f9c7_field_7, &__struct_info__e05287b17561f9c7_field_8 };
+StructInfo __struct_info__e05287b17561f9c7 = {"_lambda_thismodule_36_12_24", "", 14, __struct_info__e05287b17561f9c7_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0xe05287b17561f9c7) };
+TypeInfo * __type_info__6e8dc1e75265ad96_arg_types_var_14727024572426216557[2] = { &__type_info__4da5125fcede02e2, &__type_info__7478fdc114c254be };
+VarInfo __struct_info__cc60e6d24de9e46d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__6e8dc1e75265ad96_arg_types_var_14727024572426216557, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x6e8dc1e75265ad96), "__lambda", 0 };
+TypeInfo * __type_info__a901c7a6cff11d23_arg_types_var_14727024572426216557[1] = { &__type_info__16a32539a1950c90 };
+VarInfo __struct_info__cc60e6d24de9e46d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__a901c7a6cff11d23_arg_types_var_14727024572426216557, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xa901c7a6cff11d23), "__finalize", 8 };
+VarInfo __struct_info__cc60e6d24de9e46d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xd6f2b86016f84622), "__yield", 16 };
+TypeInfo * __type_info__ef09cee91256acaa_arg_types_var_14727024572426216557[1] = { &__type_info__a52e7c07602356af };
+VarInfo __struct_info__cc60e6d24de9e46d_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__ef09cee91256acaa_arg_types_var_14727024572426216557, nullptr, 1, 0, nullptr, 24576, 8, UINT64_C(0xef09cee91256acaa), "blk", 24 };
+VarInfo __struct_info__cc60e6d24de9e46d_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x71433de95c2ee6b7), "src", 32 };
+VarInfo __struct_info__cc60e6d24de9e46d_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x2a80e543fb25fe1d), "_loop_at_20", 40 };
+VarInfo __struct_info__cc60e6d24de9e46d_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x419b1078ec5c2499), "_source_0_at_20", 48 };
+VarInfo __struct_info__cc60e6d24de9e46d_field_7 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x254713a4a2a82514), "w", 56 };
+VarInfo __struct_info__cc60e6d24de9e46d_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x2029c1490c1ada15), "_pvar_0_at_20", 80 };
+VarInfo * __struct_info__cc60e6d24de9e46d_fields[9] =  { &__struct_info__cc60e6d24de9e46d_field_0, &__struct_info__cc60e6d24de9e46d_field_1, &__struct_info__cc60e6d24de9e46d_field_2, &__struct_info__cc60e6d24de9e46d_field_3, &__struct_info__cc60e6d24de9e46d_field_4, &__struct_info__cc60e6d24de9e46d_field_5, &__struct_info__cc60e6d24de9e46d_field_6, &__struct_info__cc60e6d24de9e46d_field_7, &__struct_info__cc60e6d24de9e46d_field_8 };
+StructInfo __struct_info__cc60e6d24de9e46d = {"_lambda_thismodule_20_12_30", "", 30, __struct_info__cc60e6d24de9e46d_fields, 9, 88, UINT64_C(0x0), nullptr, UINT64_C(0xcc60e6d24de9e46d) };
+TypeInfo * __type_info__84485af89858e60b_arg_types_var_16164127910299563182[2] = { &__type_info__1574da00a994ba93, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__e05284b17561f4ae_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__84485af89858e60b_arg_types_var_16164127910299563182, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x84485af89858e60b), "__lambda", 0 };
+TypeInfo * __type_info__307ec46ae406b26a_arg_types_var_16164127910299563182[1] = { &__type_info__287226494776f491 };
+VarInfo __struct_info__e05284b17561f4ae_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__307ec46ae406b26a_arg_types_var_16164127910299563182, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x307ec46ae406b26a), "__finalize", 8 };
+VarInfo __struct_info__e05284b17561f4ae_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xcb73015c7adfb021), "__yield", 16 };
+TypeInfo * __type_info__c9baa23ac99b7b45_arg_types_var_16164127910299563182[1] = { &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__e05284b17561f4ae_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ebd3969580ab017b, nullptr, (TypeInfo **)__type_info__c9baa23ac99b7b45_arg_types_var_16164127910299563182, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xc9baa23ac99b7b45), "blk", 24 };
+VarInfo __struct_info__e05284b17561f4ae_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x48095b3a80371ec8), "src", 32 };
+VarInfo __struct_info__e05284b17561f4ae_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xd5d7acedf4f52721), "_loop_at_36", 40 };
+VarInfo __struct_info__e05284b17561f4ae_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xef1777856a6d0029), "_source_0_at_36", 48 };
+VarInfo __struct_info__e05284b17561f4ae_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa5ceab81e3bddf37), "w", 56 };
+VarInfo __struct_info__e05284b17561f4ae_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xa519df5d65409d2d), "_pvar_0_at_36", 64 };
+VarInfo * __struct_info__e05284b17561f4ae_fields[9] =  { &__struct_info__e05284b17561f4ae_field_0, &__struct_info__e05284b17561f4ae_field_1, &__struct_info__e05284b17561f4ae_field_2, &__struct_info__e05284b17561f4ae_field_3, &__struct_info__e05284b17561f4ae_field_4, &__struct_info__e05284b17561f4ae_field_5, &__struct_info__e05284b17561f4ae_field_6, &__struct_info__e05284b17561f4ae_field_7, &__struct_info__e05284b17561f4ae_field_8 };
+StructInfo __struct_info__e05284b17561f4ae = {"_lambda_thismodule_36_12_23", "", 14, __struct_info__e05284b17561f4ae_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0xe05284b17561f4ae) };
+TypeInfo * __type_info__2b28cef087294366_arg_types_var_9719100249194324509[2] = { &__type_info__4df3d25c01614824, &__type_info__d727cf470ebcdf10 };
+VarInfo __struct_info__86e12e2ec1a3621d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__2b28cef087294366_arg_types_var_9719100249194324509, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x2b28cef087294366), "__lambda", 0 };
+TypeInfo * __type_info__a410916d2e6092d3_arg_types_var_9719100249194324509[1] = { &__type_info__388a580cd154083c };
+VarInfo __struct_info__86e12e2ec1a3621d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__a410916d2e6092d3_arg_types_var_9719100249194324509, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xa410916d2e6092d3), "__finalize", 8 };
+VarInfo __struct_info__86e12e2ec1a3621d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xd6b44798c15cfab2), "__yield", 16 };
+VarInfo __struct_info__86e12e2ec1a3621d_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b69bd28e2d842dd9, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xec9e71652a498b27), "src", 24 };
+VarInfo __struct_info__86e12e2ec1a3621d_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__230ec6e68c66775c, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x880f3265823244d2), "arr", 32 };
+VarInfo __struct_info__86e12e2ec1a3621d_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xab085c80b1ef097d), "___loop_at_147_rename_at_147", 56 };
+VarInfo __struct_info__86e12e2ec1a3621d_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__230ec6e68c66775c, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x3b47a494f348af73), "__x_rename_at_147", 64 };
+VarInfo __struct_info__86e12e2ec1a3621d_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xeff413641e894799), "___pvar_0_at_147_rename_at_147", 72 };
+VarInfo __struct_info__86e12e2ec1a3621d_field_8 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xd9ab86a8a6da2ee3), "_loop_at_143", 80 };
+VarInfo __struct_info__86e12e2ec1a3621d_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b69bd28e2d842dd9, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x9caeff022f8dc62f), "_source_0_at_143", 88 };
+TypeInfo * __type_info__64aa7bef173ed259_arg_types_var_9719100249194324509[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+VarInfo __struct_info__86e12e2ec1a3621d_field_10 =  { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__64aa7bef173ed259_arg_types_var_9719100249194324509, nullptr, 2, 0, nullptr, 30, 8, UINT64_C(0x64aa7bef173ed259), "x", 96 };
+VarInfo __struct_info__86e12e2ec1a3621d_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xf885959092007c0b), "_pvar_0_at_143", 104 };
+VarInfo __struct_info__86e12e2ec1a3621d_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__4f1bdf8b4f0601a8, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x7419090aca2d044d), "___source_0_at_147_rename_at_147", 112 };
+VarInfo * __struct_info__86e12e2ec1a3621d_fields[13] =  { &__struct_info__86e12e2ec1a3621d_field_0, &__struct_info__86e12e2ec1a3621d_field_1, &__struct_info__86e12e2ec1a3621d_field_2, &__struct_info__86e12e2ec1a3621d_field_3, &__struct_info__86e12e2ec1a3621d_field_4, &__struct_info__86e12e2ec1a3621d_field_5, &__struct_info__86e12e2ec1a3621d_field_6, &__struct_info__86e12e2ec1a3621d_field_7, &__struct_info__86e12e2ec1a3621d_field_8, &__struct_info__86e12e2ec1a3621d_field_9, &__struct_info__86e12e2ec1a3621d_field_10, &__struct_info__86e12e2ec1a3621d_field_11, &__struct_info__86e12e2ec1a3621d_field_12 };
+StructInfo __struct_info__86e12e2ec1a3621d = {"_lambda_thismodule_142_12_28", "", 30, __struct_info__86e12e2ec1a3621d_fields, 13, 120, UINT64_C(0x0), nullptr, UINT64_C(0x86e12e2ec1a3621d) };
+TypeInfo * __type_info__f64e025a6d26c4af_arg_types_var_11403575767593589170[2] = { &__type_info__f4903c6752ec6541, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__9e41a3bdecab19b2_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__f64e025a6d26c4af_arg_types_var_11403575767593589170, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xf64e025a6d26c4af), "__lambda", 0 };
+TypeInfo * __type_info__9d631da847f747a6_arg_types_var_11403575767593589170[1] = { &__type_info__6f3948a703b89a51 };
+VarInfo __struct_info__9e41a3bdecab19b2_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__9d631da847f747a6_arg_types_var_11403575767593589170, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x9d631da847f747a6), "__finalize", 8 };
+VarInfo __struct_info__9e41a3bdecab19b2_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x18d63c276547096), "start", 16 };
+VarInfo __struct_info__9e41a3bdecab19b2_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x1b93c462ba49c924), "step", 20 };
+VarInfo * __struct_info__9e41a3bdecab19b2_fields[4] =  { &__struct_info__9e41a3bdecab19b2_field_0, &__struct_info__9e41a3bdecab19b2_field_1, &__struct_info__9e41a3bdecab19b2_field_2, &__struct_info__9e41a3bdecab19b2_field_3 };
+StructInfo __struct_info__9e41a3bdecab19b2 = {"_lambda_thismodule_173_8_2", "", 6, __struct_info__9e41a3bdecab19b2_fields, 4, 24, UINT64_C(0x0), nullptr, UINT64_C(0x9e41a3bdecab19b2) };
+TypeInfo * __type_info__51b92c8819c648a1_arg_types_var_16163128454229708608[2] = { &__type_info__1ea30300aeed91a9, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__e04ef7b1755ecf40_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__51b92c8819c648a1_arg_types_var_16163128454229708608, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x51b92c8819c648a1), "__lambda", 0 };
+TypeInfo * __type_info__2f7403daa0dfe830_arg_types_var_16163128454229708608[1] = { &__type_info__98e7065ef71d3cfb };
+VarInfo __struct_info__e04ef7b1755ecf40_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__2f7403daa0dfe830_arg_types_var_16163128454229708608, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x2f7403daa0dfe830), "__finalize", 8 };
+VarInfo __struct_info__e04ef7b1755ecf40_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x86f6ceb928baf727), "__yield", 16 };
+TypeInfo * __type_info__6e7df3a854835bc3_arg_types_var_16163128454229708608[1] = { &__type_info__a52e7c07602356af };
+VarInfo __struct_info__e04ef7b1755ecf40_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__ebd3969580ab017b, nullptr, (TypeInfo **)__type_info__6e7df3a854835bc3_arg_types_var_16163128454229708608, nullptr, 1, 0, nullptr, 24576, 8, UINT64_C(0x6e7df3a854835bc3), "blk", 24 };
+VarInfo __struct_info__e04ef7b1755ecf40_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x2408ca8a8597af2), "src", 32 };
+VarInfo __struct_info__e04ef7b1755ecf40_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xa0ee2674079cb3f3), "_loop_at_36", 40 };
+VarInfo __struct_info__e04ef7b1755ecf40_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x12d5070fd1ad752f), "_source_0_at_36", 48 };
+VarInfo __struct_info__e04ef7b1755ecf40_field_7 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x9e5b982411f8f7e9), "w", 56 };
+VarInfo __struct_info__e04ef7b1755ecf40_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xd149c2fe063ed0a3), "_pvar_0_at_36", 80 };
+VarInfo * __struct_info__e04ef7b1755ecf40_fields[9] =  { &__struct_info__e04ef7b1755ecf40_field_0, &__struct_info__e04ef7b1755ecf40_field_1, &__struct_info__e04ef7b1755ecf40_field_2, &__struct_info__e04ef7b1755ecf40_field_3, &__struct_info__e04ef7b1755ecf40_field_4, &__struct_info__e04ef7b1755ecf40_field_5, &__struct_info__e04ef7b1755ecf40_field_6, &__struct_info__e04ef7b1755ecf40_field_7, &__struct_info__e04ef7b1755ecf40_field_8 };
+StructInfo __struct_info__e04ef7b1755ecf40 = {"_lambda_thismodule_36_12_36", "", 30, __struct_info__e04ef7b1755ecf40_fields, 9, 88, UINT64_C(0x0), nullptr, UINT64_C(0xe04ef7b1755ecf40) };
+TypeInfo * __type_info__c136ef23591a4ad1_arg_types_var_13791539554345827792[2] = { &__type_info__cd1cc76c0b5b3a3b, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__bf6564276a883dd0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__c136ef23591a4ad1_arg_types_var_13791539554345827792, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xc136ef23591a4ad1), "__lambda", 0 };
+TypeInfo * __type_info__ed5415ff51555740_arg_types_var_13791539554345827792[1] = { &__type_info__4db90dc5fb10ec13 };
+VarInfo __struct_info__bf6564276a883dd0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__ed5415ff51555740_arg_types_var_13791539554345827792, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xed5415ff51555740), "__finalize", 8 };
+VarInfo * __struct_info__bf6564276a883dd0_fields[2] =  { &__struct_info__bf6564276a883dd0_field_0, &__struct_info__bf6564276a883dd0_field_1 };
+StructInfo __struct_info__bf6564276a883dd0 = {"_lambda_thismodule_172_30_17", "", 6, __struct_info__bf6564276a883dd0_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xbf6564276a883dd0) };
+TypeInfo * __type_info__ab6d31d2f97e4af7_arg_types_var_17348820476231923722[2] = { &__type_info__6a3930e350d8b9e7, &__type_info__a52e7c07602356af };
+VarInfo __struct_info__f0c3644e1dd3b80a_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, (TypeInfo **)__type_info__ab6d31d2f97e4af7_arg_types_var_17348820476231923722, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xab6d31d2f97e4af7), "__lambda", 0 };
+TypeInfo * __type_info__bf91dac1c0424d3e_arg_types_var_17348820476231923722[1] = { &__type_info__3c6cf2e5c7dde6ad };
+VarInfo __struct_info__f0c3644e1dd3b80a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__bf91dac1c0424d3e_arg_types_var_17348820476231923722, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xbf91dac1c0424d3e), "__finalize", 8 };
+VarInfo * __struct_info__f0c3644e1dd3b80a_fields[2] =  { &__struct_info__f0c3644e1dd3b80a_field_0, &__struct_info__f0c3644e1dd3b80a_field_1 };
+StructInfo __struct_info__f0c3644e1dd3b80a = {"_lambda_thismodule_93_29_35", "", 6, __struct_info__f0c3644e1dd3b80a_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xf0c3644e1dd3b80a) };
+TypeInfo * __type_info__800fccae2dafff6d_arg_types_var_17167807911655138556[2] = { &__type_info__d85a88cb0811b649, &__type_info__a52e7c07602356af };
+VarInfo __struct_info__ee404e56325864fc_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c6da56122d36aaea, nullptr, (TypeInfo **)__type_info__800fccae2dafff6d_arg_types_var_17167807911655138556, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x800fccae2dafff6d), "__lambda", 0 };
+TypeInfo * __type_info__1c065fb77cbdeed4_arg_types_var_17167807911655138556[1] = { &__type_info__bc40da34bfd9f5ff };
+VarInfo __struct_info__ee404e56325864fc_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__1c065fb77cbdeed4_arg_types_var_17167807911655138556, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x1c065fb77cbdeed4), "__finalize", 8 };
+VarInfo * __struct_info__ee404e56325864fc_fields[2] =  { &__struct_info__ee404e56325864fc_field_0, &__struct_info__ee404e56325864fc_field_1 };
+StructInfo __struct_info__ee404e56325864fc = {"_lambda_thismodule_92_36_32", "", 6, __struct_info__ee404e56325864fc_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xee404e56325864fc) };
+TypeInfo * __type_info__2267d7b2c69e338_arg_types_var_8573355120616541259[2] = { &__type_info__aacae256c3713dd6, &__type_info__c6da56122d36aaea };
+VarInfo __struct_info__76faad0f01a00c4b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__2267d7b2c69e338_arg_types_var_8573355120616541259, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x2267d7b2c69e338), "__lambda", 0 };
+TypeInfo * __type_info__9ce73ac1ed50da6d_arg_types_var_8573355120616541259[1] = { &__type_info__60d5936f4e638ac2 };
+VarInfo __struct_info__76faad0f01a00c4b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__9ce73ac1ed50da6d_arg_types_var_8573355120616541259, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x9ce73ac1ed50da6d), "__finalize", 8 };
+VarInfo __struct_info__76faad0f01a00c4b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xb8aa2266b59867ec), "__yield", 16 };
+VarInfo __struct_info__76faad0f01a00c4b_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x6ecb0f443ca8f3c0), "_loop_at_243", 20 };
+VarInfo __struct_info__76faad0f01a00c4b_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x9223ab46decd43db), "x", 24 };
+VarInfo __struct_info__76faad0f01a00c4b_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xc27c02167ddba684), "_pvar_0_at_243", 32 };
+VarInfo __struct_info__76faad0f01a00c4b_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x5bfe33da07321ca0), "_source_0_at_243", 40 };
+VarInfo * __struct_info__76faad0f01a00c4b_fields[7] =  { &__struct_info__76faad0f01a00c4b_field_0, &__struct_info__76faad0f01a00c4b_field_1, &__struct_info__76faad0f01a00c4b_field_2, &__struct_info__76faad0f01a00c4b_field_3, &__struct_info__76faad0f01a00c4b_field_4, &__struct_info__76faad0f01a00c4b_field_5, &__struct_info__76faad0f01a00c4b_field_6 };
+StructInfo __struct_info__76faad0f01a00c4b = {"_lambda_thismodule_243_18_13", "", 14, __struct_info__76faad0f01a00c4b_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x76faad0f01a00c4b) };
+TypeInfo * __type_info__3bf2dc2b5c1215a_arg_types_var_16584016385234968817[2] = { &__type_info__fe5a5d63abb87972, &__type_info__230ec6e68c66775c };
+VarInfo __struct_info__e6264309573020f1_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__3bf2dc2b5c1215a_arg_types_var_16584016385234968817, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x3bf2dc2b5c1215a), "__lambda", 0 };
+TypeInfo * __type_info__8cc8f0abc3db6e4f_arg_types_var_16584016385234968817[1] = { &__type_info__e732f984707a7444 };
+VarInfo __struct_info__e6264309573020f1_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__8cc8f0abc3db6e4f_arg_types_var_16584016385234968817, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x8cc8f0abc3db6e4f), "__finalize", 8 };
+VarInfo __struct_info__e6264309573020f1_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x35c2487ba7ef17fe), "__yield", 16 };
+VarInfo __struct_info__e6264309573020f1_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x231a1f3163e7dc36), "_loop_at_232", 20 };
+VarInfo __struct_info__e6264309573020f1_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x6f5cb03c59af98ed), "x", 24 };
+VarInfo __struct_info__e6264309573020f1_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xbc76fe9107390716), "_pvar_0_at_232", 32 };
+VarInfo __struct_info__e6264309573020f1_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x41231575836789c2), "_source_0_at_232", 40 };
+VarInfo * __struct_info__e6264309573020f1_fields[7] =  { &__struct_info__e6264309573020f1_field_0, &__struct_info__e6264309573020f1_field_1, &__struct_info__e6264309573020f1_field_2, &__struct_info__e6264309573020f1_field_3, &__struct_info__e6264309573020f1_field_4, &__struct_info__e6264309573020f1_field_5, &__struct_info__e6264309573020f1_field_6 };
+StructInfo __struct_info__e6264309573020f1 = {"_lambda_thismodule_232_10_8", "", 14, __struct_info__e6264309573020f1_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0xe6264309573020f1) };
+TypeInfo * __type_info__708b7b1f4637864b_arg_types_var_8887306657367794926[2] = { &__type_info__bdf7a1e0681463c1, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__7b560e51625f24ee_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__708b7b1f4637864b_arg_types_var_8887306657367794926, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x708b7b1f4637864b), "__lambda", 0 };
+TypeInfo * __type_info__f7a34774dbafdcaa_arg_types_var_8887306657367794926[1] = { &__type_info__bb9c492cc91755d5 };
+VarInfo __struct_info__7b560e51625f24ee_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f7a34774dbafdcaa_arg_types_var_8887306657367794926, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xf7a34774dbafdcaa), "__finalize", 8 };
+VarInfo __struct_info__7b560e51625f24ee_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x6bc0b0633ab5be61), "__yield", 16 };
+VarInfo __struct_info__7b560e51625f24ee_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xdbb056abc8d03a71), "count", 20 };
+VarInfo __struct_info__7b560e51625f24ee_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x739b51c640158dc3), "value", 24 };
+VarInfo __struct_info__7b560e51625f24ee_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xb472ea4559b3eeab), "_loop_at_193", 28 };
+VarInfo __struct_info__7b560e51625f24ee_field_6 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xc9cc9ed90fb573c6), "x", 32 };
+VarInfo __struct_info__7b560e51625f24ee_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x1219633e7d186a7), "_pvar_0_at_193", 40 };
+VarInfo __struct_info__7b560e51625f24ee_field_8 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x82c38a7edadf71d3), "_source_0_at_193", 48 };
+VarInfo * __struct_info__7b560e51625f24ee_fields[9] =  { &__struct_info__7b560e51625f24ee_field_0, &__struct_info__7b560e51625f24ee_field_1, &__struct_info__7b560e51625f24ee_field_2, &__struct_info__7b560e51625f24ee_field_3, &__struct_info__7b560e51625f24ee_field_4, &__struct_info__7b560e51625f24ee_field_5, &__struct_info__7b560e51625f24ee_field_6, &__struct_info__7b560e51625f24ee_field_7, &__struct_info__7b560e51625f24ee_field_8 };
+StructInfo __struct_info__7b560e51625f24ee = {"_lambda_thismodule_190_8_3", "", 14, __struct_info__7b560e51625f24ee_fields, 9, 56, UINT64_C(0x0), nullptr, UINT64_C(0x7b560e51625f24ee) };
+TypeInfo * __type_info__c41beb5df221da95_arg_types_var_5787431478258659380[2] = { &__type_info__c64ef0f336da093b, &__type_info__7478fdc114c254be };
+VarInfo __struct_info__505116442f857034_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__c41beb5df221da95_arg_types_var_5787431478258659380, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xc41beb5df221da95), "__lambda", 0 };
+TypeInfo * __type_info__5183870d2868632c_arg_types_var_5787431478258659380[1] = { &__type_info__254c2aebd5a0e423 };
+VarInfo __struct_info__505116442f857034_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__5183870d2868632c_arg_types_var_5787431478258659380, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x5183870d2868632c), "__finalize", 8 };
+VarInfo __struct_info__505116442f857034_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x92a0e0aef0040cc3), "__yield", 16 };
+VarInfo __struct_info__505116442f857034_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6794cf34222edd2b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x5878beb11b9587a6), "src", 24 };
+VarInfo __struct_info__505116442f857034_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x3d24db0fed9132fc), "start", 32 };
+VarInfo __struct_info__505116442f857034_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xfce032f1e99e61d8), "stop", 36 };
+VarInfo __struct_info__505116442f857034_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xf84bc8e430a5822), "_loop_at_163", 40 };
+VarInfo __struct_info__505116442f857034_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6794cf34222edd2b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x49329069474a6b5e), "_source_0_at_163", 48 };
+VarInfo __struct_info__505116442f857034_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xf769408d0fc18a8), "x", 56 };
+VarInfo __struct_info__505116442f857034_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x89c536b99baef1a), "_pvar_0_at_163", 64 };
+VarInfo __struct_info__505116442f857034_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf768508d0fbff2b), "i", 72 };
+VarInfo __struct_info__505116442f857034_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8994d37c268bbc7), "_pvar_1_at_163", 80 };
+VarInfo __struct_info__505116442f857034_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xeb3470eb4bf7331b), "_source_1_at_163", 88 };
+VarInfo * __struct_info__505116442f857034_fields[13] =  { &__struct_info__505116442f857034_field_0, &__struct_info__505116442f857034_field_1, &__struct_info__505116442f857034_field_2, &__struct_info__505116442f857034_field_3, &__struct_info__505116442f857034_field_4, &__struct_info__505116442f857034_field_5, &__struct_info__505116442f857034_field_6, &__struct_info__505116442f857034_field_7, &__struct_info__505116442f857034_field_8, &__struct_info__505116442f857034_field_9, &__struct_info__505116442f857034_field_10, &__struct_info__505116442f857034_field_11, &__struct_info__505116442f857034_field_12 };
+StructInfo __struct_info__505116442f857034 = {"_lambda_thismodule_163_12_33", "", 14, __struct_info__505116442f857034_fields, 13, 96, UINT64_C(0x0), nullptr, UINT64_C(0x505116442f857034) };
+TypeInfo * __type_info__bf06151889a0f864_arg_types_var_8760237366367195047[2] = { &__type_info__6cde42349a0dc4e2, &__type_info__40f0563f55af18bb };
+VarInfo __struct_info__79929d78926b8fa7_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__bf06151889a0f864_arg_types_var_8760237366367195047, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xbf06151889a0f864), "__lambda", 0 };
+TypeInfo * __type_info__5444c3f5adffa911_arg_types_var_8760237366367195047[1] = { &__type_info__53c59994f551fa0a };
+VarInfo __struct_info__79929d78926b8fa7_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__5444c3f5adffa911_arg_types_var_8760237366367195047, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x5444c3f5adffa911), "__finalize", 8 };
+VarInfo __struct_info__79929d78926b8fa7_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbf9493d0b2f0be00), "__yield", 16 };
+VarInfo __struct_info__79929d78926b8fa7_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x7f814b0819b7668c), "_loop_at_50", 20 };
+VarInfo __struct_info__79929d78926b8fa7_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x527d4d4089b4faa7), "x", 24 };
+VarInfo __struct_info__79929d78926b8fa7_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xe1ed5cefcddbeb30), "_pvar_0_at_50", 32 };
+VarInfo __struct_info__79929d78926b8fa7_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x347d7050bf525b84), "_source_0_at_50", 40 };
+VarInfo * __struct_info__79929d78926b8fa7_fields[7] =  { &__struct_info__79929d78926b8fa7_field_0, &__struct_info__79929d78926b8fa7_field_1, &__struct_info__79929d78926b8fa7_field_2, &__struct_info__79929d78926b8fa7_field_3, &__struct_info__79929d78926b8fa7_field_4, &__struct_info__79929d78926b8fa7_field_5, &__struct_info__79929d78926b8fa7_field_6 };
+StructInfo __struct_info__79929d78926b8fa7 = {"_lambda_thismodule_50_23_4", "", 14, __struct_info__79929d78926b8fa7_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x79929d78926b8fa7) };
+TypeInfo * __type_info__af0325e33812d1e_arg_types_var_2269014502333157125[2] = { &__type_info__6d54aae16733e4ee, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__1f7d28ab09c70f05_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__af0325e33812d1e_arg_types_var_2269014502333157125, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xaf0325e33812d1e), "__lambda", 0 };
+TypeInfo * __type_info__13c93a11486eb59b_arg_types_var_2269014502333157125[1] = { &__type_info__83c6ce69a67deaf0 };
+VarInfo __struct_info__1f7d28ab09c70f05_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__13c93a11486eb59b_arg_types_var_2269014502333157125, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x13c93a11486eb59b), "__finalize", 8 };
+VarInfo __struct_info__1f7d28ab09c70f05_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbf843d341239202a), "__yield", 16 };
+TypeInfo * __type_info__baa5dd887a9b32c2_arg_types_var_2269014502333157125[1] = { &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__1f7d28ab09c70f05_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__baa5dd887a9b32c2_arg_types_var_2269014502333157125, nullptr, 1, 0, nullptr, 24576, 8, UINT64_C(0xbaa5dd887a9b32c2), "blk", 24 };
+VarInfo __struct_info__1f7d28ab09c70f05_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x26a01c88268cb5cf), "src", 32 };
+VarInfo __struct_info__1f7d28ab09c70f05_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x95983e212a66912a), "_loop_at_14", 40 };
+VarInfo __struct_info__1f7d28ab09c70f05_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xc0646b21183db7e), "_source_0_at_14", 48 };
+VarInfo __struct_info__1f7d28ab09c70f05_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xdb3bb94fdbe236ac), "w", 56 };
+VarInfo __struct_info__1f7d28ab09c70f05_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x9ac7a3a52e4561a2), "_pvar_0_at_14", 64 };
+VarInfo * __struct_info__1f7d28ab09c70f05_fields[9] =  { &__struct_info__1f7d28ab09c70f05_field_0, &__struct_info__1f7d28ab09c70f05_field_1, &__struct_info__1f7d28ab09c70f05_field_2, &__struct_info__1f7d28ab09c70f05_field_3, &__struct_info__1f7d28ab09c70f05_field_4, &__struct_info__1f7d28ab09c70f05_field_5, &__struct_info__1f7d28ab09c70f05_field_6, &__struct_info__1f7d28ab09c70f05_field_7, &__struct_info__1f7d28ab09c70f05_field_8 };
+StructInfo __struct_info__1f7d28ab09c70f05 = {"_lambda_thismodule_14_12_22", "", 14, __struct_info__1f7d28ab09c70f05_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0x1f7d28ab09c70f05) };
+VarInfo __func_info__d38a664a1724371c_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x6054875315d987a1), "x", 0 };
+VarInfo __func_info__d38a664a1724371c_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xc213154ac11a2dcc), "y", 0 };
+VarInfo * __func_info__d38a664a1724371c_fields[2] =  { &__func_info__d38a664a1724371c_field_0, &__func_info__d38a664a1724371c_field_1 };
+FuncInfo __func_info__d38a664a1724371c = {"invoke block<(x:int const;y:int const):int const> const", "", __func_info__d38a664a1724371c_fields, 2, 32, &__type_info__90f5707b5a6f641, nullptr,0,UINT64_C(0xd38a664a1724371c), 0x0 };
+TypeInfo __type_info__3c6cf2e5c7dde6ad = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6a3930e350d8b9e7, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x3c6cf2e5c7dde6ad) };
+TypeInfo __type_info__6f3948a703b89a51 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f4903c6752ec6541, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x6f3948a703b89a51) };
+TypeInfo __type_info__1bdc8d89ade286f = { Type::tStructure, &__struct_info__5379a78d4f0222d0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 120, UINT64_C(0x1bdc8d89ade286f) };
+TypeInfo __type_info__6cde42349a0dc4e2 = { Type::tStructure, &__struct_info__79929d78926b8fa7, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x6cde42349a0dc4e2) };
+TypeInfo __type_info__cd1cc76c0b5b3a3b = { Type::tStructure, &__struct_info__bf6564276a883dd0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0xcd1cc76c0b5b3a3b) };
+TypeInfo __type_info__a8f3a4fc49b1f977 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8875b5a4bb8f230d, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xa8f3a4fc49b1f977) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__90f4c07b5a6e390 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0x90f4c07b5a6e390) };
+TypeInfo * __type_info__4f1bdf8b4f0601a8_arg_types[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+TypeInfo __type_info__4f1bdf8b4f0601a8 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__4f1bdf8b4f0601a8_arg_types, nullptr, 2, 0, nullptr, 286, 8, UINT64_C(0x4f1bdf8b4f0601a8) };
+TypeInfo __type_info__7478fdc114c254be = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c6da56122d36aaea, nullptr, nullptr, nullptr, 0, 0, nullptr, 8461, 8, UINT64_C(0x7478fdc114c254be) };
+TypeInfo __type_info__bc40da34bfd9f5ff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d85a88cb0811b649, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xbc40da34bfd9f5ff) };
+TypeInfo * __type_info__ecf20d246ea2da8d_arg_types[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+TypeInfo __type_info__ecf20d246ea2da8d = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__ecf20d246ea2da8d_arg_types, nullptr, 2, 0, nullptr, 286, 8, UINT64_C(0xecf20d246ea2da8d) };
+TypeInfo __type_info__2f475a6f20815946 = { Type::tStructure, &__struct_info__457a06e6215cbac5, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x2f475a6f20815946) };
+TypeInfo __type_info__4df7545c01645ae1 = { Type::tStructure, &__struct_info__86e12d2ec1a3606a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 136, UINT64_C(0x4df7545c01645ae1) };
+TypeInfo __type_info__bb9c492cc91755d5 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bdf7a1e0681463c1, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xbb9c492cc91755d5) };
+TypeInfo __type_info__2a6ca4b563f875a3 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x2a6ca4b563f875a3) };
+TypeInfo __type_info__a1b1f7687b7fc012 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2feb34e5d3529432, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xa1b1f7687b7fc012) };
+TypeInfo __type_info__6794cf34222edd2b = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 41218, 24, UINT64_C(0x6794cf34222edd2b) };
+TypeInfo __type_info__af63df4c8601f1a5 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf63df4c8601f1a5) };
+TypeInfo __type_info__98e7065ef71d3cfb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1ea30300aeed91a9, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x98e7065ef71d3cfb) };
+TypeInfo __type_info__296c1814f03c34e5 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__c6da56122d36aaea, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x296c1814f03c34e5) };
+TypeInfo __type_info__1c031d28e891379a = { Type::tStructure, &__struct_info__d7b9a3ba8861754d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x1c031d28e891379a) };
+TypeInfo __type_info__ce32da0418ebc6d6 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 41218, 24, UINT64_C(0xce32da0418ebc6d6) };
+TypeInfo __type_info__1dfcb9675860dcfc = { Type::tStructure, &__struct_info__898e7dd97feabbf5, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0x1dfcb9675860dcfc) };
+TypeInfo __type_info__60d5936f4e638ac2 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__aacae256c3713dd6, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x60d5936f4e638ac2) };
+TypeInfo __type_info__24de1aaea8f37bbf = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1377ef38c945836d, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x24de1aaea8f37bbf) };
+TypeInfo * __type_info__230ec6e68c66775c_arg_types[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+TypeInfo __type_info__230ec6e68c66775c = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__230ec6e68c66775c_arg_types, nullptr, 2, 0, nullptr, 30, 8, UINT64_C(0x230ec6e68c66775c) };
+TypeInfo __type_info__d6ada678229fa84 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f475a6f20815946, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xd6ada678229fa84) };
+TypeInfo __type_info__15b5672770fd3027 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x15b5672770fd3027) };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63db4c8601ead9) };
+TypeInfo __type_info__185ee399728dead3 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__2a6ca4b563f875a3, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x185ee399728dead3) };
+TypeInfo __type_info__1377ef38c945836d = { Type::tStructure, &__struct_info__6cd3faceff529fb8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, UINT64_C(0x1377ef38c945836d) };
+TypeInfo __type_info__4db90dc5fb10ec13 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cd1cc76c0b5b3a3b, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x4db90dc5fb10ec13) };
+TypeInfo __type_info__bdf7a1e0681463c1 = { Type::tStructure, &__struct_info__7b560e51625f24ee, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0xbdf7a1e0681463c1) };
+TypeInfo __type_info__156ad800a98c62a8 = { Type::tStructure, &__struct_info__e05287b17561f9c7, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, UINT64_C(0x156ad800a98c62a8) };
+TypeInfo __type_info__561b702296a83038 = { Type::tStructure, &__struct_info__2ce346746a0ac39d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x561b702296a83038) };
+TypeInfo __type_info__1ea30300aeed91a9 = { Type::tStructure, &__struct_info__e04ef7b1755ecf40, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 88, UINT64_C(0x1ea30300aeed91a9) };
+TypeInfo __type_info__fd3623f6e384d1fc = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3c724274ce6fd088, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xfd3623f6e384d1fc) };
+TypeInfo __type_info__b29301ae75415d99 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xb29301ae75415d99) };
+TypeInfo __type_info__4da5125fcede02e2 = { Type::tStructure, &__struct_info__cc60e6d24de9e46d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 88, UINT64_C(0x4da5125fcede02e2) };
+TypeInfo * __type_info__b69bd28e2d842dd9_arg_types[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+TypeInfo __type_info__b69bd28e2d842dd9 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__b69bd28e2d842dd9_arg_types, nullptr, 2, 0, nullptr, 30, 8, UINT64_C(0xb69bd28e2d842dd9) };
+TypeInfo __type_info__6a3930e350d8b9e7 = { Type::tStructure, &__struct_info__f0c3644e1dd3b80a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0x6a3930e350d8b9e7) };
+TypeInfo __type_info__3ded19b5586b95b7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1bdc8d89ade286f, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x3ded19b5586b95b7) };
+TypeInfo __type_info__e732f984707a7444 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fe5a5d63abb87972, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe732f984707a7444) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__f4047c7272c4eb5b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6d5eace1673c3cd9, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xf4047c7272c4eb5b) };
+TypeInfo __type_info__c6da56122d36aaea = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xc6da56122d36aaea) };
+TypeInfo __type_info__25a520ad1b30fd9 = { Type::tStructure, &__struct_info__69d04685e0a74560, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0x25a520ad1b30fd9) };
+TypeInfo __type_info__83c6ce69a67deaf0 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6d54aae16733e4ee, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x83c6ce69a67deaf0) };
+TypeInfo __type_info__c655f0f336e027e9 = { Type::tStructure, &__struct_info__505118442f85739a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 96, UINT64_C(0xc655f0f336e027e9) };
+TypeInfo __type_info__d727cf470ebcdf10 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__230ec6e68c66775c, nullptr, nullptr, nullptr, 0, 0, nullptr, 8461, 8, UINT64_C(0xd727cf470ebcdf10) };
+TypeInfo __type_info__53c59994f551fa0a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6cde42349a0dc4e2, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x53c59994f551fa0a) };
+TypeInfo __type_info__a52e7c07602356af = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40994, 24, UINT64_C(0xa52e7c07602356af) };
+TypeInfo __type_info__ade9b1523a00b747 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bbbb40b84cc1be8d, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xade9b1523a00b747) };
+TypeInfo __type_info__db27357fa3eaaa3e = { Type::tStructure, &__struct_info__e06853efcc15cee5, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0xdb27357fa3eaaa3e) };
+TypeInfo __type_info__be0705f80ec4dc07 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bd650e7b2b33be23, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xbe0705f80ec4dc07) };
+TypeInfo __type_info__cb7308b44d3f8ad6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a177731b62cb70ec, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xcb7308b44d3f8ad6) };
+TypeInfo __type_info__16a32539a1950c90 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4da5125fcede02e2, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x16a32539a1950c90) };
+TypeInfo __type_info__8875b5a4bb8f230d = { Type::tStructure, &__struct_info__c20bde997ea8ce0c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0x8875b5a4bb8f230d) };
+TypeInfo __type_info__fe5a5d63abb87972 = { Type::tStructure, &__struct_info__e6264309573020f1, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0xfe5a5d63abb87972) };
+TypeInfo __type_info__7bf5307b489d850 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0x7bf5307b489d850) };
+TypeInfo __type_info__dc109ea7c63e48a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6eaa4ee09cf6186c, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xdc109ea7c63e48a) };
+TypeInfo __type_info__8eea9764bc67c160 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1dfcb9675860dcfc, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8eea9764bc67c160) };
+TypeInfo __type_info__ebd3969580ab017b = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xebd3969580ab017b) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+TypeInfo __type_info__6eaa4ee09cf6186c = { Type::tStructure, &__struct_info__2243015f6b9fdc53, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0x6eaa4ee09cf6186c) };
+TypeInfo __type_info__c64ef0f336da093b = { Type::tStructure, &__struct_info__505116442f857034, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 96, UINT64_C(0xc64ef0f336da093b) };
+TypeInfo __type_info__6d5eace1673c3cd9 = { Type::tStructure, &__struct_info__1f7d25ab09c709ec, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 72, UINT64_C(0x6d5eace1673c3cd9) };
+TypeInfo __type_info__6d54aae16733e4ee = { Type::tStructure, &__struct_info__1f7d28ab09c70f05, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, UINT64_C(0x6d54aae16733e4ee) };
+TypeInfo __type_info__bd650e7b2b33be23 = { Type::tStructure, &__struct_info__a85847e7150b5eb8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0xbd650e7b2b33be23) };
+TypeInfo __type_info__388a580cd154083c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4df3d25c01614824, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x388a580cd154083c) };
+TypeInfo __type_info__64be5dc860f5ba81 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x64be5dc860f5ba81) };
+TypeInfo __type_info__d85a88cb0811b649 = { Type::tStructure, &__struct_info__ee404e56325864fc, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0xd85a88cb0811b649) };
+TypeInfo __type_info__f4903c6752ec6541 = { Type::tStructure, &__struct_info__9e41a3bdecab19b2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 24, UINT64_C(0xf4903c6752ec6541) };
+TypeInfo __type_info__2feb34e5d3529432 = { Type::tStructure, &__struct_info__92b50408061416b3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0x2feb34e5d3529432) };
+TypeInfo __type_info__3c724274ce6fd088 = { Type::tStructure, &__struct_info__e95a96f774b5ed21, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0x3c724274ce6fd088) };
+TypeInfo __type_info__eaa81096831f6030 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__561b702296a83038, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xeaa81096831f6030) };
+TypeInfo __type_info__287226494776f491 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1574da00a994ba93, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x287226494776f491) };
+TypeInfo __type_info__8c109174916e450c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__db27357fa3eaaa3e, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x8c109174916e450c) };
+TypeInfo __type_info__4df3d25c01614824 = { Type::tStructure, &__struct_info__86e12e2ec1a3621d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 120, UINT64_C(0x4df3d25c01614824) };
+TypeInfo __type_info__254c2aebd5a0e423 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c64ef0f336da093b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x254c2aebd5a0e423) };
+TypeInfo __type_info__faa8860665a6a9c9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4df7545c01645ae1, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xfaa8860665a6a9c9) };
+TypeInfo __type_info__a177731b62cb70ec = { Type::tStructure, &__struct_info__a48507c33051b48b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0xa177731b62cb70ec) };
+TypeInfo __type_info__bbbb40b84cc1be8d = { Type::tStructure, &__struct_info__6b2f06a43c338f58, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0xbbbb40b84cc1be8d) };
+TypeInfo __type_info__5f97da61fb7344c5 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x5f97da61fb7344c5) };
+TypeInfo __type_info__772d2adc9dad5ec5 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c655f0f336e027e9, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x772d2adc9dad5ec5) };
+TypeInfo __type_info__40f0563f55af18bb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__90f5707b5a6f641, nullptr, nullptr, nullptr, 0, 0, nullptr, 8461, 8, UINT64_C(0x40f0563f55af18bb) };
+TypeInfo __type_info__6d36f884b58c289e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__156ad800a98c62a8, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x6d36f884b58c289e) };
+TypeInfo __type_info__289c16574f003020 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x289c16574f003020) };
+TypeInfo __type_info__1574da00a994ba93 = { Type::tStructure, &__struct_info__e05284b17561f4ae, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 72, UINT64_C(0x1574da00a994ba93) };
+TypeInfo __type_info__a3dfaa63decefde = { Type::tStructure, &__struct_info__ccf8cc02c6c3a4f3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 96, UINT64_C(0xa3dfaa63decefde) };
+TypeInfo __type_info__aacae256c3713dd6 = { Type::tStructure, &__struct_info__76faad0f01a00c4b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0xaacae256c3713dd6) };
+TypeInfo __type_info__40ad0c15d6e5502e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a3dfaa63decefde, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x40ad0c15d6e5502e) };
+TypeInfo __type_info__d579d48436105d0b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__25a520ad1b30fd9, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xd579d48436105d0b) };
+TypeInfo __type_info__48dc519e0431cc1c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1c031d28e891379a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x48dc519e0431cc1c) };
+TypeInfo __type_info__3ceb21b1e6727087 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x3ceb21b1e6727087) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__185ee399728dead3 };
+TypeInfo * __tinfo_1[1] = { &__type_info__64be5dc860f5ba81 };
+TypeInfo * __tinfo_2[1] = { &__type_info__289c16574f003020 };
+TypeInfo * __tinfo_3[1] = { &__type_info__296c1814f03c34e5 };
+TypeInfo * __tinfo_4[1] = { &__type_info__3ceb21b1e6727087 };
+TypeInfo * __tinfo_5[1] = { &__type_info__185ee399728dead3 };
+namespace  { struct _lambda_thismodule_85_28_1; };
+namespace  { struct _lambda_thismodule_173_8_2; };
+namespace  { struct _lambda_thismodule_190_8_3; };
+namespace  { struct _lambda_thismodule_50_23_4; };
+namespace  { struct _lambda_thismodule_106_15_5; };
+namespace  { struct _lambda_thismodule_139_28_6; };
+namespace  { struct _lambda_thismodule_227_19_7; };
+namespace  { struct _lambda_thismodule_232_10_8; };
+namespace  { struct _lambda_thismodule_235_18_9; };
+namespace  { struct _lambda_thismodule_56_21_10; };
+namespace  { struct _lambda_thismodule_90_14_11; };
+namespace  { struct _lambda_thismodule_240_10_12; };
+namespace  { struct _lambda_thismodule_243_18_13; };
+namespace  { struct _lambda_thismodule_71_25_14; };
+namespace  { struct _lambda_thismodule_115_27_15; };
+namespace  { struct _lambda_thismodule_163_30_16; };
+namespace  { struct _lambda_thismodule_172_30_17; };
+namespace  { struct _lambda_thismodule_180_30_18; };
+namespace  { struct _lambda_thismodule_157_12_19; };
+namespace  { struct _lambda_thismodule_130_12_20; };
+namespace  { struct _lambda_thismodule_14_12_21; };
+namespace  { struct _lambda_thismodule_14_12_22; };
+namespace  { struct _lambda_thismodule_36_12_23; };
+namespace  { struct _lambda_thismodule_36_12_24; };
+namespace  { struct _lambda_thismodule_36_12_25; };
+namespace  { struct _lambda_thismodule_91_25_26; };
+namespace  { struct _lambda_thismodule_36_12_27; };
+namespace  { struct _lambda_thismodule_142_12_28; };
+namespace  { struct _lambda_thismodule_142_12_29; };
+namespace  { struct _lambda_thismodule_20_12_30; };
+namespace  { struct _lambda_thismodule_163_12_31; };
+namespace  { struct _lambda_thismodule_92_36_32; };
+namespace  { struct _lambda_thismodule_163_12_33; };
+namespace  { struct _lambda_thismodule_41_12_34; };
+namespace  { struct _lambda_thismodule_93_29_35; };
+namespace  { struct _lambda_thismodule_36_12_36; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace templates { struct DecltypeMacro; };
+namespace templates { struct DecltypeNoRefMacro; };
+namespace templates { struct TemplateMacro; };
+namespace contracts { struct IsAnyType; };
+namespace contracts { struct IsAnyArrayMacro; };
+namespace contracts { struct IsDimMacro; };
+namespace contracts { struct IsNotDimMacro; };
+namespace contracts { struct IsAnyEnumMacro; };
+namespace contracts { struct IsAnyVectorType; };
+namespace contracts { struct IsAnyStructMacro; };
+namespace contracts { struct IsAnyNumericMacro; };
+namespace contracts { struct IsAnyWorkhorse; };
+namespace contracts { struct IsAnyWorkhorseNonPtrMacro; };
+namespace contracts { struct IsAnyTupleNonPtrMacro; };
+namespace contracts { struct IsAnyVariantNonPtrMacro; };
+namespace contracts { struct IsAnyFunctionNonPtrMacro; };
+namespace templates_boost { struct Template; };
+namespace templates_boost { struct TemplateVisitor; };
+namespace templates_boost { struct RemoveDerefVisitor; };
+namespace templates_boost { struct QRulesVisitor; };
+namespace templates_boost { struct AstQCallMacro; };
+namespace templates_boost { struct QMacro; };
+namespace templates_boost { struct QBlockMacro; };
+namespace templates_boost { struct QBlockExprMacro; };
+namespace templates_boost { struct QTypeMacro; };
+namespace templates_boost { struct AstQNamedMacro; };
+namespace templates_boost { struct AstQFunctionMacro; };
+namespace templates_boost { struct AstQVariableMacro; };
+namespace templates_boost { struct AstQNamedClassMacro; };
+namespace templates_boost { struct AstQMethodMacro; };
+namespace functional { struct FusionMacro; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+// unused structure DecltypeMacro
+// unused structure DecltypeNoRefMacro
+// unused structure TemplateMacro
+// unused structure IsAnyType
+// unused structure IsAnyArrayMacro
+// unused structure IsDimMacro
+// unused structure IsNotDimMacro
+// unused structure IsAnyEnumMacro
+// unused structure IsAnyVectorType
+// unused structure IsAnyStructMacro
+// unused structure IsAnyNumericMacro
+// unused structure IsAnyWorkhorse
+// unused structure IsAnyWorkhorseNonPtrMacro
+// unused structure IsAnyTupleNonPtrMacro
+// unused structure IsAnyVariantNonPtrMacro
+// unused structure IsAnyFunctionNonPtrMacro
+// unused structure Template
+// unused structure TemplateVisitor
+// unused structure RemoveDerefVisitor
+// unused structure QRulesVisitor
+// unused structure AstQCallMacro
+// unused structure QMacro
+// unused structure QBlockMacro
+// unused structure QBlockExprMacro
+// unused structure QTypeMacro
+// unused structure AstQNamedMacro
+// unused structure AstQFunctionMacro
+// unused structure AstQVariableMacro
+// unused structure AstQNamedClassMacro
+// unused structure AstQMethodMacro
+// unused structure FusionMacro
+namespace  {
+
+struct _lambda_thismodule_85_28_1 {
+	Func DAS_COMMENT((int32_t,_lambda_thismodule_85_28_1,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_85_28_1 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_85_28_1)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_85_28_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_85_28_1,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_173_8_2 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_173_8_2,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_173_8_2 *)) __finalize;
+	int32_t start;
+	int32_t step;
+};
+static_assert(sizeof(_lambda_thismodule_173_8_2)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_2,start)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_2,step)==20,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_190_8_3 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_190_8_3,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_190_8_3 *)) __finalize;
+	int32_t __yield;
+	int32_t count;
+	int32_t value;
+	bool _loop_at_193;
+	int32_t x;
+	void * _pvar_0_at_193;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_193;
+};
+static_assert(sizeof(_lambda_thismodule_190_8_3)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_190_8_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_190_8_3,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_190_8_3,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_190_8_3,count)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_190_8_3,value)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_190_8_3,_loop_at_193)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_190_8_3,x)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_190_8_3,_pvar_0_at_193)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_190_8_3,_source_0_at_193)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_50_23_4 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_50_23_4,int32_t const  * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_50_23_4 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_50;
+	int32_t x;
+	void * _pvar_0_at_50;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_50;
+};
+static_assert(sizeof(_lambda_thismodule_50_23_4)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,_loop_at_50)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,_pvar_0_at_50)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,_source_0_at_50)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_106_15_5 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_106_15_5,int32_t const  * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_106_15_5 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_106;
+	int32_t x;
+	void * _pvar_0_at_106;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_106;
+};
+static_assert(sizeof(_lambda_thismodule_106_15_5)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,_loop_at_106)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,_pvar_0_at_106)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,_source_0_at_106)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_139_28_6 {
+	Func DAS_COMMENT((TTuple<8,int32_t,float>,_lambda_thismodule_139_28_6,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_139_28_6 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_139_28_6)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_28_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_28_6,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_227_19_7 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_227_19_7,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_227_19_7 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_227;
+	int32_t x;
+	void * _pvar_0_at_227;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_227;
+};
+static_assert(sizeof(_lambda_thismodule_227_19_7)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,_loop_at_227)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,_pvar_0_at_227)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,_source_0_at_227)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_232_10_8 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_232_10_8,TTuple<8,int32_t,float>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_232_10_8 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_232;
+	int32_t x;
+	void * _pvar_0_at_232;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_232;
+};
+static_assert(sizeof(_lambda_thismodule_232_10_8)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,_loop_at_232)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,_pvar_0_at_232)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,_source_0_at_232)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_235_18_9 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_235_18_9,TTuple<8,int32_t,float>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_235_18_9 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_235;
+	int32_t x;
+	void * _pvar_0_at_235;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_235;
+};
+static_assert(sizeof(_lambda_thismodule_235_18_9)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,_loop_at_235)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,_pvar_0_at_235)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,_source_0_at_235)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_56_21_10 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_56_21_10,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_56_21_10 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_56;
+	int32_t x;
+	void * _pvar_0_at_56;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_56;
+};
+static_assert(sizeof(_lambda_thismodule_56_21_10)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,_loop_at_56)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,_pvar_0_at_56)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,_source_0_at_56)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_90_14_11 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_90_14_11,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_90_14_11 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_90;
+	int32_t x;
+	void * _pvar_0_at_90;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_90;
+};
+static_assert(sizeof(_lambda_thismodule_90_14_11)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,_loop_at_90)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,_pvar_0_at_90)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,_source_0_at_90)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_240_10_12 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_240_10_12,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_240_10_12 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_240;
+	int32_t x;
+	void * _pvar_0_at_240;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_240;
+};
+static_assert(sizeof(_lambda_thismodule_240_10_12)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,_loop_at_240)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,_pvar_0_at_240)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,_source_0_at_240)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_243_18_13 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_243_18_13,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_243_18_13 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_243;
+	int32_t x;
+	void * _pvar_0_at_243;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_243;
+};
+static_assert(sizeof(_lambda_thismodule_243_18_13)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,_loop_at_243)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,_pvar_0_at_243)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,_source_0_at_243)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_71_25_14 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_71_25_14,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_71_25_14 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_71_25_14)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_71_25_14,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_71_25_14,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_115_27_15 {
+	Func DAS_COMMENT((int32_t,_lambda_thismodule_115_27_15,int32_t,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_115_27_15 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_115_27_15)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_115_27_15,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_115_27_15,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_163_30_16 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_163_30_16,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_163_30_16 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_163_30_16)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_30_16,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_30_16,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_172_30_17 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_172_30_17,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_172_30_17 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_172_30_17)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_172_30_17,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_172_30_17,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_180_30_18 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_180_30_18,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_180_30_18 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_180_30_18)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_30_18,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_30_18,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_157_12_19 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_157_12_19,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_157_12_19 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((int32_t)) src;
+	int32_t start;
+	int32_t stop;
+	bool _loop_at_157;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_157;
+	int32_t x;
+	void * _pvar_0_at_157;
+	int32_t i;
+	void * _pvar_1_at_157;
+	Sequence DAS_COMMENT((int32_t)) _source_1_at_157;
+};
+static_assert(sizeof(_lambda_thismodule_157_12_19)==96,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_157_12_19,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_157_12_19,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_157_12_19,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_157_12_19,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_157_12_19,start)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_157_12_19,stop)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_157_12_19,_loop_at_157)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_157_12_19,_source_0_at_157)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_157_12_19,x)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_157_12_19,_pvar_0_at_157)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_157_12_19,i)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_157_12_19,_pvar_1_at_157)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_157_12_19,_source_1_at_157)==88,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_130_12_20 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_130_12_20,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_130_12_20 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((int32_t)) src;
+	TArray<int32_t> arr;
+	bool ___loop_at_135_rename_at_135;
+	int32_t * __x_rename_at_135;
+	void * ___pvar_0_at_135_rename_at_135;
+	bool _loop_at_131;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_131;
+	int32_t x;
+	void * _pvar_0_at_131;
+	Sequence DAS_COMMENT((int32_t &)) ___source_0_at_135_rename_at_135;
+};
+static_assert(sizeof(_lambda_thismodule_130_12_20)==120,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_12_20,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_12_20,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_12_20,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_12_20,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_12_20,arr)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_12_20,___loop_at_135_rename_at_135)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_12_20,__x_rename_at_135)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_12_20,___pvar_0_at_135_rename_at_135)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_12_20,_loop_at_131)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_12_20,_source_0_at_131)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_12_20,x)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_12_20,_pvar_0_at_131)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_12_20,___source_0_at_135_rename_at_135)==112,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_14_12_21 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_14_12_21,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_14_12_21 *)) __finalize;
+	int32_t __yield;
+	Func DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_14;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_14;
+	int32_t w;
+	void * _pvar_0_at_14;
+};
+static_assert(sizeof(_lambda_thismodule_14_12_21)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_21,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_21,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_21,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_21,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_21,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_21,_loop_at_14)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_21,_source_0_at_14)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_21,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_21,_pvar_0_at_14)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_14_12_22 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_14_12_22,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_14_12_22 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_14;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_14;
+	int32_t w;
+	void * _pvar_0_at_14;
+};
+static_assert(sizeof(_lambda_thismodule_14_12_22)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_22,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_22,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_22,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_22,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_22,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_22,_loop_at_14)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_22,_source_0_at_14)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_22,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_14_12_22,_pvar_0_at_14)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_36_12_23 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_36_12_23,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_36_12_23 *)) __finalize;
+	int32_t __yield;
+	Func DAS_COMMENT((int32_t,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_36;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_36;
+	int32_t w;
+	void * _pvar_0_at_36;
+};
+static_assert(sizeof(_lambda_thismodule_36_12_23)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_23,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_23,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_23,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_23,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_23,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_23,_loop_at_36)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_23,_source_0_at_36)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_23,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_23,_pvar_0_at_36)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_36_12_24 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_36_12_24,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_36_12_24 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((int32_t,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_36;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_36;
+	int32_t w;
+	void * _pvar_0_at_36;
+};
+static_assert(sizeof(_lambda_thismodule_36_12_24)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_24,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_24,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_24,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_24,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_24,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_24,_loop_at_36)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_24,_source_0_at_36)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_24,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_24,_pvar_0_at_36)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_36_12_25 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_36_12_25,bool &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_36_12_25 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_36;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_36;
+	int32_t w;
+	void * _pvar_0_at_36;
+};
+static_assert(sizeof(_lambda_thismodule_36_12_25)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_25,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_25,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_25,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_25,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_25,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_25,_loop_at_36)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_25,_source_0_at_36)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_25,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_25,_pvar_0_at_36)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_91_25_26 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_91_25_26,TArray<int32_t> const )) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_91_25_26 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_91_25_26)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_91_25_26,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_91_25_26,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_36_12_27 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_36_12_27,TTuple<8,int32_t,float>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_36_12_27 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_36;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_36;
+	int32_t w;
+	void * _pvar_0_at_36;
+};
+static_assert(sizeof(_lambda_thismodule_36_12_27)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_27,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_27,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_27,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_27,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_27,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_27,_loop_at_36)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_27,_source_0_at_36)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_27,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_27,_pvar_0_at_36)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_142_12_28 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_142_12_28,TTuple<8,int32_t,float> * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_142_12_28 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) src;
+	TArray<TTuple<8,int32_t,float>> arr;
+	bool ___loop_at_147_rename_at_147;
+	TTuple<8,int32_t,float> * __x_rename_at_147;
+	void * ___pvar_0_at_147_rename_at_147;
+	bool _loop_at_143;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _source_0_at_143;
+	TTuple<8,int32_t,float> x;
+	void * _pvar_0_at_143;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) ___source_0_at_147_rename_at_147;
+};
+static_assert(sizeof(_lambda_thismodule_142_12_28)==120,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_28,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_28,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_28,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_28,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_28,arr)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_28,___loop_at_147_rename_at_147)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_28,__x_rename_at_147)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_28,___pvar_0_at_147_rename_at_147)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_28,_loop_at_143)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_28,_source_0_at_143)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_28,x)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_28,_pvar_0_at_143)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_28,___source_0_at_147_rename_at_147)==112,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_142_12_29 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_142_12_29,TArray<int32_t> * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_142_12_29 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TArray<int32_t>)) src;
+	TArray<TArray<int32_t>> arr;
+	bool ___loop_at_147_rename_at_147;
+	TArray<int32_t> * __x_rename_at_147;
+	void * ___pvar_0_at_147_rename_at_147;
+	bool _loop_at_143;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_143;
+	TArray<int32_t> x;
+	void * _pvar_0_at_143;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) ___source_0_at_147_rename_at_147;
+};
+static_assert(sizeof(_lambda_thismodule_142_12_29)==136,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_29,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_29,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_29,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_29,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_29,arr)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_29,___loop_at_147_rename_at_147)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_29,__x_rename_at_147)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_29,___pvar_0_at_147_rename_at_147)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_29,_loop_at_143)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_29,_source_0_at_143)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_29,x)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_29,_pvar_0_at_143)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_142_12_29,___source_0_at_147_rename_at_147)==128,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_20_12_30 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_20_12_30,TArray<int32_t> * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_20_12_30 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,TArray<int32_t> const )) blk;
+	Sequence DAS_COMMENT((TArray<int32_t>)) src;
+	bool _loop_at_20;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_20;
+	TArray<int32_t> w;
+	void * _pvar_0_at_20;
+};
+static_assert(sizeof(_lambda_thismodule_20_12_30)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_20_12_30,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_20_12_30,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_20_12_30,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_20_12_30,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_20_12_30,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_20_12_30,_loop_at_20)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_20_12_30,_source_0_at_20)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_20_12_30,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_20_12_30,_pvar_0_at_20)==80,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_163_12_31 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_163_12_31,TTuple<8,int32_t,float> * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_163_12_31 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) src;
+	int32_t start;
+	int32_t stop;
+	bool _loop_at_163;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _source_0_at_163;
+	TTuple<8,int32_t,float> * x;
+	void * _pvar_0_at_163;
+	int32_t i;
+	void * _pvar_1_at_163;
+	Sequence DAS_COMMENT((int32_t)) _source_1_at_163;
+};
+static_assert(sizeof(_lambda_thismodule_163_12_31)==96,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_31,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_31,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_31,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_31,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_31,start)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_31,stop)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_31,_loop_at_163)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_31,_source_0_at_163)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_31,x)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_31,_pvar_0_at_163)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_31,i)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_31,_pvar_1_at_163)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_31,_source_1_at_163)==88,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_92_36_32 {
+	Func DAS_COMMENT((TArray<int32_t>,_lambda_thismodule_92_36_32,TArray<int32_t> const )) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_92_36_32 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_92_36_32)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_92_36_32,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_92_36_32,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_163_12_33 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_163_12_33,TArray<int32_t> * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_163_12_33 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) src;
+	int32_t start;
+	int32_t stop;
+	bool _loop_at_163;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) _source_0_at_163;
+	TArray<int32_t> * x;
+	void * _pvar_0_at_163;
+	int32_t i;
+	void * _pvar_1_at_163;
+	Sequence DAS_COMMENT((int32_t)) _source_1_at_163;
+};
+static_assert(sizeof(_lambda_thismodule_163_12_33)==96,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_33,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_33,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_33,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_33,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_33,start)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_33,stop)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_33,_loop_at_163)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_33,_source_0_at_163)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_33,x)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_33,_pvar_0_at_163)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_33,i)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_33,_pvar_1_at_163)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_12_33,_source_1_at_163)==88,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_41_12_34 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_41_12_34,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_41_12_34 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) blk;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) src;
+	bool _loop_at_41;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) _source_0_at_41;
+	TArray<int32_t> * w;
+	void * _pvar_0_at_41;
+};
+static_assert(sizeof(_lambda_thismodule_41_12_34)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_41_12_34,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_41_12_34,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_41_12_34,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_41_12_34,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_41_12_34,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_41_12_34,_loop_at_41)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_41_12_34,_source_0_at_41)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_41_12_34,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_41_12_34,_pvar_0_at_41)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_93_29_35 {
+	Func DAS_COMMENT((int32_t,_lambda_thismodule_93_29_35,TArray<int32_t> const )) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_93_29_35 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_93_29_35)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_29_35,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_29_35,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_36_12_36 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_36_12_36,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_36_12_36 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) blk;
+	Sequence DAS_COMMENT((TArray<int32_t>)) src;
+	bool _loop_at_36;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_36;
+	TArray<int32_t> w;
+	void * _pvar_0_at_36;
+};
+static_assert(sizeof(_lambda_thismodule_36_12_36)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_36,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_36,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_36,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_36,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_36,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_36,_loop_at_36)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_36,_source_0_at_36)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_36,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_12_36,_pvar_0_at_36)==80,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_54bf1348c9b80490 ( Context * __context__, _lambda_thismodule_36_12_36 & ____this_rename_at_36 );
+inline bool _Func_lambda_thismodule_36_12_36_0x60_function_f70e75692c84d121 ( Context * __context__, _lambda_thismodule_36_12_36 & ____this_rename_at_36, int32_t & ___yield_36_rename_at_36 );
+inline void _Func_lambda_thismodule_36_12_36_0x60_finalizer_16d59ce0493ea764 ( Context * __context__, _lambda_thismodule_36_12_36 * ____this_rename_at_36 );
+inline void finalize_a7122cc19257df9a ( Context * __context__, _lambda_thismodule_93_29_35 & ____this_rename_at_93 );
+inline int32_t _Func_lambda_thismodule_93_29_35_0x60_function_9952822083039823 ( Context * __context__, _lambda_thismodule_93_29_35 & ____this_rename_at_93, TArray<int32_t> const  & __x_rename_at_93 );
+inline void _Func_lambda_thismodule_93_29_35_0x60_finalizer_77b7ae3fdea0e0ca ( Context * __context__, _lambda_thismodule_93_29_35 * ____this_rename_at_93 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_9262de0c50f54bad ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_33, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) __blk_rename_at_33 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_82ad2f6322b2be3d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_51, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const  __blk_rename_at_51 );
+inline void finalize_c6c82fde31fdb2e6 ( Context * __context__, _lambda_thismodule_41_12_34 & ____this_rename_at_41 );
+inline bool _Func_lambda_thismodule_41_12_34_0x60_function_fbe3de92257c0070 ( Context * __context__, _lambda_thismodule_41_12_34 & ____this_rename_at_41, TArray<int32_t> & ___yield_41_rename_at_41 );
+inline void _Func_lambda_thismodule_41_12_34_0x60_finalizer_7303256f4aeb3774 ( Context * __context__, _lambda_thismodule_41_12_34 * ____this_rename_at_41 );
+inline bool _Func_0x60_is_same_b2ee21551accec13 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) const  & __a_rename_at_37, Sequence DAS_COMMENT((TArray<int32_t>)) const  & __b_rename_at_37 );
+inline void finalize_fae068741c4996d9 ( Context * __context__, _lambda_thismodule_163_12_33 & ____this_rename_at_163 );
+inline bool _Func_0x60_is_same_84e5a5cb0f2aec39 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) const  & __a_rename_at_37, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & __b_rename_at_37 );
+inline void finalize_b0bb974ccdd5181b ( Context * __context__, _lambda_thismodule_163_12_31 & ____this_rename_at_163 );
+inline void finalize_3f3f5513ea66b214 ( Context * __context__, _lambda_thismodule_92_36_32 & ____this_rename_at_92 );
+inline bool _Func_lambda_thismodule_163_12_33_0x60_function_f8080823c69e3cdd ( Context * __context__, _lambda_thismodule_163_12_33 & ____this_rename_at_163, TArray<int32_t> * & ___ryield163_rename_at_163 );
+inline void _Func_lambda_thismodule_163_12_33_0x60_finalizer_965919f06d889a76 ( Context * __context__, _lambda_thismodule_163_12_33 * ____this_rename_at_163 );
+inline void _Funcbuiltin_0x60_finalize_ca527b18279269a0 ( Context * __context__, TArray<TArray<int32_t>> & __a_rename_at_399 );
+inline bool _Func_lambda_thismodule_163_12_31_0x60_function_748a5459db8fb549 ( Context * __context__, _lambda_thismodule_163_12_31 & ____this_rename_at_163, TTuple<8,int32_t,float> * & ___ryield163_rename_at_163 );
+inline void _Func_lambda_thismodule_163_12_31_0x60_finalizer_5625720652b77ce2 ( Context * __context__, _lambda_thismodule_163_12_31 * ____this_rename_at_163 );
+inline void _Funcbuiltin_0x60_finalize_943699eaf2940908 ( Context * __context__, TArray<TTuple<8,int32_t,float>> & __a_rename_at_399 );
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> & __a_rename_at_338, TArray<int32_t> const  & __b_rename_at_338 );
+inline TArray<int32_t> _Func_lambda_thismodule_92_36_32_0x60_function_cc78477825a25340 ( Context * __context__, _lambda_thismodule_92_36_32 & ____this_rename_at_92, TArray<int32_t> const  & __x_rename_at_92 );
+inline void _Func_lambda_thismodule_92_36_32_0x60_finalizer_cc7541e2ca708852 ( Context * __context__, _lambda_thismodule_92_36_32 * ____this_rename_at_92 );
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_any_17b6b876d76660ef ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __src_rename_at_33, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) __blk_rename_at_33 );
+inline void finalize_554c45dda146b8a6 ( Context * __context__, TTuple<8,int32_t,float> & ____this_rename_at_143 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_e5c085c7199596c7 ( Context * __context__, TArray<TArray<int32_t>> const  & __a_rename_at_475 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_399 );
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_cb33d88d14d2480d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __src_rename_at_51, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const  __blk_rename_at_51 );
+inline int32_t _Func_0x60_first_7932efd700c6a809 ( Context * __context__, TTuple<8,int32_t,float> const  & __x_rename_at_23 );
+inline void finalize_f88f9c056c2aa22b ( Context * __context__, _lambda_thismodule_20_12_30 & ____this_rename_at_20 );
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_any_7bf095d1cee7b6d8 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & __it_rename_at_60, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  & __functor_rename_at_60 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_6a927dd59cc9e5af ( Context * __context__, TArray<TTuple<8,int32_t,float>> const  & __a_rename_at_475 );
+inline bool _Funcfunctional_0x60_not_4c37d11112acdd2e ( Context * __context__, bool __x_rename_at_205 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_islice_51a3045a357b5024 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __src_rename_at_153, int32_t __start_rename_at_153, int32_t __stop_rename_at_153 );
+inline void finalize_fd89e81470ac2037 ( Context * __context__, _lambda_thismodule_142_12_29 & ____this_rename_at_142 );
+inline bool _Func_lambda_thismodule_20_12_30_0x60_function_2a3c166be85a47a1 ( Context * __context__, _lambda_thismodule_20_12_30 & ____this_rename_at_20, TArray<int32_t> * & ___ryield20_rename_at_20 );
+inline void _Func_lambda_thismodule_20_12_30_0x60_finalizer_9ebeff833b3b3714 ( Context * __context__, _lambda_thismodule_20_12_30 * ____this_rename_at_20 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_ref_ab33c386e8c5b2f6 ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const  __lam_rename_at_487 );
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_8ae7fcb7e421f194 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & __it_rename_at_87, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  & __blk_rename_at_87 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_islice_ed9efbf4e50742f0 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) & __src_rename_at_153, int32_t __start_rename_at_153, int32_t __stop_rename_at_153 );
+inline void finalize_688b941ccc3b70f0 ( Context * __context__, _lambda_thismodule_142_12_28 & ____this_rename_at_142 );
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_a87e3fc9767b4917 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_475 );
+inline void _Funcbuiltin_0x60_push_clone_17e595ccf2ea82f6 ( Context * __context__, TArray<TArray<int32_t>> & __Arr_rename_at_156, TArray<int32_t> const  & __value_rename_at_156 );
+inline bool _Func_lambda_thismodule_142_12_29_0x60_function_4ac001e1c9c805bd ( Context * __context__, _lambda_thismodule_142_12_29 & ____this_rename_at_142, TArray<int32_t> * & ___ryield142_rename_at_142 );
+inline void _Func_lambda_thismodule_142_12_29_0x60_finalizer_7197b61db218f9f4 ( Context * __context__, _lambda_thismodule_142_12_29 * ____this_rename_at_142 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_ref_dd86c289804be67a ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const  __lam_rename_at_487 );
+inline void _Func_0x60_verify_even_b071089197a7ced6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __arr_rename_at_19 );
+inline bool _Funcfunctional_0x60_any_cf35c74e31a01f2b ( Context * __context__, Sequence DAS_COMMENT((bool)) const  & __it_rename_at_102 );
+inline bool _Funcfunctional_0x60_all_927327c38b4c115b ( Context * __context__, Sequence DAS_COMMENT((bool)) const  & __it_rename_at_115 );
+inline bool _Func_0x60_is_same_8d62f8edc4df68d8 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __a_rename_at_37, Sequence DAS_COMMENT((int32_t)) const  & __b_rename_at_37 );
+inline void finalize_40e8d0f1b8f49c52 ( Context * __context__, _lambda_thismodule_14_12_21 & ____this_rename_at_14 );
+inline void finalize_40ecfde5d647179b ( Context * __context__, _lambda_thismodule_14_12_22 & ____this_rename_at_14 );
+inline void finalize_26e26b1d9e5eee70 ( Context * __context__, _lambda_thismodule_36_12_23 & ____this_rename_at_36 );
+inline void finalize_c73f35326dfaded9 ( Context * __context__, _lambda_thismodule_36_12_24 & ____this_rename_at_36 );
+inline void finalize_2b16ae00fd6cbbd8 ( Context * __context__, _lambda_thismodule_91_25_26 & ____this_rename_at_91 );
+inline void _Funcbuiltin_0x60_push_clone_bede40064f7c66cf ( Context * __context__, TArray<TTuple<8,int32_t,float>> & __Arr_rename_at_156, TTuple<8,int32_t,float> const  & __value_rename_at_156 );
+inline bool _Func_lambda_thismodule_142_12_28_0x60_function_cdeb562fe872f9e2 ( Context * __context__, _lambda_thismodule_142_12_28 & ____this_rename_at_142, TTuple<8,int32_t,float> * & ___ryield142_rename_at_142 );
+inline void _Func_lambda_thismodule_142_12_28_0x60_finalizer_7db4fed5bf632358 ( Context * __context__, _lambda_thismodule_142_12_28 * ____this_rename_at_142 );
+inline void finalize_91466dc60be5ec6 ( Context * __context__, _lambda_thismodule_157_12_19 & ____this_rename_at_157 );
+inline void finalize_3c0e41d6a28cffe3 ( Context * __context__, _lambda_thismodule_130_12_20 & ____this_rename_at_130 );
+inline bool _Func_lambda_thismodule_14_12_21_0x60_function_f174bcd7545caa8a ( Context * __context__, _lambda_thismodule_14_12_21 & ____this_rename_at_14, int32_t & ___yield_14_rename_at_14 );
+inline void _Func_lambda_thismodule_14_12_21_0x60_finalizer_82f817fdaad6b024 ( Context * __context__, _lambda_thismodule_14_12_21 * ____this_rename_at_14 );
+inline bool _Func_lambda_thismodule_14_12_22_0x60_function_e557eee355d39963 ( Context * __context__, _lambda_thismodule_14_12_22 & ____this_rename_at_14, int32_t & ___yield_14_rename_at_14 );
+inline void _Func_lambda_thismodule_14_12_22_0x60_finalizer_2f37f530a0cea82c ( Context * __context__, _lambda_thismodule_14_12_22 * ____this_rename_at_14 );
+inline bool _Func_lambda_thismodule_36_12_23_0x60_function_f95273975fd7764 ( Context * __context__, _lambda_thismodule_36_12_23 & ____this_rename_at_36, int32_t & ___yield_36_rename_at_36 );
+inline void _Func_lambda_thismodule_36_12_23_0x60_finalizer_6ba2205dab2f7198 ( Context * __context__, _lambda_thismodule_36_12_23 * ____this_rename_at_36 );
+inline bool _Func_lambda_thismodule_36_12_24_0x60_function_ccba983e2210c435 ( Context * __context__, _lambda_thismodule_36_12_24 & ____this_rename_at_36, int32_t & ___yield_36_rename_at_36 );
+inline void _Func_lambda_thismodule_36_12_24_0x60_finalizer_508212161cc2a60c ( Context * __context__, _lambda_thismodule_36_12_24 * ____this_rename_at_36 );
+inline bool _Func_lambda_thismodule_91_25_26_0x60_function_15f2a680f0c86a65 ( Context * __context__, _lambda_thismodule_91_25_26 & ____this_rename_at_91, TArray<int32_t> const  & __x_rename_at_91 );
+inline void _Func_lambda_thismodule_91_25_26_0x60_finalizer_17737d2831ca41c6 ( Context * __context__, _lambda_thismodule_91_25_26 * ____this_rename_at_91 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_any_e29162d675421b2b ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_11, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) __blk_rename_at_11 );
+inline void _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07 ( Context * __context__, TArray<int32_t> & __a_rename_at_31, TArray<int32_t> & __b_rename_at_31 );
+inline bool _Func_lambda_thismodule_157_12_19_0x60_function_4cc416e65d0f7490 ( Context * __context__, _lambda_thismodule_157_12_19 & ____this_rename_at_157, int32_t & ___yield_157_rename_at_157 );
+inline void _Func_lambda_thismodule_157_12_19_0x60_finalizer_3f8bbd6bdc9ad954 ( Context * __context__, _lambda_thismodule_157_12_19 * ____this_rename_at_157 );
+inline bool _Func_lambda_thismodule_130_12_20_0x60_function_3df999ebdcd26a1f ( Context * __context__, _lambda_thismodule_130_12_20 & ____this_rename_at_130, int32_t & ___yield_130_rename_at_130 );
+inline void _Func_lambda_thismodule_130_12_20_0x60_finalizer_226fe41329c877cc ( Context * __context__, _lambda_thismodule_130_12_20 * ____this_rename_at_130 );
+inline void finalize_d2bdfafa2f479e21 ( Context * __context__, _lambda_thismodule_71_25_14 & ____this_rename_at_71 );
+inline int32_t _Funcfunctional_0x60_reduce_any_e3cd3f9a12b0fb52 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __it_rename_at_60, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __functor_rename_at_60 );
+inline void finalize_b1fbd3f7f17aa107 ( Context * __context__, _lambda_thismodule_115_27_15 & ____this_rename_at_115 );
+inline void finalize_4e811d32879905fb ( Context * __context__, _lambda_thismodule_163_30_16 & ____this_rename_at_163 );
+inline void finalize_9241f8123a6109c0 ( Context * __context__, _lambda_thismodule_172_30_17 & ____this_rename_at_172 );
+inline void finalize_3da670ae0d0fd49c ( Context * __context__, _lambda_thismodule_180_30_18 & ____this_rename_at_180 );
+inline void _Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_156, int32_t __value_rename_at_156 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Func_0x60_verify_14_c7953d9d52dffeef ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) const  & __t_rename_at_43 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_64323d9de00083a ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_25, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const  __blk_rename_at_25 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_cycle_a78805a0131a894d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_126 );
+inline void finalize_dca9089a796b169e ( Context * __context__, _lambda_thismodule_56_21_10 & ____this_rename_at_56 );
+inline void finalize_3c00f319f5878b9f ( Context * __context__, _lambda_thismodule_90_14_11 & ____this_rename_at_90 );
+inline void finalize_95e8646aced816cb ( Context * __context__, _lambda_thismodule_240_10_12 & ____this_rename_at_240 );
+inline void finalize_5d81d27f4ab6f1ad ( Context * __context__, _lambda_thismodule_243_18_13 & ____this_rename_at_243 );
+inline void _Func_0x60_verify_even_7e6d5ca7b65b79bf ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __arr_rename_at_19 );
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcbuiltin_0x60_each_7f633a072c41b03c ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t>)) const  __lam_rename_at_480 );
+inline TArray<TArray<int32_t>> & _Funcbuiltin_0x60__return_with_lockcheck_39e9c05a08e7d337 ( Context * __context__, TArray<TArray<int32_t>> & __a_rename_at_42 );
+inline bool _Func_lambda_thismodule_71_25_14_0x60_function_4ef28c57d655e61b ( Context * __context__, _lambda_thismodule_71_25_14 & ____this_rename_at_71, int32_t __x_rename_at_71 );
+inline void _Func_lambda_thismodule_71_25_14_0x60_finalizer_1de86f8b7e406fde ( Context * __context__, _lambda_thismodule_71_25_14 * ____this_rename_at_71 );
+inline bool _Funcfunctional_0x60_is_equal_2af44bbc0bb6f328 ( Context * __context__, int32_t __a_rename_at_197, int32_t __b_rename_at_197 );
+inline int32_t _Funcfunctional_0x60_reduce_7c596f6a790683f4 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __it_rename_at_87, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __blk_rename_at_87 );
+inline int32_t _Func_lambda_thismodule_115_27_15_0x60_function_76c593a2d975afd9 ( Context * __context__, _lambda_thismodule_115_27_15 & ____this_rename_at_115, int32_t __x_rename_at_115, int32_t __y_rename_at_115 );
+inline void _Func_lambda_thismodule_115_27_15_0x60_finalizer_b7ae6dadf312675a ( Context * __context__, _lambda_thismodule_115_27_15 * ____this_rename_at_115 );
+inline bool _Func_lambda_thismodule_163_30_16_0x60_function_7c6e7fcacb6ae853 ( Context * __context__, _lambda_thismodule_163_30_16 & ____this_rename_at_163, int32_t __x_rename_at_163 );
+inline void _Func_lambda_thismodule_163_30_16_0x60_finalizer_1efff7382e84e2aa ( Context * __context__, _lambda_thismodule_163_30_16 * ____this_rename_at_163 );
+inline bool _Func_lambda_thismodule_172_30_17_0x60_function_42c5b6ebaac79686 ( Context * __context__, _lambda_thismodule_172_30_17 & ____this_rename_at_172, int32_t __x_rename_at_172 );
+inline void _Func_lambda_thismodule_172_30_17_0x60_finalizer_8ed4bb4bd4545e60 ( Context * __context__, _lambda_thismodule_172_30_17 * ____this_rename_at_172 );
+inline bool _Func_lambda_thismodule_180_30_18_0x60_function_d983c4a30551bc1c ( Context * __context__, _lambda_thismodule_180_30_18 & ____this_rename_at_180, int32_t __x_rename_at_180 );
+inline void _Func_lambda_thismodule_180_30_18_0x60_finalizer_526d77f2b8437988 ( Context * __context__, _lambda_thismodule_180_30_18 * ____this_rename_at_180 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_937a16f0c7f42db ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_505 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_cycle_db50944d1b917eec ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) & __src_rename_at_126 );
+inline void finalize_fbc79084dd3275de ( Context * __context__, _lambda_thismodule_173_8_2 & ____this_rename_at_173 );
+inline void finalize_ea9711ac7e396704 ( Context * __context__, _lambda_thismodule_190_8_3 & ____this_rename_at_190 );
+inline void finalize_50a2b26c59df4fa5 ( Context * __context__, _lambda_thismodule_50_23_4 & ____this_rename_at_50 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_2ae23ac41016a34a ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_11, Func DAS_COMMENT((bool,int32_t)) __blk_rename_at_11 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_f8dac28aa0dd5ec0 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_11, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_11 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_6e0944b71f858323 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_33, Func DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_33 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_c16fd10e29077412 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_33, Lambda DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_33 );
+inline int32_t _Funcfunctional_0x60_reduce_any_e8c9be3d74e2ec87 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_60, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __functor_rename_at_60 );
+inline void finalize_1141d7256c227d21 ( Context * __context__, _lambda_thismodule_106_15_5 & ____this_rename_at_106 );
+inline int32_t _Funcfunctional_0x60_reduce_any_1eddf981a5714858 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_60, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_60 );
+inline int32_t _Funcfunctional_0x60_reduce_any_6430db396ca81d22 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_60, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_60 );
+inline void finalize_18fe4fcb57354a0c ( Context * __context__, _lambda_thismodule_139_28_6 & ____this_rename_at_139 );
+inline void finalize_36a3b02b1fb3dcf7 ( Context * __context__, _lambda_thismodule_227_19_7 & ____this_rename_at_227 );
+inline void finalize_a109dfbebfbc079f ( Context * __context__, _lambda_thismodule_232_10_8 & ____this_rename_at_232 );
+inline void finalize_daf2db5be95cd687 ( Context * __context__, _lambda_thismodule_235_18_9 & ____this_rename_at_235 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_2290b067fc65760f ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_480 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_ref_77eafe8c9006a0 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const  __lam_rename_at_487 );
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> & __a_rename_at_42 );
+inline bool _Func_lambda_thismodule_56_21_10_0x60_function_eaac258aa9c0d84a ( Context * __context__, _lambda_thismodule_56_21_10 & ____this_rename_at_56, TArray<int32_t> & ___yield_56_rename_at_56 );
+inline void _Func_lambda_thismodule_56_21_10_0x60_finalizer_6390258da803cc74 ( Context * __context__, _lambda_thismodule_56_21_10 * ____this_rename_at_56 );
+inline void _Funcbuiltin_0x60_emplace_46aeb6a61c4e9221 ( Context * __context__, TArray<TArray<int32_t>> & __Arr_rename_at_120, TArray<int32_t> & __value_rename_at_120 );
+inline void _Func_0x60_verify_14_ad9c7b801e624df0 ( Context * __context__, TArray<TArray<int32_t>> const  & __t_rename_at_43 );
+inline bool _Func_lambda_thismodule_90_14_11_0x60_function_7c8af860540bcf86 ( Context * __context__, _lambda_thismodule_90_14_11 & ____this_rename_at_90, TArray<int32_t> & ___yield_90_rename_at_90 );
+inline void _Func_lambda_thismodule_90_14_11_0x60_finalizer_398faab869104a98 ( Context * __context__, _lambda_thismodule_90_14_11 * ____this_rename_at_90 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcbuiltin_0x60_each_5b8f7b8f8a92acc2 ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const  __lam_rename_at_480 );
+inline bool _Func_lambda_thismodule_240_10_12_0x60_function_4e2050b2cd3a10f7 ( Context * __context__, _lambda_thismodule_240_10_12 & ____this_rename_at_240, TArray<int32_t> & ___yield_240_rename_at_240 );
+inline void _Func_lambda_thismodule_240_10_12_0x60_finalizer_722f889b1020677c ( Context * __context__, _lambda_thismodule_240_10_12 * ____this_rename_at_240 );
+inline bool _Func_lambda_thismodule_243_18_13_0x60_function_8457e9c7a37377d ( Context * __context__, _lambda_thismodule_243_18_13 & ____this_rename_at_243, TArray<int32_t> & ___yield_243_rename_at_243 );
+inline void _Func_lambda_thismodule_243_18_13_0x60_finalizer_5c6dfa59ff707404 ( Context * __context__, _lambda_thismodule_243_18_13 * ____this_rename_at_243 );
+inline void finalize_2e9b369ff6b06689 ( Context * __context__, _lambda_thismodule_85_28_1 & ____this_rename_at_85 );
+inline bool _Func_lambda_thismodule_173_8_2_0x60_function_a2d0530164e71c37 ( Context * __context__, _lambda_thismodule_173_8_2 & ____this_rename_at_173, int32_t & __result_rename_at_172 );
+inline void _Func_lambda_thismodule_173_8_2_0x60_finalizer_4907142523166368 ( Context * __context__, _lambda_thismodule_173_8_2 * ____this_rename_at_173 );
+inline bool _Func_lambda_thismodule_190_8_3_0x60_function_20eecf34434e56ab ( Context * __context__, _lambda_thismodule_190_8_3 & ____this_rename_at_190, int32_t & ___yield_190_rename_at_190 );
+inline void _Func_lambda_thismodule_190_8_3_0x60_finalizer_d00fbd4aff2c7106 ( Context * __context__, _lambda_thismodule_190_8_3 * ____this_rename_at_190 );
+inline bool _Func_lambda_thismodule_50_23_4_0x60_function_acc8ccfc59a727e8 ( Context * __context__, _lambda_thismodule_50_23_4 & ____this_rename_at_50, int32_t const  * & ___ryield50_rename_at_50 );
+inline void _Func_lambda_thismodule_50_23_4_0x60_finalizer_d48a0c4dc1dec02c ( Context * __context__, _lambda_thismodule_50_23_4 * ____this_rename_at_50 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline void _Func_0x60_verify_even_6703252febc142e7 ( Context * __context__, TArray<int32_t> const  & __arr_rename_at_19 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_196d50d6a5b657be ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_30, Func DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_30 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_53efa21008623dcb ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_25, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_25 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_a60435d0c6456bd4 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_56, Func DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_56 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_58dc263556f6d651 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_51, Lambda DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_51 );
+inline int32_t _Funcfunctional_0x60_reduce_417083d1002ee3c4 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_87, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __blk_rename_at_87 );
+inline bool _Func_lambda_thismodule_106_15_5_0x60_function_4edb7cf4dd0af38f ( Context * __context__, _lambda_thismodule_106_15_5 & ____this_rename_at_106, int32_t const  * & ___ryield106_rename_at_106 );
+inline void _Func_lambda_thismodule_106_15_5_0x60_finalizer_b87dcc28f4b26ad4 ( Context * __context__, _lambda_thismodule_106_15_5 * ____this_rename_at_106 );
+inline int32_t _Funcfunctional_0x60_reduce_8fbeb127951de7b8 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_75, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_75 );
+inline int32_t _Funcfunctional_0x60_reduce_c78f959eee6d541d ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_82, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_82 );
+inline TTuple<8,int32_t,float> _Func_lambda_thismodule_139_28_6_0x60_function_ecdee715a1fae593 ( Context * __context__, _lambda_thismodule_139_28_6 & ____this_rename_at_139, int32_t __x_rename_at_139 );
+inline void _Func_lambda_thismodule_139_28_6_0x60_finalizer_b747e97a7829fa46 ( Context * __context__, _lambda_thismodule_139_28_6 * ____this_rename_at_139 );
+inline int32_t _Funcfunctional_0x60_sum_c6bb83657fd0ca16 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_92 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_islice_b171313d5fbcf9e0 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_153, int32_t __start_rename_at_153, int32_t __stop_rename_at_153 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_cycle_ccb8645ee9ac4b14 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_126 );
+inline bool _Func_lambda_thismodule_227_19_7_0x60_function_1cec87bec4f6e7e1 ( Context * __context__, _lambda_thismodule_227_19_7 & ____this_rename_at_227, int32_t & ___yield_227_rename_at_227 );
+inline void _Func_lambda_thismodule_227_19_7_0x60_finalizer_f6e0cad214e51598 ( Context * __context__, _lambda_thismodule_227_19_7 * ____this_rename_at_227 );
+inline bool _Func_lambda_thismodule_232_10_8_0x60_function_1b9e5aecd83626ed ( Context * __context__, _lambda_thismodule_232_10_8 & ____this_rename_at_232, TTuple<8,int32_t,float> & ___yield_232_rename_at_232 );
+inline void _Func_lambda_thismodule_232_10_8_0x60_finalizer_f0c678795587145c ( Context * __context__, _lambda_thismodule_232_10_8 * ____this_rename_at_232 );
+inline bool _Func_lambda_thismodule_235_18_9_0x60_function_87eca29eb8b63ff ( Context * __context__, _lambda_thismodule_235_18_9 & ____this_rename_at_235, TTuple<8,int32_t,float> & ___yield_235_rename_at_235 );
+inline void _Func_lambda_thismodule_235_18_9_0x60_finalizer_f01773fb180129d8 ( Context * __context__, _lambda_thismodule_235_18_9 * ____this_rename_at_235 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_8095aad6f5b96480 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_518 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_451 );
+inline int32_t _Func_lambda_thismodule_85_28_1_0x60_function_bddb2af26f5dab07 ( Context * __context__, _lambda_thismodule_85_28_1 & ____this_rename_at_85, int32_t __x_rename_at_85 );
+inline void _Func_lambda_thismodule_85_28_1_0x60_finalizer_3dc36ce0a81f940e ( Context * __context__, _lambda_thismodule_85_28_1 * ____this_rename_at_85 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48 ( Context * __context__, TDim<int32_t,3> & __a_rename_at_518 );
+inline bool _Funcfunctional_0x60_any_a5606ed295f053c9 ( Context * __context__, TDim<bool,2> const  & __it_rename_at_102 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_count_7119d72d72fe3e50 ( Context * __context__, int32_t __start_rename_at_170, int32_t __step_rename_at_170 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_repeat_a8c2dce35f26e7e0 ( Context * __context__, int32_t __value_rename_at_187, int32_t __count_rename_at_187 );
+inline bool is_even_9f92407af8b51b2c ( Context * __context__, int32_t __x_rename_at_9 );
+inline int32_t twice_aa4c716c97740337 ( Context * __context__, int32_t __x_rename_at_12 );
+inline int32_t add_8997dbbc2c7fa6aa ( Context * __context__, int32_t __a_rename_at_15, int32_t __b_rename_at_15 );
+inline bool _FuncExclEqu_d496bfa20e8277a0 ( Context * __context__, TTuple<8,int32_t,float> const  & __a_rename_at_26, TTuple<8,int32_t,float> const  & __b_rename_at_26 );
+inline bool _FuncExclEqu_46b76804d5e31c7b ( Context * __context__, TArray<int32_t> const  & __a_rename_at_29, TArray<int32_t> const  & __b_rename_at_29 );
+inline bool test_84d7773f38040831 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_54bf1348c9b80490 ( Context * __context__, _lambda_thismodule_36_12_36 &  ____this_rename_at_36 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_36._source_0_at_36),__context__);
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_36.w));
+	memset(&(____this_rename_at_36), 0, 88);
+}
+
+inline bool _Func_lambda_thismodule_36_12_36_0x60_function_f70e75692c84d121 ( Context * __context__, _lambda_thismodule_36_12_36 &  ____this_rename_at_36, int32_t & ___yield_36_rename_at_36 )
+{
+	switch (____this_rename_at_36.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_36._loop_at_36,true);
+	das_move(____this_rename_at_36._source_0_at_36,____this_rename_at_36.src);
+	memset(&(____this_rename_at_36.w), 0, 24);
+	das_copy(____this_rename_at_36._pvar_0_at_36,das_ref(__context__,____this_rename_at_36.w));
+	DAS_SETBOOLAND((____this_rename_at_36._loop_at_36),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_36._source_0_at_36),____this_rename_at_36._pvar_0_at_36,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_36._loop_at_36 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_36_rename_at_36,das_invoke_lambda<int32_t>::invoke<TArray<int32_t> &>(__context__,nullptr,____this_rename_at_36.blk,das_arg<TArray<int32_t>>::pass(____this_rename_at_36.w)));
+	das_copy(____this_rename_at_36.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_36._loop_at_36),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_36._source_0_at_36),____this_rename_at_36._pvar_0_at_36,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_36._source_0_at_36),____this_rename_at_36._pvar_0_at_36,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_36_12_36_0x60_finalizer_16d59ce0493ea764 ( Context * __context__, _lambda_thismodule_36_12_36 * ____this_rename_at_36 )
+{
+	finalize_54bf1348c9b80490(__context__,das_arg<_lambda_thismodule_36_12_36>::pass(das_deref(__context__,____this_rename_at_36)));
+	das_delete_lambda_struct<_lambda_thismodule_36_12_36 *>::clear(__context__,____this_rename_at_36);
+}
+
+inline void finalize_a7122cc19257df9a ( Context * __context__, _lambda_thismodule_93_29_35 &  ____this_rename_at_93 )
+{
+	memset(&(____this_rename_at_93), 0, 16);
+}
+
+inline int32_t _Func_lambda_thismodule_93_29_35_0x60_function_9952822083039823 ( Context * __context__, _lambda_thismodule_93_29_35 &  ____this_rename_at_93, TArray<int32_t> const  &  __x_rename_at_93 )
+{
+	return das_auto_cast<int32_t>::cast(__x_rename_at_93(0,__context__));
+}
+
+inline void _Func_lambda_thismodule_93_29_35_0x60_finalizer_77b7ae3fdea0e0ca ( Context * __context__, _lambda_thismodule_93_29_35 * ____this_rename_at_93 )
+{
+	finalize_a7122cc19257df9a(__context__,das_arg<_lambda_thismodule_93_29_35>::pass(das_deref(__context__,____this_rename_at_93)));
+	das_delete_lambda_struct<_lambda_thismodule_93_29_35 *>::clear(__context__,____this_rename_at_93);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_9262de0c50f54bad ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_33, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) __blk_rename_at_33 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_36_12_36>::make(__context__,&__type_info__1ea30300aeed91a9,(([&]() -> _lambda_thismodule_36_12_36 {
+		_lambda_thismodule_36_12_36 __mks_35;
+		das_zero(__mks_35);
+		das_copy((__mks_35.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_36_12_36`function XS<::_lambda_thismodule_36_12_36> &i*/ 10776621176099257213u))));
+		das_copy((__mks_35.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_36_12_36`finalizer X1<S<::_lambda_thismodule_36_12_36>>?*/ 5055891003615444022u))));
+		das_move((__mks_35.blk),(__blk_rename_at_33));
+		das_move((__mks_35.src),(__src_rename_at_33));
+		return __mks_35;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_82ad2f6322b2be3d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_51, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const  __blk_rename_at_51 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_map_any_9262de0c50f54bad(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__src_rename_at_51),__blk_rename_at_51));
+}
+
+inline void finalize_c6c82fde31fdb2e6 ( Context * __context__, _lambda_thismodule_41_12_34 &  ____this_rename_at_41 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_41._source_0_at_41),__context__);
+	memset(&(____this_rename_at_41), 0, 72);
+}
+
+inline bool _Func_lambda_thismodule_41_12_34_0x60_function_fbe3de92257c0070 ( Context * __context__, _lambda_thismodule_41_12_34 &  ____this_rename_at_41, TArray<int32_t> &  ___yield_41_rename_at_41 )
+{
+	switch (____this_rename_at_41.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_41._loop_at_41,true);
+	das_move(____this_rename_at_41._source_0_at_41,____this_rename_at_41.src);
+	memset(&(____this_rename_at_41.w), 0, 8);
+	das_copy(____this_rename_at_41._pvar_0_at_41,das_ref(__context__,____this_rename_at_41.w));
+	DAS_SETBOOLAND((____this_rename_at_41._loop_at_41),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_41._source_0_at_41),____this_rename_at_41._pvar_0_at_41,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_41._loop_at_41 )
+	{
+		goto label_4;
+	};
+	_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07(__context__,das_arg<TArray<int32_t>>::pass(___yield_41_rename_at_41),das_arg<TArray<int32_t>>::pass(das_invoke_lambda<TArray<int32_t>>::invoke_cmres<TArray<int32_t> &>(__context__,nullptr,____this_rename_at_41.blk,das_arg<TArray<int32_t>>::pass(das_deref(__context__,____this_rename_at_41.w)))));
+	das_copy(____this_rename_at_41.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_41._loop_at_41),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_41._source_0_at_41),____this_rename_at_41._pvar_0_at_41,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_41._source_0_at_41),____this_rename_at_41._pvar_0_at_41,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_41_12_34_0x60_finalizer_7303256f4aeb3774 ( Context * __context__, _lambda_thismodule_41_12_34 * ____this_rename_at_41 )
+{
+	finalize_c6c82fde31fdb2e6(__context__,das_arg<_lambda_thismodule_41_12_34>::pass(das_deref(__context__,____this_rename_at_41)));
+	das_delete_lambda_struct<_lambda_thismodule_41_12_34 *>::clear(__context__,____this_rename_at_41);
+}
+
+inline bool _Func_0x60_is_same_b2ee21551accec13 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) const  &  __a_rename_at_37, Sequence DAS_COMMENT((TArray<int32_t>)) const  &  __b_rename_at_37 )
+{
+	{
+		bool __need_loop_38 = true;
+		// x : array<int> const&
+		das_iterator<Sequence DAS_COMMENT((TArray<int32_t>)) const > __x_iterator(__a_rename_at_37);
+		TArray<int32_t> const  * __x_rename_at_38;
+		__need_loop_38 = __x_iterator.first(__context__,(__x_rename_at_38)) && __need_loop_38;
+		// y : array<int> const
+		das_iterator<Sequence DAS_COMMENT((TArray<int32_t>)) const > __y_iterator(__b_rename_at_37);
+		TArray<int32_t> const  __y_rename_at_38;
+		__need_loop_38 = __y_iterator.first(__context__,(__y_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __x_iterator.next(__context__,(__x_rename_at_38)) && __y_iterator.next(__context__,(__y_rename_at_38)) )
+		{
+			if ( _FuncExclEqu_46b76804d5e31c7b(__context__,(*__x_rename_at_38),__y_rename_at_38) )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_38));
+		__y_iterator.close(__context__,(__y_rename_at_38));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void finalize_fae068741c4996d9 ( Context * __context__, _lambda_thismodule_163_12_33 &  ____this_rename_at_163 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_163._source_0_at_163),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_163._source_1_at_163),__context__);
+	memset(&(____this_rename_at_163), 0, 96);
+}
+
+inline bool _Func_0x60_is_same_84e5a5cb0f2aec39 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) const  &  __a_rename_at_37, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  __b_rename_at_37 )
+{
+	{
+		bool __need_loop_38 = true;
+		// x : tuple<int;float> const&
+		das_iterator<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const > __x_iterator(__a_rename_at_37);
+		TTuple<8,int32_t,float> const  * __x_rename_at_38;
+		__need_loop_38 = __x_iterator.first(__context__,(__x_rename_at_38)) && __need_loop_38;
+		// y : tuple<int;float> const
+		das_iterator<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const > __y_iterator(__b_rename_at_37);
+		TTuple<8,int32_t,float> const  __y_rename_at_38;
+		__need_loop_38 = __y_iterator.first(__context__,(__y_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __x_iterator.next(__context__,(__x_rename_at_38)) && __y_iterator.next(__context__,(__y_rename_at_38)) )
+		{
+			if ( _FuncExclEqu_d496bfa20e8277a0(__context__,(*__x_rename_at_38),__y_rename_at_38) )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_38));
+		__y_iterator.close(__context__,(__y_rename_at_38));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void finalize_b0bb974ccdd5181b ( Context * __context__, _lambda_thismodule_163_12_31 &  ____this_rename_at_163 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_163._source_0_at_163),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_163._source_1_at_163),__context__);
+	memset(&(____this_rename_at_163), 0, 96);
+}
+
+inline void finalize_3f3f5513ea66b214 ( Context * __context__, _lambda_thismodule_92_36_32 &  ____this_rename_at_92 )
+{
+	memset(&(____this_rename_at_92), 0, 16);
+}
+
+inline bool _Func_lambda_thismodule_163_12_33_0x60_function_f8080823c69e3cdd ( Context * __context__, _lambda_thismodule_163_12_33 &  ____this_rename_at_163, TArray<int32_t> * & ___ryield163_rename_at_163 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_163_32;
+	switch (____this_rename_at_163.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_163._loop_at_163,true);
+	das_move(____this_rename_at_163._source_0_at_163,____this_rename_at_163.src);
+	memset(&(____this_rename_at_163.x), 0, 8);
+	das_copy(____this_rename_at_163._pvar_0_at_163,das_ref(__context__,____this_rename_at_163.x));
+	DAS_SETBOOLAND((____this_rename_at_163._loop_at_163),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_163._source_0_at_163),____this_rename_at_163._pvar_0_at_163,__context__)));
+	das_move(____this_rename_at_163._source_1_at_163,(_temp_make_local_163_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(____this_rename_at_163.stop)))));
+	memset(&(____this_rename_at_163.i), 0, 4);
+	das_copy(____this_rename_at_163._pvar_1_at_163,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_163.i)));
+	DAS_SETBOOLAND((____this_rename_at_163._loop_at_163),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_163._source_1_at_163),____this_rename_at_163._pvar_1_at_163,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_163._loop_at_163 )
+	{
+		goto label_5;
+	};
+	if ( !(____this_rename_at_163.i >= ____this_rename_at_163.start) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield163_rename_at_163,das_ref(__context__,das_deref(__context__,____this_rename_at_163.x)));
+	das_copy(____this_rename_at_163.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_163._loop_at_163),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_163._source_0_at_163),____this_rename_at_163._pvar_0_at_163,__context__)));
+	DAS_SETBOOLAND((____this_rename_at_163._loop_at_163),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_163._source_1_at_163),____this_rename_at_163._pvar_1_at_163,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_163._source_0_at_163),____this_rename_at_163._pvar_0_at_163,__context__);
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_163._source_1_at_163),____this_rename_at_163._pvar_1_at_163,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_163_12_33_0x60_finalizer_965919f06d889a76 ( Context * __context__, _lambda_thismodule_163_12_33 * ____this_rename_at_163 )
+{
+	finalize_fae068741c4996d9(__context__,das_arg<_lambda_thismodule_163_12_33>::pass(das_deref(__context__,____this_rename_at_163)));
+	das_delete_lambda_struct<_lambda_thismodule_163_12_33 *>::clear(__context__,____this_rename_at_163);
+}
+
+inline void _Funcbuiltin_0x60_finalize_ca527b18279269a0 ( Context * __context__, TArray<TArray<int32_t>> &  __a_rename_at_399 )
+{
+	{
+		bool __need_loop_401 = true;
+		// aV : array<int> aka TT&
+		das_iterator<TArray<TArray<int32_t>>> __aV_iterator(__a_rename_at_399);
+		TArray<int32_t> * __aV_rename_at_401;
+		__need_loop_401 = __aV_iterator.first(__context__,(__aV_rename_at_401)) && __need_loop_401;
+		for ( ; __need_loop_401 ; __need_loop_401 = __aV_iterator.next(__context__,(__aV_rename_at_401)) )
+		{
+			_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass((*__aV_rename_at_401)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_401));
+	};
+	builtin_array_free(das_arg<TArray<TArray<int32_t>>>::pass(__a_rename_at_399),24,__context__);
+}
+
+inline bool _Func_lambda_thismodule_163_12_31_0x60_function_748a5459db8fb549 ( Context * __context__, _lambda_thismodule_163_12_31 &  ____this_rename_at_163, TTuple<8,int32_t,float> * & ___ryield163_rename_at_163 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_163_32;
+	switch (____this_rename_at_163.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_163._loop_at_163,true);
+	das_move(____this_rename_at_163._source_0_at_163,____this_rename_at_163.src);
+	memset(&(____this_rename_at_163.x), 0, 8);
+	das_copy(____this_rename_at_163._pvar_0_at_163,das_ref(__context__,____this_rename_at_163.x));
+	DAS_SETBOOLAND((____this_rename_at_163._loop_at_163),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_163._source_0_at_163),____this_rename_at_163._pvar_0_at_163,__context__)));
+	das_move(____this_rename_at_163._source_1_at_163,(_temp_make_local_163_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(____this_rename_at_163.stop)))));
+	memset(&(____this_rename_at_163.i), 0, 4);
+	das_copy(____this_rename_at_163._pvar_1_at_163,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_163.i)));
+	DAS_SETBOOLAND((____this_rename_at_163._loop_at_163),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_163._source_1_at_163),____this_rename_at_163._pvar_1_at_163,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_163._loop_at_163 )
+	{
+		goto label_5;
+	};
+	if ( !(____this_rename_at_163.i >= ____this_rename_at_163.start) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield163_rename_at_163,das_ref(__context__,das_deref(__context__,____this_rename_at_163.x)));
+	das_copy(____this_rename_at_163.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_163._loop_at_163),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_163._source_0_at_163),____this_rename_at_163._pvar_0_at_163,__context__)));
+	DAS_SETBOOLAND((____this_rename_at_163._loop_at_163),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_163._source_1_at_163),____this_rename_at_163._pvar_1_at_163,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_163._source_0_at_163),____this_rename_at_163._pvar_0_at_163,__context__);
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_163._source_1_at_163),____this_rename_at_163._pvar_1_at_163,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_163_12_31_0x60_finalizer_5625720652b77ce2 ( Context * __context__, _lambda_thismodule_163_12_31 * ____this_rename_at_163 )
+{
+	finalize_b0bb974ccdd5181b(__context__,das_arg<_lambda_thismodule_163_12_31>::pass(das_deref(__context__,____this_rename_at_163)));
+	das_delete_lambda_struct<_lambda_thismodule_163_12_31 *>::clear(__context__,____this_rename_at_163);
+}
+
+inline void _Funcbuiltin_0x60_finalize_943699eaf2940908 ( Context * __context__, TArray<TTuple<8,int32_t,float>> &  __a_rename_at_399 )
+{
+	{
+		bool __need_loop_401 = true;
+		// aV : tuple<int;float> aka TT&
+		das_iterator<TArray<TTuple<8,int32_t,float>>> __aV_iterator(__a_rename_at_399);
+		TTuple<8,int32_t,float> * __aV_rename_at_401;
+		__need_loop_401 = __aV_iterator.first(__context__,(__aV_rename_at_401)) && __need_loop_401;
+		for ( ; __need_loop_401 ; __need_loop_401 = __aV_iterator.next(__context__,(__aV_rename_at_401)) )
+		{
+			finalize_554c45dda146b8a6(__context__,das_arg<TTuple<8,int32_t,float>>::pass((*__aV_rename_at_401)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_401));
+	};
+	builtin_array_free(das_arg<TArray<TTuple<8,int32_t,float>>>::pass(__a_rename_at_399),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> &  __a_rename_at_338, TArray<int32_t> const  &  __b_rename_at_338 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_338),builtin_array_size(__b_rename_at_338));
+	{
+		bool __need_loop_340 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_338);
+		int32_t * __aV_rename_at_340;
+		__need_loop_340 = __aV_iterator.first(__context__,(__aV_rename_at_340)) && __need_loop_340;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_338);
+		int32_t const  * __bV_rename_at_340;
+		__need_loop_340 = __bV_iterator.first(__context__,(__bV_rename_at_340)) && __need_loop_340;
+		for ( ; __need_loop_340 ; __need_loop_340 = __aV_iterator.next(__context__,(__aV_rename_at_340)) && __bV_iterator.next(__context__,(__bV_rename_at_340)) )
+		{
+			das_copy((*__aV_rename_at_340),(*__bV_rename_at_340));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_340));
+		__bV_iterator.close(__context__,(__bV_rename_at_340));
+	};
+}
+
+inline TArray<int32_t> _Func_lambda_thismodule_92_36_32_0x60_function_cc78477825a25340 ( Context * __context__, _lambda_thismodule_92_36_32 &  ____this_rename_at_92, TArray<int32_t> const  &  __x_rename_at_92 )
+{
+	TArray<int32_t> _temp_make_local_92_32;
+	TDim<int32_t,3> _temp_make_local_92_64;
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_92_32 = (_Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+		_temp_make_local_92_64(0,__context__) = __x_rename_at_92(0,__context__);
+		_temp_make_local_92_64(1,__context__) = __x_rename_at_92(0,__context__);
+		_temp_make_local_92_64(2,__context__) = __x_rename_at_92(0,__context__);
+		return _temp_make_local_92_64;
+	})()))))))));
+}
+
+inline void _Func_lambda_thismodule_92_36_32_0x60_finalizer_cc7541e2ca708852 ( Context * __context__, _lambda_thismodule_92_36_32 * ____this_rename_at_92 )
+{
+	finalize_3f3f5513ea66b214(__context__,das_arg<_lambda_thismodule_92_36_32>::pass(das_deref(__context__,____this_rename_at_92)));
+	das_delete_lambda_struct<_lambda_thismodule_92_36_32 *>::clear(__context__,____this_rename_at_92);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_any_17b6b876d76660ef ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __src_rename_at_33, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) __blk_rename_at_33 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t>))>::cast(_Funcbuiltin_0x60_each_7f633a072c41b03c(__context__,das_ascend<bool,_lambda_thismodule_41_12_34>::make(__context__,&__type_info__1377ef38c945836d,(([&]() -> _lambda_thismodule_41_12_34 {
+		_lambda_thismodule_41_12_34 __mks_40;
+		das_zero(__mks_40);
+		das_copy((__mks_40.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_41_12_34`function XS<::_lambda_thismodule_41_12_34> 1<i>A*/ 522834722955066189u))));
+		das_copy((__mks_40.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_41_12_34`finalizer X1<S<::_lambda_thismodule_41_12_34>>?*/ 3336299365475469794u))));
+		das_move((__mks_40.blk),(__blk_rename_at_33));
+		das_move((__mks_40.src),(__src_rename_at_33));
+		return __mks_40;
+	})()))));
+}
+
+inline void finalize_554c45dda146b8a6 ( Context * __context__, TTuple<8,int32_t,float> &  ____this_rename_at_143 )
+{
+	memset(&(____this_rename_at_143), 0, 8);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_e5c085c7199596c7 ( Context * __context__, TArray<TArray<int32_t>> const  &  __a_rename_at_475 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t> *)) __it_rename_at_476; das_zero(__it_rename_at_476);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__it_rename_at_476),__a_rename_at_475,24,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(__it_rename_at_476);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_399 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_399),4,__context__);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_cb33d88d14d2480d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __src_rename_at_51, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const  __blk_rename_at_51 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t>))>::cast(_Funcfunctional_0x60_map_any_17b6b876d76660ef(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__src_rename_at_51),__blk_rename_at_51));
+}
+
+inline int32_t _Func_0x60_first_7932efd700c6a809 ( Context * __context__, TTuple<8,int32_t,float> const  &  __x_rename_at_23 )
+{
+	return das_auto_cast<int32_t>::cast(das_get_tuple_field<int32_t,0>::get(__x_rename_at_23));
+}
+
+inline void finalize_f88f9c056c2aa22b ( Context * __context__, _lambda_thismodule_20_12_30 &  ____this_rename_at_20 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_20._source_0_at_20),__context__);
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_20.w));
+	memset(&(____this_rename_at_20), 0, 88);
+}
+
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_any_7bf095d1cee7b6d8 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  __it_rename_at_60, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  __functor_rename_at_60 )
+{
+	TTuple<8,int32_t,float> __left_rename_at_61; das_zero(__left_rename_at_61);
+	bool __first_rename_at_62 = true;
+	{
+		bool __need_loop_63 = true;
+		// right : tuple<int;float> aka TT const
+		das_iterator<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const > __right_iterator(__it_rename_at_60);
+		TTuple<8,int32_t,float> const  __right_rename_at_63;
+		__need_loop_63 = __right_iterator.first(__context__,(__right_rename_at_63)) && __need_loop_63;
+		for ( ; __need_loop_63 ; __need_loop_63 = __right_iterator.next(__context__,(__right_rename_at_63)) )
+		{
+			if ( __first_rename_at_62 )
+			{
+				das_copy(__first_rename_at_62,false);
+				das_copy(__left_rename_at_61,__right_rename_at_63);
+			} else {
+				das_copy(__left_rename_at_61,das_invoke<TTuple<8,int32_t,float> const >::invoke_cmres<TTuple<8,int32_t,float> &,TTuple<8,int32_t,float> const  &>(__context__,nullptr,__functor_rename_at_60,das_arg<TTuple<8,int32_t,float>>::pass(__left_rename_at_61),__right_rename_at_63));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_63));
+	};
+	if ( __first_rename_at_62 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return das_auto_cast_ref<TTuple<8,int32_t,float>>::cast(__left_rename_at_61);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_6a927dd59cc9e5af ( Context * __context__, TArray<TTuple<8,int32_t,float>> const  &  __a_rename_at_475 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) __it_rename_at_476; das_zero(__it_rename_at_476);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_476),__a_rename_at_475,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(__it_rename_at_476);
+}
+
+inline bool _Funcfunctional_0x60_not_4c37d11112acdd2e ( Context * __context__, bool __x_rename_at_205 )
+{
+	return das_auto_cast<bool>::cast(!__x_rename_at_205);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_islice_51a3045a357b5024 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __src_rename_at_153, int32_t __start_rename_at_153, int32_t __stop_rename_at_153 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_Funcbuiltin_0x60_each_ref_ab33c386e8c5b2f6(__context__,das_ascend<bool,_lambda_thismodule_163_12_33>::make(__context__,&__type_info__c64ef0f336da093b,(([&]() -> _lambda_thismodule_163_12_33 {
+		_lambda_thismodule_163_12_33 __mks_162;
+		das_zero(__mks_162);
+		das_copy((__mks_162.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_163_12_33`function XS<::_lambda_thismodule_163_12_33> &1<1<i>A>?*/ 3187304740748007579u))));
+		das_copy((__mks_162.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_163_12_33`finalizer X1<S<::_lambda_thismodule_163_12_33>>?*/ 6816838826323955772u))));
+		das_move((__mks_162.src),(__src_rename_at_153));
+		das_copy((__mks_162.start),(__start_rename_at_153));
+		das_copy((__mks_162.stop),(__stop_rename_at_153));
+		return __mks_162;
+	})()))));
+}
+
+inline void finalize_fd89e81470ac2037 ( Context * __context__, _lambda_thismodule_142_12_29 &  ____this_rename_at_142 )
+{
+	_Funcbuiltin_0x60_finalize_ca527b18279269a0(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____this_rename_at_142.arr));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_142._source_0_at_143),__context__);
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_142.x));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_142.___source_0_at_147_rename_at_147),__context__);
+	memset(&(____this_rename_at_142), 0, 136);
+}
+
+inline bool _Func_lambda_thismodule_20_12_30_0x60_function_2a3c166be85a47a1 ( Context * __context__, _lambda_thismodule_20_12_30 &  ____this_rename_at_20, TArray<int32_t> * & ___ryield20_rename_at_20 )
+{
+	switch (____this_rename_at_20.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_20._loop_at_20,true);
+	das_move(____this_rename_at_20._source_0_at_20,____this_rename_at_20.src);
+	memset(&(____this_rename_at_20.w), 0, 24);
+	das_copy(____this_rename_at_20._pvar_0_at_20,das_ref(__context__,____this_rename_at_20.w));
+	DAS_SETBOOLAND((____this_rename_at_20._loop_at_20),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_20._source_0_at_20),____this_rename_at_20._pvar_0_at_20,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_20._loop_at_20 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_lambda<bool>::invoke<TArray<int32_t> &>(__context__,nullptr,____this_rename_at_20.blk,das_arg<TArray<int32_t>>::pass(____this_rename_at_20.w)) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield20_rename_at_20,das_ref(__context__,____this_rename_at_20.w));
+	das_copy(____this_rename_at_20.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_20._loop_at_20),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_20._source_0_at_20),____this_rename_at_20._pvar_0_at_20,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_20._source_0_at_20),____this_rename_at_20._pvar_0_at_20,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_20_12_30_0x60_finalizer_9ebeff833b3b3714 ( Context * __context__, _lambda_thismodule_20_12_30 * ____this_rename_at_20 )
+{
+	finalize_f88f9c056c2aa22b(__context__,das_arg<_lambda_thismodule_20_12_30>::pass(das_deref(__context__,____this_rename_at_20)));
+	das_delete_lambda_struct<_lambda_thismodule_20_12_30 *>::clear(__context__,____this_rename_at_20);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_ref_ab33c386e8c5b2f6 ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const  __lam_rename_at_487 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t> *)) __it_rename_at_488; das_zero(__it_rename_at_488);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__it_rename_at_488),__lam_rename_at_487,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(__it_rename_at_488);
+}
+
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_8ae7fcb7e421f194 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  __it_rename_at_87, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  __blk_rename_at_87 )
+{
+	return das_auto_cast_ref<TTuple<8,int32_t,float>>::cast(_Funcfunctional_0x60_reduce_any_7bf095d1cee7b6d8(__context__,__it_rename_at_87,__blk_rename_at_87));
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_islice_ed9efbf4e50742f0 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) &  __src_rename_at_153, int32_t __start_rename_at_153, int32_t __stop_rename_at_153 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(_Funcbuiltin_0x60_each_ref_dd86c289804be67a(__context__,das_ascend<bool,_lambda_thismodule_163_12_31>::make(__context__,&__type_info__c655f0f336e027e9,(([&]() -> _lambda_thismodule_163_12_31 {
+		_lambda_thismodule_163_12_31 __mks_162;
+		das_zero(__mks_162);
+		das_copy((__mks_162.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_163_12_31`function XS<::_lambda_thismodule_163_12_31> &1<0<i;f>U>?*/ 6139916754660741217u))));
+		das_copy((__mks_162.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_163_12_31`finalizer X1<S<::_lambda_thismodule_163_12_31>>?*/ 3994935723320188900u))));
+		das_move((__mks_162.src),(__src_rename_at_153));
+		das_copy((__mks_162.start),(__start_rename_at_153));
+		das_copy((__mks_162.stop),(__stop_rename_at_153));
+		return __mks_162;
+	})()))));
+}
+
+inline void finalize_688b941ccc3b70f0 ( Context * __context__, _lambda_thismodule_142_12_28 &  ____this_rename_at_142 )
+{
+	_Funcbuiltin_0x60_finalize_943699eaf2940908(__context__,das_arg<TArray<TTuple<8,int32_t,float>>>::pass(____this_rename_at_142.arr));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_142._source_0_at_143),__context__);
+	finalize_554c45dda146b8a6(__context__,das_arg<TTuple<8,int32_t,float>>::pass(____this_rename_at_142.x));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_142.___source_0_at_147_rename_at_147),__context__);
+	memset(&(____this_rename_at_142), 0, 120);
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_a87e3fc9767b4917 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_475 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_476; das_zero(__it_rename_at_476);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_476),__a_rename_at_475,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t &))>::cast(__it_rename_at_476);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_17e595ccf2ea82f6 ( Context * __context__, TArray<TArray<int32_t>> &  __Arr_rename_at_156, TArray<int32_t> const  &  __value_rename_at_156 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<TArray<int32_t>> &>::from(__Arr_rename_at_156)));
+	_Funcbuiltin_0x60_clone_7775f70b42a34990(__context__,das_arg<TArray<int32_t>>::pass(__Arr_rename_at_156(builtin_array_push_back_zero(das_arg<TArray<TArray<int32_t>>>::pass(__Arr_rename_at_156),24,__context__),__context__)),__value_rename_at_156);
+}
+
+inline bool _Func_lambda_thismodule_142_12_29_0x60_function_4ac001e1c9c805bd ( Context * __context__, _lambda_thismodule_142_12_29 &  ____this_rename_at_142, TArray<int32_t> * & ___ryield142_rename_at_142 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_147_32;
+	switch (____this_rename_at_142.__yield) {
+	case 0: goto label_0;
+	case 8: goto label_8;
+	case 7: goto label_7;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	memset(&(____this_rename_at_142.arr), 0, 24);
+	das_copy(____this_rename_at_142._loop_at_143,true);
+	das_move(____this_rename_at_142._source_0_at_143,____this_rename_at_142.src);
+	memset(&(____this_rename_at_142.x), 0, 24);
+	das_copy(____this_rename_at_142._pvar_0_at_143,das_ref(__context__,____this_rename_at_142.x));
+	DAS_SETBOOLAND((____this_rename_at_142._loop_at_143),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_142._source_0_at_143),____this_rename_at_142._pvar_0_at_143,__context__)));
+	label_8:;;
+	if ( !____this_rename_at_142._loop_at_143 )
+	{
+		goto label_10;
+	};
+	das_copy(___ryield142_rename_at_142,das_ref(__context__,____this_rename_at_142.x));
+	das_copy(____this_rename_at_142.__yield,7);
+	return das_auto_cast<bool>::cast(true);
+	label_7:;;
+	_Funcbuiltin_0x60_push_clone_17e595ccf2ea82f6(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____this_rename_at_142.arr),das_arg<TArray<int32_t>>::pass(____this_rename_at_142.x));
+	label_9:;;
+	DAS_SETBOOLAND((____this_rename_at_142._loop_at_143),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_142._source_0_at_143),____this_rename_at_142._pvar_0_at_143,__context__)));
+	goto label_8;
+	label_10:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_142._source_0_at_143),____this_rename_at_142._pvar_0_at_143,__context__);
+	label_5:;;
+	das_copy(____this_rename_at_142.___loop_at_147_rename_at_147,true);
+	das_move(____this_rename_at_142.___source_0_at_147_rename_at_147,(_temp_make_local_147_32 = (_Funcbuiltin_0x60_each_e5c085c7199596c7(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____this_rename_at_142.arr)))));
+	memset(&(____this_rename_at_142.__x_rename_at_147), 0, 8);
+	das_copy(____this_rename_at_142.___pvar_0_at_147_rename_at_147,das_ref(__context__,____this_rename_at_142.__x_rename_at_147));
+	DAS_SETBOOLAND((____this_rename_at_142.___loop_at_147_rename_at_147),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_142.___source_0_at_147_rename_at_147),____this_rename_at_142.___pvar_0_at_147_rename_at_147,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_142.___loop_at_147_rename_at_147 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield142_rename_at_142,das_ref(__context__,das_deref(__context__,____this_rename_at_142.__x_rename_at_147)));
+	das_copy(____this_rename_at_142.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_142.___loop_at_147_rename_at_147),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_142.___source_0_at_147_rename_at_147),____this_rename_at_142.___pvar_0_at_147_rename_at_147,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_142.___source_0_at_147_rename_at_147),____this_rename_at_142.___pvar_0_at_147_rename_at_147,__context__);
+	goto label_5;
+	label_6:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_142_12_29_0x60_finalizer_7197b61db218f9f4 ( Context * __context__, _lambda_thismodule_142_12_29 * ____this_rename_at_142 )
+{
+	builtin_array_clear_lock(das_arg<TArray<TArray<int32_t>>>::pass(das_deref(__context__,____this_rename_at_142).arr),__context__);
+	finalize_fd89e81470ac2037(__context__,das_arg<_lambda_thismodule_142_12_29>::pass(das_deref(__context__,____this_rename_at_142)));
+	das_delete_lambda_struct<_lambda_thismodule_142_12_29 *>::clear(__context__,____this_rename_at_142);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_ref_dd86c289804be67a ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const  __lam_rename_at_487 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) __it_rename_at_488; das_zero(__it_rename_at_488);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_488),__lam_rename_at_487,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(__it_rename_at_488);
+}
+
+inline void _Func_0x60_verify_even_b071089197a7ced6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __arr_rename_at_19 )
+{
+	{
+		bool __need_loop_20 = true;
+		// x : int const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__arr_rename_at_19);
+		int32_t __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,50));
+		int32_t __y_rename_at_20;
+		__need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) && __y_iterator.next(__context__,(__y_rename_at_20)) )
+		{
+			DAS_ASSERT((__x_rename_at_20 == (__y_rename_at_20 * 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+		__y_iterator.close(__context__,(__y_rename_at_20));
+	};
+}
+
+inline bool _Funcfunctional_0x60_any_cf35c74e31a01f2b ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  __it_rename_at_102 )
+{
+	{
+		bool __need_loop_108 = true;
+		// x : bool const
+		das_iterator<Sequence DAS_COMMENT((bool)) const > __x_iterator(__it_rename_at_102);
+		bool __x_rename_at_108;
+		__need_loop_108 = __x_iterator.first(__context__,(__x_rename_at_108)) && __need_loop_108;
+		for ( ; __need_loop_108 ; __need_loop_108 = __x_iterator.next(__context__,(__x_rename_at_108)) )
+		{
+			if ( __x_rename_at_108 )
+			{
+				return das_auto_cast<bool>::cast(true);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_108));
+	};
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline bool _Funcfunctional_0x60_all_927327c38b4c115b ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  __it_rename_at_115 )
+{
+	{
+		bool __need_loop_121 = true;
+		// x : bool const
+		das_iterator<Sequence DAS_COMMENT((bool)) const > __x_iterator(__it_rename_at_115);
+		bool __x_rename_at_121;
+		__need_loop_121 = __x_iterator.first(__context__,(__x_rename_at_121)) && __need_loop_121;
+		for ( ; __need_loop_121 ; __need_loop_121 = __x_iterator.next(__context__,(__x_rename_at_121)) )
+		{
+			if ( !__x_rename_at_121 )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_121));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool _Func_0x60_is_same_8d62f8edc4df68d8 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __a_rename_at_37, Sequence DAS_COMMENT((int32_t)) const  &  __b_rename_at_37 )
+{
+	{
+		bool __need_loop_38 = true;
+		// x : int const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__a_rename_at_37);
+		int32_t __x_rename_at_38;
+		__need_loop_38 = __x_iterator.first(__context__,(__x_rename_at_38)) && __need_loop_38;
+		// y : int const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __y_iterator(__b_rename_at_37);
+		int32_t __y_rename_at_38;
+		__need_loop_38 = __y_iterator.first(__context__,(__y_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __x_iterator.next(__context__,(__x_rename_at_38)) && __y_iterator.next(__context__,(__y_rename_at_38)) )
+		{
+			if ( __x_rename_at_38 != __y_rename_at_38 )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_38));
+		__y_iterator.close(__context__,(__y_rename_at_38));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void finalize_40e8d0f1b8f49c52 ( Context * __context__, _lambda_thismodule_14_12_21 &  ____this_rename_at_14 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_14._source_0_at_14),__context__);
+	memset(&(____this_rename_at_14), 0, 72);
+}
+
+inline void finalize_40ecfde5d647179b ( Context * __context__, _lambda_thismodule_14_12_22 &  ____this_rename_at_14 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_14._source_0_at_14),__context__);
+	memset(&(____this_rename_at_14), 0, 72);
+}
+
+inline void finalize_26e26b1d9e5eee70 ( Context * __context__, _lambda_thismodule_36_12_23 &  ____this_rename_at_36 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_36._source_0_at_36),__context__);
+	memset(&(____this_rename_at_36), 0, 72);
+}
+
+inline void finalize_c73f35326dfaded9 ( Context * __context__, _lambda_thismodule_36_12_24 &  ____this_rename_at_36 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_36._source_0_at_36),__context__);
+	memset(&(____this_rename_at_36), 0, 72);
+}
+
+inline void finalize_2b16ae00fd6cbbd8 ( Context * __context__, _lambda_thismodule_91_25_26 &  ____this_rename_at_91 )
+{
+	memset(&(____this_rename_at_91), 0, 16);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_bede40064f7c66cf ( Context * __context__, TArray<TTuple<8,int32_t,float>> &  __Arr_rename_at_156, TTuple<8,int32_t,float> const  &  __value_rename_at_156 )
+{
+	das_copy(__Arr_rename_at_156(builtin_array_push_back_zero(das_arg<TArray<TTuple<8,int32_t,float>>>::pass(__Arr_rename_at_156),8,__context__),__context__),__value_rename_at_156);
+}
+
+inline bool _Func_lambda_thismodule_142_12_28_0x60_function_cdeb562fe872f9e2 ( Context * __context__, _lambda_thismodule_142_12_28 &  ____this_rename_at_142, TTuple<8,int32_t,float> * & ___ryield142_rename_at_142 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) _temp_make_local_147_32;
+	switch (____this_rename_at_142.__yield) {
+	case 0: goto label_0;
+	case 8: goto label_8;
+	case 7: goto label_7;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	memset(&(____this_rename_at_142.arr), 0, 24);
+	das_copy(____this_rename_at_142._loop_at_143,true);
+	das_move(____this_rename_at_142._source_0_at_143,____this_rename_at_142.src);
+	memset(&(____this_rename_at_142.x), 0, 8);
+	das_copy(____this_rename_at_142._pvar_0_at_143,das_ref(__context__,____this_rename_at_142.x));
+	DAS_SETBOOLAND((____this_rename_at_142._loop_at_143),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_142._source_0_at_143),____this_rename_at_142._pvar_0_at_143,__context__)));
+	label_8:;;
+	if ( !____this_rename_at_142._loop_at_143 )
+	{
+		goto label_10;
+	};
+	das_copy(___ryield142_rename_at_142,das_ref(__context__,____this_rename_at_142.x));
+	das_copy(____this_rename_at_142.__yield,7);
+	return das_auto_cast<bool>::cast(true);
+	label_7:;;
+	_Funcbuiltin_0x60_push_clone_bede40064f7c66cf(__context__,das_arg<TArray<TTuple<8,int32_t,float>>>::pass(____this_rename_at_142.arr),das_arg<TTuple<8,int32_t,float>>::pass(____this_rename_at_142.x));
+	label_9:;;
+	DAS_SETBOOLAND((____this_rename_at_142._loop_at_143),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_142._source_0_at_143),____this_rename_at_142._pvar_0_at_143,__context__)));
+	goto label_8;
+	label_10:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_142._source_0_at_143),____this_rename_at_142._pvar_0_at_143,__context__);
+	label_5:;;
+	das_copy(____this_rename_at_142.___loop_at_147_rename_at_147,true);
+	das_move(____this_rename_at_142.___source_0_at_147_rename_at_147,(_temp_make_local_147_32 = (_Funcbuiltin_0x60_each_6a927dd59cc9e5af(__context__,das_arg<TArray<TTuple<8,int32_t,float>>>::pass(____this_rename_at_142.arr)))));
+	memset(&(____this_rename_at_142.__x_rename_at_147), 0, 8);
+	das_copy(____this_rename_at_142.___pvar_0_at_147_rename_at_147,das_ref(__context__,____this_rename_at_142.__x_rename_at_147));
+	DAS_SETBOOLAND((____this_rename_at_142.___loop_at_147_rename_at_147),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_142.___source_0_at_147_rename_at_147),____this_rename_at_142.___pvar_0_at_147_rename_at_147,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_142.___loop_at_147_rename_at_147 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield142_rename_at_142,das_ref(__context__,das_deref(__context__,____this_rename_at_142.__x_rename_at_147)));
+	das_copy(____this_rename_at_142.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_142.___loop_at_147_rename_at_147),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_142.___source_0_at_147_rename_at_147),____this_rename_at_142.___pvar_0_at_147_rename_at_147,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_142.___source_0_at_147_rename_at_147),____this_rename_at_142.___pvar_0_at_147_rename_at_147,__context__);
+	goto label_5;
+	label_6:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_142_12_28_0x60_finalizer_7db4fed5bf632358 ( Context * __context__, _lambda_thismodule_142_12_28 * ____this_rename_at_142 )
+{
+	builtin_array_clear_lock(das_arg<TArray<TTuple<8,int32_t,float>>>::pass(das_deref(__context__,____this_rename_at_142).arr),__context__);
+	finalize_688b941ccc3b70f0(__context__,das_arg<_lambda_thismodule_142_12_28>::pass(das_deref(__context__,____this_rename_at_142)));
+	das_delete_lambda_struct<_lambda_thismodule_142_12_28 *>::clear(__context__,____this_rename_at_142);
+}
+
+inline void finalize_91466dc60be5ec6 ( Context * __context__, _lambda_thismodule_157_12_19 &  ____this_rename_at_157 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_157._source_0_at_157),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_157._source_1_at_157),__context__);
+	memset(&(____this_rename_at_157), 0, 96);
+}
+
+inline void finalize_3c0e41d6a28cffe3 ( Context * __context__, _lambda_thismodule_130_12_20 &  ____this_rename_at_130 )
+{
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_130.arr));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_130._source_0_at_131),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_130.___source_0_at_135_rename_at_135),__context__);
+	memset(&(____this_rename_at_130), 0, 120);
+}
+
+inline bool _Func_lambda_thismodule_14_12_21_0x60_function_f174bcd7545caa8a ( Context * __context__, _lambda_thismodule_14_12_21 &  ____this_rename_at_14, int32_t & ___yield_14_rename_at_14 )
+{
+	switch (____this_rename_at_14.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_14._loop_at_14,true);
+	das_move(____this_rename_at_14._source_0_at_14,____this_rename_at_14.src);
+	memset(&(____this_rename_at_14.w), 0, 4);
+	das_copy(____this_rename_at_14._pvar_0_at_14,das_ref(__context__,____this_rename_at_14.w));
+	DAS_SETBOOLAND((____this_rename_at_14._loop_at_14),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_14._source_0_at_14),____this_rename_at_14._pvar_0_at_14,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_14._loop_at_14 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_function<bool>::invoke<int32_t>(__context__,nullptr,____this_rename_at_14.blk,____this_rename_at_14.w) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_14_rename_at_14,____this_rename_at_14.w);
+	das_copy(____this_rename_at_14.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_14._loop_at_14),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_14._source_0_at_14),____this_rename_at_14._pvar_0_at_14,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_14._source_0_at_14),____this_rename_at_14._pvar_0_at_14,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_14_12_21_0x60_finalizer_82f817fdaad6b024 ( Context * __context__, _lambda_thismodule_14_12_21 * ____this_rename_at_14 )
+{
+	finalize_40e8d0f1b8f49c52(__context__,das_arg<_lambda_thismodule_14_12_21>::pass(das_deref(__context__,____this_rename_at_14)));
+	das_delete_lambda_struct<_lambda_thismodule_14_12_21 *>::clear(__context__,____this_rename_at_14);
+}
+
+inline bool _Func_lambda_thismodule_14_12_22_0x60_function_e557eee355d39963 ( Context * __context__, _lambda_thismodule_14_12_22 &  ____this_rename_at_14, int32_t & ___yield_14_rename_at_14 )
+{
+	switch (____this_rename_at_14.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_14._loop_at_14,true);
+	das_move(____this_rename_at_14._source_0_at_14,____this_rename_at_14.src);
+	memset(&(____this_rename_at_14.w), 0, 4);
+	das_copy(____this_rename_at_14._pvar_0_at_14,das_ref(__context__,____this_rename_at_14.w));
+	DAS_SETBOOLAND((____this_rename_at_14._loop_at_14),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_14._source_0_at_14),____this_rename_at_14._pvar_0_at_14,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_14._loop_at_14 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_lambda<bool>::invoke<int32_t>(__context__,nullptr,____this_rename_at_14.blk,____this_rename_at_14.w) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_14_rename_at_14,____this_rename_at_14.w);
+	das_copy(____this_rename_at_14.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_14._loop_at_14),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_14._source_0_at_14),____this_rename_at_14._pvar_0_at_14,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_14._source_0_at_14),____this_rename_at_14._pvar_0_at_14,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_14_12_22_0x60_finalizer_2f37f530a0cea82c ( Context * __context__, _lambda_thismodule_14_12_22 * ____this_rename_at_14 )
+{
+	finalize_40ecfde5d647179b(__context__,das_arg<_lambda_thismodule_14_12_22>::pass(das_deref(__context__,____this_rename_at_14)));
+	das_delete_lambda_struct<_lambda_thismodule_14_12_22 *>::clear(__context__,____this_rename_at_14);
+}
+
+inline bool _Func_lambda_thismodule_36_12_23_0x60_function_f95273975fd7764 ( Context * __context__, _lambda_thismodule_36_12_23 &  ____this_rename_at_36, int32_t & ___yield_36_rename_at_36 )
+{
+	switch (____this_rename_at_36.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_36._loop_at_36,true);
+	das_move(____this_rename_at_36._source_0_at_36,____this_rename_at_36.src);
+	memset(&(____this_rename_at_36.w), 0, 4);
+	das_copy(____this_rename_at_36._pvar_0_at_36,das_ref(__context__,____this_rename_at_36.w));
+	DAS_SETBOOLAND((____this_rename_at_36._loop_at_36),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_36._source_0_at_36),____this_rename_at_36._pvar_0_at_36,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_36._loop_at_36 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_36_rename_at_36,das_invoke_function<int32_t>::invoke<int32_t>(__context__,nullptr,____this_rename_at_36.blk,____this_rename_at_36.w));
+	das_copy(____this_rename_at_36.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_36._loop_at_36),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_36._source_0_at_36),____this_rename_at_36._pvar_0_at_36,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_36._source_0_at_36),____this_rename_at_36._pvar_0_at_36,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_36_12_23_0x60_finalizer_6ba2205dab2f7198 ( Context * __context__, _lambda_thismodule_36_12_23 * ____this_rename_at_36 )
+{
+	finalize_26e26b1d9e5eee70(__context__,das_arg<_lambda_thismodule_36_12_23>::pass(das_deref(__context__,____this_rename_at_36)));
+	das_delete_lambda_struct<_lambda_thismodule_36_12_23 *>::clear(__context__,____this_rename_at_36);
+}
+
+inline bool _Func_lambda_thismodule_36_12_24_0x60_function_ccba983e2210c435 ( Context * __context__, _lambda_thismodule_36_12_24 &  ____this_rename_at_36, int32_t & ___yield_36_rename_at_36 )
+{
+	switch (____this_rename_at_36.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_36._loop_at_36,true);
+	das_move(____this_rename_at_36._source_0_at_36,____this_rename_at_36.src);
+	memset(&(____this_rename_at_36.w), 0, 4);
+	das_copy(____this_rename_at_36._pvar_0_at_36,das_ref(__context__,____this_rename_at_36.w));
+	DAS_SETBOOLAND((____this_rename_at_36._loop_at_36),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_36._source_0_at_36),____this_rename_at_36._pvar_0_at_36,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_36._loop_at_36 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_36_rename_at_36,das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,nullptr,____this_rename_at_36.blk,____this_rename_at_36.w));
+	das_copy(____this_rename_at_36.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_36._loop_at_36),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_36._source_0_at_36),____this_rename_at_36._pvar_0_at_36,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_36._source_0_at_36),____this_rename_at_36._pvar_0_at_36,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_36_12_24_0x60_finalizer_508212161cc2a60c ( Context * __context__, _lambda_thismodule_36_12_24 * ____this_rename_at_36 )
+{
+	finalize_c73f35326dfaded9(__context__,das_arg<_lambda_thismodule_36_12_24>::pass(das_deref(__context__,____this_rename_at_36)));
+	das_delete_lambda_struct<_lambda_thismodule_36_12_24 *>::clear(__context__,____this_rename_at_36);
+}
+
+inline bool _Func_lambda_thismodule_91_25_26_0x60_function_15f2a680f0c86a65 ( Context * __context__, _lambda_thismodule_91_25_26 &  ____this_rename_at_91, TArray<int32_t> const  &  __x_rename_at_91 )
+{
+	return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_91(0,__context__),2,*__context__,nullptr)) == 0);
+}
+
+inline void _Func_lambda_thismodule_91_25_26_0x60_finalizer_17737d2831ca41c6 ( Context * __context__, _lambda_thismodule_91_25_26 * ____this_rename_at_91 )
+{
+	finalize_2b16ae00fd6cbbd8(__context__,das_arg<_lambda_thismodule_91_25_26>::pass(das_deref(__context__,____this_rename_at_91)));
+	das_delete_lambda_struct<_lambda_thismodule_91_25_26 *>::clear(__context__,____this_rename_at_91);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_any_e29162d675421b2b ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_11, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) __blk_rename_at_11 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_Funcbuiltin_0x60_each_ref_ab33c386e8c5b2f6(__context__,das_ascend<bool,_lambda_thismodule_20_12_30>::make(__context__,&__type_info__4da5125fcede02e2,(([&]() -> _lambda_thismodule_20_12_30 {
+		_lambda_thismodule_20_12_30 __mks_19;
+		das_zero(__mks_19);
+		das_copy((__mks_19.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_20_12_30`function XS<::_lambda_thismodule_20_12_30> &1<1<i>A>?*/ 3099795730864850691u))));
+		das_copy((__mks_19.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_20_12_30`finalizer X1<S<::_lambda_thismodule_20_12_30>>?*/ 12240247075375951456u))));
+		das_move((__mks_19.blk),(__blk_rename_at_11));
+		das_move((__mks_19.src),(__src_rename_at_11));
+		return __mks_19;
+	})()))));
+}
+
+inline void _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07 ( Context * __context__, TArray<int32_t> &  __a_rename_at_31, TArray<int32_t> &  __b_rename_at_31 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<TArray<int32_t> &>::from(__a_rename_at_31)));
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<TArray<int32_t> &>::from(__b_rename_at_31)));
+	das_move(__a_rename_at_31,__b_rename_at_31);
+}
+
+inline bool _Func_lambda_thismodule_157_12_19_0x60_function_4cc416e65d0f7490 ( Context * __context__, _lambda_thismodule_157_12_19 &  ____this_rename_at_157, int32_t & ___yield_157_rename_at_157 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_157_32;
+	switch (____this_rename_at_157.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_157._loop_at_157,true);
+	das_move(____this_rename_at_157._source_0_at_157,____this_rename_at_157.src);
+	memset(&(____this_rename_at_157.x), 0, 4);
+	das_copy(____this_rename_at_157._pvar_0_at_157,das_ref(__context__,____this_rename_at_157.x));
+	DAS_SETBOOLAND((____this_rename_at_157._loop_at_157),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_157._source_0_at_157),____this_rename_at_157._pvar_0_at_157,__context__)));
+	das_move(____this_rename_at_157._source_1_at_157,(_temp_make_local_157_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(____this_rename_at_157.stop)))));
+	memset(&(____this_rename_at_157.i), 0, 4);
+	das_copy(____this_rename_at_157._pvar_1_at_157,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_157.i)));
+	DAS_SETBOOLAND((____this_rename_at_157._loop_at_157),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_157._source_1_at_157),____this_rename_at_157._pvar_1_at_157,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_157._loop_at_157 )
+	{
+		goto label_5;
+	};
+	if ( !(____this_rename_at_157.i >= ____this_rename_at_157.start) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_157_rename_at_157,____this_rename_at_157.x);
+	das_copy(____this_rename_at_157.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_157._loop_at_157),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_157._source_0_at_157),____this_rename_at_157._pvar_0_at_157,__context__)));
+	DAS_SETBOOLAND((____this_rename_at_157._loop_at_157),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_157._source_1_at_157),____this_rename_at_157._pvar_1_at_157,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_157._source_0_at_157),____this_rename_at_157._pvar_0_at_157,__context__);
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_157._source_1_at_157),____this_rename_at_157._pvar_1_at_157,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_157_12_19_0x60_finalizer_3f8bbd6bdc9ad954 ( Context * __context__, _lambda_thismodule_157_12_19 * ____this_rename_at_157 )
+{
+	finalize_91466dc60be5ec6(__context__,das_arg<_lambda_thismodule_157_12_19>::pass(das_deref(__context__,____this_rename_at_157)));
+	das_delete_lambda_struct<_lambda_thismodule_157_12_19 *>::clear(__context__,____this_rename_at_157);
+}
+
+inline bool _Func_lambda_thismodule_130_12_20_0x60_function_3df999ebdcd26a1f ( Context * __context__, _lambda_thismodule_130_12_20 &  ____this_rename_at_130, int32_t & ___yield_130_rename_at_130 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_135_32;
+	switch (____this_rename_at_130.__yield) {
+	case 0: goto label_0;
+	case 8: goto label_8;
+	case 7: goto label_7;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	memset(&(____this_rename_at_130.arr), 0, 24);
+	das_copy(____this_rename_at_130._loop_at_131,true);
+	das_move(____this_rename_at_130._source_0_at_131,____this_rename_at_130.src);
+	memset(&(____this_rename_at_130.x), 0, 4);
+	das_copy(____this_rename_at_130._pvar_0_at_131,das_ref(__context__,____this_rename_at_130.x));
+	DAS_SETBOOLAND((____this_rename_at_130._loop_at_131),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_130._source_0_at_131),____this_rename_at_130._pvar_0_at_131,__context__)));
+	label_8:;;
+	if ( !____this_rename_at_130._loop_at_131 )
+	{
+		goto label_10;
+	};
+	das_copy(___yield_130_rename_at_130,____this_rename_at_130.x);
+	das_copy(____this_rename_at_130.__yield,7);
+	return das_auto_cast<bool>::cast(true);
+	label_7:;;
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_130.arr),____this_rename_at_130.x);
+	label_9:;;
+	DAS_SETBOOLAND((____this_rename_at_130._loop_at_131),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_130._source_0_at_131),____this_rename_at_130._pvar_0_at_131,__context__)));
+	goto label_8;
+	label_10:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_130._source_0_at_131),____this_rename_at_130._pvar_0_at_131,__context__);
+	label_5:;;
+	das_copy(____this_rename_at_130.___loop_at_135_rename_at_135,true);
+	das_move(____this_rename_at_130.___source_0_at_135_rename_at_135,(_temp_make_local_135_32 = (_Funcbuiltin_0x60_each_a87e3fc9767b4917(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_130.arr)))));
+	memset(&(____this_rename_at_130.__x_rename_at_135), 0, 8);
+	das_copy(____this_rename_at_130.___pvar_0_at_135_rename_at_135,das_ref(__context__,____this_rename_at_130.__x_rename_at_135));
+	DAS_SETBOOLAND((____this_rename_at_130.___loop_at_135_rename_at_135),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_130.___source_0_at_135_rename_at_135),____this_rename_at_130.___pvar_0_at_135_rename_at_135,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_130.___loop_at_135_rename_at_135 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_130_rename_at_130,das_deref(__context__,____this_rename_at_130.__x_rename_at_135));
+	das_copy(____this_rename_at_130.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_130.___loop_at_135_rename_at_135),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_130.___source_0_at_135_rename_at_135),____this_rename_at_130.___pvar_0_at_135_rename_at_135,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_130.___source_0_at_135_rename_at_135),____this_rename_at_130.___pvar_0_at_135_rename_at_135,__context__);
+	goto label_5;
+	label_6:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_130_12_20_0x60_finalizer_226fe41329c877cc ( Context * __context__, _lambda_thismodule_130_12_20 * ____this_rename_at_130 )
+{
+	builtin_array_clear_lock(das_arg<TArray<int32_t>>::pass(das_deref(__context__,____this_rename_at_130).arr),__context__);
+	finalize_3c0e41d6a28cffe3(__context__,das_arg<_lambda_thismodule_130_12_20>::pass(das_deref(__context__,____this_rename_at_130)));
+	das_delete_lambda_struct<_lambda_thismodule_130_12_20 *>::clear(__context__,____this_rename_at_130);
+}
+
+inline void finalize_d2bdfafa2f479e21 ( Context * __context__, _lambda_thismodule_71_25_14 &  ____this_rename_at_71 )
+{
+	memset(&(____this_rename_at_71), 0, 16);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_e3cd3f9a12b0fb52 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __it_rename_at_60, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __functor_rename_at_60 )
+{
+	int32_t __left_rename_at_61 = 0;
+	bool __first_rename_at_62 = true;
+	{
+		bool __need_loop_63 = true;
+		// right : int aka TT const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const )) const > __right_iterator(__it_rename_at_60);
+		int32_t const  * __right_rename_at_63;
+		__need_loop_63 = __right_iterator.first(__context__,(__right_rename_at_63)) && __need_loop_63;
+		for ( ; __need_loop_63 ; __need_loop_63 = __right_iterator.next(__context__,(__right_rename_at_63)) )
+		{
+			if ( __first_rename_at_62 )
+			{
+				das_copy(__first_rename_at_62,false);
+				das_copy(__left_rename_at_61,(*__right_rename_at_63));
+			} else {
+				das_copy(__left_rename_at_61,das_invoke<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__functor_rename_at_60,__left_rename_at_61,(*__right_rename_at_63)));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_63));
+	};
+	if ( __first_rename_at_62 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return das_auto_cast<int32_t>::cast(__left_rename_at_61);
+}
+
+inline void finalize_b1fbd3f7f17aa107 ( Context * __context__, _lambda_thismodule_115_27_15 &  ____this_rename_at_115 )
+{
+	memset(&(____this_rename_at_115), 0, 16);
+}
+
+inline void finalize_4e811d32879905fb ( Context * __context__, _lambda_thismodule_163_30_16 &  ____this_rename_at_163 )
+{
+	memset(&(____this_rename_at_163), 0, 16);
+}
+
+inline void finalize_9241f8123a6109c0 ( Context * __context__, _lambda_thismodule_172_30_17 &  ____this_rename_at_172 )
+{
+	memset(&(____this_rename_at_172), 0, 16);
+}
+
+inline void finalize_3da670ae0d0fd49c ( Context * __context__, _lambda_thismodule_180_30_18 &  ____this_rename_at_180 )
+{
+	memset(&(____this_rename_at_180), 0, 16);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_156, int32_t __value_rename_at_156 )
+{
+	das_copy(__Arr_rename_at_156(builtin_array_push_back_zero(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_156),4,__context__),__context__),__value_rename_at_156);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Func_0x60_verify_14_c7953d9d52dffeef ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) const  &  __t_rename_at_43 )
+{
+	{
+		bool __need_loop_44 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(1,4));
+		int32_t __x_rename_at_44;
+		__need_loop_44 = __x_iterator.first(__context__,(__x_rename_at_44)) && __need_loop_44;
+		// y : array<int> const
+		das_iterator<Sequence DAS_COMMENT((TArray<int32_t>)) const > __y_iterator(__t_rename_at_43);
+		TArray<int32_t> const  __y_rename_at_44;
+		__need_loop_44 = __y_iterator.first(__context__,(__y_rename_at_44)) && __need_loop_44;
+		for ( ; __need_loop_44 ; __need_loop_44 = __x_iterator.next(__context__,(__x_rename_at_44)) && __y_iterator.next(__context__,(__y_rename_at_44)) )
+		{
+			DAS_ASSERT(((__y_rename_at_44(0,__context__) == __x_rename_at_44) && (__y_rename_at_44(1,__context__) == 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_44));
+		__y_iterator.close(__context__,(__y_rename_at_44));
+	};
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_64323d9de00083a ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_25, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const  __blk_rename_at_25 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_Funcfunctional_0x60_filter_any_e29162d675421b2b(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__src_rename_at_25),__blk_rename_at_25));
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_cycle_a78805a0131a894d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_126 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_Funcbuiltin_0x60_each_ref_ab33c386e8c5b2f6(__context__,das_ascend<bool,_lambda_thismodule_142_12_29>::make(__context__,&__type_info__4df7545c01645ae1,(([&]() -> _lambda_thismodule_142_12_29 {
+		_lambda_thismodule_142_12_29 __mks_141;
+		das_zero(__mks_141);
+		das_copy((__mks_141.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_142_12_29`function XS<::_lambda_thismodule_142_12_29> &1<1<i>A>?*/ 1061339844795583671u))));
+		das_copy((__mks_141.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_142_12_29`finalizer X1<S<::_lambda_thismodule_142_12_29>>?*/ 17270090336056138680u))));
+		das_move((__mks_141.src),(__src_rename_at_126));
+		return __mks_141;
+	})()))));
+}
+
+inline void finalize_dca9089a796b169e ( Context * __context__, _lambda_thismodule_56_21_10 &  ____this_rename_at_56 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),__context__);
+	memset(&(____this_rename_at_56), 0, 48);
+}
+
+inline void finalize_3c00f319f5878b9f ( Context * __context__, _lambda_thismodule_90_14_11 &  ____this_rename_at_90 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),__context__);
+	memset(&(____this_rename_at_90), 0, 48);
+}
+
+inline void finalize_95e8646aced816cb ( Context * __context__, _lambda_thismodule_240_10_12 &  ____this_rename_at_240 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),__context__);
+	memset(&(____this_rename_at_240), 0, 48);
+}
+
+inline void finalize_5d81d27f4ab6f1ad ( Context * __context__, _lambda_thismodule_243_18_13 &  ____this_rename_at_243 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),__context__);
+	memset(&(____this_rename_at_243), 0, 48);
+}
+
+inline void _Func_0x60_verify_even_7e6d5ca7b65b79bf ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __arr_rename_at_19 )
+{
+	{
+		bool __need_loop_20 = true;
+		// x : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const )) const > __x_iterator(__arr_rename_at_19);
+		int32_t const  * __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,50));
+		int32_t __y_rename_at_20;
+		__need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) && __y_iterator.next(__context__,(__y_rename_at_20)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_20) == (__y_rename_at_20 * 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+		__y_iterator.close(__context__,(__y_rename_at_20));
+	};
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcbuiltin_0x60_each_7f633a072c41b03c ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t>)) const  __lam_rename_at_480 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t>)) __it_rename_at_482; das_zero(__it_rename_at_482);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__it_rename_at_482),__lam_rename_at_480,24,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t>))>::cast(__it_rename_at_482);
+}
+
+inline TArray<TArray<int32_t>> & _Funcbuiltin_0x60__return_with_lockcheck_39e9c05a08e7d337 ( Context * __context__, TArray<TArray<int32_t>> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_3,cast<TArray<TArray<int32_t>> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<TArray<int32_t>> &>::cast(__a_rename_at_42);
+}
+
+inline bool _Func_lambda_thismodule_71_25_14_0x60_function_4ef28c57d655e61b ( Context * __context__, _lambda_thismodule_71_25_14 &  ____this_rename_at_71, int32_t __x_rename_at_71 )
+{
+	return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_71,2,*__context__,nullptr)) == 0);
+}
+
+inline void _Func_lambda_thismodule_71_25_14_0x60_finalizer_1de86f8b7e406fde ( Context * __context__, _lambda_thismodule_71_25_14 * ____this_rename_at_71 )
+{
+	finalize_d2bdfafa2f479e21(__context__,das_arg<_lambda_thismodule_71_25_14>::pass(das_deref(__context__,____this_rename_at_71)));
+	das_delete_lambda_struct<_lambda_thismodule_71_25_14 *>::clear(__context__,____this_rename_at_71);
+}
+
+inline bool _Funcfunctional_0x60_is_equal_2af44bbc0bb6f328 ( Context * __context__, int32_t __a_rename_at_197, int32_t __b_rename_at_197 )
+{
+	return das_auto_cast<bool>::cast(__a_rename_at_197 == __b_rename_at_197);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_7c596f6a790683f4 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __it_rename_at_87, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __blk_rename_at_87 )
+{
+	return das_auto_cast<int32_t>::cast(_Funcfunctional_0x60_reduce_any_e3cd3f9a12b0fb52(__context__,__it_rename_at_87,__blk_rename_at_87));
+}
+
+inline int32_t _Func_lambda_thismodule_115_27_15_0x60_function_76c593a2d975afd9 ( Context * __context__, _lambda_thismodule_115_27_15 &  ____this_rename_at_115, int32_t __x_rename_at_115, int32_t __y_rename_at_115 )
+{
+	return das_auto_cast<int32_t>::cast(__x_rename_at_115 + __y_rename_at_115);
+}
+
+inline void _Func_lambda_thismodule_115_27_15_0x60_finalizer_b7ae6dadf312675a ( Context * __context__, _lambda_thismodule_115_27_15 * ____this_rename_at_115 )
+{
+	finalize_b1fbd3f7f17aa107(__context__,das_arg<_lambda_thismodule_115_27_15>::pass(das_deref(__context__,____this_rename_at_115)));
+	das_delete_lambda_struct<_lambda_thismodule_115_27_15 *>::clear(__context__,____this_rename_at_115);
+}
+
+inline bool _Func_lambda_thismodule_163_30_16_0x60_function_7c6e7fcacb6ae853 ( Context * __context__, _lambda_thismodule_163_30_16 &  ____this_rename_at_163, int32_t __x_rename_at_163 )
+{
+	return das_auto_cast<bool>::cast(__x_rename_at_163 > 30);
+}
+
+inline void _Func_lambda_thismodule_163_30_16_0x60_finalizer_1efff7382e84e2aa ( Context * __context__, _lambda_thismodule_163_30_16 * ____this_rename_at_163 )
+{
+	finalize_4e811d32879905fb(__context__,das_arg<_lambda_thismodule_163_30_16>::pass(das_deref(__context__,____this_rename_at_163)));
+	das_delete_lambda_struct<_lambda_thismodule_163_30_16 *>::clear(__context__,____this_rename_at_163);
+}
+
+inline bool _Func_lambda_thismodule_172_30_17_0x60_function_42c5b6ebaac79686 ( Context * __context__, _lambda_thismodule_172_30_17 &  ____this_rename_at_172, int32_t __x_rename_at_172 )
+{
+	return das_auto_cast<bool>::cast(__x_rename_at_172 < 100);
+}
+
+inline void _Func_lambda_thismodule_172_30_17_0x60_finalizer_8ed4bb4bd4545e60 ( Context * __context__, _lambda_thismodule_172_30_17 * ____this_rename_at_172 )
+{
+	finalize_9241f8123a6109c0(__context__,das_arg<_lambda_thismodule_172_30_17>::pass(das_deref(__context__,____this_rename_at_172)));
+	das_delete_lambda_struct<_lambda_thismodule_172_30_17 *>::clear(__context__,____this_rename_at_172);
+}
+
+inline bool _Func_lambda_thismodule_180_30_18_0x60_function_d983c4a30551bc1c ( Context * __context__, _lambda_thismodule_180_30_18 &  ____this_rename_at_180, int32_t __x_rename_at_180 )
+{
+	return das_auto_cast<bool>::cast(__x_rename_at_180 > 0);
+}
+
+inline void _Func_lambda_thismodule_180_30_18_0x60_finalizer_526d77f2b8437988 ( Context * __context__, _lambda_thismodule_180_30_18 * ____this_rename_at_180 )
+{
+	finalize_3da670ae0d0fd49c(__context__,das_arg<_lambda_thismodule_180_30_18>::pass(das_deref(__context__,____this_rename_at_180)));
+	das_delete_lambda_struct<_lambda_thismodule_180_30_18 *>::clear(__context__,____this_rename_at_180);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_937a16f0c7f42db ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_505 )
+{
+	TArray<int32_t> __arr_rename_at_506; das_zero(__arr_rename_at_506);
+	{
+		bool __need_loop_507 = true;
+		// x : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__it_rename_at_505);
+		int32_t __x_rename_at_507;
+		__need_loop_507 = __x_iterator.first(__context__,(__x_rename_at_507)) && __need_loop_507;
+		for ( ; __need_loop_507 ; __need_loop_507 = __x_iterator.next(__context__,(__x_rename_at_507)) )
+		{
+			_Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_506),__x_rename_at_507);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_507));
+	};
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_506);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_cycle_db50944d1b917eec ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  __src_rename_at_126 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(_Funcbuiltin_0x60_each_ref_dd86c289804be67a(__context__,das_ascend<bool,_lambda_thismodule_142_12_28>::make(__context__,&__type_info__4df3d25c01614824,(([&]() -> _lambda_thismodule_142_12_28 {
+		_lambda_thismodule_142_12_28 __mks_141;
+		das_zero(__mks_141);
+		das_copy((__mks_141.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_142_12_28`function XS<::_lambda_thismodule_142_12_28> &1<0<i;f>U>?*/ 16955701849359329807u))));
+		das_copy((__mks_141.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_142_12_28`finalizer X1<S<::_lambda_thismodule_142_12_28>>?*/ 1844742990608401788u))));
+		das_move((__mks_141.src),(__src_rename_at_126));
+		return __mks_141;
+	})()))));
+}
+
+inline void finalize_fbc79084dd3275de ( Context * __context__, _lambda_thismodule_173_8_2 &  ____this_rename_at_173 )
+{
+	memset(&(____this_rename_at_173), 0, 24);
+}
+
+inline void finalize_ea9711ac7e396704 ( Context * __context__, _lambda_thismodule_190_8_3 &  ____this_rename_at_190 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_190._source_0_at_193),__context__);
+	memset(&(____this_rename_at_190), 0, 56);
+}
+
+inline void finalize_50a2b26c59df4fa5 ( Context * __context__, _lambda_thismodule_50_23_4 &  ____this_rename_at_50 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),__context__);
+	memset(&(____this_rename_at_50), 0, 48);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_2ae23ac41016a34a ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_11, Func DAS_COMMENT((bool,int32_t)) __blk_rename_at_11 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_14_12_21>::make(__context__,&__type_info__6d5eace1673c3cd9,(([&]() -> _lambda_thismodule_14_12_21 {
+		_lambda_thismodule_14_12_21 __mks_13;
+		das_zero(__mks_13);
+		das_copy((__mks_13.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_14_12_21`function XS<::_lambda_thismodule_14_12_21> &i*/ 14193881624226004049u))));
+		das_copy((__mks_13.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_14_12_21`finalizer X1<S<::_lambda_thismodule_14_12_21>>?*/ 7197005507309020522u))));
+		das_move((__mks_13.blk),(__blk_rename_at_11));
+		das_move((__mks_13.src),(__src_rename_at_11));
+		return __mks_13;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_f8dac28aa0dd5ec0 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_11, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_11 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_14_12_22>::make(__context__,&__type_info__6d54aae16733e4ee,(([&]() -> _lambda_thismodule_14_12_22 {
+		_lambda_thismodule_14_12_22 __mks_13;
+		das_zero(__mks_13);
+		das_copy((__mks_13.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_14_12_22`function XS<::_lambda_thismodule_14_12_22> &i*/ 4584809989944293109u))));
+		das_copy((__mks_13.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_14_12_22`finalizer X1<S<::_lambda_thismodule_14_12_22>>?*/ 14909787583219619976u))));
+		das_move((__mks_13.blk),(__blk_rename_at_11));
+		das_move((__mks_13.src),(__src_rename_at_11));
+		return __mks_13;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_6e0944b71f858323 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_33, Func DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_33 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_36_12_23>::make(__context__,&__type_info__1574da00a994ba93,(([&]() -> _lambda_thismodule_36_12_23 {
+		_lambda_thismodule_36_12_23 __mks_35;
+		das_zero(__mks_35);
+		das_copy((__mks_35.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_36_12_23`function XS<::_lambda_thismodule_36_12_23> &i*/ 1004623150924096077u))));
+		das_copy((__mks_35.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_36_12_23`finalizer X1<S<::_lambda_thismodule_36_12_23>>?*/ 12419460174005828946u))));
+		das_move((__mks_35.blk),(__blk_rename_at_33));
+		das_move((__mks_35.src),(__src_rename_at_33));
+		return __mks_35;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_c16fd10e29077412 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_33, Lambda DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_33 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_36_12_24>::make(__context__,&__type_info__156ad800a98c62a8,(([&]() -> _lambda_thismodule_36_12_24 {
+		_lambda_thismodule_36_12_24 __mks_35;
+		das_zero(__mks_35);
+		das_copy((__mks_35.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_36_12_24`function XS<::_lambda_thismodule_36_12_24> &i*/ 2277668751206325509u))));
+		das_copy((__mks_35.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_36_12_24`finalizer X1<S<::_lambda_thismodule_36_12_24>>?*/ 11636796923624143824u))));
+		das_move((__mks_35.blk),(__blk_rename_at_33));
+		das_move((__mks_35.src),(__src_rename_at_33));
+		return __mks_35;
+	})()))));
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_e8c9be3d74e2ec87 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_60, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __functor_rename_at_60 )
+{
+	int32_t __left_rename_at_61 = 0;
+	bool __first_rename_at_62 = true;
+	{
+		bool __need_loop_63 = true;
+		// right : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __right_iterator(__it_rename_at_60);
+		int32_t __right_rename_at_63;
+		__need_loop_63 = __right_iterator.first(__context__,(__right_rename_at_63)) && __need_loop_63;
+		for ( ; __need_loop_63 ; __need_loop_63 = __right_iterator.next(__context__,(__right_rename_at_63)) )
+		{
+			if ( __first_rename_at_62 )
+			{
+				das_copy(__first_rename_at_62,false);
+				das_copy(__left_rename_at_61,__right_rename_at_63);
+			} else {
+				das_copy(__left_rename_at_61,das_invoke<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__functor_rename_at_60,__left_rename_at_61,__right_rename_at_63));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_63));
+	};
+	if ( __first_rename_at_62 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return das_auto_cast<int32_t>::cast(__left_rename_at_61);
+}
+
+inline void finalize_1141d7256c227d21 ( Context * __context__, _lambda_thismodule_106_15_5 &  ____this_rename_at_106 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),__context__);
+	memset(&(____this_rename_at_106), 0, 48);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_1eddf981a5714858 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_60, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_60 )
+{
+	int32_t __left_rename_at_61 = 0;
+	bool __first_rename_at_62 = true;
+	{
+		bool __need_loop_63 = true;
+		// right : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __right_iterator(__it_rename_at_60);
+		int32_t __right_rename_at_63;
+		__need_loop_63 = __right_iterator.first(__context__,(__right_rename_at_63)) && __need_loop_63;
+		for ( ; __need_loop_63 ; __need_loop_63 = __right_iterator.next(__context__,(__right_rename_at_63)) )
+		{
+			if ( __first_rename_at_62 )
+			{
+				das_copy(__first_rename_at_62,false);
+				das_copy(__left_rename_at_61,__right_rename_at_63);
+			} else {
+				das_copy(__left_rename_at_61,das_invoke_lambda<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__functor_rename_at_60,__left_rename_at_61,__right_rename_at_63));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_63));
+	};
+	if ( __first_rename_at_62 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return das_auto_cast<int32_t>::cast(__left_rename_at_61);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_6430db396ca81d22 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_60, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_60 )
+{
+	int32_t __left_rename_at_61 = 0;
+	bool __first_rename_at_62 = true;
+	{
+		bool __need_loop_63 = true;
+		// right : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __right_iterator(__it_rename_at_60);
+		int32_t __right_rename_at_63;
+		__need_loop_63 = __right_iterator.first(__context__,(__right_rename_at_63)) && __need_loop_63;
+		for ( ; __need_loop_63 ; __need_loop_63 = __right_iterator.next(__context__,(__right_rename_at_63)) )
+		{
+			if ( __first_rename_at_62 )
+			{
+				das_copy(__first_rename_at_62,false);
+				das_copy(__left_rename_at_61,__right_rename_at_63);
+			} else {
+				das_copy(__left_rename_at_61,das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__functor_rename_at_60,__left_rename_at_61,__right_rename_at_63));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_63));
+	};
+	if ( __first_rename_at_62 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return das_auto_cast<int32_t>::cast(__left_rename_at_61);
+}
+
+inline void finalize_18fe4fcb57354a0c ( Context * __context__, _lambda_thismodule_139_28_6 &  ____this_rename_at_139 )
+{
+	memset(&(____this_rename_at_139), 0, 16);
+}
+
+inline void finalize_36a3b02b1fb3dcf7 ( Context * __context__, _lambda_thismodule_227_19_7 &  ____this_rename_at_227 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),__context__);
+	memset(&(____this_rename_at_227), 0, 48);
+}
+
+inline void finalize_a109dfbebfbc079f ( Context * __context__, _lambda_thismodule_232_10_8 &  ____this_rename_at_232 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),__context__);
+	memset(&(____this_rename_at_232), 0, 48);
+}
+
+inline void finalize_daf2db5be95cd687 ( Context * __context__, _lambda_thismodule_235_18_9 &  ____this_rename_at_235 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),__context__);
+	memset(&(____this_rename_at_235), 0, 48);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_2290b067fc65760f ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_480 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_482; das_zero(__it_rename_at_482);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_482),__lam_rename_at_480,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_482);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_ref_77eafe8c9006a0 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const  __lam_rename_at_487 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_488; das_zero(__it_rename_at_488);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_488),__lam_rename_at_487,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t const  &))>::cast(__it_rename_at_488);
+}
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_4,cast<TArray<int32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_42);
+}
+
+inline bool _Func_lambda_thismodule_56_21_10_0x60_function_eaac258aa9c0d84a ( Context * __context__, _lambda_thismodule_56_21_10 &  ____this_rename_at_56, TArray<int32_t> &  ___yield_56_rename_at_56 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_56_32;
+	TArray<int32_t> _temp_make_local_56_48;
+	TDim<int32_t,2> _temp_make_local_56_80;
+	switch (____this_rename_at_56.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_56._loop_at_56,true);
+	das_move(____this_rename_at_56._source_0_at_56,(_temp_make_local_56_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(1,4)))));
+	memset(&(____this_rename_at_56.x), 0, 4);
+	das_copy(____this_rename_at_56._pvar_0_at_56,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_56.x)));
+	DAS_SETBOOLAND((____this_rename_at_56._loop_at_56),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),____this_rename_at_56._pvar_0_at_56,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_56._loop_at_56 )
+	{
+		goto label_4;
+	};
+	_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07(__context__,das_arg<TArray<int32_t>>::pass(___yield_56_rename_at_56),das_arg<TArray<int32_t>>::pass((_temp_make_local_56_48 = (_Funcbuiltin_0x60_to_array_move_8095aad6f5b96480(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_56_80(0,__context__) = ____this_rename_at_56.x;
+		_temp_make_local_56_80(1,__context__) = 2;
+		return _temp_make_local_56_80;
+	})())))))));
+	das_copy(____this_rename_at_56.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_56._loop_at_56),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),____this_rename_at_56._pvar_0_at_56,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),____this_rename_at_56._pvar_0_at_56,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_56_21_10_0x60_finalizer_6390258da803cc74 ( Context * __context__, _lambda_thismodule_56_21_10 * ____this_rename_at_56 )
+{
+	finalize_dca9089a796b169e(__context__,das_arg<_lambda_thismodule_56_21_10>::pass(das_deref(__context__,____this_rename_at_56)));
+	das_delete_lambda_struct<_lambda_thismodule_56_21_10 *>::clear(__context__,____this_rename_at_56);
+}
+
+inline void _Funcbuiltin_0x60_emplace_46aeb6a61c4e9221 ( Context * __context__, TArray<TArray<int32_t>> &  __Arr_rename_at_120, TArray<int32_t> &  __value_rename_at_120 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_5,cast<TArray<TArray<int32_t>> &>::from(__Arr_rename_at_120)));
+	das_move(__Arr_rename_at_120(builtin_array_push_back(das_arg<TArray<TArray<int32_t>>>::pass(__Arr_rename_at_120),24,__context__),__context__),__value_rename_at_120);
+}
+
+inline void _Func_0x60_verify_14_ad9c7b801e624df0 ( Context * __context__, TArray<TArray<int32_t>> const  &  __t_rename_at_43 )
+{
+	{
+		bool __need_loop_44 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(1,4));
+		int32_t __x_rename_at_44;
+		__need_loop_44 = __x_iterator.first(__context__,(__x_rename_at_44)) && __need_loop_44;
+		// y : array<int> const&
+		das_iterator<TArray<TArray<int32_t>> const > __y_iterator(__t_rename_at_43);
+		TArray<int32_t> const  * __y_rename_at_44;
+		__need_loop_44 = __y_iterator.first(__context__,(__y_rename_at_44)) && __need_loop_44;
+		for ( ; __need_loop_44 ; __need_loop_44 = __x_iterator.next(__context__,(__x_rename_at_44)) && __y_iterator.next(__context__,(__y_rename_at_44)) )
+		{
+			DAS_ASSERT((((*__y_rename_at_44)(0,__context__) == __x_rename_at_44) && ((*__y_rename_at_44)(1,__context__) == 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_44));
+		__y_iterator.close(__context__,(__y_rename_at_44));
+	};
+}
+
+inline bool _Func_lambda_thismodule_90_14_11_0x60_function_7c8af860540bcf86 ( Context * __context__, _lambda_thismodule_90_14_11 &  ____this_rename_at_90, TArray<int32_t> &  ___yield_90_rename_at_90 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_90_32;
+	TArray<int32_t> _temp_make_local_90_48;
+	TDim<int32_t,2> _temp_make_local_90_80;
+	switch (____this_rename_at_90.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_90._loop_at_90,true);
+	das_move(____this_rename_at_90._source_0_at_90,(_temp_make_local_90_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,100)))));
+	memset(&(____this_rename_at_90.x), 0, 4);
+	das_copy(____this_rename_at_90._pvar_0_at_90,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_90.x)));
+	DAS_SETBOOLAND((____this_rename_at_90._loop_at_90),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),____this_rename_at_90._pvar_0_at_90,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_90._loop_at_90 )
+	{
+		goto label_4;
+	};
+	_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07(__context__,das_arg<TArray<int32_t>>::pass(___yield_90_rename_at_90),das_arg<TArray<int32_t>>::pass((_temp_make_local_90_48 = (_Funcbuiltin_0x60_to_array_move_8095aad6f5b96480(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_90_80(0,__context__) = ____this_rename_at_90.x;
+		_temp_make_local_90_80(1,__context__) = 2;
+		return _temp_make_local_90_80;
+	})())))))));
+	das_copy(____this_rename_at_90.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_90._loop_at_90),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),____this_rename_at_90._pvar_0_at_90,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),____this_rename_at_90._pvar_0_at_90,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_90_14_11_0x60_finalizer_398faab869104a98 ( Context * __context__, _lambda_thismodule_90_14_11 * ____this_rename_at_90 )
+{
+	finalize_3c00f319f5878b9f(__context__,das_arg<_lambda_thismodule_90_14_11>::pass(das_deref(__context__,____this_rename_at_90)));
+	das_delete_lambda_struct<_lambda_thismodule_90_14_11 *>::clear(__context__,____this_rename_at_90);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcbuiltin_0x60_each_5b8f7b8f8a92acc2 ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const  __lam_rename_at_480 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) __it_rename_at_482; das_zero(__it_rename_at_482);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_482),__lam_rename_at_480,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::cast(__it_rename_at_482);
+}
+
+inline bool _Func_lambda_thismodule_240_10_12_0x60_function_4e2050b2cd3a10f7 ( Context * __context__, _lambda_thismodule_240_10_12 &  ____this_rename_at_240, TArray<int32_t> &  ___yield_240_rename_at_240 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_240_32;
+	TArray<int32_t> _temp_make_local_240_48;
+	TDim<int32_t,2> _temp_make_local_240_80;
+	switch (____this_rename_at_240.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_240._loop_at_240,true);
+	das_move(____this_rename_at_240._source_0_at_240,(_temp_make_local_240_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(1,4)))));
+	memset(&(____this_rename_at_240.x), 0, 4);
+	das_copy(____this_rename_at_240._pvar_0_at_240,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_240.x)));
+	DAS_SETBOOLAND((____this_rename_at_240._loop_at_240),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),____this_rename_at_240._pvar_0_at_240,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_240._loop_at_240 )
+	{
+		goto label_4;
+	};
+	_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07(__context__,das_arg<TArray<int32_t>>::pass(___yield_240_rename_at_240),das_arg<TArray<int32_t>>::pass((_temp_make_local_240_48 = (_Funcbuiltin_0x60_to_array_move_8095aad6f5b96480(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_240_80(0,__context__) = ____this_rename_at_240.x;
+		_temp_make_local_240_80(1,__context__) = 2;
+		return _temp_make_local_240_80;
+	})())))))));
+	das_copy(____this_rename_at_240.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_240._loop_at_240),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),____this_rename_at_240._pvar_0_at_240,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),____this_rename_at_240._pvar_0_at_240,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_240_10_12_0x60_finalizer_722f889b1020677c ( Context * __context__, _lambda_thismodule_240_10_12 * ____this_rename_at_240 )
+{
+	finalize_95e8646aced816cb(__context__,das_arg<_lambda_thismodule_240_10_12>::pass(das_deref(__context__,____this_rename_at_240)));
+	das_delete_lambda_struct<_lambda_thismodule_240_10_12 *>::clear(__context__,____this_rename_at_240);
+}
+
+inline bool _Func_lambda_thismodule_243_18_13_0x60_function_8457e9c7a37377d ( Context * __context__, _lambda_thismodule_243_18_13 &  ____this_rename_at_243, TArray<int32_t> &  ___yield_243_rename_at_243 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_243_32;
+	TArray<int32_t> _temp_make_local_243_48;
+	TDim<int32_t,2> _temp_make_local_243_80;
+	switch (____this_rename_at_243.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_243._loop_at_243,true);
+	das_move(____this_rename_at_243._source_0_at_243,(_temp_make_local_243_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10)))));
+	memset(&(____this_rename_at_243.x), 0, 4);
+	das_copy(____this_rename_at_243._pvar_0_at_243,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_243.x)));
+	DAS_SETBOOLAND((____this_rename_at_243._loop_at_243),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),____this_rename_at_243._pvar_0_at_243,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_243._loop_at_243 )
+	{
+		goto label_4;
+	};
+	_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07(__context__,das_arg<TArray<int32_t>>::pass(___yield_243_rename_at_243),das_arg<TArray<int32_t>>::pass((_temp_make_local_243_48 = (_Funcbuiltin_0x60_to_array_move_8095aad6f5b96480(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_243_80(0,__context__) = ((SimPolicy<int32_t>::Mod(____this_rename_at_243.x,3,*__context__,nullptr)) + 1);
+		_temp_make_local_243_80(1,__context__) = 2;
+		return _temp_make_local_243_80;
+	})())))))));
+	das_copy(____this_rename_at_243.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_243._loop_at_243),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),____this_rename_at_243._pvar_0_at_243,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),____this_rename_at_243._pvar_0_at_243,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_243_18_13_0x60_finalizer_5c6dfa59ff707404 ( Context * __context__, _lambda_thismodule_243_18_13 * ____this_rename_at_243 )
+{
+	finalize_5d81d27f4ab6f1ad(__context__,das_arg<_lambda_thismodule_243_18_13>::pass(das_deref(__context__,____this_rename_at_243)));
+	das_delete_lambda_struct<_lambda_thismodule_243_18_13 *>::clear(__context__,____this_rename_at_243);
+}
+
+inline void finalize_2e9b369ff6b06689 ( Context * __context__, _lambda_thismodule_85_28_1 &  ____this_rename_at_85 )
+{
+	memset(&(____this_rename_at_85), 0, 16);
+}
+
+inline bool _Func_lambda_thismodule_173_8_2_0x60_function_a2d0530164e71c37 ( Context * __context__, _lambda_thismodule_173_8_2 &  ____this_rename_at_173, int32_t & __result_rename_at_172 )
+{
+	das_copy(__result_rename_at_172,____this_rename_at_173.start);
+	____this_rename_at_173.start += ____this_rename_at_173.step;
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void _Func_lambda_thismodule_173_8_2_0x60_finalizer_4907142523166368 ( Context * __context__, _lambda_thismodule_173_8_2 * ____this_rename_at_173 )
+{
+	finalize_fbc79084dd3275de(__context__,das_arg<_lambda_thismodule_173_8_2>::pass(das_deref(__context__,____this_rename_at_173)));
+	das_delete_lambda_struct<_lambda_thismodule_173_8_2 *>::clear(__context__,____this_rename_at_173);
+}
+
+inline bool _Func_lambda_thismodule_190_8_3_0x60_function_20eecf34434e56ab ( Context * __context__, _lambda_thismodule_190_8_3 &  ____this_rename_at_190, int32_t & ___yield_190_rename_at_190 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_193_32;
+	switch (____this_rename_at_190.__yield) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	case 5: goto label_5;
+	case 7: goto label_7;
+	case 8: goto label_8;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_190.count == 0) )
+	{
+		goto label_4;
+	};
+	label_1:;;
+	das_copy(___yield_190_rename_at_190,____this_rename_at_190.value);
+	das_copy(____this_rename_at_190.__yield,3);
+	return das_auto_cast<bool>::cast(true);
+	label_3:;;
+	goto label_1;
+	label_2:;;
+	label_4:;;
+	das_copy(____this_rename_at_190._loop_at_193,true);
+	das_move(____this_rename_at_190._source_0_at_193,(_temp_make_local_193_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(____this_rename_at_190.count)))));
+	memset(&(____this_rename_at_190.x), 0, 4);
+	das_copy(____this_rename_at_190._pvar_0_at_193,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_190.x)));
+	DAS_SETBOOLAND((____this_rename_at_190._loop_at_193),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_190._source_0_at_193),____this_rename_at_190._pvar_0_at_193,__context__)));
+	label_6:;;
+	if ( !____this_rename_at_190._loop_at_193 )
+	{
+		goto label_8;
+	};
+	das_copy(___yield_190_rename_at_190,____this_rename_at_190.value);
+	das_copy(____this_rename_at_190.__yield,5);
+	return das_auto_cast<bool>::cast(true);
+	label_5:;;
+	label_7:;;
+	DAS_SETBOOLAND((____this_rename_at_190._loop_at_193),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_190._source_0_at_193),____this_rename_at_190._pvar_0_at_193,__context__)));
+	goto label_6;
+	label_8:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_190._source_0_at_193),____this_rename_at_190._pvar_0_at_193,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_190_8_3_0x60_finalizer_d00fbd4aff2c7106 ( Context * __context__, _lambda_thismodule_190_8_3 * ____this_rename_at_190 )
+{
+	finalize_ea9711ac7e396704(__context__,das_arg<_lambda_thismodule_190_8_3>::pass(das_deref(__context__,____this_rename_at_190)));
+	das_delete_lambda_struct<_lambda_thismodule_190_8_3 *>::clear(__context__,____this_rename_at_190);
+}
+
+inline bool _Func_lambda_thismodule_50_23_4_0x60_function_acc8ccfc59a727e8 ( Context * __context__, _lambda_thismodule_50_23_4 &  ____this_rename_at_50, int32_t const  * & ___ryield50_rename_at_50 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_50_32;
+	switch (____this_rename_at_50.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_50._loop_at_50,true);
+	das_move(____this_rename_at_50._source_0_at_50,(_temp_make_local_50_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,100)))));
+	memset(&(____this_rename_at_50.x), 0, 4);
+	das_copy(____this_rename_at_50._pvar_0_at_50,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_50.x)));
+	DAS_SETBOOLAND((____this_rename_at_50._loop_at_50),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),____this_rename_at_50._pvar_0_at_50,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_50._loop_at_50 )
+	{
+		goto label_5;
+	};
+	if ( !((SimPolicy<int32_t>::Mod(____this_rename_at_50.x,2,*__context__,nullptr)) == 0) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield50_rename_at_50,das_ref(__context__,____this_rename_at_50.x));
+	das_copy(____this_rename_at_50.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_50._loop_at_50),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),____this_rename_at_50._pvar_0_at_50,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),____this_rename_at_50._pvar_0_at_50,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_50_23_4_0x60_finalizer_d48a0c4dc1dec02c ( Context * __context__, _lambda_thismodule_50_23_4 * ____this_rename_at_50 )
+{
+	finalize_50a2b26c59df4fa5(__context__,das_arg<_lambda_thismodule_50_23_4>::pass(das_deref(__context__,____this_rename_at_50)));
+	das_delete_lambda_struct<_lambda_thismodule_50_23_4 *>::clear(__context__,____this_rename_at_50);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Func_0x60_verify_even_6703252febc142e7 ( Context * __context__, TArray<int32_t> const  &  __arr_rename_at_19 )
+{
+	{
+		bool __need_loop_20 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__arr_rename_at_19);
+		int32_t const  * __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,50));
+		int32_t __y_rename_at_20;
+		__need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) && __y_iterator.next(__context__,(__y_rename_at_20)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_20) == (__y_rename_at_20 * 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+		__y_iterator.close(__context__,(__y_rename_at_20));
+	};
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_196d50d6a5b657be ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_30, Func DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_30 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_filter_any_2ae23ac41016a34a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_30),__blk_rename_at_30));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_53efa21008623dcb ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_25, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_25 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_filter_any_f8dac28aa0dd5ec0(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_25),__blk_rename_at_25));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_a60435d0c6456bd4 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_56, Func DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_56 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_map_any_6e0944b71f858323(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_56),__blk_rename_at_56));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_58dc263556f6d651 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_51, Lambda DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_51 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_map_any_c16fd10e29077412(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_51),__blk_rename_at_51));
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_417083d1002ee3c4 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_87, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __blk_rename_at_87 )
+{
+	return das_auto_cast<int32_t>::cast(_Funcfunctional_0x60_reduce_any_e8c9be3d74e2ec87(__context__,__it_rename_at_87,__blk_rename_at_87));
+}
+
+inline bool _Func_lambda_thismodule_106_15_5_0x60_function_4edb7cf4dd0af38f ( Context * __context__, _lambda_thismodule_106_15_5 &  ____this_rename_at_106, int32_t const  * & ___ryield106_rename_at_106 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_106_32;
+	switch (____this_rename_at_106.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_106._loop_at_106,true);
+	das_move(____this_rename_at_106._source_0_at_106,(_temp_make_local_106_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10)))));
+	memset(&(____this_rename_at_106.x), 0, 4);
+	das_copy(____this_rename_at_106._pvar_0_at_106,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_106.x)));
+	DAS_SETBOOLAND((____this_rename_at_106._loop_at_106),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),____this_rename_at_106._pvar_0_at_106,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_106._loop_at_106 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield106_rename_at_106,das_ref(__context__,____this_rename_at_106.x));
+	das_copy(____this_rename_at_106.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_106._loop_at_106),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),____this_rename_at_106._pvar_0_at_106,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),____this_rename_at_106._pvar_0_at_106,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_106_15_5_0x60_finalizer_b87dcc28f4b26ad4 ( Context * __context__, _lambda_thismodule_106_15_5 * ____this_rename_at_106 )
+{
+	finalize_1141d7256c227d21(__context__,das_arg<_lambda_thismodule_106_15_5>::pass(das_deref(__context__,____this_rename_at_106)));
+	das_delete_lambda_struct<_lambda_thismodule_106_15_5 *>::clear(__context__,____this_rename_at_106);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_8fbeb127951de7b8 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_75, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_75 )
+{
+	return das_auto_cast<int32_t>::cast(_Funcfunctional_0x60_reduce_any_1eddf981a5714858(__context__,__it_rename_at_75,__blk_rename_at_75));
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_c78f959eee6d541d ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_82, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_82 )
+{
+	return das_auto_cast<int32_t>::cast(_Funcfunctional_0x60_reduce_any_6430db396ca81d22(__context__,__it_rename_at_82,__blk_rename_at_82));
+}
+
+inline TTuple<8,int32_t,float> _Func_lambda_thismodule_139_28_6_0x60_function_ecdee715a1fae593 ( Context * __context__, _lambda_thismodule_139_28_6 &  ____this_rename_at_139, int32_t __x_rename_at_139 )
+{
+	return das_auto_cast_ref<TTuple<8,int32_t,float>>::cast((([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_139;
+		das_get_tuple_field<int32_t,0>::get(__mkt_139) = __x_rename_at_139;
+		das_get_tuple_field<float,4>::get(__mkt_139) = 1.5f;
+		return __mkt_139;
+	})()));
+}
+
+inline void _Func_lambda_thismodule_139_28_6_0x60_finalizer_b747e97a7829fa46 ( Context * __context__, _lambda_thismodule_139_28_6 * ____this_rename_at_139 )
+{
+	finalize_18fe4fcb57354a0c(__context__,das_arg<_lambda_thismodule_139_28_6>::pass(das_deref(__context__,____this_rename_at_139)));
+	das_delete_lambda_struct<_lambda_thismodule_139_28_6 *>::clear(__context__,____this_rename_at_139);
+}
+
+inline int32_t _Funcfunctional_0x60_sum_c6bb83657fd0ca16 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_92 )
+{
+	int32_t __temp_rename_at_95 = 0;
+	{
+		bool __need_loop_96 = true;
+		// x : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__it_rename_at_92);
+		int32_t __x_rename_at_96;
+		__need_loop_96 = __x_iterator.first(__context__,(__x_rename_at_96)) && __need_loop_96;
+		for ( ; __need_loop_96 ; __need_loop_96 = __x_iterator.next(__context__,(__x_rename_at_96)) )
+		{
+			__temp_rename_at_95 += __x_rename_at_96;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_96));
+	};
+	return das_auto_cast<int32_t>::cast(__temp_rename_at_95);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_islice_b171313d5fbcf9e0 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_153, int32_t __start_rename_at_153, int32_t __stop_rename_at_153 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_157_12_19>::make(__context__,&__type_info__a3dfaa63decefde,(([&]() -> _lambda_thismodule_157_12_19 {
+		_lambda_thismodule_157_12_19 __mks_156;
+		das_zero(__mks_156);
+		das_copy((__mks_156.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_157_12_19`function XS<::_lambda_thismodule_157_12_19> &i*/ 3451075856419076623u))));
+		das_copy((__mks_156.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_157_12_19`finalizer X1<S<::_lambda_thismodule_157_12_19>>?*/ 9652197025253419616u))));
+		das_move((__mks_156.src),(__src_rename_at_153));
+		das_copy((__mks_156.start),(__start_rename_at_153));
+		das_copy((__mks_156.stop),(__stop_rename_at_153));
+		return __mks_156;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_cycle_ccb8645ee9ac4b14 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_126 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_130_12_20>::make(__context__,&__type_info__1bdc8d89ade286f,(([&]() -> _lambda_thismodule_130_12_20 {
+		_lambda_thismodule_130_12_20 __mks_129;
+		das_zero(__mks_129);
+		das_copy((__mks_129.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_130_12_20`function XS<::_lambda_thismodule_130_12_20> &i*/ 6240367916771582873u))));
+		das_copy((__mks_129.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_130_12_20`finalizer X1<S<::_lambda_thismodule_130_12_20>>?*/ 7884862145760548748u))));
+		das_move((__mks_129.src),(__src_rename_at_126));
+		return __mks_129;
+	})()))));
+}
+
+inline bool _Func_lambda_thismodule_227_19_7_0x60_function_1cec87bec4f6e7e1 ( Context * __context__, _lambda_thismodule_227_19_7 &  ____this_rename_at_227, int32_t & ___yield_227_rename_at_227 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_227_32;
+	switch (____this_rename_at_227.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_227._loop_at_227,true);
+	das_move(____this_rename_at_227._source_0_at_227,(_temp_make_local_227_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10)))));
+	memset(&(____this_rename_at_227.x), 0, 4);
+	das_copy(____this_rename_at_227._pvar_0_at_227,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_227.x)));
+	DAS_SETBOOLAND((____this_rename_at_227._loop_at_227),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),____this_rename_at_227._pvar_0_at_227,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_227._loop_at_227 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_227_rename_at_227,(SimPolicy<int32_t>::Mod(____this_rename_at_227.x,3,*__context__,nullptr)) + 1);
+	das_copy(____this_rename_at_227.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_227._loop_at_227),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),____this_rename_at_227._pvar_0_at_227,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),____this_rename_at_227._pvar_0_at_227,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_227_19_7_0x60_finalizer_f6e0cad214e51598 ( Context * __context__, _lambda_thismodule_227_19_7 * ____this_rename_at_227 )
+{
+	finalize_36a3b02b1fb3dcf7(__context__,das_arg<_lambda_thismodule_227_19_7>::pass(das_deref(__context__,____this_rename_at_227)));
+	das_delete_lambda_struct<_lambda_thismodule_227_19_7 *>::clear(__context__,____this_rename_at_227);
+}
+
+inline bool _Func_lambda_thismodule_232_10_8_0x60_function_1b9e5aecd83626ed ( Context * __context__, _lambda_thismodule_232_10_8 &  ____this_rename_at_232, TTuple<8,int32_t,float> &  ___yield_232_rename_at_232 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_232_32;
+	switch (____this_rename_at_232.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_232._loop_at_232,true);
+	das_move(____this_rename_at_232._source_0_at_232,(_temp_make_local_232_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(1,4)))));
+	memset(&(____this_rename_at_232.x), 0, 4);
+	das_copy(____this_rename_at_232._pvar_0_at_232,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_232.x)));
+	DAS_SETBOOLAND((____this_rename_at_232._loop_at_232),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),____this_rename_at_232._pvar_0_at_232,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_232._loop_at_232 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_232_rename_at_232,(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_232;
+		das_get_tuple_field<int32_t,0>::get(__mkt_232) = ____this_rename_at_232.x;
+		das_get_tuple_field<float,4>::get(__mkt_232) = 2.5f;
+		return __mkt_232;
+	})()));
+	das_copy(____this_rename_at_232.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_232._loop_at_232),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),____this_rename_at_232._pvar_0_at_232,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),____this_rename_at_232._pvar_0_at_232,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_232_10_8_0x60_finalizer_f0c678795587145c ( Context * __context__, _lambda_thismodule_232_10_8 * ____this_rename_at_232 )
+{
+	finalize_a109dfbebfbc079f(__context__,das_arg<_lambda_thismodule_232_10_8>::pass(das_deref(__context__,____this_rename_at_232)));
+	das_delete_lambda_struct<_lambda_thismodule_232_10_8 *>::clear(__context__,____this_rename_at_232);
+}
+
+inline bool _Func_lambda_thismodule_235_18_9_0x60_function_87eca29eb8b63ff ( Context * __context__, _lambda_thismodule_235_18_9 &  ____this_rename_at_235, TTuple<8,int32_t,float> &  ___yield_235_rename_at_235 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_235_32;
+	switch (____this_rename_at_235.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_235._loop_at_235,true);
+	das_move(____this_rename_at_235._source_0_at_235,(_temp_make_local_235_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10)))));
+	memset(&(____this_rename_at_235.x), 0, 4);
+	das_copy(____this_rename_at_235._pvar_0_at_235,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_235.x)));
+	DAS_SETBOOLAND((____this_rename_at_235._loop_at_235),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),____this_rename_at_235._pvar_0_at_235,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_235._loop_at_235 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_235_rename_at_235,(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_235;
+		das_get_tuple_field<int32_t,0>::get(__mkt_235) = ((SimPolicy<int32_t>::Mod(____this_rename_at_235.x,3,*__context__,nullptr)) + 1);
+		das_get_tuple_field<float,4>::get(__mkt_235) = 2.5f;
+		return __mkt_235;
+	})()));
+	das_copy(____this_rename_at_235.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_235._loop_at_235),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),____this_rename_at_235._pvar_0_at_235,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),____this_rename_at_235._pvar_0_at_235,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_235_18_9_0x60_finalizer_f01773fb180129d8 ( Context * __context__, _lambda_thismodule_235_18_9 * ____this_rename_at_235 )
+{
+	finalize_daf2db5be95cd687(__context__,das_arg<_lambda_thismodule_235_18_9>::pass(das_deref(__context__,____this_rename_at_235)));
+	das_delete_lambda_struct<_lambda_thismodule_235_18_9 *>::clear(__context__,____this_rename_at_235);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_8095aad6f5b96480 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_518 )
+{
+	TArray<int32_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_519),2);
+	das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_519);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_451 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_452; das_zero(__it_rename_at_452);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_452),__rng_rename_at_451,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_452);
+}
+
+inline int32_t _Func_lambda_thismodule_85_28_1_0x60_function_bddb2af26f5dab07 ( Context * __context__, _lambda_thismodule_85_28_1 &  ____this_rename_at_85, int32_t __x_rename_at_85 )
+{
+	return das_auto_cast<int32_t>::cast(__x_rename_at_85 + __x_rename_at_85);
+}
+
+inline void _Func_lambda_thismodule_85_28_1_0x60_finalizer_3dc36ce0a81f940e ( Context * __context__, _lambda_thismodule_85_28_1 * ____this_rename_at_85 )
+{
+	finalize_2e9b369ff6b06689(__context__,das_arg<_lambda_thismodule_85_28_1>::pass(das_deref(__context__,____this_rename_at_85)));
+	das_delete_lambda_struct<_lambda_thismodule_85_28_1 *>::clear(__context__,____this_rename_at_85);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48 ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_518 )
+{
+	TArray<int32_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_519),3);
+	das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_519);
+}
+
+inline bool _Funcfunctional_0x60_any_a5606ed295f053c9 ( Context * __context__, TDim<bool,2> const  &  __it_rename_at_102 )
+{
+	{
+		bool __need_loop_108 = true;
+		// x : bool const&
+		das_iterator<TDim<bool,2> const > __x_iterator(__it_rename_at_102);
+		bool const  * __x_rename_at_108;
+		__need_loop_108 = __x_iterator.first(__context__,(__x_rename_at_108)) && __need_loop_108;
+		for ( ; __need_loop_108 ; __need_loop_108 = __x_iterator.next(__context__,(__x_rename_at_108)) )
+		{
+			if ( (*__x_rename_at_108) )
+			{
+				return das_auto_cast<bool>::cast(true);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_108));
+	};
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_count_7119d72d72fe3e50 ( Context * __context__, int32_t __start_rename_at_170, int32_t __step_rename_at_170 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_173_8_2>::make(__context__,&__type_info__f4903c6752ec6541,(([&]() -> _lambda_thismodule_173_8_2 {
+		_lambda_thismodule_173_8_2 __mks_173;
+		das_copy((__mks_173.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_173_8_2`function XS<::_lambda_thismodule_173_8_2> &i*/ 4864202634600865325u))));
+		das_copy((__mks_173.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_173_8_2`finalizer X1<S<::_lambda_thismodule_173_8_2>>?*/ 11614174905647337528u))));
+		das_copy((__mks_173.start),(__start_rename_at_170));
+		das_copy((__mks_173.step),(__step_rename_at_170));
+		return __mks_173;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_repeat_a8c2dce35f26e7e0 ( Context * __context__, int32_t __value_rename_at_187, int32_t __count_rename_at_187 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_190_8_3>::make(__context__,&__type_info__bdf7a1e0681463c1,(([&]() -> _lambda_thismodule_190_8_3 {
+		_lambda_thismodule_190_8_3 __mks_189;
+		das_zero(__mks_189);
+		das_copy((__mks_189.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_190_8_3`function XS<::_lambda_thismodule_190_8_3> &Xi*/ 1340502853065912953u))));
+		das_copy((__mks_189.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_190_8_3`finalizer X1<S<::_lambda_thismodule_190_8_3>>?*/ 1132630517507928444u))));
+		das_copy((__mks_189.count),(__count_rename_at_187));
+		das_copy((__mks_189.value),(__value_rename_at_187));
+		return __mks_189;
+	})()))));
+}
+
+inline bool is_even_9f92407af8b51b2c ( Context * __context__, int32_t __x_rename_at_9 )
+{
+	return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_9,2,*__context__,nullptr)) == 0);
+}
+
+inline int32_t twice_aa4c716c97740337 ( Context * __context__, int32_t __x_rename_at_12 )
+{
+	return das_auto_cast<int32_t>::cast(__x_rename_at_12 + __x_rename_at_12);
+}
+
+inline int32_t add_8997dbbc2c7fa6aa ( Context * __context__, int32_t __a_rename_at_15, int32_t __b_rename_at_15 )
+{
+	return das_auto_cast<int32_t>::cast(__a_rename_at_15 + __b_rename_at_15);
+}
+
+inline bool _FuncExclEqu_d496bfa20e8277a0 ( Context * __context__, TTuple<8,int32_t,float> const  &  __a_rename_at_26, TTuple<8,int32_t,float> const  &  __b_rename_at_26 )
+{
+	return das_auto_cast<bool>::cast((das_get_tuple_field<int32_t,0>::get(__a_rename_at_26) != das_get_tuple_field<int32_t,0>::get(__b_rename_at_26)) || (das_get_tuple_field<float,4>::get(__a_rename_at_26) != das_get_tuple_field<float,4>::get(__b_rename_at_26)));
+}
+
+inline bool _FuncExclEqu_46b76804d5e31c7b ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_29, TArray<int32_t> const  &  __b_rename_at_29 )
+{
+	if ( builtin_array_size(__a_rename_at_29) != builtin_array_size(__b_rename_at_29) )
+	{
+		return das_auto_cast<bool>::cast(true);
+	} else {
+		{
+			bool __need_loop_32 = true;
+			// x : int const&
+			das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_29);
+			int32_t const  * __x_rename_at_32;
+			__need_loop_32 = __x_iterator.first(__context__,(__x_rename_at_32)) && __need_loop_32;
+			// y : int const&
+			das_iterator<TArray<int32_t> const > __y_iterator(__b_rename_at_29);
+			int32_t const  * __y_rename_at_32;
+			__need_loop_32 = __y_iterator.first(__context__,(__y_rename_at_32)) && __need_loop_32;
+			for ( ; __need_loop_32 ; __need_loop_32 = __x_iterator.next(__context__,(__x_rename_at_32)) && __y_iterator.next(__context__,(__y_rename_at_32)) )
+			{
+				if ( (*__x_rename_at_32) != (*__y_rename_at_32) )
+				{
+					return das_auto_cast<bool>::cast(true);
+				};
+			}
+			__x_iterator.close(__context__,(__x_rename_at_32));
+			__y_iterator.close(__context__,(__y_rename_at_32));
+		};
+		return das_auto_cast<bool>::cast(false);
+	};
+}
+
+inline bool test_84d7773f38040831 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,2608,"test " DAS_FILE_LINE);
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_50_32;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_56_208;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_64_432;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_63_448;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_71_464;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_70_480;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_78_512;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_77_528;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_85_544;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_84_560;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_93_592;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_92_608;
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_91_624;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_90_640;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_106_880;
+	TDim<bool,2> _temp_make_local_155_1664;
+	TArray<int32_t> _temp_make_local_208_2224;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_207_2256;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_206_2272;
+	TArray<int32_t> _temp_make_local_216_2288;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_215_2320;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_226_2336;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_225_2352;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_224_2368;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_227_2384;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) _temp_make_local_234_2416;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) _temp_make_local_233_2432;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _temp_make_local_232_2448;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _temp_make_local_235_2480;
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_242_2512;
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_241_2528;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_240_2544;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_243_2576;
+	_Func_0x60_verify_even_7e6d5ca7b65b79bf(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_50_32 = (_Funcbuiltin_0x60_each_ref_77eafe8c9006a0(__context__,das_ascend<bool,_lambda_thismodule_50_23_4>::make(__context__,&__type_info__6cde42349a0dc4e2,(([&]() -> _lambda_thismodule_50_23_4 {
+		_lambda_thismodule_50_23_4 __mks_50;
+		das_zero(__mks_50);
+		das_copy((__mks_50.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_50_23_4`function XS<::_lambda_thismodule_50_23_4> &1<Ci>?*/ 2670477349306073666u))));
+		das_copy((__mks_50.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_50_23_4`finalizer X1<S<::_lambda_thismodule_50_23_4>>?*/ 12851092492806755024u))));
+		return __mks_50;
+	})())))))));
+	_Func_0x60_verify_even_6703252febc142e7(__context__,das_arg<TArray<int32_t>>::pass(das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_53_rename_at_53; das_zero(____acomp_53_rename_at_53);
+		{
+			bool __need_loop_53 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,100));
+			int32_t __x_rename_at_53;
+			__need_loop_53 = __x_iterator.first(__context__,(__x_rename_at_53)) && __need_loop_53;
+			for ( ; __need_loop_53 ; __need_loop_53 = __x_iterator.next(__context__,(__x_rename_at_53)) )
+			{
+				if ( (SimPolicy<int32_t>::Mod(__x_rename_at_53,2,*__context__,nullptr)) == 0 )
+				{
+					_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____acomp_53_rename_at_53),__x_rename_at_53);
+				};
+			}
+			__x_iterator.close(__context__,(__x_rename_at_53));
+		};
+		return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(____acomp_53_rename_at_53)));
+	})));
+	_Func_0x60_verify_14_c7953d9d52dffeef(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_56_208 = (_Funcbuiltin_0x60_each_7f633a072c41b03c(__context__,das_ascend<bool,_lambda_thismodule_56_21_10>::make(__context__,&__type_info__bbbb40b84cc1be8d,(([&]() -> _lambda_thismodule_56_21_10 {
+		_lambda_thismodule_56_21_10 __mks_56;
+		das_zero(__mks_56);
+		das_copy((__mks_56.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_56_21_10`function XS<::_lambda_thismodule_56_21_10> 1<i>A*/ 945866718390883397u))));
+		das_copy((__mks_56.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_56_21_10`finalizer X1<S<::_lambda_thismodule_56_21_10>>?*/ 16622501033528147810u))));
+		return __mks_56;
+	})())))))));
+	_Func_0x60_verify_14_ad9c7b801e624df0(__context__,das_arg<TArray<TArray<int32_t>>>::pass(das_invoke<TArray<TArray<int32_t>>>::invoke_cmres(__context__,nullptr,[&]()->TArray<TArray<int32_t>>{
+		TArray<TArray<int32_t>> ____acomp_59_rename_at_59; das_zero(____acomp_59_rename_at_59);
+		{
+			bool __need_loop_59 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(1,4));
+			int32_t __x_rename_at_59;
+			__need_loop_59 = __x_iterator.first(__context__,(__x_rename_at_59)) && __need_loop_59;
+			for ( ; __need_loop_59 ; __need_loop_59 = __x_iterator.next(__context__,(__x_rename_at_59)) )
+			{
+				TArray<int32_t> _temp_make_local_59_384;
+				TDim<int32_t,2> _temp_make_local_59_416;
+				_Funcbuiltin_0x60_emplace_46aeb6a61c4e9221(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____acomp_59_rename_at_59),das_arg<TArray<int32_t>>::pass((_temp_make_local_59_384 = (_Funcbuiltin_0x60_to_array_move_8095aad6f5b96480(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+					_temp_make_local_59_416(0,__context__) = __x_rename_at_59;
+					_temp_make_local_59_416(1,__context__) = 2;
+					return _temp_make_local_59_416;
+				})())))))));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_59));
+		};
+		return /* <- */ das_auto_cast_move<TArray<TArray<int32_t>>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_39e9c05a08e7d337(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____acomp_59_rename_at_59)));
+	})));
+	_Func_0x60_verify_even_b071089197a7ced6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_64_432 = (_Funcfunctional_0x60_filter_196d50d6a5b657be(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_63_448 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,100))))),Func(__context__->fnByMangledName(/*is_even Ci*/ 13416377918219290010u)))))));
+	_Func_0x60_verify_even_b071089197a7ced6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_71_464 = (_Funcfunctional_0x60_filter_53efa21008623dcb(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_70_480 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,100))))),das_ascend<bool,_lambda_thismodule_71_25_14>::make(__context__,&__type_info__6eaa4ee09cf6186c,(([&]() -> _lambda_thismodule_71_25_14 {
+		_lambda_thismodule_71_25_14 __mks_71;
+		das_copy((__mks_71.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_71_25_14`function XS<::_lambda_thismodule_71_25_14> Ci*/ 5833227212949650636u))));
+		das_copy((__mks_71.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_71_25_14`finalizer X1<S<::_lambda_thismodule_71_25_14>>?*/ 17323985314034454032u))));
+		return __mks_71;
+	})())))))));
+	_Func_0x60_verify_even_b071089197a7ced6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_78_512 = (_Funcfunctional_0x60_map_a60435d0c6456bd4(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_77_528 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,50))))),Func(__context__->fnByMangledName(/*twice Ci*/ 8053380109654962965u)))))));
+	_Func_0x60_verify_even_b071089197a7ced6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_85_544 = (_Funcfunctional_0x60_map_58dc263556f6d651(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_84_560 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,50))))),das_ascend<int32_t,_lambda_thismodule_85_28_1>::make(__context__,&__type_info__2feb34e5d3529432,(([&]() -> _lambda_thismodule_85_28_1 {
+		_lambda_thismodule_85_28_1 __mks_85;
+		das_copy((__mks_85.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_85_28_1`function XS<::_lambda_thismodule_85_28_1> Ci*/ 7553957166788205930u))));
+		das_copy((__mks_85.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_85_28_1`finalizer X1<S<::_lambda_thismodule_85_28_1>>?*/ 4424892993805582696u))));
+		return __mks_85;
+	})())))))));
+	_Func_0x60_verify_even_b071089197a7ced6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_93_592 = (_Funcfunctional_0x60_map_82ad2f6322b2be3d(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_92_608 = (_Funcfunctional_0x60_map_cb33d88d14d2480d(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_91_624 = (_Funcfunctional_0x60_filter_64323d9de00083a(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_90_640 = (_Funcbuiltin_0x60_each_7f633a072c41b03c(__context__,das_ascend<bool,_lambda_thismodule_90_14_11>::make(__context__,&__type_info__2f475a6f20815946,(([&]() -> _lambda_thismodule_90_14_11 {
+		_lambda_thismodule_90_14_11 __mks_90;
+		das_zero(__mks_90);
+		das_copy((__mks_90.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_90_14_11`function XS<::_lambda_thismodule_90_14_11> 1<i>A*/ 8752476815890222389u))));
+		das_copy((__mks_90.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_90_14_11`finalizer X1<S<::_lambda_thismodule_90_14_11>>?*/ 7977738798050276396u))));
+		return __mks_90;
+	})())))))),das_ascend<bool,_lambda_thismodule_91_25_26>::make(__context__,&__type_info__25a520ad1b30fd9,(([&]() -> _lambda_thismodule_91_25_26 {
+		_lambda_thismodule_91_25_26 __mks_91;
+		das_copy((__mks_91.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_91_25_26`function XS<::_lambda_thismodule_91_25_26> C1<i>A*/ 7486578186552142202u))));
+		das_copy((__mks_91.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_91_25_26`finalizer X1<S<::_lambda_thismodule_91_25_26>>?*/ 6208914807321435222u))));
+		return __mks_91;
+	})())))))),das_ascend<TArray<int32_t>,_lambda_thismodule_92_36_32>::make(__context__,&__type_info__d85a88cb0811b649,(([&]() -> _lambda_thismodule_92_36_32 {
+		_lambda_thismodule_92_36_32 __mks_92;
+		das_copy((__mks_92.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_92_36_32`function XS<::_lambda_thismodule_92_36_32> C1<i>A*/ 5831925149992380994u))));
+		das_copy((__mks_92.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_92_36_32`finalizer X1<S<::_lambda_thismodule_92_36_32>>?*/ 4579485301633637370u))));
+		return __mks_92;
+	})())))))),das_ascend<int32_t,_lambda_thismodule_93_29_35>::make(__context__,&__type_info__6a3930e350d8b9e7,(([&]() -> _lambda_thismodule_93_29_35 {
+		_lambda_thismodule_93_29_35 __mks_93;
+		das_copy((__mks_93.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_93_29_35`function XS<::_lambda_thismodule_93_29_35> C1<i>A*/ 10431591211831891946u))));
+		das_copy((__mks_93.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_93_29_35`finalizer X1<S<::_lambda_thismodule_93_29_35>>?*/ 10794705547767295626u))));
+		return __mks_93;
+	})())))))));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,das_invoke<int32_t>::invoke(__context__,nullptr,[&]()->int32_t{
+		int32_t ____fuse_100_12_acc_rename_at_375 = 0;
+		bool ____fuse_100_12_first_rename_at_377 = true;
+		{
+			bool __need_loop_416 = true;
+			// __fuse_100_12_src : int const
+			das_iterator<range> ____fuse_100_12_src_iterator(range(0,10));
+			int32_t ____fuse_100_12_src_rename_at_416;
+			__need_loop_416 = ____fuse_100_12_src_iterator.first(__context__,(____fuse_100_12_src_rename_at_416)) && __need_loop_416;
+			for ( ; __need_loop_416 ; __need_loop_416 = ____fuse_100_12_src_iterator.next(__context__,(____fuse_100_12_src_rename_at_416)) )
+			{
+				if ( ____fuse_100_12_first_rename_at_377 )
+				{
+					das_copy(____fuse_100_12_first_rename_at_377,false);
+					das_copy(____fuse_100_12_acc_rename_at_375,____fuse_100_12_src_rename_at_416);
+				} else {
+					das_copy(____fuse_100_12_acc_rename_at_375,das_invoke<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,[&](int32_t const  __x_rename_at_100, int32_t const  __y_rename_at_100)->int32_t{
+						return das_auto_cast<int32_t>::cast(__x_rename_at_100 + __y_rename_at_100);
+					},____fuse_100_12_acc_rename_at_375,____fuse_100_12_src_rename_at_416));
+				};
+			}
+			____fuse_100_12_src_iterator.close(__context__,(____fuse_100_12_src_rename_at_416));
+		};
+		if ( ____fuse_100_12_first_rename_at_377 )
+		{
+			builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		};
+		return das_auto_cast<int32_t>::cast(____fuse_100_12_acc_rename_at_375);
+	}),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,_Funcfunctional_0x60_reduce_7c596f6a790683f4(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_106_880 = (_Funcbuiltin_0x60_each_ref_77eafe8c9006a0(__context__,das_ascend<bool,_lambda_thismodule_106_15_5>::make(__context__,&__type_info__a177731b62cb70ec,(([&]() -> _lambda_thismodule_106_15_5 {
+		_lambda_thismodule_106_15_5 __mks_106;
+		das_zero(__mks_106);
+		das_copy((__mks_106.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_106_15_5`function XS<::_lambda_thismodule_106_15_5> &1<Ci>?*/ 6772321299619138280u))));
+		das_copy((__mks_106.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_106_15_5`finalizer X1<S<::_lambda_thismodule_106_15_5>>?*/ 17401491653742923728u))));
+		return __mks_106;
+	})())))))),das_make_block<int32_t,int32_t,int32_t>(__context__,960,0,&__func_info__d38a664a1724371c,[&](int32_t const  __x_rename_at_107, int32_t const  __y_rename_at_107)->int32_t{
+		return das_auto_cast<int32_t>::cast(__x_rename_at_107 + __y_rename_at_107);
+	})),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,das_invoke<int32_t>::invoke(__context__,nullptr,[&]()->int32_t{
+		Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) ____fuse_115_12_fn_rename_at_285; das_zero(____fuse_115_12_fn_rename_at_285); das_move(____fuse_115_12_fn_rename_at_285, das_ascend<int32_t,_lambda_thismodule_115_27_15>::make(__context__,&__type_info__1dfcb9675860dcfc,(([&]() -> _lambda_thismodule_115_27_15 {
+			_lambda_thismodule_115_27_15 __mks_285;
+			das_copy((__mks_285.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_115_27_15`function XS<::_lambda_thismodule_115_27_15> Ci Ci*/ 15458072574639753146u))));
+			das_copy((__mks_285.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_115_27_15`finalizer X1<S<::_lambda_thismodule_115_27_15>>?*/ 8844705764011535640u))));
+			return __mks_285;
+		})())));
+		int32_t ____fuse_115_12_acc_rename_at_375 = 0;
+		bool ____fuse_115_12_first_rename_at_377 = true;
+		{
+			bool __need_loop_416 = true;
+			// __fuse_115_12_src : int const
+			das_iterator<range> ____fuse_115_12_src_iterator(range(0,10));
+			int32_t ____fuse_115_12_src_rename_at_416;
+			__need_loop_416 = ____fuse_115_12_src_iterator.first(__context__,(____fuse_115_12_src_rename_at_416)) && __need_loop_416;
+			for ( ; __need_loop_416 ; __need_loop_416 = ____fuse_115_12_src_iterator.next(__context__,(____fuse_115_12_src_rename_at_416)) )
+			{
+				if ( ____fuse_115_12_first_rename_at_377 )
+				{
+					das_copy(____fuse_115_12_first_rename_at_377,false);
+					das_copy(____fuse_115_12_acc_rename_at_375,____fuse_115_12_src_rename_at_416);
+				} else {
+					das_copy(____fuse_115_12_acc_rename_at_375,das_invoke_lambda<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,____fuse_115_12_fn_rename_at_285,____fuse_115_12_acc_rename_at_375,____fuse_115_12_src_rename_at_416));
+				};
+			}
+			____fuse_115_12_src_iterator.close(__context__,(____fuse_115_12_src_rename_at_416));
+		};
+		if ( ____fuse_115_12_first_rename_at_377 )
+		{
+			builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		};
+		return das_auto_cast<int32_t>::cast(____fuse_115_12_acc_rename_at_375);
+	}),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,das_invoke<int32_t>::invoke(__context__,nullptr,[&]()->int32_t{
+		Func DAS_COMMENT((int32_t,int32_t,int32_t)) ____fuse_123_12_fn_rename_at_285; das_zero(____fuse_123_12_fn_rename_at_285); das_move(____fuse_123_12_fn_rename_at_285, Func(__context__->fnByMangledName(/*add Ci Ci*/ 18334826246998135716u)));
+		int32_t ____fuse_123_12_acc_rename_at_375 = 0;
+		bool ____fuse_123_12_first_rename_at_377 = true;
+		{
+			bool __need_loop_416 = true;
+			// __fuse_123_12_src : int const
+			das_iterator<range> ____fuse_123_12_src_iterator(range(0,10));
+			int32_t ____fuse_123_12_src_rename_at_416;
+			__need_loop_416 = ____fuse_123_12_src_iterator.first(__context__,(____fuse_123_12_src_rename_at_416)) && __need_loop_416;
+			for ( ; __need_loop_416 ; __need_loop_416 = ____fuse_123_12_src_iterator.next(__context__,(____fuse_123_12_src_rename_at_416)) )
+			{
+				if ( ____fuse_123_12_first_rename_at_377 )
+				{
+					das_copy(____fuse_123_12_first_rename_at_377,false);
+					das_copy(____fuse_123_12_acc_rename_at_375,____fuse_123_12_src_rename_at_416);
+				} else {
+					das_copy(____fuse_123_12_acc_rename_at_375,das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,____fuse_123_12_fn_rename_at_285,____fuse_123_12_acc_rename_at_375,____fuse_123_12_src_rename_at_416));
+				};
+			}
+			____fuse_123_12_src_iterator.close(__context__,(____fuse_123_12_src_rename_at_416));
+		};
+		if ( ____fuse_123_12_first_rename_at_377 )
+		{
+			builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		};
+		return das_auto_cast<int32_t>::cast(____fuse_123_12_acc_rename_at_375);
+	}),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,das_invoke<int32_t>::invoke(__context__,nullptr,[&]()->int32_t{
+		Func DAS_COMMENT((int32_t,int32_t,int32_t)) ____fuse_131_12_fn_rename_at_285; das_zero(____fuse_131_12_fn_rename_at_285); das_move(____fuse_131_12_fn_rename_at_285, Func(__context__->fnByMangledName(/*add Ci Ci*/ 18334826246998135716u)));
+		int32_t ____fuse_131_12_acc_rename_at_375 = 0;
+		bool ____fuse_131_12_first_rename_at_377 = true;
+		{
+			bool __need_loop_416 = true;
+			// __fuse_131_12_src : int const
+			das_iterator<range> ____fuse_131_12_src_iterator(range(45,46));
+			int32_t ____fuse_131_12_src_rename_at_416;
+			__need_loop_416 = ____fuse_131_12_src_iterator.first(__context__,(____fuse_131_12_src_rename_at_416)) && __need_loop_416;
+			for ( ; __need_loop_416 ; __need_loop_416 = ____fuse_131_12_src_iterator.next(__context__,(____fuse_131_12_src_rename_at_416)) )
+			{
+				if ( ____fuse_131_12_first_rename_at_377 )
+				{
+					das_copy(____fuse_131_12_first_rename_at_377,false);
+					das_copy(____fuse_131_12_acc_rename_at_375,____fuse_131_12_src_rename_at_416);
+				} else {
+					das_copy(____fuse_131_12_acc_rename_at_375,das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,____fuse_131_12_fn_rename_at_285,____fuse_131_12_acc_rename_at_375,____fuse_131_12_src_rename_at_416));
+				};
+			}
+			____fuse_131_12_src_iterator.close(__context__,(____fuse_131_12_src_rename_at_416));
+		};
+		if ( ____fuse_131_12_first_rename_at_377 )
+		{
+			builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		};
+		return das_auto_cast<int32_t>::cast(____fuse_131_12_acc_rename_at_375);
+	}),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,_Func_0x60_first_7932efd700c6a809(__context__,das_arg<TTuple<8,int32_t,float>>::pass(das_invoke<TTuple<8,int32_t,float>>::invoke_cmres(__context__,nullptr,[&]()->TTuple<8,int32_t,float>{
+		Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) ____fuse_140_12_0_fn_rename_at_285; das_zero(____fuse_140_12_0_fn_rename_at_285); das_move(____fuse_140_12_0_fn_rename_at_285, das_ascend<TTuple<8,int32_t,float>,_lambda_thismodule_139_28_6>::make(__context__,&__type_info__8875b5a4bb8f230d,(([&]() -> _lambda_thismodule_139_28_6 {
+			_lambda_thismodule_139_28_6 __mks_139;
+			das_copy((__mks_139.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_139_28_6`function XS<::_lambda_thismodule_139_28_6> Ci*/ 10337168955661683764u))));
+			das_copy((__mks_139.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_139_28_6`finalizer X1<S<::_lambda_thismodule_139_28_6>>?*/ 101448240992313054u))));
+			return __mks_139;
+		})())));
+		TTuple<8,int32_t,float> ____fuse_140_12_acc_rename_at_375; das_zero(____fuse_140_12_acc_rename_at_375);
+		bool ____fuse_140_12_first_rename_at_377 = true;
+		{
+			bool __need_loop_416 = true;
+			// __fuse_140_12_src : int const
+			das_iterator<range> ____fuse_140_12_src_iterator(range(0,10));
+			int32_t ____fuse_140_12_src_rename_at_416;
+			__need_loop_416 = ____fuse_140_12_src_iterator.first(__context__,(____fuse_140_12_src_rename_at_416)) && __need_loop_416;
+			for ( ; __need_loop_416 ; __need_loop_416 = ____fuse_140_12_src_iterator.next(__context__,(____fuse_140_12_src_rename_at_416)) )
+			{
+				TTuple<8,int32_t,float> ____fuse_140_12_0_rename_at_324 = das_invoke_lambda<TTuple<8,int32_t,float>>::invoke_cmres<int32_t>(__context__,nullptr,____fuse_140_12_0_fn_rename_at_285,____fuse_140_12_src_rename_at_416);
+				if ( ____fuse_140_12_first_rename_at_377 )
+				{
+					das_copy(____fuse_140_12_first_rename_at_377,false);
+					das_copy(____fuse_140_12_acc_rename_at_375,____fuse_140_12_0_rename_at_324);
+				} else {
+					das_copy(____fuse_140_12_acc_rename_at_375,das_invoke<TTuple<8,int32_t,float> const >::invoke_cmres<TTuple<8,int32_t,float> &,TTuple<8,int32_t,float> &>(__context__,nullptr,[&](TTuple<8,int32_t,float> const  & __x_rename_at_140, TTuple<8,int32_t,float> const  & __y_rename_at_140)->TTuple<8,int32_t,float> const {
+						return das_auto_cast_ref<TTuple<8,int32_t,float> const >::cast((([&]() -> TTuple<8,int32_t,float> {
+							TTuple<8,int32_t,float> __mkt_140;
+							das_get_tuple_field<int32_t,0>::get(__mkt_140) = (das_get_tuple_field<int32_t,0>::get(__x_rename_at_140) + das_get_tuple_field<int32_t,0>::get(__y_rename_at_140));
+							das_get_tuple_field<float,4>::get(__mkt_140) = 2.f;
+							return __mkt_140;
+						})()));
+					},das_arg<TTuple<8,int32_t,float>>::pass(____fuse_140_12_acc_rename_at_375),das_arg<TTuple<8,int32_t,float>>::pass(____fuse_140_12_0_rename_at_324)));
+				};
+			}
+			____fuse_140_12_src_iterator.close(__context__,(____fuse_140_12_src_rename_at_416));
+		};
+		if ( ____fuse_140_12_first_rename_at_377 )
+		{
+			builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		};
+		return das_auto_cast_ref<TTuple<8,int32_t,float>>::cast(____fuse_140_12_acc_rename_at_375);
+	}))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,das_invoke<int32_t>::invoke(__context__,nullptr,[&]()->int32_t{
+		int32_t ____fuse_149_12_acc_rename_at_363 = 0;
+		{
+			bool __need_loop_416 = true;
+			// __fuse_149_12_src : int const
+			das_iterator<range> ____fuse_149_12_src_iterator(range(0,10));
+			int32_t ____fuse_149_12_src_rename_at_416;
+			__need_loop_416 = ____fuse_149_12_src_iterator.first(__context__,(____fuse_149_12_src_rename_at_416)) && __need_loop_416;
+			for ( ; __need_loop_416 ; __need_loop_416 = ____fuse_149_12_src_iterator.next(__context__,(____fuse_149_12_src_rename_at_416)) )
+			{
+				____fuse_149_12_acc_rename_at_363 += ____fuse_149_12_src_rename_at_416;
+			}
+			____fuse_149_12_src_iterator.close(__context__,(____fuse_149_12_src_rename_at_416));
+		};
+		return das_auto_cast<int32_t>::cast(____fuse_149_12_acc_rename_at_363);
+	}),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_any_a5606ed295f053c9(__context__,das_arg<TDim<bool,2>>::pass((([&]() -> TDim<bool,2>& {
+		_temp_make_local_155_1664(0,__context__) = true;
+		_temp_make_local_155_1664(1,__context__) = false;
+		return _temp_make_local_155_1664;
+	})())))));
+	DAS_VERIFY((_Funcfunctional_0x60_not_4c37d11112acdd2e(__context__,das_invoke<bool>::invoke(__context__,nullptr,[&]()->bool{
+		Lambda DAS_COMMENT((bool,int32_t)) ____fuse_164_12_0_fn_rename_at_285; das_zero(____fuse_164_12_0_fn_rename_at_285); das_move(____fuse_164_12_0_fn_rename_at_285, das_ascend<bool,_lambda_thismodule_163_30_16>::make(__context__,&__type_info__3c724274ce6fd088,(([&]() -> _lambda_thismodule_163_30_16 {
+			_lambda_thismodule_163_30_16 __mks_163;
+			das_copy((__mks_163.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_163_30_16`function XS<::_lambda_thismodule_163_30_16> Ci*/ 6967241967881677426u))));
+			das_copy((__mks_163.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_163_30_16`finalizer X1<S<::_lambda_thismodule_163_30_16>>?*/ 16540221710712481608u))));
+			return __mks_163;
+		})())));
+		{
+			bool __need_loop_416 = true;
+			// __fuse_164_12_src : int const
+			das_iterator<range> ____fuse_164_12_src_iterator(range(0,10));
+			int32_t ____fuse_164_12_src_rename_at_416;
+			__need_loop_416 = ____fuse_164_12_src_iterator.first(__context__,(____fuse_164_12_src_rename_at_416)) && __need_loop_416;
+			for ( ; __need_loop_416 ; __need_loop_416 = ____fuse_164_12_src_iterator.next(__context__,(____fuse_164_12_src_rename_at_416)) )
+			{
+				bool ____fuse_164_12_0_rename_at_324 = das_invoke_lambda<bool>::invoke<int32_t>(__context__,nullptr,____fuse_164_12_0_fn_rename_at_285,____fuse_164_12_src_rename_at_416);
+				if ( ____fuse_164_12_0_rename_at_324 )
+				{
+					return das_auto_cast<bool>::cast(true);
+				};
+			}
+			____fuse_164_12_src_iterator.close(__context__,(____fuse_164_12_src_rename_at_416));
+		};
+		return das_auto_cast<bool>::cast(false);
+	}))));
+	DAS_VERIFY((das_invoke<bool>::invoke(__context__,nullptr,[&]()->bool{
+		Lambda DAS_COMMENT((bool,int32_t)) ____fuse_173_12_0_fn_rename_at_285; das_zero(____fuse_173_12_0_fn_rename_at_285); das_move(____fuse_173_12_0_fn_rename_at_285, das_ascend<bool,_lambda_thismodule_172_30_17>::make(__context__,&__type_info__cd1cc76c0b5b3a3b,(([&]() -> _lambda_thismodule_172_30_17 {
+			_lambda_thismodule_172_30_17 __mks_172;
+			das_copy((__mks_172.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_172_30_17`function XS<::_lambda_thismodule_172_30_17> Ci*/ 13223761252910389548u))));
+			das_copy((__mks_172.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_172_30_17`finalizer X1<S<::_lambda_thismodule_172_30_17>>?*/ 16557156517026331416u))));
+			return __mks_172;
+		})())));
+		{
+			bool __need_loop_416 = true;
+			// __fuse_173_12_src : int const
+			das_iterator<range> ____fuse_173_12_src_iterator(range(0,10));
+			int32_t ____fuse_173_12_src_rename_at_416;
+			__need_loop_416 = ____fuse_173_12_src_iterator.first(__context__,(____fuse_173_12_src_rename_at_416)) && __need_loop_416;
+			for ( ; __need_loop_416 ; __need_loop_416 = ____fuse_173_12_src_iterator.next(__context__,(____fuse_173_12_src_rename_at_416)) )
+			{
+				bool ____fuse_173_12_0_rename_at_324 = das_invoke_lambda<bool>::invoke<int32_t>(__context__,nullptr,____fuse_173_12_0_fn_rename_at_285,____fuse_173_12_src_rename_at_416);
+				if ( !____fuse_173_12_0_rename_at_324 )
+				{
+					return das_auto_cast<bool>::cast(false);
+				};
+			}
+			____fuse_173_12_src_iterator.close(__context__,(____fuse_173_12_src_rename_at_416));
+		};
+		return das_auto_cast<bool>::cast(true);
+	})));
+	DAS_VERIFY((_Funcfunctional_0x60_not_4c37d11112acdd2e(__context__,das_invoke<bool>::invoke(__context__,nullptr,[&]()->bool{
+		Lambda DAS_COMMENT((bool,int32_t)) ____fuse_183_12_0_fn_rename_at_285; das_zero(____fuse_183_12_0_fn_rename_at_285); das_move(____fuse_183_12_0_fn_rename_at_285, das_ascend<bool,_lambda_thismodule_180_30_18>::make(__context__,&__type_info__bd650e7b2b33be23,(([&]() -> _lambda_thismodule_180_30_18 {
+			_lambda_thismodule_180_30_18 __mks_180;
+			das_copy((__mks_180.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_180_30_18`function XS<::_lambda_thismodule_180_30_18> Ci*/ 16289326180299914960u))));
+			das_copy((__mks_180.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_180_30_18`finalizer X1<S<::_lambda_thismodule_180_30_18>>?*/ 16085197035545635080u))));
+			return __mks_180;
+		})())));
+		{
+			bool __need_loop_416 = true;
+			// __fuse_183_12_src : int const
+			das_iterator<range> ____fuse_183_12_src_iterator(range(0,10));
+			int32_t ____fuse_183_12_src_rename_at_416;
+			__need_loop_416 = ____fuse_183_12_src_iterator.first(__context__,(____fuse_183_12_src_rename_at_416)) && __need_loop_416;
+			for ( ; __need_loop_416 ; __need_loop_416 = ____fuse_183_12_src_iterator.next(__context__,(____fuse_183_12_src_rename_at_416)) )
+			{
+				bool ____fuse_183_12_0_rename_at_324 = das_invoke_lambda<bool>::invoke<int32_t>(__context__,nullptr,____fuse_183_12_0_fn_rename_at_285,____fuse_183_12_src_rename_at_416);
+				if ( !____fuse_183_12_0_rename_at_324 )
+				{
+					return das_auto_cast<bool>::cast(false);
+				};
+			}
+			____fuse_183_12_src_iterator.close(__context__,(____fuse_183_12_src_rename_at_416));
+		};
+		return das_auto_cast<bool>::cast(true);
+	}))));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,das_invoke<int32_t>::invoke(__context__,nullptr,[&]()->int32_t{
+		int32_t ____fuse_192_12_0_count_rename_at_342 = 0;
+		int32_t ____fuse_192_12_acc_rename_at_363 = 0;
+		{
+			bool __need_loop_416 = true;
+			// __fuse_192_12_src : int const
+			das_iterator<range> ____fuse_192_12_src_iterator(range(0,10));
+			int32_t ____fuse_192_12_src_rename_at_416;
+			__need_loop_416 = ____fuse_192_12_src_iterator.first(__context__,(____fuse_192_12_src_rename_at_416)) && __need_loop_416;
+			for ( ; __need_loop_416 ; __need_loop_416 = ____fuse_192_12_src_iterator.next(__context__,(____fuse_192_12_src_rename_at_416)) )
+			{
+				if ( ____fuse_192_12_0_count_rename_at_342 >= 4 )
+				{
+					break;
+				} else {
+					if ( ____fuse_192_12_0_count_rename_at_342++ < 1 )
+					{
+						continue;
+					} else {
+						____fuse_192_12_acc_rename_at_363 += ____fuse_192_12_src_rename_at_416;
+					};
+				};
+			}
+			____fuse_192_12_src_iterator.close(__context__,(____fuse_192_12_src_rename_at_416));
+		};
+		return das_auto_cast<int32_t>::cast(____fuse_192_12_acc_rename_at_363);
+	}),6)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,das_invoke<int32_t>::invoke(__context__,nullptr,[&]()->int32_t{
+		Sequence DAS_COMMENT((int32_t)) _temp_make_local_416_2192;
+		int32_t ____fuse_200_12_0_count_rename_at_342 = 0;
+		int32_t ____fuse_200_12_acc_rename_at_363 = 0;
+		{
+			bool __need_loop_416 = true;
+			// __fuse_200_12_src : int
+			das_iterator<Sequence DAS_COMMENT((int32_t))> ____fuse_200_12_src_iterator((_temp_make_local_416_2192 = (_Funcfunctional_0x60_count_7119d72d72fe3e50(__context__,0,10))));
+			int32_t ____fuse_200_12_src_rename_at_416;
+			__need_loop_416 = ____fuse_200_12_src_iterator.first(__context__,(____fuse_200_12_src_rename_at_416)) && __need_loop_416;
+			for ( ; __need_loop_416 ; __need_loop_416 = ____fuse_200_12_src_iterator.next(__context__,(____fuse_200_12_src_rename_at_416)) )
+			{
+				if ( ____fuse_200_12_0_count_rename_at_342 >= 10 )
+				{
+					break;
+				} else {
+					if ( ____fuse_200_12_0_count_rename_at_342++ < 0 )
+					{
+						continue;
+					} else {
+						____fuse_200_12_acc_rename_at_363 += ____fuse_200_12_src_rename_at_416;
+					};
+				};
+			}
+			____fuse_200_12_src_iterator.close(__context__,(____fuse_200_12_src_rename_at_416));
+		};
+		return das_auto_cast<int32_t>::cast(____fuse_200_12_acc_rename_at_363);
+	}),450)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,builtin_array_size(das_arg<TArray<int32_t>>::pass((_temp_make_local_208_2224 = (_Funcbuiltin_0x60_to_array_937a16f0c7f42db(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_207_2256 = (_Funcfunctional_0x60_islice_b171313d5fbcf9e0(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_206_2272 = (_Funcfunctional_0x60_repeat_a8c2dce35f26e7e0(__context__,10,0)))),0,5))))))))),5)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,builtin_array_size(das_arg<TArray<int32_t>>::pass((_temp_make_local_216_2288 = (_Funcbuiltin_0x60_to_array_937a16f0c7f42db(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_215_2320 = (_Funcfunctional_0x60_repeat_a8c2dce35f26e7e0(__context__,10,6))))))))),6)));
+	DAS_VERIFY((_Func_0x60_is_same_8d62f8edc4df68d8(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_226_2336 = (_Funcfunctional_0x60_islice_b171313d5fbcf9e0(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_225_2352 = (_Funcfunctional_0x60_cycle_ccb8645ee9ac4b14(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_224_2368 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(1,4))))))))),0,10)))),das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_227_2384 = (_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_227_19_7>::make(__context__,&__type_info__db27357fa3eaaa3e,(([&]() -> _lambda_thismodule_227_19_7 {
+		_lambda_thismodule_227_19_7 __mks_227;
+		das_zero(__mks_227);
+		das_copy((__mks_227.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_227_19_7`function XS<::_lambda_thismodule_227_19_7> &i*/ 14000129570724364177u))));
+		das_copy((__mks_227.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_227_19_7`finalizer X1<S<::_lambda_thismodule_227_19_7>>?*/ 1520284161826329556u))));
+		return __mks_227;
+	})())))))))));
+	DAS_VERIFY((_Func_0x60_is_same_84e5a5cb0f2aec39(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_234_2416 = (_Funcfunctional_0x60_islice_ed9efbf4e50742f0(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_233_2432 = (_Funcfunctional_0x60_cycle_db50944d1b917eec(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_232_2448 = (_Funcbuiltin_0x60_each_5b8f7b8f8a92acc2(__context__,das_ascend<bool,_lambda_thismodule_232_10_8>::make(__context__,&__type_info__fe5a5d63abb87972,(([&]() -> _lambda_thismodule_232_10_8 {
+		_lambda_thismodule_232_10_8 __mks_232;
+		das_zero(__mks_232);
+		das_copy((__mks_232.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_232_10_8`function XS<::_lambda_thismodule_232_10_8> 0<i;f>U*/ 13898216724500756851u))));
+		das_copy((__mks_232.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_232_10_8`finalizer X1<S<::_lambda_thismodule_232_10_8>>?*/ 17503386922363931336u))));
+		return __mks_232;
+	})())))))))))),0,10)))),das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_235_2480 = (_Funcbuiltin_0x60_each_5b8f7b8f8a92acc2(__context__,das_ascend<bool,_lambda_thismodule_235_18_9>::make(__context__,&__type_info__1c031d28e891379a,(([&]() -> _lambda_thismodule_235_18_9 {
+		_lambda_thismodule_235_18_9 __mks_235;
+		das_zero(__mks_235);
+		das_copy((__mks_235.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_235_18_9`function XS<::_lambda_thismodule_235_18_9> 0<i;f>U*/ 17532435174113720731u))));
+		das_copy((__mks_235.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_235_18_9`finalizer X1<S<::_lambda_thismodule_235_18_9>>?*/ 6243026897735230540u))));
+		return __mks_235;
+	})())))))))));
+	DAS_VERIFY((_Func_0x60_is_same_b2ee21551accec13(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_242_2512 = (_Funcfunctional_0x60_islice_51a3045a357b5024(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_241_2528 = (_Funcfunctional_0x60_cycle_a78805a0131a894d(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_240_2544 = (_Funcbuiltin_0x60_each_7f633a072c41b03c(__context__,das_ascend<bool,_lambda_thismodule_240_10_12>::make(__context__,&__type_info__561b702296a83038,(([&]() -> _lambda_thismodule_240_10_12 {
+		_lambda_thismodule_240_10_12 __mks_240;
+		das_zero(__mks_240);
+		das_copy((__mks_240.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_240_10_12`function XS<::_lambda_thismodule_240_10_12> 1<i>A*/ 9303789722340153559u))));
+		das_copy((__mks_240.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_240_10_12`finalizer X1<S<::_lambda_thismodule_240_10_12>>?*/ 13001115373317045936u))));
+		return __mks_240;
+	})())))))))))),0,10)))),das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_243_2576 = (_Funcbuiltin_0x60_each_7f633a072c41b03c(__context__,das_ascend<bool,_lambda_thismodule_243_18_13>::make(__context__,&__type_info__aacae256c3713dd6,(([&]() -> _lambda_thismodule_243_18_13 {
+		_lambda_thismodule_243_18_13 __mks_243;
+		das_zero(__mks_243);
+		das_copy((__mks_243.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_243_18_13`function XS<::_lambda_thismodule_243_18_13> 1<i>A*/ 9720217594959356831u))));
+		das_copy((__mks_243.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_243_18_13`finalizer X1<S<::_lambda_thismodule_243_18_13>>?*/ 1624281604795845336u))));
+		return __mks_243;
+	})())))))))));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_54bf1348c9b80490
+	aotLib[0x2d0e47ea865955c2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_36_12_36 &  ),&finalize_54bf1348c9b80490>>();
+	};
+	// _Func_lambda_thismodule_36_12_36_0x60_function_f70e75692c84d121
+	aotLib[0xea6c769cb865aa09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_36_12_36 & , int32_t &  ),&_Func_lambda_thismodule_36_12_36_0x60_function_f70e75692c84d121>>();
+	};
+	// _Func_lambda_thismodule_36_12_36_0x60_finalizer_16d59ce0493ea764
+	aotLib[0xa83716ba10e0b5d3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_36_12_36 *  ),&_Func_lambda_thismodule_36_12_36_0x60_finalizer_16d59ce0493ea764>>();
+	};
+	// finalize_a7122cc19257df9a
+	aotLib[0xd5fe2b2c25e0148d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_93_29_35 &  ),&finalize_a7122cc19257df9a>>();
+	};
+	// _Func_lambda_thismodule_93_29_35_0x60_function_9952822083039823
+	aotLib[0x9bb9a44d74a4c4d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, _lambda_thismodule_93_29_35 & , TArray<int32_t> const  &  ),&_Func_lambda_thismodule_93_29_35_0x60_function_9952822083039823>>();
+	};
+	// _Func_lambda_thismodule_93_29_35_0x60_finalizer_77b7ae3fdea0e0ca
+	aotLib[0x6b4e4415e02a3ffd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_93_29_35 *  ),&_Func_lambda_thismodule_93_29_35_0x60_finalizer_77b7ae3fdea0e0ca>>();
+	};
+	// _Funcfunctional_0x60_map_any_9262de0c50f54bad
+	aotLib[0x7f2f7119875dcd76] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((int32_t,TArray<int32_t> const ))  ),&_Funcfunctional_0x60_map_any_9262de0c50f54bad>>();
+	};
+	// _Funcfunctional_0x60_map_82ad2f6322b2be3d
+	aotLib[0x95ee1e2ffb8565d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const   ),&_Funcfunctional_0x60_map_82ad2f6322b2be3d>>();
+	};
+	// finalize_c6c82fde31fdb2e6
+	aotLib[0x2a798b40888d2519] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_41_12_34 &  ),&finalize_c6c82fde31fdb2e6>>();
+	};
+	// _Func_lambda_thismodule_41_12_34_0x60_function_fbe3de92257c0070
+	aotLib[0x58074307ac720a0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_41_12_34 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_41_12_34_0x60_function_fbe3de92257c0070>>();
+	};
+	// _Func_lambda_thismodule_41_12_34_0x60_finalizer_7303256f4aeb3774
+	aotLib[0x583d3e101e8fed0a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_41_12_34 *  ),&_Func_lambda_thismodule_41_12_34_0x60_finalizer_7303256f4aeb3774>>();
+	};
+	// _Func_0x60_is_same_b2ee21551accec13
+	aotLib[0x8e28dbb598257b4f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) const  & , Sequence DAS_COMMENT((TArray<int32_t>)) const  &  ),&_Func_0x60_is_same_b2ee21551accec13>>();
+	};
+	// finalize_fae068741c4996d9
+	aotLib[0x655202b0dd0ed9a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_163_12_33 &  ),&finalize_fae068741c4996d9>>();
+	};
+	// _Func_0x60_is_same_84e5a5cb0f2aec39
+	aotLib[0xf104f53c45501321] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) const  & , Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  ),&_Func_0x60_is_same_84e5a5cb0f2aec39>>();
+	};
+	// finalize_b0bb974ccdd5181b
+	aotLib[0x9b34ec383bbb7ef1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_163_12_31 &  ),&finalize_b0bb974ccdd5181b>>();
+	};
+	// finalize_3f3f5513ea66b214
+	aotLib[0x9d38f712032a61c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_92_36_32 &  ),&finalize_3f3f5513ea66b214>>();
+	};
+	// _Func_lambda_thismodule_163_12_33_0x60_function_f8080823c69e3cdd
+	aotLib[0x111b3920e06062b7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_163_12_33 & , TArray<int32_t> * &  ),&_Func_lambda_thismodule_163_12_33_0x60_function_f8080823c69e3cdd>>();
+	};
+	// _Func_lambda_thismodule_163_12_33_0x60_finalizer_965919f06d889a76
+	aotLib[0x86e20b8ca9424255] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_163_12_33 *  ),&_Func_lambda_thismodule_163_12_33_0x60_finalizer_965919f06d889a76>>();
+	};
+	// _Funcbuiltin_0x60_finalize_ca527b18279269a0
+	aotLib[0xe4bbb0213c59f442] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> &  ),&_Funcbuiltin_0x60_finalize_ca527b18279269a0>>();
+	};
+	// _Func_lambda_thismodule_163_12_31_0x60_function_748a5459db8fb549
+	aotLib[0xbacbba9508a467fb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_163_12_31 & , TTuple<8,int32_t,float> * &  ),&_Func_lambda_thismodule_163_12_31_0x60_function_748a5459db8fb549>>();
+	};
+	// _Func_lambda_thismodule_163_12_31_0x60_finalizer_5625720652b77ce2
+	aotLib[0x795f9c81aa20298e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_163_12_31 *  ),&_Func_lambda_thismodule_163_12_31_0x60_finalizer_5625720652b77ce2>>();
+	};
+	// _Funcbuiltin_0x60_finalize_943699eaf2940908
+	aotLib[0xa3f5c118930fbae3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<8,int32_t,float>> &  ),&_Funcbuiltin_0x60_finalize_943699eaf2940908>>();
+	};
+	// _Funcbuiltin_0x60_clone_7775f70b42a34990
+	aotLib[0xbde965effb9cac8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_7775f70b42a34990>>();
+	};
+	// _Func_lambda_thismodule_92_36_32_0x60_function_cc78477825a25340
+	aotLib[0x9253233b31b2cf0e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, _lambda_thismodule_92_36_32 & , TArray<int32_t> const  &  ),&_Func_lambda_thismodule_92_36_32_0x60_function_cc78477825a25340>>();
+	};
+	// _Func_lambda_thismodule_92_36_32_0x60_finalizer_cc7541e2ca708852
+	aotLib[0x7a0e77dc85bcd4c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_92_36_32 *  ),&_Func_lambda_thismodule_92_36_32_0x60_finalizer_cc7541e2ca708852>>();
+	};
+	// _Funcfunctional_0x60_map_any_17b6b876d76660ef
+	aotLib[0x89d989b76bb43fa3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t>)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & , Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const ))  ),&_Funcfunctional_0x60_map_any_17b6b876d76660ef>>();
+	};
+	// finalize_554c45dda146b8a6
+	aotLib[0x44f1f99164dafc69] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<8,int32_t,float> &  ),&finalize_554c45dda146b8a6>>();
+	};
+	// _Funcbuiltin_0x60_each_e5c085c7199596c7
+	aotLib[0x3d1d6c1e748b8145] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, TArray<TArray<int32_t>> const  &  ),&_Funcbuiltin_0x60_each_e5c085c7199596c7>>();
+	};
+	// _Funcbuiltin_0x60_finalize_c5f896860856389a
+	aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+	// _Funcfunctional_0x60_map_cb33d88d14d2480d
+	aotLib[0x10d8880e9f2904fa] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t>)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & , Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const   ),&_Funcfunctional_0x60_map_cb33d88d14d2480d>>();
+	};
+	// _Func_0x60_first_7932efd700c6a809
+	aotLib[0xf10802b672f22f95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTuple<8,int32_t,float> const  &  ),&_Func_0x60_first_7932efd700c6a809>>();
+	};
+	// finalize_f88f9c056c2aa22b
+	aotLib[0xb12ad0db75652d7a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_20_12_30 &  ),&finalize_f88f9c056c2aa22b>>();
+	};
+	// _Funcfunctional_0x60_reduce_any_7bf095d1cee7b6d8
+	aotLib[0x580522c6187739ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTuple<8,int32_t,float> (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & , Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  ),&_Funcfunctional_0x60_reduce_any_7bf095d1cee7b6d8>>();
+	};
+	// _Funcbuiltin_0x60_each_6a927dd59cc9e5af
+	aotLib[0x575449b94eb1ad09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, TArray<TTuple<8,int32_t,float>> const  &  ),&_Funcbuiltin_0x60_each_6a927dd59cc9e5af>>();
+	};
+	// _Funcfunctional_0x60_not_4c37d11112acdd2e
+	aotLib[0xb4a3b9bed97b34bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, bool  ),&_Funcfunctional_0x60_not_4c37d11112acdd2e>>();
+	};
+	// _Funcfunctional_0x60_islice_51a3045a357b5024
+	aotLib[0x1166b6e9f04bcc06] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & , int32_t , int32_t  ),&_Funcfunctional_0x60_islice_51a3045a357b5024>>();
+	};
+	// finalize_fd89e81470ac2037
+	aotLib[0x6d5cfe0d37bbfa37] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_142_12_29 &  ),&finalize_fd89e81470ac2037>>();
+	};
+	// _Func_lambda_thismodule_20_12_30_0x60_function_2a3c166be85a47a1
+	aotLib[0x1a14c3fdc9a7248d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_20_12_30 & , TArray<int32_t> * &  ),&_Func_lambda_thismodule_20_12_30_0x60_function_2a3c166be85a47a1>>();
+	};
+	// _Func_lambda_thismodule_20_12_30_0x60_finalizer_9ebeff833b3b3714
+	aotLib[0x1d4564a36cdd0fe7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_20_12_30 *  ),&_Func_lambda_thismodule_20_12_30_0x60_finalizer_9ebeff833b3b3714>>();
+	};
+	// _Funcbuiltin_0x60_each_ref_ab33c386e8c5b2f6
+	aotLib[0x8ba63e978865ba5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const   ),&_Funcbuiltin_0x60_each_ref_ab33c386e8c5b2f6>>();
+	};
+	// _Funcfunctional_0x60_reduce_8ae7fcb7e421f194
+	aotLib[0xd46de31f8a46e781] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTuple<8,int32_t,float> (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & , Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  ),&_Funcfunctional_0x60_reduce_8ae7fcb7e421f194>>();
+	};
+	// _Funcfunctional_0x60_islice_ed9efbf4e50742f0
+	aotLib[0x3c402cd661da74e2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) & , int32_t , int32_t  ),&_Funcfunctional_0x60_islice_ed9efbf4e50742f0>>();
+	};
+	// finalize_688b941ccc3b70f0
+	aotLib[0x32d11968ac3a76cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_142_12_28 &  ),&finalize_688b941ccc3b70f0>>();
+	};
+	// _Funcbuiltin_0x60_each_a87e3fc9767b4917
+	aotLib[0xa9042b9c676edab5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t &)) (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_each_a87e3fc9767b4917>>();
+	};
+	// _Funcbuiltin_0x60_push_clone_17e595ccf2ea82f6
+	aotLib[0x3a62a4c26bd7b39d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_push_clone_17e595ccf2ea82f6>>();
+	};
+	// _Func_lambda_thismodule_142_12_29_0x60_function_4ac001e1c9c805bd
+	aotLib[0x9fd64cb2c70013f2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_142_12_29 & , TArray<int32_t> * &  ),&_Func_lambda_thismodule_142_12_29_0x60_function_4ac001e1c9c805bd>>();
+	};
+	// _Func_lambda_thismodule_142_12_29_0x60_finalizer_7197b61db218f9f4
+	aotLib[0x254ac4dfe8413afa] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_142_12_29 *  ),&_Func_lambda_thismodule_142_12_29_0x60_finalizer_7197b61db218f9f4>>();
+	};
+	// _Funcbuiltin_0x60_each_ref_dd86c289804be67a
+	aotLib[0xc47ca9a8c8f594e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const   ),&_Funcbuiltin_0x60_each_ref_dd86c289804be67a>>();
+	};
+	// _Func_0x60_verify_even_b071089197a7ced6
+	aotLib[0x2f4f13f8dc531f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Func_0x60_verify_even_b071089197a7ced6>>();
+	};
+	// _Funcfunctional_0x60_any_cf35c74e31a01f2b
+	aotLib[0xeaf0278bd17dcedd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  ),&_Funcfunctional_0x60_any_cf35c74e31a01f2b>>();
+	};
+	// _Funcfunctional_0x60_all_927327c38b4c115b
+	aotLib[0x9b17e5fc8e4a0529] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  ),&_Funcfunctional_0x60_all_927327c38b4c115b>>();
+	};
+	// _Func_0x60_is_same_8d62f8edc4df68d8
+	aotLib[0x193fcd887c4f4985] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Sequence DAS_COMMENT((int32_t)) const  &  ),&_Func_0x60_is_same_8d62f8edc4df68d8>>();
+	};
+	// finalize_40e8d0f1b8f49c52
+	aotLib[0x5e0d1f533dafa8c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_14_12_21 &  ),&finalize_40e8d0f1b8f49c52>>();
+	};
+	// finalize_40ecfde5d647179b
+	aotLib[0xd15e9831b6263185] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_14_12_22 &  ),&finalize_40ecfde5d647179b>>();
+	};
+	// finalize_26e26b1d9e5eee70
+	aotLib[0xde80b8e2b2268339] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_36_12_23 &  ),&finalize_26e26b1d9e5eee70>>();
+	};
+	// finalize_c73f35326dfaded9
+	aotLib[0x75ffbcb5011bed81] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_36_12_24 &  ),&finalize_c73f35326dfaded9>>();
+	};
+	// finalize_2b16ae00fd6cbbd8
+	aotLib[0xd7fed082cdafb0f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_91_25_26 &  ),&finalize_2b16ae00fd6cbbd8>>();
+	};
+	// _Funcbuiltin_0x60_push_clone_bede40064f7c66cf
+	aotLib[0x18f9089c8573c2d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<8,int32_t,float>> & , TTuple<8,int32_t,float> const  &  ),&_Funcbuiltin_0x60_push_clone_bede40064f7c66cf>>();
+	};
+	// _Func_lambda_thismodule_142_12_28_0x60_function_cdeb562fe872f9e2
+	aotLib[0x619a01d2b2633c30] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_142_12_28 & , TTuple<8,int32_t,float> * &  ),&_Func_lambda_thismodule_142_12_28_0x60_function_cdeb562fe872f9e2>>();
+	};
+	// _Func_lambda_thismodule_142_12_28_0x60_finalizer_7db4fed5bf632358
+	aotLib[0x930b8a87cc168c65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_142_12_28 *  ),&_Func_lambda_thismodule_142_12_28_0x60_finalizer_7db4fed5bf632358>>();
+	};
+	// finalize_91466dc60be5ec6
+	aotLib[0xbe111a0cb5ff14d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_157_12_19 &  ),&finalize_91466dc60be5ec6>>();
+	};
+	// finalize_3c0e41d6a28cffe3
+	aotLib[0xf0808cdbd1446e2e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_130_12_20 &  ),&finalize_3c0e41d6a28cffe3>>();
+	};
+	// _Func_lambda_thismodule_14_12_21_0x60_function_f174bcd7545caa8a
+	aotLib[0xeb2f11e2786c8b85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_14_12_21 & , int32_t &  ),&_Func_lambda_thismodule_14_12_21_0x60_function_f174bcd7545caa8a>>();
+	};
+	// _Func_lambda_thismodule_14_12_21_0x60_finalizer_82f817fdaad6b024
+	aotLib[0x21dcbbc34b850282] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_14_12_21 *  ),&_Func_lambda_thismodule_14_12_21_0x60_finalizer_82f817fdaad6b024>>();
+	};
+	// _Func_lambda_thismodule_14_12_22_0x60_function_e557eee355d39963
+	aotLib[0xf7332e36fc7482c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_14_12_22 & , int32_t &  ),&_Func_lambda_thismodule_14_12_22_0x60_function_e557eee355d39963>>();
+	};
+	// _Func_lambda_thismodule_14_12_22_0x60_finalizer_2f37f530a0cea82c
+	aotLib[0xc23528dfe7215fa8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_14_12_22 *  ),&_Func_lambda_thismodule_14_12_22_0x60_finalizer_2f37f530a0cea82c>>();
+	};
+	// _Func_lambda_thismodule_36_12_23_0x60_function_f95273975fd7764
+	aotLib[0x8af898c01e6dc1e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_36_12_23 & , int32_t &  ),&_Func_lambda_thismodule_36_12_23_0x60_function_f95273975fd7764>>();
+	};
+	// _Func_lambda_thismodule_36_12_23_0x60_finalizer_6ba2205dab2f7198
+	aotLib[0x1e94e4be4156a3f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_36_12_23 *  ),&_Func_lambda_thismodule_36_12_23_0x60_finalizer_6ba2205dab2f7198>>();
+	};
+	// _Func_lambda_thismodule_36_12_24_0x60_function_ccba983e2210c435
+	aotLib[0x1f7f2a4c0b7da1b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_36_12_24 & , int32_t &  ),&_Func_lambda_thismodule_36_12_24_0x60_function_ccba983e2210c435>>();
+	};
+	// _Func_lambda_thismodule_36_12_24_0x60_finalizer_508212161cc2a60c
+	aotLib[0x5611fd67db32f960] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_36_12_24 *  ),&_Func_lambda_thismodule_36_12_24_0x60_finalizer_508212161cc2a60c>>();
+	};
+	// _Func_lambda_thismodule_91_25_26_0x60_function_15f2a680f0c86a65
+	aotLib[0x3ff8af4f35cea115] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_91_25_26 & , TArray<int32_t> const  &  ),&_Func_lambda_thismodule_91_25_26_0x60_function_15f2a680f0c86a65>>();
+	};
+	// _Func_lambda_thismodule_91_25_26_0x60_finalizer_17737d2831ca41c6
+	aotLib[0x51a59350ccbee87e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_91_25_26 *  ),&_Func_lambda_thismodule_91_25_26_0x60_finalizer_17737d2831ca41c6>>();
+	};
+	// _Funcfunctional_0x60_filter_any_e29162d675421b2b
+	aotLib[0xcf3aa3e8bab7b40b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((bool,TArray<int32_t> const ))  ),&_Funcfunctional_0x60_filter_any_e29162d675421b2b>>();
+	};
+	// _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07
+	aotLib[0x44c6ff6768abbc55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> &  ),&_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07>>();
+	};
+	// _Func_lambda_thismodule_157_12_19_0x60_function_4cc416e65d0f7490
+	aotLib[0xc5423afed1cef0a7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_157_12_19 & , int32_t &  ),&_Func_lambda_thismodule_157_12_19_0x60_function_4cc416e65d0f7490>>();
+	};
+	// _Func_lambda_thismodule_157_12_19_0x60_finalizer_3f8bbd6bdc9ad954
+	aotLib[0xbe540b1c94f9201e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_157_12_19 *  ),&_Func_lambda_thismodule_157_12_19_0x60_finalizer_3f8bbd6bdc9ad954>>();
+	};
+	// _Func_lambda_thismodule_130_12_20_0x60_function_3df999ebdcd26a1f
+	aotLib[0xe4764e620e23503f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_130_12_20 & , int32_t &  ),&_Func_lambda_thismodule_130_12_20_0x60_function_3df999ebdcd26a1f>>();
+	};
+	// _Func_lambda_thismodule_130_12_20_0x60_finalizer_226fe41329c877cc
+	aotLib[0x30a9db261de30b81] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_130_12_20 *  ),&_Func_lambda_thismodule_130_12_20_0x60_finalizer_226fe41329c877cc>>();
+	};
+	// finalize_d2bdfafa2f479e21
+	aotLib[0x67dc79e5bf7d4d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_71_25_14 &  ),&finalize_d2bdfafa2f479e21>>();
+	};
+	// _Funcfunctional_0x60_reduce_any_e3cd3f9a12b0fb52
+	aotLib[0x67fff219c4a4ea09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_any_e3cd3f9a12b0fb52>>();
+	};
+	// finalize_b1fbd3f7f17aa107
+	aotLib[0x2a2c25d1169bb081] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_115_27_15 &  ),&finalize_b1fbd3f7f17aa107>>();
+	};
+	// finalize_4e811d32879905fb
+	aotLib[0x944ba510df1512d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_163_30_16 &  ),&finalize_4e811d32879905fb>>();
+	};
+	// finalize_9241f8123a6109c0
+	aotLib[0xe1eedb34cbdc7bf9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_172_30_17 &  ),&finalize_9241f8123a6109c0>>();
+	};
+	// finalize_3da670ae0d0fd49c
+	aotLib[0xa47707c93124647d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_180_30_18 &  ),&finalize_3da670ae0d0fd49c>>();
+	};
+	// _Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e
+	aotLib[0x683c44aa23b4b64d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Func_0x60_verify_14_c7953d9d52dffeef
+	aotLib[0xdfef0bdba8dc12e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) const  &  ),&_Func_0x60_verify_14_c7953d9d52dffeef>>();
+	};
+	// _Funcfunctional_0x60_filter_64323d9de00083a
+	aotLib[0x1ce2c0611dabed6f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const   ),&_Funcfunctional_0x60_filter_64323d9de00083a>>();
+	};
+	// _Funcfunctional_0x60_cycle_a78805a0131a894d
+	aotLib[0x2179f15c1671808a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  ),&_Funcfunctional_0x60_cycle_a78805a0131a894d>>();
+	};
+	// finalize_dca9089a796b169e
+	aotLib[0xee807ba376e56789] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_56_21_10 &  ),&finalize_dca9089a796b169e>>();
+	};
+	// finalize_3c00f319f5878b9f
+	aotLib[0xc3df21be9eaefe61] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_90_14_11 &  ),&finalize_3c00f319f5878b9f>>();
+	};
+	// finalize_95e8646aced816cb
+	aotLib[0xb13322d9b7ead269] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_240_10_12 &  ),&finalize_95e8646aced816cb>>();
+	};
+	// finalize_5d81d27f4ab6f1ad
+	aotLib[0x9508fc5632cf05d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_243_18_13 &  ),&finalize_5d81d27f4ab6f1ad>>();
+	};
+	// _Func_0x60_verify_even_7e6d5ca7b65b79bf
+	aotLib[0x63c7e9a0ef114741] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  ),&_Func_0x60_verify_even_7e6d5ca7b65b79bf>>();
+	};
+	// _Funcbuiltin_0x60_each_7f633a072c41b03c
+	aotLib[0x424c8986aefc8339] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t>)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t>)) const   ),&_Funcbuiltin_0x60_each_7f633a072c41b03c>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_39e9c05a08e7d337
+	aotLib[0xf3462d9f5cd6c419] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<TArray<int32_t>> & (*) ( Context * __context__, TArray<TArray<int32_t>> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_39e9c05a08e7d337>>();
+	};
+	// _Func_lambda_thismodule_71_25_14_0x60_function_4ef28c57d655e61b
+	aotLib[0xebccb3be27d0b6e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_71_25_14 & , int32_t  ),&_Func_lambda_thismodule_71_25_14_0x60_function_4ef28c57d655e61b>>();
+	};
+	// _Func_lambda_thismodule_71_25_14_0x60_finalizer_1de86f8b7e406fde
+	aotLib[0xcc63117a478adc5f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_71_25_14 *  ),&_Func_lambda_thismodule_71_25_14_0x60_finalizer_1de86f8b7e406fde>>();
+	};
+	// _Funcfunctional_0x60_is_equal_2af44bbc0bb6f328
+	aotLib[0xed006e1459e96d11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t , int32_t  ),&_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328>>();
+	};
+	// _Funcfunctional_0x60_reduce_7c596f6a790683f4
+	aotLib[0xb2d5c836b554d76b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_7c596f6a790683f4>>();
+	};
+	// _Func_lambda_thismodule_115_27_15_0x60_function_76c593a2d975afd9
+	aotLib[0xb1a1544dc1b70689] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, _lambda_thismodule_115_27_15 & , int32_t , int32_t  ),&_Func_lambda_thismodule_115_27_15_0x60_function_76c593a2d975afd9>>();
+	};
+	// _Func_lambda_thismodule_115_27_15_0x60_finalizer_b7ae6dadf312675a
+	aotLib[0xa5fc347f2f1995e6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_115_27_15 *  ),&_Func_lambda_thismodule_115_27_15_0x60_finalizer_b7ae6dadf312675a>>();
+	};
+	// _Func_lambda_thismodule_163_30_16_0x60_function_7c6e7fcacb6ae853
+	aotLib[0xe128c2d9cab5e035] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_163_30_16 & , int32_t  ),&_Func_lambda_thismodule_163_30_16_0x60_function_7c6e7fcacb6ae853>>();
+	};
+	// _Func_lambda_thismodule_163_30_16_0x60_finalizer_1efff7382e84e2aa
+	aotLib[0x90595d2504eddbf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_163_30_16 *  ),&_Func_lambda_thismodule_163_30_16_0x60_finalizer_1efff7382e84e2aa>>();
+	};
+	// _Func_lambda_thismodule_172_30_17_0x60_function_42c5b6ebaac79686
+	aotLib[0xcbc1273b086b310d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_172_30_17 & , int32_t  ),&_Func_lambda_thismodule_172_30_17_0x60_function_42c5b6ebaac79686>>();
+	};
+	// _Func_lambda_thismodule_172_30_17_0x60_finalizer_8ed4bb4bd4545e60
+	aotLib[0x154b6a1d40cc71a8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_172_30_17 *  ),&_Func_lambda_thismodule_172_30_17_0x60_finalizer_8ed4bb4bd4545e60>>();
+	};
+	// _Func_lambda_thismodule_180_30_18_0x60_function_d983c4a30551bc1c
+	aotLib[0xf94d719ae433068d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_180_30_18 & , int32_t  ),&_Func_lambda_thismodule_180_30_18_0x60_function_d983c4a30551bc1c>>();
+	};
+	// _Func_lambda_thismodule_180_30_18_0x60_finalizer_526d77f2b8437988
+	aotLib[0xe895d4dd55f97f2a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_180_30_18 *  ),&_Func_lambda_thismodule_180_30_18_0x60_finalizer_526d77f2b8437988>>();
+	};
+	// _Funcbuiltin_0x60_to_array_937a16f0c7f42db
+	aotLib[0xd5858834f9027884] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Funcbuiltin_0x60_to_array_937a16f0c7f42db>>();
+	};
+	// _Funcfunctional_0x60_cycle_db50944d1b917eec
+	aotLib[0x2d78fdb9f324048c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  ),&_Funcfunctional_0x60_cycle_db50944d1b917eec>>();
+	};
+	// finalize_fbc79084dd3275de
+	aotLib[0x9730b90c932937d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_173_8_2 &  ),&finalize_fbc79084dd3275de>>();
+	};
+	// finalize_ea9711ac7e396704
+	aotLib[0x9bed7afeaf698835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_190_8_3 &  ),&finalize_ea9711ac7e396704>>();
+	};
+	// finalize_50a2b26c59df4fa5
+	aotLib[0x900a6b7adb72958d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_50_23_4 &  ),&finalize_50a2b26c59df4fa5>>();
+	};
+	// _Funcfunctional_0x60_filter_any_2ae23ac41016a34a
+	aotLib[0xc0f1aeb475f8e4f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_filter_any_2ae23ac41016a34a>>();
+	};
+	// _Funcfunctional_0x60_filter_any_f8dac28aa0dd5ec0
+	aotLib[0x58e092a315235737] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_filter_any_f8dac28aa0dd5ec0>>();
+	};
+	// _Funcfunctional_0x60_map_any_6e0944b71f858323
+	aotLib[0x4f8a24319c8901a6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((int32_t,int32_t))  ),&_Funcfunctional_0x60_map_any_6e0944b71f858323>>();
+	};
+	// _Funcfunctional_0x60_map_any_c16fd10e29077412
+	aotLib[0x9128099ba3bae988] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((int32_t,int32_t))  ),&_Funcfunctional_0x60_map_any_c16fd10e29077412>>();
+	};
+	// _Funcfunctional_0x60_reduce_any_e8c9be3d74e2ec87
+	aotLib[0xc47f533689667429] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_any_e8c9be3d74e2ec87>>();
+	};
+	// finalize_1141d7256c227d21
+	aotLib[0xb77e767401933ed9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_106_15_5 &  ),&finalize_1141d7256c227d21>>();
+	};
+	// _Funcfunctional_0x60_reduce_any_1eddf981a5714858
+	aotLib[0x91d29e8b5ed60c71] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_any_1eddf981a5714858>>();
+	};
+	// _Funcfunctional_0x60_reduce_any_6430db396ca81d22
+	aotLib[0x31d7e016a60f45d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Func DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_any_6430db396ca81d22>>();
+	};
+	// finalize_18fe4fcb57354a0c
+	aotLib[0xa1b51673a2c93b6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_139_28_6 &  ),&finalize_18fe4fcb57354a0c>>();
+	};
+	// finalize_36a3b02b1fb3dcf7
+	aotLib[0x12cf0178d7c5a5fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_227_19_7 &  ),&finalize_36a3b02b1fb3dcf7>>();
+	};
+	// finalize_a109dfbebfbc079f
+	aotLib[0x1e843425a469981d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_232_10_8 &  ),&finalize_a109dfbebfbc079f>>();
+	};
+	// finalize_daf2db5be95cd687
+	aotLib[0xbe1022c473cd9485] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_235_18_9 &  ),&finalize_daf2db5be95cd687>>();
+	};
+	// _Funcbuiltin_0x60_each_2290b067fc65760f
+	aotLib[0x2174fbe7e898cabd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_2290b067fc65760f>>();
+	};
+	// _Funcbuiltin_0x60_each_ref_77eafe8c9006a0
+	aotLib[0x16fe52960f26f455] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const   ),&_Funcbuiltin_0x60_each_ref_77eafe8c9006a0>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd
+	aotLib[0x66e322246598e835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> & (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd>>();
+	};
+	// _Func_lambda_thismodule_56_21_10_0x60_function_eaac258aa9c0d84a
+	aotLib[0x571d5eb8b1f11804] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_56_21_10 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_56_21_10_0x60_function_eaac258aa9c0d84a>>();
+	};
+	// _Func_lambda_thismodule_56_21_10_0x60_finalizer_6390258da803cc74
+	aotLib[0x4c21d5e5ac150206] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_56_21_10 *  ),&_Func_lambda_thismodule_56_21_10_0x60_finalizer_6390258da803cc74>>();
+	};
+	// _Funcbuiltin_0x60_emplace_46aeb6a61c4e9221
+	aotLib[0xcf2120c183f7a219] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> & , TArray<int32_t> &  ),&_Funcbuiltin_0x60_emplace_46aeb6a61c4e9221>>();
+	};
+	// _Func_0x60_verify_14_ad9c7b801e624df0
+	aotLib[0x9a7e7eea6d8192f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> const  &  ),&_Func_0x60_verify_14_ad9c7b801e624df0>>();
+	};
+	// _Func_lambda_thismodule_90_14_11_0x60_function_7c8af860540bcf86
+	aotLib[0x6d54706759b2d910] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_90_14_11 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_90_14_11_0x60_function_7c8af860540bcf86>>();
+	};
+	// _Func_lambda_thismodule_90_14_11_0x60_finalizer_398faab869104a98
+	aotLib[0x30d145301b4fe9d7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_90_14_11 *  ),&_Func_lambda_thismodule_90_14_11_0x60_finalizer_398faab869104a98>>();
+	};
+	// _Funcbuiltin_0x60_each_5b8f7b8f8a92acc2
+	aotLib[0x5ff902efa64c797d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const   ),&_Funcbuiltin_0x60_each_5b8f7b8f8a92acc2>>();
+	};
+	// _Func_lambda_thismodule_240_10_12_0x60_function_4e2050b2cd3a10f7
+	aotLib[0x60c9dc071f9503f8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_240_10_12 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_240_10_12_0x60_function_4e2050b2cd3a10f7>>();
+	};
+	// _Func_lambda_thismodule_240_10_12_0x60_finalizer_722f889b1020677c
+	aotLib[0xad9b34ea3256bfc7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_240_10_12 *  ),&_Func_lambda_thismodule_240_10_12_0x60_finalizer_722f889b1020677c>>();
+	};
+	// _Func_lambda_thismodule_243_18_13_0x60_function_8457e9c7a37377d
+	aotLib[0x698309b3be06e8e8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_243_18_13 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_243_18_13_0x60_function_8457e9c7a37377d>>();
+	};
+	// _Func_lambda_thismodule_243_18_13_0x60_finalizer_5c6dfa59ff707404
+	aotLib[0xef4c4fc64acb0770] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_243_18_13 *  ),&_Func_lambda_thismodule_243_18_13_0x60_finalizer_5c6dfa59ff707404>>();
+	};
+	// finalize_2e9b369ff6b06689
+	aotLib[0xfe6880a5162199ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_85_28_1 &  ),&finalize_2e9b369ff6b06689>>();
+	};
+	// _Func_lambda_thismodule_173_8_2_0x60_function_a2d0530164e71c37
+	aotLib[0x457cb20fa066d421] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_173_8_2 & , int32_t &  ),&_Func_lambda_thismodule_173_8_2_0x60_function_a2d0530164e71c37>>();
+	};
+	// _Func_lambda_thismodule_173_8_2_0x60_finalizer_4907142523166368
+	aotLib[0x71b10718af9bac1b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_173_8_2 *  ),&_Func_lambda_thismodule_173_8_2_0x60_finalizer_4907142523166368>>();
+	};
+	// _Func_lambda_thismodule_190_8_3_0x60_function_20eecf34434e56ab
+	aotLib[0x312e98f4d03a7ae3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_190_8_3 & , int32_t &  ),&_Func_lambda_thismodule_190_8_3_0x60_function_20eecf34434e56ab>>();
+	};
+	// _Func_lambda_thismodule_190_8_3_0x60_finalizer_d00fbd4aff2c7106
+	aotLib[0x1e3b40e9fdea3ecd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_190_8_3 *  ),&_Func_lambda_thismodule_190_8_3_0x60_finalizer_d00fbd4aff2c7106>>();
+	};
+	// _Func_lambda_thismodule_50_23_4_0x60_function_acc8ccfc59a727e8
+	aotLib[0x12227083d5a3c043] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_50_23_4 & , int32_t const  * &  ),&_Func_lambda_thismodule_50_23_4_0x60_function_acc8ccfc59a727e8>>();
+	};
+	// _Func_lambda_thismodule_50_23_4_0x60_finalizer_d48a0c4dc1dec02c
+	aotLib[0x8571a4e804bfecbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_50_23_4 *  ),&_Func_lambda_thismodule_50_23_4_0x60_finalizer_d48a0c4dc1dec02c>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Func_0x60_verify_even_6703252febc142e7
+	aotLib[0xd222e52d59a18749] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Func_0x60_verify_even_6703252febc142e7>>();
+	};
+	// _Funcfunctional_0x60_filter_196d50d6a5b657be
+	aotLib[0xc172b452e8a347ae] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_filter_196d50d6a5b657be>>();
+	};
+	// _Funcfunctional_0x60_filter_53efa21008623dcb
+	aotLib[0x80e96326790b0bda] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_filter_53efa21008623dcb>>();
+	};
+	// _Funcfunctional_0x60_map_a60435d0c6456bd4
+	aotLib[0x849ea5e7e6e6b8a4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((int32_t,int32_t)) const   ),&_Funcfunctional_0x60_map_a60435d0c6456bd4>>();
+	};
+	// _Funcfunctional_0x60_map_58dc263556f6d651
+	aotLib[0x8c6ea8fff6eee87b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((int32_t,int32_t)) const   ),&_Funcfunctional_0x60_map_58dc263556f6d651>>();
+	};
+	// _Funcfunctional_0x60_reduce_417083d1002ee3c4
+	aotLib[0x6b6edd05caf1b85a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_417083d1002ee3c4>>();
+	};
+	// _Func_lambda_thismodule_106_15_5_0x60_function_4edb7cf4dd0af38f
+	aotLib[0x86ff1fe4dc741967] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_106_15_5 & , int32_t const  * &  ),&_Func_lambda_thismodule_106_15_5_0x60_function_4edb7cf4dd0af38f>>();
+	};
+	// _Func_lambda_thismodule_106_15_5_0x60_finalizer_b87dcc28f4b26ad4
+	aotLib[0x57c3d99eb6882ae3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_106_15_5 *  ),&_Func_lambda_thismodule_106_15_5_0x60_finalizer_b87dcc28f4b26ad4>>();
+	};
+	// _Funcfunctional_0x60_reduce_8fbeb127951de7b8
+	aotLib[0xd310d4f5cc7d67a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_8fbeb127951de7b8>>();
+	};
+	// _Funcfunctional_0x60_reduce_c78f959eee6d541d
+	aotLib[0xce07eb76c8fef060] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Func DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_c78f959eee6d541d>>();
+	};
+	// _Func_lambda_thismodule_139_28_6_0x60_function_ecdee715a1fae593
+	aotLib[0xf7a7c1486298abf9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTuple<8,int32_t,float> (*) ( Context * __context__, _lambda_thismodule_139_28_6 & , int32_t  ),&_Func_lambda_thismodule_139_28_6_0x60_function_ecdee715a1fae593>>();
+	};
+	// _Func_lambda_thismodule_139_28_6_0x60_finalizer_b747e97a7829fa46
+	aotLib[0xe8c473a85585f4b7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_139_28_6 *  ),&_Func_lambda_thismodule_139_28_6_0x60_finalizer_b747e97a7829fa46>>();
+	};
+	// _Funcfunctional_0x60_sum_c6bb83657fd0ca16
+	aotLib[0xf14d34f54916e785] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Funcfunctional_0x60_sum_c6bb83657fd0ca16>>();
+	};
+	// _Funcfunctional_0x60_islice_b171313d5fbcf9e0
+	aotLib[0xbc6c15a38df7865a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , int32_t , int32_t  ),&_Funcfunctional_0x60_islice_b171313d5fbcf9e0>>();
+	};
+	// _Funcfunctional_0x60_cycle_ccb8645ee9ac4b14
+	aotLib[0x57693480a2eb4023] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  ),&_Funcfunctional_0x60_cycle_ccb8645ee9ac4b14>>();
+	};
+	// _Func_lambda_thismodule_227_19_7_0x60_function_1cec87bec4f6e7e1
+	aotLib[0xf3b131fe778fc47f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_227_19_7 & , int32_t &  ),&_Func_lambda_thismodule_227_19_7_0x60_function_1cec87bec4f6e7e1>>();
+	};
+	// _Func_lambda_thismodule_227_19_7_0x60_finalizer_f6e0cad214e51598
+	aotLib[0x77900dd802ebcd22] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_227_19_7 *  ),&_Func_lambda_thismodule_227_19_7_0x60_finalizer_f6e0cad214e51598>>();
+	};
+	// _Func_lambda_thismodule_232_10_8_0x60_function_1b9e5aecd83626ed
+	aotLib[0x79d2116123510587] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_232_10_8 & , TTuple<8,int32_t,float> &  ),&_Func_lambda_thismodule_232_10_8_0x60_function_1b9e5aecd83626ed>>();
+	};
+	// _Func_lambda_thismodule_232_10_8_0x60_finalizer_f0c678795587145c
+	aotLib[0xb1e787faf5eb31cf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_232_10_8 *  ),&_Func_lambda_thismodule_232_10_8_0x60_finalizer_f0c678795587145c>>();
+	};
+	// _Func_lambda_thismodule_235_18_9_0x60_function_87eca29eb8b63ff
+	aotLib[0x77386766840803fb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_235_18_9 & , TTuple<8,int32_t,float> &  ),&_Func_lambda_thismodule_235_18_9_0x60_function_87eca29eb8b63ff>>();
+	};
+	// _Func_lambda_thismodule_235_18_9_0x60_finalizer_f01773fb180129d8
+	aotLib[0xc04d2bc1809e669] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_235_18_9 *  ),&_Func_lambda_thismodule_235_18_9_0x60_finalizer_f01773fb180129d8>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_8095aad6f5b96480
+	aotLib[0x4128e4dc2cc12101] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,2> &  ),&_Funcbuiltin_0x60_to_array_move_8095aad6f5b96480>>();
+	};
+	// _Funcbuiltin_0x60_each_5cbab1dfe9635bc1
+	aotLib[0x8c2bf3089ff8b6f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_5cbab1dfe9635bc1>>();
+	};
+	// _Func_lambda_thismodule_85_28_1_0x60_function_bddb2af26f5dab07
+	aotLib[0xcc3887418a859821] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, _lambda_thismodule_85_28_1 & , int32_t  ),&_Func_lambda_thismodule_85_28_1_0x60_function_bddb2af26f5dab07>>();
+	};
+	// _Func_lambda_thismodule_85_28_1_0x60_finalizer_3dc36ce0a81f940e
+	aotLib[0x327edf23af463190] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_85_28_1 *  ),&_Func_lambda_thismodule_85_28_1_0x60_finalizer_3dc36ce0a81f940e>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48
+	aotLib[0xae43369ad2ed6a9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48>>();
+	};
+	// _Funcfunctional_0x60_any_a5606ed295f053c9
+	aotLib[0xdae7885028c860f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TDim<bool,2> const  &  ),&_Funcfunctional_0x60_any_a5606ed295f053c9>>();
+	};
+	// _Funcfunctional_0x60_count_7119d72d72fe3e50
+	aotLib[0xad51516eed6abf37] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, int32_t , int32_t  ),&_Funcfunctional_0x60_count_7119d72d72fe3e50>>();
+	};
+	// _Funcfunctional_0x60_repeat_a8c2dce35f26e7e0
+	aotLib[0xfbcf5d672ab5a0bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, int32_t , int32_t  ),&_Funcfunctional_0x60_repeat_a8c2dce35f26e7e0>>();
+	};
+	// is_even_9f92407af8b51b2c
+	aotLib[0xd071b9d19a9085c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&is_even_9f92407af8b51b2c>>();
+	};
+	// twice_aa4c716c97740337
+	aotLib[0xe9815055f07f1799] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&twice_aa4c716c97740337>>();
+	};
+	// add_8997dbbc2c7fa6aa
+	aotLib[0xded93289f7948165] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t  ),&add_8997dbbc2c7fa6aa>>();
+	};
+	// _FuncExclEqu_d496bfa20e8277a0
+	aotLib[0xa8294fdb7fe5db95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTuple<8,int32_t,float> const  & , TTuple<8,int32_t,float> const  &  ),&_FuncExclEqu_d496bfa20e8277a0>>();
+	};
+	// _FuncExclEqu_46b76804d5e31c7b
+	aotLib[0x41720b69387cc809] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<int32_t> const  & , TArray<int32_t> const  &  ),&_FuncExclEqu_46b76804d5e31c7b>>();
+	};
+	// test_84d7773f38040831
+	aotLib[0x3300a8c17d99fa9f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_84d7773f38040831>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,1367 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12022805216446079086 {
+
+extern TypeInfo __type_info__8989007b54230b7;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__cb4000b1a5c381a2;
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__ec5216dc8cf2f2a0;
+extern TypeInfo __type_info__3ceb21b1e6727087;
+
+TypeInfo __type_info__8989007b54230b7 = { Type::tFloat4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 16, UINT64_C(0x8989007b54230b7) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__cb4000b1a5c381a2 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63db4c8601ead9, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xcb4000b1a5c381a2) };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63db4c8601ead9) };
+TypeInfo __type_info__ec5216dc8cf2f2a0 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8989007b54230b7, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xec5216dc8cf2f2a0) };
+TypeInfo __type_info__3ceb21b1e6727087 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x3ceb21b1e6727087) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__cb4000b1a5c381a2 };
+TypeInfo * __tinfo_1[1] = { &__type_info__3ceb21b1e6727087 };
+TypeInfo * __tinfo_2[1] = { &__type_info__ec5216dc8cf2f2a0 };
+namespace  { struct Item; };
+namespace  {
+
+struct Item {
+	float x;
+	int32_t n;
+};
+static_assert(sizeof(Item)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Item,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Item,n)==4,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_resize_761fb73a377a5e66 ( Context * __context__, TArray<float4> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline TArray<float> _Funcbuiltin_0x60_clone_to_move_58ed3a977bba06cc ( Context * __context__, TArray<float> const  & __clone_src_rename_at_325 );
+inline TArray<int32_t> _Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec ( Context * __context__, TArray<int32_t> const  & __clone_src_rename_at_325 );
+inline TArray<float4> _Funcbuiltin_0x60_clone_to_move_44fa43ac0d3b86ce ( Context * __context__, TArray<float4> const  & __clone_src_rename_at_325 );
+inline TArray<float> & _Funcbuiltin_0x60__return_with_lockcheck_a1f776f65548652d ( Context * __context__, TArray<float> & __a_rename_at_42 );
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60_push_be0d7618115c67b8 ( Context * __context__, TArray<float4> & __Arr_rename_at_75, float4 __value_rename_at_75 );
+inline TArray<float4> & _Funcbuiltin_0x60__return_with_lockcheck_e6ea63a21373a53 ( Context * __context__, TArray<float4> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60_clone_be6000bd12691f87 ( Context * __context__, TArray<float> & __a_rename_at_338, TArray<float> const  & __b_rename_at_338 );
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> & __a_rename_at_338, TArray<int32_t> const  & __b_rename_at_338 );
+inline void _Funcbuiltin_0x60_clone_236faa863ce779d1 ( Context * __context__, TArray<float4> & __a_rename_at_338, TArray<float4> const  & __b_rename_at_338 );
+inline void _Funcbuiltin_0x60_push_e4aecc27f9e903c6 ( Context * __context__, TArray<float> & __Arr_rename_at_75, float __value_rename_at_75 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline float _Func_0x60_sum_acf01f1b3720286d ( Context * __context__, TArray<float> const  & __a_rename_at_13 );
+inline float _Func_0x60_sum_ref_a1f1c405879e882c ( Context * __context__, TArray<float> const  & __a_rename_at_20 );
+inline int32_t _Func_0x60_sum_eb38a83c107fb8bd ( Context * __context__, TArray<int32_t> const  & __a_rename_at_13 );
+inline int32_t _Func_0x60_sum_ref_dd8af90b4803d223 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_20 );
+inline float4 _Func_0x60_sum_54dfd57d2b8c7739 ( Context * __context__, TArray<float4> const  & __a_rename_at_13 );
+inline float4 _Func_0x60_sum_ref_2df45ff3c8b9f490 ( Context * __context__, TArray<float4> const  & __a_rename_at_20 );
+inline float _Func_0x60_dot_7f4e93a3af0e87d9 ( Context * __context__, TArray<float> const  & __a_rename_at_27, TArray<float> const  & __b_rename_at_27 );
+inline float _Func_0x60_dot_ref_57db12513aab4e83 ( Context * __context__, TArray<float> const  & __a_rename_at_34, TArray<float> const  & __b_rename_at_34 );
+inline int32_t _Func_0x60_dot_e9fbfcc5344b0689 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_27, TArray<int32_t> const  & __b_rename_at_27 );
+inline int32_t _Func_0x60_dot_ref_5ee5df70d83de719 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_34, TArray<int32_t> const  & __b_rename_at_34 );
+inline float4 _Func_0x60_dot_9447f1b32b00dd81 ( Context * __context__, TArray<float4> const  & __a_rename_at_27, TArray<float4> const  & __b_rename_at_27 );
+inline float4 _Func_0x60_dot_ref_d35fdbb9f2fde503 ( Context * __context__, TArray<float4> const  & __a_rename_at_34, TArray<float4> const  & __b_rename_at_34 );
+inline void _Func_0x60_scale_4df4829dddbe05f5 ( Context * __context__, TArray<float> & __a_rename_at_48, float __k_rename_at_48 );
+inline void _Func_0x60_offset_e743e8517318604f ( Context * __context__, TArray<float> & __a_rename_at_53 );
+inline void _Func_0x60_scale_52b8f28a8d0f4e00 ( Context * __context__, TArray<int32_t> & __a_rename_at_48, int32_t __k_rename_at_48 );
+inline void _Func_0x60_offset_a4ca108e275e6172 ( Context * __context__, TArray<int32_t> & __a_rename_at_53 );
+inline void _Func_0x60_scale_863d422fab3b9dfd ( Context * __context__, TArray<float4> & __a_rename_at_48, float4 __k_rename_at_48 );
+inline void _Func_0x60_axpy_77d286e1245bc590 ( Context * __context__, TArray<float> & __a_rename_at_59, TArray<float> const  & __b_rename_at_59, float __k_rename_at_59 );
+inline void _Func_0x60_axpy_ref_7f5068e9a2824add ( Context * __context__, TArray<float> & __a_rename_at_69, TArray<float> const  & __b_rename_at_69, float __k_rename_at_69 );
+inline bool _Func_0x60_same_af1cf5d725ae1d65 ( Context * __context__, TArray<float> const  & __a_rename_at_97, TArray<float> const  & __b_rename_at_97 );
+inline void _Func_0x60_axpy_left_6ad1477e8b751ded ( Context * __context__, TArray<float> & __a_rename_at_64, TArray<float> const  & __b_rename_at_64, float __k_rename_at_64 );
+inline void _Func_0x60_axpy_5ebe8d1c27784f1d ( Context * __context__, TArray<int32_t> & __a_rename_at_59, TArray<int32_t> const  & __b_rename_at_59, int32_t __k_rename_at_59 );
+inline void _Func_0x60_axpy_ref_b7ab93166e2ae3ad ( Context * __context__, TArray<int32_t> & __a_rename_at_69, TArray<int32_t> const  & __b_rename_at_69, int32_t __k_rename_at_69 );
+inline bool _Func_0x60_same_e3eb7b0511ce9118 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_97, TArray<int32_t> const  & __b_rename_at_97 );
+inline void _Func_0x60_axpy_1c03455f86902684 ( Context * __context__, TArray<float4> & __a_rename_at_59, TArray<float4> const  & __b_rename_at_59, float4 __k_rename_at_59 );
+inline void _Func_0x60_axpy_ref_49c1b9024520585f ( Context * __context__, TArray<float4> & __a_rename_at_69, TArray<float4> const  & __b_rename_at_69, float4 __k_rename_at_69 );
+inline bool _Func_0x60_same_2e3903a41a39a699 ( Context * __context__, TArray<float4> const  & __a_rename_at_97, TArray<float4> const  & __b_rename_at_97 );
+inline void _Funcbuiltin_0x60_push_e40cc9c689790847 ( Context * __context__, TArray<Item> & __Arr_rename_at_75, Item const  & __value_rename_at_75 );
+inline float sum_squares_98c59cee9ce9a2f3 ( Context * __context__, TArray<float> const  & __a_rename_at_41 );
+inline int32_t sum_fields_c7efad8523532b13 ( Context * __context__, TArray<Item> const  & __items_rename_at_74 );
+inline void scale_fields_2a1af93faefc700f ( Context * __context__, TArray<Item> & __items_rename_at_81, float __k_rename_at_81 );
+inline int32_t sum_fixed_717d5300f537ac14 ( Context * __context__, TDim<int32_t,7> const  & __a_rename_at_86 );
+inline void scale_fixed_af5cc6388d43384d ( Context * __context__, TDim<float,7> & __a_rename_at_93, float __k_rename_at_93 );
+inline TArray<float> make_floats_500cf72352b74b16 ( Context * __context__, int32_t __n_rename_at_105, int32_t __seed_rename_at_105 );
+inline TArray<int32_t> make_ints_14ee53421dc54809 ( Context * __context__, int32_t __n_rename_at_111, int32_t __seed_rename_at_111 );
+inline TArray<float4> make_float4s_bd15e06ab15e151d ( Context * __context__, int32_t __n_rename_at_117, int32_t __seed_rename_at_117 );
+inline bool test_abd0904b4d669855 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0xbebe648cfebc074b>(__context__) = 3;/*g_k*/
+}
+
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<float>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_761fb73a377a5e66 ( Context * __context__, TArray<float4> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<float4>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,16,__context__);
+}
+
+inline TArray<float> _Funcbuiltin_0x60_clone_to_move_58ed3a977bba06cc ( Context * __context__, TArray<float> const  &  __clone_src_rename_at_325 )
+{
+	TArray<float> __clone_dest_rename_at_327; das_zero(__clone_dest_rename_at_327);
+	_Funcbuiltin_0x60_clone_be6000bd12691f87(__context__,das_arg<TArray<float>>::pass(__clone_dest_rename_at_327),__clone_src_rename_at_325);
+	return /* <- */ das_auto_cast_move<TArray<float>>::cast(__clone_dest_rename_at_327);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec ( Context * __context__, TArray<int32_t> const  &  __clone_src_rename_at_325 )
+{
+	TArray<int32_t> __clone_dest_rename_at_327; das_zero(__clone_dest_rename_at_327);
+	_Funcbuiltin_0x60_clone_7775f70b42a34990(__context__,das_arg<TArray<int32_t>>::pass(__clone_dest_rename_at_327),__clone_src_rename_at_325);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__clone_dest_rename_at_327);
+}
+
+inline TArray<float4> _Funcbuiltin_0x60_clone_to_move_44fa43ac0d3b86ce ( Context * __context__, TArray<float4> const  &  __clone_src_rename_at_325 )
+{
+	TArray<float4> __clone_dest_rename_at_327; das_zero(__clone_dest_rename_at_327);
+	_Funcbuiltin_0x60_clone_236faa863ce779d1(__context__,das_arg<TArray<float4>>::pass(__clone_dest_rename_at_327),__clone_src_rename_at_325);
+	return /* <- */ das_auto_cast_move<TArray<float4>>::cast(__clone_dest_rename_at_327);
+}
+
+inline TArray<float> & _Funcbuiltin_0x60__return_with_lockcheck_a1f776f65548652d ( Context * __context__, TArray<float> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<float> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<float> &>::cast(__a_rename_at_42);
+}
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<TArray<int32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60_push_be0d7618115c67b8 ( Context * __context__, TArray<float4> &  __Arr_rename_at_75, float4 __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<float4>>::pass(__Arr_rename_at_75),16,__context__),__context__),__value_rename_at_75);
+}
+
+inline TArray<float4> & _Funcbuiltin_0x60__return_with_lockcheck_e6ea63a21373a53 ( Context * __context__, TArray<float4> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<TArray<float4> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<float4> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60_clone_be6000bd12691f87 ( Context * __context__, TArray<float> &  __a_rename_at_338, TArray<float> const  &  __b_rename_at_338 )
+{
+	_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__a_rename_at_338),builtin_array_size(__b_rename_at_338));
+	{
+		bool __need_loop_340 = true;
+		// aV : float aka TT&
+		das_iterator<TArray<float>> __aV_iterator(__a_rename_at_338);
+		float * __aV_rename_at_340;
+		__need_loop_340 = __aV_iterator.first(__context__,(__aV_rename_at_340)) && __need_loop_340;
+		// bV : float const&
+		das_iterator<TArray<float> const > __bV_iterator(__b_rename_at_338);
+		float const  * __bV_rename_at_340;
+		__need_loop_340 = __bV_iterator.first(__context__,(__bV_rename_at_340)) && __need_loop_340;
+		for ( ; __need_loop_340 ; __need_loop_340 = __aV_iterator.next(__context__,(__aV_rename_at_340)) && __bV_iterator.next(__context__,(__bV_rename_at_340)) )
+		{
+			das_copy((*__aV_rename_at_340),(*__bV_rename_at_340));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_340));
+		__bV_iterator.close(__context__,(__bV_rename_at_340));
+	};
+}
+
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> &  __a_rename_at_338, TArray<int32_t> const  &  __b_rename_at_338 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_338),builtin_array_size(__b_rename_at_338));
+	{
+		bool __need_loop_340 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_338);
+		int32_t * __aV_rename_at_340;
+		__need_loop_340 = __aV_iterator.first(__context__,(__aV_rename_at_340)) && __need_loop_340;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_338);
+		int32_t const  * __bV_rename_at_340;
+		__need_loop_340 = __bV_iterator.first(__context__,(__bV_rename_at_340)) && __need_loop_340;
+		for ( ; __need_loop_340 ; __need_loop_340 = __aV_iterator.next(__context__,(__aV_rename_at_340)) && __bV_iterator.next(__context__,(__bV_rename_at_340)) )
+		{
+			das_copy((*__aV_rename_at_340),(*__bV_rename_at_340));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_340));
+		__bV_iterator.close(__context__,(__bV_rename_at_340));
+	};
+}
+
+inline void _Funcbuiltin_0x60_clone_236faa863ce779d1 ( Context * __context__, TArray<float4> &  __a_rename_at_338, TArray<float4> const  &  __b_rename_at_338 )
+{
+	_Funcbuiltin_0x60_resize_761fb73a377a5e66(__context__,das_arg<TArray<float4>>::pass(__a_rename_at_338),builtin_array_size(__b_rename_at_338));
+	{
+		bool __need_loop_340 = true;
+		// aV : float4 aka TT&
+		das_iterator<TArray<float4>> __aV_iterator(__a_rename_at_338);
+		float4 * __aV_rename_at_340;
+		__need_loop_340 = __aV_iterator.first(__context__,(__aV_rename_at_340)) && __need_loop_340;
+		// bV : float4 const&
+		das_iterator<TArray<float4> const > __bV_iterator(__b_rename_at_338);
+		float4 const  * __bV_rename_at_340;
+		__need_loop_340 = __bV_iterator.first(__context__,(__bV_rename_at_340)) && __need_loop_340;
+		for ( ; __need_loop_340 ; __need_loop_340 = __aV_iterator.next(__context__,(__aV_rename_at_340)) && __bV_iterator.next(__context__,(__bV_rename_at_340)) )
+		{
+			das_copy((*__aV_rename_at_340),(*__bV_rename_at_340));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_340));
+		__bV_iterator.close(__context__,(__bV_rename_at_340));
+	};
+}
+
+inline void _Funcbuiltin_0x60_push_e4aecc27f9e903c6 ( Context * __context__, TArray<float> &  __Arr_rename_at_75, float __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<float>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline float _Func_0x60_sum_acf01f1b3720286d ( Context * __context__, TArray<float> const  &  __a_rename_at_13 )
+{
+	float __s_rename_at_14 = 0;
+	{
+		bool __need_loop_15 = true;
+		// x : float aka TT const&
+		das_iterator<TArray<float> const > __x_iterator(__a_rename_at_13);
+		float const  * __x_rename_at_15;
+		__need_loop_15 = __x_iterator.first(__context__,(__x_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __x_iterator.next(__context__,(__x_rename_at_15)) )
+		{
+			__s_rename_at_14 += (*__x_rename_at_15);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_15));
+	};
+	return das_auto_cast<float>::cast(__s_rename_at_14);
+}
+
+inline float _Func_0x60_sum_ref_a1f1c405879e882c ( Context * __context__, TArray<float> const  &  __a_rename_at_20 )
+{
+	float __s_rename_at_21 = 0;
+	{
+		bool __need_loop_22 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(builtin_array_size(__a_rename_at_20)));
+		int32_t __i_rename_at_22;
+		__need_loop_22 = __i_iterator.first(__context__,(__i_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __i_iterator.next(__context__,(__i_rename_at_22)) )
+		{
+			__s_rename_at_21 += __a_rename_at_20(__i_rename_at_22,__context__);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_22));
+	};
+	return das_auto_cast<float>::cast(__s_rename_at_21);
+}
+
+inline int32_t _Func_0x60_sum_eb38a83c107fb8bd ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_13 )
+{
+	int32_t __s_rename_at_14 = 0;
+	{
+		bool __need_loop_15 = true;
+		// x : int aka TT const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_13);
+		int32_t const  * __x_rename_at_15;
+		__need_loop_15 = __x_iterator.first(__context__,(__x_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __x_iterator.next(__context__,(__x_rename_at_15)) )
+		{
+			__s_rename_at_14 += (*__x_rename_at_15);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_15));
+	};
+	return das_auto_cast<int32_t>::cast(__s_rename_at_14);
+}
+
+inline int32_t _Func_0x60_sum_ref_dd8af90b4803d223 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_20 )
+{
+	int32_t __s_rename_at_21 = 0;
+	{
+		bool __need_loop_22 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(builtin_array_size(__a_rename_at_20)));
+		int32_t __i_rename_at_22;
+		__need_loop_22 = __i_iterator.first(__context__,(__i_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __i_iterator.next(__context__,(__i_rename_at_22)) )
+		{
+			__s_rename_at_21 += __a_rename_at_20(__i_rename_at_22,__context__);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_22));
+	};
+	return das_auto_cast<int32_t>::cast(__s_rename_at_21);
+}
+
+inline float4 _Func_0x60_sum_54dfd57d2b8c7739 ( Context * __context__, TArray<float4> const  &  __a_rename_at_13 )
+{
+	float4 __s_rename_at_14 = v_zero();
+	{
+		bool __need_loop_15 = true;
+		// x : float4 aka TT const&
+		das_iterator<TArray<float4> const > __x_iterator(__a_rename_at_13);
+		float4 const  * __x_rename_at_15;
+		__need_loop_15 = __x_iterator.first(__context__,(__x_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __x_iterator.next(__context__,(__x_rename_at_15)) )
+		{
+			SimPolicy<float4>::SetAdd((char *)&(__s_rename_at_14),(*__x_rename_at_15),*__context__,nullptr);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_15));
+	};
+	return das_auto_cast<float4>::cast(__s_rename_at_14);
+}
+
+inline float4 _Func_0x60_sum_ref_2df45ff3c8b9f490 ( Context * __context__, TArray<float4> const  &  __a_rename_at_20 )
+{
+	float4 __s_rename_at_21 = v_zero();
+	{
+		bool __need_loop_22 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(builtin_array_size(__a_rename_at_20)));
+		int32_t __i_rename_at_22;
+		__need_loop_22 = __i_iterator.first(__context__,(__i_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __i_iterator.next(__context__,(__i_rename_at_22)) )
+		{
+			SimPolicy<float4>::SetAdd((char *)&(__s_rename_at_21),__a_rename_at_20(__i_rename_at_22,__context__),*__context__,nullptr);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_22));
+	};
+	return das_auto_cast<float4>::cast(__s_rename_at_21);
+}
+
+inline float _Func_0x60_dot_7f4e93a3af0e87d9 ( Context * __context__, TArray<float> const  &  __a_rename_at_27, TArray<float> const  &  __b_rename_at_27 )
+{
+	float __s_rename_at_28 = 0;
+	{
+		bool __need_loop_29 = true;
+		// x : float aka TT const&
+		das_iterator<TArray<float> const > __x_iterator(__a_rename_at_27);
+		float const  * __x_rename_at_29;
+		__need_loop_29 = __x_iterator.first(__context__,(__x_rename_at_29)) && __need_loop_29;
+		// y : float aka TT const&
+		das_iterator<TArray<float> const > __y_iterator(__b_rename_at_27);
+		float const  * __y_rename_at_29;
+		__need_loop_29 = __y_iterator.first(__context__,(__y_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __x_iterator.next(__context__,(__x_rename_at_29)) && __y_iterator.next(__context__,(__y_rename_at_29)) )
+		{
+			__s_rename_at_28 += ((*__x_rename_at_29) * (*__y_rename_at_29));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_29));
+		__y_iterator.close(__context__,(__y_rename_at_29));
+	};
+	return das_auto_cast<float>::cast(__s_rename_at_28);
+}
+
+inline float _Func_0x60_dot_ref_57db12513aab4e83 ( Context * __context__, TArray<float> const  &  __a_rename_at_34, TArray<float> const  &  __b_rename_at_34 )
+{
+	float __s_rename_at_35 = 0;
+	{
+		bool __need_loop_36 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(SimPolicy<int32_t>::Min(builtin_array_size(__a_rename_at_34),builtin_array_size(__b_rename_at_34),*__context__,nullptr)));
+		int32_t __i_rename_at_36;
+		__need_loop_36 = __i_iterator.first(__context__,(__i_rename_at_36)) && __need_loop_36;
+		for ( ; __need_loop_36 ; __need_loop_36 = __i_iterator.next(__context__,(__i_rename_at_36)) )
+		{
+			__s_rename_at_35 += (__a_rename_at_34(__i_rename_at_36,__context__) * __b_rename_at_34(__i_rename_at_36,__context__));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_36));
+	};
+	return das_auto_cast<float>::cast(__s_rename_at_35);
+}
+
+inline int32_t _Func_0x60_dot_e9fbfcc5344b0689 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_27, TArray<int32_t> const  &  __b_rename_at_27 )
+{
+	int32_t __s_rename_at_28 = 0;
+	{
+		bool __need_loop_29 = true;
+		// x : int aka TT const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_27);
+		int32_t const  * __x_rename_at_29;
+		__need_loop_29 = __x_iterator.first(__context__,(__x_rename_at_29)) && __need_loop_29;
+		// y : int aka TT const&
+		das_iterator<TArray<int32_t> const > __y_iterator(__b_rename_at_27);
+		int32_t const  * __y_rename_at_29;
+		__need_loop_29 = __y_iterator.first(__context__,(__y_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __x_iterator.next(__context__,(__x_rename_at_29)) && __y_iterator.next(__context__,(__y_rename_at_29)) )
+		{
+			__s_rename_at_28 += ((*__x_rename_at_29) * (*__y_rename_at_29));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_29));
+		__y_iterator.close(__context__,(__y_rename_at_29));
+	};
+	return das_auto_cast<int32_t>::cast(__s_rename_at_28);
+}
+
+inline int32_t _Func_0x60_dot_ref_5ee5df70d83de719 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_34, TArray<int32_t> const  &  __b_rename_at_34 )
+{
+	int32_t __s_rename_at_35 = 0;
+	{
+		bool __need_loop_36 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(SimPolicy<int32_t>::Min(builtin_array_size(__a_rename_at_34),builtin_array_size(__b_rename_at_34),*__context__,nullptr)));
+		int32_t __i_rename_at_36;
+		__need_loop_36 = __i_iterator.first(__context__,(__i_rename_at_36)) && __need_loop_36;
+		for ( ; __need_loop_36 ; __need_loop_36 = __i_iterator.next(__context__,(__i_rename_at_36)) )
+		{
+			__s_rename_at_35 += (__a_rename_at_34(__i_rename_at_36,__context__) * __b_rename_at_34(__i_rename_at_36,__context__));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_36));
+	};
+	return das_auto_cast<int32_t>::cast(__s_rename_at_35);
+}
+
+inline float4 _Func_0x60_dot_9447f1b32b00dd81 ( Context * __context__, TArray<float4> const  &  __a_rename_at_27, TArray<float4> const  &  __b_rename_at_27 )
+{
+	float4 __s_rename_at_28 = v_zero();
+	{
+		bool __need_loop_29 = true;
+		// x : float4 aka TT const&
+		das_iterator<TArray<float4> const > __x_iterator(__a_rename_at_27);
+		float4 const  * __x_rename_at_29;
+		__need_loop_29 = __x_iterator.first(__context__,(__x_rename_at_29)) && __need_loop_29;
+		// y : float4 aka TT const&
+		das_iterator<TArray<float4> const > __y_iterator(__b_rename_at_27);
+		float4 const  * __y_rename_at_29;
+		__need_loop_29 = __y_iterator.first(__context__,(__y_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __x_iterator.next(__context__,(__x_rename_at_29)) && __y_iterator.next(__context__,(__y_rename_at_29)) )
+		{
+			SimPolicy<float4>::SetAdd((char *)&(__s_rename_at_28),(SimPolicy<float4>::Mul((*__x_rename_at_29),(*__y_rename_at_29),*__context__,nullptr)),*__context__,nullptr);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_29));
+		__y_iterator.close(__context__,(__y_rename_at_29));
+	};
+	return das_auto_cast<float4>::cast(__s_rename_at_28);
+}
+
+inline float4 _Func_0x60_dot_ref_d35fdbb9f2fde503 ( Context * __context__, TArray<float4> const  &  __a_rename_at_34, TArray<float4> const  &  __b_rename_at_34 )
+{
+	float4 __s_rename_at_35 = v_zero();
+	{
+		bool __need_loop_36 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(SimPolicy<int32_t>::Min(builtin_array_size(__a_rename_at_34),builtin_array_size(__b_rename_at_34),*__context__,nullptr)));
+		int32_t __i_rename_at_36;
+		__need_loop_36 = __i_iterator.first(__context__,(__i_rename_at_36)) && __need_loop_36;
+		for ( ; __need_loop_36 ; __need_loop_36 = __i_iterator.next(__context__,(__i_rename_at_36)) )
+		{
+			SimPolicy<float4>::SetAdd((char *)&(__s_rename_at_35),(SimPolicy<float4>::Mul(__a_rename_at_34(__i_rename_at_36,__context__),__b_rename_at_34(__i_rename_at_36,__context__),*__context__,nullptr)),*__context__,nullptr);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_36));
+	};
+	return das_auto_cast<float4>::cast(__s_rename_at_35);
+}
+
+inline void _Func_0x60_scale_4df4829dddbe05f5 ( Context * __context__, TArray<float> &  __a_rename_at_48, float __k_rename_at_48 )
+{
+	{
+		bool __need_loop_49 = true;
+		// x : float aka TT&
+		das_iterator<TArray<float>> __x_iterator(__a_rename_at_48);
+		float * __x_rename_at_49;
+		__need_loop_49 = __x_iterator.first(__context__,(__x_rename_at_49)) && __need_loop_49;
+		for ( ; __need_loop_49 ; __need_loop_49 = __x_iterator.next(__context__,(__x_rename_at_49)) )
+		{
+			(*__x_rename_at_49) *= __k_rename_at_48;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_49));
+	};
+}
+
+inline void _Func_0x60_offset_e743e8517318604f ( Context * __context__, TArray<float> &  __a_rename_at_53 )
+{
+	float __k_rename_at_54 = ((float)float(das_global<int32_t,0xbebe648cfebc074b>(__context__) /*g_k*/));
+	{
+		bool __need_loop_55 = true;
+		// x : float aka TT&
+		das_iterator<TArray<float>> __x_iterator(__a_rename_at_53);
+		float * __x_rename_at_55;
+		__need_loop_55 = __x_iterator.first(__context__,(__x_rename_at_55)) && __need_loop_55;
+		for ( ; __need_loop_55 ; __need_loop_55 = __x_iterator.next(__context__,(__x_rename_at_55)) )
+		{
+			(*__x_rename_at_55) -= __k_rename_at_54;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_55));
+	};
+}
+
+inline void _Func_0x60_scale_52b8f28a8d0f4e00 ( Context * __context__, TArray<int32_t> &  __a_rename_at_48, int32_t __k_rename_at_48 )
+{
+	{
+		bool __need_loop_49 = true;
+		// x : int aka TT&
+		das_iterator<TArray<int32_t>> __x_iterator(__a_rename_at_48);
+		int32_t * __x_rename_at_49;
+		__need_loop_49 = __x_iterator.first(__context__,(__x_rename_at_49)) && __need_loop_49;
+		for ( ; __need_loop_49 ; __need_loop_49 = __x_iterator.next(__context__,(__x_rename_at_49)) )
+		{
+			(*__x_rename_at_49) *= __k_rename_at_48;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_49));
+	};
+}
+
+inline void _Func_0x60_offset_a4ca108e275e6172 ( Context * __context__, TArray<int32_t> &  __a_rename_at_53 )
+{
+	int32_t __k_rename_at_54 = ((int32_t)int32_t(das_global<int32_t,0xbebe648cfebc074b>(__context__) /*g_k*/));
+	{
+		bool __need_loop_55 = true;
+		// x : int aka TT&
+		das_iterator<TArray<int32_t>> __x_iterator(__a_rename_at_53);
+		int32_t * __x_rename_at_55;
+		__need_loop_55 = __x_iterator.first(__context__,(__x_rename_at_55)) && __need_loop_55;
+		for ( ; __need_loop_55 ; __need_loop_55 = __x_iterator.next(__context__,(__x_rename_at_55)) )
+		{
+			(*__x_rename_at_55) -= __k_rename_at_54;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_55));
+	};
+}
+
+inline void _Func_0x60_scale_863d422fab3b9dfd ( Context * __context__, TArray<float4> &  __a_rename_at_48, float4 __k_rename_at_48 )
+{
+	{
+		bool __need_loop_49 = true;
+		// x : float4 aka TT&
+		das_iterator<TArray<float4>> __x_iterator(__a_rename_at_48);
+		float4 * __x_rename_at_49;
+		__need_loop_49 = __x_iterator.first(__context__,(__x_rename_at_49)) && __need_loop_49;
+		for ( ; __need_loop_49 ; __need_loop_49 = __x_iterator.next(__context__,(__x_rename_at_49)) )
+		{
+			SimPolicy<float4>::SetMul((char *)&((*__x_rename_at_49)),__k_rename_at_48,*__context__,nullptr);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_49));
+	};
+}
+
+inline void _Func_0x60_axpy_77d286e1245bc590 ( Context * __context__, TArray<float> &  __a_rename_at_59, TArray<float> const  &  __b_rename_at_59, float __k_rename_at_59 )
+{
+	{
+		bool __need_loop_60 = true;
+		// x : float aka TT&
+		das_iterator<TArray<float>> __x_iterator(__a_rename_at_59);
+		float * __x_rename_at_60;
+		__need_loop_60 = __x_iterator.first(__context__,(__x_rename_at_60)) && __need_loop_60;
+		// y : float const&
+		das_iterator<TArray<float> const > __y_iterator(__b_rename_at_59);
+		float const  * __y_rename_at_60;
+		__need_loop_60 = __y_iterator.first(__context__,(__y_rename_at_60)) && __need_loop_60;
+		for ( ; __need_loop_60 ; __need_loop_60 = __x_iterator.next(__context__,(__x_rename_at_60)) && __y_iterator.next(__context__,(__y_rename_at_60)) )
+		{
+			(*__x_rename_at_60) += ((*__y_rename_at_60) * __k_rename_at_59);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_60));
+		__y_iterator.close(__context__,(__y_rename_at_60));
+	};
+}
+
+inline void _Func_0x60_axpy_ref_7f5068e9a2824add ( Context * __context__, TArray<float> &  __a_rename_at_69, TArray<float> const  &  __b_rename_at_69, float __k_rename_at_69 )
+{
+	{
+		bool __need_loop_70 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(SimPolicy<int32_t>::Min(builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_69)),builtin_array_size(__b_rename_at_69),*__context__,nullptr)));
+		int32_t __i_rename_at_70;
+		__need_loop_70 = __i_iterator.first(__context__,(__i_rename_at_70)) && __need_loop_70;
+		for ( ; __need_loop_70 ; __need_loop_70 = __i_iterator.next(__context__,(__i_rename_at_70)) )
+		{
+			__a_rename_at_69(__i_rename_at_70,__context__) += (__b_rename_at_69(__i_rename_at_70,__context__) * __k_rename_at_69);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_70));
+	};
+}
+
+inline bool _Func_0x60_same_af1cf5d725ae1d65 ( Context * __context__, TArray<float> const  &  __a_rename_at_97, TArray<float> const  &  __b_rename_at_97 )
+{
+	if ( builtin_array_size(__a_rename_at_97) != builtin_array_size(__b_rename_at_97) )
+	{
+		return das_auto_cast<bool>::cast(false);
+	} else {
+		{
+			bool __need_loop_100 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(mk_range(builtin_array_size(__a_rename_at_97)));
+			int32_t __i_rename_at_100;
+			__need_loop_100 = __i_iterator.first(__context__,(__i_rename_at_100)) && __need_loop_100;
+			for ( ; __need_loop_100 ; __need_loop_100 = __i_iterator.next(__context__,(__i_rename_at_100)) )
+			{
+				if ( __a_rename_at_97(__i_rename_at_100,__context__) != __b_rename_at_97(__i_rename_at_100,__context__) )
+				{
+					return das_auto_cast<bool>::cast(false);
+				};
+			}
+			__i_iterator.close(__context__,(__i_rename_at_100));
+		};
+		return das_auto_cast<bool>::cast(true);
+	};
+}
+
+inline void _Func_0x60_axpy_left_6ad1477e8b751ded ( Context * __context__, TArray<float> &  __a_rename_at_64, TArray<float> const  &  __b_rename_at_64, float __k_rename_at_64 )
+{
+	{
+		bool __need_loop_65 = true;
+		// x : float aka TT&
+		das_iterator<TArray<float>> __x_iterator(__a_rename_at_64);
+		float * __x_rename_at_65;
+		__need_loop_65 = __x_iterator.first(__context__,(__x_rename_at_65)) && __need_loop_65;
+		// y : float const&
+		das_iterator<TArray<float> const > __y_iterator(__b_rename_at_64);
+		float const  * __y_rename_at_65;
+		__need_loop_65 = __y_iterator.first(__context__,(__y_rename_at_65)) && __need_loop_65;
+		for ( ; __need_loop_65 ; __need_loop_65 = __x_iterator.next(__context__,(__x_rename_at_65)) && __y_iterator.next(__context__,(__y_rename_at_65)) )
+		{
+			(*__x_rename_at_65) += (__k_rename_at_64 * (*__y_rename_at_65));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_65));
+		__y_iterator.close(__context__,(__y_rename_at_65));
+	};
+}
+
+inline void _Func_0x60_axpy_5ebe8d1c27784f1d ( Context * __context__, TArray<int32_t> &  __a_rename_at_59, TArray<int32_t> const  &  __b_rename_at_59, int32_t __k_rename_at_59 )
+{
+	{
+		bool __need_loop_60 = true;
+		// x : int aka TT&
+		das_iterator<TArray<int32_t>> __x_iterator(__a_rename_at_59);
+		int32_t * __x_rename_at_60;
+		__need_loop_60 = __x_iterator.first(__context__,(__x_rename_at_60)) && __need_loop_60;
+		// y : int const&
+		das_iterator<TArray<int32_t> const > __y_iterator(__b_rename_at_59);
+		int32_t const  * __y_rename_at_60;
+		__need_loop_60 = __y_iterator.first(__context__,(__y_rename_at_60)) && __need_loop_60;
+		for ( ; __need_loop_60 ; __need_loop_60 = __x_iterator.next(__context__,(__x_rename_at_60)) && __y_iterator.next(__context__,(__y_rename_at_60)) )
+		{
+			(*__x_rename_at_60) += ((*__y_rename_at_60) * __k_rename_at_59);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_60));
+		__y_iterator.close(__context__,(__y_rename_at_60));
+	};
+}
+
+inline void _Func_0x60_axpy_ref_b7ab93166e2ae3ad ( Context * __context__, TArray<int32_t> &  __a_rename_at_69, TArray<int32_t> const  &  __b_rename_at_69, int32_t __k_rename_at_69 )
+{
+	{
+		bool __need_loop_70 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(SimPolicy<int32_t>::Min(builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_69)),builtin_array_size(__b_rename_at_69),*__context__,nullptr)));
+		int32_t __i_rename_at_70;
+		__need_loop_70 = __i_iterator.first(__context__,(__i_rename_at_70)) && __need_loop_70;
+		for ( ; __need_loop_70 ; __need_loop_70 = __i_iterator.next(__context__,(__i_rename_at_70)) )
+		{
+			__a_rename_at_69(__i_rename_at_70,__context__) += (__b_rename_at_69(__i_rename_at_70,__context__) * __k_rename_at_69);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_70));
+	};
+}
+
+inline bool _Func_0x60_same_e3eb7b0511ce9118 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_97, TArray<int32_t> const  &  __b_rename_at_97 )
+{
+	if ( builtin_array_size(__a_rename_at_97) != builtin_array_size(__b_rename_at_97) )
+	{
+		return das_auto_cast<bool>::cast(false);
+	} else {
+		{
+			bool __need_loop_100 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(mk_range(builtin_array_size(__a_rename_at_97)));
+			int32_t __i_rename_at_100;
+			__need_loop_100 = __i_iterator.first(__context__,(__i_rename_at_100)) && __need_loop_100;
+			for ( ; __need_loop_100 ; __need_loop_100 = __i_iterator.next(__context__,(__i_rename_at_100)) )
+			{
+				if ( __a_rename_at_97(__i_rename_at_100,__context__) != __b_rename_at_97(__i_rename_at_100,__context__) )
+				{
+					return das_auto_cast<bool>::cast(false);
+				};
+			}
+			__i_iterator.close(__context__,(__i_rename_at_100));
+		};
+		return das_auto_cast<bool>::cast(true);
+	};
+}
+
+inline void _Func_0x60_axpy_1c03455f86902684 ( Context * __context__, TArray<float4> &  __a_rename_at_59, TArray<float4> const  &  __b_rename_at_59, float4 __k_rename_at_59 )
+{
+	{
+		bool __need_loop_60 = true;
+		// x : float4 aka TT&
+		das_iterator<TArray<float4>> __x_iterator(__a_rename_at_59);
+		float4 * __x_rename_at_60;
+		__need_loop_60 = __x_iterator.first(__context__,(__x_rename_at_60)) && __need_loop_60;
+		// y : float4 const&
+		das_iterator<TArray<float4> const > __y_iterator(__b_rename_at_59);
+		float4 const  * __y_rename_at_60;
+		__need_loop_60 = __y_iterator.first(__context__,(__y_rename_at_60)) && __need_loop_60;
+		for ( ; __need_loop_60 ; __need_loop_60 = __x_iterator.next(__context__,(__x_rename_at_60)) && __y_iterator.next(__context__,(__y_rename_at_60)) )
+		{
+			SimPolicy<float4>::SetAdd((char *)&((*__x_rename_at_60)),(SimPolicy<float4>::Mul((*__y_rename_at_60),__k_rename_at_59,*__context__,nullptr)),*__context__,nullptr);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_60));
+		__y_iterator.close(__context__,(__y_rename_at_60));
+	};
+}
+
+inline void _Func_0x60_axpy_ref_49c1b9024520585f ( Context * __context__, TArray<float4> &  __a_rename_at_69, TArray<float4> const  &  __b_rename_at_69, float4 __k_rename_at_69 )
+{
+	{
+		bool __need_loop_70 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(SimPolicy<int32_t>::Min(builtin_array_size(das_arg<TArray<float4>>::pass(__a_rename_at_69)),builtin_array_size(__b_rename_at_69),*__context__,nullptr)));
+		int32_t __i_rename_at_70;
+		__need_loop_70 = __i_iterator.first(__context__,(__i_rename_at_70)) && __need_loop_70;
+		for ( ; __need_loop_70 ; __need_loop_70 = __i_iterator.next(__context__,(__i_rename_at_70)) )
+		{
+			SimPolicy<float4>::SetAdd((char *)&(__a_rename_at_69(__i_rename_at_70,__context__)),(SimPolicy<float4>::Mul(__b_rename_at_69(__i_rename_at_70,__context__),__k_rename_at_69,*__context__,nullptr)),*__context__,nullptr);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_70));
+	};
+}
+
+inline bool _Func_0x60_same_2e3903a41a39a699 ( Context * __context__, TArray<float4> const  &  __a_rename_at_97, TArray<float4> const  &  __b_rename_at_97 )
+{
+	if ( builtin_array_size(__a_rename_at_97) != builtin_array_size(__b_rename_at_97) )
+	{
+		return das_auto_cast<bool>::cast(false);
+	} else {
+		{
+			bool __need_loop_100 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(mk_range(builtin_array_size(__a_rename_at_97)));
+			int32_t __i_rename_at_100;
+			__need_loop_100 = __i_iterator.first(__context__,(__i_rename_at_100)) && __need_loop_100;
+			for ( ; __need_loop_100 ; __need_loop_100 = __i_iterator.next(__context__,(__i_rename_at_100)) )
+			{
+				if ( SimPolicy<float4>::NotEqu(__a_rename_at_97(__i_rename_at_100,__context__),__b_rename_at_97(__i_rename_at_100,__context__),*__context__,nullptr) )
+				{
+					return das_auto_cast<bool>::cast(false);
+				};
+			}
+			__i_iterator.close(__context__,(__i_rename_at_100));
+		};
+		return das_auto_cast<bool>::cast(true);
+	};
+}
+
+inline void _Funcbuiltin_0x60_push_e40cc9c689790847 ( Context * __context__, TArray<Item> &  __Arr_rename_at_75, Item const  &  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<Item>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline float sum_squares_98c59cee9ce9a2f3 ( Context * __context__, TArray<float> const  &  __a_rename_at_41 )
+{
+	float __s_rename_at_42 = 0.f;
+	{
+		bool __need_loop_43 = true;
+		// x : float const&
+		das_iterator<TArray<float> const > __x_iterator(__a_rename_at_41);
+		float const  * __x_rename_at_43;
+		__need_loop_43 = __x_iterator.first(__context__,(__x_rename_at_43)) && __need_loop_43;
+		for ( ; __need_loop_43 ; __need_loop_43 = __x_iterator.next(__context__,(__x_rename_at_43)) )
+		{
+			__s_rename_at_42 += ((*__x_rename_at_43) * (*__x_rename_at_43));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_43));
+	};
+	return das_auto_cast<float>::cast(__s_rename_at_42);
+}
+
+inline int32_t sum_fields_c7efad8523532b13 ( Context * __context__, TArray<Item> const  &  __items_rename_at_74 )
+{
+	int32_t __s_rename_at_75 = 0;
+	{
+		bool __need_loop_76 = true;
+		// it : Item const&
+		das_iterator<TArray<Item> const > __it_iterator(__items_rename_at_74);
+		Item const  * __it_rename_at_76;
+		__need_loop_76 = __it_iterator.first(__context__,(__it_rename_at_76)) && __need_loop_76;
+		for ( ; __need_loop_76 ; __need_loop_76 = __it_iterator.next(__context__,(__it_rename_at_76)) )
+		{
+			__s_rename_at_75 += (*__it_rename_at_76).n;
+		}
+		__it_iterator.close(__context__,(__it_rename_at_76));
+	};
+	return das_auto_cast<int32_t>::cast(__s_rename_at_75);
+}
+
+inline void scale_fields_2a1af93faefc700f ( Context * __context__, TArray<Item> &  __items_rename_at_81, float __k_rename_at_81 )
+{
+	{
+		bool __need_loop_82 = true;
+		// it : Item&
+		das_iterator<TArray<Item>> __it_iterator(__items_rename_at_81);
+		Item * __it_rename_at_82;
+		__need_loop_82 = __it_iterator.first(__context__,(__it_rename_at_82)) && __need_loop_82;
+		for ( ; __need_loop_82 ; __need_loop_82 = __it_iterator.next(__context__,(__it_rename_at_82)) )
+		{
+			(*__it_rename_at_82).x *= __k_rename_at_81;
+		}
+		__it_iterator.close(__context__,(__it_rename_at_82));
+	};
+}
+
+inline int32_t sum_fixed_717d5300f537ac14 ( Context * __context__, TDim<int32_t,7> const  &  __a_rename_at_86 )
+{
+	int32_t __s_rename_at_87 = 0;
+	{
+		bool __need_loop_88 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,7> const > __x_iterator(__a_rename_at_86);
+		int32_t const  * __x_rename_at_88;
+		__need_loop_88 = __x_iterator.first(__context__,(__x_rename_at_88)) && __need_loop_88;
+		for ( ; __need_loop_88 ; __need_loop_88 = __x_iterator.next(__context__,(__x_rename_at_88)) )
+		{
+			__s_rename_at_87 += (*__x_rename_at_88);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_88));
+	};
+	return das_auto_cast<int32_t>::cast(__s_rename_at_87);
+}
+
+inline void scale_fixed_af5cc6388d43384d ( Context * __context__, TDim<float,7> &  __a_rename_at_93, float __k_rename_at_93 )
+{
+	{
+		bool __need_loop_94 = true;
+		// x : float& -const
+		das_iterator<TDim<float,7>> __x_iterator(__a_rename_at_93);
+		float * __x_rename_at_94;
+		__need_loop_94 = __x_iterator.first(__context__,(__x_rename_at_94)) && __need_loop_94;
+		for ( ; __need_loop_94 ; __need_loop_94 = __x_iterator.next(__context__,(__x_rename_at_94)) )
+		{
+			(*__x_rename_at_94) *= __k_rename_at_93;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_94));
+	};
+}
+
+inline TArray<float> make_floats_500cf72352b74b16 ( Context * __context__, int32_t __n_rename_at_105, int32_t __seed_rename_at_105 )
+{
+	TArray<float> __a_rename_at_106; das_zero(__a_rename_at_106);
+	{
+		bool __need_loop_107 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_105));
+		int32_t __i_rename_at_107;
+		__need_loop_107 = __i_iterator.first(__context__,(__i_rename_at_107)) && __need_loop_107;
+		for ( ; __need_loop_107 ; __need_loop_107 = __i_iterator.next(__context__,(__i_rename_at_107)) )
+		{
+			_Funcbuiltin_0x60_push_e4aecc27f9e903c6(__context__,das_arg<TArray<float>>::pass(__a_rename_at_106),(float(SimPolicy<int32_t>::Mod(((__i_rename_at_107 * 7) + __seed_rename_at_105),13,*__context__,nullptr)) * 0.370000005f) - 1.10000002f);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_107));
+	};
+	return /* <- */ das_auto_cast_move<TArray<float>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_a1f776f65548652d(__context__,das_arg<TArray<float>>::pass(__a_rename_at_106)));
+}
+
+inline TArray<int32_t> make_ints_14ee53421dc54809 ( Context * __context__, int32_t __n_rename_at_111, int32_t __seed_rename_at_111 )
+{
+	TArray<int32_t> __a_rename_at_112; das_zero(__a_rename_at_112);
+	{
+		bool __need_loop_113 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_111));
+		int32_t __i_rename_at_113;
+		__need_loop_113 = __i_iterator.first(__context__,(__i_rename_at_113)) && __need_loop_113;
+		for ( ; __need_loop_113 ; __need_loop_113 = __i_iterator.next(__context__,(__i_rename_at_113)) )
+		{
+			_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_112),((SimPolicy<int32_t>::Mod(((__i_rename_at_113 * 7) + __seed_rename_at_111),13,*__context__,nullptr)) - 5) + (__i_rename_at_113 * 100000));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_113));
+	};
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_112)));
+}
+
+inline TArray<float4> make_float4s_bd15e06ab15e151d ( Context * __context__, int32_t __n_rename_at_117, int32_t __seed_rename_at_117 )
+{
+	TArray<float4> __a_rename_at_118; das_zero(__a_rename_at_118);
+	{
+		bool __need_loop_119 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_117));
+		int32_t __i_rename_at_119;
+		__need_loop_119 = __i_iterator.first(__context__,(__i_rename_at_119)) && __need_loop_119;
+		for ( ; __need_loop_119 ; __need_loop_119 = __i_iterator.next(__context__,(__i_rename_at_119)) )
+		{
+			_Funcbuiltin_0x60_push_be0d7618115c67b8(__context__,das_arg<TArray<float4>>::pass(__a_rename_at_118),float4(float(__i_rename_at_119),float(__seed_rename_at_117) * 0.300000012f,float(__i_rename_at_119 + __seed_rename_at_117) * -0.699999988f,1.10000002f));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_119));
+	};
+	return /* <- */ das_auto_cast_move<TArray<float4>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_e6ea63a21373a53(__context__,das_arg<TArray<float4>>::pass(__a_rename_at_118)));
+}
+
+inline bool test_abd0904b4d669855 ( Context * __context__ )
+{
+	TDim<int32_t,7> _temp_make_local_125_32;
+	{
+		bool __need_loop_125 = true;
+		// n : int&
+		das_iterator<TDim<int32_t,7>> __n_iterator((([&]() -> TDim<int32_t,7>& {
+			_temp_make_local_125_32(0,__context__) = 0;
+			_temp_make_local_125_32(1,__context__) = 1;
+			_temp_make_local_125_32(2,__context__) = 3;
+			_temp_make_local_125_32(3,__context__) = 4;
+			_temp_make_local_125_32(4,__context__) = 5;
+			_temp_make_local_125_32(5,__context__) = 17;
+			_temp_make_local_125_32(6,__context__) = 1000;
+			return _temp_make_local_125_32;
+		})()));
+		int32_t * __n_rename_at_125;
+		__need_loop_125 = __n_iterator.first(__context__,(__n_rename_at_125)) && __need_loop_125;
+		for ( ; __need_loop_125 ; __need_loop_125 = __n_iterator.next(__context__,(__n_rename_at_125)) )
+		{
+			TArray<float> __fa_rename_at_126_ConstRef; das_zero(__fa_rename_at_126_ConstRef); das_move(__fa_rename_at_126_ConstRef, ((TArray<float>)make_floats_500cf72352b74b16(__context__,(*__n_rename_at_125),1)));
+	TArray<float> const  & __fa_rename_at_126 = __fa_rename_at_126_ConstRef; ;
+			TArray<float> __fb_rename_at_127_ConstRef; das_zero(__fb_rename_at_127_ConstRef); das_move(__fb_rename_at_127_ConstRef, ((TArray<float>)make_floats_500cf72352b74b16(__context__,(*__n_rename_at_125) + 2,5)));
+	TArray<float> const  & __fb_rename_at_127 = __fb_rename_at_127_ConstRef; ;
+			TArray<int32_t> __ia_rename_at_128_ConstRef; das_zero(__ia_rename_at_128_ConstRef); das_move(__ia_rename_at_128_ConstRef, ((TArray<int32_t>)make_ints_14ee53421dc54809(__context__,(*__n_rename_at_125),1)));
+	TArray<int32_t> const  & __ia_rename_at_128 = __ia_rename_at_128_ConstRef; ;
+			TArray<int32_t> __ib_rename_at_129_ConstRef; das_zero(__ib_rename_at_129_ConstRef); das_move(__ib_rename_at_129_ConstRef, ((TArray<int32_t>)make_ints_14ee53421dc54809(__context__,(*__n_rename_at_125) + 2,5)));
+	TArray<int32_t> const  & __ib_rename_at_129 = __ib_rename_at_129_ConstRef; ;
+			TArray<float4> __va_rename_at_130_ConstRef; das_zero(__va_rename_at_130_ConstRef); das_move(__va_rename_at_130_ConstRef, ((TArray<float4>)make_float4s_bd15e06ab15e151d(__context__,(*__n_rename_at_125),1)));
+	TArray<float4> const  & __va_rename_at_130 = __va_rename_at_130_ConstRef; ;
+			TArray<float4> __vb_rename_at_131_ConstRef; das_zero(__vb_rename_at_131_ConstRef); das_move(__vb_rename_at_131_ConstRef, ((TArray<float4>)make_float4s_bd15e06ab15e151d(__context__,(*__n_rename_at_125) + 2,5)));
+	TArray<float4> const  & __vb_rename_at_131 = __vb_rename_at_131_ConstRef; ;
+			DAS_VERIFY((_Func_0x60_sum_acf01f1b3720286d(__context__,__fa_rename_at_126) == _Func_0x60_sum_ref_a1f1c405879e882c(__context__,__fa_rename_at_126)));
+			DAS_VERIFY((_Func_0x60_sum_eb38a83c107fb8bd(__context__,__ia_rename_at_128) == _Func_0x60_sum_ref_dd8af90b4803d223(__context__,__ia_rename_at_128)));
+			DAS_VERIFY((SimPolicy<float4>::Equ(_Func_0x60_sum_54dfd57d2b8c7739(__context__,__va_rename_at_130),_Func_0x60_sum_ref_2df45ff3c8b9f490(__context__,__va_rename_at_130),*__context__,nullptr)));
+			DAS_VERIFY((_Func_0x60_dot_7f4e93a3af0e87d9(__context__,__fa_rename_at_126,__fb_rename_at_127) == _Func_0x60_dot_ref_57db12513aab4e83(__context__,__fa_rename_at_126,__fb_rename_at_127)));
+			DAS_VERIFY((_Func_0x60_dot_e9fbfcc5344b0689(__context__,__ia_rename_at_128,__ib_rename_at_129) == _Func_0x60_dot_ref_5ee5df70d83de719(__context__,__ia_rename_at_128,__ib_rename_at_129)));
+			DAS_VERIFY((SimPolicy<float4>::Equ(_Func_0x60_dot_9447f1b32b00dd81(__context__,__va_rename_at_130,__vb_rename_at_131),_Func_0x60_dot_ref_d35fdbb9f2fde503(__context__,__va_rename_at_130,__vb_rename_at_131),*__context__,nullptr)));
+			DAS_VERIFY((sum_squares_98c59cee9ce9a2f3(__context__,__fa_rename_at_126) == _Func_0x60_dot_ref_57db12513aab4e83(__context__,__fa_rename_at_126,__fa_rename_at_126)));
+			TArray<float> __fc_rename_at_141; das_zero(__fc_rename_at_141); das_move(__fc_rename_at_141, _Funcbuiltin_0x60_clone_to_move_58ed3a977bba06cc(__context__,__fa_rename_at_126));
+			TArray<float> __fd_rename_at_142; das_zero(__fd_rename_at_142); das_move(__fd_rename_at_142, _Funcbuiltin_0x60_clone_to_move_58ed3a977bba06cc(__context__,__fa_rename_at_126));
+			_Func_0x60_scale_4df4829dddbe05f5(__context__,das_arg<TArray<float>>::pass(__fc_rename_at_141),1.70000005f);
+			{
+				bool __need_loop_144 = true;
+				// x : float&
+				das_iterator<TArray<float>> __x_iterator(__fc_rename_at_141);
+				float * __x_rename_at_144;
+				__need_loop_144 = __x_iterator.first(__context__,(__x_rename_at_144)) && __need_loop_144;
+				// y : float&
+				das_iterator<TArray<float>> __y_iterator(__fd_rename_at_142);
+				float * __y_rename_at_144;
+				__need_loop_144 = __y_iterator.first(__context__,(__y_rename_at_144)) && __need_loop_144;
+				for ( ; __need_loop_144 ; __need_loop_144 = __x_iterator.next(__context__,(__x_rename_at_144)) && __y_iterator.next(__context__,(__y_rename_at_144)) )
+				{
+					DAS_VERIFY(((*__x_rename_at_144) == ((*__y_rename_at_144) * 1.70000005f)));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_144));
+				__y_iterator.close(__context__,(__y_rename_at_144));
+			};
+			_Func_0x60_offset_e743e8517318604f(__context__,das_arg<TArray<float>>::pass(__fc_rename_at_141));
+			TArray<int32_t> __ic_rename_at_147; das_zero(__ic_rename_at_147); das_move(__ic_rename_at_147, _Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec(__context__,__ia_rename_at_128));
+			_Func_0x60_scale_52b8f28a8d0f4e00(__context__,das_arg<TArray<int32_t>>::pass(__ic_rename_at_147),3);
+			_Func_0x60_offset_a4ca108e275e6172(__context__,das_arg<TArray<int32_t>>::pass(__ic_rename_at_147));
+			{
+				bool __need_loop_150 = true;
+				// x : int&
+				das_iterator<TArray<int32_t>> __x_iterator(__ic_rename_at_147);
+				int32_t * __x_rename_at_150;
+				__need_loop_150 = __x_iterator.first(__context__,(__x_rename_at_150)) && __need_loop_150;
+				// y : int const&
+				das_iterator<TArray<int32_t> const > __y_iterator(__ia_rename_at_128);
+				int32_t const  * __y_rename_at_150;
+				__need_loop_150 = __y_iterator.first(__context__,(__y_rename_at_150)) && __need_loop_150;
+				for ( ; __need_loop_150 ; __need_loop_150 = __x_iterator.next(__context__,(__x_rename_at_150)) && __y_iterator.next(__context__,(__y_rename_at_150)) )
+				{
+					DAS_VERIFY(((*__x_rename_at_150) == (((*__y_rename_at_150) * 3) - das_global<int32_t,0xbebe648cfebc074b>(__context__) /*g_k*/)));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_150));
+				__y_iterator.close(__context__,(__y_rename_at_150));
+			};
+			TArray<float4> __vc_rename_at_152; das_zero(__vc_rename_at_152); das_move(__vc_rename_at_152, _Funcbuiltin_0x60_clone_to_move_44fa43ac0d3b86ce(__context__,__va_rename_at_130));
+			_Func_0x60_scale_863d422fab3b9dfd(__context__,das_arg<TArray<float4>>::pass(__vc_rename_at_152),v_make_vec4f(1.f,2.f,-3.f,0.5f));
+			{
+				bool __need_loop_154 = true;
+				// x : float4&
+				das_iterator<TArray<float4>> __x_iterator(__vc_rename_at_152);
+				float4 * __x_rename_at_154;
+				__need_loop_154 = __x_iterator.first(__context__,(__x_rename_at_154)) && __need_loop_154;
+				// y : float4 const&
+				das_iterator<TArray<float4> const > __y_iterator(__va_rename_at_130);
+				float4 const  * __y_rename_at_154;
+				__need_loop_154 = __y_iterator.first(__context__,(__y_rename_at_154)) && __need_loop_154;
+				for ( ; __need_loop_154 ; __need_loop_154 = __x_iterator.next(__context__,(__x_rename_at_154)) && __y_iterator.next(__context__,(__y_rename_at_154)) )
+				{
+					DAS_VERIFY((SimPolicy<float4>::Equ((*__x_rename_at_154),(SimPolicy<float4>::Mul((*__y_rename_at_154),v_make_vec4f(1.f,2.f,-3.f,0.5f),*__context__,nullptr)),*__context__,nullptr)));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_154));
+				__y_iterator.close(__context__,(__y_rename_at_154));
+			};
+			_Funcbuiltin_0x60_clone_be6000bd12691f87(__context__,das_arg<TArray<float>>::pass(__fc_rename_at_141),__fa_rename_at_126);
+			_Funcbuiltin_0x60_clone_be6000bd12691f87(__context__,das_arg<TArray<float>>::pass(__fd_rename_at_142),__fa_rename_at_126);
+			_Func_0x60_axpy_77d286e1245bc590(__context__,das_arg<TArray<float>>::pass(__fc_rename_at_141),__fb_rename_at_127,0.300000012f);
+			_Func_0x60_axpy_ref_7f5068e9a2824add(__context__,das_arg<TArray<float>>::pass(__fd_rename_at_142),__fb_rename_at_127,0.300000012f);
+			DAS_VERIFY((_Func_0x60_same_af1cf5d725ae1d65(__context__,das_arg<TArray<float>>::pass(__fc_rename_at_141),das_arg<TArray<float>>::pass(__fd_rename_at_142))));
+			_Func_0x60_axpy_left_6ad1477e8b751ded(__context__,das_arg<TArray<float>>::pass(__fc_rename_at_141),__fb_rename_at_127,-1.29999995f);
+			_Func_0x60_axpy_ref_7f5068e9a2824add(__context__,das_arg<TArray<float>>::pass(__fd_rename_at_142),__fb_rename_at_127,-1.29999995f);
+			DAS_VERIFY((_Func_0x60_same_af1cf5d725ae1d65(__context__,das_arg<TArray<float>>::pass(__fc_rename_at_141),das_arg<TArray<float>>::pass(__fd_rename_at_142))));
+			_Funcbuiltin_0x60_clone_7775f70b42a34990(__context__,das_arg<TArray<int32_t>>::pass(__ic_rename_at_147),__ia_rename_at_128);
+			TArray<int32_t> __id_rename_at_166; das_zero(__id_rename_at_166); das_move(__id_rename_at_166, _Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec(__context__,__ia_rename_at_128));
+			_Func_0x60_axpy_5ebe8d1c27784f1d(__context__,das_arg<TArray<int32_t>>::pass(__ic_rename_at_147),__ib_rename_at_129,das_global<int32_t,0xbebe648cfebc074b>(__context__) /*g_k*/);
+			_Func_0x60_axpy_ref_b7ab93166e2ae3ad(__context__,das_arg<TArray<int32_t>>::pass(__id_rename_at_166),__ib_rename_at_129,das_global<int32_t,0xbebe648cfebc074b>(__context__) /*g_k*/);
+			DAS_VERIFY((_Func_0x60_same_e3eb7b0511ce9118(__context__,das_arg<TArray<int32_t>>::pass(__ic_rename_at_147),das_arg<TArray<int32_t>>::pass(__id_rename_at_166))));
+			_Funcbuiltin_0x60_clone_236faa863ce779d1(__context__,das_arg<TArray<float4>>::pass(__vc_rename_at_152),__va_rename_at_130);
+			TArray<float4> __vd_rename_at_171; das_zero(__vd_rename_at_171); das_move(__vd_rename_at_171, _Funcbuiltin_0x60_clone_to_move_44fa43ac0d3b86ce(__context__,__va_rename_at_130));
+			_Func_0x60_axpy_1c03455f86902684(__context__,das_arg<TArray<float4>>::pass(__vc_rename_at_152),__vb_rename_at_131,v_splats(0.5f));
+			_Func_0x60_axpy_ref_49c1b9024520585f(__context__,das_arg<TArray<float4>>::pass(__vd_rename_at_171),__vb_rename_at_131,v_splats(0.5f));
+			DAS_VERIFY((_Func_0x60_same_2e3903a41a39a699(__context__,das_arg<TArray<float4>>::pass(__vc_rename_at_152),das_arg<TArray<float4>>::pass(__vd_rename_at_171))));
+			_Funcbuiltin_0x60_clone_be6000bd12691f87(__context__,das_arg<TArray<float>>::pass(__fc_rename_at_141),__fa_rename_at_126);
+			_Funcbuiltin_0x60_clone_be6000bd12691f87(__context__,das_arg<TArray<float>>::pass(__fd_rename_at_142),__fa_rename_at_126);
+			_Func_0x60_axpy_77d286e1245bc590(__context__,das_arg<TArray<float>>::pass(__fc_rename_at_141),das_arg<TArray<float>>::pass(__fc_rename_at_141),2.f);
+			{
+				bool __need_loop_179 = true;
+				// x : float&
+				das_iterator<TArray<float>> __x_iterator(__fc_rename_at_141);
+				float * __x_rename_at_179;
+				__need_loop_179 = __x_iterator.first(__context__,(__x_rename_at_179)) && __need_loop_179;
+				// y : float&
+				das_iterator<TArray<float>> __y_iterator(__fd_rename_at_142);
+				float * __y_rename_at_179;
+				__need_loop_179 = __y_iterator.first(__context__,(__y_rename_at_179)) && __need_loop_179;
+				for ( ; __need_loop_179 ; __need_loop_179 = __x_iterator.next(__context__,(__x_rename_at_179)) && __y_iterator.next(__context__,(__y_rename_at_179)) )
+				{
+					DAS_VERIFY(((*__x_rename_at_179) == ((*__y_rename_at_179) + ((*__y_rename_at_179) * 2.f))));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_179));
+				__y_iterator.close(__context__,(__y_rename_at_179));
+			};
+		}
+		__n_iterator.close(__context__,(__n_rename_at_125));
+	};
+	TArray<Item> __items_rename_at_182; das_zero(__items_rename_at_182);
+	{
+		bool __need_loop_183 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,9));
+		int32_t __i_rename_at_183;
+		__need_loop_183 = __i_iterator.first(__context__,(__i_rename_at_183)) && __need_loop_183;
+		for ( ; __need_loop_183 ; __need_loop_183 = __i_iterator.next(__context__,(__i_rename_at_183)) )
+		{
+			Item _temp_make_local_184_640;
+			_Funcbuiltin_0x60_push_e40cc9c689790847(__context__,das_arg<TArray<Item>>::pass(__items_rename_at_182),das_arg<Item>::pass((([&]() -> Item& {
+				das_copy((_temp_make_local_184_640.x),(float(__i_rename_at_183)));
+				das_copy((_temp_make_local_184_640.n),(__i_rename_at_183));
+				return _temp_make_local_184_640;
+			})())));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_183));
+	};
+	DAS_VERIFY((sum_fields_c7efad8523532b13(__context__,das_arg<TArray<Item>>::pass(__items_rename_at_182)) == 36));
+	scale_fields_2a1af93faefc700f(__context__,das_arg<TArray<Item>>::pass(__items_rename_at_182),0.5f);
+	{
+		bool __need_loop_187 = true;
+		// it : Item&
+		das_iterator<TArray<Item>> __it_iterator(__items_rename_at_182);
+		Item * __it_rename_at_187;
+		__need_loop_187 = __it_iterator.first(__context__,(__it_rename_at_187)) && __need_loop_187;
+		for ( ; __need_loop_187 ; __need_loop_187 = __it_iterator.next(__context__,(__it_rename_at_187)) )
+		{
+			DAS_VERIFY(((*__it_rename_at_187).x == (float((*__it_rename_at_187).n) * 0.5f)));
+		}
+		__it_iterator.close(__context__,(__it_rename_at_187));
+	};
+	TDim<int32_t,7> __ifa_rename_at_190; das_zero(__ifa_rename_at_190);
+	TDim<float,7> __ffa_rename_at_191; das_zero(__ffa_rename_at_191);
+	{
+		bool __need_loop_192 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,7));
+		int32_t __i_rename_at_192;
+		__need_loop_192 = __i_iterator.first(__context__,(__i_rename_at_192)) && __need_loop_192;
+		for ( ; __need_loop_192 ; __need_loop_192 = __i_iterator.next(__context__,(__i_rename_at_192)) )
+		{
+			das_copy(__ifa_rename_at_190(__i_rename_at_192,__context__),__i_rename_at_192 * das_global<int32_t,0xbebe648cfebc074b>(__context__) /*g_k*/);
+			das_copy(__ffa_rename_at_191(__i_rename_at_192,__context__),float(__i_rename_at_192));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_192));
+	};
+	DAS_VERIFY((sum_fixed_717d5300f537ac14(__context__,das_arg<TDim<int32_t,7>>::pass(__ifa_rename_at_190)) == (das_global<int32_t,0xbebe648cfebc074b>(__context__) /*g_k*/ * 21)));
+	scale_fixed_af5cc6388d43384d(__context__,das_arg<TDim<float,7>>::pass(__ffa_rename_at_191),2.f);
+	{
+		bool __need_loop_197 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,7));
+		int32_t __i_rename_at_197;
+		__need_loop_197 = __i_iterator.first(__context__,(__i_rename_at_197)) && __need_loop_197;
+		for ( ; __need_loop_197 ; __need_loop_197 = __i_iterator.next(__context__,(__i_rename_at_197)) )
+		{
+			DAS_VERIFY((__ffa_rename_at_191(__i_rename_at_197,__context__) == (float(__i_rename_at_197) * 2.f)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_197));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_d240579333227022
+	aotLib[0x40d6b5552dd22f51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , int32_t  ),&_Funcbuiltin_0x60_resize_d240579333227022>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_resize_761fb73a377a5e66
+	aotLib[0xc267e309ce3735b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> & , int32_t  ),&_Funcbuiltin_0x60_resize_761fb73a377a5e66>>();
+	};
+	// _Funcbuiltin_0x60_clone_to_move_58ed3a977bba06cc
+	aotLib[0x1882cb34137685f6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<float> (*) ( Context * __context__, TArray<float> const  &  ),&_Funcbuiltin_0x60_clone_to_move_58ed3a977bba06cc>>();
+	};
+	// _Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec
+	aotLib[0xf79a059000c4b1dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec>>();
+	};
+	// _Funcbuiltin_0x60_clone_to_move_44fa43ac0d3b86ce
+	aotLib[0x360e72e0e194839f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<float4> (*) ( Context * __context__, TArray<float4> const  &  ),&_Funcbuiltin_0x60_clone_to_move_44fa43ac0d3b86ce>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_a1f776f65548652d
+	aotLib[0x73e4f44d128eebbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<float> & (*) ( Context * __context__, TArray<float> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_a1f776f65548652d>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd
+	aotLib[0x66e322246598e835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> & (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd>>();
+	};
+	// _Funcbuiltin_0x60_push_be0d7618115c67b8
+	aotLib[0xc8ba519efc21ad91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> & , float4  ),&_Funcbuiltin_0x60_push_be0d7618115c67b8>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_e6ea63a21373a53
+	aotLib[0xf489ab6ebcbafa0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<float4> & (*) ( Context * __context__, TArray<float4> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_e6ea63a21373a53>>();
+	};
+	// _Funcbuiltin_0x60_clone_be6000bd12691f87
+	aotLib[0x7b5ea3ae646e1a5c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , TArray<float> const  &  ),&_Funcbuiltin_0x60_clone_be6000bd12691f87>>();
+	};
+	// _Funcbuiltin_0x60_clone_7775f70b42a34990
+	aotLib[0xbde965effb9cac8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_7775f70b42a34990>>();
+	};
+	// _Funcbuiltin_0x60_clone_236faa863ce779d1
+	aotLib[0x4e85b53a7a30417c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> & , TArray<float4> const  &  ),&_Funcbuiltin_0x60_clone_236faa863ce779d1>>();
+	};
+	// _Funcbuiltin_0x60_push_e4aecc27f9e903c6
+	aotLib[0xea7fed8bbc1a9125] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float  ),&_Funcbuiltin_0x60_push_e4aecc27f9e903c6>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Func_0x60_sum_acf01f1b3720286d
+	aotLib[0x2636579bf885195] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, TArray<float> const  &  ),&_Func_0x60_sum_acf01f1b3720286d>>();
+	};
+	// _Func_0x60_sum_ref_a1f1c405879e882c
+	aotLib[0xf3d9618b83926db5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, TArray<float> const  &  ),&_Func_0x60_sum_ref_a1f1c405879e882c>>();
+	};
+	// _Func_0x60_sum_eb38a83c107fb8bd
+	aotLib[0x42faebb3a0e60a19] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Func_0x60_sum_eb38a83c107fb8bd>>();
+	};
+	// _Func_0x60_sum_ref_dd8af90b4803d223
+	aotLib[0x226def16309abcc9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Func_0x60_sum_ref_dd8af90b4803d223>>();
+	};
+	// _Func_0x60_sum_54dfd57d2b8c7739
+	aotLib[0x5036c58854a910ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float4 (*) ( Context * __context__, TArray<float4> const  &  ),&_Func_0x60_sum_54dfd57d2b8c7739>>();
+	};
+	// _Func_0x60_sum_ref_2df45ff3c8b9f490
+	aotLib[0x22e937de98791295] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float4 (*) ( Context * __context__, TArray<float4> const  &  ),&_Func_0x60_sum_ref_2df45ff3c8b9f490>>();
+	};
+	// _Func_0x60_dot_7f4e93a3af0e87d9
+	aotLib[0xa59feaaa08bd505] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, TArray<float> const  & , TArray<float> const  &  ),&_Func_0x60_dot_7f4e93a3af0e87d9>>();
+	};
+	// _Func_0x60_dot_ref_57db12513aab4e83
+	aotLib[0x72552ac32d80dfa9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, TArray<float> const  & , TArray<float> const  &  ),&_Func_0x60_dot_ref_57db12513aab4e83>>();
+	};
+	// _Func_0x60_dot_e9fbfcc5344b0689
+	aotLib[0x81a42e55b44688ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  & , TArray<int32_t> const  &  ),&_Func_0x60_dot_e9fbfcc5344b0689>>();
+	};
+	// _Func_0x60_dot_ref_5ee5df70d83de719
+	aotLib[0x9177fba1c0b05151] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  & , TArray<int32_t> const  &  ),&_Func_0x60_dot_ref_5ee5df70d83de719>>();
+	};
+	// _Func_0x60_dot_9447f1b32b00dd81
+	aotLib[0xefb228cb8b2a2215] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float4 (*) ( Context * __context__, TArray<float4> const  & , TArray<float4> const  &  ),&_Func_0x60_dot_9447f1b32b00dd81>>();
+	};
+	// _Func_0x60_dot_ref_d35fdbb9f2fde503
+	aotLib[0xa964811c731ae7cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float4 (*) ( Context * __context__, TArray<float4> const  & , TArray<float4> const  &  ),&_Func_0x60_dot_ref_d35fdbb9f2fde503>>();
+	};
+	// _Func_0x60_scale_4df4829dddbe05f5
+	aotLib[0x453f423d256cea61] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float  ),&_Func_0x60_scale_4df4829dddbe05f5>>();
+	};
+	// _Func_0x60_offset_e743e8517318604f
+	aotLib[0xe13ce81de47083a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Func_0x60_offset_e743e8517318604f>>();
+	};
+	// _Func_0x60_scale_52b8f28a8d0f4e00
+	aotLib[0xbf0b9b4ff18bad65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Func_0x60_scale_52b8f28a8d0f4e00>>();
+	};
+	// _Func_0x60_offset_a4ca108e275e6172
+	aotLib[0xf62ce5f2450d34bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Func_0x60_offset_a4ca108e275e6172>>();
+	};
+	// _Func_0x60_scale_863d422fab3b9dfd
+	aotLib[0xa2cbefb4d1e6a73d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> & , float4  ),&_Func_0x60_scale_863d422fab3b9dfd>>();
+	};
+	// _Func_0x60_axpy_77d286e1245bc590
+	aotLib[0xba703cdd51259d85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , TArray<float> const  & , float  ),&_Func_0x60_axpy_77d286e1245bc590>>();
+	};
+	// _Func_0x60_axpy_ref_7f5068e9a2824add
+	aotLib[0x8396abad54477939] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , TArray<float> const  & , float  ),&_Func_0x60_axpy_ref_7f5068e9a2824add>>();
+	};
+	// _Func_0x60_same_af1cf5d725ae1d65
+	aotLib[0xd02ba5ebcf1da315] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<float> const  & , TArray<float> const  &  ),&_Func_0x60_same_af1cf5d725ae1d65>>();
+	};
+	// _Func_0x60_axpy_left_6ad1477e8b751ded
+	aotLib[0x9e8def7ea1365ff1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , TArray<float> const  & , float  ),&_Func_0x60_axpy_left_6ad1477e8b751ded>>();
+	};
+	// _Func_0x60_axpy_5ebe8d1c27784f1d
+	aotLib[0x6bd308fbe35943e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  & , int32_t  ),&_Func_0x60_axpy_5ebe8d1c27784f1d>>();
+	};
+	// _Func_0x60_axpy_ref_b7ab93166e2ae3ad
+	aotLib[0xa23b27c90f677bc1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  & , int32_t  ),&_Func_0x60_axpy_ref_b7ab93166e2ae3ad>>();
+	};
+	// _Func_0x60_same_e3eb7b0511ce9118
+	aotLib[0xcd7be213e5a8b075] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<int32_t> const  & , TArray<int32_t> const  &  ),&_Func_0x60_same_e3eb7b0511ce9118>>();
+	};
+	// _Func_0x60_axpy_1c03455f86902684
+	aotLib[0x84a25a3de11c3f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> & , TArray<float4> const  & , float4  ),&_Func_0x60_axpy_1c03455f86902684>>();
+	};
+	// _Func_0x60_axpy_ref_49c1b9024520585f
+	aotLib[0xe092cb0e5f36a6dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> & , TArray<float4> const  & , float4  ),&_Func_0x60_axpy_ref_49c1b9024520585f>>();
+	};
+	// _Func_0x60_same_2e3903a41a39a699
+	aotLib[0x808d0792c6236239] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<float4> const  & , TArray<float4> const  &  ),&_Func_0x60_same_2e3903a41a39a699>>();
+	};
+	// _Funcbuiltin_0x60_push_e40cc9c689790847
+	aotLib[0x9148e5718d29512d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Item> & , Item const  &  ),&_Funcbuiltin_0x60_push_e40cc9c689790847>>();
+	};
+	// sum_squares_98c59cee9ce9a2f3
+	aotLib[0xa63df46cbc520361] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, TArray<float> const  &  ),&sum_squares_98c59cee9ce9a2f3>>();
+	};
+	// sum_fields_c7efad8523532b13
+	aotLib[0xf6fe8b7f01bdad0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<Item> const  &  ),&sum_fields_c7efad8523532b13>>();
+	};
+	// scale_fields_2a1af93faefc700f
+	aotLib[0x7566728167159b01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Item> & , float  ),&scale_fields_2a1af93faefc700f>>();
+	};
+	// sum_fixed_717d5300f537ac14
+	aotLib[0xe0e173bfc521cd01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<int32_t,7> const  &  ),&sum_fixed_717d5300f537ac14>>();
+	};
+	// scale_fixed_af5cc6388d43384d
+	aotLib[0xf5c9151a160bde1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<float,7> & , float  ),&scale_fixed_af5cc6388d43384d>>();
+	};
+	// make_floats_500cf72352b74b16
+	aotLib[0x19eb1d41db449288] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<float> (*) ( Context * __context__, int32_t , int32_t  ),&make_floats_500cf72352b74b16>>();
+	};
+	// make_ints_14ee53421dc54809
+	aotLib[0x30d95290ee7f6225] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, int32_t , int32_t  ),&make_ints_14ee53421dc54809>>();
+	};
+	// make_float4s_bd15e06ab15e151d
+	aotLib[0x8d19fae217751683] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<float4> (*) ( Context * __context__, int32_t , int32_t  ),&make_float4s_bd15e06ab15e151d>>();
+	};
+	// test_abd0904b4d669855
+	aotLib[0x877a544506594cc3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_abd0904b4d669855>>();
+	};
+	// [[ init script ]]
+	aotLib[0x6f8dd3f1c63a8ba] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,549 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10201408365578945981 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Item; };
+namespace  {
+
+struct Item {
+	float x;
+	int32_t n;
+};
+static_assert(sizeof(Item)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Item,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Item,n)==4,"structure field offset mismatch with DAS");
+}
+
+inline int32_t _Func_0x60_count_ops_ff2f2ef0c96dc365 ( Context * __context__, int32_t __a_rename_at_10, int32_t __b_rename_at_10 );
+inline int32_t _Func_0x60_count_ops_10379a6c94ff755d ( Context * __context__, uint32_t __a_rename_at_10, uint32_t __b_rename_at_10 );
+inline int32_t _Func_0x60_count_ops_921aad64f9680e7d ( Context * __context__, int64_t __a_rename_at_10, int64_t __b_rename_at_10 );
+inline int32_t _Func_0x60_count_ops_570208655abcdd5d ( Context * __context__, uint64_t __a_rename_at_10, uint64_t __b_rename_at_10 );
+inline int32_t _Func_0x60_count_ops_4d5476dc53cdc8bb ( Context * __context__, float __a_rename_at_10, float __b_rename_at_10 );
+inline int32_t _Func_0x60_count_ops_7ac9612c857ff597 ( Context * __context__, double __a_rename_at_10, double __b_rename_at_10 );
+inline int32_t _Func_0x60_count_ops_local_7dcba429c5f7fbcf ( Context * __context__, int32_t __a_rename_at_27, int32_t __b_rename_at_27 );
+inline int32_t _Func_0x60_count_ops_local_1a07c3d304076dad ( Context * __context__, float __a_rename_at_27, float __b_rename_at_27 );
+inline int32_t while_less_4d9169ded3c204f ( Context * __context__, int32_t __n_rename_at_44 );
+inline int32_t while_break_4588f4d0899849ce ( Context * __context__, int32_t __n_rename_at_53 );
+inline int32_t ternary_f49affb29c0c60ff ( Context * __context__, int32_t __a_rename_at_62, int32_t __b_rename_at_62 );
+inline int32_t count_items_arg_b033d5e044b17cad ( Context * __context__, TDim<Item,8> & __items_rename_at_66, float __limit_rename_at_66 );
+inline int32_t count_items_local_96e13c27aebb7684 ( Context * __context__, int32_t __limit_rename_at_74 );
+inline bool out_of_range_231a2b8ffa6655c6 ( Context * __context__, int32_t __k_rename_at_87 );
+inline bool test_e886aaa11f79e0ed ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0xac17bc5cb19166f1>(__context__) = 5;/*g_limit*/
+}
+
+inline int32_t _Func_0x60_count_ops_ff2f2ef0c96dc365 ( Context * __context__, int32_t __a_rename_at_10, int32_t __b_rename_at_10 )
+{
+	int32_t __res_rename_at_11 = 0;
+	if ( __a_rename_at_10 == __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 1;
+	};
+	if ( __a_rename_at_10 != __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 2;
+	};
+	if ( __a_rename_at_10 < __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 4;
+	};
+	if ( __a_rename_at_10 <= __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 8;
+	};
+	if ( __a_rename_at_10 > __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 16;
+	};
+	if ( __a_rename_at_10 >= __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 32;
+	};
+	return das_auto_cast<int32_t>::cast(__res_rename_at_11);
+}
+
+inline int32_t _Func_0x60_count_ops_10379a6c94ff755d ( Context * __context__, uint32_t __a_rename_at_10, uint32_t __b_rename_at_10 )
+{
+	int32_t __res_rename_at_11 = 0;
+	if ( __a_rename_at_10 == __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 1;
+	};
+	if ( __a_rename_at_10 != __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 2;
+	};
+	if ( __a_rename_at_10 < __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 4;
+	};
+	if ( __a_rename_at_10 <= __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 8;
+	};
+	if ( __a_rename_at_10 > __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 16;
+	};
+	if ( __a_rename_at_10 >= __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 32;
+	};
+	return das_auto_cast<int32_t>::cast(__res_rename_at_11);
+}
+
+inline int32_t _Func_0x60_count_ops_921aad64f9680e7d ( Context * __context__, int64_t __a_rename_at_10, int64_t __b_rename_at_10 )
+{
+	int32_t __res_rename_at_11 = 0;
+	if ( __a_rename_at_10 == __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 1;
+	};
+	if ( __a_rename_at_10 != __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 2;
+	};
+	if ( __a_rename_at_10 < __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 4;
+	};
+	if ( __a_rename_at_10 <= __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 8;
+	};
+	if ( __a_rename_at_10 > __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 16;
+	};
+	if ( __a_rename_at_10 >= __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 32;
+	};
+	return das_auto_cast<int32_t>::cast(__res_rename_at_11);
+}
+
+inline int32_t _Func_0x60_count_ops_570208655abcdd5d ( Context * __context__, uint64_t __a_rename_at_10, uint64_t __b_rename_at_10 )
+{
+	int32_t __res_rename_at_11 = 0;
+	if ( __a_rename_at_10 == __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 1;
+	};
+	if ( __a_rename_at_10 != __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 2;
+	};
+	if ( __a_rename_at_10 < __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 4;
+	};
+	if ( __a_rename_at_10 <= __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 8;
+	};
+	if ( __a_rename_at_10 > __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 16;
+	};
+	if ( __a_rename_at_10 >= __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 32;
+	};
+	return das_auto_cast<int32_t>::cast(__res_rename_at_11);
+}
+
+inline int32_t _Func_0x60_count_ops_4d5476dc53cdc8bb ( Context * __context__, float __a_rename_at_10, float __b_rename_at_10 )
+{
+	int32_t __res_rename_at_11 = 0;
+	if ( __a_rename_at_10 == __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 1;
+	};
+	if ( __a_rename_at_10 != __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 2;
+	};
+	if ( __a_rename_at_10 < __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 4;
+	};
+	if ( __a_rename_at_10 <= __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 8;
+	};
+	if ( __a_rename_at_10 > __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 16;
+	};
+	if ( __a_rename_at_10 >= __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 32;
+	};
+	return das_auto_cast<int32_t>::cast(__res_rename_at_11);
+}
+
+inline int32_t _Func_0x60_count_ops_7ac9612c857ff597 ( Context * __context__, double __a_rename_at_10, double __b_rename_at_10 )
+{
+	int32_t __res_rename_at_11 = 0;
+	if ( __a_rename_at_10 == __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 1;
+	};
+	if ( __a_rename_at_10 != __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 2;
+	};
+	if ( __a_rename_at_10 < __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 4;
+	};
+	if ( __a_rename_at_10 <= __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 8;
+	};
+	if ( __a_rename_at_10 > __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 16;
+	};
+	if ( __a_rename_at_10 >= __b_rename_at_10 )
+	{
+		__res_rename_at_11 |= 32;
+	};
+	return das_auto_cast<int32_t>::cast(__res_rename_at_11);
+}
+
+inline int32_t _Func_0x60_count_ops_local_7dcba429c5f7fbcf ( Context * __context__, int32_t __a_rename_at_27, int32_t __b_rename_at_27 )
+{
+	int32_t __la_rename_at_28 = ((int32_t)__a_rename_at_27);
+	int32_t __lb_rename_at_29 = ((int32_t)__b_rename_at_27);
+	int32_t __res_rename_at_30 = 0;
+	if ( __la_rename_at_28 == __lb_rename_at_29 )
+	{
+		__res_rename_at_30 |= 1;
+	} else {
+		__res_rename_at_30 |= 64;
+	};
+	if ( __la_rename_at_28 < __lb_rename_at_29 )
+	{
+		__res_rename_at_30 |= 4;
+	} else {
+		__res_rename_at_30 |= 128;
+	};
+	if ( __la_rename_at_28 >= 3 )
+	{
+		__res_rename_at_30 |= 32;
+	};
+	return das_auto_cast<int32_t>::cast(__res_rename_at_30);
+}
+
+inline int32_t _Func_0x60_count_ops_local_1a07c3d304076dad ( Context * __context__, float __a_rename_at_27, float __b_rename_at_27 )
+{
+	float __la_rename_at_28 = ((float)__a_rename_at_27);
+	float __lb_rename_at_29 = ((float)__b_rename_at_27);
+	int32_t __res_rename_at_30 = 0;
+	if ( __la_rename_at_28 == __lb_rename_at_29 )
+	{
+		__res_rename_at_30 |= 1;
+	} else {
+		__res_rename_at_30 |= 64;
+	};
+	if ( __la_rename_at_28 < __lb_rename_at_29 )
+	{
+		__res_rename_at_30 |= 4;
+	} else {
+		__res_rename_at_30 |= 128;
+	};
+	if ( __la_rename_at_28 >= 3.f )
+	{
+		__res_rename_at_30 |= 32;
+	};
+	return das_auto_cast<int32_t>::cast(__res_rename_at_30);
+}
+
+inline int32_t while_less_4d9169ded3c204f ( Context * __context__, int32_t __n_rename_at_44 )
+{
+	int32_t __i_rename_at_45 = 0;
+	int32_t __total_rename_at_46 = 0;
+	while ( __i_rename_at_45 < __n_rename_at_44 )
+	{
+		__total_rename_at_46 += __i_rename_at_45;
+		++__i_rename_at_45;
+	};
+	return das_auto_cast<int32_t>::cast(__total_rename_at_46);
+}
+
+inline int32_t while_break_4588f4d0899849ce ( Context * __context__, int32_t __n_rename_at_53 )
+{
+	int32_t __i_rename_at_54 = 0;
+	while ( __i_rename_at_54 != 100 )
+	{
+		if ( __i_rename_at_54 == __n_rename_at_53 )
+		{
+			break;
+		} else {
+			++__i_rename_at_54;
+		};
+	};
+	return das_auto_cast<int32_t>::cast(__i_rename_at_54);
+}
+
+inline int32_t ternary_f49affb29c0c60ff ( Context * __context__, int32_t __a_rename_at_62, int32_t __b_rename_at_62 )
+{
+	return das_auto_cast<int32_t>::cast((__a_rename_at_62 < __b_rename_at_62) ? das_auto_cast<int32_t>::cast(__a_rename_at_62) : das_auto_cast<int32_t>::cast(__b_rename_at_62));
+}
+
+inline int32_t count_items_arg_b033d5e044b17cad ( Context * __context__, TDim<Item,8> &  __items_rename_at_66, float __limit_rename_at_66 )
+{
+	int32_t __total_rename_at_67 = 0;
+	{
+		bool __need_loop_68 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,8));
+		int32_t __i_rename_at_68;
+		__need_loop_68 = __i_iterator.first(__context__,(__i_rename_at_68)) && __need_loop_68;
+		for ( ; __need_loop_68 ; __need_loop_68 = __i_iterator.next(__context__,(__i_rename_at_68)) )
+		{
+			if ( __items_rename_at_66(__i_rename_at_68,__context__).x < __limit_rename_at_66 )
+			{
+				++__total_rename_at_67;
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_68));
+	};
+	return das_auto_cast<int32_t>::cast(__total_rename_at_67);
+}
+
+inline int32_t count_items_local_96e13c27aebb7684 ( Context * __context__, int32_t __limit_rename_at_74 )
+{
+	TDim<Item,8> __items_rename_at_75; das_zero(__items_rename_at_75);
+	{
+		bool __need_loop_76 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,8));
+		int32_t __i_rename_at_76;
+		__need_loop_76 = __i_iterator.first(__context__,(__i_rename_at_76)) && __need_loop_76;
+		for ( ; __need_loop_76 ; __need_loop_76 = __i_iterator.next(__context__,(__i_rename_at_76)) )
+		{
+			das_copy(__items_rename_at_75(__i_rename_at_76,__context__).n,__i_rename_at_76);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_76));
+	};
+	int32_t __total_rename_at_78 = 0;
+	int32_t __i_rename_at_79 = 0;
+	while ( __i_rename_at_79 < 8 )
+	{
+		if ( __items_rename_at_75(__i_rename_at_79,__context__).n >= __limit_rename_at_74 )
+		{
+			++__total_rename_at_78;
+		};
+		++__i_rename_at_79;
+	};
+	return das_auto_cast<int32_t>::cast(__total_rename_at_78);
+}
+
+inline bool out_of_range_231a2b8ffa6655c6 ( Context * __context__, int32_t __k_rename_at_87 )
+{
+	TDim<Item,8> __items_rename_at_88; das_zero(__items_rename_at_88);
+	int32_t __i_rename_at_89 = __k_rename_at_87;
+	bool __failed_rename_at_90 = false;
+	das_try_recover(__context__, [&]()
+	{
+		if ( __items_rename_at_88(__i_rename_at_89,__context__).n == 0 )
+		{
+			return das_auto_cast<bool>::cast(false);
+		};
+	}, [&]()
+	{
+		das_copy(__failed_rename_at_90,true);
+	});
+	return das_auto_cast<bool>::cast(__failed_rename_at_90);
+}
+
+inline bool test_e886aaa11f79e0ed ( Context * __context__ )
+{
+	TDim<int32_t,3> _temp_make_local_100_32;
+	TDim<int32_t,3> _temp_make_local_100_48;
+	{
+		bool __need_loop_100 = true;
+		// a : int&
+		das_iterator<TDim<int32_t,3>> __a_iterator((([&]() -> TDim<int32_t,3>& {
+			_temp_make_local_100_32(0,__context__) = 1;
+			_temp_make_local_100_32(1,__context__) = 2;
+			_temp_make_local_100_32(2,__context__) = 3;
+			return _temp_make_local_100_32;
+		})()));
+		int32_t * __a_rename_at_100;
+		__need_loop_100 = __a_iterator.first(__context__,(__a_rename_at_100)) && __need_loop_100;
+		// b : int&
+		das_iterator<TDim<int32_t,3>> __b_iterator((([&]() -> TDim<int32_t,3>& {
+			_temp_make_local_100_48(0,__context__) = 2;
+			_temp_make_local_100_48(1,__context__) = 2;
+			_temp_make_local_100_48(2,__context__) = 2;
+			return _temp_make_local_100_48;
+		})()));
+		int32_t * __b_rename_at_100;
+		__need_loop_100 = __b_iterator.first(__context__,(__b_rename_at_100)) && __need_loop_100;
+		for ( ; __need_loop_100 ; __need_loop_100 = __a_iterator.next(__context__,(__a_rename_at_100)) && __b_iterator.next(__context__,(__b_rename_at_100)) )
+		{
+			DAS_VERIFY((_Func_0x60_count_ops_ff2f2ef0c96dc365(__context__,(*__a_rename_at_100),(*__b_rename_at_100)) == (((((((*__a_rename_at_100) == (*__b_rename_at_100)) ? das_auto_cast<int32_t>::cast(1) : das_auto_cast<int32_t>::cast(2)) | (((*__a_rename_at_100) < (*__b_rename_at_100)) ? das_auto_cast<int32_t>::cast(4) : das_auto_cast<int32_t>::cast(0))) | (((*__a_rename_at_100) <= (*__b_rename_at_100)) ? das_auto_cast<int32_t>::cast(8) : das_auto_cast<int32_t>::cast(0))) | (((*__a_rename_at_100) > (*__b_rename_at_100)) ? das_auto_cast<int32_t>::cast(16) : das_auto_cast<int32_t>::cast(0))) | (((*__a_rename_at_100) >= (*__b_rename_at_100)) ? das_auto_cast<int32_t>::cast(32) : das_auto_cast<int32_t>::cast(0)))));
+		}
+		__a_iterator.close(__context__,(__a_rename_at_100));
+		__b_iterator.close(__context__,(__b_rename_at_100));
+	};
+	DAS_VERIFY((_Func_0x60_count_ops_10379a6c94ff755d(__context__,0x1u,0x2u) == 14));
+	DAS_VERIFY((_Func_0x60_count_ops_921aad64f9680e7d(__context__,INT64_C(2),INT64_C(2)) == 41));
+	DAS_VERIFY((_Func_0x60_count_ops_570208655abcdd5d(__context__,UINT64_C(0x3),UINT64_C(0x2)) == 50));
+	DAS_VERIFY((_Func_0x60_count_ops_4d5476dc53cdc8bb(__context__,1.f,2.f) == 14));
+	DAS_VERIFY((_Func_0x60_count_ops_7ac9612c857ff597(__context__,2.,1.) == 50));
+	DAS_VERIFY((_Func_0x60_count_ops_local_7dcba429c5f7fbcf(__context__,3,3) == 161));
+	DAS_VERIFY((_Func_0x60_count_ops_local_1a07c3d304076dad(__context__,1.f,2.f) == 68));
+	DAS_VERIFY((while_less_4d9169ded3c204f(__context__,das_global<int32_t,0xac17bc5cb19166f1>(__context__) /*g_limit*/) == 10));
+	DAS_VERIFY((while_break_4588f4d0899849ce(__context__,das_global<int32_t,0xac17bc5cb19166f1>(__context__) /*g_limit*/) == 5));
+	DAS_VERIFY(((ternary_f49affb29c0c60ff(__context__,das_global<int32_t,0xac17bc5cb19166f1>(__context__) /*g_limit*/,3) == 3) && (ternary_f49affb29c0c60ff(__context__,1,das_global<int32_t,0xac17bc5cb19166f1>(__context__) /*g_limit*/) == 1)));
+	TDim<Item,8> __items_rename_at_112; das_zero(__items_rename_at_112);
+	{
+		bool __need_loop_113 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,8));
+		int32_t __i_rename_at_113;
+		__need_loop_113 = __i_iterator.first(__context__,(__i_rename_at_113)) && __need_loop_113;
+		for ( ; __need_loop_113 ; __need_loop_113 = __i_iterator.next(__context__,(__i_rename_at_113)) )
+		{
+			das_copy(__items_rename_at_112(__i_rename_at_113,__context__).x,float(__i_rename_at_113));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_113));
+	};
+	DAS_VERIFY((count_items_arg_b033d5e044b17cad(__context__,das_arg<TDim<Item,8>>::pass(__items_rename_at_112),float(das_global<int32_t,0xac17bc5cb19166f1>(__context__) /*g_limit*/)) == 5));
+	DAS_VERIFY((count_items_local_96e13c27aebb7684(__context__,das_global<int32_t,0xac17bc5cb19166f1>(__context__) /*g_limit*/) == 3));
+	DAS_VERIFY((out_of_range_231a2b8ffa6655c6(__context__,das_global<int32_t,0xac17bc5cb19166f1>(__context__) /*g_limit*/ + 10)));
+	DAS_VERIFY((!out_of_range_231a2b8ffa6655c6(__context__,das_global<int32_t,0xac17bc5cb19166f1>(__context__) /*g_limit*/)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_count_ops_ff2f2ef0c96dc365
+	aotLib[0x9f27efd3b764c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t  ),&_Func_0x60_count_ops_ff2f2ef0c96dc365>>();
+	};
+	// _Func_0x60_count_ops_10379a6c94ff755d
+	aotLib[0x98978129b262e6cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, uint32_t , uint32_t  ),&_Func_0x60_count_ops_10379a6c94ff755d>>();
+	};
+	// _Func_0x60_count_ops_921aad64f9680e7d
+	aotLib[0x5f66add63b2281e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int64_t , int64_t  ),&_Func_0x60_count_ops_921aad64f9680e7d>>();
+	};
+	// _Func_0x60_count_ops_570208655abcdd5d
+	aotLib[0x3188c77364cf2c1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, uint64_t , uint64_t  ),&_Func_0x60_count_ops_570208655abcdd5d>>();
+	};
+	// _Func_0x60_count_ops_4d5476dc53cdc8bb
+	aotLib[0x7b413c42d209e0c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, float , float  ),&_Func_0x60_count_ops_4d5476dc53cdc8bb>>();
+	};
+	// _Func_0x60_count_ops_7ac9612c857ff597
+	aotLib[0x106529fa852ece55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, double , double  ),&_Func_0x60_count_ops_7ac9612c857ff597>>();
+	};
+	// _Func_0x60_count_ops_local_7dcba429c5f7fbcf
+	aotLib[0x819c432d09cf6139] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t  ),&_Func_0x60_count_ops_local_7dcba429c5f7fbcf>>();
+	};
+	// _Func_0x60_count_ops_local_1a07c3d304076dad
+	aotLib[0xd796633ea081313d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, float , float  ),&_Func_0x60_count_ops_local_1a07c3d304076dad>>();
+	};
+	// while_less_4d9169ded3c204f
+	aotLib[0x9e7d09bc45690231] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&while_less_4d9169ded3c204f>>();
+	};
+	// while_break_4588f4d0899849ce
+	aotLib[0x49febfc494cf2269] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&while_break_4588f4d0899849ce>>();
+	};
+	// ternary_f49affb29c0c60ff
+	aotLib[0x6a8c6a153f790fe1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t  ),&ternary_f49affb29c0c60ff>>();
+	};
+	// count_items_arg_b033d5e044b17cad
+	aotLib[0x8753a42dc01cdcfd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<Item,8> & , float  ),&count_items_arg_b033d5e044b17cad>>();
+	};
+	// count_items_local_96e13c27aebb7684
+	aotLib[0xa85a70d829a81049] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&count_items_local_96e13c27aebb7684>>();
+	};
+	// out_of_range_231a2b8ffa6655c6
+	aotLib[0x99a15ddf48f0bcb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&out_of_range_231a2b8ffa6655c6>>();
+	};
+	// test_e886aaa11f79e0ed
+	aotLib[0x5d6a9a6b714344b3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e886aaa11f79e0ed>>();
+	};
+	// [[ init script ]]
+	aotLib[0xba961f8633b46a02] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
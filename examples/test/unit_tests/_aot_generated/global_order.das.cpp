@@ -0,0 +1,191 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11425675864343881732 {
+
+extern TypeInfo __type_info__6f902bb202c1ac85;
+extern TypeInfo __type_info__af63ee4c86020b22;
+
+TypeInfo __type_info__6f902bb202c1ac85 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, UINT64_C(0x6f902bb202c1ac85) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__6f902bb202c1ac85 };
+
+inline void _Funcbuiltin_0x60_clone_e2e23c7f9b9e7718 ( Context * __context__, TArray<char *> & __a_rename_at_338, TArray<char *> const  & __b_rename_at_338 );
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline TArray<char *> _Func_0x60_clone_a07b04562214039c ( Context * __context__, TArray<char *> const  & __value_rename_at_1 );
+inline TArray<char *> test_a_b2fe8008196d83ca ( Context * __context__ );
+inline TArray<char *> test_0_13f1245414923558 ( Context * __context__ );
+inline bool test_b0087d371648db3f ( Context * __context__ );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_ef283e7163129fb4 ( Context * __context__, TDim<char *,1> & __a_rename_at_518 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	TDim<char *,1> _temp_make_local_7_32;
+	das_global<TArray<char *>,0x1534382860783a8e>(__context__) = _Funcbuiltin_0x60_to_array_move_ef283e7163129fb4(__context__,das_arg<TDim<char *,1>>::pass((([&]() -> TDim<char *,1>& {
+		_temp_make_local_7_32(0,__context__) = ((char *) "test");
+		return _temp_make_local_7_32;
+	})())));/*some_a*/
+	das_global<TArray<char *>,0x3f8ec523543bb886>(__context__) = test_a_b2fe8008196d83ca(__context__);/*some_0*/
+}
+
+inline void _Funcbuiltin_0x60_clone_e2e23c7f9b9e7718 ( Context * __context__, TArray<char *> &  __a_rename_at_338, TArray<char *> const  &  __b_rename_at_338 )
+{
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_338),builtin_array_size(__b_rename_at_338));
+	{
+		bool __need_loop_340 = true;
+		// aV : string aka TT&
+		das_iterator<TArray<char *>> __aV_iterator(__a_rename_at_338);
+		char * * __aV_rename_at_340;
+		__need_loop_340 = __aV_iterator.first(__context__,(__aV_rename_at_340)) && __need_loop_340;
+		// bV : string const&
+		das_iterator<TArray<char *> const > __bV_iterator(__b_rename_at_338);
+		char * const  * __bV_rename_at_340;
+		__need_loop_340 = __bV_iterator.first(__context__,(__bV_rename_at_340)) && __need_loop_340;
+		for ( ; __need_loop_340 ; __need_loop_340 = __aV_iterator.next(__context__,(__aV_rename_at_340)) && __bV_iterator.next(__context__,(__bV_rename_at_340)) )
+		{
+			das_copy((*__aV_rename_at_340),(*__bV_rename_at_340));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_340));
+		__bV_iterator.close(__context__,(__bV_rename_at_340));
+	};
+}
+
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<char *> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<char *> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,8,__context__);
+}
+
+inline TArray<char *> _Func_0x60_clone_a07b04562214039c ( Context * __context__, TArray<char *> const  &  __value_rename_at_1 )
+{
+	TArray<char *> __res_rename_at_2; das_zero(__res_rename_at_2);
+	_Funcbuiltin_0x60_clone_e2e23c7f9b9e7718(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_2),__value_rename_at_1);
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_2)));
+}
+
+inline TArray<char *> test_a_b2fe8008196d83ca ( Context * __context__ )
+{
+	TArray<char *> _temp_make_local_11_32;
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<char *>>::pass(das_global<TArray<char *>,0x1534382860783a8e>(__context__) /*some_a*/)) == 1));
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_11_32 = (_Func_0x60_clone_a07b04562214039c(__context__,das_arg<TArray<char *>>::pass(das_global<TArray<char *>,0x1534382860783a8e>(__context__) /*some_a*/)))))));
+}
+
+inline TArray<char *> test_0_13f1245414923558 ( Context * __context__ )
+{
+	TArray<char *> _temp_make_local_17_32;
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_17_32 = (_Func_0x60_clone_a07b04562214039c(__context__,das_global<TArray<char *>,0x3f8ec523543bb886>(__context__) /*some_0*/))))));
+}
+
+inline bool test_b0087d371648db3f ( Context * __context__ )
+{
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_ef283e7163129fb4 ( Context * __context__, TDim<char *,1> &  __a_rename_at_518 )
+{
+	TArray<char *> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_519),1);
+	das_copy(das_cast<TDim<char *,1>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(__arr_rename_at_519);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_clone_e2e23c7f9b9e7718
+	aotLib[0xacdefaebdd5c2397] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , TArray<char *> const  &  ),&_Funcbuiltin_0x60_clone_e2e23c7f9b9e7718>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465
+	aotLib[0xed99ea3c3e04d451] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<char *> & (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465>>();
+	};
+	// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+	aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+	// _Func_0x60_clone_a07b04562214039c
+	aotLib[0xda64f3b17037a85b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_clone_a07b04562214039c>>();
+	};
+	// test_a_b2fe8008196d83ca
+	aotLib[0x43a177f70ca355d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__ ),&test_a_b2fe8008196d83ca>>();
+	};
+	// test_0_13f1245414923558
+	aotLib[0xfbc4d3016fc0f25c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__ ),&test_0_13f1245414923558>>();
+	};
+	// test_b0087d371648db3f
+	aotLib[0x434f546c6487b225] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b0087d371648db3f>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_ef283e7163129fb4
+	aotLib[0x54e24ab48a6e85d7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,1> &  ),&_Funcbuiltin_0x60_to_array_move_ef283e7163129fb4>>();
+	};
+	// [[ init script ]]
+	aotLib[0xc728006778d6ea53] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,237 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15316999779741368410 {
+
+extern TypeInfo __type_info__2e57fe7e39654b68;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__5001bdb7716037d2;
+
+TypeInfo __type_info__2e57fe7e39654b68 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__5001bdb7716037d2, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x2e57fe7e39654b68) };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__5001bdb7716037d2 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~UnitTest::FancyClass"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 40, UINT64_C(0x5001bdb7716037d2) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__5001bdb7716037d2.resolveAnnotation();
+}
+
+TypeInfo * __tinfo_0[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__2e57fe7e39654b68, &__type_info__90f3d07b5a6ca13 };
+namespace  { struct Foo; };
+namespace  { struct TestObjectFooNative; };
+namespace  { struct TestObjectBarNative; };
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct Foo {
+	int32_t a;
+	int32_t b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct TestObjectFooNative {
+	int32_t fooData;
+};
+static_assert(sizeof(TestObjectFooNative)==4,"structure size mismatch with DAS");
+static_assert(offsetof(TestObjectFooNative,fooData)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct TestObjectBarNative {
+	TestObjectFooNative * fooPtr;
+	float barData;
+};
+static_assert(sizeof(TestObjectBarNative)==16,"structure size mismatch with DAS");
+static_assert(offsetof(TestObjectBarNative,fooPtr)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestObjectBarNative,barData)==8,"structure field offset mismatch with DAS");
+}
+
+inline void test_native_3288c86cc8dcfba3 ( Context * __context__ );
+inline void test_handled_9c21f93d9644a407 ( Context * __context__ );
+inline void test_fancy_container_7f931f22ac7a0e7b ( Context * __context__, TArray<FancyClass> & __a_rename_at_74 );
+inline void test_fancy_e04fcadcd191e279 ( Context * __context__ );
+inline void test_nc_alias_8576f8f782713426 ( Context * __context__ );
+inline bool test_7d7b8e84ec28fd3d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void test_native_3288c86cc8dcfba3 ( Context * __context__ )
+{
+	TestObjectFooNative * __a_rename_at_19 = 0;
+	TestObjectBarNative * __b_rename_at_20 = 0;
+	int32_t __idummy_rename_at_21 = 0;
+	float __fdummy_rename_at_22 = 0;
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<TestObjectFooNative,int32_t,&TestObjectFooNative::fooData>::get(__a_rename_at_19),__idummy_rename_at_21),1);
+	DAS_ASSERT((__idummy_rename_at_21 == 1));
+	das_copy(__a_rename_at_19,das_new<TestObjectFooNative>::make(__context__));
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<TestObjectFooNative,int32_t,&TestObjectFooNative::fooData>::get(__a_rename_at_19),__idummy_rename_at_21),2);
+	DAS_ASSERT(((__a_rename_at_19->fooData == 2) && (__idummy_rename_at_21 == 1)));
+	das_copy(das_null_coalescing<float &>::get(das_safe_navigation<TestObjectBarNative,float,&TestObjectBarNative::barData>::get(__b_rename_at_20),__fdummy_rename_at_22),1.f);
+	DAS_ASSERT((__fdummy_rename_at_22 == 1.f));
+	das_copy(__b_rename_at_20,das_new<TestObjectBarNative>::make(__context__));
+	das_copy(das_null_coalescing<float &>::get(das_safe_navigation<TestObjectBarNative,float,&TestObjectBarNative::barData>::get(__b_rename_at_20),__fdummy_rename_at_22),2.f);
+	DAS_ASSERT(((__b_rename_at_20->barData == 2.f) && (__fdummy_rename_at_22 == 1.f)));
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<TestObjectFooNative,int32_t,&TestObjectFooNative::fooData>::get(das_safe_navigation_ptr<TestObjectBarNative,TestObjectFooNative *,&TestObjectBarNative::fooPtr>::get(__b_rename_at_20)),__idummy_rename_at_21),3);
+	DAS_ASSERT((__idummy_rename_at_21 == 3));
+	das_copy(__b_rename_at_20->fooPtr,__a_rename_at_19);
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<TestObjectFooNative,int32_t,&TestObjectFooNative::fooData>::get(das_safe_navigation_ptr<TestObjectBarNative,TestObjectFooNative *,&TestObjectBarNative::fooPtr>::get(__b_rename_at_20)),__idummy_rename_at_21),4);
+	DAS_ASSERT(((__b_rename_at_20->fooPtr->fooData == 4) && (__idummy_rename_at_21 == 3)));
+}
+
+inline void test_handled_9c21f93d9644a407 ( Context * __context__ )
+{
+	TestObjectFoo * __a_rename_at_41 = 0;
+	TestObjectBar * __b_rename_at_42 = 0;
+	int32_t __idummy_rename_at_43 = 0;
+	float __fdummy_rename_at_44 = 0;
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation_handle<TestObjectFoo,int32_t>::get(__a_rename_at_41,([&](const TestObjectFoo * __any) -> auto & {return __any->fooData /*fooData*/;})),__idummy_rename_at_43),1);
+	DAS_ASSERT((__idummy_rename_at_43 == 1));
+	das_copy(__a_rename_at_41,das_new_handle<TestObjectFoo,false>::make(__context__));
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation_handle<TestObjectFoo,int32_t>::get(__a_rename_at_41,([&](const TestObjectFoo * __any) -> auto & {return __any->fooData /*fooData*/;})),__idummy_rename_at_43),2);
+	DAS_ASSERT(((__a_rename_at_41->fooData /*fooData*/ == 2) && (__idummy_rename_at_43 == 1)));
+	das_copy(das_null_coalescing<float &>::get(das_safe_navigation_handle<TestObjectBar,float>::get(__b_rename_at_42,([&](const TestObjectBar * __any) -> auto & {return __any->barData /*barData*/;})),__fdummy_rename_at_44),1.f);
+	DAS_ASSERT((__fdummy_rename_at_44 == 1.f));
+	das_copy(__b_rename_at_42,das_new_handle<TestObjectBar,false>::make(__context__));
+	das_copy(das_null_coalescing<float &>::get(das_safe_navigation_handle<TestObjectBar,float>::get(__b_rename_at_42,([&](const TestObjectBar * __any) -> auto & {return __any->barData /*barData*/;})),__fdummy_rename_at_44),2.f);
+	DAS_ASSERT(((__b_rename_at_42->barData /*barData*/ == 2.f) && (__fdummy_rename_at_44 == 1.f)));
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation_handle<TestObjectFoo,int32_t>::get(das_safe_navigation_handle_ptr<TestObjectBar,TestObjectFoo *>::get(__b_rename_at_42,([&](const TestObjectBar * __any) -> auto & {return __any->fooPtr /*fooPtr*/;})),([&](const TestObjectFoo * __any) -> auto & {return __any->fooData /*fooData*/;})),__idummy_rename_at_43),3);
+	DAS_ASSERT((__idummy_rename_at_43 == 3));
+	das_copy(__b_rename_at_42->fooPtr /*fooPtr*/,__a_rename_at_41);
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation_handle<TestObjectFoo,int32_t>::get(das_safe_navigation_handle_ptr<TestObjectBar,TestObjectFoo *>::get(__b_rename_at_42,([&](const TestObjectBar * __any) -> auto & {return __any->fooPtr /*fooPtr*/;})),([&](const TestObjectFoo * __any) -> auto & {return __any->fooData /*fooData*/;})),__idummy_rename_at_43),4);
+	DAS_ASSERT(((__b_rename_at_42->fooPtr /*fooPtr*/->fooData /*fooData*/ == 4) && (__idummy_rename_at_43 == 3)));
+	das_copy(__a_rename_at_41->fooData /*fooData*/,7);
+	DAS_ASSERT((__a_rename_at_41->propAdd13() /*propAdd13*/ == 20));
+	DAS_ASSERT((__b_rename_at_42->getFoo() /*getFoo*/.fooData /*fooData*/ == 7));
+	DAS_ASSERT((das_deref(__context__,__b_rename_at_42->getFooPtr() /*getFooPtr*/).fooData /*fooData*/ == 7));
+	DAS_ASSERT((das_equ(das_arg<TestObjectFoo>::pass(das_deref(__context__,__a_rename_at_41)),das_arg<TestObjectFoo>::pass(das_deref(__context__,__b_rename_at_42->fooPtr /*fooPtr*/)))));
+	DAS_ASSERT((!(das_nequ(das_arg<TestObjectFoo>::pass(das_deref(__context__,__a_rename_at_41)),das_arg<TestObjectFoo>::pass(das_deref(__context__,__b_rename_at_42->fooPtr /*fooPtr*/))))));
+	das_call_member< DAS_BIND_MEMBER_FUN(TestObjectFoo::hitMe)>::invoke(das_arg<TestObjectFoo>::pass(das_deref(__context__,__a_rename_at_41)),1,2);
+	DAS_ASSERT((__a_rename_at_41->fooData /*fooData*/ == 3));
+	das_delete_handle<TestObjectFoo *>::clear(__context__,__a_rename_at_41);
+	das_delete_handle<TestObjectBar *>::clear(__context__,__b_rename_at_42);
+}
+
+inline void test_fancy_container_7f931f22ac7a0e7b ( Context * __context__, TArray<FancyClass> &  __a_rename_at_74 )
+{
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "a = ")), cast<TArray<FancyClass> &>::from(__a_rename_at_74), cast<char * const >::from(((char *) "\n")))),__context__);
+}
+
+inline void test_fancy_e04fcadcd191e279 ( Context * __context__ )
+{
+	FancyClass __fc0_rename_at_78 = /*c-tor*/ FancyClass(/*end-c-tor*/);
+	DAS_ASSERT((__fc0_rename_at_78.value /*value*/ == 13));
+	FancyClass __fc_rename_at_80 = FancyClass(1,2);
+	DAS_ASSERT((__fc_rename_at_80.value /*value*/ == 3));
+	das_using<FancyClass>::use([&](FancyClass & __f_rename_at_82)->void{
+		DAS_ASSERT((__f_rename_at_82.value /*value*/ == 13));
+	});
+	das_using<FancyClass>::use(1,3,[&](FancyClass & __f_rename_at_84)->void{
+		DAS_ASSERT((__f_rename_at_84.value /*value*/ == 4));
+	});
+}
+
+inline void test_nc_alias_8576f8f782713426 ( Context * __context__ )
+{
+	TestObjectFoo * __lookingAt_rename_at_88 = das_new_handle<TestObjectFoo,false>::make(__context__);
+	float3 __lookPos_rename_at_89 = das_null_coalescing<float3>::get((float3 *)__lookingAt_rename_at_88->lookAt /*lookAt*/,v_zero());
+	DAS_ASSERT((SimPolicy<float3>::Equ(__lookPos_rename_at_89,v_zero(),*__context__,nullptr)));
+	das_delete_handle<TestObjectFoo *>::clear(__context__,__lookingAt_rename_at_88);
+}
+
+inline bool test_7d7b8e84ec28fd3d ( Context * __context__ )
+{
+	test_native_3288c86cc8dcfba3(__context__);
+	test_handled_9c21f93d9644a407(__context__);
+	test_fancy_e04fcadcd191e279(__context__);
+	test_nc_alias_8576f8f782713426(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// test_native_3288c86cc8dcfba3
+	aotLib[0x9d8924ada2aff1cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_native_3288c86cc8dcfba3>>();
+	};
+	// test_handled_9c21f93d9644a407
+	aotLib[0xe6e3eae3de546469] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_handled_9c21f93d9644a407>>();
+	};
+	// test_fancy_container_7f931f22ac7a0e7b
+	aotLib[0xdb23562e5bb455e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<FancyClass> &  ),&test_fancy_container_7f931f22ac7a0e7b>>();
+	};
+	// test_fancy_e04fcadcd191e279
+	aotLib[0x1a780944fb410445] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_fancy_e04fcadcd191e279>>();
+	};
+	// test_nc_alias_8576f8f782713426
+	aotLib[0x20de620fa5a8a909] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_nc_alias_8576f8f782713426>>();
+	};
+	// test_7d7b8e84ec28fd3d
+	aotLib[0xb62365293ab0103c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_7d7b8e84ec28fd3d>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
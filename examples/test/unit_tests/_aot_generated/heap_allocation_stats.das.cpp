@@ -0,0 +1,229 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11227492297353009529 {
+
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern VarInfo __var_info__c9554a08bbda1f81;
+extern VarInfo __var_info__3f655087b6e04f42;
+extern VarInfo __var_info__2f53c8e032412ca0;
+extern VarInfo __var_info__a8e1c82ffed78f14;
+extern VarInfo __var_info__9e745370c45d4b84;
+extern FuncInfo __func_info__ab162d3750b36392;
+
+VarInfo __func_info__ab162d3750b36392_field_0 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xc9554a08bbda1f81), "a", 0 };
+VarInfo __func_info__ab162d3750b36392_field_1 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0x2f53c8e032412ca0), "f", 0 };
+VarInfo __func_info__ab162d3750b36392_field_2 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0x3f655087b6e04f42), "h", 0 };
+VarInfo __func_info__ab162d3750b36392_field_3 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0x9e745370c45d4b84), "b", 0 };
+VarInfo __func_info__ab162d3750b36392_field_4 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xa8e1c82ffed78f14), "r", 0 };
+VarInfo * __func_info__ab162d3750b36392_fields[5] =  { &__func_info__ab162d3750b36392_field_0, &__func_info__ab162d3750b36392_field_1, &__func_info__ab162d3750b36392_field_2, &__func_info__ab162d3750b36392_field_3, &__func_info__ab162d3750b36392_field_4 };
+FuncInfo __func_info__ab162d3750b36392 = {"invoke block<(a:uint64;f:uint64;h:uint64;b:uint64;r:uint64):void> const", "", __func_info__ab162d3750b36392_fields, 5, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xab162d3750b36392), 0x0 };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+namespace  { struct Node; };
+namespace  { struct HeapStats; };
+namespace  {
+
+struct Node {
+	int32_t value;
+	char * name;
+};
+static_assert(sizeof(Node)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Node,value)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,name)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct HeapStats {
+	uint64_t allocations;
+	uint64_t frees;
+	uint64_t hits;
+	uint64_t bytes;
+	uint64_t reserved;
+};
+static_assert(sizeof(HeapStats)==40,"structure size mismatch with DAS");
+static_assert(offsetof(HeapStats,allocations)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(HeapStats,frees)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(HeapStats,hits)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(HeapStats,bytes)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(HeapStats,reserved)==32,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_5cecd2fec52f0af ( Context * __context__, Node & ____this_rename_at_4 );
+inline void finalize_ad8552a85f163e47 ( Context * __context__, Node * & ____this_rename_at_16 );
+inline int32_t churn_41598a7248a10be9 ( Context * __context__ );
+inline HeapStats stats_612d3e6f3bc1bce2 ( Context * __context__ );
+inline bool test_c9637182c409592a ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x35627ac8937ff7d8>(__context__) = 1000;/*g_churn*/
+}
+
+inline void finalize_5cecd2fec52f0af ( Context * __context__, Node &  ____this_rename_at_4 )
+{
+	memset(&(____this_rename_at_4), 0, 16);
+}
+
+inline void finalize_ad8552a85f163e47 ( Context * __context__, Node * & ____this_rename_at_16 )
+{
+	if ( ____this_rename_at_16 != nullptr )
+	{
+		finalize_5cecd2fec52f0af(__context__,das_arg<Node>::pass(das_deref(__context__,____this_rename_at_16)));
+		das_delete<Node *>::clear(__context__,____this_rename_at_16);
+		das_copy(____this_rename_at_16,nullptr);
+	};
+}
+
+inline int32_t churn_41598a7248a10be9 ( Context * __context__ )
+{
+	int32_t __total_rename_at_11 = 0;
+	{
+		bool __need_loop_12 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(das_global<int32_t,0x35627ac8937ff7d8>(__context__) /*g_churn*/));
+		int32_t __i_rename_at_12;
+		__need_loop_12 = __i_iterator.first(__context__,(__i_rename_at_12)) && __need_loop_12;
+		for ( ; __need_loop_12 ; __need_loop_12 = __i_iterator.next(__context__,(__i_rename_at_12)) )
+		{
+			Node * __n_rename_at_13 = das_ascend<Node,Node>::make(__context__,nullptr,(([&]() -> Node {
+				Node __mks_13;
+				das_copy((__mks_13.value),(__i_rename_at_12));
+				das_copy((__mks_13.name),(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "node ")), cast<int32_t>::from(__i_rename_at_12)))));
+				return __mks_13;
+			})()));
+			__total_rename_at_11 += __n_rename_at_13->value;
+			finalize_ad8552a85f163e47(__context__,__n_rename_at_13);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_12));
+	};
+	return das_auto_cast<int32_t>::cast(__total_rename_at_11);
+}
+
+inline HeapStats stats_612d3e6f3bc1bce2 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,112,"stats " DAS_FILE_LINE);
+{
+	HeapStats __res_rename_at_27; das_zero(__res_rename_at_27);
+	heap_allocation_stats(das_make_block<void,uint64_t,uint64_t,uint64_t,uint64_t,uint64_t>(__context__,80,0,&__func_info__ab162d3750b36392,[&](uint64_t __a_rename_at_28, uint64_t __f_rename_at_28, uint64_t __h_rename_at_28, uint64_t __b_rename_at_28, uint64_t __r_rename_at_28)->void{
+		das_copy(__res_rename_at_27,(([&]() -> HeapStats {
+			HeapStats __mks_29;
+			das_copy((__mks_29.allocations),(__a_rename_at_28));
+			das_copy((__mks_29.frees),(__f_rename_at_28));
+			das_copy((__mks_29.hits),(__h_rename_at_28));
+			das_copy((__mks_29.bytes),(__b_rename_at_28));
+			das_copy((__mks_29.reserved),(__r_rename_at_28));
+			return __mks_29;
+		})()));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast_ref<HeapStats>::cast(__res_rename_at_27);
+}}
+
+inline bool test_c9637182c409592a ( Context * __context__ ) { das_stack_prologue __prologue(__context__,256,"test " DAS_FILE_LINE);
+{
+	HeapStats __before_rename_at_34_ConstRef = ((HeapStats)stats_612d3e6f3bc1bce2(__context__));
+	HeapStats const  & __before_rename_at_34 = __before_rename_at_34_ConstRef; ;
+	DAS_VERIFY((churn_41598a7248a10be9(__context__) == 499500));
+	HeapStats __after_rename_at_36_ConstRef = ((HeapStats)stats_612d3e6f3bc1bce2(__context__));
+	HeapStats const  & __after_rename_at_36 = __after_rename_at_36_ConstRef; ;
+	DAS_ASSERT(((__after_rename_at_36.allocations - __before_rename_at_34.allocations) >= uint64_t(das_global<int32_t,0x35627ac8937ff7d8>(__context__) /*g_churn*/)));
+	DAS_ASSERT(((__after_rename_at_36.frees - __before_rename_at_34.frees) >= uint64_t(das_global<int32_t,0x35627ac8937ff7d8>(__context__) /*g_churn*/)));
+	DAS_ASSERT(((__after_rename_at_36.hits - __before_rename_at_34.hits) >= uint64_t(das_global<int32_t,0x35627ac8937ff7d8>(__context__) /*g_churn*/ - 1)));
+	DAS_ASSERT((__after_rename_at_36.bytes <= __after_rename_at_36.reserved));
+	uint64_t __sallocations_rename_at_42 = UINT64_C(0x0);
+	string_heap_allocation_stats(das_make_block<void,uint64_t,uint64_t,uint64_t,uint64_t,uint64_t>(__context__,192,0,&__func_info__ab162d3750b36392,[&](uint64_t __a_rename_at_43, uint64_t __f_rename_at_43, uint64_t __h_rename_at_43, uint64_t __b_rename_at_43, uint64_t __r_rename_at_43)->void{
+		das_copy(__sallocations_rename_at_42,__a_rename_at_43);
+		DAS_ASSERT((__b_rename_at_43 <= __r_rename_at_43));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((__sallocations_rename_at_42 >= uint64_t(das_global<int32_t,0x35627ac8937ff7d8>(__context__) /*g_churn*/)));
+	heap_collect(true,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	HeapStats __collected_rename_at_50_ConstRef = ((HeapStats)stats_612d3e6f3bc1bce2(__context__));
+	HeapStats const  & __collected_rename_at_50 = __collected_rename_at_50_ConstRef; ;
+	DAS_ASSERT((__collected_rename_at_50.bytes <= __after_rename_at_36.bytes));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_5cecd2fec52f0af
+	aotLib[0x2b309e49d8d4ac7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node &  ),&finalize_5cecd2fec52f0af>>();
+	};
+	// finalize_ad8552a85f163e47
+	aotLib[0x76b6e7b1a4b56ba9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node * &  ),&finalize_ad8552a85f163e47>>();
+	};
+	// churn_41598a7248a10be9
+	aotLib[0x1666ced5c32dbd33] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&churn_41598a7248a10be9>>();
+	};
+	// stats_612d3e6f3bc1bce2
+	aotLib[0xdaab2c0103690cf5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<HeapStats (*) ( Context * __context__ ),&stats_612d3e6f3bc1bce2>>();
+	};
+	// test_c9637182c409592a
+	aotLib[0x9f606254ef21778d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_c9637182c409592a>>();
+	};
+	// [[ init script ]]
+	aotLib[0x1220fbdc1dfc212e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
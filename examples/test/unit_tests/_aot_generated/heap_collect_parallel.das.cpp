@@ -0,0 +1,218 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require jobque
+#include "daScript/simulate/aot_builtin_jobque.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5200916407443712203 {
+
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_1[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_2[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_3[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_4[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+namespace  { struct Node; };
+namespace  {
+
+struct Node {
+	int32_t value;
+	char * name;
+};
+static_assert(sizeof(Node)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Node,value)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,name)==8,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_push_e97b929e30d25832 ( Context * __context__, TArray<Node *> & __Arr_rename_at_75, Node * const  __value_rename_at_75 );
+inline int32_t make_garbage_1f74261d3bc61d1c ( Context * __context__ );
+inline bool test_221d7bcaa4913a96 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<TArray<Node *>,0xa5fb03de6eb6ae99>(__context__);/*g_nodes*/
+	das_global_zero<TTable<int32_t,char *>,0x7f5bc1c8eac68e86>(__context__);/*g_names*/
+	das_global<int32_t,0x8e25ef7fa65212f1>(__context__) = 1000;/*g_garbage*/
+}
+
+inline void _Funcbuiltin_0x60_push_e97b929e30d25832 ( Context * __context__, TArray<Node *> &  __Arr_rename_at_75, Node * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<Node *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline int32_t make_garbage_1f74261d3bc61d1c ( Context * __context__ )
+{
+	int32_t __total_rename_at_15 = 0;
+	{
+		bool __need_loop_16 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(das_global<int32_t,0x8e25ef7fa65212f1>(__context__) /*g_garbage*/));
+		int32_t __i_rename_at_16;
+		__need_loop_16 = __i_iterator.first(__context__,(__i_rename_at_16)) && __need_loop_16;
+		for ( ; __need_loop_16 ; __need_loop_16 = __i_iterator.next(__context__,(__i_rename_at_16)) )
+		{
+			Node * __n_rename_at_17 = das_ascend<Node,Node>::make(__context__,nullptr,(([&]() -> Node {
+				Node __mks_17;
+				das_copy((__mks_17.value),(__i_rename_at_16));
+				das_copy((__mks_17.name),(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "garbage ")), cast<int32_t>::from(__i_rename_at_16)))));
+				return __mks_17;
+			})()));
+			__total_rename_at_15 += __n_rename_at_17->value;
+		}
+		__i_iterator.close(__context__,(__i_rename_at_16));
+	};
+	return das_auto_cast<int32_t>::cast(__total_rename_at_15);
+}
+
+inline bool test_221d7bcaa4913a96 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,272,"test " DAS_FILE_LINE);
+{
+	{
+		bool __need_loop_23 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10000));
+		int32_t __i_rename_at_23;
+		__need_loop_23 = __i_iterator.first(__context__,(__i_rename_at_23)) && __need_loop_23;
+		for ( ; __need_loop_23 ; __need_loop_23 = __i_iterator.next(__context__,(__i_rename_at_23)) )
+		{
+			_Funcbuiltin_0x60_push_e97b929e30d25832(__context__,das_arg<TArray<Node *>>::pass(das_global<TArray<Node *>,0xa5fb03de6eb6ae99>(__context__) /*g_nodes*/),das_ascend<Node,Node>::make(__context__,nullptr,(([&]() -> Node {
+				Node __mks_24;
+				das_copy((__mks_24.value),(__i_rename_at_23));
+				das_copy((__mks_24.name),(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<char * const >::from(((char *) "node ")), cast<int32_t>::from(__i_rename_at_23)))));
+				return __mks_24;
+			})())));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_23));
+	};
+	{
+		bool __need_loop_25 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,3000));
+		int32_t __i_rename_at_25;
+		__need_loop_25 = __i_iterator.first(__context__,(__i_rename_at_25)) && __need_loop_25;
+		for ( ; __need_loop_25 ; __need_loop_25 = __i_iterator.next(__context__,(__i_rename_at_25)) )
+		{
+			das_copy(das_global<TTable<int32_t,char *>,0x7f5bc1c8eac68e86>(__context__) /*g_names*/(__i_rename_at_25,__context__),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<char * const >::from(((char *) "name ")), cast<int32_t>::from(__i_rename_at_25))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_25));
+	};
+	withJobQue(das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		heapCollectParallel(true,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_VERIFY((make_garbage_1f74261d3bc61d1c(__context__) == 499500));
+	uint64_t __before_rename_at_31 = ((uint64_t)heap_bytes_allocated(__context__));
+	uint64_t __sbefore_rename_at_32 = ((uint64_t)string_heap_bytes_allocated(__context__));
+	withJobQue(das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		heapCollectParallel(true,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	uint64_t __after_rename_at_36 = ((uint64_t)heap_bytes_allocated(__context__));
+	uint64_t __safter_rename_at_37 = ((uint64_t)string_heap_bytes_allocated(__context__));
+	DAS_ASSERT((__after_rename_at_36 < __before_rename_at_31));
+	DAS_ASSERT((__safter_rename_at_37 < __sbefore_rename_at_32));
+	{
+		bool __need_loop_40 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10000));
+		int32_t __i_rename_at_40;
+		__need_loop_40 = __i_iterator.first(__context__,(__i_rename_at_40)) && __need_loop_40;
+		for ( ; __need_loop_40 ; __need_loop_40 = __i_iterator.next(__context__,(__i_rename_at_40)) )
+		{
+			DAS_ASSERT(((das_global<TArray<Node *>,0xa5fb03de6eb6ae99>(__context__) /*g_nodes*/(__i_rename_at_40,__context__)->value == __i_rename_at_40) && (SimPolicy<char *>::Equ(cast<char *>::from(das_global<TArray<Node *>,0xa5fb03de6eb6ae99>(__context__) /*g_nodes*/(__i_rename_at_40,__context__)->name),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_3, cast<char * const >::from(((char *) "node ")), cast<int32_t>::from(__i_rename_at_40)))),*__context__,nullptr))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_40));
+	};
+	{
+		bool __need_loop_42 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,3000));
+		int32_t __i_rename_at_42;
+		__need_loop_42 = __i_iterator.first(__context__,(__i_rename_at_42)) && __need_loop_42;
+		for ( ; __need_loop_42 ; __need_loop_42 = __i_iterator.next(__context__,(__i_rename_at_42)) )
+		{
+			DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(das_global<TTable<int32_t,char *>,0x7f5bc1c8eac68e86>(__context__) /*g_names*/(__i_rename_at_42,__context__)),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_4, cast<char * const >::from(((char *) "name ")), cast<int32_t>::from(__i_rename_at_42)))),*__context__,nullptr)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_42));
+	};
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_push_e97b929e30d25832
+	aotLib[0x83380bbec52ed465] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Node *> & , Node * const   ),&_Funcbuiltin_0x60_push_e97b929e30d25832>>();
+	};
+	// make_garbage_1f74261d3bc61d1c
+	aotLib[0x4a6211192492ac79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&make_garbage_1f74261d3bc61d1c>>();
+	};
+	// test_221d7bcaa4913a96
+	aotLib[0x2aea29c9eafa0ccb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_221d7bcaa4913a96>>();
+	};
+	// [[ init script ]]
+	aotLib[0x871801bb17f0b7dc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,244 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4672130362935447278 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__2a6ca4b563f875a3;
+extern TypeInfo __type_info__185ee399728dead3;
+
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__2a6ca4b563f875a3 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x2a6ca4b563f875a3) };
+TypeInfo __type_info__185ee399728dead3 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__2a6ca4b563f875a3, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x185ee399728dead3) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__185ee399728dead3 };
+namespace  { struct Node; };
+namespace  {
+
+struct Node {
+	int32_t value;
+	Node * next;
+};
+static_assert(sizeof(Node)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Node,value)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,next)==8,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_587b2aa94c7155cf ( Context * __context__, TArray<TArray<int32_t>> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline Node * make_list_4a88a260fc442a7 ( Context * __context__, int32_t __n_rename_at_11 );
+inline int32_t list_sum_ee4e403f53c11492 ( Context * __context__, Node * const  __n_rename_at_17 );
+inline int32_t make_garbage_569eb533d9904fa1 ( Context * __context__ );
+inline bool test_d715b3dc85f4febc ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<Node *,0xb38b985ec3db01fc>(__context__);/*g_list*/
+	das_global_zero<TArray<TArray<int32_t>>,0x2fc16562acafc58c>(__context__);/*g_big*/
+	das_global<int32_t,0x8e25ef7fa65212f1>(__context__) = 1000;/*g_garbage*/
+}
+
+inline void _Funcbuiltin_0x60_resize_587b2aa94c7155cf ( Context * __context__, TArray<TArray<int32_t>> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<TArray<int32_t>> &>::from(__Arr_rename_at_54)));
+	builtin_array_resize(das_arg<TArray<TArray<int32_t>>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,24,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline Node * make_list_4a88a260fc442a7 ( Context * __context__, int32_t __n_rename_at_11 )
+{
+	Node * __head_rename_at_12 = 0;
+	{
+		bool __need_loop_13 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_11));
+		int32_t __i_rename_at_13;
+		__need_loop_13 = __i_iterator.first(__context__,(__i_rename_at_13)) && __need_loop_13;
+		for ( ; __need_loop_13 ; __need_loop_13 = __i_iterator.next(__context__,(__i_rename_at_13)) )
+		{
+			das_copy(__head_rename_at_12,das_ascend<Node,Node>::make(__context__,nullptr,(([&]() -> Node {
+				Node __mks_14;
+				das_copy((__mks_14.value),(__i_rename_at_13));
+				das_copy((__mks_14.next),(__head_rename_at_12));
+				return __mks_14;
+			})())));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_13));
+	};
+	return das_auto_cast<Node *>::cast(__head_rename_at_12);
+}
+
+inline int32_t list_sum_ee4e403f53c11492 ( Context * __context__, Node * const  __n_rename_at_17 )
+{
+	int32_t __s_rename_at_18 = 0;
+	Node * __it_rename_at_19 = __n_rename_at_17;
+	while ( __it_rename_at_19 != nullptr )
+	{
+		__s_rename_at_18 += __it_rename_at_19->value;
+		das_copy(__it_rename_at_19,__it_rename_at_19->next);
+	};
+	return das_auto_cast<int32_t>::cast(__s_rename_at_18);
+}
+
+inline int32_t make_garbage_569eb533d9904fa1 ( Context * __context__ )
+{
+	int32_t __total_rename_at_28 = 0;
+	{
+		bool __need_loop_29 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(das_global<int32_t,0x8e25ef7fa65212f1>(__context__) /*g_garbage*/));
+		int32_t __i_rename_at_29;
+		__need_loop_29 = __i_iterator.first(__context__,(__i_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __i_iterator.next(__context__,(__i_rename_at_29)) )
+		{
+			Node * __l_rename_at_30 = ((Node *)make_list_4a88a260fc442a7(__context__,10));
+			__total_rename_at_28 += __l_rename_at_30->value;
+		}
+		__i_iterator.close(__context__,(__i_rename_at_29));
+	};
+	return das_auto_cast<int32_t>::cast(__total_rename_at_28);
+}
+
+inline bool test_d715b3dc85f4febc ( Context * __context__ )
+{
+	das_copy(das_global<Node *,0xb38b985ec3db01fc>(__context__) /*g_list*/,make_list_4a88a260fc442a7(__context__,1000));
+	_Funcbuiltin_0x60_resize_587b2aa94c7155cf(__context__,das_arg<TArray<TArray<int32_t>>>::pass(das_global<TArray<TArray<int32_t>>,0x2fc16562acafc58c>(__context__) /*g_big*/),5000);
+	{
+		bool __need_loop_38 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,5000));
+		int32_t __i_rename_at_38;
+		__need_loop_38 = __i_iterator.first(__context__,(__i_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __i_iterator.next(__context__,(__i_rename_at_38)) )
+		{
+			_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(das_global<TArray<TArray<int32_t>>,0x2fc16562acafc58c>(__context__) /*g_big*/(__i_rename_at_38,__context__)),__i_rename_at_38);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_38));
+	};
+	DAS_VERIFY((make_garbage_569eb533d9904fa1(__context__) == 9000));
+	uint64_t __before_rename_at_41 = ((uint64_t)heap_bytes_allocated(__context__));
+	int32_t __steps_rename_at_42 = 1;
+	while ( !heap_collect_step(0,true,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) )
+	{
+		++__steps_rename_at_42;
+	};
+	DAS_ASSERT((__steps_rename_at_42 > 1));
+	uint64_t __after_rename_at_47 = ((uint64_t)heap_bytes_allocated(__context__));
+	DAS_ASSERT((__after_rename_at_47 < __before_rename_at_41));
+	DAS_ASSERT((list_sum_ee4e403f53c11492(__context__,das_global<Node *,0xb38b985ec3db01fc>(__context__) /*g_list*/) == 499500));
+	{
+		bool __need_loop_50 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,5000));
+		int32_t __i_rename_at_50;
+		__need_loop_50 = __i_iterator.first(__context__,(__i_rename_at_50)) && __need_loop_50;
+		for ( ; __need_loop_50 ; __need_loop_50 = __i_iterator.next(__context__,(__i_rename_at_50)) )
+		{
+			DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(das_global<TArray<TArray<int32_t>>,0x2fc16562acafc58c>(__context__) /*g_big*/(__i_rename_at_50,__context__))) == 1) && (das_global<TArray<TArray<int32_t>>,0x2fc16562acafc58c>(__context__) /*g_big*/(__i_rename_at_50,__context__)(0,__context__) == __i_rename_at_50)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_50));
+	};
+	Node * __fresh_rename_at_53 = 0;
+	DAS_VERIFY((!heap_collect_step(0,true,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+	das_copy(__fresh_rename_at_53,das_ascend<Node,Node>::make(__context__,nullptr,(([&]() -> Node {
+		Node __mks_56;
+		das_zero(__mks_56);
+		das_copy((__mks_56.value),(13));
+		return __mks_56;
+	})())));
+	while ( !heap_collect_step(0,true,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) )
+	{
+	};
+	DAS_ASSERT((__fresh_rename_at_53->value == 13));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_587b2aa94c7155cf
+	aotLib[0xfdcc4c7d9a23aaad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> & , int32_t  ),&_Funcbuiltin_0x60_resize_587b2aa94c7155cf>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// make_list_4a88a260fc442a7
+	aotLib[0x5e29f14132650d25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Node * (*) ( Context * __context__, int32_t  ),&make_list_4a88a260fc442a7>>();
+	};
+	// list_sum_ee4e403f53c11492
+	aotLib[0xd4f9d6561298c7e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Node * const   ),&list_sum_ee4e403f53c11492>>();
+	};
+	// make_garbage_569eb533d9904fa1
+	aotLib[0x38647e76987b22bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&make_garbage_569eb533d9904fa1>>();
+	};
+	// test_d715b3dc85f4febc
+	aotLib[0xd4c335ed33d1de2b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_d715b3dc85f4febc>>();
+	};
+	// [[ init script ]]
+	aotLib[0xff6e738a1b768185] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,250 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+ // require _hint_macros
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_8424369176480580654 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace _hint_macros { struct HintLookup; };
+namespace _hint_macros { struct GetHintFnMacro; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+namespace _hint_macros {
+
+struct HintLookup {
+	TTable<uint64_t,char *> tab;
+};
+static_assert(sizeof(HintLookup)==48,"structure size mismatch with DAS");
+static_assert(offsetof(HintLookup,tab)==0,"structure field offset mismatch with DAS");
+}
+// unused structure GetHintFnMacro
+
+inline TTable<uint64_t,char *> _Funcbuiltin_0x60_to_table_move_4059aea3d185e2e6 ( Context * __context__, TDim<TTuple<16,uint64_t,char *>,2> & __a_rename_at_560 );
+inline bool ttt_b0087d371648db3f ( Context * __context__ );
+inline bool test_eb751b29ffa9f7d9 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline TTable<uint64_t,char *> _Funcbuiltin_0x60_to_table_move_4059aea3d185e2e6 ( Context * __context__, TDim<TTuple<16,uint64_t,char *>,2> &  __a_rename_at_560 )
+{
+	TTable<uint64_t,char *> __tab_rename_at_561; das_zero(__tab_rename_at_561);
+	{
+		bool __need_loop_563 = true;
+		// x : tuple<uint64 aka keyT;string aka valT>&
+		das_iterator<TDim<TTuple<16,uint64_t,char *>,2>> __x_iterator(__a_rename_at_560);
+		TTuple<16,uint64_t,char *> * __x_rename_at_563;
+		__need_loop_563 = __x_iterator.first(__context__,(__x_rename_at_563)) && __need_loop_563;
+		for ( ; __need_loop_563 ; __need_loop_563 = __x_iterator.next(__context__,(__x_rename_at_563)) )
+		{
+			das_copy(__tab_rename_at_561(das_get_tuple_field<uint64_t,0>::get((*__x_rename_at_563)),__context__),das_get_tuple_field<char *,8>::get((*__x_rename_at_563)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_563));
+	};
+	return /* <- */ das_auto_cast_move<TTable<uint64_t,char *>>::cast(__tab_rename_at_561);
+}
+
+inline bool ttt_b0087d371648db3f ( Context * __context__ )
+{
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_eb751b29ffa9f7d9 ( Context * __context__ )
+{
+	TDim<TTuple<16,uint64_t,char *>,2> _temp_make_local_12_80;
+	_hint_macros::HintLookup __hints_rename_at_11; das_zero(__hints_rename_at_11); das_move(__hints_rename_at_11, (([&]() -> _hint_macros::HintLookup {
+		_hint_macros::HintLookup __mks_11;
+		das_move((__mks_11.tab),(_Funcbuiltin_0x60_to_table_move_4059aea3d185e2e6(__context__,das_arg<TDim<TTuple<16,uint64_t,char *>,2>>::pass((([&]() -> TDim<TTuple<16,uint64_t,char *>,2>& {
+			_temp_make_local_12_80(0,__context__) = (([&]() -> TTuple<16,uint64_t,char *> {
+				TTuple<16,uint64_t,char *> __mkt_13;
+				das_get_tuple_field<uint64_t,0>::get(__mkt_13) = UINT64_C(0x1a08aa1921ca5caf);
+				das_get_tuple_field<char *,8>::get(__mkt_13) = ((char *) "one");
+				return __mkt_13;
+			})());
+			_temp_make_local_12_80(1,__context__) = (([&]() -> TTuple<16,uint64_t,char *> {
+				TTuple<16,uint64_t,char *> __mkt_14;
+				das_get_tuple_field<uint64_t,0>::get(__mkt_14) = UINT64_C(0x5714d319447c9709);
+				das_get_tuple_field<char *,8>::get(__mkt_14) = ((char *) "two");
+				return __mkt_14;
+			})());
+			return _temp_make_local_12_80;
+		})())))));
+		return __mks_11;
+	})()));
+	char * __h1_rename_at_17 = ((char *)(char *)(das_invoke_function<char * const >::invoke<_hint_macros::HintLookup const  &,char * const ,char * const ,uint64_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*@_hint_macros::get_hint CS<HintLookup> Cs Cs Cu64*/ 2090940566170429782u)),das_arg<_hint_macros::HintLookup>::pass(__hints_rename_at_11),((char *) "one"),((char *) "no hint"),UINT64_C(0x1a08aa1921ca5caf))));
+	char * __h2_rename_at_18 = ((char *)(char *)(das_invoke_function<char * const >::invoke<_hint_macros::HintLookup const  &,char * const ,char * const ,uint64_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*@_hint_macros::get_hint CS<HintLookup> Cs Cs Cu64*/ 2090940566170429782u)),das_arg<_hint_macros::HintLookup>::pass(__hints_rename_at_11),((char *) "three"),((char *) "no hint"),UINT64_C(0x5a73f1720ca645a3))));
+	char * __s3_rename_at_19 = (char *)(((char *) "tw"));
+	SimPolicy<char *>::SetAdd((char *)&(__s3_rename_at_19),cast<char *>::from(((char *) "o")),*__context__,nullptr);
+	char * __h3_rename_at_21 = ((char *)(char *)(das_invoke_function<char * const >::invoke<_hint_macros::HintLookup const  &,char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@_hint_macros::get_hint CS<HintLookup> Cs Cs*/ 5008841942469202448u)),das_arg<_hint_macros::HintLookup>::pass(__hints_rename_at_11),__s3_rename_at_19,((char *) "no hint"))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__h1_rename_at_17),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__h2_rename_at_18),cast<char *>::from(((char *) "no hint")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__h3_rename_at_21),cast<char *>::from(((char *) "two")),*__context__,nullptr)));
+	DAS_ASSERT((das_global<int32_t,0x4fa09e68109b5258>(__context__) /*g_non_hints*/ == 1));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_to_table_move_4059aea3d185e2e6
+	aotLib[0x58971aa90ee1a651] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<uint64_t,char *> (*) ( Context * __context__, TDim<TTuple<16,uint64_t,char *>,2> &  ),&_Funcbuiltin_0x60_to_table_move_4059aea3d185e2e6>>();
+	};
+	// ttt_b0087d371648db3f
+	aotLib[0x434f546c6487b225] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&ttt_b0087d371648db3f>>();
+	};
+	// test_eb751b29ffa9f7d9
+	aotLib[0x21fda5ceeccf2faa] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_eb751b29ffa9f7d9>>();
+	};
+	// [[ init script ]]
+	aotLib[0xd4dc0b39a96ec70c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
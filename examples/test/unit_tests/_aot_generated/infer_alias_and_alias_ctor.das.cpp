@@ -0,0 +1,197 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1895841499086458157 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__5520a041a593e30e;
+extern FuncInfo __func_info__8904ac433b29167e;
+
+VarInfo __func_info__8904ac433b29167e_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, UINT64_C(0x5520a041a593e30e), "obj", 0 };
+VarInfo * __func_info__8904ac433b29167e_fields[1] =  { &__func_info__8904ac433b29167e_field_0 };
+FuncInfo __func_info__8904ac433b29167e = {"invoke block<(obj:int? const):void> const", "", __func_info__8904ac433b29167e_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x8904ac433b29167e), 0x0 };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline void _Funcbuiltin_0x60_find_fd9952db15f0f9da ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_229, char * const  __at_rename_at_229, Block DAS_COMMENT((void,int32_t * const )) const  & __blk_rename_at_229 );
+inline int32_t * _Func_0x60_findObject_17e01f8ade6fd595 ( Context * __context__, TTable<char *,int32_t> const  & __objects_rename_at_9, char * const  __guid_rename_at_9 );
+inline TTable<char *,int32_t> _Funcbuiltin_0x60_to_table_move_3b45f42072206a84 ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> & __a_rename_at_560 );
+inline void _Funcbuiltin_0x60_push_e4aecc27f9e903c6 ( Context * __context__, TArray<float> & __Arr_rename_at_75, float __value_rename_at_75 );
+inline float _Func_0x60_join_ee1bd0c4ff24421b ( Context * __context__, TArray<float> const  & __a_rename_at_3 );
+inline bool test_325b60fbe25320f1 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_find_fd9952db15f0f9da ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_229, char * const  __at_rename_at_229, Block DAS_COMMENT((void,int32_t * const )) const  &  __blk_rename_at_229 )
+{
+	builtin_table_lock(__Tab_rename_at_229,__context__);
+	int32_t * __val_rename_at_231 = __builtin_table_find(__context__,__Tab_rename_at_229,__at_rename_at_229);
+	das_invoke<void>::invoke<int32_t *>(__context__,nullptr,__blk_rename_at_229,__val_rename_at_231);
+	builtin_table_unlock(__Tab_rename_at_229,__context__);
+}
+
+inline int32_t * _Func_0x60_findObject_17e01f8ade6fd595 ( Context * __context__, TTable<char *,int32_t> const  &  __objects_rename_at_9, char * const  __guid_rename_at_9 ) { das_stack_prologue __prologue(__context__,112,"`findObject " DAS_FILE_LINE);
+{
+	int32_t * __foundObj_rename_at_10 = 0;
+	_Funcbuiltin_0x60_find_fd9952db15f0f9da(__context__,__objects_rename_at_9,__guid_rename_at_9,das_make_block<void,int32_t * const >(__context__,96,0,&__func_info__8904ac433b29167e,[&](int32_t * const  __obj_rename_at_11)->void{
+		das_copy(__foundObj_rename_at_10,__obj_rename_at_11);
+	}));
+	return das_auto_cast<int32_t *>::cast(__foundObj_rename_at_10);
+}}
+
+inline TTable<char *,int32_t> _Funcbuiltin_0x60_to_table_move_3b45f42072206a84 ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> &  __a_rename_at_560 )
+{
+	TTable<char *,int32_t> __tab_rename_at_561; das_zero(__tab_rename_at_561);
+	{
+		bool __need_loop_563 = true;
+		// x : tuple<string aka keyT;int aka valT>&
+		das_iterator<TDim<TTuple<16,char *,int32_t>,2>> __x_iterator(__a_rename_at_560);
+		TTuple<16,char *,int32_t> * __x_rename_at_563;
+		__need_loop_563 = __x_iterator.first(__context__,(__x_rename_at_563)) && __need_loop_563;
+		for ( ; __need_loop_563 ; __need_loop_563 = __x_iterator.next(__context__,(__x_rename_at_563)) )
+		{
+			das_copy(__tab_rename_at_561(das_get_tuple_field<char *,0>::get((*__x_rename_at_563)),__context__),das_get_tuple_field<int32_t,8>::get((*__x_rename_at_563)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_563));
+	};
+	return /* <- */ das_auto_cast_move<TTable<char *,int32_t>>::cast(__tab_rename_at_561);
+}
+
+inline void _Funcbuiltin_0x60_push_e4aecc27f9e903c6 ( Context * __context__, TArray<float> &  __Arr_rename_at_75, float __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<float>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline float _Func_0x60_join_ee1bd0c4ff24421b ( Context * __context__, TArray<float> const  &  __a_rename_at_3 )
+{
+	float __t_rename_at_4 = 0.f;
+	{
+		bool __need_loop_5 = true;
+		// x : float aka numt const&
+		das_iterator<TArray<float> const > __x_iterator(__a_rename_at_3);
+		float const  * __x_rename_at_5;
+		__need_loop_5 = __x_iterator.first(__context__,(__x_rename_at_5)) && __need_loop_5;
+		for ( ; __need_loop_5 ; __need_loop_5 = __x_iterator.next(__context__,(__x_rename_at_5)) )
+		{
+			__t_rename_at_4 += (*__x_rename_at_5);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_5));
+	};
+	return das_auto_cast<float>::cast(__t_rename_at_4);
+}
+
+inline bool test_325b60fbe25320f1 ( Context * __context__ )
+{
+	TDim<TTuple<16,char *,int32_t>,2> _temp_make_local_24_128;
+	TArray<float> __a_rename_at_18; das_zero(__a_rename_at_18);
+	_Funcbuiltin_0x60_push_e4aecc27f9e903c6(__context__,das_arg<TArray<float>>::pass(__a_rename_at_18),1.f);
+	_Funcbuiltin_0x60_push_e4aecc27f9e903c6(__context__,das_arg<TArray<float>>::pass(__a_rename_at_18),2.f);
+	_Funcbuiltin_0x60_push_e4aecc27f9e903c6(__context__,das_arg<TArray<float>>::pass(__a_rename_at_18),3.f);
+	float __t_rename_at_22 = ((float)_Func_0x60_join_ee1bd0c4ff24421b(__context__,das_arg<TArray<float>>::pass(__a_rename_at_18)));
+	DAS_ASSERT((__t_rename_at_22 == 6.f));
+	TTable<char *,int32_t> __tab_rename_at_24_ConstRef; das_zero(__tab_rename_at_24_ConstRef); das_move(__tab_rename_at_24_ConstRef, ((TTable<char *,int32_t>)_Funcbuiltin_0x60_to_table_move_3b45f42072206a84(__context__,das_arg<TDim<TTuple<16,char *,int32_t>,2>>::pass((([&]() -> TDim<TTuple<16,char *,int32_t>,2>& {
+		_temp_make_local_24_128(0,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_24;
+			das_get_tuple_field<char *,0>::get(__mkt_24) = ((char *) "one");
+			das_get_tuple_field<int32_t,8>::get(__mkt_24) = 1;
+			return __mkt_24;
+		})());
+		_temp_make_local_24_128(1,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_24;
+			das_get_tuple_field<char *,0>::get(__mkt_24) = ((char *) "two");
+			das_get_tuple_field<int32_t,8>::get(__mkt_24) = 2;
+			return __mkt_24;
+		})());
+		return _temp_make_local_24_128;
+	})())))));
+	TTable<char *,int32_t> const  & __tab_rename_at_24 = __tab_rename_at_24_ConstRef; ;
+	DAS_VERIFY((das_null_coalescing<int32_t>::get(_Func_0x60_findObject_17e01f8ade6fd595(__context__,__tab_rename_at_24,((char *) "one")),0) == 1));
+	DAS_VERIFY((das_null_coalescing<int32_t>::get(_Func_0x60_findObject_17e01f8ade6fd595(__context__,__tab_rename_at_24,((char *) "two")),0) == 2));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_find_fd9952db15f0f9da
+	aotLib[0x459fa806d87d2d7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> const  & , char * const  , Block DAS_COMMENT((void,int32_t * const )) const  &  ),&_Funcbuiltin_0x60_find_fd9952db15f0f9da>>();
+	};
+	// _Func_0x60_findObject_17e01f8ade6fd595
+	aotLib[0xf5dbc82b5a458420] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t * (*) ( Context * __context__, TTable<char *,int32_t> const  & , char * const   ),&_Func_0x60_findObject_17e01f8ade6fd595>>();
+	};
+	// _Funcbuiltin_0x60_to_table_move_3b45f42072206a84
+	aotLib[0x7578b7877ea5dd45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<char *,int32_t> (*) ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> &  ),&_Funcbuiltin_0x60_to_table_move_3b45f42072206a84>>();
+	};
+	// _Funcbuiltin_0x60_push_e4aecc27f9e903c6
+	aotLib[0xea7fed8bbc1a9125] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float  ),&_Funcbuiltin_0x60_push_e4aecc27f9e903c6>>();
+	};
+	// _Func_0x60_join_ee1bd0c4ff24421b
+	aotLib[0x9503f37bced054e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, TArray<float> const  &  ),&_Func_0x60_join_ee1bd0c4ff24421b>>();
+	};
+	// test_325b60fbe25320f1
+	aotLib[0x6fb83498a9e1113c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_325b60fbe25320f1>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
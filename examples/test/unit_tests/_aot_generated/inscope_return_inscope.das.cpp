@@ -0,0 +1,137 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15969988183971147534 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+	int32_t a;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_aef1da7f017792ad ( Context * __context__, Foo & ____this_rename_at_1 );
+inline void finalize_b273d59c34ab1579 ( Context * __context__, Foo * & ____this_rename_at_12 );
+inline void buggy_6860db6a48df2fa8 ( Context * __context__, bool __skip_rename_at_5 );
+inline bool test_7998533f0e48c53c ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_aef1da7f017792ad ( Context * __context__, Foo &  ____this_rename_at_1 )
+{
+	memset(&(____this_rename_at_1), 0, 4);
+}
+
+inline void finalize_b273d59c34ab1579 ( Context * __context__, Foo * & ____this_rename_at_12 )
+{
+	if ( ____this_rename_at_12 != nullptr )
+	{
+		finalize_aef1da7f017792ad(__context__,das_arg<Foo>::pass(das_deref(__context__,____this_rename_at_12)));
+		das_delete<Foo *>::clear(__context__,____this_rename_at_12);
+		das_copy(____this_rename_at_12,nullptr);
+	};
+}
+
+inline void buggy_6860db6a48df2fa8 ( Context * __context__, bool __skip_rename_at_5 )
+{
+	Foo * __a_rename_at_6; memset(&__a_rename_at_6,0,sizeof(__a_rename_at_6));
+	Foo * __b_rename_at_9; memset(&__b_rename_at_9,0,sizeof(__b_rename_at_9));
+/* finally */ auto __finally_6= das_finally([&](){
+	finalize_b273d59c34ab1579(__context__,__a_rename_at_6);
+	finalize_b273d59c34ab1579(__context__,__b_rename_at_9);
+/* end finally */ });
+	__a_rename_at_6 = das_new<Foo>::make(__context__);
+	if ( __skip_rename_at_5 )
+	{
+		return ;
+	} else {
+		__b_rename_at_9 = das_new<Foo>::make(__context__);
+	};
+}
+
+inline bool test_7998533f0e48c53c ( Context * __context__ )
+{
+	buggy_6860db6a48df2fa8(__context__,true);
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_aef1da7f017792ad
+	aotLib[0x3d3bea36176f00e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&finalize_aef1da7f017792ad>>();
+	};
+	// finalize_b273d59c34ab1579
+	aotLib[0x57c81cd32f2ce6dc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo * &  ),&finalize_b273d59c34ab1579>>();
+	};
+	// buggy_6860db6a48df2fa8
+	aotLib[0x3fb242217f01ef0b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, bool  ),&buggy_6860db6a48df2fa8>>();
+	};
+	// test_7998533f0e48c53c
+	aotLib[0xf0e5ca1a9ab847a6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_7998533f0e48c53c>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
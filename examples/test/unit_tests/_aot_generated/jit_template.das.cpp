@@ -0,0 +1,473 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9619396201082486814 {
+
+extern TypeInfo __type_info__af63e84c860200f0;
+extern TypeInfo __type_info__6f902bb202c1ac85;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__af63d94c8601e773;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__2ae1af192b331746;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__af63e84c860200f0 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e84c860200f0) };
+TypeInfo __type_info__6f902bb202c1ac85 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, UINT64_C(0x6f902bb202c1ac85) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63db4c8601ead9) };
+TypeInfo __type_info__af63d94c8601e773 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xaf63d94c8601e773) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__2ae1af192b331746 = { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0x2ae1af192b331746) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__6f902bb202c1ac85 };
+TypeInfo * __tinfo_1[2] = { &__type_info__af63ee4c86020b22, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_2[1] = { &__type_info__af63e44c8601fa24 };
+TypeInfo * __tinfo_3[1] = { &__type_info__af63e44c8601fa24 };
+TypeInfo * __tinfo_4[1] = { &__type_info__af63e44c8601fa24 };
+TypeInfo * __tinfo_5[1] = { &__type_info__2ae1af192b331746 };
+TypeInfo * __tinfo_6[1] = { &__type_info__af63e44c8601fa24 };
+TypeInfo * __tinfo_7[1] = { &__type_info__af63db4c8601ead9 };
+TypeInfo * __tinfo_8[1] = { &__type_info__af63d94c8601e773 };
+TypeInfo * __tinfo_9[1] = { &__type_info__af63d94c8601e773 };
+TypeInfo * __tinfo_10[1] = { &__type_info__af63e84c860200f0 };
+TypeInfo * __tinfo_11[1] = { &__type_info__af63db4c8601ead9 };
+TypeInfo * __tinfo_12[3] = { &__type_info__af63e44c8601fa24, &__type_info__90f3d07b5a6ca13, &__type_info__af63e44c8601fa24 };
+TypeInfo * __tinfo_13[1] = { &__type_info__2ae1af192b331746 };
+namespace  { struct Point; };
+namespace  {
+
+struct Point {
+	float x;
+	float y;
+	Point * next;
+};
+static_assert(sizeof(Point)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Point,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Point,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Point,next)==8,"structure field offset mismatch with DAS");
+}
+
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60_push_49bdd408ef1e4c5a ( Context * __context__, TArray<char *> & __Arr_rename_at_75, char * const  __value_rename_at_75 );
+inline int32_t fib_309c658c0429d1ed ( Context * __context__, int32_t __n_rename_at_9 );
+inline int32_t fib_pair_80b4515e56dd253a ( Context * __context__, int32_t __n_rename_at_15 );
+inline int32_t depth_8d6d7aa7d48b6d03 ( Context * __context__, int32_t __n_rename_at_20 );
+inline int64_t sum_loop_a095dbe6ae94f7fe ( Context * __context__, int32_t __n_rename_at_26 );
+inline int32_t while_loop_273fc20961b7bf5c ( Context * __context__, int32_t __n_rename_at_37 );
+inline float float_math_7eb35cf8e65761b1 ( Context * __context__, float __a_rename_at_46, float __b_rename_at_46 );
+inline double double_math_9745dba530cde927 ( Context * __context__, double __a_rename_at_55, double __b_rename_at_55 );
+inline uint32_t uint_math_be65032795481d84 ( Context * __context__, uint32_t __a_rename_at_59, uint32_t __b_rename_at_59 );
+inline float chain_len2_9e21332161139a97 ( Context * __context__, Point * const  __p_rename_at_71 );
+inline int32_t div_int_afef67b826a92d6e ( Context * __context__, int32_t __a_rename_at_80, int32_t __b_rename_at_80 );
+inline int64_t mod_int64_ba0572626f8cc2b7 ( Context * __context__, int64_t __a_rename_at_84, int64_t __b_rename_at_84 );
+inline char * with_string_c7b34e3535dca370 ( Context * __context__, int32_t __n_rename_at_88 );
+inline TArray<char *> run_all_750e6e69898fa830 ( Context * __context__ );
+inline bool throws_a28262118d42e8e0 ( Context * __context__, Block DAS_COMMENT((void)) const  & __blk_rename_at_113 );
+inline bool test_f8b0084bed54394c ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0xe934398d168b17cc>(__context__) = 30;/*g_n*/
+	das_global<int32_t,0xbfd2baa0c4f0ca4a>(__context__) = 0;/*g_zero*/
+	das_global<float,0x14842b8d2f13fd54>(__context__) = 3.5f;/*g_a*/
+	das_global<float,0xcb3f48d2ae462f5>(__context__) = 1.25f;/*g_b*/
+	das_global<int64_t,0x7403c4a257a8baad>(__context__) = INT64_C(0);/*g_sink*/
+}
+
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<char *> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<char *> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60_push_49bdd408ef1e4c5a ( Context * __context__, TArray<char *> &  __Arr_rename_at_75, char * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<char *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline int32_t fib_309c658c0429d1ed ( Context * __context__, int32_t __n_rename_at_9 )
+{
+	return das_auto_cast<int32_t>::cast((__n_rename_at_9 < 2) ? das_auto_cast<int32_t>::cast(__n_rename_at_9) : das_auto_cast<int32_t>::cast((fib_309c658c0429d1ed(__context__,__n_rename_at_9 - 1) + fib_309c658c0429d1ed(__context__,__n_rename_at_9 - 2))));
+}
+
+inline int32_t fib_pair_80b4515e56dd253a ( Context * __context__, int32_t __n_rename_at_15 )
+{
+	return das_auto_cast<int32_t>::cast(fib_309c658c0429d1ed(__context__,__n_rename_at_15) + fib_309c658c0429d1ed(__context__,__n_rename_at_15 + 1));
+}
+
+inline int32_t depth_8d6d7aa7d48b6d03 ( Context * __context__, int32_t __n_rename_at_20 )
+{
+	return das_auto_cast<int32_t>::cast((__n_rename_at_20 == 0) ? das_auto_cast<int32_t>::cast(0) : das_auto_cast<int32_t>::cast((depth_8d6d7aa7d48b6d03(__context__,__n_rename_at_20 - 1) + 1)));
+}
+
+inline int64_t sum_loop_a095dbe6ae94f7fe ( Context * __context__, int32_t __n_rename_at_26 )
+{
+	int64_t __total_rename_at_27 = INT64_C(0);
+	{
+		bool __need_loop_28 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_26));
+		int32_t __i_rename_at_28;
+		__need_loop_28 = __i_iterator.first(__context__,(__i_rename_at_28)) && __need_loop_28;
+		for ( ; __need_loop_28 ; __need_loop_28 = __i_iterator.next(__context__,(__i_rename_at_28)) )
+		{
+			if ( (SimPolicy<int32_t>::Mod(__i_rename_at_28,3,*__context__,nullptr)) == 0 )
+			{
+				continue;
+			} else {
+				__total_rename_at_27 += int64_t(__i_rename_at_28);
+				if ( __total_rename_at_27 > INT64_C(1000000) )
+				{
+					break;
+				};
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_28));
+	};
+	return das_auto_cast<int64_t>::cast(__total_rename_at_27);
+}
+
+inline int32_t while_loop_273fc20961b7bf5c ( Context * __context__, int32_t __n_rename_at_37 )
+{
+	int32_t __i_rename_at_38 = 0;
+	int32_t __s_rename_at_39 = 0;
+	while ( __i_rename_at_38 < __n_rename_at_37 )
+	{
+		__s_rename_at_39 += ((__i_rename_at_38 * __i_rename_at_38) - (__i_rename_at_38 >> 1));
+		++__i_rename_at_38;
+	};
+	return das_auto_cast<int32_t>::cast(__s_rename_at_39);
+}
+
+inline float float_math_7eb35cf8e65761b1 ( Context * __context__, float __a_rename_at_46, float __b_rename_at_46 )
+{
+	float __r_rename_at_47 = 0.f;
+	{
+		bool __need_loop_48 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_48;
+		__need_loop_48 = __i_iterator.first(__context__,(__i_rename_at_48)) && __need_loop_48;
+		for ( ; __need_loop_48 ; __need_loop_48 = __i_iterator.next(__context__,(__i_rename_at_48)) )
+		{
+			__r_rename_at_47 += (((__a_rename_at_46 * __b_rename_at_46) + (SimPolicy<float>::Div(__a_rename_at_46,__b_rename_at_46,*__context__,nullptr))) - float(__i_rename_at_48));
+			if ( (__r_rename_at_47 != __r_rename_at_47) || (__r_rename_at_47 >= 100.f) )
+			{
+				das_copy(__r_rename_at_47,-__r_rename_at_47);
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_48));
+	};
+	return das_auto_cast<float>::cast(__r_rename_at_47);
+}
+
+inline double double_math_9745dba530cde927 ( Context * __context__, double __a_rename_at_55, double __b_rename_at_55 )
+{
+	return das_auto_cast<double>::cast((__a_rename_at_55 > __b_rename_at_55) ? das_auto_cast<double>::cast(((__a_rename_at_55 * __b_rename_at_55) - double(int32_t(__a_rename_at_55)))) : das_auto_cast<double>::cast((SimPolicy<double>::Div(__b_rename_at_55,__a_rename_at_55,*__context__,nullptr))));
+}
+
+inline uint32_t uint_math_be65032795481d84 ( Context * __context__, uint32_t __a_rename_at_59, uint32_t __b_rename_at_59 )
+{
+	uint32_t __r_rename_at_60 = __a_rename_at_59;
+	{
+		bool __need_loop_61 = true;
+		// i : uint const
+		das_iterator<urange> __i_iterator(mk_urange(__b_rename_at_59));
+		uint32_t __i_rename_at_61;
+		__need_loop_61 = __i_iterator.first(__context__,(__i_rename_at_61)) && __need_loop_61;
+		for ( ; __need_loop_61 ; __need_loop_61 = __i_iterator.next(__context__,(__i_rename_at_61)) )
+		{
+			das_copy(__r_rename_at_60,(__r_rename_at_60 << 0x3u) ^ ((__r_rename_at_60 >> 0x5u) + __i_rename_at_61));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_61));
+	};
+	return das_auto_cast<uint32_t>::cast(__r_rename_at_60);
+}
+
+inline float chain_len2_9e21332161139a97 ( Context * __context__, Point * const  __p_rename_at_71 )
+{
+	float __total_rename_at_72 = 0.f;
+	Point * __q_rename_at_73 = __p_rename_at_71;
+	while ( __q_rename_at_73 != nullptr )
+	{
+		__total_rename_at_72 += ((__q_rename_at_73->x * __q_rename_at_73->x) + (__q_rename_at_73->y * __q_rename_at_73->y));
+		das_copy(__q_rename_at_73,__q_rename_at_73->next);
+	};
+	return das_auto_cast<float>::cast(__total_rename_at_72);
+}
+
+inline int32_t div_int_afef67b826a92d6e ( Context * __context__, int32_t __a_rename_at_80, int32_t __b_rename_at_80 )
+{
+	return das_auto_cast<int32_t>::cast(SimPolicy<int32_t>::Div(__a_rename_at_80,__b_rename_at_80,*__context__,nullptr));
+}
+
+inline int64_t mod_int64_ba0572626f8cc2b7 ( Context * __context__, int64_t __a_rename_at_84, int64_t __b_rename_at_84 )
+{
+	return das_auto_cast<int64_t>::cast(SimPolicy<int64_t>::Mod(__a_rename_at_84,__b_rename_at_84,*__context__,nullptr));
+}
+
+inline char * with_string_c7b34e3535dca370 ( Context * __context__, int32_t __n_rename_at_88 )
+{
+	char * __s_rename_at_90 = (char *)(nullptr);
+	{
+		bool __need_loop_91 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_88));
+		int32_t __i_rename_at_91;
+		__need_loop_91 = __i_iterator.first(__context__,(__i_rename_at_91)) && __need_loop_91;
+		for ( ; __need_loop_91 ; __need_loop_91 = __i_iterator.next(__context__,(__i_rename_at_91)) )
+		{
+			das_copy(__s_rename_at_90,das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<char *>::from(__s_rename_at_90), cast<int32_t>::from(__i_rename_at_91))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_91));
+	};
+	return das_auto_cast<char *>::cast(__s_rename_at_90);
+}
+
+inline TArray<char *> run_all_750e6e69898fa830 ( Context * __context__ )
+{
+	TArray<char *> __res_rename_at_96; das_zero(__res_rename_at_96);
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_96),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_2, cast<int32_t>::from(fib_309c658c0429d1ed(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/)))));
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_96),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_3, cast<int32_t>::from(fib_pair_80b4515e56dd253a(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/ - 10)))));
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_96),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_4, cast<int32_t>::from(depth_8d6d7aa7d48b6d03(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/)))));
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_96),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_5, cast<int64_t>::from(sum_loop_a095dbe6ae94f7fe(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/ * 1000)))));
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_96),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_6, cast<int32_t>::from(while_loop_273fc20961b7bf5c(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/ * 100)))));
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_96),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_7, cast<float>::from(float_math_7eb35cf8e65761b1(__context__,das_global<float,0x14842b8d2f13fd54>(__context__) /*g_a*/,das_global<float,0xcb3f48d2ae462f5>(__context__) /*g_b*/)))));
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_96),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_8, cast<double>::from(double_math_9745dba530cde927(__context__,double(das_global<float,0x14842b8d2f13fd54>(__context__) /*g_a*/),double(das_global<float,0xcb3f48d2ae462f5>(__context__) /*g_b*/))))));
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_96),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_9, cast<double>::from(double_math_9745dba530cde927(__context__,double(das_global<float,0xcb3f48d2ae462f5>(__context__) /*g_b*/),double(das_global<float,0x14842b8d2f13fd54>(__context__) /*g_a*/))))));
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_96),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_10, cast<uint32_t>::from(uint_math_be65032795481d84(__context__,uint32_t(das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/),0x11u)))));
+	Point * __c_rename_at_106 = das_ascend<Point,Point>::make(__context__,nullptr,(([&]() -> Point {
+		Point __mks_106;
+		das_copy((__mks_106.x),(1.f));
+		das_copy((__mks_106.y),(2.f));
+		das_copy((__mks_106.next),(das_ascend<Point,Point>::make(__context__,nullptr,(([&]() -> Point {
+			Point __mks_106;
+			das_zero(__mks_106);
+			das_copy((__mks_106.x),(das_global<float,0x14842b8d2f13fd54>(__context__) /*g_a*/));
+			das_copy((__mks_106.y),(das_global<float,0xcb3f48d2ae462f5>(__context__) /*g_b*/));
+			return __mks_106;
+		})()))));
+		return __mks_106;
+	})()));
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_96),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_11, cast<float>::from(chain_len2_9e21332161139a97(__context__,__c_rename_at_106)))));
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_96),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_12, cast<int32_t>::from(div_int_afef67b826a92d6e(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/,7)), cast<char * const >::from(((char *) " ")), cast<int32_t>::from(div_int_afef67b826a92d6e(__context__,-das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/,4)))));
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_96),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_13, cast<int64_t>::from(mod_int64_ba0572626f8cc2b7(__context__,int64_t(das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/) * INT64_C(1000),INT64_C(7))))));
+	_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_96),with_string_c7b34e3535dca370(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/));
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_96)));
+}
+
+inline bool throws_a28262118d42e8e0 ( Context * __context__, Block DAS_COMMENT((void)) const  &  __blk_rename_at_113 )
+{
+	bool __failed_rename_at_114 = false;
+	das_try_recover(__context__, [&]()
+	{
+		das_invoke<void>::invoke(__context__,nullptr,__blk_rename_at_113);
+	}, [&]()
+	{
+		das_copy(__failed_rename_at_114,true);
+	});
+	return das_auto_cast<bool>::cast(__failed_rename_at_114);
+}
+
+inline bool test_f8b0084bed54394c ( Context * __context__ ) { das_stack_prologue __prologue(__context__,368,"test " DAS_FILE_LINE);
+{
+	DAS_VERIFY((das_is_jit_function(Func(__context__->fnByMangledName(/*fib Ci*/ 15090530272238763470u)))));
+	DAS_VERIFY((das_is_jit_function(Func(__context__->fnByMangledName(/*sum_loop Ci*/ 10560069391350052093u)))));
+	DAS_VERIFY((das_is_jit_function(Func(__context__->fnByMangledName(/*chain_len2 C1<S<::Point>>?*/ 2144488580252001164u)))));
+	TArray<char *> __jitted_rename_at_128_ConstRef; das_zero(__jitted_rename_at_128_ConstRef); das_move(__jitted_rename_at_128_ConstRef, ((TArray<char *>)run_all_750e6e69898fa830(__context__)));
+	TArray<char *> const  & __jitted_rename_at_128 = __jitted_rename_at_128_ConstRef; ;
+	DAS_VERIFY((throws_a28262118d42e8e0(__context__,das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(das_global<int64_t,0x7403c4a257a8baad>(__context__) /*g_sink*/,int64_t(div_int_afef67b826a92d6e(__context__,1,das_global<int32_t,0xbfd2baa0c4f0ca4a>(__context__) /*g_zero*/)));
+	}))));
+	DAS_VERIFY((throws_a28262118d42e8e0(__context__,das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(das_global<int64_t,0x7403c4a257a8baad>(__context__) /*g_sink*/,mod_int64_ba0572626f8cc2b7(__context__,INT64_C(1),int64_t(das_global<int32_t,0xbfd2baa0c4f0ca4a>(__context__) /*g_zero*/)));
+	}))));
+	DAS_VERIFY((throws_a28262118d42e8e0(__context__,das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(das_global<int64_t,0x7403c4a257a8baad>(__context__) /*g_sink*/,int64_t(chain_len2_9e21332161139a97(__context__,das_auto_cast<Point * const >::cast(nullptr))));
+	})) == false));
+	DAS_VERIFY((throws_a28262118d42e8e0(__context__,das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		das_copy(das_global<int64_t,0x7403c4a257a8baad>(__context__) /*g_sink*/,int64_t(depth_8d6d7aa7d48b6d03(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/ * 1000000)));
+	}))));
+	DAS_VERIFY((das_remove_jit(Func(__context__->fnByMangledName(/*fib Ci*/ 15090530272238763470u)))));
+	DAS_VERIFY((das_remove_jit(Func(__context__->fnByMangledName(/*depth Ci*/ 1992632849360123082u)))));
+	DAS_VERIFY((das_remove_jit(Func(__context__->fnByMangledName(/*sum_loop Ci*/ 10560069391350052093u)))));
+	DAS_VERIFY((das_remove_jit(Func(__context__->fnByMangledName(/*while_loop Ci*/ 1511587628432405067u)))));
+	DAS_VERIFY((das_remove_jit(Func(__context__->fnByMangledName(/*float_math Cf Cf*/ 15624231224905451186u)))));
+	DAS_VERIFY((das_remove_jit(Func(__context__->fnByMangledName(/*double_math Cd Cd*/ 3626912446297129785u)))));
+	DAS_VERIFY((das_remove_jit(Func(__context__->fnByMangledName(/*uint_math Cu Cu*/ 18181630347254904552u)))));
+	DAS_VERIFY((das_remove_jit(Func(__context__->fnByMangledName(/*chain_len2 C1<S<::Point>>?*/ 2144488580252001164u)))));
+	DAS_VERIFY((das_remove_jit(Func(__context__->fnByMangledName(/*div_int Ci Ci*/ 3528256315248182462u)))));
+	DAS_VERIFY((das_remove_jit(Func(__context__->fnByMangledName(/*mod_int64 Ci64 Ci64*/ 4064617185655400159u)))));
+	DAS_VERIFY((das_remove_jit(Func(__context__->fnByMangledName(/*with_string Ci*/ 15008456442709351325u)))));
+	DAS_VERIFY((!das_is_jit_function(Func(__context__->fnByMangledName(/*fib Ci*/ 15090530272238763470u)))));
+	TArray<char *> __mixed_rename_at_147_ConstRef; das_zero(__mixed_rename_at_147_ConstRef); das_move(__mixed_rename_at_147_ConstRef, ((TArray<char *>)run_all_750e6e69898fa830(__context__)));
+	TArray<char *> const  & __mixed_rename_at_147 = __mixed_rename_at_147_ConstRef; ;
+	DAS_VERIFY((das_remove_jit(Func(__context__->fnByMangledName(/*fib_pair Ci*/ 14470841013469448861u)))));
+	TArray<char *> __interpreted_rename_at_150_ConstRef; das_zero(__interpreted_rename_at_150_ConstRef); das_move(__interpreted_rename_at_150_ConstRef, ((TArray<char *>)run_all_750e6e69898fa830(__context__)));
+	TArray<char *> const  & __interpreted_rename_at_150 = __interpreted_rename_at_150_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__jitted_rename_at_128) == builtin_array_size(__interpreted_rename_at_150)));
+	{
+		bool __need_loop_152 = true;
+		// j : string const&
+		das_iterator<TArray<char *> const > __j_iterator(__jitted_rename_at_128);
+		char * const  * __j_rename_at_152;
+		__need_loop_152 = __j_iterator.first(__context__,(__j_rename_at_152)) && __need_loop_152;
+		// m : string const&
+		das_iterator<TArray<char *> const > __m_iterator(__mixed_rename_at_147);
+		char * const  * __m_rename_at_152;
+		__need_loop_152 = __m_iterator.first(__context__,(__m_rename_at_152)) && __need_loop_152;
+		// i : string const&
+		das_iterator<TArray<char *> const > __i_iterator(__interpreted_rename_at_150);
+		char * const  * __i_rename_at_152;
+		__need_loop_152 = __i_iterator.first(__context__,(__i_rename_at_152)) && __need_loop_152;
+		for ( ; __need_loop_152 ; __need_loop_152 = __j_iterator.next(__context__,(__j_rename_at_152)) && __m_iterator.next(__context__,(__m_rename_at_152)) && __i_iterator.next(__context__,(__i_rename_at_152)) )
+		{
+			DAS_ASSERT(((SimPolicy<char *>::Equ(cast<char *>::from((*__j_rename_at_152)),cast<char *>::from((*__i_rename_at_152)),*__context__,nullptr)) && (SimPolicy<char *>::Equ(cast<char *>::from((*__m_rename_at_152)),cast<char *>::from((*__i_rename_at_152)),*__context__,nullptr))));
+		}
+		__j_iterator.close(__context__,(__j_rename_at_152));
+		__m_iterator.close(__context__,(__m_rename_at_152));
+		__i_iterator.close(__context__,(__i_rename_at_152));
+	};
+	DAS_VERIFY((das_jit_compile(Func(__context__->fnByMangledName(/*fib Ci*/ 15090530272238763470u)),__context__)));
+	DAS_VERIFY((das_jit_compile(Func(__context__->fnByMangledName(/*float_math Cf Cf*/ 15624231224905451186u)),__context__)));
+	DAS_ASSERT((fib_309c658c0429d1ed(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/) == 832040));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465
+	aotLib[0xed99ea3c3e04d451] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<char *> & (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465>>();
+	};
+	// _Funcbuiltin_0x60_push_49bdd408ef1e4c5a
+	aotLib[0xb187be2de84ea8d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const   ),&_Funcbuiltin_0x60_push_49bdd408ef1e4c5a>>();
+	};
+	// fib_309c658c0429d1ed
+	aotLib[0x50d2574c1be9dce5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&fib_309c658c0429d1ed>>();
+	};
+	// fib_pair_80b4515e56dd253a
+	aotLib[0xc0b3c8b349abc881] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&fib_pair_80b4515e56dd253a>>();
+	};
+	// depth_8d6d7aa7d48b6d03
+	aotLib[0xe1f505ef3c3f1b35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&depth_8d6d7aa7d48b6d03>>();
+	};
+	// sum_loop_a095dbe6ae94f7fe
+	aotLib[0x856928ab63f6a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int64_t (*) ( Context * __context__, int32_t  ),&sum_loop_a095dbe6ae94f7fe>>();
+	};
+	// while_loop_273fc20961b7bf5c
+	aotLib[0xf3de9ac5c64b3f35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&while_loop_273fc20961b7bf5c>>();
+	};
+	// float_math_7eb35cf8e65761b1
+	aotLib[0x10fdf0282d6b9e69] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, float , float  ),&float_math_7eb35cf8e65761b1>>();
+	};
+	// double_math_9745dba530cde927
+	aotLib[0x2639179f2fabcbc1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<double (*) ( Context * __context__, double , double  ),&double_math_9745dba530cde927>>();
+	};
+	// uint_math_be65032795481d84
+	aotLib[0x7905f88b8204b381] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, uint32_t , uint32_t  ),&uint_math_be65032795481d84>>();
+	};
+	// chain_len2_9e21332161139a97
+	aotLib[0x36a8d1ab1917f4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, Point * const   ),&chain_len2_9e21332161139a97>>();
+	};
+	// div_int_afef67b826a92d6e
+	aotLib[0x1cc39d7161c3bb7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t  ),&div_int_afef67b826a92d6e>>();
+	};
+	// mod_int64_ba0572626f8cc2b7
+	aotLib[0xb78fe4690482d685] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int64_t (*) ( Context * __context__, int64_t , int64_t  ),&mod_int64_ba0572626f8cc2b7>>();
+	};
+	// with_string_c7b34e3535dca370
+	aotLib[0x5838e596d5ab8891] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, int32_t  ),&with_string_c7b34e3535dca370>>();
+	};
+	// run_all_750e6e69898fa830
+	aotLib[0x10f4eadfde32e20e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__ ),&run_all_750e6e69898fa830>>();
+	};
+	// throws_a28262118d42e8e0
+	aotLib[0xabb05580f69dd041] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Block DAS_COMMENT((void)) const  &  ),&throws_a28262118d42e8e0>>();
+	};
+	// test_f8b0084bed54394c
+	aotLib[0x5c657359735a9a5a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f8b0084bed54394c>>();
+	};
+	// [[ init script ]]
+	aotLib[0x3827b45eb4a4aa26] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,254 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_8938327284437206496 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__226cc7d44a6e000f;
+extern VarInfo __var_info__6ffe5019524b3e67;
+extern VarInfo __var_info__4eb3b2b99291d089;
+extern VarInfo __var_info__f6b916190d9a778d;
+extern VarInfo __var_info__a4f45b9cf11344f8;
+extern VarInfo __var_info__dd969318ff9c00b6;
+extern VarInfo __var_info__b4ecdb8aabb898b6;
+extern VarInfo __var_info__cb6a1d18f5133920;
+extern FuncInfo __func_info__dc53d4e3894cb896;
+
+VarInfo __func_info__dc53d4e3894cb896_field_0 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0x226cc7d44a6e000f), "calls", 0 };
+VarInfo __func_info__dc53d4e3894cb896_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x6ffe5019524b3e67), "q", 0 };
+VarInfo __func_info__dc53d4e3894cb896_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf6b916190d9a778d), "c", 0 };
+VarInfo __func_info__dc53d4e3894cb896_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xdd969318ff9c00b6), "f", 0 };
+VarInfo __func_info__dc53d4e3894cb896_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xcb6a1d18f5133920), "d", 0 };
+VarInfo __func_info__dc53d4e3894cb896_field_5 =  { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xa4f45b9cf11344f8), "iusec", 0 };
+VarInfo __func_info__dc53d4e3894cb896_field_6 =  { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0x4eb3b2b99291d089), "jusec", 0 };
+VarInfo __func_info__dc53d4e3894cb896_field_7 =  { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xb4ecdb8aabb898b6), "cusec", 0 };
+VarInfo * __func_info__dc53d4e3894cb896_fields[8] =  { &__func_info__dc53d4e3894cb896_field_0, &__func_info__dc53d4e3894cb896_field_1, &__func_info__dc53d4e3894cb896_field_2, &__func_info__dc53d4e3894cb896_field_3, &__func_info__dc53d4e3894cb896_field_4, &__func_info__dc53d4e3894cb896_field_5, &__func_info__dc53d4e3894cb896_field_6, &__func_info__dc53d4e3894cb896_field_7 };
+FuncInfo __func_info__dc53d4e3894cb896 = {"invoke block<(calls:uint64;q:int;c:int;f:int;d:int;iusec:double;jusec:double;cusec:double):void> const", "", __func_info__dc53d4e3894cb896_fields, 8, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xdc53d4e3894cb896), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct TierStats; };
+namespace  {
+
+struct TierStats {
+	uint64_t interpreted_calls;
+	int32_t queued;
+	int32_t compiled;
+	int32_t failed;
+	int32_t deopted;
+	double interpreter_usec;
+	double jit_usec;
+	double compile_usec;
+};
+static_assert(sizeof(TierStats)==48,"structure size mismatch with DAS");
+static_assert(offsetof(TierStats,interpreted_calls)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TierStats,queued)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TierStats,compiled)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(TierStats,failed)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TierStats,deopted)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(TierStats,interpreter_usec)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TierStats,jit_usec)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TierStats,compile_usec)==40,"structure field offset mismatch with DAS");
+}
+
+inline int32_t hot_3b177fe2d6d6c042 ( Context * __context__, int32_t __n_rename_at_6 );
+inline int32_t looping_cc4ce8ef321254e4 ( Context * __context__, int32_t __n_rename_at_12 );
+inline int32_t cold_41bd5f67379db0d2 ( Context * __context__, int32_t __n_rename_at_20 );
+inline TierStats tier_stats_bc1d87fce043436 ( Context * __context__ );
+inline bool test_5d6ae92f98e6cff8 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0xe934398d168b17cc>(__context__) = 20;/*g_n*/
+	das_global<int32_t,0x7112d9f944d6319f>(__context__) = 0;/*g_sink*/
+}
+
+inline int32_t hot_3b177fe2d6d6c042 ( Context * __context__, int32_t __n_rename_at_6 )
+{
+	int32_t __s_rename_at_7 = 0;
+	{
+		bool __need_loop_8 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_6));
+		int32_t __i_rename_at_8;
+		__need_loop_8 = __i_iterator.first(__context__,(__i_rename_at_8)) && __need_loop_8;
+		for ( ; __need_loop_8 ; __need_loop_8 = __i_iterator.next(__context__,(__i_rename_at_8)) )
+		{
+			__s_rename_at_7 += (SimPolicy<int32_t>::Mod((__i_rename_at_8 * __i_rename_at_8),7,*__context__,nullptr));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_8));
+	};
+	return das_auto_cast<int32_t>::cast(__s_rename_at_7);
+}
+
+inline int32_t looping_cc4ce8ef321254e4 ( Context * __context__, int32_t __n_rename_at_12 )
+{
+	int32_t __s_rename_at_13 = 0;
+	int32_t __i_rename_at_14 = 0;
+	while ( __i_rename_at_14 < __n_rename_at_12 )
+	{
+		__s_rename_at_13 += (__i_rename_at_14 & 15);
+		++__i_rename_at_14;
+	};
+	return das_auto_cast<int32_t>::cast(__s_rename_at_13);
+}
+
+inline int32_t cold_41bd5f67379db0d2 ( Context * __context__, int32_t __n_rename_at_20 )
+{
+	return das_auto_cast<int32_t>::cast(__n_rename_at_20 + 1);
+}
+
+inline TierStats tier_stats_bc1d87fce043436 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,112,"tier_stats " DAS_FILE_LINE);
+{
+	TierStats __res_rename_at_34; das_zero(__res_rename_at_34);
+	das_jit_tiering_stats(das_make_block<void,uint64_t,int32_t,int32_t,int32_t,int32_t,double,double,double>(__context__,80,0,&__func_info__dc53d4e3894cb896,[&](uint64_t __calls_rename_at_35, int32_t __q_rename_at_35, int32_t __c_rename_at_35, int32_t __f_rename_at_35, int32_t __d_rename_at_35, double __iusec_rename_at_35, double __jusec_rename_at_35, double __cusec_rename_at_35)->void{
+		das_copy(__res_rename_at_34,(([&]() -> TierStats {
+			TierStats __mks_36;
+			das_copy((__mks_36.interpreted_calls),(__calls_rename_at_35));
+			das_copy((__mks_36.queued),(__q_rename_at_35));
+			das_copy((__mks_36.compiled),(__c_rename_at_35));
+			das_copy((__mks_36.failed),(__f_rename_at_35));
+			das_copy((__mks_36.deopted),(__d_rename_at_35));
+			das_copy((__mks_36.interpreter_usec),(__iusec_rename_at_35));
+			das_copy((__mks_36.jit_usec),(__jusec_rename_at_35));
+			das_copy((__mks_36.compile_usec),(__cusec_rename_at_35));
+			return __mks_36;
+		})()));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast_ref<TierStats>::cast(__res_rename_at_34);
+}}
+
+inline bool test_5d6ae92f98e6cff8 ( Context * __context__ )
+{
+	int32_t __expected_hot_rename_at_45 = ((int32_t)hot_3b177fe2d6d6c042(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/));
+	int32_t __expected_looping_rename_at_46 = ((int32_t)looping_cc4ce8ef321254e4(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/ * 1000));
+	DAS_VERIFY((das_jit_tiering(true,10,5000,__context__)));
+	{
+		bool __need_loop_49 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_49;
+		__need_loop_49 = __t_iterator.first(__context__,(__t_rename_at_49)) && __need_loop_49;
+		for ( ; __need_loop_49 ; __need_loop_49 = __t_iterator.next(__context__,(__t_rename_at_49)) )
+		{
+			DAS_VERIFY((hot_3b177fe2d6d6c042(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/) == __expected_hot_rename_at_45));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_49));
+	};
+	DAS_VERIFY((looping_cc4ce8ef321254e4(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/ * 1000) == __expected_looping_rename_at_46));
+	das_copy(das_global<int32_t,0x7112d9f944d6319f>(__context__) /*g_sink*/,cold_41bd5f67379db0d2(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/));
+	das_jit_tiering_wait(__context__);
+	DAS_VERIFY((hot_3b177fe2d6d6c042(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/) == __expected_hot_rename_at_45));
+	DAS_VERIFY((looping_cc4ce8ef321254e4(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/ * 1000) == __expected_looping_rename_at_46));
+	DAS_VERIFY((das_is_jit_function(Func(__context__->fnByMangledName(/*hot Ci*/ 6572086097779715148u)))));
+	DAS_VERIFY((das_is_jit_function(Func(__context__->fnByMangledName(/*looping Ci*/ 7485561151609362767u)))));
+	DAS_VERIFY((!das_is_jit_function(Func(__context__->fnByMangledName(/*cold Ci*/ 15714320913364712201u)))));
+	TierStats __stats_rename_at_61 = tier_stats_bc1d87fce043436(__context__);
+	DAS_ASSERT(((__stats_rename_at_61.queued >= 2) && (__stats_rename_at_61.compiled >= 2)));
+	DAS_ASSERT((__stats_rename_at_61.interpreted_calls >= UINT64_C(0xb)));
+	DAS_ASSERT((((__stats_rename_at_61.interpreter_usec > 0.) && (__stats_rename_at_61.jit_usec > 0.)) && (__stats_rename_at_61.compile_usec > 0.)));
+	DAS_VERIFY((das_remove_jit(Func(__context__->fnByMangledName(/*hot Ci*/ 6572086097779715148u)))));
+	{
+		bool __need_loop_68 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,20));
+		int32_t __t_rename_at_68;
+		__need_loop_68 = __t_iterator.first(__context__,(__t_rename_at_68)) && __need_loop_68;
+		for ( ; __need_loop_68 ; __need_loop_68 = __t_iterator.next(__context__,(__t_rename_at_68)) )
+		{
+			DAS_VERIFY((hot_3b177fe2d6d6c042(__context__,das_global<int32_t,0xe934398d168b17cc>(__context__) /*g_n*/) == __expected_hot_rename_at_45));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_68));
+	};
+	das_jit_tiering_wait(__context__);
+	DAS_VERIFY((!das_is_jit_function(Func(__context__->fnByMangledName(/*hot Ci*/ 6572086097779715148u)))));
+	das_copy(__stats_rename_at_61,tier_stats_bc1d87fce043436(__context__));
+	DAS_ASSERT((__stats_rename_at_61.deopted == 1));
+	char * __report_rename_at_74 = ((char *)(char *)(((char *)(das_jit_tiering_report(__context__)))));
+	DAS_ASSERT((builtin_string_length(__report_rename_at_74,__context__) > 0));
+	DAS_VERIFY((das_jit_tiering(false,1000,100000,__context__)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// hot_3b177fe2d6d6c042
+	aotLib[0x7cb7fbc3683dba41] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&hot_3b177fe2d6d6c042>>();
+	};
+	// looping_cc4ce8ef321254e4
+	aotLib[0x9b04488467f1ea99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&looping_cc4ce8ef321254e4>>();
+	};
+	// cold_41bd5f67379db0d2
+	aotLib[0x88f2a0e3ec6c6249] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&cold_41bd5f67379db0d2>>();
+	};
+	// tier_stats_bc1d87fce043436
+	aotLib[0x94e2ad6102e4577d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TierStats (*) ( Context * __context__ ),&tier_stats_bc1d87fce043436>>();
+	};
+	// test_5d6ae92f98e6cff8
+	aotLib[0x9c5883f8d7759688] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_5d6ae92f98e6cff8>>();
+	};
+	// [[ init script ]]
+	aotLib[0xdca712af1e6df784] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
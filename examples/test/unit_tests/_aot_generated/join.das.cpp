@@ -0,0 +1,335 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_16861495141994232996 {
+
+extern TypeInfo __type_info__b9a1419aa578516;
+extern TypeInfo __type_info__f95678735cf0e442;
+extern TypeInfo __type_info__90f5707b5a6f641;
+
+TypeInfo __type_info__b9a1419aa578516 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16548, 8, UINT64_C(0xb9a1419aa578516) };
+TypeInfo __type_info__f95678735cf0e442 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 40, UINT64_C(0xf95678735cf0e442) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__f95678735cf0e442.resolveAnnotation();
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__f95678735cf0e442, &__type_info__b9a1419aa578516 };
+TypeInfo * __tinfo_1[2] = { &__type_info__f95678735cf0e442, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_2[2] = { &__type_info__f95678735cf0e442, &__type_info__b9a1419aa578516 };
+TypeInfo * __tinfo_3[2] = { &__type_info__f95678735cf0e442, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_4[2] = { &__type_info__f95678735cf0e442, &__type_info__b9a1419aa578516 };
+TypeInfo * __tinfo_5[2] = { &__type_info__f95678735cf0e442, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_6[2] = { &__type_info__f95678735cf0e442, &__type_info__b9a1419aa578516 };
+TypeInfo * __tinfo_7[2] = { &__type_info__f95678735cf0e442, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_8[2] = { &__type_info__f95678735cf0e442, &__type_info__b9a1419aa578516 };
+TypeInfo * __tinfo_9[2] = { &__type_info__f95678735cf0e442, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_10[2] = { &__type_info__f95678735cf0e442, &__type_info__b9a1419aa578516 };
+
+inline char * const  _Funcstrings_boost_0x60_join_9a4ea3bbfa8bf8 ( Context * __context__, TDim<int32_t,1> const  & __it_rename_at_18, char * const  __separator_rename_at_18 );
+inline char * const  _Funcstrings_boost_0x60_join_33ec7afeb9584325 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_18, char * const  __separator_rename_at_18 );
+inline char * const  _Funcstrings_boost_0x60_join_d0e0ef47b0a376e1 ( Context * __context__, TDim<int32_t,4> const  & __it_rename_at_18, char * const  __separator_rename_at_18 );
+inline char * const  _Funcstrings_boost_0x60_join_7b3a02b54a3db2df ( Context * __context__, TArray<int32_t> const  & __it_rename_at_18, char * const  __separator_rename_at_18 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline char * const  _Funcstrings_boost_0x60_join_4d58c73e022813a1 ( Context * __context__, range __it_rename_at_18, char * const  __separator_rename_at_18 );
+inline char * const  _Funcstrings_boost_0x60_join_c5bc1006246142a4 ( Context * __context__, char * const  __it_rename_at_18, char * const  __separator_rename_at_18 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_451 );
+inline bool test_84a0a694bd86d2c0 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_9a4ea3bbfa8bf8 ( Context * __context__, TDim<int32_t,1> const  &  __it_rename_at_18, char * const  __separator_rename_at_18 )
+{
+	char * __st_rename_at_23 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_23)->void{
+		bool __skip_first_rename_at_24 = true;
+		{
+			bool __need_loop_25 = true;
+			// elem : int const&
+			das_iterator<TDim<int32_t,1> const > __elem_iterator(__it_rename_at_18);
+			int32_t const  * __elem_rename_at_25;
+			__need_loop_25 = __elem_iterator.first(__context__,(__elem_rename_at_25)) && __need_loop_25;
+			for ( ; __need_loop_25 ; __need_loop_25 = __elem_iterator.next(__context__,(__elem_rename_at_25)) )
+			{
+				if ( __skip_first_rename_at_24 )
+				{
+					das_copy(__skip_first_rename_at_24,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_23),cast<char * const >::from(__separator_rename_at_18)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_23),cast<int32_t>::from((*__elem_rename_at_25))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_25));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_23);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_33ec7afeb9584325 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_18, char * const  __separator_rename_at_18 )
+{
+	char * __st_rename_at_23 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_23)->void{
+		bool __skip_first_rename_at_24 = true;
+		{
+			bool __need_loop_25 = true;
+			// elem : int const
+			das_iterator<Sequence DAS_COMMENT((int32_t)) const > __elem_iterator(__it_rename_at_18);
+			int32_t __elem_rename_at_25;
+			__need_loop_25 = __elem_iterator.first(__context__,(__elem_rename_at_25)) && __need_loop_25;
+			for ( ; __need_loop_25 ; __need_loop_25 = __elem_iterator.next(__context__,(__elem_rename_at_25)) )
+			{
+				if ( __skip_first_rename_at_24 )
+				{
+					das_copy(__skip_first_rename_at_24,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<StringBuilderWriter &>::from(__writer_rename_at_23),cast<char * const >::from(__separator_rename_at_18)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_3,cast<StringBuilderWriter &>::from(__writer_rename_at_23),cast<int32_t>::from(__elem_rename_at_25)));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_25));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_23);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_d0e0ef47b0a376e1 ( Context * __context__, TDim<int32_t,4> const  &  __it_rename_at_18, char * const  __separator_rename_at_18 )
+{
+	char * __st_rename_at_23 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_23)->void{
+		bool __skip_first_rename_at_24 = true;
+		{
+			bool __need_loop_25 = true;
+			// elem : int const&
+			das_iterator<TDim<int32_t,4> const > __elem_iterator(__it_rename_at_18);
+			int32_t const  * __elem_rename_at_25;
+			__need_loop_25 = __elem_iterator.first(__context__,(__elem_rename_at_25)) && __need_loop_25;
+			for ( ; __need_loop_25 ; __need_loop_25 = __elem_iterator.next(__context__,(__elem_rename_at_25)) )
+			{
+				if ( __skip_first_rename_at_24 )
+				{
+					das_copy(__skip_first_rename_at_24,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_4,cast<StringBuilderWriter &>::from(__writer_rename_at_23),cast<char * const >::from(__separator_rename_at_18)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_5,cast<StringBuilderWriter &>::from(__writer_rename_at_23),cast<int32_t>::from((*__elem_rename_at_25))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_25));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_23);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_7b3a02b54a3db2df ( Context * __context__, TArray<int32_t> const  &  __it_rename_at_18, char * const  __separator_rename_at_18 )
+{
+	char * __st_rename_at_23 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_23)->void{
+		bool __skip_first_rename_at_24 = true;
+		{
+			bool __need_loop_25 = true;
+			// elem : int const&
+			das_iterator<TArray<int32_t> const > __elem_iterator(__it_rename_at_18);
+			int32_t const  * __elem_rename_at_25;
+			__need_loop_25 = __elem_iterator.first(__context__,(__elem_rename_at_25)) && __need_loop_25;
+			for ( ; __need_loop_25 ; __need_loop_25 = __elem_iterator.next(__context__,(__elem_rename_at_25)) )
+			{
+				if ( __skip_first_rename_at_24 )
+				{
+					das_copy(__skip_first_rename_at_24,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_6,cast<StringBuilderWriter &>::from(__writer_rename_at_23),cast<char * const >::from(__separator_rename_at_18)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_7,cast<StringBuilderWriter &>::from(__writer_rename_at_23),cast<int32_t>::from((*__elem_rename_at_25))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_25));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_23);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_4d58c73e022813a1 ( Context * __context__, range __it_rename_at_18, char * const  __separator_rename_at_18 )
+{
+	char * __st_rename_at_23 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_23)->void{
+		bool __skip_first_rename_at_24 = true;
+		{
+			bool __need_loop_25 = true;
+			// elem : int const
+			das_iterator<range> __elem_iterator(__it_rename_at_18);
+			int32_t __elem_rename_at_25;
+			__need_loop_25 = __elem_iterator.first(__context__,(__elem_rename_at_25)) && __need_loop_25;
+			for ( ; __need_loop_25 ; __need_loop_25 = __elem_iterator.next(__context__,(__elem_rename_at_25)) )
+			{
+				if ( __skip_first_rename_at_24 )
+				{
+					das_copy(__skip_first_rename_at_24,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_8,cast<StringBuilderWriter &>::from(__writer_rename_at_23),cast<char * const >::from(__separator_rename_at_18)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_9,cast<StringBuilderWriter &>::from(__writer_rename_at_23),cast<int32_t>::from(__elem_rename_at_25)));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_25));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_23);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_c5bc1006246142a4 ( Context * __context__, char * const  __it_rename_at_18, char * const  __separator_rename_at_18 )
+{
+	char * __st_rename_at_23 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_23)->void{
+		bool __skip_first_rename_at_24 = true;
+		{
+			bool __need_loop_25 = true;
+			// elem : int const
+			das_iterator<char * const > __elem_iterator(__it_rename_at_18);
+			int32_t __elem_rename_at_25;
+			__need_loop_25 = __elem_iterator.first(__context__,(__elem_rename_at_25)) && __need_loop_25;
+			for ( ; __need_loop_25 ; __need_loop_25 = __elem_iterator.next(__context__,(__elem_rename_at_25)) )
+			{
+				if ( __skip_first_rename_at_24 )
+				{
+					das_copy(__skip_first_rename_at_24,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_10,cast<StringBuilderWriter &>::from(__writer_rename_at_23),cast<char * const >::from(__separator_rename_at_18)));
+				};
+				write_string_char(das_arg<StringBuilderWriter>::pass(__writer_rename_at_23),__elem_rename_at_25);
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_25));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_23);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_451 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_452; das_zero(__it_rename_at_452);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_452),__rng_rename_at_451,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_452);
+}
+
+inline bool test_84a0a694bd86d2c0 ( Context * __context__ )
+{
+	TDim<int32_t,1> _temp_make_local_6_32;
+	TDim<int32_t,4> _temp_make_local_7_48;
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_9a4ea3bbfa8bf8(__context__,das_arg<TDim<int32_t,1>>::pass((([&]() -> TDim<int32_t,1>& {
+		_temp_make_local_6_32(0,__context__) = 1;
+		return _temp_make_local_6_32;
+	})())),((char *) ","))),cast<char *>::from(((char *) "1")),*__context__,nullptr)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_d0e0ef47b0a376e1(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_7_48(0,__context__) = 1;
+		_temp_make_local_7_48(1,__context__) = 2;
+		_temp_make_local_7_48(2,__context__) = 3;
+		_temp_make_local_7_48(3,__context__) = 4;
+		return _temp_make_local_7_48;
+	})())),((char *) ","))),cast<char *>::from(((char *) "1,2,3,4")),*__context__,nullptr)));
+	TArray<int32_t> __a_rename_at_9; das_zero(__a_rename_at_9);
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_7b3a02b54a3db2df(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),((char *) " "))),cast<char *>::from(nullptr),*__context__,nullptr)));
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),1);
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_7b3a02b54a3db2df(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),((char *) "."))),cast<char *>::from(((char *) "1")),*__context__,nullptr)));
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),2);
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_7b3a02b54a3db2df(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),((char *) "."))),cast<char *>::from(((char *) "1.2")),*__context__,nullptr)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_4d58c73e022813a1(__context__,range(1,4),((char *) "-"))),cast<char *>::from(((char *) "1-2-3")),*__context__,nullptr)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_c5bc1006246142a4(__context__,((char *) "hello"),((char *) " "))),cast<char *>::from(((char *) "h e l l o")),*__context__,nullptr)));
+	Sequence DAS_COMMENT((int32_t)) __rit_rename_at_20_ConstRef; das_zero(__rit_rename_at_20_ConstRef); das_move(__rit_rename_at_20_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(1,4))));
+	Sequence DAS_COMMENT((int32_t)) const  & __rit_rename_at_20 = __rit_rename_at_20_ConstRef; ;
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_33ec7afeb9584325(__context__,__rit_rename_at_20,((char *) "*"))),cast<char *>::from(((char *) "1*2*3")),*__context__,nullptr)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcstrings_boost_0x60_join_9a4ea3bbfa8bf8
+	aotLib[0x9320569c1fec92a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TDim<int32_t,1> const  & , char * const   ),&_Funcstrings_boost_0x60_join_9a4ea3bbfa8bf8>>();
+	};
+	// _Funcstrings_boost_0x60_join_33ec7afeb9584325
+	aotLib[0x5d8ce708d21d4ce1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , char * const   ),&_Funcstrings_boost_0x60_join_33ec7afeb9584325>>();
+	};
+	// _Funcstrings_boost_0x60_join_d0e0ef47b0a376e1
+	aotLib[0x2de4eb8e39c99669] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TDim<int32_t,4> const  & , char * const   ),&_Funcstrings_boost_0x60_join_d0e0ef47b0a376e1>>();
+	};
+	// _Funcstrings_boost_0x60_join_7b3a02b54a3db2df
+	aotLib[0xc763f8a334813dc1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TArray<int32_t> const  & , char * const   ),&_Funcstrings_boost_0x60_join_7b3a02b54a3db2df>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Funcstrings_boost_0x60_join_4d58c73e022813a1
+	aotLib[0x20b72b46f59a5b31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, range , char * const   ),&_Funcstrings_boost_0x60_join_4d58c73e022813a1>>();
+	};
+	// _Funcstrings_boost_0x60_join_c5bc1006246142a4
+	aotLib[0xee251c657ac22409] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, char * const  , char * const   ),&_Funcstrings_boost_0x60_join_c5bc1006246142a4>>();
+	};
+	// _Funcbuiltin_0x60_each_5cbab1dfe9635bc1
+	aotLib[0x8c2bf3089ff8b6f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_5cbab1dfe9635bc1>>();
+	};
+	// test_84a0a694bd86d2c0
+	aotLib[0x93b770fd44b22e65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_84a0a694bd86d2c0>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,312 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14602203794430086486 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline void basic_goto_8c0cda91fbb18c0d ( Context * __context__ );
+inline void nested_goto_824638af9d134b1c ( Context * __context__ );
+inline void for_goto_90b10236c6c14907 ( Context * __context__ );
+inline void while_goto_119ffbd8a21c7ad7 ( Context * __context__ );
+inline void finally_goto_516a9594ec3a62cf ( Context * __context__, bool __yes_rename_at_74 );
+inline int32_t gotoN_142b6df317484e60 ( Context * __context__, int32_t __n_rename_at_85 );
+inline void N_goto_9a2b68351cc0f0ba ( Context * __context__ );
+inline bool test_12e3c67dfe140ad9 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void basic_goto_8c0cda91fbb18c0d ( Context * __context__ )
+{
+	TDim<int32_t,10> __arr_rename_at_4; das_zero(__arr_rename_at_4);
+	int32_t __i_rename_at_5 = 0;
+	label_0:;;
+	das_copy(__arr_rename_at_4(__i_rename_at_5,__context__),__i_rename_at_5);
+	++__i_rename_at_5;
+	if ( __i_rename_at_5 < 10 )
+	{
+		goto label_0;
+	};
+	{
+		bool __need_loop_13 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_13;
+		__need_loop_13 = __t_iterator.first(__context__,(__t_rename_at_13)) && __need_loop_13;
+		for ( ; __need_loop_13 ; __need_loop_13 = __t_iterator.next(__context__,(__t_rename_at_13)) )
+		{
+			DAS_ASSERT((__arr_rename_at_4(__t_rename_at_13,__context__) == __t_rename_at_13));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_13));
+	};
+}
+
+inline void nested_goto_824638af9d134b1c ( Context * __context__ )
+{
+	bool __fail_rename_at_19 = false;
+	TDim<int32_t,10> __arr_rename_at_20; das_zero(__arr_rename_at_20);
+	int32_t __i_rename_at_21 = 0;
+	label_0:;;
+	das_copy(__arr_rename_at_20(__i_rename_at_21,__context__),__i_rename_at_21);
+	++__i_rename_at_21;
+	if ( __i_rename_at_21 < 10 )
+	{
+		if ( __i_rename_at_21 < 10 )
+		{
+			goto label_0;
+		};
+		das_copy(__fail_rename_at_19,true);
+	};
+	{
+		bool __need_loop_30 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_30;
+		__need_loop_30 = __t_iterator.first(__context__,(__t_rename_at_30)) && __need_loop_30;
+		for ( ; __need_loop_30 ; __need_loop_30 = __t_iterator.next(__context__,(__t_rename_at_30)) )
+		{
+			DAS_ASSERT((__arr_rename_at_20(__t_rename_at_30,__context__) == __t_rename_at_30));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_30));
+	};
+}
+
+inline void for_goto_90b10236c6c14907 ( Context * __context__ )
+{
+	TDim<int32_t,10> __arr_rename_at_36; das_zero(__arr_rename_at_36);
+	{
+		bool __need_loop_37 = true;
+		// j : int const
+		das_iterator<range> __j_iterator(range(0,10));
+		int32_t __j_rename_at_37;
+		__need_loop_37 = __j_iterator.first(__context__,(__j_rename_at_37)) && __need_loop_37;
+		for ( ; __need_loop_37 ; __need_loop_37 = __j_iterator.next(__context__,(__j_rename_at_37)) )
+		{
+			int32_t __i_rename_at_38 = 0;
+			label_0:;;
+			das_copy(__arr_rename_at_36(__i_rename_at_38,__context__),__i_rename_at_38 + __j_rename_at_37);
+			++__i_rename_at_38;
+			if ( __i_rename_at_38 < 10 )
+			{
+				goto label_0;
+			};
+			{
+				bool __need_loop_45 = true;
+				// t : int const
+				das_iterator<range> __t_iterator(range(0,10));
+				int32_t __t_rename_at_45;
+				__need_loop_45 = __t_iterator.first(__context__,(__t_rename_at_45)) && __need_loop_45;
+				for ( ; __need_loop_45 ; __need_loop_45 = __t_iterator.next(__context__,(__t_rename_at_45)) )
+				{
+					DAS_ASSERT((__arr_rename_at_36(__t_rename_at_45,__context__) == (__t_rename_at_45 + __j_rename_at_37)));
+				}
+				__t_iterator.close(__context__,(__t_rename_at_45));
+			};
+		}
+		__j_iterator.close(__context__,(__j_rename_at_37));
+	};
+	{
+		bool __need_loop_48 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_48;
+		__need_loop_48 = __t_iterator.first(__context__,(__t_rename_at_48)) && __need_loop_48;
+		for ( ; __need_loop_48 ; __need_loop_48 = __t_iterator.next(__context__,(__t_rename_at_48)) )
+		{
+			DAS_ASSERT((__arr_rename_at_36(__t_rename_at_48,__context__) == (__t_rename_at_48 + 9)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_48));
+	};
+}
+
+inline void while_goto_119ffbd8a21c7ad7 ( Context * __context__ )
+{
+	TDim<int32_t,10> __arr_rename_at_55; das_zero(__arr_rename_at_55);
+	int32_t __j_rename_at_56 = 0;
+	while ( __j_rename_at_56 < 10 )
+	{
+		int32_t __i_rename_at_58 = 0;
+		label_0:;;
+		das_copy(__arr_rename_at_55(__i_rename_at_58,__context__),__i_rename_at_58 + __j_rename_at_56);
+		++__i_rename_at_58;
+		if ( __i_rename_at_58 < 10 )
+		{
+			goto label_0;
+		};
+		{
+			bool __need_loop_65 = true;
+			// t : int const
+			das_iterator<range> __t_iterator(range(0,10));
+			int32_t __t_rename_at_65;
+			__need_loop_65 = __t_iterator.first(__context__,(__t_rename_at_65)) && __need_loop_65;
+			for ( ; __need_loop_65 ; __need_loop_65 = __t_iterator.next(__context__,(__t_rename_at_65)) )
+			{
+				DAS_ASSERT((__arr_rename_at_55(__t_rename_at_65,__context__) == (__t_rename_at_65 + __j_rename_at_56)));
+			}
+			__t_iterator.close(__context__,(__t_rename_at_65));
+		};
+		++__j_rename_at_56;
+	};
+	{
+		bool __need_loop_69 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_69;
+		__need_loop_69 = __t_iterator.first(__context__,(__t_rename_at_69)) && __need_loop_69;
+		for ( ; __need_loop_69 ; __need_loop_69 = __t_iterator.next(__context__,(__t_rename_at_69)) )
+		{
+			DAS_ASSERT((__arr_rename_at_55(__t_rename_at_69,__context__) == (__t_rename_at_69 + 9)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_69));
+	};
+}
+
+inline void finally_goto_516a9594ec3a62cf ( Context * __context__, bool __yes_rename_at_74 )
+{
+	bool __fail_rename_at_75 = true;
+	if ( __yes_rename_at_74 )
+	{
+	/* finally */ auto __finally_77= das_finally([&](){
+		das_copy(__fail_rename_at_75,false);
+	/* end finally */ });
+		das_copy(__fail_rename_at_75,true);
+		goto label_0;
+	};
+	label_0:;;
+	DAS_ASSERT((!__fail_rename_at_75));
+}
+
+inline int32_t gotoN_142b6df317484e60 ( Context * __context__, int32_t __n_rename_at_85 )
+{
+	int32_t __res_rename_at_86 = -1;
+	switch (__n_rename_at_85) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 3: goto label_3;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(__res_rename_at_86,0);
+	goto label_3;
+	label_1:;;
+	das_copy(__res_rename_at_86,1);
+	goto label_3;
+	label_2:;;
+	das_copy(__res_rename_at_86,2);
+	goto label_3;
+	label_3:;;
+	return das_auto_cast<int32_t>::cast(__res_rename_at_86);
+}
+
+inline void N_goto_9a2b68351cc0f0ba ( Context * __context__ )
+{
+	DAS_VERIFY((gotoN_142b6df317484e60(__context__,0) == 0));
+	DAS_VERIFY((gotoN_142b6df317484e60(__context__,1) == 1));
+	DAS_VERIFY((gotoN_142b6df317484e60(__context__,2) == 2));
+	DAS_VERIFY((gotoN_142b6df317484e60(__context__,3) == -1));
+}
+
+inline bool test_12e3c67dfe140ad9 ( Context * __context__ )
+{
+	basic_goto_8c0cda91fbb18c0d(__context__);
+	nested_goto_824638af9d134b1c(__context__);
+	for_goto_90b10236c6c14907(__context__);
+	while_goto_119ffbd8a21c7ad7(__context__);
+	finally_goto_516a9594ec3a62cf(__context__,true);
+	N_goto_9a2b68351cc0f0ba(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// basic_goto_8c0cda91fbb18c0d
+	aotLib[0xfdc0bf664fb11df9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&basic_goto_8c0cda91fbb18c0d>>();
+	};
+	// nested_goto_824638af9d134b1c
+	aotLib[0xbe558eef01fb9e55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&nested_goto_824638af9d134b1c>>();
+	};
+	// for_goto_90b10236c6c14907
+	aotLib[0xbde39809ec1df819] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&for_goto_90b10236c6c14907>>();
+	};
+	// while_goto_119ffbd8a21c7ad7
+	aotLib[0x261dd8e901009ffd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&while_goto_119ffbd8a21c7ad7>>();
+	};
+	// finally_goto_516a9594ec3a62cf
+	aotLib[0xd902e52767dc33f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, bool  ),&finally_goto_516a9594ec3a62cf>>();
+	};
+	// gotoN_142b6df317484e60
+	aotLib[0x4d031883a24ece65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&gotoN_142b6df317484e60>>();
+	};
+	// N_goto_9a2b68351cc0f0ba
+	aotLib[0x526586b030b83715] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&N_goto_9a2b68351cc0f0ba>>();
+	};
+	// test_12e3c67dfe140ad9
+	aotLib[0x27294b8803dd7ac2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_12e3c67dfe140ad9>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
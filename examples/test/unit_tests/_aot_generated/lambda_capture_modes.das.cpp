@@ -0,0 +1,396 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3834142340220581425 {
+
+extern StructInfo __struct_info__f35ff723fded4627;
+extern StructInfo __struct_info__13c9c109b3b9668e;
+extern StructInfo __struct_info__19c8c78c973aa469;
+extern TypeInfo __type_info__dfd82b908f3b1490;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__c25909d47fcbd02e;
+extern TypeInfo __type_info__191e9af2cafe6af0;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__d6a2c32eecda1595;
+extern TypeInfo __type_info__c6da56122d36aaea;
+extern TypeInfo __type_info__6deb491c6c2cdb9f;
+extern VarInfo __var_info__a9aa928ce20f509;
+extern VarInfo __var_info__f9dbeb0652ac1aeb;
+extern VarInfo __var_info__b6ec23458376bbb;
+extern VarInfo __var_info__8d7bd0ac84d3333d;
+extern VarInfo __var_info__f0483770eed3747;
+extern VarInfo __var_info__bf0cf5e7ade9c864;
+extern VarInfo __var_info__8d7bcdac84d32e24;
+extern VarInfo __var_info__a9aa828ce20f356;
+extern VarInfo __var_info__a9aa628ce20eff0;
+extern VarInfo __var_info__c9d66f25b7f7bd4a;
+extern VarInfo __var_info__811a28cdaee34e42;
+
+VarInfo __struct_info__f35ff723fded4627_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xb6ec23458376bbb), "dummy", 0 };
+VarInfo * __struct_info__f35ff723fded4627_fields[1] =  { &__struct_info__f35ff723fded4627_field_0 };
+StructInfo __struct_info__f35ff723fded4627 = {"Foo", "", 0, __struct_info__f35ff723fded4627_fields, 1, 4, UINT64_C(0x0), nullptr, UINT64_C(0xf35ff723fded4627) };
+TypeInfo * __type_info__f9dbeb0652ac1aeb_arg_types_var_1425883004453611150[1] = { &__type_info__6deb491c6c2cdb9f };
+VarInfo __struct_info__13c9c109b3b9668e_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f9dbeb0652ac1aeb_arg_types_var_1425883004453611150, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xf9dbeb0652ac1aeb), "__lambda", 0 };
+TypeInfo * __type_info__c9d66f25b7f7bd4a_arg_types_var_1425883004453611150[1] = { &__type_info__d6a2c32eecda1595 };
+VarInfo __struct_info__13c9c109b3b9668e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__c9d66f25b7f7bd4a_arg_types_var_1425883004453611150, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xc9d66f25b7f7bd4a), "__finalize", 8 };
+VarInfo __struct_info__13c9c109b3b9668e_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c6da56122d36aaea, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xa9aa628ce20eff0), "a1", 16 };
+VarInfo __struct_info__13c9c109b3b9668e_field_3 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xa9aa928ce20f509), "a2", 24 };
+VarInfo __struct_info__13c9c109b3b9668e_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xa9aa828ce20f356), "a3", 48 };
+VarInfo * __struct_info__13c9c109b3b9668e_fields[5] =  { &__struct_info__13c9c109b3b9668e_field_0, &__struct_info__13c9c109b3b9668e_field_1, &__struct_info__13c9c109b3b9668e_field_2, &__struct_info__13c9c109b3b9668e_field_3, &__struct_info__13c9c109b3b9668e_field_4 };
+StructInfo __struct_info__13c9c109b3b9668e = {"_lambda_thismodule_33_3_2", "", 22, __struct_info__13c9c109b3b9668e_fields, 5, 72, UINT64_C(0x0), nullptr, UINT64_C(0x13c9c109b3b9668e) };
+TypeInfo * __type_info__811a28cdaee34e42_arg_types_var_1857954252936881257[1] = { &__type_info__c25909d47fcbd02e };
+VarInfo __struct_info__19c8c78c973aa469_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__811a28cdaee34e42_arg_types_var_1857954252936881257, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x811a28cdaee34e42), "__lambda", 0 };
+TypeInfo * __type_info__f0483770eed3747_arg_types_var_1857954252936881257[1] = { &__type_info__191e9af2cafe6af0 };
+VarInfo __struct_info__19c8c78c973aa469_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f0483770eed3747_arg_types_var_1857954252936881257, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xf0483770eed3747), "__finalize", 8 };
+VarInfo __struct_info__19c8c78c973aa469_field_2 =  { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 4, UINT64_C(0xbf0cf5e7ade9c864), "C", 16 };
+VarInfo __struct_info__19c8c78c973aa469_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__dfd82b908f3b1490, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8d7bcdac84d32e24), "pA", 24 };
+VarInfo __struct_info__19c8c78c973aa469_field_4 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__dfd82b908f3b1490, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8d7bd0ac84d3333d), "pB", 32 };
+VarInfo * __struct_info__19c8c78c973aa469_fields[5] =  { &__struct_info__19c8c78c973aa469_field_0, &__struct_info__19c8c78c973aa469_field_1, &__struct_info__19c8c78c973aa469_field_2, &__struct_info__19c8c78c973aa469_field_3, &__struct_info__19c8c78c973aa469_field_4 };
+StructInfo __struct_info__19c8c78c973aa469 = {"_lambda_thismodule_16_2_1", "", 6, __struct_info__19c8c78c973aa469_fields, 5, 40, UINT64_C(0x0), nullptr, UINT64_C(0x19c8c78c973aa469) };
+TypeInfo __type_info__dfd82b908f3b1490 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 4, UINT64_C(0xdfd82b908f3b1490) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__c25909d47fcbd02e = { Type::tStructure, &__struct_info__19c8c78c973aa469, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 40, UINT64_C(0xc25909d47fcbd02e) };
+TypeInfo __type_info__191e9af2cafe6af0 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c25909d47fcbd02e, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x191e9af2cafe6af0) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__d6a2c32eecda1595 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6deb491c6c2cdb9f, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xd6a2c32eecda1595) };
+TypeInfo __type_info__c6da56122d36aaea = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xc6da56122d36aaea) };
+TypeInfo __type_info__6deb491c6c2cdb9f = { Type::tStructure, &__struct_info__13c9c109b3b9668e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 72, UINT64_C(0x6deb491c6c2cdb9f) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Foo; };
+namespace  { struct _lambda_thismodule_16_2_1; };
+namespace  { struct _lambda_thismodule_33_3_2; };
+namespace  {
+
+struct Foo {
+	int32_t dummy;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,dummy)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_16_2_1 {
+	Func DAS_COMMENT((void,_lambda_thismodule_16_2_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_16_2_1 *)) __finalize;
+	Foo C;
+	Foo * pA;
+	Foo * pB;
+};
+static_assert(sizeof(_lambda_thismodule_16_2_1)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_2_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_2_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_2_1,C)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_2_1,pA)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_2_1,pB)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_33_3_2 {
+	Func DAS_COMMENT((void,_lambda_thismodule_33_3_2)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_33_3_2 *)) __finalize;
+	TArray<int32_t> * a1;
+	TArray<int32_t> a2;
+	TArray<int32_t> a3;
+};
+static_assert(sizeof(_lambda_thismodule_33_3_2)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_33_3_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_33_3_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_33_3_2,a1)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_33_3_2,a2)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_33_3_2,a3)==48,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> & __a_rename_at_338, TArray<int32_t> const  & __b_rename_at_338 );
+inline void finalize_6e26c06df6af9ee8 ( Context * __context__, Foo * & ____this_rename_at_12 );
+inline void finalize_5182e01d51b1e01a ( Context * __context__, _lambda_thismodule_33_3_2 & ____this_rename_at_33 );
+inline void finalize_f97e9ee88efdee33 ( Context * __context__, _lambda_thismodule_16_2_1 & ____this_rename_at_16 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline void _Func_lambda_thismodule_33_3_2_0x60_function_ac241b775db4f5ae ( Context * __context__, _lambda_thismodule_33_3_2 & ____this_rename_at_33 );
+inline void _Func_lambda_thismodule_33_3_2_0x60_finalizer_9075fc046a08b122 ( Context * __context__, _lambda_thismodule_33_3_2 * ____this_rename_at_33 );
+inline void _Func_lambda_thismodule_16_2_1_0x60_function_93951be4fdbb78de ( Context * __context__, _lambda_thismodule_16_2_1 & ____this_rename_at_16 );
+inline void _Func_lambda_thismodule_16_2_1_0x60_finalizer_2c1099cba8d93be0 ( Context * __context__, _lambda_thismodule_16_2_1 * ____this_rename_at_16 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_8095aad6f5b96480 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_518 );
+inline void finalize_f12d08ce5dd8bd15 ( Context * __context__, Foo const  & __f_rename_at_7 );
+inline bool test_delete_9e9550f94c1cb2bf ( Context * __context__ );
+inline bool test_dfee50dd1e0dd805 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x28f91f2ccac8e71a>(__context__) = 0;/*g_counter*/
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> &  __a_rename_at_338, TArray<int32_t> const  &  __b_rename_at_338 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_338),builtin_array_size(__b_rename_at_338));
+	{
+		bool __need_loop_340 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_338);
+		int32_t * __aV_rename_at_340;
+		__need_loop_340 = __aV_iterator.first(__context__,(__aV_rename_at_340)) && __need_loop_340;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_338);
+		int32_t const  * __bV_rename_at_340;
+		__need_loop_340 = __bV_iterator.first(__context__,(__bV_rename_at_340)) && __need_loop_340;
+		for ( ; __need_loop_340 ; __need_loop_340 = __aV_iterator.next(__context__,(__aV_rename_at_340)) && __bV_iterator.next(__context__,(__bV_rename_at_340)) )
+		{
+			das_copy((*__aV_rename_at_340),(*__bV_rename_at_340));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_340));
+		__bV_iterator.close(__context__,(__bV_rename_at_340));
+	};
+}
+
+inline void finalize_6e26c06df6af9ee8 ( Context * __context__, Foo * & ____this_rename_at_12 )
+{
+	if ( ____this_rename_at_12 != nullptr )
+	{
+		finalize_f12d08ce5dd8bd15(__context__,das_arg<Foo>::pass(das_deref(__context__,____this_rename_at_12)));
+		das_delete<Foo *>::clear(__context__,____this_rename_at_12);
+		das_copy(____this_rename_at_12,nullptr);
+	};
+}
+
+inline void finalize_5182e01d51b1e01a ( Context * __context__, _lambda_thismodule_33_3_2 &  ____this_rename_at_33 )
+{
+	memset(&(____this_rename_at_33), 0, 72);
+}
+
+inline void finalize_f97e9ee88efdee33 ( Context * __context__, _lambda_thismodule_16_2_1 &  ____this_rename_at_16 )
+{
+	finalize_f12d08ce5dd8bd15(__context__,das_arg<Foo>::pass(____this_rename_at_16.C));
+	finalize_6e26c06df6af9ee8(__context__,____this_rename_at_16.pA);
+	memset(&(____this_rename_at_16), 0, 40);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Func_lambda_thismodule_33_3_2_0x60_function_ac241b775db4f5ae ( Context * __context__, _lambda_thismodule_33_3_2 &  ____this_rename_at_33 )
+{
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(das_deref(__context__,____this_rename_at_33.a1)),1);
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_33.a2),1);
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_33.a3),1);
+}
+
+inline void _Func_lambda_thismodule_33_3_2_0x60_finalizer_9075fc046a08b122 ( Context * __context__, _lambda_thismodule_33_3_2 * ____this_rename_at_33 )
+{
+	finalize_5182e01d51b1e01a(__context__,das_arg<_lambda_thismodule_33_3_2>::pass(das_deref(__context__,____this_rename_at_33)));
+	das_delete_lambda_struct<_lambda_thismodule_33_3_2 *>::clear(__context__,____this_rename_at_33);
+}
+
+inline void _Func_lambda_thismodule_16_2_1_0x60_function_93951be4fdbb78de ( Context * __context__, _lambda_thismodule_16_2_1 &  ____this_rename_at_16 )
+{
+	DAS_ASSERT((____this_rename_at_16.pA->dummy == 0));
+	DAS_ASSERT((____this_rename_at_16.pB->dummy == 0));
+	DAS_ASSERT((____this_rename_at_16.C.dummy == 0));
+}
+
+inline void _Func_lambda_thismodule_16_2_1_0x60_finalizer_2c1099cba8d93be0 ( Context * __context__, _lambda_thismodule_16_2_1 * ____this_rename_at_16 )
+{
+	finalize_f97e9ee88efdee33(__context__,das_arg<_lambda_thismodule_16_2_1>::pass(das_deref(__context__,____this_rename_at_16)));
+	das_delete_lambda_struct<_lambda_thismodule_16_2_1 *>::clear(__context__,____this_rename_at_16);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_8095aad6f5b96480 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_518 )
+{
+	TArray<int32_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_519),2);
+	das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_519);
+}
+
+inline void finalize_f12d08ce5dd8bd15 ( Context * __context__, Foo const  &  __f_rename_at_7 )
+{
+	++das_global<int32_t,0x28f91f2ccac8e71a>(__context__) /*g_counter*/;
+}
+
+inline bool test_delete_9e9550f94c1cb2bf ( Context * __context__ )
+{
+	Foo * __pA_rename_at_12 = das_new<Foo>::make(__context__);
+	Foo * __pB_rename_at_13 = das_new<Foo>::make(__context__);
+	Foo __C_rename_at_14 = (([&]() -> Foo {
+		Foo __mks_14;
+		das_zero(__mks_14);
+		return __mks_14;
+	})());
+	Lambda DAS_COMMENT((void)) __lam_rename_at_15; das_zero(__lam_rename_at_15); das_move(__lam_rename_at_15, das_ascend<void,_lambda_thismodule_16_2_1>::make(__context__,&__type_info__c25909d47fcbd02e,(([&]() -> _lambda_thismodule_16_2_1 {
+		_lambda_thismodule_16_2_1 __mks_16;
+		das_copy((__mks_16.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_16_2_1`function XS<::_lambda_thismodule_16_2_1>*/ 12046897622016808916u))));
+		das_copy((__mks_16.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_16_2_1`finalizer X1<S<::_lambda_thismodule_16_2_1>>?*/ 1247886874655106212u))));
+		das_copy((__mks_16.C),(__C_rename_at_14));
+		das_copy((__mks_16.pA),(__pA_rename_at_12));
+		das_move((__mks_16.pB),(__pB_rename_at_13));
+		return __mks_16;
+	})())));
+	DAS_ASSERT((__pB_rename_at_13 == nullptr));
+	das_invoke_lambda<void>::invoke(__context__,nullptr,__lam_rename_at_15);
+	das_delete<Lambda DAS_COMMENT((void))>::clear(__context__,__lam_rename_at_15);
+	DAS_ASSERT((das_global<int32_t,0x28f91f2ccac8e71a>(__context__) /*g_counter*/ == 2));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_dfee50dd1e0dd805 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,272,"test " DAS_FILE_LINE);
+{
+	TDim<int32_t,2> _temp_make_local_28_64;
+	TDim<int32_t,2> _temp_make_local_29_112;
+	TDim<int32_t,2> _temp_make_local_30_160;
+	TArray<int32_t> __a1_rename_at_28; das_zero(__a1_rename_at_28); das_move(__a1_rename_at_28, _Funcbuiltin_0x60_to_array_move_8095aad6f5b96480(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_28_64(0,__context__) = 1;
+		_temp_make_local_28_64(1,__context__) = 2;
+		return _temp_make_local_28_64;
+	})()))));
+	TArray<int32_t> __a2_rename_at_29; das_zero(__a2_rename_at_29); das_move(__a2_rename_at_29, _Funcbuiltin_0x60_to_array_move_8095aad6f5b96480(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_29_112(0,__context__) = 1;
+		_temp_make_local_29_112(1,__context__) = 2;
+		return _temp_make_local_29_112;
+	})()))));
+	TArray<int32_t> __a3_rename_at_30; das_zero(__a3_rename_at_30); das_move(__a3_rename_at_30, _Funcbuiltin_0x60_to_array_move_8095aad6f5b96480(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_30_160(0,__context__) = 1;
+		_temp_make_local_30_160(1,__context__) = 2;
+		return _temp_make_local_30_160;
+	})()))));
+	Lambda DAS_COMMENT((void)) __lam_rename_at_32; das_zero(__lam_rename_at_32); das_move(__lam_rename_at_32, das_ascend<void,_lambda_thismodule_33_3_2>::make(__context__,&__type_info__6deb491c6c2cdb9f,(([&]() -> _lambda_thismodule_33_3_2 {
+		_lambda_thismodule_33_3_2 __mks_33;
+		das_zero(__mks_33);
+		das_copy((__mks_33.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_33_3_2`function XS<::_lambda_thismodule_33_3_2>*/ 15589734991651792996u))));
+		das_copy((__mks_33.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_33_3_2`finalizer X1<S<::_lambda_thismodule_33_3_2>>?*/ 12552045046090067474u))));
+		das_copy((__mks_33.a1),(das_ref(__context__,__a1_rename_at_28)));
+		das_move((__mks_33.a2),(__a2_rename_at_29));
+		{
+			_Funcbuiltin_0x60_clone_7775f70b42a34990(__context__,das_arg<TArray<int32_t>>::pass(__mks_33.a3),das_arg<TArray<int32_t>>::pass(__a3_rename_at_30));
+		}		return __mks_33;
+	})())));
+	das_invoke_lambda<void>::invoke(__context__,nullptr,__lam_rename_at_32);
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a1_rename_at_28)) == 3));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a2_rename_at_29)) == 0));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a3_rename_at_30)) == 2));
+	test_delete_9e9550f94c1cb2bf(__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_clone_7775f70b42a34990
+	aotLib[0xbde965effb9cac8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_7775f70b42a34990>>();
+	};
+	// finalize_6e26c06df6af9ee8
+	aotLib[0x7dc2d9270432a758] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo * &  ),&finalize_6e26c06df6af9ee8>>();
+	};
+	// finalize_5182e01d51b1e01a
+	aotLib[0x35bb74e0af929e75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_33_3_2 &  ),&finalize_5182e01d51b1e01a>>();
+	};
+	// finalize_f97e9ee88efdee33
+	aotLib[0xef46b6a089ba5c36] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_2_1 &  ),&finalize_f97e9ee88efdee33>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Func_lambda_thismodule_33_3_2_0x60_function_ac241b775db4f5ae
+	aotLib[0xb3c0c9dc1fb91088] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_33_3_2 &  ),&_Func_lambda_thismodule_33_3_2_0x60_function_ac241b775db4f5ae>>();
+	};
+	// _Func_lambda_thismodule_33_3_2_0x60_finalizer_9075fc046a08b122
+	aotLib[0x291fae51c3efbb55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_33_3_2 *  ),&_Func_lambda_thismodule_33_3_2_0x60_finalizer_9075fc046a08b122>>();
+	};
+	// _Func_lambda_thismodule_16_2_1_0x60_function_93951be4fdbb78de
+	aotLib[0x9d9b6f3531fb51b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_2_1 &  ),&_Func_lambda_thismodule_16_2_1_0x60_function_93951be4fdbb78de>>();
+	};
+	// _Func_lambda_thismodule_16_2_1_0x60_finalizer_2c1099cba8d93be0
+	aotLib[0xfb662507880f6d3f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_2_1 *  ),&_Func_lambda_thismodule_16_2_1_0x60_finalizer_2c1099cba8d93be0>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_8095aad6f5b96480
+	aotLib[0x4128e4dc2cc12101] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,2> &  ),&_Funcbuiltin_0x60_to_array_move_8095aad6f5b96480>>();
+	};
+	// finalize_f12d08ce5dd8bd15
+	aotLib[0xf6bcded70c05e499] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo const  &  ),&finalize_f12d08ce5dd8bd15>>();
+	};
+	// test_delete_9e9550f94c1cb2bf
+	aotLib[0xa7b93674a341790] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_delete_9e9550f94c1cb2bf>>();
+	};
+	// test_dfee50dd1e0dd805
+	aotLib[0x9e1b22db108253ab] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_dfee50dd1e0dd805>>();
+	};
+	// [[ init script ]]
+	aotLib[0xd80166db7424acd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
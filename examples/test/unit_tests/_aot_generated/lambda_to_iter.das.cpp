@@ -0,0 +1,306 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4630714069667024076 {
+
+extern StructInfo __struct_info__f35ff723fded4627;
+extern StructInfo __struct_info__b08126c18c4eb620;
+extern StructInfo __struct_info__fc01352167b7d425;
+extern TypeInfo __type_info__dfd82b908f3b1490;
+extern TypeInfo __type_info__af63df4c8601f1a5;
+extern TypeInfo __type_info__e89fa787528fe9fc;
+extern TypeInfo __type_info__2f75c9939bbea90b;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__7bf5307b489d850;
+extern TypeInfo __type_info__2a0ab836a28a8cb9;
+extern TypeInfo __type_info__971e3eabd6eae788;
+extern VarInfo __var_info__dbc7247f4ff7a30a;
+extern VarInfo __var_info__3d8833490ce44a90;
+extern VarInfo __var_info__e05895d9cfcf7e3b;
+extern VarInfo __var_info__85c370960df8537b;
+extern VarInfo __var_info__b6a668aaf48962be;
+extern VarInfo __var_info__8b37c8dad3bbc601;
+extern VarInfo __var_info__838c839f665e952;
+
+VarInfo __struct_info__f35ff723fded4627_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xdbc7247f4ff7a30a), "value", 0 };
+VarInfo * __struct_info__f35ff723fded4627_fields[1] =  { &__struct_info__f35ff723fded4627_field_0 };
+StructInfo __struct_info__f35ff723fded4627 = {"Foo", "", 0, __struct_info__f35ff723fded4627_fields, 1, 4, UINT64_C(0x0), nullptr, UINT64_C(0xf35ff723fded4627) };
+TypeInfo * __type_info__8b37c8dad3bbc601_arg_types_var_12718489435395503648[2] = { &__type_info__2a0ab836a28a8cb9, &__type_info__dfd82b908f3b1490 };
+VarInfo __struct_info__b08126c18c4eb620_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__8b37c8dad3bbc601_arg_types_var_12718489435395503648, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x8b37c8dad3bbc601), "__lambda", 0 };
+TypeInfo * __type_info__3d8833490ce44a90_arg_types_var_12718489435395503648[1] = { &__type_info__2f75c9939bbea90b };
+VarInfo __struct_info__b08126c18c4eb620_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__3d8833490ce44a90_arg_types_var_12718489435395503648, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x3d8833490ce44a90), "__finalize", 8 };
+VarInfo __struct_info__b08126c18c4eb620_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x85c370960df8537b), "count", 16 };
+VarInfo * __struct_info__b08126c18c4eb620_fields[3] =  { &__struct_info__b08126c18c4eb620_field_0, &__struct_info__b08126c18c4eb620_field_1, &__struct_info__b08126c18c4eb620_field_2 };
+StructInfo __struct_info__b08126c18c4eb620 = {"_lambda_thismodule_18_8_2", "", 6, __struct_info__b08126c18c4eb620_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0xb08126c18c4eb620) };
+TypeInfo * __type_info__b6a668aaf48962be_arg_types_var_18158853590124844069[2] = { &__type_info__e89fa787528fe9fc, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__fc01352167b7d425_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__b6a668aaf48962be_arg_types_var_18158853590124844069, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xb6a668aaf48962be), "__lambda", 0 };
+TypeInfo * __type_info__e05895d9cfcf7e3b_arg_types_var_18158853590124844069[1] = { &__type_info__971e3eabd6eae788 };
+VarInfo __struct_info__fc01352167b7d425_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__e05895d9cfcf7e3b_arg_types_var_18158853590124844069, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xe05895d9cfcf7e3b), "__finalize", 8 };
+VarInfo __struct_info__fc01352167b7d425_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x838c839f665e952), "count", 16 };
+VarInfo * __struct_info__fc01352167b7d425_fields[3] =  { &__struct_info__fc01352167b7d425_field_0, &__struct_info__fc01352167b7d425_field_1, &__struct_info__fc01352167b7d425_field_2 };
+StructInfo __struct_info__fc01352167b7d425 = {"_lambda_thismodule_9_8_1", "", 6, __struct_info__fc01352167b7d425_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0xfc01352167b7d425) };
+TypeInfo __type_info__dfd82b908f3b1490 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 4, UINT64_C(0xdfd82b908f3b1490) };
+TypeInfo __type_info__af63df4c8601f1a5 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf63df4c8601f1a5) };
+TypeInfo __type_info__e89fa787528fe9fc = { Type::tStructure, &__struct_info__fc01352167b7d425, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 24, UINT64_C(0xe89fa787528fe9fc) };
+TypeInfo __type_info__2f75c9939bbea90b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2a0ab836a28a8cb9, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x2f75c9939bbea90b) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__7bf5307b489d850 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0x7bf5307b489d850) };
+TypeInfo __type_info__2a0ab836a28a8cb9 = { Type::tStructure, &__struct_info__b08126c18c4eb620, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 24, UINT64_C(0x2a0ab836a28a8cb9) };
+TypeInfo __type_info__971e3eabd6eae788 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e89fa787528fe9fc, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x971e3eabd6eae788) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Foo; };
+namespace  { struct _lambda_thismodule_9_8_1; };
+namespace  { struct _lambda_thismodule_18_8_2; };
+namespace  {
+
+struct Foo {
+	int32_t value;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,value)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_9_8_1 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_9_8_1,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_9_8_1 *)) __finalize;
+	int32_t count;
+};
+static_assert(sizeof(_lambda_thismodule_9_8_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_8_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_8_1,count)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_18_8_2 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_18_8_2,Foo)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_18_8_2 *)) __finalize;
+	int32_t count;
+};
+static_assert(sizeof(_lambda_thismodule_18_8_2)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_8_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_8_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_8_2,count)==16,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_13087582e4cc4f87 ( Context * __context__, _lambda_thismodule_9_8_1 & ____this_rename_at_9 );
+inline void finalize_93b083cc548a0830 ( Context * __context__, _lambda_thismodule_18_8_2 & ____this_rename_at_18 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_62417db41598dc23 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_480 );
+inline Sequence DAS_COMMENT((Foo)) _Funcbuiltin_0x60_each_f4bdce09e74e2ae9 ( Context * __context__, Lambda DAS_COMMENT((bool,Foo)) const  __lam_rename_at_480 );
+inline bool _Func_lambda_thismodule_9_8_1_0x60_function_e86c0a40d495a685 ( Context * __context__, _lambda_thismodule_9_8_1 & ____this_rename_at_9, int32_t & __a_rename_at_8 );
+inline void _Func_lambda_thismodule_9_8_1_0x60_finalizer_f6d5bde04d9fd14a ( Context * __context__, _lambda_thismodule_9_8_1 * ____this_rename_at_9 );
+inline bool _Func_lambda_thismodule_18_8_2_0x60_function_a16e8f594eeb087d ( Context * __context__, _lambda_thismodule_18_8_2 & ____this_rename_at_18, Foo & __a_rename_at_17 );
+inline void _Func_lambda_thismodule_18_8_2_0x60_finalizer_fa8f8cf3a50583be ( Context * __context__, _lambda_thismodule_18_8_2 * ____this_rename_at_18 );
+inline bool test_66f5df210ea4917a ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_13087582e4cc4f87 ( Context * __context__, _lambda_thismodule_9_8_1 &  ____this_rename_at_9 )
+{
+	memset(&(____this_rename_at_9), 0, 24);
+}
+
+inline void finalize_93b083cc548a0830 ( Context * __context__, _lambda_thismodule_18_8_2 &  ____this_rename_at_18 )
+{
+	memset(&(____this_rename_at_18), 0, 24);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_62417db41598dc23 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_480 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_482; das_zero(__it_rename_at_482);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_482),__lam_rename_at_480,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_482);
+}
+
+inline Sequence DAS_COMMENT((Foo)) _Funcbuiltin_0x60_each_f4bdce09e74e2ae9 ( Context * __context__, Lambda DAS_COMMENT((bool,Foo)) const  __lam_rename_at_480 )
+{
+	Sequence DAS_COMMENT((Foo)) __it_rename_at_482; das_zero(__it_rename_at_482);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((Foo))>::pass(__it_rename_at_482),__lam_rename_at_480,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((Foo))>::cast(__it_rename_at_482);
+}
+
+inline bool _Func_lambda_thismodule_9_8_1_0x60_function_e86c0a40d495a685 ( Context * __context__, _lambda_thismodule_9_8_1 &  ____this_rename_at_9, int32_t & __a_rename_at_8 )
+{
+	if ( ____this_rename_at_9.count < 10 )
+	{
+		das_copy(__a_rename_at_8,____this_rename_at_9.count++);
+		return das_auto_cast<bool>::cast(true);
+	} else {
+		return das_auto_cast<bool>::cast(false);
+	};
+}
+
+inline void _Func_lambda_thismodule_9_8_1_0x60_finalizer_f6d5bde04d9fd14a ( Context * __context__, _lambda_thismodule_9_8_1 * ____this_rename_at_9 )
+{
+	finalize_13087582e4cc4f87(__context__,das_arg<_lambda_thismodule_9_8_1>::pass(das_deref(__context__,____this_rename_at_9)));
+	das_delete_lambda_struct<_lambda_thismodule_9_8_1 *>::clear(__context__,____this_rename_at_9);
+}
+
+inline bool _Func_lambda_thismodule_18_8_2_0x60_function_a16e8f594eeb087d ( Context * __context__, _lambda_thismodule_18_8_2 &  ____this_rename_at_18, Foo &  __a_rename_at_17 )
+{
+	if ( ____this_rename_at_18.count < 10 )
+	{
+		das_copy(__a_rename_at_17.value,____this_rename_at_18.count++);
+		return das_auto_cast<bool>::cast(true);
+	} else {
+		return das_auto_cast<bool>::cast(false);
+	};
+}
+
+inline void _Func_lambda_thismodule_18_8_2_0x60_finalizer_fa8f8cf3a50583be ( Context * __context__, _lambda_thismodule_18_8_2 * ____this_rename_at_18 )
+{
+	finalize_93b083cc548a0830(__context__,das_arg<_lambda_thismodule_18_8_2>::pass(das_deref(__context__,____this_rename_at_18)));
+	das_delete_lambda_struct<_lambda_thismodule_18_8_2 *>::clear(__context__,____this_rename_at_18);
+}
+
+inline bool test_66f5df210ea4917a ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_14_64;
+	Sequence DAS_COMMENT((Foo)) _temp_make_local_23_144;
+	Lambda DAS_COMMENT((bool,int32_t &)) __lam_rename_at_8; das_zero(__lam_rename_at_8); das_move(__lam_rename_at_8, ((Lambda DAS_COMMENT((bool,int32_t &)))das_ascend<bool,_lambda_thismodule_9_8_1>::make(__context__,&__type_info__e89fa787528fe9fc,(([&]() -> _lambda_thismodule_9_8_1 {
+		_lambda_thismodule_9_8_1 __mks_9;
+		das_copy((__mks_9.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_9_8_1`function XS<::_lambda_thismodule_9_8_1> &i*/ 16778137049376230579u))));
+		das_copy((__mks_9.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_9_8_1`finalizer X1<S<::_lambda_thismodule_9_8_1>>?*/ 13776629878738028112u))));
+		das_copy((__mks_9.count),(0));
+		return __mks_9;
+	})()))));
+	{
+		bool __need_loop_14 = true;
+		// x : int
+		das_iterator<Sequence DAS_COMMENT((int32_t))> __x_iterator((_temp_make_local_14_64 = (_Funcbuiltin_0x60_each_62417db41598dc23(__context__,__lam_rename_at_8))));
+		int32_t __x_rename_at_14;
+		__need_loop_14 = __x_iterator.first(__context__,(__x_rename_at_14)) && __need_loop_14;
+		// tx : int const
+		das_iterator<range> __tx_iterator(range(0,10));
+		int32_t __tx_rename_at_14;
+		__need_loop_14 = __tx_iterator.first(__context__,(__tx_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __x_iterator.next(__context__,(__x_rename_at_14)) && __tx_iterator.next(__context__,(__tx_rename_at_14)) )
+		{
+			DAS_ASSERT((__x_rename_at_14 == __tx_rename_at_14));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_14));
+		__tx_iterator.close(__context__,(__tx_rename_at_14));
+	};
+	Lambda DAS_COMMENT((bool,Foo)) __lamF_rename_at_17; das_zero(__lamF_rename_at_17); das_move(__lamF_rename_at_17, ((Lambda DAS_COMMENT((bool,Foo)))das_ascend<bool,_lambda_thismodule_18_8_2>::make(__context__,&__type_info__2a0ab836a28a8cb9,(([&]() -> _lambda_thismodule_18_8_2 {
+		_lambda_thismodule_18_8_2 __mks_18;
+		das_copy((__mks_18.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_18_8_2`function XS<::_lambda_thismodule_18_8_2> S<::Foo>*/ 8501376358882319169u))));
+		das_copy((__mks_18.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_18_8_2`finalizer X1<S<::_lambda_thismodule_18_8_2>>?*/ 9135440238521105446u))));
+		das_copy((__mks_18.count),(0));
+		return __mks_18;
+	})()))));
+	{
+		bool __need_loop_23 = true;
+		// y : Foo
+		das_iterator<Sequence DAS_COMMENT((Foo))> __y_iterator((_temp_make_local_23_144 = (_Funcbuiltin_0x60_each_f4bdce09e74e2ae9(__context__,__lamF_rename_at_17))));
+		Foo __y_rename_at_23;
+		__need_loop_23 = __y_iterator.first(__context__,(__y_rename_at_23)) && __need_loop_23;
+		// ty : int const
+		das_iterator<range> __ty_iterator(range(0,10));
+		int32_t __ty_rename_at_23;
+		__need_loop_23 = __ty_iterator.first(__context__,(__ty_rename_at_23)) && __need_loop_23;
+		for ( ; __need_loop_23 ; __need_loop_23 = __y_iterator.next(__context__,(__y_rename_at_23)) && __ty_iterator.next(__context__,(__ty_rename_at_23)) )
+		{
+			DAS_ASSERT((__y_rename_at_23.value == __ty_rename_at_23));
+		}
+		__y_iterator.close(__context__,(__y_rename_at_23));
+		__ty_iterator.close(__context__,(__ty_rename_at_23));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_13087582e4cc4f87
+	aotLib[0x9eea27f0463e7d71] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_9_8_1 &  ),&finalize_13087582e4cc4f87>>();
+	};
+	// finalize_93b083cc548a0830
+	aotLib[0x8c6dbd1f6085d855] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_18_8_2 &  ),&finalize_93b083cc548a0830>>();
+	};
+	// _Funcbuiltin_0x60_each_62417db41598dc23
+	aotLib[0xc4ecfe78d3c3d325] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_62417db41598dc23>>();
+	};
+	// _Funcbuiltin_0x60_each_f4bdce09e74e2ae9
+	aotLib[0xdfc2e102dbddc6a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((Foo)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,Foo)) const   ),&_Funcbuiltin_0x60_each_f4bdce09e74e2ae9>>();
+	};
+	// _Func_lambda_thismodule_9_8_1_0x60_function_e86c0a40d495a685
+	aotLib[0xe21ee48c4236e245] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_9_8_1 & , int32_t &  ),&_Func_lambda_thismodule_9_8_1_0x60_function_e86c0a40d495a685>>();
+	};
+	// _Func_lambda_thismodule_9_8_1_0x60_finalizer_f6d5bde04d9fd14a
+	aotLib[0x57bf1b680ee7ce07] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_9_8_1 *  ),&_Func_lambda_thismodule_9_8_1_0x60_finalizer_f6d5bde04d9fd14a>>();
+	};
+	// _Func_lambda_thismodule_18_8_2_0x60_function_a16e8f594eeb087d
+	aotLib[0xc3c0ac3ad3d58295] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_18_8_2 & , Foo &  ),&_Func_lambda_thismodule_18_8_2_0x60_function_a16e8f594eeb087d>>();
+	};
+	// _Func_lambda_thismodule_18_8_2_0x60_finalizer_fa8f8cf3a50583be
+	aotLib[0xd53f27562ee58c27] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_18_8_2 *  ),&_Func_lambda_thismodule_18_8_2_0x60_finalizer_fa8f8cf3a50583be>>();
+	};
+	// test_66f5df210ea4917a
+	aotLib[0xb9a76caa381068dc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_66f5df210ea4917a>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
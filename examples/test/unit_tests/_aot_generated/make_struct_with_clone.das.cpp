@@ -0,0 +1,249 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_398701858841431669 {
+
+extern TypeInfo __type_info__b9a1419aa578516;
+extern TypeInfo __type_info__f95678735cf0e442;
+extern TypeInfo __type_info__90f5707b5a6f641;
+
+TypeInfo __type_info__b9a1419aa578516 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16548, 8, UINT64_C(0xb9a1419aa578516) };
+TypeInfo __type_info__f95678735cf0e442 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 40, UINT64_C(0xf95678735cf0e442) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__f95678735cf0e442.resolveAnnotation();
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__f95678735cf0e442, &__type_info__b9a1419aa578516 };
+TypeInfo * __tinfo_1[2] = { &__type_info__f95678735cf0e442, &__type_info__90f5707b5a6f641 };
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+	TArray<int32_t> a;
+	char * b;
+};
+static_assert(sizeof(Foo)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==24,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> & __a_rename_at_338, TArray<int32_t> const  & __b_rename_at_338 );
+inline char * const  _Funcstrings_boost_0x60_join_7b3a02b54a3db2df ( Context * __context__, TArray<int32_t> const  & __it_rename_at_18, char * const  __separator_rename_at_18 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_adf8841f5d461f64 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_518 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48 ( Context * __context__, TDim<int32_t,3> & __a_rename_at_518 );
+inline bool test_361e2152403c0ff3 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> &  __a_rename_at_338, TArray<int32_t> const  &  __b_rename_at_338 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_338),builtin_array_size(__b_rename_at_338));
+	{
+		bool __need_loop_340 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_338);
+		int32_t * __aV_rename_at_340;
+		__need_loop_340 = __aV_iterator.first(__context__,(__aV_rename_at_340)) && __need_loop_340;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_338);
+		int32_t const  * __bV_rename_at_340;
+		__need_loop_340 = __bV_iterator.first(__context__,(__bV_rename_at_340)) && __need_loop_340;
+		for ( ; __need_loop_340 ; __need_loop_340 = __aV_iterator.next(__context__,(__aV_rename_at_340)) && __bV_iterator.next(__context__,(__bV_rename_at_340)) )
+		{
+			das_copy((*__aV_rename_at_340),(*__bV_rename_at_340));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_340));
+		__bV_iterator.close(__context__,(__bV_rename_at_340));
+	};
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_7b3a02b54a3db2df ( Context * __context__, TArray<int32_t> const  &  __it_rename_at_18, char * const  __separator_rename_at_18 )
+{
+	char * __st_rename_at_23 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_23)->void{
+		bool __skip_first_rename_at_24 = true;
+		{
+			bool __need_loop_25 = true;
+			// elem : int const&
+			das_iterator<TArray<int32_t> const > __elem_iterator(__it_rename_at_18);
+			int32_t const  * __elem_rename_at_25;
+			__need_loop_25 = __elem_iterator.first(__context__,(__elem_rename_at_25)) && __need_loop_25;
+			for ( ; __need_loop_25 ; __need_loop_25 = __elem_iterator.next(__context__,(__elem_rename_at_25)) )
+			{
+				if ( __skip_first_rename_at_24 )
+				{
+					das_copy(__skip_first_rename_at_24,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_23),cast<char * const >::from(__separator_rename_at_18)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_23),cast<int32_t>::from((*__elem_rename_at_25))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_25));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_23);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_adf8841f5d461f64 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_518 )
+{
+	TArray<int32_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_519),4);
+	das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_519);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48 ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_518 )
+{
+	TArray<int32_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_519),3);
+	das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_519);
+}
+
+inline bool test_361e2152403c0ff3 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,448,"test " DAS_FILE_LINE);
+{
+	TDim<int32_t,4> _temp_make_local_9_64;
+	TDim<int32_t,3> _temp_make_local_10_112;
+	TArray<int32_t> __sa_rename_at_9_ConstRef; das_zero(__sa_rename_at_9_ConstRef); das_move(__sa_rename_at_9_ConstRef, ((TArray<int32_t>)_Funcbuiltin_0x60_to_array_move_adf8841f5d461f64(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_9_64(0,__context__) = 1;
+		_temp_make_local_9_64(1,__context__) = 2;
+		_temp_make_local_9_64(2,__context__) = 3;
+		_temp_make_local_9_64(3,__context__) = 4;
+		return _temp_make_local_9_64;
+	})())))));
+	TArray<int32_t> const  & __sa_rename_at_9 = __sa_rename_at_9_ConstRef; ;
+	TArray<int32_t> __sb_rename_at_10_ConstRef; das_zero(__sb_rename_at_10_ConstRef); das_move(__sb_rename_at_10_ConstRef, ((TArray<int32_t>)_Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+		_temp_make_local_10_112(0,__context__) = 1;
+		_temp_make_local_10_112(1,__context__) = 2;
+		_temp_make_local_10_112(2,__context__) = 3;
+		return _temp_make_local_10_112;
+	})())))));
+	TArray<int32_t> const  & __sb_rename_at_10 = __sb_rename_at_10_ConstRef; ;
+	Foo __fa_rename_at_11_ConstRef; das_zero(__fa_rename_at_11_ConstRef); das_move(__fa_rename_at_11_ConstRef, ((Foo)(([&]() -> Foo {
+		Foo __mks_11;
+		das_zero(__mks_11);
+		{
+			_Funcbuiltin_0x60_clone_7775f70b42a34990(__context__,das_arg<TArray<int32_t>>::pass(__mks_11.a),__sa_rename_at_9);
+		}		return __mks_11;
+	})())));
+	Foo const  & __fa_rename_at_11 = __fa_rename_at_11_ConstRef; ;
+	TDim<Foo,2> __fa2_rename_at_12_ConstRef; das_zero(__fa2_rename_at_12_ConstRef); das_move(__fa2_rename_at_12_ConstRef, ((TDim<Foo,2>)(([&]() -> TDim<Foo,2> {
+		TDim<Foo,2> __mks_12;
+		das_zero(__mks_12);
+		{
+			_Funcbuiltin_0x60_clone_7775f70b42a34990(__context__,das_arg<TArray<int32_t>>::pass(__mks_12(1,__context__).a),__sb_rename_at_10);
+			_Funcbuiltin_0x60_clone_7775f70b42a34990(__context__,das_arg<TArray<int32_t>>::pass(__mks_12(0,__context__).a),__sa_rename_at_9);
+		}		return __mks_12;
+	})())));
+	TDim<Foo,2> const  & __fa2_rename_at_12 = __fa2_rename_at_12_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__sa_rename_at_9) == 4));
+	DAS_ASSERT((builtin_array_size(__fa_rename_at_11.a) == 4));
+	DAS_ASSERT((builtin_array_size(__fa2_rename_at_12(0,__context__).a) == 4));
+	DAS_ASSERT((builtin_array_size(__fa2_rename_at_12(1,__context__).a) == 3));
+	Foo __faw_rename_at_17_ConstRef; das_zero(__faw_rename_at_17_ConstRef); das_move(__faw_rename_at_17_ConstRef, ((Foo)(([&]() -> Foo {
+		Foo __mks_17;
+		das_zero(__mks_17);
+		das_copy((__mks_17.b),(((char *) "a is ")));
+		{
+			_Funcbuiltin_0x60_clone_7775f70b42a34990(__context__,das_arg<TArray<int32_t>>::pass(__mks_17.a),__sa_rename_at_9);
+			SimPolicy<char *>::SetAdd((char *)&(__mks_17.b),cast<char *>::from(_Funcstrings_boost_0x60_join_7b3a02b54a3db2df(__context__,das_arg<TArray<int32_t>>::pass(__mks_17.a),((char *) "-"))),*__context__,nullptr);
+		}		return __mks_17;
+	})())));
+	Foo const  & __faw_rename_at_17 = __faw_rename_at_17_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__faw_rename_at_17.a) == 4));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__faw_rename_at_17.b),cast<char *>::from(((char *) "a is 1-2-3-4")),*__context__,nullptr)));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_clone_7775f70b42a34990
+	aotLib[0xbde965effb9cac8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_7775f70b42a34990>>();
+	};
+	// _Funcstrings_boost_0x60_join_7b3a02b54a3db2df
+	aotLib[0xc763f8a334813dc1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TArray<int32_t> const  & , char * const   ),&_Funcstrings_boost_0x60_join_7b3a02b54a3db2df>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_adf8841f5d461f64
+	aotLib[0x36c5b0e8a702b305] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_adf8841f5d461f64>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48
+	aotLib[0xae43369ad2ed6a9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48>>();
+	};
+	// test_361e2152403c0ff3
+	aotLib[0x7df2428b5b2cd5f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_361e2152403c0ff3>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
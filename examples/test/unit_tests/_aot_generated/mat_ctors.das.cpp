@@ -0,0 +1,286 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7355114952034546762 {
+
+extern TypeInfo __type_info__6475ee615df78d95;
+
+TypeInfo __type_info__6475ee615df78d95 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~math::float4x4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 286, 64, UINT64_C(0x6475ee615df78d95) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__6475ee615df78d95.resolveAnnotation();
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__6475ee615df78d95 };
+TypeInfo * __tinfo_1[1] = { &__type_info__6475ee615df78d95 };
+
+inline int32_t _Func_0x60_passx_85f26f5ae4622040 ( Context * __context__, int32_t __a_rename_at_58 );
+inline void _Func_0x60_test_any_8443bda039cb0dea ( Context * __context__, float4x4 & __t_rename_at_61 );
+inline void _Func_0x60_test_any_f82cce299919163b ( Context * __context__, float3x4 & __t_rename_at_61 );
+inline void test_4x4_ffc2e66e7680f5f ( Context * __context__ );
+inline bool test_r2v_78f0e2655969aaad ( Context * __context__ );
+inline bool test_1368b7eed393c555 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t _Func_0x60_passx_85f26f5ae4622040 ( Context * __context__, int32_t __a_rename_at_58 )
+{
+	return das_auto_cast<int32_t>::cast(__a_rename_at_58);
+}
+
+inline void _Func_0x60_test_any_8443bda039cb0dea ( Context * __context__, float4x4 &  __t_rename_at_61 )
+{
+	float4x4_identity(das_arg<float4x4>::pass(__t_rename_at_61));
+	{
+		bool __need_loop_67 = true;
+		// r : int const
+		das_iterator<range> __r_iterator(range(0,4));
+		int32_t __r_rename_at_67;
+		__need_loop_67 = __r_iterator.first(__context__,(__r_rename_at_67)) && __need_loop_67;
+		for ( ; __need_loop_67 ; __need_loop_67 = __r_iterator.next(__context__,(__r_rename_at_67)) )
+		{
+			das_copy(das_index<float4x4>::at(__t_rename_at_61,__r_rename_at_67,__context__),v_splats(__r_rename_at_67));
+		}
+		__r_iterator.close(__context__,(__r_rename_at_67));
+	};
+	{
+		bool __need_loop_70 = true;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,4));
+		int32_t __y_rename_at_70;
+		__need_loop_70 = __y_iterator.first(__context__,(__y_rename_at_70)) && __need_loop_70;
+		for ( ; __need_loop_70 ; __need_loop_70 = __y_iterator.next(__context__,(__y_rename_at_70)) )
+		{
+			{
+				bool __need_loop_71 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,4));
+				int32_t __x_rename_at_71;
+				__need_loop_71 = __x_iterator.first(__context__,(__x_rename_at_71)) && __need_loop_71;
+				for ( ; __need_loop_71 ; __need_loop_71 = __x_iterator.next(__context__,(__x_rename_at_71)) )
+				{
+					das_copy(das_index<float4>::at(das_index<float4x4>::at(__t_rename_at_61,__y_rename_at_70,__context__),__x_rename_at_71,__context__),(__x_rename_at_71 == __y_rename_at_70) ? das_auto_cast<float>::cast(1.f) : das_auto_cast<float>::cast(0.f));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_71));
+			};
+		}
+		__y_iterator.close(__context__,(__y_rename_at_70));
+	};
+	bool __ops_rename_at_74 = false;
+	das_try_recover(__context__, [&]()
+	{
+		das_copy(das_index<float4x4>::at(__t_rename_at_61,_Func_0x60_passx_85f26f5ae4622040(__context__,4),__context__),v_zero());
+	}, [&]()
+	{
+		das_copy(__ops_rename_at_74,true);
+	});
+	DAS_ASSERT((__ops_rename_at_74));
+}
+
+inline void _Func_0x60_test_any_f82cce299919163b ( Context * __context__, float3x4 &  __t_rename_at_61 )
+{
+	float3x4_identity(das_arg<float3x4>::pass(__t_rename_at_61));
+	{
+		bool __need_loop_67 = true;
+		// r : int const
+		das_iterator<range> __r_iterator(range(0,4));
+		int32_t __r_rename_at_67;
+		__need_loop_67 = __r_iterator.first(__context__,(__r_rename_at_67)) && __need_loop_67;
+		for ( ; __need_loop_67 ; __need_loop_67 = __r_iterator.next(__context__,(__r_rename_at_67)) )
+		{
+			das_copy(das_index<float3x4>::at(__t_rename_at_61,__r_rename_at_67,__context__),v_splats(__r_rename_at_67));
+		}
+		__r_iterator.close(__context__,(__r_rename_at_67));
+	};
+	{
+		bool __need_loop_70 = true;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,4));
+		int32_t __y_rename_at_70;
+		__need_loop_70 = __y_iterator.first(__context__,(__y_rename_at_70)) && __need_loop_70;
+		for ( ; __need_loop_70 ; __need_loop_70 = __y_iterator.next(__context__,(__y_rename_at_70)) )
+		{
+			{
+				bool __need_loop_71 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,3));
+				int32_t __x_rename_at_71;
+				__need_loop_71 = __x_iterator.first(__context__,(__x_rename_at_71)) && __need_loop_71;
+				for ( ; __need_loop_71 ; __need_loop_71 = __x_iterator.next(__context__,(__x_rename_at_71)) )
+				{
+					das_copy(das_index<float3>::at(das_index<float3x4>::at(__t_rename_at_61,__y_rename_at_70,__context__),__x_rename_at_71,__context__),(__x_rename_at_71 == __y_rename_at_70) ? das_auto_cast<float>::cast(1.f) : das_auto_cast<float>::cast(0.f));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_71));
+			};
+		}
+		__y_iterator.close(__context__,(__y_rename_at_70));
+	};
+	bool __ops_rename_at_74 = false;
+	das_try_recover(__context__, [&]()
+	{
+		das_copy(das_index<float3x4>::at(__t_rename_at_61,_Func_0x60_passx_85f26f5ae4622040(__context__,4),__context__),v_zero());
+	}, [&]()
+	{
+		das_copy(__ops_rename_at_74,true);
+	});
+	DAS_ASSERT((__ops_rename_at_74));
+}
+
+inline void test_4x4_ffc2e66e7680f5f ( Context * __context__ )
+{
+	float4x4 __t_rename_at_31; das_zero(__t_rename_at_31);
+	das_copy(das_index<float4x4>::at(__t_rename_at_31,0,__context__),v_make_vec4f(1.f,2.f,3.f,4.f));
+	das_copy(das_index<float4x4>::at(__t_rename_at_31,1,__context__),v_make_vec4f(5.f,6.f,7.f,8.f));
+	das_copy(das_index<float4x4>::at(__t_rename_at_31,2,__context__),v_make_vec4f(9.f,10.f,11.f,12.f));
+	das_copy(das_index<float4x4>::at(__t_rename_at_31,3,__context__),v_make_vec4f(13.f,14.f,15.f,16.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float4x4 &>::from(__t_rename_at_31)))),cast<char *>::from(((char *) "[[ 1,2,3,4; 5,6,7,8; 9,10,11,12; 13,14,15,16]]")),*__context__,nullptr)));
+	{
+		bool __need_loop_38 = true;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,4));
+		int32_t __y_rename_at_38;
+		__need_loop_38 = __y_iterator.first(__context__,(__y_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __y_iterator.next(__context__,(__y_rename_at_38)) )
+		{
+			{
+				bool __need_loop_39 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,4));
+				int32_t __x_rename_at_39;
+				__need_loop_39 = __x_iterator.first(__context__,(__x_rename_at_39)) && __need_loop_39;
+				for ( ; __need_loop_39 ; __need_loop_39 = __x_iterator.next(__context__,(__x_rename_at_39)) )
+				{
+					das_copy(das_index<float4>::at(das_index<float4x4>::at(__t_rename_at_31,__y_rename_at_38,__context__),__x_rename_at_39,__context__),(__x_rename_at_39 == __y_rename_at_38) ? das_auto_cast<float>::cast(1.f) : das_auto_cast<float>::cast(0.f));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_39));
+			};
+		}
+		__y_iterator.close(__context__,(__y_rename_at_38));
+	};
+	das_copy(__t_rename_at_31.m[0] /*x*/,v_make_vec4f(1.f,2.f,3.f,4.f));
+	das_copy(__t_rename_at_31.m[1] /*y*/,v_make_vec4f(5.f,6.f,7.f,8.f));
+	das_copy(__t_rename_at_31.m[2] /*z*/,v_make_vec4f(9.f,10.f,11.f,12.f));
+	das_copy(__t_rename_at_31.m[3] /*w*/,v_make_vec4f(13.f,14.f,15.f,16.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<float4x4 &>::from(__t_rename_at_31)))),cast<char *>::from(((char *) "[[ 1,2,3,4; 5,6,7,8; 9,10,11,12; 13,14,15,16]]")),*__context__,nullptr)));
+	float4x4_identity(das_arg<float4x4>::pass(__t_rename_at_31));
+	bool __ops_rename_at_50 = false;
+	das_try_recover(__context__, [&]()
+	{
+		das_copy(das_index<float4x4>::at(__t_rename_at_31,_Func_0x60_passx_85f26f5ae4622040(__context__,4),__context__),v_zero());
+	}, [&]()
+	{
+		das_copy(__ops_rename_at_50,true);
+	});
+	DAS_ASSERT((__ops_rename_at_50));
+}
+
+inline bool test_r2v_78f0e2655969aaad ( Context * __context__ )
+{
+	float4x4 __m_rename_at_83; das_zero(__m_rename_at_83);
+	das_copy(das_index<float4x4>::at(__m_rename_at_83,0,__context__),v_make_vec4f(1.f,2.f,3.f,4.f));
+	das_copy(das_swizzle_ref<float,float4,1>::swizzle(das_index<float4x4>::at(__m_rename_at_83,1,__context__)) /*y*/,6.f);
+	das_copy(das_index<float4x4>::at(__m_rename_at_83,2,__context__),v_make_vec4f(5.f,6.f,7.f,8.f));
+	das_copy(__m_rename_at_83.m[3] /*w*/,v_make_vec4f(9.f,10.f,11.f,12.f));
+	das_copy(das_swizzle_ref<float,float4,2>::swizzle(__m_rename_at_83.m[3] /*w*/) /*z*/,111.f);
+	DAS_ASSERT((SimPolicy<float4>::Equ(das_index<float4x4>::at(__m_rename_at_83,0,__context__),v_make_vec4f(1.f,2.f,3.f,4.f),*__context__,nullptr)));
+	DAS_ASSERT((v_extract_y(das_index<float4x4>::at(__m_rename_at_83,1,__context__)) /*y*/ == 6.f));
+	DAS_ASSERT((SimPolicy<float4>::Equ(das_index<float4x4>::at(__m_rename_at_83,1,__context__),v_make_vec4f(0.f,6.f,0.f,0.f),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<float4>::Equ(das_index<float4x4>::at(__m_rename_at_83,2,__context__),v_make_vec4f(5.f,6.f,7.f,8.f),*__context__,nullptr)));
+	DAS_ASSERT((v_extract_z(__m_rename_at_83.m[3] /*w*/) /*z*/ == 111.f));
+	DAS_ASSERT((SimPolicy<float4>::Equ(__m_rename_at_83.m[3] /*w*/,v_make_vec4f(9.f,10.f,111.f,12.f),*__context__,nullptr)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_1368b7eed393c555 ( Context * __context__ )
+{
+	float4x4 _temp_make_local_101_32;
+	float3x4 _temp_make_local_102_96;
+	test_r2v_78f0e2655969aaad(__context__);
+	test_4x4_ffc2e66e7680f5f(__context__);
+	_Func_0x60_test_any_8443bda039cb0dea(__context__,das_arg<float4x4>::pass((_temp_make_local_101_32 = (/*c-tor*/ float4x4(/*end-c-tor*/)))));
+	_Func_0x60_test_any_f82cce299919163b(__context__,das_arg<float3x4>::pass((_temp_make_local_102_96 = (/*c-tor*/ float3x4(/*end-c-tor*/)))));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_passx_85f26f5ae4622040
+	aotLib[0x3d262f71f19bed45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_passx_85f26f5ae4622040>>();
+	};
+	// _Func_0x60_test_any_8443bda039cb0dea
+	aotLib[0xeb5fa6d075ad53e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float4x4 &  ),&_Func_0x60_test_any_8443bda039cb0dea>>();
+	};
+	// _Func_0x60_test_any_f82cce299919163b
+	aotLib[0xee6a17307125441d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float3x4 &  ),&_Func_0x60_test_any_f82cce299919163b>>();
+	};
+	// test_4x4_ffc2e66e7680f5f
+	aotLib[0xe2676113a5548839] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_4x4_ffc2e66e7680f5f>>();
+	};
+	// test_r2v_78f0e2655969aaad
+	aotLib[0xa015f4d556ef7409] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_r2v_78f0e2655969aaad>>();
+	};
+	// test_1368b7eed393c555
+	aotLib[0xf17d144322a975dc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_1368b7eed393c555>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,462 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_16459700225401903444 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__af63e44c8601fa24 };
+TypeInfo * __tinfo_1[2] = { &__type_info__af63e44c8601fa24, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_2[2] = { &__type_info__af63e44c8601fa24, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_3[2] = { &__type_info__af63e44c8601fa24, &__type_info__90f3d07b5a6ca13 };
+namespace  { struct SomethingSmall; };
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct SomethingSmall {
+	int32_t a;
+	int32_t b;
+	int32_t c;
+};
+static_assert(sizeof(SomethingSmall)==12,"structure size mismatch with DAS");
+static_assert(offsetof(SomethingSmall,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SomethingSmall,b)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(SomethingSmall,c)==8,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_399 );
+inline void finalize_36072647358759e2 ( Context * __context__, SomethingSmall & ____this_rename_at_9 );
+inline void _Funcbuiltin_0x60_finalize_dim_f30117ee130dd0d1 ( Context * __context__, TDim<TArray<int32_t>,5> & __a_rename_at_391 );
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_406 );
+inline void _Funcbuiltin_0x60_finalize_dim_936299d196c72523 ( Context * __context__, TDim<SomethingSmall *,10> & __a_rename_at_391 );
+inline void _Funcbuiltin_0x60_finalize_dim_e5ae447d433db26c ( Context * __context__, TDim<TestObjectFoo *,10> & __a_rename_at_391 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void finalize_7c102b827992dd63 ( Context * __context__, SomethingSmall * & ____this_rename_at_41 );
+inline void _Func_0x60_da_inscope_8c50c2639a67d5c5 ( Context * __context__, int32_t __x_rename_at_72 );
+inline void test_delete_array_fbfe7d3935e6f893 ( Context * __context__ );
+inline void test_delete_table_1a5e156f3fee8fd1 ( Context * __context__ );
+inline void test_delete_struct_9cad1733953baebc ( Context * __context__ );
+inline void test_delete_struct_array_ed9ed5a5e75e971d ( Context * __context__ );
+inline void test_delete_handle_87fccf1fed12f54f ( Context * __context__ );
+inline void test_delete_handle_array_4e6f6288478f5b98 ( Context * __context__ );
+inline void test_delete_struct_array_in_scope_b7b2e8b39002e5e7 ( Context * __context__ );
+inline void test_delete_string_688fda081f00c9e6 ( Context * __context__ );
+inline void test_delete_string_array_99d11d499795e0c0 ( Context * __context__ );
+inline bool test_3e3887bf9fa67f93 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_399 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_399),4,__context__);
+}
+
+inline void finalize_36072647358759e2 ( Context * __context__, SomethingSmall &  ____this_rename_at_9 )
+{
+	memset(&(____this_rename_at_9), 0, 12);
+}
+
+inline void _Funcbuiltin_0x60_finalize_dim_f30117ee130dd0d1 ( Context * __context__, TDim<TArray<int32_t>,5> &  __a_rename_at_391 )
+{
+	{
+		bool __need_loop_393 = true;
+		// aV : array<int> aka TT&
+		das_iterator<TDim<TArray<int32_t>,5>> __aV_iterator(__a_rename_at_391);
+		TArray<int32_t> * __aV_rename_at_393;
+		__need_loop_393 = __aV_iterator.first(__context__,(__aV_rename_at_393)) && __need_loop_393;
+		for ( ; __need_loop_393 ; __need_loop_393 = __aV_iterator.next(__context__,(__aV_rename_at_393)) )
+		{
+			_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass((*__aV_rename_at_393)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_393));
+	};
+}
+
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_406 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_406),4,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_dim_936299d196c72523 ( Context * __context__, TDim<SomethingSmall *,10> &  __a_rename_at_391 )
+{
+	{
+		bool __need_loop_393 = true;
+		// aV : SomethingSmall? aka TT&
+		das_iterator<TDim<SomethingSmall *,10>> __aV_iterator(__a_rename_at_391);
+		SomethingSmall * * __aV_rename_at_393;
+		__need_loop_393 = __aV_iterator.first(__context__,(__aV_rename_at_393)) && __need_loop_393;
+		for ( ; __need_loop_393 ; __need_loop_393 = __aV_iterator.next(__context__,(__aV_rename_at_393)) )
+		{
+			finalize_7c102b827992dd63(__context__,(*__aV_rename_at_393));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_393));
+	};
+}
+
+inline void _Funcbuiltin_0x60_finalize_dim_e5ae447d433db26c ( Context * __context__, TDim<TestObjectFoo *,10> &  __a_rename_at_391 )
+{
+	{
+		bool __need_loop_393 = true;
+		// aV : UnitTest::TestObjectFoo? aka TT&
+		das_iterator<TDim<TestObjectFoo *,10>> __aV_iterator(__a_rename_at_391);
+		TestObjectFoo * * __aV_rename_at_393;
+		__need_loop_393 = __aV_iterator.first(__context__,(__aV_rename_at_393)) && __need_loop_393;
+		for ( ; __need_loop_393 ; __need_loop_393 = __aV_iterator.next(__context__,(__aV_rename_at_393)) )
+		{
+			das_delete_handle<TestObjectFoo *>::clear(__context__,(*__aV_rename_at_393));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_393));
+	};
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void finalize_7c102b827992dd63 ( Context * __context__, SomethingSmall * & ____this_rename_at_41 )
+{
+	if ( ____this_rename_at_41 != nullptr )
+	{
+		finalize_36072647358759e2(__context__,das_arg<SomethingSmall>::pass(das_deref(__context__,____this_rename_at_41)));
+		das_delete<SomethingSmall *>::clear(__context__,____this_rename_at_41);
+		das_copy(____this_rename_at_41,nullptr);
+	};
+}
+
+inline void _Func_0x60_da_inscope_8c50c2639a67d5c5 ( Context * __context__, int32_t __x_rename_at_72 )
+{
+	SomethingSmall * __b_rename_at_73; memset(&__b_rename_at_73,0,sizeof(__b_rename_at_73));
+	TDim<SomethingSmall *,10> __a_rename_at_74; memset(&__a_rename_at_74,0,sizeof(__a_rename_at_74));
+/* finally */ auto __finally_73= das_finally([&](){
+	_Funcbuiltin_0x60_finalize_dim_936299d196c72523(__context__,das_arg<TDim<SomethingSmall *,10>>::pass(__a_rename_at_74));
+	finalize_7c102b827992dd63(__context__,__b_rename_at_73);
+/* end finally */ });
+	__b_rename_at_73 = das_new<SomethingSmall>::make(__context__);
+	__a_rename_at_74 = das_new_dim<SomethingSmall,10>::make(__context__);
+	das_copy(__b_rename_at_73->a,__x_rename_at_72);
+	{
+		bool __need_loop_76 = true;
+		// pA : SomethingSmall?&
+		das_iterator<TDim<SomethingSmall *,10>> __pA_iterator(__a_rename_at_74);
+		SomethingSmall * * __pA_rename_at_76;
+		__need_loop_76 = __pA_iterator.first(__context__,(__pA_rename_at_76)) && __need_loop_76;
+		for ( ; __need_loop_76 ; __need_loop_76 = __pA_iterator.next(__context__,(__pA_rename_at_76)) )
+		{
+			das_copy((*__pA_rename_at_76)->a,__x_rename_at_72);
+		}
+		__pA_iterator.close(__context__,(__pA_rename_at_76));
+	};
+}
+
+inline void test_delete_array_fbfe7d3935e6f893 ( Context * __context__ )
+{
+	TDim<TArray<int32_t>,5> __a_rename_at_13; das_zero(__a_rename_at_13);
+	uint64_t __w0_rename_at_14 = ((uint64_t)heap_bytes_allocated(__context__));
+	{
+		bool __need_loop_15 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,5));
+		int32_t __t_rename_at_15;
+		__need_loop_15 = __t_iterator.first(__context__,(__t_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __t_iterator.next(__context__,(__t_rename_at_15)) )
+		{
+			_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_13(__t_rename_at_15,__context__)),10);
+		}
+		__t_iterator.close(__context__,(__t_rename_at_15));
+	};
+	uint64_t __w1_rename_at_17 = ((uint64_t)heap_bytes_allocated(__context__));
+	_Funcbuiltin_0x60_finalize_dim_f30117ee130dd0d1(__context__,das_arg<TDim<TArray<int32_t>,5>>::pass(__a_rename_at_13));
+	uint64_t __w2_rename_at_19 = ((uint64_t)heap_bytes_allocated(__context__));
+	DAS_ASSERT(((__w1_rename_at_17 > __w0_rename_at_14) && (__w0_rename_at_14 == __w2_rename_at_19)));
+	{
+		bool __need_loop_21 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,5));
+		int32_t __t_rename_at_21;
+		__need_loop_21 = __t_iterator.first(__context__,(__t_rename_at_21)) && __need_loop_21;
+		for ( ; __need_loop_21 ; __need_loop_21 = __t_iterator.next(__context__,(__t_rename_at_21)) )
+		{
+			DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_13(__t_rename_at_21,__context__))) == 0) && (builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__a_rename_at_13(__t_rename_at_21,__context__))) == 0)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_21));
+	};
+}
+
+inline void test_delete_table_1a5e156f3fee8fd1 ( Context * __context__ )
+{
+	TTable<int32_t,int32_t> __a_rename_at_25; das_zero(__a_rename_at_25);
+	uint64_t __w0_rename_at_26 = ((uint64_t)heap_bytes_allocated(__context__));
+	das_copy(__a_rename_at_25(0,__context__),1);
+	das_copy(__a_rename_at_25(1,__context__),2);
+	uint64_t __w1_rename_at_29 = ((uint64_t)heap_bytes_allocated(__context__));
+	_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_25));
+	uint64_t __w2_rename_at_31 = ((uint64_t)heap_bytes_allocated(__context__));
+	DAS_ASSERT(((__w1_rename_at_29 > __w0_rename_at_26) && (__w0_rename_at_26 == __w2_rename_at_31)));
+	DAS_ASSERT(((builtin_table_size(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_25)) == 0) && (builtin_table_capacity(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_25)) == 0)));
+}
+
+inline void test_delete_struct_9cad1733953baebc ( Context * __context__ )
+{
+	SomethingSmall * __a_rename_at_36 = 0;
+	uint64_t __w0_rename_at_37 = ((uint64_t)heap_bytes_allocated(__context__));
+	das_copy(__a_rename_at_36,das_new<SomethingSmall>::make(__context__));
+	uint64_t __w1_rename_at_39 = ((uint64_t)heap_bytes_allocated(__context__));
+	finalize_7c102b827992dd63(__context__,__a_rename_at_36);
+	uint64_t __w2_rename_at_42 = ((uint64_t)heap_bytes_allocated(__context__));
+	DAS_ASSERT(((__w1_rename_at_39 > __w0_rename_at_37) && (__w0_rename_at_37 == __w2_rename_at_42)));
+	DAS_ASSERT((__a_rename_at_36 == nullptr));
+}
+
+inline void test_delete_struct_array_ed9ed5a5e75e971d ( Context * __context__ )
+{
+	uint64_t __w0_rename_at_47 = ((uint64_t)heap_bytes_allocated(__context__));
+	TDim<SomethingSmall *,10> __a_rename_at_48 = das_new_dim<SomethingSmall,10>::make(__context__);
+	uint64_t __w1_rename_at_49 = ((uint64_t)heap_bytes_allocated(__context__));
+	_Funcbuiltin_0x60_finalize_dim_936299d196c72523(__context__,das_arg<TDim<SomethingSmall *,10>>::pass(__a_rename_at_48));
+	uint64_t __w2_rename_at_52 = ((uint64_t)heap_bytes_allocated(__context__));
+	DAS_ASSERT(((__w1_rename_at_49 > __w0_rename_at_47) && (__w0_rename_at_47 == __w2_rename_at_52)));
+	{
+		bool __need_loop_54 = true;
+		// pA : SomethingSmall?&
+		das_iterator<TDim<SomethingSmall *,10>> __pA_iterator(__a_rename_at_48);
+		SomethingSmall * * __pA_rename_at_54;
+		__need_loop_54 = __pA_iterator.first(__context__,(__pA_rename_at_54)) && __need_loop_54;
+		for ( ; __need_loop_54 ; __need_loop_54 = __pA_iterator.next(__context__,(__pA_rename_at_54)) )
+		{
+			DAS_ASSERT(((*__pA_rename_at_54) == nullptr));
+		}
+		__pA_iterator.close(__context__,(__pA_rename_at_54));
+	};
+}
+
+inline void test_delete_handle_87fccf1fed12f54f ( Context * __context__ )
+{
+	TestObjectFoo * __a_rename_at_58 = 0;
+	das_copy(__a_rename_at_58,das_new_handle<TestObjectFoo,false>::make(__context__));
+	das_delete_handle<TestObjectFoo *>::clear(__context__,__a_rename_at_58);
+	DAS_ASSERT((__a_rename_at_58 == nullptr));
+}
+
+inline void test_delete_handle_array_4e6f6288478f5b98 ( Context * __context__ )
+{
+	TDim<TestObjectFoo *,10> __a_rename_at_65 = das_new_dim_handle<TestObjectFoo,10,false>::make(__context__);
+	_Funcbuiltin_0x60_finalize_dim_e5ae447d433db26c(__context__,das_arg<TDim<TestObjectFoo *,10>>::pass(__a_rename_at_65));
+	{
+		bool __need_loop_68 = true;
+		// pA : UnitTest::TestObjectFoo?&
+		das_iterator<TDim<TestObjectFoo *,10>> __pA_iterator(__a_rename_at_65);
+		TestObjectFoo * * __pA_rename_at_68;
+		__need_loop_68 = __pA_iterator.first(__context__,(__pA_rename_at_68)) && __need_loop_68;
+		for ( ; __need_loop_68 ; __need_loop_68 = __pA_iterator.next(__context__,(__pA_rename_at_68)) )
+		{
+			DAS_ASSERT(((*__pA_rename_at_68) == nullptr));
+		}
+		__pA_iterator.close(__context__,(__pA_rename_at_68));
+	};
+}
+
+inline void test_delete_struct_array_in_scope_b7b2e8b39002e5e7 ( Context * __context__ )
+{
+	uint64_t __w0_rename_at_84 = ((uint64_t)heap_bytes_allocated(__context__));
+	_Func_0x60_da_inscope_8c50c2639a67d5c5(__context__,2);
+	uint64_t __w1_rename_at_86 = ((uint64_t)heap_bytes_allocated(__context__));
+	DAS_ASSERT((__w0_rename_at_84 == __w1_rename_at_86));
+}
+
+inline void test_delete_string_688fda081f00c9e6 ( Context * __context__ )
+{
+	uint64_t __w0_rename_at_91 = ((uint64_t)heap_bytes_allocated(__context__));
+	char * __a_rename_at_92 = (char *)(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<int32_t>::from(das_deref(__context__,getPtr())))));
+	delete_string(__a_rename_at_92,__context__);
+	uint64_t __w1_rename_at_96 = ((uint64_t)heap_bytes_allocated(__context__));
+	DAS_ASSERT((__w0_rename_at_91 == __w1_rename_at_96));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_92),cast<char *>::from(nullptr),*__context__,nullptr)));
+}
+
+inline void test_delete_string_array_99d11d499795e0c0 ( Context * __context__ )
+{
+	uint64_t __w0_rename_at_102 = ((uint64_t)heap_bytes_allocated(__context__));
+	TDim<char *,3> __a_rename_at_103 = (([&]() -> TDim<char *,3> {
+		TDim<char *,3> __mka_103;
+		__mka_103(0,__context__) = das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<int32_t>::from(das_deref(__context__,getPtr())), cast<char * const >::from(((char *) "_1"))));
+		__mka_103(1,__context__) = das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<int32_t>::from(das_deref(__context__,getPtr())), cast<char * const >::from(((char *) "_2"))));
+		__mka_103(2,__context__) = das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_3, cast<int32_t>::from(das_deref(__context__,getPtr())), cast<char * const >::from(((char *) "_3"))));
+		return __mka_103;
+	})());
+	{
+		bool __need_loop_104 = true;
+		// AA : string&
+		das_iterator<TDim<char *,3>> __AA_iterator(__a_rename_at_103);
+		char * * __AA_rename_at_104;
+		__need_loop_104 = __AA_iterator.first(__context__,(__AA_rename_at_104)) && __need_loop_104;
+		for ( ; __need_loop_104 ; __need_loop_104 = __AA_iterator.next(__context__,(__AA_rename_at_104)) )
+		{
+			delete_string((*__AA_rename_at_104),__context__);
+		}
+		__AA_iterator.close(__context__,(__AA_rename_at_104));
+	};
+	uint64_t __w1_rename_at_107 = ((uint64_t)heap_bytes_allocated(__context__));
+	DAS_ASSERT((__w0_rename_at_102 == __w1_rename_at_107));
+}
+
+inline bool test_3e3887bf9fa67f93 ( Context * __context__ )
+{
+	test_delete_struct_array_in_scope_b7b2e8b39002e5e7(__context__);
+	test_delete_handle_87fccf1fed12f54f(__context__);
+	test_delete_handle_array_4e6f6288478f5b98(__context__);
+	test_delete_struct_9cad1733953baebc(__context__);
+	test_delete_struct_array_ed9ed5a5e75e971d(__context__);
+	test_delete_array_fbfe7d3935e6f893(__context__);
+	test_delete_table_1a5e156f3fee8fd1(__context__);
+	test_delete_string_688fda081f00c9e6(__context__);
+	test_delete_string_array_99d11d499795e0c0(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_finalize_c5f896860856389a
+	aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+	// finalize_36072647358759e2
+	aotLib[0x1261e188359309fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, SomethingSmall &  ),&finalize_36072647358759e2>>();
+	};
+	// _Funcbuiltin_0x60_finalize_dim_f30117ee130dd0d1
+	aotLib[0x8ce6cc76490a34e6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<TArray<int32_t>,5> &  ),&_Funcbuiltin_0x60_finalize_dim_f30117ee130dd0d1>>();
+	};
+	// _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c
+	aotLib[0x8773319e89d22a5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c>>();
+	};
+	// _Funcbuiltin_0x60_finalize_dim_936299d196c72523
+	aotLib[0x4432e16f307430ba] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<SomethingSmall *,10> &  ),&_Funcbuiltin_0x60_finalize_dim_936299d196c72523>>();
+	};
+	// _Funcbuiltin_0x60_finalize_dim_e5ae447d433db26c
+	aotLib[0xf2624de8af5721d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<TestObjectFoo *,10> &  ),&_Funcbuiltin_0x60_finalize_dim_e5ae447d433db26c>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// finalize_7c102b827992dd63
+	aotLib[0x913e45d9ba414cec] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, SomethingSmall * &  ),&finalize_7c102b827992dd63>>();
+	};
+	// _Func_0x60_da_inscope_8c50c2639a67d5c5
+	aotLib[0x2f064c15cc7f91de] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t  ),&_Func_0x60_da_inscope_8c50c2639a67d5c5>>();
+	};
+	// test_delete_array_fbfe7d3935e6f893
+	aotLib[0xc92b214de1760bc8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_array_fbfe7d3935e6f893>>();
+	};
+	// test_delete_table_1a5e156f3fee8fd1
+	aotLib[0xb1ba7aff6f953d77] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_table_1a5e156f3fee8fd1>>();
+	};
+	// test_delete_struct_9cad1733953baebc
+	aotLib[0x9c73eeb92ddcada2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_struct_9cad1733953baebc>>();
+	};
+	// test_delete_struct_array_ed9ed5a5e75e971d
+	aotLib[0x71221567d2e53e2a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_struct_array_ed9ed5a5e75e971d>>();
+	};
+	// test_delete_handle_87fccf1fed12f54f
+	aotLib[0xb3bcfc7466a65915] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_handle_87fccf1fed12f54f>>();
+	};
+	// test_delete_handle_array_4e6f6288478f5b98
+	aotLib[0xc4f6c97824880593] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_handle_array_4e6f6288478f5b98>>();
+	};
+	// test_delete_struct_array_in_scope_b7b2e8b39002e5e7
+	aotLib[0x5368fc9dcfda2924] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_struct_array_in_scope_b7b2e8b39002e5e7>>();
+	};
+	// test_delete_string_688fda081f00c9e6
+	aotLib[0xcf5c064a464225bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_string_688fda081f00c9e6>>();
+	};
+	// test_delete_string_array_99d11d499795e0c0
+	aotLib[0xb6c25a6c5ea1e5a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_string_array_99d11d499795e0c0>>();
+	};
+	// test_3e3887bf9fa67f93
+	aotLib[0x63082cdff140e81d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3e3887bf9fa67f93>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
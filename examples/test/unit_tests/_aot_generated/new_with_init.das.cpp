@@ -0,0 +1,194 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_2284719717410100282 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Ball; };
+namespace  {
+
+struct Ball {
+	float3 center;
+	float radius;
+};
+static_assert(sizeof(Ball)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Ball,center)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Ball,radius)==12,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_9bf481eba8828170 ( Context * __context__, Ball & ____this_rename_at_3 );
+inline void _Funcbuiltin_0x60_finalize_dim_46f9e72e4289b3f9 ( Context * __context__, TDim<Ball *,3> & __a_rename_at_391 );
+inline void finalize_4bb49aebf5f9f1e7 ( Context * __context__, Ball * & ____this_rename_at_27 );
+inline Ball Ball_578ef10292fdb944 ( Context * __context__, float3 __center_rename_at_7, float __radius_rename_at_7 );
+inline bool test_175492d2c53c1b76 ( Context * __context__ );
+inline Ball Ball_44af365e5709a93a ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_9bf481eba8828170 ( Context * __context__, Ball &  ____this_rename_at_3 )
+{
+	memset(&(____this_rename_at_3), 0, 16);
+}
+
+inline void _Funcbuiltin_0x60_finalize_dim_46f9e72e4289b3f9 ( Context * __context__, TDim<Ball *,3> &  __a_rename_at_391 )
+{
+	{
+		bool __need_loop_393 = true;
+		// aV : Ball? aka TT&
+		das_iterator<TDim<Ball *,3>> __aV_iterator(__a_rename_at_391);
+		Ball * * __aV_rename_at_393;
+		__need_loop_393 = __aV_iterator.first(__context__,(__aV_rename_at_393)) && __need_loop_393;
+		for ( ; __need_loop_393 ; __need_loop_393 = __aV_iterator.next(__context__,(__aV_rename_at_393)) )
+		{
+			finalize_4bb49aebf5f9f1e7(__context__,(*__aV_rename_at_393));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_393));
+	};
+}
+
+inline void finalize_4bb49aebf5f9f1e7 ( Context * __context__, Ball * & ____this_rename_at_27 )
+{
+	if ( ____this_rename_at_27 != nullptr )
+	{
+		finalize_9bf481eba8828170(__context__,das_arg<Ball>::pass(das_deref(__context__,____this_rename_at_27)));
+		das_delete<Ball *>::clear(__context__,____this_rename_at_27);
+		das_copy(____this_rename_at_27,nullptr);
+	};
+}
+
+inline Ball Ball_578ef10292fdb944 ( Context * __context__, float3 __center_rename_at_7, float __radius_rename_at_7 )
+{
+	Ball __b_rename_at_8; das_zero(__b_rename_at_8);
+	das_copy(__b_rename_at_8.center,__center_rename_at_7);
+	das_copy(__b_rename_at_8.radius,__radius_rename_at_7);
+	return das_auto_cast_ref<Ball>::cast(__b_rename_at_8);
+}
+
+inline bool test_175492d2c53c1b76 ( Context * __context__ )
+{
+	Ball * __b0_rename_at_15; memset(&__b0_rename_at_15,0,sizeof(__b0_rename_at_15));
+	Ball * __b1_rename_at_17; memset(&__b1_rename_at_17,0,sizeof(__b1_rename_at_17));
+	Ball * __b2_rename_at_19; memset(&__b2_rename_at_19,0,sizeof(__b2_rename_at_19));
+	TDim<Ball *,3> __b3_rename_at_21; memset(&__b3_rename_at_21,0,sizeof(__b3_rename_at_21));
+/* finally */ auto __finally_15= das_finally([&](){
+	finalize_4bb49aebf5f9f1e7(__context__,__b0_rename_at_15);
+	finalize_4bb49aebf5f9f1e7(__context__,__b1_rename_at_17);
+	finalize_4bb49aebf5f9f1e7(__context__,__b2_rename_at_19);
+	_Funcbuiltin_0x60_finalize_dim_46f9e72e4289b3f9(__context__,das_arg<TDim<Ball *,3>>::pass(__b3_rename_at_21));
+/* end finally */ });
+	__b0_rename_at_15 = das_new<Ball>::make(__context__);
+	DAS_ASSERT(((SimPolicy<float3>::Equ(__b0_rename_at_15->center,v_zero(),*__context__,nullptr)) && (__b0_rename_at_15->radius == 0.f)));
+	__b1_rename_at_17 = das_new<Ball>::make_and_init(__context__,[&]() { return Ball_44af365e5709a93a(__context__); });
+	DAS_ASSERT(((SimPolicy<float3>::Equ(__b1_rename_at_17->center,v_make_vec4f(7.f,8.f,9.f,0.f),*__context__,nullptr)) && (__b1_rename_at_17->radius == 1.23399997f)));
+	__b2_rename_at_19 = das_new<Ball>::make_and_init(__context__,[&]() { return Ball_578ef10292fdb944(__context__,v_make_vec4f(1.f,2.f,3.f,0.f),4.f); });
+	DAS_ASSERT(((SimPolicy<float3>::Equ(__b2_rename_at_19->center,v_make_vec4f(1.f,2.f,3.f,0.f),*__context__,nullptr)) && (__b2_rename_at_19->radius == 4.f)));
+	__b3_rename_at_21 = das_new_dim<Ball,3>::make_and_init(__context__,[&]() { return Ball_578ef10292fdb944(__context__,v_make_vec4f(3.f,2.f,1.f,0.f),0.5f); });
+	{
+		bool __need_loop_22 = true;
+		// b : Ball?&
+		das_iterator<TDim<Ball *,3>> __b_iterator(__b3_rename_at_21);
+		Ball * * __b_rename_at_22;
+		__need_loop_22 = __b_iterator.first(__context__,(__b_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __b_iterator.next(__context__,(__b_rename_at_22)) )
+		{
+			DAS_ASSERT(((SimPolicy<float3>::Equ((*__b_rename_at_22)->center,v_make_vec4f(3.f,2.f,1.f,0.f),*__context__,nullptr)) && ((*__b_rename_at_22)->radius == 0.5f)));
+		}
+		__b_iterator.close(__context__,(__b_rename_at_22));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline Ball Ball_44af365e5709a93a ( Context * __context__ )
+{
+	return das_auto_cast_ref<Ball>::cast((([&]() -> Ball {
+		Ball __mks_3;
+		das_copy((__mks_3.center),(v_make_vec4f(7.f,8.f,9.f,0.f)));
+		das_copy((__mks_3.radius),(1.23399997f));
+		return __mks_3;
+	})()));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_9bf481eba8828170
+	aotLib[0x7e8060f091117e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Ball &  ),&finalize_9bf481eba8828170>>();
+	};
+	// _Funcbuiltin_0x60_finalize_dim_46f9e72e4289b3f9
+	aotLib[0xae2e75b5ad2eaf93] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<Ball *,3> &  ),&_Funcbuiltin_0x60_finalize_dim_46f9e72e4289b3f9>>();
+	};
+	// finalize_4bb49aebf5f9f1e7
+	aotLib[0x4d197d87f73dfc91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Ball * &  ),&finalize_4bb49aebf5f9f1e7>>();
+	};
+	// Ball_578ef10292fdb944
+	aotLib[0xce318efe4182d4c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Ball (*) ( Context * __context__, float3 , float  ),&Ball_578ef10292fdb944>>();
+	};
+	// test_175492d2c53c1b76
+	aotLib[0x9e0776e2bad16a94] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_175492d2c53c1b76>>();
+	};
+	// Ball_44af365e5709a93a
+	aotLib[0xbfc9652aaefacd05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Ball (*) ( Context * __context__ ),&Ball_44af365e5709a93a>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,593 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15651216735842873446 {
+
+extern StructInfo __struct_info__5cf32ec79c4b81a8;
+extern StructInfo __struct_info__f35ff723fded4627;
+extern StructInfo __struct_info__e917ce23f7a4e75c;
+extern TypeInfo __type_info__dfd82b908f3b1490;
+extern TypeInfo __type_info__18a99c9ebd46d265;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__f6ec8d9653d888a5;
+extern VarInfo __var_info__a08ac32745ae8127;
+extern VarInfo __var_info__e2f2fd70a8e5a909;
+extern VarInfo __var_info__fb543e93693c4476;
+extern VarInfo __var_info__f5cb69a2f3b1d2b2;
+extern VarInfo __var_info__5b1e419d64672d8;
+extern VarInfo __var_info__eedb85419432bbaf;
+extern VarInfo __var_info__b457ef1451c3a491;
+extern VarInfo __var_info__8f67c6a6535b7c3;
+extern VarInfo __var_info__8771033a44e0a4fb;
+extern VarInfo __var_info__157ff670c5203643;
+extern VarInfo __var_info__6bed2c513b6a52b4;
+extern VarInfo __var_info__a08ac22745ae7f74;
+extern VarInfo __var_info__f5cb67a2f3b1cf4c;
+extern VarInfo __var_info__f5cb68a2f3b1d0ff;
+extern VarInfo __var_info__2e2c459385b6d4f4;
+extern VarInfo __var_info__8c250e19a21250ae;
+
+VarInfo __struct_info__5cf32ec79c4b81a8_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8f67c6a6535b7c3), "__rtti", 0 };
+TypeInfo * __type_info__5b1e419d64672d8_arg_types_var_6697748505685623208[1] = { &__type_info__dfd82b908f3b1490 };
+VarInfo __struct_info__5cf32ec79c4b81a8_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__5b1e419d64672d8_arg_types_var_6697748505685623208, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x5b1e419d64672d8), "__finalize", 8 };
+VarInfo __struct_info__5cf32ec79c4b81a8_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf5cb67a2f3b1cf4c), "x", 16 };
+VarInfo __struct_info__5cf32ec79c4b81a8_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf5cb68a2f3b1d0ff), "y", 20 };
+TypeInfo * __type_info__2e2c459385b6d4f4_arg_types_var_6697748505685623208[3] = { &__type_info__dfd82b908f3b1490, &__type_info__90f5707b5a6f641, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__5cf32ec79c4b81a8_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__2e2c459385b6d4f4_arg_types_var_6697748505685623208, nullptr, 3, 0, nullptr, 28, 8, UINT64_C(0x2e2c459385b6d4f4), "set", 24 };
+TypeInfo * __type_info__fb543e93693c4476_arg_types_var_6697748505685623208[1] = { &__type_info__dfd82b908f3b1490 };
+VarInfo __struct_info__5cf32ec79c4b81a8_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fb543e93693c4476_arg_types_var_6697748505685623208, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xfb543e93693c4476), "ups", 32 };
+VarInfo __struct_info__5cf32ec79c4b81a8_field_6 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf5cb69a2f3b1d2b2), "z", 40 };
+VarInfo * __struct_info__5cf32ec79c4b81a8_fields[7] =  { &__struct_info__5cf32ec79c4b81a8_field_0, &__struct_info__5cf32ec79c4b81a8_field_1, &__struct_info__5cf32ec79c4b81a8_field_2, &__struct_info__5cf32ec79c4b81a8_field_3, &__struct_info__5cf32ec79c4b81a8_field_4, &__struct_info__5cf32ec79c4b81a8_field_5, &__struct_info__5cf32ec79c4b81a8_field_6 };
+StructInfo __struct_info__5cf32ec79c4b81a8 = {"Foo3D", "", 5, __struct_info__5cf32ec79c4b81a8_fields, 7, 48, UINT64_C(0x8b206416159ae5f8), nullptr, UINT64_C(0x5cf32ec79c4b81a8) };
+VarInfo __struct_info__f35ff723fded4627_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8c250e19a21250ae), "__rtti", 0 };
+TypeInfo * __type_info__b457ef1451c3a491_arg_types_var_17537007207960102439[1] = { &__type_info__dfd82b908f3b1490 };
+VarInfo __struct_info__f35ff723fded4627_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__b457ef1451c3a491_arg_types_var_17537007207960102439, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xb457ef1451c3a491), "__finalize", 8 };
+VarInfo __struct_info__f35ff723fded4627_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa08ac32745ae8127), "x", 16 };
+VarInfo __struct_info__f35ff723fded4627_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa08ac22745ae7f74), "y", 20 };
+TypeInfo * __type_info__157ff670c5203643_arg_types_var_17537007207960102439[3] = { &__type_info__dfd82b908f3b1490, &__type_info__90f5707b5a6f641, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__f35ff723fded4627_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__157ff670c5203643_arg_types_var_17537007207960102439, nullptr, 3, 0, nullptr, 28, 8, UINT64_C(0x157ff670c5203643), "set", 24 };
+TypeInfo * __type_info__e2f2fd70a8e5a909_arg_types_var_17537007207960102439[1] = { &__type_info__dfd82b908f3b1490 };
+VarInfo __struct_info__f35ff723fded4627_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__e2f2fd70a8e5a909_arg_types_var_17537007207960102439, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xe2f2fd70a8e5a909), "ups", 32 };
+VarInfo * __struct_info__f35ff723fded4627_fields[6] =  { &__struct_info__f35ff723fded4627_field_0, &__struct_info__f35ff723fded4627_field_1, &__struct_info__f35ff723fded4627_field_2, &__struct_info__f35ff723fded4627_field_3, &__struct_info__f35ff723fded4627_field_4, &__struct_info__f35ff723fded4627_field_5 };
+StructInfo __struct_info__f35ff723fded4627 = {"Foo", "", 5, __struct_info__f35ff723fded4627_fields, 6, 40, UINT64_C(0xf2bb95199c92e1d7), nullptr, UINT64_C(0xf35ff723fded4627) };
+VarInfo __struct_info__e917ce23f7a4e75c_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xeedb85419432bbaf), "__rtti", 0 };
+TypeInfo * __type_info__6bed2c513b6a52b4_arg_types_var_16796119989175510876[1] = { &__type_info__f6ec8d9653d888a5 };
+VarInfo __struct_info__e917ce23f7a4e75c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__6bed2c513b6a52b4_arg_types_var_16796119989175510876, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x6bed2c513b6a52b4), "__finalize", 8 };
+VarInfo __struct_info__e917ce23f7a4e75c_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x8771033a44e0a4fb), "a", 16 };
+VarInfo * __struct_info__e917ce23f7a4e75c_fields[3] =  { &__struct_info__e917ce23f7a4e75c_field_0, &__struct_info__e917ce23f7a4e75c_field_1, &__struct_info__e917ce23f7a4e75c_field_2 };
+StructInfo __struct_info__e917ce23f7a4e75c = {"Goo", "", 5, __struct_info__e917ce23f7a4e75c_fields, 3, 24, UINT64_C(0xeaff6c199874084c), nullptr, UINT64_C(0xe917ce23f7a4e75c) };
+TypeInfo __type_info__dfd82b908f3b1490 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 40, UINT64_C(0xdfd82b908f3b1490) };
+TypeInfo __type_info__18a99c9ebd46d265 = { Type::tStructure, &__struct_info__5cf32ec79c4b81a8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 48, UINT64_C(0x18a99c9ebd46d265) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+TypeInfo __type_info__f6ec8d9653d888a5 = { Type::tStructure, &__struct_info__e917ce23f7a4e75c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 24, UINT64_C(0xf6ec8d9653d888a5) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Foo; };
+namespace  { struct Foo3D; };
+namespace  { struct Goo; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+namespace  {
+
+struct Foo {
+	void * __rtti;
+	Func DAS_COMMENT((void,Foo)) __finalize;
+	int32_t x;
+	int32_t y;
+	Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set;
+	Func DAS_COMMENT((void,Foo)) ups;
+};
+static_assert(sizeof(Foo)==40,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,set)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,ups)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo3D {
+	void * __rtti;
+	Func DAS_COMMENT((void,Foo)) __finalize;
+	int32_t x;
+	int32_t y;
+	Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set;
+	Func DAS_COMMENT((void,Foo)) ups;
+	int32_t z;
+};
+static_assert(sizeof(Foo3D)==48,"structure size mismatch with DAS");
+static_assert(offsetof(Foo3D,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,y)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,set)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,ups)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,z)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Goo {
+	void * __rtti;
+	Func DAS_COMMENT((void,Goo)) __finalize;
+	int32_t a;
+};
+static_assert(sizeof(Goo)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Goo,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Goo,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Goo,a)==16,"structure field offset mismatch with DAS");
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_dd6db0dfec5c6377 ( Context * __context__, Goo const  & __cl_rename_at_86 );
+inline void finalize_1ce195c4f33bd99c ( Context * __context__, Foo * & ____this_rename_at_74 );
+inline void finalize_f0a5bc956156a1bc ( Context * __context__, Goo & ____this_rename_at_85 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_50c6f0ce34b2537c ( Context * __context__, Foo const  & __cl_rename_at_86 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_425ecbeb287386ff ( Context * __context__, Foo3D const  & __cl_rename_at_86 );
+inline Foo Foo_978f921bb57cd1cc ( Context * __context__ );
+inline void _FuncFoo_0x60_Foo_39b8d39180d6d14 ( Context * __context__, Foo & __self_rename_at_9 );
+inline Foo Foo_45199f23fc19c274 ( Context * __context__, int32_t __T_rename_at_11 );
+inline void _FuncFoo_0x60_Foo_881fda4335b7b81a ( Context * __context__, Foo & __self_rename_at_11, int32_t __T_rename_at_11 );
+inline Foo Foo_65ec5213978b4b81 ( Context * __context__, int32_t __X_rename_at_13, int32_t __Y_rename_at_13 );
+inline void _FuncFoo_0x60_Foo_620227408c619161 ( Context * __context__, Foo & __self_rename_at_13, int32_t __X_rename_at_13, int32_t __Y_rename_at_13 );
+inline void _FuncFoo_0x60_set_8c22e0ec3d82d22e ( Context * __context__, Foo & __self_rename_at_15, int32_t __X_rename_at_15, int32_t __Y_rename_at_15 );
+inline void _FuncFoo_0x60_ups_669543df32d03699 ( Context * __context__, Foo & __self_rename_at_18 );
+inline void finalize_453dd213792c24e9 ( Context * __context__, Foo & __self_rename_at_21 );
+inline void _FuncFoo_0x27___finalize_502ce87fe4325f9b ( Context * __context__, Foo & __self_rename_at_7 );
+inline Foo3D Foo3D_18a0f444853f8302 ( Context * __context__ );
+inline void _FuncFoo3D_0x60_Foo3D_a60ac8b8b8be18a6 ( Context * __context__, Foo3D & __self_rename_at_26 );
+inline void _FuncFoo3D_0x60_set_38c3fa1fc69af30f ( Context * __context__, Foo3D & __self_rename_at_32, int32_t __X_rename_at_32, int32_t __Y_rename_at_32 );
+inline void _FuncFoo3D_0x60_ups_33d344bfc3700bd5 ( Context * __context__, Foo3D & __self_rename_at_35 );
+inline void finalize_cae2ffe3311a4033 ( Context * __context__, Foo3D & __self_rename_at_39 );
+inline void _FuncFoo3D_0x27___finalize_ab7067363d8ec701 ( Context * __context__, Foo3D & __self_rename_at_24 );
+inline void test_foo_85fc9f468454869e ( Context * __context__ );
+inline void test_foo_ptr_a11c2cce673e966 ( Context * __context__ );
+inline void _FuncGoo_0x27___finalize_9687127206555bdf ( Context * __context__, Goo & __self_rename_at_85 );
+inline void test_rtti_4a31254ebfbfbb04 ( Context * __context__ );
+inline bool test_359b249487062ce3 ( Context * __context__ );
+inline Goo Goo_770046c22aa74584 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x5b535081b098fcd5>(__context__) = 0;/*delFoo*/
+	das_global<int32_t,0xe18ec80ccad5d7ba>(__context__) = 0;/*delFoo3D*/
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_dd6db0dfec5c6377 ( Context * __context__, Goo const  &  __cl_rename_at_86 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo const  *>::cast(__cl_rename_at_86.__rtti)->structType /*structType*/));
+}
+
+inline void finalize_1ce195c4f33bd99c ( Context * __context__, Foo * & ____this_rename_at_74 )
+{
+	if ( ____this_rename_at_74 != nullptr )
+	{
+		int32_t ____size_rename_at_74 = ((int32_t)class_rtti_size(das_auto_cast<void * const >::cast(____this_rename_at_74)));
+		das_invoke_function<void>::invoke<Foo &>(__context__,nullptr,____this_rename_at_74->__finalize,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,____this_rename_at_74))));
+		das_delete<Foo *>::clear(__context__,____this_rename_at_74,____size_rename_at_74);
+		das_copy(____this_rename_at_74,nullptr);
+	};
+}
+
+inline void finalize_f0a5bc956156a1bc ( Context * __context__, Goo &  ____this_rename_at_85 )
+{
+	memset(&(____this_rename_at_85), 0, 24);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_50c6f0ce34b2537c ( Context * __context__, Foo const  &  __cl_rename_at_86 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo const  *>::cast(__cl_rename_at_86.__rtti)->structType /*structType*/));
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_425ecbeb287386ff ( Context * __context__, Foo3D const  &  __cl_rename_at_86 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo const  *>::cast(__cl_rename_at_86.__rtti)->structType /*structType*/));
+}
+
+inline Foo Foo_978f921bb57cd1cc ( Context * __context__ )
+{
+	Foo __self_rename_at_9; das_zero(__self_rename_at_9); das_move(__self_rename_at_9, (([&]() -> Foo {
+		Foo __mks_9;
+		das_copy((__mks_9.__rtti),(((void *)(&__type_info__dfd82b908f3b1490))));
+		das_copy((__mks_9.__finalize),(Func(__context__->fnByMangledName(/*Foo'__finalize S<::Foo>*/ 3524882781912245377u))));
+		das_copy((__mks_9.x),(0));
+		das_copy((__mks_9.y),(0));
+		das_copy((__mks_9.set),(Func(__context__->fnByMangledName(/*Foo`set S<::Foo> Ci Ci*/ 3175967141394302796u))));
+		das_copy((__mks_9.ups),(Func(__context__->fnByMangledName(/*Foo`ups S<::Foo>*/ 14162962066563773514u))));
+		return __mks_9;
+	})()));
+	_FuncFoo_0x60_Foo_39b8d39180d6d14(__context__,das_arg<Foo>::pass(__self_rename_at_9));
+	return /* <- */ das_auto_cast_move<Foo>::cast(__self_rename_at_9);
+}
+
+inline void _FuncFoo_0x60_Foo_39b8d39180d6d14 ( Context * __context__, Foo &  __self_rename_at_9 )
+{
+	_FuncFoo_0x60_set_8c22e0ec3d82d22e(__context__,das_arg<Foo>::pass(__self_rename_at_9),1,1);
+}
+
+inline Foo Foo_45199f23fc19c274 ( Context * __context__, int32_t __T_rename_at_11 )
+{
+	Foo __self_rename_at_11; das_zero(__self_rename_at_11); das_move(__self_rename_at_11, (([&]() -> Foo {
+		Foo __mks_11;
+		das_copy((__mks_11.__rtti),(((void *)(&__type_info__dfd82b908f3b1490))));
+		das_copy((__mks_11.__finalize),(Func(__context__->fnByMangledName(/*Foo'__finalize S<::Foo>*/ 3524882781912245377u))));
+		das_copy((__mks_11.x),(0));
+		das_copy((__mks_11.y),(0));
+		das_copy((__mks_11.set),(Func(__context__->fnByMangledName(/*Foo`set S<::Foo> Ci Ci*/ 3175967141394302796u))));
+		das_copy((__mks_11.ups),(Func(__context__->fnByMangledName(/*Foo`ups S<::Foo>*/ 14162962066563773514u))));
+		return __mks_11;
+	})()));
+	_FuncFoo_0x60_Foo_881fda4335b7b81a(__context__,das_arg<Foo>::pass(__self_rename_at_11),__T_rename_at_11);
+	return /* <- */ das_auto_cast_move<Foo>::cast(__self_rename_at_11);
+}
+
+inline void _FuncFoo_0x60_Foo_881fda4335b7b81a ( Context * __context__, Foo &  __self_rename_at_11, int32_t __T_rename_at_11 )
+{
+	das_invoke_function<void>::invoke<Foo &,int32_t,int32_t>(__context__,nullptr,__self_rename_at_11.set,das_arg<Foo>::pass(__self_rename_at_11),__T_rename_at_11,__T_rename_at_11);
+}
+
+inline Foo Foo_65ec5213978b4b81 ( Context * __context__, int32_t __X_rename_at_13, int32_t __Y_rename_at_13 )
+{
+	Foo __self_rename_at_13; das_zero(__self_rename_at_13); das_move(__self_rename_at_13, (([&]() -> Foo {
+		Foo __mks_13;
+		das_copy((__mks_13.__rtti),(((void *)(&__type_info__dfd82b908f3b1490))));
+		das_copy((__mks_13.__finalize),(Func(__context__->fnByMangledName(/*Foo'__finalize S<::Foo>*/ 3524882781912245377u))));
+		das_copy((__mks_13.x),(0));
+		das_copy((__mks_13.y),(0));
+		das_copy((__mks_13.set),(Func(__context__->fnByMangledName(/*Foo`set S<::Foo> Ci Ci*/ 3175967141394302796u))));
+		das_copy((__mks_13.ups),(Func(__context__->fnByMangledName(/*Foo`ups S<::Foo>*/ 14162962066563773514u))));
+		return __mks_13;
+	})()));
+	_FuncFoo_0x60_Foo_620227408c619161(__context__,das_arg<Foo>::pass(__self_rename_at_13),__X_rename_at_13,__Y_rename_at_13);
+	return /* <- */ das_auto_cast_move<Foo>::cast(__self_rename_at_13);
+}
+
+inline void _FuncFoo_0x60_Foo_620227408c619161 ( Context * __context__, Foo &  __self_rename_at_13, int32_t __X_rename_at_13, int32_t __Y_rename_at_13 )
+{
+	_FuncFoo_0x60_set_8c22e0ec3d82d22e(__context__,das_arg<Foo>::pass(__self_rename_at_13),__X_rename_at_13,__Y_rename_at_13);
+}
+
+inline void _FuncFoo_0x60_set_8c22e0ec3d82d22e ( Context * __context__, Foo &  __self_rename_at_15, int32_t __X_rename_at_15, int32_t __Y_rename_at_15 )
+{
+	das_copy(__self_rename_at_15.x,__X_rename_at_15);
+	das_copy(__self_rename_at_15.y,__Y_rename_at_15);
+}
+
+inline void _FuncFoo_0x60_ups_669543df32d03699 ( Context * __context__, Foo &  __self_rename_at_18 )
+{
+	das_copy(__self_rename_at_18.x,-1);
+	das_copy(__self_rename_at_18.y,-1);
+}
+
+inline void finalize_453dd213792c24e9 ( Context * __context__, Foo &  __self_rename_at_21 )
+{
+	++das_global<int32_t,0x5b535081b098fcd5>(__context__) /*delFoo*/;
+}
+
+inline void _FuncFoo_0x27___finalize_502ce87fe4325f9b ( Context * __context__, Foo &  __self_rename_at_7 )
+{
+	finalize_453dd213792c24e9(__context__,das_arg<Foo>::pass(__self_rename_at_7));
+}
+
+inline Foo3D Foo3D_18a0f444853f8302 ( Context * __context__ )
+{
+	Foo3D __self_rename_at_26; das_zero(__self_rename_at_26); das_move(__self_rename_at_26, (([&]() -> Foo3D {
+		Foo3D __mks_26;
+		das_copy((__mks_26.__rtti),(((void *)(&__type_info__18a99c9ebd46d265))));
+		das_copy((__mks_26.__finalize),(das_cast<Func DAS_COMMENT((void,Foo))>::cast(Func(__context__->fnByMangledName(/*Foo3D'__finalize S<::Foo3D>*/ 10677920379024627723u)))));
+		das_copy((__mks_26.x),(0));
+		das_copy((__mks_26.y),(0));
+		das_copy((__mks_26.set),(das_cast<Func DAS_COMMENT((void,Foo,int32_t,int32_t))>::cast(Func(__context__->fnByMangledName(/*Foo3D`set S<::Foo3D> Ci Ci*/ 12021514949180096008u)))));
+		das_copy((__mks_26.ups),(das_cast<Func DAS_COMMENT((void,Foo))>::cast(Func(__context__->fnByMangledName(/*Foo3D`ups S<::Foo3D>*/ 17652358755152774318u)))));
+		das_copy((__mks_26.z),(13));
+		return __mks_26;
+	})()));
+	_FuncFoo3D_0x60_Foo3D_a60ac8b8b8be18a6(__context__,das_arg<Foo3D>::pass(__self_rename_at_26));
+	return /* <- */ das_auto_cast_move<Foo3D>::cast(__self_rename_at_26);
+}
+
+inline void _FuncFoo3D_0x60_Foo3D_a60ac8b8b8be18a6 ( Context * __context__, Foo3D &  __self_rename_at_26 )
+{
+	DAS_ASSERT(((__self_rename_at_26.x == 0) && (__self_rename_at_26.y == 0)));
+	DAS_ASSERT((__self_rename_at_26.z == 13));
+	_FuncFoo_0x60_Foo_39b8d39180d6d14(__context__,das_reinterpret<Foo>::pass(das_arg<Foo3D>::pass(__self_rename_at_26)));
+	DAS_ASSERT(((__self_rename_at_26.x == 1) && (__self_rename_at_26.y == 1)));
+	das_copy(__self_rename_at_26.z,3);
+}
+
+inline void _FuncFoo3D_0x60_set_38c3fa1fc69af30f ( Context * __context__, Foo3D &  __self_rename_at_32, int32_t __X_rename_at_32, int32_t __Y_rename_at_32 )
+{
+	_FuncFoo_0x60_set_8c22e0ec3d82d22e(__context__,das_reinterpret<Foo>::pass(das_arg<Foo3D>::pass(__self_rename_at_32)),__X_rename_at_32,__Y_rename_at_32);
+	das_copy(__self_rename_at_32.z,0);
+}
+
+inline void _FuncFoo3D_0x60_ups_33d344bfc3700bd5 ( Context * __context__, Foo3D &  __self_rename_at_35 )
+{
+	das_copy(__self_rename_at_35.x,-2);
+	das_copy(__self_rename_at_35.y,-2);
+	das_copy(__self_rename_at_35.z,-2);
+}
+
+inline void finalize_cae2ffe3311a4033 ( Context * __context__, Foo3D &  __self_rename_at_39 )
+{
+	finalize_453dd213792c24e9(__context__,das_arg<Foo>::pass(das_cast<Foo>::cast(__self_rename_at_39)));
+	++das_global<int32_t,0xe18ec80ccad5d7ba>(__context__) /*delFoo3D*/;
+}
+
+inline void _FuncFoo3D_0x27___finalize_ab7067363d8ec701 ( Context * __context__, Foo3D &  __self_rename_at_24 )
+{
+	finalize_cae2ffe3311a4033(__context__,das_arg<Foo3D>::pass(__self_rename_at_24));
+}
+
+inline void test_foo_85fc9f468454869e ( Context * __context__ )
+{
+	Foo __f_rename_at_45 = Foo_978f921bb57cd1cc(__context__);
+	DAS_ASSERT(((__f_rename_at_45.x == 1) && (__f_rename_at_45.y == 1)));
+	das_invoke_function<void>::invoke<Foo &,int32_t,int32_t>(__context__,nullptr,__f_rename_at_45.set,das_arg<Foo>::pass(das_cast<Foo>::cast(__f_rename_at_45)),1,2);
+	DAS_ASSERT(((__f_rename_at_45.x == 1) && (__f_rename_at_45.y == 2)));
+	das_copy(__f_rename_at_45,Foo_65ec5213978b4b81(__context__,11,12));
+	DAS_ASSERT(((__f_rename_at_45.x == 11) && (__f_rename_at_45.y == 12)));
+	das_copy(__f_rename_at_45,Foo_45199f23fc19c274(__context__,13));
+	DAS_ASSERT(((__f_rename_at_45.x == 13) && (__f_rename_at_45.y == 13)));
+	Foo3D __f3d_rename_at_53 = Foo3D_18a0f444853f8302(__context__);
+	DAS_ASSERT((((__f3d_rename_at_53.x == 1) && (__f3d_rename_at_53.y == 1)) && (__f3d_rename_at_53.z == 3)));
+	das_invoke_function<void>::invoke<Foo &,int32_t,int32_t>(__context__,nullptr,__f3d_rename_at_53.set,das_arg<Foo>::pass(das_cast<Foo>::cast(__f3d_rename_at_53)),1,2);
+	DAS_ASSERT((((__f3d_rename_at_53.x == 1) && (__f3d_rename_at_53.y == 2)) && (__f3d_rename_at_53.z == 0)));
+	das_copy(__f3d_rename_at_53.z,13);
+	das_invoke_function<void>::invoke<Foo &,int32_t,int32_t>(__context__,nullptr,__f3d_rename_at_53.set,das_arg<Foo>::pass(das_cast<Foo>::cast(__f3d_rename_at_53)),3,4);
+	DAS_ASSERT((((__f3d_rename_at_53.x == 3) && (__f3d_rename_at_53.y == 4)) && (__f3d_rename_at_53.z == 0)));
+	DAS_ASSERT(((das_global<int32_t,0x5b535081b098fcd5>(__context__) /*delFoo*/ == 0) && (das_global<int32_t,0xe18ec80ccad5d7ba>(__context__) /*delFoo3D*/ == 0)));
+	finalize_453dd213792c24e9(__context__,das_arg<Foo>::pass(__f_rename_at_45));
+	DAS_ASSERT(((das_global<int32_t,0x5b535081b098fcd5>(__context__) /*delFoo*/ == 1) && (das_global<int32_t,0xe18ec80ccad5d7ba>(__context__) /*delFoo3D*/ == 0)));
+	finalize_cae2ffe3311a4033(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_53));
+	DAS_ASSERT(((das_global<int32_t,0x5b535081b098fcd5>(__context__) /*delFoo*/ == 2) && (das_global<int32_t,0xe18ec80ccad5d7ba>(__context__) /*delFoo3D*/ == 1)));
+	das_copy(das_global<int32_t,0x5b535081b098fcd5>(__context__) /*delFoo*/,0);
+	das_copy(das_global<int32_t,0xe18ec80ccad5d7ba>(__context__) /*delFoo3D*/,0);
+}
+
+inline void test_foo_ptr_a11c2cce673e966 ( Context * __context__ )
+{
+	Foo * __f_rename_at_69 = das_new<Foo>::make_and_init(__context__,[&]() { return Foo_978f921bb57cd1cc(__context__); });
+	das_invoke_function<void>::invoke<Foo &>(__context__,nullptr,__f_rename_at_69->ups,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,__f_rename_at_69))));
+	DAS_ASSERT(((__f_rename_at_69->x == -1) && (__f_rename_at_69->y == -1)));
+	DAS_ASSERT(((das_global<int32_t,0x5b535081b098fcd5>(__context__) /*delFoo*/ == 0) && (das_global<int32_t,0xe18ec80ccad5d7ba>(__context__) /*delFoo3D*/ == 0)));
+	finalize_1ce195c4f33bd99c(__context__,__f_rename_at_69);
+	DAS_ASSERT(((das_global<int32_t,0x5b535081b098fcd5>(__context__) /*delFoo*/ == 1) && (das_global<int32_t,0xe18ec80ccad5d7ba>(__context__) /*delFoo3D*/ == 0)));
+	das_copy(__f_rename_at_69,das_cast<Foo *>::cast(das_new<Foo3D>::make_and_init(__context__,[&]() { return Foo3D_18a0f444853f8302(__context__); })));
+	das_invoke_function<void>::invoke<Foo &>(__context__,nullptr,__f_rename_at_69->ups,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,__f_rename_at_69))));
+	DAS_ASSERT(((__f_rename_at_69->x == -2) && (__f_rename_at_69->y == -2)));
+	finalize_1ce195c4f33bd99c(__context__,__f_rename_at_69);
+	DAS_ASSERT(((das_global<int32_t,0x5b535081b098fcd5>(__context__) /*delFoo*/ == 2) && (das_global<int32_t,0xe18ec80ccad5d7ba>(__context__) /*delFoo3D*/ == 1)));
+	das_copy(das_global<int32_t,0x5b535081b098fcd5>(__context__) /*delFoo*/,0);
+	das_copy(das_global<int32_t,0xe18ec80ccad5d7ba>(__context__) /*delFoo3D*/,0);
+}
+
+inline void _FuncGoo_0x27___finalize_9687127206555bdf ( Context * __context__, Goo &  __self_rename_at_85 )
+{
+	finalize_f0a5bc956156a1bc(__context__,das_arg<Goo>::pass(__self_rename_at_85));
+}
+
+inline void test_rtti_4a31254ebfbfbb04 ( Context * __context__ )
+{
+	Goo __g_rename_at_90 = Goo_770046c22aa74584(__context__);
+	Foo __f_rename_at_91 = Foo_978f921bb57cd1cc(__context__);
+	Foo __f2_rename_at_92 = Foo_978f921bb57cd1cc(__context__);
+	Foo3D __f3d_rename_at_93 = Foo3D_18a0f444853f8302(__context__);
+	Foo3D __f3d2_rename_at_94 = Foo3D_18a0f444853f8302(__context__);
+	DAS_ASSERT((__f_rename_at_91.__rtti != __g_rename_at_90.__rtti));
+	DAS_ASSERT((__f3d_rename_at_93.__rtti != __g_rename_at_90.__rtti));
+	DAS_ASSERT((__f_rename_at_91.__rtti == __f2_rename_at_92.__rtti));
+	DAS_ASSERT((__f3d_rename_at_93.__rtti == __f3d2_rename_at_94.__rtti));
+	DAS_ASSERT((__f_rename_at_91.__rtti != __f3d_rename_at_93.__rtti));
+	DAS_ASSERT((_Funcrtti_0x60_class_info_50c6f0ce34b2537c(__context__,das_arg<Foo>::pass(__f_rename_at_91)) != _Funcrtti_0x60_class_info_dd6db0dfec5c6377(__context__,das_arg<Goo>::pass(__g_rename_at_90))));
+	DAS_ASSERT((_Funcrtti_0x60_class_info_425ecbeb287386ff(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_93)) != _Funcrtti_0x60_class_info_dd6db0dfec5c6377(__context__,das_arg<Goo>::pass(__g_rename_at_90))));
+	DAS_ASSERT((_Funcrtti_0x60_class_info_50c6f0ce34b2537c(__context__,das_arg<Foo>::pass(__f_rename_at_91)) == _Funcrtti_0x60_class_info_50c6f0ce34b2537c(__context__,das_arg<Foo>::pass(__f2_rename_at_92))));
+	DAS_ASSERT((_Funcrtti_0x60_class_info_425ecbeb287386ff(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_93)) == _Funcrtti_0x60_class_info_425ecbeb287386ff(__context__,das_arg<Foo3D>::pass(__f3d2_rename_at_94))));
+	DAS_ASSERT((_Funcrtti_0x60_class_info_50c6f0ce34b2537c(__context__,das_arg<Foo>::pass(__f_rename_at_91)) != _Funcrtti_0x60_class_info_425ecbeb287386ff(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_93))));
+	DAS_VERIFY((isCompatibleCast(_Funcrtti_0x60_class_info_50c6f0ce34b2537c(__context__,das_arg<Foo>::pass(__f_rename_at_91)),_Funcrtti_0x60_class_info_50c6f0ce34b2537c(__context__,das_arg<Foo>::pass(__f_rename_at_91)))));
+	DAS_VERIFY((isCompatibleCast(_Funcrtti_0x60_class_info_50c6f0ce34b2537c(__context__,das_arg<Foo>::pass(__f_rename_at_91)),_Funcrtti_0x60_class_info_425ecbeb287386ff(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_93)))));
+	DAS_VERIFY((!isCompatibleCast(_Funcrtti_0x60_class_info_425ecbeb287386ff(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_93)),_Funcrtti_0x60_class_info_50c6f0ce34b2537c(__context__,das_arg<Foo>::pass(__f_rename_at_91)))));
+	DAS_VERIFY((!isCompatibleCast(_Funcrtti_0x60_class_info_dd6db0dfec5c6377(__context__,das_arg<Goo>::pass(__g_rename_at_90)),_Funcrtti_0x60_class_info_50c6f0ce34b2537c(__context__,das_arg<Foo>::pass(__f_rename_at_91)))));
+	DAS_VERIFY((!isCompatibleCast(_Funcrtti_0x60_class_info_50c6f0ce34b2537c(__context__,das_arg<Foo>::pass(__f_rename_at_91)),_Funcrtti_0x60_class_info_dd6db0dfec5c6377(__context__,das_arg<Goo>::pass(__g_rename_at_90)))));
+	DAS_VERIFY((!isCompatibleCast(_Funcrtti_0x60_class_info_dd6db0dfec5c6377(__context__,das_arg<Goo>::pass(__g_rename_at_90)),_Funcrtti_0x60_class_info_425ecbeb287386ff(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_93)))));
+	DAS_VERIFY((!isCompatibleCast(_Funcrtti_0x60_class_info_425ecbeb287386ff(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_93)),_Funcrtti_0x60_class_info_dd6db0dfec5c6377(__context__,das_arg<Goo>::pass(__g_rename_at_90)))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(_Funcrtti_0x60_class_info_50c6f0ce34b2537c(__context__,das_arg<Foo>::pass(__f_rename_at_91))->name /*name*/),cast<char *>::from(((char *) "Foo")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(_Funcrtti_0x60_class_info_425ecbeb287386ff(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_93))->name /*name*/),cast<char *>::from(((char *) "Foo3D")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(_Funcrtti_0x60_class_info_dd6db0dfec5c6377(__context__,das_arg<Goo>::pass(__g_rename_at_90))->name /*name*/),cast<char *>::from(((char *) "Goo")),*__context__,nullptr)));
+}
+
+inline bool test_359b249487062ce3 ( Context * __context__ )
+{
+	test_foo_85fc9f468454869e(__context__);
+	test_foo_ptr_a11c2cce673e966(__context__);
+	test_rtti_4a31254ebfbfbb04(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline Goo Goo_770046c22aa74584 ( Context * __context__ )
+{
+	return das_auto_cast_ref<Goo>::cast((([&]() -> Goo {
+		Goo __mks_85;
+		das_zero(__mks_85);
+		das_copy((__mks_85.__rtti),(((void *)(&__type_info__f6ec8d9653d888a5))));
+		das_copy((__mks_85.__finalize),(Func(__context__->fnByMangledName(/*Goo'__finalize S<::Goo>*/ 4784588734145800371u))));
+		return __mks_85;
+	})()));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcrtti_0x60_class_info_dd6db0dfec5c6377
+	aotLib[0x1e52130f51eb1b09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, Goo const  &  ),&_Funcrtti_0x60_class_info_dd6db0dfec5c6377>>();
+	};
+	// finalize_1ce195c4f33bd99c
+	aotLib[0x2d7249bc25d22d99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo * &  ),&finalize_1ce195c4f33bd99c>>();
+	};
+	// finalize_f0a5bc956156a1bc
+	aotLib[0x4bd700492b66433d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Goo &  ),&finalize_f0a5bc956156a1bc>>();
+	};
+	// _Funcrtti_0x60_class_info_50c6f0ce34b2537c
+	aotLib[0xdc81e0b9a650fbc9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, Foo const  &  ),&_Funcrtti_0x60_class_info_50c6f0ce34b2537c>>();
+	};
+	// _Funcrtti_0x60_class_info_425ecbeb287386ff
+	aotLib[0xb6100a538478bf05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, Foo3D const  &  ),&_Funcrtti_0x60_class_info_425ecbeb287386ff>>();
+	};
+	// Foo_978f921bb57cd1cc
+	aotLib[0x9575e16c93c9318e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_978f921bb57cd1cc>>();
+	};
+	// _FuncFoo_0x60_Foo_39b8d39180d6d14
+	aotLib[0xf0e950f99de37b42] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&_FuncFoo_0x60_Foo_39b8d39180d6d14>>();
+	};
+	// Foo_45199f23fc19c274
+	aotLib[0x16e329aef1e83190] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, int32_t  ),&Foo_45199f23fc19c274>>();
+	};
+	// _FuncFoo_0x60_Foo_881fda4335b7b81a
+	aotLib[0xcdcad3331c968845] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , int32_t  ),&_FuncFoo_0x60_Foo_881fda4335b7b81a>>();
+	};
+	// Foo_65ec5213978b4b81
+	aotLib[0x8fb6baeb649db1da] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, int32_t , int32_t  ),&Foo_65ec5213978b4b81>>();
+	};
+	// _FuncFoo_0x60_Foo_620227408c619161
+	aotLib[0x60bebc700843572e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , int32_t , int32_t  ),&_FuncFoo_0x60_Foo_620227408c619161>>();
+	};
+	// _FuncFoo_0x60_set_8c22e0ec3d82d22e
+	aotLib[0x9da6b28c156e5ef1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , int32_t , int32_t  ),&_FuncFoo_0x60_set_8c22e0ec3d82d22e>>();
+	};
+	// _FuncFoo_0x60_ups_669543df32d03699
+	aotLib[0xf73d0a939a87a1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&_FuncFoo_0x60_ups_669543df32d03699>>();
+	};
+	// finalize_453dd213792c24e9
+	aotLib[0xc4c12cab419d0db9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&finalize_453dd213792c24e9>>();
+	};
+	// _FuncFoo_0x27___finalize_502ce87fe4325f9b
+	aotLib[0x5bbab5a4cc6b00ac] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&_FuncFoo_0x27___finalize_502ce87fe4325f9b>>();
+	};
+	// Foo3D_18a0f444853f8302
+	aotLib[0x79ab3cdd4cd27b06] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo3D (*) ( Context * __context__ ),&Foo3D_18a0f444853f8302>>();
+	};
+	// _FuncFoo3D_0x60_Foo3D_a60ac8b8b8be18a6
+	aotLib[0xaf537dd679d655dc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo3D &  ),&_FuncFoo3D_0x60_Foo3D_a60ac8b8b8be18a6>>();
+	};
+	// _FuncFoo3D_0x60_set_38c3fa1fc69af30f
+	aotLib[0x84165f6af89faae6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo3D & , int32_t , int32_t  ),&_FuncFoo3D_0x60_set_38c3fa1fc69af30f>>();
+	};
+	// _FuncFoo3D_0x60_ups_33d344bfc3700bd5
+	aotLib[0x1a4a2231c9e19ea5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo3D &  ),&_FuncFoo3D_0x60_ups_33d344bfc3700bd5>>();
+	};
+	// finalize_cae2ffe3311a4033
+	aotLib[0x21c6c1822f313c80] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo3D &  ),&finalize_cae2ffe3311a4033>>();
+	};
+	// _FuncFoo3D_0x27___finalize_ab7067363d8ec701
+	aotLib[0x946eb2ed6b0a9830] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo3D &  ),&_FuncFoo3D_0x27___finalize_ab7067363d8ec701>>();
+	};
+	// test_foo_85fc9f468454869e
+	aotLib[0x580422a26a0e87fc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_foo_85fc9f468454869e>>();
+	};
+	// test_foo_ptr_a11c2cce673e966
+	aotLib[0xd8654f06181defe6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_foo_ptr_a11c2cce673e966>>();
+	};
+	// _FuncGoo_0x27___finalize_9687127206555bdf
+	aotLib[0x355a7b698a9bd0ef] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Goo &  ),&_FuncGoo_0x27___finalize_9687127206555bdf>>();
+	};
+	// test_rtti_4a31254ebfbfbb04
+	aotLib[0xc5c77b76ba288024] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_rtti_4a31254ebfbfbb04>>();
+	};
+	// test_359b249487062ce3
+	aotLib[0xf2c36b6bad7c0c42] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_359b249487062ce3>>();
+	};
+	// Goo_770046c22aa74584
+	aotLib[0x7faf7b8547b3d03] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Goo (*) ( Context * __context__ ),&Goo_770046c22aa74584>>();
+	};
+	// [[ init script ]]
+	aotLib[0x8142a60f446a1314] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,154 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4373304618096088607 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct iVec2; };
+namespace  {
+
+struct iVec2 {
+	int32_t x;
+	int32_t y;
+};
+static_assert(sizeof(iVec2)==8,"structure size mismatch with DAS");
+static_assert(offsetof(iVec2,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(iVec2,y)==4,"structure field offset mismatch with DAS");
+}
+
+inline iVec2 iVec2_7cc487616f836b2d ( Context * __context__, int32_t __X_rename_at_6, int32_t __Y_rename_at_6 );
+inline iVec2 _FuncSub_936850d0962e7bf0 ( Context * __context__, iVec2 const  & __a_rename_at_9 );
+inline iVec2 _FuncAdd_5408fac711265064 ( Context * __context__, iVec2 const  & __a_rename_at_12, iVec2 const  & __b_rename_at_12 );
+inline bool _FuncEquEqu_5e7a3c36dd321f4f ( Context * __context__, iVec2 const  & __a_rename_at_15, iVec2 const  & __b_rename_at_15 );
+inline bool test_1e04cd71ebe51a91 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline iVec2 iVec2_7cc487616f836b2d ( Context * __context__, int32_t __X_rename_at_6, int32_t __Y_rename_at_6 )
+{
+	return das_auto_cast_ref<iVec2>::cast((([&]() -> iVec2 {
+		iVec2 __mks_7;
+		das_copy((__mks_7.x),(__X_rename_at_6));
+		das_copy((__mks_7.y),(__Y_rename_at_6));
+		return __mks_7;
+	})()));
+}
+
+inline iVec2 _FuncSub_936850d0962e7bf0 ( Context * __context__, iVec2 const  &  __a_rename_at_9 )
+{
+	return das_auto_cast_ref<iVec2>::cast((([&]() -> iVec2 {
+		iVec2 __mks_10;
+		das_copy((__mks_10.x),(-(__a_rename_at_9.x)));
+		das_copy((__mks_10.y),(-(__a_rename_at_9.y)));
+		return __mks_10;
+	})()));
+}
+
+inline iVec2 _FuncAdd_5408fac711265064 ( Context * __context__, iVec2 const  &  __a_rename_at_12, iVec2 const  &  __b_rename_at_12 )
+{
+	return das_auto_cast_ref<iVec2>::cast((([&]() -> iVec2 {
+		iVec2 __mks_13;
+		das_copy((__mks_13.x),((__a_rename_at_12.x + __b_rename_at_12.x)));
+		das_copy((__mks_13.y),((__a_rename_at_12.y + __b_rename_at_12.y)));
+		return __mks_13;
+	})()));
+}
+
+inline bool _FuncEquEqu_5e7a3c36dd321f4f ( Context * __context__, iVec2 const  &  __a_rename_at_15, iVec2 const  &  __b_rename_at_15 )
+{
+	return das_auto_cast<bool>::cast((__a_rename_at_15.x == __b_rename_at_15.x) && (__a_rename_at_15.y == __b_rename_at_15.y));
+}
+
+inline bool test_1e04cd71ebe51a91 ( Context * __context__ )
+{
+	iVec2 _temp_make_local_22_80;
+	iVec2 _temp_make_local_23_112;
+	iVec2 __a_rename_at_20_ConstRef = ((iVec2)iVec2_7cc487616f836b2d(__context__,4,5));
+	iVec2 const  & __a_rename_at_20 = __a_rename_at_20_ConstRef; ;
+	iVec2 __b_rename_at_21_ConstRef = ((iVec2)iVec2_7cc487616f836b2d(__context__,6,7));
+	iVec2 const  & __b_rename_at_21 = __b_rename_at_21_ConstRef; ;
+	DAS_ASSERT((_FuncEquEqu_5e7a3c36dd321f4f(__context__,das_arg<iVec2>::pass(_FuncSub_936850d0962e7bf0(__context__,__a_rename_at_20)),das_arg<iVec2>::pass((_temp_make_local_22_80 = (iVec2_7cc487616f836b2d(__context__,-4,-5)))))));
+	DAS_ASSERT((_FuncEquEqu_5e7a3c36dd321f4f(__context__,das_arg<iVec2>::pass((_FuncAdd_5408fac711265064(__context__,__a_rename_at_20,__b_rename_at_21))),das_arg<iVec2>::pass((_temp_make_local_23_112 = (iVec2_7cc487616f836b2d(__context__,10,12)))))));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// iVec2_7cc487616f836b2d
+	aotLib[0x6e9b90ad2f477749] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<iVec2 (*) ( Context * __context__, int32_t , int32_t  ),&iVec2_7cc487616f836b2d>>();
+	};
+	// _FuncSub_936850d0962e7bf0
+	aotLib[0x80d1453d5bd9fc9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<iVec2 (*) ( Context * __context__, iVec2 const  &  ),&_FuncSub_936850d0962e7bf0>>();
+	};
+	// _FuncAdd_5408fac711265064
+	aotLib[0x284c6e14b1f70fa5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<iVec2 (*) ( Context * __context__, iVec2 const  & , iVec2 const  &  ),&_FuncAdd_5408fac711265064>>();
+	};
+	// _FuncEquEqu_5e7a3c36dd321f4f
+	aotLib[0x4b327676b67b6cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, iVec2 const  & , iVec2 const  &  ),&_FuncEquEqu_5e7a3c36dd321f4f>>();
+	};
+	// test_1e04cd71ebe51a91
+	aotLib[0x8f737d3cd0d9e586] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_1e04cd71ebe51a91>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,193 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12173739315674658976 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Foo; };
+namespace  { struct Foo3D; };
+namespace  {
+
+struct Foo {
+	int32_t x;
+	int32_t y;
+	Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set;
+	Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set2;
+};
+static_assert(sizeof(Foo)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,set)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,set2)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo3D {
+	int32_t x;
+	int32_t y;
+	Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set;
+	Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set2;
+	int32_t z;
+};
+static_assert(sizeof(Foo3D)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo3D,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,set)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,set2)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,z)==24,"structure field offset mismatch with DAS");
+}
+
+inline void Foo_setXY_2efe8cad9c89e8be ( Context * __context__, Foo & __that_rename_at_6, int32_t __x_rename_at_6, int32_t __y_rename_at_6 );
+inline void Foo3D_setXY_61dae193586326f5 ( Context * __context__, Foo3D & __that_rename_at_15, int32_t __x_rename_at_15, int32_t __y_rename_at_15 );
+inline void Foo3D_setXY2_d77b7d83964d2887 ( Context * __context__, Foo & ___that_rename_at_20, int32_t __x_rename_at_20, int32_t __y_rename_at_20 );
+inline bool test_e73d59755974d947 ( Context * __context__ );
+inline Foo Foo_42b1b2c6d29309c5 ( Context * __context__ );
+inline Foo3D Foo3D_a2cfc4b1c6b1ee10 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void Foo_setXY_2efe8cad9c89e8be ( Context * __context__, Foo &  __that_rename_at_6, int32_t __x_rename_at_6, int32_t __y_rename_at_6 )
+{
+	das_copy(__that_rename_at_6.x,__x_rename_at_6);
+	das_copy(__that_rename_at_6.y,__y_rename_at_6);
+}
+
+inline void Foo3D_setXY_61dae193586326f5 ( Context * __context__, Foo3D &  __that_rename_at_15, int32_t __x_rename_at_15, int32_t __y_rename_at_15 )
+{
+	das_copy(__that_rename_at_15.x,__x_rename_at_15);
+	das_copy(__that_rename_at_15.y,__y_rename_at_15);
+	das_copy(__that_rename_at_15.z,0);
+}
+
+inline void Foo3D_setXY2_d77b7d83964d2887 ( Context * __context__, Foo &  ___that_rename_at_20, int32_t __x_rename_at_20, int32_t __y_rename_at_20 )
+{
+	Foo3D * __that_rename_at_22 = &(das_upcast<Foo3D &>::cast(___that_rename_at_20));
+	das_copy((*__that_rename_at_22).x,__x_rename_at_20);
+	das_copy((*__that_rename_at_22).y,__y_rename_at_20);
+	das_copy((*__that_rename_at_22).z,0);
+}
+
+inline bool test_e73d59755974d947 ( Context * __context__ )
+{
+	Foo __f_rename_at_29 = Foo_42b1b2c6d29309c5(__context__);
+	das_invoke_function<void>::invoke<Foo &,int32_t,int32_t>(__context__,nullptr,__f_rename_at_29.set,das_arg<Foo>::pass(das_cast<Foo>::cast(__f_rename_at_29)),1,2);
+	DAS_ASSERT(((__f_rename_at_29.x == 1) && (__f_rename_at_29.y == 2)));
+	Foo3D __f3d_rename_at_32 = Foo3D_a2cfc4b1c6b1ee10(__context__);
+	DAS_ASSERT((((__f3d_rename_at_32.x == 0) && (__f3d_rename_at_32.y == 0)) && (__f3d_rename_at_32.z == 3)));
+	das_invoke_function<void>::invoke<Foo &,int32_t,int32_t>(__context__,nullptr,__f3d_rename_at_32.set,das_arg<Foo>::pass(das_cast<Foo>::cast(__f3d_rename_at_32)),1,2);
+	DAS_ASSERT((((__f3d_rename_at_32.x == 1) && (__f3d_rename_at_32.y == 2)) && (__f3d_rename_at_32.z == 0)));
+	das_copy(__f3d_rename_at_32.z,13);
+	das_invoke_function<void>::invoke<Foo &,int32_t,int32_t>(__context__,nullptr,__f3d_rename_at_32.set2,das_arg<Foo>::pass(das_cast<Foo>::cast(__f3d_rename_at_32)),3,4);
+	DAS_ASSERT((((__f3d_rename_at_32.x == 3) && (__f3d_rename_at_32.y == 4)) && (__f3d_rename_at_32.z == 0)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline Foo Foo_42b1b2c6d29309c5 ( Context * __context__ )
+{
+	return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+		Foo __mks_1;
+		das_copy((__mks_1.x),(0));
+		das_copy((__mks_1.y),(0));
+		das_copy((__mks_1.set),(Func(__context__->fnByMangledName(/*Foo_setXY S<::Foo> Ci Ci*/ 14917834837999096196u))));
+		das_copy((__mks_1.set2),(Func(__context__->fnByMangledName(/*Foo_setXY S<::Foo> Ci Ci*/ 14917834837999096196u))));
+		return __mks_1;
+	})()));
+}
+
+inline Foo3D Foo3D_a2cfc4b1c6b1ee10 ( Context * __context__ )
+{
+	return das_auto_cast_ref<Foo3D>::cast((([&]() -> Foo3D {
+		Foo3D __mks_10;
+		das_copy((__mks_10.x),(0));
+		das_copy((__mks_10.y),(0));
+		das_copy((__mks_10.set),(das_cast<Func DAS_COMMENT((void,Foo,int32_t,int32_t))>::cast(Func(__context__->fnByMangledName(/*Foo3D_setXY S<::Foo3D> Ci Ci*/ 14293176764996915432u)))));
+		das_copy((__mks_10.set2),(Func(__context__->fnByMangledName(/*Foo3D_setXY2 S<::Foo> Ci Ci*/ 13378946640514097791u))));
+		das_copy((__mks_10.z),(3));
+		return __mks_10;
+	})()));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// Foo_setXY_2efe8cad9c89e8be
+	aotLib[0x5c8b5f39369929fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , int32_t , int32_t  ),&Foo_setXY_2efe8cad9c89e8be>>();
+	};
+	// Foo3D_setXY_61dae193586326f5
+	aotLib[0xb4f640dcb5281f89] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo3D & , int32_t , int32_t  ),&Foo3D_setXY_61dae193586326f5>>();
+	};
+	// Foo3D_setXY2_d77b7d83964d2887
+	aotLib[0x17c9e6cd11b40545] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , int32_t , int32_t  ),&Foo3D_setXY2_d77b7d83964d2887>>();
+	};
+	// test_e73d59755974d947
+	aotLib[0xbd1f7115d28ffea5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e73d59755974d947>>();
+	};
+	// Foo_42b1b2c6d29309c5
+	aotLib[0xef4c1e6797a0b917] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_42b1b2c6d29309c5>>();
+	};
+	// Foo3D_a2cfc4b1c6b1ee10
+	aotLib[0xeebb4cccf8498fe6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo3D (*) ( Context * __context__ ),&Foo3D_a2cfc4b1c6b1ee10>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,195 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5897131812899605661 {
+
+extern StructInfo __struct_info__f35ff723fded4627;
+extern TypeInfo __type_info__dfd82b908f3b1490;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__eda11cf9c28f294;
+extern VarInfo __var_info__b457ef1451c3a491;
+extern VarInfo __var_info__42e994392921bdf4;
+extern VarInfo __var_info__8c250e19a21250ae;
+
+VarInfo __struct_info__f35ff723fded4627_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8c250e19a21250ae), "__rtti", 0 };
+TypeInfo * __type_info__b457ef1451c3a491_arg_types_var_17537007207960102439[1] = { &__type_info__dfd82b908f3b1490 };
+VarInfo __struct_info__f35ff723fded4627_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__b457ef1451c3a491_arg_types_var_17537007207960102439, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xb457ef1451c3a491), "__finalize", 8 };
+VarInfo __struct_info__f35ff723fded4627_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xeda11cf9c28f294), "count", 16 };
+TypeInfo * __type_info__42e994392921bdf4_arg_types_var_17537007207960102439[1] = { &__type_info__dfd82b908f3b1490 };
+VarInfo __struct_info__f35ff723fded4627_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, (TypeInfo **)__type_info__42e994392921bdf4_arg_types_var_17537007207960102439, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x42e994392921bdf4), "update", 24 };
+VarInfo * __struct_info__f35ff723fded4627_fields[4] =  { &__struct_info__f35ff723fded4627_field_0, &__struct_info__f35ff723fded4627_field_1, &__struct_info__f35ff723fded4627_field_2, &__struct_info__f35ff723fded4627_field_3 };
+StructInfo __struct_info__f35ff723fded4627 = {"Foo", "", 5, __struct_info__f35ff723fded4627_fields, 4, 32, UINT64_C(0x0), nullptr, UINT64_C(0xf35ff723fded4627) };
+TypeInfo __type_info__dfd82b908f3b1490 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 32, UINT64_C(0xdfd82b908f3b1490) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+	void * __rtti;
+	Func DAS_COMMENT((void,Foo)) __finalize;
+	int32_t count;
+	Func DAS_COMMENT((int32_t,Foo)) update;
+};
+static_assert(sizeof(Foo)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,count)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,update)==24,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_1967eb7c45418ae1 ( Context * __context__, Foo & ____this_rename_at_2 );
+inline void finalize_1ce195c4f33bd99c ( Context * __context__, Foo * & ____this_rename_at_15 );
+inline Foo Foo_1f37d60cef86bd78 ( Context * __context__, int32_t __ic_rename_at_4 );
+inline void _FuncFoo_0x60_Foo_d5a1e813139f61aa ( Context * __context__, Foo & __self_rename_at_4, int32_t __ic_rename_at_4 );
+inline int32_t _FuncFoo_0x60_update_69930b9eef0c7be0 ( Context * __context__, Foo & __self_rename_at_6 );
+inline void _FuncFoo_0x27___finalize_502ce87fe4325f9b ( Context * __context__, Foo & __self_rename_at_2 );
+inline bool test_9f7f3e561fc4d612 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_1967eb7c45418ae1 ( Context * __context__, Foo &  ____this_rename_at_2 )
+{
+	memset(&(____this_rename_at_2), 0, 32);
+}
+
+inline void finalize_1ce195c4f33bd99c ( Context * __context__, Foo * & ____this_rename_at_15 )
+{
+	if ( ____this_rename_at_15 != nullptr )
+	{
+		int32_t ____size_rename_at_15 = ((int32_t)class_rtti_size(das_auto_cast<void * const >::cast(____this_rename_at_15)));
+		das_invoke_function<void>::invoke<Foo &>(__context__,nullptr,____this_rename_at_15->__finalize,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,____this_rename_at_15))));
+		das_delete_persistent<Foo *>::clear(__context__,____this_rename_at_15,____size_rename_at_15);
+		das_copy(____this_rename_at_15,nullptr);
+	};
+}
+
+inline Foo Foo_1f37d60cef86bd78 ( Context * __context__, int32_t __ic_rename_at_4 )
+{
+	Foo __self_rename_at_4; das_zero(__self_rename_at_4); das_move(__self_rename_at_4, (([&]() -> Foo {
+		Foo __mks_4;
+		das_copy((__mks_4.__rtti),(((void *)(&__type_info__dfd82b908f3b1490))));
+		das_copy((__mks_4.__finalize),(Func(__context__->fnByMangledName(/*Foo'__finalize S<::Foo>*/ 3524882781912245377u))));
+		das_copy((__mks_4.count),(0));
+		das_copy((__mks_4.update),(Func(__context__->fnByMangledName(/*Foo`update S<::Foo>*/ 16756678423927542713u))));
+		return __mks_4;
+	})()));
+	_FuncFoo_0x60_Foo_d5a1e813139f61aa(__context__,das_arg<Foo>::pass(__self_rename_at_4),__ic_rename_at_4);
+	return /* <- */ das_auto_cast_move<Foo>::cast(__self_rename_at_4);
+}
+
+inline void _FuncFoo_0x60_Foo_d5a1e813139f61aa ( Context * __context__, Foo &  __self_rename_at_4, int32_t __ic_rename_at_4 )
+{
+	das_copy(__self_rename_at_4.count,__ic_rename_at_4);
+}
+
+inline int32_t _FuncFoo_0x60_update_69930b9eef0c7be0 ( Context * __context__, Foo &  __self_rename_at_6 )
+{
+	return das_auto_cast<int32_t>::cast(__self_rename_at_6.count++);
+}
+
+inline void _FuncFoo_0x27___finalize_502ce87fe4325f9b ( Context * __context__, Foo &  __self_rename_at_2 )
+{
+	finalize_1967eb7c45418ae1(__context__,das_arg<Foo>::pass(__self_rename_at_2));
+}
+
+inline bool test_9f7f3e561fc4d612 ( Context * __context__ )
+{
+	Foo * __pFoo_rename_at_11 = das_new_persistent<Foo>::make_and_init(__context__,[&]() { return Foo_1f37d60cef86bd78(__context__,13); });
+	int32_t __up1_rename_at_12 = ((int32_t)das_invoke_function<int32_t>::invoke<Foo &>(__context__,nullptr,__pFoo_rename_at_11->update,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,__pFoo_rename_at_11)))));
+	int32_t __up2_rename_at_13 = ((int32_t)das_invoke_function<int32_t>::invoke<Foo &>(__context__,nullptr,__pFoo_rename_at_11->update,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,__pFoo_rename_at_11)))));
+	finalize_1ce195c4f33bd99c(__context__,__pFoo_rename_at_11);
+	DAS_ASSERT((__up1_rename_at_12 == 13));
+	DAS_ASSERT((__up2_rename_at_13 == 14));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_1967eb7c45418ae1
+	aotLib[0x47918324ca4ed2a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&finalize_1967eb7c45418ae1>>();
+	};
+	// finalize_1ce195c4f33bd99c
+	aotLib[0x2d7249bc25d22d99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo * &  ),&finalize_1ce195c4f33bd99c>>();
+	};
+	// Foo_1f37d60cef86bd78
+	aotLib[0xff376a4cbd1f49fb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, int32_t  ),&Foo_1f37d60cef86bd78>>();
+	};
+	// _FuncFoo_0x60_Foo_d5a1e813139f61aa
+	aotLib[0xe5be32e15b8aae81] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , int32_t  ),&_FuncFoo_0x60_Foo_d5a1e813139f61aa>>();
+	};
+	// _FuncFoo_0x60_update_69930b9eef0c7be0
+	aotLib[0xdfc6bfb2215d7c31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Foo &  ),&_FuncFoo_0x60_update_69930b9eef0c7be0>>();
+	};
+	// _FuncFoo_0x27___finalize_502ce87fe4325f9b
+	aotLib[0x5f9414feefad492d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&_FuncFoo_0x27___finalize_502ce87fe4325f9b>>();
+	};
+	// test_9f7f3e561fc4d612
+	aotLib[0xaf81c86a66540e94] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_9f7f3e561fc4d612>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,105 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14429897603429194053 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline void fn_with_default_null_ptr_2b6cd1124292a3d0 ( Context * __context__, int32_t * __a_rename_at_1 );
+inline bool test_204c4194cf6285fe ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void fn_with_default_null_ptr_2b6cd1124292a3d0 ( Context * __context__, int32_t * __a_rename_at_1 )
+{
+	int32_t __b_rename_at_2 = 0;
+	das_copy(das_null_coalescing<int32_t &>::get(__a_rename_at_1,__b_rename_at_2),2);
+}
+
+inline bool test_204c4194cf6285fe ( Context * __context__ )
+{
+	TDim<int32_t,5> __t_rename_at_7_ConstRef = ((TDim<int32_t,5>)(([&]() -> TDim<int32_t,5> {
+		TDim<int32_t,5> __mka_7;
+		__mka_7(0,__context__) = 1;
+		__mka_7(1,__context__) = 2;
+		__mka_7(2,__context__) = 3;
+		__mka_7(3,__context__) = 4;
+		__mka_7(4,__context__) = 5;
+		return __mka_7;
+	})()));
+	TDim<int32_t,5> const  & __t_rename_at_7 = __t_rename_at_7_ConstRef; ;
+	int32_t const  * __pt_rename_at_9 = ((int32_t const  *)das_ref(__context__,__t_rename_at_7(0,__context__)));
+	DAS_ASSERT((das_deref(__context__,__pt_rename_at_9) == 1));
+	DAS_ASSERT((((((das_index<int32_t const  * const >::at(__pt_rename_at_9,0,__context__) == 1) && (das_index<int32_t const  * const >::at(__pt_rename_at_9,1,__context__) == 2)) && (das_index<int32_t const  * const >::at(__pt_rename_at_9,2,__context__) == 3)) && (das_index<int32_t const  * const >::at(__pt_rename_at_9,3,__context__) == 4)) && (das_index<int32_t const  * const >::at(__pt_rename_at_9,4,__context__) == 5)));
+	fn_with_default_null_ptr_2b6cd1124292a3d0(__context__,das_auto_cast<int32_t *>::cast(nullptr));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// fn_with_default_null_ptr_2b6cd1124292a3d0
+	aotLib[0xecbf340b8c89fa1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t *  ),&fn_with_default_null_ptr_2b6cd1124292a3d0>>();
+	};
+	// test_204c4194cf6285fe
+	aotLib[0xd3d387ea707e6760] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_204c4194cf6285fe>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,1833 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11986451382265822521 {
+
+extern StructInfo __struct_info__d1c5eb7fd4f061a1;
+extern StructInfo __struct_info__8673687d12c4f24e;
+extern StructInfo __struct_info__d0ba31729e19ca4c;
+extern StructInfo __struct_info__8673667d12c4eee8;
+extern StructInfo __struct_info__d1c5ed7fd4f06507;
+extern StructInfo __struct_info__d0ba34729e19cf65;
+extern TypeInfo __type_info__af63e84c860200f0;
+extern TypeInfo __type_info__1fdd00790fb044fe;
+extern TypeInfo __type_info__47537b4c7b9bc604;
+extern TypeInfo __type_info__6f902bb202c1ac85;
+extern TypeInfo __type_info__502df38abad53a0e;
+extern TypeInfo __type_info__90f4c07b5a6e390;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__5bafe69928470d64;
+extern TypeInfo __type_info__198a21e196d00300;
+extern TypeInfo __type_info__af63df4c8601f1a5;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__b9a1419aa578516;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__c30d245c044acb90;
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__7bf4d07b489ce1e;
+extern TypeInfo __type_info__964115ac42702fc2;
+extern TypeInfo __type_info__b3bb2d75180c6f9b;
+extern TypeInfo __type_info__af63d94c8601e773;
+extern TypeInfo __type_info__af63a74c8601927d;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__f8866cbb82121fe;
+extern TypeInfo __type_info__b790a95547e1ecef;
+extern TypeInfo __type_info__2ae1af192b331746;
+extern TypeInfo __type_info__c3fda6ec581060af;
+extern TypeInfo __type_info__7bf5307b489d850;
+extern TypeInfo __type_info__70bdea0df6685b7a;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__2548679d1136a5b3;
+extern TypeInfo __type_info__f95678735cf0e442;
+extern TypeInfo __type_info__429f822150f7676f;
+extern TypeInfo __type_info__b3c1ad751811b4c9;
+extern TypeInfo __type_info__1fd680790faaffd0;
+extern TypeInfo __type_info__b75c75094bb47869;
+extern TypeInfo __type_info__cdbff50c9a9bc58f;
+extern TypeInfo __type_info__3fc3020fa5048c91;
+extern TypeInfo __type_info__4d35d3193e8d66f2;
+extern TypeInfo __type_info__ce89ac4b7cd19fba;
+extern TypeInfo __type_info__198723e196cdd08f;
+extern TypeInfo __type_info__c7d920a76807486;
+extern VarInfo __var_info__fbafcee8e6b025d3;
+extern VarInfo __var_info__885891cfb74199b3;
+extern VarInfo __var_info__ea66279652a9fab;
+extern VarInfo __var_info__525fa4d29ea163e0;
+extern VarInfo __var_info__d47ad063a4b2f466;
+extern VarInfo __var_info__738e634e82871cd7;
+extern VarInfo __var_info__f683c6904d1790e3;
+extern VarInfo __var_info__56f52810fd9bb871;
+extern VarInfo __var_info__ce420a69708c0eec;
+extern VarInfo __var_info__e6fd7217b83827c5;
+extern VarInfo __var_info__d7e2a37aad2448cf;
+extern VarInfo __var_info__11010433d9e4affe;
+extern VarInfo __var_info__c670af0f18bf380a;
+extern VarInfo __var_info__eaf690368ac4030e;
+extern VarInfo __var_info__41c52e23e3db681f;
+extern VarInfo __var_info__5c036500f5726077;
+extern VarInfo __var_info__6d856a255643cbcb;
+extern VarInfo __var_info__29dfa3561f6685fa;
+extern VarInfo __var_info__d0246a937df1e6cb;
+extern VarInfo __var_info__3a77185e75a8d234;
+extern VarInfo __var_info__4291eb0fbc670806;
+extern VarInfo __var_info__2d536663f8fd9c8d;
+extern VarInfo __var_info__b7bdcce9d275628a;
+extern VarInfo __var_info__2fd6f0deb760ddc4;
+extern VarInfo __var_info__2797bfd54a7bb99;
+extern VarInfo __var_info__f9243b60fab0e31a;
+extern VarInfo __var_info__b481e5947dd77fea;
+extern VarInfo __var_info__332dc2b4840e0aed;
+extern VarInfo __var_info__f21dbae0e0c8287f;
+extern VarInfo __var_info__26f82e65644808a1;
+extern VarInfo __var_info__4bdfc0992c6d5877;
+extern VarInfo __var_info__6c9b3e0fa18018c3;
+extern VarInfo __var_info__15535ea7ae518cf5;
+extern VarInfo __var_info__b33e5117f988a64d;
+extern VarInfo __var_info__3329a7027bc86671;
+extern VarInfo __var_info__ebced841b46e0041;
+extern VarInfo __var_info__945738b586de92b5;
+extern VarInfo __var_info__e46f1c52d5805022;
+extern VarInfo __var_info__9fddd9870fa3bbf1;
+extern VarInfo __var_info__e263d626742f7d48;
+extern VarInfo __var_info__df143957d8e2e118;
+extern VarInfo __var_info__bb0ba1a67698fa5f;
+extern VarInfo __var_info__1478b967163451ae;
+extern VarInfo __var_info__d2e1adf736a59829;
+extern VarInfo __var_info__19e24bd25d52bed8;
+extern VarInfo __var_info__ffb39c5d70a30e4;
+extern VarInfo __var_info__103aa8f4183424f4;
+extern VarInfo __var_info__d82234ae3690efcc;
+extern VarInfo __var_info__a1b710dfaebc1d7b;
+extern VarInfo __var_info__a6f07f136fe130e;
+extern VarInfo __var_info__a369f3b79cdf7a0b;
+extern VarInfo __var_info__2626cdbf873c13c8;
+extern VarInfo __var_info__753d8c48e141c07b;
+extern VarInfo __var_info__97611c6cff6a6526;
+extern VarInfo __var_info__fb09fa3486bec470;
+extern VarInfo __var_info__a288e2df0584b05d;
+extern VarInfo __var_info__73a3ab4e2eb3f206;
+extern VarInfo __var_info__b18f02cb5414d4b9;
+extern VarInfo __var_info__703a7f9428de29e4;
+extern VarInfo __var_info__4a25183b6b0ae47b;
+extern VarInfo __var_info__48d9fe5cd15fa351;
+extern VarInfo __var_info__8a007cd8048af1de;
+extern VarInfo __var_info__dd8a27586a177ade;
+extern FuncInfo __func_info__2c12a6aa37521148;
+extern FuncInfo __func_info__42b9ab3569fc8cc2;
+extern FuncInfo __func_info__6ad1e3a2ee25c238;
+extern FuncInfo __func_info__ed882aeeee77d685;
+extern FuncInfo __func_info__fde63a99772d772a;
+extern FuncInfo __func_info__111e1cc17e1f6877;
+extern FuncInfo __func_info__4630f883740fb23c;
+extern FuncInfo __func_info__93b32dbff1ee41dc;
+extern FuncInfo __func_info__c13635b7462011bb;
+extern FuncInfo __func_info__d3151a2573df63e7;
+
+TypeInfo * __type_info__b481e5947dd77fea_arg_types_var_15115746658604835233[2] = { &__type_info__1fd680790faaffd0, &__type_info__7bf4d07b489ce1e };
+VarInfo __struct_info__d1c5eb7fd4f061a1_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__b481e5947dd77fea_arg_types_var_15115746658604835233, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xb481e5947dd77fea), "__lambda", 0 };
+TypeInfo * __type_info__f21dbae0e0c8287f_arg_types_var_15115746658604835233[1] = { &__type_info__5bafe69928470d64 };
+VarInfo __struct_info__d1c5eb7fd4f061a1_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f21dbae0e0c8287f_arg_types_var_15115746658604835233, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xf21dbae0e0c8287f), "__finalize", 8 };
+VarInfo __struct_info__d1c5eb7fd4f061a1_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa6f07f136fe130e), "__yield", 16 };
+VarInfo __struct_info__d1c5eb7fd4f061a1_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ce89ac4b7cd19fba, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe6fd7217b83827c5), "pinfo", 24 };
+VarInfo __struct_info__d1c5eb7fd4f061a1_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x945738b586de92b5), "___loop_at_73_rename_at_73", 32 };
+VarInfo __struct_info__d1c5eb7fd4f061a1_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x15535ea7ae518cf5), "__index_rename_at_73", 36 };
+VarInfo __struct_info__d1c5eb7fd4f061a1_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x2797bfd54a7bb99), "___pvar_0_at_73_rename_at_73", 40 };
+VarInfo __struct_info__d1c5eb7fd4f061a1_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x2d536663f8fd9c8d), "___source_0_at_73_rename_at_73", 48 };
+VarInfo * __struct_info__d1c5eb7fd4f061a1_fields[8] =  { &__struct_info__d1c5eb7fd4f061a1_field_0, &__struct_info__d1c5eb7fd4f061a1_field_1, &__struct_info__d1c5eb7fd4f061a1_field_2, &__struct_info__d1c5eb7fd4f061a1_field_3, &__struct_info__d1c5eb7fd4f061a1_field_4, &__struct_info__d1c5eb7fd4f061a1_field_5, &__struct_info__d1c5eb7fd4f061a1_field_6, &__struct_info__d1c5eb7fd4f061a1_field_7 };
+StructInfo __struct_info__d1c5eb7fd4f061a1 = {"_lambda_thismodule_72_12_2", "", 14, __struct_info__d1c5eb7fd4f061a1_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0xd1c5eb7fd4f061a1) };
+TypeInfo * __type_info__ea66279652a9fab_arg_types_var_9688202109799166542[2] = { &__type_info__b3c1ad751811b4c9, &__type_info__b75c75094bb47869 };
+VarInfo __struct_info__8673687d12c4f24e_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__ea66279652a9fab_arg_types_var_9688202109799166542, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xea66279652a9fab), "__lambda", 0 };
+TypeInfo * __type_info__c670af0f18bf380a_arg_types_var_9688202109799166542[1] = { &__type_info__3fc3020fa5048c91 };
+VarInfo __struct_info__8673687d12c4f24e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__c670af0f18bf380a_arg_types_var_9688202109799166542, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xc670af0f18bf380a), "__finalize", 8 };
+VarInfo __struct_info__8673687d12c4f24e_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xebced841b46e0041), "__yield", 16 };
+VarInfo __struct_info__8673687d12c4f24e_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c3fda6ec581060af, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xdd8a27586a177ade), "pinfo", 24 };
+VarInfo __struct_info__8673687d12c4f24e_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xe263d626742f7d48), "___loop_at_55_rename_at_55", 32 };
+VarInfo __struct_info__8673687d12c4f24e_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x3a77185e75a8d234), "__index_rename_at_55", 36 };
+VarInfo __struct_info__8673687d12c4f24e_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xfb09fa3486bec470), "___pvar_0_at_55_rename_at_55", 40 };
+VarInfo __struct_info__8673687d12c4f24e_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xce420a69708c0eec), "___source_0_at_55_rename_at_55", 48 };
+VarInfo * __struct_info__8673687d12c4f24e_fields[8] =  { &__struct_info__8673687d12c4f24e_field_0, &__struct_info__8673687d12c4f24e_field_1, &__struct_info__8673687d12c4f24e_field_2, &__struct_info__8673687d12c4f24e_field_3, &__struct_info__8673687d12c4f24e_field_4, &__struct_info__8673687d12c4f24e_field_5, &__struct_info__8673687d12c4f24e_field_6, &__struct_info__8673687d12c4f24e_field_7 };
+StructInfo __struct_info__8673687d12c4f24e = {"_lambda_thismodule_54_12_3", "", 14, __struct_info__8673687d12c4f24e_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0x8673687d12c4f24e) };
+TypeInfo * __type_info__a288e2df0584b05d_arg_types_var_15040388273905715788[2] = { &__type_info__198723e196cdd08f, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__d0ba31729e19ca4c_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__a288e2df0584b05d_arg_types_var_15040388273905715788, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xa288e2df0584b05d), "__lambda", 0 };
+TypeInfo * __type_info__703a7f9428de29e4_arg_types_var_15040388273905715788[1] = { &__type_info__b790a95547e1ecef };
+VarInfo __struct_info__d0ba31729e19ca4c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__703a7f9428de29e4_arg_types_var_15040388273905715788, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x703a7f9428de29e4), "__finalize", 8 };
+VarInfo __struct_info__d0ba31729e19ca4c_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x6d856a255643cbcb), "__yield", 16 };
+VarInfo __struct_info__d0ba31729e19ca4c_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c3fda6ec581060af, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x103aa8f4183424f4), "pinfo", 24 };
+VarInfo __struct_info__d0ba31729e19ca4c_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x4291eb0fbc670806), "_loop_at_40", 32 };
+VarInfo __struct_info__d0ba31729e19ca4c_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xffb39c5d70a30e4), "index", 36 };
+VarInfo __struct_info__d0ba31729e19ca4c_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xeaf690368ac4030e), "_pvar_0_at_40", 40 };
+VarInfo __struct_info__d0ba31729e19ca4c_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x29dfa3561f6685fa), "_source_0_at_40", 48 };
+VarInfo * __struct_info__d0ba31729e19ca4c_fields[8] =  { &__struct_info__d0ba31729e19ca4c_field_0, &__struct_info__d0ba31729e19ca4c_field_1, &__struct_info__d0ba31729e19ca4c_field_2, &__struct_info__d0ba31729e19ca4c_field_3, &__struct_info__d0ba31729e19ca4c_field_4, &__struct_info__d0ba31729e19ca4c_field_5, &__struct_info__d0ba31729e19ca4c_field_6, &__struct_info__d0ba31729e19ca4c_field_7 };
+StructInfo __struct_info__d0ba31729e19ca4c = {"_lambda_thismodule_40_21_6", "", 14, __struct_info__d0ba31729e19ca4c_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0xd0ba31729e19ca4c) };
+TypeInfo * __type_info__b18f02cb5414d4b9_arg_types_var_9688199910775910120[2] = { &__type_info__b3bb2d75180c6f9b, &__type_info__b75c75094bb47869 };
+VarInfo __struct_info__8673667d12c4eee8_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__b18f02cb5414d4b9_arg_types_var_9688199910775910120, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xb18f02cb5414d4b9), "__lambda", 0 };
+TypeInfo * __type_info__df143957d8e2e118_arg_types_var_9688199910775910120[1] = { &__type_info__429f822150f7676f };
+VarInfo __struct_info__8673667d12c4eee8_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__df143957d8e2e118_arg_types_var_9688199910775910120, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xdf143957d8e2e118), "__finalize", 8 };
+VarInfo __struct_info__8673667d12c4eee8_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x41c52e23e3db681f), "__yield", 16 };
+VarInfo __struct_info__8673667d12c4eee8_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ce89ac4b7cd19fba, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x19e24bd25d52bed8), "pinfo", 24 };
+VarInfo __struct_info__8673667d12c4eee8_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xe46f1c52d5805022), "___loop_at_55_rename_at_55", 32 };
+VarInfo __struct_info__8673667d12c4eee8_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x1478b967163451ae), "__index_rename_at_55", 36 };
+VarInfo __struct_info__8673667d12c4eee8_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8a007cd8048af1de), "___pvar_0_at_55_rename_at_55", 40 };
+VarInfo __struct_info__8673667d12c4eee8_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xf9243b60fab0e31a), "___source_0_at_55_rename_at_55", 48 };
+VarInfo * __struct_info__8673667d12c4eee8_fields[8] =  { &__struct_info__8673667d12c4eee8_field_0, &__struct_info__8673667d12c4eee8_field_1, &__struct_info__8673667d12c4eee8_field_2, &__struct_info__8673667d12c4eee8_field_3, &__struct_info__8673667d12c4eee8_field_4, &__struct_info__8673667d12c4eee8_field_5, &__struct_info__8673667d12c4eee8_field_6, &__struct_info__8673667d12c4eee8_field_7 };
+StructInfo __struct_info__8673667d12c4eee8 = {"_lambda_thismodule_54_12_1", "", 14, __struct_info__8673667d12c4eee8_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0x8673667d12c4eee8) };
+TypeInfo * __type_info__2fd6f0deb760ddc4_arg_types_var_15115748857628091655[2] = { &__type_info__1fdd00790fb044fe, &__type_info__7bf4d07b489ce1e };
+VarInfo __struct_info__d1c5ed7fd4f06507_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__2fd6f0deb760ddc4_arg_types_var_15115748857628091655, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x2fd6f0deb760ddc4), "__lambda", 0 };
+TypeInfo * __type_info__3329a7027bc86671_arg_types_var_15115748857628091655[1] = { &__type_info__f8866cbb82121fe };
+VarInfo __struct_info__d1c5ed7fd4f06507_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__3329a7027bc86671_arg_types_var_15115748857628091655, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x3329a7027bc86671), "__finalize", 8 };
+VarInfo __struct_info__d1c5ed7fd4f06507_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x525fa4d29ea163e0), "__yield", 16 };
+VarInfo __struct_info__d1c5ed7fd4f06507_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c3fda6ec581060af, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xa1b710dfaebc1d7b), "pinfo", 24 };
+VarInfo __struct_info__d1c5ed7fd4f06507_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xa369f3b79cdf7a0b), "___loop_at_73_rename_at_73", 32 };
+VarInfo __struct_info__d1c5ed7fd4f06507_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x885891cfb74199b3), "__index_rename_at_73", 36 };
+VarInfo __struct_info__d1c5ed7fd4f06507_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x6c9b3e0fa18018c3), "___pvar_0_at_73_rename_at_73", 40 };
+VarInfo __struct_info__d1c5ed7fd4f06507_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xbb0ba1a67698fa5f), "___source_0_at_73_rename_at_73", 48 };
+VarInfo * __struct_info__d1c5ed7fd4f06507_fields[8] =  { &__struct_info__d1c5ed7fd4f06507_field_0, &__struct_info__d1c5ed7fd4f06507_field_1, &__struct_info__d1c5ed7fd4f06507_field_2, &__struct_info__d1c5ed7fd4f06507_field_3, &__struct_info__d1c5ed7fd4f06507_field_4, &__struct_info__d1c5ed7fd4f06507_field_5, &__struct_info__d1c5ed7fd4f06507_field_6, &__struct_info__d1c5ed7fd4f06507_field_7 };
+StructInfo __struct_info__d1c5ed7fd4f06507 = {"_lambda_thismodule_72_12_4", "", 14, __struct_info__d1c5ed7fd4f06507_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0xd1c5ed7fd4f06507) };
+TypeInfo * __type_info__11010433d9e4affe_arg_types_var_15040391572440600421[2] = { &__type_info__198a21e196d00300, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__d0ba34729e19cf65_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__11010433d9e4affe_arg_types_var_15040391572440600421, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x11010433d9e4affe), "__lambda", 0 };
+TypeInfo * __type_info__753d8c48e141c07b_arg_types_var_15040391572440600421[1] = { &__type_info__47537b4c7b9bc604 };
+VarInfo __struct_info__d0ba34729e19cf65_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__753d8c48e141c07b_arg_types_var_15040391572440600421, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x753d8c48e141c07b), "__finalize", 8 };
+VarInfo __struct_info__d0ba34729e19cf65_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xb7bdcce9d275628a), "__yield", 16 };
+VarInfo __struct_info__d0ba34729e19cf65_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ce89ac4b7cd19fba, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x26f82e65644808a1), "pinfo", 24 };
+VarInfo __struct_info__d0ba34729e19cf65_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xf683c6904d1790e3), "_loop_at_40", 32 };
+VarInfo __struct_info__d0ba34729e19cf65_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xd2e1adf736a59829), "index", 36 };
+VarInfo __struct_info__d0ba34729e19cf65_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x4a25183b6b0ae47b), "_pvar_0_at_40", 40 };
+VarInfo __struct_info__d0ba34729e19cf65_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x4bdfc0992c6d5877), "_source_0_at_40", 48 };
+VarInfo * __struct_info__d0ba34729e19cf65_fields[8] =  { &__struct_info__d0ba34729e19cf65_field_0, &__struct_info__d0ba34729e19cf65_field_1, &__struct_info__d0ba34729e19cf65_field_2, &__struct_info__d0ba34729e19cf65_field_3, &__struct_info__d0ba34729e19cf65_field_4, &__struct_info__d0ba34729e19cf65_field_5, &__struct_info__d0ba34729e19cf65_field_6, &__struct_info__d0ba34729e19cf65_field_7 };
+StructInfo __struct_info__d0ba34729e19cf65 = {"_lambda_thismodule_40_21_5", "", 14, __struct_info__d0ba34729e19cf65_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0xd0ba34729e19cf65) };
+VarInfo __func_info__2c12a6aa37521148_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xfbafcee8e6b025d3), "name", 0 };
+VarInfo __func_info__2c12a6aa37521148_field_1 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0x2626cdbf873c13c8), "cppName", 0 };
+VarInfo __func_info__2c12a6aa37521148_field_2 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::TypeInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24622, 80, UINT64_C(0x5c036500f5726077), "xtype", 0 };
+VarInfo __func_info__2c12a6aa37521148_field_3 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x48d9fe5cd15fa351), "offset", 0 };
+VarInfo * __func_info__2c12a6aa37521148_fields[4] =  { &__func_info__2c12a6aa37521148_field_0, &__func_info__2c12a6aa37521148_field_1, &__func_info__2c12a6aa37521148_field_2, &__func_info__2c12a6aa37521148_field_3 };
+FuncInfo __func_info__2c12a6aa37521148 = {"invoke block<(name:string;cppName:string;xtype:rtti::TypeInfo const;offset:uint):void> const", "", __func_info__2c12a6aa37521148_fields, 4, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x2c12a6aa37521148), 0x0 };
+VarInfo __func_info__42b9ab3569fc8cc2_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::FuncInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24622, 64, UINT64_C(0xd0246a937df1e6cb), "finfo", 0 };
+VarInfo * __func_info__42b9ab3569fc8cc2_fields[1] =  { &__func_info__42b9ab3569fc8cc2_field_0 };
+FuncInfo __func_info__42b9ab3569fc8cc2 = {"invoke block<(finfo:rtti::FuncInfo const):void> const", "", __func_info__42b9ab3569fc8cc2_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x42b9ab3569fc8cc2), 0x0 };
+VarInfo __func_info__6ad1e3a2ee25c238_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::Annotation"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8226, 88, UINT64_C(0x56f52810fd9bb871), "ann", 0 };
+VarInfo __func_info__6ad1e3a2ee25c238_field_1 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::AnnotationArguments"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8226, 24, UINT64_C(0x73a3ab4e2eb3f206), "annArgs", 0 };
+VarInfo * __func_info__6ad1e3a2ee25c238_fields[2] =  { &__func_info__6ad1e3a2ee25c238_field_0, &__func_info__6ad1e3a2ee25c238_field_1 };
+FuncInfo __func_info__6ad1e3a2ee25c238 = {"invoke block<(ann:rtti::Annotation const;annArgs:rtti::AnnotationArguments const):void> const", "", __func_info__6ad1e3a2ee25c238_fields, 2, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x6ad1e3a2ee25c238), 0x0 };
+VarInfo __func_info__ed882aeeee77d685_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::StructInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16430, 64, UINT64_C(0x738e634e82871cd7), "sinfo", 0 };
+VarInfo * __func_info__ed882aeeee77d685_fields[1] =  { &__func_info__ed882aeeee77d685_field_0 };
+FuncInfo __func_info__ed882aeeee77d685 = {"invoke block<(sinfo:rtti::StructInfo const):void> const", "", __func_info__ed882aeeee77d685_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xed882aeeee77d685), 0x0 };
+VarInfo __func_info__fde63a99772d772a_field_0 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x332dc2b4840e0aed), "ok", 0 };
+VarInfo __func_info__fde63a99772d772a_field_1 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__964115ac42702fc2, nullptr, nullptr, nullptr, 0, 0, nullptr, 11264, 8, UINT64_C(0xd7e2a37aad2448cf), "prog", 0 };
+VarInfo __func_info__fde63a99772d772a_field_2 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 32, UINT64_C(0x9fddd9870fa3bbf1), "errors", 0 };
+VarInfo * __func_info__fde63a99772d772a_fields[3] =  { &__func_info__fde63a99772d772a_field_0, &__func_info__fde63a99772d772a_field_1, &__func_info__fde63a99772d772a_field_2 };
+FuncInfo __func_info__fde63a99772d772a = {"invoke block<(ok:bool;prog:smart_ptr<rtti::Program>;errors:$::das_string const):void> const", "", __func_info__fde63a99772d772a_fields, 3, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xfde63a99772d772a), 0x0 };
+VarInfo __func_info__111e1cc17e1f6877_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::EnumInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16430, 40, UINT64_C(0xb33e5117f988a64d), "einfo", 0 };
+VarInfo * __func_info__111e1cc17e1f6877_fields[1] =  { &__func_info__111e1cc17e1f6877_field_0 };
+FuncInfo __func_info__111e1cc17e1f6877 = {"invoke block<(einfo:rtti::EnumInfo const):void> const", "", __func_info__111e1cc17e1f6877_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x111e1cc17e1f6877), 0x0 };
+VarInfo __func_info__4630f883740fb23c_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::VarInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24614, 128, UINT64_C(0x97611c6cff6a6526), "glob", 0 };
+VarInfo * __func_info__4630f883740fb23c_fields[1] =  { &__func_info__4630f883740fb23c_field_0 };
+FuncInfo __func_info__4630f883740fb23c = {"invoke block<(glob:rtti::VarInfo const):void> const", "", __func_info__4630f883740fb23c_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x4630f883740fb23c), 0x0 };
+VarInfo __func_info__93b32dbff1ee41dc_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::VarInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24614, 128, UINT64_C(0xd82234ae3690efcc), "vinfo", 0 };
+VarInfo * __func_info__93b32dbff1ee41dc_fields[1] =  { &__func_info__93b32dbff1ee41dc_field_0 };
+FuncInfo __func_info__93b32dbff1ee41dc = {"invoke block<(vinfo:rtti::VarInfo const):void> const", "", __func_info__93b32dbff1ee41dc_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x93b32dbff1ee41dc), 0x0 };
+VarInfo __func_info__c13635b7462011bb_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__502df38abad53a0e, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xd47ad063a4b2f466), "mod", 0 };
+VarInfo * __func_info__c13635b7462011bb_fields[1] =  { &__func_info__c13635b7462011bb_field_0 };
+FuncInfo __func_info__c13635b7462011bb = {"invoke block<(mod:rtti::Module?):void> const", "", __func_info__c13635b7462011bb_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xc13635b7462011bb), 0x0 };
+VarInfo __func_info__d3151a2573df63e7_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::Annotation"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8226, 88, UINT64_C(0x56f52810fd9bb871), "ann", 0 };
+VarInfo * __func_info__d3151a2573df63e7_fields[1] =  { &__func_info__d3151a2573df63e7_field_0 };
+FuncInfo __func_info__d3151a2573df63e7 = {"invoke block<(ann:rtti::Annotation const):void> const", "", __func_info__d3151a2573df63e7_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xd3151a2573df63e7), 0x0 };
+TypeInfo __type_info__af63e84c860200f0 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e84c860200f0) };
+TypeInfo __type_info__1fdd00790fb044fe = { Type::tStructure, &__struct_info__d1c5ed7fd4f06507, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0x1fdd00790fb044fe) };
+TypeInfo __type_info__47537b4c7b9bc604 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__198a21e196d00300, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x47537b4c7b9bc604) };
+TypeInfo __type_info__6f902bb202c1ac85 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, UINT64_C(0x6f902bb202c1ac85) };
+TypeInfo __type_info__502df38abad53a0e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::Module"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 1120, UINT64_C(0x502df38abad53a0e) };
+TypeInfo __type_info__90f4c07b5a6e390 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0x90f4c07b5a6e390) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__5bafe69928470d64 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1fd680790faaffd0, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x5bafe69928470d64) };
+TypeInfo __type_info__198a21e196d00300 = { Type::tStructure, &__struct_info__d0ba34729e19cf65, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0x198a21e196d00300) };
+TypeInfo __type_info__af63df4c8601f1a5 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf63df4c8601f1a5) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__b9a1419aa578516 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16548, 8, UINT64_C(0xb9a1419aa578516) };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__c30d245c044acb90 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 32, UINT64_C(0xc30d245c044acb90) };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63db4c8601ead9) };
+TypeInfo __type_info__7bf4d07b489ce1e = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16645, 8, UINT64_C(0x7bf4d07b489ce1e) };
+TypeInfo __type_info__964115ac42702fc2 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8194, 368, UINT64_C(0x964115ac42702fc2) };
+TypeInfo __type_info__b3bb2d75180c6f9b = { Type::tStructure, &__struct_info__8673667d12c4eee8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0xb3bb2d75180c6f9b) };
+TypeInfo __type_info__af63d94c8601e773 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xaf63d94c8601e773) };
+TypeInfo __type_info__af63a74c8601927d = { Type::anyArgument, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 16, UINT64_C(0xaf63a74c8601927d) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__f8866cbb82121fe = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1fdd00790fb044fe, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xf8866cbb82121fe) };
+TypeInfo __type_info__b790a95547e1ecef = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__198723e196cdd08f, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xb790a95547e1ecef) };
+TypeInfo __type_info__2ae1af192b331746 = { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0x2ae1af192b331746) };
+TypeInfo __type_info__c3fda6ec581060af = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::TypeInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24622, 80, UINT64_C(0xc3fda6ec581060af) };
+TypeInfo __type_info__7bf5307b489d850 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0x7bf5307b489d850) };
+TypeInfo * __type_info__70bdea0df6685b7a_arg_types[9] = { &__type_info__af63df4c8601f1a5, &__type_info__af63e44c8601fa24, &__type_info__af63e84c860200f0, &__type_info__2ae1af192b331746, &__type_info__4d35d3193e8d66f2, &__type_info__af63db4c8601ead9, &__type_info__af63d94c8601e773, &__type_info__af63ee4c86020b22, &__type_info__af63a74c8601927d };
+const char * __type_info__70bdea0df6685b7a_arg_names[9] = { "tBool", "tInt", "tUInt", "tInt64", "tUInt64", "tFloat", "tDouble", "tString", "nothing" };
+TypeInfo __type_info__70bdea0df6685b7a = { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__70bdea0df6685b7a_arg_types, __type_info__70bdea0df6685b7a_arg_names, 9, 0, nullptr, 16422, 32, UINT64_C(0x70bdea0df6685b7a) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+TypeInfo __type_info__2548679d1136a5b3 = { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0x2548679d1136a5b3) };
+TypeInfo __type_info__f95678735cf0e442 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 40, UINT64_C(0xf95678735cf0e442) };
+TypeInfo __type_info__429f822150f7676f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b3bb2d75180c6f9b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x429f822150f7676f) };
+TypeInfo __type_info__b3c1ad751811b4c9 = { Type::tStructure, &__struct_info__8673687d12c4f24e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0xb3c1ad751811b4c9) };
+TypeInfo __type_info__1fd680790faaffd0 = { Type::tStructure, &__struct_info__d1c5eb7fd4f061a1, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0x1fd680790faaffd0) };
+TypeInfo __type_info__b75c75094bb47869 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c3fda6ec581060af, nullptr, nullptr, nullptr, 0, 0, nullptr, 24845, 8, UINT64_C(0xb75c75094bb47869) };
+TypeInfo __type_info__cdbff50c9a9bc58f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::Context"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24834, 1072, UINT64_C(0xcdbff50c9a9bc58f) };
+TypeInfo __type_info__3fc3020fa5048c91 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b3c1ad751811b4c9, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x3fc3020fa5048c91) };
+TypeInfo __type_info__4d35d3193e8d66f2 = { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0x4d35d3193e8d66f2) };
+TypeInfo __type_info__ce89ac4b7cd19fba = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::VarInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24614, 128, UINT64_C(0xce89ac4b7cd19fba) };
+TypeInfo __type_info__198723e196cdd08f = { Type::tStructure, &__struct_info__d0ba31729e19ca4c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0x198723e196cdd08f) };
+TypeInfo __type_info__c7d920a76807486 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 290, 32, UINT64_C(0xc7d920a76807486) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__502df38abad53a0e.resolveAnnotation();
+	__type_info__c30d245c044acb90.resolveAnnotation();
+	__type_info__964115ac42702fc2.resolveAnnotation();
+	__type_info__c3fda6ec581060af.resolveAnnotation();
+	__type_info__f95678735cf0e442.resolveAnnotation();
+	__type_info__cdbff50c9a9bc58f.resolveAnnotation();
+	__type_info__ce89ac4b7cd19fba.resolveAnnotation();
+	__type_info__c7d920a76807486.resolveAnnotation();
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__6f902bb202c1ac85 };
+TypeInfo * __tinfo_1[2] = { &__type_info__f95678735cf0e442, &__type_info__b9a1419aa578516 };
+TypeInfo * __tinfo_2[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_3[2] = { &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_4[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_5[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_6[3] = { &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_7[2] = { &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_8[1] = { &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_9[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63e44c8601fa24, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_10[2] = { &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_11[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_12[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_13[3] = { &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_14[2] = { &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_15[1] = { &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_16[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63e44c8601fa24, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_17[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__70bdea0df6685b7a, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_18[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__70bdea0df6685b7a };
+TypeInfo * __tinfo_19[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_20[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__2548679d1136a5b3, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_21[2] = { &__type_info__c7d920a76807486, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_22[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__c7d920a76807486, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_23[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_24[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__c7d920a76807486, &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641, &__type_info__90f3d07b5a6ca13, &__type_info__c7d920a76807486, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_25[9] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13, &__type_info__af63e84c860200f0, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_26[4] = { &__type_info__c7d920a76807486, &__type_info__90f3d07b5a6ca13, &__type_info__c7d920a76807486, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_27[2] = { &__type_info__c7d920a76807486, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_28[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_29[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_30[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_31[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_32[6] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_33[2] = { &__type_info__cdbff50c9a9bc58f, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_34[2] = { &__type_info__cdbff50c9a9bc58f, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_35[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__c30d245c044acb90, &__type_info__90f3d07b5a6ca13 };
+namespace  { struct _lambda_thismodule_54_12_1; };
+namespace  { struct _lambda_thismodule_72_12_2; };
+namespace  { struct _lambda_thismodule_54_12_3; };
+namespace  { struct _lambda_thismodule_72_12_4; };
+namespace  { struct _lambda_thismodule_40_21_5; };
+namespace  { struct _lambda_thismodule_40_21_6; };
+// unused enumeration CompilationError
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+	none = int32_t(INT64_C(0)),
+	autoinfer = int32_t(INT64_C(1)),
+	alias = int32_t(INT64_C(2)),
+	fakeContext = int32_t(INT64_C(3)),
+	fakeLineInfo = int32_t(INT64_C(4)),
+	anyArgument = int32_t(INT64_C(5)),
+	tVoid = int32_t(INT64_C(6)),
+	tBool = int32_t(INT64_C(7)),
+	tInt64 = int32_t(INT64_C(12)),
+	tUInt64 = int32_t(INT64_C(13)),
+	tInt = int32_t(INT64_C(14)),
+	tInt2 = int32_t(INT64_C(15)),
+	tInt3 = int32_t(INT64_C(16)),
+	tInt4 = int32_t(INT64_C(17)),
+	tUInt = int32_t(INT64_C(18)),
+	tUInt2 = int32_t(INT64_C(19)),
+	tUInt3 = int32_t(INT64_C(20)),
+	tUInt4 = int32_t(INT64_C(21)),
+	tFloat = int32_t(INT64_C(22)),
+	tFloat2 = int32_t(INT64_C(23)),
+	tFloat3 = int32_t(INT64_C(24)),
+	tFloat4 = int32_t(INT64_C(25)),
+	tDouble = int32_t(INT64_C(26)),
+	tRange = int32_t(INT64_C(27)),
+	tURange = int32_t(INT64_C(28)),
+	tString = int32_t(INT64_C(29)),
+	tStructure = int32_t(INT64_C(30)),
+	tHandle = int32_t(INT64_C(31)),
+	tEnumeration = int32_t(INT64_C(32)),
+	tPointer = int32_t(INT64_C(36)),
+	tFunction = int32_t(INT64_C(37)),
+	tLambda = int32_t(INT64_C(38)),
+	tIterator = int32_t(INT64_C(39)),
+	tArray = int32_t(INT64_C(40)),
+	tTable = int32_t(INT64_C(41)),
+	tBlock = int32_t(INT64_C(42)),
+	tInt8 = int32_t(INT64_C(8)),
+	tUInt8 = int32_t(INT64_C(9)),
+	tInt16 = int32_t(INT64_C(10)),
+	tUInt16 = int32_t(INT64_C(11)),
+	tTuple = int32_t(INT64_C(43)),
+	tEnumeration8 = int32_t(INT64_C(33)),
+	tEnumeration16 = int32_t(INT64_C(34)),
+	tVariant = int32_t(INT64_C(44)),
+	tBitfield = int32_t(INT64_C(35)),
+};
+}
+#endif // external enum
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+namespace  {
+
+struct _lambda_thismodule_54_12_1 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_54_12_1,TypeInfo const  * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_54_12_1 *)) __finalize;
+	int32_t __yield;
+	VarInfo const  * pinfo;
+	bool ___loop_at_55_rename_at_55;
+	int32_t __index_rename_at_55;
+	void * ___pvar_0_at_55_rename_at_55;
+	Sequence DAS_COMMENT((int32_t)) ___source_0_at_55_rename_at_55;
+};
+static_assert(sizeof(_lambda_thismodule_54_12_1)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_1,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_1,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_1,___loop_at_55_rename_at_55)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_1,__index_rename_at_55)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_1,___pvar_0_at_55_rename_at_55)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_1,___source_0_at_55_rename_at_55)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_72_12_2 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_72_12_2,char * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_72_12_2 *)) __finalize;
+	int32_t __yield;
+	VarInfo const  * pinfo;
+	bool ___loop_at_73_rename_at_73;
+	int32_t __index_rename_at_73;
+	void * ___pvar_0_at_73_rename_at_73;
+	Sequence DAS_COMMENT((int32_t)) ___source_0_at_73_rename_at_73;
+};
+static_assert(sizeof(_lambda_thismodule_72_12_2)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_2,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_2,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_2,___loop_at_73_rename_at_73)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_2,__index_rename_at_73)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_2,___pvar_0_at_73_rename_at_73)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_2,___source_0_at_73_rename_at_73)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_54_12_3 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_54_12_3,TypeInfo const  * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_54_12_3 *)) __finalize;
+	int32_t __yield;
+	TypeInfo const  * pinfo;
+	bool ___loop_at_55_rename_at_55;
+	int32_t __index_rename_at_55;
+	void * ___pvar_0_at_55_rename_at_55;
+	Sequence DAS_COMMENT((int32_t)) ___source_0_at_55_rename_at_55;
+};
+static_assert(sizeof(_lambda_thismodule_54_12_3)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_3,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_3,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_3,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_3,___loop_at_55_rename_at_55)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_3,__index_rename_at_55)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_3,___pvar_0_at_55_rename_at_55)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_3,___source_0_at_55_rename_at_55)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_72_12_4 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_72_12_4,char * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_72_12_4 *)) __finalize;
+	int32_t __yield;
+	TypeInfo const  * pinfo;
+	bool ___loop_at_73_rename_at_73;
+	int32_t __index_rename_at_73;
+	void * ___pvar_0_at_73_rename_at_73;
+	Sequence DAS_COMMENT((int32_t)) ___source_0_at_73_rename_at_73;
+};
+static_assert(sizeof(_lambda_thismodule_72_12_4)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_4,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_4,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_4,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_4,___loop_at_73_rename_at_73)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_4,__index_rename_at_73)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_4,___pvar_0_at_73_rename_at_73)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_4,___source_0_at_73_rename_at_73)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_40_21_5 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_40_21_5,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_40_21_5 *)) __finalize;
+	int32_t __yield;
+	VarInfo const  * pinfo;
+	bool _loop_at_40;
+	int32_t index;
+	void * _pvar_0_at_40;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_40;
+};
+static_assert(sizeof(_lambda_thismodule_40_21_5)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,_loop_at_40)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,index)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,_pvar_0_at_40)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,_source_0_at_40)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_40_21_6 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_40_21_6,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_40_21_6 *)) __finalize;
+	int32_t __yield;
+	TypeInfo const  * pinfo;
+	bool _loop_at_40;
+	int32_t index;
+	void * _pvar_0_at_40;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_40;
+};
+static_assert(sizeof(_lambda_thismodule_40_21_6)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,_loop_at_40)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,index)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,_pvar_0_at_40)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,_source_0_at_40)==48,"structure field offset mismatch with DAS");
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_451 );
+inline void finalize_e22c2ab37dc6acaf ( Context * __context__, _lambda_thismodule_40_21_5 & ____this_rename_at_40 );
+inline void finalize_122063b03197e0e6 ( Context * __context__, _lambda_thismodule_40_21_6 & ____this_rename_at_40 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_3d5479e9b282f2ef ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_480 );
+inline void finalize_78e2d212e48b3566 ( Context * __context__, _lambda_thismodule_54_12_1 & ____this_rename_at_54 );
+inline void finalize_d0485049507a858f ( Context * __context__, _lambda_thismodule_72_12_2 & ____this_rename_at_72 );
+inline void finalize_3a6818aad144f7c0 ( Context * __context__, _lambda_thismodule_54_12_3 & ____this_rename_at_54 );
+inline void finalize_f850a27986f951a9 ( Context * __context__, _lambda_thismodule_72_12_4 & ____this_rename_at_72 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcbuiltin_0x60_each_ref_1607ca369977f978 ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const  __lam_rename_at_487 );
+inline Sequence DAS_COMMENT((char *)) _Funcbuiltin_0x60_each_b77a57a217361068 ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_480 );
+inline bool _Func_lambda_thismodule_40_21_5_0x60_function_f8d47f7646034bd7 ( Context * __context__, _lambda_thismodule_40_21_5 & ____this_rename_at_40, int32_t & ___yield_40_rename_at_40 );
+inline void _Func_lambda_thismodule_40_21_5_0x60_finalizer_b2bc7709be071290 ( Context * __context__, _lambda_thismodule_40_21_5 * ____this_rename_at_40 );
+inline bool _Func_lambda_thismodule_40_21_6_0x60_function_1259040e14b0f996 ( Context * __context__, _lambda_thismodule_40_21_6 & ____this_rename_at_40, int32_t & ___yield_40_rename_at_40 );
+inline void _Func_lambda_thismodule_40_21_6_0x60_finalizer_e57bb9527cd69c5e ( Context * __context__, _lambda_thismodule_40_21_6 * ____this_rename_at_40 );
+inline bool _Func_lambda_thismodule_54_12_1_0x60_function_3f7f7a8673272fc ( Context * __context__, _lambda_thismodule_54_12_1 & ____this_rename_at_54, TypeInfo const  * & ___ryield54_rename_at_54 );
+inline void _Func_lambda_thismodule_54_12_1_0x60_finalizer_e2caef4b069bb3ca ( Context * __context__, _lambda_thismodule_54_12_1 * ____this_rename_at_54 );
+inline bool _Func_lambda_thismodule_72_12_2_0x60_function_9b712201c43b54df ( Context * __context__, _lambda_thismodule_72_12_2 & ____this_rename_at_72, char * & ___yield_72_rename_at_72 );
+inline void _Func_lambda_thismodule_72_12_2_0x60_finalizer_68384240d4969e64 ( Context * __context__, _lambda_thismodule_72_12_2 * ____this_rename_at_72 );
+inline bool _Func_lambda_thismodule_54_12_3_0x60_function_13a122e47015a7c2 ( Context * __context__, _lambda_thismodule_54_12_3 & ____this_rename_at_54, TypeInfo const  * & ___ryield54_rename_at_54 );
+inline void _Func_lambda_thismodule_54_12_3_0x60_finalizer_b09a9a95e5c6809e ( Context * __context__, _lambda_thismodule_54_12_3 * ____this_rename_at_54 );
+inline bool _Func_lambda_thismodule_72_12_4_0x60_function_5bcbb7652685435d ( Context * __context__, _lambda_thismodule_72_12_4 & ____this_rename_at_72, char * & ___yield_72_rename_at_72 );
+inline void _Func_lambda_thismodule_72_12_4_0x60_finalizer_16408138305be6c ( Context * __context__, _lambda_thismodule_72_12_4 * ____this_rename_at_72 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_any_735dabc9bb2cfb3b ( Context * __context__, VarInfo const  & __info_rename_at_50 );
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_any_ec9d3e677f4c5580 ( Context * __context__, VarInfo const  & __info_rename_at_68 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_any_104b74ea2f5e6089 ( Context * __context__, VarInfo const  & __info_rename_at_37 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_any_e03f6d2d665c6cae ( Context * __context__, TypeInfo const  & __info_rename_at_50 );
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_any_30b38f673dda1c82 ( Context * __context__, TypeInfo const  & __info_rename_at_68 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_any_a258d520ce6be0e5 ( Context * __context__, TypeInfo const  & __info_rename_at_37 );
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> & __a_rename_at_42 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_917d5ebd8853d661 ( Context * __context__, VarInfo const  & __info_rename_at_65 );
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_22e0cdc118be6a6c ( Context * __context__, VarInfo const  & __info_rename_at_83 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_f5526c67356b3f98 ( Context * __context__, VarInfo const  & __info_rename_at_47 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_d3f96ce97ffb0433 ( Context * __context__, TypeInfo const  & __info_rename_at_61 );
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_4e81e6cbaea75066 ( Context * __context__, TypeInfo const  & __info_rename_at_79 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_900b57120fc9d5d6 ( Context * __context__, TypeInfo const  & __info_rename_at_43 );
+inline void _Funcbuiltin_0x60_push_49bdd408ef1e4c5a ( Context * __context__, TArray<char *> & __Arr_rename_at_75, char * const  __value_rename_at_75 );
+inline char * const  _Funcstrings_boost_0x60_join_9d9ba7e191784459 ( Context * __context__, TArray<char *> const  & __it_rename_at_18, char * const  __separator_rename_at_18 );
+inline void _Funcrtti_0x60_structure_for_each_annotation_3f72bd690dbe4f48 ( Context * __context__, StructInfo const  & __st_rename_at_10, Block DAS_COMMENT((void,Annotation const ,AnnotationArguments const )) const  & __subexpr_rename_at_10 );
+inline char * _Func_0x60_describeType_e026a100f91229ef ( Context * __context__, VarInfo const  & __info_rename_at_41 );
+inline char * _Func_0x60_describeType_8b3a41c83e382da3 ( Context * __context__, TypeInfo const  & __info_rename_at_41 );
+inline char * const  _Func_0x60_describeValue_d2d6042c1a290ea1 ( Context * __context__, TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  & __value_rename_at_99 );
+inline void _Func_0x60_describeEnumeration_1658b23f3db6d9fa ( Context * __context__, EnumInfo const  & __einfo_rename_at_119 );
+inline void _Func_0x60_describeStructure_ee281510bbdaabdc ( Context * __context__, StructInfo const  & __sinfo_rename_at_110 );
+inline void _Func_0x60_describeAnnotation_2ddad14e29570e3 ( Context * __context__, Annotation const  & __ann_rename_at_124 );
+inline void _Func_0x60_describeFunction_deba3fc8aa932956 ( Context * __context__, FuncInfo const  & __finfo_rename_at_90 );
+inline void _Func_0x60_describeVariable_4c21003f44d38096 ( Context * __context__, VarInfo const  & __glob_rename_at_107, char * const  __extra_rename_at_107 );
+inline void _Func_0x60_describeModule_770309617fce2149 ( Context * __context__, Module * const  __mod_rename_at_138 );
+inline void _Funcrtti_0x60_context_for_each_function_f61741bb8a08ddac ( Context * __context__, Block DAS_COMMENT((void,FuncInfo const )) const  & __blk_rename_at_28 );
+inline void _Funcrtti_0x60_context_for_each_variable_1f2d7042992bbcd3 ( Context * __context__, Block DAS_COMMENT((void,VarInfo const )) const  & __blk_rename_at_33 );
+inline bool main_c82b89aedf3f8860 ( Context * __context__ );
+inline bool test_b0087d371648db3f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<char *,0xcd3e2ceccecd7dd2>(__context__) = ((char *) "\nrequire math\nrequire UnitTest\n\nlet\n    one_two = 12\n\nenum TestEnum\n    foo\n    bar\n\n[checkRange (foo=5)]\nstruct TestStruct\n    a : int = 5\n    b : string = \"something\"\n    c : float[3][4]\n    d : array<int>\n    e : table<float; string>\n    f : TestStruct?\n    g : tuple<int; float; string>\n    h : variant<i : int; f : float>\n    fn : function<(a:int;b:float):string>\n    lm : lambda<(a:int;b:float):string>\n\n[export]\ndef bar ( blk : block<(a:int):float> )\n    pass\n\n[export]\ndef main\n    print(\"hello world!\n\")\n    return true\n");/*sample*/
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_451 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_452; das_zero(__it_rename_at_452);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_452),__rng_rename_at_451,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_452);
+}
+
+inline void finalize_e22c2ab37dc6acaf ( Context * __context__, _lambda_thismodule_40_21_5 &  ____this_rename_at_40 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),__context__);
+	memset(&(____this_rename_at_40), 0, 56);
+}
+
+inline void finalize_122063b03197e0e6 ( Context * __context__, _lambda_thismodule_40_21_6 &  ____this_rename_at_40 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),__context__);
+	memset(&(____this_rename_at_40), 0, 56);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_3d5479e9b282f2ef ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_480 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_482; das_zero(__it_rename_at_482);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_482),__lam_rename_at_480,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_482);
+}
+
+inline void finalize_78e2d212e48b3566 ( Context * __context__, _lambda_thismodule_54_12_1 &  ____this_rename_at_54 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_54.___source_0_at_55_rename_at_55),__context__);
+	memset(&(____this_rename_at_54), 0, 56);
+}
+
+inline void finalize_d0485049507a858f ( Context * __context__, _lambda_thismodule_72_12_2 &  ____this_rename_at_72 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_72.___source_0_at_73_rename_at_73),__context__);
+	memset(&(____this_rename_at_72), 0, 56);
+}
+
+inline void finalize_3a6818aad144f7c0 ( Context * __context__, _lambda_thismodule_54_12_3 &  ____this_rename_at_54 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_54.___source_0_at_55_rename_at_55),__context__);
+	memset(&(____this_rename_at_54), 0, 56);
+}
+
+inline void finalize_f850a27986f951a9 ( Context * __context__, _lambda_thismodule_72_12_4 &  ____this_rename_at_72 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_72.___source_0_at_73_rename_at_73),__context__);
+	memset(&(____this_rename_at_72), 0, 56);
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcbuiltin_0x60_each_ref_1607ca369977f978 ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const  __lam_rename_at_487 )
+{
+	Sequence DAS_COMMENT((TypeInfo *)) __it_rename_at_488; das_zero(__it_rename_at_488);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TypeInfo const ))>::pass(__it_rename_at_488),__lam_rename_at_487,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(__it_rename_at_488);
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcbuiltin_0x60_each_b77a57a217361068 ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_480 )
+{
+	Sequence DAS_COMMENT((char *)) __it_rename_at_482; das_zero(__it_rename_at_482);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((char *))>::pass(__it_rename_at_482),__lam_rename_at_480,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(__it_rename_at_482);
+}
+
+inline bool _Func_lambda_thismodule_40_21_5_0x60_function_f8d47f7646034bd7 ( Context * __context__, _lambda_thismodule_40_21_5 &  ____this_rename_at_40, int32_t & ___yield_40_rename_at_40 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_40_32;
+	switch (____this_rename_at_40.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_40._loop_at_40,true);
+	das_move(____this_rename_at_40._source_0_at_40,(_temp_make_local_40_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(int32_t(____this_rename_at_40.pinfo->dimSize /*dimSize*/))))));
+	memset(&(____this_rename_at_40.index), 0, 4);
+	das_copy(____this_rename_at_40._pvar_0_at_40,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_40.index)));
+	DAS_SETBOOLAND((____this_rename_at_40._loop_at_40),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),____this_rename_at_40._pvar_0_at_40,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_40._loop_at_40 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_40_rename_at_40,rtti_getDimVarInfo(das_deref(__context__,____this_rename_at_40.pinfo),____this_rename_at_40.index,__context__));
+	das_copy(____this_rename_at_40.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_40._loop_at_40),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),____this_rename_at_40._pvar_0_at_40,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),____this_rename_at_40._pvar_0_at_40,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_40_21_5_0x60_finalizer_b2bc7709be071290 ( Context * __context__, _lambda_thismodule_40_21_5 * ____this_rename_at_40 )
+{
+	finalize_e22c2ab37dc6acaf(__context__,das_arg<_lambda_thismodule_40_21_5>::pass(das_deref(__context__,____this_rename_at_40)));
+	das_delete_lambda_struct<_lambda_thismodule_40_21_5 *>::clear(__context__,____this_rename_at_40);
+}
+
+inline bool _Func_lambda_thismodule_40_21_6_0x60_function_1259040e14b0f996 ( Context * __context__, _lambda_thismodule_40_21_6 &  ____this_rename_at_40, int32_t & ___yield_40_rename_at_40 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_40_32;
+	switch (____this_rename_at_40.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_40._loop_at_40,true);
+	das_move(____this_rename_at_40._source_0_at_40,(_temp_make_local_40_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(int32_t(____this_rename_at_40.pinfo->dimSize /*dimSize*/))))));
+	memset(&(____this_rename_at_40.index), 0, 4);
+	das_copy(____this_rename_at_40._pvar_0_at_40,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_40.index)));
+	DAS_SETBOOLAND((____this_rename_at_40._loop_at_40),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),____this_rename_at_40._pvar_0_at_40,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_40._loop_at_40 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_40_rename_at_40,rtti_getDimTypeInfo(das_deref(__context__,____this_rename_at_40.pinfo),____this_rename_at_40.index,__context__));
+	das_copy(____this_rename_at_40.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_40._loop_at_40),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),____this_rename_at_40._pvar_0_at_40,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),____this_rename_at_40._pvar_0_at_40,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_40_21_6_0x60_finalizer_e57bb9527cd69c5e ( Context * __context__, _lambda_thismodule_40_21_6 * ____this_rename_at_40 )
+{
+	finalize_122063b03197e0e6(__context__,das_arg<_lambda_thismodule_40_21_6>::pass(das_deref(__context__,____this_rename_at_40)));
+	das_delete_lambda_struct<_lambda_thismodule_40_21_6 *>::clear(__context__,____this_rename_at_40);
+}
+
+inline bool _Func_lambda_thismodule_54_12_1_0x60_function_3f7f7a8673272fc ( Context * __context__, _lambda_thismodule_54_12_1 &  ____this_rename_at_54, TypeInfo const  * & ___ryield54_rename_at_54 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_55_32;
+	switch (____this_rename_at_54.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_54.pinfo->argTypes /*argTypes*/ != nullptr) )
+	{
+		goto label_5;
+	};
+	das_copy(____this_rename_at_54.___loop_at_55_rename_at_55,true);
+	das_move(____this_rename_at_54.___source_0_at_55_rename_at_55,(_temp_make_local_55_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(int32_t(____this_rename_at_54.pinfo->argCount /*argCount*/))))));
+	memset(&(____this_rename_at_54.__index_rename_at_55), 0, 4);
+	das_copy(____this_rename_at_54.___pvar_0_at_55_rename_at_55,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_54.__index_rename_at_55)));
+	DAS_SETBOOLAND((____this_rename_at_54.___loop_at_55_rename_at_55),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_54.___source_0_at_55_rename_at_55),____this_rename_at_54.___pvar_0_at_55_rename_at_55,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_54.___loop_at_55_rename_at_55 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield54_rename_at_54,das_ref(__context__,das_deref(__context__,das_index<TypeInfo * * const >::at(____this_rename_at_54.pinfo->argTypes /*argTypes*/,____this_rename_at_54.__index_rename_at_55,__context__))));
+	das_copy(____this_rename_at_54.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_54.___loop_at_55_rename_at_55),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_54.___source_0_at_55_rename_at_55),____this_rename_at_54.___pvar_0_at_55_rename_at_55,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_54.___source_0_at_55_rename_at_55),____this_rename_at_54.___pvar_0_at_55_rename_at_55,__context__);
+	label_5:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_54_12_1_0x60_finalizer_e2caef4b069bb3ca ( Context * __context__, _lambda_thismodule_54_12_1 * ____this_rename_at_54 )
+{
+	finalize_78e2d212e48b3566(__context__,das_arg<_lambda_thismodule_54_12_1>::pass(das_deref(__context__,____this_rename_at_54)));
+	das_delete_lambda_struct<_lambda_thismodule_54_12_1 *>::clear(__context__,____this_rename_at_54);
+}
+
+inline bool _Func_lambda_thismodule_72_12_2_0x60_function_9b712201c43b54df ( Context * __context__, _lambda_thismodule_72_12_2 &  ____this_rename_at_72, char * & ___yield_72_rename_at_72 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_73_32;
+	switch (____this_rename_at_72.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_72.pinfo->argNames /*argNames*/ != nullptr) )
+	{
+		goto label_5;
+	};
+	das_copy(____this_rename_at_72.___loop_at_73_rename_at_73,true);
+	das_move(____this_rename_at_72.___source_0_at_73_rename_at_73,(_temp_make_local_73_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(int32_t(____this_rename_at_72.pinfo->argCount /*argCount*/))))));
+	memset(&(____this_rename_at_72.__index_rename_at_73), 0, 4);
+	das_copy(____this_rename_at_72.___pvar_0_at_73_rename_at_73,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_72.__index_rename_at_73)));
+	DAS_SETBOOLAND((____this_rename_at_72.___loop_at_73_rename_at_73),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_72.___source_0_at_73_rename_at_73),____this_rename_at_72.___pvar_0_at_73_rename_at_73,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_72.___loop_at_73_rename_at_73 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_72_rename_at_72,das_index<char * const  * const >::at(____this_rename_at_72.pinfo->argNames /*argNames*/,____this_rename_at_72.__index_rename_at_73,__context__));
+	das_copy(____this_rename_at_72.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_72.___loop_at_73_rename_at_73),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_72.___source_0_at_73_rename_at_73),____this_rename_at_72.___pvar_0_at_73_rename_at_73,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_72.___source_0_at_73_rename_at_73),____this_rename_at_72.___pvar_0_at_73_rename_at_73,__context__);
+	label_5:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_72_12_2_0x60_finalizer_68384240d4969e64 ( Context * __context__, _lambda_thismodule_72_12_2 * ____this_rename_at_72 )
+{
+	finalize_d0485049507a858f(__context__,das_arg<_lambda_thismodule_72_12_2>::pass(das_deref(__context__,____this_rename_at_72)));
+	das_delete_lambda_struct<_lambda_thismodule_72_12_2 *>::clear(__context__,____this_rename_at_72);
+}
+
+inline bool _Func_lambda_thismodule_54_12_3_0x60_function_13a122e47015a7c2 ( Context * __context__, _lambda_thismodule_54_12_3 &  ____this_rename_at_54, TypeInfo const  * & ___ryield54_rename_at_54 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_55_32;
+	switch (____this_rename_at_54.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_54.pinfo->argTypes /*argTypes*/ != nullptr) )
+	{
+		goto label_5;
+	};
+	das_copy(____this_rename_at_54.___loop_at_55_rename_at_55,true);
+	das_move(____this_rename_at_54.___source_0_at_55_rename_at_55,(_temp_make_local_55_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(int32_t(____this_rename_at_54.pinfo->argCount /*argCount*/))))));
+	memset(&(____this_rename_at_54.__index_rename_at_55), 0, 4);
+	das_copy(____this_rename_at_54.___pvar_0_at_55_rename_at_55,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_54.__index_rename_at_55)));
+	DAS_SETBOOLAND((____this_rename_at_54.___loop_at_55_rename_at_55),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_54.___source_0_at_55_rename_at_55),____this_rename_at_54.___pvar_0_at_55_rename_at_55,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_54.___loop_at_55_rename_at_55 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield54_rename_at_54,das_ref(__context__,das_deref(__context__,das_index<TypeInfo * * const >::at(____this_rename_at_54.pinfo->argTypes /*argTypes*/,____this_rename_at_54.__index_rename_at_55,__context__))));
+	das_copy(____this_rename_at_54.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_54.___loop_at_55_rename_at_55),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_54.___source_0_at_55_rename_at_55),____this_rename_at_54.___pvar_0_at_55_rename_at_55,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_54.___source_0_at_55_rename_at_55),____this_rename_at_54.___pvar_0_at_55_rename_at_55,__context__);
+	label_5:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_54_12_3_0x60_finalizer_b09a9a95e5c6809e ( Context * __context__, _lambda_thismodule_54_12_3 * ____this_rename_at_54 )
+{
+	finalize_3a6818aad144f7c0(__context__,das_arg<_lambda_thismodule_54_12_3>::pass(das_deref(__context__,____this_rename_at_54)));
+	das_delete_lambda_struct<_lambda_thismodule_54_12_3 *>::clear(__context__,____this_rename_at_54);
+}
+
+inline bool _Func_lambda_thismodule_72_12_4_0x60_function_5bcbb7652685435d ( Context * __context__, _lambda_thismodule_72_12_4 &  ____this_rename_at_72, char * & ___yield_72_rename_at_72 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_73_32;
+	switch (____this_rename_at_72.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_72.pinfo->argNames /*argNames*/ != nullptr) )
+	{
+		goto label_5;
+	};
+	das_copy(____this_rename_at_72.___loop_at_73_rename_at_73,true);
+	das_move(____this_rename_at_72.___source_0_at_73_rename_at_73,(_temp_make_local_73_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(int32_t(____this_rename_at_72.pinfo->argCount /*argCount*/))))));
+	memset(&(____this_rename_at_72.__index_rename_at_73), 0, 4);
+	das_copy(____this_rename_at_72.___pvar_0_at_73_rename_at_73,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_72.__index_rename_at_73)));
+	DAS_SETBOOLAND((____this_rename_at_72.___loop_at_73_rename_at_73),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_72.___source_0_at_73_rename_at_73),____this_rename_at_72.___pvar_0_at_73_rename_at_73,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_72.___loop_at_73_rename_at_73 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_72_rename_at_72,das_index<char * const  * const >::at(____this_rename_at_72.pinfo->argNames /*argNames*/,____this_rename_at_72.__index_rename_at_73,__context__));
+	das_copy(____this_rename_at_72.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_72.___loop_at_73_rename_at_73),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_72.___source_0_at_73_rename_at_73),____this_rename_at_72.___pvar_0_at_73_rename_at_73,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_72.___source_0_at_73_rename_at_73),____this_rename_at_72.___pvar_0_at_73_rename_at_73,__context__);
+	label_5:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_72_12_4_0x60_finalizer_16408138305be6c ( Context * __context__, _lambda_thismodule_72_12_4 * ____this_rename_at_72 )
+{
+	finalize_f850a27986f951a9(__context__,das_arg<_lambda_thismodule_72_12_4>::pass(das_deref(__context__,____this_rename_at_72)));
+	das_delete_lambda_struct<_lambda_thismodule_72_12_4 *>::clear(__context__,____this_rename_at_72);
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_any_735dabc9bb2cfb3b ( Context * __context__, VarInfo const  &  __info_rename_at_50 )
+{
+	VarInfo const  * __pinfo_rename_at_52 = ((VarInfo const  *)das_ref(__context__,__info_rename_at_50));
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(_Funcbuiltin_0x60_each_ref_1607ca369977f978(__context__,das_ascend<bool,_lambda_thismodule_54_12_1>::make(__context__,&__type_info__b3bb2d75180c6f9b,(([&]() -> _lambda_thismodule_54_12_1 {
+		_lambda_thismodule_54_12_1 __mks_53;
+		das_zero(__mks_53);
+		das_copy((__mks_53.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_54_12_1`function XS<::_lambda_thismodule_54_12_1> &1<CH<rtti::TypeInfo>>?*/ 5999354312059279158u))));
+		das_copy((__mks_53.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_54_12_1`finalizer X1<S<::_lambda_thismodule_54_12_1>>?*/ 5811602116537538800u))));
+		das_copy((__mks_53.pinfo),(__pinfo_rename_at_52));
+		return __mks_53;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_any_ec9d3e677f4c5580 ( Context * __context__, VarInfo const  &  __info_rename_at_68 )
+{
+	VarInfo const  * __pinfo_rename_at_70 = ((VarInfo const  *)das_ref(__context__,__info_rename_at_68));
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_Funcbuiltin_0x60_each_b77a57a217361068(__context__,das_ascend<bool,_lambda_thismodule_72_12_2>::make(__context__,&__type_info__1fd680790faaffd0,(([&]() -> _lambda_thismodule_72_12_2 {
+		_lambda_thismodule_72_12_2 __mks_71;
+		das_zero(__mks_71);
+		das_copy((__mks_71.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_72_12_2`function XS<::_lambda_thismodule_72_12_2> &s*/ 12811640807923530881u))));
+		das_copy((__mks_71.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_72_12_2`finalizer X1<S<::_lambda_thismodule_72_12_2>>?*/ 13522876571322266216u))));
+		das_copy((__mks_71.pinfo),(__pinfo_rename_at_70));
+		return __mks_71;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_any_104b74ea2f5e6089 ( Context * __context__, VarInfo const  &  __info_rename_at_37 )
+{
+	VarInfo const  * __pinfo_rename_at_39 = ((VarInfo const  *)das_ref(__context__,__info_rename_at_37));
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_3d5479e9b282f2ef(__context__,das_ascend<bool,_lambda_thismodule_40_21_5>::make(__context__,&__type_info__198a21e196d00300,(([&]() -> _lambda_thismodule_40_21_5 {
+		_lambda_thismodule_40_21_5 __mks_40;
+		das_zero(__mks_40);
+		das_copy((__mks_40.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_40_21_5`function XS<::_lambda_thismodule_40_21_5> &i*/ 10674027974229884731u))));
+		das_copy((__mks_40.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_40_21_5`finalizer X1<S<::_lambda_thismodule_40_21_5>>?*/ 14448636304449125228u))));
+		das_copy((__mks_40.pinfo),(__pinfo_rename_at_39));
+		return __mks_40;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_any_e03f6d2d665c6cae ( Context * __context__, TypeInfo const  &  __info_rename_at_50 )
+{
+	TypeInfo const  * __pinfo_rename_at_52 = ((TypeInfo const  *)das_ref(__context__,__info_rename_at_50));
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(_Funcbuiltin_0x60_each_ref_1607ca369977f978(__context__,das_ascend<bool,_lambda_thismodule_54_12_3>::make(__context__,&__type_info__b3c1ad751811b4c9,(([&]() -> _lambda_thismodule_54_12_3 {
+		_lambda_thismodule_54_12_3 __mks_53;
+		das_zero(__mks_53);
+		das_copy((__mks_53.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_54_12_3`function XS<::_lambda_thismodule_54_12_3> &1<CH<rtti::TypeInfo>>?*/ 15654252767376194786u))));
+		das_copy((__mks_53.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_54_12_3`finalizer X1<S<::_lambda_thismodule_54_12_3>>?*/ 10031870394583565336u))));
+		das_copy((__mks_53.pinfo),(__pinfo_rename_at_52));
+		return __mks_53;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_any_30b38f673dda1c82 ( Context * __context__, TypeInfo const  &  __info_rename_at_68 )
+{
+	TypeInfo const  * __pinfo_rename_at_70 = ((TypeInfo const  *)das_ref(__context__,__info_rename_at_68));
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_Funcbuiltin_0x60_each_b77a57a217361068(__context__,das_ascend<bool,_lambda_thismodule_72_12_4>::make(__context__,&__type_info__1fdd00790fb044fe,(([&]() -> _lambda_thismodule_72_12_4 {
+		_lambda_thismodule_72_12_4 __mks_71;
+		das_zero(__mks_71);
+		das_copy((__mks_71.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_72_12_4`function XS<::_lambda_thismodule_72_12_4> &s*/ 6463309710093724729u))));
+		das_copy((__mks_71.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_72_12_4`finalizer X1<S<::_lambda_thismodule_72_12_4>>?*/ 265517984514064976u))));
+		das_copy((__mks_71.pinfo),(__pinfo_rename_at_70));
+		return __mks_71;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_any_a258d520ce6be0e5 ( Context * __context__, TypeInfo const  &  __info_rename_at_37 )
+{
+	TypeInfo const  * __pinfo_rename_at_39 = ((TypeInfo const  *)das_ref(__context__,__info_rename_at_37));
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_3d5479e9b282f2ef(__context__,das_ascend<bool,_lambda_thismodule_40_21_6>::make(__context__,&__type_info__198723e196cdd08f,(([&]() -> _lambda_thismodule_40_21_6 {
+		_lambda_thismodule_40_21_6 __mks_40;
+		das_zero(__mks_40);
+		das_copy((__mks_40.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_40_21_6`function XS<::_lambda_thismodule_40_21_6> &i*/ 18259255360360862309u))));
+		das_copy((__mks_40.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_40_21_6`finalizer X1<S<::_lambda_thismodule_40_21_6>>?*/ 12202578020372486896u))));
+		das_copy((__mks_40.pinfo),(__pinfo_rename_at_39));
+		return __mks_40;
+	})()))));
+}
+
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<char *> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<char *> &>::cast(__a_rename_at_42);
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_917d5ebd8853d661 ( Context * __context__, VarInfo const  &  __info_rename_at_65 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(_Funcrtti_0x60_arg_types_any_735dabc9bb2cfb3b(__context__,__info_rename_at_65));
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_22e0cdc118be6a6c ( Context * __context__, VarInfo const  &  __info_rename_at_83 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_Funcrtti_0x60_arg_names_any_ec9d3e677f4c5580(__context__,__info_rename_at_83));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_f5526c67356b3f98 ( Context * __context__, VarInfo const  &  __info_rename_at_47 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcrtti_0x60_each_dim_any_104b74ea2f5e6089(__context__,__info_rename_at_47));
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_d3f96ce97ffb0433 ( Context * __context__, TypeInfo const  &  __info_rename_at_61 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(_Funcrtti_0x60_arg_types_any_e03f6d2d665c6cae(__context__,__info_rename_at_61));
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_4e81e6cbaea75066 ( Context * __context__, TypeInfo const  &  __info_rename_at_79 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_Funcrtti_0x60_arg_names_any_30b38f673dda1c82(__context__,__info_rename_at_79));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_900b57120fc9d5d6 ( Context * __context__, TypeInfo const  &  __info_rename_at_43 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcrtti_0x60_each_dim_any_a258d520ce6be0e5(__context__,__info_rename_at_43));
+}
+
+inline void _Funcbuiltin_0x60_push_49bdd408ef1e4c5a ( Context * __context__, TArray<char *> &  __Arr_rename_at_75, char * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<char *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_9d9ba7e191784459 ( Context * __context__, TArray<char *> const  &  __it_rename_at_18, char * const  __separator_rename_at_18 )
+{
+	char * __st_rename_at_23 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_23)->void{
+		bool __skip_first_rename_at_24 = true;
+		{
+			bool __need_loop_25 = true;
+			// elem : string const&
+			das_iterator<TArray<char *> const > __elem_iterator(__it_rename_at_18);
+			char * const  * __elem_rename_at_25;
+			__need_loop_25 = __elem_iterator.first(__context__,(__elem_rename_at_25)) && __need_loop_25;
+			for ( ; __need_loop_25 ; __need_loop_25 = __elem_iterator.next(__context__,(__elem_rename_at_25)) )
+			{
+				if ( __skip_first_rename_at_24 )
+				{
+					das_copy(__skip_first_rename_at_24,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_23),cast<char * const >::from(__separator_rename_at_18)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<StringBuilderWriter &>::from(__writer_rename_at_23),cast<char * const >::from((*__elem_rename_at_25))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_25));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_23);
+}
+
+inline void _Funcrtti_0x60_structure_for_each_annotation_3f72bd690dbe4f48 ( Context * __context__, StructInfo const  &  __st_rename_at_10, Block DAS_COMMENT((void,Annotation const ,AnnotationArguments const )) const  &  __subexpr_rename_at_10 )
+{
+	rtti_builtin_structure_for_each_annotation(__st_rename_at_10,__subexpr_rename_at_10,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline char * _Func_0x60_describeType_e026a100f91229ef ( Context * __context__, VarInfo const  &  __info_rename_at_41 )
+{
+	char * __res_rename_at_42 = 0;
+	if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tHandle )
+	{
+		das_copy(__res_rename_at_42,((char *)(to_das_string(__info_rename_at_41.getAnnotation() /*annotation*/->name /*name*/,__context__))));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tStructure )
+	{
+		das_copy(__res_rename_at_42,das_null_coalescing<char * const >::get(das_safe_navigation_handle<StructInfo,char * const >::get(__info_rename_at_41.structType /*structType*/,([&](const StructInfo * __any) -> auto & {return __any->name /*name*/;})),((char *) "structure")));
+	} else if ( ((__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration8)) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration16) )
+	{
+		das_copy(__res_rename_at_42,das_null_coalescing<char * const >::get(das_safe_navigation_handle<EnumInfo,char * const >::get(__info_rename_at_41.enumType /*enumType*/,([&](const EnumInfo * __any) -> auto & {return __any->name /*name*/;})),((char *) "enumeration")));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tPointer )
+	{
+		das_copy(__res_rename_at_42,(__info_rename_at_41.firstType /*firstType*/ != nullptr) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_3, cast<char *>::from(_Func_0x60_describeType_8b3a41c83e382da3(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/))), cast<char * const >::from(((char *) "?"))))) : das_auto_cast<char * const >::cast(((char *) "void?")));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tArray )
+	{
+		das_copy(__res_rename_at_42,(__info_rename_at_41.firstType /*firstType*/ != nullptr) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_4, cast<char * const >::from(((char *) "array<")), cast<char *>::from(_Func_0x60_describeType_8b3a41c83e382da3(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/))), cast<char * const >::from(((char *) ">"))))) : das_auto_cast<char * const >::cast(((char *) "array")));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tTable )
+	{
+		if ( (__info_rename_at_41.firstType /*firstType*/ != nullptr) && (__info_rename_at_41.secondType /*secondType*/ != nullptr) )
+		{
+			das_copy(__res_rename_at_42,das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_5, cast<char * const >::from(((char *) "table<")), cast<char *>::from(_Func_0x60_describeType_8b3a41c83e382da3(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/))), cast<char * const >::from(((char *) ";")), cast<char *>::from(_Func_0x60_describeType_8b3a41c83e382da3(__context__,das_deref(__context__,__info_rename_at_41.secondType /*secondType*/))), cast<char * const >::from(((char *) ">")))));
+		} else {
+			das_copy(__res_rename_at_42,((char *) "table"));
+		};
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tTuple )
+	{
+		if ( __info_rename_at_41.argTypes /*argTypes*/ != nullptr )
+		{
+			das_copy(__res_rename_at_42,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "tuple<")),cast<char *>::from(_Funcstrings_boost_0x60_join_9d9ba7e191784459(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]()->TArray<char *>{
+				Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_60_176;
+				TArray<char *> ____acomp_60_rename_at_60; das_zero(____acomp_60_rename_at_60);
+				{
+					bool __need_loop_60 = true;
+					// argtype : rtti::TypeInfo const&
+					das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_60_176 = (_Funcrtti_0x60_arg_types_917d5ebd8853d661(__context__,__info_rename_at_41))));
+					TypeInfo const  * __argtype_rename_at_60;
+					__need_loop_60 = __argtype_iterator.first(__context__,(__argtype_rename_at_60)) && __need_loop_60;
+					for ( ; __need_loop_60 ; __need_loop_60 = __argtype_iterator.next(__context__,(__argtype_rename_at_60)) )
+					{
+						_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(____acomp_60_rename_at_60),_Func_0x60_describeType_8b3a41c83e382da3(__context__,(*__argtype_rename_at_60)));
+					}
+					__argtype_iterator.close(__context__,(__argtype_rename_at_60));
+				};
+				return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(____acomp_60_rename_at_60)));
+			})),((char *) ";"))),*__context__,nullptr)))),cast<char *>::from(((char *) ">")),*__context__,nullptr)));
+		} else {
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) "tuple")),*__context__,nullptr);
+		};
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tVariant )
+	{
+		if ( (__info_rename_at_41.argTypes /*argTypes*/ != nullptr) && (__info_rename_at_41.argNames /*argNames*/ != nullptr) )
+		{
+			das_copy(__res_rename_at_42,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "variant<")),cast<char *>::from(_Funcstrings_boost_0x60_join_9d9ba7e191784459(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]()->TArray<char *>{
+				Sequence DAS_COMMENT((char *)) _temp_make_local_65_400;
+				Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_65_416;
+				TArray<char *> ____acomp_65_rename_at_65; das_zero(____acomp_65_rename_at_65);
+				{
+					bool __need_loop_65 = true;
+					// argname : string
+					das_iterator<Sequence DAS_COMMENT((char *))> __argname_iterator((_temp_make_local_65_400 = (_Funcrtti_0x60_arg_names_22e0cdc118be6a6c(__context__,__info_rename_at_41))));
+					char * __argname_rename_at_65;
+					__need_loop_65 = __argname_iterator.first(__context__,(__argname_rename_at_65)) && __need_loop_65;
+					// argtype : rtti::TypeInfo const&
+					das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_65_416 = (_Funcrtti_0x60_arg_types_917d5ebd8853d661(__context__,__info_rename_at_41))));
+					TypeInfo const  * __argtype_rename_at_65;
+					__need_loop_65 = __argtype_iterator.first(__context__,(__argtype_rename_at_65)) && __need_loop_65;
+					for ( ; __need_loop_65 ; __need_loop_65 = __argname_iterator.next(__context__,(__argname_rename_at_65)) && __argtype_iterator.next(__context__,(__argtype_rename_at_65)) )
+					{
+						_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(____acomp_65_rename_at_65),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_6, cast<char *>::from(__argname_rename_at_65), cast<char * const >::from(((char *) ":")), cast<char *>::from(_Func_0x60_describeType_8b3a41c83e382da3(__context__,(*__argtype_rename_at_65))))));
+					}
+					__argname_iterator.close(__context__,(__argname_rename_at_65));
+					__argtype_iterator.close(__context__,(__argtype_rename_at_65));
+				};
+				return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(____acomp_65_rename_at_65)));
+			})),((char *) ";"))),*__context__,nullptr)))),cast<char *>::from(((char *) ">")),*__context__,nullptr)));
+		} else {
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) "variant")),*__context__,nullptr);
+		};
+	} else if ( ((__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tFunction) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tLambda)) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tBlock) )
+	{
+		das_copy(__res_rename_at_42,das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_7, cast<char *>::from(((char *)(rtti_get_das_type_name(__info_rename_at_41.type /*basicType*/,__context__)))), cast<char * const >::from(((char *) "<")))));
+		if ( __info_rename_at_41.argTypes /*argTypes*/ != nullptr )
+		{
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "(")),cast<char *>::from(_Funcstrings_boost_0x60_join_9d9ba7e191784459(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]()->TArray<char *>{
+				Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_71_656;
+				TArray<char *> ____acomp_71_rename_at_71; das_zero(____acomp_71_rename_at_71);
+				{
+					bool __need_loop_71 = true;
+					// argtype : rtti::TypeInfo const&
+					das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_71_656 = (_Funcrtti_0x60_arg_types_917d5ebd8853d661(__context__,__info_rename_at_41))));
+					TypeInfo const  * __argtype_rename_at_71;
+					__need_loop_71 = __argtype_iterator.first(__context__,(__argtype_rename_at_71)) && __need_loop_71;
+					for ( ; __need_loop_71 ; __need_loop_71 = __argtype_iterator.next(__context__,(__argtype_rename_at_71)) )
+					{
+						_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(____acomp_71_rename_at_71),_Func_0x60_describeType_8b3a41c83e382da3(__context__,(*__argtype_rename_at_71)));
+					}
+					__argtype_iterator.close(__context__,(__argtype_rename_at_71));
+				};
+				return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(____acomp_71_rename_at_71)));
+			})),((char *) ";"))),*__context__,nullptr)))),cast<char *>::from(((char *) ")")),*__context__,nullptr)))),*__context__,nullptr);
+		};
+		if ( __info_rename_at_41.firstType /*firstType*/ != nullptr )
+		{
+			if ( __info_rename_at_41.argTypes /*argTypes*/ != nullptr )
+			{
+				SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) ":")),*__context__,nullptr);
+			};
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_8, cast<char *>::from(_Func_0x60_describeType_8b3a41c83e382da3(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/)))))),*__context__,nullptr);
+		};
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) ">")),*__context__,nullptr);
+	} else {
+		das_copy(__res_rename_at_42,((char *)(rtti_get_das_type_name(__info_rename_at_41.type /*basicType*/,__context__))));
+	};
+	SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(_Funcstrings_boost_0x60_join_9d9ba7e191784459(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]()->TArray<char *>{
+		Sequence DAS_COMMENT((int32_t)) _temp_make_local_79_880;
+		TArray<char *> ____acomp_79_rename_at_79; das_zero(____acomp_79_rename_at_79);
+		{
+			bool __need_loop_79 = true;
+			// d : int
+			das_iterator<Sequence DAS_COMMENT((int32_t))> __d_iterator((_temp_make_local_79_880 = (_Funcrtti_0x60_each_dim_f5526c67356b3f98(__context__,__info_rename_at_41))));
+			int32_t __d_rename_at_79;
+			__need_loop_79 = __d_iterator.first(__context__,(__d_rename_at_79)) && __need_loop_79;
+			for ( ; __need_loop_79 ; __need_loop_79 = __d_iterator.next(__context__,(__d_rename_at_79)) )
+			{
+				_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(____acomp_79_rename_at_79),(__d_rename_at_79 != -1) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_9, cast<char * const >::from(((char *) "[")), cast<int32_t>::from(__d_rename_at_79), cast<char * const >::from(((char *) "]"))))) : das_auto_cast<char * const >::cast(((char *) "[]")));
+			}
+			__d_iterator.close(__context__,(__d_rename_at_79));
+		};
+		return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(____acomp_79_rename_at_79)));
+	})),nullptr)),*__context__,nullptr);
+	if ( __info_rename_at_41.isConst() /*isConst*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) " const")),*__context__,nullptr);
+	};
+	if ( __info_rename_at_41.isRef() /*isRef*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) " &")),*__context__,nullptr);
+	};
+	if ( __info_rename_at_41.isTemp() /*isTemp*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) "#")),*__context__,nullptr);
+	};
+	if ( __info_rename_at_41.isImplicit() /*isImplicit*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) " implicit")),*__context__,nullptr);
+	};
+	return das_auto_cast<char *>::cast(__res_rename_at_42);
+}
+
+inline char * _Func_0x60_describeType_8b3a41c83e382da3 ( Context * __context__, TypeInfo const  &  __info_rename_at_41 )
+{
+	char * __res_rename_at_42 = 0;
+	if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tHandle )
+	{
+		das_copy(__res_rename_at_42,((char *)(to_das_string(__info_rename_at_41.getAnnotation() /*annotation*/->name /*name*/,__context__))));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tStructure )
+	{
+		das_copy(__res_rename_at_42,das_null_coalescing<char * const >::get(das_safe_navigation_handle<StructInfo,char * const >::get(__info_rename_at_41.structType /*structType*/,([&](const StructInfo * __any) -> auto & {return __any->name /*name*/;})),((char *) "structure")));
+	} else if ( ((__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration8)) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration16) )
+	{
+		das_copy(__res_rename_at_42,das_null_coalescing<char * const >::get(das_safe_navigation_handle<EnumInfo,char * const >::get(__info_rename_at_41.enumType /*enumType*/,([&](const EnumInfo * __any) -> auto & {return __any->name /*name*/;})),((char *) "enumeration")));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tPointer )
+	{
+		das_copy(__res_rename_at_42,(__info_rename_at_41.firstType /*firstType*/ != nullptr) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_10, cast<char *>::from(_Func_0x60_describeType_8b3a41c83e382da3(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/))), cast<char * const >::from(((char *) "?"))))) : das_auto_cast<char * const >::cast(((char *) "void?")));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tArray )
+	{
+		das_copy(__res_rename_at_42,(__info_rename_at_41.firstType /*firstType*/ != nullptr) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_11, cast<char * const >::from(((char *) "array<")), cast<char *>::from(_Func_0x60_describeType_8b3a41c83e382da3(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/))), cast<char * const >::from(((char *) ">"))))) : das_auto_cast<char * const >::cast(((char *) "array")));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tTable )
+	{
+		if ( (__info_rename_at_41.firstType /*firstType*/ != nullptr) && (__info_rename_at_41.secondType /*secondType*/ != nullptr) )
+		{
+			das_copy(__res_rename_at_42,das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_12, cast<char * const >::from(((char *) "table<")), cast<char *>::from(_Func_0x60_describeType_8b3a41c83e382da3(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/))), cast<char * const >::from(((char *) ";")), cast<char *>::from(_Func_0x60_describeType_8b3a41c83e382da3(__context__,das_deref(__context__,__info_rename_at_41.secondType /*secondType*/))), cast<char * const >::from(((char *) ">")))));
+		} else {
+			das_copy(__res_rename_at_42,((char *) "table"));
+		};
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tTuple )
+	{
+		if ( __info_rename_at_41.argTypes /*argTypes*/ != nullptr )
+		{
+			das_copy(__res_rename_at_42,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "tuple<")),cast<char *>::from(_Funcstrings_boost_0x60_join_9d9ba7e191784459(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]()->TArray<char *>{
+				Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_60_176;
+				TArray<char *> ____acomp_60_rename_at_60; das_zero(____acomp_60_rename_at_60);
+				{
+					bool __need_loop_60 = true;
+					// argtype : rtti::TypeInfo const&
+					das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_60_176 = (_Funcrtti_0x60_arg_types_d3f96ce97ffb0433(__context__,__info_rename_at_41))));
+					TypeInfo const  * __argtype_rename_at_60;
+					__need_loop_60 = __argtype_iterator.first(__context__,(__argtype_rename_at_60)) && __need_loop_60;
+					for ( ; __need_loop_60 ; __need_loop_60 = __argtype_iterator.next(__context__,(__argtype_rename_at_60)) )
+					{
+						_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(____acomp_60_rename_at_60),_Func_0x60_describeType_8b3a41c83e382da3(__context__,(*__argtype_rename_at_60)));
+					}
+					__argtype_iterator.close(__context__,(__argtype_rename_at_60));
+				};
+				return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(____acomp_60_rename_at_60)));
+			})),((char *) ";"))),*__context__,nullptr)))),cast<char *>::from(((char *) ">")),*__context__,nullptr)));
+		} else {
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) "tuple")),*__context__,nullptr);
+		};
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tVariant )
+	{
+		if ( (__info_rename_at_41.argTypes /*argTypes*/ != nullptr) && (__info_rename_at_41.argNames /*argNames*/ != nullptr) )
+		{
+			das_copy(__res_rename_at_42,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "variant<")),cast<char *>::from(_Funcstrings_boost_0x60_join_9d9ba7e191784459(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]()->TArray<char *>{
+				Sequence DAS_COMMENT((char *)) _temp_make_local_65_400;
+				Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_65_416;
+				TArray<char *> ____acomp_65_rename_at_65; das_zero(____acomp_65_rename_at_65);
+				{
+					bool __need_loop_65 = true;
+					// argname : string
+					das_iterator<Sequence DAS_COMMENT((char *))> __argname_iterator((_temp_make_local_65_400 = (_Funcrtti_0x60_arg_names_4e81e6cbaea75066(__context__,__info_rename_at_41))));
+					char * __argname_rename_at_65;
+					__need_loop_65 = __argname_iterator.first(__context__,(__argname_rename_at_65)) && __need_loop_65;
+					// argtype : rtti::TypeInfo const&
+					das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_65_416 = (_Funcrtti_0x60_arg_types_d3f96ce97ffb0433(__context__,__info_rename_at_41))));
+					TypeInfo const  * __argtype_rename_at_65;
+					__need_loop_65 = __argtype_iterator.first(__context__,(__argtype_rename_at_65)) && __need_loop_65;
+					for ( ; __need_loop_65 ; __need_loop_65 = __argname_iterator.next(__context__,(__argname_rename_at_65)) && __argtype_iterator.next(__context__,(__argtype_rename_at_65)) )
+					{
+						_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(____acomp_65_rename_at_65),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_13, cast<char *>::from(__argname_rename_at_65), cast<char * const >::from(((char *) ":")), cast<char *>::from(_Func_0x60_describeType_8b3a41c83e382da3(__context__,(*__argtype_rename_at_65))))));
+					}
+					__argname_iterator.close(__context__,(__argname_rename_at_65));
+					__argtype_iterator.close(__context__,(__argtype_rename_at_65));
+				};
+				return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(____acomp_65_rename_at_65)));
+			})),((char *) ";"))),*__context__,nullptr)))),cast<char *>::from(((char *) ">")),*__context__,nullptr)));
+		} else {
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) "variant")),*__context__,nullptr);
+		};
+	} else if ( ((__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tFunction) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tLambda)) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tBlock) )
+	{
+		das_copy(__res_rename_at_42,das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_14, cast<char *>::from(((char *)(rtti_get_das_type_name(__info_rename_at_41.type /*basicType*/,__context__)))), cast<char * const >::from(((char *) "<")))));
+		if ( __info_rename_at_41.argTypes /*argTypes*/ != nullptr )
+		{
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "(")),cast<char *>::from(_Funcstrings_boost_0x60_join_9d9ba7e191784459(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]()->TArray<char *>{
+				Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_71_656;
+				TArray<char *> ____acomp_71_rename_at_71; das_zero(____acomp_71_rename_at_71);
+				{
+					bool __need_loop_71 = true;
+					// argtype : rtti::TypeInfo const&
+					das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_71_656 = (_Funcrtti_0x60_arg_types_d3f96ce97ffb0433(__context__,__info_rename_at_41))));
+					TypeInfo const  * __argtype_rename_at_71;
+					__need_loop_71 = __argtype_iterator.first(__context__,(__argtype_rename_at_71)) && __need_loop_71;
+					for ( ; __need_loop_71 ; __need_loop_71 = __argtype_iterator.next(__context__,(__argtype_rename_at_71)) )
+					{
+						_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(____acomp_71_rename_at_71),_Func_0x60_describeType_8b3a41c83e382da3(__context__,(*__argtype_rename_at_71)));
+					}
+					__argtype_iterator.close(__context__,(__argtype_rename_at_71));
+				};
+				return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(____acomp_71_rename_at_71)));
+			})),((char *) ";"))),*__context__,nullptr)))),cast<char *>::from(((char *) ")")),*__context__,nullptr)))),*__context__,nullptr);
+		};
+		if ( __info_rename_at_41.firstType /*firstType*/ != nullptr )
+		{
+			if ( __info_rename_at_41.argTypes /*argTypes*/ != nullptr )
+			{
+				SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) ":")),*__context__,nullptr);
+			};
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_15, cast<char *>::from(_Func_0x60_describeType_8b3a41c83e382da3(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/)))))),*__context__,nullptr);
+		};
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) ">")),*__context__,nullptr);
+	} else {
+		das_copy(__res_rename_at_42,((char *)(rtti_get_das_type_name(__info_rename_at_41.type /*basicType*/,__context__))));
+	};
+	SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(_Funcstrings_boost_0x60_join_9d9ba7e191784459(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]()->TArray<char *>{
+		Sequence DAS_COMMENT((int32_t)) _temp_make_local_79_880;
+		TArray<char *> ____acomp_79_rename_at_79; das_zero(____acomp_79_rename_at_79);
+		{
+			bool __need_loop_79 = true;
+			// d : int
+			das_iterator<Sequence DAS_COMMENT((int32_t))> __d_iterator((_temp_make_local_79_880 = (_Funcrtti_0x60_each_dim_900b57120fc9d5d6(__context__,__info_rename_at_41))));
+			int32_t __d_rename_at_79;
+			__need_loop_79 = __d_iterator.first(__context__,(__d_rename_at_79)) && __need_loop_79;
+			for ( ; __need_loop_79 ; __need_loop_79 = __d_iterator.next(__context__,(__d_rename_at_79)) )
+			{
+				_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(____acomp_79_rename_at_79),(__d_rename_at_79 != -1) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_16, cast<char * const >::from(((char *) "[")), cast<int32_t>::from(__d_rename_at_79), cast<char * const >::from(((char *) "]"))))) : das_auto_cast<char * const >::cast(((char *) "[]")));
+			}
+			__d_iterator.close(__context__,(__d_rename_at_79));
+		};
+		return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(____acomp_79_rename_at_79)));
+	})),nullptr)),*__context__,nullptr);
+	if ( __info_rename_at_41.isConst() /*isConst*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) " const")),*__context__,nullptr);
+	};
+	if ( __info_rename_at_41.isRef() /*isRef*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) " &")),*__context__,nullptr);
+	};
+	if ( __info_rename_at_41.isTemp() /*isTemp*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) "#")),*__context__,nullptr);
+	};
+	if ( __info_rename_at_41.isImplicit() /*isImplicit*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) " implicit")),*__context__,nullptr);
+	};
+	return das_auto_cast<char *>::cast(__res_rename_at_42);
+}
+
+inline char * const  _Func_0x60_describeValue_d2d6042c1a290ea1 ( Context * __context__, TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  &  __value_rename_at_99 )
+{
+	if ( das_get_variant_field<vec4f,16,8>::is(__value_rename_at_99) )
+	{
+		return das_auto_cast<char * const >::cast(nullptr);
+	} else return das_auto_cast<char * const >::cast(das_get_variant_field<char *,16,7>::is(__value_rename_at_99) ? das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_17, cast<char * const >::from(((char *) "=\"")), cast<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  &>::from(__value_rename_at_99), cast<char * const >::from(((char *) "\""))))) : das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_18, cast<char * const >::from(((char *) "=")), cast<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  &>::from(__value_rename_at_99)))));
+}
+
+inline void _Func_0x60_describeEnumeration_1658b23f3db6d9fa ( Context * __context__, EnumInfo const  &  __einfo_rename_at_119 )
+{
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_19, cast<char * const >::from(((char *) "enum ")), cast<char * const >::from(((char * const )(__einfo_rename_at_119.name /*name*/))), cast<char * const >::from(((char *) "\n")))),__context__);
+	{
+		bool __need_loop_121 = true;
+		// eitem : rtti::EnumValueInfo const&
+		das_iterator<EnumInfo const > __eitem_iterator(__einfo_rename_at_119);
+		EnumValueInfo const  * __eitem_rename_at_121;
+		__need_loop_121 = __eitem_iterator.first(__context__,(__eitem_rename_at_121)) && __need_loop_121;
+		for ( ; __need_loop_121 ; __need_loop_121 = __eitem_iterator.next(__context__,(__eitem_rename_at_121)) )
+		{
+			builtin_print(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_20, cast<char * const >::from(((char *) "\t")), cast<char * const >::from(((char * const )((*__eitem_rename_at_121).name /*name*/))), cast<char * const >::from(((char *) " = ")), cast<int64_t>::from((*__eitem_rename_at_121).value /*value*/), cast<char * const >::from(((char *) "\n")))),__context__);
+		}
+		__eitem_iterator.close(__context__,(__eitem_rename_at_121));
+	};
+}
+
+inline void _Func_0x60_describeStructure_ee281510bbdaabdc ( Context * __context__, StructInfo const  &  __sinfo_rename_at_110 ) { das_stack_prologue __prologue(__context__,512,"`describeStructure " DAS_FILE_LINE);
+{
+	_Funcrtti_0x60_structure_for_each_annotation_3f72bd690dbe4f48(__context__,__sinfo_rename_at_110,das_make_block<void,Annotation const  &,AnnotationArguments const  &>(__context__,80,0,&__func_info__6ad1e3a2ee25c238,[&](Annotation const  & __ann_rename_at_112, AnnotationArguments const  & __annArgs_rename_at_112)->void{
+		char * __argT_rename_at_113 = ((char *)(char *)(_Funcstrings_boost_0x60_join_9d9ba7e191784459(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]()->TArray<char *>{
+			TArray<char *> ____acomp_113_rename_at_113; das_zero(____acomp_113_rename_at_113);
+			{
+				bool __need_loop_113 = true;
+				// arg : rtti::AnnotationArgument const&
+				das_iterator<AnnotationArguments const > __arg_iterator(__annArgs_rename_at_112);
+				AnnotationArgument const  * __arg_rename_at_113;
+				__need_loop_113 = __arg_iterator.first(__context__,(__arg_rename_at_113)) && __need_loop_113;
+				for ( ; __need_loop_113 ; __need_loop_113 = __arg_iterator.next(__context__,(__arg_rename_at_113)) )
+				{
+					TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> _temp_make_local_113_352;
+					_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(____acomp_113_rename_at_113),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_21, cast<das::string const  &>::from((*__arg_rename_at_113).name /*name*/), cast<char * const >::from(_Func_0x60_describeValue_d2d6042c1a290ea1(__context__,das_arg<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>>::pass((_temp_make_local_113_352 = (das_alias<RttiValue>::from(rtti_builtin_argument_value((*__arg_rename_at_113),__context__))))))))));
+				}
+				__arg_iterator.close(__context__,(__arg_rename_at_113));
+			};
+			return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(____acomp_113_rename_at_113)));
+		})),((char *) ","))));
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_22, cast<char * const >::from(((char *) "[")), cast<das::string const  &>::from(__ann_rename_at_112.name /*name*/), cast<char * const >::from(((char *) "(")), cast<char * const >::from(__argT_rename_at_113), cast<char * const >::from(((char *) ")]\n")))),__context__);
+	}));
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_23, cast<char * const >::from(((char *) "struct ")), cast<char * const >::from(((char * const )(__sinfo_rename_at_110.name /*name*/))), cast<char * const >::from(((char *) "\n")))),__context__);
+	{
+		bool __need_loop_116 = true;
+		// sfield : rtti::VarInfo const&
+		das_iterator<StructInfo const > __sfield_iterator(__sinfo_rename_at_110);
+		VarInfo const  * __sfield_rename_at_116;
+		__need_loop_116 = __sfield_iterator.first(__context__,(__sfield_rename_at_116)) && __need_loop_116;
+		for ( ; __need_loop_116 ; __need_loop_116 = __sfield_iterator.next(__context__,(__sfield_rename_at_116)) )
+		{
+			_Func_0x60_describeVariable_4c21003f44d38096(__context__,(*__sfield_rename_at_116),((char *) "\t"));
+		}
+		__sfield_iterator.close(__context__,(__sfield_rename_at_116));
+	};
+}}
+
+inline void _Func_0x60_describeAnnotation_2ddad14e29570e3 ( Context * __context__, Annotation const  &  __ann_rename_at_124 ) { das_stack_prologue __prologue(__context__,128,"`describeAnnotation " DAS_FILE_LINE);
+{
+	if ( __ann_rename_at_124.rtti_isBasicStructureAnnotation() /*isBasicStructureAnnotation*/ )
+	{
+		BasicStructureAnnotation * __sann_rename_at_127 = ((BasicStructureAnnotation *)&(das_cast<BasicStructureAnnotation &>::cast(__ann_rename_at_124)));
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_24, cast<char * const >::from(((char *) "struct ")), cast<das::string const  &>::from((*__sann_rename_at_127).name /*name*/), cast<char * const >::from(((char *) " // ")), cast<int32_t>::from((*__sann_rename_at_127).fieldCount() /*fieldCount*/), cast<char * const >::from(((char *) " ")), cast<das::string const  &>::from((*__sann_rename_at_127).cppName /*cppName*/), cast<char * const >::from(((char *) "\n")))),__context__);
+		rtti_builtin_basic_struct_for_each_field((*__sann_rename_at_127),das_make_block<void,char *,char *,TypeInfo const  &,uint32_t>(__context__,96,0,&__func_info__2c12a6aa37521148,[&](char * __name_rename_at_129, char * __cppName_rename_at_129, TypeInfo const  & __xtype_rename_at_129, uint32_t __offset_rename_at_129)->void{
+			builtin_print(das_string_builder(__context__,SimNode_AotInterop<9>(__tinfo_25, cast<char * const >::from(((char *) "\t")), cast<char *>::from(__name_rename_at_129), cast<char * const >::from(((char *) ":")), cast<char *>::from(_Func_0x60_describeType_8b3a41c83e382da3(__context__,__xtype_rename_at_129)), cast<char * const >::from(((char *) " // ")), cast<char *>::from(__cppName_rename_at_129), cast<char * const >::from(((char *) " at ")), cast<uint32_t>::from(__offset_rename_at_129), cast<char * const >::from(((char *) "\n")))),__context__);
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	} else if ( __ann_rename_at_124.rtti_isHandledTypeAnnotation() /*isTypeAnnotation*/ )
+	{
+		TypeAnnotation * __tann_rename_at_133 = ((TypeAnnotation *)&(das_cast<TypeAnnotation &>::cast(__ann_rename_at_124)));
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_26, cast<das::string const  &>::from((*__tann_rename_at_133).name /*name*/), cast<char * const >::from(((char *) " // ")), cast<das::string const  &>::from((*__tann_rename_at_133).cppName /*cppName*/), cast<char * const >::from(((char *) "\n")))),__context__);
+	} else {
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_27, cast<das::string const  &>::from(__ann_rename_at_124.name /*name*/), cast<char * const >::from(((char *) "\n")))),__context__);
+	};
+}}
+
+inline void _Func_0x60_describeFunction_deba3fc8aa932956 ( Context * __context__, FuncInfo const  &  __finfo_rename_at_90 )
+{
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_28, cast<char * const >::from(((char *) "def ")), cast<char * const >::from(((char * const )(__finfo_rename_at_90.name /*name*/))), cast<char * const >::from(((char *) " ")))),__context__);
+	if ( __finfo_rename_at_90.count /*count*/ != 0x0u )
+	{
+		char * __argT_rename_at_93 = ((char *)(char *)(_Funcstrings_boost_0x60_join_9d9ba7e191784459(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]()->TArray<char *>{
+			TArray<char *> ____acomp_93_rename_at_93; das_zero(____acomp_93_rename_at_93);
+			{
+				bool __need_loop_93 = true;
+				// arg : rtti::VarInfo const&
+				das_iterator<FuncInfo const > __arg_iterator(__finfo_rename_at_90);
+				VarInfo const  * __arg_rename_at_93;
+				__need_loop_93 = __arg_iterator.first(__context__,(__arg_rename_at_93)) && __need_loop_93;
+				for ( ; __need_loop_93 ; __need_loop_93 = __arg_iterator.next(__context__,(__arg_rename_at_93)) )
+				{
+					_Funcbuiltin_0x60_push_49bdd408ef1e4c5a(__context__,das_arg<TArray<char *>>::pass(____acomp_93_rename_at_93),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_29, cast<char * const >::from(((char * const )((*__arg_rename_at_93).name /*name*/))), cast<char * const >::from(((char *) ":")), cast<char *>::from(_Func_0x60_describeType_e026a100f91229ef(__context__,(*__arg_rename_at_93))))));
+				}
+				__arg_iterator.close(__context__,(__arg_rename_at_93));
+			};
+			return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(____acomp_93_rename_at_93)));
+		})),((char *) "; "))));
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_30, cast<char * const >::from(((char *) "( ")), cast<char * const >::from(__argT_rename_at_93), cast<char * const >::from(((char *) " ) ")))),__context__);
+	};
+	if ( __finfo_rename_at_90.result /*result*/ != nullptr )
+	{
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_31, cast<char * const >::from(((char *) ": ")), cast<char *>::from(_Func_0x60_describeType_8b3a41c83e382da3(__context__,das_deref(__context__,__finfo_rename_at_90.result /*result*/))))),__context__);
+	};
+	builtin_print(((char *) "\n"),__context__);
+}
+
+inline void _Func_0x60_describeVariable_4c21003f44d38096 ( Context * __context__, VarInfo const  &  __glob_rename_at_107, char * const  __extra_rename_at_107 )
+{
+	TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> _temp_make_local_108_32;
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<6>(__tinfo_32, cast<char * const >::from(__extra_rename_at_107), cast<char * const >::from(((char * const )(__glob_rename_at_107.name /*name*/))), cast<char * const >::from(((char *) " : ")), cast<char *>::from(_Func_0x60_describeType_e026a100f91229ef(__context__,__glob_rename_at_107)), cast<char * const >::from(_Func_0x60_describeValue_d2d6042c1a290ea1(__context__,das_arg<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>>::pass((_temp_make_local_108_32 = (das_alias<RttiValue>::from(rtti_builtin_variable_value(__glob_rename_at_107))))))), cast<char * const >::from(((char *) "\n")))),__context__);
+}
+
+inline void _Func_0x60_describeModule_770309617fce2149 ( Context * __context__, Module * const  __mod_rename_at_138 ) { das_stack_prologue __prologue(__context__,416,"`describeModule " DAS_FILE_LINE);
+{
+	rtti_builtin_module_for_each_enumeration(__mod_rename_at_138,das_make_block<void,EnumInfo const  &>(__context__,80,0,&__func_info__111e1cc17e1f6877,[&](EnumInfo const  & __einfo_rename_at_139)->void{
+		_Func_0x60_describeEnumeration_1658b23f3db6d9fa(__context__,__einfo_rename_at_139);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	rtti_builtin_module_for_each_structure(__mod_rename_at_138,das_make_block<void,StructInfo const  &>(__context__,144,0,&__func_info__ed882aeeee77d685,[&](StructInfo const  & __sinfo_rename_at_141)->void{
+		_Func_0x60_describeStructure_ee281510bbdaabdc(__context__,__sinfo_rename_at_141);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	rtti_builtin_module_for_each_annotation(__mod_rename_at_138,das_make_block<void,Annotation const  &>(__context__,208,0,&__func_info__d3151a2573df63e7,[&](Annotation const  & __ann_rename_at_143)->void{
+		_Func_0x60_describeAnnotation_2ddad14e29570e3(__context__,__ann_rename_at_143);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	rtti_builtin_module_for_each_function(__mod_rename_at_138,das_make_block<void,FuncInfo const  &>(__context__,272,0,&__func_info__42b9ab3569fc8cc2,[&](FuncInfo const  & __finfo_rename_at_145)->void{
+		_Func_0x60_describeFunction_deba3fc8aa932956(__context__,__finfo_rename_at_145);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	rtti_builtin_module_for_each_generic(__mod_rename_at_138,das_make_block<void,FuncInfo const  &>(__context__,336,0,&__func_info__42b9ab3569fc8cc2,[&](FuncInfo const  & __finfo_rename_at_147)->void{
+		_Func_0x60_describeFunction_deba3fc8aa932956(__context__,__finfo_rename_at_147);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	rtti_builtin_module_for_each_global(__mod_rename_at_138,das_make_block<void,VarInfo const  &>(__context__,400,0,&__func_info__4630f883740fb23c,[&](VarInfo const  & __glob_rename_at_149)->void{
+		_Func_0x60_describeVariable_4c21003f44d38096(__context__,__glob_rename_at_149,nullptr);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+
+inline void _Funcrtti_0x60_context_for_each_function_f61741bb8a08ddac ( Context * __context__, Block DAS_COMMENT((void,FuncInfo const )) const  &  __blk_rename_at_28 )
+{
+	{
+		bool __need_loop_29 = true;
+		// fni : int const
+		das_iterator<range> __fni_iterator(mk_range(rtti_contextTotalFunctions(das_arg<Context>::pass(thisContext(__context__)))));
+		int32_t __fni_rename_at_29;
+		__need_loop_29 = __fni_iterator.first(__context__,(__fni_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __fni_iterator.next(__context__,(__fni_rename_at_29)) )
+		{
+			das_invoke<void>::invoke<FuncInfo const  &>(__context__,nullptr,__blk_rename_at_28,das_call_interop<FuncInfo const  &>::call(&rtti_contextFunctionInfo,__context__,SimNode_AotInterop<2>(__tinfo_33,cast<Context &>::from(thisContext(__context__)),cast<int32_t>::from(__fni_rename_at_29))));
+		}
+		__fni_iterator.close(__context__,(__fni_rename_at_29));
+	};
+}
+
+inline void _Funcrtti_0x60_context_for_each_variable_1f2d7042992bbcd3 ( Context * __context__, Block DAS_COMMENT((void,VarInfo const )) const  &  __blk_rename_at_33 )
+{
+	{
+		bool __need_loop_34 = true;
+		// vi : int const
+		das_iterator<range> __vi_iterator(mk_range(rtti_contextTotalVariables(das_arg<Context>::pass(thisContext(__context__)))));
+		int32_t __vi_rename_at_34;
+		__need_loop_34 = __vi_iterator.first(__context__,(__vi_rename_at_34)) && __need_loop_34;
+		for ( ; __need_loop_34 ; __need_loop_34 = __vi_iterator.next(__context__,(__vi_rename_at_34)) )
+		{
+			das_invoke<void>::invoke<VarInfo const  &>(__context__,nullptr,__blk_rename_at_33,das_call_interop<VarInfo const  &>::call(&rtti_contextVariableInfo,__context__,SimNode_AotInterop<2>(__tinfo_34,cast<Context &>::from(thisContext(__context__)),cast<int32_t>::from(__vi_rename_at_34))));
+		}
+		__vi_iterator.close(__context__,(__vi_rename_at_34));
+	};
+}
+
+inline bool main_c82b89aedf3f8860 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,448,"main " DAS_FILE_LINE);
+{
+	CodeOfPolicies _temp_make_local_159_96;
+	rtti_builtin_program_for_each_registered_module(das_make_block<void,Module *>(__context__,80,0,&__func_info__c13635b7462011bb,[&](Module * __mod_rename_at_155)->void{
+		_Func_0x60_describeModule_770309617fce2149(__context__,__mod_rename_at_155);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	_Func_0x60_describeModule_770309617fce2149(__context__,rtti_get_builtin_module(((char *) "$")));
+	rtti_builtin_compile(((char *) "sample"),das_global<char *,0xcd3e2ceccecd7dd2>(__context__) /*sample*/,das_arg<CodeOfPolicies>::pass((_temp_make_local_159_96 = (/*c-tor*/ CodeOfPolicies(/*end-c-tor*/)))),das_make_block<void,bool,smart_ptr<Program>,das::string const  &>(__context__,224,0,&__func_info__fde63a99772d772a,[&](bool __ok_rename_at_159, smart_ptr<Program> __prog_rename_at_159, das::string const  & __errors_rename_at_159)->void{
+		if ( __ok_rename_at_159 )
+		{
+			builtin_print(((char *) "compiled\n"),__context__);
+			Module * __thisMod_rename_at_162 = ((Module *)rtti_get_this_module(__prog_rename_at_159));
+			rtti_builtin_program_for_each_module(__prog_rename_at_159,das_make_block<void,Module *>(__context__,304,0,&__func_info__c13635b7462011bb,[&](Module * __mod_rename_at_163)->void{
+				if ( __mod_rename_at_163 == __thisMod_rename_at_162 )
+				{
+					_Func_0x60_describeModule_770309617fce2149(__context__,__mod_rename_at_163);
+				};
+			}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		} else {
+			builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_35, cast<char * const >::from(((char *) "failed to compile:\n")), cast<das::string const  &>::from(__errors_rename_at_159), cast<char * const >::from(((char *) "\n")))),__context__);
+			DAS_ASSERT((false));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	_Funcrtti_0x60_context_for_each_function_f61741bb8a08ddac(__context__,das_make_block<void,FuncInfo const  &>(__context__,368,0,&__func_info__42b9ab3569fc8cc2,[&](FuncInfo const  & __finfo_rename_at_170)->void{
+		_Func_0x60_describeFunction_deba3fc8aa932956(__context__,__finfo_rename_at_170);
+	}));
+	_Funcrtti_0x60_context_for_each_variable_1f2d7042992bbcd3(__context__,das_make_block<void,VarInfo const  &>(__context__,432,0,&__func_info__93b32dbff1ee41dc,[&](VarInfo const  & __vinfo_rename_at_172)->void{
+		_Func_0x60_describeVariable_4c21003f44d38096(__context__,__vinfo_rename_at_172,nullptr);
+	}));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline bool test_b0087d371648db3f ( Context * __context__ )
+{
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_each_5cbab1dfe9635bc1
+	aotLib[0x8c2bf3089ff8b6f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_5cbab1dfe9635bc1>>();
+	};
+	// finalize_e22c2ab37dc6acaf
+	aotLib[0x77e36d2736e32d49] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_40_21_5 &  ),&finalize_e22c2ab37dc6acaf>>();
+	};
+	// finalize_122063b03197e0e6
+	aotLib[0xd76f79bcaed6d945] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_40_21_6 &  ),&finalize_122063b03197e0e6>>();
+	};
+	// _Funcbuiltin_0x60_each_3d5479e9b282f2ef
+	aotLib[0x6680963fbeb6af05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_3d5479e9b282f2ef>>();
+	};
+	// finalize_78e2d212e48b3566
+	aotLib[0xdefa499d8ea1d685] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_54_12_1 &  ),&finalize_78e2d212e48b3566>>();
+	};
+	// finalize_d0485049507a858f
+	aotLib[0x56a30f372dee8edd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_72_12_2 &  ),&finalize_d0485049507a858f>>();
+	};
+	// finalize_3a6818aad144f7c0
+	aotLib[0xc3f8e56947bcda7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_54_12_3 &  ),&finalize_3a6818aad144f7c0>>();
+	};
+	// finalize_f850a27986f951a9
+	aotLib[0x14168c3975368d51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_72_12_4 &  ),&finalize_f850a27986f951a9>>();
+	};
+	// _Funcbuiltin_0x60_each_ref_1607ca369977f978
+	aotLib[0x9679ff2aa42db15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const   ),&_Funcbuiltin_0x60_each_ref_1607ca369977f978>>();
+	};
+	// _Funcbuiltin_0x60_each_b77a57a217361068
+	aotLib[0x482653acb1c06fc1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const   ),&_Funcbuiltin_0x60_each_b77a57a217361068>>();
+	};
+	// _Func_lambda_thismodule_40_21_5_0x60_function_f8d47f7646034bd7
+	aotLib[0x22fb6094b9571bb7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_40_21_5 & , int32_t &  ),&_Func_lambda_thismodule_40_21_5_0x60_function_f8d47f7646034bd7>>();
+	};
+	// _Func_lambda_thismodule_40_21_5_0x60_finalizer_b2bc7709be071290
+	aotLib[0xc10530feae6f5944] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_40_21_5 *  ),&_Func_lambda_thismodule_40_21_5_0x60_finalizer_b2bc7709be071290>>();
+	};
+	// _Func_lambda_thismodule_40_21_6_0x60_function_1259040e14b0f996
+	aotLib[0x382d0eee738b7f87] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_40_21_6 & , int32_t &  ),&_Func_lambda_thismodule_40_21_6_0x60_function_1259040e14b0f996>>();
+	};
+	// _Func_lambda_thismodule_40_21_6_0x60_finalizer_e57bb9527cd69c5e
+	aotLib[0x3500e564f4181984] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_40_21_6 *  ),&_Func_lambda_thismodule_40_21_6_0x60_finalizer_e57bb9527cd69c5e>>();
+	};
+	// _Func_lambda_thismodule_54_12_1_0x60_function_3f7f7a8673272fc
+	aotLib[0x901d18e137b08a9b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_54_12_1 & , TypeInfo const  * &  ),&_Func_lambda_thismodule_54_12_1_0x60_function_3f7f7a8673272fc>>();
+	};
+	// _Func_lambda_thismodule_54_12_1_0x60_finalizer_e2caef4b069bb3ca
+	aotLib[0x75965f23e0e82701] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_54_12_1 *  ),&_Func_lambda_thismodule_54_12_1_0x60_finalizer_e2caef4b069bb3ca>>();
+	};
+	// _Func_lambda_thismodule_72_12_2_0x60_function_9b712201c43b54df
+	aotLib[0xc86ba600a320dcef] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_72_12_2 & , char * &  ),&_Func_lambda_thismodule_72_12_2_0x60_function_9b712201c43b54df>>();
+	};
+	// _Func_lambda_thismodule_72_12_2_0x60_finalizer_68384240d4969e64
+	aotLib[0x75701d2dbc718922] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_72_12_2 *  ),&_Func_lambda_thismodule_72_12_2_0x60_finalizer_68384240d4969e64>>();
+	};
+	// _Func_lambda_thismodule_54_12_3_0x60_function_13a122e47015a7c2
+	aotLib[0x554fccdc0afb92a7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_54_12_3 & , TypeInfo const  * &  ),&_Func_lambda_thismodule_54_12_3_0x60_function_13a122e47015a7c2>>();
+	};
+	// _Func_lambda_thismodule_54_12_3_0x60_finalizer_b09a9a95e5c6809e
+	aotLib[0x8f354e43637eb5ab] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_54_12_3 *  ),&_Func_lambda_thismodule_54_12_3_0x60_finalizer_b09a9a95e5c6809e>>();
+	};
+	// _Func_lambda_thismodule_72_12_4_0x60_function_5bcbb7652685435d
+	aotLib[0x4a6fb3035914e68b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_72_12_4 & , char * &  ),&_Func_lambda_thismodule_72_12_4_0x60_function_5bcbb7652685435d>>();
+	};
+	// _Func_lambda_thismodule_72_12_4_0x60_finalizer_16408138305be6c
+	aotLib[0x5971aff9be0d31e7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_72_12_4 *  ),&_Func_lambda_thismodule_72_12_4_0x60_finalizer_16408138305be6c>>();
+	};
+	// _Funcrtti_0x60_arg_types_any_735dabc9bb2cfb3b
+	aotLib[0x6a73e744f8e0c847] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, VarInfo const  &  ),&_Funcrtti_0x60_arg_types_any_735dabc9bb2cfb3b>>();
+	};
+	// _Funcrtti_0x60_arg_names_any_ec9d3e677f4c5580
+	aotLib[0x7e5f71beda31d4e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, VarInfo const  &  ),&_Funcrtti_0x60_arg_names_any_ec9d3e677f4c5580>>();
+	};
+	// _Funcrtti_0x60_each_dim_any_104b74ea2f5e6089
+	aotLib[0xdc2dff5eb674d75b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, VarInfo const  &  ),&_Funcrtti_0x60_each_dim_any_104b74ea2f5e6089>>();
+	};
+	// _Funcrtti_0x60_arg_types_any_e03f6d2d665c6cae
+	aotLib[0x9fea7489a4187b0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_types_any_e03f6d2d665c6cae>>();
+	};
+	// _Funcrtti_0x60_arg_names_any_30b38f673dda1c82
+	aotLib[0xb85ee21cabfc209] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_names_any_30b38f673dda1c82>>();
+	};
+	// _Funcrtti_0x60_each_dim_any_a258d520ce6be0e5
+	aotLib[0xbe9ac85713580aff] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_each_dim_any_a258d520ce6be0e5>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465
+	aotLib[0xed99ea3c3e04d451] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<char *> & (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465>>();
+	};
+	// _Funcrtti_0x60_arg_types_917d5ebd8853d661
+	aotLib[0x4d4a932a4cedb4d0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, VarInfo const  &  ),&_Funcrtti_0x60_arg_types_917d5ebd8853d661>>();
+	};
+	// _Funcrtti_0x60_arg_names_22e0cdc118be6a6c
+	aotLib[0x90514d5ddecbb79c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, VarInfo const  &  ),&_Funcrtti_0x60_arg_names_22e0cdc118be6a6c>>();
+	};
+	// _Funcrtti_0x60_each_dim_f5526c67356b3f98
+	aotLib[0x118faf4a59719d04] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, VarInfo const  &  ),&_Funcrtti_0x60_each_dim_f5526c67356b3f98>>();
+	};
+	// _Funcrtti_0x60_arg_types_d3f96ce97ffb0433
+	aotLib[0x511527caa36db86c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_types_d3f96ce97ffb0433>>();
+	};
+	// _Funcrtti_0x60_arg_names_4e81e6cbaea75066
+	aotLib[0xba6e572ded0f612b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_names_4e81e6cbaea75066>>();
+	};
+	// _Funcrtti_0x60_each_dim_900b57120fc9d5d6
+	aotLib[0xc15a72bf1367139e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_each_dim_900b57120fc9d5d6>>();
+	};
+	// _Funcbuiltin_0x60_push_49bdd408ef1e4c5a
+	aotLib[0xb187be2de84ea8d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const   ),&_Funcbuiltin_0x60_push_49bdd408ef1e4c5a>>();
+	};
+	// _Funcstrings_boost_0x60_join_9d9ba7e191784459
+	aotLib[0xdafed42ba5563909] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TArray<char *> const  & , char * const   ),&_Funcstrings_boost_0x60_join_9d9ba7e191784459>>();
+	};
+	// _Funcrtti_0x60_structure_for_each_annotation_3f72bd690dbe4f48
+	aotLib[0x5bf8b58a9ab498d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, StructInfo const  & , Block DAS_COMMENT((void,Annotation const ,AnnotationArguments const )) const  &  ),&_Funcrtti_0x60_structure_for_each_annotation_3f72bd690dbe4f48>>();
+	};
+	// _Func_0x60_describeType_e026a100f91229ef
+	aotLib[0x708efe42941d8a73] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, VarInfo const  &  ),&_Func_0x60_describeType_e026a100f91229ef>>();
+	};
+	// _Func_0x60_describeType_8b3a41c83e382da3
+	aotLib[0x774b989874166625] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, TypeInfo const  &  ),&_Func_0x60_describeType_8b3a41c83e382da3>>();
+	};
+	// _Func_0x60_describeValue_d2d6042c1a290ea1
+	aotLib[0x4b0138d5af4742d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  &  ),&_Func_0x60_describeValue_d2d6042c1a290ea1>>();
+	};
+	// _Func_0x60_describeEnumeration_1658b23f3db6d9fa
+	aotLib[0xb10955b6490e4a05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, EnumInfo const  &  ),&_Func_0x60_describeEnumeration_1658b23f3db6d9fa>>();
+	};
+	// _Func_0x60_describeStructure_ee281510bbdaabdc
+	aotLib[0x67ebfda8d24341a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, StructInfo const  &  ),&_Func_0x60_describeStructure_ee281510bbdaabdc>>();
+	};
+	// _Func_0x60_describeAnnotation_2ddad14e29570e3
+	aotLib[0x8b923bfb64e72137] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Annotation const  &  ),&_Func_0x60_describeAnnotation_2ddad14e29570e3>>();
+	};
+	// _Func_0x60_describeFunction_deba3fc8aa932956
+	aotLib[0x179b089f24ca871b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, FuncInfo const  &  ),&_Func_0x60_describeFunction_deba3fc8aa932956>>();
+	};
+	// _Func_0x60_describeVariable_4c21003f44d38096
+	aotLib[0x7a91a1fb4c1388cf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, VarInfo const  & , char * const   ),&_Func_0x60_describeVariable_4c21003f44d38096>>();
+	};
+	// _Func_0x60_describeModule_770309617fce2149
+	aotLib[0xbd82b877fbc29a2c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Module * const   ),&_Func_0x60_describeModule_770309617fce2149>>();
+	};
+	// _Funcrtti_0x60_context_for_each_function_f61741bb8a08ddac
+	aotLib[0x530a5f030f76c685] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void,FuncInfo const )) const  &  ),&_Funcrtti_0x60_context_for_each_function_f61741bb8a08ddac>>();
+	};
+	// _Funcrtti_0x60_context_for_each_variable_1f2d7042992bbcd3
+	aotLib[0x666f6c3d0223b4c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void,VarInfo const )) const  &  ),&_Funcrtti_0x60_context_for_each_variable_1f2d7042992bbcd3>>();
+	};
+	// main_c82b89aedf3f8860
+	aotLib[0xb38fcaba008d24a4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&main_c82b89aedf3f8860>>();
+	};
+	// test_b0087d371648db3f
+	aotLib[0x434f546c6487b225] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b0087d371648db3f>>();
+	};
+	// [[ init script ]]
+	aotLib[0xea6a96836b462e1b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
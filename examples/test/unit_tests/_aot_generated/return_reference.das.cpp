@@ -0,0 +1,133 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5195235318066913116 {
+
+extern TypeInfo __type_info__7bf5307b489d850;
+extern FuncInfo __func_info__2693f6c220076c3a;
+
+FuncInfo __func_info__2693f6c220076c3a = {"invoke block<int&> const", "", nullptr, 0, 32, &__type_info__7bf5307b489d850, nullptr,0,UINT64_C(0x2693f6c220076c3a), 0x0 };
+TypeInfo __type_info__7bf5307b489d850 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0x7bf5307b489d850) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline int32_t & _Func_0x60_ret_safe_ref_a028cae6fce9d180 ( Context * __context__, int32_t & __a_rename_at_13 );
+inline int32_t & ret_ref_26646e92e5aef365 ( Context * __context__ );
+inline void add2_ecad6a810a3f93cf ( Context * __context__, Block DAS_COMMENT((int32_t &)) const  & __bl_rename_at_17 );
+inline bool test_580a6ef46fb1c94 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0xca6b878d961c569a>(__context__) = 2;/*g_t*/
+}
+
+inline int32_t & _Func_0x60_ret_safe_ref_a028cae6fce9d180 ( Context * __context__, int32_t & __a_rename_at_13 )
+{
+	return das_auto_cast_ref<int32_t &>::cast(__a_rename_at_13);
+}
+
+inline int32_t & ret_ref_26646e92e5aef365 ( Context * __context__ )
+{
+	int32_t * __qq_rename_at_8 = &(das_global<int32_t,0xca6b878d961c569a>(__context__) /*g_t*/);
+	return das_auto_cast_ref<int32_t &>::cast((*__qq_rename_at_8));
+}
+
+inline void add2_ecad6a810a3f93cf ( Context * __context__, Block DAS_COMMENT((int32_t &)) const  &  __bl_rename_at_17 )
+{
+	das_invoke<int32_t &>::invoke(__context__,nullptr,__bl_rename_at_17) += 2;
+}
+
+inline bool test_580a6ef46fb1c94 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,128,"test " DAS_FILE_LINE);
+{
+	int32_t __x_rename_at_23 = ret_ref_26646e92e5aef365(__context__);
+	int32_t * __xx_rename_at_24 = &(_Func_0x60_ret_safe_ref_a028cae6fce9d180(__context__,__x_rename_at_23));
+	DAS_ASSERT(((*__xx_rename_at_24) == 2));
+	int32_t * __z_rename_at_26 = &(ret_ref_26646e92e5aef365(__context__));
+	DAS_ASSERT(((__x_rename_at_23 == 2) && ((*__z_rename_at_26) == 2)));
+	das_copy(ret_ref_26646e92e5aef365(__context__),3);
+	DAS_ASSERT(((__x_rename_at_23 == 2) && ((*__z_rename_at_26) == 3)));
+	das_copy((*__xx_rename_at_24),4);
+	DAS_ASSERT((((__x_rename_at_23 == 4) && ((*__z_rename_at_26) == 3)) && ((*__xx_rename_at_24) == 4)));
+	add2_ecad6a810a3f93cf(__context__,das_make_block<int32_t &>(__context__,0,0,&__func_info__2693f6c220076c3a,[&]()->int32_t &{
+		return das_auto_cast_ref<int32_t &>::cast(__x_rename_at_23);
+	}));
+	DAS_ASSERT((__x_rename_at_23 == 6));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_ret_safe_ref_a028cae6fce9d180
+	aotLib[0x7a1627de2562091] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t & (*) ( Context * __context__, int32_t &  ),&_Func_0x60_ret_safe_ref_a028cae6fce9d180>>();
+	};
+	// ret_ref_26646e92e5aef365
+	aotLib[0x85d2b1b68ebd7b61] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t & (*) ( Context * __context__ ),&ret_ref_26646e92e5aef365>>();
+	};
+	// add2_ecad6a810a3f93cf
+	aotLib[0xab4ed2f7ace27c65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((int32_t &)) const  &  ),&add2_ecad6a810a3f93cf>>();
+	};
+	// test_580a6ef46fb1c94
+	aotLib[0x48e50db7fbfeb05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_580a6ef46fb1c94>>();
+	};
+	// [[ init script ]]
+	aotLib[0x4b4a8414f8345aac] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
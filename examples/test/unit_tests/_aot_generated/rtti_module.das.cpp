@@ -0,0 +1,506 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12120485503138813146 {
+
+extern StructInfo __struct_info__d1c5e87fd4f05c88;
+extern StructInfo __struct_info__8673697d12c4f401;
+extern TypeInfo __type_info__90f4c07b5a6e390;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__cbed94a1f48e0dcf;
+extern TypeInfo __type_info__b3be2b75180ea20c;
+extern TypeInfo __type_info__7bf4d07b489ce1e;
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__90f5007b5a6ea5c;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__d262541884b14084;
+extern TypeInfo __type_info__c3fda6ec581060af;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__9b8e12ff1e5f74ae;
+extern TypeInfo __type_info__b75c75094bb47869;
+extern TypeInfo __type_info__1fd302790fa7f3df;
+extern VarInfo __var_info__1cd94d063dae886a;
+extern VarInfo __var_info__220dad35ac8ff362;
+extern VarInfo __var_info__1291b1620a2fdd4d;
+extern VarInfo __var_info__5d46bbecd30a60b8;
+extern VarInfo __var_info__78a0673a3decf40d;
+extern VarInfo __var_info__6689fe32cda0eb3f;
+extern VarInfo __var_info__c633d2c8366b18f2;
+extern VarInfo __var_info__f6d363cc58f5a659;
+extern VarInfo __var_info__9152ef704ab371a5;
+extern VarInfo __var_info__114e9ea731f3cd78;
+extern VarInfo __var_info__e9d9f4219b34966e;
+extern VarInfo __var_info__ceeffa95e6077279;
+extern VarInfo __var_info__1a44fb7ca3546556;
+extern VarInfo __var_info__413d93a4a2b9f235;
+extern VarInfo __var_info__e438dbc9de78caca;
+extern VarInfo __var_info__3cd469e12de40b5f;
+
+TypeInfo * __type_info__f6d363cc58f5a659_arg_types_var_15115743360069950600[2] = { &__type_info__1fd302790fa7f3df, &__type_info__7bf4d07b489ce1e };
+VarInfo __struct_info__d1c5e87fd4f05c88_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__f6d363cc58f5a659_arg_types_var_15115743360069950600, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xf6d363cc58f5a659), "__lambda", 0 };
+TypeInfo * __type_info__5d46bbecd30a60b8_arg_types_var_15115743360069950600[1] = { &__type_info__cbed94a1f48e0dcf };
+VarInfo __struct_info__d1c5e87fd4f05c88_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__5d46bbecd30a60b8_arg_types_var_15115743360069950600, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x5d46bbecd30a60b8), "__finalize", 8 };
+VarInfo __struct_info__d1c5e87fd4f05c88_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x6689fe32cda0eb3f), "__yield", 16 };
+VarInfo __struct_info__d1c5e87fd4f05c88_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c3fda6ec581060af, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x114e9ea731f3cd78), "pinfo", 24 };
+VarInfo __struct_info__d1c5e87fd4f05c88_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x1cd94d063dae886a), "___loop_at_73_rename_at_73", 32 };
+VarInfo __struct_info__d1c5e87fd4f05c88_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xc633d2c8366b18f2), "__index_rename_at_73", 36 };
+VarInfo __struct_info__d1c5e87fd4f05c88_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x1a44fb7ca3546556), "___pvar_0_at_73_rename_at_73", 40 };
+VarInfo __struct_info__d1c5e87fd4f05c88_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x220dad35ac8ff362), "___source_0_at_73_rename_at_73", 48 };
+VarInfo * __struct_info__d1c5e87fd4f05c88_fields[8] =  { &__struct_info__d1c5e87fd4f05c88_field_0, &__struct_info__d1c5e87fd4f05c88_field_1, &__struct_info__d1c5e87fd4f05c88_field_2, &__struct_info__d1c5e87fd4f05c88_field_3, &__struct_info__d1c5e87fd4f05c88_field_4, &__struct_info__d1c5e87fd4f05c88_field_5, &__struct_info__d1c5e87fd4f05c88_field_6, &__struct_info__d1c5e87fd4f05c88_field_7 };
+StructInfo __struct_info__d1c5e87fd4f05c88 = {"_lambda_thismodule_72_12_1", "", 14, __struct_info__d1c5e87fd4f05c88_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0xd1c5e87fd4f05c88) };
+TypeInfo * __type_info__e438dbc9de78caca_arg_types_var_9688203209310794753[2] = { &__type_info__b3be2b75180ea20c, &__type_info__b75c75094bb47869 };
+VarInfo __struct_info__8673697d12c4f401_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__e438dbc9de78caca_arg_types_var_9688203209310794753, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xe438dbc9de78caca), "__lambda", 0 };
+TypeInfo * __type_info__3cd469e12de40b5f_arg_types_var_9688203209310794753[1] = { &__type_info__d262541884b14084 };
+VarInfo __struct_info__8673697d12c4f401_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__3cd469e12de40b5f_arg_types_var_9688203209310794753, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x3cd469e12de40b5f), "__finalize", 8 };
+VarInfo __struct_info__8673697d12c4f401_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xe9d9f4219b34966e), "__yield", 16 };
+VarInfo __struct_info__8673697d12c4f401_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c3fda6ec581060af, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x9152ef704ab371a5), "pinfo", 24 };
+VarInfo __struct_info__8673697d12c4f401_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x413d93a4a2b9f235), "___loop_at_55_rename_at_55", 32 };
+VarInfo __struct_info__8673697d12c4f401_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x78a0673a3decf40d), "__index_rename_at_55", 36 };
+VarInfo __struct_info__8673697d12c4f401_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xceeffa95e6077279), "___pvar_0_at_55_rename_at_55", 40 };
+VarInfo __struct_info__8673697d12c4f401_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x1291b1620a2fdd4d), "___source_0_at_55_rename_at_55", 48 };
+VarInfo * __struct_info__8673697d12c4f401_fields[8] =  { &__struct_info__8673697d12c4f401_field_0, &__struct_info__8673697d12c4f401_field_1, &__struct_info__8673697d12c4f401_field_2, &__struct_info__8673697d12c4f401_field_3, &__struct_info__8673697d12c4f401_field_4, &__struct_info__8673697d12c4f401_field_5, &__struct_info__8673697d12c4f401_field_6, &__struct_info__8673697d12c4f401_field_7 };
+StructInfo __struct_info__8673697d12c4f401 = {"_lambda_thismodule_54_12_2", "", 14, __struct_info__8673697d12c4f401_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0x8673697d12c4f401) };
+TypeInfo __type_info__90f4c07b5a6e390 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0x90f4c07b5a6e390) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__cbed94a1f48e0dcf = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1fd302790fa7f3df, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xcbed94a1f48e0dcf) };
+TypeInfo __type_info__b3be2b75180ea20c = { Type::tStructure, &__struct_info__8673697d12c4f401, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0xb3be2b75180ea20c) };
+TypeInfo __type_info__7bf4d07b489ce1e = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16645, 8, UINT64_C(0x7bf4d07b489ce1e) };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63db4c8601ead9) };
+TypeInfo __type_info__90f5007b5a6ea5c = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5007b5a6ea5c) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__d262541884b14084 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b3be2b75180ea20c, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xd262541884b14084) };
+TypeInfo __type_info__c3fda6ec581060af = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::TypeInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24622, 80, UINT64_C(0xc3fda6ec581060af) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+TypeInfo * __type_info__9b8e12ff1e5f74ae_arg_types[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+const char * __type_info__9b8e12ff1e5f74ae_arg_names[2] = { "i", "f" };
+TypeInfo __type_info__9b8e12ff1e5f74ae = { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__9b8e12ff1e5f74ae_arg_types, __type_info__9b8e12ff1e5f74ae_arg_names, 2, 0, nullptr, 62, 8, UINT64_C(0x9b8e12ff1e5f74ae) };
+TypeInfo __type_info__b75c75094bb47869 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c3fda6ec581060af, nullptr, nullptr, nullptr, 0, 0, nullptr, 24845, 8, UINT64_C(0xb75c75094bb47869) };
+TypeInfo __type_info__1fd302790fa7f3df = { Type::tStructure, &__struct_info__d1c5e87fd4f05c88, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0x1fd302790fa7f3df) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__c3fda6ec581060af.resolveAnnotation();
+}
+
+namespace  { struct _lambda_thismodule_72_12_1; };
+namespace  { struct _lambda_thismodule_54_12_2; };
+// unused enumeration CompilationError
+// unused enumeration Type
+#if 0 // external enum
+namespace rtti {
+
+enum class RefMatters : int32_t {
+	no = int32_t(INT64_C(0)),
+	yes = int32_t(INT64_C(1)),
+};
+}
+#endif // external enum
+#if 0 // external enum
+namespace rtti {
+
+enum class ConstMatters : int32_t {
+	no = int32_t(INT64_C(0)),
+	yes = int32_t(INT64_C(1)),
+};
+}
+#endif // external enum
+#if 0 // external enum
+namespace rtti {
+
+enum class TemporaryMatters : int32_t {
+	no = int32_t(INT64_C(0)),
+	yes = int32_t(INT64_C(1)),
+};
+}
+#endif // external enum
+namespace  {
+
+struct _lambda_thismodule_72_12_1 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_72_12_1,char * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_72_12_1 *)) __finalize;
+	int32_t __yield;
+	TypeInfo const  * pinfo;
+	bool ___loop_at_73_rename_at_73;
+	int32_t __index_rename_at_73;
+	void * ___pvar_0_at_73_rename_at_73;
+	Sequence DAS_COMMENT((int32_t)) ___source_0_at_73_rename_at_73;
+};
+static_assert(sizeof(_lambda_thismodule_72_12_1)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_1,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_1,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_1,___loop_at_73_rename_at_73)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_1,__index_rename_at_73)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_1,___pvar_0_at_73_rename_at_73)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_12_1,___source_0_at_73_rename_at_73)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_54_12_2 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_54_12_2,TypeInfo const  * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_54_12_2 *)) __finalize;
+	int32_t __yield;
+	TypeInfo const  * pinfo;
+	bool ___loop_at_55_rename_at_55;
+	int32_t __index_rename_at_55;
+	void * ___pvar_0_at_55_rename_at_55;
+	Sequence DAS_COMMENT((int32_t)) ___source_0_at_55_rename_at_55;
+};
+static_assert(sizeof(_lambda_thismodule_54_12_2)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_2,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_2,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_2,___loop_at_55_rename_at_55)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_2,__index_rename_at_55)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_2,___pvar_0_at_55_rename_at_55)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_54_12_2,___source_0_at_55_rename_at_55)==48,"structure field offset mismatch with DAS");
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_451 );
+inline void finalize_dc89aae4677d546 ( Context * __context__, _lambda_thismodule_72_12_1 & ____this_rename_at_72 );
+inline void finalize_48ee991630ba012f ( Context * __context__, _lambda_thismodule_54_12_2 & ____this_rename_at_54 );
+inline Sequence DAS_COMMENT((char *)) _Funcbuiltin_0x60_each_b77a57a217361068 ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_480 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcbuiltin_0x60_each_ref_1607ca369977f978 ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const  __lam_rename_at_487 );
+inline bool _Func_lambda_thismodule_72_12_1_0x60_function_ab96ca71a8f7fd3e ( Context * __context__, _lambda_thismodule_72_12_1 & ____this_rename_at_72, char * & ___yield_72_rename_at_72 );
+inline void _Func_lambda_thismodule_72_12_1_0x60_finalizer_365776f06e345f26 ( Context * __context__, _lambda_thismodule_72_12_1 * ____this_rename_at_72 );
+inline bool _Func_lambda_thismodule_54_12_2_0x60_function_9e98497768bdeaef ( Context * __context__, _lambda_thismodule_54_12_2 & ____this_rename_at_54, TypeInfo const  * & ___ryield54_rename_at_54 );
+inline void _Func_lambda_thismodule_54_12_2_0x60_finalizer_890bf603b00c3a9c ( Context * __context__, _lambda_thismodule_54_12_2 * ____this_rename_at_54 );
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_any_3b9fcb651e0b126c ( Context * __context__, TypeInfo const  & __info_rename_at_68 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_any_41e89e879d693547 ( Context * __context__, TypeInfo const  & __info_rename_at_50 );
+inline bool _Funcrtti_0x60_is_same_type_4f465f822ee29d6a ( Context * __context__, TypeInfo const  & __a_rename_at_14, TypeInfo const  & __b_rename_at_14, DAS_COMMENT(bound_enum) das::RefMatters __refMatters_rename_at_15, DAS_COMMENT(bound_enum) das::ConstMatters __constMatters_rename_at_16, DAS_COMMENT(bound_enum) das::TemporaryMatters __temporaryMatters_rename_at_17, bool __topLevel_rename_at_18 );
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_4e81e6cbaea75066 ( Context * __context__, TypeInfo const  & __info_rename_at_79 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_d3f96ce97ffb0433 ( Context * __context__, TypeInfo const  & __info_rename_at_61 );
+inline bool test_5fec3afe8e343cda ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_451 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_452; das_zero(__it_rename_at_452);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_452),__rng_rename_at_451,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_452);
+}
+
+inline void finalize_dc89aae4677d546 ( Context * __context__, _lambda_thismodule_72_12_1 &  ____this_rename_at_72 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_72.___source_0_at_73_rename_at_73),__context__);
+	memset(&(____this_rename_at_72), 0, 56);
+}
+
+inline void finalize_48ee991630ba012f ( Context * __context__, _lambda_thismodule_54_12_2 &  ____this_rename_at_54 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_54.___source_0_at_55_rename_at_55),__context__);
+	memset(&(____this_rename_at_54), 0, 56);
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcbuiltin_0x60_each_b77a57a217361068 ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_480 )
+{
+	Sequence DAS_COMMENT((char *)) __it_rename_at_482; das_zero(__it_rename_at_482);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((char *))>::pass(__it_rename_at_482),__lam_rename_at_480,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(__it_rename_at_482);
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcbuiltin_0x60_each_ref_1607ca369977f978 ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const  __lam_rename_at_487 )
+{
+	Sequence DAS_COMMENT((TypeInfo *)) __it_rename_at_488; das_zero(__it_rename_at_488);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TypeInfo const ))>::pass(__it_rename_at_488),__lam_rename_at_487,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(__it_rename_at_488);
+}
+
+inline bool _Func_lambda_thismodule_72_12_1_0x60_function_ab96ca71a8f7fd3e ( Context * __context__, _lambda_thismodule_72_12_1 &  ____this_rename_at_72, char * & ___yield_72_rename_at_72 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_73_32;
+	switch (____this_rename_at_72.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_72.pinfo->argNames /*argNames*/ != nullptr) )
+	{
+		goto label_5;
+	};
+	das_copy(____this_rename_at_72.___loop_at_73_rename_at_73,true);
+	das_move(____this_rename_at_72.___source_0_at_73_rename_at_73,(_temp_make_local_73_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(int32_t(____this_rename_at_72.pinfo->argCount /*argCount*/))))));
+	memset(&(____this_rename_at_72.__index_rename_at_73), 0, 4);
+	das_copy(____this_rename_at_72.___pvar_0_at_73_rename_at_73,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_72.__index_rename_at_73)));
+	DAS_SETBOOLAND((____this_rename_at_72.___loop_at_73_rename_at_73),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_72.___source_0_at_73_rename_at_73),____this_rename_at_72.___pvar_0_at_73_rename_at_73,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_72.___loop_at_73_rename_at_73 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_72_rename_at_72,das_index<char * const  * const >::at(____this_rename_at_72.pinfo->argNames /*argNames*/,____this_rename_at_72.__index_rename_at_73,__context__));
+	das_copy(____this_rename_at_72.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_72.___loop_at_73_rename_at_73),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_72.___source_0_at_73_rename_at_73),____this_rename_at_72.___pvar_0_at_73_rename_at_73,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_72.___source_0_at_73_rename_at_73),____this_rename_at_72.___pvar_0_at_73_rename_at_73,__context__);
+	label_5:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_72_12_1_0x60_finalizer_365776f06e345f26 ( Context * __context__, _lambda_thismodule_72_12_1 * ____this_rename_at_72 )
+{
+	finalize_dc89aae4677d546(__context__,das_arg<_lambda_thismodule_72_12_1>::pass(das_deref(__context__,____this_rename_at_72)));
+	das_delete_lambda_struct<_lambda_thismodule_72_12_1 *>::clear(__context__,____this_rename_at_72);
+}
+
+inline bool _Func_lambda_thismodule_54_12_2_0x60_function_9e98497768bdeaef ( Context * __context__, _lambda_thismodule_54_12_2 &  ____this_rename_at_54, TypeInfo const  * & ___ryield54_rename_at_54 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_55_32;
+	switch (____this_rename_at_54.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_54.pinfo->argTypes /*argTypes*/ != nullptr) )
+	{
+		goto label_5;
+	};
+	das_copy(____this_rename_at_54.___loop_at_55_rename_at_55,true);
+	das_move(____this_rename_at_54.___source_0_at_55_rename_at_55,(_temp_make_local_55_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(int32_t(____this_rename_at_54.pinfo->argCount /*argCount*/))))));
+	memset(&(____this_rename_at_54.__index_rename_at_55), 0, 4);
+	das_copy(____this_rename_at_54.___pvar_0_at_55_rename_at_55,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_54.__index_rename_at_55)));
+	DAS_SETBOOLAND((____this_rename_at_54.___loop_at_55_rename_at_55),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_54.___source_0_at_55_rename_at_55),____this_rename_at_54.___pvar_0_at_55_rename_at_55,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_54.___loop_at_55_rename_at_55 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield54_rename_at_54,das_ref(__context__,das_deref(__context__,das_index<TypeInfo * * const >::at(____this_rename_at_54.pinfo->argTypes /*argTypes*/,____this_rename_at_54.__index_rename_at_55,__context__))));
+	das_copy(____this_rename_at_54.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_54.___loop_at_55_rename_at_55),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_54.___source_0_at_55_rename_at_55),____this_rename_at_54.___pvar_0_at_55_rename_at_55,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_54.___source_0_at_55_rename_at_55),____this_rename_at_54.___pvar_0_at_55_rename_at_55,__context__);
+	label_5:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_54_12_2_0x60_finalizer_890bf603b00c3a9c ( Context * __context__, _lambda_thismodule_54_12_2 * ____this_rename_at_54 )
+{
+	finalize_48ee991630ba012f(__context__,das_arg<_lambda_thismodule_54_12_2>::pass(das_deref(__context__,____this_rename_at_54)));
+	das_delete_lambda_struct<_lambda_thismodule_54_12_2 *>::clear(__context__,____this_rename_at_54);
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_any_3b9fcb651e0b126c ( Context * __context__, TypeInfo const  &  __info_rename_at_68 )
+{
+	TypeInfo const  * __pinfo_rename_at_70 = ((TypeInfo const  *)das_ref(__context__,__info_rename_at_68));
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_Funcbuiltin_0x60_each_b77a57a217361068(__context__,das_ascend<bool,_lambda_thismodule_72_12_1>::make(__context__,&__type_info__1fd302790fa7f3df,(([&]() -> _lambda_thismodule_72_12_1 {
+		_lambda_thismodule_72_12_1 __mks_71;
+		das_zero(__mks_71);
+		das_copy((__mks_71.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_72_12_1`function XS<::_lambda_thismodule_72_12_1> &s*/ 11908043999719657915u))));
+		das_copy((__mks_71.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_72_12_1`finalizer X1<S<::_lambda_thismodule_72_12_1>>?*/ 5593129478007272308u))));
+		das_copy((__mks_71.pinfo),(__pinfo_rename_at_70));
+		return __mks_71;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_any_41e89e879d693547 ( Context * __context__, TypeInfo const  &  __info_rename_at_50 )
+{
+	TypeInfo const  * __pinfo_rename_at_52 = ((TypeInfo const  *)das_ref(__context__,__info_rename_at_50));
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(_Funcbuiltin_0x60_each_ref_1607ca369977f978(__context__,das_ascend<bool,_lambda_thismodule_54_12_2>::make(__context__,&__type_info__b3be2b75180ea20c,(([&]() -> _lambda_thismodule_54_12_2 {
+		_lambda_thismodule_54_12_2 __mks_53;
+		das_zero(__mks_53);
+		das_copy((__mks_53.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_54_12_2`function XS<::_lambda_thismodule_54_12_2> &1<CH<rtti::TypeInfo>>?*/ 15228622082780518584u))));
+		das_copy((__mks_53.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_54_12_2`finalizer X1<S<::_lambda_thismodule_54_12_2>>?*/ 17915188329316509664u))));
+		das_copy((__mks_53.pinfo),(__pinfo_rename_at_52));
+		return __mks_53;
+	})()))));
+}
+
+inline bool _Funcrtti_0x60_is_same_type_4f465f822ee29d6a ( Context * __context__, TypeInfo const  &  __a_rename_at_14, TypeInfo const  &  __b_rename_at_14, DAS_COMMENT(bound_enum) das::RefMatters __refMatters_rename_at_15, DAS_COMMENT(bound_enum) das::ConstMatters __constMatters_rename_at_16, DAS_COMMENT(bound_enum) das::TemporaryMatters __temporaryMatters_rename_at_17, bool __topLevel_rename_at_18 )
+{
+	return das_auto_cast<bool>::cast(isSameType(das_cast<TypeInfo const  *>::cast(__a_rename_at_14),das_cast<TypeInfo const  *>::cast(__b_rename_at_14),__refMatters_rename_at_15,__constMatters_rename_at_16,__temporaryMatters_rename_at_17,__topLevel_rename_at_18));
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_4e81e6cbaea75066 ( Context * __context__, TypeInfo const  &  __info_rename_at_79 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_Funcrtti_0x60_arg_names_any_3b9fcb651e0b126c(__context__,__info_rename_at_79));
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_d3f96ce97ffb0433 ( Context * __context__, TypeInfo const  &  __info_rename_at_61 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(_Funcrtti_0x60_arg_types_any_41e89e879d693547(__context__,__info_rename_at_61));
+}
+
+inline bool test_5fec3afe8e343cda ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((char *)) _temp_make_local_11_64;
+	Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_11_80;
+	DAS_VERIFY((_Funcrtti_0x60_is_same_type_4f465f822ee29d6a(__context__,(__type_info__90f5707b5a6f641),(__type_info__90f5707b5a6f641),DAS_COMMENT(bound_enum) das::RefMatters::yes,DAS_COMMENT(bound_enum) das::ConstMatters::yes,DAS_COMMENT(bound_enum) das::TemporaryMatters::yes,true)));
+	DAS_VERIFY((!_Funcrtti_0x60_is_same_type_4f465f822ee29d6a(__context__,(__type_info__90f5007b5a6ea5c),(__type_info__90f5707b5a6f641),DAS_COMMENT(bound_enum) das::RefMatters::yes,DAS_COMMENT(bound_enum) das::ConstMatters::yes,DAS_COMMENT(bound_enum) das::TemporaryMatters::yes,true)));
+	TVariant<8,int32_t,float> __v_rename_at_8_ConstRef; das_zero(__v_rename_at_8_ConstRef);
+	TVariant<8,int32_t,float> const  & __v_rename_at_8 = __v_rename_at_8_ConstRef; ;
+	TypeInfo * __vinfo_rename_at_9 = ((TypeInfo *)&((__type_info__9b8e12ff1e5f74ae)));
+	DAS_ASSERT(((*__vinfo_rename_at_9).argCount /*argCount*/ == 0x2u));
+	{
+		bool __need_loop_11 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,2));
+		int32_t __i_rename_at_11;
+		__need_loop_11 = __i_iterator.first(__context__,(__i_rename_at_11)) && __need_loop_11;
+		// n : string
+		das_iterator<Sequence DAS_COMMENT((char *))> __n_iterator((_temp_make_local_11_64 = (_Funcrtti_0x60_arg_names_4e81e6cbaea75066(__context__,(*__vinfo_rename_at_9)))));
+		char * __n_rename_at_11;
+		__need_loop_11 = __n_iterator.first(__context__,(__n_rename_at_11)) && __need_loop_11;
+		// t : rtti::TypeInfo const&
+		das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __t_iterator((_temp_make_local_11_80 = (_Funcrtti_0x60_arg_types_d3f96ce97ffb0433(__context__,(*__vinfo_rename_at_9)))));
+		TypeInfo const  * __t_rename_at_11;
+		__need_loop_11 = __t_iterator.first(__context__,(__t_rename_at_11)) && __need_loop_11;
+		for ( ; __need_loop_11 ; __need_loop_11 = __i_iterator.next(__context__,(__i_rename_at_11)) && __n_iterator.next(__context__,(__n_rename_at_11)) && __t_iterator.next(__context__,(__t_rename_at_11)) )
+		{
+			if ( __i_rename_at_11 == 0 )
+			{
+				DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__n_rename_at_11),cast<char *>::from(((char *) "i")),*__context__,nullptr)));
+				DAS_VERIFY((_Funcrtti_0x60_is_same_type_4f465f822ee29d6a(__context__,(__type_info__90f5707b5a6f641),(*__t_rename_at_11),DAS_COMMENT(bound_enum) das::RefMatters::no,DAS_COMMENT(bound_enum) das::ConstMatters::no,DAS_COMMENT(bound_enum) das::TemporaryMatters::yes,true)));
+			} else if ( __i_rename_at_11 == 1 )
+			{
+				DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__n_rename_at_11),cast<char *>::from(((char *) "f")),*__context__,nullptr)));
+				DAS_VERIFY((_Funcrtti_0x60_is_same_type_4f465f822ee29d6a(__context__,(__type_info__90f5007b5a6ea5c),(*__t_rename_at_11),DAS_COMMENT(bound_enum) das::RefMatters::no,DAS_COMMENT(bound_enum) das::ConstMatters::no,DAS_COMMENT(bound_enum) das::TemporaryMatters::yes,true)));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_11));
+		__n_iterator.close(__context__,(__n_rename_at_11));
+		__t_iterator.close(__context__,(__t_rename_at_11));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_each_5cbab1dfe9635bc1
+	aotLib[0x8c2bf3089ff8b6f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_5cbab1dfe9635bc1>>();
+	};
+	// finalize_dc89aae4677d546
+	aotLib[0x93915bda6338ddfd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_72_12_1 &  ),&finalize_dc89aae4677d546>>();
+	};
+	// finalize_48ee991630ba012f
+	aotLib[0x7138426e02ed828d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_54_12_2 &  ),&finalize_48ee991630ba012f>>();
+	};
+	// _Funcbuiltin_0x60_each_b77a57a217361068
+	aotLib[0x482653acb1c06fc1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const   ),&_Funcbuiltin_0x60_each_b77a57a217361068>>();
+	};
+	// _Funcbuiltin_0x60_each_ref_1607ca369977f978
+	aotLib[0x9679ff2aa42db15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const   ),&_Funcbuiltin_0x60_each_ref_1607ca369977f978>>();
+	};
+	// _Func_lambda_thismodule_72_12_1_0x60_function_ab96ca71a8f7fd3e
+	aotLib[0x5867683b53c4a37] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_72_12_1 & , char * &  ),&_Func_lambda_thismodule_72_12_1_0x60_function_ab96ca71a8f7fd3e>>();
+	};
+	// _Func_lambda_thismodule_72_12_1_0x60_finalizer_365776f06e345f26
+	aotLib[0x4a316ef85d719626] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_72_12_1 *  ),&_Func_lambda_thismodule_72_12_1_0x60_finalizer_365776f06e345f26>>();
+	};
+	// _Func_lambda_thismodule_54_12_2_0x60_function_9e98497768bdeaef
+	aotLib[0x16d7cea13b0af963] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_54_12_2 & , TypeInfo const  * &  ),&_Func_lambda_thismodule_54_12_2_0x60_function_9e98497768bdeaef>>();
+	};
+	// _Func_lambda_thismodule_54_12_2_0x60_finalizer_890bf603b00c3a9c
+	aotLib[0xc6c64bc56621ce90] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_54_12_2 *  ),&_Func_lambda_thismodule_54_12_2_0x60_finalizer_890bf603b00c3a9c>>();
+	};
+	// _Funcrtti_0x60_arg_names_any_3b9fcb651e0b126c
+	aotLib[0x2cbcf17bff15b1fb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_names_any_3b9fcb651e0b126c>>();
+	};
+	// _Funcrtti_0x60_arg_types_any_41e89e879d693547
+	aotLib[0xed8a7af1cf07f241] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_types_any_41e89e879d693547>>();
+	};
+	// _Funcrtti_0x60_is_same_type_4f465f822ee29d6a
+	aotLib[0x825666ceb8d48d7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TypeInfo const  & , TypeInfo const  & , DAS_COMMENT(bound_enum) das::RefMatters , DAS_COMMENT(bound_enum) das::ConstMatters , DAS_COMMENT(bound_enum) das::TemporaryMatters , bool  ),&_Funcrtti_0x60_is_same_type_4f465f822ee29d6a>>();
+	};
+	// _Funcrtti_0x60_arg_names_4e81e6cbaea75066
+	aotLib[0xecdac6a1c88337e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_names_4e81e6cbaea75066>>();
+	};
+	// _Funcrtti_0x60_arg_types_d3f96ce97ffb0433
+	aotLib[0x7e718651d3119099] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_types_d3f96ce97ffb0433>>();
+	};
+	// test_5fec3afe8e343cda
+	aotLib[0xe2448ae637a1a660] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_5fec3afe8e343cda>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
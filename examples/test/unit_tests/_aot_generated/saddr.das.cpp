@@ -0,0 +1,221 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+ // require is_local
+ // require safe_addr
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_18308073225796334394 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Foo; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace safe_addr { struct SafeAddrMacro; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+// unused structure SafeAddrMacro
+namespace  {
+
+struct Foo {
+	int32_t a;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+}
+
+inline int32_t * _Funcsafe_addr_0x60_safe_addr_534b38203da0a488 ( Context * __context__, int32_t & __x_rename_at_14 );
+inline int32_t const  * const  _Funcsafe_addr_0x60_safe_addr_df6e6081d7b4a4b9 ( Context * __context__, int32_t const  & __x_rename_at_21 );
+inline bool test_dabbfb40ee3d3bae ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t * _Funcsafe_addr_0x60_safe_addr_534b38203da0a488 ( Context * __context__, int32_t & __x_rename_at_14 )
+{
+	return das_auto_cast<int32_t *>::cast(das_cast<int32_t *>::cast(das_ref(__context__,__x_rename_at_14)));
+}
+
+inline int32_t const  * const  _Funcsafe_addr_0x60_safe_addr_df6e6081d7b4a4b9 ( Context * __context__, int32_t const  & __x_rename_at_21 )
+{
+	return das_auto_cast<int32_t const  * const >::cast(das_cast<int32_t const  * const >::cast(das_ref(__context__,__x_rename_at_21)));
+}
+
+inline bool test_dabbfb40ee3d3bae ( Context * __context__ )
+{
+	int32_t __t_rename_at_8 = 1;
+	int32_t * __pt_rename_at_9 = _Funcsafe_addr_0x60_safe_addr_534b38203da0a488(__context__,__t_rename_at_8);
+	das_copy(das_deref(__context__,__pt_rename_at_9),2);
+	DAS_ASSERT((__t_rename_at_8 == 2));
+	Foo __q_rename_at_12_ConstRef = ((Foo)(([&]() -> Foo {
+		Foo __mks_12;
+		das_copy((__mks_12.a),(3));
+		return __mks_12;
+	})()));
+	Foo const  & __q_rename_at_12 = __q_rename_at_12_ConstRef; ;
+	int32_t const  * __pq_rename_at_13 = ((int32_t const  *)_Funcsafe_addr_0x60_safe_addr_df6e6081d7b4a4b9(__context__,__q_rename_at_12.a));
+	DAS_ASSERT((das_deref(__context__,__pq_rename_at_13) == 3));
+	TDim<int32_t,2> __w_rename_at_15; das_zero(__w_rename_at_15);
+	das_copy(__w_rename_at_15(1,__context__),4);
+	int32_t * __pw_rename_at_17 = ((int32_t *)_Funcsafe_addr_0x60_safe_addr_534b38203da0a488(__context__,__w_rename_at_15(1,__context__)));
+	DAS_ASSERT((das_deref(__context__,__pw_rename_at_17) == 4));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcsafe_addr_0x60_safe_addr_534b38203da0a488
+	aotLib[0xee05a8a29c3746c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t * (*) ( Context * __context__, int32_t &  ),&_Funcsafe_addr_0x60_safe_addr_534b38203da0a488>>();
+	};
+	// _Funcsafe_addr_0x60_safe_addr_df6e6081d7b4a4b9
+	aotLib[0xccf718b2fe5ecaad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t const  * const  (*) ( Context * __context__, int32_t const  &  ),&_Funcsafe_addr_0x60_safe_addr_df6e6081d7b4a4b9>>();
+	};
+	// test_dabbfb40ee3d3bae
+	aotLib[0x6aa0631fffce739a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_dabbfb40ee3d3bae>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
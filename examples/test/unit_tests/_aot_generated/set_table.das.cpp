@@ -0,0 +1,411 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9196761617374806599 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline void _Funcbuiltin_0x60_clone_1cd511d2f8def63d ( Context * __context__, TTable<int32_t,void> & __a_rename_at_348, TTable<int32_t,void> const  & __b_rename_at_348 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline TTable<int32_t,void> _Funcbuiltin_0x60_clone_to_move_63c68afdd4582c42 ( Context * __context__, TTable<int32_t,void> const  & __clone_src_rename_at_325 );
+inline TTable<int32_t,void> _Funcbuiltin_0x60_to_table_move_b60f18452fffcf8d ( Context * __context__, TDim<int32_t,4> & __a_rename_at_554 );
+inline void _Funcbuiltin_0x60_insert_2267db139e0df384 ( Context * __context__, TTable<int32_t,void> & __Tab_rename_at_303, int32_t __at_rename_at_303 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_9203c68f7d4aaffb ( Context * __context__, TTable<int32_t,void> const  & __a_rename_at_370 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48 ( Context * __context__, TDim<int32_t,3> & __a_rename_at_518 );
+inline bool _Funcbuiltin_0x60_erase_f068f7f6b908bb11 ( Context * __context__, TTable<int32_t,void> & __Tab_rename_at_298, int32_t __at_rename_at_298 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_8095aad6f5b96480 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_518 );
+inline bool _Funcbuiltin_0x60_key_exists_521e4bee16959b33 ( Context * __context__, TTable<int32_t,void> const  & __Tab_rename_at_306, int32_t __at_rename_at_306 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_adf8841f5d461f64 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_518 );
+inline TTable<int32_t,void> _Funcbuiltin_0x60_to_table_3f3328d93e964b26 ( Context * __context__, TDim<int32_t,4> const  & __a_rename_at_548 );
+inline bool test_9a004b60d9d27ca4 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_clone_1cd511d2f8def63d ( Context * __context__, TTable<int32_t,void> &  __a_rename_at_348, TTable<int32_t,void> const  &  __b_rename_at_348 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_350_32;
+	builtin_table_clear(das_arg<TTable<int32_t,void>>::pass(__a_rename_at_348),__context__);
+	{
+		bool __need_loop_350 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_350_32 = (_Funcbuiltin_0x60_keys_9203c68f7d4aaffb(__context__,__b_rename_at_348))));
+		int32_t const  * __k_rename_at_350;
+		__need_loop_350 = __k_iterator.first(__context__,(__k_rename_at_350)) && __need_loop_350;
+		for ( ; __need_loop_350 ; __need_loop_350 = __k_iterator.next(__context__,(__k_rename_at_350)) )
+		{
+			__builtin_table_set_insert(__context__,__a_rename_at_348,(*__k_rename_at_350));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_350));
+	};
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline TTable<int32_t,void> _Funcbuiltin_0x60_clone_to_move_63c68afdd4582c42 ( Context * __context__, TTable<int32_t,void> const  &  __clone_src_rename_at_325 )
+{
+	TTable<int32_t,void> __clone_dest_rename_at_327; das_zero(__clone_dest_rename_at_327);
+	_Funcbuiltin_0x60_clone_1cd511d2f8def63d(__context__,das_arg<TTable<int32_t,void>>::pass(__clone_dest_rename_at_327),__clone_src_rename_at_325);
+	return /* <- */ das_auto_cast_move<TTable<int32_t,void>>::cast(__clone_dest_rename_at_327);
+}
+
+inline TTable<int32_t,void> _Funcbuiltin_0x60_to_table_move_b60f18452fffcf8d ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_554 )
+{
+	TTable<int32_t,void> __tab_rename_at_555; das_zero(__tab_rename_at_555);
+	{
+		bool __need_loop_556 = true;
+		// at : int aka keyT&
+		das_iterator<TDim<int32_t,4>> __at_iterator(__a_rename_at_554);
+		int32_t * __at_rename_at_556;
+		__need_loop_556 = __at_iterator.first(__context__,(__at_rename_at_556)) && __need_loop_556;
+		for ( ; __need_loop_556 ; __need_loop_556 = __at_iterator.next(__context__,(__at_rename_at_556)) )
+		{
+			__builtin_table_set_insert(__context__,__tab_rename_at_555,(*__at_rename_at_556));
+		}
+		__at_iterator.close(__context__,(__at_rename_at_556));
+	};
+	return /* <- */ das_auto_cast_move<TTable<int32_t,void>>::cast(__tab_rename_at_555);
+}
+
+inline void _Funcbuiltin_0x60_insert_2267db139e0df384 ( Context * __context__, TTable<int32_t,void> &  __Tab_rename_at_303, int32_t __at_rename_at_303 )
+{
+	__builtin_table_set_insert(__context__,__Tab_rename_at_303,__at_rename_at_303);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_9203c68f7d4aaffb ( Context * __context__, TTable<int32_t,void> const  &  __a_rename_at_370 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_371; das_zero(__it_rename_at_371);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_371),__a_rename_at_370,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t const  &))>::cast(__it_rename_at_371);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48 ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_518 )
+{
+	TArray<int32_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_519),3);
+	das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_519);
+}
+
+inline bool _Funcbuiltin_0x60_erase_f068f7f6b908bb11 ( Context * __context__, TTable<int32_t,void> &  __Tab_rename_at_298, int32_t __at_rename_at_298 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_298,__at_rename_at_298));
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_8095aad6f5b96480 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_518 )
+{
+	TArray<int32_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_519),2);
+	das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_519);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_521e4bee16959b33 ( Context * __context__, TTable<int32_t,void> const  &  __Tab_rename_at_306, int32_t __at_rename_at_306 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_306,__at_rename_at_306));
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_adf8841f5d461f64 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_518 )
+{
+	TArray<int32_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_519),4);
+	das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_519);
+}
+
+inline TTable<int32_t,void> _Funcbuiltin_0x60_to_table_3f3328d93e964b26 ( Context * __context__, TDim<int32_t,4> const  &  __a_rename_at_548 )
+{
+	TTable<int32_t,void> __tab_rename_at_549; das_zero(__tab_rename_at_549);
+	{
+		bool __need_loop_550 = true;
+		// at : int aka keyT const&
+		das_iterator<TDim<int32_t,4> const > __at_iterator(__a_rename_at_548);
+		int32_t const  * __at_rename_at_550;
+		__need_loop_550 = __at_iterator.first(__context__,(__at_rename_at_550)) && __need_loop_550;
+		for ( ; __need_loop_550 ; __need_loop_550 = __at_iterator.next(__context__,(__at_rename_at_550)) )
+		{
+			__builtin_table_set_insert(__context__,__tab_rename_at_549,(*__at_rename_at_550));
+		}
+		__at_iterator.close(__context__,(__at_rename_at_550));
+	};
+	return /* <- */ das_auto_cast_move<TTable<int32_t,void>>::cast(__tab_rename_at_549);
+}
+
+inline bool test_9a004b60d9d27ca4 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_14_96;
+	TArray<int32_t> _temp_make_local_14_112;
+	TDim<int32_t,3> _temp_make_local_14_144;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_17_192;
+	TArray<int32_t> _temp_make_local_17_208;
+	TDim<int32_t,2> _temp_make_local_17_240;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_20_336;
+	TArray<int32_t> _temp_make_local_20_352;
+	TDim<int32_t,2> _temp_make_local_20_384;
+	TDim<int32_t,4> _temp_make_local_31_480;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_32_496;
+	TArray<int32_t> _temp_make_local_32_512;
+	TDim<int32_t,4> _temp_make_local_32_544;
+	TDim<int32_t,4> _temp_make_local_34_640;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_35_656;
+	TArray<int32_t> _temp_make_local_35_672;
+	TDim<int32_t,4> _temp_make_local_35_704;
+	TTable<int32_t,void> __tab_rename_at_3; das_zero(__tab_rename_at_3);
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_3)) == 0));
+	{
+		bool __need_loop_12 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(3,6));
+		int32_t __i_rename_at_12;
+		__need_loop_12 = __i_iterator.first(__context__,(__i_rename_at_12)) && __need_loop_12;
+		for ( ; __need_loop_12 ; __need_loop_12 = __i_iterator.next(__context__,(__i_rename_at_12)) )
+		{
+			_Funcbuiltin_0x60_insert_2267db139e0df384(__context__,das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_3),__i_rename_at_12);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_12));
+	};
+	{
+		bool __need_loop_14 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_14_96 = (_Funcbuiltin_0x60_keys_9203c68f7d4aaffb(__context__,das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_3)))));
+		int32_t const  * __k_rename_at_14;
+		__need_loop_14 = __k_iterator.first(__context__,(__k_rename_at_14)) && __need_loop_14;
+		// i : int&
+		das_iterator<TArray<int32_t>> __i_iterator((_temp_make_local_14_112 = (_Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+			_temp_make_local_14_144(0,__context__) = 5;
+			_temp_make_local_14_144(1,__context__) = 4;
+			_temp_make_local_14_144(2,__context__) = 3;
+			return _temp_make_local_14_144;
+		})()))))));
+		int32_t * __i_rename_at_14;
+		__need_loop_14 = __i_iterator.first(__context__,(__i_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __k_iterator.next(__context__,(__k_rename_at_14)) && __i_iterator.next(__context__,(__i_rename_at_14)) )
+		{
+			DAS_ASSERT(((*__k_rename_at_14) == (*__i_rename_at_14)));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_14));
+		__i_iterator.close(__context__,(__i_rename_at_14));
+	};
+	_Funcbuiltin_0x60_erase_f068f7f6b908bb11(__context__,das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_3),4);
+	{
+		bool __need_loop_17 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_17_192 = (_Funcbuiltin_0x60_keys_9203c68f7d4aaffb(__context__,das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_3)))));
+		int32_t const  * __k_rename_at_17;
+		__need_loop_17 = __k_iterator.first(__context__,(__k_rename_at_17)) && __need_loop_17;
+		// i : int&
+		das_iterator<TArray<int32_t>> __i_iterator((_temp_make_local_17_208 = (_Funcbuiltin_0x60_to_array_move_8095aad6f5b96480(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+			_temp_make_local_17_240(0,__context__) = 5;
+			_temp_make_local_17_240(1,__context__) = 3;
+			return _temp_make_local_17_240;
+		})()))))));
+		int32_t * __i_rename_at_17;
+		__need_loop_17 = __i_iterator.first(__context__,(__i_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __k_iterator.next(__context__,(__k_rename_at_17)) && __i_iterator.next(__context__,(__i_rename_at_17)) )
+		{
+			DAS_ASSERT(((*__k_rename_at_17) == (*__i_rename_at_17)));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_17));
+		__i_iterator.close(__context__,(__i_rename_at_17));
+	};
+	TTable<int32_t,void> __tc_rename_at_19; das_zero(__tc_rename_at_19); das_move(__tc_rename_at_19, _Funcbuiltin_0x60_clone_to_move_63c68afdd4582c42(__context__,das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_3)));
+	{
+		bool __need_loop_20 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_20_336 = (_Funcbuiltin_0x60_keys_9203c68f7d4aaffb(__context__,das_arg<TTable<int32_t,void>>::pass(__tc_rename_at_19)))));
+		int32_t const  * __k_rename_at_20;
+		__need_loop_20 = __k_iterator.first(__context__,(__k_rename_at_20)) && __need_loop_20;
+		// i : int&
+		das_iterator<TArray<int32_t>> __i_iterator((_temp_make_local_20_352 = (_Funcbuiltin_0x60_to_array_move_8095aad6f5b96480(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+			_temp_make_local_20_384(0,__context__) = 5;
+			_temp_make_local_20_384(1,__context__) = 3;
+			return _temp_make_local_20_384;
+		})()))))));
+		int32_t * __i_rename_at_20;
+		__need_loop_20 = __i_iterator.first(__context__,(__i_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __k_iterator.next(__context__,(__k_rename_at_20)) && __i_iterator.next(__context__,(__i_rename_at_20)) )
+		{
+			DAS_ASSERT(((*__k_rename_at_20) == (*__i_rename_at_20)));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_20));
+		__i_iterator.close(__context__,(__i_rename_at_20));
+	};
+	DAS_ASSERT((_Funcbuiltin_0x60_key_exists_521e4bee16959b33(__context__,das_arg<TTable<int32_t,void>>::pass(__tc_rename_at_19),3)));
+	DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_521e4bee16959b33(__context__,das_arg<TTable<int32_t,void>>::pass(__tc_rename_at_19),4)));
+	TTable<int32_t,void> __ttt_rename_at_31; das_zero(__ttt_rename_at_31); das_move(__ttt_rename_at_31, _Funcbuiltin_0x60_to_table_move_b60f18452fffcf8d(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_31_480(0,__context__) = 1;
+		_temp_make_local_31_480(1,__context__) = 2;
+		_temp_make_local_31_480(2,__context__) = 3;
+		_temp_make_local_31_480(3,__context__) = 4;
+		return _temp_make_local_31_480;
+	})()))));
+	{
+		bool __need_loop_32 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_32_496 = (_Funcbuiltin_0x60_keys_9203c68f7d4aaffb(__context__,das_arg<TTable<int32_t,void>>::pass(__ttt_rename_at_31)))));
+		int32_t const  * __k_rename_at_32;
+		__need_loop_32 = __k_iterator.first(__context__,(__k_rename_at_32)) && __need_loop_32;
+		// i : int&
+		das_iterator<TArray<int32_t>> __i_iterator((_temp_make_local_32_512 = (_Funcbuiltin_0x60_to_array_move_adf8841f5d461f64(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+			_temp_make_local_32_544(0,__context__) = 2;
+			_temp_make_local_32_544(1,__context__) = 1;
+			_temp_make_local_32_544(2,__context__) = 4;
+			_temp_make_local_32_544(3,__context__) = 3;
+			return _temp_make_local_32_544;
+		})()))))));
+		int32_t * __i_rename_at_32;
+		__need_loop_32 = __i_iterator.first(__context__,(__i_rename_at_32)) && __need_loop_32;
+		for ( ; __need_loop_32 ; __need_loop_32 = __k_iterator.next(__context__,(__k_rename_at_32)) && __i_iterator.next(__context__,(__i_rename_at_32)) )
+		{
+			DAS_ASSERT(((*__k_rename_at_32) == (*__i_rename_at_32)));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_32));
+		__i_iterator.close(__context__,(__i_rename_at_32));
+	};
+	TTable<int32_t,void> __qqq_rename_at_34; das_zero(__qqq_rename_at_34); das_move(__qqq_rename_at_34, _Funcbuiltin_0x60_to_table_3f3328d93e964b26(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_34_640(0,__context__) = 1;
+		_temp_make_local_34_640(1,__context__) = 2;
+		_temp_make_local_34_640(2,__context__) = 3;
+		_temp_make_local_34_640(3,__context__) = 4;
+		return _temp_make_local_34_640;
+	})()))));
+	{
+		bool __need_loop_35 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_35_656 = (_Funcbuiltin_0x60_keys_9203c68f7d4aaffb(__context__,das_arg<TTable<int32_t,void>>::pass(__qqq_rename_at_34)))));
+		int32_t const  * __k_rename_at_35;
+		__need_loop_35 = __k_iterator.first(__context__,(__k_rename_at_35)) && __need_loop_35;
+		// i : int&
+		das_iterator<TArray<int32_t>> __i_iterator((_temp_make_local_35_672 = (_Funcbuiltin_0x60_to_array_move_adf8841f5d461f64(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+			_temp_make_local_35_704(0,__context__) = 2;
+			_temp_make_local_35_704(1,__context__) = 1;
+			_temp_make_local_35_704(2,__context__) = 4;
+			_temp_make_local_35_704(3,__context__) = 3;
+			return _temp_make_local_35_704;
+		})()))))));
+		int32_t * __i_rename_at_35;
+		__need_loop_35 = __i_iterator.first(__context__,(__i_rename_at_35)) && __need_loop_35;
+		for ( ; __need_loop_35 ; __need_loop_35 = __k_iterator.next(__context__,(__k_rename_at_35)) && __i_iterator.next(__context__,(__i_rename_at_35)) )
+		{
+			DAS_ASSERT(((*__k_rename_at_35) == (*__i_rename_at_35)));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_35));
+		__i_iterator.close(__context__,(__i_rename_at_35));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_clone_1cd511d2f8def63d
+	aotLib[0x66366531243ff12] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,void> & , TTable<int32_t,void> const  &  ),&_Funcbuiltin_0x60_clone_1cd511d2f8def63d>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_clone_to_move_63c68afdd4582c42
+	aotLib[0x308e00604228041f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<int32_t,void> (*) ( Context * __context__, TTable<int32_t,void> const  &  ),&_Funcbuiltin_0x60_clone_to_move_63c68afdd4582c42>>();
+	};
+	// _Funcbuiltin_0x60_to_table_move_b60f18452fffcf8d
+	aotLib[0xcd032370c14db3f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<int32_t,void> (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Funcbuiltin_0x60_to_table_move_b60f18452fffcf8d>>();
+	};
+	// _Funcbuiltin_0x60_insert_2267db139e0df384
+	aotLib[0x93cab9dd1aa881fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,void> & , int32_t  ),&_Funcbuiltin_0x60_insert_2267db139e0df384>>();
+	};
+	// _Funcbuiltin_0x60_keys_9203c68f7d4aaffb
+	aotLib[0x5ba981df7b0e9289] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TTable<int32_t,void> const  &  ),&_Funcbuiltin_0x60_keys_9203c68f7d4aaffb>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48
+	aotLib[0xae43369ad2ed6a9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_9bdfe522bb3cfc48>>();
+	};
+	// _Funcbuiltin_0x60_erase_f068f7f6b908bb11
+	aotLib[0xd98148c9f29f65ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,void> & , int32_t  ),&_Funcbuiltin_0x60_erase_f068f7f6b908bb11>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_8095aad6f5b96480
+	aotLib[0x4128e4dc2cc12101] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,2> &  ),&_Funcbuiltin_0x60_to_array_move_8095aad6f5b96480>>();
+	};
+	// _Funcbuiltin_0x60_key_exists_521e4bee16959b33
+	aotLib[0x16a7b6981733368d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,void> const  & , int32_t  ),&_Funcbuiltin_0x60_key_exists_521e4bee16959b33>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_adf8841f5d461f64
+	aotLib[0x36c5b0e8a702b305] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_adf8841f5d461f64>>();
+	};
+	// _Funcbuiltin_0x60_to_table_3f3328d93e964b26
+	aotLib[0xdad1a32f8237b865] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<int32_t,void> (*) ( Context * __context__, TDim<int32_t,4> const  &  ),&_Funcbuiltin_0x60_to_table_3f3328d93e964b26>>();
+	};
+	// test_9a004b60d9d27ca4
+	aotLib[0x36539f123116a88d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_9a004b60d9d27ca4>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,284 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_942142986917409704 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline void clone_b64a1e75703ff2e4 ( Context * __context__, smart_ptr_raw<TestObjectSmart> & __dest_rename_at_328, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_328 );
+inline smart_ptr_raw<TestObjectSmart> _Funcbuiltin_0x60_clone_to_move_5a6b7e9c8999085 ( Context * __context__, smart_ptr_raw<TestObjectSmart> const  __clone_src_rename_at_325 );
+inline void clone_b892d17f7845f1c1 ( Context * __context__, smart_ptr_raw<TestObjectSmart> & __dest_rename_at_45, TestObjectSmart * const  __src_rename_at_45 );
+inline TestObjectSmart * _Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d ( Context * __context__, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_725 );
+inline TestObjectSmart * const  _Funcbuiltin_0x60_get_const_ptr_aa11c9c2d617d256 ( Context * __context__, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_729 );
+inline TestObjectSmart * inside_scope_test_928db780cade1249 ( Context * __context__ );
+inline void scope_test_d8a063d6ac72784e ( Context * __context__ );
+inline smart_ptr_raw<TestObjectSmart> inside_move_test_b3126cb1b40151a6 ( Context * __context__ );
+inline void move_test_bb74ac68a62a676d ( Context * __context__ );
+inline void ref_count_test_11e63a15536eaf35 ( Context * __context__ );
+inline void access_test_bfd629a5dfc0fb62 ( Context * __context__ );
+inline void fn_test_2d354f00dc66c1a6 ( Context * __context__ );
+inline bool test_d3cfe8e86aa1bf05 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void clone_b64a1e75703ff2e4 ( Context * __context__, smart_ptr_raw<TestObjectSmart> & __dest_rename_at_328, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_328 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_328),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_328));
+}
+
+inline smart_ptr_raw<TestObjectSmart> _Funcbuiltin_0x60_clone_to_move_5a6b7e9c8999085 ( Context * __context__, smart_ptr_raw<TestObjectSmart> const  __clone_src_rename_at_325 )
+{
+	smart_ptr_raw<TestObjectSmart> __clone_dest_rename_at_327; das_zero(__clone_dest_rename_at_327);
+	clone_b64a1e75703ff2e4(__context__,__clone_dest_rename_at_327,__clone_src_rename_at_325);
+	return /* <- */ das_auto_cast_move<smart_ptr_raw<TestObjectSmart>>::cast(__clone_dest_rename_at_327);
+}
+
+inline void clone_b892d17f7845f1c1 ( Context * __context__, smart_ptr_raw<TestObjectSmart> & __dest_rename_at_45, TestObjectSmart * const  __src_rename_at_45 )
+{
+	builtin_smart_ptr_clone_ptr(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_45),das_auto_cast<void * const >::cast(__src_rename_at_45));
+}
+
+inline TestObjectSmart * _Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d ( Context * __context__, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_725 )
+{
+	return das_auto_cast<TestObjectSmart *>::cast(das_cast<TestObjectSmart *>::cast(__src_rename_at_725));
+}
+
+inline TestObjectSmart * const  _Funcbuiltin_0x60_get_const_ptr_aa11c9c2d617d256 ( Context * __context__, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_729 )
+{
+	return das_auto_cast<TestObjectSmart * const >::cast(das_cast<TestObjectSmart * const >::cast(__src_rename_at_729));
+}
+
+inline TestObjectSmart * inside_scope_test_928db780cade1249 ( Context * __context__ )
+{
+	smart_ptr_raw<TestObjectSmart> __sptr_rename_at_4; das_zero(__sptr_rename_at_4); das_move(__sptr_rename_at_4, das_new_handle<TestObjectSmart,true>::make(__context__));
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	return das_auto_cast<TestObjectSmart *>::cast(_Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d(__context__,__sptr_rename_at_4));
+}
+
+inline void scope_test_d8a063d6ac72784e ( Context * __context__ )
+{
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+	TestObjectSmart * __lostPtr_rename_at_10 = ((TestObjectSmart *)inside_scope_test_928db780cade1249(__context__));
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	smart_ptr_raw<TestObjectSmart> __sptr_rename_at_13; das_zero(__sptr_rename_at_13); das_move(__sptr_rename_at_13, das_cast<smart_ptr_raw<TestObjectSmart>>::cast(__lostPtr_rename_at_10));
+	das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__sptr_rename_at_13);
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+}
+
+inline smart_ptr_raw<TestObjectSmart> inside_move_test_b3126cb1b40151a6 ( Context * __context__ )
+{
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+	smart_ptr_raw<TestObjectSmart> __t1_rename_at_19; das_zero(__t1_rename_at_19); das_move(__t1_rename_at_19, das_new_handle<TestObjectSmart,true>::make(__context__));
+	smart_ptr_raw<TestObjectSmart> __t2_rename_at_20; das_zero(__t2_rename_at_20); das_move(__t2_rename_at_20, __t1_rename_at_19);
+	DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__t1_rename_at_19)) == 0x0u));
+	DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__t2_rename_at_20)) == 0x1u));
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	return /* <- */ das_auto_cast_move<smart_ptr_raw<TestObjectSmart>>::cast(__t2_rename_at_20);
+}
+
+inline void move_test_bb74ac68a62a676d ( Context * __context__ )
+{
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+	smart_ptr_raw<TestObjectSmart> __t_rename_at_28; das_zero(__t_rename_at_28); das_move(__t_rename_at_28, inside_move_test_b3126cb1b40151a6(__context__));
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__t_rename_at_28);
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+}
+
+inline void ref_count_test_11e63a15536eaf35 ( Context * __context__ )
+{
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+	smart_ptr_raw<TestObjectSmart> __sptr_rename_at_36; das_zero(__sptr_rename_at_36); das_move(__sptr_rename_at_36, das_new_handle<TestObjectSmart,true>::make(__context__));
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__sptr_rename_at_36)) == 0x1u));
+	TestObjectSmart * __ptr_rename_at_39 = _Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d(__context__,__sptr_rename_at_36);
+	TestObjectSmart * __pptr_rename_at_40 = 0;
+	das_copy(__pptr_rename_at_40,_Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d(__context__,__sptr_rename_at_36));
+	DAS_ASSERT((equ_sptr_ptr(das_auto_cast<smart_ptr_raw<void> const  &>::cast(__sptr_rename_at_36),das_auto_cast<void * const >::cast(__ptr_rename_at_39))));
+	DAS_ASSERT((_Funcbuiltin_0x60_get_const_ptr_aa11c9c2d617d256(__context__,__sptr_rename_at_36) == __ptr_rename_at_39));
+	smart_ptr_raw<TestObjectSmart> __qptr_rename_at_44; das_zero(__qptr_rename_at_44);
+	clone_b892d17f7845f1c1(__context__,__qptr_rename_at_44,_Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d(__context__,__sptr_rename_at_36));
+	DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__sptr_rename_at_36)) == 0x2u));
+	DAS_ASSERT((equ_sptr_ptr(das_auto_cast<smart_ptr_raw<void> const  &>::cast(__qptr_rename_at_44),das_auto_cast<void * const >::cast(__ptr_rename_at_39))));
+	DAS_ASSERT((_Funcbuiltin_0x60_get_const_ptr_aa11c9c2d617d256(__context__,__qptr_rename_at_44) == __ptr_rename_at_39));
+	DAS_ASSERT((equ_sptr_sptr(das_auto_cast<smart_ptr_raw<void> const  &>::cast(__qptr_rename_at_44),das_auto_cast<smart_ptr_raw<void> const  &>::cast(__sptr_rename_at_36))));
+	smart_ptr_raw<TestObjectSmart> __fptr_rename_at_50; das_zero(__fptr_rename_at_50); das_move(__fptr_rename_at_50, _Funcbuiltin_0x60_clone_to_move_5a6b7e9c8999085(__context__,__qptr_rename_at_44));
+	DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__sptr_rename_at_36)) == 0x3u));
+	DAS_ASSERT((nequ_sptr_ptr(das_auto_cast<smart_ptr_raw<void> const  &>::cast(__fptr_rename_at_50),das_auto_cast<void * const >::cast(nullptr))));
+	DAS_ASSERT((equ_ptr_sptr(das_auto_cast<void * const >::cast(_Funcbuiltin_0x60_get_const_ptr_aa11c9c2d617d256(__context__,__fptr_rename_at_50)),das_auto_cast<smart_ptr_raw<void> const  &>::cast(__sptr_rename_at_36))));
+	DAS_ASSERT((equ_sptr_sptr(das_auto_cast<smart_ptr_raw<void> const  &>::cast(__fptr_rename_at_50),das_auto_cast<smart_ptr_raw<void> const  &>::cast(__qptr_rename_at_44))));
+	DAS_ASSERT((equ_sptr_sptr(das_auto_cast<smart_ptr_raw<void> const  &>::cast(__fptr_rename_at_50),das_auto_cast<smart_ptr_raw<void> const  &>::cast(__sptr_rename_at_36))));
+	DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__sptr_rename_at_36)) == 0x3u));
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__sptr_rename_at_36);
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__sptr_rename_at_36)) == 0x0u));
+	DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__qptr_rename_at_44)) == 0x2u));
+	das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__qptr_rename_at_44);
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__qptr_rename_at_44)) == 0x0u));
+	DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__fptr_rename_at_50)) == 0x1u));
+	das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__fptr_rename_at_50);
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+	DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__fptr_rename_at_50)) == 0x0u));
+}
+
+inline void access_test_bfd629a5dfc0fb62 ( Context * __context__ )
+{
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+	smart_ptr_raw<TestObjectSmart> __ptr_rename_at_75; das_zero(__ptr_rename_at_75); das_move(__ptr_rename_at_75, das_new_handle<TestObjectSmart,true>::make(__context__));
+	DAS_ASSERT((__ptr_rename_at_75->fooData /*fooData*/ == 1234));
+	int32_t __t_rename_at_77 = das_null_coalescing<int32_t>::get(das_safe_navigation_handle<TestObjectSmart,int32_t>::get(__ptr_rename_at_75,([&](const TestObjectSmart * __any) -> auto & {return __any->fooData /*fooData*/;})),1);
+	DAS_ASSERT((__t_rename_at_77 == 1234));
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation_handle<TestObjectSmart,int32_t>::get(__ptr_rename_at_75,([&](const TestObjectSmart * __any) -> auto & {return __any->fooData /*fooData*/;})),__t_rename_at_77),13);
+	DAS_ASSERT((__ptr_rename_at_75->fooData /*fooData*/ == 13));
+	das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__ptr_rename_at_75);
+	das_copy(__t_rename_at_77,das_null_coalescing<int32_t>::get(das_safe_navigation_handle<TestObjectSmart,int32_t>::get(__ptr_rename_at_75,([&](const TestObjectSmart * __any) -> auto & {return __any->fooData /*fooData*/;})),2));
+	DAS_ASSERT((__t_rename_at_77 == 2));
+	das_move(__ptr_rename_at_75,das_new_handle<TestObjectSmart,true>::make(__context__));
+	das_move(__ptr_rename_at_75->first /*first*/,das_new_handle<TestObjectSmart,true>::make(__context__));
+	DAS_ASSERT((__ptr_rename_at_75->first /*first*/->fooData /*fooData*/ == 1234));
+	DAS_ASSERT((das_null_coalescing<int32_t>::get(das_safe_navigation_handle<TestObjectSmart,int32_t>::get(das_safe_navigation_handle_ptr<TestObjectSmart,smart_ptr<TestObjectSmart>>::get(__ptr_rename_at_75,([&](const TestObjectSmart * __any) -> auto & {return __any->first /*first*/;})),([&](const TestObjectSmart * __any) -> auto & {return __any->fooData /*fooData*/;})),13) == 1234));
+	das_delete_handle<smart_ptr<TestObjectSmart>>::clear(__context__,__ptr_rename_at_75->first /*first*/);
+	das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__ptr_rename_at_75);
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+}
+
+inline void fn_test_2d354f00dc66c1a6 ( Context * __context__ )
+{
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+	smart_ptr<TestObjectSmart> __ptr_rename_at_97; das_zero(__ptr_rename_at_97); das_move(__ptr_rename_at_97, makeTestObjectSmart());
+	DAS_ASSERT((countTestObjectSmart(__ptr_rename_at_97) == 0x1u));
+	DAS_VERIFY((getTotalTestObjectSmart() == 1));
+	das_delete_handle<smart_ptr<TestObjectSmart>>::clear(__context__,__ptr_rename_at_97);
+	DAS_VERIFY((getTotalTestObjectSmart() == 0));
+}
+
+inline bool test_d3cfe8e86aa1bf05 ( Context * __context__ )
+{
+	ref_count_test_11e63a15536eaf35(__context__);
+	move_test_bb74ac68a62a676d(__context__);
+	scope_test_d8a063d6ac72784e(__context__);
+	access_test_bfd629a5dfc0fb62(__context__);
+	fn_test_2d354f00dc66c1a6(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// clone_b64a1e75703ff2e4
+	aotLib[0x4dfdf42fd65e3f35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<TestObjectSmart> & , smart_ptr_raw<TestObjectSmart> const   ),&clone_b64a1e75703ff2e4>>();
+	};
+	// _Funcbuiltin_0x60_clone_to_move_5a6b7e9c8999085
+	aotLib[0x39ae577780ce905f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<TestObjectSmart> (*) ( Context * __context__, smart_ptr_raw<TestObjectSmart> const   ),&_Funcbuiltin_0x60_clone_to_move_5a6b7e9c8999085>>();
+	};
+	// clone_b892d17f7845f1c1
+	aotLib[0x41abcc1723aa72bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<TestObjectSmart> & , TestObjectSmart * const   ),&clone_b892d17f7845f1c1>>();
+	};
+	// _Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d
+	aotLib[0x76f9b1b1446f8ac5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TestObjectSmart * (*) ( Context * __context__, smart_ptr_raw<TestObjectSmart> const   ),&_Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d>>();
+	};
+	// _Funcbuiltin_0x60_get_const_ptr_aa11c9c2d617d256
+	aotLib[0x46fb273599bc1fa1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TestObjectSmart * const  (*) ( Context * __context__, smart_ptr_raw<TestObjectSmart> const   ),&_Funcbuiltin_0x60_get_const_ptr_aa11c9c2d617d256>>();
+	};
+	// inside_scope_test_928db780cade1249
+	aotLib[0xecb60c392885212b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TestObjectSmart * (*) ( Context * __context__ ),&inside_scope_test_928db780cade1249>>();
+	};
+	// scope_test_d8a063d6ac72784e
+	aotLib[0xad63bea59b6758e2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&scope_test_d8a063d6ac72784e>>();
+	};
+	// inside_move_test_b3126cb1b40151a6
+	aotLib[0x275ce0b6c304f895] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<TestObjectSmart> (*) ( Context * __context__ ),&inside_move_test_b3126cb1b40151a6>>();
+	};
+	// move_test_bb74ac68a62a676d
+	aotLib[0xcffb5f26f01d8a4f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&move_test_bb74ac68a62a676d>>();
+	};
+	// ref_count_test_11e63a15536eaf35
+	aotLib[0xb4e4d6f116f6e182] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&ref_count_test_11e63a15536eaf35>>();
+	};
+	// access_test_bfd629a5dfc0fb62
+	aotLib[0x696540e657eed9c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&access_test_bfd629a5dfc0fb62>>();
+	};
+	// fn_test_2d354f00dc66c1a6
+	aotLib[0xd297a4535d315045] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&fn_test_2d354f00dc66c1a6>>();
+	};
+	// test_d3cfe8e86aa1bf05
+	aotLib[0x16e7561a5a25e5d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_d3cfe8e86aa1bf05>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,1257 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7006464871169573512 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+	int32_t x;
+	int32_t y;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_resize_29914d27690eb1e4 ( Context * __context__, TArray<uint32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_resize_20419c2df14c9d85 ( Context * __context__, TArray<int64_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_resize_48979e8311fe5126 ( Context * __context__, TArray<uint64_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_resize_6640dbff129f8443 ( Context * __context__, TArray<double> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_resize_df901583a0cdec70 ( Context * __context__, TArray<Foo> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_sort_4732ebdcad990f07 ( Context * __context__, TArray<int32_t> & __a_rename_at_590 );
+inline void _Funcbuiltin_0x60_sort_e577240fb029e3d2 ( Context * __context__, TArray<uint32_t> & __a_rename_at_590 );
+inline void _Funcbuiltin_0x60_sort_41715831ae7f1315 ( Context * __context__, TArray<int64_t> & __a_rename_at_590 );
+inline void _Funcbuiltin_0x60_sort_7c9a8c217ad5bb18 ( Context * __context__, TArray<uint64_t> & __a_rename_at_590 );
+inline void _Funcbuiltin_0x60_sort_b62e086287e4e9ac ( Context * __context__, TArray<float> & __a_rename_at_590 );
+inline void _Funcbuiltin_0x60_sort_a351332315ffdad7 ( Context * __context__, TArray<double> & __a_rename_at_590 );
+inline void _Funcbuiltin_0x60_sort_ff406c5ab603b771 ( Context * __context__, TArray<char *> & __a_rename_at_590 );
+inline void _Funcbuiltin_0x60_sort_67424656e829030e ( Context * __context__, TArray<Foo> & __a_rename_at_590 );
+inline void _Funcbuiltin_0x60_sort_5de58d1eb04c83e3 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_572 );
+inline void _Funcbuiltin_0x60_sort_fe3388df434e572c ( Context * __context__, TDim<uint32_t,4> & __a_rename_at_572 );
+inline void _Funcbuiltin_0x60_sort_2284b0bf8fa51c75 ( Context * __context__, TDim<int64_t,4> & __a_rename_at_572 );
+inline void _Funcbuiltin_0x60_sort_321a87dafe5eb0a2 ( Context * __context__, TDim<uint64_t,4> & __a_rename_at_572 );
+inline void _Funcbuiltin_0x60_sort_20b4d52a5594ef8 ( Context * __context__, TDim<float,4> & __a_rename_at_572 );
+inline void _Funcbuiltin_0x60_sort_5e5b973bd52198d5 ( Context * __context__, TDim<double,4> & __a_rename_at_572 );
+inline void _Funcbuiltin_0x60_sort_efbd6153351590ed ( Context * __context__, TDim<char *,4> & __a_rename_at_572 );
+inline void _Funcbuiltin_0x60_sort_29fe750c208866cf ( Context * __context__, TDim<Foo,4> & __a_rename_at_572 );
+inline void _Func_0x60_test_sort_a75cfdddabbef664 ( Context * __context__, TArray<int32_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_9c2a555cf2d8c100 ( Context * __context__, TArray<uint32_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_63317e10903f3ab6 ( Context * __context__, TArray<int64_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_a4fae1f5c307ae56 ( Context * __context__, TArray<uint64_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_f746378d6a490731 ( Context * __context__, TArray<float> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_d7150591b32392e1 ( Context * __context__, TArray<double> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_4c645c185d091e64 ( Context * __context__, TArray<char *> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_5923fd4d2497f7a3 ( Context * __context__, TArray<Foo> & __arr_rename_at_1 );
+inline void _Funcbuiltin_0x60_push_6c25697422f5e150 ( Context * __context__, TArray<float2> & __Arr_rename_at_75, float2 __value_rename_at_75 );
+inline void _Func_0x60_test_sort_comp_550e8513f82d9b39 ( Context * __context__, TArray<float2> & __arr_rename_at_10 );
+inline void _Func_0x60_test_sort_8f2befed097dda31 ( Context * __context__, TDim<int32_t,4> & __arr_rename_at_1 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_adf8841f5d461f64 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_518 );
+inline void _Func_0x60_test_sort_8c8cbef9c4581b23 ( Context * __context__, TDim<uint32_t,4> & __arr_rename_at_1 );
+inline TArray<uint32_t> _Funcbuiltin_0x60_to_array_move_a9124ee8f8e115d0 ( Context * __context__, TDim<uint32_t,4> & __a_rename_at_518 );
+inline void _Func_0x60_test_sort_623d951f969d8ba7 ( Context * __context__, TDim<int64_t,4> & __arr_rename_at_1 );
+inline TArray<int64_t> _Funcbuiltin_0x60_to_array_move_e4dff59b19749ef2 ( Context * __context__, TDim<int64_t,4> & __a_rename_at_518 );
+inline void _Func_0x60_test_sort_8321df15255e6e35 ( Context * __context__, TDim<uint64_t,4> & __arr_rename_at_1 );
+inline TArray<uint64_t> _Funcbuiltin_0x60_to_array_move_f542d0a06890323a ( Context * __context__, TDim<uint64_t,4> & __a_rename_at_518 );
+inline void _Func_0x60_test_sort_13aa67a62df820be ( Context * __context__, TDim<float,4> & __arr_rename_at_1 );
+inline TArray<float> _Funcbuiltin_0x60_to_array_move_ff43a82787da4803 ( Context * __context__, TDim<float,4> & __a_rename_at_518 );
+inline void _Func_0x60_test_sort_d750aaa6d65616b8 ( Context * __context__, TDim<double,4> & __arr_rename_at_1 );
+inline TArray<double> _Funcbuiltin_0x60_to_array_move_ef96ab4381d3ab8f ( Context * __context__, TDim<double,4> & __a_rename_at_518 );
+inline void _Func_0x60_test_sort_16afbe681d025215 ( Context * __context__, TDim<char *,4> & __arr_rename_at_1 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_34d5fb4c1af473b4 ( Context * __context__, TDim<char *,4> & __a_rename_at_518 );
+inline void _Func_0x60_test_sort_1caee3f6ea2dc214 ( Context * __context__, TDim<Foo,4> & __arr_rename_at_1 );
+inline TArray<Foo> _Funcbuiltin_0x60_to_array_move_5cb599e2cd73c88a ( Context * __context__, TDim<Foo,4> & __a_rename_at_518 );
+inline bool _FuncLess_b668e86487895147 ( Context * __context__, Foo const  & __a_rename_at_20, Foo const  & __b_rename_at_20 );
+inline void test_vector_sort_74cc0281ce3a8534 ( Context * __context__ );
+inline bool test_6191155e03116fbc ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_29914d27690eb1e4 ( Context * __context__, TArray<uint32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<uint32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_20419c2df14c9d85 ( Context * __context__, TArray<int64_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int64_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_48979e8311fe5126 ( Context * __context__, TArray<uint64_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<uint64_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<float>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_6640dbff129f8443 ( Context * __context__, TArray<double> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<double>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_df901583a0cdec70 ( Context * __context__, TArray<Foo> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<Foo>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_4732ebdcad990f07 ( Context * __context__, TArray<int32_t> &  __a_rename_at_590 )
+{
+	builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_590),__context__);
+	builtin_sort<int32_t>(das_ref(__context__,__a_rename_at_590(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_590)));
+	builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_590),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_e577240fb029e3d2 ( Context * __context__, TArray<uint32_t> &  __a_rename_at_590 )
+{
+	builtin_array_lock(das_arg<TArray<uint32_t>>::pass(__a_rename_at_590),__context__);
+	builtin_sort<uint32_t>(das_ref(__context__,__a_rename_at_590(0,__context__)),builtin_array_size(das_arg<TArray<uint32_t>>::pass(__a_rename_at_590)));
+	builtin_array_unlock(das_arg<TArray<uint32_t>>::pass(__a_rename_at_590),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_41715831ae7f1315 ( Context * __context__, TArray<int64_t> &  __a_rename_at_590 )
+{
+	builtin_array_lock(das_arg<TArray<int64_t>>::pass(__a_rename_at_590),__context__);
+	builtin_sort<int64_t>(das_ref(__context__,__a_rename_at_590(0,__context__)),builtin_array_size(das_arg<TArray<int64_t>>::pass(__a_rename_at_590)));
+	builtin_array_unlock(das_arg<TArray<int64_t>>::pass(__a_rename_at_590),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_7c9a8c217ad5bb18 ( Context * __context__, TArray<uint64_t> &  __a_rename_at_590 )
+{
+	builtin_array_lock(das_arg<TArray<uint64_t>>::pass(__a_rename_at_590),__context__);
+	builtin_sort<uint64_t>(das_ref(__context__,__a_rename_at_590(0,__context__)),builtin_array_size(das_arg<TArray<uint64_t>>::pass(__a_rename_at_590)));
+	builtin_array_unlock(das_arg<TArray<uint64_t>>::pass(__a_rename_at_590),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_b62e086287e4e9ac ( Context * __context__, TArray<float> &  __a_rename_at_590 )
+{
+	builtin_array_lock(das_arg<TArray<float>>::pass(__a_rename_at_590),__context__);
+	builtin_sort<float>(das_ref(__context__,__a_rename_at_590(0,__context__)),builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_590)));
+	builtin_array_unlock(das_arg<TArray<float>>::pass(__a_rename_at_590),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_a351332315ffdad7 ( Context * __context__, TArray<double> &  __a_rename_at_590 )
+{
+	builtin_array_lock(das_arg<TArray<double>>::pass(__a_rename_at_590),__context__);
+	builtin_sort<double>(das_ref(__context__,__a_rename_at_590(0,__context__)),builtin_array_size(das_arg<TArray<double>>::pass(__a_rename_at_590)));
+	builtin_array_unlock(das_arg<TArray<double>>::pass(__a_rename_at_590),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_ff406c5ab603b771 ( Context * __context__, TArray<char *> &  __a_rename_at_590 )
+{
+	builtin_array_lock(das_arg<TArray<char *>>::pass(__a_rename_at_590),__context__);
+	builtin_sort_string(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_590(0,__context__))),builtin_array_size(das_arg<TArray<char *>>::pass(__a_rename_at_590)));
+	builtin_array_unlock(das_arg<TArray<char *>>::pass(__a_rename_at_590),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_67424656e829030e ( Context * __context__, TArray<Foo> &  __a_rename_at_590 )
+{
+	builtin_sort_array_any_cblock_T(das_arg<TArray<Foo>>::pass(__a_rename_at_590),8,builtin_array_size(das_arg<TArray<Foo>>::pass(__a_rename_at_590)),[&](Foo const  & __x_rename_at_606, Foo const  & __y_rename_at_606)->bool{
+		return das_auto_cast<bool>::cast(_FuncLess_b668e86487895147(__context__,__x_rename_at_606,__y_rename_at_606));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Funcbuiltin_0x60_sort_5de58d1eb04c83e3 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_572 )
+{
+	builtin_sort<int32_t>(das_ref(__context__,__a_rename_at_572(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_fe3388df434e572c ( Context * __context__, TDim<uint32_t,4> &  __a_rename_at_572 )
+{
+	builtin_sort<uint32_t>(das_ref(__context__,__a_rename_at_572(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_2284b0bf8fa51c75 ( Context * __context__, TDim<int64_t,4> &  __a_rename_at_572 )
+{
+	builtin_sort<int64_t>(das_ref(__context__,__a_rename_at_572(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_321a87dafe5eb0a2 ( Context * __context__, TDim<uint64_t,4> &  __a_rename_at_572 )
+{
+	builtin_sort<uint64_t>(das_ref(__context__,__a_rename_at_572(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_20b4d52a5594ef8 ( Context * __context__, TDim<float,4> &  __a_rename_at_572 )
+{
+	builtin_sort<float>(das_ref(__context__,__a_rename_at_572(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_5e5b973bd52198d5 ( Context * __context__, TDim<double,4> &  __a_rename_at_572 )
+{
+	builtin_sort<double>(das_ref(__context__,__a_rename_at_572(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_efbd6153351590ed ( Context * __context__, TDim<char *,4> &  __a_rename_at_572 )
+{
+	builtin_sort_string(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_572(0,__context__))),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_29fe750c208866cf ( Context * __context__, TDim<Foo,4> &  __a_rename_at_572 )
+{
+	builtin_sort_dim_any_cblock_T(das_arg<TDim<Foo,4>>::pass(__a_rename_at_572),8,4,[&](Foo const  & __x_rename_at_584, Foo const  & __y_rename_at_584)->bool{
+		return das_auto_cast<bool>::cast(_FuncLess_b668e86487895147(__context__,__x_rename_at_584,__y_rename_at_584));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_0x60_test_sort_a75cfdddabbef664 ( Context * __context__, TArray<int32_t> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_4732ebdcad990f07(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<int32_t>>::pass(__arr_rename_at_1),4,0,[&](int32_t const  __a_rename_at_6, int32_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Func_0x60_test_sort_9c2a555cf2d8c100 ( Context * __context__, TArray<uint32_t> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_e577240fb029e3d2(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<uint32_t>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<uint32_t>>::pass(__arr_rename_at_1),4,0,[&](uint32_t const  __a_rename_at_6, uint32_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Func_0x60_test_sort_63317e10903f3ab6 ( Context * __context__, TArray<int64_t> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_41715831ae7f1315(__context__,das_arg<TArray<int64_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<int64_t>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<int64_t>>::pass(__arr_rename_at_1),8,0,[&](int64_t const  __a_rename_at_6, int64_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Func_0x60_test_sort_a4fae1f5c307ae56 ( Context * __context__, TArray<uint64_t> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_7c9a8c217ad5bb18(__context__,das_arg<TArray<uint64_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<uint64_t>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<uint64_t>>::pass(__arr_rename_at_1),8,0,[&](uint64_t const  __a_rename_at_6, uint64_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Func_0x60_test_sort_f746378d6a490731 ( Context * __context__, TArray<float> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_b62e086287e4e9ac(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<float>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<float>>::pass(__arr_rename_at_1),4,0,[&](float const  __a_rename_at_6, float const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Func_0x60_test_sort_d7150591b32392e1 ( Context * __context__, TArray<double> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_a351332315ffdad7(__context__,das_arg<TArray<double>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<double>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<double>>::pass(__arr_rename_at_1),8,0,[&](double const  __a_rename_at_6, double const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Func_0x60_test_sort_4c645c185d091e64 ( Context * __context__, TArray<char *> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_ff406c5ab603b771(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<char *>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_4,__context__)),*__context__,nullptr)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<char *>>::pass(__arr_rename_at_1),8,0,[&](char * const  __a_rename_at_6, char * const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(SimPolicy<char *>::Less(cast<char *>::from(__a_rename_at_6),cast<char *>::from(__b_rename_at_6),*__context__,nullptr)));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_7,__context__)),*__context__,nullptr))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Func_0x60_test_sort_5923fd4d2497f7a3 ( Context * __context__, TArray<Foo> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_67424656e829030e(__context__,das_arg<TArray<Foo>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<Foo>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((_FuncLess_b668e86487895147(__context__,das_arg<Foo>::pass(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),das_arg<Foo>::pass(__arr_rename_at_1(__i_rename_at_4,__context__)))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_cblock_T(das_arg<TArray<Foo>>::pass(__arr_rename_at_1),8,0,[&](Foo const  & __a_rename_at_6, Foo const  & __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(_FuncLess_b668e86487895147(__context__,__a_rename_at_6,__b_rename_at_6)));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(_FuncLess_b668e86487895147(__context__,das_arg<Foo>::pass(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),das_arg<Foo>::pass(__arr_rename_at_1(__i_rename_at_7,__context__))))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Funcbuiltin_0x60_push_6c25697422f5e150 ( Context * __context__, TArray<float2> &  __Arr_rename_at_75, float2 __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<float2>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Func_0x60_test_sort_comp_550e8513f82d9b39 ( Context * __context__, TArray<float2> &  __arr_rename_at_10 )
+{
+	int32_t __len_rename_at_11 = ((int32_t)builtin_array_size(das_arg<TArray<float2>>::pass(__arr_rename_at_10)));
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<float2>>::pass(__arr_rename_at_10),8,0,[&](float2 __a_rename_at_12, float2 __b_rename_at_12)->bool{
+		return das_auto_cast<bool>::cast(v_extract_x(__a_rename_at_12) /*x*/ < v_extract_x(__b_rename_at_12) /*x*/);
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_14 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_11));
+		int32_t __i_rename_at_14;
+		__need_loop_14 = __i_iterator.first(__context__,(__i_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __i_iterator.next(__context__,(__i_rename_at_14)) )
+		{
+			DAS_ASSERT((v_extract_x(__arr_rename_at_10((__i_rename_at_14 - 1),__context__)) /*x*/ < v_extract_x(__arr_rename_at_10(__i_rename_at_14,__context__)) /*x*/));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_14));
+	};
+}
+
+inline void _Func_0x60_test_sort_8f2befed097dda31 ( Context * __context__, TDim<int32_t,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_5de58d1eb04c83e3(__context__,das_arg<TDim<int32_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<int32_t,4>>::pass(__arr_rename_at_1),4,4,[&](int32_t const  __a_rename_at_6, int32_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_adf8841f5d461f64 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_518 )
+{
+	TArray<int32_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_519),4);
+	das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_519);
+}
+
+inline void _Func_0x60_test_sort_8c8cbef9c4581b23 ( Context * __context__, TDim<uint32_t,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_fe3388df434e572c(__context__,das_arg<TDim<uint32_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<uint32_t,4>>::pass(__arr_rename_at_1),4,4,[&](uint32_t const  __a_rename_at_6, uint32_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<uint32_t> _Funcbuiltin_0x60_to_array_move_a9124ee8f8e115d0 ( Context * __context__, TDim<uint32_t,4> &  __a_rename_at_518 )
+{
+	TArray<uint32_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_29914d27690eb1e4(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_519),4);
+	das_copy(das_cast<TDim<uint32_t,4>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<uint32_t>>::cast(__arr_rename_at_519);
+}
+
+inline void _Func_0x60_test_sort_623d951f969d8ba7 ( Context * __context__, TDim<int64_t,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_2284b0bf8fa51c75(__context__,das_arg<TDim<int64_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<int64_t,4>>::pass(__arr_rename_at_1),8,4,[&](int64_t const  __a_rename_at_6, int64_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<int64_t> _Funcbuiltin_0x60_to_array_move_e4dff59b19749ef2 ( Context * __context__, TDim<int64_t,4> &  __a_rename_at_518 )
+{
+	TArray<int64_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_20419c2df14c9d85(__context__,das_arg<TArray<int64_t>>::pass(__arr_rename_at_519),4);
+	das_copy(das_cast<TDim<int64_t,4>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<int64_t>>::cast(__arr_rename_at_519);
+}
+
+inline void _Func_0x60_test_sort_8321df15255e6e35 ( Context * __context__, TDim<uint64_t,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_321a87dafe5eb0a2(__context__,das_arg<TDim<uint64_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<uint64_t,4>>::pass(__arr_rename_at_1),8,4,[&](uint64_t const  __a_rename_at_6, uint64_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<uint64_t> _Funcbuiltin_0x60_to_array_move_f542d0a06890323a ( Context * __context__, TDim<uint64_t,4> &  __a_rename_at_518 )
+{
+	TArray<uint64_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_48979e8311fe5126(__context__,das_arg<TArray<uint64_t>>::pass(__arr_rename_at_519),4);
+	das_copy(das_cast<TDim<uint64_t,4>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<uint64_t>>::cast(__arr_rename_at_519);
+}
+
+inline void _Func_0x60_test_sort_13aa67a62df820be ( Context * __context__, TDim<float,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_20b4d52a5594ef8(__context__,das_arg<TDim<float,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<float,4>>::pass(__arr_rename_at_1),4,4,[&](float const  __a_rename_at_6, float const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<float> _Funcbuiltin_0x60_to_array_move_ff43a82787da4803 ( Context * __context__, TDim<float,4> &  __a_rename_at_518 )
+{
+	TArray<float> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_519),4);
+	das_copy(das_cast<TDim<float,4>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<float>>::cast(__arr_rename_at_519);
+}
+
+inline void _Func_0x60_test_sort_d750aaa6d65616b8 ( Context * __context__, TDim<double,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_5e5b973bd52198d5(__context__,das_arg<TDim<double,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<double,4>>::pass(__arr_rename_at_1),8,4,[&](double const  __a_rename_at_6, double const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<double> _Funcbuiltin_0x60_to_array_move_ef96ab4381d3ab8f ( Context * __context__, TDim<double,4> &  __a_rename_at_518 )
+{
+	TArray<double> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_6640dbff129f8443(__context__,das_arg<TArray<double>>::pass(__arr_rename_at_519),4);
+	das_copy(das_cast<TDim<double,4>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<double>>::cast(__arr_rename_at_519);
+}
+
+inline void _Func_0x60_test_sort_16afbe681d025215 ( Context * __context__, TDim<char *,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_efbd6153351590ed(__context__,das_arg<TDim<char *,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_4,__context__)),*__context__,nullptr)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<char *,4>>::pass(__arr_rename_at_1),8,4,[&](char * const  __a_rename_at_6, char * const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(SimPolicy<char *>::Less(cast<char *>::from(__a_rename_at_6),cast<char *>::from(__b_rename_at_6),*__context__,nullptr)));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_7,__context__)),*__context__,nullptr))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_34d5fb4c1af473b4 ( Context * __context__, TDim<char *,4> &  __a_rename_at_518 )
+{
+	TArray<char *> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_519),4);
+	das_copy(das_cast<TDim<char *,4>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(__arr_rename_at_519);
+}
+
+inline void _Func_0x60_test_sort_1caee3f6ea2dc214 ( Context * __context__, TDim<Foo,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_29fe750c208866cf(__context__,das_arg<TDim<Foo,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((_FuncLess_b668e86487895147(__context__,das_arg<Foo>::pass(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),das_arg<Foo>::pass(__arr_rename_at_1(__i_rename_at_4,__context__)))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_cblock_T(das_arg<TDim<Foo,4>>::pass(__arr_rename_at_1),8,4,[&](Foo const  & __a_rename_at_6, Foo const  & __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(_FuncLess_b668e86487895147(__context__,__a_rename_at_6,__b_rename_at_6)));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(_FuncLess_b668e86487895147(__context__,das_arg<Foo>::pass(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),das_arg<Foo>::pass(__arr_rename_at_1(__i_rename_at_7,__context__))))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<Foo> _Funcbuiltin_0x60_to_array_move_5cb599e2cd73c88a ( Context * __context__, TDim<Foo,4> &  __a_rename_at_518 )
+{
+	TArray<Foo> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_df901583a0cdec70(__context__,das_arg<TArray<Foo>>::pass(__arr_rename_at_519),4);
+	das_copy(das_cast<TDim<Foo,4>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<Foo>>::cast(__arr_rename_at_519);
+}
+
+inline bool _FuncLess_b668e86487895147 ( Context * __context__, Foo const  &  __a_rename_at_20, Foo const  &  __b_rename_at_20 )
+{
+	return das_auto_cast<bool>::cast((__a_rename_at_20.x + __a_rename_at_20.y) < (__b_rename_at_20.x + __b_rename_at_20.y));
+}
+
+inline void test_vector_sort_74cc0281ce3a8534 ( Context * __context__ )
+{
+	TArray<float2> __arr_rename_at_24; das_zero(__arr_rename_at_24);
+	_Funcbuiltin_0x60_push_6c25697422f5e150(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_24),v_make_vec4f(4.f,0.f,0.f,0.f));
+	_Funcbuiltin_0x60_push_6c25697422f5e150(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_24),v_make_vec4f(3.f,1.f,0.f,0.f));
+	_Funcbuiltin_0x60_push_6c25697422f5e150(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_24),v_make_vec4f(5.f,2.f,0.f,0.f));
+	_Func_0x60_test_sort_comp_550e8513f82d9b39(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_24));
+}
+
+inline bool test_6191155e03116fbc ( Context * __context__ )
+{
+	TDim<int32_t,4> _temp_make_local_33_32;
+	TArray<int32_t> _temp_make_local_34_48;
+	TDim<int32_t,4> _temp_make_local_34_80;
+	TDim<uint32_t,4> _temp_make_local_35_96;
+	TArray<uint32_t> _temp_make_local_36_112;
+	TDim<uint32_t,4> _temp_make_local_36_144;
+	TDim<int64_t,4> _temp_make_local_37_160;
+	TArray<int64_t> _temp_make_local_38_192;
+	TDim<int64_t,4> _temp_make_local_38_224;
+	TDim<uint64_t,4> _temp_make_local_39_256;
+	TArray<uint64_t> _temp_make_local_40_288;
+	TDim<uint64_t,4> _temp_make_local_40_320;
+	TDim<float,4> _temp_make_local_41_352;
+	TArray<float> _temp_make_local_42_368;
+	TDim<float,4> _temp_make_local_42_400;
+	TDim<double,4> _temp_make_local_43_416;
+	TArray<double> _temp_make_local_44_448;
+	TDim<double,4> _temp_make_local_44_480;
+	TDim<char *,4> _temp_make_local_46_512;
+	TArray<char *> _temp_make_local_47_544;
+	TDim<char *,4> _temp_make_local_47_576;
+	TDim<Foo,4> _temp_make_local_49_608;
+	TArray<Foo> _temp_make_local_50_640;
+	TDim<Foo,4> _temp_make_local_50_672;
+	_Func_0x60_test_sort_8f2befed097dda31(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_33_32(0,__context__) = 3;
+		_temp_make_local_33_32(1,__context__) = 2;
+		_temp_make_local_33_32(2,__context__) = 4;
+		_temp_make_local_33_32(3,__context__) = 1;
+		return _temp_make_local_33_32;
+	})())));
+	_Func_0x60_test_sort_a75cfdddabbef664(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_34_48 = (_Funcbuiltin_0x60_to_array_move_adf8841f5d461f64(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_34_80(0,__context__) = 3;
+		_temp_make_local_34_80(1,__context__) = 2;
+		_temp_make_local_34_80(2,__context__) = 4;
+		_temp_make_local_34_80(3,__context__) = 1;
+		return _temp_make_local_34_80;
+	})())))))));
+	_Func_0x60_test_sort_8c8cbef9c4581b23(__context__,das_arg<TDim<uint32_t,4>>::pass((([&]() -> TDim<uint32_t,4>& {
+		_temp_make_local_35_96(0,__context__) = 0x3u;
+		_temp_make_local_35_96(1,__context__) = 0x2u;
+		_temp_make_local_35_96(2,__context__) = 0x4u;
+		_temp_make_local_35_96(3,__context__) = 0x1u;
+		return _temp_make_local_35_96;
+	})())));
+	_Func_0x60_test_sort_9c2a555cf2d8c100(__context__,das_arg<TArray<uint32_t>>::pass((_temp_make_local_36_112 = (_Funcbuiltin_0x60_to_array_move_a9124ee8f8e115d0(__context__,das_arg<TDim<uint32_t,4>>::pass((([&]() -> TDim<uint32_t,4>& {
+		_temp_make_local_36_144(0,__context__) = 0x3u;
+		_temp_make_local_36_144(1,__context__) = 0x2u;
+		_temp_make_local_36_144(2,__context__) = 0x4u;
+		_temp_make_local_36_144(3,__context__) = 0x1u;
+		return _temp_make_local_36_144;
+	})())))))));
+	_Func_0x60_test_sort_623d951f969d8ba7(__context__,das_arg<TDim<int64_t,4>>::pass((([&]() -> TDim<int64_t,4>& {
+		_temp_make_local_37_160(0,__context__) = INT64_C(3);
+		_temp_make_local_37_160(1,__context__) = INT64_C(2);
+		_temp_make_local_37_160(2,__context__) = INT64_C(4);
+		_temp_make_local_37_160(3,__context__) = INT64_C(1);
+		return _temp_make_local_37_160;
+	})())));
+	_Func_0x60_test_sort_63317e10903f3ab6(__context__,das_arg<TArray<int64_t>>::pass((_temp_make_local_38_192 = (_Funcbuiltin_0x60_to_array_move_e4dff59b19749ef2(__context__,das_arg<TDim<int64_t,4>>::pass((([&]() -> TDim<int64_t,4>& {
+		_temp_make_local_38_224(0,__context__) = INT64_C(3);
+		_temp_make_local_38_224(1,__context__) = INT64_C(2);
+		_temp_make_local_38_224(2,__context__) = INT64_C(4);
+		_temp_make_local_38_224(3,__context__) = INT64_C(1);
+		return _temp_make_local_38_224;
+	})())))))));
+	_Func_0x60_test_sort_8321df15255e6e35(__context__,das_arg<TDim<uint64_t,4>>::pass((([&]() -> TDim<uint64_t,4>& {
+		_temp_make_local_39_256(0,__context__) = UINT64_C(0x3);
+		_temp_make_local_39_256(1,__context__) = UINT64_C(0x2);
+		_temp_make_local_39_256(2,__context__) = UINT64_C(0x4);
+		_temp_make_local_39_256(3,__context__) = UINT64_C(0x1);
+		return _temp_make_local_39_256;
+	})())));
+	_Func_0x60_test_sort_a4fae1f5c307ae56(__context__,das_arg<TArray<uint64_t>>::pass((_temp_make_local_40_288 = (_Funcbuiltin_0x60_to_array_move_f542d0a06890323a(__context__,das_arg<TDim<uint64_t,4>>::pass((([&]() -> TDim<uint64_t,4>& {
+		_temp_make_local_40_320(0,__context__) = UINT64_C(0x3);
+		_temp_make_local_40_320(1,__context__) = UINT64_C(0x2);
+		_temp_make_local_40_320(2,__context__) = UINT64_C(0x4);
+		_temp_make_local_40_320(3,__context__) = UINT64_C(0x1);
+		return _temp_make_local_40_320;
+	})())))))));
+	_Func_0x60_test_sort_13aa67a62df820be(__context__,das_arg<TDim<float,4>>::pass((([&]() -> TDim<float,4>& {
+		_temp_make_local_41_352(0,__context__) = 3.f;
+		_temp_make_local_41_352(1,__context__) = 2.f;
+		_temp_make_local_41_352(2,__context__) = 4.f;
+		_temp_make_local_41_352(3,__context__) = 1.f;
+		return _temp_make_local_41_352;
+	})())));
+	_Func_0x60_test_sort_f746378d6a490731(__context__,das_arg<TArray<float>>::pass((_temp_make_local_42_368 = (_Funcbuiltin_0x60_to_array_move_ff43a82787da4803(__context__,das_arg<TDim<float,4>>::pass((([&]() -> TDim<float,4>& {
+		_temp_make_local_42_400(0,__context__) = 3.f;
+		_temp_make_local_42_400(1,__context__) = 2.f;
+		_temp_make_local_42_400(2,__context__) = 4.f;
+		_temp_make_local_42_400(3,__context__) = 1.f;
+		return _temp_make_local_42_400;
+	})())))))));
+	_Func_0x60_test_sort_d750aaa6d65616b8(__context__,das_arg<TDim<double,4>>::pass((([&]() -> TDim<double,4>& {
+		_temp_make_local_43_416(0,__context__) = 3.;
+		_temp_make_local_43_416(1,__context__) = 2.;
+		_temp_make_local_43_416(2,__context__) = 4.;
+		_temp_make_local_43_416(3,__context__) = 1.;
+		return _temp_make_local_43_416;
+	})())));
+	_Func_0x60_test_sort_d7150591b32392e1(__context__,das_arg<TArray<double>>::pass((_temp_make_local_44_448 = (_Funcbuiltin_0x60_to_array_move_ef96ab4381d3ab8f(__context__,das_arg<TDim<double,4>>::pass((([&]() -> TDim<double,4>& {
+		_temp_make_local_44_480(0,__context__) = 3.;
+		_temp_make_local_44_480(1,__context__) = 2.;
+		_temp_make_local_44_480(2,__context__) = 4.;
+		_temp_make_local_44_480(3,__context__) = 1.;
+		return _temp_make_local_44_480;
+	})())))))));
+	_Func_0x60_test_sort_16afbe681d025215(__context__,das_arg<TDim<char *,4>>::pass((([&]() -> TDim<char *,4>& {
+		_temp_make_local_46_512(0,__context__) = ((char *) "3.0lf");
+		_temp_make_local_46_512(1,__context__) = ((char *) "2.0lf");
+		_temp_make_local_46_512(2,__context__) = ((char *) "4.0lf");
+		_temp_make_local_46_512(3,__context__) = ((char *) "1.0lf");
+		return _temp_make_local_46_512;
+	})())));
+	_Func_0x60_test_sort_4c645c185d091e64(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_47_544 = (_Funcbuiltin_0x60_to_array_move_34d5fb4c1af473b4(__context__,das_arg<TDim<char *,4>>::pass((([&]() -> TDim<char *,4>& {
+		_temp_make_local_47_576(0,__context__) = ((char *) "3.0lf");
+		_temp_make_local_47_576(1,__context__) = ((char *) "2.0lf");
+		_temp_make_local_47_576(2,__context__) = ((char *) "4.0lf");
+		_temp_make_local_47_576(3,__context__) = ((char *) "1.0lf");
+		return _temp_make_local_47_576;
+	})())))))));
+	_Func_0x60_test_sort_1caee3f6ea2dc214(__context__,das_arg<TDim<Foo,4>>::pass((([&]() -> TDim<Foo,4>& {
+		das_copy((_temp_make_local_49_608(0,__context__).x),(1));
+		das_copy((_temp_make_local_49_608(0,__context__).y),(2));
+		das_copy((_temp_make_local_49_608(1,__context__).x),(1));
+		das_copy((_temp_make_local_49_608(1,__context__).y),(1));
+		das_copy((_temp_make_local_49_608(2,__context__).x),(2));
+		das_copy((_temp_make_local_49_608(2,__context__).y),(2));
+		das_copy((_temp_make_local_49_608(3,__context__).x),(0));
+		das_copy((_temp_make_local_49_608(3,__context__).y),(1));
+		return _temp_make_local_49_608;
+	})())));
+	_Func_0x60_test_sort_5923fd4d2497f7a3(__context__,das_arg<TArray<Foo>>::pass((_temp_make_local_50_640 = (_Funcbuiltin_0x60_to_array_move_5cb599e2cd73c88a(__context__,das_arg<TDim<Foo,4>>::pass((([&]() -> TDim<Foo,4>& {
+		das_copy((_temp_make_local_50_672(0,__context__).x),(1));
+		das_copy((_temp_make_local_50_672(0,__context__).y),(2));
+		das_copy((_temp_make_local_50_672(1,__context__).x),(1));
+		das_copy((_temp_make_local_50_672(1,__context__).y),(1));
+		das_copy((_temp_make_local_50_672(2,__context__).x),(2));
+		das_copy((_temp_make_local_50_672(2,__context__).y),(2));
+		das_copy((_temp_make_local_50_672(3,__context__).x),(0));
+		das_copy((_temp_make_local_50_672(3,__context__).y),(1));
+		return _temp_make_local_50_672;
+	})())))))));
+	test_vector_sort_74cc0281ce3a8534(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_resize_29914d27690eb1e4
+	aotLib[0xa8bc2d4cd78e1eb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_29914d27690eb1e4>>();
+	};
+	// _Funcbuiltin_0x60_resize_20419c2df14c9d85
+	aotLib[0xd8c6bad9bc39fd9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int64_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_20419c2df14c9d85>>();
+	};
+	// _Funcbuiltin_0x60_resize_48979e8311fe5126
+	aotLib[0x9c33afc0a77b395] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_48979e8311fe5126>>();
+	};
+	// _Funcbuiltin_0x60_resize_d240579333227022
+	aotLib[0x40d6b5552dd22f51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , int32_t  ),&_Funcbuiltin_0x60_resize_d240579333227022>>();
+	};
+	// _Funcbuiltin_0x60_resize_6640dbff129f8443
+	aotLib[0x5f5728a8af39c939] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<double> & , int32_t  ),&_Funcbuiltin_0x60_resize_6640dbff129f8443>>();
+	};
+	// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+	aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+	// _Funcbuiltin_0x60_resize_df901583a0cdec70
+	aotLib[0xd1cfb1c711f572e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Foo> & , int32_t  ),&_Funcbuiltin_0x60_resize_df901583a0cdec70>>();
+	};
+	// _Funcbuiltin_0x60_sort_4732ebdcad990f07
+	aotLib[0xbd9e102c769f911d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_sort_4732ebdcad990f07>>();
+	};
+	// _Funcbuiltin_0x60_sort_e577240fb029e3d2
+	aotLib[0x92ad28c7a14e1d41] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> &  ),&_Funcbuiltin_0x60_sort_e577240fb029e3d2>>();
+	};
+	// _Funcbuiltin_0x60_sort_41715831ae7f1315
+	aotLib[0xe8957c42b10c356d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int64_t> &  ),&_Funcbuiltin_0x60_sort_41715831ae7f1315>>();
+	};
+	// _Funcbuiltin_0x60_sort_7c9a8c217ad5bb18
+	aotLib[0xce6fe8d66422e469] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> &  ),&_Funcbuiltin_0x60_sort_7c9a8c217ad5bb18>>();
+	};
+	// _Funcbuiltin_0x60_sort_b62e086287e4e9ac
+	aotLib[0x6cd7578140ba75d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Funcbuiltin_0x60_sort_b62e086287e4e9ac>>();
+	};
+	// _Funcbuiltin_0x60_sort_a351332315ffdad7
+	aotLib[0x9bb44e777dca65d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<double> &  ),&_Funcbuiltin_0x60_sort_a351332315ffdad7>>();
+	};
+	// _Funcbuiltin_0x60_sort_ff406c5ab603b771
+	aotLib[0x635aaf1fa4303005] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_sort_ff406c5ab603b771>>();
+	};
+	// _Funcbuiltin_0x60_sort_67424656e829030e
+	aotLib[0xaa9cabb2f58263bf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Foo> &  ),&_Funcbuiltin_0x60_sort_67424656e829030e>>();
+	};
+	// _Funcbuiltin_0x60_sort_5de58d1eb04c83e3
+	aotLib[0x1d72689eeb43a3dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Funcbuiltin_0x60_sort_5de58d1eb04c83e3>>();
+	};
+	// _Funcbuiltin_0x60_sort_fe3388df434e572c
+	aotLib[0x166ceeb96669925] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,4> &  ),&_Funcbuiltin_0x60_sort_fe3388df434e572c>>();
+	};
+	// _Funcbuiltin_0x60_sort_2284b0bf8fa51c75
+	aotLib[0x1c141f56d7191805] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int64_t,4> &  ),&_Funcbuiltin_0x60_sort_2284b0bf8fa51c75>>();
+	};
+	// _Funcbuiltin_0x60_sort_321a87dafe5eb0a2
+	aotLib[0x7c7cb99e934b60e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint64_t,4> &  ),&_Funcbuiltin_0x60_sort_321a87dafe5eb0a2>>();
+	};
+	// _Funcbuiltin_0x60_sort_20b4d52a5594ef8
+	aotLib[0x4aa424e6163eabe5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<float,4> &  ),&_Funcbuiltin_0x60_sort_20b4d52a5594ef8>>();
+	};
+	// _Funcbuiltin_0x60_sort_5e5b973bd52198d5
+	aotLib[0x8f9ae5d52f7559dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<double,4> &  ),&_Funcbuiltin_0x60_sort_5e5b973bd52198d5>>();
+	};
+	// _Funcbuiltin_0x60_sort_efbd6153351590ed
+	aotLib[0xa9503aacd3f1e3f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<char *,4> &  ),&_Funcbuiltin_0x60_sort_efbd6153351590ed>>();
+	};
+	// _Funcbuiltin_0x60_sort_29fe750c208866cf
+	aotLib[0x27c25872113289c7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<Foo,4> &  ),&_Funcbuiltin_0x60_sort_29fe750c208866cf>>();
+	};
+	// _Func_0x60_test_sort_a75cfdddabbef664
+	aotLib[0x9aa0ea6788a5a57b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Func_0x60_test_sort_a75cfdddabbef664>>();
+	};
+	// _Func_0x60_test_sort_9c2a555cf2d8c100
+	aotLib[0xef07b54bd9799a30] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> &  ),&_Func_0x60_test_sort_9c2a555cf2d8c100>>();
+	};
+	// _Func_0x60_test_sort_63317e10903f3ab6
+	aotLib[0x6f8991167fb8ba6f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int64_t> &  ),&_Func_0x60_test_sort_63317e10903f3ab6>>();
+	};
+	// _Func_0x60_test_sort_a4fae1f5c307ae56
+	aotLib[0x805a6643db667b88] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> &  ),&_Func_0x60_test_sort_a4fae1f5c307ae56>>();
+	};
+	// _Func_0x60_test_sort_f746378d6a490731
+	aotLib[0x49ea4e20c93c9f31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Func_0x60_test_sort_f746378d6a490731>>();
+	};
+	// _Func_0x60_test_sort_d7150591b32392e1
+	aotLib[0xa8180fae58bc473a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<double> &  ),&_Func_0x60_test_sort_d7150591b32392e1>>();
+	};
+	// _Func_0x60_test_sort_4c645c185d091e64
+	aotLib[0x996ca8357db0a74f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Func_0x60_test_sort_4c645c185d091e64>>();
+	};
+	// _Func_0x60_test_sort_5923fd4d2497f7a3
+	aotLib[0x594ae9acef38bf46] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Foo> &  ),&_Func_0x60_test_sort_5923fd4d2497f7a3>>();
+	};
+	// _Funcbuiltin_0x60_push_6c25697422f5e150
+	aotLib[0x49ebe5856b0c910d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float2> & , float2  ),&_Funcbuiltin_0x60_push_6c25697422f5e150>>();
+	};
+	// _Func_0x60_test_sort_comp_550e8513f82d9b39
+	aotLib[0xda01996c1d918e2d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float2> &  ),&_Func_0x60_test_sort_comp_550e8513f82d9b39>>();
+	};
+	// _Func_0x60_test_sort_8f2befed097dda31
+	aotLib[0xa437283f24293bdc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Func_0x60_test_sort_8f2befed097dda31>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_adf8841f5d461f64
+	aotLib[0x36c5b0e8a702b305] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_adf8841f5d461f64>>();
+	};
+	// _Func_0x60_test_sort_8c8cbef9c4581b23
+	aotLib[0x169e9866ccaf5c01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,4> &  ),&_Func_0x60_test_sort_8c8cbef9c4581b23>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_a9124ee8f8e115d0
+	aotLib[0x577350f964849931] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint32_t> (*) ( Context * __context__, TDim<uint32_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_a9124ee8f8e115d0>>();
+	};
+	// _Func_0x60_test_sort_623d951f969d8ba7
+	aotLib[0x2af66a5717460a0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int64_t,4> &  ),&_Func_0x60_test_sort_623d951f969d8ba7>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_e4dff59b19749ef2
+	aotLib[0xd69a81c5dd1b60ec] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int64_t> (*) ( Context * __context__, TDim<int64_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_e4dff59b19749ef2>>();
+	};
+	// _Func_0x60_test_sort_8321df15255e6e35
+	aotLib[0xd35c199fa5ff5810] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint64_t,4> &  ),&_Func_0x60_test_sort_8321df15255e6e35>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_f542d0a06890323a
+	aotLib[0x6ee763add4a725c7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint64_t> (*) ( Context * __context__, TDim<uint64_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_f542d0a06890323a>>();
+	};
+	// _Func_0x60_test_sort_13aa67a62df820be
+	aotLib[0x3a0b487b50d03939] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<float,4> &  ),&_Func_0x60_test_sort_13aa67a62df820be>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_ff43a82787da4803
+	aotLib[0x798088b5f5e17c0c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<float> (*) ( Context * __context__, TDim<float,4> &  ),&_Funcbuiltin_0x60_to_array_move_ff43a82787da4803>>();
+	};
+	// _Func_0x60_test_sort_d750aaa6d65616b8
+	aotLib[0x96db8db152beb99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<double,4> &  ),&_Func_0x60_test_sort_d750aaa6d65616b8>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_ef96ab4381d3ab8f
+	aotLib[0x92737533000d9cc7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<double> (*) ( Context * __context__, TDim<double,4> &  ),&_Funcbuiltin_0x60_to_array_move_ef96ab4381d3ab8f>>();
+	};
+	// _Func_0x60_test_sort_16afbe681d025215
+	aotLib[0xb135b06dcd78b206] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<char *,4> &  ),&_Func_0x60_test_sort_16afbe681d025215>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_34d5fb4c1af473b4
+	aotLib[0xc6874403be41ba5b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,4> &  ),&_Funcbuiltin_0x60_to_array_move_34d5fb4c1af473b4>>();
+	};
+	// _Func_0x60_test_sort_1caee3f6ea2dc214
+	aotLib[0x9a15532ff92e1bf0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<Foo,4> &  ),&_Func_0x60_test_sort_1caee3f6ea2dc214>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_5cb599e2cd73c88a
+	aotLib[0x1f6b0b43f429f9ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<Foo> (*) ( Context * __context__, TDim<Foo,4> &  ),&_Funcbuiltin_0x60_to_array_move_5cb599e2cd73c88a>>();
+	};
+	// _FuncLess_b668e86487895147
+	aotLib[0x6b48c1395d18b6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Foo const  & , Foo const  &  ),&_FuncLess_b668e86487895147>>();
+	};
+	// test_vector_sort_74cc0281ce3a8534
+	aotLib[0x43dc5d26f4bdf57] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_vector_sort_74cc0281ce3a8534>>();
+	};
+	// test_6191155e03116fbc
+	aotLib[0x6931307faaf69674] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_6191155e03116fbc>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
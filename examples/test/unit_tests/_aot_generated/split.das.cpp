@@ -0,0 +1,273 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15444197070285191976 {
+
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__abb64728b4d13c3d;
+extern FuncInfo __func_info__d6b5107185f31d8a;
+
+VarInfo __func_info__d6b5107185f31d8a_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57442, 24, UINT64_C(0xabb64728b4d13c3d), "a", 0 };
+VarInfo * __func_info__d6b5107185f31d8a_fields[1] =  { &__func_info__d6b5107185f31d8a_field_0 };
+FuncInfo __func_info__d6b5107185f31d8a = {"invoke block<(a:array<string> const#):void> const", "", __func_info__d6b5107185f31d8a_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xd6b5107185f31d8a), 0x0 };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline void _Func_0x60_expect0_842d2b380121b6bb ( Context * __context__, TArray<char *> const  & __a_rename_at_4 );
+inline void _Func_0x60_expect1_8e8d2360c4eee0dd ( Context * __context__, TArray<char *> const  & __a_rename_at_9 );
+inline void _Func_0x60_expect2_d6b1e65a145a4a40 ( Context * __context__, TArray<char *> const  & __a_rename_at_14 );
+inline void _Func_0x60_expect3_5e3964d31f419c74 ( Context * __context__, TArray<char *> const  & __a_rename_at_20 );
+inline void _Func_0x60_expect3o_6d60e8abb9eea642 ( Context * __context__, TArray<char *> const  & __a_rename_at_27 );
+inline void _Funcstrings_boost_0x60_split_41c9a8111d4edaec ( Context * __context__, char * const  __text_rename_at_36, char * const  __delim_rename_at_36, Block DAS_COMMENT((void,TArray<char *> const )) const  & __blk_rename_at_36 );
+inline void _Func_0x60_expect0_1f783b3e80e5c512 ( Context * __context__, TArray<char *> const  & __a_rename_at_4 );
+inline void _Func_0x60_expect1_f80cc04efd928d7a ( Context * __context__, TArray<char *> const  & __a_rename_at_9 );
+inline void _Func_0x60_expect2_8bcf8ecd168e6de3 ( Context * __context__, TArray<char *> const  & __a_rename_at_14 );
+inline void _Func_0x60_expect3_e7655c89fc0d1293 ( Context * __context__, TArray<char *> const  & __a_rename_at_20 );
+inline void _Func_0x60_expect3o_eeedb11211ee3381 ( Context * __context__, TArray<char *> const  & __a_rename_at_27 );
+inline bool test_49d4e7b50f1e6783 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_0x60_expect0_842d2b380121b6bb ( Context * __context__, TArray<char *> const  &  __a_rename_at_4 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_4) == 1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_4(0,__context__)),cast<char *>::from(nullptr),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_expect1_8e8d2360c4eee0dd ( Context * __context__, TArray<char *> const  &  __a_rename_at_9 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_9) == 1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_9(0,__context__)),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_expect2_d6b1e65a145a4a40 ( Context * __context__, TArray<char *> const  &  __a_rename_at_14 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_14) == 2));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_14(0,__context__)),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_14(1,__context__)),cast<char *>::from(((char *) "two")),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_expect3_5e3964d31f419c74 ( Context * __context__, TArray<char *> const  &  __a_rename_at_20 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_20) == 3));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(0,__context__)),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(1,__context__)),cast<char *>::from(((char *) "two")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(2,__context__)),cast<char *>::from(((char *) "three")),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_expect3o_6d60e8abb9eea642 ( Context * __context__, TArray<char *> const  &  __a_rename_at_27 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_27) == 3));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(0,__context__)),cast<char *>::from(((char *) "o")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(1,__context__)),cast<char *>::from(((char *) "n")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(2,__context__)),cast<char *>::from(((char *) "e")),*__context__,nullptr)));
+}
+
+inline void _Funcstrings_boost_0x60_split_41c9a8111d4edaec ( Context * __context__, char * const  __text_rename_at_36, char * const  __delim_rename_at_36, Block DAS_COMMENT((void,TArray<char *> const )) const  &  __blk_rename_at_36 )
+{
+	builtin_string_split(__text_rename_at_36,__delim_rename_at_36,__blk_rename_at_36,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_0x60_expect0_1f783b3e80e5c512 ( Context * __context__, TArray<char *> const  &  __a_rename_at_4 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_4) == 1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_4(0,__context__)),cast<char *>::from(nullptr),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_expect1_f80cc04efd928d7a ( Context * __context__, TArray<char *> const  &  __a_rename_at_9 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_9) == 1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_9(0,__context__)),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_expect2_8bcf8ecd168e6de3 ( Context * __context__, TArray<char *> const  &  __a_rename_at_14 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_14) == 2));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_14(0,__context__)),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_14(1,__context__)),cast<char *>::from(((char *) "two")),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_expect3_e7655c89fc0d1293 ( Context * __context__, TArray<char *> const  &  __a_rename_at_20 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_20) == 3));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(0,__context__)),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(1,__context__)),cast<char *>::from(((char *) "two")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(2,__context__)),cast<char *>::from(((char *) "three")),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_expect3o_eeedb11211ee3381 ( Context * __context__, TArray<char *> const  &  __a_rename_at_27 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_27) == 3));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(0,__context__)),cast<char *>::from(((char *) "o")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(1,__context__)),cast<char *>::from(((char *) "n")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(2,__context__)),cast<char *>::from(((char *) "e")),*__context__,nullptr)));
+}
+
+inline bool test_49d4e7b50f1e6783 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,736,"test " DAS_FILE_LINE);
+{
+	TArray<char *> _temp_make_local_45_352;
+	TArray<char *> _temp_make_local_46_384;
+	TArray<char *> _temp_make_local_47_416;
+	TArray<char *> _temp_make_local_48_448;
+	TArray<char *> _temp_make_local_49_480;
+	TArray<char *> _temp_make_local_50_512;
+	_Funcstrings_boost_0x60_split_41c9a8111d4edaec(__context__,nullptr,nullptr,das_make_block<void,TArray<char *> const  &>(__context__,80,0,&__func_info__d6b5107185f31d8a,[&](TArray<char *> const  & __a_rename_at_35)->void{
+		_Func_0x60_expect0_842d2b380121b6bb(__context__,__a_rename_at_35);
+	}));
+	_Funcstrings_boost_0x60_split_41c9a8111d4edaec(__context__,((char *) "one"),((char *) ","),das_make_block<void,TArray<char *> const  &>(__context__,144,0,&__func_info__d6b5107185f31d8a,[&](TArray<char *> const  & __a_rename_at_37)->void{
+		_Func_0x60_expect1_8e8d2360c4eee0dd(__context__,__a_rename_at_37);
+	}));
+	_Funcstrings_boost_0x60_split_41c9a8111d4edaec(__context__,((char *) "one,two"),((char *) ","),das_make_block<void,TArray<char *> const  &>(__context__,208,0,&__func_info__d6b5107185f31d8a,[&](TArray<char *> const  & __a_rename_at_39)->void{
+		_Func_0x60_expect2_d6b1e65a145a4a40(__context__,__a_rename_at_39);
+	}));
+	_Funcstrings_boost_0x60_split_41c9a8111d4edaec(__context__,((char *) "one, two, three"),((char *) ", "),das_make_block<void,TArray<char *> const  &>(__context__,272,0,&__func_info__d6b5107185f31d8a,[&](TArray<char *> const  & __a_rename_at_41)->void{
+		_Func_0x60_expect3_5e3964d31f419c74(__context__,__a_rename_at_41);
+	}));
+	_Funcstrings_boost_0x60_split_41c9a8111d4edaec(__context__,((char *) "one"),nullptr,das_make_block<void,TArray<char *> const  &>(__context__,336,0,&__func_info__d6b5107185f31d8a,[&](TArray<char *> const  & __a_rename_at_43)->void{
+		_Func_0x60_expect3o_6d60e8abb9eea642(__context__,__a_rename_at_43);
+	}));
+	_Func_0x60_expect0_1f783b3e80e5c512(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_45_352 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 14417986169660246949u)),nullptr,nullptr)))));
+	_Func_0x60_expect0_1f783b3e80e5c512(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_46_384 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 14417986169660246949u)),nullptr,((char *) "."))))));
+	_Func_0x60_expect1_f80cc04efd928d7a(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_47_416 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 14417986169660246949u)),((char *) "one"),((char *) ","))))));
+	_Func_0x60_expect2_8bcf8ecd168e6de3(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_48_448 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 14417986169660246949u)),((char *) "one,two"),((char *) ","))))));
+	_Func_0x60_expect3_e7655c89fc0d1293(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_49_480 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 14417986169660246949u)),((char *) "one-->two-->three"),((char *) "-->"))))));
+	_Func_0x60_expect3o_eeedb11211ee3381(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_50_512 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 14417986169660246949u)),((char *) "one"),nullptr)))));
+	TArray<char *> __es_rename_at_53_ConstRef; das_zero(__es_rename_at_53_ConstRef); das_move(__es_rename_at_53_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 14417986169660246949u)),nullptr,((char *) "/"))));
+	TArray<char *> const  & __es_rename_at_53 = __es_rename_at_53_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__es_rename_at_53) == 1));
+	TArray<char *> __ese_rename_at_55_ConstRef; das_zero(__ese_rename_at_55_ConstRef); das_move(__ese_rename_at_55_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 14417986169660246949u)),nullptr,nullptr)));
+	TArray<char *> const  & __ese_rename_at_55 = __ese_rename_at_55_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__ese_rename_at_55) == 1));
+	TArray<char *> __e0_rename_at_58_ConstRef; das_zero(__e0_rename_at_58_ConstRef); das_move(__e0_rename_at_58_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 14417986169660246949u)),((char *) "/"),((char *) "/"))));
+	TArray<char *> const  & __e0_rename_at_58 = __e0_rename_at_58_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__e0_rename_at_58) == 2));
+	DAS_ASSERT(((SimPolicy<char *>::Equ(cast<char *>::from(__e0_rename_at_58(0,__context__)),cast<char *>::from(nullptr),*__context__,nullptr)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e0_rename_at_58(1,__context__)),cast<char *>::from(nullptr),*__context__,nullptr))));
+	TArray<char *> __e1_rename_at_62_ConstRef; das_zero(__e1_rename_at_62_ConstRef); das_move(__e1_rename_at_62_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 14417986169660246949u)),((char *) "/1"),((char *) "/"))));
+	TArray<char *> const  & __e1_rename_at_62 = __e1_rename_at_62_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__e1_rename_at_62) == 2));
+	DAS_ASSERT(((SimPolicy<char *>::Equ(cast<char *>::from(__e1_rename_at_62(0,__context__)),cast<char *>::from(nullptr),*__context__,nullptr)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e1_rename_at_62(1,__context__)),cast<char *>::from(((char *) "1")),*__context__,nullptr))));
+	TArray<char *> __e2_rename_at_66_ConstRef; das_zero(__e2_rename_at_66_ConstRef); das_move(__e2_rename_at_66_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 14417986169660246949u)),((char *) "1/"),((char *) "/"))));
+	TArray<char *> const  & __e2_rename_at_66 = __e2_rename_at_66_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__e2_rename_at_66) == 2));
+	DAS_ASSERT(((SimPolicy<char *>::Equ(cast<char *>::from(__e2_rename_at_66(0,__context__)),cast<char *>::from(((char *) "1")),*__context__,nullptr)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e2_rename_at_66(1,__context__)),cast<char *>::from(nullptr),*__context__,nullptr))));
+	TArray<char *> __e3_rename_at_70_ConstRef; das_zero(__e3_rename_at_70_ConstRef); das_move(__e3_rename_at_70_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 14417986169660246949u)),((char *) "1/2/3"),((char *) "/"))));
+	TArray<char *> const  & __e3_rename_at_70 = __e3_rename_at_70_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__e3_rename_at_70) == 3));
+	DAS_ASSERT((((SimPolicy<char *>::Equ(cast<char *>::from(__e3_rename_at_70(0,__context__)),cast<char *>::from(((char *) "1")),*__context__,nullptr)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e3_rename_at_70(1,__context__)),cast<char *>::from(((char *) "2")),*__context__,nullptr))) && (SimPolicy<char *>::Equ(cast<char *>::from(__e3_rename_at_70(2,__context__)),cast<char *>::from(((char *) "3")),*__context__,nullptr))));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_expect0_842d2b380121b6bb
+	aotLib[0x695a0dbbf1239435] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect0_842d2b380121b6bb>>();
+	};
+	// _Func_0x60_expect1_8e8d2360c4eee0dd
+	aotLib[0xe201aebdab05fb19] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect1_8e8d2360c4eee0dd>>();
+	};
+	// _Func_0x60_expect2_d6b1e65a145a4a40
+	aotLib[0x680a8be27ee7ce51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect2_d6b1e65a145a4a40>>();
+	};
+	// _Func_0x60_expect3_5e3964d31f419c74
+	aotLib[0x7704e066f35f8375] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect3_5e3964d31f419c74>>();
+	};
+	// _Func_0x60_expect3o_6d60e8abb9eea642
+	aotLib[0xe5672137574dbb79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect3o_6d60e8abb9eea642>>();
+	};
+	// _Funcstrings_boost_0x60_split_41c9a8111d4edaec
+	aotLib[0xc6e736896923aed5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , char * const  , Block DAS_COMMENT((void,TArray<char *> const )) const  &  ),&_Funcstrings_boost_0x60_split_41c9a8111d4edaec>>();
+	};
+	// _Func_0x60_expect0_1f783b3e80e5c512
+	aotLib[0xe23714064a50a5a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect0_1f783b3e80e5c512>>();
+	};
+	// _Func_0x60_expect1_f80cc04efd928d7a
+	aotLib[0x96a9212aa978f975] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect1_f80cc04efd928d7a>>();
+	};
+	// _Func_0x60_expect2_8bcf8ecd168e6de3
+	aotLib[0x7b9b4d6c99dc5181] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect2_8bcf8ecd168e6de3>>();
+	};
+	// _Func_0x60_expect3_e7655c89fc0d1293
+	aotLib[0x489f91bb1e568fa9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect3_e7655c89fc0d1293>>();
+	};
+	// _Func_0x60_expect3o_eeedb11211ee3381
+	aotLib[0x40d30cc227c193b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect3o_eeedb11211ee3381>>();
+	};
+	// test_49d4e7b50f1e6783
+	aotLib[0x538c1d6a4f68b6f8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_49d4e7b50f1e6783>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,303 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5612869886674048504 {
+
+extern TypeInfo __type_info__90f5707b5a6f641;
+
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_1[1] = { &__type_info__90f5707b5a6f641 };
+
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_406 );
+inline void _Funcbuiltin_0x60_finalize_bb3702af962b623e ( Context * __context__, TTable<char *,int32_t> & __a_rename_at_406 );
+inline bool _Funcbuiltin_0x60_key_exists_164817c6d7890150 ( Context * __context__, TTable<int32_t,int32_t> const  & __Tab_rename_at_306, int32_t __at_rename_at_306 );
+inline bool _Funcbuiltin_0x60_erase_b20b0382d59ae57c ( Context * __context__, TTable<int32_t,int32_t> & __Tab_rename_at_298, int32_t __at_rename_at_298 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_5166a0dac2826af2 ( Context * __context__, TTable<int32_t,int32_t> const  & __a_rename_at_370 );
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_values_39215c1b9fef5b0e ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_386 );
+inline bool _Funcbuiltin_0x60_erase_61b4ed4bc61116da ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_298, char * const  __at_rename_at_298 );
+inline bool _Funcbuiltin_0x60_key_exists_65edeaae187fe7ac ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_306, char * const  __at_rename_at_306 );
+inline bool test_d1920a4f4df16186 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_406 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_406),4,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_bb3702af962b623e ( Context * __context__, TTable<char *,int32_t> &  __a_rename_at_406 )
+{
+	builtin_table_free(das_arg<TTable<char *,int32_t>>::pass(__a_rename_at_406),8,4,__context__);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_164817c6d7890150 ( Context * __context__, TTable<int32_t,int32_t> const  &  __Tab_rename_at_306, int32_t __at_rename_at_306 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_306,__at_rename_at_306));
+}
+
+inline bool _Funcbuiltin_0x60_erase_b20b0382d59ae57c ( Context * __context__, TTable<int32_t,int32_t> &  __Tab_rename_at_298, int32_t __at_rename_at_298 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_298,__at_rename_at_298));
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_5166a0dac2826af2 ( Context * __context__, TTable<int32_t,int32_t> const  &  __a_rename_at_370 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_371; das_zero(__it_rename_at_371);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_371),__a_rename_at_370,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t const  &))>::cast(__it_rename_at_371);
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_values_39215c1b9fef5b0e ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_386 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_387; das_zero(__it_rename_at_387);
+	builtin_table_values(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_387),das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_386),4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t &))>::cast(__it_rename_at_387);
+}
+
+inline bool _Funcbuiltin_0x60_erase_61b4ed4bc61116da ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_298, char * const  __at_rename_at_298 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_298,__at_rename_at_298));
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_65edeaae187fe7ac ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_306, char * const  __at_rename_at_306 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_306,__at_rename_at_306));
+}
+
+inline bool test_d1920a4f4df16186 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_24_176;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_24_192;
+	TTable<int32_t,int32_t> __tab_rename_at_5; das_zero(__tab_rename_at_5);
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10000));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			das_copy(__tab_rename_at_5(__i_rename_at_7,__context__),__i_rename_at_7 * 2);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_5)) == 10000));
+	{
+		bool __need_loop_10 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10000));
+		int32_t __i_rename_at_10;
+		__need_loop_10 = __i_iterator.first(__context__,(__i_rename_at_10)) && __need_loop_10;
+		for ( ; __need_loop_10 ; __need_loop_10 = __i_iterator.next(__context__,(__i_rename_at_10)) )
+		{
+			DAS_VERIFY((__tab_rename_at_5(__i_rename_at_10,__context__) == (__i_rename_at_10 * 2)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_10));
+	};
+	DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_164817c6d7890150(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_5),10000)));
+	{
+		bool __need_loop_14 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,3334));
+		int32_t __i_rename_at_14;
+		__need_loop_14 = __i_iterator.first(__context__,(__i_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __i_iterator.next(__context__,(__i_rename_at_14)) )
+		{
+			DAS_VERIFY((_Funcbuiltin_0x60_erase_b20b0382d59ae57c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_5),__i_rename_at_14 * 3)));
+			DAS_VERIFY((!_Funcbuiltin_0x60_erase_b20b0382d59ae57c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_5),__i_rename_at_14 * 3)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_14));
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_5)) == 6666));
+	{
+		bool __need_loop_18 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10000));
+		int32_t __i_rename_at_18;
+		__need_loop_18 = __i_iterator.first(__context__,(__i_rename_at_18)) && __need_loop_18;
+		for ( ; __need_loop_18 ; __need_loop_18 = __i_iterator.next(__context__,(__i_rename_at_18)) )
+		{
+			DAS_ASSERT((_Funcbuiltin_0x60_key_exists_164817c6d7890150(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_5),__i_rename_at_18) == ((SimPolicy<int32_t>::Mod(__i_rename_at_18,3,*__context__,nullptr)) != 0)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_18));
+	};
+	{
+		bool __need_loop_20 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,3334));
+		int32_t __i_rename_at_20;
+		__need_loop_20 = __i_iterator.first(__context__,(__i_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __i_iterator.next(__context__,(__i_rename_at_20)) )
+		{
+			das_copy(__tab_rename_at_5((__i_rename_at_20 * 3),__context__),-__i_rename_at_20 * 3);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_20));
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_5)) == 10000));
+	int32_t __summ_rename_at_23 = 0;
+	{
+		bool __need_loop_24 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_24_176 = (_Funcbuiltin_0x60_keys_5166a0dac2826af2(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_5)))));
+		int32_t const  * __k_rename_at_24;
+		__need_loop_24 = __k_iterator.first(__context__,(__k_rename_at_24)) && __need_loop_24;
+		// v : int&
+		das_iterator<Sequence DAS_COMMENT((int32_t))> __v_iterator((_temp_make_local_24_192 = (_Funcbuiltin_0x60_values_39215c1b9fef5b0e(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_5)))));
+		int32_t * __v_rename_at_24;
+		__need_loop_24 = __v_iterator.first(__context__,(__v_rename_at_24)) && __need_loop_24;
+		for ( ; __need_loop_24 ; __need_loop_24 = __k_iterator.next(__context__,(__k_rename_at_24)) && __v_iterator.next(__context__,(__v_rename_at_24)) )
+		{
+			__summ_rename_at_23 += (((SimPolicy<int32_t>::Mod((*__k_rename_at_24),3,*__context__,nullptr)) == 0) ? das_auto_cast<int32_t>::cast(-(*__v_rename_at_24)) : das_auto_cast<int32_t>::cast((SimPolicy<int32_t>::Div((*__v_rename_at_24),2,*__context__,nullptr))));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_24));
+		__v_iterator.close(__context__,(__v_rename_at_24));
+	};
+	DAS_ASSERT((__summ_rename_at_23 == 49995000));
+	{
+		bool __need_loop_28 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10000));
+		int32_t __i_rename_at_28;
+		__need_loop_28 = __i_iterator.first(__context__,(__i_rename_at_28)) && __need_loop_28;
+		for ( ; __need_loop_28 ; __need_loop_28 = __i_iterator.next(__context__,(__i_rename_at_28)) )
+		{
+			DAS_VERIFY((_Funcbuiltin_0x60_erase_b20b0382d59ae57c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_5),__i_rename_at_28)));
+			das_copy(__tab_rename_at_5((__i_rename_at_28 + 10000),__context__),__i_rename_at_28);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_28));
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_5)) == 10000));
+	builtin_table_clear(das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_5),__context__);
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_5)) == 0));
+	DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_164817c6d7890150(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_5),10000)));
+	das_copy(__tab_rename_at_5(1,__context__),1);
+	DAS_VERIFY((__tab_rename_at_5(1,__context__) == 1));
+	TTable<char *,int32_t> __stab_rename_at_38; das_zero(__stab_rename_at_38);
+	{
+		bool __need_loop_39 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000));
+		int32_t __i_rename_at_39;
+		__need_loop_39 = __i_iterator.first(__context__,(__i_rename_at_39)) && __need_loop_39;
+		for ( ; __need_loop_39 ; __need_loop_39 = __i_iterator.next(__context__,(__i_rename_at_39)) )
+		{
+			das_copy(__stab_rename_at_38(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<int32_t>::from(__i_rename_at_39))),__context__),__i_rename_at_39);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_39));
+	};
+	{
+		bool __need_loop_41 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000));
+		int32_t __i_rename_at_41;
+		__need_loop_41 = __i_iterator.first(__context__,(__i_rename_at_41)) && __need_loop_41;
+		for ( ; __need_loop_41 ; __need_loop_41 = __i_iterator.next(__context__,(__i_rename_at_41)) )
+		{
+			DAS_VERIFY((__stab_rename_at_38(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<int32_t>::from(__i_rename_at_41))),__context__) == __i_rename_at_41));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_41));
+	};
+	DAS_VERIFY((_Funcbuiltin_0x60_erase_61b4ed4bc61116da(__context__,das_arg<TTable<char *,int32_t>>::pass(__stab_rename_at_38),((char *) "500"))));
+	DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_65edeaae187fe7ac(__context__,das_arg<TTable<char *,int32_t>>::pass(__stab_rename_at_38),((char *) "500"))));
+	_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_5));
+	_Funcbuiltin_0x60_finalize_bb3702af962b623e(__context__,das_arg<TTable<char *,int32_t>>::pass(__stab_rename_at_38));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c
+	aotLib[0x8773319e89d22a5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c>>();
+	};
+	// _Funcbuiltin_0x60_finalize_bb3702af962b623e
+	aotLib[0x47ccc641525eada1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> &  ),&_Funcbuiltin_0x60_finalize_bb3702af962b623e>>();
+	};
+	// _Funcbuiltin_0x60_key_exists_164817c6d7890150
+	aotLib[0xc7c11e5244a2f1c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,int32_t> const  & , int32_t  ),&_Funcbuiltin_0x60_key_exists_164817c6d7890150>>();
+	};
+	// _Funcbuiltin_0x60_erase_b20b0382d59ae57c
+	aotLib[0xaa9de85420b74e25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,int32_t> & , int32_t  ),&_Funcbuiltin_0x60_erase_b20b0382d59ae57c>>();
+	};
+	// _Funcbuiltin_0x60_keys_5166a0dac2826af2
+	aotLib[0xaaa714fe0ea502d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TTable<int32_t,int32_t> const  &  ),&_Funcbuiltin_0x60_keys_5166a0dac2826af2>>();
+	};
+	// _Funcbuiltin_0x60_values_39215c1b9fef5b0e
+	aotLib[0x2ef898168cd973c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t &)) (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&_Funcbuiltin_0x60_values_39215c1b9fef5b0e>>();
+	};
+	// _Funcbuiltin_0x60_erase_61b4ed4bc61116da
+	aotLib[0x3cb88775d3e4742d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,int32_t> & , char * const   ),&_Funcbuiltin_0x60_erase_61b4ed4bc61116da>>();
+	};
+	// _Funcbuiltin_0x60_key_exists_65edeaae187fe7ac
+	aotLib[0x9c0d8b0eceeeb3dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,int32_t> const  & , char * const   ),&_Funcbuiltin_0x60_key_exists_65edeaae187fe7ac>>();
+	};
+	// test_d1920a4f4df16186
+	aotLib[0xd6e515899db56cf0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_d1920a4f4df16186>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
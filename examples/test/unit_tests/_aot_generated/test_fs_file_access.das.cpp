@@ -0,0 +1,151 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14693755433083125244 {
+
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__964115ac42702fc2;
+extern TypeInfo __type_info__c30d245c044acb90;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__3e2f23f73e184639;
+extern VarInfo __var_info__332dc2b4840e0aed;
+extern VarInfo __var_info__88e297f0a346b22;
+extern FuncInfo __func_info__76b035d7b7fa4115;
+
+VarInfo __func_info__76b035d7b7fa4115_field_0 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x332dc2b4840e0aed), "ok", 0 };
+VarInfo __func_info__76b035d7b7fa4115_field_1 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__964115ac42702fc2, nullptr, nullptr, nullptr, 0, 0, nullptr, 11264, 8, UINT64_C(0x3e2f23f73e184639), "program", 0 };
+VarInfo __func_info__76b035d7b7fa4115_field_2 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 32, UINT64_C(0x88e297f0a346b22), "issues", 0 };
+VarInfo * __func_info__76b035d7b7fa4115_fields[3] =  { &__func_info__76b035d7b7fa4115_field_0, &__func_info__76b035d7b7fa4115_field_1, &__func_info__76b035d7b7fa4115_field_2 };
+FuncInfo __func_info__76b035d7b7fa4115 = {"invoke block<(ok:bool;program:smart_ptr<rtti::Program>;issues:$::das_string const):void> const", "", __func_info__76b035d7b7fa4115_fields, 3, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x76b035d7b7fa4115), 0x0 };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__964115ac42702fc2 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8194, 368, UINT64_C(0x964115ac42702fc2) };
+TypeInfo __type_info__c30d245c044acb90 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 32, UINT64_C(0xc30d245c044acb90) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__964115ac42702fc2.resolveAnnotation();
+	__type_info__c30d245c044acb90.resolveAnnotation();
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_1[2] = { &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_2[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__c30d245c044acb90, &__type_info__90f3d07b5a6ca13 };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+
+inline void clone_6c9aff965b7e5920 ( Context * __context__, smart_ptr<FileAccess> & __dest_rename_at_328, smart_ptr<FileAccess> const  __src_rename_at_328 );
+inline smart_ptr<FileAccess> _Funcbuiltin_0x60_clone_to_move_25d5b61c36e3d1a3 ( Context * __context__, smart_ptr<FileAccess> const  __clone_src_rename_at_325 );
+inline bool test_19b1977eed032e80 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void clone_6c9aff965b7e5920 ( Context * __context__, smart_ptr<FileAccess> & __dest_rename_at_328, smart_ptr<FileAccess> const  __src_rename_at_328 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_328),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_328));
+}
+
+inline smart_ptr<FileAccess> _Funcbuiltin_0x60_clone_to_move_25d5b61c36e3d1a3 ( Context * __context__, smart_ptr<FileAccess> const  __clone_src_rename_at_325 )
+{
+	smart_ptr<FileAccess> __clone_dest_rename_at_327; das_zero(__clone_dest_rename_at_327);
+	clone_6c9aff965b7e5920(__context__,__clone_dest_rename_at_327,__clone_src_rename_at_325);
+	return /* <- */ das_auto_cast_move<smart_ptr<FileAccess>>::cast(__clone_dest_rename_at_327);
+}
+
+inline bool test_19b1977eed032e80 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,256,"test " DAS_FILE_LINE);
+{
+	char * __appfile_rename_at_5 = ((char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char *>::from(((char *)(builtin_das_root(__context__)))), cast<char * const >::from(((char *) "/examples/test/hidden_test/_hidden_test.das"))))));
+	smart_ptr<FileAccess> __access_rename_at_6; das_zero(__access_rename_at_6); das_move(__access_rename_at_6, _Funcbuiltin_0x60_clone_to_move_25d5b61c36e3d1a3(__context__,makeFileAccess(nullptr,__context__)));
+	rtti_add_file_access_root(__access_rename_at_6,((char *) "hidden"),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<char *>::from(((char *)(builtin_das_root(__context__)))), cast<char * const >::from(((char *) "/examples/test/hidden_module")))));
+	das_using<ModuleGroup>::use([&](ModuleGroup & __mg_rename_at_8)->void{
+		das_using<CodeOfPolicies>::use([&](CodeOfPolicies & __cop_rename_at_9)->void{
+			rtti_builtin_compile_file(__appfile_rename_at_5,__access_rename_at_6,das_ref(__context__,__mg_rename_at_8),das_arg<CodeOfPolicies>::pass(__cop_rename_at_9),das_make_block<void,bool,smart_ptr<Program>,das::string const  &>(__context__,240,0,&__func_info__76b035d7b7fa4115,[&](bool __ok_rename_at_10, smart_ptr<Program> __program_rename_at_10, das::string const  & __issues_rename_at_10)->void{
+				if ( __ok_rename_at_10 )
+				{
+					builtin_print(((char *) "ok"),__context__);
+				} else {
+					builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_2, cast<char * const >::from(((char *) "failed to compile\n")), cast<das::string const  &>::from(__issues_rename_at_10), cast<char * const >::from(((char *) "n")))),__context__);
+					DAS_ASSERT((false));
+				};
+			}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		});
+	});
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// clone_6c9aff965b7e5920
+	aotLib[0xa005ead4ad732529] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr<FileAccess> & , smart_ptr<FileAccess> const   ),&clone_6c9aff965b7e5920>>();
+	};
+	// _Funcbuiltin_0x60_clone_to_move_25d5b61c36e3d1a3
+	aotLib[0x5cb4ffa232a3b6cc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr<FileAccess> (*) ( Context * __context__, smart_ptr<FileAccess> const   ),&_Funcbuiltin_0x60_clone_to_move_25d5b61c36e3d1a3>>();
+	};
+	// test_19b1977eed032e80
+	aotLib[0xd7b8cc91d07a36d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_19b1977eed032e80>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,1592 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require jobque
+#include "daScript/simulate/aot_builtin_jobque.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+ // require templates
+ // require contracts
+ // require array_boost
+ // require algorithm
+ // require templates_boost
+ // require macro_boost
+ // require jobque_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3051613471692060290 {
+
+extern StructInfo __struct_info__e5095599a587ca50;
+extern StructInfo __struct_info__215ac6f59bf1c00d;
+extern StructInfo __struct_info__55aa23c241c676f1;
+extern StructInfo __struct_info__bf207a416667fe8a;
+extern StructInfo __struct_info__ca4515729b117c78;
+extern StructInfo __struct_info__eab53f12449e6b91;
+extern StructInfo __struct_info__7dee57cc255ef0de;
+extern TypeInfo __type_info__89f87fddfa254636;
+extern TypeInfo __type_info__a7244f77d75ea149;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__90f4c07b5a6e390;
+extern TypeInfo __type_info__6c10b6e9d0f66c00;
+extern TypeInfo __type_info__afb37e4eb4f402d9;
+extern TypeInfo __type_info__2f707f193f39acb0;
+extern TypeInfo __type_info__861e83a6e8367623;
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__9f2b89ea82b475bc;
+extern TypeInfo __type_info__96578ef8b03fa52f;
+extern TypeInfo __type_info__1c30fa709c8510cc;
+extern TypeInfo __type_info__7000e4b70a9e5461;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__f06023ece159b613;
+extern TypeInfo __type_info__9e797c29621111fd;
+extern TypeInfo __type_info__2f8f0e5ea918b191;
+extern TypeInfo __type_info__2fd4cf229b743e84;
+extern TypeInfo __type_info__521213b6cb688390;
+extern TypeInfo __type_info__5c1f7d5b510c9117;
+extern TypeInfo __type_info__f2ba75a8774162e8;
+extern TypeInfo __type_info__fe24a2dd43758fc9;
+extern TypeInfo __type_info__f468413453aeca48;
+extern TypeInfo __type_info__3ceb21b1e6727087;
+extern VarInfo __var_info__1b62a108764d7f42;
+extern VarInfo __var_info__c259bd834504133d;
+extern VarInfo __var_info__a4423fc370431a5a;
+extern VarInfo __var_info__3302abc5aa1e4476;
+extern VarInfo __var_info__f9e93c5065ad75b2;
+extern VarInfo __var_info__ed408fd07bade1c0;
+extern VarInfo __var_info__fc3c071aefba863c;
+extern VarInfo __var_info__6474f7fc68385a36;
+extern VarInfo __var_info__2223c9bc698fd68f;
+extern VarInfo __var_info__996b1cb2a31043fc;
+extern VarInfo __var_info__9155f8569810f110;
+extern VarInfo __var_info__a44240c370431c0d;
+extern VarInfo __var_info__46f2be9296cbc296;
+extern VarInfo __var_info__215124c471215727;
+extern VarInfo __var_info__222f26ffb92616a3;
+extern VarInfo __var_info__886f08acbc0ef35a;
+extern VarInfo __var_info__c87b4f018e48c0c3;
+extern VarInfo __var_info__e33909ae75ed6bd1;
+extern VarInfo __var_info__f2c85919facde528;
+extern VarInfo __var_info__793d9663bdd9f06f;
+extern VarInfo __var_info__42c98376cd8f791a;
+extern VarInfo __var_info__18aab86bb3264c3a;
+extern VarInfo __var_info__b6d93cbfdce11edb;
+extern VarInfo __var_info__29523ae127cc747a;
+extern VarInfo __var_info__3c94f6abfb43980;
+extern VarInfo __var_info__917f9f341dbcf8be;
+extern VarInfo __var_info__81554ee824d08a77;
+extern VarInfo __var_info__4e7316e0f9fe3e02;
+extern VarInfo __var_info__4e889e4b32b76d24;
+extern VarInfo __var_info__ed409bd07badf624;
+extern VarInfo __var_info__c42039855ecaeed;
+extern VarInfo __var_info__c68ce48f6c3a8ae9;
+extern VarInfo __var_info__76339a868e5aa8a9;
+extern VarInfo __var_info__29fa4dc47608ca7c;
+extern VarInfo __var_info__e99090596b88104f;
+extern FuncInfo __func_info__cfb81a8365a0ae64;
+extern FuncInfo __func_info__3b3f908fa21851e2;
+extern FuncInfo __func_info__e3ccd7343d92b33;
+extern FuncInfo __func_info__27bbd6f96acc8444;
+extern FuncInfo __func_info__bdb5fc9c51b78a78;
+extern FuncInfo __func_info__3ad0a31d00c9d958;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+VarInfo __struct_info__e5095599a587ca50_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xed409bd07badf624), "x", 0 };
+VarInfo __struct_info__e5095599a587ca50_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xed408fd07bade1c0), "t", 4 };
+VarInfo * __struct_info__e5095599a587ca50_fields[2] =  { &__struct_info__e5095599a587ca50_field_0, &__struct_info__e5095599a587ca50_field_1 };
+StructInfo __struct_info__e5095599a587ca50 = {"Work", "", 0, __struct_info__e5095599a587ca50_fields, 2, 8, UINT64_C(0x0), nullptr, UINT64_C(0xe5095599a587ca50) };
+TypeInfo * __type_info__6474f7fc68385a36_arg_types_var_2403452109341179917[2] = { &__type_info__f2ba75a8774162e8, &__type_info__a7244f77d75ea149 };
+VarInfo __struct_info__215ac6f59bf1c00d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__6474f7fc68385a36_arg_types_var_2403452109341179917, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x6474f7fc68385a36), "__lambda", 0 };
+TypeInfo * __type_info__c87b4f018e48c0c3_arg_types_var_2403452109341179917[1] = { &__type_info__f468413453aeca48 };
+VarInfo __struct_info__215ac6f59bf1c00d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__c87b4f018e48c0c3_arg_types_var_2403452109341179917, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xc87b4f018e48c0c3), "__finalize", 8 };
+VarInfo __struct_info__215ac6f59bf1c00d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x1b62a108764d7f42), "__yield", 16 };
+VarInfo __struct_info__215ac6f59bf1c00d_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__89f87fddfa254636, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x4e7316e0f9fe3e02), "channel", 24 };
+VarInfo __struct_info__215ac6f59bf1c00d_field_4 =  { Type::tPointer, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x4e889e4b32b76d24), "__void_data_rename_at_99", 32 };
+VarInfo * __struct_info__215ac6f59bf1c00d_fields[5] =  { &__struct_info__215ac6f59bf1c00d_field_0, &__struct_info__215ac6f59bf1c00d_field_1, &__struct_info__215ac6f59bf1c00d_field_2, &__struct_info__215ac6f59bf1c00d_field_3, &__struct_info__215ac6f59bf1c00d_field_4 };
+StructInfo __struct_info__215ac6f59bf1c00d = {"_lambda_thismodule_98_12_6", "", 6, __struct_info__215ac6f59bf1c00d_fields, 5, 40, UINT64_C(0x0), nullptr, UINT64_C(0x215ac6f59bf1c00d) };
+TypeInfo * __type_info__886f08acbc0ef35a_arg_types_var_6172785556498839281[1] = { &__type_info__2fd4cf229b743e84 };
+VarInfo __struct_info__55aa23c241c676f1_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__886f08acbc0ef35a_arg_types_var_6172785556498839281, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x886f08acbc0ef35a), "__lambda", 0 };
+TypeInfo * __type_info__e99090596b88104f_arg_types_var_6172785556498839281[1] = { &__type_info__1c30fa709c8510cc };
+VarInfo __struct_info__55aa23c241c676f1_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__e99090596b88104f_arg_types_var_6172785556498839281, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xe99090596b88104f), "__finalize", 8 };
+VarInfo __struct_info__55aa23c241c676f1_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__96578ef8b03fa52f, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x3302abc5aa1e4476), "channel", 16 };
+VarInfo __struct_info__55aa23c241c676f1_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xc42039855ecaeed), "x", 24 };
+VarInfo * __struct_info__55aa23c241c676f1_fields[4] =  { &__struct_info__55aa23c241c676f1_field_0, &__struct_info__55aa23c241c676f1_field_1, &__struct_info__55aa23c241c676f1_field_2, &__struct_info__55aa23c241c676f1_field_3 };
+StructInfo __struct_info__55aa23c241c676f1 = {"_lambda_thismodule_53_20_4", "", 6, __struct_info__55aa23c241c676f1_fields, 4, 32, UINT64_C(0x0), nullptr, UINT64_C(0x55aa23c241c676f1) };
+TypeInfo * __type_info__81554ee824d08a77_arg_types_var_13772142081808531082[1] = { &__type_info__7000e4b70a9e5461 };
+VarInfo __struct_info__bf207a416667fe8a_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__81554ee824d08a77_arg_types_var_13772142081808531082, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x81554ee824d08a77), "__lambda", 0 };
+TypeInfo * __type_info__917f9f341dbcf8be_arg_types_var_13772142081808531082[1] = { &__type_info__9e797c29621111fd };
+VarInfo __struct_info__bf207a416667fe8a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__917f9f341dbcf8be_arg_types_var_13772142081808531082, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x917f9f341dbcf8be), "__finalize", 8 };
+VarInfo __struct_info__bf207a416667fe8a_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f707f193f39acb0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x3c94f6abfb43980), "status", 16 };
+VarInfo __struct_info__bf207a416667fe8a_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf9e93c5065ad75b2), "x", 24 };
+VarInfo * __struct_info__bf207a416667fe8a_fields[4] =  { &__struct_info__bf207a416667fe8a_field_0, &__struct_info__bf207a416667fe8a_field_1, &__struct_info__bf207a416667fe8a_field_2, &__struct_info__bf207a416667fe8a_field_3 };
+StructInfo __struct_info__bf207a416667fe8a = {"_lambda_thismodule_79_20_5", "", 6, __struct_info__bf207a416667fe8a_fields, 4, 32, UINT64_C(0x0), nullptr, UINT64_C(0xbf207a416667fe8a) };
+TypeInfo * __type_info__76339a868e5aa8a9_arg_types_var_14575079351026547832[1] = { &__type_info__f06023ece159b613 };
+VarInfo __struct_info__ca4515729b117c78_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__76339a868e5aa8a9_arg_types_var_14575079351026547832, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x76339a868e5aa8a9), "__lambda", 0 };
+TypeInfo * __type_info__f2c85919facde528_arg_types_var_14575079351026547832[1] = { &__type_info__861e83a6e8367623 };
+VarInfo __struct_info__ca4515729b117c78_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f2c85919facde528_arg_types_var_14575079351026547832, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xf2c85919facde528), "__finalize", 8 };
+VarInfo __struct_info__ca4515729b117c78_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__89f87fddfa254636, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x2223c9bc698fd68f), "channel", 16 };
+VarInfo __struct_info__ca4515729b117c78_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xfc3c071aefba863c), "x", 24 };
+VarInfo * __struct_info__ca4515729b117c78_fields[4] =  { &__struct_info__ca4515729b117c78_field_0, &__struct_info__ca4515729b117c78_field_1, &__struct_info__ca4515729b117c78_field_2, &__struct_info__ca4515729b117c78_field_3 };
+StructInfo __struct_info__ca4515729b117c78 = {"_lambda_thismodule_40_20_3", "", 6, __struct_info__ca4515729b117c78_fields, 4, 32, UINT64_C(0x0), nullptr, UINT64_C(0xca4515729b117c78) };
+TypeInfo * __type_info__29523ae127cc747a_arg_types_var_16912493323352959889[1] = { &__type_info__9f2b89ea82b475bc };
+VarInfo __struct_info__eab53f12449e6b91_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__29523ae127cc747a_arg_types_var_16912493323352959889, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x29523ae127cc747a), "__lambda", 0 };
+TypeInfo * __type_info__793d9663bdd9f06f_arg_types_var_16912493323352959889[1] = { &__type_info__6c10b6e9d0f66c00 };
+VarInfo __struct_info__eab53f12449e6b91_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__793d9663bdd9f06f_arg_types_var_16912493323352959889, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x793d9663bdd9f06f), "__finalize", 8 };
+VarInfo __struct_info__eab53f12449e6b91_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f707f193f39acb0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xe33909ae75ed6bd1), "status", 16 };
+VarInfo __struct_info__eab53f12449e6b91_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa44240c370431c0d), "x", 24 };
+VarInfo __struct_info__eab53f12449e6b91_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xa4423fc370431a5a), "y", 32 };
+VarInfo * __struct_info__eab53f12449e6b91_fields[5] =  { &__struct_info__eab53f12449e6b91_field_0, &__struct_info__eab53f12449e6b91_field_1, &__struct_info__eab53f12449e6b91_field_2, &__struct_info__eab53f12449e6b91_field_3, &__struct_info__eab53f12449e6b91_field_4 };
+StructInfo __struct_info__eab53f12449e6b91 = {"_lambda_thismodule_18_20_1", "", 22, __struct_info__eab53f12449e6b91_fields, 5, 56, UINT64_C(0x0), nullptr, UINT64_C(0xeab53f12449e6b91) };
+TypeInfo * __type_info__b6d93cbfdce11edb_arg_types_var_9074286833510052062[1] = { &__type_info__2f8f0e5ea918b191 };
+VarInfo __struct_info__7dee57cc255ef0de_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__b6d93cbfdce11edb_arg_types_var_9074286833510052062, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xb6d93cbfdce11edb), "__lambda", 0 };
+TypeInfo * __type_info__42c98376cd8f791a_arg_types_var_9074286833510052062[1] = { &__type_info__afb37e4eb4f402d9 };
+VarInfo __struct_info__7dee57cc255ef0de_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__42c98376cd8f791a_arg_types_var_9074286833510052062, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x42c98376cd8f791a), "__finalize", 8 };
+VarInfo __struct_info__7dee57cc255ef0de_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__89f87fddfa254636, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xc259bd834504133d), "channel", 16 };
+VarInfo __struct_info__7dee57cc255ef0de_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x46f2be9296cbc296), "x", 24 };
+VarInfo * __struct_info__7dee57cc255ef0de_fields[4] =  { &__struct_info__7dee57cc255ef0de_field_0, &__struct_info__7dee57cc255ef0de_field_1, &__struct_info__7dee57cc255ef0de_field_2, &__struct_info__7dee57cc255ef0de_field_3 };
+StructInfo __struct_info__7dee57cc255ef0de = {"_lambda_thismodule_27_20_2", "", 6, __struct_info__7dee57cc255ef0de_fields, 4, 32, UINT64_C(0x0), nullptr, UINT64_C(0x7dee57cc255ef0de) };
+VarInfo __func_info__cfb81a8365a0ae64_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__89f87fddfa254636, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xc68ce48f6c3a8ae9), "channel", 0 };
+VarInfo * __func_info__cfb81a8365a0ae64_fields[1] =  { &__func_info__cfb81a8365a0ae64_field_0 };
+FuncInfo __func_info__cfb81a8365a0ae64 = {"invoke block<(channel:jobque::Channel?):void> const", "", __func_info__cfb81a8365a0ae64_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xcfb81a8365a0ae64), 0x0 };
+VarInfo __func_info__3b3f908fa21851e2_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x222f26ffb92616a3), "v", 0 };
+VarInfo * __func_info__3b3f908fa21851e2_fields[1] =  { &__func_info__3b3f908fa21851e2_field_0 };
+FuncInfo __func_info__3b3f908fa21851e2 = {"invoke block<(v:int const):float> const", "", __func_info__3b3f908fa21851e2_fields, 1, 32, &__type_info__af63db4c8601ead9, nullptr,0,UINT64_C(0x3b3f908fa21851e2), 0x0 };
+VarInfo __func_info__e3ccd7343d92b33_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f707f193f39acb0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x18aab86bb3264c3a), "status", 0 };
+VarInfo * __func_info__e3ccd7343d92b33_fields[1] =  { &__func_info__e3ccd7343d92b33_field_0 };
+FuncInfo __func_info__e3ccd7343d92b33 = {"invoke block<(status:jobque::JobStatus?):void> const", "", __func_info__e3ccd7343d92b33_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xe3ccd7343d92b33), 0x0 };
+VarInfo __func_info__27bbd6f96acc8444_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x215124c471215727), "i0", 0 };
+VarInfo __func_info__27bbd6f96acc8444_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x29fa4dc47608ca7c), "i1", 0 };
+VarInfo * __func_info__27bbd6f96acc8444_fields[2] =  { &__func_info__27bbd6f96acc8444_field_0, &__func_info__27bbd6f96acc8444_field_1 };
+FuncInfo __func_info__27bbd6f96acc8444 = {"invoke block<(i0:int;i1:int):void> const", "", __func_info__27bbd6f96acc8444_fields, 2, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x27bbd6f96acc8444), 0x0 };
+VarInfo __func_info__bdb5fc9c51b78a78_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__96578ef8b03fa52f, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x9155f8569810f110), "channel", 0 };
+VarInfo * __func_info__bdb5fc9c51b78a78_fields[1] =  { &__func_info__bdb5fc9c51b78a78_field_0 };
+FuncInfo __func_info__bdb5fc9c51b78a78 = {"invoke block<(channel:jobque::LockFreeChannel?):void> const", "", __func_info__bdb5fc9c51b78a78_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xbdb5fc9c51b78a78), 0x0 };
+VarInfo __func_info__3ad0a31d00c9d958_field_0 =  { Type::tStructure, &__struct_info__e5095599a587ca50, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 126, 8, UINT64_C(0x996b1cb2a31043fc), "w", 0 };
+VarInfo * __func_info__3ad0a31d00c9d958_fields[1] =  { &__func_info__3ad0a31d00c9d958_field_0 };
+FuncInfo __func_info__3ad0a31d00c9d958 = {"invoke block<(w:Work const#):void> const", "", __func_info__3ad0a31d00c9d958_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x3ad0a31d00c9d958), 0x0 };
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__89f87fddfa254636 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~jobque::Channel"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 224, UINT64_C(0x89f87fddfa254636) };
+TypeInfo __type_info__a7244f77d75ea149 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fe24a2dd43758fc9, nullptr, nullptr, nullptr, 0, 0, nullptr, 8461, 8, UINT64_C(0xa7244f77d75ea149) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__90f4c07b5a6e390 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0x90f4c07b5a6e390) };
+TypeInfo __type_info__6c10b6e9d0f66c00 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9f2b89ea82b475bc, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x6c10b6e9d0f66c00) };
+TypeInfo __type_info__afb37e4eb4f402d9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f8f0e5ea918b191, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xafb37e4eb4f402d9) };
+TypeInfo __type_info__2f707f193f39acb0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~jobque::JobStatus"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 104, UINT64_C(0x2f707f193f39acb0) };
+TypeInfo __type_info__861e83a6e8367623 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f06023ece159b613, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x861e83a6e8367623) };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63db4c8601ead9) };
+TypeInfo __type_info__9f2b89ea82b475bc = { Type::tStructure, &__struct_info__eab53f12449e6b91, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 56, UINT64_C(0x9f2b89ea82b475bc) };
+TypeInfo __type_info__96578ef8b03fa52f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~jobque::LockFreeChannel"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 384, UINT64_C(0x96578ef8b03fa52f) };
+TypeInfo __type_info__1c30fa709c8510cc = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2fd4cf229b743e84, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x1c30fa709c8510cc) };
+TypeInfo __type_info__7000e4b70a9e5461 = { Type::tStructure, &__struct_info__bf207a416667fe8a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 32, UINT64_C(0x7000e4b70a9e5461) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__f06023ece159b613 = { Type::tStructure, &__struct_info__ca4515729b117c78, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 32, UINT64_C(0xf06023ece159b613) };
+TypeInfo __type_info__9e797c29621111fd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7000e4b70a9e5461, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x9e797c29621111fd) };
+TypeInfo __type_info__2f8f0e5ea918b191 = { Type::tStructure, &__struct_info__7dee57cc255ef0de, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 32, UINT64_C(0x2f8f0e5ea918b191) };
+TypeInfo __type_info__2fd4cf229b743e84 = { Type::tStructure, &__struct_info__55aa23c241c676f1, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 32, UINT64_C(0x2fd4cf229b743e84) };
+TypeInfo __type_info__521213b6cb688390 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__5c1f7d5b510c9117, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x521213b6cb688390) };
+TypeInfo __type_info__5c1f7d5b510c9117 = { Type::tStructure, &__struct_info__e5095599a587ca50, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 8, UINT64_C(0x5c1f7d5b510c9117) };
+TypeInfo __type_info__f2ba75a8774162e8 = { Type::tStructure, &__struct_info__215ac6f59bf1c00d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 40, UINT64_C(0xf2ba75a8774162e8) };
+TypeInfo __type_info__fe24a2dd43758fc9 = { Type::tStructure, &__struct_info__e5095599a587ca50, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 126, 8, UINT64_C(0xfe24a2dd43758fc9) };
+TypeInfo __type_info__f468413453aeca48 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f2ba75a8774162e8, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xf468413453aeca48) };
+TypeInfo __type_info__3ceb21b1e6727087 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x3ceb21b1e6727087) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__89f87fddfa254636.resolveAnnotation();
+	__type_info__2f707f193f39acb0.resolveAnnotation();
+	__type_info__96578ef8b03fa52f.resolveAnnotation();
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__521213b6cb688390 };
+TypeInfo * __tinfo_1[1] = { &__type_info__3ceb21b1e6727087 };
+namespace  { struct Work; };
+namespace  { struct _lambda_thismodule_18_20_1; };
+namespace  { struct _lambda_thismodule_27_20_2; };
+namespace  { struct _lambda_thismodule_40_20_3; };
+namespace  { struct _lambda_thismodule_53_20_4; };
+namespace  { struct _lambda_thismodule_79_20_5; };
+namespace  { struct _lambda_thismodule_98_12_6; };
+namespace  { struct _lambda_thismodule_18_20_1_new_job_clone; };
+namespace  { struct _lambda_thismodule_27_20_2_new_job_clone; };
+namespace  { struct _lambda_thismodule_40_20_3_new_job_clone; };
+namespace  { struct _lambda_thismodule_53_20_4_new_job_clone; };
+namespace  { struct _lambda_thismodule_79_20_5_new_job_clone; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace templates { struct DecltypeMacro; };
+namespace templates { struct DecltypeNoRefMacro; };
+namespace templates { struct TemplateMacro; };
+namespace contracts { struct IsAnyType; };
+namespace contracts { struct IsAnyArrayMacro; };
+namespace contracts { struct IsDimMacro; };
+namespace contracts { struct IsNotDimMacro; };
+namespace contracts { struct IsAnyEnumMacro; };
+namespace contracts { struct IsAnyVectorType; };
+namespace contracts { struct IsAnyStructMacro; };
+namespace contracts { struct IsAnyNumericMacro; };
+namespace contracts { struct IsAnyWorkhorse; };
+namespace contracts { struct IsAnyWorkhorseNonPtrMacro; };
+namespace contracts { struct IsAnyTupleNonPtrMacro; };
+namespace contracts { struct IsAnyVariantNonPtrMacro; };
+namespace contracts { struct IsAnyFunctionNonPtrMacro; };
+namespace templates_boost { struct Template; };
+namespace templates_boost { struct TemplateVisitor; };
+namespace templates_boost { struct RemoveDerefVisitor; };
+namespace templates_boost { struct QRulesVisitor; };
+namespace templates_boost { struct AstQCallMacro; };
+namespace templates_boost { struct QMacro; };
+namespace templates_boost { struct QBlockMacro; };
+namespace templates_boost { struct QBlockExprMacro; };
+namespace templates_boost { struct QTypeMacro; };
+namespace templates_boost { struct AstQNamedMacro; };
+namespace templates_boost { struct AstQFunctionMacro; };
+namespace templates_boost { struct AstQVariableMacro; };
+namespace templates_boost { struct AstQNamedClassMacro; };
+namespace templates_boost { struct AstQMethodMacro; };
+namespace macro_boost { struct MacroVerifyMacro; };
+namespace jobque_boost { struct NewJobMacro; };
+namespace jobque_boost { struct ChannelAndStatusCapture; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+// unused structure DecltypeMacro
+// unused structure DecltypeNoRefMacro
+// unused structure TemplateMacro
+// unused structure IsAnyType
+// unused structure IsAnyArrayMacro
+// unused structure IsDimMacro
+// unused structure IsNotDimMacro
+// unused structure IsAnyEnumMacro
+// unused structure IsAnyVectorType
+// unused structure IsAnyStructMacro
+// unused structure IsAnyNumericMacro
+// unused structure IsAnyWorkhorse
+// unused structure IsAnyWorkhorseNonPtrMacro
+// unused structure IsAnyTupleNonPtrMacro
+// unused structure IsAnyVariantNonPtrMacro
+// unused structure IsAnyFunctionNonPtrMacro
+// unused structure Template
+// unused structure TemplateVisitor
+// unused structure RemoveDerefVisitor
+// unused structure QRulesVisitor
+// unused structure AstQCallMacro
+// unused structure QMacro
+// unused structure QBlockMacro
+// unused structure QBlockExprMacro
+// unused structure QTypeMacro
+// unused structure AstQNamedMacro
+// unused structure AstQFunctionMacro
+// unused structure AstQVariableMacro
+// unused structure AstQNamedClassMacro
+// unused structure AstQMethodMacro
+// unused structure MacroVerifyMacro
+// unused structure NewJobMacro
+// unused structure ChannelAndStatusCapture
+namespace  {
+
+struct Work {
+	int32_t x;
+	int32_t t;
+};
+static_assert(sizeof(Work)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Work,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Work,t)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_18_20_1 {
+	Func DAS_COMMENT((void,_lambda_thismodule_18_20_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_18_20_1 *)) __finalize;
+	JobStatus * status;
+	int32_t x;
+	TArray<int32_t> y;
+};
+static_assert(sizeof(_lambda_thismodule_18_20_1)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1,status)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1,y)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_27_20_2 {
+	Func DAS_COMMENT((void,_lambda_thismodule_27_20_2)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_27_20_2 *)) __finalize;
+	Channel * channel;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_27_20_2)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_27_20_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_27_20_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_27_20_2,channel)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_27_20_2,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_40_20_3 {
+	Func DAS_COMMENT((void,_lambda_thismodule_40_20_3)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_40_20_3 *)) __finalize;
+	Channel * channel;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_40_20_3)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_20_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_20_3,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_20_3,channel)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_20_3,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_53_20_4 {
+	Func DAS_COMMENT((void,_lambda_thismodule_53_20_4)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_53_20_4 *)) __finalize;
+	LockFreeChannel * channel;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_53_20_4)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_53_20_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_53_20_4,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_53_20_4,channel)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_53_20_4,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_79_20_5 {
+	Func DAS_COMMENT((void,_lambda_thismodule_79_20_5)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_79_20_5 *)) __finalize;
+	JobStatus * status;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_79_20_5)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_79_20_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_79_20_5,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_79_20_5,status)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_79_20_5,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_98_12_6 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_98_12_6,Work const  * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_98_12_6 *)) __finalize;
+	int32_t __yield;
+	Channel * channel;
+	void * __void_data_rename_at_99;
+};
+static_assert(sizeof(_lambda_thismodule_98_12_6)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_12_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_12_6,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_12_6,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_12_6,channel)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_12_6,__void_data_rename_at_99)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_18_20_1_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_18_20_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_18_20_1 *)) __finalize;
+	JobStatus * status;
+	int32_t x;
+	TArray<int32_t> y;
+};
+static_assert(sizeof(_lambda_thismodule_18_20_1_new_job_clone)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1_new_job_clone,status)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1_new_job_clone,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1_new_job_clone,y)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_27_20_2_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_27_20_2)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_27_20_2 *)) __finalize;
+	Channel * channel;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_27_20_2_new_job_clone)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_27_20_2_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_27_20_2_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_27_20_2_new_job_clone,channel)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_27_20_2_new_job_clone,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_40_20_3_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_40_20_3)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_40_20_3 *)) __finalize;
+	Channel * channel;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_40_20_3_new_job_clone)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_20_3_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_20_3_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_20_3_new_job_clone,channel)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_20_3_new_job_clone,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_53_20_4_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_53_20_4)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_53_20_4 *)) __finalize;
+	LockFreeChannel * channel;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_53_20_4_new_job_clone)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_53_20_4_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_53_20_4_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_53_20_4_new_job_clone,channel)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_53_20_4_new_job_clone,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_79_20_5_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_79_20_5)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_79_20_5 *)) __finalize;
+	JobStatus * status;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_79_20_5_new_job_clone)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_79_20_5_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_79_20_5_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_79_20_5_new_job_clone,status)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_79_20_5_new_job_clone,x)==24,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> & __a_rename_at_338, TArray<int32_t> const  & __b_rename_at_338 );
+inline void finalize_baab685a83a370b7 ( Context * __context__, _lambda_thismodule_98_12_6 & ____this_rename_at_98 );
+inline void finalize_35cbbf7257c44c0 ( Context * __context__, Work & ____this_rename_at_5 );
+inline Sequence DAS_COMMENT((Work const  &)) _Funcbuiltin_0x60_each_ref_d7642bb9cae45024 ( Context * __context__, Lambda DAS_COMMENT((bool,Work const  * &)) const  __lam_rename_at_487 );
+inline void _Funcbuiltin_0x60_finalize_d82479d0972b3594 ( Context * __context__, TArray<void *> & __a_rename_at_399 );
+inline void finalize_972ca8ae057d618f ( Context * __context__, _lambda_thismodule_18_20_1 & ____this_rename_at_18 );
+inline void finalize_c88db3a3fc2bd8de ( Context * __context__, _lambda_thismodule_27_20_2 & ____this_rename_at_27 );
+inline void finalize_1cf9baf2b038ad20 ( Context * __context__, _lambda_thismodule_40_20_3 & ____this_rename_at_40 );
+inline bool _Func_lambda_thismodule_98_12_6_0x60_function_a455fb0e79485024 ( Context * __context__, _lambda_thismodule_98_12_6 & ____this_rename_at_98, Work const  * & ___ryield98_rename_at_98 );
+inline void _Func_lambda_thismodule_98_12_6_0x60_finalizer_34f255a12c773042 ( Context * __context__, _lambda_thismodule_98_12_6 * ____this_rename_at_98 );
+inline void _Funcbuiltin_0x60_reserve_5080f51a18b25959 ( Context * __context__, TArray<void *> & __Arr_rename_at_59, int32_t __newSize_rename_at_59 );
+inline void _Funcbuiltin_0x60_push_cb11951ac51d80e2 ( Context * __context__, TArray<void *> & __Arr_rename_at_75, void * const  __value_rename_at_75 );
+inline TArray<Work> & _Funcbuiltin_0x60__return_with_lockcheck_252f2f5383e1d0c5 ( Context * __context__, TArray<Work> & __a_rename_at_42 );
+inline void finalize_27b636d7445827fb ( Context * __context__, _lambda_thismodule_53_20_4 & ____this_rename_at_53 );
+inline void finalize_d4a58e3b1bdba5bc ( Context * __context__, Work * & ____this_rename_at_122 );
+inline void finalize_93243fba5b8dfb7a ( Context * __context__, _lambda_thismodule_79_20_5 & ____this_rename_at_79 );
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> & __a_rename_at_42 );
+inline void clone_7498ed4435e69a51 ( Context * __context__, _lambda_thismodule_18_20_1_new_job_clone & __a_rename_at_18, _lambda_thismodule_18_20_1_new_job_clone const  & __b_rename_at_18 );
+inline void clone_7e7382ae80121839 ( Context * __context__, _lambda_thismodule_27_20_2_new_job_clone & __a_rename_at_27, _lambda_thismodule_27_20_2_new_job_clone const  & __b_rename_at_27 );
+inline void clone_513329cb28e97af1 ( Context * __context__, _lambda_thismodule_40_20_3_new_job_clone & __a_rename_at_40, _lambda_thismodule_40_20_3_new_job_clone const  & __b_rename_at_40 );
+inline Sequence DAS_COMMENT((Work const  &)) _Func_0x60_template_0x60_0x9ae6ef0237d899a0_0x60_jobque_boost_0x60_each_53b02f08b1683c07 ( Context * __context__, Channel * __channel_rename_at_92 );
+inline void clone_c9405317ec45866b ( Context * __context__, _lambda_thismodule_53_20_4_new_job_clone & __a_rename_at_53, _lambda_thismodule_53_20_4_new_job_clone const  & __b_rename_at_53 );
+inline void clone_ad6a4885f11023d9 ( Context * __context__, _lambda_thismodule_79_20_5_new_job_clone & __a_rename_at_79, _lambda_thismodule_79_20_5_new_job_clone const  & __b_rename_at_79 );
+inline void _Funcjobque_boost_0x60_parallel_map_9b405b37d4e481e1 ( Context * __context__, TArray<int32_t> const  & __input_rename_at_169, TArray<float> & __output_rename_at_169, int32_t __chunk_rename_at_169, Block DAS_COMMENT((float,int32_t)) const  & __blk_rename_at_169 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline void _Func_lambda_thismodule_18_20_1_0x60_function_d1142320cc7116ac ( Context * __context__, _lambda_thismodule_18_20_1 & ____this_rename_at_18 );
+inline void _Func_lambda_thismodule_18_20_1_0x60_finalizer_49626a8351ffc67a ( Context * __context__, _lambda_thismodule_18_20_1 * ____this_rename_at_18 );
+inline void _Funcjobque_boost_0x60_push_clone_81bdf1aab41cbc7e ( Context * __context__, Channel * const  __channel_rename_at_81, Work const  & __data_rename_at_81 );
+inline void _Func_lambda_thismodule_27_20_2_0x60_function_cbb35cb4fe7d3884 ( Context * __context__, _lambda_thismodule_27_20_2 & ____this_rename_at_27 );
+inline void _Func_lambda_thismodule_27_20_2_0x60_finalizer_599b344a046d7c88 ( Context * __context__, _lambda_thismodule_27_20_2 * ____this_rename_at_27 );
+inline void _Funcjobque_boost_0x60_for_each_1b27909a068e107 ( Context * __context__, Channel * const  __channel_rename_at_69, Block DAS_COMMENT((void,Work const )) const  & __blk_rename_at_69 );
+inline void _Func_lambda_thismodule_40_20_3_0x60_function_19188be2df78527a ( Context * __context__, _lambda_thismodule_40_20_3 & ____this_rename_at_40 );
+inline void _Func_lambda_thismodule_40_20_3_0x60_finalizer_58510cb32f454648 ( Context * __context__, _lambda_thismodule_40_20_3 * ____this_rename_at_40 );
+inline void _Funcjobque_boost_0x60_push_clone_892b0b909365e37e ( Context * __context__, LockFreeChannel * const  __channel_rename_at_107, Work const  & __data_rename_at_107 );
+inline void _Funcbuiltin_0x60_push_72088d13f08990d7 ( Context * __context__, TArray<Work> & __Arr_rename_at_75, Work const  & __value_rename_at_75 );
+inline void _Funcjobque_boost_0x60_push_batch_clone_8a4063ef87aa5504 ( Context * __context__, LockFreeChannel * const  __channel_rename_at_133, TArray<Work> const  & __data_rename_at_133 );
+inline void _Func_lambda_thismodule_53_20_4_0x60_function_4f43d954fa01c3b0 ( Context * __context__, _lambda_thismodule_53_20_4 & ____this_rename_at_53 );
+inline void _Func_lambda_thismodule_53_20_4_0x60_finalizer_4836ba52174ad6ba ( Context * __context__, _lambda_thismodule_53_20_4 * ____this_rename_at_53 );
+inline void _Funcjobque_boost_0x60_for_each_27f1b49b926ed269 ( Context * __context__, LockFreeChannel * const  __channel_rename_at_146, Block DAS_COMMENT((void,Work const )) const  & __blk_rename_at_146 );
+inline bool _Funcjobque_boost_0x60_try_push_clone_22c52beb62b8d696 ( Context * __context__, LockFreeChannel * const  __channel_rename_at_114, Work const  & __data_rename_at_114 );
+inline bool _Funcjobque_boost_0x60_try_pop_f762fb5e736859b1 ( Context * __context__, LockFreeChannel * const  __channel_rename_at_158, Block DAS_COMMENT((void,Work const )) const  & __blk_rename_at_158 );
+inline void _Func_lambda_thismodule_79_20_5_0x60_function_c4d5385ccdb7d99 ( Context * __context__, _lambda_thismodule_79_20_5 & ____this_rename_at_79 );
+inline void _Func_lambda_thismodule_79_20_5_0x60_finalizer_d9081e32d2ad474 ( Context * __context__, _lambda_thismodule_79_20_5 * ____this_rename_at_79 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_399 );
+inline void _Funcbuiltin_0x60_finalize_4da34799ba0520c5 ( Context * __context__, TArray<float> & __a_rename_at_399 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcjobque_boost_0x60_parallel_map_431dccd551bb2775 ( Context * __context__, TArray<int32_t> const  & __input_rename_at_181, TArray<float> & __output_rename_at_181, Block DAS_COMMENT((float,int32_t)) const  & __blk_rename_at_181 );
+inline bool test_dff0cea6facb6ed8 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0xdd9cd8b28c4f1767>(__context__) = 1;/*g_job_global*/
+}
+
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<float>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> &  __a_rename_at_338, TArray<int32_t> const  &  __b_rename_at_338 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_338),builtin_array_size(__b_rename_at_338));
+	{
+		bool __need_loop_340 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_338);
+		int32_t * __aV_rename_at_340;
+		__need_loop_340 = __aV_iterator.first(__context__,(__aV_rename_at_340)) && __need_loop_340;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_338);
+		int32_t const  * __bV_rename_at_340;
+		__need_loop_340 = __bV_iterator.first(__context__,(__bV_rename_at_340)) && __need_loop_340;
+		for ( ; __need_loop_340 ; __need_loop_340 = __aV_iterator.next(__context__,(__aV_rename_at_340)) && __bV_iterator.next(__context__,(__bV_rename_at_340)) )
+		{
+			das_copy((*__aV_rename_at_340),(*__bV_rename_at_340));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_340));
+		__bV_iterator.close(__context__,(__bV_rename_at_340));
+	};
+}
+
+inline void finalize_baab685a83a370b7 ( Context * __context__, _lambda_thismodule_98_12_6 &  ____this_rename_at_98 )
+{
+	memset(&(____this_rename_at_98), 0, 40);
+}
+
+inline void finalize_35cbbf7257c44c0 ( Context * __context__, Work &  ____this_rename_at_5 )
+{
+	memset(&(____this_rename_at_5), 0, 8);
+}
+
+inline Sequence DAS_COMMENT((Work const  &)) _Funcbuiltin_0x60_each_ref_d7642bb9cae45024 ( Context * __context__, Lambda DAS_COMMENT((bool,Work const  * &)) const  __lam_rename_at_487 )
+{
+	Sequence DAS_COMMENT((Work *)) __it_rename_at_488; das_zero(__it_rename_at_488);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((Work const ))>::pass(__it_rename_at_488),__lam_rename_at_487,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((Work const  &))>::cast(__it_rename_at_488);
+}
+
+inline void _Funcbuiltin_0x60_finalize_d82479d0972b3594 ( Context * __context__, TArray<void *> &  __a_rename_at_399 )
+{
+	builtin_array_free(das_arg<TArray<void *>>::pass(__a_rename_at_399),8,__context__);
+}
+
+inline void finalize_972ca8ae057d618f ( Context * __context__, _lambda_thismodule_18_20_1 &  ____this_rename_at_18 )
+{
+	memset(&(____this_rename_at_18), 0, 56);
+}
+
+inline void finalize_c88db3a3fc2bd8de ( Context * __context__, _lambda_thismodule_27_20_2 &  ____this_rename_at_27 )
+{
+	memset(&(____this_rename_at_27), 0, 32);
+}
+
+inline void finalize_1cf9baf2b038ad20 ( Context * __context__, _lambda_thismodule_40_20_3 &  ____this_rename_at_40 )
+{
+	memset(&(____this_rename_at_40), 0, 32);
+}
+
+inline bool _Func_lambda_thismodule_98_12_6_0x60_function_a455fb0e79485024 ( Context * __context__, _lambda_thismodule_98_12_6 &  ____this_rename_at_98, Work const  * & ___ryield98_rename_at_98 )
+{
+	switch (____this_rename_at_98.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	label_2:;;
+	das_copy(____this_rename_at_98.__void_data_rename_at_99,channelPop(____this_rename_at_98.channel,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+	if ( ____this_rename_at_98.__void_data_rename_at_99 == nullptr )
+	{
+		goto label_3;
+	};
+	das_copy(___ryield98_rename_at_98,das_ref(__context__,das_deref(__context__,das_cast<Work const  *>::cast(____this_rename_at_98.__void_data_rename_at_99))));
+	das_copy(____this_rename_at_98.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	goto label_2;
+	label_3:;;
+	channelReleaseRef(____this_rename_at_98.channel,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_98_12_6_0x60_finalizer_34f255a12c773042 ( Context * __context__, _lambda_thismodule_98_12_6 * ____this_rename_at_98 )
+{
+	finalize_baab685a83a370b7(__context__,das_arg<_lambda_thismodule_98_12_6>::pass(das_deref(__context__,____this_rename_at_98)));
+	das_delete_lambda_struct<_lambda_thismodule_98_12_6 *>::clear(__context__,____this_rename_at_98);
+}
+
+inline void _Funcbuiltin_0x60_reserve_5080f51a18b25959 ( Context * __context__, TArray<void *> &  __Arr_rename_at_59, int32_t __newSize_rename_at_59 )
+{
+	builtin_array_reserve(das_arg<TArray<void *>>::pass(__Arr_rename_at_59),__newSize_rename_at_59,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_cb11951ac51d80e2 ( Context * __context__, TArray<void *> &  __Arr_rename_at_75, void * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<void *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline TArray<Work> & _Funcbuiltin_0x60__return_with_lockcheck_252f2f5383e1d0c5 ( Context * __context__, TArray<Work> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<Work> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<Work> &>::cast(__a_rename_at_42);
+}
+
+inline void finalize_27b636d7445827fb ( Context * __context__, _lambda_thismodule_53_20_4 &  ____this_rename_at_53 )
+{
+	memset(&(____this_rename_at_53), 0, 32);
+}
+
+inline void finalize_d4a58e3b1bdba5bc ( Context * __context__, Work * & ____this_rename_at_122 )
+{
+	if ( ____this_rename_at_122 != nullptr )
+	{
+		finalize_35cbbf7257c44c0(__context__,das_arg<Work>::pass(das_deref(__context__,____this_rename_at_122)));
+		das_delete<Work *>::clear(__context__,____this_rename_at_122);
+		das_copy(____this_rename_at_122,nullptr);
+	};
+}
+
+inline void finalize_93243fba5b8dfb7a ( Context * __context__, _lambda_thismodule_79_20_5 &  ____this_rename_at_79 )
+{
+	memset(&(____this_rename_at_79), 0, 32);
+}
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<TArray<int32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_42);
+}
+
+inline void clone_7498ed4435e69a51 ( Context * __context__, _lambda_thismodule_18_20_1_new_job_clone &  __a_rename_at_18, _lambda_thismodule_18_20_1_new_job_clone const  &  __b_rename_at_18 )
+{
+	das_copy(__a_rename_at_18.__lambda,__b_rename_at_18.__lambda);
+	das_copy(__a_rename_at_18.__finalize,__b_rename_at_18.__finalize);
+	das_copy(__a_rename_at_18.status,__b_rename_at_18.status);
+	das_copy(__a_rename_at_18.x,__b_rename_at_18.x);
+	_Funcbuiltin_0x60_clone_7775f70b42a34990(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_18.y),__b_rename_at_18.y);
+}
+
+inline void clone_7e7382ae80121839 ( Context * __context__, _lambda_thismodule_27_20_2_new_job_clone &  __a_rename_at_27, _lambda_thismodule_27_20_2_new_job_clone const  &  __b_rename_at_27 )
+{
+	das_copy(__a_rename_at_27.__lambda,__b_rename_at_27.__lambda);
+	das_copy(__a_rename_at_27.__finalize,__b_rename_at_27.__finalize);
+	das_copy(__a_rename_at_27.channel,__b_rename_at_27.channel);
+	das_copy(__a_rename_at_27.x,__b_rename_at_27.x);
+}
+
+inline void clone_513329cb28e97af1 ( Context * __context__, _lambda_thismodule_40_20_3_new_job_clone &  __a_rename_at_40, _lambda_thismodule_40_20_3_new_job_clone const  &  __b_rename_at_40 )
+{
+	das_copy(__a_rename_at_40.__lambda,__b_rename_at_40.__lambda);
+	das_copy(__a_rename_at_40.__finalize,__b_rename_at_40.__finalize);
+	das_copy(__a_rename_at_40.channel,__b_rename_at_40.channel);
+	das_copy(__a_rename_at_40.x,__b_rename_at_40.x);
+}
+
+inline Sequence DAS_COMMENT((Work const  &)) _Func_0x60_template_0x60_0x9ae6ef0237d899a0_0x60_jobque_boost_0x60_each_53b02f08b1683c07 ( Context * __context__, Channel * __channel_rename_at_92 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((Work const  &))>::cast(_Funcbuiltin_0x60_each_ref_d7642bb9cae45024(__context__,das_ascend<bool,_lambda_thismodule_98_12_6>::make(__context__,&__type_info__f2ba75a8774162e8,(([&]() -> _lambda_thismodule_98_12_6 {
+		_lambda_thismodule_98_12_6 __mks_97;
+		das_zero(__mks_97);
+		das_copy((__mks_97.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_98_12_6`function XS<::_lambda_thismodule_98_12_6> &1<C#XS<::Work>>?*/ 7248127621462349716u))));
+		das_copy((__mks_97.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_98_12_6`finalizer X1<S<::_lambda_thismodule_98_12_6>>?*/ 831239179428143608u))));
+		das_copy((__mks_97.channel),(das_invoke_function<Channel *>::invoke<Channel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::capture_jobque_channel C1<H<jobque::Channel>>?*/ 14129945787985015456u)),__channel_rename_at_92)));
+		return __mks_97;
+	})()))));
+}
+
+inline void clone_c9405317ec45866b ( Context * __context__, _lambda_thismodule_53_20_4_new_job_clone &  __a_rename_at_53, _lambda_thismodule_53_20_4_new_job_clone const  &  __b_rename_at_53 )
+{
+	das_copy(__a_rename_at_53.__lambda,__b_rename_at_53.__lambda);
+	das_copy(__a_rename_at_53.__finalize,__b_rename_at_53.__finalize);
+	das_copy(__a_rename_at_53.channel,__b_rename_at_53.channel);
+	das_copy(__a_rename_at_53.x,__b_rename_at_53.x);
+}
+
+inline void clone_ad6a4885f11023d9 ( Context * __context__, _lambda_thismodule_79_20_5_new_job_clone &  __a_rename_at_79, _lambda_thismodule_79_20_5_new_job_clone const  &  __b_rename_at_79 )
+{
+	das_copy(__a_rename_at_79.__lambda,__b_rename_at_79.__lambda);
+	das_copy(__a_rename_at_79.__finalize,__b_rename_at_79.__finalize);
+	das_copy(__a_rename_at_79.status,__b_rename_at_79.status);
+	das_copy(__a_rename_at_79.x,__b_rename_at_79.x);
+}
+
+inline void _Funcjobque_boost_0x60_parallel_map_9b405b37d4e481e1 ( Context * __context__, TArray<int32_t> const  &  __input_rename_at_169, TArray<float> &  __output_rename_at_169, int32_t __chunk_rename_at_169, Block DAS_COMMENT((float,int32_t)) const  &  __blk_rename_at_169 ) { das_stack_prologue __prologue(__context__,112,"jobque_boost`parallel_map " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__output_rename_at_169),builtin_array_size(__input_rename_at_169));
+	parallelFor(0,builtin_array_size(__input_rename_at_169),__chunk_rename_at_169,das_make_block<void,int32_t,int32_t>(__context__,80,0,&__func_info__27bbd6f96acc8444,[&](int32_t __i0_rename_at_177, int32_t __i1_rename_at_177)->void{
+		{
+			bool __need_loop_178 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(__i0_rename_at_177,__i1_rename_at_177));
+			int32_t __i_rename_at_178;
+			__need_loop_178 = __i_iterator.first(__context__,(__i_rename_at_178)) && __need_loop_178;
+			for ( ; __need_loop_178 ; __need_loop_178 = __i_iterator.next(__context__,(__i_rename_at_178)) )
+			{
+				das_copy(__output_rename_at_169(__i_rename_at_178,__context__),das_invoke<float>::invoke<int32_t>(__context__,nullptr,__blk_rename_at_169,__input_rename_at_169(__i_rename_at_178,__context__)));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_178));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Func_lambda_thismodule_18_20_1_0x60_function_d1142320cc7116ac ( Context * __context__, _lambda_thismodule_18_20_1 &  ____this_rename_at_18 )
+{
+/* finally */ auto __finally_18= das_finally([&](){
+	das_invoke_function<void>::invoke<JobStatus * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::release_capture_jobque_job_status C1<H<jobque::JobStatus>>?*/ 13882985380930343467u)),____this_rename_at_18.status);
+/* end finally */ });
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(____this_rename_at_18.y)) == 3));
+	{
+		bool __need_loop_19 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_19;
+		__need_loop_19 = __t_iterator.first(__context__,(__t_rename_at_19)) && __need_loop_19;
+		// c : int&
+		das_iterator<TArray<int32_t>> __c_iterator(____this_rename_at_18.y);
+		int32_t * __c_rename_at_19;
+		__need_loop_19 = __c_iterator.first(__context__,(__c_rename_at_19)) && __need_loop_19;
+		for ( ; __need_loop_19 ; __need_loop_19 = __t_iterator.next(__context__,(__t_rename_at_19)) && __c_iterator.next(__context__,(__c_rename_at_19)) )
+		{
+			DAS_ASSERT(((__t_rename_at_19 + ____this_rename_at_18.x) == (*__c_rename_at_19)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_19));
+		__c_iterator.close(__context__,(__c_rename_at_19));
+	};
+	notifyAndReleaseJob(____this_rename_at_18.status,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_18_20_1_0x60_finalizer_49626a8351ffc67a ( Context * __context__, _lambda_thismodule_18_20_1 * ____this_rename_at_18 )
+{
+	finalize_972ca8ae057d618f(__context__,das_arg<_lambda_thismodule_18_20_1>::pass(das_deref(__context__,____this_rename_at_18)));
+	das_delete_lambda_struct<_lambda_thismodule_18_20_1 *>::clear(__context__,____this_rename_at_18);
+}
+
+inline void _Funcjobque_boost_0x60_push_clone_81bdf1aab41cbc7e ( Context * __context__, Channel * const  __channel_rename_at_81, Work const  &  __data_rename_at_81 )
+{
+	Work * __heap_data_rename_at_83 = das_new<Work>::make(__context__);
+	das_copy(das_deref(__context__,__heap_data_rename_at_83),__data_rename_at_81);
+	channelPush(__channel_rename_at_81,das_auto_cast<void * const >::cast(__heap_data_rename_at_83),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_27_20_2_0x60_function_cbb35cb4fe7d3884 ( Context * __context__, _lambda_thismodule_27_20_2 &  ____this_rename_at_27 )
+{
+/* finally */ auto __finally_27= das_finally([&](){
+	das_invoke_function<void>::invoke<Channel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::release_capture_jobque_channel C1<H<jobque::Channel>>?*/ 5115173217570402306u)),____this_rename_at_27.channel);
+/* end finally */ });
+	{
+		bool __need_loop_27 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_27;
+		__need_loop_27 = __t_iterator.first(__context__,(__t_rename_at_27)) && __need_loop_27;
+		for ( ; __need_loop_27 ; __need_loop_27 = __t_iterator.next(__context__,(__t_rename_at_27)) )
+		{
+			Work _temp_make_local_28_48;
+			_Funcjobque_boost_0x60_push_clone_81bdf1aab41cbc7e(__context__,____this_rename_at_27.channel,das_arg<Work>::pass((([&]() -> Work& {
+				das_copy((_temp_make_local_28_48.x),(____this_rename_at_27.x));
+				das_copy((_temp_make_local_28_48.t),(__t_rename_at_27));
+				return _temp_make_local_28_48;
+			})())));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_27));
+	};
+	notifyAndReleaseChannel(____this_rename_at_27.channel,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_27_20_2_0x60_finalizer_599b344a046d7c88 ( Context * __context__, _lambda_thismodule_27_20_2 * ____this_rename_at_27 )
+{
+	finalize_c88db3a3fc2bd8de(__context__,das_arg<_lambda_thismodule_27_20_2>::pass(das_deref(__context__,____this_rename_at_27)));
+	das_delete_lambda_struct<_lambda_thismodule_27_20_2 *>::clear(__context__,____this_rename_at_27);
+}
+
+inline void _Funcjobque_boost_0x60_for_each_1b27909a068e107 ( Context * __context__, Channel * const  __channel_rename_at_69, Block DAS_COMMENT((void,Work const )) const  &  __blk_rename_at_69 )
+{
+	while ( true )
+	{
+		void * __void_data_rename_at_74 = ((void *)channelPop(__channel_rename_at_69,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+		if ( __void_data_rename_at_74 == nullptr )
+		{
+			break;
+		} else {
+			Work const  * __typed_data_rename_at_78 = ((Work const  *)das_cast<Work const  *>::cast(__void_data_rename_at_74));
+			das_invoke<void>::invoke<Work const  &>(__context__,nullptr,__blk_rename_at_69,das_deref(__context__,__typed_data_rename_at_78));
+		};
+	};
+}
+
+inline void _Func_lambda_thismodule_40_20_3_0x60_function_19188be2df78527a ( Context * __context__, _lambda_thismodule_40_20_3 &  ____this_rename_at_40 )
+{
+/* finally */ auto __finally_40= das_finally([&](){
+	das_invoke_function<void>::invoke<Channel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::release_capture_jobque_channel C1<H<jobque::Channel>>?*/ 5115173217570402306u)),____this_rename_at_40.channel);
+/* end finally */ });
+	{
+		bool __need_loop_40 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_40;
+		__need_loop_40 = __t_iterator.first(__context__,(__t_rename_at_40)) && __need_loop_40;
+		for ( ; __need_loop_40 ; __need_loop_40 = __t_iterator.next(__context__,(__t_rename_at_40)) )
+		{
+			Work _temp_make_local_41_48;
+			_Funcjobque_boost_0x60_push_clone_81bdf1aab41cbc7e(__context__,____this_rename_at_40.channel,das_arg<Work>::pass((([&]() -> Work& {
+				das_copy((_temp_make_local_41_48.x),(____this_rename_at_40.x));
+				das_copy((_temp_make_local_41_48.t),(__t_rename_at_40));
+				return _temp_make_local_41_48;
+			})())));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_40));
+	};
+	notifyAndReleaseChannel(____this_rename_at_40.channel,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_40_20_3_0x60_finalizer_58510cb32f454648 ( Context * __context__, _lambda_thismodule_40_20_3 * ____this_rename_at_40 )
+{
+	finalize_1cf9baf2b038ad20(__context__,das_arg<_lambda_thismodule_40_20_3>::pass(das_deref(__context__,____this_rename_at_40)));
+	das_delete_lambda_struct<_lambda_thismodule_40_20_3 *>::clear(__context__,____this_rename_at_40);
+}
+
+inline void _Funcjobque_boost_0x60_push_clone_892b0b909365e37e ( Context * __context__, LockFreeChannel * const  __channel_rename_at_107, Work const  &  __data_rename_at_107 )
+{
+	Work * __heap_data_rename_at_110 = das_new<Work>::make(__context__);
+	das_copy(das_deref(__context__,__heap_data_rename_at_110),__data_rename_at_107);
+	lockFreeChannelPush(__channel_rename_at_107,das_auto_cast<void * const >::cast(__heap_data_rename_at_110),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Funcbuiltin_0x60_push_72088d13f08990d7 ( Context * __context__, TArray<Work> &  __Arr_rename_at_75, Work const  &  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<Work>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcjobque_boost_0x60_push_batch_clone_8a4063ef87aa5504 ( Context * __context__, LockFreeChannel * const  __channel_rename_at_133, TArray<Work> const  &  __data_rename_at_133 )
+{
+	TArray<void *> __batch_rename_at_136; das_zero(__batch_rename_at_136);
+	_Funcbuiltin_0x60_reserve_5080f51a18b25959(__context__,das_arg<TArray<void *>>::pass(__batch_rename_at_136),builtin_array_size(__data_rename_at_133));
+	{
+		bool __need_loop_138 = true;
+		// d : Work aka TT const&
+		das_iterator<TArray<Work> const > __d_iterator(__data_rename_at_133);
+		Work const  * __d_rename_at_138;
+		__need_loop_138 = __d_iterator.first(__context__,(__d_rename_at_138)) && __need_loop_138;
+		for ( ; __need_loop_138 ; __need_loop_138 = __d_iterator.next(__context__,(__d_rename_at_138)) )
+		{
+			Work * __heap_data_rename_at_139 = das_new<Work>::make(__context__);
+			das_copy(das_deref(__context__,__heap_data_rename_at_139),(*__d_rename_at_138));
+			_Funcbuiltin_0x60_push_cb11951ac51d80e2(__context__,das_arg<TArray<void *>>::pass(__batch_rename_at_136),das_cast<void *>::cast(__heap_data_rename_at_139));
+		}
+		__d_iterator.close(__context__,(__d_rename_at_138));
+	};
+	lockFreeChannelPushBatch(__channel_rename_at_133,das_arg<TArray<void *>>::pass(__batch_rename_at_136),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	_Funcbuiltin_0x60_finalize_d82479d0972b3594(__context__,das_arg<TArray<void *>>::pass(__batch_rename_at_136));
+}
+
+inline void _Func_lambda_thismodule_53_20_4_0x60_function_4f43d954fa01c3b0 ( Context * __context__, _lambda_thismodule_53_20_4 &  ____this_rename_at_53 )
+{
+/* finally */ auto __finally_53= das_finally([&](){
+	das_invoke_function<void>::invoke<LockFreeChannel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::release_capture_jobque_lock_free_channel C1<H<jobque::LockFreeChannel>>?*/ 5296560203819340390u)),____this_rename_at_53.channel);
+/* end finally */ });
+	{
+		bool __need_loop_53 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_53;
+		__need_loop_53 = __t_iterator.first(__context__,(__t_rename_at_53)) && __need_loop_53;
+		for ( ; __need_loop_53 ; __need_loop_53 = __t_iterator.next(__context__,(__t_rename_at_53)) )
+		{
+			Work _temp_make_local_54_48;
+			_Funcjobque_boost_0x60_push_clone_892b0b909365e37e(__context__,____this_rename_at_53.channel,das_arg<Work>::pass((([&]() -> Work& {
+				das_copy((_temp_make_local_54_48.x),(____this_rename_at_53.x));
+				das_copy((_temp_make_local_54_48.t),(__t_rename_at_53));
+				return _temp_make_local_54_48;
+			})())));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_53));
+	};
+	_Funcjobque_boost_0x60_push_batch_clone_8a4063ef87aa5504(__context__,____this_rename_at_53.channel,das_arg<TArray<Work>>::pass(das_invoke<TArray<Work>>::invoke_cmres(__context__,nullptr,[&]()->TArray<Work>{
+		TArray<Work> ____acomp_55_rename_at_55; das_zero(____acomp_55_rename_at_55);
+		{
+			bool __need_loop_55 = true;
+			// t : int const
+			das_iterator<range> __t_iterator(range(0,3));
+			int32_t __t_rename_at_55;
+			__need_loop_55 = __t_iterator.first(__context__,(__t_rename_at_55)) && __need_loop_55;
+			for ( ; __need_loop_55 ; __need_loop_55 = __t_iterator.next(__context__,(__t_rename_at_55)) )
+			{
+				Work _temp_make_local_55_208;
+				_Funcbuiltin_0x60_push_72088d13f08990d7(__context__,das_arg<TArray<Work>>::pass(____acomp_55_rename_at_55),das_arg<Work>::pass((([&]() -> Work& {
+					das_copy((_temp_make_local_55_208.x),(____this_rename_at_53.x));
+					das_copy((_temp_make_local_55_208.t),(__t_rename_at_55));
+					return _temp_make_local_55_208;
+				})())));
+			}
+			__t_iterator.close(__context__,(__t_rename_at_55));
+		};
+		return /* <- */ das_auto_cast_move<TArray<Work>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_252f2f5383e1d0c5(__context__,das_arg<TArray<Work>>::pass(____acomp_55_rename_at_55)));
+	})));
+	notifyAndReleaseLockFreeChannel(____this_rename_at_53.channel,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_53_20_4_0x60_finalizer_4836ba52174ad6ba ( Context * __context__, _lambda_thismodule_53_20_4 * ____this_rename_at_53 )
+{
+	finalize_27b636d7445827fb(__context__,das_arg<_lambda_thismodule_53_20_4>::pass(das_deref(__context__,____this_rename_at_53)));
+	das_delete_lambda_struct<_lambda_thismodule_53_20_4 *>::clear(__context__,____this_rename_at_53);
+}
+
+inline void _Funcjobque_boost_0x60_for_each_27f1b49b926ed269 ( Context * __context__, LockFreeChannel * const  __channel_rename_at_146, Block DAS_COMMENT((void,Work const )) const  &  __blk_rename_at_146 )
+{
+	TArray<void *> __batch_rename_at_150; das_zero(__batch_rename_at_150);
+	while ( lockFreeChannelPopBatch(__channel_rename_at_146,das_arg<TArray<void *>>::pass(__batch_rename_at_150),64,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) != 0 )
+	{
+		{
+			bool __need_loop_152 = true;
+			// void_data : void?&
+			das_iterator<TArray<void *>> __void_data_iterator(__batch_rename_at_150);
+			void * * __void_data_rename_at_152;
+			__need_loop_152 = __void_data_iterator.first(__context__,(__void_data_rename_at_152)) && __need_loop_152;
+			for ( ; __need_loop_152 ; __need_loop_152 = __void_data_iterator.next(__context__,(__void_data_rename_at_152)) )
+			{
+				Work const  * __typed_data_rename_at_154 = ((Work const  *)das_cast<Work const  *>::cast((*__void_data_rename_at_152)));
+				das_invoke<void>::invoke<Work const  &>(__context__,nullptr,__blk_rename_at_146,das_deref(__context__,__typed_data_rename_at_154));
+			}
+			__void_data_iterator.close(__context__,(__void_data_rename_at_152));
+		};
+	};
+	_Funcbuiltin_0x60_finalize_d82479d0972b3594(__context__,das_arg<TArray<void *>>::pass(__batch_rename_at_150));
+}
+
+inline bool _Funcjobque_boost_0x60_try_push_clone_22c52beb62b8d696 ( Context * __context__, LockFreeChannel * const  __channel_rename_at_114, Work const  &  __data_rename_at_114 )
+{
+	Work * __heap_data_rename_at_117 = das_new<Work>::make(__context__);
+	das_copy(das_deref(__context__,__heap_data_rename_at_117),__data_rename_at_114);
+	if ( lockFreeChannelTryPush(__channel_rename_at_114,das_auto_cast<void * const >::cast(__heap_data_rename_at_117),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) )
+	{
+		return das_auto_cast<bool>::cast(true);
+	} else {
+		finalize_d4a58e3b1bdba5bc(__context__,__heap_data_rename_at_117);
+		return das_auto_cast<bool>::cast(false);
+	};
+}
+
+inline bool _Funcjobque_boost_0x60_try_pop_f762fb5e736859b1 ( Context * __context__, LockFreeChannel * const  __channel_rename_at_158, Block DAS_COMMENT((void,Work const )) const  &  __blk_rename_at_158 )
+{
+	void * __void_data_rename_at_161 = ((void *)lockFreeChannelTryPop(__channel_rename_at_158,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+	if ( __void_data_rename_at_161 == nullptr )
+	{
+		return das_auto_cast<bool>::cast(false);
+	} else {
+		Work const  * __typed_data_rename_at_165 = ((Work const  *)das_cast<Work const  *>::cast(__void_data_rename_at_161));
+		das_invoke<void>::invoke<Work const  &>(__context__,nullptr,__blk_rename_at_158,das_deref(__context__,__typed_data_rename_at_165));
+		return das_auto_cast<bool>::cast(true);
+	};
+}
+
+inline void _Func_lambda_thismodule_79_20_5_0x60_function_c4d5385ccdb7d99 ( Context * __context__, _lambda_thismodule_79_20_5 &  ____this_rename_at_79 )
+{
+/* finally */ auto __finally_79= das_finally([&](){
+	das_invoke_function<void>::invoke<JobStatus * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::release_capture_jobque_job_status C1<H<jobque::JobStatus>>?*/ 13882985380930343467u)),____this_rename_at_79.status);
+/* end finally */ });
+	DAS_ASSERT((das_global<int32_t,0xdd9cd8b28c4f1767>(__context__) /*g_job_global*/ == 1));
+	das_copy(das_global<int32_t,0xdd9cd8b28c4f1767>(__context__) /*g_job_global*/,____this_rename_at_79.x + 2);
+	notifyAndReleaseJob(____this_rename_at_79.status,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_79_20_5_0x60_finalizer_d9081e32d2ad474 ( Context * __context__, _lambda_thismodule_79_20_5 * ____this_rename_at_79 )
+{
+	finalize_93243fba5b8dfb7a(__context__,das_arg<_lambda_thismodule_79_20_5>::pass(das_deref(__context__,____this_rename_at_79)));
+	das_delete_lambda_struct<_lambda_thismodule_79_20_5 *>::clear(__context__,____this_rename_at_79);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_399 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_399),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_4da34799ba0520c5 ( Context * __context__, TArray<float> &  __a_rename_at_399 )
+{
+	builtin_array_free(das_arg<TArray<float>>::pass(__a_rename_at_399),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcjobque_boost_0x60_parallel_map_431dccd551bb2775 ( Context * __context__, TArray<int32_t> const  &  __input_rename_at_181, TArray<float> &  __output_rename_at_181, Block DAS_COMMENT((float,int32_t)) const  &  __blk_rename_at_181 )
+{
+	int32_t __chunk_rename_at_184 = ((int32_t)(SimPolicy<int32_t>::Div(builtin_array_size(__input_rename_at_181),(getTotalHwJobs(__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) * 4),*__context__,nullptr)));
+	_Funcjobque_boost_0x60_parallel_map_9b405b37d4e481e1(__context__,__input_rename_at_181,das_arg<TArray<float>>::pass(__output_rename_at_181),(__chunk_rename_at_184 > 1) ? das_auto_cast<int32_t>::cast(__chunk_rename_at_184) : das_auto_cast<int32_t>::cast(1),__blk_rename_at_181);
+}
+
+inline bool test_dff0cea6facb6ed8 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,1376,"test " DAS_FILE_LINE);
+{
+	withJobQue(das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]()->void{
+		withJobStatus(5,das_make_block<void,JobStatus *>(__context__,128,0,&__func_info__e3ccd7343d92b33,[&](JobStatus * __status_rename_at_14)->void{
+			{
+				bool __need_loop_15 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,5));
+				int32_t __x_rename_at_15;
+				__need_loop_15 = __x_iterator.first(__context__,(__x_rename_at_15)) && __need_loop_15;
+				for ( ; __need_loop_15 ; __need_loop_15 = __x_iterator.next(__context__,(__x_rename_at_15)) )
+				{
+					TArray<int32_t> __y_rename_at_16; das_zero(__y_rename_at_16); das_move(__y_rename_at_16, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]()->TArray<int32_t>{
+						TArray<int32_t> ____acomp_16_rename_at_16; das_zero(____acomp_16_rename_at_16);
+						{
+							bool __need_loop_16 = true;
+							// t : int const
+							das_iterator<range> __t_iterator(range(0,3));
+							int32_t __t_rename_at_16;
+							__need_loop_16 = __t_iterator.first(__context__,(__t_rename_at_16)) && __need_loop_16;
+							for ( ; __need_loop_16 ; __need_loop_16 = __t_iterator.next(__context__,(__t_rename_at_16)) )
+							{
+								_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____acomp_16_rename_at_16),__t_rename_at_16 + __x_rename_at_15);
+							}
+							__t_iterator.close(__context__,(__t_rename_at_16));
+						};
+						return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(____acomp_16_rename_at_16)));
+					}));
+					new_job_invoke(das_ascend<void,_lambda_thismodule_18_20_1>::make(__context__,&__type_info__9f2b89ea82b475bc,(([&]() -> _lambda_thismodule_18_20_1 {
+						_lambda_thismodule_18_20_1 __mks_18;
+						das_copy((__mks_18.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_18_20_1`function XS<::_lambda_thismodule_18_20_1>*/ 16169966985493263794u))));
+						das_copy((__mks_18.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_18_20_1`finalizer X1<S<::_lambda_thismodule_18_20_1>>?*/ 10530847169005301916u))));
+						das_copy((__mks_18.status),(das_invoke_function<JobStatus *>::invoke<JobStatus * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::capture_jobque_job_status C1<H<jobque::JobStatus>>?*/ 15451494409577770137u)),__status_rename_at_14)));
+						das_copy((__mks_18.x),(__x_rename_at_15));
+						das_move((__mks_18.y),(__y_rename_at_16));
+						return __mks_18;
+					})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_18_20_1_new_job_clone> CIS<::_lambda_thismodule_18_20_1_new_job_clone>*/ 14428750939509508546u)),56,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_15));
+			};
+			waitForJob(__status_rename_at_14,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		withChannelEx(5,das_make_block<void,Channel *>(__context__,368,0,&__func_info__cfb81a8365a0ae64,[&](Channel * __channel_rename_at_24)->void{
+			{
+				bool __need_loop_25 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,5));
+				int32_t __x_rename_at_25;
+				__need_loop_25 = __x_iterator.first(__context__,(__x_rename_at_25)) && __need_loop_25;
+				for ( ; __need_loop_25 ; __need_loop_25 = __x_iterator.next(__context__,(__x_rename_at_25)) )
+				{
+					new_job_invoke(das_ascend<void,_lambda_thismodule_27_20_2>::make(__context__,&__type_info__2f8f0e5ea918b191,(([&]() -> _lambda_thismodule_27_20_2 {
+						_lambda_thismodule_27_20_2 __mks_27;
+						das_copy((__mks_27.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_27_20_2`function XS<::_lambda_thismodule_27_20_2>*/ 17459409851406830868u))));
+						das_copy((__mks_27.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_27_20_2`finalizer X1<S<::_lambda_thismodule_27_20_2>>?*/ 17510185269841402216u))));
+						das_copy((__mks_27.channel),(das_invoke_function<Channel *>::invoke<Channel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::capture_jobque_channel C1<H<jobque::Channel>>?*/ 14129945787985015456u)),__channel_rename_at_24)));
+						das_copy((__mks_27.x),(__x_rename_at_25));
+						return __mks_27;
+					})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_27_20_2_new_job_clone> CIS<::_lambda_thismodule_27_20_2_new_job_clone>*/ 4154571324442380910u)),32,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_25));
+			};
+			int32_t __summ_rename_at_30 = 0;
+			_Funcjobque_boost_0x60_for_each_1b27909a068e107(__context__,__channel_rename_at_24,das_make_block<void,Work const  &>(__context__,480,0,&__func_info__3ad0a31d00c9d958,[&](Work const  & __w_rename_at_31)->void{
+				__summ_rename_at_30 += (__w_rename_at_31.x * __w_rename_at_31.t);
+			}));
+			DAS_ASSERT((__summ_rename_at_30 == 30));
+			DAS_ASSERT((__channel_rename_at_24->isEmpty() /*isEmpty*/));
+			DAS_ASSERT((__channel_rename_at_24->isReady() /*isReady*/));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		withChannelEx(5,das_make_block<void,Channel *>(__context__,544,0,&__func_info__cfb81a8365a0ae64,[&](Channel * __channel_rename_at_37)->void{
+			Sequence DAS_COMMENT((Work *)) _temp_make_local_44_608;
+			{
+				bool __need_loop_38 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,5));
+				int32_t __x_rename_at_38;
+				__need_loop_38 = __x_iterator.first(__context__,(__x_rename_at_38)) && __need_loop_38;
+				for ( ; __need_loop_38 ; __need_loop_38 = __x_iterator.next(__context__,(__x_rename_at_38)) )
+				{
+					new_job_invoke(das_ascend<void,_lambda_thismodule_40_20_3>::make(__context__,&__type_info__f06023ece159b613,(([&]() -> _lambda_thismodule_40_20_3 {
+						_lambda_thismodule_40_20_3 __mks_40;
+						das_copy((__mks_40.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_40_20_3`function XS<::_lambda_thismodule_40_20_3>*/ 10049017598949817564u))));
+						das_copy((__mks_40.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_40_20_3`finalizer X1<S<::_lambda_thismodule_40_20_3>>?*/ 4778043168710434616u))));
+						das_copy((__mks_40.channel),(das_invoke_function<Channel *>::invoke<Channel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::capture_jobque_channel C1<H<jobque::Channel>>?*/ 14129945787985015456u)),__channel_rename_at_37)));
+						das_copy((__mks_40.x),(__x_rename_at_38));
+						return __mks_40;
+					})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_40_20_3_new_job_clone> CIS<::_lambda_thismodule_40_20_3_new_job_clone>*/ 7154084990287745442u)),32,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_38));
+			};
+			int32_t __summ_rename_at_43 = 0;
+			{
+				bool __need_loop_44 = true;
+				// w : Work const&#
+				das_iterator<Sequence DAS_COMMENT((Work const ))> __w_iterator((_temp_make_local_44_608 = (_Func_0x60_template_0x60_0x9ae6ef0237d899a0_0x60_jobque_boost_0x60_each_53b02f08b1683c07(__context__,__channel_rename_at_37))));
+				Work const  * __w_rename_at_44;
+				__need_loop_44 = __w_iterator.first(__context__,(__w_rename_at_44)) && __need_loop_44;
+				for ( ; __need_loop_44 ; __need_loop_44 = __w_iterator.next(__context__,(__w_rename_at_44)) )
+				{
+					__summ_rename_at_43 += ((*__w_rename_at_44).x * (*__w_rename_at_44).t);
+				}
+				__w_iterator.close(__context__,(__w_rename_at_44));
+			};
+			DAS_ASSERT((__summ_rename_at_43 == 30));
+			DAS_ASSERT((__channel_rename_at_37->isEmpty() /*isEmpty*/));
+			DAS_ASSERT((__channel_rename_at_37->isReady() /*isReady*/));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		withLockFreeChannel(16,5,false,das_make_block<void,LockFreeChannel *>(__context__,688,0,&__func_info__bdb5fc9c51b78a78,[&](LockFreeChannel * __channel_rename_at_50)->void{
+			{
+				bool __need_loop_51 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,5));
+				int32_t __x_rename_at_51;
+				__need_loop_51 = __x_iterator.first(__context__,(__x_rename_at_51)) && __need_loop_51;
+				for ( ; __need_loop_51 ; __need_loop_51 = __x_iterator.next(__context__,(__x_rename_at_51)) )
+				{
+					new_job_invoke(das_ascend<void,_lambda_thismodule_53_20_4>::make(__context__,&__type_info__2fd4cf229b743e84,(([&]() -> _lambda_thismodule_53_20_4 {
+						_lambda_thismodule_53_20_4 __mks_53;
+						das_copy((__mks_53.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_53_20_4`function XS<::_lambda_thismodule_53_20_4>*/ 5811131861911589038u))));
+						das_copy((__mks_53.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_53_20_4`finalizer X1<S<::_lambda_thismodule_53_20_4>>?*/ 18181128242145467544u))));
+						das_copy((__mks_53.channel),(das_invoke_function<LockFreeChannel *>::invoke<LockFreeChannel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::capture_jobque_lock_free_channel C1<H<jobque::LockFreeChannel>>?*/ 11452516802089387932u)),__channel_rename_at_50)));
+						das_copy((__mks_53.x),(__x_rename_at_51));
+						return __mks_53;
+					})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_53_20_4_new_job_clone> CIS<::_lambda_thismodule_53_20_4_new_job_clone>*/ 6768971230756227622u)),32,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_51));
+			};
+			int32_t __summ_rename_at_57 = 0;
+			_Funcjobque_boost_0x60_for_each_27f1b49b926ed269(__context__,__channel_rename_at_50,das_make_block<void,Work const  &>(__context__,800,0,&__func_info__3ad0a31d00c9d958,[&](Work const  & __w_rename_at_58)->void{
+				__summ_rename_at_57 += (__w_rename_at_58.x * __w_rename_at_58.t);
+			}));
+			DAS_ASSERT((__summ_rename_at_57 == 60));
+			DAS_ASSERT((__channel_rename_at_50->isEmpty() /*isEmpty*/));
+			DAS_ASSERT((__channel_rename_at_50->isReady() /*isReady*/));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		withLockFreeChannel(2,0,true,das_make_block<void,LockFreeChannel *>(__context__,864,0,&__func_info__bdb5fc9c51b78a78,[&](LockFreeChannel * __channel_rename_at_64)->void{
+			Work _temp_make_local_66_880;
+			Work _temp_make_local_67_896;
+			Work _temp_make_local_68_912;
+			DAS_ASSERT((__channel_rename_at_64->capacity() /*capacity*/ == 2));
+			DAS_VERIFY((_Funcjobque_boost_0x60_try_push_clone_22c52beb62b8d696(__context__,__channel_rename_at_64,das_arg<Work>::pass((([&]() -> Work& {
+				das_copy((_temp_make_local_66_880.x),(1));
+				das_copy((_temp_make_local_66_880.t),(2));
+				return _temp_make_local_66_880;
+			})())))));
+			DAS_VERIFY((_Funcjobque_boost_0x60_try_push_clone_22c52beb62b8d696(__context__,__channel_rename_at_64,das_arg<Work>::pass((([&]() -> Work& {
+				das_copy((_temp_make_local_67_896.x),(3));
+				das_copy((_temp_make_local_67_896.t),(4));
+				return _temp_make_local_67_896;
+			})())))));
+			DAS_VERIFY((!_Funcjobque_boost_0x60_try_push_clone_22c52beb62b8d696(__context__,__channel_rename_at_64,das_arg<Work>::pass((([&]() -> Work& {
+				das_copy((_temp_make_local_68_912.x),(5));
+				das_copy((_temp_make_local_68_912.t),(6));
+				return _temp_make_local_68_912;
+			})())))));
+			int32_t __summ_rename_at_69 = 0;
+			bool __popped_rename_at_70 = true;
+			while ( __popped_rename_at_70 )
+			{
+				das_copy(__popped_rename_at_70,_Funcjobque_boost_0x60_try_pop_f762fb5e736859b1(__context__,__channel_rename_at_64,das_make_block<void,Work const  &>(__context__,1008,0,&__func_info__3ad0a31d00c9d958,[&](Work const  & __w_rename_at_72)->void{
+					__summ_rename_at_69 += (__w_rename_at_72.x * __w_rename_at_72.t);
+				})));
+			};
+			DAS_ASSERT((__summ_rename_at_69 == 14));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		{
+			bool __need_loop_76 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,5));
+			int32_t __x_rename_at_76;
+			__need_loop_76 = __x_iterator.first(__context__,(__x_rename_at_76)) && __need_loop_76;
+			for ( ; __need_loop_76 ; __need_loop_76 = __x_iterator.next(__context__,(__x_rename_at_76)) )
+			{
+				withJobStatus(1,das_make_block<void,JobStatus *>(__context__,1088,0,&__func_info__e3ccd7343d92b33,[&](JobStatus * __status_rename_at_77)->void{
+					new_job_invoke(das_ascend<void,_lambda_thismodule_79_20_5>::make(__context__,&__type_info__7000e4b70a9e5461,(([&]() -> _lambda_thismodule_79_20_5 {
+						_lambda_thismodule_79_20_5 __mks_79;
+						das_copy((__mks_79.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_79_20_5`function XS<::_lambda_thismodule_79_20_5>*/ 6951288359745468108u))));
+						das_copy((__mks_79.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_79_20_5`finalizer X1<S<::_lambda_thismodule_79_20_5>>?*/ 2046384316396267924u))));
+						das_copy((__mks_79.status),(das_invoke_function<JobStatus *>::invoke<JobStatus * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::capture_jobque_job_status C1<H<jobque::JobStatus>>?*/ 15451494409577770137u)),__status_rename_at_77)));
+						das_copy((__mks_79.x),(__x_rename_at_76));
+						return __mks_79;
+					})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_79_20_5_new_job_clone> CIS<::_lambda_thismodule_79_20_5_new_job_clone>*/ 14365374442478240618u)),32,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+					waitForJob(__status_rename_at_77,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_76));
+		};
+		DAS_ASSERT((das_global<int32_t,0xdd9cd8b28c4f1767>(__context__) /*g_job_global*/ == 1));
+		TArray<int32_t> __squares_rename_at_86; das_zero(__squares_rename_at_86);
+		_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__squares_rename_at_86),1000);
+		parallelFor(0,1000,16,das_make_block<void,int32_t,int32_t>(__context__,1200,0,&__func_info__27bbd6f96acc8444,[&](int32_t __i0_rename_at_88, int32_t __i1_rename_at_88)->void{
+			{
+				bool __need_loop_89 = true;
+				// i : int const
+				das_iterator<range> __i_iterator(range(__i0_rename_at_88,__i1_rename_at_88));
+				int32_t __i_rename_at_89;
+				__need_loop_89 = __i_iterator.first(__context__,(__i_rename_at_89)) && __need_loop_89;
+				for ( ; __need_loop_89 ; __need_loop_89 = __i_iterator.next(__context__,(__i_rename_at_89)) )
+				{
+					das_copy(__squares_rename_at_86(__i_rename_at_89,__context__),(__i_rename_at_89 * __i_rename_at_89) * 3);
+				}
+				__i_iterator.close(__context__,(__i_rename_at_89));
+			};
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		{
+			bool __need_loop_91 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_91;
+			__need_loop_91 = __i_iterator.first(__context__,(__i_rename_at_91)) && __need_loop_91;
+			for ( ; __need_loop_91 ; __need_loop_91 = __i_iterator.next(__context__,(__i_rename_at_91)) )
+			{
+				DAS_ASSERT((__squares_rename_at_86(__i_rename_at_91,__context__) == ((__i_rename_at_91 * __i_rename_at_91) * 3)));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_91));
+		};
+		TArray<float> __halves_rename_at_94; das_zero(__halves_rename_at_94);
+		_Funcjobque_boost_0x60_parallel_map_431dccd551bb2775(__context__,das_arg<TArray<int32_t>>::pass(__squares_rename_at_86),das_arg<TArray<float>>::pass(__halves_rename_at_94),das_make_block<float,int32_t>(__context__,1328,0,&__func_info__3b3f908fa21851e2,[&](int32_t const  __v_rename_at_95)->float{
+			return das_auto_cast<float>::cast(float(__v_rename_at_95) * 0.5f);
+		}));
+		DAS_ASSERT((builtin_array_size(das_arg<TArray<float>>::pass(__halves_rename_at_94)) == 1000));
+		{
+			bool __need_loop_98 = true;
+			// v : int&
+			das_iterator<TArray<int32_t>> __v_iterator(__squares_rename_at_86);
+			int32_t * __v_rename_at_98;
+			__need_loop_98 = __v_iterator.first(__context__,(__v_rename_at_98)) && __need_loop_98;
+			// h : float&
+			das_iterator<TArray<float>> __h_iterator(__halves_rename_at_94);
+			float * __h_rename_at_98;
+			__need_loop_98 = __h_iterator.first(__context__,(__h_rename_at_98)) && __need_loop_98;
+			for ( ; __need_loop_98 ; __need_loop_98 = __v_iterator.next(__context__,(__v_rename_at_98)) && __h_iterator.next(__context__,(__h_rename_at_98)) )
+			{
+				DAS_ASSERT(((float((*__v_rename_at_98)) * 0.5f) == (*__h_rename_at_98)));
+			}
+			__v_iterator.close(__context__,(__v_rename_at_98));
+			__h_iterator.close(__context__,(__h_rename_at_98));
+		};
+		_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__squares_rename_at_86));
+		_Funcbuiltin_0x60_finalize_4da34799ba0520c5(__context__,das_arg<TArray<float>>::pass(__halves_rename_at_94));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_d240579333227022
+	aotLib[0x40d6b5552dd22f51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , int32_t  ),&_Funcbuiltin_0x60_resize_d240579333227022>>();
+	};
+	// _Funcbuiltin_0x60_clone_7775f70b42a34990
+	aotLib[0xbde965effb9cac8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_7775f70b42a34990>>();
+	};
+	// finalize_baab685a83a370b7
+	aotLib[0xbb6e742ffba9ead1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_98_12_6 &  ),&finalize_baab685a83a370b7>>();
+	};
+	// finalize_35cbbf7257c44c0
+	aotLib[0x6b52564df0acd5c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Work &  ),&finalize_35cbbf7257c44c0>>();
+	};
+	// _Funcbuiltin_0x60_each_ref_d7642bb9cae45024
+	aotLib[0xb4a3fcd5f7a65399] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((Work const  &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,Work const  * &)) const   ),&_Funcbuiltin_0x60_each_ref_d7642bb9cae45024>>();
+	};
+	// _Funcbuiltin_0x60_finalize_d82479d0972b3594
+	aotLib[0x49943681ec84e1a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<void *> &  ),&_Funcbuiltin_0x60_finalize_d82479d0972b3594>>();
+	};
+	// finalize_972ca8ae057d618f
+	aotLib[0xcc5294d51bff3415] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_18_20_1 &  ),&finalize_972ca8ae057d618f>>();
+	};
+	// finalize_c88db3a3fc2bd8de
+	aotLib[0xf10a3d13feff0bf9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_27_20_2 &  ),&finalize_c88db3a3fc2bd8de>>();
+	};
+	// finalize_1cf9baf2b038ad20
+	aotLib[0x657b72e188efea49] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_40_20_3 &  ),&finalize_1cf9baf2b038ad20>>();
+	};
+	// _Func_lambda_thismodule_98_12_6_0x60_function_a455fb0e79485024
+	aotLib[0x9f23d347f64bcef9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_98_12_6 & , Work const  * &  ),&_Func_lambda_thismodule_98_12_6_0x60_function_a455fb0e79485024>>();
+	};
+	// _Func_lambda_thismodule_98_12_6_0x60_finalizer_34f255a12c773042
+	aotLib[0xc253dffa65b3ceef] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_98_12_6 *  ),&_Func_lambda_thismodule_98_12_6_0x60_finalizer_34f255a12c773042>>();
+	};
+	// _Funcbuiltin_0x60_reserve_5080f51a18b25959
+	aotLib[0xc218eb2a70cba065] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<void *> & , int32_t  ),&_Funcbuiltin_0x60_reserve_5080f51a18b25959>>();
+	};
+	// _Funcbuiltin_0x60_push_cb11951ac51d80e2
+	aotLib[0xfc096587e52e11ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<void *> & , void * const   ),&_Funcbuiltin_0x60_push_cb11951ac51d80e2>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_252f2f5383e1d0c5
+	aotLib[0x3256d674208cbf55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<Work> & (*) ( Context * __context__, TArray<Work> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_252f2f5383e1d0c5>>();
+	};
+	// finalize_27b636d7445827fb
+	aotLib[0xc714ec14c1600be5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_53_20_4 &  ),&finalize_27b636d7445827fb>>();
+	};
+	// finalize_d4a58e3b1bdba5bc
+	aotLib[0x386692c55d5e195] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Work * &  ),&finalize_d4a58e3b1bdba5bc>>();
+	};
+	// finalize_93243fba5b8dfb7a
+	aotLib[0x9a68c42e32e3e575] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_79_20_5 &  ),&finalize_93243fba5b8dfb7a>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd
+	aotLib[0x66e322246598e835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> & (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd>>();
+	};
+	// clone_7498ed4435e69a51
+	aotLib[0x2a21f4490e705dbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_18_20_1_new_job_clone & , _lambda_thismodule_18_20_1_new_job_clone const  &  ),&clone_7498ed4435e69a51>>();
+	};
+	// clone_7e7382ae80121839
+	aotLib[0x7c7198758a889ba5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_27_20_2_new_job_clone & , _lambda_thismodule_27_20_2_new_job_clone const  &  ),&clone_7e7382ae80121839>>();
+	};
+	// clone_513329cb28e97af1
+	aotLib[0xe8c74ae7812b918d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_40_20_3_new_job_clone & , _lambda_thismodule_40_20_3_new_job_clone const  &  ),&clone_513329cb28e97af1>>();
+	};
+	// _Func_0x60_template_0x60_0x9ae6ef0237d899a0_0x60_jobque_boost_0x60_each_53b02f08b1683c07
+	aotLib[0xd1398bc588b3ad1c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((Work const  &)) (*) ( Context * __context__, Channel *  ),&_Func_0x60_template_0x60_0x9ae6ef0237d899a0_0x60_jobque_boost_0x60_each_53b02f08b1683c07>>();
+	};
+	// clone_c9405317ec45866b
+	aotLib[0xa5aeb27e5f14a36d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_53_20_4_new_job_clone & , _lambda_thismodule_53_20_4_new_job_clone const  &  ),&clone_c9405317ec45866b>>();
+	};
+	// clone_ad6a4885f11023d9
+	aotLib[0xabfedadb74c31049] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_79_20_5_new_job_clone & , _lambda_thismodule_79_20_5_new_job_clone const  &  ),&clone_ad6a4885f11023d9>>();
+	};
+	// _Funcjobque_boost_0x60_parallel_map_9b405b37d4e481e1
+	aotLib[0xae7e62b85c136fcc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  & , TArray<float> & , int32_t , Block DAS_COMMENT((float,int32_t)) const  &  ),&_Funcjobque_boost_0x60_parallel_map_9b405b37d4e481e1>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Func_lambda_thismodule_18_20_1_0x60_function_d1142320cc7116ac
+	aotLib[0x5c8d9a3f6f3b8efd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_18_20_1 &  ),&_Func_lambda_thismodule_18_20_1_0x60_function_d1142320cc7116ac>>();
+	};
+	// _Func_lambda_thismodule_18_20_1_0x60_finalizer_49626a8351ffc67a
+	aotLib[0x23ba4262f8ecfbc8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_18_20_1 *  ),&_Func_lambda_thismodule_18_20_1_0x60_finalizer_49626a8351ffc67a>>();
+	};
+	// _Funcjobque_boost_0x60_push_clone_81bdf1aab41cbc7e
+	aotLib[0xce3f4096fab44535] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Channel * const  , Work const  &  ),&_Funcjobque_boost_0x60_push_clone_81bdf1aab41cbc7e>>();
+	};
+	// _Func_lambda_thismodule_27_20_2_0x60_function_cbb35cb4fe7d3884
+	aotLib[0x7dca5a52f0a1b750] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_27_20_2 &  ),&_Func_lambda_thismodule_27_20_2_0x60_function_cbb35cb4fe7d3884>>();
+	};
+	// _Func_lambda_thismodule_27_20_2_0x60_finalizer_599b344a046d7c88
+	aotLib[0x79368e970385e96f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_27_20_2 *  ),&_Func_lambda_thismodule_27_20_2_0x60_finalizer_599b344a046d7c88>>();
+	};
+	// _Funcjobque_boost_0x60_for_each_1b27909a068e107
+	aotLib[0xa52be64f55eaa835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Channel * const  , Block DAS_COMMENT((void,Work const )) const  &  ),&_Funcjobque_boost_0x60_for_each_1b27909a068e107>>();
+	};
+	// _Func_lambda_thismodule_40_20_3_0x60_function_19188be2df78527a
+	aotLib[0x2c50009677168394] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_40_20_3 &  ),&_Func_lambda_thismodule_40_20_3_0x60_function_19188be2df78527a>>();
+	};
+	// _Func_lambda_thismodule_40_20_3_0x60_finalizer_58510cb32f454648
+	aotLib[0x52aeb6ce25dfcca7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_40_20_3 *  ),&_Func_lambda_thismodule_40_20_3_0x60_finalizer_58510cb32f454648>>();
+	};
+	// _Funcjobque_boost_0x60_push_clone_892b0b909365e37e
+	aotLib[0x1160bf932430171d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, LockFreeChannel * const  , Work const  &  ),&_Funcjobque_boost_0x60_push_clone_892b0b909365e37e>>();
+	};
+	// _Funcbuiltin_0x60_push_72088d13f08990d7
+	aotLib[0x77759b2892382d85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Work> & , Work const  &  ),&_Funcbuiltin_0x60_push_72088d13f08990d7>>();
+	};
+	// _Funcjobque_boost_0x60_push_batch_clone_8a4063ef87aa5504
+	aotLib[0xea2fc4fa1a5ee6b7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, LockFreeChannel * const  , TArray<Work> const  &  ),&_Funcjobque_boost_0x60_push_batch_clone_8a4063ef87aa5504>>();
+	};
+	// _Func_lambda_thismodule_53_20_4_0x60_function_4f43d954fa01c3b0
+	aotLib[0xb0d4c839409c4ace] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_53_20_4 &  ),&_Func_lambda_thismodule_53_20_4_0x60_function_4f43d954fa01c3b0>>();
+	};
+	// _Func_lambda_thismodule_53_20_4_0x60_finalizer_4836ba52174ad6ba
+	aotLib[0x91d8b94a46a6913d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_53_20_4 *  ),&_Func_lambda_thismodule_53_20_4_0x60_finalizer_4836ba52174ad6ba>>();
+	};
+	// _Funcjobque_boost_0x60_for_each_27f1b49b926ed269
+	aotLib[0x3f60f557cdd297ef] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, LockFreeChannel * const  , Block DAS_COMMENT((void,Work const )) const  &  ),&_Funcjobque_boost_0x60_for_each_27f1b49b926ed269>>();
+	};
+	// _Funcjobque_boost_0x60_try_push_clone_22c52beb62b8d696
+	aotLib[0xf4f45535c42ca984] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, LockFreeChannel * const  , Work const  &  ),&_Funcjobque_boost_0x60_try_push_clone_22c52beb62b8d696>>();
+	};
+	// _Funcjobque_boost_0x60_try_pop_f762fb5e736859b1
+	aotLib[0x18856e91762f52d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, LockFreeChannel * const  , Block DAS_COMMENT((void,Work const )) const  &  ),&_Funcjobque_boost_0x60_try_pop_f762fb5e736859b1>>();
+	};
+	// _Func_lambda_thismodule_79_20_5_0x60_function_c4d5385ccdb7d99
+	aotLib[0x36727e8ff2b784a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_79_20_5 &  ),&_Func_lambda_thismodule_79_20_5_0x60_function_c4d5385ccdb7d99>>();
+	};
+	// _Func_lambda_thismodule_79_20_5_0x60_finalizer_d9081e32d2ad474
+	aotLib[0x2615a30e5b6a11dc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_79_20_5 *  ),&_Func_lambda_thismodule_79_20_5_0x60_finalizer_d9081e32d2ad474>>();
+	};
+	// _Funcbuiltin_0x60_finalize_c5f896860856389a
+	aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+	// _Funcbuiltin_0x60_finalize_4da34799ba0520c5
+	aotLib[0xbd5f701fe616ff75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Funcbuiltin_0x60_finalize_4da34799ba0520c5>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcjobque_boost_0x60_parallel_map_431dccd551bb2775
+	aotLib[0x3c651f070541965] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  & , TArray<float> & , Block DAS_COMMENT((float,int32_t)) const  &  ),&_Funcjobque_boost_0x60_parallel_map_431dccd551bb2775>>();
+	};
+	// test_dff0cea6facb6ed8
+	aotLib[0x72533820b5600661] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_dff0cea6facb6ed8>>();
+	};
+	// [[ init script ]]
+	aotLib[0x311bed75cbaf0857] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,360 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4157455559899168162 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline void _Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_156, int32_t __value_rename_at_156 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_937a16f0c7f42db ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_505 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_3253bd3cafce6f4e ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __it_rename_at_505 );
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_a87e3fc9767b4917 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_475 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_21403e111cb34d6b ( Context * __context__, TDim<int32_t,4> const  & __a_rename_at_511 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_451 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_8d3e07a4869384e6 ( Context * __context__, TDim<int32_t,4> const  & __a_rename_at_467 );
+inline bool test_ed1dd617f7f5df17 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_156, int32_t __value_rename_at_156 )
+{
+	das_copy(__Arr_rename_at_156(builtin_array_push_back_zero(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_156),4,__context__),__context__),__value_rename_at_156);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_937a16f0c7f42db ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_505 )
+{
+	TArray<int32_t> __arr_rename_at_506; das_zero(__arr_rename_at_506);
+	{
+		bool __need_loop_507 = true;
+		// x : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__it_rename_at_505);
+		int32_t __x_rename_at_507;
+		__need_loop_507 = __x_iterator.first(__context__,(__x_rename_at_507)) && __need_loop_507;
+		for ( ; __need_loop_507 ; __need_loop_507 = __x_iterator.next(__context__,(__x_rename_at_507)) )
+		{
+			_Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_506),__x_rename_at_507);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_507));
+	};
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_506);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_3253bd3cafce6f4e ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __it_rename_at_505 )
+{
+	TArray<int32_t> __arr_rename_at_506; das_zero(__arr_rename_at_506);
+	{
+		bool __need_loop_507 = true;
+		// x : int aka TT const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const )) const > __x_iterator(__it_rename_at_505);
+		int32_t const  * __x_rename_at_507;
+		__need_loop_507 = __x_iterator.first(__context__,(__x_rename_at_507)) && __need_loop_507;
+		for ( ; __need_loop_507 ; __need_loop_507 = __x_iterator.next(__context__,(__x_rename_at_507)) )
+		{
+			_Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_506),(*__x_rename_at_507));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_507));
+	};
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_506);
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_a87e3fc9767b4917 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_475 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_476; das_zero(__it_rename_at_476);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_476),__a_rename_at_475,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t &))>::cast(__it_rename_at_476);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_21403e111cb34d6b ( Context * __context__, TDim<int32_t,4> const  &  __a_rename_at_511 )
+{
+	TArray<int32_t> __arr_rename_at_512; das_zero(__arr_rename_at_512);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_512),4);
+	das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_512(0,__context__))),__a_rename_at_511);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_512);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_451 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_452; das_zero(__it_rename_at_452);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_452),__rng_rename_at_451,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_452);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_8d3e07a4869384e6 ( Context * __context__, TDim<int32_t,4> const  &  __a_rename_at_467 )
+{
+	void * __parr_rename_at_469 = das_cast<void *>::cast(das_ref(__context__,__a_rename_at_467(0,__context__)));
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_470; das_zero(__it_rename_at_470);
+	builtin_make_fixed_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_470),__parr_rename_at_469,4,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t const  &))>::cast(__it_rename_at_470);
+}
+
+inline bool test_ed1dd617f7f5df17 ( Context * __context__ )
+{
+	TDim<int32_t,4> _temp_make_local_5_80;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_9_128;
+	TArray<int32_t> _temp_make_local_11_176;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_11_208;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_15_256;
+	TArray<int32_t> _temp_make_local_17_304;
+	TArray<int32_t> _temp_make_local_20_368;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_20_400;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_24_448;
+	TArray<int32_t> _temp_make_local_27_496;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_27_528;
+	TDim<int32_t,4> __d_rename_at_4_ConstRef = ((TDim<int32_t,4>)(([&]() -> TDim<int32_t,4> {
+		TDim<int32_t,4> __mka_4;
+		__mka_4(0,__context__) = 1;
+		__mka_4(1,__context__) = 2;
+		__mka_4(2,__context__) = 3;
+		__mka_4(3,__context__) = 4;
+		return __mka_4;
+	})()));
+	TDim<int32_t,4> const  & __d_rename_at_4 = __d_rename_at_4_ConstRef; ;
+	TArray<int32_t> __a_rename_at_5_ConstRef; das_zero(__a_rename_at_5_ConstRef); das_move(__a_rename_at_5_ConstRef, ((TArray<int32_t>)_Funcbuiltin_0x60_to_array_21403e111cb34d6b(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_5_80(0,__context__) = 1;
+		_temp_make_local_5_80(1,__context__) = 2;
+		_temp_make_local_5_80(2,__context__) = 3;
+		_temp_make_local_5_80(3,__context__) = 4;
+		return _temp_make_local_5_80;
+	})())))));
+	TArray<int32_t> const  & __a_rename_at_5 = __a_rename_at_5_ConstRef; ;
+	{
+		bool __need_loop_6 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_4);
+		int32_t const  * __x_rename_at_6;
+		__need_loop_6 = __x_iterator.first(__context__,(__x_rename_at_6)) && __need_loop_6;
+		// y : int const&
+		das_iterator<TArray<int32_t> const > __y_iterator(__a_rename_at_5);
+		int32_t const  * __y_rename_at_6;
+		__need_loop_6 = __y_iterator.first(__context__,(__y_rename_at_6)) && __need_loop_6;
+		for ( ; __need_loop_6 ; __need_loop_6 = __x_iterator.next(__context__,(__x_rename_at_6)) && __y_iterator.next(__context__,(__y_rename_at_6)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_6) == (*__y_rename_at_6)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_6));
+		__y_iterator.close(__context__,(__y_rename_at_6));
+	};
+	{
+		bool __need_loop_9 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,5));
+		int32_t __x_rename_at_9;
+		__need_loop_9 = __x_iterator.first(__context__,(__x_rename_at_9)) && __need_loop_9;
+		// y : int
+		das_iterator<Sequence DAS_COMMENT((int32_t))> __y_iterator((_temp_make_local_9_128 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,5)))));
+		int32_t __y_rename_at_9;
+		__need_loop_9 = __y_iterator.first(__context__,(__y_rename_at_9)) && __need_loop_9;
+		for ( ; __need_loop_9 ; __need_loop_9 = __x_iterator.next(__context__,(__x_rename_at_9)) && __y_iterator.next(__context__,(__y_rename_at_9)) )
+		{
+			DAS_ASSERT((__x_rename_at_9 == __y_rename_at_9));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_9));
+		__y_iterator.close(__context__,(__y_rename_at_9));
+	};
+	{
+		bool __need_loop_11 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,5));
+		int32_t __x_rename_at_11;
+		__need_loop_11 = __x_iterator.first(__context__,(__x_rename_at_11)) && __need_loop_11;
+		// y : int&
+		das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_11_176 = (_Funcbuiltin_0x60_to_array_937a16f0c7f42db(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_11_208 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,5)))))))));
+		int32_t * __y_rename_at_11;
+		__need_loop_11 = __y_iterator.first(__context__,(__y_rename_at_11)) && __need_loop_11;
+		for ( ; __need_loop_11 ; __need_loop_11 = __x_iterator.next(__context__,(__x_rename_at_11)) && __y_iterator.next(__context__,(__y_rename_at_11)) )
+		{
+			DAS_ASSERT((__x_rename_at_11 == (*__y_rename_at_11)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_11));
+		__y_iterator.close(__context__,(__y_rename_at_11));
+	};
+	{
+		bool __need_loop_15 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_4);
+		int32_t const  * __x_rename_at_15;
+		__need_loop_15 = __x_iterator.first(__context__,(__x_rename_at_15)) && __need_loop_15;
+		// y : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __y_iterator((_temp_make_local_15_256 = (_Funcbuiltin_0x60_each_8d3e07a4869384e6(__context__,__d_rename_at_4))));
+		int32_t const  * __y_rename_at_15;
+		__need_loop_15 = __y_iterator.first(__context__,(__y_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __x_iterator.next(__context__,(__x_rename_at_15)) && __y_iterator.next(__context__,(__y_rename_at_15)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_15) == (*__y_rename_at_15)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_15));
+		__y_iterator.close(__context__,(__y_rename_at_15));
+	};
+	{
+		bool __need_loop_17 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_4);
+		int32_t const  * __x_rename_at_17;
+		__need_loop_17 = __x_iterator.first(__context__,(__x_rename_at_17)) && __need_loop_17;
+		// y : int&
+		das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_17_304 = (_Funcbuiltin_0x60_to_array_21403e111cb34d6b(__context__,__d_rename_at_4))));
+		int32_t * __y_rename_at_17;
+		__need_loop_17 = __y_iterator.first(__context__,(__y_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __x_iterator.next(__context__,(__x_rename_at_17)) && __y_iterator.next(__context__,(__y_rename_at_17)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_17) == (*__y_rename_at_17)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_17));
+		__y_iterator.close(__context__,(__y_rename_at_17));
+	};
+	{
+		bool __need_loop_20 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_4);
+		int32_t const  * __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		// y : int&
+		das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_20_368 = (_Funcbuiltin_0x60_to_array_3253bd3cafce6f4e(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_20_400 = (_Funcbuiltin_0x60_each_8d3e07a4869384e6(__context__,__d_rename_at_4))))))));
+		int32_t * __y_rename_at_20;
+		__need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) && __y_iterator.next(__context__,(__y_rename_at_20)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_20) == (*__y_rename_at_20)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+		__y_iterator.close(__context__,(__y_rename_at_20));
+	};
+	{
+		bool __need_loop_24 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_5);
+		int32_t const  * __x_rename_at_24;
+		__need_loop_24 = __x_iterator.first(__context__,(__x_rename_at_24)) && __need_loop_24;
+		// y : int&
+		das_iterator<Sequence DAS_COMMENT((int32_t))> __y_iterator((_temp_make_local_24_448 = (_Funcbuiltin_0x60_each_a87e3fc9767b4917(__context__,__a_rename_at_5))));
+		int32_t * __y_rename_at_24;
+		__need_loop_24 = __y_iterator.first(__context__,(__y_rename_at_24)) && __need_loop_24;
+		for ( ; __need_loop_24 ; __need_loop_24 = __x_iterator.next(__context__,(__x_rename_at_24)) && __y_iterator.next(__context__,(__y_rename_at_24)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_24) == (*__y_rename_at_24)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_24));
+		__y_iterator.close(__context__,(__y_rename_at_24));
+	};
+	{
+		bool __need_loop_27 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_5);
+		int32_t const  * __x_rename_at_27;
+		__need_loop_27 = __x_iterator.first(__context__,(__x_rename_at_27)) && __need_loop_27;
+		// y : int&
+		das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_27_496 = (_Funcbuiltin_0x60_to_array_3253bd3cafce6f4e(__context__,das_reinterpret<Sequence DAS_COMMENT((int32_t const )) const >::pass(das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_27_528 = (_Funcbuiltin_0x60_each_a87e3fc9767b4917(__context__,__a_rename_at_5)))))))));
+		int32_t * __y_rename_at_27;
+		__need_loop_27 = __y_iterator.first(__context__,(__y_rename_at_27)) && __need_loop_27;
+		for ( ; __need_loop_27 ; __need_loop_27 = __x_iterator.next(__context__,(__x_rename_at_27)) && __y_iterator.next(__context__,(__y_rename_at_27)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_27) == (*__y_rename_at_27)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_27));
+		__y_iterator.close(__context__,(__y_rename_at_27));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e
+	aotLib[0x683c44aa23b4b64d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_to_array_937a16f0c7f42db
+	aotLib[0xd5858834f9027884] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Funcbuiltin_0x60_to_array_937a16f0c7f42db>>();
+	};
+	// _Funcbuiltin_0x60_to_array_3253bd3cafce6f4e
+	aotLib[0x2dad29208df8d1dc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  ),&_Funcbuiltin_0x60_to_array_3253bd3cafce6f4e>>();
+	};
+	// _Funcbuiltin_0x60_each_a87e3fc9767b4917
+	aotLib[0xa9042b9c676edab5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t &)) (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_each_a87e3fc9767b4917>>();
+	};
+	// _Funcbuiltin_0x60_to_array_21403e111cb34d6b
+	aotLib[0x6ba55b6988e8c3f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,4> const  &  ),&_Funcbuiltin_0x60_to_array_21403e111cb34d6b>>();
+	};
+	// _Funcbuiltin_0x60_each_5cbab1dfe9635bc1
+	aotLib[0x8c2bf3089ff8b6f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_5cbab1dfe9635bc1>>();
+	};
+	// _Funcbuiltin_0x60_each_8d3e07a4869384e6
+	aotLib[0x101142aea18b327d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TDim<int32_t,4> const  &  ),&_Funcbuiltin_0x60_each_8d3e07a4869384e6>>();
+	};
+	// test_ed1dd617f7f5df17
+	aotLib[0x34b662843dfe8f79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_ed1dd617f7f5df17>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,160 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_2699074996864209031 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline TTable<int32_t,char *> _Funcbuiltin_0x60_to_table_7a70bc7883cc9bc0 ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> const  & __a_rename_at_542 );
+inline bool test_a3db90d7ecac03d9 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline TTable<int32_t,char *> _Funcbuiltin_0x60_to_table_7a70bc7883cc9bc0 ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> const  &  __a_rename_at_542 )
+{
+	TTable<int32_t,char *> __tab_rename_at_543; das_zero(__tab_rename_at_543);
+	{
+		bool __need_loop_544 = true;
+		// x : tuple<int aka keyT;string aka valT> const&
+		das_iterator<TDim<TTuple<16,int32_t,char *>,3> const > __x_iterator(__a_rename_at_542);
+		TTuple<16,int32_t,char *> const  * __x_rename_at_544;
+		__need_loop_544 = __x_iterator.first(__context__,(__x_rename_at_544)) && __need_loop_544;
+		for ( ; __need_loop_544 ; __need_loop_544 = __x_iterator.next(__context__,(__x_rename_at_544)) )
+		{
+			das_copy(__tab_rename_at_543(das_get_tuple_field<int32_t,0>::get((*__x_rename_at_544)),__context__),das_get_tuple_field<char *,8>::get((*__x_rename_at_544)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_544));
+	};
+	return /* <- */ das_auto_cast_move<TTable<int32_t,char *>>::cast(__tab_rename_at_543);
+}
+
+inline bool test_a3db90d7ecac03d9 ( Context * __context__ )
+{
+	TDim<TTuple<16,int32_t,char *>,3> _temp_make_local_4_128;
+	TDim<TTuple<16,int32_t,char *>,3> __a_rename_at_3_ConstRef = ((TDim<TTuple<16,int32_t,char *>,3>)(([&]() -> TDim<TTuple<16,int32_t,char *>,3> {
+		TDim<TTuple<16,int32_t,char *>,3> __mka_3;
+		__mka_3(0,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_3;
+			das_get_tuple_field<int32_t,0>::get(__mkt_3) = 1;
+			das_get_tuple_field<char *,8>::get(__mkt_3) = ((char *) "one");
+			return __mkt_3;
+		})());
+		__mka_3(1,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_3;
+			das_get_tuple_field<int32_t,0>::get(__mkt_3) = 2;
+			das_get_tuple_field<char *,8>::get(__mkt_3) = ((char *) "two");
+			return __mkt_3;
+		})());
+		__mka_3(2,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_3;
+			das_get_tuple_field<int32_t,0>::get(__mkt_3) = 3;
+			das_get_tuple_field<char *,8>::get(__mkt_3) = ((char *) "three");
+			return __mkt_3;
+		})());
+		return __mka_3;
+	})()));
+	TDim<TTuple<16,int32_t,char *>,3> const  & __a_rename_at_3 = __a_rename_at_3_ConstRef; ;
+	TTable<int32_t,char *> __b_rename_at_4; das_zero(__b_rename_at_4); das_move(__b_rename_at_4, _Funcbuiltin_0x60_to_table_7a70bc7883cc9bc0(__context__,das_arg<TDim<TTuple<16,int32_t,char *>,3>>::pass((([&]() -> TDim<TTuple<16,int32_t,char *>,3>& {
+		_temp_make_local_4_128(0,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_4;
+			das_get_tuple_field<int32_t,0>::get(__mkt_4) = 1;
+			das_get_tuple_field<char *,8>::get(__mkt_4) = ((char *) "one");
+			return __mkt_4;
+		})());
+		_temp_make_local_4_128(1,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_4;
+			das_get_tuple_field<int32_t,0>::get(__mkt_4) = 2;
+			das_get_tuple_field<char *,8>::get(__mkt_4) = ((char *) "two");
+			return __mkt_4;
+		})());
+		_temp_make_local_4_128(2,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_4;
+			das_get_tuple_field<int32_t,0>::get(__mkt_4) = 3;
+			das_get_tuple_field<char *,8>::get(__mkt_4) = ((char *) "three");
+			return __mkt_4;
+		})());
+		return _temp_make_local_4_128;
+	})()))));
+	{
+		bool __need_loop_5 = true;
+		// t : tuple<int;string> const&
+		das_iterator<TDim<TTuple<16,int32_t,char *>,3> const > __t_iterator(__a_rename_at_3);
+		TTuple<16,int32_t,char *> const  * __t_rename_at_5;
+		__need_loop_5 = __t_iterator.first(__context__,(__t_rename_at_5)) && __need_loop_5;
+		for ( ; __need_loop_5 ; __need_loop_5 = __t_iterator.next(__context__,(__t_rename_at_5)) )
+		{
+			DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(__b_rename_at_4(das_get_tuple_field<int32_t,0>::get((*__t_rename_at_5)),__context__)),cast<char *>::from(das_get_tuple_field<char *,8>::get((*__t_rename_at_5))),*__context__,nullptr)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_5));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_to_table_7a70bc7883cc9bc0
+	aotLib[0x438cd2902d4d219d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<int32_t,char *> (*) ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> const  &  ),&_Funcbuiltin_0x60_to_table_7a70bc7883cc9bc0>>();
+	};
+	// test_a3db90d7ecac03d9
+	aotLib[0xd923c4cc08a8c65b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_a3db90d7ecac03d9>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
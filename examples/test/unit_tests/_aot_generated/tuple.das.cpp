@@ -0,0 +1,405 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_18272330691972124546 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__64be5dc860f5ba81;
+extern TypeInfo __type_info__3ceb21b1e6727087;
+extern TypeInfo __type_info__289c16574f003020;
+
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__64be5dc860f5ba81 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x64be5dc860f5ba81) };
+TypeInfo __type_info__3ceb21b1e6727087 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x3ceb21b1e6727087) };
+TypeInfo __type_info__289c16574f003020 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x289c16574f003020) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__3ceb21b1e6727087 };
+TypeInfo * __tinfo_1[1] = { &__type_info__64be5dc860f5ba81 };
+TypeInfo * __tinfo_2[1] = { &__type_info__289c16574f003020 };
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> & __a_rename_at_338, TArray<int32_t> const  & __b_rename_at_338 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_399 );
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07 ( Context * __context__, TArray<int32_t> & __a_rename_at_31, TArray<int32_t> & __b_rename_at_31 );
+inline TTuple<32,int32_t,float,TArray<int32_t>> _Funcbuiltin_0x60_clone_to_move_f556af6a1a3f663 ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> const  & __clone_src_rename_at_325 );
+inline void finalize_815698fa6c068f23 ( Context * __context__, TTuple<8,int32_t,float> & ____this_rename_at_55 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline void finalize_1a91107e105f118d ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> & ____this_rename_at_18 );
+inline void finalize_8d926b64f0be1e67 ( Context * __context__, TTuple<8,int32_t,float> * & ____this_rename_at_55 );
+inline bool testI_7143532cc6ae0b1e ( Context * __context__, TTuple<8,int32_t,float> const  & __arg_rename_at_3 );
+inline bool testF_c2366a2b5180cc29 ( Context * __context__, TTuple<8,int32_t,float> const  & __arg_rename_at_6 );
+inline bool testFinalizeAndClone_8b246a239c31476f ( Context * __context__ );
+inline bool test_c2333475fe946bd7 ( Context * __context__ );
+inline void clone_864da6cdbb7792a8 ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> & __dest_rename_at_328, TTuple<32,int32_t,float,TArray<int32_t>> const  & __src_rename_at_328 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_clone_7775f70b42a34990 ( Context * __context__, TArray<int32_t> &  __a_rename_at_338, TArray<int32_t> const  &  __b_rename_at_338 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_338),builtin_array_size(__b_rename_at_338));
+	{
+		bool __need_loop_340 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_338);
+		int32_t * __aV_rename_at_340;
+		__need_loop_340 = __aV_iterator.first(__context__,(__aV_rename_at_340)) && __need_loop_340;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_338);
+		int32_t const  * __bV_rename_at_340;
+		__need_loop_340 = __bV_iterator.first(__context__,(__bV_rename_at_340)) && __need_loop_340;
+		for ( ; __need_loop_340 ; __need_loop_340 = __aV_iterator.next(__context__,(__aV_rename_at_340)) && __bV_iterator.next(__context__,(__bV_rename_at_340)) )
+		{
+			das_copy((*__aV_rename_at_340),(*__bV_rename_at_340));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_340));
+		__bV_iterator.close(__context__,(__bV_rename_at_340));
+	};
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_399 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_399),4,__context__);
+}
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07 ( Context * __context__, TArray<int32_t> &  __a_rename_at_31, TArray<int32_t> &  __b_rename_at_31 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<TArray<int32_t> &>::from(__a_rename_at_31)));
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<TArray<int32_t> &>::from(__b_rename_at_31)));
+	das_move(__a_rename_at_31,__b_rename_at_31);
+}
+
+inline TTuple<32,int32_t,float,TArray<int32_t>> _Funcbuiltin_0x60_clone_to_move_f556af6a1a3f663 ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> const  &  __clone_src_rename_at_325 )
+{
+	TTuple<32,int32_t,float,TArray<int32_t>> __clone_dest_rename_at_327; das_zero(__clone_dest_rename_at_327);
+	clone_864da6cdbb7792a8(__context__,das_arg<TTuple<32,int32_t,float,TArray<int32_t>>>::pass(__clone_dest_rename_at_327),__clone_src_rename_at_325);
+	return /* <- */ das_auto_cast_move<TTuple<32,int32_t,float,TArray<int32_t>>>::cast(__clone_dest_rename_at_327);
+}
+
+inline void finalize_815698fa6c068f23 ( Context * __context__, TTuple<8,int32_t,float> &  ____this_rename_at_55 )
+{
+	memset(&(____this_rename_at_55), 0, 8);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void finalize_1a91107e105f118d ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> &  ____this_rename_at_18 )
+{
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(das_get_tuple_field<TArray<int32_t>,8>::get(____this_rename_at_18)));
+	memset(&(____this_rename_at_18), 0, 32);
+}
+
+inline void finalize_8d926b64f0be1e67 ( Context * __context__, TTuple<8,int32_t,float> * & ____this_rename_at_55 )
+{
+	if ( ____this_rename_at_55 != nullptr )
+	{
+		finalize_815698fa6c068f23(__context__,das_arg<TTuple<8,int32_t,float>>::pass(das_deref(__context__,____this_rename_at_55)));
+		das_delete<TTuple<8,int32_t,float> *>::clear(__context__,____this_rename_at_55);
+		das_copy(____this_rename_at_55,nullptr);
+	};
+}
+
+inline bool testI_7143532cc6ae0b1e ( Context * __context__, TTuple<8,int32_t,float> const  &  __arg_rename_at_3 )
+{
+	return das_auto_cast<bool>::cast(das_get_tuple_field<int32_t,0>::get(__arg_rename_at_3) == 1);
+}
+
+inline bool testF_c2366a2b5180cc29 ( Context * __context__, TTuple<8,int32_t,float> const  &  __arg_rename_at_6 )
+{
+	return das_auto_cast<bool>::cast(das_get_tuple_field<float,4>::get(__arg_rename_at_6) == 3.1400001f);
+}
+
+inline bool testFinalizeAndClone_8b246a239c31476f ( Context * __context__ )
+{
+	TTuple<32,int32_t,float,TArray<int32_t>> __x_rename_at_10; das_zero(__x_rename_at_10);
+	das_copy(das_get_tuple_field<int32_t,0>::get(__x_rename_at_10),1);
+	das_copy(das_get_tuple_field<float,4>::get(__x_rename_at_10),2.f);
+	_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07(__context__,das_arg<TArray<int32_t>>::pass(das_get_tuple_field<TArray<int32_t>,8>::get(__x_rename_at_10)),das_arg<TArray<int32_t>>::pass(das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_13_rename_at_13; das_zero(____acomp_13_rename_at_13);
+		{
+			bool __need_loop_13 = true;
+			// xx : int const
+			das_iterator<range> __xx_iterator(range(0,10));
+			int32_t __xx_rename_at_13;
+			__need_loop_13 = __xx_iterator.first(__context__,(__xx_rename_at_13)) && __need_loop_13;
+			for ( ; __need_loop_13 ; __need_loop_13 = __xx_iterator.next(__context__,(__xx_rename_at_13)) )
+			{
+				_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____acomp_13_rename_at_13),__xx_rename_at_13);
+			}
+			__xx_iterator.close(__context__,(__xx_rename_at_13));
+		};
+		return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(____acomp_13_rename_at_13)));
+	})));
+	TTuple<32,int32_t,float,TArray<int32_t>> __y_rename_at_14; das_zero(__y_rename_at_14); das_move(__y_rename_at_14, _Funcbuiltin_0x60_clone_to_move_f556af6a1a3f663(__context__,das_arg<TTuple<32,int32_t,float,TArray<int32_t>>>::pass(__x_rename_at_10)));
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__y_rename_at_14) == 1) && (das_get_tuple_field<float,4>::get(__y_rename_at_14) == 2.f)));
+	{
+		bool __need_loop_16 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_16;
+		__need_loop_16 = __t_iterator.first(__context__,(__t_rename_at_16)) && __need_loop_16;
+		for ( ; __need_loop_16 ; __need_loop_16 = __t_iterator.next(__context__,(__t_rename_at_16)) )
+		{
+			DAS_ASSERT((das_get_tuple_field<TArray<int32_t>,8>::get(__y_rename_at_14)(__t_rename_at_16,__context__) == __t_rename_at_16));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_16));
+	};
+	finalize_1a91107e105f118d(__context__,das_arg<TTuple<32,int32_t,float,TArray<int32_t>>>::pass(__x_rename_at_10));
+	DAS_ASSERT((((das_get_tuple_field<int32_t,0>::get(__x_rename_at_10) == 0) && (das_get_tuple_field<float,4>::get(__x_rename_at_10) == 0.f)) && (builtin_array_size(das_arg<TArray<int32_t>>::pass(das_get_tuple_field<TArray<int32_t>,8>::get(__x_rename_at_10))) == 0)));
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__y_rename_at_14) == 1) && (das_get_tuple_field<float,4>::get(__y_rename_at_14) == 2.f)));
+	{
+		bool __need_loop_21 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_21;
+		__need_loop_21 = __t_iterator.first(__context__,(__t_rename_at_21)) && __need_loop_21;
+		for ( ; __need_loop_21 ; __need_loop_21 = __t_iterator.next(__context__,(__t_rename_at_21)) )
+		{
+			DAS_ASSERT((das_get_tuple_field<TArray<int32_t>,8>::get(__y_rename_at_14)(__t_rename_at_21,__context__) == __t_rename_at_21));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_21));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_c2333475fe946bd7 ( Context * __context__ )
+{
+	TTuple<8,int32_t,float> __ttt_rename_at_27_ConstRef = ((TTuple<8,int32_t,float>)(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_27;
+		das_get_tuple_field<int32_t,0>::get(__mkt_27) = 1;
+		das_get_tuple_field<float,4>::get(__mkt_27) = 3.1400001f;
+		return __mkt_27;
+	})()));
+	TTuple<8,int32_t,float> const  & __ttt_rename_at_27 = __ttt_rename_at_27_ConstRef; ;
+	DAS_ASSERT((testI_7143532cc6ae0b1e(__context__,__ttt_rename_at_27)));
+	DAS_ASSERT((testF_c2366a2b5180cc29(__context__,__ttt_rename_at_27)));
+	DAS_ASSERT((das_get_tuple_field<int32_t,0>::get(__ttt_rename_at_27) == 1));
+	DAS_ASSERT((das_get_tuple_field<float,4>::get(__ttt_rename_at_27) == 3.1400001f));
+	TTuple<16,int32_t,float,char *> __t_rename_at_32; das_zero(__t_rename_at_32);
+	das_copy(das_get_tuple_field<int32_t,0>::get(__t_rename_at_32),1);
+	das_copy(das_get_tuple_field<float,4>::get(__t_rename_at_32),2.f);
+	das_copy(das_get_tuple_field<char *,8>::get(__t_rename_at_32),((char *) "3"));
+	TTuple<16,int32_t,float,char *> __q_rename_at_37 = __t_rename_at_32;
+	DAS_ASSERT((das_get_tuple_field<int32_t,0>::get(__q_rename_at_37) == 1));
+	DAS_ASSERT((das_get_tuple_field<float,4>::get(__q_rename_at_37) == 2.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_get_tuple_field<char *,8>::get(__q_rename_at_37)),cast<char *>::from(((char *) "3")),*__context__,nullptr)));
+	TTuple<16,int32_t,float,char *> * __pq_rename_at_42 = das_ref(__context__,__q_rename_at_37);
+	DAS_ASSERT((das_get_tuple_field_ptr<int32_t,0>::get(__pq_rename_at_42) == 1));
+	DAS_ASSERT((das_get_tuple_field_ptr<float,4>::get(__pq_rename_at_42) == 2.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_get_tuple_field_ptr<char *,8>::get(__pq_rename_at_42)),cast<char *>::from(((char *) "3")),*__context__,nullptr)));
+	DAS_ASSERT((das_null_coalescing<int32_t>::get(das_safe_navigation_tuple<int32_t, 0>::get(__pq_rename_at_42),0) == 1));
+	DAS_ASSERT((das_null_coalescing<float>::get(das_safe_navigation_tuple<float, 4>::get(__pq_rename_at_42),0.f) == 2.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_null_coalescing<char * const >::get(das_safe_navigation_tuple<char *, 8>::get(__pq_rename_at_42),((char *) "nothing"))),cast<char *>::from(((char *) "3")),*__context__,nullptr)));
+	TTuple<8,int32_t,float> * __qq_rename_at_49 = das_new<TTuple<8,int32_t,float>>::make(__context__);
+	das_copy(das_get_tuple_field_ptr<int32_t,0>::get(__qq_rename_at_49),1);
+	das_copy(das_get_tuple_field_ptr<float,4>::get(__qq_rename_at_49),2.f);
+	DAS_ASSERT((das_null_coalescing<int32_t>::get(das_safe_navigation_tuple<int32_t, 0>::get(__qq_rename_at_49),0) == 1));
+	DAS_ASSERT((das_null_coalescing<float>::get(das_safe_navigation_tuple<float, 4>::get(__qq_rename_at_49),0.f) == 2.f));
+	finalize_8d926b64f0be1e67(__context__,__qq_rename_at_49);
+	TTuple<8,int32_t,float> __mkt_rename_at_57_ConstRef = ((TTuple<8,int32_t,float>)(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_57;
+		das_get_tuple_field<int32_t,0>::get(__mkt_57) = 1;
+		das_get_tuple_field<float,4>::get(__mkt_57) = 2.f;
+		return __mkt_57;
+	})()));
+	TTuple<8,int32_t,float> const  & __mkt_rename_at_57 = __mkt_rename_at_57_ConstRef; ;
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__mkt_rename_at_57) == 1) && (das_get_tuple_field<float,4>::get(__mkt_rename_at_57) == 2.f)));
+	TDim<TTuple<8,int32_t,float>,2> __mkta_rename_at_59_ConstRef = ((TDim<TTuple<8,int32_t,float>,2>)(([&]() -> TDim<TTuple<8,int32_t,float>,2> {
+		TDim<TTuple<8,int32_t,float>,2> __mka_59;
+		__mka_59(0,__context__) = (([&]() -> TTuple<8,int32_t,float> {
+			TTuple<8,int32_t,float> __mkt_59;
+			das_get_tuple_field<int32_t,0>::get(__mkt_59) = 1;
+			das_get_tuple_field<float,4>::get(__mkt_59) = 2.f;
+			return __mkt_59;
+		})());
+		__mka_59(1,__context__) = (([&]() -> TTuple<8,int32_t,float> {
+			TTuple<8,int32_t,float> __mkt_59;
+			das_get_tuple_field<int32_t,0>::get(__mkt_59) = 3;
+			das_get_tuple_field<float,4>::get(__mkt_59) = 4.f;
+			return __mkt_59;
+		})());
+		return __mka_59;
+	})()));
+	TDim<TTuple<8,int32_t,float>,2> const  & __mkta_rename_at_59 = __mkta_rename_at_59_ConstRef; ;
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__mkta_rename_at_59(0,__context__)) == 1) && (das_get_tuple_field<float,4>::get(__mkta_rename_at_59(0,__context__)) == 2.f)));
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__mkta_rename_at_59(1,__context__)) == 3) && (das_get_tuple_field<float,4>::get(__mkta_rename_at_59(1,__context__)) == 4.f)));
+	TDim<int32_t,4> __ti_rename_at_63_ConstRef = ((TDim<int32_t,4>)(([&]() -> TDim<int32_t,4> {
+		TDim<int32_t,4> __mka_63;
+		__mka_63(0,__context__) = 1;
+		__mka_63(1,__context__) = 2;
+		__mka_63(2,__context__) = 3;
+		__mka_63(3,__context__) = 4;
+		return __mka_63;
+	})()));
+	TDim<int32_t,4> const  & __ti_rename_at_63 = __ti_rename_at_63_ConstRef; ;
+	DAS_ASSERT(((((__ti_rename_at_63(0,__context__) == 1) && (__ti_rename_at_63(1,__context__) == 2)) && (__ti_rename_at_63(2,__context__) == 3)) && (__ti_rename_at_63(3,__context__) == 4)));
+	TDim<TTuple<8,int32_t,int32_t>,2> __tt_rename_at_66_ConstRef = ((TDim<TTuple<8,int32_t,int32_t>,2>)(([&]() -> TDim<TTuple<8,int32_t,int32_t>,2> {
+		TDim<TTuple<8,int32_t,int32_t>,2> __mka_66;
+		__mka_66(0,__context__) = (([&]() -> TTuple<8,int32_t,int32_t> {
+			TTuple<8,int32_t,int32_t> __mkt_66;
+			das_get_tuple_field<int32_t,0>::get(__mkt_66) = 1;
+			das_get_tuple_field<int32_t,4>::get(__mkt_66) = 2;
+			return __mkt_66;
+		})());
+		__mka_66(1,__context__) = (([&]() -> TTuple<8,int32_t,int32_t> {
+			TTuple<8,int32_t,int32_t> __mkt_66;
+			das_get_tuple_field<int32_t,0>::get(__mkt_66) = 3;
+			das_get_tuple_field<int32_t,4>::get(__mkt_66) = 4;
+			return __mkt_66;
+		})());
+		return __mka_66;
+	})()));
+	TDim<TTuple<8,int32_t,int32_t>,2> const  & __tt_rename_at_66 = __tt_rename_at_66_ConstRef; ;
+	DAS_ASSERT(((((das_get_tuple_field<int32_t,0>::get(__tt_rename_at_66(0,__context__)) == 1) && (das_get_tuple_field<int32_t,4>::get(__tt_rename_at_66(0,__context__)) == 2)) && (das_get_tuple_field<int32_t,0>::get(__tt_rename_at_66(1,__context__)) == 3)) && (das_get_tuple_field<int32_t,4>::get(__tt_rename_at_66(1,__context__)) == 4)));
+	TTuple<8,int32_t,float> __tq_rename_at_69_ConstRef = ((TTuple<8,int32_t,float>)(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_69;
+		das_get_tuple_field<int32_t,0>::get(__mkt_69) = 1;
+		das_get_tuple_field<float,4>::get(__mkt_69) = 2.f;
+		return __mkt_69;
+	})()));
+	TTuple<8,int32_t,float> const  & __tq_rename_at_69 = __tq_rename_at_69_ConstRef; ;
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__tq_rename_at_69) == 1) && (das_get_tuple_field<float,4>::get(__tq_rename_at_69) == 2.f)));
+	testFinalizeAndClone_8b246a239c31476f(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void clone_864da6cdbb7792a8 ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> &  __dest_rename_at_328, TTuple<32,int32_t,float,TArray<int32_t>> const  &  __src_rename_at_328 )
+{
+	das_copy(das_get_tuple_field<int32_t,0>::get(__dest_rename_at_328),das_get_tuple_field<int32_t,0>::get(__src_rename_at_328));
+	das_copy(das_get_tuple_field<float,4>::get(__dest_rename_at_328),das_get_tuple_field<float,4>::get(__src_rename_at_328));
+	_Funcbuiltin_0x60_clone_7775f70b42a34990(__context__,das_arg<TArray<int32_t>>::pass(das_get_tuple_field<TArray<int32_t>,8>::get(__dest_rename_at_328)),das_get_tuple_field<TArray<int32_t>,8>::get(__src_rename_at_328));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_clone_7775f70b42a34990
+	aotLib[0xbde965effb9cac8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_7775f70b42a34990>>();
+	};
+	// _Funcbuiltin_0x60_finalize_c5f896860856389a
+	aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd
+	aotLib[0x66e322246598e835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> & (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd>>();
+	};
+	// _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07
+	aotLib[0x44c6ff6768abbc55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> &  ),&_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07>>();
+	};
+	// _Funcbuiltin_0x60_clone_to_move_f556af6a1a3f663
+	aotLib[0xe7351e9a3cb977a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTuple<32,int32_t,float,TArray<int32_t>> (*) ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> const  &  ),&_Funcbuiltin_0x60_clone_to_move_f556af6a1a3f663>>();
+	};
+	// finalize_815698fa6c068f23
+	aotLib[0x748c10b2aaee4581] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<8,int32_t,float> &  ),&finalize_815698fa6c068f23>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// finalize_1a91107e105f118d
+	aotLib[0xe02e4d43c09b7f5e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> &  ),&finalize_1a91107e105f118d>>();
+	};
+	// finalize_8d926b64f0be1e67
+	aotLib[0xaf2bd765412d73b6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<8,int32_t,float> * &  ),&finalize_8d926b64f0be1e67>>();
+	};
+	// testI_7143532cc6ae0b1e
+	aotLib[0x9847cedbb0b58cd9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTuple<8,int32_t,float> const  &  ),&testI_7143532cc6ae0b1e>>();
+	};
+	// testF_c2366a2b5180cc29
+	aotLib[0x2fcb5771894125] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTuple<8,int32_t,float> const  &  ),&testF_c2366a2b5180cc29>>();
+	};
+	// testFinalizeAndClone_8b246a239c31476f
+	aotLib[0xaa15d5a10a820227] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&testFinalizeAndClone_8b246a239c31476f>>();
+	};
+	// test_c2333475fe946bd7
+	aotLib[0x78a9c1d8711d1da9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_c2333475fe946bd7>>();
+	};
+	// clone_864da6cdbb7792a8
+	aotLib[0x8d7e55cd9c87acb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> & , TTuple<32,int32_t,float,TArray<int32_t>> const  &  ),&clone_864da6cdbb7792a8>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,11 @@
+// unity build batch 11
+#include "mat_let_handle.das.cpp"
+#include "math.das.cpp"
+#include "memzero.das.cpp"
+#include "method_semantic.das.cpp"
+#include "mksmart_zero.das.cpp"
+#include "module.das.cpp"
+#include "module_vis_fail.das.cpp"
+#include "move_lambda_local_ref.das.cpp"
+#include "named_call.das.cpp"
+#include "new_and_init.das.cpp"
@@ -0,0 +1,11 @@
+// unity build batch 13
+#include "persistent.das.cpp"
+#include "ptr_index.das.cpp"
+#include "reflection.das.cpp"
+#include "replace.das.cpp"
+#include "req_inc.das.cpp"
+#include "return_reference.das.cpp"
+#include "rpipe.das.cpp"
+#include "rtti_module.das.cpp"
+#include "saddr.das.cpp"
+#include "safe_index.das.cpp"
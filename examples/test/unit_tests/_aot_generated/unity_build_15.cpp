@@ -0,0 +1,11 @@
+// unity build batch 15
+#include "static_if.das.cpp"
+#include "stdvec_r2v.das.cpp"
+#include "storage_types.das.cpp"
+#include "string.das.cpp"
+#include "string_builder.das.cpp"
+#include "struct.das.cpp"
+#include "structure_annotation.das.cpp"
+#include "swiss_table.das.cpp"
+#include "swizze.das.cpp"
+#include "table.das.cpp"
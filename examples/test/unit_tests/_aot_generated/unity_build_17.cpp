@@ -0,0 +1,11 @@
+// unity build batch 17
+#include "tuple.das.cpp"
+#include "typeAlias.das.cpp"
+#include "typeinfo.das.cpp"
+#include "typename.das.cpp"
+#include "types.das.cpp"
+#include "unused_arguments.das.cpp"
+#include "utf8.das.cpp"
+#include "variant.das.cpp"
+#include "vec_ctors.das.cpp"
+#include "vec_index.das.cpp"
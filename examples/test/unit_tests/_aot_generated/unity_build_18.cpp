@@ -0,0 +1,3 @@
+// unity build batch 18
+#include "vec_swizzle.das.cpp"
+#include "with.das.cpp"
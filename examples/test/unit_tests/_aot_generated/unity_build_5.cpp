@@ -0,0 +1,11 @@
+// unity build batch 5
+#include "dummy.das.cpp"
+#include "dynamic_array.das.cpp"
+#include "each_std_vector.das.cpp"
+#include "enum.das.cpp"
+#include "enum_total_test.das.cpp"
+#include "fast_to_int.das.cpp"
+#include "fastcall_crash.das.cpp"
+#include "finalizer_in_module.das.cpp"
+#include "finally.das.cpp"
+#include "fio.das.cpp"
@@ -0,0 +1,11 @@
+// unity build batch 7
+#include "fusion_for_array.das.cpp"
+#include "fusion_if_cmp.das.cpp"
+#include "generators.das.cpp"
+#include "global.das.cpp"
+#include "global_func_shadow_check.das.cpp"
+#include "global_order.das.cpp"
+#include "handle.das.cpp"
+#include "heap_allocation_stats.das.cpp"
+#include "heap_collect_parallel.das.cpp"
+#include "heap_collect_step.das.cpp"
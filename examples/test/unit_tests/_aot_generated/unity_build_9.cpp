@@ -0,0 +1,11 @@
+// unity build batch 9
+#include "invoke_cmres.das.cpp"
+#include "jit_template.das.cpp"
+#include "jit_tiering.das.cpp"
+#include "join.das.cpp"
+#include "label.das.cpp"
+#include "lambda.das.cpp"
+#include "lambda_capture_modes.das.cpp"
+#include "lambda_to_iter.das.cpp"
+#include "line_info.das.cpp"
+#include "local_reference.das.cpp"
@@ -0,0 +1,138 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require utf8_utils
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_8477654532364159283 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline void _Funcbuiltin_0x60_resize_8b9bf29a687b3e9d ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline TArray<uint8_t> _Funcbuiltin_0x60_to_array_move_d980fcef79a48e78 ( Context * __context__, TDim<uint8_t,3> & __a_rename_at_518 );
+inline bool test_f70fbb768c31a408 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_8b9bf29a687b3e9d ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,1,__context__);
+}
+
+inline TArray<uint8_t> _Funcbuiltin_0x60_to_array_move_d980fcef79a48e78 ( Context * __context__, TDim<uint8_t,3> &  __a_rename_at_518 )
+{
+	TArray<uint8_t> __arr_rename_at_519; das_zero(__arr_rename_at_519);
+	_Funcbuiltin_0x60_resize_8b9bf29a687b3e9d(__context__,das_arg<TArray<uint8_t>>::pass(__arr_rename_at_519),3);
+	das_copy(das_cast<TDim<uint8_t,3>>::cast(das_ref(__context__,__arr_rename_at_519(0,__context__))),__a_rename_at_518);
+	return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(__arr_rename_at_519);
+}
+
+inline bool test_f70fbb768c31a408 ( Context * __context__ )
+{
+	TArray<uint8_t> _temp_make_local_23_144;
+	TDim<uint8_t,3> _temp_make_local_34_208;
+	TArray<uint8_t> __arr_rename_at_10_ConstRef; das_zero(__arr_rename_at_10_ConstRef); das_move(__arr_rename_at_10_ConstRef, ((TArray<uint8_t>)das_invoke_function<TArray<uint8_t>>::invoke_cmres<uint32_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::utf8_encode Cu*/ 11571049667647884088u)),0x42eu)));
+	TArray<uint8_t> const  & __arr_rename_at_10 = __arr_rename_at_10_ConstRef; ;
+	DAS_ASSERT((das_equ_val(__arr_rename_at_10(0,__context__),uint8_t(208))));
+	DAS_ASSERT((das_equ_val(__arr_rename_at_10(1,__context__),uint8_t(174))));
+	TArray<uint32_t> __codepoints1_rename_at_14_ConstRef; das_zero(__codepoints1_rename_at_14_ConstRef); das_move(__codepoints1_rename_at_14_ConstRef, ((TArray<uint32_t>)das_invoke_function<TArray<uint32_t>>::invoke_cmres<char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::utf8_decode Cs*/ 16703559429911599886u)),((char *) "_xcd 1 \n\t~A"))));
+	TArray<uint32_t> const  & __codepoints1_rename_at_14 = __codepoints1_rename_at_14_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__codepoints1_rename_at_14) == 11));
+	DAS_ASSERT((__codepoints1_rename_at_14(10,__context__) == 0x41u));
+	TArray<uint32_t> __codepoints2_rename_at_18; das_zero(__codepoints2_rename_at_18); das_move(__codepoints2_rename_at_18, das_invoke_function<TArray<uint32_t>>::invoke_cmres<char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::utf8_decode Cs*/ 16703559429911599886u)),((char *) "Юникод \n\t~A")));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<uint32_t>>::pass(__codepoints2_rename_at_18)) == 11));
+	DAS_ASSERT((__codepoints2_rename_at_18(10,__context__) == 0x41u));
+	DAS_ASSERT((__codepoints2_rename_at_18(1,__context__) == 0x43du));
+	char * __s3_rename_at_23 = ((char *)(char *)(((char *)(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass((_temp_make_local_23_144 = (das_invoke_function<TArray<uint8_t>>::invoke_cmres<TArray<uint32_t> const  &>(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::utf8_encode CI1<u>A*/ 12924760836188770709u)),das_arg<TArray<uint32_t>>::pass(__codepoints2_rename_at_18))))),__context__)))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__s3_rename_at_23),cast<char *>::from(((char *) "Юникод \n\t~A")),*__context__,nullptr)));
+	das_invoke_function<void>::invoke<TArray<uint32_t> &,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::utf8_decode 1<u>A Cs*/ 7222067221502674449u)),das_arg<TArray<uint32_t>>::pass(__codepoints2_rename_at_18),((char *) "Юникод \n\t~A"));
+	DAS_ASSERT((__codepoints2_rename_at_18(21,__context__) == 0x41u));
+	DAS_VERIFY((das_invoke_function<bool>::invoke<char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::is_utf8_string_valid Cs*/ 1248925448974558701u)),((char *) "_xcd 1 \n\t~A"))));
+	DAS_VERIFY((das_invoke_function<bool>::invoke<char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::is_utf8_string_valid Cs*/ 1248925448974558701u)),nullptr)));
+	TArray<uint8_t> __invalidStr_rename_at_34_ConstRef; das_zero(__invalidStr_rename_at_34_ConstRef); das_move(__invalidStr_rename_at_34_ConstRef, ((TArray<uint8_t>)_Funcbuiltin_0x60_to_array_move_d980fcef79a48e78(__context__,das_arg<TDim<uint8_t,3>>::pass((([&]() -> TDim<uint8_t,3>& {
+		_temp_make_local_34_208(0,__context__) = uint8_t(0x1fu);
+		_temp_make_local_34_208(1,__context__) = uint8_t(0xffu);
+		_temp_make_local_34_208(2,__context__) = uint8_t(0xffu);
+		return _temp_make_local_34_208;
+	})())))));
+	TArray<uint8_t> const  & __invalidStr_rename_at_34 = __invalidStr_rename_at_34_ConstRef; ;
+	DAS_VERIFY((!das_invoke_function<bool>::invoke<TArray<uint8_t> const  &>(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::is_utf8_string_valid CI1<u8>A*/ 10736456897026718142u)),__invalidStr_rename_at_34)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_8b9bf29a687b3e9d
+	aotLib[0xd467d57646ae4a91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_8b9bf29a687b3e9d>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_d980fcef79a48e78
+	aotLib[0xa4c99865f0c5b23] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint8_t> (*) ( Context * __context__, TDim<uint8_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_d980fcef79a48e78>>();
+	};
+	// test_f70fbb768c31a408
+	aotLib[0x6b24fe423cdb43d8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f70fbb768c31a408>>();
+	};
+	// [[ init script ]]
+	aotLib[0x2d4cde6426d71023] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,716 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10081785718223038802 {
+
+extern TypeInfo __type_info__bef6b19aaa058ea;
+extern TypeInfo __type_info__c075419aab4c3b6;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__bc35c19aa7b0482;
+extern TypeInfo __type_info__90f3c07b5a6c860;
+extern TypeInfo __type_info__bc35d19aa7b0635;
+extern TypeInfo __type_info__bef6519aaa04eb8;
+extern TypeInfo __type_info__c075519aab4c569;
+extern TypeInfo __type_info__bef6c19aaa05a9d;
+extern TypeInfo __type_info__90f4407b5a6d5f8;
+extern TypeInfo __type_info__c075719aab4c8cf;
+extern TypeInfo __type_info__bc35719aa7afc03;
+
+TypeInfo __type_info__bef6b19aaa058ea = { Type::tFloat2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0xbef6b19aaa058ea) };
+TypeInfo __type_info__c075419aab4c3b6 = { Type::tInt3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 12, UINT64_C(0xc075419aab4c3b6) };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__bc35c19aa7b0482 = { Type::tUInt3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 12, UINT64_C(0xbc35c19aa7b0482) };
+TypeInfo __type_info__90f3c07b5a6c860 = { Type::tRange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0x90f3c07b5a6c860) };
+TypeInfo __type_info__bc35d19aa7b0635 = { Type::tUInt2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0xbc35d19aa7b0635) };
+TypeInfo __type_info__bef6519aaa04eb8 = { Type::tFloat4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 16, UINT64_C(0xbef6519aaa04eb8) };
+TypeInfo __type_info__c075519aab4c569 = { Type::tInt2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0xc075519aab4c569) };
+TypeInfo __type_info__bef6c19aaa05a9d = { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 12, UINT64_C(0xbef6c19aaa05a9d) };
+TypeInfo __type_info__90f4407b5a6d5f8 = { Type::tURange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0x90f4407b5a6d5f8) };
+TypeInfo __type_info__c075719aab4c8cf = { Type::tInt4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 16, UINT64_C(0xc075719aab4c8cf) };
+TypeInfo __type_info__bc35719aa7afc03 = { Type::tUInt4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 16, UINT64_C(0xbc35719aa7afc03) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_1[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_2[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_3[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_4[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_5[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_6[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_7[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_8[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_9[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_10[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_11[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_12[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_13[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_14[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_15[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_16[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_17[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_18[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_19[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_20[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_21[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_22[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_23[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_24[1] = { &__type_info__bef6b19aaa058ea };
+TypeInfo * __tinfo_25[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_26[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_27[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_28[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_29[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_30[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_31[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_32[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_33[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_34[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_35[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_36[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_37[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_38[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_39[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_40[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_41[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_42[1] = { &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_43[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_44[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_45[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_46[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_47[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_48[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_49[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_50[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_51[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_52[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_53[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_54[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_55[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_56[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_57[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_58[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_59[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_60[1] = { &__type_info__bef6519aaa04eb8 };
+TypeInfo * __tinfo_61[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_62[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_63[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_64[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_65[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_66[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_67[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_68[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_69[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_70[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_71[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_72[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_73[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_74[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_75[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_76[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_77[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_78[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_79[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_80[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_81[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_82[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_83[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_84[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_85[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_86[1] = { &__type_info__c075519aab4c569 };
+TypeInfo * __tinfo_87[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_88[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_89[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_90[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_91[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_92[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_93[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_94[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_95[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_96[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_97[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_98[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_99[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_100[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_101[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_102[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_103[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_104[1] = { &__type_info__c075419aab4c3b6 };
+TypeInfo * __tinfo_105[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_106[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_107[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_108[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_109[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_110[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_111[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_112[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_113[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_114[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_115[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_116[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_117[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_118[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_119[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_120[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_121[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_122[1] = { &__type_info__c075719aab4c8cf };
+TypeInfo * __tinfo_123[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_124[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_125[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_126[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_127[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_128[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_129[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_130[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_131[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_132[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_133[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_134[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_135[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_136[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_137[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_138[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_139[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_140[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_141[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_142[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_143[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_144[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_145[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_146[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_147[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_148[1] = { &__type_info__bc35d19aa7b0635 };
+TypeInfo * __tinfo_149[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_150[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_151[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_152[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_153[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_154[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_155[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_156[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_157[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_158[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_159[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_160[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_161[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_162[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_163[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_164[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_165[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_166[1] = { &__type_info__bc35c19aa7b0482 };
+TypeInfo * __tinfo_167[5] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_168[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_169[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_170[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_171[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_172[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_173[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_174[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_175[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_176[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_177[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_178[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_179[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_180[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_181[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_182[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_183[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_184[1] = { &__type_info__bc35719aa7afc03 };
+TypeInfo * __tinfo_185[7] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_186[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_187[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_188[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_189[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_190[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_191[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_192[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_193[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_194[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_195[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_196[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_197[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_198[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_199[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_200[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_201[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_202[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_203[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_204[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_205[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_206[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_207[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_208[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_209[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_210[1] = { &__type_info__90f3c07b5a6c860 };
+TypeInfo * __tinfo_211[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_212[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_213[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_214[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_215[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_216[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_217[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_218[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_219[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_220[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_221[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_222[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_223[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_224[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_225[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_226[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_227[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_228[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_229[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_230[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_231[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_232[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_233[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_234[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_235[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_236[1] = { &__type_info__90f4407b5a6d5f8 };
+TypeInfo * __tinfo_237[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+
+inline void _Func_0x60_test_vec2_ba1dd7a8a8bf59bc ( Context * __context__, float2 __a_rename_at_6, bool __isRange_rename_at_6 );
+inline void _Func_0x60_test_vec3_90c01ccd749145f2 ( Context * __context__, float3 __a_rename_at_32 );
+inline void _Func_0x60_test_vec4_5deb4589c37450ab ( Context * __context__, float4 __a_rename_at_52 );
+inline void _Func_0x60_test_vec2_20274c73d3ae2045 ( Context * __context__, int2 __a_rename_at_6, bool __isRange_rename_at_6 );
+inline void _Func_0x60_test_vec3_fc71262baa05ffb ( Context * __context__, int3 __a_rename_at_32 );
+inline void _Func_0x60_test_vec4_1354365b96ffc1ee ( Context * __context__, int4 __a_rename_at_52 );
+inline void _Func_0x60_test_vec2_c8111223f1f10e43 ( Context * __context__, uint2 __a_rename_at_6, bool __isRange_rename_at_6 );
+inline void _Func_0x60_test_vec3_104d34767c77f4b ( Context * __context__, uint3 __a_rename_at_32 );
+inline void _Func_0x60_test_vec4_f67fb6577603cee0 ( Context * __context__, uint4 __a_rename_at_52 );
+inline void _Func_0x60_test_vec2_db65dc36af37d92e ( Context * __context__, range __a_rename_at_6, bool __isRange_rename_at_6 );
+inline void _Func_0x60_test_vec2_7ec1e722ddb20d04 ( Context * __context__, urange __a_rename_at_6, bool __isRange_rename_at_6 );
+inline void test_cvt_b1c4b2cf8e077f42 ( Context * __context__, int32_t __a_rename_at_73, int32_t __b_rename_at_73, int32_t __c_rename_at_73, int32_t __d_rename_at_73 );
+inline bool test_d3f425db6546ae08 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_0x60_test_vec2_ba1dd7a8a8bf59bc ( Context * __context__, float2 __a_rename_at_6, bool __isRange_rename_at_6 )
+{
+	float2 __f2_0_rename_at_7 = ((float2)v_zero());
+	float2 __f2_x_rename_at_8 = ((float2)v_make_vec4f(1.f,2.f,0.f,0.f));
+	float2 __f2_y_rename_at_9 = ((float2)v_make_vec4f(1.f,2.f,0.f,0.f));
+	float2 __f2_z_rename_at_10 = ((float2)v_make_vec4f(1.f,2.f,0.f,0.f));
+	float2 __f2_w_rename_at_11 = ((float2)v_make_vec4f(1.f,2.f,0.f,0.f));
+	float2 __f2_xx_rename_at_12 = ((float2)v_splats(1.f));
+	float2 __f2_yy_rename_at_13 = ((float2)v_splats(1.f));
+	float2 __f2_zz_rename_at_14 = ((float2)v_splats(1.f));
+	float2 __f2_ww_rename_at_15 = ((float2)v_splats(1.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_0_rename_at_7)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_2, cast<float2>::from(__f2_x_rename_at_8)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_4, cast<float2>::from(__f2_y_rename_at_9)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_5, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_6, cast<float2>::from(__f2_z_rename_at_10)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_7, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_8, cast<float2>::from(__f2_w_rename_at_11)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_9, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	if ( __isRange_rename_at_6 )
+	{
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_10, cast<float2>::from(__f2_xx_rename_at_12)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_11, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_12, cast<float2>::from(__f2_yy_rename_at_13)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_13, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_14, cast<float2>::from(__f2_zz_rename_at_14)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_15, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_16, cast<float2>::from(__f2_ww_rename_at_15)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_17, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	} else {
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_18, cast<float2>::from(__f2_xx_rename_at_12)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_19, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_20, cast<float2>::from(__f2_yy_rename_at_13)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_21, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_22, cast<float2>::from(__f2_zz_rename_at_14)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_23, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_24, cast<float2>::from(__f2_ww_rename_at_15)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_25, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	};
+}
+
+inline void _Func_0x60_test_vec3_90c01ccd749145f2 ( Context * __context__, float3 __a_rename_at_32 )
+{
+	float3 __f3_0_rename_at_33 = ((float3)v_zero());
+	float3 __f3_x_rename_at_34 = ((float3)v_make_vec4f(1.f,2.f,3.f,0.f));
+	float3 __f3_y_rename_at_35 = ((float3)v_make_vec4f(1.f,2.f,3.f,0.f));
+	float3 __f3_z_rename_at_36 = ((float3)v_make_vec4f(1.f,2.f,3.f,0.f));
+	float3 __f3_w_rename_at_37 = ((float3)v_make_vec4f(1.f,2.f,3.f,0.f));
+	float3 __f3_xx_rename_at_38 = ((float3)v_splats(1.f));
+	float3 __f3_yy_rename_at_39 = ((float3)v_splats(1.f));
+	float3 __f3_zz_rename_at_40 = ((float3)v_splats(1.f));
+	float3 __f3_ww_rename_at_41 = ((float3)v_splats(1.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_26, cast<float3>::from(__f3_0_rename_at_33)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_28, cast<float3>::from(__f3_x_rename_at_34)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_29, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_30, cast<float3>::from(__f3_y_rename_at_35)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_31, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_32, cast<float3>::from(__f3_z_rename_at_36)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_33, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_34, cast<float3>::from(__f3_w_rename_at_37)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_35, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_36, cast<float3>::from(__f3_xx_rename_at_38)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_37, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_38, cast<float3>::from(__f3_yy_rename_at_39)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_39, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_40, cast<float3>::from(__f3_zz_rename_at_40)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_41, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_42, cast<float3>::from(__f3_ww_rename_at_41)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_43, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_test_vec4_5deb4589c37450ab ( Context * __context__, float4 __a_rename_at_52 )
+{
+	float4 __f4_0_rename_at_53 = ((float4)v_zero());
+	float4 __f4_x_rename_at_54 = ((float4)v_make_vec4f(1.f,2.f,3.f,4.f));
+	float4 __f4_y_rename_at_55 = ((float4)v_make_vec4f(1.f,2.f,3.f,4.f));
+	float4 __f4_z_rename_at_56 = ((float4)v_make_vec4f(1.f,2.f,3.f,4.f));
+	float4 __f4_w_rename_at_57 = ((float4)v_make_vec4f(1.f,2.f,3.f,4.f));
+	float4 __f4_xx_rename_at_58 = ((float4)v_splats(1.f));
+	float4 __f4_yy_rename_at_59 = ((float4)v_splats(1.f));
+	float4 __f4_zz_rename_at_60 = ((float4)v_splats(1.f));
+	float4 __f4_ww_rename_at_61 = ((float4)v_splats(1.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_44, cast<float4>::from(__f4_0_rename_at_53)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_46, cast<float4>::from(__f4_x_rename_at_54)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_47, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_48, cast<float4>::from(__f4_y_rename_at_55)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_49, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_50, cast<float4>::from(__f4_z_rename_at_56)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_51, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_52, cast<float4>::from(__f4_w_rename_at_57)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_53, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_54, cast<float4>::from(__f4_xx_rename_at_58)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_55, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_56, cast<float4>::from(__f4_yy_rename_at_59)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_57, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_58, cast<float4>::from(__f4_zz_rename_at_60)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_59, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_60, cast<float4>::from(__f4_ww_rename_at_61)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_61, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_test_vec2_20274c73d3ae2045 ( Context * __context__, int2 __a_rename_at_6, bool __isRange_rename_at_6 )
+{
+	int2 __f2_0_rename_at_7 = ((int2)int2(0,0));
+	int2 __f2_x_rename_at_8 = ((int2)int2(1,2));
+	int2 __f2_y_rename_at_9 = ((int2)int2(1,2));
+	int2 __f2_z_rename_at_10 = ((int2)int2(1,2));
+	int2 __f2_w_rename_at_11 = ((int2)int2(1,2));
+	int2 __f2_xx_rename_at_12 = ((int2)int2(1,1));
+	int2 __f2_yy_rename_at_13 = ((int2)int2(1,1));
+	int2 __f2_zz_rename_at_14 = ((int2)int2(1,1));
+	int2 __f2_ww_rename_at_15 = ((int2)int2(1,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<int2>::from(__f2_0_rename_at_7)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_63, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_64, cast<int2>::from(__f2_x_rename_at_8)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_65, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_66, cast<int2>::from(__f2_y_rename_at_9)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_67, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_68, cast<int2>::from(__f2_z_rename_at_10)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_69, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_70, cast<int2>::from(__f2_w_rename_at_11)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_71, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	if ( __isRange_rename_at_6 )
+	{
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_72, cast<int2>::from(__f2_xx_rename_at_12)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_73, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_74, cast<int2>::from(__f2_yy_rename_at_13)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_75, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_76, cast<int2>::from(__f2_zz_rename_at_14)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_77, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_78, cast<int2>::from(__f2_ww_rename_at_15)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_79, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	} else {
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_80, cast<int2>::from(__f2_xx_rename_at_12)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_81, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_82, cast<int2>::from(__f2_yy_rename_at_13)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_83, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_84, cast<int2>::from(__f2_zz_rename_at_14)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_85, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_86, cast<int2>::from(__f2_ww_rename_at_15)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_87, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	};
+}
+
+inline void _Func_0x60_test_vec3_fc71262baa05ffb ( Context * __context__, int3 __a_rename_at_32 )
+{
+	int3 __f3_0_rename_at_33 = ((int3)int3(0,0,0));
+	int3 __f3_x_rename_at_34 = ((int3)int3(1,2,3));
+	int3 __f3_y_rename_at_35 = ((int3)int3(1,2,3));
+	int3 __f3_z_rename_at_36 = ((int3)int3(1,2,3));
+	int3 __f3_w_rename_at_37 = ((int3)int3(1,2,3));
+	int3 __f3_xx_rename_at_38 = ((int3)int3(1,1,1));
+	int3 __f3_yy_rename_at_39 = ((int3)int3(1,1,1));
+	int3 __f3_zz_rename_at_40 = ((int3)int3(1,1,1));
+	int3 __f3_ww_rename_at_41 = ((int3)int3(1,1,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_88, cast<int3>::from(__f3_0_rename_at_33)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_89, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_90, cast<int3>::from(__f3_x_rename_at_34)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_91, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_92, cast<int3>::from(__f3_y_rename_at_35)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_93, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_94, cast<int3>::from(__f3_z_rename_at_36)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_95, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_96, cast<int3>::from(__f3_w_rename_at_37)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_97, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_98, cast<int3>::from(__f3_xx_rename_at_38)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_99, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_100, cast<int3>::from(__f3_yy_rename_at_39)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_101, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_102, cast<int3>::from(__f3_zz_rename_at_40)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_103, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_104, cast<int3>::from(__f3_ww_rename_at_41)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_105, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_test_vec4_1354365b96ffc1ee ( Context * __context__, int4 __a_rename_at_52 )
+{
+	int4 __f4_0_rename_at_53 = ((int4)int4(0,0,0,0));
+	int4 __f4_x_rename_at_54 = ((int4)int4(1,2,3,4));
+	int4 __f4_y_rename_at_55 = ((int4)int4(1,2,3,4));
+	int4 __f4_z_rename_at_56 = ((int4)int4(1,2,3,4));
+	int4 __f4_w_rename_at_57 = ((int4)int4(1,2,3,4));
+	int4 __f4_xx_rename_at_58 = ((int4)int4(1,1,1,1));
+	int4 __f4_yy_rename_at_59 = ((int4)int4(1,1,1,1));
+	int4 __f4_zz_rename_at_60 = ((int4)int4(1,1,1,1));
+	int4 __f4_ww_rename_at_61 = ((int4)int4(1,1,1,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_106, cast<int4>::from(__f4_0_rename_at_53)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_107, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_108, cast<int4>::from(__f4_x_rename_at_54)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_109, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_110, cast<int4>::from(__f4_y_rename_at_55)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_111, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_112, cast<int4>::from(__f4_z_rename_at_56)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_113, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_114, cast<int4>::from(__f4_w_rename_at_57)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_115, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_116, cast<int4>::from(__f4_xx_rename_at_58)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_117, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_118, cast<int4>::from(__f4_yy_rename_at_59)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_119, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_120, cast<int4>::from(__f4_zz_rename_at_60)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_121, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_122, cast<int4>::from(__f4_ww_rename_at_61)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_123, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_test_vec2_c8111223f1f10e43 ( Context * __context__, uint2 __a_rename_at_6, bool __isRange_rename_at_6 )
+{
+	uint2 __f2_0_rename_at_7 = ((uint2)uint2(0,0));
+	uint2 __f2_x_rename_at_8 = ((uint2)uint2(1,2));
+	uint2 __f2_y_rename_at_9 = ((uint2)uint2(1,2));
+	uint2 __f2_z_rename_at_10 = ((uint2)uint2(1,2));
+	uint2 __f2_w_rename_at_11 = ((uint2)uint2(1,2));
+	uint2 __f2_xx_rename_at_12 = ((uint2)uint2(1,1));
+	uint2 __f2_yy_rename_at_13 = ((uint2)uint2(1,1));
+	uint2 __f2_zz_rename_at_14 = ((uint2)uint2(1,1));
+	uint2 __f2_ww_rename_at_15 = ((uint2)uint2(1,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_124, cast<uint2>::from(__f2_0_rename_at_7)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_125, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_126, cast<uint2>::from(__f2_x_rename_at_8)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_127, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_128, cast<uint2>::from(__f2_y_rename_at_9)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_129, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_130, cast<uint2>::from(__f2_z_rename_at_10)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_131, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_132, cast<uint2>::from(__f2_w_rename_at_11)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_133, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	if ( __isRange_rename_at_6 )
+	{
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_134, cast<uint2>::from(__f2_xx_rename_at_12)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_135, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_136, cast<uint2>::from(__f2_yy_rename_at_13)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_137, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_138, cast<uint2>::from(__f2_zz_rename_at_14)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_139, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_140, cast<uint2>::from(__f2_ww_rename_at_15)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_141, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	} else {
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_142, cast<uint2>::from(__f2_xx_rename_at_12)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_143, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_144, cast<uint2>::from(__f2_yy_rename_at_13)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_145, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_146, cast<uint2>::from(__f2_zz_rename_at_14)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_147, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_148, cast<uint2>::from(__f2_ww_rename_at_15)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_149, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	};
+}
+
+inline void _Func_0x60_test_vec3_104d34767c77f4b ( Context * __context__, uint3 __a_rename_at_32 )
+{
+	uint3 __f3_0_rename_at_33 = ((uint3)uint3(0,0,0));
+	uint3 __f3_x_rename_at_34 = ((uint3)uint3(1,2,3));
+	uint3 __f3_y_rename_at_35 = ((uint3)uint3(1,2,3));
+	uint3 __f3_z_rename_at_36 = ((uint3)uint3(1,2,3));
+	uint3 __f3_w_rename_at_37 = ((uint3)uint3(1,2,3));
+	uint3 __f3_xx_rename_at_38 = ((uint3)uint3(1,1,1));
+	uint3 __f3_yy_rename_at_39 = ((uint3)uint3(1,1,1));
+	uint3 __f3_zz_rename_at_40 = ((uint3)uint3(1,1,1));
+	uint3 __f3_ww_rename_at_41 = ((uint3)uint3(1,1,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_150, cast<uint3>::from(__f3_0_rename_at_33)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_151, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_152, cast<uint3>::from(__f3_x_rename_at_34)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_153, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_154, cast<uint3>::from(__f3_y_rename_at_35)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_155, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_156, cast<uint3>::from(__f3_z_rename_at_36)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_157, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_158, cast<uint3>::from(__f3_w_rename_at_37)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_159, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_160, cast<uint3>::from(__f3_xx_rename_at_38)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_161, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_162, cast<uint3>::from(__f3_yy_rename_at_39)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_163, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_164, cast<uint3>::from(__f3_zz_rename_at_40)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_165, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_166, cast<uint3>::from(__f3_ww_rename_at_41)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_167, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_test_vec4_f67fb6577603cee0 ( Context * __context__, uint4 __a_rename_at_52 )
+{
+	uint4 __f4_0_rename_at_53 = ((uint4)uint4(0,0,0,0));
+	uint4 __f4_x_rename_at_54 = ((uint4)uint4(1,2,3,4));
+	uint4 __f4_y_rename_at_55 = ((uint4)uint4(1,2,3,4));
+	uint4 __f4_z_rename_at_56 = ((uint4)uint4(1,2,3,4));
+	uint4 __f4_w_rename_at_57 = ((uint4)uint4(1,2,3,4));
+	uint4 __f4_xx_rename_at_58 = ((uint4)uint4(1,1,1,1));
+	uint4 __f4_yy_rename_at_59 = ((uint4)uint4(1,1,1,1));
+	uint4 __f4_zz_rename_at_60 = ((uint4)uint4(1,1,1,1));
+	uint4 __f4_ww_rename_at_61 = ((uint4)uint4(1,1,1,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_168, cast<uint4>::from(__f4_0_rename_at_53)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_169, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_170, cast<uint4>::from(__f4_x_rename_at_54)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_171, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_172, cast<uint4>::from(__f4_y_rename_at_55)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_173, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_174, cast<uint4>::from(__f4_z_rename_at_56)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_175, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_176, cast<uint4>::from(__f4_w_rename_at_57)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_177, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_178, cast<uint4>::from(__f4_xx_rename_at_58)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_179, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_180, cast<uint4>::from(__f4_yy_rename_at_59)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_181, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_182, cast<uint4>::from(__f4_zz_rename_at_60)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_183, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_184, cast<uint4>::from(__f4_ww_rename_at_61)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_185, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+}
+
+inline void _Func_0x60_test_vec2_db65dc36af37d92e ( Context * __context__, range __a_rename_at_6, bool __isRange_rename_at_6 )
+{
+	range __f2_0_rename_at_7 = ((range)range(0,0));
+	range __f2_x_rename_at_8 = ((range)range(1,2));
+	range __f2_y_rename_at_9 = ((range)range(1,2));
+	range __f2_z_rename_at_10 = ((range)range(1,2));
+	range __f2_w_rename_at_11 = ((range)range(1,2));
+	range __f2_xx_rename_at_12 = ((range)range(0,1));
+	range __f2_yy_rename_at_13 = ((range)range(0,1));
+	range __f2_zz_rename_at_14 = ((range)range(0,1));
+	range __f2_ww_rename_at_15 = ((range)range(0,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_186, cast<range>::from(__f2_0_rename_at_7)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_187, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_188, cast<range>::from(__f2_x_rename_at_8)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_189, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_190, cast<range>::from(__f2_y_rename_at_9)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_191, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_192, cast<range>::from(__f2_z_rename_at_10)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_193, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_194, cast<range>::from(__f2_w_rename_at_11)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_195, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	if ( __isRange_rename_at_6 )
+	{
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_196, cast<range>::from(__f2_xx_rename_at_12)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_197, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_198, cast<range>::from(__f2_yy_rename_at_13)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_199, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_200, cast<range>::from(__f2_zz_rename_at_14)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_201, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_202, cast<range>::from(__f2_ww_rename_at_15)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_203, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	} else {
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_204, cast<range>::from(__f2_xx_rename_at_12)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_205, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_206, cast<range>::from(__f2_yy_rename_at_13)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_207, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_208, cast<range>::from(__f2_zz_rename_at_14)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_209, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_210, cast<range>::from(__f2_ww_rename_at_15)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_211, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	};
+}
+
+inline void _Func_0x60_test_vec2_7ec1e722ddb20d04 ( Context * __context__, urange __a_rename_at_6, bool __isRange_rename_at_6 )
+{
+	urange __f2_0_rename_at_7 = ((urange)urange(0,0));
+	urange __f2_x_rename_at_8 = ((urange)urange(1,2));
+	urange __f2_y_rename_at_9 = ((urange)urange(1,2));
+	urange __f2_z_rename_at_10 = ((urange)urange(1,2));
+	urange __f2_w_rename_at_11 = ((urange)urange(1,2));
+	urange __f2_xx_rename_at_12 = ((urange)urange(0,1));
+	urange __f2_yy_rename_at_13 = ((urange)urange(0,1));
+	urange __f2_zz_rename_at_14 = ((urange)urange(0,1));
+	urange __f2_ww_rename_at_15 = ((urange)urange(0,1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_212, cast<urange>::from(__f2_0_rename_at_7)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_213, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_214, cast<urange>::from(__f2_x_rename_at_8)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_215, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_216, cast<urange>::from(__f2_y_rename_at_9)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_217, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_218, cast<urange>::from(__f2_z_rename_at_10)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_219, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_220, cast<urange>::from(__f2_w_rename_at_11)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_221, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+	if ( __isRange_rename_at_6 )
+	{
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_222, cast<urange>::from(__f2_xx_rename_at_12)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_223, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_224, cast<urange>::from(__f2_yy_rename_at_13)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_225, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_226, cast<urange>::from(__f2_zz_rename_at_14)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_227, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_228, cast<urange>::from(__f2_ww_rename_at_15)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_229, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	} else {
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_230, cast<urange>::from(__f2_xx_rename_at_12)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_231, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_232, cast<urange>::from(__f2_yy_rename_at_13)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_233, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_234, cast<urange>::from(__f2_zz_rename_at_14)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_235, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_236, cast<urange>::from(__f2_ww_rename_at_15)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_237, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0x6abc71af8348239a>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+	};
+}
+
+inline void test_cvt_b1c4b2cf8e077f42 ( Context * __context__, int32_t __a_rename_at_73, int32_t __b_rename_at_73, int32_t __c_rename_at_73, int32_t __d_rename_at_73 )
+{
+	DAS_ASSERT((SimPolicy<float2>::Equ(cvt_ifloat2(int2(__a_rename_at_73,__b_rename_at_73)),float2(__a_rename_at_73,__b_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<float3>::Equ(cvt_ifloat3(int3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73)),float3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<float4>::Equ(cvt_ifloat4(int4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73)),float4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<float2>::Equ(cvt_ufloat2(uint2(__a_rename_at_73,__b_rename_at_73)),float2(__a_rename_at_73,__b_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<float3>::Equ(cvt_ufloat3(uint3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73)),float3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<float4>::Equ(cvt_ufloat4(uint4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73)),float4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<int2>::Equ(cvt_int2(float2(__a_rename_at_73,__b_rename_at_73)),int2(__a_rename_at_73,__b_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<int3>::Equ(cvt_int3(float3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73)),int3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<int4>::Equ(cvt_int4(float4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73)),int4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<uint2>::Equ(cvt_uint2(float2(__a_rename_at_73,__b_rename_at_73)),uint2(__a_rename_at_73,__b_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<uint3>::Equ(cvt_uint3(float3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73)),uint3(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<uint4>::Equ(cvt_uint4(float4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73)),uint4(__a_rename_at_73,__b_rename_at_73,__c_rename_at_73,__d_rename_at_73),*__context__,nullptr)));
+}
+
+inline bool test_d3f425db6546ae08 ( Context * __context__ )
+{
+	_Func_0x60_test_vec2_ba1dd7a8a8bf59bc(__context__,v_zero(),false);
+	_Func_0x60_test_vec3_90c01ccd749145f2(__context__,v_zero());
+	_Func_0x60_test_vec4_5deb4589c37450ab(__context__,v_zero());
+	_Func_0x60_test_vec2_20274c73d3ae2045(__context__,int2(0,0),false);
+	_Func_0x60_test_vec3_fc71262baa05ffb(__context__,int3(0,0,0));
+	_Func_0x60_test_vec4_1354365b96ffc1ee(__context__,int4(0,0,0,0));
+	_Func_0x60_test_vec2_c8111223f1f10e43(__context__,uint2(0,0),false);
+	_Func_0x60_test_vec3_104d34767c77f4b(__context__,uint3(0,0,0));
+	_Func_0x60_test_vec4_f67fb6577603cee0(__context__,uint4(0,0,0,0));
+	_Func_0x60_test_vec2_db65dc36af37d92e(__context__,range(0,0),true);
+	_Func_0x60_test_vec2_7ec1e722ddb20d04(__context__,urange(0,0),true);
+	test_cvt_b1c4b2cf8e077f42(__context__,1,2,3,4);
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_test_vec2_ba1dd7a8a8bf59bc
+	aotLib[0x440e0f6f2239d6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float2 , bool  ),&_Func_0x60_test_vec2_ba1dd7a8a8bf59bc>>();
+	};
+	// _Func_0x60_test_vec3_90c01ccd749145f2
+	aotLib[0x819ae9b92fc41eb9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float3  ),&_Func_0x60_test_vec3_90c01ccd749145f2>>();
+	};
+	// _Func_0x60_test_vec4_5deb4589c37450ab
+	aotLib[0xd34d0708a6a41e95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float4  ),&_Func_0x60_test_vec4_5deb4589c37450ab>>();
+	};
+	// _Func_0x60_test_vec2_20274c73d3ae2045
+	aotLib[0x217bc0481d0406c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int2 , bool  ),&_Func_0x60_test_vec2_20274c73d3ae2045>>();
+	};
+	// _Func_0x60_test_vec3_fc71262baa05ffb
+	aotLib[0x228f6cf9af5e54ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int3  ),&_Func_0x60_test_vec3_fc71262baa05ffb>>();
+	};
+	// _Func_0x60_test_vec4_1354365b96ffc1ee
+	aotLib[0x6fd93caccb13b305] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int4  ),&_Func_0x60_test_vec4_1354365b96ffc1ee>>();
+	};
+	// _Func_0x60_test_vec2_c8111223f1f10e43
+	aotLib[0x234a2148a379db05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, uint2 , bool  ),&_Func_0x60_test_vec2_c8111223f1f10e43>>();
+	};
+	// _Func_0x60_test_vec3_104d34767c77f4b
+	aotLib[0x3d976c7379e7d591] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, uint3  ),&_Func_0x60_test_vec3_104d34767c77f4b>>();
+	};
+	// _Func_0x60_test_vec4_f67fb6577603cee0
+	aotLib[0xbb2ca1bdbab6d5ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, uint4  ),&_Func_0x60_test_vec4_f67fb6577603cee0>>();
+	};
+	// _Func_0x60_test_vec2_db65dc36af37d92e
+	aotLib[0xaa95e257e637d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, range , bool  ),&_Func_0x60_test_vec2_db65dc36af37d92e>>();
+	};
+	// _Func_0x60_test_vec2_7ec1e722ddb20d04
+	aotLib[0x5814d26c9531e5e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, urange , bool  ),&_Func_0x60_test_vec2_7ec1e722ddb20d04>>();
+	};
+	// test_cvt_b1c4b2cf8e077f42
+	aotLib[0xa0419919432420a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , int32_t , int32_t , int32_t  ),&test_cvt_b1c4b2cf8e077f42>>();
+	};
+	// test_d3f425db6546ae08
+	aotLib[0x7485248b06e78acc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_d3f425db6546ae08>>();
+	};
+	// [[ init script ]]
+	aotLib[0xb267459b697f8727] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -1152,6 +1152,8 @@ namespace das
         uint32_t    stack = 16*1024;                    // 0 for unique stack
         bool        intern_strings = false;             // use string interning lookup for regular string heap
         bool        persistent_heap = false;
+        bool        swiss_tables = false;               // tables probe groups of control bytes, instead of linear probing over hashes
+        bool        clone_snapshot = false;             // context clones copy current globals of the parent, instead of running the init script
         bool        multiple_contexts = false;          // code supports context safety
         uint32_t    heap_size_hint = 65536;
         uint32_t    string_heap_size_hint = 65536;
@@ -1181,6 +1183,7 @@ namespace das
         bool no_optimizations = false;                  // disable optimizations, regardless of settings
         bool fail_on_no_aot = true;                     // AOT link failure is error
         bool fail_on_lack_of_aot_export = false;        // remove_unused_symbols = false is missing in the module, which is passed to AOT
+        bool profile_compile = false;                   // time and heap growth of each pass, module and macro, see ast_compile_profile.h
     // debugger
         //  when enabled
         //      1. disables [fastcall]
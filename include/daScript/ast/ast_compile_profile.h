@@ -0,0 +1,73 @@
+#pragma once
+
+#include "daScript/ast/ast.h"
+
+namespace das {
+
+    // compile time profiler
+    //  records nested scopes of the compilation pipeline: modules, passes and macro invocations
+    //  installed per thread, either by the host (to cover simulate and aot as well),
+    //  or by compileDaScript itself when CodeOfPolicies::profile_compile is set
+    struct CompileProfileEvent {
+        const char *    category = "";      // module, pass or macro
+        string          name;
+        string          module;             // module being compiled, when the scope was opened
+        int64_t         start = 0;          // usec, since the profiler was installed
+        int64_t         duration = 0;       // usec
+        int64_t         heapGrowth = 0;     // bytes of the process heap in use, after the scope vs before
+        uint32_t        inferPasses = 0;    // inferTypesDirty iterations, within the scope
+        int32_t         depth = 0;
+    };
+
+    enum class CompileProfileFormat {
+        text,           // totals per pass, per macro and per module
+        json,           // totals and raw events
+        chromeTrace     // chrome://tracing or perfetto
+    };
+
+    class CompileProfiler {
+    public:
+        CompileProfiler();
+        ~CompileProfiler();
+        static CompileProfiler * current();
+        void install();
+        void uninstall();
+        int32_t begin ( const char * category, const string & name );
+        void end ( int32_t index );
+        void countInferPass() { inferPasses ++; }
+        void report ( TextWriter & tout, CompileProfileFormat format ) const;
+        bool heapGrowthSupported() const;
+        const vector<CompileProfileEvent> & getEvents() const { return events; }
+    protected:
+        void reportText ( TextWriter & tout ) const;
+        void reportJson ( TextWriter & tout ) const;
+        void reportChromeTrace ( TextWriter & tout ) const;
+    protected:
+        vector<CompileProfileEvent>     events;
+        vector<int32_t>                 stack;
+        vector<int64_t>                 heapAtBegin;
+        vector<uint32_t>                inferAtBegin;
+        vector<string>                  modules;
+        int64_t                         time0 = 0;
+        uint32_t                        inferPasses = 0;
+        CompileProfiler *               previous = nullptr;
+        bool                            installed = false;
+    };
+
+    // scope is a no-op, unless there is a profiler on this thread
+    class CompileProfileScope {
+    public:
+        __forceinline CompileProfileScope ( const char * category, const char * name ) {
+            if ( (profiler = CompileProfiler::current()) ) index = profiler->begin(category, name);
+        }
+        __forceinline CompileProfileScope ( const char * category, const string & name ) {
+            if ( (profiler = CompileProfiler::current()) ) index = profiler->begin(category, name);
+        }
+        __forceinline ~CompileProfileScope() {
+            if ( profiler ) profiler->end(index);
+        }
+    protected:
+        CompileProfiler *   profiler = nullptr;
+        int32_t             index = -1;
+    };
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "daScript/ast/ast.h"
+
+namespace das {
+
+    // compiled program, along with the module group which owns its dependencies
+    // contexts, simulated from the program, should not outlive it
+    struct CachedProgram : ptr_ref_count {
+        ProgramPtr                      program;
+        unique_ptr<ModuleGroup>         group;
+        vector<pair<string,uint64_t>>   sources;        // file name, hash of the source; main file goes first
+        uint64_t                        policiesHash = 0;
+        uint64_t                        sourcesHash = 0;
+        int64_t                         compileUsec = 0;
+    };
+    typedef smart_ptr<CachedProgram> CachedProgramPtr;
+
+    struct ProgramCacheStats {
+        uint64_t    hits = 0;
+        uint64_t    misses = 0;
+        int64_t     coldUsec = 0;           // spent compiling, on misses
+        int64_t     warmUsec = 0;           // spent validating sources, on hits
+    };
+
+    uint64_t hashCodeOfPolicies ( const CodeOfPolicies & policies );
+
+    // program cache
+    //  key is the file name and CodeOfPolicies. entry is valid, as long as main file and every module it requires
+    //  have the same source. parse, infer, optimize and allocateStack are skipped on hit; simulate still runs per context
+    //  sources are re-read via FileAccess, so its up to the access to invalidate files which changed on disk
+    class ProgramCache {
+    public:
+        CachedProgramPtr compile ( const string & fileName, const FileAccessPtr & access, TextWriter & logs,
+            bool exportAll = false, CodeOfPolicies policies = CodeOfPolicies() );
+        CachedProgramPtr find ( const string & fileName, const FileAccessPtr & access, const CodeOfPolicies & policies );
+        bool invalidate ( const string & fileName );
+        void clear();
+        size_t size() const { return entries.size(); }
+        const ProgramCacheStats & getStats() const { return stats; }
+        void resetStats() { stats = ProgramCacheStats(); }
+    protected:
+        static bool collectSources ( const string & fileName, const FileAccessPtr & access,
+            const CodeOfPolicies & policies, CachedProgram & entry );
+        static bool hashSource ( const string & fileName, const FileAccessPtr & access, uint64_t & hash );
+    protected:
+        das_hash_map<string,CachedProgramPtr>   entries;
+        ProgramCacheStats                       stats;
+    };
+}
@@ -20,5 +20,7 @@ namespace das
     NEED_MODULE(Module_Debugger); \
     NEED_MODULE(Module_FIO); \
     NEED_MODULE(Module_DASBIND); \
-    NEED_MODULE(Module_Network);
+    NEED_MODULE(Module_Network); \
+    NEED_MODULE(Module_JsonNative); \
+    NEED_MODULE(Module_RegexNative);
 
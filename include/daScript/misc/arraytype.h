@@ -95,6 +95,7 @@ namespace das
             struct {
                 bool    shared : 1;
                 bool    hopeless : 1;   // needs to be deleted without fuss (exceptions)
+                bool    swiss : 1;      // table only, control bytes follow hashes (see TableHash)
             };
             uint32_t    flags;
         };
@@ -113,10 +114,15 @@ namespace das
     struct Table : Array {
         char *      keys;
         uint64_t *  hashes;
-        uint32_t    maxLookups;
+        uint32_t    maxLookups;     // linear probing limit, or insertions left before grow for the swiss layout
         uint32_t    shift;
     };
 
+    // bytes per table slot, key and value included
+    __forceinline uint32_t table_slot_size ( const Table & tab, uint32_t keyValueSize ) {
+        return keyValueSize + uint32_t(sizeof(uint64_t)) + (tab.swiss ? 1 : 0);
+    }
+
     void table_clear ( Context & context, Table & arr );
     void table_lock ( Context & context, Table & arr );
     void table_unlock ( Context & context, Table & arr );
@@ -46,9 +46,90 @@ namespace das {
         atomic<int>         mRef{0};
     };
 
+    // Chase-Lev work-stealing deque (Le, Pop, Cohen, Zappa Nardelli - "Correct and Efficient Work-Stealing for Weak Memory Models")
+    // owner thread pushes and pops at the bottom (LIFO), any other thread steals from the top (FIFO)
+    template <typename T>
+    class WorkStealingDeque {
+        struct Ring {
+            Ring ( int64_t cap ) : capacity(cap), mask(cap-1), data(new atomic<T>[cap]) {}
+            __forceinline T get ( int64_t i ) const { return data[i & mask].load(memory_order_relaxed); }
+            __forceinline void put ( int64_t i, T x ) { data[i & mask].store(x, memory_order_relaxed); }
+            Ring * grow ( int64_t b, int64_t t ) const {
+                auto ring = new Ring(capacity*2);
+                for ( int64_t i=t; i!=b; ++i ) ring->put(i, get(i));
+                return ring;
+            }
+            int64_t                 capacity;
+            int64_t                 mask;
+            unique_ptr<atomic<T>[]> data;
+        };
+    public:
+        WorkStealingDeque ( int64_t capacity = 256 ) {
+            DAS_ASSERTF((capacity & (capacity-1))==0, "capacity must be power of 2");
+            auto ring = new Ring(capacity);
+            mRing.store(ring, memory_order_relaxed);
+            mRings.emplace_back(ring);
+        }
+        WorkStealingDeque ( const WorkStealingDeque & ) = delete;
+        WorkStealingDeque & operator = ( const WorkStealingDeque & ) = delete;
+        // owner only
+        void push ( T x ) {
+            int64_t b = mBottom.load(memory_order_relaxed);
+            int64_t t = mTop.load(memory_order_acquire);
+            Ring * ring = mRing.load(memory_order_relaxed);
+            if ( b - t > ring->capacity - 1 ) {
+                ring = ring->grow(b, t);
+                mRings.emplace_back(ring);  // old rings stay alive, thieves may still read them
+                mRing.store(ring, memory_order_release);
+            }
+            ring->put(b, x);
+            atomic_thread_fence(memory_order_release);
+            mBottom.store(b + 1, memory_order_relaxed);
+        }
+        // owner only
+        bool pop ( T & x ) {
+            int64_t b = mBottom.load(memory_order_relaxed) - 1;
+            Ring * ring = mRing.load(memory_order_relaxed);
+            mBottom.store(b, memory_order_relaxed);
+            atomic_thread_fence(memory_order_seq_cst);
+            int64_t t = mTop.load(memory_order_relaxed);
+            if ( t > b ) {
+                mBottom.store(b + 1, memory_order_relaxed);
+                return false;
+            }
+            x = ring->get(b);
+            if ( t == b ) {     // last element, race against thieves
+                bool won = mTop.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed);
+                mBottom.store(b + 1, memory_order_relaxed);
+                return won;
+            }
+            return true;
+        }
+        // any thread
+        bool steal ( T & x ) {
+            int64_t t = mTop.load(memory_order_acquire);
+            atomic_thread_fence(memory_order_seq_cst);
+            int64_t b = mBottom.load(memory_order_acquire);
+            if ( t >= b ) return false;
+            Ring * ring = mRing.load(memory_order_acquire);
+            x = ring->get(t);
+            return mTop.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed);
+        }
+        // approximate, when called from non-owner thread
+        bool empty() const {
+            return mBottom.load(memory_order_relaxed) <= mTop.load(memory_order_relaxed);
+        }
+    protected:
+        alignas(64) atomic<int64_t>     mTop{0};
+        alignas(64) atomic<int64_t>     mBottom{0};
+        alignas(64) atomic<Ring *>      mRing{nullptr};
+        vector<unique_ptr<Ring>>        mRings;
+    };
+
     class JobQue {
     public:
         JobQue();
+        JobQue( int threadCount );
         JobQue ( const JobQue & ) = delete;
         JobQue ( JobQue && ) = delete;
         JobQue & operator = ( const JobQue & ) = delete;
@@ -67,6 +148,7 @@ namespace das {
         void EvalMainThreadJobs();
         void wait();
         void Reset() { wait( ); }
+        uint64_t getTotalSteals() const { return mTotalSteals; }
     protected:
         struct JobEntry {
             JobEntry( Job&& _function, JobCategory _category, JobPriority _priority) {
@@ -78,29 +160,46 @@ namespace das {
             JobPriority		priority = JobPriority::Inactive;
             JobCategory		category = 0;
         };
+        enum {
+            NumPriorities = int(JobPriority::Maximum) - int(JobPriority::Minimum) + 1,
+            NumCategorySlots = 64,          // queued jobs are counted per category slot, collisions only make areJobsPending conservative
+        };
+        // each worker owns one deque per priority. jobs pushed by the worker itself go there,
+        // jobs pushed from other threads go to the inbox of the worker, picked round-robin
         struct ThreadEntry {
-            ThreadEntry( unique_ptr<thread> && thread) {
-                threadPointer = das::move(thread);
-            };
-            unique_ptr<thread>	threadPointer;
-            JobPriority			currentPriority = JobPriority::Inactive;
-            JobCategory			currentCategory = 0;
+            ThreadEntry() {}
+            unique_ptr<thread>              threadPointer;
+            atomic<JobPriority>             currentPriority{JobPriority::Inactive};
+            atomic<JobCategory>             currentCategory{0};
+            WorkStealingDeque<JobEntry *>   local[NumPriorities];
+            mutex                           inboxMutex;
+            deque<JobEntry *>               inbox[NumPriorities];
+            atomic<int>                     inboxCount{0};
         };
     protected:
+        void start(int threadCount);
         void join();
         void job(int threadIndex);
         void submit(Job && job, JobCategory category, JobPriority priority);
+        void wakeUp(int count);
+        JobEntry * fetch(int threadIndex, uint32_t & seed);
+        JobEntry * popInbox(ThreadEntry & entry, int pi, bool wait);
+        static int priorityIndex(JobPriority priority) { return clamp(int(priority),int(JobPriority::Minimum),int(JobPriority::Maximum)) - int(JobPriority::Minimum); }
     protected:
+        mutex mSleepMutex;
         condition_variable mCond;
         int mSleepMs;
         atomic<bool>	mShutdown{false};
         atomic<int>		mThreadCount{0};
+        atomic<int>     mSleeping{0};
+        atomic<uint32_t> mNextInbox{0};
         static thread::id mTheMainThread;
-        mutex mFifoMutex;
     protected:
-        deque<JobEntry>	mFifo;
-        vector<ThreadEntry>		mThreads;
+        vector<unique_ptr<ThreadEntry>>	mThreads;
+        atomic<int> mJobsQueued{0};
         atomic<int> mJobsRunning{0};
+        atomic<int> mCategoryQueued[NumCategorySlots];
+        atomic<uint64_t> mTotalSteals{0};
     protected:
         mutex mEvalMainThreadMutex;
         vector<Job> mEvalMainThread;
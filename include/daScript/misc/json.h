@@ -0,0 +1,113 @@
+#pragma once
+
+namespace das {
+
+    enum class JsonType : uint8_t {
+            null_value
+        ,   boolean
+        ,   number
+        ,   string
+        ,   array
+        ,   object
+    };
+
+    // values are stored in the order they appear in the text
+    // children of an array or an object follow it, object children go as key, value, key, value...
+    // 'next' is the index of the first node after the value, including all of its children
+    struct JsonNode {
+        JsonType        type = JsonType::null_value;
+        bool            boolean = false;
+        bool            isInteger = false;  // number, which is exactly 'integer'
+        uint32_t        count = 0;          // elements of the array, fields of the object, or length of the string
+        uint32_t        next = 0;
+        uint32_t        offset = 0;         // in the text, for error messages
+        union {
+            double          number;
+            const char *    str;
+        };
+        int64_t         integer = 0;
+        JsonNode() : number(0.0) {}
+    };
+
+    // whole text is parsed in one go, into the node array and the string arena of the document
+    // arena is allocated up front, unescaped strings are never longer than the text, so they never move
+    // document can be reused, arena and nodes keep their capacity
+    class JsonDocument {
+    public:
+        bool parse ( const char * text, uint32_t length );
+        const JsonNode & root() const { return nodes[0]; }
+        const JsonNode & operator [] ( uint32_t index ) const { return nodes[index]; }
+        uint32_t size() const { return uint32_t(nodes.size()); }
+        const string & getError() const { return error; }
+        string describe ( uint32_t index ) const;   // line and column of the node
+        static const char * typeName ( JsonType type );
+        static int32_t maxDepth;
+    protected:
+        const char * skipWhiteSpace ( const char * it ) const;
+        const char * parseValue ( const char * it, int32_t depth );
+        const char * parseString ( const char * it, JsonNode & node );
+        const char * parseNumber ( const char * it, JsonNode & node );
+        const char * fail ( const char * it, const char * message );
+        string location ( uint32_t offset ) const;
+    protected:
+        vector<JsonNode>    nodes;
+        vector<char>        arena;
+        char *              arenaTop = nullptr;
+        const char *        text = nullptr;
+        const char *        textEnd = nullptr;
+        string              error;
+    };
+
+    // output buffer grows geometrically, unlike TextWriter, which reserves exactly what it appends
+    class JsonWriter {
+    public:
+        JsonWriter ( bool pr = true ) : pretty(pr) {}
+        void writeRaw ( const char * str, uint32_t length ) {
+            memcpy(allocate(length), str, length);
+        }
+        void writeChar ( char ch ) { *allocate(1) = ch; }
+        void writeString ( const char * str, uint32_t length );
+        void writeNumber ( double value );
+        void writeFloat ( float value );
+        void writeInteger ( int64_t value );
+        void writeUnsigned ( uint64_t value );
+        void writeBool ( bool value ) { value ? writeRaw("true",4) : writeRaw("false",5); }
+        void writeNull() { writeRaw("null",4); }
+        // containers, same layout as daslib/json write_json - one value per line, indented with tabs
+        void beginArray() { writeChar('['); first = true; depth++; }
+        void endArray() { depth--; if ( !first ) newLine(); writeChar(']'); first = false; }
+        void beginObject() { writeChar('{'); first = true; depth++; }
+        void endObject() { depth--; if ( !first ) newLine(); writeChar('}'); first = false; }
+        void element() {
+            if ( !first ) writeChar(',');
+            first = false;
+            newLine();
+        }
+        void key ( const char * str, uint32_t length ) {
+            element();
+            writeString(str, length);
+            pretty ? writeRaw(" : ",3) : writeChar(':');
+        }
+        const char * data() const { return buffer.data(); }
+        uint32_t size() const { return uint32_t(buffer.size()); }
+    protected:
+        void newLine() {
+            if ( pretty ) {
+                char * at = allocate(depth + 1);
+                *at = '\n';
+                memset(at + 1, '\t', depth);
+            }
+        }
+        char * allocate ( uint32_t length ) {
+            size_t sz = buffer.size();
+            if ( sz + length > buffer.capacity() ) buffer.reserve(das::max(buffer.capacity()*2, sz + length + 256));
+            buffer.resize(sz + length);
+            return buffer.data() + sz;
+        }
+    protected:
+        vector<char>    buffer;
+        uint32_t        depth = 0;
+        bool            pretty = true;
+        bool            first = true;
+    };
+}
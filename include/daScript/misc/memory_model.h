@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 namespace das {
 
 #if DAS_TRACK_ALLOCATIONS
@@ -10,6 +12,14 @@ namespace das {
 
     #define DAS_PAGE_GC_MASK    0x80000000
 
+    // gc marks can be set from several threads at once, when heap is collected with the job queue
+    __forceinline void das_atomic_mark ( uint32_t & bits, uint32_t mask ) {
+        auto & abits = reinterpret_cast<atomic<uint32_t> &>(bits);
+        if ( !(abits.load(memory_order_relaxed) & mask) ) {
+            abits.fetch_or(mask, memory_order_relaxed);
+        }
+    }
+
     struct LineInfo;
 
     struct Deck {
@@ -38,14 +48,23 @@ namespace das {
             gc_bits = (uint32_t*) das_aligned_alloc16(total / 32 * 4);
             memset ( gc_bits, 0, total / 32 * 4);
             look = 0;
-            gc_allocated = 0;
             if ( next ) next->beforeGC();
         }
         void afterGC() {
+            if ( !gc_bits ) return;     // deck was allocated during collection, everything in it is alive
             memcpy ( bits, gc_bits, total / 32 * 4 );
             das_aligned_free16 ( gc_bits );
             gc_bits = nullptr;
-            allocated = gc_allocated;
+            allocated = 0;
+            for ( uint32_t i=0, maxt=total/32; i!=maxt; ++i ) {
+                allocated += das_popcount(bits[i]);
+            }
+        }
+        void abortGC() {
+            if ( gc_bits ) {
+                das_aligned_free16 ( gc_bits );
+                gc_bits = nullptr;
+            }
         }
         __forceinline bool isOwnPtr ( char * ptr ) const {
             return (ptr>=data) && (ptr<data+totalBytes);
@@ -69,6 +88,9 @@ namespace das {
                     uint32_t j = 31 - das_clz(nb);
                     bits[look] = b | (1u<<j);
                     allocated ++;
+                    if ( gc_bits ) {                // allocated during incremental collection, alive
+                        gc_bits[look] |= 1u<<j;
+                    }
                     uint32_t ofs = (look * 32 + j);
                     DAS_ASSERT(ofs < total);
                     return data + ofs * size;
@@ -90,6 +112,9 @@ namespace das {
             bits[i] = b ^ (1u<<j);
             look = i;
             allocated --;
+            if ( gc_bits ) {
+                gc_bits[i] &= ~(1u<<j);
+            }
         }
         __forceinline void mark ( char * ptr ) {
             ptrdiff_t idx = (ptr - data) / size;
@@ -97,11 +122,7 @@ namespace das {
             uint32_t uidx = uint32_t(idx);
             uint32_t i = uidx >> 5;
             uint32_t j = uidx & 31;
-            uint32_t b = gc_bits[i];
-            if ( !(b & (1u<<j)) ) {
-                gc_bits[i] = b | (1u<<j);
-                gc_allocated ++;
-            }
+            das_atomic_mark(gc_bits[i], 1u<<j);
         }
         char *      data = nullptr;
         uint32_t *  bits = nullptr;
@@ -111,12 +132,20 @@ namespace das {
         uint32_t    totalBytes = 0;
         uint32_t    look = 0;
         uint32_t    allocated = 0;
-        uint32_t    gc_allocated = 0;
         Deck *      next = nullptr;
     };
 
 #define DAS_MAX_SHOE_ALLOCATION     256
 #define DAS_MAX_SHOE_CUNKS          (DAS_MAX_SHOE_ALLOCATION>>4)
+#define DAS_SHOE_PAGE_SHIFT         12
+
+#ifndef DAS_FREE_LIST_LIMIT
+#if DAS_SANITIZER
+#define DAS_FREE_LIST_LIMIT         0       // immediate reuse would hide use-after-free
+#else
+#define DAS_FREE_LIST_LIMIT         256     // per size class
+#endif
+#endif
 
     struct Shoe {
         Shoe () {
@@ -134,6 +163,7 @@ namespace das {
                 if ( chunks[i] ) delete chunks[i];
                 chunks[i] = nullptr;
             }
+            pages.clear();
         }
         void reset() {
             // TODO: modify watermarks
@@ -152,15 +182,39 @@ namespace das {
             }
             return nullptr;
         }
+        void addDeck ( uint32_t si, Deck * ch ) {
+            ch->next = chunks[si];
+            chunks[si] = ch;
+            if ( !ch->totalBytes ) return;
+            uint64_t pfrom = uint64_t(intptr_t(ch->data)) >> DAS_SHOE_PAGE_SHIFT;
+            uint64_t pto = uint64_t(intptr_t(ch->data + ch->totalBytes - 1)) >> DAS_SHOE_PAGE_SHIFT;
+            for ( uint64_t page=pfrom; page<=pto; ++page ) {
+                pages[page] = ch;       // page, which is shared by two decks, goes to the newer one
+            }
+        }
+        // page lookup covers everything but the pages, which are shared by two decks. those go the long way
+        __forceinline Deck * owner ( char * ptr, uint32_t si ) const {
+            auto it = pages.find(uint64_t(intptr_t(ptr)) >> DAS_SHOE_PAGE_SHIFT);
+            if ( it != pages.end() ) {
+                Deck * ch = it->second;
+                if ( ch->isOwnPtr(ptr) ) {
+                    return ch->size==((si+1)<<4) ? ch : nullptr;
+                }
+            }
+            for ( auto ch = chunks[si]; ch; ch=ch->next ) {
+                if ( ch->isOwnPtr(ptr) ) {
+                    return ch;
+                }
+            }
+            return nullptr;
+        }
         void free ( char * ptr, uint32_t size ) {
             size = (size + 15) & ~15;
             DAS_ASSERT(size && size<=DAS_MAX_SHOE_ALLOCATION);
             uint32_t si = (size >> 4) - 1;
-            for ( auto ch = chunks[si]; ch; ch=ch->next ) {
-                if ( ch->isOwnPtr(ptr) ) {
-                    ch->free(ptr);
-                    return;
-                }
+            if ( auto ch = owner(ptr, si) ) {
+                ch->free(ptr);
+                return;
             }
             DAS_FATAL_ERROR("deleting %p %i, which is not a chunk pointer (or chunk size mismatch)\n", (void *)ptr, size);
         }
@@ -168,11 +222,9 @@ namespace das {
             size = (size + 15) & ~15;
             DAS_ASSERT(size && size<=DAS_MAX_SHOE_ALLOCATION);
             uint32_t si = (size >> 4) - 1;
-            for ( auto ch = chunks[si]; ch; ch=ch->next ) {
-                if ( ch->isOwnPtr(ptr) ) {
-                    ch->mark(ptr);
-                    return true;
-                }
+            if ( auto ch = owner(ptr, si) ) {
+                ch->mark(ptr);
+                return true;
             }
             return false;
         }
@@ -181,25 +233,23 @@ namespace das {
                 if ( chunks[i] ) chunks[i]->beforeGC();
             }
         }
+        void abortGC() {
+            for ( int i=0; i!=DAS_MAX_SHOE_CUNKS; ++i ) {
+                for ( auto ch = chunks[i]; ch; ch=ch->next ) {
+                    ch->abortGC();
+                }
+            }
+        }
         bool isOwnPtr ( char * ptr, uint32_t size ) const {
             DAS_ASSERT(size && size<=DAS_MAX_SHOE_ALLOCATION);
             uint32_t si = (size >> 4) - 1;
-            for ( auto ch = chunks[si]; ch; ch=ch->next ) {
-                if ( ch->isOwnPtr(ptr) ) {
-                    return true;
-                }
-            }
-            return false;
+            return owner(ptr, si)!=nullptr;
         }
         bool isAllocatedPtr ( char * ptr, uint32_t size ) const {
             DAS_ASSERT(size && size<=DAS_MAX_SHOE_ALLOCATION);
             uint32_t si = (size >> 4) - 1;
-            for ( auto ch = chunks[si]; ch; ch=ch->next ) {
-                if ( ch->isOwnPtr(ptr) ) {
-                    return ch->isAllocatedPtr(ptr);
-                }
-            }
-            return false;
+            auto ch = owner(ptr, si);
+            return ch ? ch->isAllocatedPtr(ptr) : false;
         }
         void getStats ( uint32_t & depth, uint32_t & pages, uint64_t & bytes, uint64_t & totalBytes ) const {
             depth = 0;
@@ -235,13 +285,28 @@ namespace das {
         uint64_t totalBytesAllocated ( ) const {
             uint32_t d, p; uint64_t b, t;
             getStats(d, p, b, t);
-            return d;
+            return t;
         }
         Deck *  chunks[DAS_MAX_SHOE_CUNKS];
+        das_hash_map<uint64_t,Deck *> pages;    // page index to deck, which owns it
     };
 
     typedef function<int(int)> CustomGrowFunction;
 
+    struct AllocationStats {
+        uint64_t    allocations = 0;        // total number of allocations
+        uint64_t    frees = 0;              // total number of frees
+        uint64_t    freeListHits = 0;       // allocations, which were served from size class free lists
+        uint64_t    bytesAllocated = 0;     // currently in use
+        uint64_t    bytesReserved = 0;      // decks, and big allocations
+        uint64_t    bytesInFreeLists = 0;   // freed, but still held by size class free lists
+        uint32_t    decks = 0;
+        uint32_t    bigAllocations = 0;
+        __forceinline double fragmentation() const {    // share of the reserved memory, which is not in use
+            return bytesReserved ? 1.0 - double(bytesAllocated) / double(bytesReserved) : 0.0;
+        }
+    };
+
     struct MemoryModel : ptr_ref_count {
         enum { default_initial_size = 65536 };
         MemoryModel(const MemoryModel &) = delete;
@@ -251,9 +316,13 @@ namespace das {
         virtual void reset();
         void setInitialSize ( uint32_t size );
         uint32_t grow ( uint32_t si );
+        void beforeGC();
+        void abortGC();
         virtual void sweep();
         char * allocate ( uint32_t size );
         bool free ( char * ptr, uint32_t size );
+        void flushFreeLists();      // returns cached blocks to their decks
+        void getStats ( AllocationStats & stats ) const;
         char * reallocate ( char * ptr, uint32_t size, uint32_t nsize );
         __forceinline int depth() const { return shoe.depth(); }
         __forceinline bool isOwnPtr( char * ptr, uint32_t size ) const {
@@ -270,6 +339,13 @@ namespace das {
         uint32_t                totalAllocated;
         uint32_t                maxAllocated;
         uint32_t                initialSize = 0;
+        bool                    marking = false;    // between beforeGC and sweep, new allocations are alive
+        uint32_t                freeListLimit = DAS_FREE_LIST_LIMIT;       // can't be above DAS_FREE_LIST_LIMIT
+        char **                 freeList[DAS_MAX_SHOE_CUNKS];       // stacks of freed blocks, allocated on first use
+        uint32_t                freeListSize[DAS_MAX_SHOE_CUNKS];
+        uint64_t                totalAllocations = 0;
+        uint64_t                totalFrees = 0;
+        uint64_t                freeListHits = 0;
         Shoe                    shoe;
         das_hash_map<void *,uint32_t> bigStuff;  // note: can't use char *, some stl implementations try hashing it as string
 #if DAS_SANITIZER
@@ -33,4 +33,79 @@ namespace das {
         socket_t server_fd = 0;
         socket_t client_fd = 0;
     };
-}
\ No newline at end of file
+    enum class NetworkFraming {
+            raw         // data is passed as it arrives
+        ,   length32    // uint32 little endian size, followed by the message
+        ,   line        // message ends with '\n', which is not included (nor is '\r' before it)
+    };
+
+    struct NetworkMessage {
+        uint8_t *   data;
+        int32_t     size;
+        int32_t     connection;
+    };
+
+    // many connections on one port (epoll on linux, poll everywhere else)
+    //  each connection has its own read buffer, which is split into messages according to the framing
+    //  messages from all connections are passed to onData at once, at the end of each tick
+    //  send queues the message, which is written as the socket allows. send fails if the queue is full,
+    //  and the connection is not read from until its queue is drained (backpressure)
+    class MultiServer : public ptr_ref_count {
+    public:
+        MultiServer ();
+        virtual ~MultiServer();
+        bool init ( int port = 9000, NetworkFraming fr = NetworkFraming::raw );    // port 0 picks any free port
+        bool is_open() const;
+        int32_t get_port() const;
+        int32_t tick ( int32_t timeoutMsec = 0 );       // returns number of messages passed to onData
+        bool send_msg ( int32_t connection, const char * data, int32_t size );
+        void close_connection ( int32_t connection );   // after the pending output is sent
+        bool is_connected ( int32_t connection ) const;
+        int32_t connection_count() const;
+        int32_t get_queued ( int32_t connection ) const;
+        void set_limits ( int32_t maxMessageSize, int32_t maxQueueSize );
+    protected:
+        virtual void onConnect ( int32_t connection );
+        virtual void onDisconnect ( int32_t connection );
+        virtual void onData ( NetworkMessage * messages, int32_t count );
+        virtual void onError ( const char * msg, int code );
+    protected:
+        struct Connection {
+            socket_t        fd;
+            vector<uint8_t> input;
+            uint32_t        inputOffset = 0;        // already passed to onData
+            vector<uint8_t> output;
+            uint32_t        outputOffset = 0;       // already sent
+            bool            reading = true;         // false while the output is over the limit
+            bool            writing = false;        // output is waiting for the socket
+            bool            closing = false;        // close as soon as the output is sent
+            bool            closed = false;         // peer is gone, or error
+        };
+        struct ReadyEvent {
+            int32_t     connection;                 // 0 is server itself
+            bool        readable;
+            bool        writable;
+            bool        failed;
+        };
+        void acceptAll();
+        void readAll ( Connection & conn );
+        void flush ( Connection & conn );
+        void frame ( int32_t connection, Connection & conn );
+        void updateInterest ( int32_t connection, Connection & conn );
+        void closeNow ( int32_t connection );
+        void wait ( int32_t timeoutMsec );
+    protected:
+        socket_t                            server_fd;
+        int                                 poll_fd = -1;           // epoll only
+        int32_t                             port = 0;
+        NetworkFraming                      framing = NetworkFraming::raw;
+        uint32_t                            maxMessage = 1024*1024;
+        uint32_t                            maxQueue = 4*1024*1024;
+        int32_t                             nextConnection = 1;
+        bool                                inDispatch = false;
+        das_hash_map<int32_t,Connection>    connections;
+        vector<ReadyEvent>                  ready;
+        vector<NetworkMessage>              batch;
+        vector<int32_t>                     received;
+    };
+}
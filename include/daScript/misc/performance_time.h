@@ -4,6 +4,7 @@
 
 extern "C" int64_t ref_time_ticks ();
 extern "C" int get_time_usec ( int64_t reft );
+extern "C" double ref_time_delta_to_usec ( int64_t ticks );
 
 #if DAS_PROFILE_SECTIONS
 
@@ -117,9 +117,13 @@
         _BitScanForward(&r, x);
         return uint32_t(31 - r);
     }
+    __forceinline uint32_t das_popcount(uint32_t x) {
+        return uint32_t(__popcnt(x));
+    }
 #else
     #define das_clz __builtin_clz
     #define das_ctz __builtin_ctz
+    #define das_popcount __builtin_popcount
 #endif
 
 #ifdef _MSC_VER
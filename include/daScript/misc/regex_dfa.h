@@ -0,0 +1,113 @@
+#pragma once
+
+namespace das {
+
+    // same as daslib/regex ReOp. regex_compile flattens ReNode tree into the code, in prefix order
+    //  Char        length, characters...
+    //  Set         index of the 8 words of the set
+    //  Any, Eos
+    //  Group       index, subexpr
+    //  Plus, Star, Question    subexpr
+    //  Concat      left, right
+    //  Union       count, subexpressions...
+    enum class RegexOp : int32_t {
+            Char
+        ,   Set
+        ,   Any
+        ,   Eos
+        ,   Group
+        ,   Plus
+        ,   Star
+        ,   Question
+        ,   Concat
+        ,   Union
+    };
+
+    // Thompson NFA, with lazily built DFA on top of it. DFA finds where the match ends (leftmost, longest),
+    // then NFA is simulated over the match only, to find the groups (Pike VM, greedy repetitions).
+    // DFA states are built on demand, and the whole cache is dropped once it grows over maxStates.
+    // all of it is linear in the length of the text per attempted start, there is no backtracking
+    class RegexDfa {
+    public:
+        bool compile ( const int32_t * code, uint32_t codeSize, const uint32_t * sets, uint32_t setsSize );
+        // longest match, which starts at the offset. returns the end, or -1
+        int32_t match ( const char * str, int32_t length, int32_t offset );
+        // leftmost longest match, which starts at the offset or after
+        bool search ( const char * str, int32_t length, int32_t offset, int32_t & start, int32_t & end );
+        // groups of the last match, 0 is the whole match
+        int32_t groupCount() const { return int32_t(groups.size() / 2); }
+        int32_t groupStart ( int32_t index ) const { return groups[index*2]; }
+        int32_t groupEnd ( int32_t index ) const { return groups[index*2+1]; }
+        uint32_t stateCount() const { return uint32_t(anchored.states.size() + unanchored.states.size()); }
+        static uint32_t maxStates;
+    protected:
+        enum class InstKind : uint8_t { Set, Split, Save, Eos, Match };
+        struct Inst {
+            InstKind    kind;
+            int32_t     x = -1;         // next
+            int32_t     y = -1;         // alternative of the split, lower priority
+            int32_t     arg = 0;        // set index, or save slot
+        };
+        struct Node {                   // code, parsed back into the tree
+            RegexOp         op;
+            int32_t         arg = 0;
+            int32_t         first = 0;  // characters in the code, or first child
+            vector<int32_t> children;
+        };
+        struct State {
+            uint32_t    offset;         // of NFA instructions in the cache pool
+            uint32_t    count;
+            bool        accepting;
+            int8_t      acceptsAtEos = -1;
+        };
+        struct Cache {
+            vector<State>           states;
+            vector<int32_t>         pool;
+            vector<int32_t>         transitions;    // states x classes, -1 if not built yet
+            das_hash_map<string,int32_t>    index;
+            int32_t                 start = 0;
+            uint32_t                generation = 0; // bumped every time the cache is dropped
+            bool                    unanchored = false;
+        };
+        int32_t parseNode ( const int32_t * code, uint32_t codeSize, uint32_t & at );
+        int32_t build ( int32_t node, int32_t next );
+        int32_t emit ( InstKind kind, int32_t x = -1, int32_t y = -1, int32_t arg = 0 );
+        int32_t addSet ( const uint32_t * bits );
+        void buildClasses();
+        void closure ( vector<int32_t> & list, int32_t pc, bool throughEos );
+        void resetCache ( Cache & cache );
+        int32_t intern ( Cache & cache, vector<int32_t> & list );
+        int32_t step ( Cache & cache, int32_t state, uint8_t ch );
+        bool acceptsAtEos ( Cache & cache, int32_t state );
+        bool inSet ( int32_t set, uint8_t ch ) const { return (sets[set*8 + (ch>>5)] & (1u << (ch & 31))) != 0; }
+        int32_t skipToFirst ( const char * str, int32_t length, int32_t pos ) const;
+        int32_t longest ( const char * str, int32_t length, int32_t offset, bool memo );
+        void setGroups ( const char * str, int32_t length, int32_t start, int32_t end );
+        void matchGroups ( const char * str, int32_t length, int32_t start, int32_t end );
+    protected:
+        vector<Node>        nodes;
+        vector<Inst>        program;
+        vector<uint32_t>    sets;           // 8 words per set
+        das_hash_map<string,int32_t>    setIndex;
+        int32_t             startPc = 0;
+        int32_t             slotCount = 0;
+        uint8_t             classOf[256];
+        uint8_t             classRep[256];
+        uint32_t            classCount = 0;
+        uint32_t            firstSet[8];    // characters, which can start non-empty match
+        uint8_t             firstBytes[4];
+        int32_t             firstCount = 0; // how many characters in the first set, if there are only few
+        bool                canBeEmpty = false;
+        Cache               anchored;
+        Cache               unanchored;
+        vector<int32_t>     groups;
+        vector<uint32_t>    visited;
+        uint32_t            visitedGen = 0;
+        vector<int32_t>     scratch;
+        vector<int32_t>     stack;
+        vector<int32_t>     deadEnds;       // state of the failed candidates, per position of the search
+        int32_t             memoStart = 0;
+        int32_t             memoEnd = 0;
+        uint32_t            memoGeneration = 0;
+    };
+}
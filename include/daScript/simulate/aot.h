@@ -1426,7 +1426,7 @@ namespace das {
         static __forceinline void clear ( Context * __context__, TTable<TKey,TVal> & tab ) {
             if ( tab.data ) {
                 if ( !tab.lock ) {
-                    uint32_t oldSize = tab.capacity*(sizeof(TKey)+sizeof(TVal)+sizeof(uint64_t));
+                    uint32_t oldSize = tab.capacity*table_slot_size(tab, uint32_t(sizeof(TKey)+sizeof(TVal)));
                     __context__->heap->free(tab.data, oldSize);
                 } else {
                     __context__->throw_error("can't delete locked table");
@@ -1928,8 +1928,15 @@ namespace das {
                 return result;
             }
         }
+        // invoke of the block, which is declared in place. such block is a C++ lambda
         template <typename BLK, typename ...ArgType>
-        static __forceinline ResType invoke_cmres ( Context *, LineInfo *, const BLK & blk, ArgType ...arg ) {
+        static __forceinline typename enable_if<!is_base_of<Block,BLK>::value,ResType>::type
+        invoke ( Context *, LineInfo *, const BLK & blk, ArgType && ...arg ) {
+            return blk(forward<ArgType>(arg)...);
+        }
+        template <typename BLK, typename ...ArgType>
+        static __forceinline typename enable_if<!is_base_of<Block,BLK>::value,ResType>::type
+        invoke_cmres ( Context *, LineInfo *, const BLK & blk, ArgType && ...arg ) {
             return blk(forward<ArgType>(arg)...);
         }
     };
@@ -1957,7 +1964,8 @@ namespace das {
             }
         }
         template <typename BLK, typename ...ArgType>
-        static __forceinline void invoke ( Context *, LineInfo *, const BLK & blk, ArgType ...arg ) {
+        static __forceinline typename enable_if<!is_base_of<Block,BLK>::value>::type
+        invoke ( Context *, LineInfo *, const BLK & blk, ArgType && ...arg ) {
             return blk(forward<ArgType>(arg)...);
         }
     };
@@ -2811,6 +2819,12 @@ namespace das {
     bool das_is_jit_function ( const Func func );
     bool das_remove_jit ( const Func func );
     bool das_instrument_jit ( void * pfun, const Func func, Context * context );
+    bool das_jit_compile ( const Func func, Context * context );
+    bool das_jit_is_supported ();
+    bool das_jit_tiering ( bool enable, int32_t callThreshold, int32_t loopThreshold, Context * context );
+    void das_jit_tiering_wait ( Context * context );
+    bool das_jit_tiering_stats ( const TBlock<void,uint64_t,int32_t,int32_t,int32_t,int32_t,double,double,double> & blk, Context * context, LineInfoArg * at );
+    char * das_jit_tiering_report ( Context * context );
 }
 
 #if defined(_MSC_VER)
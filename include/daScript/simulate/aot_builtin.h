@@ -29,9 +29,12 @@ namespace das {
     int32_t heap_depth ( Context * context );
     uint64_t string_heap_bytes_allocated ( Context * context );
     int32_t string_heap_depth ( Context * context );
+    void heap_allocation_stats ( const TBlock<void,uint64_t,uint64_t,uint64_t,uint64_t,uint64_t> & blk, Context * context, LineInfoArg * at );
+    void string_heap_allocation_stats ( const TBlock<void,uint64_t,uint64_t,uint64_t,uint64_t,uint64_t> & blk, Context * context, LineInfoArg * at );
     void string_heap_collect ( bool validate, Context * context, LineInfoArg * info );
     void string_heap_report ( Context * context, LineInfoArg * info );
     void heap_collect ( bool stringHeap, bool validate, Context * context, LineInfoArg * info );
+    bool heap_collect_step ( int32_t budget, bool stringHeap, bool validate, Context * context, LineInfoArg * info );
     void heap_report ( Context * context, LineInfoArg * info );
     void memory_report ( bool errorsOnly, Context * context, LineInfoArg * info );
     void builtin_table_lock ( const Table & arr, Context * context );
@@ -73,6 +76,11 @@ namespace das {
     void resetProfiler( Context * context );
     void dumpProfileInfo( Context * context );
     char * collectProfileInfo( Context * context );
+    void profileFunctions ( bool enable, Context * context );
+    bool profileFunction ( const char * name, bool enable, Context * context );
+    void resetFunctionProfile ( Context * context );
+    char * collectFunctionProfile ( Context * context );
+    bool getFunctionProfile ( const char * name, const TBlock<void,uint64_t,double,double,double> & blk, Context * context, LineInfoArg * at );
 
     template <typename TT>
     __forceinline void builtin_sort ( TT * data, int32_t length ) {
@@ -13,6 +13,10 @@ namespace das {
     char * builtin_fread ( const FILE * _f, Context * context, LineInfoArg * at );
     char* builtin_fgets(const FILE* _f, Context* context, LineInfoArg * at );
     void builtin_fwrite(const FILE * _f, char * str, Context * context, LineInfoArg * at );
+    void builtin_fflush ( const FILE * f, Context * context, LineInfoArg * at );
+    int64_t builtin_fread_chunks ( const FILE * f, int32_t chunkSize, const TBlock<void,TTemporary<TArray<uint8_t>>> & blk, Context * context, LineInfoArg * at );
+    int64_t builtin_fread_lines ( const FILE * f, const TBlock<void,TTemporary<const char *>> & blk, Context * context, LineInfoArg * at );
+    bool builtin_fadvise ( const FILE * f, int32_t advice, Context * context, LineInfoArg * at );
     bool builtin_feof(const FILE* _f);
     int64_t builtin_ftell ( const FILE * f, Context * context, LineInfoArg * at );
     int64_t builtin_fseek ( const FILE * f, int64_t offset, int32_t mode, Context * context, LineInfoArg * at );
@@ -7,6 +7,8 @@
 
 namespace das {
 
+    template <typename TT> struct TArray;
+
     struct Feature {
         void *              data = nullptr;
         shared_ptr<Context> from;
@@ -49,10 +51,69 @@ namespace das {
         atomic<int>         mRef{0};
     };
 
+    // bounded lock-free multi-producer multi-consumer channel (Dmitry Vyukov's bounded MPMC queue)
+    // producer contexts are referenced once per channel, not per entry
+    class LockFreeChannel {
+        struct Cell {
+            atomic<size_t>  sequence;
+            void *          data;
+        };
+    public:
+        LockFreeChannel ( Context * ctx, int32_t capacity, int32_t count, bool spin );
+        ~LockFreeChannel();
+        LockFreeChannel ( LockFreeChannel && ) = delete;
+        LockFreeChannel ( const LockFreeChannel & ) = delete;
+        LockFreeChannel & operator = ( const LockFreeChannel & ) = delete;
+        LockFreeChannel & operator = ( LockFreeChannel && ) = delete;
+        bool tryPush ( void * data, Context * context );
+        void * tryPop ();
+        void push ( void * data, Context * context );               // waits while channel is full
+        void * pop ();                                              // waits for data, null once channel is depleted
+        int32_t tryPushBatch ( void ** data, int32_t count, Context * context );
+        int32_t tryPopBatch ( void ** data, int32_t count );
+        void pushBatch ( void ** data, int32_t count, Context * context );
+        int32_t popBatch ( void ** data, int32_t count );           // waits for data, 0 once channel is depleted
+        bool isEmpty() const;
+        int size() const { return remaining; }
+        int capacity() const { return int(mMask + 1); }
+        bool isReady() const { return remaining==0; }
+        bool isSpinning() const { return mSpin; }
+        void notify();
+        void notifyAndRelease();
+        void wait();
+        int append(int size) { return remaining += size; }
+        int addRef() { return mRef++; }
+        int releaseRef() { return --mRef; }
+    protected:
+        void addProducer ( Context * context );
+        void waitForSignal ( int & spins );
+        void signal();
+    protected:
+        unique_ptr<Cell[]>          mBuffer;
+        size_t                      mMask = 0;
+        alignas(64) atomic<size_t>  mEnqueuePos{0};
+        alignas(64) atomic<size_t>  mDequeuePos{0};
+        alignas(64) atomic<int>     remaining{0};
+        atomic<int>                 mWaiters{0};
+        atomic<int>                 mRef{0};
+        bool                        mSpin = false;
+        uint64_t                    mId = 0;
+        Context *                   owner = nullptr;
+        mutex                       mLock;                          // producers and sleeping waiters only
+        condition_variable          mCond;
+        vector<shared_ptr<Context>> mProducers;
+    };
+
     bool is_job_que_shutting_down();
+    uint64_t getJobContextPoolHits();
+    uint64_t getJobContextPoolMisses();
+    int64_t getJobContextPoolSavedUsec();
+    void setJobContextPoolCapacity ( int32_t capacity );
+    void parallelFor ( int32_t from, int32_t to, int32_t chunk, const TBlock<void,int32_t,int32_t> & blk, Context * context, LineInfoArg * at );
     void new_job_invoke ( Lambda lambda, Func fn, int32_t lambdaSize, Context * context, LineInfoArg * lineinfo );
     void new_thread_invoke ( Lambda lambda, Func fn, int32_t lambdaSize, Context * context, LineInfoArg * lineinfo );
     void withJobQue ( const TBlock<void> & block, Context * context, LineInfoArg * lineInfo );
+    void heapCollectParallel ( bool sheap, bool validate, Context * context, LineInfoArg * at );
     int getTotalHwJobs( Context * context, LineInfoArg * at );
     int getTotalHwThreads ();
     void withJobStatus ( int32_t total, const TBlock<void,JobStatus *> & block, Context * context, LineInfoArg * lineInfo );
@@ -71,4 +132,19 @@ namespace das {
     void waitForChannel ( Channel * status, Context * context, LineInfoArg * at );
     void notifyChannel ( Channel * status, Context * context, LineInfoArg * at );
     void notifyAndReleaseChannel ( Channel * & status, Context * context, LineInfoArg * at );
+    void withLockFreeChannel ( int32_t capacity, int32_t count, bool spin, const TBlock<void,LockFreeChannel *> & blk, Context * context, LineInfoArg * at );
+    bool lockFreeChannelTryPush ( LockFreeChannel * ch, void * data, Context * context, LineInfoArg * at );
+    void * lockFreeChannelTryPop ( LockFreeChannel * ch, Context * context, LineInfoArg * at );
+    void lockFreeChannelPush ( LockFreeChannel * ch, void * data, Context * context, LineInfoArg * at );
+    void * lockFreeChannelPop ( LockFreeChannel * ch, Context * context, LineInfoArg * at );
+    int32_t lockFreeChannelTryPushBatch ( LockFreeChannel * ch, const TArray<void *> & data, Context * context, LineInfoArg * at );
+    void lockFreeChannelPushBatch ( LockFreeChannel * ch, const TArray<void *> & data, Context * context, LineInfoArg * at );
+    int32_t lockFreeChannelTryPopBatch ( LockFreeChannel * ch, TArray<void *> & data, int32_t count, Context * context, LineInfoArg * at );
+    int32_t lockFreeChannelPopBatch ( LockFreeChannel * ch, TArray<void *> & data, int32_t count, Context * context, LineInfoArg * at );
+    int lockFreeChannelAppend ( LockFreeChannel * ch, int size, Context * context, LineInfoArg * at );
+    void lockFreeChannelAddRef ( LockFreeChannel * ch, Context * context, LineInfoArg * at );
+    void lockFreeChannelReleaseRef ( LockFreeChannel * & ch, Context * context, LineInfoArg * at );
+    void waitForLockFreeChannel ( LockFreeChannel * ch, Context * context, LineInfoArg * at );
+    void notifyLockFreeChannel ( LockFreeChannel * ch, Context * context, LineInfoArg * at );
+    void notifyAndReleaseLockFreeChannel ( LockFreeChannel * & ch, Context * context, LineInfoArg * at );
 }
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "daScript/simulate/debug_info.h"
+
+namespace das {
+    template <typename TT> struct TArray;
+
+    bool builtin_json_decode ( const char * text, void * data, const TypeInfo * info, char * & error, Context * context, LineInfoArg * at );
+    bool builtin_json_decode_bytes ( const TArray<uint8_t> & bytes, void * data, const TypeInfo * info, char * & error, Context * context, LineInfoArg * at );
+    char * builtin_json_encode ( const void * data, const TypeInfo * info, bool pretty, Context * context, LineInfoArg * at );
+}
@@ -2,6 +2,9 @@
 
 #include "daScript/misc/network.h"
 #include "daScript/simulate/debug_info.h"
+#include "daScript/simulate/bind_enum.h"
+
+DAS_BIND_ENUM_CAST(NetworkFraming);
 
 namespace das {
     bool makeServer ( const void * pClass, const StructInfo * info, Context * context );
@@ -10,4 +13,18 @@ namespace das {
     bool server_is_connected ( smart_ptr_raw<Server> server, Context * context );
     bool server_send ( smart_ptr_raw<Server> server, uint8_t * data, int32_t size, Context * context );
     void server_tick ( smart_ptr_raw<Server> server, Context * context );
+    void server_restore ( smart_ptr_raw<Server> server, const void * pClass, const StructInfo * info, Context * context );
+
+    bool makeMultiServer ( const void * pClass, const StructInfo * info, Context * context );
+    bool multi_server_init ( smart_ptr_raw<MultiServer> server, int32_t port, NetworkFraming framing, Context * context );
+    bool multi_server_is_open ( smart_ptr_raw<MultiServer> server, Context * context );
+    int32_t multi_server_port ( smart_ptr_raw<MultiServer> server, Context * context );
+    int32_t multi_server_tick ( smart_ptr_raw<MultiServer> server, int32_t timeoutMsec, Context * context );
+    bool multi_server_send ( smart_ptr_raw<MultiServer> server, int32_t connection, uint8_t * data, int32_t size, Context * context );
+    void multi_server_close ( smart_ptr_raw<MultiServer> server, int32_t connection, Context * context );
+    bool multi_server_is_connected ( smart_ptr_raw<MultiServer> server, int32_t connection, Context * context );
+    int32_t multi_server_connections ( smart_ptr_raw<MultiServer> server, Context * context );
+    int32_t multi_server_queued ( smart_ptr_raw<MultiServer> server, int32_t connection, Context * context );
+    void multi_server_set_limits ( smart_ptr_raw<MultiServer> server, int32_t maxMessageSize, int32_t maxQueueSize, Context * context );
+    void multi_server_restore ( smart_ptr_raw<MultiServer> server, const void * pClass, const StructInfo * info, Context * context );
 }
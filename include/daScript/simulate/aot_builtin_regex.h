@@ -0,0 +1,15 @@
+#pragma once
+
+#include "daScript/misc/regex_dfa.h"
+#include "daScript/simulate/debug_info.h"
+
+namespace das {
+    template <typename TT> struct TArray;
+
+    RegexDfa * builtin_regex_dfa_create ( const TArray<int32_t> & code, const TArray<uint32_t> & sets );
+    int32_t builtin_regex_dfa_match ( RegexDfa * dfa, const char * str, int32_t offset, Context * context, LineInfoArg * at );
+    range builtin_regex_dfa_search ( RegexDfa * dfa, const char * str, int32_t offset, Context * context, LineInfoArg * at );
+    range builtin_regex_dfa_search_n ( RegexDfa * dfa, const char * str, int32_t length, int32_t offset, Context * context, LineInfoArg * at );
+    range builtin_regex_dfa_group ( const RegexDfa * dfa, int32_t index, Context * context, LineInfoArg * at );
+    int32_t builtin_regex_dfa_states ( const RegexDfa * dfa );
+}
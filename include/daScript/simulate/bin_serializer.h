@@ -10,4 +10,14 @@ namespace das {
     // load ( obj, bytesAt:uint32 )
     vec4f _builtin_binary_load ( Context & context, SimNode_CallBase * call, vec4f * args );
     void _builtin_binary_load ( Context & context, TypeInfo* info, const char *data, uint32_t len, char *to);//
+
+    // same, but with the schema of the saved types, so it can be loaded after the types change
+    // save_versioned ( obj, block<(bytesAt:string)> )
+    vec4f _builtin_binary_save_versioned ( Context & context, SimNode_CallBase * call, vec4f * args );
+    // load_versioned ( obj, bytesAt:uint32 )
+    vec4f _builtin_binary_load_versioned ( Context & context, SimNode_CallBase * call, vec4f * args );
+    // fsave_versioned ( file, obj ) : int
+    vec4f _builtin_binary_fsave_versioned ( Context & context, SimNode_CallBase * call, vec4f * args );
+    // fload_versioned ( file, obj ) : bool
+    vec4f _builtin_binary_fload_versioned ( Context & context, SimNode_CallBase * call, vec4f * args );
 }
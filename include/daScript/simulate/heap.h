@@ -137,11 +137,16 @@ namespace das {
         virtual bool mark() = 0;
         virtual void mark ( char * ptr, uint32_t size ) = 0;
         virtual void sweep() = 0;
+        virtual void abortMark() = 0;   // drop marks of the collection in progress, everything stays allocated
         virtual bool isOwnPtr ( char * ptr, uint32_t size ) = 0;
         virtual bool isValidPtr ( char * ptr, uint32_t size ) = 0;  // only if isOwnPtr
         virtual void setInitialSize ( uint32_t size ) = 0;
         virtual int32_t getInitialSize() const = 0;
         virtual void setGrowFunction ( CustomGrowFunction && fun ) = 0;
+        virtual void getStats ( AllocationStats & stats ) const {   // only persistent heaps track allocations and frees
+            stats.bytesAllocated = bytesAllocated();
+            stats.bytesReserved = totalAlignedMemoryAllocated();
+        }
     public:
 #if DAS_TRACK_ALLOCATIONS
         virtual void mark_location ( void *, LineInfo * )  {}
@@ -208,11 +213,13 @@ namespace das {
         virtual bool mark() override;
         virtual void mark ( char * ptr, uint32_t size ) override;
         virtual void sweep() override { model.sweep(); }
+        virtual void abortMark() override { model.abortGC(); }
         virtual bool isOwnPtr ( char * ptr, uint32_t size ) override { return model.isOwnPtr(ptr,size); }
         virtual bool isValidPtr ( char * ptr, uint32_t size ) override { return model.isAllocatedPtr(ptr,size); }
         virtual void setInitialSize ( uint32_t size ) override { model.setInitialSize(size); }
         virtual int32_t getInitialSize() const override { return model.initialSize; }
         virtual void setGrowFunction ( CustomGrowFunction && fun ) override { model.customGrow = fun; };
+        virtual void getStats ( AllocationStats & stats ) const override { model.getStats(stats); }
 #if DAS_TRACK_ALLOCATIONS
         virtual void mark_location ( void * ptr, LineInfo * at ) override  { model.mark_location(ptr,at); };
         virtual  void mark_comment ( void * ptr, const char * what ) override { model.mark_comment(ptr,what); };
@@ -235,6 +242,7 @@ namespace das {
         virtual bool mark() override { return false; }
         virtual void mark ( char *, uint32_t ) override { DAS_ASSERT(0 && "not supported"); }
         virtual void sweep() override { DAS_ASSERT(0 && "not supported"); }
+        virtual void abortMark() override { }
         virtual bool isOwnPtr ( char * ptr, uint32_t ) override { return model.isOwnPtr(ptr); }
         virtual bool isValidPtr ( char *, uint32_t ) override { return true; }
         virtual void setInitialSize ( uint32_t size ) override { model.setInitialSize(size); }
@@ -278,11 +286,13 @@ namespace das {
         virtual bool mark() override;
         virtual void mark ( char * ptr, uint32_t size ) override;
         virtual void sweep() override;
+        virtual void abortMark() override { model.abortGC(); }
         virtual bool isOwnPtr ( char * ptr, uint32_t size ) override { return model.isOwnPtr(ptr,size); }
         virtual bool isValidPtr ( char * ptr, uint32_t size ) override { return model.isAllocatedPtr(ptr,size); }
         virtual void setInitialSize ( uint32_t size ) override { model.setInitialSize(size); }
         virtual int32_t getInitialSize() const override { return model.initialSize; }
         virtual void setGrowFunction ( CustomGrowFunction && fun ) override { model.customGrow = fun; };
+        virtual void getStats ( AllocationStats & stats ) const override { model.getStats(stats); }
 #if DAS_TRACK_ALLOCATIONS
         virtual void mark_location ( void * ptr, LineInfo * at ) override { model.mark_location(ptr,at); };
         virtual  void mark_comment ( void * ptr, const char * what ) override { model.mark_comment(ptr,what); };
@@ -306,6 +316,7 @@ namespace das {
         virtual bool mark() override { return false; }
         virtual void mark ( char *, uint32_t ) override { DAS_ASSERT(0 && "not supported"); }
         virtual void sweep() override { DAS_ASSERT(0 && "not supported"); }
+        virtual void abortMark() override { }
         virtual bool isOwnPtr ( char * ptr, uint32_t ) override { return model.isOwnPtr(ptr); }
         virtual bool isValidPtr ( char *, uint32_t ) override { return true; }
         virtual void setInitialSize ( uint32_t size ) override { model.setInitialSize(size); }
@@ -327,10 +338,13 @@ namespace das {
     };
     static_assert(sizeof(NodePrefix)==sizeof(vec4f), "node prefix must be one alignment line");
 
+    class JitCodeArena;
+
     class NodeAllocator : public LinearChunkAllocator {
     public:
         bool prefixWithHeader = true;
         uint32_t totalNodesAllocated = 0;
+        shared_ptr<JitCodeArena> jitCode;   // machine code of jit compiled functions, references nodes bellow
     public:
         NodeAllocator() {}
 
@@ -6,5 +6,18 @@ namespace das
 {
     // profile(count,category,block) -> float time in sec
     float builtin_profile ( int32_t count, const char * category, const Block & block, Context * context, LineInfoArg * at );
-}
 
+    // sampling profiler
+    //  timer thread walks Prologue chain of every running context, same way stack walker does
+    //  samples are aggregated into folded stacks (outermost;...;innermost count), which is flamegraph.pl input
+    void sampling_profiler_register_context ( Context * context );
+    void sampling_profiler_unregister_context ( Context * context );
+    bool sampling_profiler_start ( int32_t intervalUsec );
+    void sampling_profiler_stop ();
+    bool sampling_profiler_is_running ();
+    void sampling_profiler_reset ();
+    void sampling_profiler_sample ();
+    int64_t sampling_profiler_samples ();
+    char * sampling_profiler_folded ( Context * context, LineInfoArg * at );
+    char * sampling_profiler_report ( Context * context, LineInfoArg * at );
+}
@@ -37,6 +37,57 @@ namespace das
         }
     };
 
+    // swiss table layout: one control byte per slot follows the hashes, slots are probed one group at a time
+    // control byte is either ctrl_empty, ctrl_killed, or low 7 bits of the hash
+    enum : uint8_t {
+        ctrl_empty  = 0x80,
+        ctrl_killed = 0xfe
+    };
+
+    struct TableControlGroup {
+        enum { width = 16 };
+#if _TARGET_SIMD_SSE
+        __m128i ctrl;
+        __forceinline TableControlGroup ( const uint8_t * p ) : ctrl(_mm_loadu_si128((const __m128i *)p)) {}
+        __forceinline uint32_t match ( uint8_t c ) const {
+            return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(char(c)), ctrl)));
+        }
+        __forceinline uint32_t matchFree () const {     // empty or killed, both have high bit set
+            return uint32_t(_mm_movemask_epi8(ctrl));
+        }
+#elif _TARGET_SIMD_NEON && (defined(__aarch64__) || defined(_M_ARM64))
+        uint8x16_t ctrl;
+        __forceinline TableControlGroup ( const uint8_t * p ) : ctrl(vld1q_u8(p)) {}
+        static __forceinline uint32_t movemask ( uint8x16_t m ) {
+            static const uint8_t bits[16] = { 1,2,4,8,16,32,64,128, 1,2,4,8,16,32,64,128 };
+            uint8x16_t mb = vandq_u8(m, vld1q_u8(bits));
+            return uint32_t(vaddv_u8(vget_low_u8(mb))) | (uint32_t(vaddv_u8(vget_high_u8(mb))) << 8);
+        }
+        __forceinline uint32_t match ( uint8_t c ) const {
+            return movemask(vceqq_u8(vdupq_n_u8(c), ctrl));
+        }
+        __forceinline uint32_t matchFree () const {
+            return movemask(vcltq_s8(vreinterpretq_s8_u8(ctrl), vdupq_n_s8(0)));
+        }
+#else
+        const uint8_t * ctrl;
+        __forceinline TableControlGroup ( const uint8_t * p ) : ctrl(p) {}
+        __forceinline uint32_t match ( uint8_t c ) const {
+            uint32_t res = 0;
+            for ( uint32_t i=0; i!=width; ++i ) res |= uint32_t(ctrl[i]==c) << i;
+            return res;
+        }
+        __forceinline uint32_t matchFree () const {
+            uint32_t res = 0;
+            for ( uint32_t i=0; i!=width; ++i ) res |= uint32_t(ctrl[i]>>7) << i;
+            return res;
+        }
+#endif
+        __forceinline uint32_t matchEmpty () const {
+            return match(ctrl_empty);
+        }
+    };
+
     template <typename KeyType>
     class TableHash {
         Context *   context = nullptr;
@@ -63,7 +114,20 @@ namespace das
             return das::max(uint32_t(minLookups), desired * 6);
         }
 
+        static __forceinline uint8_t * controlBytes ( const Table & tab ) {
+            return (uint8_t *)(tab.hashes + tab.capacity);
+        }
+
+        static __forceinline uint8_t controlFromHash ( uint64_t hash ) {
+            return uint8_t(hash & 0x7f);
+        }
+
+        static __forceinline uint32_t growthLimit ( uint32_t capacity ) {
+            return capacity - capacity/8;   // 7/8 max load factor
+        }
+
         __forceinline int find ( const Table & tab, KeyType key, uint64_t hash ) const {
+            if ( tab.swiss ) return findSwiss(tab, key, hash);
             uint32_t mask = tab.capacity - 1;
             uint32_t index = indexFromHash(hash, tab.shift);
             uint32_t lastI = (index+tab.maxLookups) & mask;
@@ -82,6 +146,7 @@ namespace das
         }
 
         __forceinline int insertNew ( Table & tab, uint64_t hash ) const {
+            if ( tab.swiss ) return insertNewSwiss(tab, hash);
             // TODO: take key under account and be less agressive?
             uint32_t mask = tab.capacity - 1;
             uint32_t index = indexFromHash(hash, tab.shift);
@@ -98,6 +163,7 @@ namespace das
         }
 
         __forceinline int reserve ( Table & tab, KeyType key, uint64_t hash ) {
+            if ( tab.swiss ) return reserveSwiss(tab, key, hash);
             for ( ;; ) {
                 uint32_t mask = tab.capacity - 1;
                 uint32_t index = indexFromHash(hash, tab.shift);
@@ -124,10 +190,12 @@ namespace das
                 if ( !grow(tab) ) {
                     return -1;
                 }
+                if ( tab.swiss ) return reserveSwiss(tab, key, hash);
             }
         }
 
         __forceinline int erase ( Table & tab, KeyType key, uint64_t hash ) {
+            if ( tab.swiss ) return eraseSwiss(tab, key, hash);
             uint32_t mask = tab.capacity - 1;
             uint32_t index = indexFromHash(hash, tab.shift);
             uint32_t lastI = (index+tab.maxLookups) & mask;
@@ -148,11 +216,121 @@ namespace das
             return -1;
         }
 
+        // probe sequence visits groups at triangular offsets, which covers every group of the power-of-2 table
+        int findSwiss ( const Table & tab, KeyType key, uint64_t hash ) const {
+            uint32_t mask = tab.capacity - 1;
+            uint32_t group = indexFromHash(hash, tab.shift) & ~uint32_t(TableControlGroup::width-1);
+            uint8_t ch = controlFromHash(hash);
+            auto pCtrl = controlBytes(tab);
+            auto pKeys = (const KeyType *) tab.keys;
+            auto pHashes = tab.hashes;
+            for ( uint32_t step=TableControlGroup::width; ; step+=TableControlGroup::width ) {
+                TableControlGroup g(pCtrl + group);
+                for ( uint32_t m=g.match(ch); m; m&=m-1 ) {
+                    uint32_t index = group + das_ctz(m);
+                    if ( pHashes[index]==hash && KeyCompare<KeyType>()(pKeys[index],key) ) {
+                        return (int) index;
+                    }
+                }
+                if ( g.matchEmpty() || step>mask ) {
+                    return -1;
+                }
+                group = (group + step) & mask;
+            }
+        }
+
+        int insertNewSwiss ( Table & tab, uint64_t hash ) const {
+            uint32_t mask = tab.capacity - 1;
+            uint32_t group = indexFromHash(hash, tab.shift) & ~uint32_t(TableControlGroup::width-1);
+            auto pCtrl = controlBytes(tab);
+            for ( uint32_t step=TableControlGroup::width; ; step+=TableControlGroup::width ) {
+                if ( uint32_t m = TableControlGroup(pCtrl + group).matchFree() ) {
+                    return (int) (group + das_ctz(m));
+                }
+                if ( step>mask ) {
+                    return -1;
+                }
+                group = (group + step) & mask;
+            }
+        }
+
+        int reserveSwiss ( Table & tab, KeyType key, uint64_t hash ) {
+            uint8_t ch = controlFromHash(hash);
+            for ( ;; ) {
+                uint32_t mask = tab.capacity - 1;
+                uint32_t group = indexFromHash(hash, tab.shift) & ~uint32_t(TableControlGroup::width-1);
+                uint32_t insertI = -1u;
+                auto pCtrl = controlBytes(tab);
+                auto pKeys = (KeyType *) tab.keys;
+                auto pHashes = tab.hashes;
+                for ( uint32_t step=TableControlGroup::width; ; step+=TableControlGroup::width ) {
+                    TableControlGroup g(pCtrl + group);
+                    for ( uint32_t m=g.match(ch); m; m&=m-1 ) {
+                        uint32_t index = group + das_ctz(m);
+                        if ( pHashes[index]==hash && KeyCompare<KeyType>()(pKeys[index],key) ) {
+                            return (int) index;
+                        }
+                    }
+                    if ( insertI==-1u ) {
+                        if ( uint32_t f = g.matchFree() ) {
+                            insertI = group + das_ctz(f);
+                        }
+                    }
+                    if ( g.matchEmpty() || step>mask ) {
+                        break;
+                    }
+                    group = (group + step) & mask;
+                }
+                // killed slots are reused for free, empty ones count against the load factor
+                if ( insertI!=-1u && (pCtrl[insertI]==ctrl_killed || tab.maxLookups) ) {
+                    if ( tab.isLocked() ) context->throw_error("can't insert into locked table");
+                    if ( pCtrl[insertI]==ctrl_empty ) tab.maxLookups--;
+                    pCtrl[insertI] = ch;
+                    pHashes[insertI] = hash;
+                    pKeys[insertI] = key;
+                    tab.size++;
+                    return (int) insertI;
+                }
+                if ( !grow(tab) ) {
+                    return -1;
+                }
+            }
+        }
+
+        int eraseSwiss ( Table & tab, KeyType key, uint64_t hash ) {
+            int index = findSwiss(tab, key, hash);
+            if ( index==-1 ) {
+                return -1;
+            }
+            tab.size--;
+            // if the group has an empty slot, no probe sequence ever went past it, and the slot can be empty again
+            auto pCtrl = controlBytes(tab);
+            uint32_t group = uint32_t(index) & ~uint32_t(TableControlGroup::width-1);
+            if ( TableControlGroup(pCtrl + group).matchEmpty() ) {
+                pCtrl[index] = ctrl_empty;
+                tab.hashes[index] = HASH_EMPTY64;
+                tab.maxLookups++;
+            } else {
+                pCtrl[index] = ctrl_killed;
+                tab.hashes[index] = HASH_KILLED64;
+            }
+            memset(tab.data + index*valueTypeSize, 0, valueTypeSize);
+            return index;
+        }
+
         bool grow ( Table & tab ) {
-            uint32_t newCapacity = das::max(uint32_t(minCapacity), tab.capacity*2);
+            bool swiss = tab.capacity ? tab.swiss : context->swissTables;
+            uint32_t newCapacity;
+            if ( swiss ) {
+                // mostly killed slots, same capacity is enough
+                newCapacity = das::max(uint32_t(TableControlGroup::width), tab.capacity);
+                if ( tab.size*2 >= growthLimit(newCapacity) ) newCapacity *= 2;
+            } else {
+                newCapacity = das::max(uint32_t(minCapacity), tab.capacity*2);
+            }
         repeatIt:;
             Table newTab;
-            uint64_t memSize64 = uint64_t(newCapacity) * (uint64_t(valueTypeSize) + uint64_t(sizeof(KeyType)) + uint64_t(sizeof(uint64_t)));
+            uint64_t memSize64 = uint64_t(newCapacity) * (uint64_t(valueTypeSize) + uint64_t(sizeof(KeyType)) + uint64_t(sizeof(uint64_t)) + (swiss ? 1 : 0));
             if ( memSize64>=0xffffffff ) {
                 context->throw_error_ex("can't grow table, out of index space [capacity=%i]", newCapacity);
                 return false;
@@ -171,11 +349,14 @@ namespace das
             newTab.capacity = newCapacity;
             newTab.lock = tab.lock;
             newTab.flags = tab.flags;
-            newTab.maxLookups = computeMaxLookups(newCapacity);
+            newTab.swiss = swiss;
+            newTab.maxLookups = swiss ? growthLimit(newCapacity) - tab.size : computeMaxLookups(newCapacity);
             newTab.shift = computeShift(newCapacity);
             if ( valueTypeSize ) memset(newTab.data, 0, newCapacity*valueTypeSize);
             auto pHashes = newTab.hashes;
             memset(pHashes, 0, newCapacity * sizeof(uint64_t));
+            auto pCtrl = controlBytes(newTab);
+            if ( swiss ) memset(pCtrl, ctrl_empty, newCapacity);
             if ( tab.size ) {
                 auto pKeys = (KeyType *) newTab.keys;
                 auto pOldValues = tab.data;
@@ -187,18 +368,20 @@ namespace das
                     if ( hash>HASH_KILLED64 ) {
                         int index = insertNew(newTab, hash);
                         if ( index==-1 ) {
-                             newCapacity *= 2;
+                            context->heap->free(newTab.data, memSize);
+                            newCapacity *= 2;
                             goto repeatIt;
                         } else {
                             pHashes[index] = hash;
                             pKeys[index] = pOldKeys[i];
+                            if ( swiss ) pCtrl[index] = controlFromHash(hash);
                             memcpy ( pValues + index*valueTypeSize, pOldValues + i*valueTypeSize, valueTypeSize );
                         }
                     }
                 }
             }
             if (tab.capacity) {
-                uint32_t oldSize = tab.capacity*(valueTypeSize + sizeof(KeyType) + sizeof(uint64_t));
+                uint32_t oldSize = tab.capacity*table_slot_size(tab, valueTypeSize + uint32_t(sizeof(KeyType)));
                 context->heap->free(tab.data, oldSize);
             }
             swap ( newTab, tab );
@@ -206,6 +389,3 @@ namespace das
         }
     };
 }
-
-
-
@@ -88,6 +88,27 @@ namespace das
         };
     };
 
+    struct FunctionProfileData {
+        uint64_t    calls = 0;
+        int64_t     inclusiveTicks = 0;     // ref_time_ticks, including callees
+        int64_t     exclusiveTicks = 0;     // minus time spent in profiled callees
+        int64_t     maxTicks = 0;           // longest single call, inclusive
+    };
+
+    struct GcPauseHistogram {
+        enum { num_buckets = 24 };  // bucket N counts pauses shorter than 2^N usec, last one counts the rest
+        uint64_t    buckets[num_buckets] = {};
+        uint64_t    count = 0;
+        uint64_t    totalUsec = 0;
+        uint64_t    maxUsec = 0;
+        void record ( uint64_t usec );
+        void report ( TextWriter & tp, const char * title ) const;
+    };
+
+    struct GcRoot;
+    struct GcMarkState;
+    class JobQue;
+
     struct SimNode {
         SimNode ( const LineInfo & at ) : debugInfo(at) {}
         virtual SimNode * copyNode ( Context & context, NodeAllocator * code );
@@ -106,6 +127,7 @@ namespace das
         virtual bool rtti_node_isBlock() const { return false; }
         virtual bool rtti_node_isInstrument() const { return false; }
         virtual bool rtti_node_isInstrumentFunction() const { return false; }
+        virtual bool rtti_node_isProfileFunction() const { return false; }
         virtual bool rtti_node_isJit() const { return false; }
     protected:
         virtual ~SimNode() {}
@@ -301,6 +323,7 @@ namespace das
 
         __forceinline void restartHeaps() {
             DAS_ASSERTF(insideContext==0,"can't reset heaps in locked context");
+            if ( gcMarkState ) abortHeapCollection();
             heap->reset();
             stringHeap->reset();
         }
@@ -376,6 +399,8 @@ namespace das
         string getStackWalk ( const LineInfo * at, bool showArguments, bool showLocalVariables, bool showOutOfScope = false, bool stackTopOnly = false );
         void runInitScript ();
         bool runShutdownScript ();
+        void resetClone ( const Context * from = nullptr );
+        bool copyGlobalsFrom ( const Context & ctx );
 
         virtual void to_out ( const char * message );   // output to stdout or equivalent
         virtual void to_err ( const char * message );   // output to stderr or equivalent
@@ -598,7 +623,12 @@ namespace das
         void relocateCode( bool pwh = false );
         void announceCreation();
         void collectStringHeap(LineInfo * at, bool validate);
-        void collectHeap(LineInfo * at, bool stringHeap, bool validate);
+        void collectHeap(LineInfo * at, bool stringHeap, bool validate, JobQue * jobQue = nullptr);  // with jobQue roots are marked in parallel
+        bool collectHeapStep ( LineInfo * at, bool stringHeap, bool validate, int32_t budgetUsec );  // true when cycle is complete
+        void abortHeapCollection();
+        __forceinline bool isCollectingHeap() const { return gcMarkState!=nullptr; }
+        void collectHeapRoots ( LineInfo * at, vector<GcRoot> & roots, int32_t gcFlags );
+        void reportHeapErrors ( LineInfo * at, bool sheap, const das_set<char *> & failed );
         void reportAnyHeap(LineInfo * at, bool sth, bool rgh, bool rghOnly, bool errorsOnly);
         void instrumentFunction ( SimFunction * , bool isInstrumenting, uint64_t userData );
         void instrumentContextNode ( const Block & blk, bool isInstrumenting, Context * context, LineInfo * line );
@@ -610,6 +640,12 @@ namespace das
 
         void resetProfiler();
         void collectProfileInfo( TextWriter & tout );
+        void profileFunction ( SimFunction * fn, bool isProfiling );    // nullptr for all functions
+        void resetFunctionProfile();
+        void collectFunctionProfile ( TextWriter & tout ) const;
+        __forceinline const FunctionProfileData * getFunctionProfile ( SimFunction * fn ) const {
+            return functionProfile ? functionProfile + (fn - functions) : nullptr;
+        }
 
         vector<FileInfo *> getAllFiles() const;
 
@@ -646,6 +682,8 @@ namespace das
         smart_ptr<StringHeapAllocator>  stringHeap;
         smart_ptr<AnyHeapAllocator>     heap;
         bool                            persistent = false;
+        bool                            swissTables = false;    // new tables use swiss layout
+        bool                            cloneSnapshot = false;  // clones copy globals of this context, instead of running the init script
         char *                          globals = nullptr;
         char *                          shared = nullptr;
         shared_ptr<ConstStringAllocator> constStringHeap;
@@ -683,6 +721,17 @@ namespace das
         int totalVariables = 0;
         int totalFunctions = 0;
         SimNode * aotInitScript = nullptr;
+    public:
+        GcPauseHistogram gcPauses;                          // full collections
+        GcPauseHistogram gcSlicePauses;                     // incremental collection slices
+        uint64_t gcAbortedCycles = 0;
+        GcMarkState * gcMarkState = nullptr;                // incremental collection in progress
+        FunctionProfileData * functionProfile = nullptr;    // one per function, allocated by profileFunction
+        int64_t functionProfileChildTicks = 0;              // time spent in profiled callees of the current call
+    protected:
+        char *   globalsSnapshot = nullptr;     // clone globals right after init, if init did not touch the heaps
+    protected:
+        void initializeClone ( const Context * from = nullptr );
     protected:
         bool            debugger = false;
         volatile bool   singleStepMode = false;
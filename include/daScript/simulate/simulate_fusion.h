@@ -12,10 +12,24 @@ namespace das {
     typedef char * StringPtr;
     typedef void * VoidPtr;
 
+    // interned name of the node, or of its type. names are interned for the lifetime of the process
+    // and kinds are stable across threads, so fusion points can cache them per call site
+    typedef uint32_t SimNodeKind;   // 0 is no name
+
+    SimNodeKind internSimNodeKind ( const char * name );
+    const char * getSimNodeKindName ( SimNodeKind kind );
+
+    #define DAS_SIM_NODE_KIND(NAME) \
+        ([]() -> SimNodeKind { static const SimNodeKind kind_ = internSimNodeKind(NAME); return kind_; }())
+
+    __forceinline uint64_t fusionKey ( SimNodeKind name, SimNodeKind typeName ) {
+        return (uint64_t(name) << 32) | uint64_t(typeName);
+    }
+
     struct SimNodeInfo {
-        string  name;
-        string  typeName;
-        size_t  typeSize;
+        SimNodeKind name = 0;
+        SimNodeKind typeName = 0;
+        uint32_t    typeSize = 0;
     };
 
     typedef das_hash_map<SimNode *,SimNodeInfo> SimNodeInfoLookup;
@@ -24,13 +38,18 @@ namespace das {
         FusionPoint () {}
         virtual ~FusionPoint() {}
         virtual SimNode * fuse ( const SimNodeInfoLookup &, SimNode * node, Context * ) { return node; }
+        static SimNodeKind kind ( const SimNodeInfoLookup & info, SimNode * node );
+        static bool is ( const SimNodeInfoLookup & info, SimNode * node, SimNodeKind name );
+        static bool is2 ( const SimNodeInfoLookup & info, SimNode * lnode, SimNode * rnode, SimNodeKind lname, SimNodeKind rname );
+        static bool is ( const SimNodeInfoLookup & info, SimNode * node, SimNodeKind name, SimNodeKind typeName );
         static bool is ( const SimNodeInfoLookup & info, SimNode * node, const char * name );
         static bool is2 ( const SimNodeInfoLookup & info, SimNode * lnode, SimNode * rnode, const char * lname, const char * rname );
         static bool is ( const SimNodeInfoLookup & info, SimNode * node, const char * name, const char * typeName );
     };
     typedef unique_ptr<FusionPoint> FusionPointPtr;
 
-    typedef das_hash_map<string,vector<FusionPointPtr>> FusionEngine;   // note: unordered map for thread safety
+    // pattern table, fusionKey(name,typeName) to fusion points in order of registration
+    typedef das_hash_map<uint64_t,vector<FusionPointPtr>> FusionEngine;   // note: unordered map for thread safety
     extern DAS_THREAD_LOCAL unique_ptr<FusionEngine> g_fusionEngine;
 
     const char * getSimSourceName(SimSourceType st);
@@ -61,6 +80,12 @@ namespace das {
         SimSource       l, r;
     };
 
+    // value[index] with the fixed stride and range, see simulate_fusion_at.cpp
+    struct SimNode_Op2At : SimNode_Op2Fusion {
+        virtual SimNode * visit(SimVisitor & vis) override;
+        uint32_t  stride, offset, range;
+    };
+
     struct FusionPointOp1 : FusionPoint {
         virtual SimNode * match(const SimNodeInfoLookup &, SimNode *, SimNode *, Context *) = 0;
         virtual void set(SimNode_Op1Fusion * result, SimNode * node) = 0;
@@ -76,7 +101,6 @@ namespace das {
     };
 
 
-    string fuseName ( const string & name, const string & typeName );
     void resetFusionEngine();
     void createFusionEngine();
     void registerFusion ( const char * OpName, const char * CTypeName, FusionPoint * node );
@@ -90,6 +114,7 @@ namespace das {
     void createFusionEngine_return();
     void createFusionEngine_ptrfdr();
     void createFusionEngine_if();
+    void createFusionEngine_if_cmp();
     // scalar
     void createFusionEngine_op2();
     void createFusionEngine_op2_set();
@@ -108,5 +133,7 @@ namespace das {
     // call
     void createFusionEngine_call1();
     void createFusionEngine_call2();
+    // loops
+    void createFusionEngine_for_array();
 #endif
 }
@@ -1,16 +1,16 @@
 #define MATCH_OP2(OPNAME,LNODENAME,RNODENAME,COMPUTEL,COMPUTER) \
-    else if ( is2(info,node_l,node_r,LNODENAME,RNODENAME) ) { \
+    else if ( is2(info,node_l,node_r,DAS_SIM_NODE_KIND(LNODENAME),DAS_SIM_NODE_KIND(RNODENAME)) ) { \
         return ccode.makeNode<SimNode_##OPNAME##_##COMPUTEL##_##COMPUTER>(); \
     }
 
 #define MATCH_OP2_ANYR(OPNAME,LNODENAME,COMPUTEL) \
-    else if ( is(info,node_l,LNODENAME) ) { \
+    else if ( is(info,node_l,DAS_SIM_NODE_KIND(LNODENAME)) ) { \
         anyRight = true; \
         return ccode.makeNode<SimNode_##OPNAME##_##COMPUTEL##_Any>(); \
     }
 
 #define MATCH_OP2_ANYL(OPNAME,RNODENAME,COMPUTER) \
-    else if ( is(info,node_r,RNODENAME) ) { \
+    else if ( is(info,node_r,DAS_SIM_NODE_KIND(RNODENAME)) ) { \
         anyLeft = true; \
         return ccode.makeNode<SimNode_##OPNAME##_Any_##COMPUTER>(); \
     }
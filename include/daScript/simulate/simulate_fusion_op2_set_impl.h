@@ -1,10 +1,10 @@
 #define MATCH_OP2_SET(OPNAME,LNODENAME,RNODENAME,COMPUTEL,COMPUTER) \
-    else if ( is2(info,node_l,node_r,LNODENAME,RNODENAME) ) { \
+    else if ( is2(info,node_l,node_r,DAS_SIM_NODE_KIND(LNODENAME),DAS_SIM_NODE_KIND(RNODENAME)) ) { \
         return ccode.makeNode<SimNode_##OPNAME##_##COMPUTEL##_##COMPUTER>(); \
     }
 
 #define MATCH_OP2_SET_ANY(OPNAME,LNODENAME,COMPUTEL) \
-    else if ( is(info, node_l,LNODENAME) ) { \
+    else if ( is(info,node_l,DAS_SIM_NODE_KIND(LNODENAME)) ) { \
         anyRight = true; \
         return ccode.makeNode<SimNode_##OPNAME##_##COMPUTEL##_Any>(); \
     }
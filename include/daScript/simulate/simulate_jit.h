@@ -0,0 +1,64 @@
+#pragma once
+
+#include "daScript/simulate/simulate.h"
+
+// built-in template jit
+//  compiles SimNode tree of a function straight to x86-64 machine code, installs it via SimNode_Jit
+//  nodes it does not know about are evaluated by the interpreter, one sub-tree at a time
+//  context throws via longjmp, so jit frames need no unwind info; with DAS_ENABLE_EXCEPTIONS jit is off
+#ifndef DAS_JIT
+    #if (defined(__x86_64__) || defined(_M_X64)) && !defined(_WIN32) && !DAS_ENABLE_EXCEPTIONS
+        #define DAS_JIT 1
+    #else
+        #define DAS_JIT 0
+    #endif
+#endif
+
+namespace das {
+
+    struct JitStats {
+        uint32_t    nativeNodes = 0;        // nodes compiled to machine code
+        uint32_t    fallbackNodes = 0;      // sub-trees left to the interpreter
+        uint32_t    codeSize = 0;           // bytes of machine code
+    };
+
+    struct JitTierStats {
+        uint64_t    interpretedCalls = 0;   // calls, which went through the interpreter tier
+        uint32_t    queued = 0;             // functions, which crossed the threshold
+        uint32_t    compiled = 0;           // functions, which run jit code now or did before deopt
+        uint32_t    failed = 0;             // functions, which jit could not compile
+        uint32_t    deopted = 0;            // functions, which were returned to the interpreter via remove_jit
+        int64_t     interpreterTicks = 0;   // ref_time_ticks spent in the interpreter tier
+        int64_t     jitTicks = 0;           // ref_time_ticks spent in the jit tier
+        int64_t     compileTicks = 0;       // ref_time_ticks spent compiling, on the background thread
+    };
+
+    class JitTiering;
+
+    // machine code lives as long as the nodes it references, i.e. as long as NodeAllocator
+    class JitCodeArena {
+    public:
+        JitCodeArena() {}
+        ~JitCodeArena();
+        void * place ( const uint8_t * code, size_t size );
+        size_t bytesAllocated() const { return totalBytes; }
+        JitTiering * tiering = nullptr;     // owned, stopped before the nodes go away
+    protected:
+        mutex lock;
+        vector<pair<void *,size_t>> blocks;
+        size_t totalBytes = 0;
+    };
+
+    bool jitIsSupported();
+    // returns false and leaves the function interpreted, if the function can't be compiled
+    bool jitCompileFunction ( Context * context, SimFunction * fn, JitStats * stats = nullptr );
+
+    // tiered execution
+    //  functions start in the interpreter, which counts calls and loop back-edges
+    //  once either crosses its threshold, the function is compiled on the background thread,
+    //  and jit code is swapped in on the next call. remove_jit is the way back to the interpreter
+    bool jitEnableTiering ( Context * context, bool enable, uint32_t callThreshold, uint32_t loopThreshold );
+    void jitWaitTiering ( Context * context );      // waits for the background compilation to finish
+    bool jitTieringStats ( Context * context, JitTierStats & stats );
+    void jitTieringReport ( Context * context, TextWriter & tout );
+}
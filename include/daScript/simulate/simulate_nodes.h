@@ -3,6 +3,7 @@
 #include "simulate.h"
 
 #include "daScript/simulate/simulate_visit_op.h"
+#include "daScript/misc/performance_time.h"
 
 namespace das {
 
@@ -1209,6 +1210,33 @@ SIM_NODE_AT_VECTOR(Float, float)
         virtual vec4f eval ( Context & context ) override;
     };
 
+    // StringBuilder, where every part is a literal, string, scalar, vector, range or enumeration
+    // parts are formatted directly, into the buffer of the known upper bound. output is the same as of the
+    // DebugDataWalker with PrintFlags::string_builder, which SimNode_StringBuilder uses for everything else
+    enum class StringBuilderPartKind : uint8_t {
+        Literal, String, Bool, Int8, UInt8, Int16, UInt16, Int, UInt, Int64, UInt64, Float, Double,
+        Int2, Int3, Int4, UInt2, UInt3, UInt4, Float2, Float3, Float4, Range, URange,
+        Enumeration, Enumeration8, Enumeration16
+    };
+
+    struct StringBuilderPart {
+        StringBuilderPartKind   kind;
+        uint32_t                length = 0;         // of the literal, or the upper bound of the formatted value
+        const char *            text = nullptr;     // literal
+        EnumInfo *              enumInfo = nullptr;
+    };
+
+    struct SimNode_StringBuilderFormat : SimNode_CallBase {
+        SimNode_StringBuilderFormat ( const LineInfo & at ) : SimNode_CallBase(at) {}
+        virtual SimNode * copyNode ( Context & context, NodeAllocator * code ) override;
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        virtual vec4f eval ( Context & context ) override;
+        static uint32_t maxLength ( StringBuilderPartKind kind, EnumInfo * info );
+        StringBuilderPart * parts = nullptr;   // arguments are only for the non-literal parts, in order
+        int32_t             nParts = 0;
+        uint32_t            fixedLength = 0;    // upper bound of everything, but strings
+    };
+
     // CAST
     template <typename CastTo, typename CastFrom>
     struct SimNode_Cast : SimNode_CallBase {
@@ -2529,6 +2557,55 @@ SIM_NODE_AT_VECTOR(Float, float)
 #undef EVAL_NODE
     };
 
+    // function level profiler, see Context::profileFunction
+    // accumulates into the table of the context it runs on, does nothing when that context is not profiling
+    struct SimNode_ProfileFunction : SimNode {
+        SimNode_ProfileFunction ( const LineInfo & at, SimFunction * simF, int32_t idx, SimNode * se )
+            : SimNode(at), func(simF), index(idx), subexpr(se) {}
+        virtual bool rtti_node_isProfileFunction() const override { return true; }
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        struct Scope {
+            __forceinline Scope ( Context & ctx, int32_t index ) : context(ctx) {
+                if ( (data = context.functionProfile) ) {
+                    data += index;
+                    childTicks = context.functionProfileChildTicks;
+                    context.functionProfileChildTicks = 0;
+                    t0 = ref_time_ticks();
+                }
+            }
+            __forceinline ~Scope () {
+                if ( data ) {
+                    int64_t dt = ref_time_ticks() - t0;
+                    data->calls ++;
+                    data->inclusiveTicks += dt;
+                    data->exclusiveTicks += dt - context.functionProfileChildTicks;
+                    data->maxTicks = das::max(data->maxTicks, dt);
+                    context.functionProfileChildTicks = childTicks + dt;
+                }
+            }
+            Context &               context;
+            FunctionProfileData *   data;
+            int64_t                 childTicks = 0;
+            int64_t                 t0 = 0;
+        };
+        virtual vec4f eval ( Context & context ) override {
+            DAS_PROFILE_NODE
+            Scope scope(context, index);
+            return subexpr->eval(context);
+        }
+#define EVAL_NODE(TYPE,CTYPE) \
+        virtual CTYPE eval##TYPE ( Context & context ) override { \
+                DAS_PROFILE_NODE \
+                Scope scope(context, index); \
+                return subexpr->eval##TYPE(context); \
+            }
+        DAS_EVAL_NODE
+#undef EVAL_NODE
+        SimFunction *   func;
+        int32_t         index;
+        SimNode *       subexpr;
+    };
+
 #if DAS_DEBUGGER
 
     struct SimNodeDebug_Instrument : SimNode {
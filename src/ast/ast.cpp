@@ -2,6 +2,7 @@
 
 #include "daScript/ast/ast.h"
 #include "daScript/ast/ast_visitor.h"
+#include "daScript/ast/ast_compile_profile.h"
 
 namespace das {
 
@@ -3003,6 +3004,7 @@ namespace das {
     }
 
     void Program::optimize(TextWriter & logs, ModuleGroup & libGroup) {
+        CompileProfileScope profileScope("pass", "optimize");
         const bool log = options.getBoolOption("log_optimization_passes",false);
         bool any, last;
         if (log) {
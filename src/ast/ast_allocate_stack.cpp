@@ -2,6 +2,7 @@
 
 #include "daScript/ast/ast.h"
 #include "daScript/ast/ast_visitor.h"
+#include "daScript/ast/ast_compile_profile.h"
 
 namespace das {
 
@@ -552,6 +553,7 @@ namespace das {
     // program
 
     void Program::allocateStack(TextWriter & logs) {
+        CompileProfileScope profileScope("pass", "allocate stack");
         // string heap
         AllocateConstString vstr;
         for (auto & pm : library.modules) {
@@ -2,6 +2,7 @@
 
 #include "daScript/ast/ast.h"
 #include "daScript/ast/ast_visitor.h"
+#include "daScript/ast/ast_compile_profile.h"
 
 namespace das
 {
@@ -95,11 +96,13 @@ namespace das
     };
 
     void Program::finalizeAnnotations() {
+        CompileProfileScope profileScope("pass", "finalize annotations");
         FinAnnotationVisitor fin(this);
         visit(fin);
     }
 
     bool Program::patchAnnotations() {
+        CompileProfileScope profileScope("pass", "patch annotations");
         bool astChanged = false;
         thisModule->functions.foreach([&](auto fn){
             for ( auto & ann : fn->annotations ) {
@@ -133,6 +136,7 @@ namespace das
     }
 
     void Program::fixupAnnotations() {
+        CompileProfileScope profileScope("pass", "fixup annotations");
         thisModule->functions.foreach([&](auto fn){
             for ( auto & ann : fn->annotations ) {
                 if ( ann->annotation->rtti_isFunctionAnnotation() ) {
@@ -6,6 +6,8 @@
 
 #include "daScript/misc/enums.h"
 #include "daScript/simulate/hash.h"
+#include "daScript/simulate/simulate_nodes.h"
+#include "daScript/ast/ast_compile_profile.h"
 
 namespace das {
 
@@ -2823,7 +2825,10 @@ namespace das {
                 ExprInvoke * einv = static_cast<ExprInvoke *>(call);
                 ss << "<" << describeCppType(call->type) << ">::invoke";
                 if ( einv->isCopyOrMove() ) ss << "_cmres";
-                if ( call->arguments.size()>1 ) {
+                // block, which is declared in place, is a C++ lambda. argument types are deduced
+                bool inPlaceBlock = call->arguments[0]->rtti_isMakeBlock()
+                    && static_pointer_cast<ExprBlock>(static_pointer_cast<ExprMakeBlock>(call->arguments[0])->block)->aotSkipMakeBlock;
+                if ( call->arguments.size()>1 && !inPlaceBlock ) {
                     ss << "<";
                     for ( const auto & arg : call->arguments ) {
                         if ( arg!=call->arguments.front() ) {
@@ -3309,6 +3314,7 @@ namespace das {
     }
 
     void Program::aotCpp ( Context & context, TextWriter & logs ) {
+        CompileProfileScope profileScope("pass", "aot cpp");
         // run no-aot marker
         NoAotMarker marker;
         visit(marker);
@@ -3322,7 +3328,9 @@ namespace das {
                 if (pfun->index < 0 || !pfun->used)
                     return;
                 SimFunction * fn = context.getFunction(fni);
-                pfun->hash = getFunctionHash(pfun.get(), fn->code, &context);
+                // [jit] functions are already compiled by now, hash what they were compiled from
+                auto code = fn->code->rtti_node_isJit() ? ((SimNode_Jit *)fn->code)->saved_code : fn->code;
+                pfun->hash = getFunctionHash(pfun.get(), code, &context);
                 fni++;
             });
         }
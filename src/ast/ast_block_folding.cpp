@@ -2,6 +2,7 @@
 
 #include "daScript/ast/ast.h"
 #include "daScript/ast/ast_visitor.h"
+#include "daScript/ast/ast_compile_profile.h"
 
 namespace das {
 
@@ -13,6 +14,7 @@ namespace das {
     };
 
     void Program::foldUnsafe() {
+        CompileProfileScope profileScope("pass", "fold unsafe");
         UnsafeFolding context;
         visit(context);
     }
@@ -336,6 +338,7 @@ namespace das {
     // program
 
     bool Program::optimizationRefFolding() {
+        CompileProfileScope profileScope("pass", "ref folding");
         bool any = false, anything = false;
         do {
             RefFolding context;
@@ -347,12 +350,14 @@ namespace das {
     }
 
     bool Program::optimizationBlockFolding() {
+        CompileProfileScope profileScope("pass", "block folding");
         BlockFolding context;
         visit(context);
         return context.didAnything();
     }
 
     bool Program::optimizationCondFolding() {
+        CompileProfileScope profileScope("pass", "cond folding");
         CondFolding context;
         visit(context);
         return context.didAnything();
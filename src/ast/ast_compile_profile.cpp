@@ -0,0 +1,224 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast_compile_profile.h"
+#include "daScript/misc/performance_time.h"
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    #include <malloc.h>
+    #define DAS_COMPILE_PROFILE_HEAP    1
+#else
+    #define DAS_COMPILE_PROFILE_HEAP    0
+#endif
+
+namespace das {
+
+    static DAS_THREAD_LOCAL CompileProfiler * g_compileProfiler = nullptr;
+
+    static int64_t heapInUse() {
+#if DAS_COMPILE_PROFILE_HEAP
+        auto mi = mallinfo2();
+        return int64_t(mi.uordblks + mi.hblkhd);
+#else
+        return 0;
+#endif
+    }
+
+    CompileProfiler::CompileProfiler() {
+        time0 = ref_time_ticks();
+    }
+
+    CompileProfiler::~CompileProfiler() {
+        if ( installed ) uninstall();
+    }
+
+    CompileProfiler * CompileProfiler::current() {
+        return g_compileProfiler;
+    }
+
+    void CompileProfiler::install() {
+        DAS_ASSERT(!installed);
+        previous = g_compileProfiler;
+        g_compileProfiler = this;
+        installed = true;
+    }
+
+    void CompileProfiler::uninstall() {
+        DAS_ASSERT(installed && g_compileProfiler==this);
+        g_compileProfiler = previous;
+        previous = nullptr;
+        installed = false;
+    }
+
+    bool CompileProfiler::heapGrowthSupported() const {
+        return DAS_COMPILE_PROFILE_HEAP;
+    }
+
+    int32_t CompileProfiler::begin ( const char * category, const string & name ) {
+        CompileProfileEvent ev;
+        ev.category = category;
+        ev.name = name;
+        if ( strcmp(category,"module")==0 ) modules.push_back(name);
+        ev.module = modules.empty() ? string() : modules.back();
+        ev.depth = int32_t(stack.size());
+        // macros are called a lot, heap is only measured for passes and modules
+        heapAtBegin.push_back(strcmp(category,"macro")==0 ? 0 : heapInUse());
+        inferAtBegin.push_back(inferPasses);
+        ev.start = int64_t(ref_time_delta_to_usec(ref_time_ticks() - time0));
+        int32_t index = int32_t(events.size());
+        events.push_back(das::move(ev));
+        stack.push_back(index);
+        return index;
+    }
+
+    void CompileProfiler::end ( int32_t index ) {
+        DAS_ASSERT(!stack.empty() && stack.back()==index);
+        auto & ev = events[index];
+        ev.duration = int64_t(ref_time_delta_to_usec(ref_time_ticks() - time0)) - ev.start;
+        if ( strcmp(ev.category,"macro")!=0 ) ev.heapGrowth = heapInUse() - heapAtBegin.back();
+        ev.inferPasses = inferPasses - inferAtBegin.back();
+        if ( strcmp(ev.category,"module")==0 ) modules.pop_back();
+        stack.pop_back();
+        heapAtBegin.pop_back();
+        inferAtBegin.pop_back();
+    }
+
+    void CompileProfiler::report ( TextWriter & tout, CompileProfileFormat format ) const {
+        switch ( format ) {
+        case CompileProfileFormat::text:        reportText(tout); break;
+        case CompileProfileFormat::json:        reportJson(tout); break;
+        case CompileProfileFormat::chromeTrace: reportChromeTrace(tout); break;
+        }
+    }
+
+    struct CompileProfileTotal {
+        string      name;
+        int64_t     time = 0;
+        int64_t     heapGrowth = 0;
+        uint32_t    calls = 0;
+        uint32_t    inferPasses = 0;
+    };
+
+    // totals by name, for the given category. nested scopes of the same name are counted once
+    static vector<CompileProfileTotal> compileProfileTotals ( const vector<CompileProfileEvent> & events,
+            const char * category, bool byModule ) {
+        das_hash_map<string,int> index;
+        vector<CompileProfileTotal> totals;
+        vector<const CompileProfileEvent *> stack;     // ancestors of the current event
+        for ( auto & ev : events ) {
+            stack.resize(ev.depth);
+            stack.push_back(&ev);
+            if ( strcmp(ev.category,category)!=0 ) continue;
+            const string & key = byModule ? ev.module : ev.name;
+            bool nested = false;
+            for ( size_t i=0; i+1<stack.size(); ++i ) {
+                auto outer = stack[i];
+                if ( strcmp(outer->category,category)==0 && (byModule ? outer->module : outer->name)==key ) {
+                    nested = true;
+                    break;
+                }
+            }
+            auto it = index.find(key);
+            if ( it==index.end() ) {
+                it = index.insert(make_pair(key, int(totals.size()))).first;
+                totals.emplace_back();
+                totals.back().name = key;
+            }
+            auto & tot = totals[it->second];
+            tot.calls ++;
+            if ( nested ) continue;
+            tot.time += ev.duration;
+            tot.heapGrowth += ev.heapGrowth;
+            tot.inferPasses += ev.inferPasses;
+        }
+        sort(totals.begin(), totals.end(), [](const CompileProfileTotal & a, const CompileProfileTotal & b) {
+            return a.time > b.time;
+        });
+        return totals;
+    }
+
+    static void reportTotals ( TextWriter & tout, const char * title, const vector<CompileProfileTotal> & totals ) {
+        if ( totals.empty() ) return;
+        tout << title << "\n";
+        tout << "\tusec\tcalls\theap kb\tinfer passes\tname\n";
+        for ( auto & tot : totals ) {
+            tout << "\t" << tot.time << "\t" << tot.calls << "\t" << (tot.heapGrowth / 1024)
+                << "\t" << tot.inferPasses << "\t" << (tot.name.empty() ? "<main>" : tot.name) << "\n";
+        }
+    }
+
+    void CompileProfiler::reportText ( TextWriter & tout ) const {
+        tout << "COMPILE PROFILE:\n";
+        if ( !heapGrowthSupported() ) tout << "heap growth is not available on this platform\n";
+        reportTotals(tout, "passes", compileProfileTotals(events, "pass", false));
+        reportTotals(tout, "modules", compileProfileTotals(events, "module", true));
+        reportTotals(tout, "macros", compileProfileTotals(events, "macro", false));
+    }
+
+    static string jsonString ( const string & str ) {
+        string res = "\"";
+        for ( auto ch : str ) {
+            switch ( ch ) {
+            case '"':   res += "\\\""; break;
+            case '\\':  res += "\\\\"; break;
+            case '\n':  res += "\\n"; break;
+            case '\r':  res += "\\r"; break;
+            case '\t':  res += "\\t"; break;
+            default:
+                if ( uint8_t(ch) < 0x20 ) {
+                    char buf[8];
+                    snprintf(buf, sizeof(buf), "\\u%04x", uint8_t(ch));
+                    res += buf;
+                } else {
+                    res += ch;
+                }
+            }
+        }
+        res += "\"";
+        return res;
+    }
+
+    static void reportJsonTotals ( TextWriter & tout, const char * title, const vector<CompileProfileTotal> & totals ) {
+        tout << "\"" << title << "\":[";
+        const char * sep = "\n";
+        for ( auto & tot : totals ) {
+            tout << sep << "\t{\"name\":" << jsonString(tot.name) << ",\"usec\":" << tot.time
+                << ",\"calls\":" << tot.calls << ",\"heap\":" << tot.heapGrowth
+                << ",\"infer_passes\":" << tot.inferPasses << "}";
+            sep = ",\n";
+        }
+        tout << "\n]";
+    }
+
+    void CompileProfiler::reportJson ( TextWriter & tout ) const {
+        tout << "{\n";
+        reportJsonTotals(tout, "passes", compileProfileTotals(events, "pass", false));
+        tout << ",\n";
+        reportJsonTotals(tout, "modules", compileProfileTotals(events, "module", true));
+        tout << ",\n";
+        reportJsonTotals(tout, "macros", compileProfileTotals(events, "macro", false));
+        tout << ",\n\"events\":[";
+        const char * sep = "\n";
+        for ( auto & ev : events ) {
+            tout << sep << "\t{\"category\":\"" << ev.category << "\",\"name\":" << jsonString(ev.name)
+                << ",\"module\":" << jsonString(ev.module) << ",\"start\":" << ev.start
+                << ",\"usec\":" << ev.duration << ",\"heap\":" << ev.heapGrowth
+                << ",\"infer_passes\":" << ev.inferPasses << ",\"depth\":" << ev.depth << "}";
+            sep = ",\n";
+        }
+        tout << "\n]\n}\n";
+    }
+
+    // https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU, complete events
+    void CompileProfiler::reportChromeTrace ( TextWriter & tout ) const {
+        tout << "{\"traceEvents\":[";
+        const char * sep = "\n";
+        for ( auto & ev : events ) {
+            tout << sep << "\t{\"name\":" << jsonString(ev.name) << ",\"cat\":\"" << ev.category
+                << "\",\"ph\":\"X\",\"ts\":" << ev.start << ",\"dur\":" << ev.duration
+                << ",\"pid\":1,\"tid\":1,\"args\":{\"module\":" << jsonString(ev.module)
+                << ",\"heap\":" << ev.heapGrowth << ",\"infer_passes\":" << ev.inferPasses << "}}";
+            sep = ",\n";
+        }
+        tout << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+}
@@ -4,6 +4,7 @@
 #include "daScript/ast/ast_visitor.h"
 #include "daScript/ast/ast_generate.h"
 #include "daScript/simulate/debug_print.h"
+#include "daScript/ast/ast_compile_profile.h"
 
 /*
 TODO:
@@ -844,6 +845,7 @@ namespace das {
     }
 
     bool Program::optimizationConstFolding() {
+        CompileProfileScope profileScope("pass", "const folding");
         checkSideEffects();
         ConstFolding cfe(this);
         visit(cfe);
@@ -859,6 +861,7 @@ namespace das {
     }
 
     bool Program::verifyAndFoldContracts() {
+        CompileProfileScope profileScope("pass", "contracts");
         ContractFolding context(this);
         visit(context);
         return context.didAnything();
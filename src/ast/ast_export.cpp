@@ -2,6 +2,7 @@
 
 #include "daScript/ast/ast.h"
 #include "daScript/ast/ast_visitor.h"
+#include "daScript/ast/ast_compile_profile.h"
 
 namespace das {
 
@@ -262,6 +263,7 @@ namespace das {
     }
 
     void Program::markModuleSymbolUse(TextWriter * logs) {
+        CompileProfileScope profileScope("pass", "mark symbol use");
         // this module public, this module export, this module init\shutdown
         clearSymbolUse();
         MarkSymbolUse vis(false);
@@ -272,6 +274,7 @@ namespace das {
     }
 
     void Program::markMacroSymbolUse(TextWriter * logs) {
+        CompileProfileScope profileScope("pass", "mark symbol use");
         // this module macro init
         clearSymbolUse();
         MarkSymbolUse vis(false);
@@ -282,6 +285,7 @@ namespace das {
     }
 
     void Program::markExecutableSymbolUse(TextWriter * logs) {
+        CompileProfileScope profileScope("pass", "mark symbol use");
         clearSymbolUse();
         MarkSymbolUse vis(false);
         vis.tw = logs;
@@ -309,6 +313,7 @@ namespace das {
     }
 
     void Program::removeUnusedSymbols() {
+        CompileProfileScope profileScope("pass", "remove unused symbols");
         if ( options.getBoolOption("remove_unused_symbols",true) ) {
             ClearUnusedSymbols cvis;
             visit(cvis);
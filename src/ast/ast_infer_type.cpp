@@ -3,6 +3,7 @@
 #include "daScript/ast/ast.h"
 #include "daScript/ast/ast_visitor.h"
 #include "daScript/ast/ast_generate.h"
+#include "daScript/ast/ast_compile_profile.h"
 
 namespace das {
 
@@ -7403,6 +7404,7 @@ namespace das {
     // try infer, if failed - no macros
     // run macros til any of them does work, then reinfer and restart (i.e. infer after each macro)
     void Program::inferTypes(TextWriter &logs, ModuleGroup & libGroup) {
+        CompileProfileScope profileScope("pass", "infer");
         newLambdaIndex = 1;
         inferTypesDirty(logs, false);
         bool anyMacrosDidWork = false;
@@ -7451,8 +7453,10 @@ namespace das {
         if ( log ) {
             logs << "INITIAL CODE:\n" << *this;
         }
+        auto profiler = CompileProfiler::current();
         for ( pass = 0; pass < maxPasses; ++pass ) {
             if ( macroException ) break;
+            if ( profiler ) profiler->countInferPass();
             failToCompile = false;
             errors.clear();
             InferTypes context(this);
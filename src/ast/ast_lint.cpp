@@ -4,6 +4,7 @@
 #include "daScript/ast/ast_generate.h"
 #include "daScript/ast/ast_expressions.h"
 #include "daScript/ast/ast_visitor.h"
+#include "daScript/ast/ast_compile_profile.h"
 
 namespace das {
 
@@ -479,6 +480,8 @@ namespace das {
         "intern_strings",               Type::tBool,
         "multiple_contexts",            Type::tBool,
         "persistent_heap",              Type::tBool,
+        "swiss_tables",                 Type::tBool,
+        "clone_snapshot",               Type::tBool,
         "heap_size_hint",               Type::tInt,
         "string_heap_size_hint",        Type::tInt,
         "gc",                           Type::tBool,
@@ -536,6 +539,7 @@ namespace das {
     }
 
     void Program::lint ( ModuleGroup & libGroup ) {
+        CompileProfileScope profileScope("pass", "lint");
         if (!options.getBoolOption("lint", true)) {
             return;
         }
@@ -2,6 +2,7 @@
 
 #include "daScript/ast/ast.h"
 #include "daScript/ast/ast_expressions.h"
+#include "daScript/ast/ast_compile_profile.h"
 
 #include "../parser/parser_state.h"
 
@@ -283,6 +284,69 @@ namespace das {
     static DAS_THREAD_LOCAL int64_t totOpt = 0;
     static DAS_THREAD_LOCAL int64_t totM = 0;
 
+    // compile time of a single module, along with its place in the dependency graph
+    struct ModuleCompileTime {
+        string      name;
+        int         wave = 0;           // 0 for modules, which only require builtin ones
+        int64_t     parse = 0;
+        int64_t     infer = 0;
+        int64_t     optimize = 0;
+        int64_t     macro = 0;
+        int64_t     total = 0;
+        int64_t     criticalPath = 0;   // longest chain of dependencies, which ends with this module
+    };
+
+    struct ModuleCompileTimes {
+        vector<ModuleCompileTime>   modules;
+        das_hash_map<string,int>    index;
+        __forceinline void begin() {
+            parse0 = totParse; infer0 = totInfer; opt0 = totOpt; macro0 = totM;
+            time0 = ref_time_ticks();
+        }
+        void end ( const string & name, Module * mod ) {
+            ModuleCompileTime mt;
+            mt.name = name;
+            mt.total = get_time_usec(time0);
+            mt.parse = totParse - parse0;
+            mt.infer = totInfer - infer0;
+            mt.optimize = totOpt - opt0;
+            mt.macro = totM - macro0;
+            int64_t depPath = 0;
+            int depWave = -1;
+            if ( mod ) {
+                for ( auto & req : mod->requireModule ) {
+                    auto it = index.find(req.first->name);
+                    if ( it!=index.end() && !req.first->name.empty() ) {
+                        auto & dep = modules[it->second];
+                        depWave = das::max(depWave, dep.wave);
+                        depPath = das::max(depPath, dep.criticalPath);
+                    }
+                }
+            }
+            mt.wave = depWave + 1;
+            mt.criticalPath = depPath + mt.total;
+            index[name] = int(modules.size());
+            modules.push_back(mt);
+        }
+        void log ( TextWriter & logs ) const {
+            logs << "\tper module: wave, parse, infer, optimize, macro, total\n";
+            int64_t serial = 0, critical = 0;
+            int waves = 0;
+            for ( auto & mt : modules ) {
+                logs << "\t\t" << mt.name << "\t" << mt.wave
+                    << "\t" << (mt.parse / 1000000.) << "\t" << (mt.infer / 1000000.)
+                    << "\t" << (mt.optimize / 1000000.) << "\t" << (mt.macro / 1000000.)
+                    << "\t" << (mt.total / 1000000.) << "\n";
+                serial += mt.total;
+                critical = das::max(critical, mt.criticalPath);
+                waves = das::max(waves, mt.wave + 1);
+            }
+            logs << "\tdependency waves " << waves << ", serial " << (serial / 1000000.)
+                << ", critical path " << (critical / 1000000.) << "\n";
+        }
+        int64_t parse0 = 0, infer0 = 0, opt0 = 0, macro0 = 0, time0 = 0;
+    };
+
     ProgramPtr parseDaScript ( const string & fileName,
                               const FileAccessPtr & access,
                               TextWriter & logs,
@@ -291,6 +355,7 @@ namespace das {
                               bool isDep,
                               CodeOfPolicies policies ) {
         ReuseCacheGuard rcg;
+        CompileProfileScope profileScope("module", fileName);
         auto time0 = ref_time_ticks();
         int err;
         auto program = make_smart<Program>();
@@ -334,7 +399,10 @@ namespace das {
             daScriptEnvironment::bound->g_Program.reset();
             return program;
         }
-        err = das_yyparse(scanner);
+        {
+            CompileProfileScope parseScope("pass", "parse");
+            err = das_yyparse(scanner);
+        }
         das_yylex_destroy(scanner);
         parserState = DasParserState();
         totParse += get_time_usec(time0);
@@ -420,6 +488,24 @@ namespace das {
         }
     }
 
+    // profile_compile policy, without a profiler installed by the host, reports just the compilation
+    struct OwnCompileProfiler {
+        OwnCompileProfiler ( const CodeOfPolicies & policies, TextWriter & l ) : logs(l) {
+            if ( policies.profile_compile && !CompileProfiler::current() ) {
+                profiler = make_unique<CompileProfiler>();
+                profiler->install();
+            }
+        }
+        ~OwnCompileProfiler() {
+            if ( profiler ) {
+                profiler->uninstall();
+                profiler->report(logs, CompileProfileFormat::text);
+            }
+        }
+        unique_ptr<CompileProfiler> profiler;
+        TextWriter &                logs;
+    };
+
     ProgramPtr compileDaScript ( const string & fileName,
                                 const FileAccessPtr & access,
                                 TextWriter & logs,
@@ -427,8 +513,10 @@ namespace das {
                                 bool exportAll,
                                 CodeOfPolicies policies ) {
         ReuseCacheGuard rcg;
+        OwnCompileProfiler ownProfiler(policies, logs);
         auto time0 = ref_time_ticks();
-        totParse = 0;
+        totParse = totInfer = totOpt = totM = 0;
+        ModuleCompileTimes moduleTimes;
         vector<ModuleInfo> req;
         vector<string> missing, circular, notAllowed;
         das_set<string> dependencies;
@@ -457,10 +545,12 @@ namespace das {
             }
             for ( auto & mod : req ) {
                 if ( !libGroup.findModule(mod.moduleName) ) {
+                    moduleTimes.begin();
                     auto program = parseDaScript(mod.fileName, access, logs, libGroup, true, true, policies);
                     if ( program->failed() ) {
                         return program;
                     }
+                    moduleTimes.end(mod.moduleName, program->thisModule.get());
                     if ( policies.fail_on_lack_of_aot_export ) {
                         if ( !program->options.getBoolOption("no_aot",false) ) {
                             if ( program->thisModule->name.empty() ) {
@@ -500,7 +590,9 @@ namespace das {
                     }, "*");
                 }
             }
+            moduleTimes.begin();
             auto res = parseDaScript(fileName, access, logs, libGroup, exportAll, false, policies);
+            moduleTimes.end(fileName, res->thisModule.get());
             if ( !res->failed() ) {
                 if ( res->options.getBoolOption("log_symbol_use") ) {
                     res->markSymbolUse(false, false, false, &logs);
@@ -563,6 +655,7 @@ namespace das {
                      << "\toptimize " << (totOpt   / 1000000.) << "\n"
                      << "\tmacro    " << (totM     / 1000000.) << "\n"
                 ;
+                moduleTimes.log(logs);
             }
             return res;
         } else {
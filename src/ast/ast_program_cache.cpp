@@ -0,0 +1,113 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast_program_cache.h"
+#include "daScript/misc/fnv.h"
+#include "daScript/misc/performance_time.h"
+
+namespace das {
+
+    // keep in sync with CodeOfPolicies
+    uint64_t hashCodeOfPolicies ( const CodeOfPolicies & p ) {
+        const uint32_t values[] = {
+            p.aot, p.aot_module, p.completion,
+            p.stack, p.intern_strings, p.persistent_heap, p.swiss_tables, p.clone_snapshot, p.multiple_contexts,
+            p.heap_size_hint, p.string_heap_size_hint, p.solid_context,
+            p.macro_context_persistent_heap, p.macro_context_collect,
+            p.rtti,
+            p.no_unsafe, p.local_ref_is_unsafe, p.no_global_variables, p.no_global_variables_at_all,
+            p.no_global_heap, p.only_fast_aot, p.aot_order_side_effects, p.no_unused_function_arguments,
+            p.no_unused_block_arguments, p.smart_pointer_by_value_unsafe, p.allow_block_variable_shadowing,
+            p.allow_local_variable_shadowing, p.allow_shared_lambda, p.ignore_shared_modules,
+            p.default_module_public,
+            p.no_optimizations, p.fail_on_no_aot, p.fail_on_lack_of_aot_export, p.profile_compile,
+            p.debugger,
+        };
+        auto hv = hash_block64((const uint8_t *)values, sizeof(values));
+        return hv ^ hash_blockz64((const uint8_t *)p.debug_module.c_str());
+    }
+
+    bool ProgramCache::hashSource ( const string & fileName, const FileAccessPtr & access, uint64_t & hash ) {
+        auto fi = access->getFileInfo(fileName);
+        if ( !fi ) return false;
+        const char * src = nullptr;
+        uint32_t len = 0;
+        fi->getSourceAndLength(src, len);
+        if ( !src ) return false;
+        hash = hash_block64((const uint8_t *)src, len);
+        return true;
+    }
+
+    bool ProgramCache::collectSources ( const string & fileName, const FileAccessPtr & access,
+            const CodeOfPolicies & policies, CachedProgram & entry ) {
+        vector<ModuleInfo> req;
+        vector<string> missing, circular, notAllowed;
+        das_set<string> dependencies;
+        ModuleGroup reqGroup;
+        if ( !getPrerequisits(fileName, access, req, missing, circular, notAllowed,
+                dependencies, reqGroup, nullptr, 1, !policies.ignore_shared_modules) ) {
+            return false;
+        }
+        if ( policies.debugger && !policies.debug_module.empty() ) {
+            ModuleInfo info;
+            info.fileName = policies.debug_module;
+            req.push_back(info);
+        }
+        entry.sources.clear();
+        entry.sources.emplace_back(fileName, 0);
+        for ( auto & mod : req ) {
+            entry.sources.emplace_back(mod.fileName, 0);
+        }
+        for ( auto & src : entry.sources ) {
+            if ( !hashSource(src.first, access, src.second) ) return false;
+        }
+        entry.sourcesHash = 14695981039346656037ul;
+        for ( auto & src : entry.sources ) {
+            entry.sourcesHash = (entry.sourcesHash ^ src.second) * 1099511628211ul;
+        }
+        return true;
+    }
+
+    CachedProgramPtr ProgramCache::find ( const string & fileName, const FileAccessPtr & access, const CodeOfPolicies & policies ) {
+        auto it = entries.find(fileName);
+        if ( it==entries.end() ) return nullptr;
+        auto & entry = it->second;
+        if ( entry->policiesHash!=hashCodeOfPolicies(policies) ) return nullptr;
+        for ( auto & src : entry->sources ) {
+            uint64_t hash = 0;
+            if ( !hashSource(src.first, access, hash) || hash!=src.second ) return nullptr;
+        }
+        return entry;
+    }
+
+    CachedProgramPtr ProgramCache::compile ( const string & fileName, const FileAccessPtr & access, TextWriter & logs,
+            bool exportAll, CodeOfPolicies policies ) {
+        auto time0 = ref_time_ticks();
+        if ( auto entry = find(fileName, access, policies) ) {
+            stats.hits ++;
+            stats.warmUsec += get_time_usec(time0);
+            return entry;
+        }
+        auto entry = make_smart<CachedProgram>();
+        entry->group = make_unique<ModuleGroup>();
+        entry->policiesHash = hashCodeOfPolicies(policies);
+        entry->program = compileDaScript(fileName, access, logs, *entry->group, exportAll, policies);
+        entry->compileUsec = get_time_usec(time0);
+        stats.misses ++;
+        stats.coldUsec += entry->compileUsec;
+        // failed programs are returned, but not cached
+        if ( entry->program->failed() || !collectSources(fileName, access, policies, *entry) ) {
+            entries.erase(fileName);
+            return entry;
+        }
+        entries[fileName] = entry;
+        return entry;
+    }
+
+    bool ProgramCache::invalidate ( const string & fileName ) {
+        return entries.erase(fileName) != 0;
+    }
+
+    void ProgramCache::clear() {
+        entries.clear();
+    }
+}
@@ -13,6 +13,7 @@
 #include "daScript/simulate/simulate_nodes.h"
 
 #include "daScript/simulate/simulate_visit_op.h"
+#include "daScript/ast/ast_compile_profile.h"
 
 das::Context * get_context ( int stackSize=0 );//link time resolved dependencies
 
@@ -1920,7 +1921,86 @@ namespace das
         }
     }
 
+    static bool stringBuilderPartKind ( const TypeDecl * type, StringBuilderPartKind & kind ) {
+        if ( type->isRef() || type->dim.size() ) return false;
+        switch ( type->baseType ) {
+        case Type::tString:         kind = StringBuilderPartKind::String; return true;
+        case Type::tBool:           kind = StringBuilderPartKind::Bool; return true;
+        case Type::tInt8:           kind = StringBuilderPartKind::Int8; return true;
+        case Type::tUInt8:          kind = StringBuilderPartKind::UInt8; return true;
+        case Type::tInt16:          kind = StringBuilderPartKind::Int16; return true;
+        case Type::tUInt16:         kind = StringBuilderPartKind::UInt16; return true;
+        case Type::tInt:            kind = StringBuilderPartKind::Int; return true;
+        case Type::tUInt:           kind = StringBuilderPartKind::UInt; return true;
+        case Type::tInt64:          kind = StringBuilderPartKind::Int64; return true;
+        case Type::tUInt64:         kind = StringBuilderPartKind::UInt64; return true;
+        case Type::tFloat:          kind = StringBuilderPartKind::Float; return true;
+        case Type::tDouble:         kind = StringBuilderPartKind::Double; return true;
+        case Type::tInt2:           kind = StringBuilderPartKind::Int2; return true;
+        case Type::tInt3:           kind = StringBuilderPartKind::Int3; return true;
+        case Type::tInt4:           kind = StringBuilderPartKind::Int4; return true;
+        case Type::tUInt2:          kind = StringBuilderPartKind::UInt2; return true;
+        case Type::tUInt3:          kind = StringBuilderPartKind::UInt3; return true;
+        case Type::tUInt4:          kind = StringBuilderPartKind::UInt4; return true;
+        case Type::tFloat2:         kind = StringBuilderPartKind::Float2; return true;
+        case Type::tFloat3:         kind = StringBuilderPartKind::Float3; return true;
+        case Type::tFloat4:         kind = StringBuilderPartKind::Float4; return true;
+        case Type::tRange:          kind = StringBuilderPartKind::Range; return true;
+        case Type::tURange:         kind = StringBuilderPartKind::URange; return true;
+        case Type::tEnumeration:    kind = StringBuilderPartKind::Enumeration; return true;
+        case Type::tEnumeration8:   kind = StringBuilderPartKind::Enumeration8; return true;
+        case Type::tEnumeration16:  kind = StringBuilderPartKind::Enumeration16; return true;
+        default:                    return false;
+        }
+    }
+
+    // when all the parts are simple, they are formatted directly, without the data walker
+    static SimNode * simulateStringBuilderFormat ( Context & context, const ExprStringBuilder * expr ) {
+        vector<StringBuilderPart> parts;
+        vector<ExpressionPtr> args;
+        for ( const auto & elem : expr->elements ) {
+            StringBuilderPart part;
+            if ( elem->rtti_isStringConstant() ) {
+                const auto & text = static_pointer_cast<ExprConstString>(elem)->text;
+                if ( text.empty() ) continue;
+                part.kind = StringBuilderPartKind::Literal;
+                part.text = context.constStringHeap->allocateString(text);
+                part.length = uint32_t(text.length());
+            } else {
+                if ( !elem->type || !stringBuilderPartKind(elem->type.get(), part.kind) ) return nullptr;
+                if ( elem->type->isEnum() ) {
+                    part.enumInfo = context.thisHelper->makeTypeInfo(nullptr, elem->type)->enumType;
+                }
+                args.push_back(elem);
+            }
+            parts.push_back(part);
+        }
+        if ( parts.empty() ) return nullptr;
+        auto pSB = context.code->makeNode<SimNode_StringBuilderFormat>(expr->at);
+        pSB->nParts = int32_t(parts.size());
+        pSB->parts = (StringBuilderPart *) context.code->allocate(parts.size() * sizeof(StringBuilderPart));
+        for ( size_t i=0; i!=parts.size(); ++i ) {
+            auto & part = parts[i];
+            if ( part.kind!=StringBuilderPartKind::Literal ) {
+                part.length = SimNode_StringBuilderFormat::maxLength(part.kind, part.enumInfo);
+            }
+            pSB->fixedLength += part.length;
+            pSB->parts[i] = part;
+        }
+        if ( int nArg = (int) args.size() ) {
+            pSB->arguments = (SimNode **) context.code->allocate(nArg * sizeof(SimNode *));
+            pSB->nArguments = nArg;
+            for ( int a=0; a!=nArg; ++a ) {
+                pSB->arguments[a] = args[a]->simulate(context);
+            }
+        }
+        return pSB;
+    }
+
     SimNode * ExprStringBuilder::simulate (Context & context) const {
+        if ( auto pFmt = simulateStringBuilderFormat(context, this) ) {
+            return pFmt;
+        }
         SimNode_StringBuilder * pSB = context.code->makeNode<SimNode_StringBuilder>(at);
         if ( int nArg = (int) elements.size() ) {
             pSB->arguments = (SimNode **) context.code->allocate(nArg * sizeof(SimNode *));
@@ -2796,6 +2876,7 @@ namespace das
     }
 
     void Program::makeMacroModule ( TextWriter & logs ) {
+        CompileProfileScope profileScope("pass", "macro module");
         isCompilingMacros = true;
         thisModule->macroContext = get_context(getContextStackSize());
         thisModule->macroContext->category = uint32_t(das::ContextCategory::macro_context);
@@ -2813,6 +2894,7 @@ namespace das
     extern "C" int get_time_usec (int64_t reft);
 
     bool Program::simulate ( Context & context, TextWriter & logs, StackAllocator * sharedStack ) {
+        CompileProfileScope profileScope("pass", "simulate");
         auto time0 = ref_time_ticks();
         isSimulating = true;
         context.thisProgram = this;
@@ -2824,6 +2906,8 @@ namespace das
             context.heap = make_smart<LinearHeapAllocator>();
             context.stringHeap = make_smart<LinearStringAllocator>();
         }
+        context.swissTables = options.getBoolOption("swiss_tables", policies.swiss_tables);
+        context.cloneSnapshot = options.getBoolOption("clone_snapshot", policies.clone_snapshot);
         context.heap->setInitialSize ( options.getIntOption("heap_size_hint", policies.heap_size_hint) );
         context.stringHeap->setInitialSize ( options.getIntOption("string_heap_size_hint", policies.string_heap_size_hint) );
         context.constStringHeap = make_shared<ConstStringAllocator>();
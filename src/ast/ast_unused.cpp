@@ -2,6 +2,7 @@
 
 #include "daScript/ast/ast.h"
 #include "daScript/ast/ast_visitor.h"
+#include "daScript/ast/ast_compile_profile.h"
 
 namespace das {
 
@@ -659,6 +660,7 @@ namespace das {
     // program
 
     void Program::buildAccessFlags(TextWriter &) {
+        CompileProfileScope profileScope("pass", "access flags");
         markSymbolUse(true,false,true);
         // determine function side-effects
         TrackFieldAndAtFlags faf;
@@ -666,6 +668,7 @@ namespace das {
     }
 
     bool Program::optimizationUnused(TextWriter & logs) {
+        CompileProfileScope profileScope("pass", "unused");
         buildAccessFlags(logs);
         // remove itselft
         RemoveUnusedLocalVariables context;
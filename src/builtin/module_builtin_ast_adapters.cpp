@@ -7,6 +7,7 @@
 #include "daScript/ast/ast_expressions.h"
 #include "daScript/ast/ast_generate.h"
 #include "daScript/ast/ast_visitor.h"
+#include "daScript/ast/ast_compile_profile.h"
 #include "daScript/simulate/aot_builtin_ast.h"
 #include "daScript/simulate/aot_builtin_string.h"
 #include "daScript/misc/performance_time.h"
@@ -660,7 +661,7 @@ namespace das {
 
 #include "ast_gen.inc"
 
-    void runMacroFunction ( Context * context, const string & message, const callable<void()> & subexpr ) {
+    static void runMacroFunctionWithCatch ( Context * context, const string & message, const callable<void()> & subexpr ) {
         if ( !context->runWithCatch(subexpr) ) {
             DAS_ASSERTF(daScriptEnvironment::bound->g_Program, "calling macros while not compiling a program");
             daScriptEnvironment::bound->g_Program->error(
@@ -673,6 +674,20 @@ namespace das {
         }
     }
 
+    void runMacroFunction ( Context * context, const string & macroName, const string & message, const callable<void()> & subexpr ) {
+        if ( auto profiler = CompileProfiler::current() ) {
+            auto index = profiler->begin("macro", macroName.empty() ? message : macroName + "." + message);
+            runMacroFunctionWithCatch(context, message, subexpr);
+            profiler->end(index);
+        } else {
+            runMacroFunctionWithCatch(context, message, subexpr);
+        }
+    }
+
+    void runMacroFunction ( Context * context, const string & message, const callable<void()> & subexpr ) {
+        runMacroFunction(context, string(), message, subexpr);
+    }
+
     struct AstVisitorAdapterAnnotation : ManagedStructureAnnotation<VisitorAdapter,false,true> {
         AstVisitorAdapterAnnotation(ModuleLibrary & ml)
             : ManagedStructureAnnotation ("VisitorAdapter", ml) {
@@ -699,7 +714,7 @@ namespace das {
                             const AnnotationArgumentList & args, string & errors ) override {
             if ( auto fnApply = get_apply(classPtr) ) {
                 bool result = true;
-                runMacroFunction(context, "apply", [&]() {
+                runMacroFunction(context, name, "apply", [&]() {
                     result = invoke_apply(context,fnApply,classPtr,blk,group,args,errors);
                 });
                 return result;
@@ -712,7 +727,7 @@ namespace das {
                                const AnnotationArgumentList & progArgs, string & errors ) override {
             if ( auto fnFinish = get_finish(classPtr) ) {
                 bool result = true;
-                runMacroFunction(context, "finish", [&]() {
+                runMacroFunction(context, name, "finish", [&]() {
                     result = invoke_finish(context,fnFinish,classPtr,blk,group,args,progArgs,errors);
                 });
                 return result;
@@ -734,7 +749,7 @@ namespace das {
                             const AnnotationArgumentList & args, string & errors ) override {
             if ( auto fnApply = get_apply(classPtr) ) {
                 bool result = true;
-                runMacroFunction(context, "apply", [&]() {
+                runMacroFunction(context, name, "apply", [&]() {
                     result = invoke_apply(context,fnApply,classPtr,func,group,args,errors);
                 });
                 return result;
@@ -747,7 +762,7 @@ namespace das {
                                const AnnotationArgumentList & progArgs, string & errors ) override {
             if ( auto fnFinish = get_finish(classPtr) ) {
                 bool result = true;
-                runMacroFunction(context, "finish", [&]() {
+                runMacroFunction(context, name, "finish", [&]() {
                     result = invoke_finish(context,fnFinish,classPtr,func,group,args,progArgs,errors);
                 });
                 return result;
@@ -760,7 +775,7 @@ namespace das {
                                const AnnotationArgumentList & progArgs, string & errors ) override {
             if ( auto fnLint = get_lint(classPtr) ) {
                 bool result = true;
-                runMacroFunction(context, "lint", [&]() {
+                runMacroFunction(context, name, "lint", [&]() {
                     result = invoke_lint(context,fnLint,classPtr,func,group,args,progArgs,errors);
                 });
                 return result;
@@ -773,7 +788,7 @@ namespace das {
                                const AnnotationArgumentList & progArgs, string & errors, bool & astChanged ) override {
             if ( auto fnPatch = get_patch(classPtr) ) {
                 bool result = true;
-                runMacroFunction(context, "patch", [&]() {
+                runMacroFunction(context, name, "patch", [&]() {
                     result = invoke_patch(context,fnPatch,classPtr,func,group,args,progArgs,errors,astChanged);
                 });
                 return result;
@@ -786,7 +801,7 @@ namespace das {
                                const AnnotationArgumentList & progArgs, string & errors ) override {
             if ( auto fnFixup = get_fixup(classPtr) ) {
                 bool result = true;
-                runMacroFunction(context, "fixup", [&]() {
+                runMacroFunction(context, name, "fixup", [&]() {
                     result = invoke_fixup(context,fnFixup,classPtr,func,group,args,progArgs,errors);
                 });
                 return result;
@@ -808,7 +823,7 @@ namespace das {
         virtual ExpressionPtr transformCall ( ExprCallFunc * call, string & err ) override {
             if ( auto fnTransform = get_transform(classPtr) ) {
                 ExpressionPtr result;
-                runMacroFunction(context, "transformCall", [&]() {
+                runMacroFunction(context, name, "transformCall", [&]() {
                     result = invoke_transform(context,fnTransform,classPtr,call,err);
                 });
                 return result;
@@ -820,7 +835,7 @@ namespace das {
                 const AnnotationArgumentList & progArgs, string & err ) override {
             if ( auto fnTransform = get_verifyCall(classPtr) ) {
                 bool result = true;
-                runMacroFunction(context, "verifyCall", [&]() {
+                runMacroFunction(context, name, "verifyCall", [&]() {
                     result = invoke_verifyCall(context,fnTransform,classPtr,call,args,progArgs,err);
                 });
                 return result;
@@ -831,7 +846,7 @@ namespace das {
         virtual bool isSpecialized () const override {
             if ( auto fnIsSpecialized = get_isSpecialized(classPtr) ) {
                 bool result = false;
-                runMacroFunction(context, "isSpecialized", [&]() {
+                runMacroFunction(context, name, "isSpecialized", [&]() {
                     result = invoke_isSpecialized(context,fnIsSpecialized,classPtr);
                 });
                 return result;
@@ -843,7 +858,7 @@ namespace das {
             const AnnotationDeclaration & decl, string & err  ) const override {
             if ( auto fnIsCompatible = get_isCompatible(classPtr) ) {
                 bool result = true;
-                runMacroFunction(context, "isCompatible", [&]() {
+                runMacroFunction(context, name, "isCompatible", [&]() {
                     result = invoke_isCompatible(context,fnIsCompatible,classPtr,fn,const_cast<vector<TypeDeclPtr> &>(types),decl,err);
                 });
                 return result;
@@ -853,14 +868,14 @@ namespace das {
         }
         virtual void  complete (  Context * ctx, const FunctionPtr & fnp ) override {
             if ( auto fnComplete = get_complete(classPtr) ) {
-                runMacroFunction(context, "complete", [&]() {
+                runMacroFunction(context, name, "complete", [&]() {
                     invoke_complete(context,fnComplete,classPtr,fnp,ctx);
                 });
             }
         }
         virtual void appendToMangledName( const FunctionPtr & fnp, const AnnotationDeclaration & decl, string & mangledName ) const override {
             if ( auto fnAppend = get_appendToMangledName(classPtr) ) {
-                runMacroFunction(context, "appendToMangledName", [&]() {
+                runMacroFunction(context, name, "appendToMangledName", [&]() {
                     invoke_appendToMangledName(context,fnAppend,classPtr,fnp,decl,mangledName);
                 });
             }
@@ -884,7 +899,7 @@ namespace das {
                             const AnnotationArgumentList & args, string & errors ) override {
             if ( auto fnApply = get_apply(classPtr) ) {
                 bool result = true;
-                runMacroFunction(context, "apply", [&]() {
+                runMacroFunction(context, name, "apply", [&]() {
                     result = invoke_apply(context,fnApply,classPtr,st,group,args,errors);
                 });
                 return result;
@@ -896,7 +911,7 @@ namespace das {
             const AnnotationArgumentList & args, string & errors ) override {
             if ( auto fnFinish = get_finish(classPtr) ) {
                 bool result = true;
-                runMacroFunction(context, "finish", [&]() {
+                runMacroFunction(context, name, "finish", [&]() {
                     result = invoke_finish(context,fnFinish,classPtr,st,group,args,errors);
                 });
                 return result;
@@ -908,7 +923,7 @@ namespace das {
             const AnnotationArgumentList & args, string & errors, bool & astChanged ) override {
             if ( auto fnPatch = get_patch(classPtr) ) {
                 bool result = true;
-                runMacroFunction(context, "patch", [&]() {
+                runMacroFunction(context, name, "patch", [&]() {
                     result = invoke_patch(context,fnPatch,classPtr,st,group,args,errors,astChanged);
                 });
                 return result;
@@ -918,7 +933,7 @@ namespace das {
         }
         virtual void  complete (  Context * ctx, const StructurePtr & stp ) override {
             if ( auto fnComplete = get_complete(classPtr) ) {
-                runMacroFunction(context, "complete", [&]() {
+                runMacroFunction(context, name, "complete", [&]() {
                     invoke_complete(context,fnComplete,classPtr,stp,ctx);
                 });
             }
@@ -942,7 +957,7 @@ namespace das {
                             const AnnotationArgumentList & args, string & errors ) override {
             if ( auto fnApply = get_apply(classPtr) ) {
                 bool result = true;
-                runMacroFunction(context, "apply", [&]() {
+                runMacroFunction(context, name, "apply", [&]() {
                     result = invoke_apply(context,fnApply,classPtr,st,group,args,errors);
                 });
                 return result;
@@ -968,7 +983,7 @@ namespace das {
         virtual bool apply ( Program * prog, Module * mod ) override {
             if ( auto fnApply = get_apply(classPtr) ) {
                 bool result = false;
-                runMacroFunction(context, "apply", [&]() {
+                runMacroFunction(context, name, "apply", [&]() {
                     result = invoke_apply(context,fnApply,classPtr,prog,mod);
                 });
                 return result;
@@ -995,7 +1010,7 @@ namespace das {
         virtual ExpressionPtr visitIs ( Program * prog, Module * mod, ExprIsVariant * expr ) override {
             if ( auto fnVisitIs = get_visitExprIsVariant(classPtr) ) {
                 ExpressionPtr result;
-                runMacroFunction(context, "visitExprIsVariant", [&]() {
+                runMacroFunction(context, name, "visitExprIsVariant", [&]() {
                     result = invoke_visitExprIsVariant(context,fnVisitIs,classPtr,prog,mod,expr);
                 });
                 return result;
@@ -1006,7 +1021,7 @@ namespace das {
         virtual ExpressionPtr visitAs ( Program * prog, Module * mod, ExprAsVariant * expr ) override {
             if ( auto fnVisitAs = get_visitExprAsVariant(classPtr) ) {
                 ExpressionPtr result;
-                runMacroFunction(context, "visitExprAsVariant", [&]() {
+                runMacroFunction(context, name, "visitExprAsVariant", [&]() {
                     result = invoke_visitExprAsVariant(context,fnVisitAs,classPtr,prog,mod,expr);
                 });
                 return result;
@@ -1017,7 +1032,7 @@ namespace das {
         virtual ExpressionPtr visitSafeAs ( Program * prog, Module * mod, ExprSafeAsVariant * expr ) override {
             if ( auto fnVisitSafeAs = get_visitExprSafeAsVariant(classPtr) ) {
                 ExpressionPtr result;
-                runMacroFunction(context, "visitExprSafeAsVariant", [&]() {
+                runMacroFunction(context, name, "visitExprSafeAsVariant", [&]() {
                     result = invoke_visitExprSafeAsVariant(context,fnVisitSafeAs,classPtr,prog,mod,expr);
                 });
                 return result;
@@ -1044,7 +1059,7 @@ namespace das {
         virtual ExpressionPtr visit ( Program * prog, Module * mod, ExprFor * loop ) override {
             if ( auto fnVisit = get_visitExprFor(classPtr) ) {
                 ExpressionPtr result;
-                runMacroFunction(context, "visitExprFor", [&]() {
+                runMacroFunction(context, name, "visitExprFor", [&]() {
                     result = invoke_visitExprFor(context,fnVisit,classPtr,prog,mod,loop);
                 });
                 return result;
@@ -1071,7 +1086,7 @@ namespace das {
         virtual ExpressionPtr captureExpression ( Program * prog, Module * mod, Expression * expr, TypeDecl * typ ) override {
             if ( auto fnCaptureExpression = get_captureExpression(classPtr) ) {
                 ExpressionPtr result;
-                runMacroFunction(context, "captureExpression", [&]() {
+                runMacroFunction(context, name, "captureExpression", [&]() {
                     result = invoke_captureExpression(context,fnCaptureExpression,classPtr,prog,mod,expr,typ);
                 });
                 return result;
@@ -1081,7 +1096,7 @@ namespace das {
         }
         virtual void captureFunction ( Program * prog, Module * mod, Structure * lcs, Function * fun ) override {
             if ( auto fnCaptureFunction = get_captureFunction(classPtr) ) {
-                runMacroFunction(context, "captureFunction", [&]() {
+                runMacroFunction(context, name, "captureFunction", [&]() {
                     invoke_captureFunction(context,fnCaptureFunction,classPtr,prog,mod,lcs,fun);
                 });
             }
@@ -1105,7 +1120,7 @@ namespace das {
         virtual bool accept ( Program * prog, Module * mod, ExprReader * expr, int Ch, const LineInfo & info ) override {
             if ( auto fnAccept = get_accept(classPtr) ) {
                 bool result = false;
-                runMacroFunction(context, "accept", [&]() {
+                runMacroFunction(context, name, "accept", [&]() {
                     result = invoke_accept(context,fnAccept,classPtr,prog,mod,expr,Ch,info);
                 });
                 return result;
@@ -1116,7 +1131,7 @@ namespace das {
         virtual ExpressionPtr visit (  Program * prog, Module * mod, ExprReader * expr ) override {
             if ( auto fnVisit = get_visit(classPtr) ) {
                 ExpressionPtr result;
-                runMacroFunction(context, "visit", [&]() {
+                runMacroFunction(context, name, "visit", [&]() {
                     result = invoke_visit(context,fnVisit,classPtr,prog,mod,expr);
                 });
                 return result;
@@ -1349,7 +1364,7 @@ namespace das {
         }
         virtual void preVisit (  Program * prog, Module * mod, ExprCallMacro * expr ) override {
             if ( auto fnPreVisit = get_preVisit(classPtr) ) {
-                runMacroFunction(context, "preVisit", [&]() {
+                runMacroFunction(context, name, "preVisit", [&]() {
                     invoke_preVisit(context,fnPreVisit,classPtr,prog,mod,expr);
                 });
             }
@@ -1357,7 +1372,7 @@ namespace das {
         virtual ExpressionPtr visit (  Program * prog, Module * mod, ExprCallMacro * expr ) override {
             if ( auto fnVisit = get_visit(classPtr) ) {
                 ExpressionPtr result;
-                runMacroFunction(context, "visit", [&]() {
+                runMacroFunction(context, name, "visit", [&]() {
                     result = invoke_visit(context,fnVisit,classPtr,prog,mod,expr);
                 });
                 return result;
@@ -1368,7 +1383,7 @@ namespace das {
         virtual bool canVisitArguments ( ExprCallMacro * expr ) override {
             if ( auto fnCanVisitArguments = get_canVisitArguments(classPtr) ) {
                 bool result = true;
-                runMacroFunction(context, "canVisitArguments", [&]() {
+                runMacroFunction(context, name, "canVisitArguments", [&]() {
                     result = invoke_canVisitArguments(context,fnCanVisitArguments,classPtr,expr);
                 });
                 return result;
@@ -1395,7 +1410,7 @@ namespace das {
         virtual ExpressionPtr getAstChange ( const ExpressionPtr & expr, string & err ) override {
             if ( auto fnGetAstChange = get_getAstChange(classPtr) ) {
                 ExpressionPtr result;
-                runMacroFunction(context, "getAstChange", [&]() {
+                runMacroFunction(context, name, "getAstChange", [&]() {
                     auto tinfo = static_pointer_cast<ExprTypeInfo>(expr);
                     result = invoke_getAstChange(context,fnGetAstChange,classPtr,tinfo,err);
                 });
@@ -1407,7 +1422,7 @@ namespace das {
         virtual TypeDeclPtr getAstType ( ModuleLibrary & lib, const ExpressionPtr & expr, string & err ) override {
             if ( auto fnGetAstType = get_getAstType(classPtr) ) {
                 TypeDeclPtr result;
-                runMacroFunction(context, "getAstType", [&]() {
+                runMacroFunction(context, name, "getAstType", [&]() {
                     auto tinfo = static_pointer_cast<ExprTypeInfo>(expr);
                     result = invoke_getAstType(context,fnGetAstType,classPtr,lib,tinfo,err);
                 });
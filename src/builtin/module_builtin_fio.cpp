@@ -5,6 +5,7 @@
 #include "daScript/simulate/aot_builtin_fio.h"
 
 #include "daScript/simulate/simulate_nodes.h"
+#include "daScript/simulate/bin_serializer.h"
 #include "daScript/ast/ast_interop.h"
 #include "daScript/ast/ast_policy_types.h"
 #include "daScript/ast/ast_handle.h"
@@ -93,6 +94,7 @@ namespace das {
 #include <libgen.h>
 #include <dirent.h>
 #include <unistd.h>
+#include <fcntl.h>
 #include <sys/mman.h>
 #endif
 
@@ -193,7 +195,8 @@ namespace das {
         struct stat st;
         int fd = fileno((FILE *)f);
         fstat(fd, &st);
-        void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        void* data = st.st_size ? mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0) : nullptr;
+        if ( data==MAP_FAILED ) context->throw_error_at(*at, "can't map file");
         Array arr;
         arr.data = (char *) data;
         arr.capacity = arr.size = uint32_t(st.st_size);
@@ -202,7 +205,7 @@ namespace das {
         vec4f args[1];
         args[0] = cast<Array *>::from(&arr);
         context->invoke(blk, args, nullptr, at);
-        munmap(data, 0);
+        if ( data ) munmap(data, st.st_size);
     }
 
     int64_t builtin_ftell ( const FILE * f, Context * context, LineInfoArg * at ) {
@@ -246,6 +249,88 @@ namespace das {
         if (len) fwrite(str, 1, len, (FILE*)f);
     }
 
+    void builtin_fflush ( const FILE * f, Context * context, LineInfoArg * at ) {
+        if ( !f ) context->throw_error_at(*at, "can't fflush NULL");
+        fflush((FILE *)f);
+    }
+
+    // reads the rest of the file in chunks of up to chunkSize bytes. one buffer is reused for every chunk
+    int64_t builtin_fread_chunks ( const FILE * f, int32_t chunkSize, const TBlock<void,TTemporary<TArray<uint8_t>>> & blk, Context * context, LineInfoArg * at ) {
+        if ( !f ) context->throw_error_at(*at, "can't fread_chunks NULL");
+        if ( chunkSize<=0 ) context->throw_error_at(*at, "fread_chunks chunk size must be positive, got %d", chunkSize);
+        vector<char> buffer(chunkSize);
+        Array arr;
+        arr.data = buffer.data();
+        arr.lock = 1;
+        arr.flags = 0;
+        vec4f args[1];
+        int64_t total = 0;
+        for ( ;; ) {
+            auto bytes = fread(buffer.data(), 1, chunkSize, (FILE *)f);
+            if ( !bytes ) break;
+            arr.capacity = arr.size = uint32_t(bytes);
+            args[0] = cast<Array *>::from(&arr);
+            context->invoke(blk, args, nullptr, at);
+            total += bytes;
+            if ( bytes < size_t(chunkSize) ) break;
+        }
+        return total;
+    }
+
+    // reads the rest of the file line by line. lines are temporary strings, which point into the reused buffer
+    // new line (and \r before it) is not included. buffer grows to fit the longest line
+    int64_t builtin_fread_lines ( const FILE * f, const TBlock<void,TTemporary<const char *>> & blk, Context * context, LineInfoArg * at ) {
+        if ( !f ) context->throw_error_at(*at, "can't fread_lines NULL");
+        vector<char> buffer(65536);
+        size_t head = 0, tail = 0;
+        bool eof = false;
+        int64_t lines = 0;
+        vec4f args[1];
+        while ( !eof ) {
+            if ( head ) {
+                memmove(buffer.data(), buffer.data() + head, tail - head);
+                tail -= head;
+                head = 0;
+            }
+            if ( tail + 1 >= buffer.size() ) {
+                buffer.resize(buffer.size() * 2);
+            }
+            size_t request = buffer.size() - tail - 1;     // one byte is reserved for the terminator of the last line
+            auto bytes = fread(buffer.data() + tail, 1, request, (FILE *)f);
+            eof = bytes < request;
+            tail += bytes;
+            char * data = buffer.data();
+            while ( auto eol = (char *) memchr(data + head, '\n', tail - head) ) {
+                char * end = eol;
+                if ( end > data + head && end[-1]=='\r' ) end --;
+                *end = 0;
+                args[0] = cast<char *>::from(data + head);
+                context->invoke(blk, args, nullptr, at);
+                lines ++;
+                head = eol + 1 - data;
+            }
+            if ( eof && head < tail ) {
+                data[tail] = 0;
+                args[0] = cast<char *>::from(data + head);
+                context->invoke(blk, args, nullptr, at);
+                lines ++;
+            }
+        }
+        return lines;
+    }
+
+    // access pattern hint, so that the kernel can read ahead (or drop pages behind). not all platforms support it
+    bool builtin_fadvise ( const FILE * f, int32_t advice, Context * context, LineInfoArg * at ) {
+        if ( !f ) context->throw_error_at(*at, "can't fadvise NULL");
+#if defined(__linux__)
+        static const int advices[] = { POSIX_FADV_NORMAL, POSIX_FADV_SEQUENTIAL, POSIX_FADV_RANDOM, POSIX_FADV_WILLNEED, POSIX_FADV_DONTNEED };
+        if ( advice<0 || advice>=int32_t(sizeof(advices)/sizeof(advices[0])) ) return false;
+        return posix_fadvise(fileno((FILE *)f), 0, 0, advices[advice])==0;
+#else
+        return false;
+#endif
+    }
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable:4100)
@@ -469,6 +554,12 @@ namespace das {
             addConstant<int32_t>(*this, "seek_set", SEEK_SET);
             addConstant<int32_t>(*this, "seek_cur", SEEK_CUR);
             addConstant<int32_t>(*this, "seek_end", SEEK_END);
+            // fadvise constants
+            addConstant<int32_t>(*this, "fadvise_normal", 0);
+            addConstant<int32_t>(*this, "fadvise_sequential", 1);
+            addConstant<int32_t>(*this, "fadvise_random", 2);
+            addConstant<int32_t>(*this, "fadvise_willneed", 3);
+            addConstant<int32_t>(*this, "fadvise_dontneed", 4);
             // file io
             addExtern<DAS_BIND_FUN(builtin_remove_file)>(*this, lib, "remove",
                 SideEffects::modifyExternal, "builtin_remove_file")
@@ -494,6 +585,18 @@ namespace das {
             addExtern<DAS_BIND_FUN(builtin_fwrite)>(*this, lib, "fwrite",
                 SideEffects::modifyExternal, "builtin_fwrite")
                     ->args({"file","text","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_fflush)>(*this, lib, "fflush",
+                SideEffects::modifyExternal, "builtin_fflush")
+                    ->args({"file","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_fread_chunks)>(*this, lib, "fread_chunks",
+                SideEffects::modifyExternal, "builtin_fread_chunks")
+                    ->args({"file","chunk_size","block","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_fread_lines)>(*this, lib, "fread_lines",
+                SideEffects::modifyExternal, "builtin_fread_lines")
+                    ->args({"file","block","context","line"});
+            addExtern<DAS_BIND_FUN(builtin_fadvise)>(*this, lib, "fadvise",
+                SideEffects::modifyExternal, "builtin_fadvise")
+                    ->args({"file","advice","context","line"});
             addExtern<DAS_BIND_FUN(builtin_feof)>(*this, lib, "feof",
                 SideEffects::modifyExternal, "builtin_feof")
                     ->arg("file");
@@ -513,6 +616,12 @@ namespace das {
             addInterop<builtin_load,void,const FILE*,int32_t,const Block &>(*this, lib, "_builtin_load",
                 das::SideEffects::modifyExternal, "builtin_load")
                     ->args({"file","length","block"});
+            addInterop<_builtin_binary_fsave_versioned,int,const FILE*,const vec4f>(*this, lib, "_builtin_fsave_versioned",
+                SideEffects::modifyExternal, "_builtin_binary_fsave_versioned")
+                    ->args({"file","data"});
+            addInterop<_builtin_binary_fload_versioned,bool,const FILE*,vec4f>(*this, lib, "_builtin_fload_versioned",
+                SideEffects::modifyArgumentAndExternal, "_builtin_binary_fload_versioned")
+                    ->args({"file","data"});
             addExtern<DAS_BIND_FUN(builtin_dirname)>(*this, lib, "dir_name",
                 SideEffects::none, "builtin_dirname")
                     ->args({"name","context","line"});
@@ -2,11 +2,13 @@
 
 #include "daScript/misc/performance_time.h"
 #include "daScript/simulate/aot_builtin_jobque.h"
+#include "daScript/simulate/aot.h"
 #include "daScript/ast/ast.h"
 #include "daScript/ast/ast_handle.h"
 
 MAKE_TYPE_FACTORY(JobStatus, JobStatus)
 MAKE_TYPE_FACTORY(Channel, Channel)
+MAKE_TYPE_FACTORY(LockFreeChannel, LockFreeChannel)
 
 namespace das {
 
@@ -152,6 +154,322 @@ namespace das {
         status = nullptr;
     }
 
+    static atomic<uint64_t> g_lockFreeChannelId{0};
+    static DAS_THREAD_LOCAL uint64_t tl_lastChannelId = 0;
+    static DAS_THREAD_LOCAL Context * tl_lastProducer = nullptr;
+
+    LockFreeChannel::LockFreeChannel ( Context * ctx, int32_t cap, int32_t count, bool spin )
+        : remaining(count), mSpin(spin), owner(ctx) {
+        size_t size = 2;
+        while ( size < size_t(max(cap,2)) ) size <<= 1;
+        mBuffer.reset(new Cell[size]);
+        for ( size_t i=0; i!=size; ++i ) {
+            mBuffer[i].sequence.store(i, memory_order_relaxed);
+            mBuffer[i].data = nullptr;
+        }
+        mMask = size - 1;
+        mId = ++g_lockFreeChannelId;
+    }
+
+    LockFreeChannel::~LockFreeChannel() {
+        DAS_ASSERT(mRef==0);
+        if ( tl_lastChannelId==mId ) tl_lastChannelId = 0;
+    }
+
+    void LockFreeChannel::addProducer ( Context * context ) {
+        if ( !context || context==owner ) return;
+        if ( tl_lastChannelId==mId && tl_lastProducer==context ) return;
+        {
+            lock_guard<mutex> guard(mLock);
+            auto it = find_if(mProducers.begin(), mProducers.end(), [&](const shared_ptr<Context> & pc) {
+                return pc.get()==context;
+            });
+            if ( it==mProducers.end() ) {
+                mProducers.push_back(context->shared_from_this());
+            }
+        }
+        tl_lastChannelId = mId;
+        tl_lastProducer = context;
+    }
+
+    void LockFreeChannel::signal() {
+        if ( mWaiters ) {
+            lock_guard<mutex> guard(mLock);
+            mCond.notify_all();
+        }
+    }
+
+    void LockFreeChannel::waitForSignal ( int & spins ) {
+        if ( mSpin || ++spins < 64 ) {
+            this_thread::yield();
+            return;
+        }
+        spins = 0;
+        unique_lock<mutex> uguard(mLock);
+        mWaiters ++;
+        mCond.wait_for(uguard, chrono::milliseconds(1));
+        mWaiters --;
+    }
+
+    bool LockFreeChannel::tryPush ( void * data, Context * context ) {
+        addProducer(context);
+        size_t pos = mEnqueuePos.load(memory_order_relaxed);
+        Cell * cell;
+        for ( ;; ) {
+            cell = &mBuffer[pos & mMask];
+            size_t seq = cell->sequence.load(memory_order_acquire);
+            intptr_t dif = intptr_t(seq) - intptr_t(pos);
+            if ( dif==0 ) {
+                if ( mEnqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed) ) break;
+            } else if ( dif<0 ) {
+                return false;
+            } else {
+                pos = mEnqueuePos.load(memory_order_relaxed);
+            }
+        }
+        cell->data = data;
+        cell->sequence.store(pos + 1, memory_order_release);
+        signal();
+        return true;
+    }
+
+    void * LockFreeChannel::tryPop () {
+        size_t pos = mDequeuePos.load(memory_order_relaxed);
+        Cell * cell;
+        for ( ;; ) {
+            cell = &mBuffer[pos & mMask];
+            size_t seq = cell->sequence.load(memory_order_acquire);
+            intptr_t dif = intptr_t(seq) - intptr_t(pos + 1);
+            if ( dif==0 ) {
+                if ( mDequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed) ) break;
+            } else if ( dif<0 ) {
+                return nullptr;
+            } else {
+                pos = mDequeuePos.load(memory_order_relaxed);
+            }
+        }
+        void * data = cell->data;
+        cell->sequence.store(pos + mMask + 1, memory_order_release);
+        signal();
+        return data;
+    }
+
+    // claims as many consecutive free cells as available, up to count, with a single CAS
+    int32_t LockFreeChannel::tryPushBatch ( void ** data, int32_t count, Context * context ) {
+        if ( count<=0 ) return 0;
+        addProducer(context);
+        size_t pos = mEnqueuePos.load(memory_order_relaxed);
+        int32_t got;
+        for ( ;; ) {
+            got = 0;
+            while ( got<count && mBuffer[(pos + got) & mMask].sequence.load(memory_order_acquire)==pos + got ) {
+                got ++;
+            }
+            if ( got==0 ) {
+                size_t seq = mBuffer[pos & mMask].sequence.load(memory_order_acquire);
+                if ( intptr_t(seq) - intptr_t(pos) < 0 ) return 0;
+                pos = mEnqueuePos.load(memory_order_relaxed);
+                continue;
+            }
+            if ( mEnqueuePos.compare_exchange_weak(pos, pos + got, memory_order_relaxed) ) break;
+        }
+        for ( int32_t i=0; i!=got; ++i ) {
+            Cell & cell = mBuffer[(pos + i) & mMask];
+            cell.data = data[i];
+            cell.sequence.store(pos + i + 1, memory_order_release);
+        }
+        signal();
+        return got;
+    }
+
+    int32_t LockFreeChannel::tryPopBatch ( void ** data, int32_t count ) {
+        if ( count<=0 ) return 0;
+        size_t pos = mDequeuePos.load(memory_order_relaxed);
+        int32_t got;
+        for ( ;; ) {
+            got = 0;
+            while ( got<count && mBuffer[(pos + got) & mMask].sequence.load(memory_order_acquire)==pos + got + 1 ) {
+                got ++;
+            }
+            if ( got==0 ) {
+                size_t seq = mBuffer[pos & mMask].sequence.load(memory_order_acquire);
+                if ( intptr_t(seq) - intptr_t(pos + 1) < 0 ) return 0;
+                pos = mDequeuePos.load(memory_order_relaxed);
+                continue;
+            }
+            if ( mDequeuePos.compare_exchange_weak(pos, pos + got, memory_order_relaxed) ) break;
+        }
+        for ( int32_t i=0; i!=got; ++i ) {
+            Cell & cell = mBuffer[(pos + i) & mMask];
+            data[i] = cell.data;
+            cell.sequence.store(pos + i + mMask + 1, memory_order_release);
+        }
+        signal();
+        return got;
+    }
+
+    void LockFreeChannel::push ( void * data, Context * context ) {
+        int spins = 0;
+        while ( !tryPush(data, context) ) {
+            waitForSignal(spins);
+        }
+    }
+
+    void LockFreeChannel::pushBatch ( void ** data, int32_t count, Context * context ) {
+        int spins = 0;
+        while ( count ) {
+            int32_t got = tryPushBatch(data, count, context);
+            if ( got ) {
+                data += got;
+                count -= got;
+            } else {
+                waitForSignal(spins);
+            }
+        }
+    }
+
+    void * LockFreeChannel::pop () {
+        int spins = 0;
+        for ( ;; ) {
+            if ( void * data = tryPop() ) return data;
+            if ( remaining==0 ) return tryPop();    // everything pushed before the last notify is visible by now
+            waitForSignal(spins);
+        }
+    }
+
+    int32_t LockFreeChannel::popBatch ( void ** data, int32_t count ) {
+        int spins = 0;
+        for ( ;; ) {
+            if ( int32_t got = tryPopBatch(data, count) ) return got;
+            if ( remaining==0 ) return tryPopBatch(data, count);
+            waitForSignal(spins);
+        }
+    }
+
+    bool LockFreeChannel::isEmpty() const {
+        return mEnqueuePos.load(memory_order_acquire)==mDequeuePos.load(memory_order_acquire);
+    }
+
+    void LockFreeChannel::notify() {
+        DAS_ASSERTF(remaining != 0, "Nothing to notify!");
+        if ( --remaining==0 ) {
+            lock_guard<mutex> guard(mLock);
+            mCond.notify_all();
+        }
+    }
+
+    void LockFreeChannel::notifyAndRelease() {
+        mRef--;
+        notify();
+    }
+
+    void LockFreeChannel::wait() {
+        int spins = 0;
+        while ( remaining ) {
+            waitForSignal(spins);
+        }
+    }
+
+    void withLockFreeChannel ( int32_t capacity, int32_t count, bool spin, const TBlock<void,LockFreeChannel *> & blk, Context * context, LineInfoArg * at ) {
+        if ( capacity<=0 ) context->throw_error_at(*at, "with_lock_free_channel: capacity must be positive");
+        LockFreeChannel ch(context, capacity, count, spin);
+        ch.addRef();
+        das_invoke<void>::invoke<LockFreeChannel *>(context, at, blk, &ch);
+        if ( ch.releaseRef() ) {
+            context->throw_error_at(*at, "channel beeing deleted while being used");
+        }
+    }
+
+    bool lockFreeChannelTryPush ( LockFreeChannel * ch, void * data, Context * context, LineInfoArg * at ) {
+        if ( !ch ) context->throw_error_at(*at, "lockFreeChannelTryPush: channel is null");
+        return ch->tryPush(data, context);
+    }
+
+    void * lockFreeChannelTryPop ( LockFreeChannel * ch, Context * context, LineInfoArg * at ) {
+        if ( !ch ) context->throw_error_at(*at, "lockFreeChannelTryPop: channel is null");
+        return ch->tryPop();
+    }
+
+    void lockFreeChannelPush ( LockFreeChannel * ch, void * data, Context * context, LineInfoArg * at ) {
+        if ( !ch ) context->throw_error_at(*at, "lockFreeChannelPush: channel is null");
+        ch->push(data, context);
+    }
+
+    void * lockFreeChannelPop ( LockFreeChannel * ch, Context * context, LineInfoArg * at ) {
+        if ( !ch ) context->throw_error_at(*at, "lockFreeChannelPop: channel is null");
+        return ch->pop();
+    }
+
+    int32_t lockFreeChannelTryPushBatch ( LockFreeChannel * ch, const TArray<void *> & data, Context * context, LineInfoArg * at ) {
+        if ( !ch ) context->throw_error_at(*at, "lockFreeChannelTryPushBatch: channel is null");
+        return ch->tryPushBatch((void **)data.data, int32_t(data.size), context);
+    }
+
+    void lockFreeChannelPushBatch ( LockFreeChannel * ch, const TArray<void *> & data, Context * context, LineInfoArg * at ) {
+        if ( !ch ) context->throw_error_at(*at, "lockFreeChannelPushBatch: channel is null");
+        ch->pushBatch((void **)data.data, int32_t(data.size), context);
+    }
+
+    int32_t lockFreeChannelTryPopBatch ( LockFreeChannel * ch, TArray<void *> & data, int32_t count, Context * context, LineInfoArg * at ) {
+        if ( !ch ) context->throw_error_at(*at, "lockFreeChannelTryPopBatch: channel is null");
+        if ( data.lock ) context->throw_error_at(*at, "lockFreeChannelTryPopBatch: array is locked");
+        builtin_array_resize(data, count, sizeof(void *), context);
+        int32_t got = ch->tryPopBatch((void **)data.data, count);
+        builtin_array_resize(data, got, sizeof(void *), context);
+        return got;
+    }
+
+    int32_t lockFreeChannelPopBatch ( LockFreeChannel * ch, TArray<void *> & data, int32_t count, Context * context, LineInfoArg * at ) {
+        if ( !ch ) context->throw_error_at(*at, "lockFreeChannelPopBatch: channel is null");
+        if ( data.lock ) context->throw_error_at(*at, "lockFreeChannelPopBatch: array is locked");
+        builtin_array_resize(data, count, sizeof(void *), context);
+        int32_t got = ch->popBatch((void **)data.data, count);
+        builtin_array_resize(data, got, sizeof(void *), context);
+        return got;
+    }
+
+    int lockFreeChannelAppend ( LockFreeChannel * ch, int size, Context * context, LineInfoArg * at ) {
+        if ( !ch ) context->throw_error_at(*at, "lockFreeChannelAppend: channel is null");
+        return ch->append(size);
+    }
+
+    void lockFreeChannelAddRef ( LockFreeChannel * ch, Context * context, LineInfoArg * at ) {
+        if ( !ch ) context->throw_error_at(*at, "lockFreeChannelAddRef: channel is null");
+        ch->addRef();
+    }
+
+    void lockFreeChannelReleaseRef ( LockFreeChannel * & ch, Context * context, LineInfoArg * at ) {
+        if ( !ch ) context->throw_error_at(*at, "lockFreeChannelReleaseRef: channel is null");
+        ch->releaseRef();
+        ch = nullptr;
+    }
+
+    void waitForLockFreeChannel ( LockFreeChannel * ch, Context * context, LineInfoArg * at ) {
+        if ( !ch ) context->throw_error_at(*at, "waitForLockFreeChannel: channel is null");
+        ch->wait();
+    }
+
+    void notifyLockFreeChannel ( LockFreeChannel * ch, Context * context, LineInfoArg * at ) {
+        if ( !ch ) context->throw_error_at(*at, "notifyLockFreeChannel: channel is null");
+        ch->notify();
+    }
+
+    void notifyAndReleaseLockFreeChannel ( LockFreeChannel * & ch, Context * context, LineInfoArg * at ) {
+        if ( !ch ) context->throw_error_at(*at, "notifyAndReleaseLockFreeChannel: channel is null");
+        ch->notifyAndRelease();
+        ch = nullptr;
+    }
+
+    struct LockFreeChannelAnnotation : ManagedStructureAnnotation<LockFreeChannel,false> {
+        LockFreeChannelAnnotation(ModuleLibrary & ml) : ManagedStructureAnnotation ("LockFreeChannel", ml) {
+            addProperty<DAS_BIND_MANAGED_PROP(isEmpty)>("isEmpty");
+            addProperty<DAS_BIND_MANAGED_PROP(isReady)>("isReady");
+            addProperty<DAS_BIND_MANAGED_PROP(isSpinning)>("isSpinning");
+            addProperty<DAS_BIND_MANAGED_PROP(size)>("size");
+            addProperty<DAS_BIND_MANAGED_PROP(capacity)>("capacity");
+        }
+    };
+
     struct ChannelAnnotation : ManagedStructureAnnotation<Channel,false> {
         ChannelAnnotation(ModuleLibrary & ml) : ManagedStructureAnnotation ("Channel", ml) {
             addProperty<DAS_BIND_MANAGED_PROP(isEmpty)>("isEmpty");
@@ -175,10 +493,101 @@ das::Context* get_clone_context( das::Context * ctx, uint32_t category );//link
 
 namespace das {
 
+    // job contexts are pooled per code (all clones of the same program share it)
+    // clone is reset once its job is done, and handed to the next job of the same program
+    // snapshot clones (options clone_snapshot) are reset when handed out instead, since they copy the current globals of the parent
+    struct JobContextPool {
+        mutex                                               lock;
+        das_hash_map<NodeAllocator *,vector<Context *>>     free;
+        atomic<int32_t>                                     capacity{64};   // per program
+        atomic<bool>                                        open{false};
+        atomic<uint64_t>                                    hits{0};
+        atomic<uint64_t>                                    misses{0};
+        atomic<int64_t>                                     cloneTicks{0};  // spent cloning, on misses
+        atomic<int64_t>                                     resetTicks{0};  // spent resetting, instead of cloning
+        shared_ptr<Context> acquire ( Context * context ) {
+            Context * ctx = nullptr;
+            if ( open ) {
+                lock_guard<mutex> guard(lock);
+                auto it = free.find(context->code.get());
+                if ( it!=free.end() && !it->second.empty() ) {
+                    ctx = it->second.back();
+                    it->second.pop_back();
+                }
+            }
+            if ( ctx ) {
+                hits ++;
+                if ( ctx->cloneSnapshot ) {
+                    auto t0 = ref_time_ticks();
+                    ctx->resetClone(context);
+                    resetTicks += ref_time_ticks() - t0;
+                }
+            } else {
+                misses ++;
+                auto t0 = ref_time_ticks();
+                ctx = get_clone_context(context, uint32_t(ContextCategory::job_clone));
+                cloneTicks += ref_time_ticks() - t0;
+            }
+            return shared_ptr<Context>(ctx, [this](Context * ctx) { release(ctx); });
+        }
+        void release ( Context * ctx ) {
+            if ( open && ctx->insideContext==0 && capacity>0 ) {
+                if ( !ctx->cloneSnapshot ) {
+                    auto t0 = ref_time_ticks();
+                    ctx->resetClone();
+                    resetTicks += ref_time_ticks() - t0;
+                }
+                lock_guard<mutex> guard(lock);
+                auto & bucket = free[ctx->code.get()];
+                if ( open && int32_t(bucket.size())<capacity ) {
+                    bucket.push_back(ctx);
+                    return;
+                }
+            }
+            delete ctx;
+        }
+        void setOpen ( bool o ) {
+            das_hash_map<NodeAllocator *,vector<Context *>> toDelete;
+            {
+                lock_guard<mutex> guard(lock);
+                open = o;
+                if ( !open ) swap(toDelete, free);
+            }
+            for ( auto & it : toDelete ) {
+                for ( auto ctx : it.second ) {
+                    delete ctx;
+                }
+            }
+        }
+        int64_t savedUsec() const {
+            uint64_t h = hits, m = misses;
+            if ( !m ) return 0;
+            int64_t saved = int64_t(double(cloneTicks) * double(h) / double(m)) - resetTicks;
+            return saved>0 ? get_time_usec(ref_time_ticks() - saved) : -get_time_usec(ref_time_ticks() + saved);
+        }
+    };
+
+    JobContextPool g_jobContextPool;
+
+    uint64_t getJobContextPoolHits() {
+        return g_jobContextPool.hits;
+    }
+
+    uint64_t getJobContextPoolMisses() {
+        return g_jobContextPool.misses;
+    }
+
+    int64_t getJobContextPoolSavedUsec() {
+        return g_jobContextPool.savedUsec();
+    }
+
+    void setJobContextPoolCapacity ( int32_t capacity ) {
+        g_jobContextPool.capacity = capacity;
+    }
+
     void new_job_invoke ( Lambda lambda, Func fn, int32_t lambdaSize, Context * context, LineInfoArg * lineinfo ) {
         if ( !g_jobQue ) context->throw_error_at(*lineinfo, "need to be in 'with_job_que' block");
-        shared_ptr<Context> forkContext;
-        forkContext.reset(get_clone_context(context, uint32_t(ContextCategory::job_clone)));
+        shared_ptr<Context> forkContext = g_jobContextPool.acquire(context);
         auto ptr = forkContext->heap->allocate(lambdaSize + 16);
         forkContext->heap->mark_comment(ptr, "new [[ ]] in new_job");
         memset ( ptr, 0, lambdaSize + 16 );
@@ -194,6 +603,117 @@ namespace das {
         }, 0, JobPriority::Default);
     }
 
+    // parallel_for workers are forked once per program and reused across calls
+    // worker shares code and globals with the caller, has private heap, and runs on a copy of the caller's stack
+    struct ParallelForWorkers {
+        mutex                                               lock;
+        das_hash_map<NodeAllocator *,vector<Context *>>     free;
+        atomic<bool>                                        open{false};
+        Context * acquire ( Context * context ) {
+            Context * ctx = nullptr;
+            if ( open ) {
+                lock_guard<mutex> guard(lock);
+                auto it = free.find(context->code.get());
+                if ( it!=free.end() && !it->second.empty() ) {
+                    ctx = it->second.back();
+                    it->second.pop_back();
+                }
+            }
+            if ( ctx && ctx->stack.size()!=context->stack.size() ) {
+                delete ctx;
+                ctx = nullptr;
+            }
+            if ( !ctx ) {
+                ctx = new Context(context->stack.size());
+                ctx->name = "parallel_for worker of " + context->name;
+            }
+            ctx->makeWorkerFor(*context);
+            return ctx;
+        }
+        void release ( Context * ctx ) {
+            if ( open ) {
+                ctx->restart();
+                ctx->restartHeaps();
+                lock_guard<mutex> guard(lock);
+                if ( open ) {
+                    free[ctx->code.get()].push_back(ctx);
+                    return;
+                }
+            }
+            delete ctx;
+        }
+        void setOpen ( bool o ) {
+            das_hash_map<NodeAllocator *,vector<Context *>> toDelete;
+            {
+                lock_guard<mutex> guard(lock);
+                open = o;
+                if ( !open ) swap(toDelete, free);
+            }
+            for ( auto & it : toDelete ) {
+                for ( auto ctx : it.second ) {
+                    delete ctx;
+                }
+            }
+        }
+    };
+
+    ParallelForWorkers g_parallelForWorkers;
+
+    static DAS_THREAD_LOCAL bool tl_insideParallelFor = false;
+
+    void parallelFor ( int32_t from, int32_t to, int32_t chunk, const TBlock<void,int32_t,int32_t> & blk, Context * context, LineInfoArg * at ) {
+        if ( !g_jobQue ) context->throw_error_at(*at, "need to be in 'with_job_que' block");
+        if ( chunk<=0 ) context->throw_error_at(*at, "parallel_for: chunk size must be positive, got %i", chunk);
+        if ( from>=to ) return;
+        int32_t numChunks = int32_t((int64_t(to) - int64_t(from) + chunk - 1) / chunk);
+        auto runChunks = [&]( Context * ctx, int32_t c0, int32_t c1 ) {
+            for ( int32_t c=c0; c!=c1; ++c ) {
+                int32_t i0 = int32_t(int64_t(from) + int64_t(c) * chunk);
+                int32_t i1 = int32_t(min(int64_t(i0) + chunk, int64_t(to)));
+                das_invoke<void>::invoke<int32_t,int32_t>(ctx, at, blk, i0, i1);
+            }
+        };
+        // aot blocks are bound to the caller's context, and nested parallel_for would wait on the job threads
+        if ( numChunks==1 || blk.aotFunction || tl_insideParallelFor ) {
+            runChunks(context, 0, numChunks);
+            return;
+        }
+        // block reads captured locals at the same stack offsets, so workers get a copy of the caller's active stack
+        // it has to be taken before the caller starts running its own chunks
+        uint32_t stackUsed = uint32_t(context->stack.top() - context->stack.ap());
+        vector<char> stackCopy(context->stack.ap(), context->stack.top());
+        auto callerThread = this_thread::get_id();
+        auto bound = daScriptEnvironment::bound;
+        mutex errorLock;
+        string error;
+        auto onError = [&]( Context * ctx ) {
+            lock_guard<mutex> guard(errorLock);
+            if ( error.empty() ) {
+                auto ex = ctx->getException();
+                error = ex ? ex : "unknown exception";
+            }
+        };
+        g_jobQue->parallel_for(0, numChunks, [&](int c0, int c1) {
+            tl_insideParallelFor = true;
+            if ( this_thread::get_id()==callerThread ) {
+                if ( !context->runWithCatch([&](){ runChunks(context, c0, c1); }) ) onError(context);
+            } else {
+                daScriptEnvironment::bound = bound;
+                Context * worker = g_parallelForWorkers.acquire(context);
+                char * EP, * SP;
+                worker->stack.push(stackUsed, EP, SP);      // same stack size, same offsets
+                memcpy(worker->stack.ap(), stackCopy.data(), stackUsed);
+                if ( !worker->runWithCatch([&](){ runChunks(worker, c0, c1); }) ) onError(worker);
+                worker->stack.pop(EP, SP);
+                g_parallelForWorkers.release(worker);
+            }
+            tl_insideParallelFor = false;
+        }, 0, JobPriority::Default, numChunks);
+        if ( !error.empty() ) {
+            context->throw_error_at(*at, "parallel_for: %s", error.c_str());
+        }
+    }
+
     static atomic<int32_t> g_jobQueAvailable{0};
     static atomic<int32_t> g_jobQueTotalThreads{0};
 
@@ -225,6 +745,8 @@ namespace das {
         if ( !g_jobQue ) {
             lock_guard<mutex> guard(g_jobQueMutex);
             g_jobQue = make_shared<JobQue>();
+            g_jobContextPool.setOpen(true);
+            g_parallelForWorkers.setOpen(true);
         }
         {
             shared_ptr<JobQue> jq = g_jobQue;
@@ -232,7 +754,11 @@ namespace das {
         }
         {
             lock_guard<mutex> guard(g_jobQueMutex);
-            if ( g_jobQue.use_count()==1 ) g_jobQue.reset();
+            if ( g_jobQue.use_count()==1 ) {
+                g_jobQue.reset();
+                g_jobContextPool.setOpen(false);
+                g_parallelForWorkers.setOpen(false);
+            }
         }
     }
 
@@ -274,6 +800,11 @@ namespace das {
         status = nullptr;
     }
 
+    void heapCollectParallel ( bool sheap, bool validate, Context * context, LineInfoArg * at ) {
+        if ( !g_jobQue ) context->throw_error_at(*at, "need to be in 'with_job_que' block");
+        context->collectHeap(at, sheap, validate, g_jobQue.get());
+    }
+
     int getTotalHwJobs( Context * context, LineInfoArg * at ) {
         if ( !g_jobQue ) context->throw_error_at(*at, "need to be in 'with_job_que' block");
         return g_jobQue->getTotalHwJobs();
@@ -324,6 +855,53 @@ namespace das {
             addExtern<DAS_BIND_FUN(notifyAndReleaseChannel)>(*this, lib,  "notify_and_release",
                 SideEffects::modifyExternal, "notifyAndReleaseChannel")
                     ->args({"channel","context","line"});
+            // lock-free channel
+            addAnnotation(make_smart<LockFreeChannelAnnotation>(lib));
+            addExtern<DAS_BIND_FUN(withLockFreeChannel)>(*this, lib,  "with_lock_free_channel",
+                SideEffects::invoke, "withLockFreeChannel")
+                    ->args({"capacity","count","spin","block","context","line"});
+            addExtern<DAS_BIND_FUN(lockFreeChannelTryPush)>(*this, lib,  "_builtin_lock_free_channel_try_push",
+                SideEffects::modifyArgumentAndExternal, "lockFreeChannelTryPush")
+                    ->args({"channel","data","context","line"});
+            addExtern<DAS_BIND_FUN(lockFreeChannelTryPop)>(*this, lib,  "_builtin_lock_free_channel_try_pop",
+                SideEffects::modifyArgumentAndExternal, "lockFreeChannelTryPop")
+                    ->args({"channel","context","line"});
+            addExtern<DAS_BIND_FUN(lockFreeChannelPush)>(*this, lib,  "_builtin_lock_free_channel_push",
+                SideEffects::modifyArgumentAndExternal, "lockFreeChannelPush")
+                    ->args({"channel","data","context","line"});
+            addExtern<DAS_BIND_FUN(lockFreeChannelPop)>(*this, lib,  "_builtin_lock_free_channel_pop",
+                SideEffects::modifyArgumentAndExternal, "lockFreeChannelPop")
+                    ->args({"channel","context","line"});
+            addExtern<DAS_BIND_FUN(lockFreeChannelTryPushBatch)>(*this, lib,  "_builtin_lock_free_channel_try_push_batch",
+                SideEffects::modifyArgumentAndExternal, "lockFreeChannelTryPushBatch")
+                    ->args({"channel","data","context","line"});
+            addExtern<DAS_BIND_FUN(lockFreeChannelPushBatch)>(*this, lib,  "_builtin_lock_free_channel_push_batch",
+                SideEffects::modifyArgumentAndExternal, "lockFreeChannelPushBatch")
+                    ->args({"channel","data","context","line"});
+            addExtern<DAS_BIND_FUN(lockFreeChannelTryPopBatch)>(*this, lib,  "_builtin_lock_free_channel_try_pop_batch",
+                SideEffects::modifyArgumentAndExternal, "lockFreeChannelTryPopBatch")
+                    ->args({"channel","data","count","context","line"});
+            addExtern<DAS_BIND_FUN(lockFreeChannelPopBatch)>(*this, lib,  "_builtin_lock_free_channel_pop_batch",
+                SideEffects::modifyArgumentAndExternal, "lockFreeChannelPopBatch")
+                    ->args({"channel","data","count","context","line"});
+            addExtern<DAS_BIND_FUN(lockFreeChannelAppend)>(*this, lib, "append",
+                SideEffects::modifyArgument, "lockFreeChannelAppend")
+                    ->args({"channel","size","context","line"});
+            addExtern<DAS_BIND_FUN(lockFreeChannelAddRef)>(*this, lib,  "add_ref",
+                SideEffects::modifyArgumentAndAccessExternal, "lockFreeChannelAddRef")
+                    ->args({"channel","context","line"});
+            addExtern<DAS_BIND_FUN(lockFreeChannelReleaseRef)>(*this, lib,  "release",
+                SideEffects::modifyArgumentAndAccessExternal, "lockFreeChannelReleaseRef")
+                    ->args({"channel","context","line"});
+            addExtern<DAS_BIND_FUN(waitForLockFreeChannel)>(*this, lib,  "join",
+                SideEffects::modifyExternal, "waitForLockFreeChannel")
+                    ->args({"channel","context","line"});
+            addExtern<DAS_BIND_FUN(notifyLockFreeChannel)>(*this, lib,  "notify",
+                SideEffects::modifyExternal, "notifyLockFreeChannel")
+                    ->args({"channel","context","line"});
+            addExtern<DAS_BIND_FUN(notifyAndReleaseLockFreeChannel)>(*this, lib,  "notify_and_release",
+                SideEffects::modifyExternal, "notifyAndReleaseLockFreeChannel")
+                    ->args({"channel","context","line"});
             // job
             addAnnotation(make_smart<JobStatusAnnotation>(lib));
             addExtern<DAS_BIND_FUN(withJobStatus)>(*this, lib,  "with_job_status",
@@ -348,9 +926,18 @@ namespace das {
             addExtern<DAS_BIND_FUN(new_job_invoke)>(*this, lib,  "new_job_invoke",
                 SideEffects::modifyExternal, "new_job_invoke")
                     ->args({"lambda","function","lambdaSize","context","line"});
+            addExtern<DAS_BIND_FUN(parallelFor)>(*this, lib,  "parallel_for",
+                SideEffects::modifyExternal, "parallelFor")
+                    ->args({"from","to","chunk","block","context","line"});
             addExtern<DAS_BIND_FUN(withJobQue)>(*this, lib,  "with_job_que",
                 SideEffects::modifyExternal, "withJobQue")
                     ->args({"block","context","line"});
+            auto hcol = addExtern<DAS_BIND_FUN(heapCollectParallel)>(*this, lib,  "heap_collect_parallel",
+                SideEffects::modifyExternal, "heapCollectParallel")
+                    ->args({"string_heap","validate","context","line"});
+            hcol->unsafeOperation = true;
+            hcol->arguments[0]->init = make_smart<ExprConstBool>(true);
+            hcol->arguments[1]->init = make_smart<ExprConstBool>(false);
             addExtern<DAS_BIND_FUN(getTotalHwJobs)>(*this, lib,  "get_total_hw_jobs",
                 SideEffects::accessExternal, "getTotalHwJobs")
                     ->args({"context","line"});
@@ -359,6 +946,15 @@ namespace das {
             addExtern<DAS_BIND_FUN(new_thread_invoke)>(*this, lib,  "new_thread_invoke",
                 SideEffects::modifyExternal, "new_thread_invoke")
                     ->args({"lambda","function","lambdaSize","context","line"});
+            addExtern<DAS_BIND_FUN(getJobContextPoolHits)>(*this, lib,  "get_job_context_pool_hits",
+                SideEffects::accessExternal, "getJobContextPoolHits");
+            addExtern<DAS_BIND_FUN(getJobContextPoolMisses)>(*this, lib,  "get_job_context_pool_misses",
+                SideEffects::accessExternal, "getJobContextPoolMisses");
+            addExtern<DAS_BIND_FUN(getJobContextPoolSavedUsec)>(*this, lib,  "get_job_context_pool_saved_usec",
+                SideEffects::accessExternal, "getJobContextPoolSavedUsec");
+            addExtern<DAS_BIND_FUN(setJobContextPoolCapacity)>(*this, lib,  "set_job_context_pool_capacity",
+                SideEffects::modifyExternal, "setJobContextPoolCapacity")
+                    ->args({"capacity"});
             addExtern<DAS_BIND_FUN(is_job_que_shutting_down)>(*this, lib,  "is_job_que_shutting_down",
                 SideEffects::modifyExternal, "is_job_que_shutting_down");
         }
@@ -374,6 +970,8 @@ namespace das {
                 }
                 lock_guard<mutex> guard(g_jobQueMutex);
                 g_jobQue.reset();
+                g_jobContextPool.setOpen(false);
+                g_parallelForWorkers.setOpen(false);
             }
         }
     protected:
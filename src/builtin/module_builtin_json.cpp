@@ -0,0 +1,656 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_interop.h"
+#include "daScript/ast/ast_handle.h"
+#include "daScript/simulate/aot_builtin_json.h"
+#include "daScript/simulate/runtime_table.h"
+#include "daScript/simulate/hash.h"
+#include "daScript/misc/json.h"
+#include "module_builtin_rtti.h"
+
+namespace das {
+
+    // daslib/json JsonValue is decoded and encoded as the dynamic json tree, and not as the structure
+    static bool isJsonValue ( const StructInfo * si ) {
+        return si && si->module_name && strcmp(si->name,"JsonValue")==0 && strcmp(si->module_name,"json")==0;
+    }
+
+    static bool isJsonValuePtr ( const TypeInfo * ti ) {
+        return ti->type==Type::tPointer && ti->dimSize==0 && ti->firstType
+            && ti->firstType->type==Type::tStructure && ti->firstType->dimSize==0 && isJsonValue(ti->firstType->structType);
+    }
+
+    static uint32_t variantDataOffset ( const TypeInfo * ti ) {
+        uint32_t fa = uint32_t(getTypeAlign((TypeInfo *)ti)) - 1;
+        return (uint32_t(getTypeBaseSize(Type::tInt)) + fa) & ~fa;
+    }
+
+    static string tupleFieldName ( const TypeInfo * ti, uint32_t index ) {
+        return ti->argNames ? string(ti->argNames[index]) : "_" + to_string(index);
+    }
+
+    static TypeInfo dimElementType ( const TypeInfo * ti, vector<uint32_t> & udim ) {
+        TypeInfo copyInfo = *ti;
+        copyInfo.size = ti->dim[0] ? copyInfo.size / ti->dim[0] : copyInfo.size;
+        copyInfo.dimSize --;
+        udim.assign(ti->dim + 1, ti->dim + ti->dimSize);
+        copyInfo.dim = copyInfo.dimSize ? udim.data() : nullptr;
+        return copyInfo;
+    }
+
+    // json document is decoded straight into the data, as described by its type info
+    // missing object fields keep their values, unknown ones are skipped. arrays and tables are replaced
+    // new elements of arrays, tables and pointers start zeroed, struct initializers are not called (same as resize)
+    // on error, path to the value is collected on the way back from the recursion
+    struct JsonDecoder {
+        JsonDecoder ( const JsonDocument & d, Context * ctx ) : doc(d), context(ctx) {}
+        const JsonDocument &    doc;
+        Context *               context;
+        string                  message;
+        string                  path;
+        uint32_t                errorNode = 0;
+        bool fail ( uint32_t ni, const string & msg ) {
+            message = msg;
+            errorNode = ni;
+            return false;
+        }
+        bool mismatch ( uint32_t ni, const char * expecting ) {
+            return fail(ni, string("expecting ") + expecting + ", got " + JsonDocument::typeName(doc[ni].type));
+        }
+        bool failedAt ( const string & segment ) {
+            path = segment + path;
+            return false;
+        }
+        string getError() const {
+            string res = doc.describe(errorNode) + ": ";
+            if ( !path.empty() ) res += (path[0]=='.' ? path.substr(1) : path) + ": ";
+            return res + message;
+        }
+        char * allocateString ( const JsonNode & node ) {
+            return node.count ? context->stringHeap->allocateString(node.str, node.count) : nullptr;
+        }
+        char * allocate ( uint32_t size ) {
+            char * ptr = (char *) context->heap->allocate(size);
+            if ( !ptr ) context->throw_error("json: out of heap");
+            context->heap->mark_comment(ptr, "json");
+            memset(ptr, 0, size);
+            return ptr;
+        }
+        template <typename TT>
+        bool decodeInteger ( uint32_t ni, char * data ) {
+            auto & node = doc[ni];
+            if ( node.type==JsonType::string && sizeof(TT)==8 ) {   // json_boost writes large 64-bit integers as strings
+                char * end = nullptr;
+                *(TT *)data = is_signed<TT>::value ? TT(strtoll(node.str, &end, 10)) : TT(strtoull(node.str, &end, 10));
+                return end && *end==0 && node.count ? true : fail(ni, "expecting integer");
+            }
+            if ( node.type!=JsonType::number ) return mismatch(ni, "number");
+            if ( node.isInteger ) {
+                if ( node.integer<int64_t(numeric_limits<TT>::min()) || (node.integer>0 && uint64_t(node.integer)>uint64_t(numeric_limits<TT>::max())) ) {
+                    return fail(ni, "integer is out of range");
+                }
+                *(TT *)data = TT(node.integer);
+            } else {
+                *(TT *)data = TT(node.number);
+            }
+            return true;
+        }
+        template <typename TT>
+        bool decodeReal ( uint32_t ni, char * data ) {
+            auto & node = doc[ni];
+            if ( node.type!=JsonType::number ) return mismatch(ni, "number");
+            *(TT *)data = TT(node.number);
+            return true;
+        }
+        // {"x":1,"y":2} as json_boost writes them, or [1,2]
+        template <typename TT>
+        bool decodeVector ( uint32_t ni, char * data, uint32_t count ) {
+            static const char * names[4] = { "x", "y", "z", "w" };
+            auto & node = doc[ni];
+            TT * comp = (TT *) data;
+            if ( node.type==JsonType::array ) {
+                if ( node.count!=count ) return fail(ni, "expecting " + to_string(count) + " components");
+                uint32_t i = 0;
+                for ( uint32_t ci=ni+1; ci!=node.next; ci=doc[ci].next, ++i ) {
+                    if ( !decodeVectorComponent(ci, comp[i]) ) return failedAt("[" + to_string(i) + "]");
+                }
+                return true;
+            } else if ( node.type==JsonType::object ) {
+                for ( uint32_t ki=ni+1; ki!=node.next; ki=doc[ki+1].next ) {
+                    auto & key = doc[ki];
+                    for ( uint32_t i=0; i!=count; ++i ) {
+                        if ( key.count==1 && key.str[0]==names[i][0] ) {
+                            if ( !decodeVectorComponent(ki+1, comp[i]) ) return failedAt(string(".") + names[i]);
+                            break;
+                        }
+                    }
+                }
+                return true;
+            }
+            return mismatch(ni, "object or array");
+        }
+        template <typename TT>
+        bool decodeVectorComponent ( uint32_t ni, TT & value ) {
+            auto & node = doc[ni];
+            if ( node.type!=JsonType::number ) return mismatch(ni, "number");
+            value = node.isInteger ? TT(node.integer) : TT(node.number);
+            return true;
+        }
+        bool decodeEnum ( uint32_t ni, char * data, TypeInfo * ti ) {
+            auto & node = doc[ni];
+            int64_t value = 0;
+            if ( node.type==JsonType::string ) {
+                auto ei = ti->enumType;
+                bool found = false;
+                for ( uint32_t i=0; i!=ei->count; ++i ) {
+                    if ( strcmp(ei->fields[i]->name, node.str)==0 ) {
+                        value = ei->fields[i]->value;
+                        found = true;
+                        break;
+                    }
+                }
+                if ( !found ) return fail(ni, string("not a valid ") + ei->name + " value '" + node.str + "'");
+            } else if ( node.type==JsonType::number ) {
+                value = node.isInteger ? node.integer : int64_t(node.number);
+            } else {
+                return mismatch(ni, "string or number");
+            }
+            switch ( ti->type ) {
+                case Type::tEnumeration8:   *(int8_t *)data = int8_t(value); break;
+                case Type::tEnumeration16:  *(int16_t *)data = int16_t(value); break;
+                default:                    *(int32_t *)data = int32_t(value); break;
+            }
+            return true;
+        }
+        bool decodeStruct ( uint32_t ni, char * data, StructInfo * si ) {
+            if ( isJsonValue(si) ) return decodeJsonValue(ni, data, si);
+            auto & node = doc[ni];
+            if ( node.type!=JsonType::object ) return mismatch(ni, "object");
+            // fields usually come in the declaration order, so the search starts after the last one found
+            uint32_t hint = 0;
+            for ( uint32_t ki=ni+1; ki!=node.next; ki=doc[ki+1].next ) {
+                auto & key = doc[ki];
+                for ( uint32_t j=0; j!=si->count; ++j ) {
+                    uint32_t fi = (hint + j) % si->count;
+                    VarInfo * field = si->fields[fi];
+                    if ( strncmp(field->name, key.str, key.count)==0 && field->name[key.count]==0 ) {
+                        if ( !decode(ki+1, data + field->offset, field) ) return failedAt(string(".") + field->name);
+                        hint = fi + 1;
+                        break;
+                    }
+                }
+            }
+            return true;
+        }
+        // array of values, or object with _0, _1... (or named) fields as json_boost writes them
+        bool decodeTuple ( uint32_t ni, char * data, TypeInfo * ti ) {
+            auto & node = doc[ni];
+            vector<uint32_t> offsets(ti->argCount);
+            uint32_t fieldOffset = 0;
+            for ( uint32_t i=0; i!=ti->argCount; ++i ) {
+                uint32_t fa = uint32_t(getTypeAlign(ti->argTypes[i])) - 1;
+                fieldOffset = (fieldOffset + fa) & ~fa;
+                offsets[i] = fieldOffset;
+                fieldOffset += ti->argTypes[i]->size;
+            }
+            if ( node.type==JsonType::array ) {
+                if ( node.count>ti->argCount ) return fail(ni, "too many tuple elements");
+                uint32_t i = 0;
+                for ( uint32_t ci=ni+1; ci!=node.next; ci=doc[ci].next, ++i ) {
+                    if ( !decode(ci, data + offsets[i], ti->argTypes[i]) ) return failedAt("[" + to_string(i) + "]");
+                }
+                return true;
+            } else if ( node.type==JsonType::object ) {
+                for ( uint32_t ki=ni+1; ki!=node.next; ki=doc[ki+1].next ) {
+                    for ( uint32_t i=0; i!=ti->argCount; ++i ) {
+                        auto name = tupleFieldName(ti, i);
+                        if ( name==doc[ki].str ) {
+                            if ( !decode(ki+1, data + offsets[i], ti->argTypes[i]) ) return failedAt("." + name);
+                            break;
+                        }
+                    }
+                }
+                return true;
+            }
+            return mismatch(ni, "array or object");
+        }
+        // {"$variant":1,"f":1.0} as json_boost writes them, or {"f":1.0}
+        bool decodeVariant ( uint32_t ni, char * data, TypeInfo * ti ) {
+            auto & node = doc[ni];
+            if ( node.type!=JsonType::object ) return mismatch(ni, "object");
+            int32_t index = -1;
+            for ( uint32_t ki=ni+1; ki!=node.next; ki=doc[ki+1].next ) {
+                if ( strcmp(doc[ki].str, "$variant")==0 ) {
+                    auto & vn = doc[ki+1];
+                    if ( vn.type!=JsonType::number || !vn.isInteger || vn.integer<0 || vn.integer>=int64_t(ti->argCount) ) {
+                        return failedAt(".$variant") || fail(ki+1, "invalid variant index");
+                    }
+                    index = int32_t(vn.integer);
+                }
+            }
+            uint32_t offset = variantDataOffset(ti);
+            for ( uint32_t ki=ni+1; ki!=node.next; ki=doc[ki+1].next ) {
+                for ( uint32_t i=0; i!=ti->argCount; ++i ) {
+                    if ( (index==-1 || index==int32_t(i)) && tupleFieldName(ti, i)==doc[ki].str ) {
+                        if ( *(int32_t *)data!=int32_t(i) ) {
+                            memset(data + offset, 0, ti->size - offset);
+                            *(int32_t *)data = int32_t(i);
+                        }
+                        if ( !decode(ki+1, data + offset, ti->argTypes[i]) ) return failedAt("." + tupleFieldName(ti, i));
+                        return true;
+                    }
+                }
+            }
+            return fail(ni, "variant value is missing");
+        }
+        bool decodeDim ( uint32_t ni, char * data, TypeInfo * ti ) {
+            auto & node = doc[ni];
+            if ( node.type!=JsonType::array ) return mismatch(ni, "array");
+            if ( node.count>ti->dim[0] ) return fail(ni, "too many elements, expecting " + to_string(ti->dim[0]));
+            vector<uint32_t> udim;
+            TypeInfo elementType = dimElementType(ti, udim);
+            uint32_t i = 0;
+            for ( uint32_t ci=ni+1; ci!=node.next; ci=doc[ci].next, ++i ) {
+                if ( !decode(ci, data + i*elementType.size, &elementType) ) return failedAt("[" + to_string(i) + "]");
+            }
+            return true;
+        }
+        bool decodeArray ( uint32_t ni, Array * arr, TypeInfo * ti ) {
+            auto & node = doc[ni];
+            if ( node.type!=JsonType::array ) return mismatch(ni, "array");
+            uint32_t stride = ti->firstType->size;
+            array_resize(*context, *arr, 0, stride, false);
+            array_resize(*context, *arr, node.count, stride, true);
+            uint32_t i = 0;
+            for ( uint32_t ci=ni+1; ci!=node.next; ci=doc[ci].next, ++i ) {
+                if ( !decode(ci, arr->data + i*stride, ti->firstType) ) return failedAt("[" + to_string(i) + "]");
+            }
+            return true;
+        }
+        template <typename KeyType>
+        bool decodeTableKey ( const JsonNode & key, KeyType & value ) {
+            char * end = nullptr;
+            if ( is_signed<KeyType>::value ) {
+                value = KeyType(strtoll(key.str, &end, 10));
+            } else {
+                value = KeyType(strtoull(key.str, &end, 10));
+            }
+            return key.count && *end==0;
+        }
+        bool decodeTableKey ( const JsonNode & key, char * & value ) {
+            value = allocateString(key);
+            return true;
+        }
+        template <typename KeyType>
+        bool decodeTable ( uint32_t ni, Table * tab, TypeInfo * ti ) {
+            auto & node = doc[ni];
+            uint32_t valueSize = ti->secondType->size;
+            table_clear(*context, *tab);
+            TableHash<KeyType> thh(context, valueSize);
+            for ( uint32_t ki=ni+1; ki!=node.next; ki=doc[ki+1].next ) {
+                KeyType key;
+                if ( !decodeTableKey(doc[ki], key) ) return fail(ki, string("invalid key '") + doc[ki].str + "'");
+                uint32_t size = tab->size;
+                int index = thh.reserve(*tab, key, hash_function(*context, key));
+                if ( index<0 ) context->throw_error("json: can't grow the table");
+                if ( tab->size==size ) return fail(ki, string("duplicate key '") + doc[ki].str + "'");
+                char * value = tab->data + index*valueSize;
+                memset(value, 0, valueSize);
+                if ( !decode(ki+1, value, ti->secondType) ) return failedAt(string("[\"") + doc[ki].str + "\"]");
+            }
+            return true;
+        }
+        bool decodeTable ( uint32_t ni, Table * tab, TypeInfo * ti ) {
+            if ( doc[ni].type!=JsonType::object ) return mismatch(ni, "object");
+            switch ( ti->firstType->type ) {
+                case Type::tString: return decodeTable<char *>(ni, tab, ti);
+                case Type::tInt:    return decodeTable<int32_t>(ni, tab, ti);
+                case Type::tUInt:   return decodeTable<uint32_t>(ni, tab, ti);
+                case Type::tInt64:  return decodeTable<int64_t>(ni, tab, ti);
+                case Type::tUInt64: return decodeTable<uint64_t>(ni, tab, ti);
+                default:            return fail(ni, "can't decode table with " + debug_type(ti->firstType) + " keys");
+            }
+        }
+        // existing pointee is decoded into, otherwise new one is allocated
+        bool decodePointer ( uint32_t ni, char ** data, TypeInfo * ti ) {
+            auto pointee = ti->firstType;
+            if ( isJsonValuePtr(ti) ) {     // null is JsonValue with _null, same as JVNull()
+                *data = allocate(pointee->size);
+                return decodeJsonValue(ni, *data, pointee->structType);
+            }
+            if ( doc[ni].type==JsonType::null_value ) {
+                *data = nullptr;
+                return true;
+            }
+            if ( !pointee || pointee->type==Type::tVoid ) return fail(ni, "can't decode " + debug_type(ti));
+            if ( !*data ) {
+                if ( pointee->type==Type::tStructure && (pointee->structType->flags & StructInfo::flag_class) ) {
+                    return fail(ni, "can't create class instance " + debug_type(pointee));
+                }
+                *data = allocate(pointee->size);
+            }
+            return decode(ni, *data, pointee);
+        }
+        // JsonValue is a structure with the single JsValue variant field, alternatives are picked by the json type
+        bool decodeJsonValue ( uint32_t ni, char * data, StructInfo * si ) {
+            static const char * alternatives[] = { "_null", "_bool", "_number", "_string", "_array", "_object" };
+            auto vi = si->fields[0];
+            auto name = alternatives[int(doc[ni].type)];
+            for ( uint32_t i=0; i!=vi->argCount; ++i ) {
+                if ( strcmp(vi->argNames[i], name)==0 ) {
+                    char * pv = data + vi->offset;
+                    uint32_t offset = variantDataOffset(vi);
+                    memset(pv + offset, 0, vi->size - offset);
+                    *(int32_t *)pv = int32_t(i);
+                    return doc[ni].type==JsonType::null_value ? true : decode(ni, pv + offset, vi->argTypes[i]);
+                }
+            }
+            return fail(ni, string("JsonValue has no ") + name);
+        }
+        bool decode ( uint32_t ni, char * data, TypeInfo * ti ) {
+            if ( ti->flags & TypeInfo::flag_ref ) data = *(char **)data;
+            if ( ti->dimSize ) return decodeDim(ni, data, ti);
+            auto & node = doc[ni];
+            switch ( ti->type ) {
+                case Type::tBool:
+                    if ( node.type!=JsonType::boolean ) return mismatch(ni, "boolean");
+                    *(bool *)data = node.boolean;
+                    return true;
+                case Type::tInt8:       return decodeInteger<int8_t>(ni, data);
+                case Type::tUInt8:      return decodeInteger<uint8_t>(ni, data);
+                case Type::tInt16:      return decodeInteger<int16_t>(ni, data);
+                case Type::tUInt16:     return decodeInteger<uint16_t>(ni, data);
+                case Type::tInt:        return decodeInteger<int32_t>(ni, data);
+                case Type::tUInt:       return decodeInteger<uint32_t>(ni, data);
+                case Type::tBitfield:   return decodeInteger<uint32_t>(ni, data);
+                case Type::tInt64:      return decodeInteger<int64_t>(ni, data);
+                case Type::tUInt64:     return decodeInteger<uint64_t>(ni, data);
+                case Type::tFloat:      return decodeReal<float>(ni, data);
+                case Type::tDouble:     return decodeReal<double>(ni, data);
+                case Type::tInt2:       return decodeVector<int32_t>(ni, data, 2);
+                case Type::tInt3:       return decodeVector<int32_t>(ni, data, 3);
+                case Type::tInt4:       return decodeVector<int32_t>(ni, data, 4);
+                case Type::tUInt2:      return decodeVector<uint32_t>(ni, data, 2);
+                case Type::tUInt3:      return decodeVector<uint32_t>(ni, data, 3);
+                case Type::tUInt4:      return decodeVector<uint32_t>(ni, data, 4);
+                case Type::tFloat2:     return decodeVector<float>(ni, data, 2);
+                case Type::tFloat3:     return decodeVector<float>(ni, data, 3);
+                case Type::tFloat4:     return decodeVector<float>(ni, data, 4);
+                case Type::tString:
+                    if ( node.type==JsonType::null_value ) {
+                        *(char **)data = nullptr;
+                        return true;
+                    }
+                    if ( node.type!=JsonType::string ) return mismatch(ni, "string");
+                    *(char **)data = allocateString(node);
+                    return true;
+                case Type::tEnumeration:
+                case Type::tEnumeration8:
+                case Type::tEnumeration16:
+                    return decodeEnum(ni, data, ti);
+                case Type::tStructure:  return decodeStruct(ni, data, ti->structType);
+                case Type::tTuple:      return decodeTuple(ni, data, ti);
+                case Type::tVariant:    return decodeVariant(ni, data, ti);
+                case Type::tArray:      return decodeArray(ni, (Array *) data, ti);
+                case Type::tTable:      return decodeTable(ni, (Table *) data, ti);
+                case Type::tPointer:    return decodePointer(ni, (char **) data, ti);
+                default:                return fail(ni, "can't decode " + debug_type(ti));
+            }
+        }
+    };
+
+    // same layout as daslib/json write_json. structures are written as objects with fields in the declaration order,
+    // and the rest of the types the way json_boost JV writes them
+    struct JsonEncoder {
+        JsonEncoder ( JsonWriter & w, Context * ctx, LineInfo * a ) : writer(w), context(ctx), at(a) {}
+        JsonWriter &    writer;
+        Context *       context;
+        LineInfo *      at;
+        static bool skipField ( const TypeInfo * ti ) {
+            if ( ti->dimSize ) return false;
+            switch ( ti->type ) {
+                case Type::tFunction:
+                case Type::tLambda:
+                case Type::tBlock:
+                case Type::tIterator:
+                case Type::tHandle:
+                    return true;
+                case Type::tPointer:
+                    return !ti->firstType || ti->firstType->type==Type::tVoid;
+                default:
+                    return false;
+            }
+        }
+        void writeString ( const char * str ) {
+            str ? writer.writeString(str, uint32_t(strlen(str))) : writer.writeString("", 0);
+        }
+        void writeComponent ( int32_t value ) { writer.writeInteger(value); }
+        void writeComponent ( uint32_t value ) { writer.writeInteger(value); }
+        void writeComponent ( float value ) { writer.writeFloat(value); }
+        template <typename TT>
+        void encodeVector ( const TT * comp, uint32_t count ) {
+            static const char * names[4] = { "x", "y", "z", "w" };
+            writer.beginObject();
+            for ( uint32_t i=0; i!=count; ++i ) {
+                writer.key(names[i], 1);
+                writeComponent(comp[i]);
+            }
+            writer.endObject();
+        }
+        void encodeEnum ( int64_t value, TypeInfo * ti ) {
+            auto ei = ti->enumType;
+            for ( uint32_t i=0; i!=ei->count; ++i ) {
+                if ( ei->fields[i]->value==value ) {
+                    writeString(ei->fields[i]->name);
+                    return;
+                }
+            }
+            writer.writeInteger(value);
+        }
+        void encodeStruct ( char * data, StructInfo * si ) {
+            if ( isJsonValue(si) ) {
+                encodeJsonValue(data, si);
+                return;
+            }
+            writer.beginObject();
+            for ( uint32_t i=0; i!=si->count; ++i ) {
+                VarInfo * field = si->fields[i];
+                if ( skipField(field) ) continue;
+                char * pf = data + field->offset;
+                if ( field->type==Type::tPointer && field->dimSize==0 && !*(char **)pf ) continue;
+                writer.key(field->name, uint32_t(strlen(field->name)));
+                encode(pf, field);
+            }
+            writer.endObject();
+        }
+        void encodeTuple ( char * data, TypeInfo * ti ) {
+            writer.beginObject();
+            uint32_t fieldOffset = 0;
+            for ( uint32_t i=0; i!=ti->argCount; ++i ) {
+                TypeInfo * vi = ti->argTypes[i];
+                uint32_t fa = uint32_t(getTypeAlign(vi)) - 1;
+                fieldOffset = (fieldOffset + fa) & ~fa;
+                auto name = tupleFieldName(ti, i);
+                writer.key(name.c_str(), uint32_t(name.length()));
+                encode(data + fieldOffset, vi);
+                fieldOffset += vi->size;
+            }
+            writer.endObject();
+        }
+        void encodeVariant ( char * data, TypeInfo * ti ) {
+            int32_t index = *(int32_t *)data;
+            writer.beginObject();
+            writer.key("$variant", 8);
+            writer.writeInteger(index);
+            auto name = tupleFieldName(ti, uint32_t(index));
+            writer.key(name.c_str(), uint32_t(name.length()));
+            encode(data + variantDataOffset(ti), ti->argTypes[index]);
+            writer.endObject();
+        }
+        void encodeJsonValue ( char * data, StructInfo * si ) {
+            auto vi = si->fields[0];
+            char * pv = data + vi->offset;
+            auto alt = vi->argTypes[*(int32_t *)pv];
+            if ( alt->type==Type::tPointer && alt->dimSize==0 ) {
+                writer.writeNull();
+            } else {
+                encode(pv + variantDataOffset(vi), alt);
+            }
+        }
+        void encodeElements ( char * data, uint32_t count, TypeInfo * ti ) {
+            writer.beginArray();
+            for ( uint32_t i=0; i!=count; ++i ) {
+                writer.element();
+                encode(data + i*ti->size, ti);
+            }
+            writer.endArray();
+        }
+        void encodeTable ( Table * tab, TypeInfo * ti ) {
+            auto kt = ti->firstType;
+            auto vt = ti->secondType;
+            writer.beginObject();
+            for ( uint32_t i=0; i!=tab->capacity; ++i ) {
+                if ( tab->hashes[i] <= HASH_KILLED64 ) continue;
+                char * key = tab->keys + i*kt->size;
+                char buf[32];
+                switch ( kt->type ) {
+                    case Type::tString: {
+                            const char * str = *(char **)key;
+                            str = str ? str : "";
+                            writer.key(str, uint32_t(strlen(str)));
+                        }
+                        break;
+                    case Type::tInt:    writer.key(buf, uint32_t(snprintf(buf, sizeof(buf), "%d", *(int32_t *)key))); break;
+                    case Type::tUInt:   writer.key(buf, uint32_t(snprintf(buf, sizeof(buf), "%u", *(uint32_t *)key))); break;
+                    case Type::tInt64:  writer.key(buf, uint32_t(snprintf(buf, sizeof(buf), "%lld", (long long) *(int64_t *)key))); break;
+                    case Type::tUInt64: writer.key(buf, uint32_t(snprintf(buf, sizeof(buf), "%llu", (unsigned long long) *(uint64_t *)key))); break;
+                    default:
+                        context->throw_error_at(*at, "json: can't encode table with %s keys", debug_type(kt).c_str());
+                }
+                encode(tab->data + i*vt->size, vt);
+            }
+            writer.endObject();
+        }
+        void encode ( char * data, TypeInfo * ti ) {
+            if ( ti->flags & TypeInfo::flag_ref ) data = *(char **)data;
+            if ( ti->dimSize ) {
+                vector<uint32_t> udim;
+                TypeInfo elementType = dimElementType(ti, udim);
+                encodeElements(data, ti->dim[0], &elementType);
+                return;
+            }
+            switch ( ti->type ) {
+                case Type::tBool:       writer.writeBool(*(bool *)data); break;
+                case Type::tInt8:       writer.writeInteger(*(int8_t *)data); break;
+                case Type::tUInt8:      writer.writeInteger(*(uint8_t *)data); break;
+                case Type::tInt16:      writer.writeInteger(*(int16_t *)data); break;
+                case Type::tUInt16:     writer.writeInteger(*(uint16_t *)data); break;
+                case Type::tInt:        writer.writeInteger(*(int32_t *)data); break;
+                case Type::tUInt:       writer.writeInteger(*(uint32_t *)data); break;
+                case Type::tBitfield:   writer.writeInteger(*(uint32_t *)data); break;
+                case Type::tInt64:      writer.writeInteger(*(int64_t *)data); break;
+                case Type::tUInt64: {
+                        uint64_t value = *(uint64_t *)data;
+                        if ( value > uint64_t(INT64_MAX) ) {    // does not fit the number, same as json_boost
+                            writer.writeChar('"');
+                            writer.writeUnsigned(value);
+                            writer.writeChar('"');
+                        } else {
+                            writer.writeUnsigned(value);
+                        }
+                    }
+                    break;
+                case Type::tFloat:      writer.writeFloat(*(float *)data); break;
+                case Type::tDouble:     writer.writeNumber(*(double *)data); break;
+                case Type::tInt2:       encodeVector((int32_t *)data, 2); break;
+                case Type::tInt3:       encodeVector((int32_t *)data, 3); break;
+                case Type::tInt4:       encodeVector((int32_t *)data, 4); break;
+                case Type::tUInt2:      encodeVector((uint32_t *)data, 2); break;
+                case Type::tUInt3:      encodeVector((uint32_t *)data, 3); break;
+                case Type::tUInt4:      encodeVector((uint32_t *)data, 4); break;
+                case Type::tFloat2:     encodeVector((float *)data, 2); break;
+                case Type::tFloat3:     encodeVector((float *)data, 3); break;
+                case Type::tFloat4:     encodeVector((float *)data, 4); break;
+                case Type::tString:     writeString(*(char **)data); break;
+                case Type::tEnumeration:    encodeEnum(*(int32_t *)data, ti); break;
+                case Type::tEnumeration8:   encodeEnum(*(int8_t *)data, ti); break;
+                case Type::tEnumeration16:  encodeEnum(*(int16_t *)data, ti); break;
+                case Type::tStructure:  encodeStruct(data, ti->structType); break;
+                case Type::tTuple:      encodeTuple(data, ti); break;
+                case Type::tVariant:    encodeVariant(data, ti); break;
+                case Type::tArray:      encodeElements(((Array *)data)->data, ((Array *)data)->size, ti->firstType); break;
+                case Type::tTable:      encodeTable((Table *)data, ti); break;
+                case Type::tPointer: {
+                        char * ptr = *(char **)data;
+                        if ( !ptr ) {
+                            writer.writeNull();
+                        } else if ( !ti->firstType || ti->firstType->type==Type::tVoid ) {
+                            context->throw_error_at(*at, "json: can't encode %s", debug_type(ti).c_str());
+                        } else {
+                            encode(ptr, ti->firstType);
+                        }
+                    }
+                    break;
+                default:
+                    context->throw_error_at(*at, "json: can't encode %s", debug_type(ti).c_str());
+            }
+        }
+    };
+
+    static bool json_decode ( const char * text, uint32_t length, void * data, const TypeInfo * info, char * & error, Context * context ) {
+        JsonDocument doc;
+        if ( !doc.parse(text, length) ) {
+            error = context->stringHeap->allocateString(doc.getError());
+            return false;
+        }
+        JsonDecoder decoder(doc, context);
+        if ( !decoder.decode(0, (char *) data, (TypeInfo *) info) ) {
+            error = context->stringHeap->allocateString(decoder.getError());
+            return false;
+        }
+        error = nullptr;
+        return true;
+    }
+
+    bool builtin_json_decode ( const char * text, void * data, const TypeInfo * info, char * & error, Context * context, LineInfoArg * ) {
+        return json_decode(text, stringLengthSafe(*context, text), data, info, error, context);
+    }
+
+    bool builtin_json_decode_bytes ( const TArray<uint8_t> & bytes, void * data, const TypeInfo * info, char * & error, Context * context, LineInfoArg * ) {
+        return json_decode((const char *) bytes.data, bytes.size, data, info, error, context);
+    }
+
+    char * builtin_json_encode ( const void * data, const TypeInfo * info, bool pretty, Context * context, LineInfoArg * at ) {
+        JsonWriter writer(pretty);
+        JsonEncoder encoder(writer, context, at);
+        encoder.encode((char *) data, (TypeInfo *) info);
+        return writer.size() ? context->stringHeap->allocateString(writer.data(), writer.size()) : nullptr;
+    }
+
+    class Module_JsonNative : public Module {
+    public:
+        Module_JsonNative() : Module("json_native") {
+            DAS_PROFILE_SECTION("Module_JsonNative");
+            ModuleLibrary lib;
+            lib.addModule(this);
+            lib.addBuiltInModule();
+            lib.addModule(Module::require("rtti"));
+            addExtern<DAS_BIND_FUN(builtin_json_decode)>(*this, lib, "json_decode",
+                SideEffects::modifyArgumentAndExternal, "builtin_json_decode")
+                    ->args({"text","data","type","error","context","at"})->unsafeOperation = true;
+            addExtern<DAS_BIND_FUN(builtin_json_decode_bytes)>(*this, lib, "json_decode",
+                SideEffects::modifyArgumentAndExternal, "builtin_json_decode_bytes")
+                    ->args({"text","data","type","error","context","at"})->unsafeOperation = true;
+            addExtern<DAS_BIND_FUN(builtin_json_encode)>(*this, lib, "json_encode",
+                SideEffects::none, "builtin_json_encode")
+                    ->args({"data","type","pretty","context","at"});
+        }
+        virtual ModuleAotType aotRequire ( TextWriter & tw ) const override {
+            tw << "#include \"daScript/simulate/aot_builtin_json.h\"\n";
+            return ModuleAotType::cpp;
+        }
+    };
+}
+
+REGISTER_MODULE_IN_NAMESPACE(Module_JsonNative,das);
@@ -1,12 +1,18 @@
 #include "daScript/misc/platform.h"
 
+#include <atomic>
+
 #include "daScript/misc/performance_time.h"
-#include "daScript/simulate/aot_builtin_network.h"
 #include "daScript/ast/ast.h"
 #include "daScript/ast/ast_handle.h"
+#include "daScript/simulate/aot_builtin_network.h"
 #include "module_builtin_rtti.h"
 
 MAKE_TYPE_FACTORY(NetworkServer,Server)
+MAKE_TYPE_FACTORY(NetworkMultiServer,MultiServer)
+MAKE_TYPE_FACTORY(NetworkMessage,das::NetworkMessage)
+
+DAS_BASE_BIND_ENUM(das::NetworkFraming, NetworkFraming, raw, length32, line)
 
 namespace das {
 
@@ -82,6 +88,87 @@ namespace das {
         }
     };
 
+    class MultiServerAdapter : public MultiServer {
+    public:
+        MultiServerAdapter(char * pClass, const StructInfo * info, Context * ctx ) {
+            update(pClass,info,ctx);
+            if ( !g_moduleNetworkTotalServers++ )
+                Server::startup();
+        }
+        virtual ~MultiServerAdapter() {
+            if ( !--g_moduleNetworkTotalServers )
+                Server::shutdown();
+        }
+        void update ( char * pClass, const StructInfo * info, Context * ctx ) {
+            context = ctx;
+            classPtr = pClass;
+            pServer = (void **) adapt_field("_server",pClass,info);
+            if ( pServer ) *pServer = this;
+            fnOnConnect = adapt("onConnect",pClass,info);
+            fnOnDisconnect = adapt("onDisconnect",pClass,info);
+            fnOnData = adapt("onData",pClass,info);
+            fnOnError = adapt("onError",pClass,info);
+        }
+        virtual void onConnect ( int32_t connection ) override {
+            if ( fnOnConnect ) {
+                return das_invoke_function<void>::invoke<void *,int32_t>
+                    (context,nullptr,fnOnConnect,classPtr,connection);
+            }
+        }
+        virtual void onDisconnect ( int32_t connection ) override {
+            if ( fnOnDisconnect ) {
+                return das_invoke_function<void>::invoke<void *,int32_t>
+                    (context,nullptr,fnOnDisconnect,classPtr,connection);
+            }
+        }
+        virtual void onData ( NetworkMessage * messages, int32_t count ) override {
+            if ( fnOnData ) {
+                // one locked array over the whole batch, message data points into connection buffers
+                Array arr;
+                arr.data = (char *) messages;
+                arr.capacity = arr.size = uint32_t(count);
+                arr.lock = 1;
+                arr.flags = 0;
+                return das_invoke_function<void>::invoke<void *,Array *>
+                    (context,nullptr,fnOnData,classPtr,&arr);
+            }
+        }
+        virtual void onError ( const char * msg, int code ) override {
+            if ( fnOnError ) {
+                return das_invoke_function<void>::invoke<void *,const char *,int32_t>
+                    (context,nullptr,fnOnError,classPtr,msg,code);
+            }
+        }
+        bool isValid() const { return pServer != nullptr; }
+    protected:
+        void ** pServer = nullptr;
+        Func    fnOnConnect;
+        Func    fnOnDisconnect;
+        Func    fnOnData;
+        Func    fnOnError;
+    protected:
+        void *      classPtr;
+        Context *   context;
+    };
+
+    struct MultiServerAnnotation : ManagedStructureAnnotation<MultiServer> {
+        MultiServerAnnotation(ModuleLibrary & ml)
+            : ManagedStructureAnnotation ("NetworkMultiServer", ml, "MultiServer") {
+        }
+    };
+
+    struct NetworkMessageAnnotation : ManagedStructureAnnotation<NetworkMessage,true> {
+        NetworkMessageAnnotation(ModuleLibrary & ml)
+            : ManagedStructureAnnotation ("NetworkMessage", ml) {
+            addField<DAS_BIND_MANAGED_FIELD(data)>("data");
+            addField<DAS_BIND_MANAGED_FIELD(size)>("size");
+            addField<DAS_BIND_MANAGED_FIELD(connection)>("connection");
+        }
+        virtual bool canMove() const override { return true; }
+        virtual bool canCopy() const override { return true; }
+        virtual bool isLocal() const override { return true; }
+    };
+
     #include "network.das.inc"
 
     bool makeServer ( const void * pClass, const StructInfo * info, Context * context ) {
@@ -122,6 +209,69 @@ namespace das {
         adapter->update((char *)pClass,info,context);
     }
 
+    bool makeMultiServer ( const void * pClass, const StructInfo * info, Context * context ) {
+        auto server = make_smart<MultiServerAdapter>((char *)pClass,info,context);
+        if ( !server->isValid() ) return false;
+        server.orphan();
+        return true;
+    }
+
+    bool multi_server_init ( smart_ptr_raw<MultiServer> server, int32_t port, NetworkFraming framing, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        return server->init(port, framing);
+    }
+
+    bool multi_server_is_open ( smart_ptr_raw<MultiServer> server, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        return server->is_open();
+    }
+
+    int32_t multi_server_port ( smart_ptr_raw<MultiServer> server, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        return server->get_port();
+    }
+
+    int32_t multi_server_tick ( smart_ptr_raw<MultiServer> server, int32_t timeoutMsec, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        return server->tick(timeoutMsec);
+    }
+
+    bool multi_server_send ( smart_ptr_raw<MultiServer> server, int32_t connection, uint8_t * data, int32_t size, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        return server->send_msg(connection, (char *)data, size);
+    }
+
+    void multi_server_close ( smart_ptr_raw<MultiServer> server, int32_t connection, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        server->close_connection(connection);
+    }
+
+    bool multi_server_is_connected ( smart_ptr_raw<MultiServer> server, int32_t connection, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        return server->is_connected(connection);
+    }
+
+    int32_t multi_server_connections ( smart_ptr_raw<MultiServer> server, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        return server->connection_count();
+    }
+
+    int32_t multi_server_queued ( smart_ptr_raw<MultiServer> server, int32_t connection, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        return server->get_queued(connection);
+    }
+
+    void multi_server_set_limits ( smart_ptr_raw<MultiServer> server, int32_t maxMessageSize, int32_t maxQueueSize, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        server->set_limits(maxMessageSize, maxQueueSize);
+    }
+
+    void multi_server_restore ( smart_ptr_raw<MultiServer> server, const void * pClass, const StructInfo * info, Context * context ) {
+        if ( !server ) context->throw_error("null server");
+        auto adapter = (MultiServerAdapter *) server.get();
+        adapter->update((char *)pClass,info,context);
+    }
+
     class Module_Network : public Module {
     public:
         Module_Network() : Module("network") {
@@ -153,6 +303,46 @@ namespace das {
             addExtern<DAS_BIND_FUN(server_restore)>(*this, lib,  "server_restore",
                 SideEffects::modifyArgumentAndExternal, "server_restore")
                     ->args({"server","class","info","context"});
+            // multi-connection server
+            addEnumeration(make_smart<EnumerationNetworkFraming>());
+            addAnnotation(make_smart<NetworkMessageAnnotation>(lib));
+            addAnnotation(make_smart<MultiServerAnnotation>(lib));
+            addExtern<DAS_BIND_FUN(makeMultiServer)>(*this, lib,  "make_multi_server",
+                SideEffects::modifyArgumentAndExternal, "makeMultiServer")
+                    ->args({"class","info","context"});
+            addExtern<DAS_BIND_FUN(multi_server_init)>(*this, lib,  "multi_server_init",
+                SideEffects::modifyArgumentAndExternal, "multi_server_init")
+                    ->args({"server","port","framing","context"});
+            addExtern<DAS_BIND_FUN(multi_server_is_open)>(*this, lib,  "multi_server_is_open",
+                SideEffects::modifyArgumentAndExternal, "multi_server_is_open")
+                    ->args({"server","context"});
+            addExtern<DAS_BIND_FUN(multi_server_port)>(*this, lib,  "multi_server_port",
+                SideEffects::modifyArgumentAndExternal, "multi_server_port")
+                    ->args({"server","context"});
+            addExtern<DAS_BIND_FUN(multi_server_tick)>(*this, lib,  "multi_server_tick",
+                SideEffects::modifyArgumentAndExternal, "multi_server_tick")
+                    ->args({"server","timeout","context"});
+            addExtern<DAS_BIND_FUN(multi_server_send)>(*this, lib,  "multi_server_send",
+                SideEffects::modifyArgumentAndExternal, "multi_server_send")
+                    ->args({"server","connection","data","size","context"});
+            addExtern<DAS_BIND_FUN(multi_server_close)>(*this, lib,  "multi_server_close",
+                SideEffects::modifyArgumentAndExternal, "multi_server_close")
+                    ->args({"server","connection","context"});
+            addExtern<DAS_BIND_FUN(multi_server_is_connected)>(*this, lib,  "multi_server_is_connected",
+                SideEffects::modifyArgumentAndExternal, "multi_server_is_connected")
+                    ->args({"server","connection","context"});
+            addExtern<DAS_BIND_FUN(multi_server_connections)>(*this, lib,  "multi_server_connections",
+                SideEffects::modifyArgumentAndExternal, "multi_server_connections")
+                    ->args({"server","context"});
+            addExtern<DAS_BIND_FUN(multi_server_queued)>(*this, lib,  "multi_server_queued",
+                SideEffects::modifyArgumentAndExternal, "multi_server_queued")
+                    ->args({"server","connection","context"});
+            addExtern<DAS_BIND_FUN(multi_server_set_limits)>(*this, lib,  "multi_server_set_limits",
+                SideEffects::modifyArgumentAndExternal, "multi_server_set_limits")
+                    ->args({"server","max_message_size","max_queue_size","context"});
+            addExtern<DAS_BIND_FUN(multi_server_restore)>(*this, lib,  "multi_server_restore",
+                SideEffects::modifyArgumentAndExternal, "multi_server_restore")
+                    ->args({"server","class","info","context"});
             // add builtin module
             compileBuiltinModule("network.das",network_das,sizeof(network_das));
         }
@@ -0,0 +1,93 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_interop.h"
+#include "daScript/ast/ast_handle.h"
+#include "daScript/simulate/aot_builtin_regex.h"
+
+MAKE_TYPE_FACTORY(RegexDfa, das::RegexDfa)
+
+namespace das {
+
+    struct RegexDfaAnnotation : ManagedStructureAnnotation<RegexDfa,false,true> {
+        RegexDfaAnnotation(ModuleLibrary & ml) : ManagedStructureAnnotation ("RegexDfa", ml, "das::RegexDfa") {
+            addProperty<DAS_BIND_MANAGED_PROP(stateCount)>("stateCount");
+            addProperty<DAS_BIND_MANAGED_PROP(groupCount)>("groupCount");
+        }
+    };
+
+    RegexDfa * builtin_regex_dfa_create ( const TArray<int32_t> & code, const TArray<uint32_t> & sets ) {
+        auto dfa = new RegexDfa();
+        if ( !dfa->compile((const int32_t *) code.data, code.size, (const uint32_t *) sets.data, sets.size) ) {
+            delete dfa;
+            return nullptr;
+        }
+        return dfa;
+    }
+
+    int32_t builtin_regex_dfa_match ( RegexDfa * dfa, const char * str, int32_t offset, Context * context, LineInfoArg * at ) {
+        if ( !dfa ) context->throw_error_at(*at, "regex is not compiled");
+        return dfa->match(str ? str : "", stringLengthSafe(*context, str), offset);
+    }
+
+    range builtin_regex_dfa_search ( RegexDfa * dfa, const char * str, int32_t offset, Context * context, LineInfoArg * at ) {
+        if ( !dfa ) context->throw_error_at(*at, "regex is not compiled");
+        int32_t start = -1, end = -1;
+        dfa->search(str ? str : "", stringLengthSafe(*context, str), offset, start, end);
+        return range(start, end);
+    }
+
+    // length is trusted, so that iterating over all the matches does not strlen the whole text on every step
+    range builtin_regex_dfa_search_n ( RegexDfa * dfa, const char * str, int32_t length, int32_t offset, Context * context, LineInfoArg * at ) {
+        if ( !dfa ) context->throw_error_at(*at, "regex is not compiled");
+        if ( length<0 || (length && !str) ) context->throw_error_at(*at, "invalid string length %i", length);
+        int32_t start = -1, end = -1;
+        dfa->search(str ? str : "", length, offset, start, end);
+        return range(start, end);
+    }
+
+    range builtin_regex_dfa_group ( const RegexDfa * dfa, int32_t index, Context * context, LineInfoArg * at ) {
+        if ( !dfa ) context->throw_error_at(*at, "regex is not compiled");
+        if ( index<0 || index>=dfa->groupCount() ) context->throw_error_at(*at, "regex group %i out of range %i", index, dfa->groupCount());
+        return range(dfa->groupStart(index), dfa->groupEnd(index));
+    }
+
+    int32_t builtin_regex_dfa_states ( const RegexDfa * dfa ) {
+        return dfa ? int32_t(dfa->stateCount()) : 0;
+    }
+
+    class Module_RegexNative : public Module {
+    public:
+        Module_RegexNative() : Module("regex_native") {
+            DAS_PROFILE_SECTION("Module_RegexNative");
+            ModuleLibrary lib;
+            lib.addModule(this);
+            lib.addBuiltInModule();
+            addAnnotation(make_smart<RegexDfaAnnotation>(lib));
+            addExtern<DAS_BIND_FUN(builtin_regex_dfa_create)>(*this, lib, "regex_dfa_create",
+                SideEffects::modifyExternal, "builtin_regex_dfa_create")
+                    ->args({"code","sets"});
+            addExtern<DAS_BIND_FUN(builtin_regex_dfa_match)>(*this, lib, "regex_dfa_match",
+                SideEffects::modifyArgumentAndExternal, "builtin_regex_dfa_match")
+                    ->args({"dfa","str","offset","context","at"});
+            addExtern<DAS_BIND_FUN(builtin_regex_dfa_search)>(*this, lib, "regex_dfa_search",
+                SideEffects::modifyArgumentAndExternal, "builtin_regex_dfa_search")
+                    ->args({"dfa","str","offset","context","at"});
+            addExtern<DAS_BIND_FUN(builtin_regex_dfa_search_n)>(*this, lib, "regex_dfa_search",
+                SideEffects::modifyArgumentAndExternal, "builtin_regex_dfa_search_n")
+                    ->args({"dfa","str","length","offset","context","at"})->unsafeOperation = true;
+            addExtern<DAS_BIND_FUN(builtin_regex_dfa_group)>(*this, lib, "regex_dfa_group",
+                SideEffects::none, "builtin_regex_dfa_group")
+                    ->args({"dfa","index","context","at"});
+            addExtern<DAS_BIND_FUN(builtin_regex_dfa_states)>(*this, lib, "regex_dfa_states",
+                SideEffects::none, "builtin_regex_dfa_states")
+                    ->args({"dfa"});
+        }
+        virtual ModuleAotType aotRequire ( TextWriter & tw ) const override {
+            tw << "#include \"daScript/simulate/aot_builtin_regex.h\"\n";
+            return ModuleAotType::cpp;
+        }
+    };
+}
+
+REGISTER_MODULE_IN_NAMESPACE(Module_RegexNative,das);
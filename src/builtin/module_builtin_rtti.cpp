@@ -601,6 +601,8 @@ namespace das {
             addField<DAS_BIND_MANAGED_FIELD(stack)>("stack");
             addField<DAS_BIND_MANAGED_FIELD(intern_strings)>("intern_strings");
             addField<DAS_BIND_MANAGED_FIELD(persistent_heap)>("persistent_heap");
+            addField<DAS_BIND_MANAGED_FIELD(swiss_tables)>("swiss_tables");
+            addField<DAS_BIND_MANAGED_FIELD(clone_snapshot)>("clone_snapshot");
             addField<DAS_BIND_MANAGED_FIELD(multiple_contexts)>("multiple_contexts");
             addField<DAS_BIND_MANAGED_FIELD(heap_size_hint)>("heap_size_hint");
             addField<DAS_BIND_MANAGED_FIELD(string_heap_size_hint)>("string_heap_size_hint");
@@ -629,6 +631,7 @@ namespace das {
             addField<DAS_BIND_MANAGED_FIELD(no_optimizations)>("no_optimizations");
             addField<DAS_BIND_MANAGED_FIELD(fail_on_no_aot)>("fail_on_no_aot");
             addField<DAS_BIND_MANAGED_FIELD(fail_on_lack_of_aot_export)>("fail_on_lack_of_aot_export");
+            addField<DAS_BIND_MANAGED_FIELD(profile_compile)>("profile_compile");
         // debugger
             addField<DAS_BIND_MANAGED_FIELD(debugger)>("debugger");
         }
@@ -12,6 +12,7 @@
 #include "daScript/simulate/runtime_range.h"
 #include "daScript/simulate/runtime_string_delete.h"
 #include "daScript/simulate/simulate_nodes.h"
+#include "daScript/simulate/simulate_jit.h"
 #include "daScript/simulate/aot.h"
 #include "daScript/misc/sysos.h"
 
@@ -135,6 +136,19 @@ namespace das
         };
     };
 
+    struct JitFunctionAnnotation : MarkFunctionAnnotation {
+        JitFunctionAnnotation() : MarkFunctionAnnotation("jit") { }
+        virtual bool apply(const FunctionPtr &, ModuleGroup &, const AnnotationArgumentList &, string &) override {
+            return true;
+        };
+        virtual void complete ( Context * context, const FunctionPtr & func ) override {
+            // nodes are final at this point, i.e. relocated and linked with aot
+            if ( func->index>=0 ) {
+                jitCompileFunction(context, context->getFunction(func->index));
+            }
+        }
+    };
+
     struct InitFunctionAnnotation : MarkFunctionAnnotation {
         InitFunctionAnnotation() : MarkFunctionAnnotation("init") { }
         virtual bool apply(const FunctionPtr & func, ModuleGroup &, const AnnotationArgumentList &, string &) override {
@@ -429,6 +443,21 @@ namespace das
         return context->stringHeap->bytesAllocated();
     }
 
+    static void invokeAllocationStats ( AnyHeapAllocator * heap, const TBlock<void,uint64_t,uint64_t,uint64_t,uint64_t,uint64_t> & blk, Context * context, LineInfoArg * at ) {
+        AllocationStats stats;
+        heap->getStats(stats);
+        das_invoke<void>::invoke<uint64_t,uint64_t,uint64_t,uint64_t,uint64_t>(context,at,blk,
+            stats.allocations,stats.frees,stats.freeListHits,stats.bytesAllocated,stats.bytesReserved);
+    }
+
+    void heap_allocation_stats ( const TBlock<void,uint64_t,uint64_t,uint64_t,uint64_t,uint64_t> & blk, Context * context, LineInfoArg * at ) {
+        invokeAllocationStats(context->heap.get(), blk, context, at);
+    }
+
+    void string_heap_allocation_stats ( const TBlock<void,uint64_t,uint64_t,uint64_t,uint64_t,uint64_t> & blk, Context * context, LineInfoArg * at ) {
+        invokeAllocationStats(context->stringHeap.get(), blk, context, at);
+    }
+
     int32_t string_heap_depth ( Context * context ) {
         return (int32_t) context->stringHeap->depth();
     }
@@ -446,6 +475,10 @@ namespace das
         context->collectHeap(info, sheap, validate);
     }
 
+    bool heap_collect_step ( int32_t budget, bool sheap, bool validate, Context * context, LineInfoArg * info ) {
+        return context->collectHeapStep(info, sheap, validate, budget);
+    }
+
     extern bool multiline_log;
 
     void heap_report ( Context * context, LineInfoArg * info ) {
@@ -678,6 +711,60 @@ namespace das
         return context->stringHeap->allocateString(tout.str());
     }
 
+    void profileFunctions ( bool enable, Context * context ) {
+        context->profileFunction(nullptr, enable);
+    }
+
+    // tabMnLookup only covers exported functions, profiler has to see all of them
+    static vector<SimFunction *> findProfiledFunctions ( Context * context, const char * name ) {
+        vector<SimFunction *> res;
+        for ( int fni=0, fnis=context->getTotalFunctions(); fni!=fnis; ++fni ) {
+            auto fn = context->getFunction(fni);
+            if ( fn->name && strcmp(fn->name, name ? name : "")==0 ) {
+                res.push_back(fn);
+            }
+        }
+        return res;
+    }
+
+    bool profileFunction ( const char * name, bool enable, Context * context ) {
+        auto fns = findProfiledFunctions(context, name);
+        for ( auto fn : fns ) {
+            context->profileFunction(fn, enable);
+        }
+        return !fns.empty();
+    }
+
+    void resetFunctionProfile ( Context * context ) {
+        context->resetFunctionProfile();
+    }
+
+    char * collectFunctionProfile ( Context * context ) {
+        TextWriter tout;
+        context->collectFunctionProfile(tout);
+        return context->stringHeap->allocateString(tout.str());
+    }
+
+    bool getFunctionProfile ( const char * name, const TBlock<void,uint64_t,double,double,double> & blk, Context * context, LineInfoArg * at ) {
+        FunctionProfileData total;
+        bool found = false;
+        for ( auto fn : findProfiledFunctions(context, name) ) {
+            if ( auto data = context->getFunctionProfile(fn) ) {
+                total.calls += data->calls;
+                total.inclusiveTicks += data->inclusiveTicks;
+                total.exclusiveTicks += data->exclusiveTicks;
+                total.maxTicks = das::max(total.maxTicks, data->maxTicks);
+                found = true;
+            }
+        }
+        if ( found ) {
+            das_invoke<void>::invoke<uint64_t,double,double,double>(context,at,blk,total.calls,
+                ref_time_delta_to_usec(total.inclusiveTicks),ref_time_delta_to_usec(total.exclusiveTicks),
+                ref_time_delta_to_usec(total.maxTicks));
+        }
+        return found;
+    }
+
     void builtin_array_free ( Array & dim, int szt, Context * __context__ ) {
         if ( dim.data ) {
             if ( !dim.lock || dim.hopeless ) {
@@ -698,7 +785,7 @@ namespace das
     void builtin_table_free ( Table & tab, int szk, int szv, Context * __context__ ) {
         if ( tab.data ) {
             if ( !tab.lock || tab.hopeless ) {
-                uint32_t oldSize = tab.capacity*(szk+szv+sizeof(uint64_t));
+                uint32_t oldSize = tab.capacity*table_slot_size(tab, szk+szv);
                 __context__->heap->free(tab.data, oldSize);
             } else {
                 __context__->throw_error("can't delete locked table");
@@ -1006,6 +1093,39 @@ namespace das
         return true;
     }
 
+    bool das_jit_compile ( const Func func, Context * context ) {
+        auto simfn = func.PTR;
+        if ( !simfn ) return false;
+        return jitCompileFunction(context, simfn);
+    }
+
+    bool das_jit_is_supported () {
+        return jitIsSupported();
+    }
+
+    bool das_jit_tiering ( bool enable, int32_t callThreshold, int32_t loopThreshold, Context * context ) {
+        return jitEnableTiering(context, enable, uint32_t(das::max(callThreshold,1)), uint32_t(das::max(loopThreshold,1)));
+    }
+
+    void das_jit_tiering_wait ( Context * context ) {
+        jitWaitTiering(context);
+    }
+
+    bool das_jit_tiering_stats ( const TBlock<void,uint64_t,int32_t,int32_t,int32_t,int32_t,double,double,double> & blk, Context * context, LineInfoArg * at ) {
+        JitTierStats stats;
+        if ( !jitTieringStats(context, stats) ) return false;
+        das_invoke<void>::invoke<uint64_t,int32_t,int32_t,int32_t,int32_t,double,double,double>(context,at,blk,
+            stats.interpretedCalls,int32_t(stats.queued),int32_t(stats.compiled),int32_t(stats.failed),int32_t(stats.deopted),
+            ref_time_delta_to_usec(stats.interpreterTicks),ref_time_delta_to_usec(stats.jitTicks),ref_time_delta_to_usec(stats.compileTicks));
+        return true;
+    }
+
+    char * das_jit_tiering_report ( Context * context ) {
+        TextWriter tout;
+        jitTieringReport(context, tout);
+        return context->stringHeap->allocateString(tout.str());
+    }
+
     void Module_BuiltIn::addRuntime(ModuleLibrary & lib) {
         // printer flags
         addAlias(makePrintFlags());
@@ -1025,6 +1145,7 @@ namespace das
         addAnnotation(make_smart<RunAtCompileTimeFunctionAnnotation>());
         addAnnotation(make_smart<UnsafeOpFunctionAnnotation>());
         addAnnotation(make_smart<NoAotFunctionAnnotation>());
+        addAnnotation(make_smart<JitFunctionAnnotation>());
         addAnnotation(make_smart<InitFunctionAnnotation>());
         addAnnotation(make_smart<FinalizeFunctionAnnotation>());
         addAnnotation(make_smart<HybridFunctionAnnotation>());
@@ -1126,6 +1247,21 @@ namespace das
         addExtern<DAS_BIND_FUN(collectProfileInfo)>(*this, lib, "collect_profile_info",
             SideEffects::modifyExternal, "collectProfileInfo")
                 ->arg("context");
+        addExtern<DAS_BIND_FUN(profileFunctions)>(*this, lib, "profile_functions",
+            SideEffects::modifyExternal, "profileFunctions")
+                ->args({"enable","context"});
+        addExtern<DAS_BIND_FUN(profileFunction)>(*this, lib, "profile_function",
+            SideEffects::modifyExternal, "profileFunction")
+                ->args({"name","enable","context"});
+        addExtern<DAS_BIND_FUN(resetFunctionProfile)>(*this, lib, "reset_function_profile",
+            SideEffects::modifyExternal, "resetFunctionProfile")
+                ->arg("context");
+        addExtern<DAS_BIND_FUN(collectFunctionProfile)>(*this, lib, "collect_function_profile",
+            SideEffects::modifyExternal, "collectFunctionProfile")
+                ->arg("context");
+        addExtern<DAS_BIND_FUN(getFunctionProfile)>(*this, lib, "get_function_profile",
+            SideEffects::modifyExternal, "getFunctionProfile")
+                ->args({"name","block","context","line"});
         // variant
         addExtern<DAS_BIND_FUN(variant_index)>(*this, lib, "variant_index", SideEffects::none, "variant_index");
         addExtern<DAS_BIND_FUN(set_variant_index)>(*this, lib, "set_variant_index",
@@ -1144,6 +1280,12 @@ namespace das
         addExtern<DAS_BIND_FUN(string_heap_depth)>(*this, lib, "string_heap_depth",
             SideEffects::modifyExternal, "string_heap_depth")
                 ->arg("context");
+        addExtern<DAS_BIND_FUN(heap_allocation_stats)>(*this, lib, "heap_allocation_stats",
+            SideEffects::modifyExternal, "heap_allocation_stats")
+                ->args({"block","context","line"});
+        addExtern<DAS_BIND_FUN(string_heap_allocation_stats)>(*this, lib, "string_heap_allocation_stats",
+            SideEffects::modifyExternal, "string_heap_allocation_stats")
+                ->args({"block","context","line"});
         auto shcol = addExtern<DAS_BIND_FUN(string_heap_collect)>(*this, lib, "string_heap_collect",
             SideEffects::modifyExternal, "string_heap_collect")
                 ->args({"validate","context","at"});
@@ -1155,6 +1297,12 @@ namespace das
         hcol->unsafeOperation = true;
         hcol->arguments[0]->init = make_smart<ExprConstBool>(true);
         hcol->arguments[1]->init = make_smart<ExprConstBool>(false);
+        auto hstep = addExtern<DAS_BIND_FUN(heap_collect_step)>(*this, lib, "heap_collect_step",
+                SideEffects::modifyExternal, "heap_collect_step")
+                    ->args({"budget_usec","string_heap","validate","context","at"});
+        hstep->unsafeOperation = true;
+        hstep->arguments[1]->init = make_smart<ExprConstBool>(true);
+        hstep->arguments[2]->init = make_smart<ExprConstBool>(false);
         addExtern<DAS_BIND_FUN(string_heap_report)>(*this, lib, "string_heap_report",
             SideEffects::modifyExternal, "string_heap_report")
                 ->args({"context","line"});
@@ -1171,6 +1319,12 @@ namespace das
         addInterop<_builtin_binary_save,void,const vec4f,const Block &>(*this, lib, "_builtin_binary_save",
             SideEffects::modifyExternal, "_builtin_binary_save")
                 ->args({"data","block"});
+        addInterop<_builtin_binary_load_versioned,void,vec4f,const Array &>(*this,lib,"_builtin_binary_load_versioned",
+            SideEffects::modifyArgumentAndExternal, "_builtin_binary_load_versioned")
+                ->args({"data","array"});
+        addInterop<_builtin_binary_save_versioned,void,const vec4f,const Block &>(*this, lib, "_builtin_binary_save_versioned",
+            SideEffects::modifyExternal, "_builtin_binary_save_versioned")
+                ->args({"data","block"});
         // function-like expresions
         addCall<ExprAssert>         ("assert",false);
         addCall<ExprAssert>         ("verify",true);
@@ -1296,6 +1450,26 @@ namespace das
         addExtern<DAS_BIND_FUN(builtin_profile)>(*this,lib,"profile",
             SideEffects::modifyExternal, "builtin_profile")
                 ->args({"count","category","block","context","line"});
+        // sampling profiler
+        addExtern<DAS_BIND_FUN(sampling_profiler_start)>(*this,lib,"sampling_profiler_start",
+            SideEffects::modifyExternal, "sampling_profiler_start")
+                ->arg("interval_usec");
+        addExtern<DAS_BIND_FUN(sampling_profiler_stop)>(*this,lib,"sampling_profiler_stop",
+            SideEffects::modifyExternal, "sampling_profiler_stop");
+        addExtern<DAS_BIND_FUN(sampling_profiler_is_running)>(*this,lib,"sampling_profiler_is_running",
+            SideEffects::accessExternal, "sampling_profiler_is_running");
+        addExtern<DAS_BIND_FUN(sampling_profiler_reset)>(*this,lib,"sampling_profiler_reset",
+            SideEffects::modifyExternal, "sampling_profiler_reset");
+        addExtern<DAS_BIND_FUN(sampling_profiler_sample)>(*this,lib,"sampling_profiler_sample",
+            SideEffects::modifyExternal, "sampling_profiler_sample");
+        addExtern<DAS_BIND_FUN(sampling_profiler_samples)>(*this,lib,"sampling_profiler_samples",
+            SideEffects::accessExternal, "sampling_profiler_samples");
+        addExtern<DAS_BIND_FUN(sampling_profiler_folded)>(*this,lib,"sampling_profiler_folded",
+            SideEffects::accessExternal, "sampling_profiler_folded")
+                ->args({"context","line"});
+        addExtern<DAS_BIND_FUN(sampling_profiler_report)>(*this,lib,"sampling_profiler_report",
+            SideEffects::accessExternal, "sampling_profiler_report")
+                ->args({"context","line"});
         // das string binding
         addAnnotation(make_smart<DasStringTypeAnnotation>());
         addExtern<DAS_BIND_FUN(to_das_string)>(*this, lib, "string",
@@ -1370,5 +1544,24 @@ namespace das
         addExtern<DAS_BIND_FUN(das_is_jit_function)>(*this, lib, "is_jit_function",
             SideEffects::worstDefault, "das_is_jit_function")
                 ->args({"function"});
+        addExtern<DAS_BIND_FUN(das_jit_compile)>(*this, lib, "jit_compile",
+            SideEffects::worstDefault, "das_jit_compile")
+                ->args({"function","context"})->unsafeOperation = true;
+        addExtern<DAS_BIND_FUN(das_jit_is_supported)>(*this, lib, "jit_is_supported",
+            SideEffects::none, "das_jit_is_supported");
+        auto jtier = addExtern<DAS_BIND_FUN(das_jit_tiering)>(*this, lib, "jit_tiering",
+            SideEffects::modifyExternal, "das_jit_tiering")
+                ->args({"enable","call_threshold","loop_threshold","context"});
+        jtier->arguments[1]->init = make_smart<ExprConstInt>(1000);
+        jtier->arguments[2]->init = make_smart<ExprConstInt>(100000);
+        addExtern<DAS_BIND_FUN(das_jit_tiering_wait)>(*this, lib, "jit_tiering_wait",
+            SideEffects::modifyExternal, "das_jit_tiering_wait")
+                ->arg("context");
+        addExtern<DAS_BIND_FUN(das_jit_tiering_stats)>(*this, lib, "jit_tiering_stats",
+            SideEffects::modifyExternal, "das_jit_tiering_stats")
+                ->args({"block","context","line"});
+        addExtern<DAS_BIND_FUN(das_jit_tiering_report)>(*this, lib, "jit_tiering_report",
+            SideEffects::modifyExternal, "das_jit_tiering_report")
+                ->arg("context");
     }
 }
@@ -33,6 +33,12 @@ extern "C" int get_time_usec ( int64_t reft ) {
     return (int)(((t0-reft)*1000000) / freq.QuadPart);
 }
 
+extern "C" double ref_time_delta_to_usec ( int64_t ticks ) {
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+    return double(ticks) * 1000000.0 / double(freq.QuadPart);
+}
+
 #elif __linux__ || defined(_EMSCRIPTEN_VER)
 
 #include <time.h>
@@ -53,6 +59,10 @@ extern "C" int get_time_usec ( int64_t reft ) {
     return (int) ((ref_time_ticks() - reft) / (NSEC_IN_SEC/1000000));
 }
 
+extern "C" double ref_time_delta_to_usec ( int64_t ticks ) {
+    return double(ticks) / double(NSEC_IN_SEC/1000000);
+}
+
 #else // osx
 
 #include <mach/mach.h>
@@ -69,4 +79,10 @@ extern "C" int get_time_usec ( int64_t reft ) {
     return relt * s_timebase_info.numer/s_timebase_info.denom/1000;
 }
 
+extern "C" double ref_time_delta_to_usec ( int64_t ticks ) {
+    mach_timebase_info_data_t s_timebase_info;
+    mach_timebase_info(&s_timebase_info);
+    return double(ticks) * s_timebase_info.numer / s_timebase_info.denom / 1000.0;
+}
+
 #endif
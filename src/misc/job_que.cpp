@@ -4,19 +4,34 @@
 
 namespace das {
 
+    // worker thread of which JobQue, if any, is running on this thread
+    static DAS_THREAD_LOCAL JobQue * tl_jobQue = nullptr;
+    static DAS_THREAD_LOCAL int tl_jobQueThreadIndex = -1;
+
     JobQue::JobQue()
-        : mSleepMs(1)
-        , mShutdown(false)
-        , mThreadCount( 0 )
-        , mJobsRunning(0) {
-        mThreadCount = max(1,(static_cast<int>(thread::hardware_concurrency())));
+        : mSleepMs(1) {
+        start(max(1,(static_cast<int>(thread::hardware_concurrency()))));
+    }
+
+    JobQue::JobQue( int threadCount )
+        : mSleepMs(1) {
+        start(max(1,threadCount));
+    }
+
+    void JobQue::start ( int threadCount ) {
+        for ( auto & cq : mCategoryQueued ) cq = 0;
+        mThreadCount = threadCount;
         SetCurrentThreadPriority(JobPriority::High);
-        for (int j = 0; j < mThreadCount; j++) {
-            mThreads.emplace_back(make_unique<thread>([=]() {
+        // all entries need to exist before any worker starts stealing
+        for (int j = 0; j < threadCount; j++) {
+            mThreads.emplace_back(make_unique<ThreadEntry>());
+        }
+        for (int j = 0; j < threadCount; j++) {
+            mThreads[j]->threadPointer = make_unique<thread>([=]() {
                 string thread_name = "JobQue_Job_" + to_string(j);
                 SetCurrentThreadName(thread_name);
                 job(j);
-            }));
+            });
         }
     }
 
@@ -51,18 +66,30 @@ namespace das {
 
     void JobQue::join() {
         mShutdown = true;
+        {
+            lock_guard<mutex> lock(mSleepMutex);
+            mCond.notify_all();
+        }
         while ( mThreadCount ) {
             this_thread::yield();
         }
         for (auto & th : mThreads) {
-            th.threadPointer->join();
+            th->threadPointer->join();
+        }
+        // jobs which never got to run
+        for ( auto & th : mThreads ) {
+            for ( int pi=0; pi!=NumPriorities; ++pi ) {
+                JobEntry * entry = nullptr;
+                while ( th->local[pi].pop(entry) ) delete entry;
+                for ( auto e : th->inbox[pi] ) delete e;
+            }
         }
         mThreads.clear();
     }
 
     bool JobQue::isEmpty ( bool includingMainThreadJobs ) {
-        lock_guard<mutex> lock(mFifoMutex);
-        bool queue_is_empty = (mJobsRunning == 0) && (mFifo.size() == 0);
+        // order matters. job is counted as running before it stops being counted as queued
+        bool queue_is_empty = (mJobsQueued == 0) && (mJobsRunning == 0);
         if ( includingMainThreadJobs ) {
             lock_guard<mutex> mainThreadLock(mEvalMainThreadMutex);
             return queue_is_empty && mEvalMainThread.empty();
@@ -71,13 +98,11 @@ namespace das {
     }
 
     bool JobQue::areJobsPending(JobCategory category) {
-        lock_guard<mutex> lock(mFifoMutex);
-        if (find_if(mFifo.begin(), mFifo.end(), [=](const JobEntry& jobEntry) {
-                return jobEntry.category == category; }) != mFifo.end()) {
+        if ( mCategoryQueued[category % NumCategorySlots] != 0 ) {
             return true;
         }
-        if (find_if(mThreads.begin(), mThreads.end(), [=](const ThreadEntry& threadEntry) {
-                return threadEntry.currentPriority != JobPriority::Inactive && threadEntry.currentCategory == category; }) != mThreads.end()) {
+        if (find_if(mThreads.begin(), mThreads.end(), [=](const unique_ptr<ThreadEntry> & threadEntry) {
+                return threadEntry->currentPriority != JobPriority::Inactive && threadEntry->currentCategory == category; }) != mThreads.end()) {
             return true;
         }
         return false;
@@ -88,47 +113,118 @@ namespace das {
     }
 
     int JobQue::getNumberOfQueuedJobs() {
-        lock_guard<mutex> lock(mFifoMutex);
-        return int(mFifo.size());
+        return mJobsQueued;
     }
 
     void JobQue::submit(Job && job, JobCategory category, JobPriority priority) {
-        auto  it = lower_bound(mFifo.begin(), mFifo.end(), priority, [](const JobEntry& lhs, JobPriority priority) {
-            return lhs.priority >= priority; });
-        mFifo.emplace(it, move(job), category, priority);
+        auto entry = new JobEntry(move(job), category, priority);
+        int pi = priorityIndex(priority);
+        mCategoryQueued[category % NumCategorySlots] ++;
+        mJobsQueued ++;
+        if ( tl_jobQue==this ) {
+            mThreads[tl_jobQueThreadIndex]->local[pi].push(entry);
+        } else {
+            auto & th = *mThreads[mNextInbox++ % uint32_t(mThreads.size())];
+            lock_guard<mutex> lock(th.inboxMutex);
+            th.inbox[pi].push_back(entry);
+            th.inboxCount ++;
+        }
+    }
+
+    void JobQue::wakeUp ( int count ) {
+        if ( mSleeping ) {
+            lock_guard<mutex> lock(mSleepMutex);
+            if ( count==1 ) {
+                mCond.notify_one();
+            } else {
+                mCond.notify_all();
+            }
+        }
     }
 
     void JobQue::push(Job && job, JobCategory category, JobPriority priority) {
-        lock_guard<mutex> lock(mFifoMutex);
         submit(move(job), category, priority);
-        mCond.notify_one();
+        wakeUp(1);
+    }
+
+    JobQue::JobEntry * JobQue::popInbox ( ThreadEntry & th, int pi, bool wait ) {
+        if ( !th.inboxCount ) return nullptr;
+        unique_lock<mutex> lock(th.inboxMutex, defer_lock);
+        if ( wait ) {
+            lock.lock();
+        } else if ( !lock.try_lock() ) {
+            return nullptr;
+        }
+        auto & inbox = th.inbox[pi];
+        if ( inbox.empty() ) return nullptr;
+        auto entry = inbox.front();
+        inbox.pop_front();
+        th.inboxCount --;
+        return entry;
+    }
+
+    JobQue::JobEntry * JobQue::fetch ( int threadIndex, uint32_t & seed ) {
+        auto & self = *mThreads[threadIndex];
+        int numThreads = int(mThreads.size());
+        JobEntry * entry = nullptr;
+        for ( int pi=NumPriorities-1; pi>=0; --pi ) {
+            if ( self.local[pi].pop(entry) ) return entry;
+            if ( (entry = popInbox(self, pi, true)) ) return entry;
+            if ( numThreads==1 ) continue;
+            // xorshift, to pick where to start stealing
+            seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+            int victim = int(seed % uint32_t(numThreads));
+            for ( int k=0; k!=numThreads; ++k, victim=(victim+1)%numThreads ) {
+                if ( victim==threadIndex ) continue;
+                auto & other = *mThreads[victim];
+                if ( other.local[pi].steal(entry) || (entry = popInbox(other, pi, false)) ) {
+                    mTotalSteals ++;
+                    return entry;
+                }
+            }
+        }
+        return nullptr;
     }
 
     void JobQue::job(int threadIndex) {
+        tl_jobQue = this;
+        tl_jobQueThreadIndex = threadIndex;
+        auto & self = *mThreads[threadIndex];
+        uint32_t seed = 2463534242u + uint32_t(threadIndex) * 747796405u;
+        JobPriority threadPriority = JobPriority::Inactive;
+        const int maxSpins = 64;
+        int spins = 0;
         while (!mShutdown) {
-            Job job;
-            {
-                unique_lock<mutex> lock(mFifoMutex);
-                if ( mCond.wait_for(lock, chrono::milliseconds(mSleepMs), [&]() { return mFifo.size() != 0; }) ) {
-                    DAS_ASSERTF(mFifo.size() > 0, "There must be at least one job available");
-                    job = move(mFifo.front().function);
-                    mThreads[threadIndex].currentPriority = mFifo.front().priority;
-                    mThreads[threadIndex].currentCategory = mFifo.front().category;
-                    mFifo.pop_front();
-                    mJobsRunning++;
-                } else {
+            JobEntry * entry = fetch(threadIndex, seed);
+            if ( !entry ) {
+                if ( ++spins < maxSpins ) {
                     this_thread::yield();
                     continue;
                 }
+                spins = 0;
+                unique_lock<mutex> lock(mSleepMutex);
+                mSleeping ++;
+                mCond.wait_for(lock, chrono::milliseconds(mSleepMs), [&]() { return mJobsQueued!=0 || mShutdown; });
+                mSleeping --;
+                continue;
             }
-            SetCurrentThreadPriority(mThreads[threadIndex].currentPriority);
-            job();
-            {
-                unique_lock<mutex> lock(mFifoMutex);
-                mThreads[threadIndex].currentPriority = JobPriority::Inactive;
-                mJobsRunning--;
+            spins = 0;
+            self.currentCategory = entry->category;
+            self.currentPriority = entry->priority;
+            mJobsRunning++;
+            mJobsQueued--;
+            mCategoryQueued[entry->category % NumCategorySlots] --;
+            if ( threadPriority != entry->priority ) {
+                threadPriority = entry->priority;
+                SetCurrentThreadPriority(threadPriority);
             }
+            entry->function();
+            delete entry;
+            self.currentPriority = JobPriority::Inactive;
+            mJobsRunning--;
         }
+        tl_jobQue = nullptr;
+        tl_jobQueThreadIndex = -1;
         mThreadCount--;
     }
 
@@ -145,18 +241,15 @@ namespace das {
         int onMainThread = max ( (numChunks + mThreadCount)  / (mThreadCount+1), 1 );
         int onThreads  = numChunks - onMainThread;
         status.Clear(onThreads);
-        {
-            lock_guard<mutex> lock(mFifoMutex);
-            for (int ch = 0; ch < onThreads; ++ch) {
-                int i0 = from + ch * step;
-                int i1 = i0 + step;
-                submit([=,&status](){
-                    chunk(i0, i1);
-                    status.Notify();
-                }, category, priority);
-            }
-            mCond.notify_all();
+        for (int ch = 0; ch < onThreads; ++ch) {
+            int i0 = from + ch * step;
+            int i1 = i0 + step;
+            submit([=,&status](){
+                chunk(i0, i1);
+                status.Notify();
+            }, category, priority);
         }
+        wakeUp(onThreads);
         chunk(from + onThreads * step, to);
     }
 
@@ -180,22 +273,19 @@ namespace das {
         deque<Job> producerFifoJobs;
         mutex producerFifoMutex;
         condition_variable condition;
-        {
-            lock_guard<mutex> lock(mFifoMutex);
-            for (int ch = 0; ch < numChunks; ++ch) {
-                int i0 = from + ch * step;
-                int i1 = min(i0 + step, to);
-                submit([=, &chunk, &producerFifoJobs, &producerFifoMutex, &condition]() {
-                    chunk(i0, i1);
-                    {
-                        lock_guard<mutex> producerFifoLock(producerFifoMutex);
-                        producerFifoJobs.push_back(([=]() { consume(i0, i1); }));
-                        condition.notify_one();
-                    }
-                }, category, priority);
-            }
-            mCond.notify_all();
+        for (int ch = 0; ch < numChunks; ++ch) {
+            int i0 = from + ch * step;
+            int i1 = min(i0 + step, to);
+            submit([=, &chunk, &producerFifoJobs, &producerFifoMutex, &condition]() {
+                chunk(i0, i1);
+                {
+                    lock_guard<mutex> producerFifoLock(producerFifoMutex);
+                    producerFifoJobs.push_back(([=]() { consume(i0, i1); }));
+                    condition.notify_one();
+                }
+            }, category, priority);
         }
+        wakeUp(numChunks);
         {
             int chunksRemaining = numChunks;
             while (chunksRemaining > 0) {
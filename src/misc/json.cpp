@@ -0,0 +1,419 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/misc/json.h"
+
+namespace das {
+
+    int32_t JsonDocument::maxDepth = 1024;
+
+    static __forceinline bool isJsonWhiteSpace ( char ch ) {
+        return ch==' ' || ch=='\n' || ch=='\r' || ch=='\t';
+    }
+
+    static __forceinline bool isJsonDigit ( char ch ) {
+        return ch>='0' && ch<='9';
+    }
+
+    const char * JsonDocument::typeName ( JsonType type ) {
+        switch ( type ) {
+            case JsonType::null_value:  return "null";
+            case JsonType::boolean:     return "boolean";
+            case JsonType::number:      return "number";
+            case JsonType::string:      return "string";
+            case JsonType::array:       return "array";
+            case JsonType::object:      return "object";
+        }
+        return "unknown";
+    }
+
+    string JsonDocument::location ( uint32_t offset ) const {
+        uint32_t line = 1, column = 1;
+        for ( const char * it = text, * end = text + offset; it!=end; ++it ) {
+            if ( *it=='\n' ) {
+                line ++;
+                column = 1;
+            } else {
+                column ++;
+            }
+        }
+        return "line " + to_string(line) + ", column " + to_string(column);
+    }
+
+    string JsonDocument::describe ( uint32_t index ) const {
+        return location(nodes[index].offset);
+    }
+
+    const char * JsonDocument::fail ( const char * it, const char * message ) {
+        error = location(uint32_t(it - text)) + ": " + message;
+        return nullptr;
+    }
+
+    const char * JsonDocument::skipWhiteSpace ( const char * it ) const {
+        while ( it!=textEnd && isJsonWhiteSpace(*it) ) {
+#if _TARGET_SIMD_SSE
+            // long runs (indentation of the pretty printed text) are skipped 16 bytes at a time
+            if ( textEnd - it >= 16 && isJsonWhiteSpace(it[1]) ) {
+                __m128i v = _mm_loadu_si128((const __m128i *)it);
+                __m128i ws = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))),
+                    _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))));
+                uint32_t mask = ~uint32_t(_mm_movemask_epi8(ws)) & 0xffff;
+                if ( mask ) return it + das_ctz(mask);
+                it += 16;
+                continue;
+            }
+#endif
+            it ++;
+        }
+        return it;
+    }
+
+    static __forceinline int32_t hexDigit ( char ch ) {
+        if ( ch>='0' && ch<='9' ) return ch - '0';
+        if ( ch>='a' && ch<='f' ) return ch - 'a' + 10;
+        if ( ch>='A' && ch<='F' ) return ch - 'A' + 10;
+        return -1;
+    }
+
+    static const char * parseHex4 ( const char * it, const char * end, uint32_t & code ) {
+        if ( end - it < 4 ) return nullptr;
+        code = 0;
+        for ( int i=0; i!=4; ++i ) {
+            int32_t d = hexDigit(it[i]);
+            if ( d<0 ) return nullptr;
+            code = (code << 4) | uint32_t(d);
+        }
+        return it + 4;
+    }
+
+    static char * writeUtf8 ( char * out, uint32_t code ) {
+        if ( code < 0x80 ) {
+            *out++ = char(code);
+        } else if ( code < 0x800 ) {
+            *out++ = char(0xc0 | (code >> 6));
+            *out++ = char(0x80 | (code & 0x3f));
+        } else if ( code < 0x10000 ) {
+            *out++ = char(0xe0 | (code >> 12));
+            *out++ = char(0x80 | ((code >> 6) & 0x3f));
+            *out++ = char(0x80 | (code & 0x3f));
+        } else {
+            *out++ = char(0xf0 | (code >> 18));
+            *out++ = char(0x80 | ((code >> 12) & 0x3f));
+            *out++ = char(0x80 | ((code >> 6) & 0x3f));
+            *out++ = char(0x80 | (code & 0x3f));
+        }
+        return out;
+    }
+
+    // unescaped string is never longer than its text, so the arena can't overflow
+    // 16 byte blocks are copied as they are, and then cut at the first quote, escape, or control character
+    const char * JsonDocument::parseString ( const char * it, JsonNode & node ) {
+        it ++;
+        char * out = arenaTop;
+        node.type = JsonType::string;
+        node.str = out;
+        for ( ;; ) {
+#if _TARGET_SIMD_SSE
+            while ( textEnd - it >= 16 ) {
+                __m128i v = _mm_loadu_si128((const __m128i *)it);
+                _mm_storeu_si128((__m128i *)out, v);
+                __m128i special = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))),
+                    _mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8(0x1f)), v));
+                uint32_t mask = uint32_t(_mm_movemask_epi8(special));
+                if ( mask ) {
+                    uint32_t n = das_ctz(mask);
+                    it += n;
+                    out += n;
+                    break;
+                }
+                it += 16;
+                out += 16;
+            }
+#endif
+            if ( it==textEnd ) return fail(it, "string exceeds text");
+            char ch = *it;
+            if ( ch=='"' ) break;
+            if ( uint8_t(ch) < 0x20 ) return fail(it, "control character in string");
+            if ( ch!='\\' ) {
+                *out++ = ch;
+                it ++;
+                continue;
+            }
+            if ( ++it==textEnd ) return fail(it, "string escape sequence exceeds text");
+            ch = *it++;
+            switch ( ch ) {
+                case 'b':   *out++ = '\b'; break;
+                case 'f':   *out++ = '\f'; break;
+                case 'n':   *out++ = '\n'; break;
+                case 'r':   *out++ = '\r'; break;
+                case 't':   *out++ = '\t'; break;
+                case 'u': {
+                        uint32_t code;
+                        auto hexEnd = parseHex4(it, textEnd, code);
+                        if ( !hexEnd ) return fail(it, "invalid \\u escape sequence");
+                        it = hexEnd;
+                        if ( code>=0xd800 && code<=0xdbff ) {
+                            uint32_t low;
+                            if ( textEnd - it < 6 || it[0]!='\\' || it[1]!='u' || !parseHex4(it+2, textEnd, low)
+                                    || low<0xdc00 || low>0xdfff ) {
+                                return fail(it, "invalid surrogate pair");
+                            }
+                            it += 6;
+                            code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+                        }
+                        out = writeUtf8(out, code);
+                    }
+                    break;
+                default:    *out++ = ch; break;    // \" \\ \/, and anything else is passed as is
+            }
+        }
+        node.count = uint32_t(out - node.str);
+        *out++ = 0;
+        arenaTop = out;
+        return it + 1;
+    }
+
+    static const double g_pow10[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    // integers, and numbers with up to 15 significant digits and a small exponent are exact in doubles
+    // everything else goes to strtod
+    const char * JsonDocument::parseNumber ( const char * it, JsonNode & node ) {
+        const char * start = it;
+        node.type = JsonType::number;
+        bool negative = false;
+        if ( *it=='-' ) {
+            negative = true;
+            it ++;
+        } else if ( *it=='+' ) {
+            it ++;
+        }
+        uint64_t mantissa = 0;
+        int32_t digits = 0, significant = 0, exponent = 0;
+        bool integer = true;
+        for ( ; it!=textEnd && isJsonDigit(*it); ++it, ++digits ) {
+            if ( significant < 19 ) {
+                mantissa = mantissa * 10 + uint64_t(*it - '0');
+                if ( mantissa ) significant ++;
+            } else {
+                exponent ++;
+                significant ++;
+            }
+        }
+        if ( it!=textEnd && *it=='.' ) {
+            integer = false;
+            for ( ++it; it!=textEnd && isJsonDigit(*it); ++it, ++digits ) {
+                if ( significant < 19 ) {
+                    mantissa = mantissa * 10 + uint64_t(*it - '0');
+                    exponent --;
+                    if ( mantissa ) significant ++;
+                } else {
+                    significant ++;
+                }
+            }
+        }
+        if ( !digits ) return fail(start, "invalid number");
+        if ( it!=textEnd && (*it=='e' || *it=='E') ) {
+            integer = false;
+            ++it;
+            bool negativeExp = false;
+            if ( it!=textEnd && (*it=='+' || *it=='-') ) {
+                negativeExp = *it=='-';
+                ++it;
+            }
+            if ( it==textEnd || !isJsonDigit(*it) ) return fail(start, "invalid number exponent");
+            int32_t exp = 0;
+            for ( ; it!=textEnd && isJsonDigit(*it); ++it ) {
+                if ( exp < 100000 ) exp = exp * 10 + (*it - '0');
+            }
+            exponent += negativeExp ? -exp : exp;
+        }
+        if ( integer && significant<=18 ) {
+            node.isInteger = true;
+            node.integer = negative ? -int64_t(mantissa) : int64_t(mantissa);
+            node.number = double(node.integer);
+        } else if ( significant<=15 && exponent>=-22 && exponent<=22 ) {
+            double value = double(mantissa);
+            value = exponent<0 ? value / g_pow10[-exponent] : value * g_pow10[exponent];
+            node.number = negative ? -value : value;
+        } else {
+            string num(start, it);
+            node.number = strtod(num.c_str(), nullptr);
+        }
+        return it;
+    }
+
+    const char * JsonDocument::parseValue ( const char * it, int32_t depth ) {
+        it = skipWhiteSpace(it);
+        if ( it==textEnd ) return fail(it, "unexpected end of text");
+        uint32_t index = uint32_t(nodes.size());
+        nodes.emplace_back();
+        nodes[index].offset = uint32_t(it - text);
+        char ch = *it;
+        if ( ch=='{' || ch=='[' ) {
+            if ( depth>=maxDepth ) return fail(it, "nesting is too deep");
+            bool isObject = ch=='{';
+            char closing = isObject ? '}' : ']';
+            nodes[index].type = isObject ? JsonType::object : JsonType::array;
+            uint32_t count = 0;
+            it = skipWhiteSpace(it + 1);
+            if ( it!=textEnd && *it==closing ) {
+                it ++;
+            } else {
+                for ( ;; ) {
+                    if ( isObject ) {
+                        it = skipWhiteSpace(it);
+                        if ( it==textEnd || *it!='"' ) return fail(it, "expecting string key");
+                        uint32_t keyIndex = uint32_t(nodes.size());
+                        nodes.emplace_back();
+                        nodes[keyIndex].offset = uint32_t(it - text);
+                        it = parseString(it, nodes[keyIndex]);
+                        if ( !it ) return nullptr;
+                        nodes[keyIndex].next = keyIndex + 1;
+                        it = skipWhiteSpace(it);
+                        if ( it==textEnd || *it!=':' ) return fail(it, "expecting ':'");
+                        it ++;
+                    }
+                    it = parseValue(it, depth + 1);
+                    if ( !it ) return nullptr;
+                    count ++;
+                    it = skipWhiteSpace(it);
+                    if ( it==textEnd ) return fail(it, "unexpected end of text");
+                    if ( *it==',' ) {
+                        it ++;
+                    } else if ( *it==closing ) {
+                        it ++;
+                        break;
+                    } else {
+                        return fail(it, isObject ? "expecting ',' or '}'" : "expecting ',' or ']'");
+                    }
+                }
+            }
+            nodes[index].count = count;
+        } else if ( ch=='"' ) {
+            it = parseString(it, nodes[index]);
+            if ( !it ) return nullptr;
+        } else if ( ch=='-' || ch=='+' || isJsonDigit(ch) ) {
+            it = parseNumber(it, nodes[index]);
+            if ( !it ) return nullptr;
+        } else if ( textEnd - it >= 4 && memcmp(it, "true", 4)==0 ) {
+            nodes[index].type = JsonType::boolean;
+            nodes[index].boolean = true;
+            it += 4;
+        } else if ( textEnd - it >= 5 && memcmp(it, "false", 5)==0 ) {
+            nodes[index].type = JsonType::boolean;
+            it += 5;
+        } else if ( textEnd - it >= 4 && memcmp(it, "null", 4)==0 ) {
+            it += 4;
+        } else {
+            string message = "invalid character '";
+            message += ch;
+            message += "'";
+            return fail(it, message.c_str());
+        }
+        nodes[index].next = uint32_t(nodes.size());
+        return it;
+    }
+
+    bool JsonDocument::parse ( const char * txt, uint32_t length ) {
+        text = txt ? txt : "";
+        textEnd = text + length;
+        error.clear();
+        nodes.clear();
+        nodes.reserve(length/16 + 16);
+        if ( arena.size() < length + 32 ) arena.resize(length + 32);
+        arenaTop = arena.data();
+        const char * it = parseValue(text, 0);
+        if ( !it ) return false;
+        it = skipWhiteSpace(it);
+        if ( it!=textEnd ) {
+            fail(it, "unexpected text after the value");
+            return false;
+        }
+        return true;
+    }
+
+    void JsonWriter::writeString ( const char * str, uint32_t length ) {
+        static const char * hex = "0123456789abcdef";
+        writeChar('"');
+        const char * run = str;
+        for ( const char * it = str, * end = str + length; it!=end; ++it ) {
+            uint8_t ch = uint8_t(*it);
+            if ( ch>=0x20 && ch!='"' && ch!='\\' ) continue;
+            writeRaw(run, uint32_t(it - run));
+            run = it + 1;
+            switch ( ch ) {
+                case '"':   writeRaw("\\\"", 2); break;
+                case '\\':  writeRaw("\\\\", 2); break;
+                case '\b':  writeRaw("\\b", 2); break;
+                case '\f':  writeRaw("\\f", 2); break;
+                case '\n':  writeRaw("\\n", 2); break;
+                case '\r':  writeRaw("\\r", 2); break;
+                case '\t':  writeRaw("\\t", 2); break;
+                default: {
+                        char esc[6] = { '\\', 'u', '0', '0', hex[ch>>4], hex[ch&15] };
+                        writeRaw(esc, 6);
+                    }
+                    break;
+            }
+        }
+        writeRaw(run, uint32_t(str + length - run));
+        writeChar('"');
+    }
+
+    void JsonWriter::writeInteger ( int64_t value ) {
+        if ( value < 0 ) {
+            writeChar('-');
+            writeUnsigned(uint64_t(0) - uint64_t(value));
+        } else {
+            writeUnsigned(uint64_t(value));
+        }
+    }
+
+    void JsonWriter::writeUnsigned ( uint64_t value ) {
+        char buf[24];
+        char * at = buf + sizeof(buf);
+        do {
+            *--at = char('0' + value % 10);
+            value /= 10;
+        } while ( value );
+        writeRaw(at, uint32_t(buf + sizeof(buf) - at));
+    }
+
+    // shortest of %.15g, %.16g and %.17g, which reads back as the same double
+    void JsonWriter::writeNumber ( double value ) {
+        if ( value!=value || value==HUGE_VAL || value==-HUGE_VAL ) {
+            writeNull();
+        } else if ( value>-9007199254740992.0 && value<9007199254740992.0 && value==double(int64_t(value)) ) {
+            writeInteger(int64_t(value));
+        } else {
+            char buf[32];
+            int len = 0;
+            for ( int precision=15; precision<=17; ++precision ) {
+                len = snprintf(buf, sizeof(buf), "%.*g", precision, value);
+                if ( precision==17 || strtod(buf, nullptr)==value ) break;
+            }
+            writeRaw(buf, uint32_t(len));
+        }
+    }
+
+    // shortest text, which reads back into the same float
+    void JsonWriter::writeFloat ( float value ) {
+        if ( value!=value || value==HUGE_VALF || value==-HUGE_VALF ) {
+            writeNull();
+        } else if ( value>-16777216.0f && value<16777216.0f && value==float(int32_t(value)) ) {
+            writeInteger(int32_t(value));
+        } else {
+            char buf[32];
+            int len = 0;
+            for ( int precision=6; precision<=9; ++precision ) {
+                len = snprintf(buf, sizeof(buf), "%.*g", precision, double(value));
+                if ( precision==9 || strtof(buf, nullptr)==value ) break;
+            }
+            writeRaw(buf, uint32_t(len));
+        }
+    }
+}
@@ -18,9 +18,16 @@ namespace das {
         alignMask = 15;
         totalAllocated = 0;
         maxAllocated = 0;
+        for ( uint32_t si=0; si!=DAS_MAX_SHOE_CUNKS; ++si ) {
+            freeList[si] = nullptr;
+            freeListSize[si] = 0;
+        }
     }
 
     MemoryModel::~MemoryModel() {
+        for ( uint32_t si=0; si!=DAS_MAX_SHOE_CUNKS; ++si ) {
+            if ( freeList[si] ) das_aligned_free16(freeList[si]);
+        }
         shoe.clear();
         for ( auto & itb : bigStuff ) {
             das_aligned_free16(itb.first);
@@ -60,11 +67,19 @@ namespace das {
         size = (size + alignMask) & ~alignMask;
         totalAllocated += size;
         maxAllocated = das::max(maxAllocated, totalAllocated);
+        totalAllocations ++;
 #if !DAS_TRACK_ALLOCATIONS
+        if ( size <= DAS_MAX_SHOE_ALLOCATION && !marking ) {
+            uint32_t si = (((size + 15) & ~15) >> 4) - 1;
+            if ( freeListSize[si] ) {       // fast path, block is still allocated in its deck
+                freeListHits ++;
+                return freeList[si][--freeListSize[si]];
+            }
+        }
         if ( size > DAS_MAX_SHOE_ALLOCATION ) {
 #endif
             char * ptr = (char *) das_aligned_alloc16(size);
-            bigStuff[ptr] = size;
+            bigStuff[ptr] = marking ? (size | DAS_PAGE_GC_MASK) : size;
 #if DAS_TRACK_ALLOCATIONS
             if ( g_tracker==g_breakpoint ) os_debug_break();
             bigStuffId[ptr] = g_tracker ++;
@@ -79,7 +94,7 @@ namespace das {
             DAS_ASSERT(size && size<=DAS_MAX_SHOE_ALLOCATION);
             uint32_t si = (size >> 4) - 1;
             uint32_t total = grow(si);
-            shoe.chunks[si] = new Deck(total, size, shoe.chunks[si]);
+            shoe.addDeck(si, new Deck(total, size, nullptr));
             return shoe.chunks[si]->allocate();
         }
 #endif
@@ -88,13 +103,21 @@ namespace das {
     bool MemoryModel::free ( char * ptr, uint32_t size ) {
         if ( !size ) return true;
         size = (size + alignMask) & ~alignMask;
-
+        totalFrees ++;
 #if DAS_SANITIZER
         memset(ptr, 0xcd, size);
 #endif
 #if !DAS_TRACK_ALLOCATIONS
         if ( size <= DAS_MAX_SHOE_ALLOCATION ) {
-            shoe.free(ptr, size);
+            uint32_t si = (((size + 15) & ~15) >> 4) - 1;
+            // the stack holds pointers only, so that freed blocks are not touched until they are reused
+            if ( freeListSize[si] < das::min(freeListLimit, uint32_t(DAS_FREE_LIST_LIMIT)) && !marking ) {
+                DAS_ASSERT(shoe.isOwnPtr(ptr, (si+1)<<4) && "freeing pointer, which is not ours (or size mismatch)");
+                if ( !freeList[si] ) freeList[si] = (char **) das_aligned_alloc16(DAS_FREE_LIST_LIMIT * sizeof(char *));
+                freeList[si][freeListSize[si]++] = ptr;
+            } else {
+                shoe.free(ptr, size);
+            }
             totalAllocated -= size;
             return true;
         }
@@ -107,7 +130,7 @@ namespace das {
 #endif
         auto itb = bigStuff.find(ptr);
         if ( itb!=bigStuff.end() ) {
-            DAS_ASSERTF(itb->second==size, "free size mismatch, %u allocated vs %u freed", itb->second, size );
+            DAS_ASSERTF((itb->second & ~DAS_PAGE_GC_MASK)==size, "free size mismatch, %u allocated vs %u freed", itb->second & ~DAS_PAGE_GC_MASK, size );
 #if DAS_SANITIZER
             deletedBigStuff[itb->first] = itb->second;
 #else
@@ -147,7 +170,38 @@ namespace das {
         return nptr;
     }
 
+    void MemoryModel::flushFreeLists() {
+        for ( uint32_t si=0; si!=DAS_MAX_SHOE_CUNKS; ++si ) {
+            for ( uint32_t i=0; i!=freeListSize[si]; ++i ) {
+                shoe.free(freeList[si][i], (si+1)<<4);
+            }
+            freeListSize[si] = 0;
+        }
+    }
+
+    void MemoryModel::getStats ( AllocationStats & stats ) const {
+        uint32_t depth = 0;
+        shoe.getStats(depth, stats.decks, stats.bytesAllocated, stats.bytesReserved);
+        stats.bytesInFreeLists = 0;
+        for ( uint32_t si=0; si!=DAS_MAX_SHOE_CUNKS; ++si ) {
+            stats.bytesInFreeLists += uint64_t(freeListSize[si]) * ((si+1)<<4);
+        }
+        stats.bytesAllocated -= stats.bytesInFreeLists;
+        stats.bigAllocations = uint32_t(bigStuff.size());
+        for ( const auto & it : bigStuff ) {
+            uint64_t bytes = it.second & ~DAS_PAGE_GC_MASK;
+            stats.bytesAllocated += bytes;
+            stats.bytesReserved += bytes;
+        }
+        stats.allocations = totalAllocations;
+        stats.frees = totalFrees;
+        stats.freeListHits = freeListHits;
+    }
+
     void MemoryModel::reset() {
+        for ( uint32_t si=0; si!=DAS_MAX_SHOE_CUNKS; ++si ) {     // decks are reset, cached blocks go with them
+            freeListSize[si] = 0;
+        }
         for ( auto & itb : bigStuff ) {
 #if DAS_SANITIZER
             deletedBigStuff[itb.first] = itb.second;
@@ -172,7 +226,22 @@ namespace das {
         return mem;
     }
 
+    void MemoryModel::beforeGC() {
+        flushFreeLists();       // cached blocks are free, sweep has to see them that way
+        shoe.beforeGC();
+        marking = true;
+    }
+
+    void MemoryModel::abortGC() {
+        shoe.abortGC();
+        for ( auto & it : bigStuff ) {
+            it.second &= ~DAS_PAGE_GC_MASK;
+        }
+        marking = false;
+    }
+
     void MemoryModel::sweep() {
+        marking = false;
         totalAllocated = 0;
 #if !DAS_TRACK_ALLOCATIONS
         for ( uint32_t si=0; si!=DAS_MAX_SHOE_CUNKS; ++si ) {   // we re-track all small allocations
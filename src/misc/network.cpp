@@ -13,6 +13,8 @@
 #pragma comment (lib, "Mswsock.lib")
 #pragma comment (lib, "AdvApi32.lib")
 
+#define poll WSAPoll
+
 #else
 
 #ifdef __NINTENDO__
@@ -21,10 +23,18 @@
 
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <unistd.h>
 #include <errno.h>
 #include <fcntl.h>
 
+#if defined(__linux__)
+#include <sys/epoll.h>
+#define DAS_NETWORK_EPOLL   1
+#else
+#include <poll.h>
+#endif
+
 #define closesocket close
 
 #ifdef __APPLE__
@@ -209,4 +219,425 @@ namespace das {
     bool Server::is_connected() const {
         return client_fd > 0;
     }
+
+    // MultiServer
+
+#ifndef DAS_NETWORK_EPOLL
+#define DAS_NETWORK_EPOLL   0
+#endif
+
+#ifdef MSG_NOSIGNAL
+    #define DAS_SEND_FLAGS  MSG_NOSIGNAL
+#else
+    #define DAS_SEND_FLAGS  0
+#endif
+
+    static int socket_error() {
+#ifdef _WIN32
+        return WSAGetLastError();
+#else
+        return errno;
+#endif
+    }
+
+    static bool would_block ( int err ) {
+#ifdef _WIN32
+        return err==WSAEWOULDBLOCK;
+#else
+        return err==EAGAIN || err==EWOULDBLOCK || err==EINTR;
+#endif
+    }
+
+    MultiServer::MultiServer() {
+        server_fd = socket_t(-1);
+    }
+
+    MultiServer::~MultiServer() {
+        for ( auto & it : connections ) {
+            closesocket(it.second.fd);
+        }
+        connections.clear();
+#if DAS_NETWORK_EPOLL
+        if ( poll_fd>=0 ) ::close(poll_fd);
+#endif
+        if ( !invalid_socket(server_fd) ) {
+            closesocket(server_fd);
+        }
+    }
+
+    bool MultiServer::init ( int p, NetworkFraming fr ) {
+        if ( !invalid_socket(server_fd) ) {
+            onError("already initialized", -1);
+            return false;
+        }
+        framing = fr;
+        server_fd = socket(AF_INET, SOCK_STREAM, 0);
+        if ( invalid_socket(server_fd) ) {
+            onError("can't socket", socket_error());
+            return false;
+        }
+#ifndef _WIN32
+        int val = 1;
+        setsockopt(server_fd, SOL_SOCKET, SO_REUSEADDR, &val, sizeof(val));
+#endif
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = INADDR_ANY;
+        address.sin_port = htons(uint16_t(p));
+        const char * failed = nullptr;
+        socklen_t addrlen = sizeof(address);
+        if ( ::bind(server_fd, (struct sockaddr *)&address, sizeof(address))<0 ) {
+            failed = "can't bind";
+        } else if ( listen(server_fd, SOMAXCONN)<0 ) {
+            failed = "can't listen";
+        } else if ( !set_socket_blocking(server_fd,false) ) {
+            failed = "can't set nbio";
+        } else if ( getsockname(server_fd, (struct sockaddr *)&address, &addrlen)<0 ) {
+            failed = "can't get port";
+        }
+#if DAS_NETWORK_EPOLL
+        if ( !failed ) {
+            poll_fd = epoll_create1(EPOLL_CLOEXEC);
+            struct epoll_event ev;
+            ev.events = EPOLLIN;
+            ev.data.u32 = 0;
+            if ( poll_fd<0 || epoll_ctl(poll_fd, EPOLL_CTL_ADD, server_fd, &ev)<0 ) {
+                failed = "can't epoll";
+            }
+        }
+#endif
+        if ( failed ) {
+            onError(failed, socket_error());
+            closesocket(server_fd);
+            server_fd = socket_t(-1);
+            return false;
+        }
+        port = ntohs(address.sin_port);
+        return true;
+    }
+
+    bool MultiServer::is_open() const {
+        return !invalid_socket(server_fd);
+    }
+
+    int32_t MultiServer::get_port() const {
+        return port;
+    }
+
+    void MultiServer::set_limits ( int32_t maxMessageSize, int32_t maxQueueSize ) {
+        maxMessage = uint32_t(das::max(maxMessageSize, 1));
+        maxQueue = uint32_t(das::max(maxQueueSize, 1));
+    }
+
+    bool MultiServer::is_connected ( int32_t connection ) const {
+        auto it = connections.find(connection);
+        return it!=connections.end() && !it->second.closing && !it->second.closed;
+    }
+
+    int32_t MultiServer::connection_count() const {
+        return int32_t(connections.size());
+    }
+
+    int32_t MultiServer::get_queued ( int32_t connection ) const {
+        auto it = connections.find(connection);
+        if ( it==connections.end() ) return 0;
+        return int32_t(it->second.output.size() - it->second.outputOffset);
+    }
+
+    void MultiServer::onConnect ( int32_t ) {
+    }
+
+    void MultiServer::onDisconnect ( int32_t ) {
+    }
+
+    void MultiServer::onData ( NetworkMessage *, int32_t ) {
+    }
+
+    void MultiServer::onError ( const char *, int ) {
+    }
+
+    bool MultiServer::send_msg ( int32_t connection, const char * data, int32_t size ) {
+        auto it = connections.find(connection);
+        if ( it==connections.end() || it->second.closing || it->second.closed || size<0 ) return false;
+        auto & conn = it->second;
+        uint32_t queued = uint32_t(conn.output.size() - conn.outputOffset);
+        uint32_t header = framing==NetworkFraming::length32 ? 4 : (framing==NetworkFraming::line ? 1 : 0);
+        if ( queued + uint32_t(size) + header > maxQueue ) return false;
+        if ( framing==NetworkFraming::length32 ) {
+            uint8_t len[4] = { uint8_t(size), uint8_t(size>>8), uint8_t(size>>16), uint8_t(size>>24) };
+            conn.output.insert(conn.output.end(), len, len + 4);
+        }
+        conn.output.insert(conn.output.end(), (const uint8_t *)data, (const uint8_t *)data + size);
+        if ( framing==NetworkFraming::line ) conn.output.push_back('\n');
+        if ( !conn.writing ) {
+            flush(conn);
+            updateInterest(connection, conn);
+        }
+        return !conn.closed;
+    }
+
+    void MultiServer::close_connection ( int32_t connection ) {
+        auto it = connections.find(connection);
+        if ( it==connections.end() ) return;
+        it->second.closing = true;
+        it->second.reading = false;
+        updateInterest(connection, it->second);
+    }
+
+    void MultiServer::acceptAll() {
+        for ( ;; ) {
+            struct sockaddr_in address;
+            socklen_t addrlen = sizeof(address);
+            socket_t fd = accept(server_fd, (struct sockaddr *)&address, &addrlen);
+            if ( invalid_socket(fd) ) {
+                int err = socket_error();
+                if ( !would_block(err) ) onError("can't accept", err);
+                return;
+            }
+            if ( !set_socket_blocking(fd,false) ) {
+                onError("can't set client nbio", socket_error());
+                closesocket(fd);
+                continue;
+            }
+            int val = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (const char *)&val, sizeof(val));
+#ifdef SO_NOSIGPIPE
+            setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &val, sizeof(val));
+#endif
+            int32_t connection = nextConnection++;
+            if ( nextConnection<=0 ) nextConnection = 1;
+#if DAS_NETWORK_EPOLL
+            struct epoll_event ev;
+            ev.events = EPOLLIN;
+            ev.data.u32 = uint32_t(connection);
+            if ( epoll_ctl(poll_fd, EPOLL_CTL_ADD, fd, &ev)<0 ) {
+                onError("can't epoll client", socket_error());
+                closesocket(fd);
+                continue;
+            }
+#endif
+            connections[connection].fd = fd;
+            onConnect(connection);
+        }
+    }
+
+    void MultiServer::readAll ( Connection & conn ) {
+        // input which was not read this time (i.e. when its over the limit) will be reported by the next wait
+        const uint32_t chunk = 64*1024;
+        for ( uint32_t total=0; total < maxMessage + chunk; ) {
+            auto size = conn.input.size();
+            conn.input.resize(size + chunk);
+            auto res = recv(conn.fd, (char *)conn.input.data() + size, chunk, 0);
+            conn.input.resize(size + (res>0 ? size_t(res) : 0));
+            if ( res>0 ) {
+                total += uint32_t(res);
+            } else if ( res==0 ) {
+                conn.closed = true;
+                return;
+            } else {
+                int err = socket_error();
+                if ( !would_block(err) ) {
+                    onError("connection closed on error", err);
+                    conn.closed = true;
+                }
+                return;
+            }
+        }
+    }
+
+    void MultiServer::flush ( Connection & conn ) {
+        while ( conn.outputOffset < conn.output.size() ) {
+            auto res = ::send(conn.fd, (const char *)conn.output.data() + conn.outputOffset,
+                int(conn.output.size() - conn.outputOffset), DAS_SEND_FLAGS);
+            if ( res>0 ) {
+                conn.outputOffset += uint32_t(res);
+            } else {
+                int err = socket_error();
+                if ( res<0 && would_block(err) ) break;
+                onError("can't send", err);
+                conn.closed = true;
+                break;
+            }
+        }
+        if ( conn.outputOffset==conn.output.size() ) {
+            conn.output.clear();
+            conn.outputOffset = 0;
+        } else if ( conn.outputOffset > conn.output.size()/2 ) {
+            conn.output.erase(conn.output.begin(), conn.output.begin() + conn.outputOffset);
+            conn.outputOffset = 0;
+        }
+        uint32_t queued = uint32_t(conn.output.size() - conn.outputOffset);
+        conn.writing = queued!=0;
+        // backpressure, stop reading while half of the queue is used, resume when it drains to a quarter
+        if ( !conn.closing ) {
+            if ( queued > maxQueue/2 ) conn.reading = false;
+            else if ( queued <= maxQueue/4 ) conn.reading = true;
+        }
+    }
+
+    void MultiServer::updateInterest ( int32_t connection, Connection & conn ) {
+#if DAS_NETWORK_EPOLL
+        struct epoll_event ev;
+        ev.events = (conn.reading ? EPOLLIN : 0) | (conn.writing ? EPOLLOUT : 0);
+        ev.data.u32 = uint32_t(connection);
+        epoll_ctl(poll_fd, EPOLL_CTL_MOD, conn.fd, &ev);
+#else
+        (void) connection;
+        (void) conn;
+#endif
+    }
+
+    void MultiServer::closeNow ( int32_t connection ) {
+        auto it = connections.find(connection);
+        if ( it==connections.end() ) return;
+        it->second.closing = true;
+        onDisconnect(connection);
+#if DAS_NETWORK_EPOLL
+        epoll_ctl(poll_fd, EPOLL_CTL_DEL, it->second.fd, nullptr);
+#endif
+        closesocket(it->second.fd);
+        connections.erase(connection);
+    }
+
+    void MultiServer::frame ( int32_t connection, Connection & conn ) {
+        auto data = conn.input.data();
+        uint32_t size = uint32_t(conn.input.size());
+        uint32_t & offset = conn.inputOffset;
+        switch ( framing ) {
+        case NetworkFraming::raw:
+            if ( offset < size ) {
+                batch.push_back({data + offset, int32_t(size - offset), connection});
+                offset = size;
+            }
+            break;
+        case NetworkFraming::length32:
+            while ( size - offset >= 4 ) {
+                auto hdr = data + offset;
+                uint32_t len = uint32_t(hdr[0]) | (uint32_t(hdr[1])<<8) | (uint32_t(hdr[2])<<16) | (uint32_t(hdr[3])<<24);
+                if ( len > maxMessage ) {
+                    onError("message is too big", int(len));
+                    conn.closed = true;
+                    break;
+                }
+                if ( size - offset - 4 < len ) break;
+                batch.push_back({hdr + 4, int32_t(len), connection});
+                offset += 4 + len;
+            }
+            break;
+        case NetworkFraming::line:
+            while ( offset < size ) {
+                auto begin = data + offset;
+                auto eol = (uint8_t *) memchr(begin, '\n', size - offset);
+                if ( !eol ) {
+                    if ( size - offset > maxMessage ) {
+                        onError("message is too big", int(size - offset));
+                        conn.closed = true;
+                    }
+                    break;
+                }
+                auto end = eol;
+                if ( end>begin && end[-1]=='\r' ) end --;
+                batch.push_back({begin, int32_t(end - begin), connection});
+                offset = uint32_t(eol + 1 - data);
+            }
+            break;
+        }
+    }
+
+    void MultiServer::wait ( int32_t timeoutMsec ) {
+        ready.clear();
+#if DAS_NETWORK_EPOLL
+        struct epoll_event events[256];
+        int n = epoll_wait(poll_fd, events, 256, timeoutMsec);
+        for ( int i=0; i<n; ++i ) {
+            auto ev = events[i].events;
+            ready.push_back({int32_t(events[i].data.u32), (ev & EPOLLIN)!=0, (ev & EPOLLOUT)!=0, (ev & (EPOLLERR|EPOLLHUP))!=0});
+        }
+#else
+        vector<struct pollfd> fds;
+        vector<int32_t> ids;
+        fds.reserve(connections.size() + 1);
+        ids.reserve(connections.size() + 1);
+        struct pollfd sfd;
+        sfd.fd = server_fd;
+        sfd.events = POLLIN;
+        sfd.revents = 0;
+        fds.push_back(sfd);
+        ids.push_back(0);
+        for ( auto & it : connections ) {
+            struct pollfd pfd;
+            pfd.fd = it.second.fd;
+            pfd.events = short((it.second.reading ? POLLIN : 0) | (it.second.writing ? POLLOUT : 0));
+            pfd.revents = 0;
+            fds.push_back(pfd);
+            ids.push_back(it.first);
+        }
+        int n = poll(fds.data(), (unsigned long)fds.size(), timeoutMsec);
+        for ( size_t i=0; n>0 && i!=fds.size(); ++i ) {
+            auto ev = fds[i].revents;
+            if ( !ev ) continue;
+            ready.push_back({ids[i], (ev & POLLIN)!=0, (ev & POLLOUT)!=0, (ev & (POLLERR|POLLHUP))!=0});
+        }
+#endif
+    }
+
+    int32_t MultiServer::tick ( int32_t timeoutMsec ) {
+        if ( invalid_socket(server_fd) || inDispatch ) return 0;
+        wait(timeoutMsec);
+        received.clear();
+        for ( auto & ev : ready ) {
+            if ( ev.connection==0 ) {
+                acceptAll();
+                continue;
+            }
+            auto it = connections.find(ev.connection);
+            if ( it==connections.end() ) continue;
+            auto & conn = it->second;
+            if ( ev.writable ) flush(conn);
+            if ( ev.readable || ev.failed ) {
+                if ( conn.reading || ev.failed ) readAll(conn);
+                if ( !conn.input.empty() || conn.closed ) received.push_back(ev.connection);
+            } else if ( conn.closed || (conn.closing && !conn.writing) ) {
+                received.push_back(ev.connection);
+            }
+        }
+        // all messages go to script at once, input buffers stay put until it returns
+        batch.clear();
+        for ( auto connection : received ) {
+            auto it = connections.find(connection);
+            if ( it!=connections.end() ) frame(connection, it->second);
+        }
+        if ( !batch.empty() ) {
+            inDispatch = true;
+            onData(batch.data(), int32_t(batch.size()));
+            inDispatch = false;
+        }
+        int32_t messages = int32_t(batch.size());
+        batch.clear();
+        for ( auto connection : received ) {
+            auto it = connections.find(connection);
+            if ( it==connections.end() ) continue;
+            auto & conn = it->second;
+            if ( conn.inputOffset ) {
+                conn.input.erase(conn.input.begin(), conn.input.begin() + conn.inputOffset);
+                conn.inputOffset = 0;
+            }
+        }
+        // flush what was sent in response, and close what needs closing
+        vector<int32_t> closed;
+        for ( auto & it : connections ) {
+            auto & conn = it.second;
+            if ( conn.writing ) flush(conn);
+            if ( conn.closed || (conn.closing && !conn.writing) ) {
+                closed.push_back(it.first);
+            } else {
+                updateInterest(it.first, conn);
+            }
+        }
+        for ( auto connection : closed ) {
+            closeNow(connection);
+        }
+        return messages;
+    }
 }
@@ -0,0 +1,522 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/misc/regex_dfa.h"
+
+namespace das {
+
+    uint32_t RegexDfa::maxStates = 4096;
+
+    int32_t RegexDfa::emit ( InstKind kind, int32_t x, int32_t y, int32_t arg ) {
+        Inst inst;
+        inst.kind = kind;
+        inst.x = x;
+        inst.y = y;
+        inst.arg = arg;
+        program.push_back(inst);
+        return int32_t(program.size()) - 1;
+    }
+
+    // character 0 is the end of the string, and is never part of the match
+    int32_t RegexDfa::addSet ( const uint32_t * bits ) {
+        uint32_t set[8];
+        memcpy(set, bits, sizeof(set));
+        set[0] &= ~1u;
+        string key((const char *)set, sizeof(set));
+        auto it = setIndex.find(key);
+        if ( it!=setIndex.end() ) return it->second;
+        int32_t index = int32_t(sets.size() / 8);
+        sets.insert(sets.end(), set, set + 8);
+        setIndex[key] = index;
+        return index;
+    }
+
+    int32_t RegexDfa::parseNode ( const int32_t * code, uint32_t codeSize, uint32_t & at ) {
+        if ( at>=codeSize ) return -1;
+        Node node;
+        node.op = RegexOp(code[at++]);
+        auto child = [&]() -> bool {
+            int32_t ci = parseNode(code, codeSize, at);
+            if ( ci<0 ) return false;
+            node.children.push_back(ci);
+            return true;
+        };
+        switch ( node.op ) {
+        case RegexOp::Char:
+            if ( at>=codeSize ) return -1;
+            node.arg = code[at++];
+            node.first = int32_t(at);
+            if ( node.arg<=0 || at + node.arg > codeSize ) return -1;
+            at += node.arg;
+            break;
+        case RegexOp::Set:
+            if ( at>=codeSize ) return -1;
+            node.arg = code[at++];      // index in the source sets, replaced by compile
+            break;
+        case RegexOp::Any:
+        case RegexOp::Eos:
+            break;
+        case RegexOp::Group:
+            if ( at>=codeSize ) return -1;
+            node.arg = code[at++];
+            if ( node.arg<=0 || !child() ) return -1;
+            break;
+        case RegexOp::Plus:
+        case RegexOp::Star:
+        case RegexOp::Question:
+            if ( !child() ) return -1;
+            break;
+        case RegexOp::Concat:
+            if ( !child() || !child() ) return -1;
+            break;
+        case RegexOp::Union:
+            if ( at>=codeSize ) return -1;
+            for ( int32_t i=0, count=code[at++]; i!=count; ++i ) {
+                if ( !child() ) return -1;
+            }
+            if ( node.children.empty() ) return -1;
+            break;
+        default:
+            return -1;
+        }
+        nodes.push_back(move(node));
+        return int32_t(nodes.size()) - 1;
+    }
+
+    // builds the node backwards, so that it continues to 'next'. returns the entry point
+    // repetitions and unions prefer the first alternative, which makes them greedy for the groups
+    int32_t RegexDfa::build ( int32_t ni, int32_t next ) {
+        switch ( nodes[ni].op ) {
+        case RegexOp::Char:
+        case RegexOp::Set:
+        case RegexOp::Any:
+            for ( int32_t i=nodes[ni].arg-1; i>=0; --i ) {
+                next = emit(InstKind::Set, next, -1, nodes[ni].children[i]);
+            }
+            return next;
+        case RegexOp::Eos:
+            return emit(InstKind::Eos, next);
+        case RegexOp::Group: {
+                int32_t slot = nodes[ni].arg * 2;
+                slotCount = das::max(slotCount, slot + 2);
+                int32_t close = emit(InstKind::Save, next, -1, slot + 1);
+                int32_t body = build(nodes[ni].children[0], close);
+                return emit(InstKind::Save, body, -1, slot);
+            }
+        case RegexOp::Plus: {
+                int32_t split = emit(InstKind::Split, -1, next);
+                int32_t body = build(nodes[ni].children[0], split);
+                program[split].x = body;
+                return body;
+            }
+        case RegexOp::Star: {
+                int32_t split = emit(InstKind::Split, -1, next);
+                program[split].x = build(nodes[ni].children[0], split);
+                return split;
+            }
+        case RegexOp::Question: {
+                int32_t body = build(nodes[ni].children[0], next);
+                return emit(InstKind::Split, body, next);
+            }
+        case RegexOp::Concat:
+            return build(nodes[ni].children[0], build(nodes[ni].children[1], next));
+        case RegexOp::Union: {
+                auto children = nodes[ni].children;
+                int32_t alt = build(children.back(), next);
+                for ( int32_t i=int32_t(children.size())-2; i>=0; --i ) {
+                    alt = emit(InstKind::Split, build(children[i], next), alt);
+                }
+                return alt;
+            }
+        default:
+            DAS_ASSERT(0 && "unsupported regex node");
+            return next;
+        }
+    }
+
+    // characters, which are in the same sets, go to the same class. DFA transitions are per class
+    void RegexDfa::buildClasses() {
+        memset(classOf, 0, sizeof(classOf));
+        classCount = 1;
+        uint32_t setCount = uint32_t(sets.size() / 8);
+        for ( uint32_t si=0; si!=setCount; ++si ) {
+            int16_t remap[512];
+            memset(remap, -1, sizeof(remap));
+            uint32_t newCount = 0;
+            for ( uint32_t ch=0; ch!=256; ++ch ) {
+                uint32_t key = classOf[ch]*2 + (inSet(int32_t(si), uint8_t(ch)) ? 1 : 0);
+                if ( remap[key]==-1 ) remap[key] = int16_t(newCount++);
+                classOf[ch] = uint8_t(remap[key]);
+            }
+            classCount = newCount;
+        }
+        for ( int32_t ch=255; ch>=0; --ch ) {
+            classRep[classOf[ch]] = uint8_t(ch);
+        }
+    }
+
+    bool RegexDfa::compile ( const int32_t * code, uint32_t codeSize, const uint32_t * srcSets, uint32_t srcSetsSize ) {
+        nodes.clear();
+        program.clear();
+        sets.clear();
+        setIndex.clear();
+        slotCount = 2;
+        uint32_t at = 0;
+        int32_t root = parseNode(code, codeSize, at);
+        if ( root<0 || at!=codeSize ) return false;
+        // all consuming nodes become sequences of sets
+        uint32_t anySet[8];
+        memset(anySet, 0xff, sizeof(anySet));
+        for ( auto & node : nodes ) {
+            if ( node.op==RegexOp::Char ) {
+                for ( int32_t i=0; i!=node.arg; ++i ) {
+                    uint32_t ch = uint32_t(code[node.first + i]) & 0xff;
+                    uint32_t single[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+                    single[ch>>5] = 1u << (ch & 31);
+                    node.children.push_back(addSet(single));
+                }
+            } else if ( node.op==RegexOp::Set ) {
+                if ( node.arg<0 || uint32_t(node.arg + 1)*8 > srcSetsSize ) return false;
+                node.children.push_back(addSet(srcSets + node.arg*8));
+                node.arg = 1;
+            } else if ( node.op==RegexOp::Any ) {
+                node.children.push_back(addSet(anySet));
+                node.arg = 1;
+            }
+        }
+        // whole match is group 0
+        int32_t match = emit(InstKind::Match);
+        int32_t close = emit(InstKind::Save, match, -1, 1);
+        int32_t body = build(root, close);
+        startPc = emit(InstKind::Save, body, -1, 0);
+        nodes.clear();
+        buildClasses();
+        visited.assign(program.size(), 0);
+        visitedGen = 0;
+        // characters, which start the match, for the quick skip
+        vector<int32_t> list;
+        visitedGen ++;
+        closure(list, startPc, false);
+        memset(firstSet, 0, sizeof(firstSet));
+        canBeEmpty = false;
+        for ( auto pc : list ) {
+            const auto & inst = program[pc];
+            if ( inst.kind==InstKind::Set ) {
+                for ( int32_t i=0; i!=8; ++i ) firstSet[i] |= sets[inst.arg*8 + i];
+            } else {
+                canBeEmpty = true;
+            }
+        }
+        firstCount = 0;
+        for ( uint32_t ch=0; ch!=256; ++ch ) {
+            if ( firstSet[ch>>5] & (1u << (ch & 31)) ) {
+                if ( firstCount==4 ) {
+                    firstCount = -1;
+                    break;
+                }
+                firstBytes[firstCount++] = uint8_t(ch);
+            }
+        }
+        anchored.unanchored = false;
+        unanchored.unanchored = true;
+        resetCache(anchored);
+        resetCache(unanchored);
+        groups.assign(slotCount, 0);
+        return true;
+    }
+
+    void RegexDfa::closure ( vector<int32_t> & list, int32_t pc, bool throughEos ) {
+        stack.push_back(pc);
+        while ( !stack.empty() ) {
+            pc = stack.back();
+            stack.pop_back();
+            if ( visited[pc]==visitedGen ) continue;
+            visited[pc] = visitedGen;
+            const auto & inst = program[pc];
+            switch ( inst.kind ) {
+            case InstKind::Split:
+                stack.push_back(inst.y);
+                stack.push_back(inst.x);
+                break;
+            case InstKind::Save:
+                stack.push_back(inst.x);
+                break;
+            case InstKind::Eos:
+                if ( throughEos ) {
+                    stack.push_back(inst.x);
+                } else {
+                    list.push_back(pc);
+                }
+                break;
+            default:
+                list.push_back(pc);
+                break;
+            }
+        }
+    }
+
+    // state 0 is the dead state, with no instructions
+    void RegexDfa::resetCache ( Cache & cache ) {
+        cache.generation ++;
+        cache.states.clear();
+        cache.pool.clear();
+        cache.transitions.clear();
+        cache.index.clear();
+        vector<int32_t> list;
+        intern(cache, list);
+        visitedGen ++;
+        closure(list, startPc, false);
+        cache.start = intern(cache, list);
+    }
+
+    int32_t RegexDfa::intern ( Cache & cache, vector<int32_t> & list ) {
+        sort(list.begin(), list.end());
+        string key((const char *)list.data(), list.size()*sizeof(int32_t));
+        auto it = cache.index.find(key);
+        if ( it!=cache.index.end() ) return it->second;
+        State state;
+        state.offset = uint32_t(cache.pool.size());
+        state.count = uint32_t(list.size());
+        state.accepting = false;
+        for ( auto pc : list ) {
+            if ( program[pc].kind==InstKind::Match ) state.accepting = true;
+        }
+        cache.pool.insert(cache.pool.end(), list.begin(), list.end());
+        int32_t index = int32_t(cache.states.size());
+        cache.states.push_back(state);
+        cache.transitions.resize(cache.transitions.size() + classCount, -1);
+        cache.index[key] = index;
+        return index;
+    }
+
+    int32_t RegexDfa::step ( Cache & cache, int32_t state, uint8_t ch ) {
+        uint32_t cls = classOf[ch];
+        int32_t target = cache.transitions[state*classCount + cls];
+        if ( target>=0 ) return target;
+        scratch.clear();
+        visitedGen ++;
+        const State & st = cache.states[state];
+        uint8_t rep = classRep[cls];
+        for ( uint32_t i=0; i!=st.count; ++i ) {
+            const auto & inst = program[cache.pool[st.offset + i]];
+            if ( inst.kind==InstKind::Set && inSet(inst.arg, rep) ) {
+                closure(scratch, inst.x, false);
+            }
+        }
+        if ( cache.unanchored ) {
+            closure(scratch, startPc, false);
+        }
+        if ( cache.states.size()>=maxStates ) {
+            // cache is full. start over, the state we came from is not needed anymore
+            vector<int32_t> list = scratch;
+            resetCache(cache);
+            return intern(cache, list);
+        }
+        target = intern(cache, scratch);
+        cache.transitions[state*classCount + cls] = target;
+        return target;
+    }
+
+    bool RegexDfa::acceptsAtEos ( Cache & cache, int32_t state ) {
+        State & st = cache.states[state];
+        if ( st.acceptsAtEos==-1 ) {
+            bool accepts = st.accepting;
+            if ( !accepts ) {
+                scratch.clear();
+                visitedGen ++;
+                for ( uint32_t i=0; i!=st.count; ++i ) {
+                    int32_t pc = cache.pool[st.offset + i];
+                    if ( program[pc].kind==InstKind::Eos ) closure(scratch, program[pc].x, true);
+                }
+                for ( auto pc : scratch ) {
+                    if ( program[pc].kind==InstKind::Match ) accepts = true;
+                }
+            }
+            cache.states[state].acceptsAtEos = accepts ? 1 : 0;
+        }
+        return cache.states[state].acceptsAtEos==1;
+    }
+
+    int32_t RegexDfa::skipToFirst ( const char * str, int32_t length, int32_t pos ) const {
+        if ( firstCount==0 ) return length;
+        if ( firstCount==1 ) {
+            auto found = (const char *) memchr(str + pos, firstBytes[0], length - pos);
+            return found ? int32_t(found - str) : length;
+        }
+#if _TARGET_SIMD_SSE
+        __m128i b0 = _mm_set1_epi8(char(firstBytes[0]));
+        __m128i b1 = _mm_set1_epi8(char(firstBytes[1]));
+        __m128i b2 = _mm_set1_epi8(char(firstBytes[firstCount>2 ? 2 : 1]));
+        __m128i b3 = _mm_set1_epi8(char(firstBytes[firstCount>3 ? 3 : 1]));
+        while ( length - pos >= 16 ) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(str + pos));
+            __m128i eq = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(v, b0), _mm_cmpeq_epi8(v, b1)),
+                _mm_or_si128(_mm_cmpeq_epi8(v, b2), _mm_cmpeq_epi8(v, b3)));
+            uint32_t mask = uint32_t(_mm_movemask_epi8(eq));
+            if ( mask ) return pos + das_ctz(mask);
+            pos += 16;
+        }
+#endif
+        for ( ; pos!=length; ++pos ) {
+            uint8_t ch = uint8_t(str[pos]);
+            if ( firstSet[ch>>5] & (1u << (ch & 31)) ) break;
+        }
+        return pos;
+    }
+
+    int32_t RegexDfa::match ( const char * str, int32_t length, int32_t offset ) {
+        if ( offset<0 || offset>length ) return -1;
+        int32_t last = longest(str, length, offset, false);
+        if ( last>=0 ) setGroups(str, length, offset, last);
+        return last;
+    }
+
+    void RegexDfa::setGroups ( const char * str, int32_t length, int32_t start, int32_t end ) {
+        if ( slotCount>2 ) {
+            matchGroups(str, length, start, end);
+        } else {
+            groups[0] = start;
+            groups[1] = end;
+        }
+    }
+
+    // anchored DFA. with memo, failed candidates of the same search leave the state they had at each position,
+    // the candidate which gets to the same state at the same position is not going to accept anything past it either
+    int32_t RegexDfa::longest ( const char * str, int32_t length, int32_t offset, bool memo ) {
+        Cache & cache = anchored;
+        int32_t state = cache.start;
+        int32_t last = cache.states[state].accepting ? offset : -1;
+        int32_t pos = offset;
+        for ( ; pos!=length; ++pos ) {
+            if ( memo && pos<memoEnd ) {
+                if ( memoGeneration!=cache.generation ) {
+                    fill(deadEnds.begin(), deadEnds.end(), -1);
+                    memoGeneration = cache.generation;
+                }
+                int32_t & seen = deadEnds[pos - memoStart];
+                if ( seen==state ) return last;
+                seen = state;
+            }
+            uint8_t ch = uint8_t(str[pos]);
+            int32_t next = cache.transitions[state*classCount + classOf[ch]];
+            state = next>=0 ? next : step(cache, state, ch);
+            if ( state==0 ) break;
+            if ( cache.states[state].accepting ) last = pos + 1;
+        }
+        if ( pos==length && acceptsAtEos(cache, state) ) last = length;
+        return last;
+    }
+
+    // unanchored DFA finds the earliest end of any match, which is linear, and quickly rejects the text with no matches
+    // the leftmost start is at or before that end, and is the first candidate the anchored DFA matches from
+    bool RegexDfa::search ( const char * str, int32_t length, int32_t offset, int32_t & start, int32_t & end ) {
+        if ( offset<0 || offset>length ) return false;
+        Cache & cache = unanchored;
+        int32_t state = cache.start;
+        int32_t found = cache.states[state].accepting ? offset : -1;
+        int32_t pos = offset;
+        bool skip = firstCount>=0 && !canBeEmpty;
+        while ( found<0 && pos!=length ) {
+            if ( skip && state==cache.start ) {
+                pos = skipToFirst(str, length, pos);
+                if ( pos==length ) break;
+            }
+            uint8_t ch = uint8_t(str[pos++]);
+            int32_t next = cache.transitions[state*classCount + classOf[ch]];
+            state = next>=0 ? next : step(cache, state, ch);
+            if ( cache.states[state].accepting ) found = pos;
+        }
+        if ( found<0 && pos==length && acceptsAtEos(cache, state) ) found = length;
+        if ( found<0 ) return false;
+        memoStart = offset;
+        memoEnd = found;
+        memoGeneration = anchored.generation;
+        deadEnds.assign(found - offset, -1);
+        for ( int32_t s=offset; s<=found; ++s ) {
+            if ( !canBeEmpty ) {
+                if ( skip ) {
+                    s = skipToFirst(str, length, s);
+                } else {
+                    while ( s<found && !(firstSet[uint8_t(str[s])>>5] & (1u << (uint8_t(str[s]) & 31))) ) s ++;
+                }
+                if ( s>found ) break;
+            }
+            int32_t e = longest(str, length, s, true);
+            if ( e>=0 ) {
+                setGroups(str, length, s, e);
+                start = s;
+                end = e;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Pike VM over the match. threads are kept in the priority order, first one to reach the end wins
+    void RegexDfa::matchGroups ( const char * str, int32_t length, int32_t start, int32_t end ) {
+        uint32_t slots = uint32_t(slotCount);
+        uint32_t ninst = uint32_t(program.size());
+        vector<int32_t> clist, nlist;
+        vector<int32_t> ccaps(ninst*slots), ncaps(ninst*slots);
+        vector<int32_t> caps(slots, -1);
+        clist.reserve(ninst);
+        nlist.reserve(ninst);
+        function<void(vector<int32_t> &, vector<int32_t> &, int32_t, int32_t)> add;
+        add = [&]( vector<int32_t> & list, vector<int32_t> & listCaps, int32_t pc, int32_t pos ) {
+            if ( visited[pc]==visitedGen ) return;
+            visited[pc] = visitedGen;
+            const auto & inst = program[pc];
+            switch ( inst.kind ) {
+            case InstKind::Split:
+                add(list, listCaps, inst.x, pos);
+                add(list, listCaps, inst.y, pos);
+                break;
+            case InstKind::Save: {
+                    int32_t old = caps[inst.arg];
+                    caps[inst.arg] = pos;
+                    add(list, listCaps, inst.x, pos);
+                    caps[inst.arg] = old;
+                }
+                break;
+            case InstKind::Eos:
+                if ( pos==length ) add(list, listCaps, inst.x, pos);
+                break;
+            default:
+                list.push_back(pc);
+                memcpy(listCaps.data() + pc*slots, caps.data(), slots*sizeof(int32_t));
+                break;
+            }
+        };
+        visitedGen ++;
+        add(clist, ccaps, startPc, start);
+        groups.assign(slots, 0);
+        groups[0] = start;
+        groups[1] = end;
+        for ( int32_t pos=start; ; ++pos ) {
+            if ( pos==end ) {
+                for ( auto pc : clist ) {
+                    if ( program[pc].kind==InstKind::Match ) {
+                        for ( uint32_t i=0; i!=slots; ++i ) {
+                            int32_t at = ccaps[pc*slots + i];
+                            groups[i] = at>=0 ? at : 0;
+                        }
+                        break;
+                    }
+                }
+                return;
+            }
+            uint8_t ch = uint8_t(str[pos]);
+            nlist.clear();
+            visitedGen ++;
+            for ( auto pc : clist ) {
+                const auto & inst = program[pc];
+                if ( inst.kind==InstKind::Set && inSet(inst.arg, ch) ) {
+                    memcpy(caps.data(), ccaps.data() + pc*slots, slots*sizeof(int32_t));
+                    add(nlist, ncaps, inst.x, pos + 1);
+                }
+            }
+            swap(clist, nlist);
+            swap(ccaps, ncaps);
+        }
+    }
+}
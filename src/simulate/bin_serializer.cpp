@@ -300,4 +300,900 @@ namespace das {
         return v_zero();
     }
 
+
+    // versioned binary format. header describes every saved type, with the structure fields by name hash and offset,
+    // so the data can be loaded into the types, which had fields added, removed or reordered since it was saved
+    //  header      magic, version, total size, type count, field count, types, fields. type 0 is the saved object
+    //  data        plain old data (no strings or arrays inside) is saved as is, in the memory layout
+    //              string is length and characters, array is size and elements, the rest is its parts in order
+    // it is not a DataWalker. type infos are compiled into the plan once per call, and the data is walked by the plan
+
+    #define DAS_BIN_MAGIC   0x56534144      // DASV
+    #define DAS_BIN_VERSION 1
+
+    // stored in the data, new kinds only go to the end
+    enum class BinKind : uint8_t {
+        None, Bool, Int8, UInt8, Int16, UInt16, Int, UInt, Int64, UInt64, Float, Double,
+        Int2, Int3, Int4, UInt2, UInt3, UInt4, Float2, Float3, Float4, Range, URange,
+        Enumeration, Enumeration8, Enumeration16, Bitfield,
+        String, Struct, Tuple, Variant, Dim, Array,
+        Last
+    };
+
+    struct BinHeader {
+        uint32_t    magic;
+        uint32_t    version;
+        uint32_t    size;           // of everything, header included
+        uint32_t    typeCount;
+        uint32_t    fieldCount;
+    };
+
+    struct BinType {
+        BinKind     kind;
+        uint8_t     pod;            // saved as is
+        uint16_t    reserved;
+        uint32_t    size;
+        uint32_t    count;          // of the fixed array elements, or of the fields
+        uint32_t    arg;            // element of the fixed array or the array, or the first field
+    };
+
+    struct BinField {
+        uint64_t    name;           // hash, tuple fields are _0, _1... unless named
+        uint32_t    offset;
+        uint32_t    type;
+    };
+
+    static BinKind binValueKind ( Type type ) {
+        switch ( type ) {
+            case Type::tBool:           return BinKind::Bool;
+            case Type::tInt8:           return BinKind::Int8;
+            case Type::tUInt8:          return BinKind::UInt8;
+            case Type::tInt16:          return BinKind::Int16;
+            case Type::tUInt16:         return BinKind::UInt16;
+            case Type::tInt:            return BinKind::Int;
+            case Type::tUInt:           return BinKind::UInt;
+            case Type::tInt64:          return BinKind::Int64;
+            case Type::tUInt64:         return BinKind::UInt64;
+            case Type::tFloat:          return BinKind::Float;
+            case Type::tDouble:         return BinKind::Double;
+            case Type::tInt2:           return BinKind::Int2;
+            case Type::tInt3:           return BinKind::Int3;
+            case Type::tInt4:           return BinKind::Int4;
+            case Type::tUInt2:          return BinKind::UInt2;
+            case Type::tUInt3:          return BinKind::UInt3;
+            case Type::tUInt4:          return BinKind::UInt4;
+            case Type::tFloat2:         return BinKind::Float2;
+            case Type::tFloat3:         return BinKind::Float3;
+            case Type::tFloat4:         return BinKind::Float4;
+            case Type::tRange:          return BinKind::Range;
+            case Type::tURange:         return BinKind::URange;
+            case Type::tEnumeration:    return BinKind::Enumeration;
+            case Type::tEnumeration8:   return BinKind::Enumeration8;
+            case Type::tEnumeration16:  return BinKind::Enumeration16;
+            case Type::tBitfield:       return BinKind::Bitfield;
+            default:                    return BinKind::None;
+        }
+    }
+
+    static uint64_t binFieldName ( const char * name, uint32_t index ) {
+        if ( name ) return hash_blockz64((const uint8_t *)name);
+        string tname = "_" + to_string(index);
+        return hash_blockz64((const uint8_t *)tname.c_str());
+    }
+
+    static uint32_t binVariantDataOffset ( TypeInfo * ti ) {
+        uint32_t fa = uint32_t(getTypeAlign(ti)) - 1;
+        return (uint32_t(getTypeBaseSize(Type::tInt)) + fa) & ~fa;
+    }
+
+    // tuple fields are laid out one after another, same as DataWalker::walk_tuple
+    static void binTupleOffsets ( TypeInfo * ti, vector<uint32_t> & offsets ) {
+        offsets.resize(ti->argCount);
+        uint32_t fieldOffset = 0;
+        for ( uint32_t i=0; i!=ti->argCount; ++i ) {
+            uint32_t fa = uint32_t(getTypeAlign(ti->argTypes[i])) - 1;
+            fieldOffset = (fieldOffset + fa) & ~fa;
+            offsets[i] = fieldOffset;
+            fieldOffset += ti->argTypes[i]->size;
+        }
+    }
+
+    // element of the fixed array, same as DataWalker::walk_dim
+    static TypeInfo binDimElement ( TypeInfo * ti, vector<uint32_t> & udim ) {
+        TypeInfo copyInfo = *ti;
+        copyInfo.size = ti->dim[0] ? copyInfo.size / ti->dim[0] : copyInfo.size;
+        copyInfo.dimSize --;
+        udim.assign(ti->dim + 1, ti->dim + ti->dimSize);
+        copyInfo.dim = copyInfo.dimSize ? udim.data() : nullptr;
+        return copyInfo;
+    }
+
+    // types of the saved object, by its type info. it is also the plan for saving
+    struct BinSchema {
+        vector<BinType>     types;
+        vector<BinField>    fields;
+        das_hash_map<uint64_t,uint32_t> structIndex;    // by StructInfo, structures can be recursive via arrays
+        string              error;
+        int32_t add ( TypeInfo * ti ) {
+            if ( ti->flags & TypeInfo::flag_ref ) return fail(ti);
+            uint32_t index = uint32_t(types.size());
+            types.push_back(BinType());
+            BinType bt;
+            memset(&bt, 0, sizeof(bt));
+            bt.size = ti->size;
+            if ( ti->dimSize ) {
+                vector<uint32_t> udim;
+                TypeInfo elementType = binDimElement(ti, udim);
+                int32_t element = add(&elementType);
+                if ( element<0 ) return -1;
+                bt.kind = BinKind::Dim;
+                bt.count = ti->dim[0];
+                bt.arg = uint32_t(element);
+                bt.pod = types[element].pod;
+            } else if ( ti->type==Type::tString ) {
+                bt.kind = BinKind::String;
+            } else if ( ti->type==Type::tArray ) {
+                int32_t element = add(ti->firstType);
+                if ( element<0 ) return -1;
+                bt.kind = BinKind::Array;
+                bt.arg = uint32_t(element);
+            } else if ( ti->type==Type::tStructure ) {
+                auto si = ti->structType;
+                auto it = structIndex.find(uint64_t(intptr_t(si)));
+                if ( it!=structIndex.end() ) {
+                    types.pop_back();
+                    return int32_t(it->second);
+                }
+                structIndex[uint64_t(intptr_t(si))] = index;
+                bt.kind = BinKind::Struct;
+                bt.count = si->count;
+                bt.arg = uint32_t(fields.size());
+                fields.resize(fields.size() + si->count);
+                bt.pod = 1;
+                for ( uint32_t i=0; i!=si->count; ++i ) {
+                    int32_t ft = add(si->fields[i]);
+                    if ( ft<0 ) return -1;
+                    fields[bt.arg + i] = { binFieldName(si->fields[i]->name, i), si->fields[i]->offset, uint32_t(ft) };
+                    bt.pod &= types[ft].pod;
+                }
+            } else if ( ti->type==Type::tTuple || ti->type==Type::tVariant ) {
+                vector<uint32_t> offsets;
+                if ( ti->type==Type::tTuple ) {
+                    binTupleOffsets(ti, offsets);
+                } else {
+                    offsets.assign(ti->argCount, binVariantDataOffset(ti));
+                }
+                bt.kind = ti->type==Type::tTuple ? BinKind::Tuple : BinKind::Variant;
+                bt.count = ti->argCount;
+                bt.arg = uint32_t(fields.size());
+                fields.resize(fields.size() + ti->argCount);
+                bt.pod = 1;
+                for ( uint32_t i=0; i!=ti->argCount; ++i ) {
+                    int32_t ft = add(ti->argTypes[i]);
+                    if ( ft<0 ) return -1;
+                    fields[bt.arg + i] = { binFieldName(ti->argNames ? ti->argNames[i] : nullptr, i), offsets[i], uint32_t(ft) };
+                    bt.pod &= types[ft].pod;
+                }
+            } else {
+                bt.kind = binValueKind(ti->type);
+                if ( bt.kind==BinKind::None ) return fail(ti);
+                bt.pod = 1;
+            }
+            types[index] = bt;
+            return int32_t(index);
+        }
+        int32_t fail ( TypeInfo * ti ) {
+            if ( error.empty() ) error = "binary serialization of " + debug_type(ti) + " is not supported";
+            return -1;
+        }
+    };
+
+    // memory, or buffered file
+    struct BinWriter {
+        char *      bytes = nullptr;
+        uint32_t    capacity = 0;
+        uint32_t    at = 0;
+        FILE *      file = nullptr;
+        bool        failed = false;
+        vector<char> buffer;
+        BinWriter ( char * b, uint32_t size ) : bytes(b), capacity(size) {}
+        BinWriter ( FILE * f ) : file(f) {
+            buffer.resize(64*1024);
+            bytes = buffer.data();
+            capacity = uint32_t(buffer.size());
+        }
+        __forceinline void write ( const void * data, uint32_t size ) {
+            if ( at + size > capacity ) {
+                DAS_ASSERT(file && "memory writer is presized");
+                flush();
+                if ( size >= capacity ) {
+                    failed |= fwrite(data, 1, size, file)!=size;
+                    return;
+                }
+            }
+            memcpy(bytes + at, data, size);
+            at += size;
+        }
+        void flush () {
+            if ( file && at ) {
+                failed |= fwrite(bytes, 1, at, file)!=at;
+                at = 0;
+            }
+        }
+    };
+
+    struct BinDataSave {
+        const BinSchema &   schema;
+        Context *           context;
+        BinDataSave ( const BinSchema & s, Context * ctx ) : schema(s), context(ctx) {}
+        uint64_t measure ( uint32_t ti, const char * data ) const {
+            auto & bt = schema.types[ti];
+            if ( bt.pod ) return bt.size;
+            switch ( bt.kind ) {
+                case BinKind::String:   return sizeof(uint32_t) + stringLengthSafe(*context, *(const char **)data);
+                case BinKind::Struct:
+                case BinKind::Tuple: {
+                        uint64_t size = 0;
+                        for ( uint32_t i=0; i!=bt.count; ++i ) {
+                            auto & field = schema.fields[bt.arg + i];
+                            size += measure(field.type, data + field.offset);
+                        }
+                        return size;
+                    }
+                case BinKind::Variant: {
+                        auto & field = schema.fields[bt.arg + *(const int32_t *)data];
+                        return sizeof(int32_t) + measure(field.type, data + field.offset);
+                    }
+                case BinKind::Dim: {
+                        uint64_t size = 0;
+                        uint32_t stride = schema.types[bt.arg].size;
+                        for ( uint32_t i=0; i!=bt.count; ++i ) {
+                            size += measure(bt.arg, data + i*stride);
+                        }
+                        return size;
+                    }
+                case BinKind::Array: {
+                        auto arr = (const Array *) data;
+                        auto & et = schema.types[bt.arg];
+                        if ( et.pod ) return sizeof(uint32_t) + uint64_t(arr->size) * et.size;
+                        uint64_t size = sizeof(uint32_t);
+                        for ( uint32_t i=0; i!=arr->size; ++i ) {
+                            size += measure(bt.arg, arr->data + i*et.size);
+                        }
+                        return size;
+                    }
+                default:
+                    DAS_ASSERTF(0, "unexpected binary type");
+                    return 0;
+            }
+        }
+        void save ( BinWriter & writer, uint32_t ti, const char * data ) const {
+            auto & bt = schema.types[ti];
+            if ( bt.pod ) {
+                writer.write(data, bt.size);
+                return;
+            }
+            switch ( bt.kind ) {
+                case BinKind::String: {
+                        auto str = *(const char **)data;
+                        uint32_t length = stringLengthSafe(*context, str);
+                        writer.write(&length, sizeof(length));
+                        if ( length ) writer.write(str, length);
+                    }
+                    break;
+                case BinKind::Struct:
+                case BinKind::Tuple:
+                    for ( uint32_t i=0; i!=bt.count; ++i ) {
+                        auto & field = schema.fields[bt.arg + i];
+                        save(writer, field.type, data + field.offset);
+                    }
+                    break;
+                case BinKind::Variant: {
+                        auto index = *(const int32_t *)data;
+                        auto & field = schema.fields[bt.arg + index];
+                        writer.write(&index, sizeof(index));
+                        save(writer, field.type, data + field.offset);
+                    }
+                    break;
+                case BinKind::Dim: {
+                        uint32_t stride = schema.types[bt.arg].size;
+                        for ( uint32_t i=0; i!=bt.count; ++i ) {
+                            save(writer, bt.arg, data + i*stride);
+                        }
+                    }
+                    break;
+                case BinKind::Array: {
+                        auto arr = (const Array *) data;
+                        auto & et = schema.types[bt.arg];
+                        writer.write(&arr->size, sizeof(uint32_t));
+                        if ( et.pod ) {
+                            if ( arr->size ) writer.write(arr->data, arr->size * et.size);  // all of it at once
+                        } else {
+                            for ( uint32_t i=0; i!=arr->size; ++i ) {
+                                save(writer, bt.arg, arr->data + i*et.size);
+                            }
+                        }
+                    }
+                    break;
+                default:
+                    DAS_ASSERTF(0, "unexpected binary type");
+            }
+        }
+        // header and data. false if its over 4GB
+        bool measureAll ( const char * data, uint32_t & total ) const {
+            uint64_t size = sizeof(BinHeader) + schema.types.size()*sizeof(BinType) + schema.fields.size()*sizeof(BinField) + measure(0, data);
+            total = uint32_t(size);
+            return size <= UINT32_MAX;
+        }
+        void saveAll ( BinWriter & writer, const char * data, uint32_t total ) const {
+            BinHeader header = { DAS_BIN_MAGIC, DAS_BIN_VERSION, total, uint32_t(schema.types.size()), uint32_t(schema.fields.size()) };
+            writer.write(&header, sizeof(header));
+            writer.write(schema.types.data(), uint32_t(schema.types.size()*sizeof(BinType)));
+            if ( schema.fields.size() ) writer.write(schema.fields.data(), uint32_t(schema.fields.size()*sizeof(BinField)));
+            save(writer, 0, data);
+            writer.flush();
+        }
+    };
+
+    // memory, or buffered file. never reads past the saved object
+    struct BinReader {
+        const char *    bytes = nullptr;
+        uint32_t        at = 0;
+        uint32_t        available = 0;      // in bytes, past at
+        uint32_t        left = 0;           // of the saved object, which are not read yet
+        FILE *          file = nullptr;
+        vector<char>    buffer;
+        vector<char>    scratch;
+        string          error;
+        BinReader ( const char * b, uint32_t size ) : bytes(b), available(size), left(size) {}
+        BinReader ( FILE * f ) : left(uint32_t(sizeof(BinHeader))), file(f) {     // the rest is known after the header
+            buffer.resize(64*1024);
+            bytes = buffer.data();
+        }
+        bool fail ( const char * message ) {
+            if ( error.empty() ) error = message;
+            return false;
+        }
+        bool refill () {
+            if ( !file ) return fail("binary data too short");
+            uint32_t size = das::min(uint32_t(buffer.size()), left - available);
+            if ( fread(buffer.data(), 1, size, file)!=size ) return fail("can't read binary data");
+            at = 0;
+            available = size;
+            return true;
+        }
+        bool read ( void * data, uint32_t size ) {
+            if ( size > left ) return fail("binary data too short");
+            char * dst = (char *) data;
+            while ( size ) {
+                if ( !available ) {
+                    if ( file && size >= buffer.size() ) {  // large pod arrays go straight to the destination
+                        if ( fread(dst, 1, size, file)!=size ) return fail("can't read binary data");
+                        left -= size;
+                        return true;
+                    }
+                    if ( !refill() ) return false;
+                }
+                uint32_t chunk = das::min(size, available);
+                memcpy(dst, bytes + at, chunk);
+                at += chunk;
+                available -= chunk;
+                left -= chunk;
+                dst += chunk;
+                size -= chunk;
+            }
+            return true;
+        }
+        bool skip ( uint32_t size ) {
+            if ( size > left ) return fail("binary data too short");
+            while ( size ) {
+                if ( !available && !refill() ) return false;
+                uint32_t chunk = das::min(size, available);
+                at += chunk;
+                available -= chunk;
+                left -= chunk;
+                size -= chunk;
+            }
+            return true;
+        }
+        // bytes in place, or copy in the scratch
+        const char * view ( uint32_t size ) {
+            if ( size > left ) {
+                fail("binary data too short");
+                return nullptr;
+            }
+            if ( size <= available ) {
+                const char * res = bytes + at;
+                at += size;
+                available -= size;
+                left -= size;
+                return res;
+            }
+            scratch.resize(size);
+            return read(scratch.data(), size) ? scratch.data() : nullptr;
+        }
+        template <typename TT>
+        bool load ( TT & data ) {
+            return read(&data, sizeof(TT));
+        }
+    };
+
+    // saved schema is matched against the type info. plan says how to load every saved type into the target
+    // structure fields and variant alternatives are matched by name, missing ones keep their values,
+    // and the saved ones, which no longer exist or changed type, are skipped
+    enum class BinOp : uint8_t { Skip, Copy, String, Fields, Variant, Dim, Array };
+
+    struct BinPlan {
+        BinOp       op = BinOp::Skip;
+        uint32_t    saved = 0;      // type
+        uint32_t    size = 0;       // of the target
+        uint32_t    count = 0;      // of the target fixed array elements
+        int32_t     element = -1;   // plan
+        uint32_t    first = 0;      // step, one per saved field
+        uint32_t    dataOffset = 0; // of the target variant
+    };
+
+    struct BinStep {
+        int32_t     plan;           // -1 to skip
+        uint32_t    offset;         // in the target
+        uint32_t    index;          // of the target variant alternative
+    };
+
+    struct BinDataLoad {
+        Context *           context;
+        BinReader &         reader;
+        vector<BinType>     types;
+        vector<BinField>    fields;
+        vector<BinPlan>     plans;
+        vector<BinStep>     steps;
+        das_safe_map<tuple<uint32_t,uint32_t,uint64_t>,int32_t> planIndex;
+        BinDataLoad ( Context * ctx, BinReader & r ) : context(ctx), reader(r) {}
+        bool fail ( const char * message ) {
+            return reader.fail(message);
+        }
+        static uint32_t valueSize ( BinKind kind ) {
+            switch ( kind ) {
+                case BinKind::Bool:         return 1;
+                case BinKind::Int8:         return 1;
+                case BinKind::UInt8:        return 1;
+                case BinKind::Int16:        return 2;
+                case BinKind::UInt16:       return 2;
+                case BinKind::Int:          return 4;
+                case BinKind::UInt:         return 4;
+                case BinKind::Int64:        return 8;
+                case BinKind::UInt64:       return 8;
+                case BinKind::Float:        return 4;
+                case BinKind::Double:       return 8;
+                case BinKind::Int2:         return 8;
+                case BinKind::Int3:         return 12;
+                case BinKind::Int4:         return 16;
+                case BinKind::UInt2:        return 8;
+                case BinKind::UInt3:        return 12;
+                case BinKind::UInt4:        return 16;
+                case BinKind::Float2:       return 8;
+                case BinKind::Float3:       return 12;
+                case BinKind::Float4:       return 16;
+                case BinKind::Range:        return 8;
+                case BinKind::URange:       return 8;
+                case BinKind::Enumeration:  return 4;
+                case BinKind::Enumeration8: return 1;
+                case BinKind::Enumeration16:return 2;
+                case BinKind::Bitfield:     return 4;
+                default:                    return 0;
+            }
+        }
+        // header and schema. everything, which the plan relies on, is verified here
+        bool loadSchema () {
+            BinHeader header;
+            if ( !reader.load(header) ) return false;
+            if ( header.magic!=DAS_BIN_MAGIC ) return fail("not a versioned binary data");
+            if ( header.version!=DAS_BIN_VERSION ) return fail("unsupported binary data version");
+            if ( header.size < sizeof(BinHeader) ) return fail("invalid binary data size");
+            uint32_t rest = header.size - uint32_t(sizeof(BinHeader));
+            if ( !reader.file && rest > reader.left ) return fail("binary data too short");
+            reader.left = rest;
+            if ( header.typeCount==0 || uint64_t(header.typeCount)*sizeof(BinType) + uint64_t(header.fieldCount)*sizeof(BinField) > reader.left ) {
+                return fail("invalid binary data schema");
+            }
+            types.resize(header.typeCount);
+            fields.resize(header.fieldCount);
+            if ( !reader.read(types.data(), uint32_t(types.size()*sizeof(BinType))) ) return false;
+            if ( fields.size() && !reader.read(fields.data(), uint32_t(fields.size()*sizeof(BinField))) ) return false;
+            vector<uint8_t> state(types.size(), 0);
+            for ( uint32_t ti=0; ti!=types.size(); ++ti ) {
+                if ( !verifyType(ti, state) ) return fail("invalid binary data schema");
+            }
+            return true;
+        }
+        // parts of the pod are within it, and only arrays can be recursive
+        bool verifyType ( uint32_t ti, vector<uint8_t> & state ) {
+            if ( state[ti]==2 ) return true;
+            if ( state[ti]==1 ) return false;
+            state[ti] = 1;
+            auto & bt = types[ti];
+            switch ( bt.kind ) {
+                case BinKind::String:
+                    if ( bt.pod ) return false;
+                    break;
+                case BinKind::Array:
+                    if ( bt.pod || bt.arg>=types.size() ) return false;
+                    state[ti] = 2;                  // element can refer back to us
+                    return verifyType(bt.arg, state);
+                case BinKind::Dim:
+                    if ( bt.arg>=types.size() || !verifyType(bt.arg, state) ) return false;
+                    if ( bt.pod && (!types[bt.arg].pod || uint64_t(types[bt.arg].size)*bt.count!=bt.size) ) return false;
+                    break;
+                case BinKind::Struct:
+                case BinKind::Tuple:
+                case BinKind::Variant:
+                    if ( uint64_t(bt.arg) + bt.count > fields.size() ) return false;
+                    if ( bt.kind==BinKind::Variant && bt.count==0 ) return false;
+                    for ( uint32_t i=0; i!=bt.count; ++i ) {
+                        auto & field = fields[bt.arg + i];
+                        if ( field.type>=types.size() || !verifyType(field.type, state) ) return false;
+                        if ( bt.pod && (!types[field.type].pod || uint64_t(field.offset) + types[field.type].size > bt.size) ) return false;
+                    }
+                    break;
+                default:
+                    if ( bt.kind>=BinKind::Last || valueSize(bt.kind)!=bt.size || !bt.pod ) return false;
+                    break;
+            }
+            state[ti] = 2;
+            return true;
+        }
+        // saved type has exactly the same layout as the target, so it can be copied as is
+        bool identical ( uint32_t ti, TypeInfo * info ) {
+            auto & bt = types[ti];
+            if ( !bt.pod || bt.size!=info->size || (info->flags & TypeInfo::flag_ref) ) return false;
+            if ( info->dimSize ) {
+                if ( bt.kind!=BinKind::Dim || bt.count!=info->dim[0] ) return false;
+                vector<uint32_t> udim;
+                TypeInfo elementType = binDimElement(info, udim);
+                return identical(bt.arg, &elementType);
+            }
+            switch ( bt.kind ) {
+                case BinKind::Struct: {
+                        if ( info->type!=Type::tStructure ) return false;
+                        auto si = info->structType;
+                        if ( si->count!=bt.count ) return false;
+                        for ( uint32_t i=0; i!=bt.count; ++i ) {
+                            auto & field = fields[bt.arg + i];
+                            if ( field.name!=binFieldName(si->fields[i]->name, i) || field.offset!=si->fields[i]->offset ) return false;
+                            if ( !identical(field.type, si->fields[i]) ) return false;
+                        }
+                        return true;
+                    }
+                case BinKind::Tuple:
+                case BinKind::Variant: {
+                        if ( info->type!=(bt.kind==BinKind::Tuple ? Type::tTuple : Type::tVariant) || info->argCount!=bt.count ) return false;
+                        vector<uint32_t> offsets;
+                        if ( info->type==Type::tTuple ) {
+                            binTupleOffsets(info, offsets);
+                        } else {
+                            offsets.assign(info->argCount, binVariantDataOffset(info));
+                        }
+                        for ( uint32_t i=0; i!=bt.count; ++i ) {
+                            auto & field = fields[bt.arg + i];
+                            if ( field.name!=binFieldName(info->argNames ? info->argNames[i] : nullptr, i) || field.offset!=offsets[i] ) return false;
+                            if ( !identical(field.type, info->argTypes[i]) ) return false;
+                        }
+                        return true;
+                    }
+                case BinKind::Dim:
+                    return false;
+                default:
+                    return bt.kind==binValueKind(info->type);
+            }
+        }
+        int32_t compile ( uint32_t ti, TypeInfo * info ) {
+            auto key = make_tuple(ti, info->dimSize, info->hash);
+            auto it = planIndex.find(key);
+            if ( it!=planIndex.end() ) return it->second;
+            int32_t index = int32_t(plans.size());
+            planIndex[key] = index;
+            plans.push_back(BinPlan());
+            BinPlan plan;
+            plan.saved = ti;
+            plan.size = info->size;
+            auto & bt = types[ti];
+            if ( info->flags & TypeInfo::flag_ref ) {
+                // skip
+            } else if ( identical(ti, info) ) {
+                plan.op = BinOp::Copy;
+            } else if ( info->dimSize ) {
+                if ( bt.kind==BinKind::Dim ) {
+                    vector<uint32_t> udim;
+                    TypeInfo elementType = binDimElement(info, udim);
+                    plan.op = BinOp::Dim;
+                    plan.count = info->dim[0];
+                    plan.element = compile(bt.arg, &elementType);
+                }
+            } else {
+                switch ( bt.kind ) {
+                    case BinKind::String:
+                        if ( info->type==Type::tString ) plan.op = BinOp::String;
+                        break;
+                    case BinKind::Array:
+                        if ( info->type==Type::tArray ) {
+                            plan.op = BinOp::Array;
+                            plan.element = compile(bt.arg, info->firstType);
+                        }
+                        break;
+                    case BinKind::Struct:
+                        if ( info->type==Type::tStructure ) {
+                            auto si = info->structType;
+                            plan.op = BinOp::Fields;
+                            plan.first = uint32_t(steps.size());
+                            steps.resize(steps.size() + bt.count, BinStep{-1,0,0});
+                            for ( uint32_t i=0; i!=bt.count; ++i ) {
+                                auto & field = fields[bt.arg + i];
+                                for ( uint32_t j=0; j!=si->count; ++j ) {
+                                    uint32_t fi = (i + j) % si->count;  // fields are usually where they were
+                                    if ( binFieldName(si->fields[fi]->name, fi)==field.name ) {
+                                        int32_t fp = compile(field.type, si->fields[fi]);
+                                        steps[plan.first + i] = { fp, si->fields[fi]->offset, fi };
+                                        break;
+                                    }
+                                }
+                            }
+                        }
+                        break;
+                    case BinKind::Tuple:
+                    case BinKind::Variant:
+                        if ( info->type==(bt.kind==BinKind::Tuple ? Type::tTuple : Type::tVariant) ) {
+                            vector<uint32_t> offsets;
+                            if ( info->type==Type::tTuple ) {
+                                binTupleOffsets(info, offsets);
+                            } else {
+                                plan.dataOffset = binVariantDataOffset(info);
+                                offsets.assign(info->argCount, plan.dataOffset);
+                            }
+                            plan.op = bt.kind==BinKind::Tuple ? BinOp::Fields : BinOp::Variant;
+                            plan.first = uint32_t(steps.size());
+                            steps.resize(steps.size() + bt.count, BinStep{-1,0,0});
+                            for ( uint32_t i=0; i!=bt.count; ++i ) {
+                                auto & field = fields[bt.arg + i];
+                                for ( uint32_t fi=0; fi!=info->argCount; ++fi ) {
+                                    if ( binFieldName(info->argNames ? info->argNames[fi] : nullptr, fi)==field.name ) {
+                                        int32_t fp = compile(field.type, info->argTypes[fi]);
+                                        steps[plan.first + i] = { fp, offsets[fi], fi };
+                                        break;
+                                    }
+                                }
+                            }
+                        }
+                        break;
+                    default:
+                        break;          // values, which are not identical, are not converted
+                }
+            }
+            plans[index] = plan;
+            return index;
+        }
+        // saved data, which does not go anywhere
+        bool skip ( uint32_t ti ) {
+            auto & bt = types[ti];
+            if ( bt.pod ) return reader.skip(bt.size);
+            switch ( bt.kind ) {
+                case BinKind::String: {
+                        uint32_t length = 0;
+                        return reader.load(length) && reader.skip(length);
+                    }
+                case BinKind::Struct:
+                case BinKind::Tuple:
+                    for ( uint32_t i=0; i!=bt.count; ++i ) {
+                        if ( !skip(fields[bt.arg + i].type) ) return false;
+                    }
+                    return true;
+                case BinKind::Variant: {
+                        uint32_t index = 0;
+                        if ( !reader.load(index) ) return false;
+                        if ( index>=bt.count ) return fail("invalid variant index");
+                        return skip(fields[bt.arg + index].type);
+                    }
+                case BinKind::Dim:
+                    for ( uint32_t i=0; i!=bt.count; ++i ) {
+                        if ( !skip(bt.arg) ) return false;
+                    }
+                    return true;
+                case BinKind::Array: {
+                        uint32_t size = 0;
+                        if ( !reader.load(size) ) return false;
+                        auto & et = types[bt.arg];
+                        if ( et.pod ) return reader.skip(uint32_t(das::min(uint64_t(size) * et.size, uint64_t(UINT32_MAX))));
+                        for ( uint32_t i=0; i!=size; ++i ) {
+                            if ( !skip(bt.arg) ) return false;
+                        }
+                        return true;
+                    }
+                default:
+                    return fail("invalid binary data schema");
+            }
+        }
+        // saved pod, which is already in memory, into the target of the different layout
+        void convert ( int32_t pi, const char * src, char * dst ) {
+            auto & plan = plans[pi];
+            auto & bt = types[plan.saved];
+            switch ( plan.op ) {
+                case BinOp::Copy:
+                    memcpy(dst, src, bt.size);
+                    break;
+                case BinOp::Fields:
+                    for ( uint32_t i=0; i!=bt.count; ++i ) {
+                        auto & step = steps[plan.first + i];
+                        if ( step.plan>=0 ) convert(step.plan, src + fields[bt.arg + i].offset, dst + step.offset);
+                    }
+                    break;
+                case BinOp::Variant: {
+                        uint32_t index = *(const uint32_t *)src;
+                        if ( index>=bt.count ) break;
+                        auto & step = steps[plan.first + index];
+                        if ( step.plan<0 ) break;
+                        selectVariant(plan, dst, step.index);
+                        convert(step.plan, src + fields[bt.arg + index].offset, dst + step.offset);
+                    }
+                    break;
+                case BinOp::Dim: {
+                        uint32_t stride = types[bt.arg].size;
+                        for ( uint32_t i=0; i!=das::min(bt.count, plan.count); ++i ) {
+                            convert(plan.element, src + i*stride, dst + i*plans[plan.element].size);
+                        }
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+        void selectVariant ( const BinPlan & plan, char * dst, uint32_t index ) {
+            if ( *(uint32_t *)dst!=index ) {
+                memset(dst + plan.dataOffset, 0, plan.size - plan.dataOffset);
+                *(uint32_t *)dst = index;
+            }
+        }
+        bool load ( int32_t pi, char * dst ) {
+            auto & plan = plans[pi];
+            auto & bt = types[plan.saved];
+            if ( plan.op==BinOp::Skip ) return skip(plan.saved);
+            if ( plan.op==BinOp::Copy ) return reader.read(dst, bt.size);
+            if ( bt.pod ) {
+                auto src = reader.view(bt.size);
+                if ( !src ) return false;
+                convert(pi, src, dst);
+                return true;
+            }
+            switch ( plan.op ) {
+                case BinOp::String: {
+                        uint32_t length = 0;
+                        if ( !reader.load(length) ) return false;
+                        if ( !length ) {
+                            *(char **)dst = nullptr;
+                            return true;
+                        }
+                        auto src = reader.view(length);
+                        if ( !src ) return false;
+                        *(char **)dst = context->stringHeap->allocateString(src, length);
+                        return true;
+                    }
+                case BinOp::Fields:
+                    for ( uint32_t i=0; i!=bt.count; ++i ) {
+                        auto & step = steps[plan.first + i];
+                        if ( !(step.plan>=0 ? load(step.plan, dst + step.offset) : skip(fields[bt.arg + i].type)) ) return false;
+                    }
+                    return true;
+                case BinOp::Variant: {
+                        uint32_t index = 0;
+                        if ( !reader.load(index) ) return false;
+                        if ( index>=bt.count ) return fail("invalid variant index");
+                        auto & step = steps[plan.first + index];
+                        if ( step.plan<0 ) return skip(fields[bt.arg + index].type);
+                        selectVariant(plan, dst, step.index);
+                        return load(step.plan, dst + step.offset);
+                    }
+                case BinOp::Dim: {
+                        uint32_t stride = plans[plan.element].size;
+                        for ( uint32_t i=0; i!=bt.count; ++i ) {
+                            if ( !(i<plan.count ? load(plan.element, dst + i*stride) : skip(bt.arg)) ) return false;
+                        }
+                        return true;
+                    }
+                case BinOp::Array: {
+                        uint32_t size = 0;
+                        if ( !reader.load(size) ) return false;
+                        auto & element = plans[plan.element];
+                        auto & et = types[bt.arg];
+                        if ( et.pod && uint64_t(size) * et.size > reader.left ) return fail("binary data too short");
+                        auto arr = (Array *) dst;
+                        array_clear(*context, *arr);
+                        array_resize(*context, *arr, size, element.size, true);
+                        if ( element.op==BinOp::Copy ) {
+                            return size ? reader.read(arr->data, size * element.size) : true;  // all of it at once
+                        }
+                        for ( uint32_t i=0; i!=size; ++i ) {
+                            if ( !load(plan.element, arr->data + i*element.size) ) return false;
+                        }
+                        return true;
+                    }
+                default:
+                    return fail("invalid binary data schema");
+            }
+        }
+        bool loadAll ( char * data, TypeInfo * info ) {
+            if ( !loadSchema() ) return false;
+            int32_t root = compile(0, info);
+            return load(root, data) && (reader.left==0 || fail("binary data is longer than expected"));
+        }
+    };
+
+    static char * binaryObject ( vec4f arg, TypeInfo * info ) {
+        return (info->flags & TypeInfo::flag_refType) ? cast<char *>::to(arg) : nullptr;
+    }
+
+    // save_versioned ( obj, block<(bytes)> )
+    vec4f _builtin_binary_save_versioned ( Context & context, SimNode_CallBase * call, vec4f * args ) {
+        TypeInfo * info = call->types[0];
+        char * data = binaryObject(args[0], info);
+        if ( !data ) context.throw_error_at(call->debugInfo, "can only serialize ref types");
+        BinSchema schema;
+        if ( schema.add(info)<0 ) context.throw_error_at(call->debugInfo, "%s", schema.error.c_str());
+        BinDataSave saver(schema, &context);
+        uint32_t total = 0;
+        if ( !saver.measureAll(data, total) ) context.throw_error_at(call->debugInfo, "binary data is over 4GB");
+        char * bytes = context.heap->allocate(total);
+        if ( !bytes ) context.throw_error_at(call->debugInfo, "can't allocate %u bytes of binary data", total);
+        context.heap->mark_comment(bytes, "binary serializer write");
+        BinWriter writer(bytes, total);
+        saver.saveAll(writer, data, total);
+        Array arr;
+        arr.data = bytes;
+        arr.size = total;
+        arr.capacity = total;
+        arr.lock = 1;
+        arr.flags = 0;
+        vec4f arg = cast<char *>::from((char *)&arr);
+        context.invoke(*cast<Block *>::to(args[1]), &arg, nullptr, &call->debugInfo);
+        context.heap->free(bytes, total);
+        return v_zero();
+    }
+
+    // load_versioned ( obj, bytes )
+    vec4f _builtin_binary_load_versioned ( Context & context, SimNode_CallBase * call, vec4f * args ) {
+        TypeInfo * info = call->types[0];
+        char * data = binaryObject(args[0], info);
+        if ( !data ) context.throw_error_at(call->debugInfo, "can only serialize ref types");
+        Array * ba = cast<Array *>::to(args[1]);
+        BinReader reader(ba->data, ba->size);
+        BinDataLoad loader(&context, reader);
+        if ( !loader.loadAll(data, info) ) context.throw_error_at(call->debugInfo, "%s", reader.error.c_str());
+        return v_zero();
+    }
+
+    // fsave_versioned ( file, obj ) : int, bytes written or -1
+    vec4f _builtin_binary_fsave_versioned ( Context & context, SimNode_CallBase * call, vec4f * args ) {
+        auto fp = cast<FILE *>::to(args[0]);
+        if ( !fp ) context.throw_error_at(call->debugInfo, "can't write NULL");
+        TypeInfo * info = call->types[1];
+        char * data = binaryObject(args[1], info);
+        if ( !data ) context.throw_error_at(call->debugInfo, "can only serialize ref types");
+        BinSchema schema;
+        if ( schema.add(info)<0 ) context.throw_error_at(call->debugInfo, "%s", schema.error.c_str());
+        BinDataSave saver(schema, &context);
+        uint32_t total = 0;
+        if ( !saver.measureAll(data, total) ) context.throw_error_at(call->debugInfo, "binary data is over 4GB");
+        BinWriter writer(fp);
+        saver.saveAll(writer, data, total);
+        return cast<int32_t>::from(writer.failed ? -1 : int32_t(total));
+    }
+
+    // fload_versioned ( file, obj ) : bool
+    vec4f _builtin_binary_fload_versioned ( Context & context, SimNode_CallBase * call, vec4f * args ) {
+        auto fp = cast<FILE *>::to(args[0]);
+        if ( !fp ) context.throw_error_at(call->debugInfo, "can't read NULL");
+        TypeInfo * info = call->types[1];
+        char * data = binaryObject(args[1], info);
+        if ( !data ) context.throw_error_at(call->debugInfo, "can only serialize ref types");
+        BinReader reader(fp);
+        BinDataLoad loader(&context, reader);
+        return cast<bool>::from(loader.loadAll(data, info));
+    }
+
 }
@@ -32,14 +32,14 @@ namespace das {
     }
 
     bool PersistentHeapAllocator::mark() {
-        model.shoe.beforeGC();
+        model.beforeGC();
         return true;
     }
 
     void PersistentHeapAllocator::mark ( char * ptr, uint32_t len ) {
         auto it = model.bigStuff.find(ptr);                  // not a big allocation
         if ( it != model.bigStuff.end() ) {
-            it->second |= DAS_PAGE_GC_MASK;
+            das_atomic_mark(it->second, DAS_PAGE_GC_MASK);
             return;
         }
         if ( len <= DAS_MAX_SHOE_ALLOCATION ) {              // not a small allocation
@@ -50,6 +50,7 @@ namespace das {
     }
 
     void PersistentHeapAllocator::report() {
+        model.flushFreeLists();
         LOG tout(LogLevel::debug);
         for ( uint32_t si=0; si!=DAS_MAX_SHOE_CUNKS; ++si ) {
             if ( model.shoe.chunks[si] ) tout << "decks of size " << int((si+1)<<4) << "\n";
@@ -111,6 +112,7 @@ namespace das {
     }
 
     void PersistentStringAllocator::forEachString ( const callable<void (const char *)> & fn ) {
+        model.flushFreeLists();     // cached blocks still look allocated in their decks
         for ( uint32_t si=0; si!=DAS_MAX_SHOE_CUNKS; ++si ) {
             for ( auto ch=model.shoe.chunks[si]; ch; ch=ch->next ) {
                 uint32_t utotal = ch->total / 32;
@@ -239,7 +241,7 @@ namespace das {
     void PersistentStringAllocator::mark ( char * ptr, uint32_t len ) {
         auto it = model.bigStuff.find(ptr);                  // not a big allocation
         if ( it != model.bigStuff.end() ) {
-            it->second |= DAS_PAGE_GC_MASK;
+            das_atomic_mark(it->second, DAS_PAGE_GC_MASK);
             return;
         }
         if ( len <= DAS_MAX_SHOE_ALLOCATION ) {              // not a small allocation
@@ -250,7 +252,7 @@ namespace das {
     }
 
     bool PersistentStringAllocator::mark() {
-        model.shoe.beforeGC();
+        model.beforeGC();
         return true;
     }
 
@@ -267,6 +269,7 @@ namespace das {
     }
 
     void PersistentStringAllocator::report() {
+        model.flushFreeLists();
         LOG tout(LogLevel::debug);
         char buf[33];
         for ( uint32_t si=0; si!=DAS_MAX_SHOE_CUNKS; ++si ) {
@@ -25,3 +25,188 @@ namespace das
     }
 }
 
+
+#include <thread>
+#include <condition_variable>
+
+namespace das
+{
+    struct SamplingProfiler {
+        enum { max_depth = 256 };
+        struct FunctionSamples {
+            int64_t self = 0;
+            int64_t total = 0;
+        };
+        mutex                                   lock;   // guards everything, context can't die while we walk its stack
+        das_hash_set<Context *>                 contexts;
+        das_hash_map<string,int64_t>            folded;
+        das_hash_map<string,FunctionSamples>    functions;
+        int64_t                                 samples = 0;
+        int32_t                                 intervalUsec = 0;
+        bool                                    running = false;
+        condition_variable                      wake;
+        thread                                  timer;
+        vector<const char *>                    frames;
+        das_hash_set<const char *>              seen;
+        // walks Prologue chain of the running context from the innermost frame outwards
+        // context runs on another thread, so every pointer is validated before it's followed;
+        // sample is dropped if anything looks off (i.e. frame is half way pushed)
+        bool walk ( Context * ctx ) {
+            frames.clear();
+        #if DAS_ENABLE_STACK_WALK
+            char * bottom = ctx->stack.bottom();
+            char * top = ctx->stack.top();
+            char * sp = ctx->stack.ap();
+            if ( !bottom || sp<bottom || sp>=top || !ctx->debugInfo ) return false;   // not running
+            auto dinfo = ctx->debugInfo.get();
+            while ( sp < top ) {
+                if ( frames.size()==max_depth ) return false;
+                if ( (intptr_t(sp) & 15) || sp+sizeof(Prologue)>top ) return false;
+                Prologue * pp = (Prologue *) sp;
+                intptr_t iblock = intptr_t(pp->block);
+                uint32_t frameSize;
+                if ( iblock & 1 ) {
+                    // block invoke, block body is part of the function which made it
+                    frameSize = uint32_t(sizeof(Prologue));
+                } else if ( iblock ) {
+                    auto info = (FuncInfo *) iblock;
+                    if ( !dinfo->isOwnPtr((const char *)info) ) return false;
+                    frames.push_back(info->name ? info->name : "?");
+                    frameSize = info->stackSize;
+                } else {
+                    frames.push_back("[aot]");
+                    frameSize = uint32_t(pp->stackSize);
+                }
+                if ( frameSize<sizeof(Prologue) ) return false;
+                sp += frameSize;
+            }
+            return !frames.empty();
+        #else
+            return false;
+        #endif
+        }
+        void record () {
+            TextWriter ss;
+            for ( size_t i=frames.size(); i!=0; --i ) {
+                if ( i!=frames.size() ) ss << ";";
+                ss << frames[i-1];
+            }
+            folded[ss.str()] ++;
+            functions[frames[0]].self ++;
+            seen.clear();
+            for ( auto fn : frames ) {
+                if ( seen.insert(fn).second ) {
+                    functions[fn].total ++;
+                }
+            }
+            samples ++;
+        }
+        void sample () {
+            for ( auto ctx : contexts ) {
+                if ( walk(ctx) ) record();
+            }
+        }
+        void run () {
+            unique_lock<mutex> guard(lock);
+            while ( running ) {
+                wake.wait_for(guard, chrono::microseconds(intervalUsec));
+                if ( running ) sample();
+            }
+        }
+    };
+
+    // intentionally never destroyed, contexts may unregister during static destruction
+    static SamplingProfiler & g_samplingProfiler = *new SamplingProfiler();
+
+    void sampling_profiler_register_context ( Context * context ) {
+        lock_guard<mutex> guard(g_samplingProfiler.lock);
+        g_samplingProfiler.contexts.insert(context);
+    }
+
+    void sampling_profiler_unregister_context ( Context * context ) {
+        lock_guard<mutex> guard(g_samplingProfiler.lock);
+        g_samplingProfiler.contexts.erase(context);
+    }
+
+    bool sampling_profiler_start ( int32_t intervalUsec ) {
+        lock_guard<mutex> guard(g_samplingProfiler.lock);
+        if ( g_samplingProfiler.running ) return false;
+        g_samplingProfiler.intervalUsec = das::max(intervalUsec, 10);
+        g_samplingProfiler.running = true;
+        g_samplingProfiler.timer = thread([](){ g_samplingProfiler.run(); });
+        return true;
+    }
+
+    void sampling_profiler_stop () {
+        thread timer;
+        {
+            lock_guard<mutex> guard(g_samplingProfiler.lock);
+            if ( !g_samplingProfiler.running ) return;
+            g_samplingProfiler.running = false;
+            timer = move(g_samplingProfiler.timer);
+        }
+        g_samplingProfiler.wake.notify_all();
+        timer.join();
+    }
+
+    bool sampling_profiler_is_running () {
+        lock_guard<mutex> guard(g_samplingProfiler.lock);
+        return g_samplingProfiler.running;
+    }
+
+    void sampling_profiler_reset () {
+        lock_guard<mutex> guard(g_samplingProfiler.lock);
+        g_samplingProfiler.folded.clear();
+        g_samplingProfiler.functions.clear();
+        g_samplingProfiler.samples = 0;
+    }
+
+    void sampling_profiler_sample () {
+        lock_guard<mutex> guard(g_samplingProfiler.lock);
+        g_samplingProfiler.sample();
+    }
+
+    int64_t sampling_profiler_samples () {
+        lock_guard<mutex> guard(g_samplingProfiler.lock);
+        return g_samplingProfiler.samples;
+    }
+
+    char * sampling_profiler_folded ( Context * context, LineInfoArg * ) {
+        vector<pair<string,int64_t>> stacks;
+        {
+            lock_guard<mutex> guard(g_samplingProfiler.lock);
+            stacks.assign(g_samplingProfiler.folded.begin(), g_samplingProfiler.folded.end());
+        }
+        sort(stacks.begin(), stacks.end());
+        TextWriter ss;
+        for ( auto & st : stacks ) {
+            ss << st.first << " " << st.second << "\n";
+        }
+        return context->stringHeap->allocateString(ss.str());
+    }
+
+    char * sampling_profiler_report ( Context * context, LineInfoArg * ) {
+        vector<pair<string,SamplingProfiler::FunctionSamples>> fns;
+        int64_t samples;
+        int32_t intervalUsec;
+        {
+            lock_guard<mutex> guard(g_samplingProfiler.lock);
+            fns.assign(g_samplingProfiler.functions.begin(), g_samplingProfiler.functions.end());
+            samples = g_samplingProfiler.samples;
+            intervalUsec = g_samplingProfiler.intervalUsec;
+        }
+        sort(fns.begin(), fns.end(), [](const auto & a, const auto & b){
+            return a.second.self!=b.second.self ? a.second.self>b.second.self : a.first<b.first;
+        });
+        TextWriter ss;
+        ss << samples << " samples";
+        if ( intervalUsec ) ss << ", " << intervalUsec << " usec interval";
+        ss << "\n" << "self\tself %\ttotal\ttotal %\tfunction\n";
+        double scale = samples ? 100. / double(samples) : 0.;
+        for ( auto & fn : fns ) {
+            ss << fn.second.self << "\t" << double(fn.second.self)*scale << "\t"
+                << fn.second.total << "\t" << double(fn.second.total)*scale << "\t" << fn.first << "\n";
+        }
+        return context->stringHeap->allocateString(ss.str());
+    }
+}
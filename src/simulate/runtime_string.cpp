@@ -349,6 +349,290 @@ namespace das
         }
     }
 
+    // direct formatting for the SimNode_StringBuilderFormat. output is the same as of the StringWriter
+
+    static const uint64_t g_sb_pow10[] = {
+        1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull
+    };
+
+    static __forceinline char * sb_uint ( char * out, uint64_t v ) {
+        char tmp[20];
+        int n = 0;
+        do { tmp[n++] = char('0' + v % 10); v /= 10; } while ( v );
+        while ( n ) *out++ = tmp[--n];
+        return out;
+    }
+
+    static __forceinline char * sb_int ( char * out, int64_t v ) {
+        if ( v<0 ) {
+            *out++ = '-';
+            return sb_uint(out, 0ull - uint64_t(v));
+        }
+        return sb_uint(out, uint64_t(v));
+    }
+
+    static __forceinline char * sb_hex ( char * out, uint64_t v ) {
+        char tmp[16];
+        int n = 0;
+        do { tmp[n++] = "0123456789abcdef"[v & 15]; v >>= 4; } while ( v );
+        *out++ = '0';
+        *out++ = 'x';
+        while ( n ) *out++ = tmp[--n];
+        return out;
+    }
+
+    static __forceinline char * sb_digits ( char * out, uint64_t v, int32_t count ) {
+        for ( int32_t i=count-1; i>=0; --i ) {
+            out[i] = char('0' + v % 10);
+            v /= 10;
+        }
+        return out + count;
+    }
+
+    // float is m * 2^e, exactly. false for inf and nan
+    static __forceinline bool sb_float_parts ( float f, uint64_t & m, int32_t & e ) {
+        uint32_t bits;
+        memcpy(&bits, &f, sizeof(bits));
+        uint32_t be = (bits >> 23) & 0xff;
+        if ( be==0xff ) return false;
+        m = bits & 0x7fffff;
+        if ( be ) {
+            m |= 0x800000;
+            e = int32_t(be) - 150;
+        } else {
+            e = -149;
+        }
+        return true;
+    }
+
+    // round(m * 2^e * 10^p), ties to even on the exact value, same as printf. false if it does not fit
+    static __forceinline bool sb_scale ( uint64_t m, int32_t e, int32_t p, uint64_t & res ) {
+        uint64_t num = m * g_sb_pow10[p];   // m < 2^24, p <= 9, so its under 2^54
+        if ( e>=0 ) {
+            if ( e>9 ) return false;
+            res = num << e;
+            return true;
+        }
+        uint32_t k = uint32_t(-e);
+        if ( k>=56 ) {                      // less than a half
+            res = 0;
+            return true;
+        }
+        uint64_t q = num >> k;
+        uint64_t rem = num & ((1ull << k) - 1);
+        uint64_t half = 1ull << (k - 1);
+        if ( rem>half || (rem==half && (q & 1)) ) q ++;
+        res = q;
+        return true;
+    }
+
+    // "%.9f"
+    static char * sb_float_fixed ( char * out, float f ) {
+        uint64_t m, n;
+        int32_t e;
+        if ( !sb_float_parts(f, m, e) || !sb_scale(m, e, 9, n) ) {
+            return out + snprintf(out, 64, "%.9f", f);
+        }
+        if ( signbit(f) ) *out++ = '-';
+        out = sb_uint(out, n / g_sb_pow10[9]);
+        *out++ = '.';
+        return sb_digits(out, n % g_sb_pow10[9], 9);
+    }
+
+    // "%g", only the fixed notation is formatted here
+    static char * sb_float_g ( char * out, float f ) {
+        static const double exp10[] = { 1e-3, 1e-2, 1e-1, 1e0, 1e1, 1e2, 1e3, 1e4, 1e5 };
+        uint64_t m, n;
+        int32_t e;
+        if ( sb_float_parts(f, m, e) ) {
+            if ( m==0 ) {
+                if ( signbit(f) ) *out++ = '-';
+                *out++ = '0';
+                return out;
+            }
+            double a = fabs(double(f));
+            if ( a>=1e-4 && a<1e6 ) {
+                int32_t x = -4;
+                while ( x<5 && a>=exp10[x+4] ) x ++;
+                int32_t p = 5 - x;                  // 6 significant digits
+                sb_scale(m, e, p, n);
+                if ( n==g_sb_pow10[6] ) {           // rounds up to the next power of 10
+                    if ( p==0 ) return out + snprintf(out, 32, "%g", f);
+                    p --;
+                    sb_scale(m, e, p, n);
+                }
+                if ( signbit(f) ) *out++ = '-';
+                out = sb_uint(out, n / g_sb_pow10[p]);
+                uint64_t frac = n % g_sb_pow10[p];
+                if ( frac ) {
+                    while ( frac % 10==0 ) {
+                        frac /= 10;
+                        p --;
+                    }
+                    *out++ = '.';
+                    out = sb_digits(out, frac, p);
+                }
+                return out;
+            }
+        }
+        return out + snprintf(out, 32, "%g", f);
+    }
+
+    static char * sb_enum ( char * out, int64_t value, EnumInfo * info ) {
+        for ( uint32_t t=0; t!=info->count; ++t ) {
+            if ( value==info->fields[t]->value ) {
+                auto len = strlen(info->fields[t]->name);
+                memcpy(out, info->fields[t]->name, len);
+                return out + len;
+            }
+        }
+        memcpy(out, "enum ", 5);
+        return sb_int(out + 5, value);
+    }
+
+    template <typename TT, int dim>
+    __forceinline char * sb_vec_int ( char * out, vec4f v ) {
+        TT comp[4];
+        memcpy(comp, &v, sizeof(comp));
+        for ( int i=0; i!=dim; ++i ) {
+            if ( i ) *out++ = ',';
+            out = is_signed<TT>::value ? sb_int(out, int64_t(comp[i])) : sb_uint(out, uint64_t(comp[i]));
+        }
+        return out;
+    }
+
+    template <int dim>
+    __forceinline char * sb_vec_float ( char * out, vec4f v ) {
+        float comp[4];
+        memcpy(comp, &v, sizeof(comp));
+        for ( int i=0; i!=dim; ++i ) {
+            if ( i ) *out++ = ',';
+            out = sb_float_g(out, comp[i]);
+        }
+        return out;
+    }
+
+    uint32_t SimNode_StringBuilderFormat::maxLength ( StringBuilderPartKind kind, EnumInfo * info ) {
+        switch ( kind ) {
+            case StringBuilderPartKind::Bool:       return 5;
+            case StringBuilderPartKind::Int8:       return 4;
+            case StringBuilderPartKind::UInt8:      return 4;
+            case StringBuilderPartKind::Int16:      return 6;
+            case StringBuilderPartKind::UInt16:     return 6;
+            case StringBuilderPartKind::Int:        return 11;
+            case StringBuilderPartKind::UInt:       return 10;
+            case StringBuilderPartKind::Int64:      return 20;
+            case StringBuilderPartKind::UInt64:     return 18;
+            case StringBuilderPartKind::Float:      return 64;      // FLT_MAX is 50 characters
+            case StringBuilderPartKind::Double:     return 336;     // and DBL_MAX is 328
+            case StringBuilderPartKind::Int2:       return 11*2 + 1;
+            case StringBuilderPartKind::Int3:       return 11*3 + 2;
+            case StringBuilderPartKind::Int4:       return 11*4 + 3;
+            case StringBuilderPartKind::UInt2:      return 10*2 + 1;
+            case StringBuilderPartKind::UInt3:      return 10*3 + 2;
+            case StringBuilderPartKind::UInt4:      return 10*4 + 3;
+            case StringBuilderPartKind::Float2:     return 16*2 + 1;
+            case StringBuilderPartKind::Float3:     return 16*3 + 2;
+            case StringBuilderPartKind::Float4:     return 16*4 + 3;
+            case StringBuilderPartKind::Range:      return 11*2 + 1;
+            case StringBuilderPartKind::URange:     return 10*2 + 1;
+            case StringBuilderPartKind::Enumeration:
+            case StringBuilderPartKind::Enumeration8:
+            case StringBuilderPartKind::Enumeration16: {
+                    uint32_t len = 5 + 11;
+                    for ( uint32_t t=0; t!=info->count; ++t ) {
+                        len = das::max(len, uint32_t(strlen(info->fields[t]->name)));
+                    }
+                    return len;
+                }
+            default:                                return 0;
+        }
+    }
+
+    vec4f SimNode_StringBuilderFormat::eval ( Context & context ) {
+        DAS_PROFILE_NODE
+        vec4f * argValues = (vec4f *)(alloca(nArguments * sizeof(vec4f)));
+        uint32_t * lengths = (uint32_t *)(alloca(nArguments * sizeof(uint32_t)));
+        evalArgs(context, argValues);
+        if ( context.stopFlags ) return v_zero();
+        uint64_t bound = fixedLength;
+        for ( int32_t i=0, a=0; i!=nParts; ++i ) {
+            if ( parts[i].kind==StringBuilderPartKind::Literal ) continue;
+            if ( parts[i].kind==StringBuilderPartKind::String ) {
+                auto str = cast<char *>::to(argValues[a]);
+                lengths[a] = str ? uint32_t(strlen(str)) : 0;
+                bound += lengths[a];
+            }
+            a ++;
+        }
+        if ( bound>0x7fffffff ) {
+            context.throw_error_at(debugInfo, "string builder result is too long");
+        }
+        char stackBuffer[1024];
+        unique_ptr<char[]> heapBuffer;
+        char * buffer = stackBuffer;
+        if ( bound>sizeof(stackBuffer) ) {
+            heapBuffer.reset(new char[bound]);
+            buffer = heapBuffer.get();
+        }
+        char * out = buffer;
+        for ( int32_t i=0, a=0; i!=nParts; ++i ) {
+            const auto & part = parts[i];
+            if ( part.kind==StringBuilderPartKind::Literal ) {
+                memcpy(out, part.text, part.length);
+                out += part.length;
+                continue;
+            }
+            vec4f v = argValues[a];
+            switch ( part.kind ) {
+                case StringBuilderPartKind::String:
+                    if ( lengths[a] ) memcpy(out, cast<char *>::to(v), lengths[a]);
+                    out += lengths[a];
+                    break;
+                case StringBuilderPartKind::Bool:
+                    if ( cast<bool>::to(v) ) { memcpy(out, "true", 4); out += 4; }
+                    else { memcpy(out, "false", 5); out += 5; }
+                    break;
+                case StringBuilderPartKind::Int8:       out = sb_int(out, cast<int8_t>::to(v)); break;
+                case StringBuilderPartKind::UInt8:      out = sb_hex(out, cast<uint8_t>::to(v)); break;
+                case StringBuilderPartKind::Int16:      out = sb_int(out, cast<int16_t>::to(v)); break;
+                case StringBuilderPartKind::UInt16:     out = sb_hex(out, cast<uint16_t>::to(v)); break;
+                case StringBuilderPartKind::Int:        out = sb_int(out, cast<int32_t>::to(v)); break;
+                case StringBuilderPartKind::UInt:       out = sb_hex(out, cast<uint32_t>::to(v)); break;
+                case StringBuilderPartKind::Int64:      out = sb_int(out, cast<int64_t>::to(v)); break;
+                case StringBuilderPartKind::UInt64:     out = sb_hex(out, cast<uint64_t>::to(v)); break;
+                case StringBuilderPartKind::Float:      out = sb_float_fixed(out, cast<float>::to(v)); break;
+                case StringBuilderPartKind::Double:     out += snprintf(out, 336, "%.17f", cast<double>::to(v)); break;
+                case StringBuilderPartKind::Int2:       out = sb_vec_int<int32_t,2>(out, v); break;
+                case StringBuilderPartKind::Int3:       out = sb_vec_int<int32_t,3>(out, v); break;
+                case StringBuilderPartKind::Int4:       out = sb_vec_int<int32_t,4>(out, v); break;
+                case StringBuilderPartKind::UInt2:      out = sb_vec_int<uint32_t,2>(out, v); break;
+                case StringBuilderPartKind::UInt3:      out = sb_vec_int<uint32_t,3>(out, v); break;
+                case StringBuilderPartKind::UInt4:      out = sb_vec_int<uint32_t,4>(out, v); break;
+                case StringBuilderPartKind::Float2:     out = sb_vec_float<2>(out, v); break;
+                case StringBuilderPartKind::Float3:     out = sb_vec_float<3>(out, v); break;
+                case StringBuilderPartKind::Float4:     out = sb_vec_float<4>(out, v); break;
+                case StringBuilderPartKind::Range:      out = sb_vec_int<int32_t,2>(out, v); break;
+                case StringBuilderPartKind::URange:     out = sb_vec_int<uint32_t,2>(out, v); break;
+                case StringBuilderPartKind::Enumeration:    out = sb_enum(out, cast<int32_t>::to(v), part.enumInfo); break;
+                case StringBuilderPartKind::Enumeration8:   out = sb_enum(out, cast<int8_t>::to(v), part.enumInfo); break;
+                case StringBuilderPartKind::Enumeration16:  out = sb_enum(out, cast<int16_t>::to(v), part.enumInfo); break;
+                default:                                    DAS_ASSERTF(0, "unsupported string builder part"); break;
+            }
+            a ++;
+        }
+        int length = int(out - buffer);
+        if ( length ) {
+            auto pStr = context.stringHeap->allocateString(buffer, length);
+            if ( !pStr  ) {
+                context.throw_error("can't allocate string builder result, out of heap");
+            }
+            return cast<char *>::from(pStr);
+        } else {
+            return v_zero();
+        }
+    }
+
     // string iteration
 
     bool StringIterator::first ( Context &, char * _value )  {
@@ -9,6 +9,10 @@ namespace das
         if ( arr.data ) {
             memset(arr.hashes, 0, arr.capacity*sizeof(uint64_t));
             memset(arr.data, 0, arr.keys - arr.data);
+            if ( arr.swiss ) {
+                memset(arr.hashes + arr.capacity, ctrl_empty, arr.capacity);
+                arr.maxLookups = arr.capacity - arr.capacity/8;
+            }
         }
         arr.size = 0;
     }
@@ -108,7 +112,7 @@ namespace das
         for ( uint32_t i=0; i!=total; ++i, pTable-- ) {
             if ( pTable->data ) {
                 if ( !pTable->isLocked() ) {
-                    uint32_t oldSize = pTable->capacity*(vts_add_kts + sizeof(uint64_t));
+                    uint32_t oldSize = pTable->capacity*table_slot_size(*pTable, vts_add_kts);
                     context.heap->free(pTable->data, oldSize);
                 } else {
                     context.throw_error("deleting locked table");
@@ -4,6 +4,7 @@
 #include "daScript/simulate/simulate_nodes.h"
 #include "daScript/simulate/runtime_string.h"
 #include "daScript/simulate/debug_print.h"
+#include "daScript/simulate/runtime_profile.h"
 #include "daScript/misc/fpe.h"
 #include "daScript/misc/debug_break.h"
 
@@ -516,6 +517,18 @@ namespace das
         return that;
     }
 
+    // SimNode_StringBuilderFormat
+
+    SimNode * SimNode_StringBuilderFormat::copyNode ( Context & context, NodeAllocator * code ) {
+        SimNode_StringBuilderFormat * that = (SimNode_StringBuilderFormat *) SimNode_CallBase::copyNode(context, code);
+        if ( nParts ) {
+            StringBuilderPart * newParts = (StringBuilderPart *) code->allocate(nParts * sizeof(StringBuilderPart));
+            memcpy ( newParts, that->parts, nParts * sizeof(StringBuilderPart));
+            that->parts = newParts;
+        }
+        return that;
+    }
+
     // SimNode_Final
 
     SimNode * SimNode_Final::copyNode ( Context & context, NodeAllocator * code ) {
@@ -1046,6 +1059,13 @@ namespace das
 
     void Context::makeWorkerFor(const Context & ctx)
     {
+        // globals and shared memory belong to the context, not to the program
+        // (on condition that all context globals are read-only)
+        globals = ctx.globals;
+        globalsOwner = false;
+        shared = ctx.shared;
+        sharedOwner = false;
+
         if (code == ctx.code)
             return;
 
@@ -1055,10 +1075,9 @@ namespace das
         thisProgram = ctx.thisProgram;
         thisHelper = ctx.thisHelper;
         category.value = ctx.category.value;
+        swissTables = ctx.swissTables;
 
-        // globals (on condition that all context globals are read-only)
-        globals = ctx.globals;
-        globalsOwner = false;
+        // globals
         annotationData = ctx.annotationData;
         globalsSize = ctx.globalsSize;
         globalInitStackSize = ctx.globalInitStackSize;
@@ -1067,8 +1086,6 @@ namespace das
 
         // shared
         sharedSize = ctx.sharedSize;
-        shared = ctx.shared;
-        sharedOwner = false;
         // functions
         functions = ctx.functions;
         totalFunctions = ctx.totalFunctions;
@@ -1077,6 +1094,15 @@ namespace das
         tabMnLookup = ctx.tabMnLookup;
         tabGMnLookup = ctx.tabGMnLookup;
         tabAdLookup = ctx.tabAdLookup;
+
+        // heap is private to the worker
+        if ( !heap ) {
+            heap = make_smart<LinearHeapAllocator>();
+            stringHeap = make_smart<LinearStringAllocator>();
+            if ( ctx.stringHeap ) stringHeap->setIntern(ctx.stringHeap->isIntern());
+        }
+        // globals are not ours to finalize
+        shutdown = true;
     }
 
     uint64_t Context::getSharedMemorySize() const {
@@ -1100,6 +1126,8 @@ namespace das
 
     Context::Context(const Context & ctx, uint32_t category_): stack(ctx.stack.size()) {
         persistent = ctx.persistent;
+        swissTables = ctx.swissTables;
+        cloneSnapshot = ctx.cloneSnapshot;
         code = ctx.code;
         constStringHeap = ctx.constStringHeap;
         debugInfo = ctx.debugInfo;
@@ -1142,7 +1170,15 @@ namespace das
         // register
         announceCreation();
         // now, make it good to go
+        initializeClone(&ctx);
+    }
+
+    void Context::initializeClone ( const Context * from ) {
         restart();
+        if ( from && from->cloneSnapshot && copyGlobalsFrom(*from) ) {
+            restart();
+            return;
+        }
         if ( stack.size() > globalInitStackSize ) {
             runInitScript();
         } else {
@@ -1152,9 +1188,32 @@ namespace das
             runInitScript();
         }
         restart();
+        // if globals do not point to the heap, they can be restored with a copy on reset
+        if ( globals && globalsOwner && !globalsSnapshot && !stopFlags
+                && heap->bytesAllocated()==0 && stringHeap->bytesAllocated()==0 ) {
+            globalsSnapshot = (char *) das_aligned_alloc16(globalsSize);
+            memcpy ( globalsSnapshot, globals, globalsSize );
+        }
+    }
+
+    // bring clone to the state right after construction, so that it can be reused
+    // snapshot clones are brought to the current state of 'from' instead
+    void Context::resetClone ( const Context * from ) {
+        DAS_ASSERTF(insideContext==0,"can't reset locked context");
+        runShutdownScript();
+        shutdown = false;
+        restart();
+        restartHeaps();
+        if ( globalsSnapshot && !(from && from->cloneSnapshot) ) {
+            memcpy ( globals, globalsSnapshot, globalsSize );
+        } else {
+            initializeClone(from);
+        }
     }
 
     Context::~Context() {
+        sampling_profiler_unregister_context(this);
+        abortHeapCollection();
         on_debug_agent_mutex([&](){
             // unregister
             category.value |= uint32_t(ContextCategory::dead);
@@ -1169,9 +1228,15 @@ namespace das
         if ( globals && globalsOwner ) {
             das_aligned_free16(globals);
         }
+        if ( globalsSnapshot ) {
+            das_aligned_free16(globalsSnapshot);
+        }
         if ( shared && sharedOwner ) {
             das_aligned_free16(shared);
         }
+        if ( functionProfile ) {
+            delete [] functionProfile;
+        }
     }
 
     struct SimNodeRelocator : SimVisitor {
@@ -1251,6 +1316,7 @@ namespace das
     }
 
     void Context::announceCreation() {
+        sampling_profiler_register_context(this);
         for_each_debug_agent([&](const DebugAgentPtr & pAgent){
             pAgent->onCreateContext(this);
         });
@@ -1274,6 +1340,156 @@ namespace das
         }
     };
 
+    // globals of the clone start as a byte copy of the source globals
+    // everything they reference on the source heaps is copied to the clone heaps, and pointers are patched in place
+    // copied heap ranges are remembered, so that two pointers to the same data still point to the same copy
+    class GlobalsCopyWalker : public DataWalker {
+    public:
+        GlobalsCopyWalker ( Context & to_, const Context & from_ ) : to(to_), from(from_) {}
+        virtual void walk ( char * pa, TypeInfo * info ) override {
+            if ( cancel || !pa ) return;
+            if ( info->type==Type::tHandle ) {
+                // handled types can own native resources, only pod ones can be copied as bytes
+                if ( !(info->flags & TypeInfo::flag_isPod) ) cancel = true;
+                return;
+            }
+            if ( info->dimSize==0 ) {
+                switch ( info->type ) {
+                case Type::tPointer:
+                    copyPointer((char **)pa, info);
+                    return;
+                case Type::tLambda:
+                case Type::tIterator:
+                    if ( *(void **)pa ) cancel = true;
+                    return;
+                default:
+                    break;
+                }
+            }
+            DataWalker::walk(pa, info);
+        }
+        virtual bool canVisitArrayData ( TypeInfo * ti ) override {
+            return !(ti->flags & TypeInfo::flag_isRawPod);
+        }
+        virtual bool canVisitTableData ( TypeInfo * ti ) override {
+            return !(ti->firstType->flags & TypeInfo::flag_isRawPod) || !(ti->secondType->flags & TypeInfo::flag_isRawPod);
+        }
+        virtual void beforeArray ( Array * pa, TypeInfo * ti ) override {
+            pa->lock = 0;
+            if ( pa->data ) {
+                bool fresh;
+                pa->data = copyRange(pa->data, ti->firstType->size * pa->capacity, fresh);
+            }
+        }
+        virtual void beforeTable ( Table * pt, TypeInfo * ti ) override {
+            pt->lock = 0;
+            if ( !pt->data ) return;
+            if ( pt->size && ti->firstType->type==Type::tPointer ) {
+                cancel = true;      // keys are hashed by address
+                return;
+            }
+            auto keysOffset = pt->keys - pt->data;
+            auto hashesOffset = (char *) pt->hashes - pt->data;
+            bool fresh;
+            pt->data = copyRange(pt->data, table_slot_size(*pt, ti->firstType->size + ti->secondType->size) * pt->capacity, fresh);
+            pt->keys = pt->data + keysOffset;
+            pt->hashes = (uint64_t *) (pt->data + hashesOffset);
+        }
+        virtual void String ( char * & str ) override {
+            if ( !str || from.constStringHeap->isOwnPtr(str) ) return;
+            uint32_t len = uint32_t(strlen(str));
+            if ( !from.stringHeap->isOwnPtr(str, len + 1) ) return;
+            auto cs = to.stringHeap->allocateString(str, len);     // strings are values, shared ones are not merged back
+            if ( !cs ) {
+                cancel = true;
+                return;
+            }
+            str = cs;
+        }
+        void copyPointer ( char ** pp, TypeInfo * info ) {
+            char * p = *pp;
+            if ( !p ) return;
+            if ( info->flags & TypeInfo::flag_isSmartPtr ) {
+                cancel = true;
+                return;
+            }
+            if ( from.isGlobalPtr(p) ) {
+                *pp = to.globals + (p - from.globals);      // data itself is copied with its own global
+                return;
+            }
+            auto pointee = info->firstType;
+            if ( !pointee || pointee->type==Type::tVoid ) {
+                if ( from.heap->isOwnPtr(p, 1) ) cancel = true;
+                return;
+            }
+            uint32_t size = pointee->size;
+            if ( pointee->type==Type::tStructure && pointee->dimSize==0 ) {
+                auto si = pointee->structType;
+                if ( si->flags & StructInfo::flag_lambda ) {
+                    cancel = true;
+                    return;
+                }
+                if ( si->flags & StructInfo::flag_class ) {
+                    if ( auto rtti = *(TypeInfo **) p ) size = rtti->structType->size;
+                }
+            }
+            bool fresh;
+            *pp = copyRange(p, size, fresh);
+            if ( fresh ) DataWalker::walk(*pp, pointee);
+        }
+        char * copyRange ( char * p, uint32_t size, bool & fresh ) {
+            fresh = false;
+            if ( cancel || !size || !from.heap->isOwnPtr(p, size) ) return p;
+            auto it = ranges.upper_bound(p);
+            if ( it != ranges.begin() ) {
+                auto pit = prev(it);
+                auto pend = pit->first + pit->second.second;
+                if ( p < pend ) {
+                    if ( p + size <= pend ) return pit->second.first + (p - pit->first);
+                    cancel = true;
+                    return p;
+                }
+            }
+            if ( it != ranges.end() && it->first < p + size ) {
+                cancel = true;      // pointer into the middle of something, which is only copied later
+                return p;
+            }
+            auto np = (char *) to.heap->allocate(size);
+            if ( !np ) {
+                cancel = true;
+                return p;
+            }
+            to.heap->mark_comment(np, "clone snapshot");
+            memcpy(np, p, size);
+            ranges[p] = make_pair(np, size);
+            fresh = true;
+            return np;
+        }
+    protected:
+        Context &                           to;
+        const Context &                     from;
+        map<char *,pair<char *,uint32_t>>   ranges;
+    };
+
+    // if it can't be done (native resources, lambdas, pointers the walker can't follow) globals and heaps are left undefined
+    bool Context::copyGlobalsFrom ( const Context & ctx ) {
+        DAS_ASSERTF(code==ctx.code, "can only copy globals of the context of the same program");
+        if ( !globals ) return true;
+        memcpy ( globals, ctx.globals, globalsSize );
+        GlobalsCopyWalker walker(*this, ctx);
+        for ( int i=0; i!=totalVariables && !walker.cancel; ++i ) {
+            auto & pv = globalVariables[i];
+            if ( !pv.shared ) {
+                walker.walk(globals + pv.offset, pv.debugInfo);
+            }
+        }
+        if ( walker.cancel ) {
+            restartHeaps();
+            return false;
+        }
+        return true;
+    }
+
     void Context::runInitScript ( ) {
         DAS_ASSERTF(insideContext==0,"can't run init script on the locked context");
         char * EP, *SP;
@@ -1797,6 +2013,7 @@ namespace das
 #endif
 
     vec4f Context::evalWithCatch ( SimNode * node ) {
+        if ( gcMarkState ) abortHeapCollection();   // incremental collection can't survive script code
         auto aa = abiArg;
         auto acm = abiCMRES;
         auto atba = abiThisBlockArg;
@@ -1838,6 +2055,7 @@ namespace das
     }
 
     bool Context::runWithCatch ( const callable<void()> & subexpr ) {
+        if ( gcMarkState ) abortHeapCollection();   // incremental collection can't survive script code
         auto aa = abiArg;
         auto acm = abiCMRES;
         auto atba = abiThisBlockArg;
@@ -1882,6 +2100,7 @@ namespace das
     }
 
     vec4f Context::evalWithCatch ( SimFunction * fnPtr, vec4f * args, void * res ) {
+        if ( gcMarkState ) abortHeapCollection();   // incremental collection can't survive script code
         auto aa = abiArg;
         auto acm = abiCMRES;
         auto atba = abiThisBlockArg;
@@ -2009,6 +2228,7 @@ namespace das
 #else
         tout << "\nPROFILER IS DISABLED\n";
 #endif
+        collectFunctionProfile(tout);
     }
 
 #ifdef _MSC_VER
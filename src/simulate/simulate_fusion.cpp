@@ -8,16 +8,49 @@
 #include "daScript/simulate/simulate_fusion.h"
 #include "daScript/simulate/sim_policy.h"
 #include "daScript/simulate/simulate_visit_op.h"
+#include "daScript/ast/ast_compile_profile.h"
+#include "daScript/misc/fnv.h"
 
 namespace das {
 
-    bool FusionPoint::is ( const SimNodeInfoLookup & info, SimNode * node, const char * name ) {
+    static mutex g_simNodeKindMutex;
+    static das_hash_map<uint64_t,SimNodeKind> g_simNodeKinds;     // hash of the name to kind
+    static vector<string> g_simNodeKindNames = { "" };
+
+    SimNodeKind internSimNodeKind ( const char * name ) {
+        if ( !name || !*name ) return 0;
+        lock_guard<mutex> guard(g_simNodeKindMutex);
+        // open addressing on top of the map, in case of the 64-bit hash collision
+        for ( uint64_t hv = hash_blockz64((const uint8_t *)name); ; ++hv ) {
+            auto it = g_simNodeKinds.find(hv);
+            if ( it==g_simNodeKinds.end() ) {
+                auto kind = SimNodeKind(g_simNodeKindNames.size());
+                g_simNodeKindNames.push_back(name);
+                g_simNodeKinds[hv] = kind;
+                return kind;
+            } else if ( g_simNodeKindNames[it->second]==name ) {
+                return it->second;
+            }
+        }
+    }
+
+    const char * getSimNodeKindName ( SimNodeKind kind ) {
+        lock_guard<mutex> guard(g_simNodeKindMutex);
+        return kind<g_simNodeKindNames.size() ? g_simNodeKindNames[kind].c_str() : "";
+    }
+
+    SimNodeKind FusionPoint::kind ( const SimNodeInfoLookup & info, SimNode * node ) {
+        auto it = info.find(node);
+        return it!=info.end() ? it->second.name : 0;
+    }
+
+    bool FusionPoint::is ( const SimNodeInfoLookup & info, SimNode * node, SimNodeKind name ) {
         auto it = info.find(node);
         if ( it==info.end() ) return false;
         return it->second.name == name;
     }
 
-    bool FusionPoint::is2 ( const SimNodeInfoLookup & info, SimNode * lnode, SimNode * rnode, const char * lname, const char * rname ) {
+    bool FusionPoint::is2 ( const SimNodeInfoLookup & info, SimNode * lnode, SimNode * rnode, SimNodeKind lname, SimNodeKind rname ) {
         auto itl = info.find(lnode);
         if ( itl==info.end() || itl->second.name!=lname ) return false;
         auto itr = info.find(rnode);
@@ -25,12 +58,24 @@ namespace das {
         return true;
     }
 
-    bool FusionPoint::is ( const SimNodeInfoLookup & info, SimNode * node, const char * name, const char * typeName ) {
+    bool FusionPoint::is ( const SimNodeInfoLookup & info, SimNode * node, SimNodeKind name, SimNodeKind typeName ) {
         auto it = info.find(node);
         if ( it==info.end() ) return false;
         return (it->second.name == name) && (it->second.typeName==typeName);
     }
 
+    bool FusionPoint::is ( const SimNodeInfoLookup & info, SimNode * node, const char * name ) {
+        return is(info, node, internSimNodeKind(name));
+    }
+
+    bool FusionPoint::is2 ( const SimNodeInfoLookup & info, SimNode * lnode, SimNode * rnode, const char * lname, const char * rname ) {
+        return is2(info, lnode, rnode, internSimNodeKind(lname), internSimNodeKind(rname));
+    }
+
+    bool FusionPoint::is ( const SimNodeInfoLookup & info, SimNode * node, const char * name, const char * typeName ) {
+        return is(info, node, internSimNodeKind(name), internSimNodeKind(typeName));
+    }
+
     SimNode * SimNode_Op1Fusion::visit(SimVisitor & vis) {
         V_BEGIN();
         string name = op;
@@ -59,6 +104,24 @@ namespace das {
         V_END();
     }
 
+    SimNode * SimNode_Op2At::visit(SimVisitor & vis) {
+        V_BEGIN();
+        string name = op;
+        name += getSimSourceName(l.type);
+        name += getSimSourceName(r.type);
+        if (baseType != Type::none) {
+            vis.op(name.c_str(), getTypeBaseSize(baseType), das_to_string(baseType));
+        } else {
+            vis.op(name.c_str());
+        }
+        l.visit(vis);
+        r.visit(vis);
+        V_ARG(stride);
+        V_ARG(offset);
+        V_ARG(range);
+        V_END();
+    }
+
     SimNode * FusionPointOp1::fuseOp1(const SimNodeInfoLookup & info, SimNode * node, SimNode * node_x, Context * context) {
         SimNode_Op1Fusion * result = (SimNode_Op1Fusion *) match(info,node,node_x,context);
         if (result) {
@@ -112,10 +175,6 @@ namespace das {
         return "???";
     }
 
-    string fuseName ( const string & name, const string & typeName ) {
-        return typeName.empty() ? name : (name + "<" + typeName + ">");
-    }
-
     // TODO: at some point we should share fusion engine
     DAS_THREAD_LOCAL unique_ptr<FusionEngine> g_fusionEngine;
 
@@ -134,6 +193,7 @@ namespace das {
             createFusionEngine_return();
             createFusionEngine_ptrfdr();
             createFusionEngine_if();
+            createFusionEngine_if_cmp();
             // scalar
             createFusionEngine_op2();
             createFusionEngine_op2_set();
@@ -152,6 +212,8 @@ namespace das {
             // call
             createFusionEngine_call1();
             createFusionEngine_call2();
+            // loops
+            createFusionEngine_for_array();
 #endif
         }
     }
@@ -162,19 +224,17 @@ namespace das {
             thisNode = node;
         }
         virtual void op ( const char * name, uint32_t typeSize, const string & typeName ) override {
-            SimNodeInfo ni;
-            ni.name = name;
-            ni.typeName = typeName;
+            auto & ni = info[thisNode];
+            ni.name = internSimNodeKind(name);
+            ni.typeName = internSimNodeKind(typeName.c_str());
             ni.typeSize = typeSize;
-            info[thisNode] = ni;
-
         }
-        das_hash_map<SimNode *,SimNodeInfo>  info;
-        SimNode * thisNode = nullptr;
+        SimNodeInfoLookup   info;
+        SimNode *           thisNode = nullptr;
     };
 
     struct SimFusion : SimVisitor {
-        SimFusion ( Context * ctx, TextWriter & wr,  das_hash_map<SimNode *,SimNodeInfo> && ni )
+        SimFusion ( Context * ctx, TextWriter & wr, SimNodeInfoLookup && ni )
             : context(ctx), ss(wr), info(ni) {
                 createFusionEngine();
         }
@@ -182,15 +242,16 @@ namespace das {
             fused = true;
         }
         virtual SimNode * visit ( SimNode * node ) override {
-            auto & ni = info[node];
-            auto it = g_fusionEngine->find(fuseName(ni.name, ni.typeName));
-            if ( it != g_fusionEngine->end() ) {
-                auto & nv = it->second;
-                for ( const auto & fe : nv ) {
-                    auto newNode = fe->fuse(info, node, context);
-                    if ( newNode != node ) {
-                        fuse();
-                        return newNode;
+            auto itn = info.find(node);
+            if ( itn != info.end() ) {
+                auto it = g_fusionEngine->find(fusionKey(itn->second.name, itn->second.typeName));
+                if ( it != g_fusionEngine->end() ) {
+                    for ( const auto & fe : it->second ) {
+                        auto newNode = fe->fuse(info, node, context);
+                        if ( newNode != node ) {
+                            fuse();
+                            return newNode;
+                        }
                     }
                 }
             }
@@ -199,39 +260,46 @@ namespace das {
         Context * context = nullptr;
         TextWriter & ss;
         bool fused = false;
-        das_hash_map<SimNode *,SimNodeInfo> & info;
+        SimNodeInfoLookup & info;
     };
 
+    static bool fuseNode ( Context & context, TextWriter & logs, SimNode * & root ) {
+        SimNodeCollector collector;
+        root->visit(collector);
+        SimFusion fuse(&context, logs, das::move(collector.info));
+        root = root->visit(fuse);
+        return fuse.fused;
+    }
+
     void Program::fusion ( Context & context, TextWriter & logs ) {
+        CompileProfileScope profileScope("pass", "fusion");
         // log all functions
         if ( options.getBoolOption("fusion",true) ) {
+            // fusion is local to the node tree, so only trees which changed on the previous iteration are revisited
+            vector<bool> dirtyVar(context.totalVariables, true);
+            vector<bool> dirtyFn(context.totalFunctions, true);
             bool anyFusion = true;
             while ( anyFusion) {
                 anyFusion = false;
                 for ( int g=0; g!=context.totalVariables; ++g ) {
                     GlobalVariable * var = context.globalVariables + g;
-                    if ( var->init ) {
-                        SimNodeCollector collector;
-                        var->init->visit(collector);
-                        SimFusion fuse(&context, logs, move(collector.info));
-                        var->init = var->init->visit(fuse);
-                        anyFusion |= fuse.fused;
+                    if ( var->init && dirtyVar[g] ) {
+                        dirtyVar[g] = fuseNode(context, logs, var->init);
+                        anyFusion |= dirtyVar[g];
                     }
                 }
                 for ( int i=0; i!=context.totalFunctions; ++i ) {
-                    SimFunction * fn = context.getFunction(i);
-                    SimNodeCollector collector;
-                    fn->code->visit(collector);
-                    SimFusion fuse(&context, logs, move(collector.info));
-                    fn->code = fn->code->visit(fuse);
-                    anyFusion |= fuse.fused;
+                    if ( dirtyFn[i] ) {
+                        SimFunction * fn = context.getFunction(i);
+                        dirtyFn[i] = fuseNode(context, logs, fn->code);
+                        anyFusion |= dirtyFn[i];
+                    }
                 }
             }
         }
     }
 
     void registerFusion ( const char * OpName, const char * CTypeName, FusionPoint * node ) {
-        (*g_fusionEngine)[fuseName(OpName,CTypeName)].emplace_back(node);
+        (*g_fusionEngine)[fusionKey(internSimNodeKind(OpName),internSimNodeKind(CTypeName))].emplace_back(node);
     }
 }
-
@@ -14,27 +14,6 @@
 
 namespace das {
 
-    struct SimNode_Op2At : SimNode_Op2Fusion {
-        virtual SimNode * visit(SimVisitor & vis) override {
-            V_BEGIN();
-            string name = op;
-            name += getSimSourceName(l.type);
-            name += getSimSourceName(r.type);
-            if (baseType != Type::none) {
-                vis.op(name.c_str(), getTypeBaseSize(baseType), das_to_string(baseType));
-            } else {
-                vis.op(name.c_str());
-            }
-            l.visit(vis);
-            r.visit(vis);
-            V_ARG(stride);
-            V_ARG(offset);
-            V_ARG(range);
-            V_END();
-        }
-        uint32_t  stride, offset, range;
-    };
-
 /* AtR2V SCALAR */
 
 #define IMPLEMENT_OP2_SET_NODE_ANY(INLINE,OPNAME,TYPE,CTYPE,COMPUTEL) \
@@ -153,8 +132,8 @@ namespace das {
     void createFusionEngine_at() {
         REGISTER_SETOP_SCALAR(AtR2V);
         REGISTER_SETOP_NUMERIC_VEC(AtR2V);
-        (*g_fusionEngine)["At"].emplace_back(new FusionPoint_Set_At_StringPtr());
-        (*g_fusionEngine)["At"].emplace_back(new FusionPoint_Set_At_VoidPtr());
+        registerFusion("At","",new FusionPoint_Set_At_StringPtr());
+        registerFusion("At","",new FusionPoint_Set_At_VoidPtr());
     }
 }
 
@@ -258,9 +258,9 @@ IMPLEMENT_ANY_OP2(__forceinline, CallAndCopyOrMove, Ptr, StringPtr)
 IMPLEMENT_ANY_OP2(__forceinline, FastCall, Ptr, StringPtr)
 
     void createFusionEngine_call2() {
-        (*g_fusionEngine)["Call"].emplace_back(new FusionPoint_Call_StringPtr());
-        (*g_fusionEngine)["CallAndCopyOrMove"].emplace_back(new FusionPoint_CallAndCopyOrMove_StringPtr());
-        (*g_fusionEngine)["FastCall"].emplace_back(new FusionPoint_FastCall_StringPtr());
+        registerFusion("Call","",new FusionPoint_Call_StringPtr());
+        registerFusion("CallAndCopyOrMove","",new FusionPoint_CallAndCopyOrMove_StringPtr());
+        registerFusion("FastCall","",new FusionPoint_FastCall_StringPtr());
     }
 }
 
@@ -0,0 +1,417 @@
+#include "daScript/misc/platform.h"
+
+#ifdef _MSC_VER
+#pragma warning(disable:4505)
+#endif
+
+#include "daScript/simulate/simulate_fusion.h"
+
+#if DAS_FUSION
+
+#include "daScript/simulate/sim_policy.h"
+#include "daScript/simulate/runtime_array.h"
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/simulate_visit_op.h"
+
+namespace das {
+
+    // loops over arrays, where the only statement of the body is already fused arithmetic
+    //  for x in a              s += x          sum
+    //  for x,y in a,b          s += x * y      dot
+    //  for x in a              x op= k         map, op is + - *
+    //  for x,y in a,b          x += y * k      axpy
+    //  elements are float, int or float4, s is local variable, and k is loop invariant (constant, local or argument)
+    //  whole loop runs natively, 4 elements at a time where data is tightly packed
+    //  float reductions are accumulated in the original order, so that the result is bit exact with the body
+    //  original body is kept, so that visitors (and jit) see the same tree as before fusion
+
+    template <typename TT> struct ForArrayOps;
+
+    template <> struct ForArrayOps<float> {
+        typedef float Scalar;
+        enum { simd = 1, simdReduce = 0 };      // reordering the sum changes the result
+        static __forceinline Scalar load ( const char * p ) { return *(const float *)p; }
+        static __forceinline void store ( char * p, Scalar v ) { *(float *)p = v; }
+        static __forceinline Scalar fromVec ( vec4f v ) { return v_extract_x(v); }
+        static __forceinline Scalar add ( Scalar a, Scalar b ) { return a + b; }
+        static __forceinline Scalar sub ( Scalar a, Scalar b ) { return a - b; }
+        static __forceinline Scalar mul ( Scalar a, Scalar b ) { return a * b; }
+        static __forceinline vec4f loadV ( const char * p ) { return v_ldu((const float *)p); }
+        static __forceinline void storeV ( char * p, vec4f v ) { v_stu(p, v); }
+        static __forceinline vec4f splatV ( Scalar v ) { return v_splats(v); }
+        static __forceinline Scalar reduceV ( vec4f ) { return 0.0f; }
+        static __forceinline vec4f addV ( vec4f a, vec4f b ) { return v_add(a, b); }
+        static __forceinline vec4f subV ( vec4f a, vec4f b ) { return v_sub(a, b); }
+        static __forceinline vec4f mulV ( vec4f a, vec4f b ) { return v_mul(a, b); }
+    };
+
+    template <> struct ForArrayOps<int32_t> {
+        typedef int32_t Scalar;
+        enum { simd = 1, simdReduce = 1 };
+        static __forceinline Scalar load ( const char * p ) { return *(const int32_t *)p; }
+        static __forceinline void store ( char * p, Scalar v ) { *(int32_t *)p = v; }
+        static __forceinline Scalar fromVec ( vec4f v ) { return v_extract_xi(v_cast_vec4i(v)); }
+        static __forceinline Scalar add ( Scalar a, Scalar b ) { return a + b; }
+        static __forceinline Scalar sub ( Scalar a, Scalar b ) { return a - b; }
+        static __forceinline Scalar mul ( Scalar a, Scalar b ) { return a * b; }
+        static __forceinline vec4f loadV ( const char * p ) { return v_cast_vec4f(v_ldui((const int *)p)); }
+        static __forceinline void storeV ( char * p, vec4f v ) { v_stu(p, v); }
+        static __forceinline vec4f splatV ( Scalar v ) { return v_cast_vec4f(v_splatsi(v)); }
+        static __forceinline Scalar reduceV ( vec4f v ) {
+            int32_t lanes[4];
+            v_stu(lanes, v);
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        }
+        static __forceinline vec4f addV ( vec4f a, vec4f b ) { return v_cast_vec4f(v_addi(v_cast_vec4i(a), v_cast_vec4i(b))); }
+        static __forceinline vec4f subV ( vec4f a, vec4f b ) { return v_cast_vec4f(v_subi(v_cast_vec4i(a), v_cast_vec4i(b))); }
+        static __forceinline vec4f mulV ( vec4f a, vec4f b ) { return v_cast_vec4f(v_muli(v_cast_vec4i(a), v_cast_vec4i(b))); }
+    };
+
+    // each element is a vector already, lanes are independent so the sum is exact
+    template <> struct ForArrayOps<float4> {
+        typedef vec4f Scalar;
+        enum { simd = 0, simdReduce = 0 };
+        static __forceinline Scalar load ( const char * p ) { return v_ldu((const float *)p); }
+        static __forceinline void store ( char * p, Scalar v ) { v_stu(p, v); }
+        static __forceinline Scalar fromVec ( vec4f v ) { return v; }
+        static __forceinline Scalar add ( Scalar a, Scalar b ) { return v_add(a, b); }
+        static __forceinline Scalar sub ( Scalar a, Scalar b ) { return v_sub(a, b); }
+        static __forceinline Scalar mul ( Scalar a, Scalar b ) { return v_mul(a, b); }
+        static __forceinline vec4f loadV ( const char * p ) { return load(p); }
+        static __forceinline void storeV ( char * p, vec4f v ) { store(p, v); }
+        static __forceinline vec4f splatV ( Scalar v ) { return v; }
+        static __forceinline Scalar reduceV ( vec4f v ) { return v; }
+        static __forceinline vec4f addV ( vec4f a, vec4f b ) { return add(a, b); }
+        static __forceinline vec4f subV ( vec4f a, vec4f b ) { return sub(a, b); }
+        static __forceinline vec4f mulV ( vec4f a, vec4f b ) { return mul(a, b); }
+    };
+
+#define IMPLEMENT_FOR_ARRAY_OP(OPNAME,FNAME) \
+    struct ForArray##OPNAME { \
+        template <typename OPS> \
+        static __forceinline typename OPS::Scalar op ( typename OPS::Scalar a, typename OPS::Scalar b ) { return OPS::FNAME(a,b); } \
+        template <typename OPS> \
+        static __forceinline vec4f opV ( vec4f a, vec4f b ) { return OPS::FNAME##V(a,b); } \
+    };
+
+    IMPLEMENT_FOR_ARRAY_OP(Add,add);
+    IMPLEMENT_FOR_ARRAY_OP(Sub,sub);
+    IMPLEMENT_FOR_ARRAY_OP(Mul,mul);
+
+    // k is verified to be one of those during fusion
+    template <typename OPS>
+    __forceinline typename OPS::Scalar forArrayInvariant ( const SimSource & src, Context & context ) {
+        switch ( src.type ) {
+        case SimSourceType::sConstValue:    return OPS::load(src.computeConst(context));
+        case SimSourceType::sLocal:         return OPS::load(src.computeLocal(context));
+        case SimSourceType::sArgument:      return OPS::load(src.computeArgument(context));
+        default:                            return OPS::fromVec(src.subexpr->eval(context));
+        }
+    }
+
+    struct SimNode_ForArrayFusionBase : SimNode_ForBase {
+        SimNode_ForArrayFusionBase ( const SimNode_ForBase * node ) : SimNode_ForBase(*node) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            return visitFor(vis, totalSources, loopName);
+        }
+        // operands are read from the body, so that they are relocated with it
+        __forceinline SimNode_Op2Fusion * body() const { return static_cast<SimNode_Op2Fusion *>(list[0]); }
+        __forceinline SimNode_Op2Fusion * bodyR() const { return static_cast<SimNode_Op2Fusion *>(body()->r.subexpr); }
+        const char *    loopName = nullptr;     // interned
+        uint32_t        xi = 0;                 // loop variable of x
+        uint32_t        yi = 0;                 // loop variable of y
+        bool            yRight = false;         // axpy only, y * k vs k * y
+    };
+
+    /* kernels */
+
+    struct ForArraySum {
+        template <typename OPS>
+        static __forceinline void run ( SimNode_ForArrayFusionBase * node, char ** ph, int szz, Context & context ) {
+            typedef typename OPS::Scalar Scalar;
+            auto set = node->body();
+            char * pacc = set->l.computeLocal(context);
+            char * px = ph[node->xi] + set->r.offset;
+            uint32_t sx = node->strides[node->xi];
+            Scalar acc = OPS::load(pacc);
+            int i = 0;
+            if ( OPS::simdReduce && sx==sizeof(Scalar) ) {
+                vec4f vacc = v_zero();
+                for ( ; i+4<=szz; i+=4, px+=4*sizeof(Scalar) ) {
+                    vacc = OPS::addV(vacc, OPS::loadV(px));
+                }
+                acc = OPS::add(acc, OPS::reduceV(vacc));
+            }
+            for ( ; i!=szz; ++i, px+=sx ) {
+                acc = OPS::add(acc, OPS::load(px));
+            }
+            OPS::store(pacc, acc);
+        }
+    };
+
+    struct ForArrayDot {
+        template <typename OPS>
+        static __forceinline void run ( SimNode_ForArrayFusionBase * node, char ** ph, int szz, Context & context ) {
+            typedef typename OPS::Scalar Scalar;
+            auto set = node->body();
+            auto mul = node->bodyR();
+            char * pacc = set->l.computeLocal(context);
+            char * px = ph[node->xi] + mul->l.offset;
+            char * py = ph[node->yi] + mul->r.offset;
+            uint32_t sx = node->strides[node->xi];
+            uint32_t sy = node->strides[node->yi];
+            Scalar acc = OPS::load(pacc);
+            int i = 0;
+            if ( OPS::simdReduce && sx==sizeof(Scalar) && sy==sizeof(Scalar) ) {
+                vec4f vacc = v_zero();
+                for ( ; i+4<=szz; i+=4, px+=4*sizeof(Scalar), py+=4*sizeof(Scalar) ) {
+                    vacc = OPS::addV(vacc, OPS::mulV(OPS::loadV(px), OPS::loadV(py)));
+                }
+                acc = OPS::add(acc, OPS::reduceV(vacc));
+            }
+            for ( ; i!=szz; ++i, px+=sx, py+=sy ) {
+                acc = OPS::add(acc, OPS::mul(OPS::load(px), OPS::load(py)));
+            }
+            OPS::store(pacc, acc);
+        }
+    };
+
+    template <typename OP>
+    struct ForArrayMap {
+        template <typename OPS>
+        static __forceinline void run ( SimNode_ForArrayFusionBase * node, char ** ph, int szz, Context & context ) {
+            typedef typename OPS::Scalar Scalar;
+            auto set = node->body();
+            char * px = ph[node->xi] + set->l.offset;
+            uint32_t sx = node->strides[node->xi];
+            Scalar k = forArrayInvariant<OPS>(set->r, context);
+            int i = 0;
+            if ( OPS::simd && sx==sizeof(Scalar) ) {
+                vec4f vk = OPS::splatV(k);
+                for ( ; i+4<=szz; i+=4, px+=4*sizeof(Scalar) ) {
+                    OPS::storeV(px, OP::template opV<OPS>(OPS::loadV(px), vk));
+                }
+            }
+            for ( ; i!=szz; ++i, px+=sx ) {
+                OPS::store(px, OP::template op<OPS>(OPS::load(px), k));
+            }
+        }
+    };
+
+    struct ForArrayAxpy {
+        template <typename OPS>
+        static __forceinline void run ( SimNode_ForArrayFusionBase * node, char ** ph, int szz, Context & context ) {
+            typedef typename OPS::Scalar Scalar;
+            auto set = node->body();
+            auto mul = node->bodyR();
+            const SimSource & ys = node->yRight ? mul->r : mul->l;
+            const SimSource & ks = node->yRight ? mul->l : mul->r;
+            char * px = ph[node->xi] + set->l.offset;
+            char * py = ph[node->yi] + ys.offset;
+            uint32_t sx = node->strides[node->xi];
+            uint32_t sy = node->strides[node->yi];
+            Scalar k = forArrayInvariant<OPS>(ks, context);
+            int i = 0;
+            if ( OPS::simd && sx==sizeof(Scalar) && sy==sizeof(Scalar) ) {
+                vec4f vk = OPS::splatV(k);
+                for ( ; i+4<=szz; i+=4, px+=4*sizeof(Scalar), py+=4*sizeof(Scalar) ) {
+                    // y is loaded first, x and y can be the same array
+                    vec4f yk = OPS::mulV(OPS::loadV(py), vk);
+                    OPS::storeV(px, OPS::addV(OPS::loadV(px), yk));
+                }
+            }
+            for ( ; i!=szz; ++i, px+=sx, py+=sy ) {
+                Scalar yk = OPS::mul(OPS::load(py), k);
+                OPS::store(px, OPS::add(OPS::load(px), yk));
+            }
+        }
+    };
+
+    /* loops */
+
+    struct ForGoodArrayFusion {
+        template <typename TT, typename KERNEL>
+        static __forceinline void run ( SimNode_ForArrayFusionBase * node, Context & context ) {
+            Array * pha[2];
+            char * ph[2];
+            int szz = INT_MAX;
+            for ( uint32_t t=0; t!=node->totalSources; ++t ) {
+                pha[t] = cast<Array *>::to(node->sources[t]->eval(context));
+                array_lock(context, *pha[t]);
+                ph[t] = pha[t]->data;
+                szz = das::min(szz, int(pha[t]->size));
+            }
+            KERNEL::template run<ForArrayOps<TT>>(node, ph, szz, context);
+            node->evalFinal(context);
+            for ( uint32_t t=0; t!=node->totalSources; ++t ) {
+                array_unlock(context, *pha[t]);
+            }
+        }
+    };
+
+    struct ForFixedArrayFusion {
+        template <typename TT, typename KERNEL>
+        static __forceinline void run ( SimNode_ForArrayFusionBase * node, Context & context ) {
+            char * ph[2];
+            for ( uint32_t t=0; t!=node->totalSources; ++t ) {
+                ph[t] = cast<char *>::to(node->sources[t]->eval(context));
+            }
+            KERNEL::template run<ForArrayOps<TT>>(node, ph, int(node->size), context);
+            node->evalFinal(context);
+        }
+    };
+
+    template <typename LOOP, typename TT, typename KERNEL>
+    struct SimNode_ForArrayFusion : SimNode_ForArrayFusionBase {
+        SimNode_ForArrayFusion ( const SimNode_ForBase * node ) : SimNode_ForArrayFusionBase(node) {}
+        virtual vec4f eval ( Context & context ) override {
+            DAS_PROFILE_NODE
+            LOOP::template run<TT,KERNEL>(this, context);
+            return v_zero();
+        }
+    };
+
+    /* fusion point */
+
+    enum ForArrayKernel { forArraySum, forArrayDot, forArrayMap, forArrayAxpy, forArrayKernels };
+
+    typedef SimNode_ForArrayFusionBase * (*ForArrayMake) ( Context * context, SimNode_ForBase * node );
+
+    template <typename NodeType>
+    SimNode_ForArrayFusionBase * makeForArray ( Context * context, SimNode_ForBase * node ) {
+        return context->code->makeNode<NodeType>(node);
+    }
+
+    // same body can match several kernels, i.e. SetAddLocroAny is x += k, or x += y * k
+    struct ForArrayPattern {
+        ForArrayMake    make[forArrayKernels] = {};
+        const char *    loopName[forArrayKernels] = {};
+    };
+
+    struct ForArrayMatch {
+        uint32_t    xi = 0;
+        uint32_t    yi = 0;
+        bool        yRight = false;
+    };
+
+    // pattern table is by fusionKey of the body, i.e. SetAddLocLocro<float>
+    template <typename LOOP>
+    struct FusionPoint_ForArray : FusionPoint {
+        FusionPoint_ForArray ( const char * ln ) : loopPrefix(ln) {
+            addType<float>();
+            addType<int32_t>();
+#if DAS_FUSION>=2
+            addType<float4>();
+#endif
+        }
+        template <typename TT>
+        void addType() {
+            auto typeKind = internSimNodeKind(das_to_string(Type(ToBasicType<TT>::type)).c_str());
+            auto key = [&]( const string & name ) {
+                return fusionKey(internSimNodeKind(name.c_str()), typeKind);
+            };
+            addPattern<TT,ForArraySum>(key("SetAddLocLocro"), forArraySum, "Sum");
+            addPattern<TT,ForArrayDot>(key("SetAddLocAny"), forArrayDot, "Dot");
+            addPattern<TT,ForArrayAxpy>(key("SetAddLocroAny"), forArrayAxpy, "Axpy");
+            mulLocroLocro.insert(key("MulLocroLocro"));
+            for ( string k : { "Const", "Loc", "Arg", "Any" } ) {
+                addPattern<TT,ForArrayMap<ForArrayAdd>>(key("SetAddLocro" + k), forArrayMap, "Add");
+                addPattern<TT,ForArrayMap<ForArraySub>>(key("SetSubLocro" + k), forArrayMap, "Sub");
+                addPattern<TT,ForArrayMap<ForArrayMul>>(key("SetMulLocro" + k), forArrayMap, "Mul");
+                mulLocroInvariant.insert(key("MulLocro" + k));
+                mulInvariantLocro.insert(key("Mul" + k + "Locro"));
+            }
+        }
+        template <typename TT, typename KERNEL>
+        void addPattern ( uint64_t key, ForArrayKernel kernel, const char * kernelName ) {
+            auto & pat = patterns[key];
+            pat.make[kernel] = &makeForArray<SimNode_ForArrayFusion<LOOP,TT,KERNEL>>;
+            pat.loopName[kernel] = getSimNodeKindName(internSimNodeKind((string(loopPrefix) + kernelName).c_str()));
+        }
+        static uint64_t infoKey ( const SimNodeInfoLookup & info, SimNode * node ) {
+            auto it = info.find(node);
+            return it==info.end() ? 0 : fusionKey(it->second.name, it->second.typeName);
+        }
+        // loop variable, which points to the element
+        static bool loopVariable ( const SimNode_ForBase * loop, const SimSource & src, uint32_t & index ) {
+            if ( src.type!=SimSourceType::sLocalRefOff ) return false;
+            for ( uint32_t t=0; t!=loop->totalSources; ++t ) {
+                if ( loop->stackTop[t]==src.stackTop ) {
+                    index = t;
+                    return true;
+                }
+            }
+            return false;
+        }
+        // body only writes to the elements, or to the accumulator, so none of those can change
+        static bool invariant ( const SimNodeInfoLookup & info, const SimSource & src ) {
+            switch ( src.type ) {
+            case SimSourceType::sConstValue:
+            case SimSourceType::sLocal:
+            case SimSourceType::sArgument:
+                return true;
+            case SimSourceType::sSimNode:
+                return is(info, src.subexpr, DAS_SIM_NODE_KIND("ConstValue"))
+                    || is(info, src.subexpr, DAS_SIM_NODE_KIND("GetLocalR2V"))
+                    || is(info, src.subexpr, DAS_SIM_NODE_KIND("GetArgument"));
+            default:
+                return false;
+            }
+        }
+        bool match ( const SimNodeInfoLookup & info, SimNode_ForBase * loop, ForArrayKernel kernel, ForArrayMatch & res ) const {
+            auto set = static_cast<SimNode_Op2Fusion *>(loop->list[0]);
+            auto mul = static_cast<SimNode_Op2Fusion *>(set->r.subexpr);
+            switch ( kernel ) {
+            case forArraySum:
+                return loopVariable(loop, set->r, res.xi);
+            case forArrayDot:
+                return mulLocroLocro.count(infoKey(info, set->r.subexpr))
+                    && loopVariable(loop, mul->l, res.xi) && loopVariable(loop, mul->r, res.yi);
+            case forArrayMap:
+                return loopVariable(loop, set->l, res.xi) && invariant(info, set->r);
+            case forArrayAxpy:
+                if ( !loopVariable(loop, set->l, res.xi) ) return false;
+                if ( mulLocroInvariant.count(infoKey(info, set->r.subexpr)) ) {
+                    return loopVariable(loop, mul->l, res.yi) && invariant(info, mul->r);
+                } else if ( mulInvariantLocro.count(infoKey(info, set->r.subexpr)) ) {
+                    res.yRight = true;
+                    return loopVariable(loop, mul->r, res.yi) && invariant(info, mul->l);
+                }
+                return false;
+            default:
+                return false;
+            }
+        }
+        virtual SimNode * fuse ( const SimNodeInfoLookup & info, SimNode * node, Context * context ) override {
+            // debug nodes single step into the body
+            if ( context->thisProgram && context->thisProgram->getDebugger() ) return node;
+            auto loop = static_cast<SimNode_ForBase *>(node);
+            if ( loop->total!=1 || loop->totalSources<1 || loop->totalSources>2 ) return node;
+            auto it = patterns.find(infoKey(info, loop->list[0]));
+            if ( it==patterns.end() ) return node;
+            for ( int kernel=0; kernel!=forArrayKernels; ++kernel ) {
+                ForArrayMatch res;
+                if ( !it->second.make[kernel] || !match(info, loop, ForArrayKernel(kernel), res) ) continue;
+                auto result = it->second.make[kernel](context, loop);
+                result->loopName = it->second.loopName[kernel];
+                result->xi = res.xi;
+                result->yi = res.yi;
+                result->yRight = res.yRight;
+                return result;
+            }
+            return node;
+        }
+        const char *                            loopPrefix;
+        das_hash_map<uint64_t,ForArrayPattern>  patterns;
+        das_set<uint64_t>                       mulLocroLocro;
+        das_set<uint64_t>                       mulLocroInvariant;
+        das_set<uint64_t>                       mulInvariantLocro;
+    };
+
+    void createFusionEngine_for_array() {
+        registerFusion("ForGoodArray1_1", "", new FusionPoint_ForArray<ForGoodArrayFusion>("ForGoodArray1"));
+        registerFusion("ForFixedArray1_1", "", new FusionPoint_ForArray<ForFixedArrayFusion>("ForFixedArray1"));
+    }
+}
+
+#endif
@@ -0,0 +1,289 @@
+#include "daScript/misc/platform.h"
+
+#ifdef _MSC_VER
+#pragma warning(disable:4505)
+#endif
+
+#include "daScript/simulate/simulate_fusion.h"
+
+#if DAS_FUSION
+
+#include "daScript/simulate/sim_policy.h"
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/simulate_visit_op.h"
+
+namespace das {
+
+    // compare and branch
+    //  if-then, if-then-else and while, where condition is already fused compare (see simulate_fusion_op2_bool.cpp)
+    //  compare is evaluated inline, instead of the virtual evalBool of the condition
+    //  left side of the compare can also be fused a[i].f (see simulate_fusion_at.cpp)
+    //  original condition is kept, so that visitors (and jit) see the same tree as before fusion
+
+    struct IfCmpOperand {
+        SimSource   value;
+        SimSource   index;          // a[i].f only
+        uint32_t    stride = 0;
+        uint32_t    offset = 0;
+        uint32_t    range = 0;
+    };
+
+    struct IfCmpOperands {
+        IfCmpOperand    l, r;
+        LineInfo        at;         // of the condition
+    };
+
+#define IMPLEMENT_IF_CMP_SOURCE(COMPUTE) \
+    struct IfCmp##COMPUTE { \
+        template <typename TT> \
+        static __forceinline TT get ( const IfCmpOperand & op, Context & context, const LineInfo & ) { \
+            return *((TT *)op.value.compute##COMPUTE(context)); \
+        } \
+    };
+
+    IMPLEMENT_IF_CMP_SOURCE(Const);
+    IMPLEMENT_IF_CMP_SOURCE(Local);
+    IMPLEMENT_IF_CMP_SOURCE(Argument);
+
+#define IMPLEMENT_IF_CMP_AT(COMPUTEL,COMPUTER) \
+    struct IfCmpAt##COMPUTEL##_##COMPUTER { \
+        template <typename TT> \
+        static __forceinline TT get ( const IfCmpOperand & op, Context & context, const LineInfo & at ) { \
+            auto pl = op.value.compute##COMPUTEL(context); \
+            auto rr = *((uint32_t *)op.index.compute##COMPUTER(context)); \
+            if ( rr >= op.range ) context.throw_error_at(at,"index out of range, %u of %u", rr, op.range); \
+            return *((TT *)(pl + rr*op.stride + op.offset)); \
+        } \
+    };
+
+    IMPLEMENT_IF_CMP_AT(Local,Local);
+    IMPLEMENT_IF_CMP_AT(ArgumentRef,Local);
+
+#define IMPLEMENT_IF_CMP_OP(OPNAME) \
+    struct IfCmp##OPNAME { \
+        template <typename TT> \
+        static __forceinline bool cmp ( TT l, TT r, Context & context, LineInfo * at ) { \
+            return SimPolicy<TT>::OPNAME(l,r,context,at); \
+        } \
+    };
+
+    IMPLEMENT_IF_CMP_OP(Equ);
+    IMPLEMENT_IF_CMP_OP(NotEqu);
+    IMPLEMENT_IF_CMP_OP(Less);
+    IMPLEMENT_IF_CMP_OP(LessEqu);
+    IMPLEMENT_IF_CMP_OP(Gt);
+    IMPLEMENT_IF_CMP_OP(GtEqu);
+
+    template <typename TT, typename OP, typename LSRC, typename RSRC>
+    __forceinline bool ifCmp ( IfCmpOperands & ops, Context & context ) {
+        return OP::template cmp<TT>(LSRC::template get<TT>(ops.l,context,ops.at),
+            RSRC::template get<TT>(ops.r,context,ops.at), context, &ops.at);
+    }
+
+    /* IfCmpThenElse */
+
+    struct SimNode_IfCmpThenElseBase : SimNode_IfThenElse {
+        typedef SimNode_IfThenElse Source;
+        SimNode_IfCmpThenElseBase ( const SimNode_IfThenElse * node ) : SimNode_IfThenElse(*node) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN_CR();
+            V_OP(IfCmpThenElse);
+            V_SUB(cond);
+            V_SUB(if_true);
+            V_SUB(if_false);
+            V_END();
+        }
+        IfCmpOperands ops;
+    };
+
+    template <typename TT, typename OP, typename LSRC, typename RSRC>
+    struct SimNode_IfCmpThenElse : SimNode_IfCmpThenElseBase {
+        SimNode_IfCmpThenElse ( const SimNode_IfThenElse * node ) : SimNode_IfCmpThenElseBase(node) {}
+        virtual vec4f eval ( Context & context ) override {
+            DAS_PROFILE_NODE
+            if ( ifCmp<TT,OP,LSRC,RSRC>(ops,context) ) {
+                return if_true->eval(context);
+            } else {
+                return if_false->eval(context);
+            }
+        }
+#define EVAL_NODE(TYPE,CTYPE)                                       \
+        virtual CTYPE eval##TYPE ( Context & context ) override {   \
+                DAS_PROFILE_NODE \
+                if ( ifCmp<TT,OP,LSRC,RSRC>(ops,context) ) {        \
+                    return if_true->eval##TYPE(context);            \
+                } else {                                            \
+                    return if_false->eval##TYPE(context);           \
+                }                                                   \
+            }
+        DAS_EVAL_NODE
+#undef EVAL_NODE
+    };
+
+    /* IfCmpThen */
+
+    struct SimNode_IfCmpThenBase : SimNode_IfThen {
+        typedef SimNode_IfThen Source;
+        SimNode_IfCmpThenBase ( const SimNode_IfThen * node ) : SimNode_IfThen(*node) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN_CR();
+            V_OP(IfCmpThen);
+            V_SUB(cond);
+            V_SUB(if_true);
+            V_END();
+        }
+        IfCmpOperands ops;
+    };
+
+    template <typename TT, typename OP, typename LSRC, typename RSRC>
+    struct SimNode_IfCmpThen : SimNode_IfCmpThenBase {
+        SimNode_IfCmpThen ( const SimNode_IfThen * node ) : SimNode_IfCmpThenBase(node) {}
+        virtual vec4f eval ( Context & context ) override {
+            DAS_PROFILE_NODE
+            if ( ifCmp<TT,OP,LSRC,RSRC>(ops,context) ) {
+                return if_true->eval(context);
+            } else {
+                return v_zero();
+            }
+        }
+    };
+
+    /* WhileCmp */
+
+    struct SimNode_WhileCmpBase : SimNode_While {
+        typedef SimNode_While Source;
+        SimNode_WhileCmpBase ( const SimNode_While * node ) : SimNode_While(*node) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN_CR();
+            V_OP(WhileCmp);
+            V_SUB(cond);
+            vis.sub(list,total,"list");
+            V_FINAL();
+            V_END();
+        }
+        IfCmpOperands ops;
+    };
+
+    template <typename TT, typename OP, typename LSRC, typename RSRC>
+    struct SimNode_WhileCmp : SimNode_WhileCmpBase {
+        SimNode_WhileCmp ( const SimNode_While * node ) : SimNode_WhileCmpBase(node) {}
+        virtual vec4f eval ( Context & context ) override {
+            DAS_PROFILE_NODE
+            SimNode ** __restrict tail = list + total;
+            while ( ifCmp<TT,OP,LSRC,RSRC>(ops,context) && !context.stopFlags ) {
+                SimNode ** __restrict body = list;
+            loopbegin:;
+                for (; body!=tail; ++body) {
+                    (*body)->eval(context);
+                    DAS_PROCESS_LOOP_FLAGS(break);
+                }
+            }
+        loopend:;
+            evalFinal(context);
+            context.stopFlags &= ~EvalFlags::stopForBreak;
+            return v_zero();
+        }
+    };
+
+    /* fusion point */
+
+    typedef SimNode * (*IfCmpMake) ( Context * context, SimNode * node, const IfCmpOperands & ops );
+
+    template <typename NodeType>
+    SimNode * makeIfCmp ( Context * context, SimNode * node, const IfCmpOperands & ops ) {
+        auto result = context->code->makeNode<NodeType>(static_cast<typename NodeType::Source *>(node));
+        result->ops = ops;
+        return result;
+    }
+
+    struct IfCmpPattern {
+        IfCmpMake                           make = nullptr;     // both sides are sources
+        das_hash_map<uint64_t,IfCmpMake>    makeAt;             // left side is a[i].f, by fusionKey of the At node
+    };
+
+    // pattern table is by fusionKey of the condition, i.e. LessLocConst<int>
+    template <template <typename,typename,typename,typename> class NodeType>
+    struct FusionPoint_IfCmp : FusionPoint {
+        FusionPoint_IfCmp() {
+            addType<int32_t>();
+            addType<uint32_t>();
+            addType<float>();
+#if DAS_FUSION>=2
+            addType<int64_t>();
+            addType<uint64_t>();
+            addType<double>();
+#endif
+        }
+        template <typename TT>
+        void addType() {
+            addOp<TT,IfCmpEqu>("Equ");
+            addOp<TT,IfCmpNotEqu>("NotEqu");
+            addOp<TT,IfCmpLess>("Less");
+            addOp<TT,IfCmpLessEqu>("LessEqu");
+            addOp<TT,IfCmpGt>("Gt");
+            addOp<TT,IfCmpGtEqu>("GtEqu");
+        }
+        template <typename TT, typename OP>
+        void addOp ( const char * opName ) {
+            auto typeKind = internSimNodeKind(das_to_string(Type(ToBasicType<TT>::type)).c_str());
+            auto key = [&]( const char * prefix, const char * l, const char * r ) {
+                string name = string(prefix) + l + r;
+                return fusionKey(internSimNodeKind(name.c_str()), typeKind);
+            };
+            patterns[key(opName,"Loc","Const")].make = &makeIfCmp<NodeType<TT,OP,IfCmpLocal,IfCmpConst>>;
+            patterns[key(opName,"Loc","Loc")].make = &makeIfCmp<NodeType<TT,OP,IfCmpLocal,IfCmpLocal>>;
+            patterns[key(opName,"Loc","Arg")].make = &makeIfCmp<NodeType<TT,OP,IfCmpLocal,IfCmpArgument>>;
+            patterns[key(opName,"Arg","Const")].make = &makeIfCmp<NodeType<TT,OP,IfCmpArgument,IfCmpConst>>;
+            patterns[key(opName,"Arg","Loc")].make = &makeIfCmp<NodeType<TT,OP,IfCmpArgument,IfCmpLocal>>;
+            patterns[key(opName,"Arg","Arg")].make = &makeIfCmp<NodeType<TT,OP,IfCmpArgument,IfCmpArgument>>;
+            // note: At of the argument is by reference, see MATCH_OP2_SET(OPNAME,"GetArgument","GetLocalR2V",ArgumentRef,Local)
+            auto atLoc = key("AtR2V","Loc","Loc"), atArg = key("AtR2V","Arg","Loc");
+            auto & anyConst = patterns[key(opName,"Any","Const")].makeAt;
+            anyConst[atLoc] = &makeIfCmp<NodeType<TT,OP,IfCmpAtLocal_Local,IfCmpConst>>;
+            anyConst[atArg] = &makeIfCmp<NodeType<TT,OP,IfCmpAtArgumentRef_Local,IfCmpConst>>;
+            auto & anyLoc = patterns[key(opName,"Any","Loc")].makeAt;
+            anyLoc[atLoc] = &makeIfCmp<NodeType<TT,OP,IfCmpAtLocal_Local,IfCmpLocal>>;
+            anyLoc[atArg] = &makeIfCmp<NodeType<TT,OP,IfCmpAtArgumentRef_Local,IfCmpLocal>>;
+            auto & anyArg = patterns[key(opName,"Any","Arg")].makeAt;
+            anyArg[atLoc] = &makeIfCmp<NodeType<TT,OP,IfCmpAtLocal_Local,IfCmpArgument>>;
+            anyArg[atArg] = &makeIfCmp<NodeType<TT,OP,IfCmpAtArgumentRef_Local,IfCmpArgument>>;
+        }
+        virtual SimNode * fuse ( const SimNodeInfoLookup & info, SimNode * node, Context * context ) override {
+            // debug nodes single step into the condition
+            if ( context->thisProgram && context->thisProgram->getDebugger() ) return node;
+            typedef typename NodeType<int32_t,IfCmpEqu,IfCmpConst,IfCmpConst>::Source SourceNode;
+            auto cond = static_cast<SourceNode *>(node)->cond;
+            auto itc = info.find(cond);
+            if ( itc==info.end() ) return node;
+            auto it = patterns.find(fusionKey(itc->second.name, itc->second.typeName));
+            if ( it==patterns.end() ) return node;
+            auto cmp = static_cast<SimNode_Op2Fusion *>(cond);
+            IfCmpOperands ops;
+            ops.l.value = cmp->l;
+            ops.r.value = cmp->r;
+            ops.at = cmp->debugInfo;
+            if ( it->second.make ) return it->second.make(context, node, ops);
+            auto ita = info.find(cmp->l.subexpr);
+            if ( ita==info.end() ) return node;
+            auto itm = it->second.makeAt.find(fusionKey(ita->second.name, ita->second.typeName));
+            if ( itm==it->second.makeAt.end() ) return node;
+            auto at = static_cast<SimNode_Op2At *>(cmp->l.subexpr);
+            ops.l.value = at->l;
+            ops.l.index = at->r;
+            ops.l.stride = at->stride;
+            ops.l.offset = at->offset;
+            ops.l.range = at->range;
+            ops.at = at->debugInfo;
+            return itm->second(context, node, ops);
+        }
+        das_hash_map<uint64_t,IfCmpPattern> patterns;
+    };
+
+    void createFusionEngine_if_cmp() {
+        registerFusion("IfThenElse", "", new FusionPoint_IfCmp<SimNode_IfCmpThenElse>());
+        registerFusion("IfThen", "", new FusionPoint_IfCmp<SimNode_IfCmpThen>());
+        registerFusion("While", "", new FusionPoint_IfCmp<SimNode_WhileCmp>());
+    }
+}
+
+#endif
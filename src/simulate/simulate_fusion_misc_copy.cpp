@@ -12,6 +12,7 @@
 #include "daScript/simulate/sim_policy.h"
 #include "daScript/ast/ast.h"
 #include "daScript/simulate/simulate_fusion_op2.h"
+#include "daScript/simulate/simulate_visit_op.h"
 
 namespace das {
 
@@ -29,7 +30,7 @@ namespace das {
         };
         virtual SimNode * match(const SimNodeInfoLookup & info, SimNode *, SimNode * node_l, SimNode *, Context * context) override {
             if (false) {}
-            else if ( is(info, node_l, "GetLocal" )) { anyRight = true; return context->code->makeNode<SimNode_CopyReferenceLocAny>();  }
+            else if ( is(info,node_l,DAS_SIM_NODE_KIND("GetLocal"))) { anyRight = true; return context->code->makeNode<SimNode_CopyReferenceLocAny>();  }
             return nullptr;
         }
         virtual void set(SimNode_Op2Fusion * result, SimNode * node) override {
@@ -42,6 +43,17 @@ namespace das {
     };
 
     struct SimNode_Op2FusionCopyRef : SimNode_Op2Fusion {
+        virtual SimNode * visit(SimVisitor & vis) override {
+            V_BEGIN();
+            string name = op;
+            name += getSimSourceName(l.type);
+            name += getSimSourceName(r.type);
+            vis.op(name.c_str());
+            l.visit(vis);
+            r.visit(vis);
+            V_ARG(size);
+            V_END();
+        }
         uint32_t size;
     };
 
@@ -74,19 +86,19 @@ namespace das {
     }
 
 #define MATCH_OP2_COPYREF_LEFT_ANY(NODENAME,COMPUTEL) \
-    else if (is(info, node_l, NODENAME) ) { \
+    else if (is(info,node_l,DAS_SIM_NODE_KIND(NODENAME)) ) { \
         anyRight = true; \
         MATCH_OP2_COPYREF_NODE(COMPUTEL,AnyPtr); \
     }
 
 #define MATCH_OP2_COPYREF_RIGHT_ANY(NODENAME,COMPUTER) \
-    else if (is(info, node_r, NODENAME) ) { \
+    else if (is(info,node_r,DAS_SIM_NODE_KIND(NODENAME)) ) { \
         anyLeft = true; \
         MATCH_OP2_COPYREF_NODE(AnyPtr,COMPUTER); \
     }
 
 #define MATCH_OP2_COPYREF(LNODENAME,RNODENAME,COMPUTEL,COMPUTER) \
-    else if ( is2(info,node_l,node_r,LNODENAME,RNODENAME) ) { \
+    else if ( is2(info,node_l,node_r,DAS_SIM_NODE_KIND(LNODENAME),DAS_SIM_NODE_KIND(RNODENAME)) ) { \
         MATCH_OP2_COPYREF_NODE(COMPUTEL,COMPUTER); \
     }
 
@@ -158,8 +170,8 @@ namespace das {
     };
 
     void createFusionEngine_misc_copy_reference() {
-        (*g_fusionEngine)["CopyReference"].emplace_back(new FusionPoint_MiscCopyReference());
-        (*g_fusionEngine)["CopyRefValue"].emplace_back(new FusionPoint_MiscCopyRefValue());
+        registerFusion("CopyReference","",new FusionPoint_MiscCopyReference());
+        registerFusion("CopyRefValue","",new FusionPoint_MiscCopyRefValue());
     }
 }
 
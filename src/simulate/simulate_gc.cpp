@@ -3,6 +3,9 @@
 #include "daScript/simulate/simulate.h"
 #include "daScript/simulate/data_walker.h"
 #include "daScript/simulate/debug_print.h"
+#include "daScript/simulate/runtime_table.h"
+#include "daScript/misc/performance_time.h"
+#include "daScript/misc/job_que.h"
 
 namespace das
 {
@@ -18,6 +21,16 @@ namespace das
         __forceinline bool contains ( const PtrRange & r ) { return !empty() && !r.empty() && from<=r.from && to>=r.to; }
     };
 
+    struct GcRoot {
+        enum Kind { value, argument, arrayElements, tableSlots };
+        enum { elements_per_root = 1024 };
+        Kind        kind;
+        char *      data;       // value, argument, array data, or table
+        TypeInfo *  info;       // value type, element type, or table type
+        uint32_t    from, to;   // element range
+        PtrRange    range;      // allocation, which holds the elements
+    };
+
     struct HeapReporter : DataWalker {
         bool reportStringHeap = true;
         bool reportHeap = true;
@@ -185,8 +198,8 @@ namespace das
         }
         virtual void beforeTable ( Table * PT, TypeInfo * ti ) override {
             DataWalker::beforeTable(PT, ti);
-            auto tsize = (ti->firstType->size + ti->secondType->size + sizeof(uint64_t)) * PT->capacity;
-            DAS_ASSERT(tsize==(getTypeSize(ti->firstType)+getTypeSize(ti->secondType)+sizeof(uint64_t))*PT->capacity);
+            auto tsize = table_slot_size(*PT, ti->firstType->size + ti->secondType->size) * PT->capacity;
+            DAS_ASSERT(tsize==table_slot_size(*PT, uint32_t(getTypeSize(ti->firstType)+getTypeSize(ti->secondType)))*PT->capacity);
             char * pa = PT->data;
             PtrRange rdata(pa, tsize);
             if ( reportHeap && tsize && markRange(rdata) ) {
@@ -378,6 +391,15 @@ namespace das
         }
     };
 
+    static void reportAllocationStats ( TextWriter & tp, const char * title, AnyHeapAllocator * heap ) {
+        AllocationStats stats;
+        heap->getStats(stats);
+        tp << title << ": " << stats.allocations << " allocations, " << stats.frees << " frees, "
+            << stats.freeListHits << " from free lists, " << stats.bytesAllocated << " of " << stats.bytesReserved
+            << " bytes in use, " << int(stats.fragmentation()*100.0) << "% fragmentation, "
+            << stats.decks << " decks, " << stats.bigAllocations << " big allocations\n";
+    }
+
     void Context::reportAnyHeap(LineInfo * at, bool sth, bool rgh, bool rghOnly, bool errorsOnly) {
         LOG tp(LogLevel::debug);
         // now
@@ -463,6 +485,15 @@ namespace das
             lineAt = info ? pp->line : nullptr;
             sp += info ? info->stackSize : pp->stackSize;
         }
+        if ( !errorsOnly ) {
+            tp << "GC PAUSES:\n";
+            gcPauses.report(tp, "full");
+            gcSlicePauses.report(tp, "incremental");
+            tp << "aborted incremental collections: " << gcAbortedCycles << "\n";
+            tp << "ALLOCATIONS:\n";
+            reportAllocationStats(tp, "heap", heap.get());
+            reportAllocationStats(tp, "string heap", stringHeap.get());
+        }
     }
 
     struct GcMarkStringHeap : DataWalker {
@@ -519,6 +550,8 @@ namespace das
     };
 
     void Context::collectStringHeap ( LineInfo * at, bool validate ) {
+        abortHeapCollection();
+        auto t0 = ref_time_ticks();
         // clean up, so that all small allocations are marked as 'free'
         if ( !stringHeap->mark() ) return;
         // now
@@ -584,6 +617,7 @@ namespace das
         }
         // sweep
         stringHeap->sweep();
+        gcPauses.record(get_time_usec(t0));
         // report errors
         if ( !walker.failed.empty() ) {
             reportAnyHeap(at, true, false, false, true);
@@ -675,7 +709,7 @@ namespace das
         }
         virtual void beforeTable ( Table * PT, TypeInfo * ti ) override {
             DataWalker::beforeTable(PT, ti);
-            PtrRange rdata(PT->data, (ti->firstType->size+ti->secondType->size+sizeof(uint64_t))*PT->capacity);
+            PtrRange rdata(PT->data, table_slot_size(*PT, ti->firstType->size+ti->secondType->size)*PT->capacity);
             markAndPushRange(rdata);
         }
         virtual void afterTable ( Table * pa, TypeInfo * ti ) override {
@@ -769,33 +803,85 @@ namespace das
                 context->stringHeap->mark(st, len);
             }
         }
+        void markRoot ( const GcRoot & root ) {
+            prepare();
+            switch ( root.kind ) {
+            case GcRoot::value:
+                walk(root.data, root.info);
+                break;
+            case GcRoot::argument:
+                walk(*(vec4f *)root.data, root.info);
+                break;
+            case GcRoot::arrayElements: {
+                    markAndPushRange(root.range);
+                    uint32_t stride = root.info->size;
+                    for ( uint32_t i=root.from; i!=root.to; ++i ) {
+                        walk(root.data + i*stride, root.info);
+                    }
+                    popRange();
+                }
+                break;
+            case GcRoot::tableSlots: {
+                    markAndPushRange(root.range);
+                    auto tab = (Table *) root.data;
+                    auto keyType = root.info->firstType;
+                    auto valueType = root.info->secondType;
+                    for ( uint32_t i=root.from; i!=root.to; ++i ) {
+                        if ( tab->hashes[i] > HASH_KILLED64 ) {
+                            walk(tab->keys + i*keyType->size, keyType);
+                            walk(tab->data + i*valueType->size, valueType);
+                        }
+                    }
+                    popRange();
+                }
+                break;
+            }
+        }
     };
 
-    void Context::collectHeap ( LineInfo * at, bool sheap, bool validate ) {
-        // clean up, so that all small allocations are marked as 'free'
-        if ( sheap && !stringHeap->mark() ) return;
-        if ( !heap->mark() ) return;
-        // now
-        GcMarkAnyHeap walker;
-        walker.markStringHeap = sheap;
-        walker.context = this;
-        walker.validate = validate;
-        // mark globals
+    // large arrays and tables are split into element ranges, so that they can be marked in parts
+    // the container itself is marked by every part
+    static void addGcRoot ( vector<GcRoot> & roots, char * data, TypeInfo * info, int32_t gcFlags ) {
+        const uint32_t chunk = GcRoot::elements_per_root;
+        if ( data && !(info->flags & TypeInfo::flag_ref) && info->dimSize==0 ) {
+            if ( info->type==Type::tArray && (info->firstType->flags & gcFlags) ) {
+                auto arr = (Array *) data;
+                if ( arr->size > chunk ) {
+                    PtrRange range(arr->data, info->firstType->size * arr->capacity);
+                    for ( uint32_t i=0; i<arr->size; i+=chunk ) {
+                        roots.push_back({GcRoot::arrayElements, arr->data, info->firstType, i, das::min(i+chunk,arr->size), range});
+                    }
+                    return;
+                }
+            } else if ( info->type==Type::tTable && ((info->firstType->flags | info->secondType->flags) & gcFlags) ) {
+                auto tab = (Table *) data;
+                if ( tab->capacity > chunk ) {
+                    PtrRange range(tab->data, table_slot_size(*tab, info->firstType->size + info->secondType->size) * tab->capacity);
+                    for ( uint32_t i=0; i<tab->capacity; i+=chunk ) {
+                        roots.push_back({GcRoot::tableSlots, data, info, i, das::min(i+chunk,tab->capacity), range});
+                    }
+                    return;
+                }
+            }
+        }
+        roots.push_back({GcRoot::value, data, info, 0, 0, PtrRange()});
+    }
+
+    void Context::collectHeapRoots ( LineInfo * at, vector<GcRoot> & roots, int32_t gcFlags ) {
+        // globals
         if ( sharedOwner ) {
             for ( int i=0; i!=totalVariables; ++i ) {
                 auto & pv = globalVariables[i];
                 if ( !pv.shared ) continue;
-                walker.prepare();
-                walker.walk(shared + pv.offset, pv.debugInfo);
+                addGcRoot(roots, shared + pv.offset, pv.debugInfo, gcFlags);
             }
         }
         for ( int i=0; i!=totalVariables; ++i ) {
             auto & pv = globalVariables[i];
             if ( pv.shared ) continue;
-            walker.prepare();
-            walker.walk(globals + pv.offset, pv.debugInfo);
+            addGcRoot(roots, globals + pv.offset, pv.debugInfo, gcFlags);
         }
-        // mark stack
+        // stack
         char * sp = stack.ap();
         const LineInfo * lineAt = at;
         while (  sp < stack.top() ) {
@@ -815,8 +901,7 @@ namespace das
             }
             if ( info ) {
                 for ( uint32_t i = 0; i != info->count; ++i ) {
-                    walker.prepare();
-                    walker.walk(pp->arguments[i], info->fields[i]);
+                    roots.push_back({GcRoot::argument, (char *)(pp->arguments + i), info->fields[i], 0, 0, PtrRange()});
                 }
                 if ( info->locals ) {
                     for ( uint32_t i = 0; i != info->localCount; ++i ) {
@@ -832,8 +917,7 @@ namespace das
                             addr = SP + lv->stackTop;
                         }
                         if ( addr ) {
-                            walker.prepare();
-                            walker.walk(addr, lv);
+                            addGcRoot(roots, addr, lv, gcFlags);
                         }
                     }
                 }
@@ -841,20 +925,148 @@ namespace das
             lineAt = info ? pp->line : nullptr;
             sp += info ? info->stackSize : pp->stackSize;
         }
+    }
+
+    void Context::reportHeapErrors ( LineInfo * at, bool sheap, const das_set<char *> & failed ) {
+        reportAnyHeap(at, sheap, true, true, true);
+        TextWriter tw;
+        tw << "GC failed on the following dangling pointers:" << HEX;
+        for ( auto f : failed ) {
+            tw << " " << uint64_t(f);
+        }
+        auto etext = stringHeap->allocateString(tw.str());
+        throw_error_at(*at, etext);
+    }
+
+    void Context::collectHeap ( LineInfo * at, bool sheap, bool validate, JobQue * jobQue ) {
+        abortHeapCollection();
+        auto t0 = ref_time_ticks();
+        // clean up, so that all small allocations are marked as 'free'
+        if ( sheap && !stringHeap->mark() ) return;
+        if ( !heap->mark() ) return;
+        // now
+        GcMarkAnyHeap walker;
+        walker.markStringHeap = sheap;
+        walker.context = this;
+        walker.validate = validate;
+        walker.prepare();
+        vector<GcRoot> roots;
+        collectHeapRoots(at, roots, walker.gcFlags);
+        if ( jobQue && roots.size()>1 ) {
+            // every worker walks its own roots, marks of both heaps are set atomically
+            // heap and string heap are marked in the same pass, so they are marked concurrently as well
+            mutex failedLock;
+            int numChunks = das::min(int(roots.size()), jobQue->getTotalHwJobs() * 4);
+            jobQue->parallel_for(0, int(roots.size()), [&](int r0, int r1) {
+                GcMarkAnyHeap worker;
+                worker.markStringHeap = sheap;
+                worker.context = this;
+                worker.validate = validate;
+                worker.prepare();
+                for ( int r=r0; r!=r1; ++r ) {
+                    worker.markRoot(roots[r]);
+                }
+                if ( !worker.failed.empty() ) {
+                    lock_guard<mutex> guard(failedLock);
+                    for ( auto f : worker.failed ) walker.failed.insert(f);
+                }
+            }, 0, JobPriority::High, numChunks);
+        } else {
+            for ( auto & root : roots ) {
+                walker.markRoot(root);
+            }
+        }
         // sweep
         if ( sheap ) stringHeap->sweep();
-        // report errors
         heap->sweep();
+        gcPauses.record(get_time_usec(t0));
+        // report errors
         if ( !walker.failed.empty() ) {
-            reportAnyHeap(at, sheap, true, true, true);
-            TextWriter tw;
-            tw << "GC failed on the following dangling pointers:" << HEX;
-            for ( auto f : walker.failed ) {
-                tw << " " << uint64_t(f);
+            reportHeapErrors(at, sheap, walker.failed);
+        }
+    }
+
+    // incremental collection, roots are collected once per cycle and then marked in time slices
+    // context must not run script code in between the slices, since there is no write barrier;
+    // evalWithCatch and runWithCatch abort collection in progress, so does a step from a different stack
+    struct GcMarkState {
+        GcMarkAnyHeap   walker;
+        vector<GcRoot>  roots;
+        size_t          next = 0;
+        char *          sp = nullptr;   // stack roots are only valid for the stack they were collected from
+    };
+
+    bool Context::collectHeapStep ( LineInfo * at, bool sheap, bool validate, int32_t budgetUsec ) {
+        auto t0 = ref_time_ticks();
+        if ( gcMarkState && (gcMarkState->walker.markStringHeap!=sheap || gcMarkState->sp!=stack.ap()) ) {
+            abortHeapCollection();
+        }
+        if ( !gcMarkState ) {
+            if ( sheap && !stringHeap->mark() ) return true;
+            if ( !heap->mark() ) {
+                if ( sheap ) stringHeap->abortMark();
+                return true;
+            }
+            gcMarkState = new GcMarkState();
+            auto & walker = gcMarkState->walker;
+            walker.markStringHeap = sheap;
+            walker.context = this;
+            walker.validate = validate;
+            walker.prepare();
+            gcMarkState->sp = stack.ap();
+            collectHeapRoots(at, gcMarkState->roots, walker.gcFlags);
+        }
+        auto & roots = gcMarkState->roots;
+        auto & next = gcMarkState->next;
+        while ( next!=roots.size() ) {
+            gcMarkState->walker.markRoot(roots[next++]);
+            if ( get_time_usec(t0) >= budgetUsec ) {
+                gcSlicePauses.record(get_time_usec(t0));
+                return false;
             }
-            auto etext = stringHeap->allocateString(tw.str());
-            throw_error_at(*at, etext);
         }
+        // sweep
+        if ( sheap ) stringHeap->sweep();
+        heap->sweep();
+        das_set<char *> failed;
+        swap(failed, gcMarkState->walker.failed);
+        delete gcMarkState;
+        gcMarkState = nullptr;
+        gcSlicePauses.record(get_time_usec(t0));
+        if ( !failed.empty() ) {
+            reportHeapErrors(at, sheap, failed);
+        }
+        return true;
     }
-}
 
+    void Context::abortHeapCollection() {
+        if ( !gcMarkState ) return;
+        if ( gcMarkState->walker.markStringHeap ) stringHeap->abortMark();
+        heap->abortMark();
+        delete gcMarkState;
+        gcMarkState = nullptr;
+        gcAbortedCycles ++;
+    }
+
+    void GcPauseHistogram::record ( uint64_t usec ) {
+        uint32_t bucket = 0;
+        while ( bucket!=num_buckets-1 && usec>=(1ull<<bucket) ) bucket ++;
+        buckets[bucket] ++;
+        count ++;
+        totalUsec += usec;
+        maxUsec = das::max(maxUsec, usec);
+    }
+
+    void GcPauseHistogram::report ( TextWriter & tp, const char * title ) const {
+        tp << title << ": " << count << " pauses, " << totalUsec << " usec total, " << maxUsec << " usec max\n";
+        if ( !count ) return;
+        for ( uint32_t bucket=0; bucket!=num_buckets; ++bucket ) {
+            if ( !buckets[bucket] ) continue;
+            if ( bucket!=num_buckets-1 ) {
+                tp << "\t< " << (1ull<<bucket) << " usec\t" << buckets[bucket] << "\n";
+            } else {
+                tp << "\t>= " << (1ull<<(bucket-1)) << " usec\t" << buckets[bucket] << "\n";
+            }
+        }
+    }
+}
@@ -106,4 +106,65 @@ namespace das {
     void Context::clearInstruments() {}
 #endif
 
+    void Context::profileFunction ( SimFunction * FNPTR, bool isProfiling ) {
+        if ( isProfiling && !functionProfile && totalFunctions ) {
+            functionProfile = new FunctionProfileData[totalFunctions];
+        }
+        auto profFn = [&](SimFunction * fun) {
+            if ( !fun->code ) return;
+            SimNode ** pcode = &fun->code;
+#if DAS_DEBUGGER
+            // debug agent instrumentation stays outermost, so that it can be removed independently
+            if ( (*pcode)->rtti_node_isInstrumentFunction() ) {
+                pcode = &((SimNodeDebug_InstrumentFunction *)*pcode)->subexpr;
+            }
+#endif
+            if ( isProfiling ) {
+                if ( !(*pcode)->rtti_node_isProfileFunction() ) {
+                    *pcode = code->makeNode<SimNode_ProfileFunction>((*pcode)->debugInfo, fun, int32_t(fun - functions), *pcode);
+                }
+            } else {
+                if ( (*pcode)->rtti_node_isProfileFunction() ) {
+                    *pcode = ((SimNode_ProfileFunction *)*pcode)->subexpr;
+                }
+            }
+        };
+        if ( FNPTR==nullptr ) {
+            for ( int fni=0; fni!=totalFunctions; ++fni ) {
+                profFn(&functions[fni]);
+            }
+        } else {
+            profFn(FNPTR);
+        }
+    }
+
+    void Context::resetFunctionProfile() {
+        if ( functionProfile ) {
+            for ( int fni=0; fni!=totalFunctions; ++fni ) {
+                functionProfile[fni] = FunctionProfileData();
+            }
+        }
+        functionProfileChildTicks = 0;
+    }
+
+    void Context::collectFunctionProfile ( TextWriter & tout ) const {
+        if ( !functionProfile ) return;
+        vector<int> order;
+        for ( int fni=0; fni!=totalFunctions; ++fni ) {
+            if ( functionProfile[fni].calls ) order.push_back(fni);
+        }
+        sort(order.begin(), order.end(), [&](int a, int b){
+            return functionProfile[a].exclusiveTicks > functionProfile[b].exclusiveTicks;
+        });
+        tout << "\nFUNCTION PROFILE:\n";
+        tout << "calls\tinclusive usec\texclusive usec\tmax usec\tfunction\n";
+        for ( auto fni : order ) {
+            auto & data = functionProfile[fni];
+            tout << data.calls << "\t"
+                << ref_time_delta_to_usec(data.inclusiveTicks) << "\t"
+                << ref_time_delta_to_usec(data.exclusiveTicks) << "\t"
+                << ref_time_delta_to_usec(data.maxTicks) << "\t"
+                << functions[fni].mangledName << "\n";
+        }
+    }
 }
@@ -0,0 +1,2102 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate_jit.h"
+#include "daScript/simulate/simulate_nodes.h"
+#include "daScript/simulate/debug_info.h"
+#include "daScript/misc/performance_time.h"
+#include "daScript/misc/job_que.h"
+#include "daScript/simulate/simulate_visit_op.h"
+
+#if DAS_JIT
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace das {
+
+#if DAS_JIT
+    static void destroyJitTiering ( JitTiering * tiering );
+#endif
+
+    JitCodeArena::~JitCodeArena() {
+#if DAS_JIT
+        destroyJitTiering(tiering);
+        for ( auto & b : blocks ) {
+            munmap(b.first, b.second);
+        }
+#endif
+    }
+
+    void * JitCodeArena::place ( const uint8_t * code, size_t size ) {
+#if DAS_JIT
+        // one mapping per function - code of other functions is never writable while it may run on another thread
+        size_t pageSize = size_t(sysconf(_SC_PAGESIZE));
+        size_t bytes = (size + pageSize - 1) & ~(pageSize - 1);
+        void * mem = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if ( mem==MAP_FAILED ) return nullptr;
+        memcpy(mem, code, size);
+        if ( mprotect(mem, bytes, PROT_READ | PROT_EXEC)!=0 ) {
+            munmap(mem, bytes);
+            return nullptr;
+        }
+        lock_guard<mutex> guard(lock);
+        blocks.emplace_back(mem, bytes);
+        totalBytes += bytes;
+        return mem;
+#else
+        return nullptr;
+#endif
+    }
+
+#if DAS_JIT
+
+    // SimNode tree, as seen by SimVisitor
+
+    struct JitItem {
+        enum Kind : uint8_t { kSp, kArgI, kArgU, kArgI64, kArgU64, kArgF, kArgD, kArgB, kArgV, kArgS, kArgFn, kSub, kGroup };
+        Kind            kind;
+        const char *    name = "";
+        union {
+            int32_t     i;
+            uint32_t    u;
+            int64_t     i64;
+            uint64_t    u64;
+            float       f;
+            double      d;
+            bool        b;
+        };
+        vec4f           v;
+        string          s;
+        uint32_t        sub = 0;        // first child for kSub and kGroup
+        uint32_t        count = 0;      // children in kGroup
+        JitItem ( Kind k, const char * n ) : kind(k), name(n ? n : "") { u64 = 0; v = v_zero(); }
+    };
+
+    struct JitNode {
+        SimNode *       node = nullptr;
+        string          op;
+        string          tt;
+        vector<JitItem> items;
+        vector<JitNode *> subs;
+    };
+
+    struct JitReader : SimVisitor {
+        vector<unique_ptr<JitNode>> nodes;
+        vector<JitNode *> stack;
+        JitNode * root = nullptr;
+        JitNode * read ( SimNode * code ) {
+            code->visit(*this);
+            return root;
+        }
+        JitItem & item ( JitItem::Kind k, const char * name ) {
+            auto & items = stack.back()->items;
+            items.emplace_back(k, name);
+            return items.back();
+        }
+        virtual void preVisit ( SimNode * node ) override {
+            nodes.push_back(make_unique<JitNode>());
+            auto jn = nodes.back().get();
+            jn->node = node;
+            if ( stack.empty() ) {
+                root = jn;
+            } else {
+                stack.back()->subs.push_back(jn);
+            }
+            stack.push_back(jn);
+        }
+        virtual SimNode * visit ( SimNode * node ) override {
+            stack.pop_back();
+            return node;
+        }
+        virtual void op ( const char * name, uint32_t, const string & TT ) override {
+            stack.back()->op = name;
+            stack.back()->tt = TT;
+        }
+        virtual void sp ( uint32_t stackTop, const char * name ) override { item(JitItem::kSp,name).u = stackTop; }
+        virtual void arg ( int32_t a, const char * name ) override { item(JitItem::kArgI,name).i = a; }
+        virtual void arg ( uint32_t a, const char * name ) override { item(JitItem::kArgU,name).u = a; }
+        virtual void arg ( int64_t a, const char * name ) override { item(JitItem::kArgI64,name).i64 = a; }
+        virtual void arg ( uint64_t a, const char * name ) override { item(JitItem::kArgU64,name).u64 = a; }
+        virtual void arg ( float a, const char * name ) override { item(JitItem::kArgF,name).f = a; }
+        virtual void arg ( double a, const char * name ) override { item(JitItem::kArgD,name).d = a; }
+        virtual void arg ( bool a, const char * name ) override { item(JitItem::kArgB,name).b = a; }
+        virtual void arg ( vec4f a, const char * name ) override { item(JitItem::kArgV,name).v = a; }
+        virtual void arg ( const char * a, const char * name ) override { item(JitItem::kArgS,name).s = a ? a : ""; }
+        virtual void arg ( Func, const char * mangledName, const char * name ) override {
+            item(JitItem::kArgFn,name).s = mangledName ? mangledName : "";
+        }
+        virtual void arg ( Func, uint32_t mnh, const char * name ) override { item(JitItem::kArgFn,name).u = mnh; }
+        virtual SimNode * sub ( SimNode * node, const char * name ) override {
+            auto & it = item(JitItem::kSub,name);
+            it.sub = uint32_t(stack.back()->subs.size());
+            return node->visit(*this);
+        }
+        virtual void sub ( SimNode ** list, uint32_t count, const char * name ) override {
+            auto & it = item(JitItem::kGroup,name);
+            it.sub = uint32_t(stack.back()->subs.size());
+            it.count = count;
+            for ( uint32_t i=0; i!=count; ++i ) {
+                list[i] = list[i]->visit(*this);
+            }
+        }
+    };
+
+    // x86-64 encoder, only what the templates bellow need
+
+    enum JitReg : uint8_t { RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI, R8, R9, R10, R11, R12, R13, R14, R15 };
+    enum JitXmm : uint8_t { XMM0, XMM1, XMM2 };
+    enum JitCond : uint8_t { cB=0x2, cAE=0x3, cE=0x4, cNE=0x5, cBE=0x6, cA=0x7, cP=0xA, cNP=0xB, cL=0xC, cGE=0xD, cLE=0xE, cG=0xF };
+
+    struct JitMem {
+        JitReg  base;
+        int32_t disp;
+    };
+
+    struct JitAssembler {
+        vector<uint8_t>     code;
+        vector<int32_t>     labels;
+        vector<pair<uint32_t,int>> fixups;
+        void byte ( uint8_t b ) { code.push_back(b); }
+        void dword ( uint32_t d ) { for ( int i=0; i!=4; ++i ) byte(uint8_t(d>>(i*8))); }
+        void qword ( uint64_t q ) { for ( int i=0; i!=8; ++i ) byte(uint8_t(q>>(i*8))); }
+        int newLabel() { labels.push_back(-1); return int(labels.size()) - 1; }
+        void bind ( int l ) { labels[l] = int32_t(code.size()); }
+        void rel32 ( int l ) { fixups.emplace_back(uint32_t(code.size()), l); dword(0); }
+        bool link() {
+            for ( auto & f : fixups ) {
+                int32_t target = labels[f.second];
+                if ( target<0 ) return false;
+                int32_t rel = target - int32_t(f.first + 4);
+                memcpy(code.data() + f.first, &rel, 4);
+            }
+            return true;
+        }
+        // encoding
+        void rex ( bool w, int reg, int base, bool force = false ) {
+            uint8_t r = uint8_t(0x40 | (w ? 8 : 0) | ((reg & 8) ? 4 : 0) | ((base & 8) ? 1 : 0));
+            if ( r!=0x40 || force ) byte(r);
+        }
+        void modrm ( int reg, JitMem m ) {
+            int base = m.base & 7;
+            if ( m.disp==0 && base!=5 ) {
+                byte(uint8_t(((reg & 7) << 3) | base));
+                if ( base==4 ) byte(0x24);
+            } else if ( m.disp>=-128 && m.disp<=127 ) {
+                byte(uint8_t(0x40 | ((reg & 7) << 3) | base));
+                if ( base==4 ) byte(0x24);
+                byte(uint8_t(int8_t(m.disp)));
+            } else {
+                byte(uint8_t(0x80 | ((reg & 7) << 3) | base));
+                if ( base==4 ) byte(0x24);
+                dword(uint32_t(m.disp));
+            }
+        }
+        void opM ( uint8_t prefix, bool w, uint8_t op0, int op1, int reg, JitMem m ) {
+            if ( prefix ) byte(prefix);
+            rex(w, reg, m.base);
+            byte(op0);
+            if ( op1>=0 ) byte(uint8_t(op1));
+            modrm(reg, m);
+        }
+        void opR ( uint8_t prefix, bool w, uint8_t op0, int op1, int reg, int rm ) {
+            if ( prefix ) byte(prefix);
+            rex(w, reg, rm);
+            byte(op0);
+            if ( op1>=0 ) byte(uint8_t(op1));
+            byte(uint8_t(0xC0 | ((reg & 7) << 3) | (rm & 7)));
+        }
+        // general purpose
+        void mov ( JitReg dst, JitReg src, bool w = true ) { opR(0, w, 0x89, -1, src, dst); }
+        void movImm ( JitReg dst, uint64_t imm ) {
+            if ( imm<=0xffffffffull ) {
+                rex(false, 0, dst);
+                byte(uint8_t(0xB8 + (dst & 7)));
+                dword(uint32_t(imm));
+            } else if ( int64_t(imm)>=INT32_MIN && int64_t(imm)<=INT32_MAX ) {
+                rex(true, 0, dst);
+                byte(0xC7);
+                byte(uint8_t(0xC0 | (dst & 7)));
+                dword(uint32_t(imm));
+            } else {
+                rex(true, 0, dst);
+                byte(uint8_t(0xB8 + (dst & 7)));
+                qword(imm);
+            }
+        }
+        void load ( JitReg dst, JitMem m, bool w ) { opM(0, w, 0x8B, -1, dst, m); }
+        void loadU8 ( JitReg dst, JitMem m ) { opM(0, false, 0x0F, 0xB6, dst, m); }
+        void store ( JitMem m, JitReg src, bool w ) { opM(0, w, 0x89, -1, src, m); }
+        void store8 ( JitMem m, JitReg src ) { opM(0, false, 0x88, -1, src, m); }   // note: src is al or cl
+        void lea ( JitReg dst, JitMem m ) { opM(0, true, 0x8D, -1, dst, m); }
+        void alu ( uint8_t op, JitReg dst, JitReg src, bool w ) { opR(0, w, op, -1, src, dst); }
+        void add ( JitReg dst, JitReg src, bool w ) { alu(0x01, dst, src, w); }
+        void or_ ( JitReg dst, JitReg src, bool w ) { alu(0x09, dst, src, w); }
+        void and_ ( JitReg dst, JitReg src, bool w ) { alu(0x21, dst, src, w); }
+        void sub ( JitReg dst, JitReg src, bool w ) { alu(0x29, dst, src, w); }
+        void xor_ ( JitReg dst, JitReg src, bool w ) { alu(0x31, dst, src, w); }
+        void cmp ( JitReg a, JitReg b, bool w ) { alu(0x39, a, b, w); }
+        void test ( JitReg a, JitReg b, bool w ) { alu(0x85, a, b, w); }
+        void imul ( JitReg dst, JitReg src, bool w ) { opR(0, w, 0x0F, 0xAF, dst, src); }
+        void grp3 ( int ext, JitReg r, bool w ) { opR(0, w, 0xF7, -1, ext, r); }     // not, neg, div, idiv
+        void shiftCl ( int ext, JitReg r, bool w ) { opR(0, w, 0xD3, -1, ext, r); }   // rol, ror, shl, shr, sar
+        void aluImm ( int ext, JitReg r, int32_t imm, bool w ) {
+            rex(w, 0, r);
+            byte(0x81);
+            byte(uint8_t(0xC0 | (ext << 3) | (r & 7)));
+            dword(uint32_t(imm));
+        }
+        void aluImmMem ( int ext, JitMem m, int32_t imm ) {   // 32-bit [m] op= imm
+            rex(false, 0, m.base);
+            byte(0x81);
+            modrm(ext, m);
+            dword(uint32_t(imm));
+        }
+        void testImm ( JitReg r, uint32_t imm ) {
+            rex(false, 0, r);
+            if ( (r & 7)==0 ) {
+                byte(0xA9);
+            } else {
+                byte(0xF7);
+                byte(uint8_t(0xC0 | (r & 7)));
+            }
+            dword(imm);
+        }
+        void shrImm ( JitReg r, uint8_t count, bool w ) {
+            rex(w, 0, r);
+            byte(0xC1);
+            byte(uint8_t(0xE8 | (r & 7)));
+            byte(count);
+        }
+        void cdq ( bool w ) { if ( w ) byte(0x48); byte(0x99); }
+        void setcc ( JitCond c, JitReg r ) { opR(0, false, 0x0F, 0x90 | c, 0, r); }
+        void movzx8 ( JitReg dst, JitReg src ) { opR(0, false, 0x0F, 0xB6, dst, src); }
+        void movsxd ( JitReg dst, JitReg src ) { opR(0, true, 0x63, -1, dst, src); }
+        void jcc ( JitCond c, int l ) { byte(0x0F); byte(uint8_t(0x80 | c)); rel32(l); }
+        void jmp ( int l ) { byte(0xE9); rel32(l); }
+        void callR ( JitReg r ) { opR(0, false, 0xFF, -1, 2, r); }
+        void push ( JitReg r ) { if ( r & 8 ) byte(0x41); byte(uint8_t(0x50 + (r & 7))); }
+        void pop ( JitReg r ) { if ( r & 8 ) byte(0x41); byte(uint8_t(0x58 + (r & 7))); }
+        void ret() { byte(0xC3); }
+        // sse
+        void movss ( JitXmm x, JitMem m ) { opM(0xF3, false, 0x0F, 0x10, x, m); }
+        void movss ( JitMem m, JitXmm x ) { opM(0xF3, false, 0x0F, 0x11, x, m); }
+        void movsd ( JitXmm x, JitMem m ) { opM(0xF2, false, 0x0F, 0x10, x, m); }
+        void movsd ( JitMem m, JitXmm x ) { opM(0xF2, false, 0x0F, 0x11, x, m); }
+        void movups ( JitXmm x, JitMem m ) { opM(0, false, 0x0F, 0x10, x, m); }
+        void movups ( JitMem m, JitXmm x ) { opM(0, false, 0x0F, 0x11, x, m); }
+        void movaps ( JitXmm dst, JitXmm src ) { opR(0, false, 0x0F, 0x28, dst, src); }
+        void movq ( JitXmm x, JitReg r, bool w ) { opR(0x66, w, 0x0F, 0x6E, x, r); }      // movd / movq xmm, r
+        void movq ( JitReg r, JitXmm x, bool w ) { opR(0x66, w, 0x0F, 0x7E, x, r); }      // movd / movq r, xmm
+        void sse ( bool dbl, uint8_t op, JitXmm dst, JitXmm src ) { opR(dbl ? 0xF2 : 0xF3, false, 0x0F, op, dst, src); }
+        void ucomis ( bool dbl, JitXmm a, JitXmm b ) { opR(dbl ? 0x66 : 0, false, 0x0F, 0x2E, a, b); }
+        void xorps ( JitXmm dst, JitXmm src ) { opR(0, false, 0x0F, 0x57, dst, src); }
+        void cvtsi2s ( bool dbl, JitXmm dst, JitReg src, bool w ) { opR(dbl ? 0xF2 : 0xF3, w, 0x0F, 0x2A, dst, src); }
+        void cvtts2si ( bool dbl, JitReg dst, JitXmm src, bool w ) { opR(dbl ? 0xF2 : 0xF3, w, 0x0F, 0x2C, dst, src); }
+        void cvts2s ( bool fromDbl, JitXmm dst, JitXmm src ) { opR(fromDbl ? 0xF2 : 0xF3, false, 0x0F, 0x5A, dst, src); }
+    };
+
+    // value types the templates work with
+    //  integers and pointers live in rax (rcx for the right operand), floating point in xmm0 (xmm1)
+
+    enum class JitType : uint8_t { none, tBool, tInt, tUInt, tInt64, tUInt64, tFloat, tDouble, tPtr };
+
+    static JitType jitTypeFromName ( const string & name ) {
+        if ( name=="bool" ) return JitType::tBool;
+        if ( name=="int" ) return JitType::tInt;
+        if ( name=="uint" ) return JitType::tUInt;
+        if ( name=="int64" ) return JitType::tInt64;
+        if ( name=="uint64" ) return JitType::tUInt64;
+        if ( name=="float" ) return JitType::tFloat;
+        if ( name=="double" ) return JitType::tDouble;
+        if ( name=="pointer" ) return JitType::tPtr;
+        return JitType::none;
+    }
+
+    // strings are pointers, when copied around - but not when compared
+    static JitType jitValueTypeFromName ( const string & name ) {
+        return name=="string" ? JitType::tPtr : jitTypeFromName(name);
+    }
+
+    static JitType jitTypeFromInfo ( TypeInfo * info ) {
+        if ( !info || info->dimSize ) return JitType::none;
+        if ( info->flags & TypeInfo::flag_ref ) return JitType::none;
+        switch ( info->type ) {
+        case Type::tBool:       return JitType::tBool;
+        case Type::tInt:        return JitType::tInt;
+        case Type::tUInt:       return JitType::tUInt;
+        case Type::tInt64:      return JitType::tInt64;
+        case Type::tUInt64:     return JitType::tUInt64;
+        case Type::tFloat:      return JitType::tFloat;
+        case Type::tDouble:     return JitType::tDouble;
+        case Type::tString:     return JitType::tPtr;
+        case Type::tPointer:    return JitType::tPtr;
+        default:                return JitType::none;
+        }
+    }
+
+    static __forceinline bool isFloat ( JitType t ) { return t==JitType::tFloat || t==JitType::tDouble; }
+    static __forceinline bool isWide ( JitType t ) { return t==JitType::tInt64 || t==JitType::tUInt64 || t==JitType::tPtr; }
+    static __forceinline bool isSigned ( JitType t ) { return t==JitType::tInt || t==JitType::tInt64; }
+    static __forceinline bool isInteger ( JitType t ) {
+        return t==JitType::tInt || t==JitType::tUInt || t==JitType::tInt64 || t==JitType::tUInt64;
+    }
+
+    // operations of fused and regular op1 \ op2 nodes
+
+    enum class JitOp : uint8_t {
+        none, add, sub, mul, div, mod, binAnd, binOr, binXor, shl, shr, rotl, rotr,
+        equ, notEqu, less, lessEqu, gt, gtEqu, set
+    };
+
+    struct JitOpName { const char * name; JitOp op; bool isSet; };
+
+    static const JitOpName g_jitOp2[] = {
+        {"Add",JitOp::add,false}, {"Sub",JitOp::sub,false}, {"Mul",JitOp::mul,false}, {"Div",JitOp::div,false},
+        {"Mod",JitOp::mod,false}, {"BinAnd",JitOp::binAnd,false}, {"BinOr",JitOp::binOr,false},
+        {"BinXor",JitOp::binXor,false}, {"BinShl",JitOp::shl,false}, {"BinShr",JitOp::shr,false},
+        {"BinRotl",JitOp::rotl,false}, {"BinRotr",JitOp::rotr,false},
+        {"Equ",JitOp::equ,false}, {"NotEqu",JitOp::notEqu,false}, {"Less",JitOp::less,false},
+        {"LessEqu",JitOp::lessEqu,false}, {"Gt",JitOp::gt,false}, {"GtEqu",JitOp::gtEqu,false},
+        {"Set",JitOp::set,true}, {"SetAdd",JitOp::add,true}, {"SetSub",JitOp::sub,true},
+        {"SetMul",JitOp::mul,true}, {"SetDiv",JitOp::div,true}, {"SetMod",JitOp::mod,true},
+        {"SetBinAnd",JitOp::binAnd,true}, {"SetBinOr",JitOp::binOr,true}, {"SetBinXor",JitOp::binXor,true},
+        {"SetBinShl",JitOp::shl,true}, {"SetBinShr",JitOp::shr,true},
+        {"SetBinRotl",JitOp::rotl,true}, {"SetBinRotr",JitOp::rotr,true},
+    };
+
+    static const char * g_jitOp1[] = {
+        "Unm", "Unp", "BoolNot", "BinNot", "Inc", "Dec", "IncPost", "DecPost", "Return",
+        "FieldDerefR2V", "PtrFieldDerefR2V", "IfZeroThen", "IfNotZeroThen", "IfZeroThenElse", "IfNotZeroThenElse",
+    };
+
+    static __forceinline bool isCompare ( JitOp op ) {
+        return op==JitOp::equ || op==JitOp::notEqu || op==JitOp::less || op==JitOp::lessEqu || op==JitOp::gt || op==JitOp::gtEqu;
+    }
+
+    // fused node operand, see SimSource
+    struct JitSrc {
+        enum Kind : uint8_t { kNone, kAny, kConst, kLoc, kLocro, kArg, kArgr, kArgro };
+        Kind        kind = kNone;
+        uint32_t    sp = 0;         // stack top or argument index
+        uint32_t    offset = 0;
+        vec4f       value;
+        JitNode *   node = nullptr;
+        JitSrc() { value = v_zero(); }
+    };
+
+    static JitSrc::Kind jitSrcKind ( const string & name ) {
+        if ( name=="Any" ) return JitSrc::kAny;
+        if ( name=="Const" ) return JitSrc::kConst;
+        if ( name=="Loc" ) return JitSrc::kLoc;
+        if ( name=="Locro" ) return JitSrc::kLocro;
+        if ( name=="Arg" ) return JitSrc::kArg;
+        if ( name=="Argr" ) return JitSrc::kArgr;
+        if ( name=="Argro" ) return JitSrc::kArgro;
+        return JitSrc::kNone;
+    }
+
+    struct JitFused {
+        string      op;
+        JitSrc      src[2];
+        int         nsrc = 0;
+        uint32_t    next = 0;       // first item after the sources
+    };
+
+    // helpers called from machine code
+
+    static int32_t jit_eval_int ( Context * context, SimNode * node ) { return node->evalInt(*context); }
+    static uint32_t jit_eval_uint ( Context * context, SimNode * node ) { return node->evalUInt(*context); }
+    static int64_t jit_eval_int64 ( Context * context, SimNode * node ) { return node->evalInt64(*context); }
+    static uint64_t jit_eval_uint64 ( Context * context, SimNode * node ) { return node->evalUInt64(*context); }
+    static float jit_eval_float ( Context * context, SimNode * node ) { return node->evalFloat(*context); }
+    static double jit_eval_double ( Context * context, SimNode * node ) { return node->evalDouble(*context); }
+    static uint32_t jit_eval_bool ( Context * context, SimNode * node ) { return node->evalBool(*context) ? 1 : 0; }
+    static char * jit_eval_ptr ( Context * context, SimNode * node ) { return node->evalPtr(*context); }
+    static vec4f jit_eval_vec ( Context * context, SimNode * node ) { return node->eval(*context); }
+    static uint32_t jit_eval_stmt ( Context * context, SimNode * node ) {
+        node->eval(*context);
+        return context->stopFlags;
+    }
+    static vec4f jit_call ( Context * context, SimFunction * fn, vec4f * args, LineInfo * at ) {
+        return context->call(fn, args, at);
+    }
+    static vec4f jit_fast_call ( Context * context, SimFunction * fn, vec4f * args ) {
+        auto aa = context->abiArg;
+        context->abiArg = args;
+        auto res = fn->code->eval(*context);
+        context->stopFlags &= ~(EvalFlags::stopForReturn | EvalFlags::stopForBreak | EvalFlags::stopForContinue);
+        context->abiArg = aa;
+        return res;
+    }
+    static void jit_throw ( Context * context, LineInfo * at, const char * message ) {
+        context->throw_error_at(at ? *at : LineInfo(), "%s", message);
+    }
+
+    struct StackAllocatorJitAccess : StackAllocator {
+        static char * StackAllocator::* evalTopMember() { return &StackAllocatorJitAccess::evalTop; }
+        static char * StackAllocator::* stackTopMember() { return &StackAllocatorJitAccess::stackTop; }
+        static char * StackAllocator::* stackMember() { return &StackAllocatorJitAccess::stack; }
+    };
+
+    // everything compiler needs to know about the context, so that it can run on another thread
+    struct JitTarget {
+        JitTarget ( Context * ctx ) {
+            evalTopOffset = int32_t((char *)&(ctx->stack.*StackAllocatorJitAccess::evalTopMember()) - (char *)ctx);
+            stackTopOffset = int32_t((char *)&(ctx->stack.*StackAllocatorJitAccess::stackTopMember()) - (char *)ctx);
+            stackOffset = int32_t((char *)&(ctx->stack.*StackAllocatorJitAccess::stackMember()) - (char *)ctx);
+            abiArgOffset = int32_t((char *)&ctx->abiArg - (char *)ctx);
+            resultOffset = int32_t((char *)&ctx->result - (char *)ctx);
+            stopFlagsOffset = int32_t((char *)&ctx->stopFlags - (char *)ctx);
+            totalFunctions = ctx->getTotalFunctions();
+            functions = totalFunctions ? ctx->getFunction(0) : nullptr;   // lives in the code allocator
+        }
+        int32_t         evalTopOffset, stackTopOffset, stackOffset, abiArgOffset, resultOffset, stopFlagsOffset;
+        SimFunction *   functions;
+        int32_t         totalFunctions;
+    };
+
+    // tiers, time is charged to the tier which is currently running on the thread
+    enum class JitTier : int32_t { none, interpreter, jit };
+
+    struct JitTierClock {
+        JitTiering *    owner = nullptr;
+        JitTier         tier = JitTier::none;
+        int64_t         stamp = 0;
+    };
+
+    static DAS_THREAD_LOCAL JitTierClock g_jitTierClock;
+
+    static void chargeJitTier ( JitTiering * owner, JitTier tier, int64_t ticks );
+
+    // time is only read when the tier changes, calls within the same tier cost nothing
+    // context throws via longjmp, so the clock may be left in the inner tier - it is charged to it, until the next change
+    struct JitTierScope {
+        __forceinline JitTierScope ( JitTiering * owner, JitTier tier ) {
+            active = g_jitTierClock.tier!=tier || g_jitTierClock.owner!=owner;
+            if ( active ) {
+                int64_t now = ref_time_ticks();
+                if ( g_jitTierClock.owner ) chargeJitTier(g_jitTierClock.owner, g_jitTierClock.tier, now - g_jitTierClock.stamp);
+                saved = g_jitTierClock;
+                g_jitTierClock.owner = owner;
+                g_jitTierClock.tier = tier;
+                g_jitTierClock.stamp = now;
+            }
+        }
+        __forceinline ~JitTierScope () {
+            if ( active ) {
+                int64_t now = ref_time_ticks();
+                if ( g_jitTierClock.owner ) chargeJitTier(g_jitTierClock.owner, g_jitTierClock.tier, now - g_jitTierClock.stamp);
+                saved.stamp = now;
+                g_jitTierClock = saved;
+            }
+        }
+        JitTierClock    saved;
+        bool            active;
+    };
+
+    // jit code, installed by tiering - same as SimNode_Jit, but charges time to the jit tier
+    struct SimNode_JitTiered : SimNode_Jit {
+        SimNode_JitTiered ( const LineInfo & at, JitFunction eval, JitTiering * t )
+            : SimNode_Jit(at, eval), tiering(t) {}
+        virtual vec4f eval ( Context & context ) override {
+            DAS_PROFILE_NODE
+            JitTierScope scope(tiering, JitTier::jit);
+            return SimNode_Jit::eval(context);
+        }
+        JitTiering * tiering;
+    };
+
+    // jit to jit calls check callee's node vtable, and take the machine code straight from it
+    //  tiered jit code is called directly too, there is no tier change in between
+    struct SimNodeJitLayout {
+        void *  vtable;
+        void *  tieredVtable;
+        int32_t funcOffset;
+        SimNodeJitLayout() {
+            alignas(SimNode_Jit) static char buffer[sizeof(SimNode_Jit)];
+            alignas(SimNode_JitTiered) static char tieredBuffer[sizeof(SimNode_JitTiered)];
+            auto node = new (buffer) SimNode_Jit(LineInfo(), nullptr);  // never destroyed, trivial
+            auto tnode = new (tieredBuffer) SimNode_JitTiered(LineInfo(), nullptr, nullptr);
+            vtable = *(void **)node;
+            tieredVtable = *(void **)tnode;
+            funcOffset = int32_t((char *)&node->func - (char *)node);
+            DAS_ASSERT(funcOffset==int32_t((char *)&tnode->func - (char *)tnode));
+        }
+    };
+
+    // template compiler
+
+    class JitCompiler {
+        struct Loop {
+            int breakLabel;
+            int continueLabel;
+            int stopLabel;
+        };
+        struct Stub {
+            int         label;
+            uint32_t    pushDepth;
+            LineInfo *  at;
+            const char * message;
+        };
+    public:
+        JitCompiler ( const JitTarget & t, SimFunction * f ) : target(t), fn(f) {
+            spOffset = t.evalTopOffset;
+            stackTopOffset = t.stackTopOffset;
+            stackOffset = t.stackOffset;
+            abiArgOffset = t.abiArgOffset;
+            resultOffset = t.resultOffset;
+            stopFlagsOffset = t.stopFlagsOffset;
+            resultType = fn->debugInfo ? jitTypeFromInfo(fn->debugInfo->result) : JitType::none;
+        }
+        bool compile ( JitNode * root, vector<uint8_t> & code ) {
+            entryLabel = a.newLabel();
+            exitLabel = a.newLabel();
+            exitResultLabel = a.newLabel();
+            a.bind(entryLabel);
+            // prologue: rbx - stack frame, r12 - arguments, r13 - context, r14 - cmres
+            a.push(RBP);
+            a.mov(RBP, RSP);
+            a.push(RBX); a.push(R12); a.push(R13); a.push(R14); a.push(R15);
+            a.byte(0x48); a.byte(0x81); a.byte(0xEC);       // sub rsp, frame
+            uint32_t frameFixup = uint32_t(a.code.size());
+            a.dword(0);
+            a.mov(R13, RDI);
+            a.mov(R12, RSI);
+            a.mov(R14, RDX);
+            a.load(RBX, JitMem{R13, spOffset}, true);
+            if ( fn->fastcall && resultType!=JitType::none ) {
+                // fastcall function is its return expression
+                expr(root, resultType);
+                if ( stats.nativeNodes==0 ) return false;
+                returnValue(resultType);
+            } else {
+                stmt(root);
+                if ( stats.nativeNodes==0 ) return false;
+            }
+            a.xorps(XMM0, XMM0);
+            a.jmp(exitLabel);
+            // fallback returned, result is in context
+            a.bind(exitResultLabel);
+            a.movups(XMM0, JitMem{R13, resultOffset});
+            a.bind(exitLabel);
+            a.lea(RSP, JitMem{RBP, -40});
+            a.pop(R15); a.pop(R14); a.pop(R13); a.pop(R12); a.pop(RBX); a.pop(RBP);
+            a.ret();
+            emitStubs();
+            if ( !a.link() ) return false;
+            uint32_t frame = frameBytes < 8 ? 8 : (((frameBytes - 8) + 15) & ~15u) + 8;
+            if ( frame > 0x10000 ) return false;
+            memcpy(a.code.data() + frameFixup, &frame, 4);
+            code = move(a.code);
+            stats.codeSize = uint32_t(code.size());
+            return true;
+        }
+        JitStats stats;
+    protected:
+        JitTarget       target;
+        SimFunction *   fn;
+        JitAssembler    a;
+        JitType         resultType;
+        int32_t         spOffset, resultOffset, stopFlagsOffset;
+        int32_t         stackTopOffset, stackOffset, abiArgOffset;
+        int             entryLabel = -1, exitLabel = -1, exitResultLabel = -1;
+        uint32_t        frameBytes = 0;
+        uint32_t        pushDepth = 0;
+        vector<Loop>    loops;
+        vector<Stub>    stubs;
+        das_hash_map<string,SimFunction *> functionByName;
+    protected:
+        // frame slots, rbp relative, 16 byte aligned
+        int32_t allocSlot ( uint32_t bytes ) {
+            uint32_t total = (40 + frameBytes + bytes + 15) & ~15u;
+            frameBytes = total - 40;
+            return -int32_t(total);
+        }
+        // native calls, keep rsp aligned
+        void callHelper ( const void * fnp ) {
+            bool pad = (pushDepth & 1)!=0;
+            if ( pad ) a.aluImm(5, RSP, 8, true);
+            a.movImm(RAX, uint64_t(intptr_t(fnp)));
+            a.callR(RAX);
+            if ( pad ) a.aluImm(0, RSP, 8, true);
+        }
+        void pushValue ( JitType t ) {
+            if ( isFloat(t) ) {
+                a.aluImm(5, RSP, 8, true);
+                a.movsd(JitMem{RSP,0}, XMM0);
+            } else {
+                a.push(RAX);
+            }
+            pushDepth ++;
+        }
+        void popValue ( JitType t, bool second ) {
+            if ( isFloat(t) ) {
+                a.movsd(second ? XMM1 : XMM0, JitMem{RSP,0});
+                a.aluImm(0, RSP, 8, true);
+            } else {
+                a.pop(second ? RCX : RAX);
+            }
+            pushDepth --;
+        }
+        void popReg ( JitReg r ) {
+            a.pop(r);
+            pushDepth --;
+        }
+        void toSecond ( JitType t ) {
+            if ( isFloat(t) ) a.movaps(XMM1, XMM0);
+            else a.mov(RCX, RAX);
+        }
+        int stub ( LineInfo * at, const char * message ) {
+            Stub s;
+            s.label = a.newLabel();
+            s.pushDepth = pushDepth;
+            s.at = at;
+            s.message = message;
+            stubs.push_back(s);
+            return s.label;
+        }
+        void emitStubs() {
+            for ( auto & s : stubs ) {
+                a.bind(s.label);
+                if ( s.pushDepth & 1 ) a.aluImm(5, RSP, 8, true);
+                a.mov(RDI, R13);
+                a.movImm(RSI, uint64_t(intptr_t(s.at)));
+                a.movImm(RDX, uint64_t(intptr_t(s.message)));
+                a.movImm(RAX, uint64_t(intptr_t(&jit_throw)));
+                a.callR(RAX);
+            }
+        }
+    protected:
+        // loads and stores
+        void loadMem ( JitType t, JitMem m, bool second ) {
+            switch ( t ) {
+            case JitType::tBool:    a.loadU8(second ? RCX : RAX, m); break;
+            case JitType::tInt:
+            case JitType::tUInt:    a.load(second ? RCX : RAX, m, false); break;
+            case JitType::tFloat:   a.movss(second ? XMM1 : XMM0, m); break;
+            case JitType::tDouble:  a.movsd(second ? XMM1 : XMM0, m); break;
+            default:                a.load(second ? RCX : RAX, m, true); break;
+            }
+        }
+        void storeMem ( JitType t, JitMem m, bool second ) {
+            switch ( t ) {
+            case JitType::tBool:    a.store8(m, second ? RCX : RAX); break;
+            case JitType::tInt:
+            case JitType::tUInt:    a.store(m, second ? RCX : RAX, false); break;
+            case JitType::tFloat:   a.movss(m, second ? XMM1 : XMM0); break;
+            case JitType::tDouble:  a.movsd(m, second ? XMM1 : XMM0); break;
+            default:                a.store(m, second ? RCX : RAX, true); break;
+            }
+        }
+        void loadConst ( JitType t, vec4f v, bool second ) {
+            JitReg r = second ? RCX : RAX;
+            switch ( t ) {
+            case JitType::tBool:    a.movImm(r, cast<bool>::to(v) ? 1 : 0); break;
+            case JitType::tInt:
+            case JitType::tUInt:
+            case JitType::tFloat:   a.movImm(r, cast<uint32_t>::to(v)); break;
+            default:                a.movImm(r, cast<uint64_t>::to(v)); break;
+            }
+            if ( t==JitType::tFloat ) a.movq(second ? XMM1 : XMM0, r, false);
+            else if ( t==JitType::tDouble ) a.movq(second ? XMM1 : XMM0, r, true);
+        }
+        // address of the operand, may use tmp register
+        JitMem srcMem ( const JitSrc & s, JitReg tmp ) {
+            switch ( s.kind ) {
+            case JitSrc::kLoc:      return JitMem{RBX, int32_t(s.sp)};
+            case JitSrc::kArg:      return JitMem{R12, int32_t(s.sp * sizeof(vec4f))};
+            case JitSrc::kArgr:
+                a.load(tmp, JitMem{R12, int32_t(s.sp * sizeof(vec4f))}, true);
+                return JitMem{tmp, 0};
+            case JitSrc::kArgro:
+                a.load(tmp, JitMem{R12, int32_t(s.sp * sizeof(vec4f))}, true);
+                return JitMem{tmp, int32_t(s.offset)};
+            case JitSrc::kLocro:
+                a.load(tmp, JitMem{RBX, int32_t(s.sp)}, true);
+                return JitMem{tmp, int32_t(s.offset)};
+            default:
+                DAS_ASSERT(0);
+                return JitMem{RBX, 0};
+            }
+        }
+        void loadSrc ( const JitSrc & s, JitType t, bool second ) {
+            if ( s.kind==JitSrc::kConst ) {
+                loadConst(t, s.value, second);
+            } else if ( s.kind==JitSrc::kAny ) {
+                DAS_ASSERT(!second);
+                expr(s.node, t);
+            } else {
+                loadMem(t, srcMem(s, R8), second);
+            }
+        }
+        // value of the function result
+        void returnValue ( JitType t ) {
+            switch ( t ) {
+            case JitType::tBool:
+            case JitType::tInt:
+            case JitType::tUInt:    a.movq(XMM0, RAX, false); break;
+            case JitType::tFloat:
+            case JitType::tDouble:  break;
+            default:                a.movq(XMM0, RAX, true); break;
+            }
+            a.jmp(exitLabel);
+        }
+        // vec4f in xmm0 to value of type t
+        void fromVec ( JitType t ) {
+            switch ( t ) {
+            case JitType::tBool:
+                a.movq(RAX, XMM0, false);
+                a.test(RAX, RAX, false);
+                a.setcc(cNE, RAX);
+                a.movzx8(RAX, RAX);
+                break;
+            case JitType::tInt:
+            case JitType::tUInt:    a.movq(RAX, XMM0, false); break;
+            case JitType::tFloat:
+            case JitType::tDouble:  break;
+            default:                a.movq(RAX, XMM0, true); break;
+            }
+        }
+    protected:
+        // item access
+        static const JitItem * findItem ( JitNode * n, JitItem::Kind k, const char * name ) {
+            for ( auto & it : n->items ) {
+                if ( it.kind==k && strcmp(it.name, name)==0 ) return &it;
+            }
+            return nullptr;
+        }
+        static JitNode * subNode ( JitNode * n, const char * name ) {
+            auto it = findItem(n, JitItem::kSub, name);
+            return it ? n->subs[it->sub] : nullptr;
+        }
+        static const JitItem * group ( JitNode * n, const char * name ) {
+            return findItem(n, JitItem::kGroup, name);
+        }
+        static bool emptyGroup ( JitNode * n, const char * name ) {
+            auto g = group(n, name);
+            return !g || g->count==0;
+        }
+        static bool hasItems ( JitNode * n, std::initializer_list<JitItem::Kind> kinds ) {
+            if ( n->items.size()!=kinds.size() ) return false;
+            uint32_t i = 0;
+            for ( auto k : kinds ) {
+                if ( n->items[i++].kind!=k ) return false;
+            }
+            return true;
+        }
+        // fused nodes are named operation + operand sources, i.e. SetAddLocAny
+        static bool decodeSources ( JitNode * n, const string & tail, int count, JitFused & f ) {
+            uint32_t item = 0;
+            string rest = tail;
+            for ( int s=0; s!=count; ++s ) {
+                JitSrc::Kind kind = JitSrc::kNone;
+                size_t len = 0;
+                for ( size_t l=rest.size(); l>=3; --l ) {
+                    string head = rest.substr(0, l);
+                    auto k = jitSrcKind(head);
+                    if ( k!=JitSrc::kNone && (s+1<count || l==rest.size()) ) {
+                        if ( s+1<count && jitSrcKind(rest.substr(l))==JitSrc::kNone ) continue;
+                        kind = k;
+                        len = l;
+                        break;
+                    }
+                }
+                if ( kind==JitSrc::kNone ) return false;
+                rest = rest.substr(len);
+                auto & src = f.src[s];
+                src.kind = kind;
+                auto take = [&]( JitItem::Kind k ) -> const JitItem * {
+                    if ( item>=n->items.size() || n->items[item].kind!=k ) return nullptr;
+                    return &n->items[item++];
+                };
+                const JitItem * it = nullptr;
+                switch ( kind ) {
+                case JitSrc::kAny:
+                    if ( !(it = take(JitItem::kSub)) ) return false;
+                    src.node = n->subs[it->sub];
+                    break;
+                case JitSrc::kConst:
+                    if ( !(it = take(JitItem::kArgV)) ) return false;
+                    src.value = it->v;
+                    break;
+                case JitSrc::kLoc:
+                case JitSrc::kArg:
+                case JitSrc::kArgr:
+                    if ( !(it = take(JitItem::kSp)) ) return false;
+                    src.sp = it->u;
+                    break;
+                case JitSrc::kLocro:
+                case JitSrc::kArgro:
+                    if ( !(it = take(JitItem::kSp)) ) return false;
+                    src.sp = it->u;
+                    if ( !(it = take(JitItem::kArgU)) ) return false;
+                    src.offset = it->u;
+                    break;
+                default:
+                    return false;
+                }
+            }
+            f.nsrc = count;
+            f.next = item;
+            return true;
+        }
+        static bool decodeOp2 ( JitNode * n, const JitOpName *& opn, JitFused & f ) {
+            const JitOpName * best = nullptr;
+            for ( auto & o : g_jitOp2 ) {
+                size_t len = strlen(o.name);
+                if ( n->op.size()>len && strncmp(n->op.c_str(), o.name, len)==0 ) {
+                    JitFused tf;
+                    if ( decodeSources(n, n->op.substr(len), 2, tf) ) {
+                        if ( !best || strlen(best->name)<len ) {
+                            best = &o;
+                            f = tf;
+                        }
+                    }
+                }
+            }
+            if ( !best ) return false;
+            opn = best;
+            f.op = best->name;
+            return true;
+        }
+        static bool decodeOp1 ( JitNode * n, JitFused & f ) {
+            const char * best = nullptr;
+            for ( auto o : g_jitOp1 ) {
+                size_t len = strlen(o);
+                if ( n->op.size()>len && strncmp(n->op.c_str(), o, len)==0 ) {
+                    JitFused tf;
+                    if ( decodeSources(n, n->op.substr(len), 1, tf) ) {
+                        if ( !best || strlen(best)<len ) {
+                            best = o;
+                            f = tf;
+                        }
+                    }
+                }
+            }
+            if ( !best ) return false;
+            f.op = best;
+            return true;
+        }
+        static const JitOpName * plainOp2 ( const string & name ) {
+            for ( auto & o : g_jitOp2 ) {
+                if ( name==o.name ) return &o;
+            }
+            return nullptr;
+        }
+        static bool opSupported ( JitOp op, JitType t ) {
+            switch ( t ) {
+            case JitType::tInt: case JitType::tUInt: case JitType::tInt64: case JitType::tUInt64:
+                return true;
+            case JitType::tFloat: case JitType::tDouble:
+                return op==JitOp::add || op==JitOp::sub || op==JitOp::mul || op==JitOp::div || op==JitOp::set || isCompare(op);
+            case JitType::tBool:
+            case JitType::tPtr:
+                return op==JitOp::equ || op==JitOp::notEqu || op==JitOp::set;
+            default:
+                return false;
+            }
+        }
+        // side effect free, so it can be evaluated before the left operand
+        bool isPure ( JitNode * n ) {
+            const string & o = n->op;
+            bool known = o=="ConstValue" || o=="GetLocalR2V" || o=="GetArgument" || o=="GetArgumentR2V"
+                || o=="GetLocalRefOffR2V" || o=="GetArgumentRefOffR2V" || o=="GetLocal" || o.compare(0,8,"Cast_to_")==0
+                || o=="FieldDerefR2V";
+            if ( !known ) {
+                const JitOpName * opn;
+                JitFused f;
+                if ( plainOp2(o) ) {
+                    known = !plainOp2(o)->isSet;
+                } else if ( decodeOp2(n, opn, f) ) {
+                    known = !opn->isSet;
+                } else if ( decodeOp1(n, f) ) {
+                    known = f.op=="Unm" || f.op=="Unp" || f.op=="BoolNot" || f.op=="BinNot" || f.op=="FieldDerefR2V";
+                } else if ( o=="Unm" || o=="Unp" || o=="BoolNot" || o=="BinNot" ) {
+                    known = true;
+                }
+            }
+            if ( !known ) return false;
+            for ( auto s : n->subs ) {
+                if ( !isPure(s) ) return false;
+            }
+            return true;
+        }
+    protected:
+        // binary operation, left in rax \ xmm0, right in rcx \ xmm1, result in rax \ xmm0
+        void binop ( JitOp op, JitType t, JitNode * n ) {
+            bool w = isWide(t);
+            if ( isFloat(t) ) {
+                bool dbl = t==JitType::tDouble;
+                switch ( op ) {
+                case JitOp::add:    a.sse(dbl, 0x58, XMM0, XMM1); break;
+                case JitOp::mul:    a.sse(dbl, 0x59, XMM0, XMM1); break;
+                case JitOp::sub:    a.sse(dbl, 0x5C, XMM0, XMM1); break;
+                case JitOp::div: {
+                        int ok = a.newLabel();
+                        a.xorps(XMM2, XMM2);
+                        a.ucomis(dbl, XMM1, XMM2);
+                        a.jcc(cP, ok);
+                        a.jcc(cE, stub(&n->node->debugInfo, "division by zero"));
+                        a.bind(ok);
+                        a.sse(dbl, 0x5E, XMM0, XMM1);
+                    }
+                    break;
+                default:
+                    compare(op, t);
+                    break;
+                }
+                return;
+            }
+            switch ( op ) {
+            case JitOp::add:    a.add(RAX, RCX, w); break;
+            case JitOp::sub:    a.sub(RAX, RCX, w); break;
+            case JitOp::mul:    a.imul(RAX, RCX, w); break;
+            case JitOp::binAnd: a.and_(RAX, RCX, w); break;
+            case JitOp::binOr:  a.or_(RAX, RCX, w); break;
+            case JitOp::binXor: a.xor_(RAX, RCX, w); break;
+            case JitOp::shl:    a.shiftCl(4, RAX, w); break;
+            case JitOp::shr:    a.shiftCl(isSigned(t) ? 7 : 5, RAX, w); break;
+            case JitOp::rotl:   a.shiftCl(0, RAX, w); break;
+            case JitOp::rotr:   a.shiftCl(1, RAX, w); break;
+            case JitOp::div:
+            case JitOp::mod:
+                a.test(RCX, RCX, w);
+                a.jcc(cE, stub(&n->node->debugInfo, op==JitOp::div ? "division by zero" : "division by zero in modulo"));
+                if ( isSigned(t) ) {
+                    a.cdq(w);
+                    a.grp3(7, RCX, w);
+                } else {
+                    a.xor_(RDX, RDX, false);
+                    a.grp3(6, RCX, w);
+                }
+                if ( op==JitOp::mod ) a.mov(RAX, RDX, w);
+                break;
+            default:
+                compare(op, t);
+                break;
+            }
+        }
+        // comparison to flags, returns condition which is true when comparison is true
+        //  floating point equality needs parity as well, handled by the callers
+        JitCond compareFlags ( JitOp op, JitType t ) {
+            if ( isFloat(t) ) {
+                bool dbl = t==JitType::tDouble;
+                switch ( op ) {
+                case JitOp::less:       a.ucomis(dbl, XMM1, XMM0); return cA;
+                case JitOp::lessEqu:    a.ucomis(dbl, XMM1, XMM0); return cAE;
+                case JitOp::gt:         a.ucomis(dbl, XMM0, XMM1); return cA;
+                case JitOp::gtEqu:      a.ucomis(dbl, XMM0, XMM1); return cAE;
+                case JitOp::equ:        a.ucomis(dbl, XMM0, XMM1); return cE;
+                default:                a.ucomis(dbl, XMM0, XMM1); return cNE;
+                }
+            }
+            a.cmp(RAX, RCX, isWide(t));
+            bool s = isSigned(t);
+            switch ( op ) {
+            case JitOp::less:       return s ? cL : cB;
+            case JitOp::lessEqu:    return s ? cLE : cBE;
+            case JitOp::gt:         return s ? cG : cA;
+            case JitOp::gtEqu:      return s ? cGE : cAE;
+            case JitOp::equ:        return cE;
+            default:                return cNE;
+            }
+        }
+        void compare ( JitOp op, JitType t ) {
+            JitCond c = compareFlags(op, t);
+            a.setcc(c, RAX);
+            if ( isFloat(t) && op==JitOp::equ ) {
+                a.setcc(cNP, RCX);
+                a.and_(RAX, RCX, false);
+            } else if ( isFloat(t) && op==JitOp::notEqu ) {
+                a.setcc(cP, RCX);
+                a.or_(RAX, RCX, false);
+            }
+            a.movzx8(RAX, RAX);
+        }
+        void jumpIfFalse ( JitOp op, JitType t, int falseLabel ) {
+            JitCond c = compareFlags(op, t);
+            if ( isFloat(t) && op==JitOp::equ ) {
+                a.jcc(cP, falseLabel);
+                a.jcc(cNE, falseLabel);
+            } else if ( isFloat(t) && op==JitOp::notEqu ) {
+                int taken = a.newLabel();
+                a.jcc(cP, taken);
+                a.jcc(cE, falseLabel);
+                a.bind(taken);
+            } else {
+                a.jcc(JitCond(c ^ 1), falseLabel);
+            }
+        }
+        // left operand to rax \ xmm0, right to rcx \ xmm1, in the order interpreter evaluates them
+        void operands ( const JitSrc & l, const JitSrc & r, JitType t ) {
+            if ( l.kind==JitSrc::kAny && r.kind==JitSrc::kAny ) {
+                if ( isPure(r.node) && isPure(l.node) ) {
+                    expr(r.node, t);
+                    pushValue(t);
+                    expr(l.node, t);
+                    popValue(t, true);
+                } else {
+                    expr(l.node, t);
+                    pushValue(t);
+                    expr(r.node, t);
+                    toSecond(t);
+                    popValue(t, false);
+                }
+            } else if ( l.kind==JitSrc::kAny ) {
+                expr(l.node, t);
+                loadSrc(r, t, true);
+            } else if ( r.kind==JitSrc::kAny ) {
+                if ( isPure(r.node) ) {
+                    expr(r.node, t);
+                    toSecond(t);
+                    loadSrc(l, t, false);
+                } else {
+                    loadSrc(l, t, false);
+                    pushValue(t);
+                    expr(r.node, t);
+                    toSecond(t);
+                    popValue(t, false);
+                }
+            } else {
+                loadSrc(l, t, false);
+                loadSrc(r, t, true);
+            }
+        }
+        JitSrc anySrc ( JitNode * n ) {
+            JitSrc s;
+            s.kind = JitSrc::kAny;
+            s.node = n;
+            return s;
+        }
+    protected:
+        // expressions
+        void fallbackExpr ( JitNode * n, JitType t ) {
+            stats.fallbackNodes ++;
+            a.mov(RDI, R13);
+            a.movImm(RSI, uint64_t(intptr_t(n->node)));
+            switch ( t ) {
+            case JitType::tBool:    callHelper((const void *)&jit_eval_bool); break;
+            case JitType::tInt:     callHelper((const void *)&jit_eval_int); break;
+            case JitType::tUInt:    callHelper((const void *)&jit_eval_uint); break;
+            case JitType::tInt64:   callHelper((const void *)&jit_eval_int64); break;
+            case JitType::tUInt64:  callHelper((const void *)&jit_eval_uint64); break;
+            case JitType::tFloat:   callHelper((const void *)&jit_eval_float); break;
+            case JitType::tDouble:  callHelper((const void *)&jit_eval_double); break;
+            case JitType::tPtr:     callHelper((const void *)&jit_eval_ptr); break;
+            default:                callHelper((const void *)&jit_eval_vec); break;
+            }
+        }
+        void expr ( JitNode * n, JitType t ) {
+            uint32_t mark = uint32_t(a.code.size());
+            size_t fixups = a.fixups.size(), nstubs = stubs.size();
+            uint32_t depth = pushDepth;
+            JitStats saved = stats;
+            if ( t!=JitType::none && tryExpr(n, t) ) {
+                stats.nativeNodes ++;
+                return;
+            }
+            a.code.resize(mark);
+            a.fixups.resize(fixups);
+            stubs.resize(nstubs);
+            pushDepth = depth;
+            stats = saved;
+            fallbackExpr(n, t);
+        }
+        bool tryExpr ( JitNode * n, JitType t ) {
+            const string & o = n->op;
+            JitType tt = jitTypeFromName(n->tt);
+            JitType vt = jitValueTypeFromName(n->tt);
+            if ( o=="ConstValue" ) {
+                if ( !hasItems(n, {JitItem::kArgV}) ) return false;
+                loadConst(t, n->items[0].v, false);
+                return true;
+            } else if ( o=="GetArgument" ) {
+                if ( !hasItems(n, {JitItem::kSp}) ) return false;
+                loadMem(t, JitMem{R12, int32_t(n->items[0].u * sizeof(vec4f))}, false);
+                return true;
+            } else if ( o=="GetLocalR2V" || o=="GetArgumentR2V" || o=="GetLocalRefOffR2V" || o=="GetArgumentRefOffR2V" ) {
+                if ( vt!=t ) return false;
+                JitSrc s;
+                s.kind = o=="GetLocalR2V" ? JitSrc::kLoc : (o=="GetArgumentR2V" ? JitSrc::kArgr
+                    : (o=="GetLocalRefOffR2V" ? JitSrc::kLocro : JitSrc::kArgro));
+                if ( s.kind==JitSrc::kLocro || s.kind==JitSrc::kArgro ) {
+                    if ( !hasItems(n, {JitItem::kSp, JitItem::kArgU}) ) return false;
+                    s.offset = n->items[1].u;
+                } else if ( !hasItems(n, {JitItem::kSp}) ) {
+                    return false;
+                }
+                s.sp = n->items[0].u;
+                loadSrc(s, t, false);
+                return true;
+            } else if ( o=="GetLocal" || o=="GetLocalRefOff" || o=="GetArgumentRef" || o=="GetArgumentRefOff" ) {
+                if ( t!=JitType::tPtr ) return false;
+                bool ofs = o=="GetLocalRefOff" || o=="GetArgumentRefOff";
+                if ( ofs ? !hasItems(n, {JitItem::kSp, JitItem::kArgU}) : !hasItems(n, {JitItem::kSp}) ) return false;
+                int32_t index = int32_t(n->items[0].u);
+                if ( o=="GetLocal" ) {
+                    a.lea(RAX, JitMem{RBX, index});
+                } else if ( o=="GetArgumentRef" ) {
+                    // address of the argument itself, see SimNode_GetArgumentRef
+                    a.lea(RAX, JitMem{R12, int32_t(index * sizeof(vec4f))});
+                } else {
+                    a.load(RAX, o=="GetLocalRefOff" ? JitMem{RBX, index} : JitMem{R12, int32_t(index * sizeof(vec4f))}, true);
+                    if ( ofs && n->items[1].u ) a.lea(RAX, JitMem{RAX, int32_t(n->items[1].u)});
+                }
+                return true;
+            } else if ( o.compare(0, 8, "Cast_to_")==0 ) {
+                JitType to = jitTypeFromName(o.substr(8));
+                if ( to!=t || tt==JitType::none || n->subs.size()!=1 ) return false;
+                if ( !castSupported(tt, to) ) return false;
+                expr(n->subs[0], tt);
+                castValue(tt, to);
+                return true;
+            } else if ( o=="FieldDerefR2V" || o=="PtrFieldDerefR2V" ) {
+                // regular field access, fused versions are decoded below
+                // variant field access has an extra argument, and is left to the interpreter
+                if ( vt!=t || !hasItems(n, {JitItem::kSub, JitItem::kArgU}) ) return false;
+                expr(n->subs[0], JitType::tPtr);
+                if ( o=="PtrFieldDerefR2V" ) {
+                    a.test(RAX, RAX, true);
+                    a.jcc(cE, stub(&n->node->debugInfo, "dereferencing null pointer"));
+                }
+                loadMem(t, JitMem{RAX, int32_t(n->items[1].u)}, false);
+                return true;
+            } else if ( o=="IfThenElse" || o=="IfCmpThenElse" ) {
+                auto c = subNode(n, "cond"), tn = subNode(n, "if_true"), fn = subNode(n, "if_false");
+                if ( !c || !tn || !fn ) return false;
+                int elseLabel = a.newLabel(), endLabel = a.newLabel();
+                cond(c, elseLabel);
+                expr(tn, t);
+                a.jmp(endLabel);
+                a.bind(elseLabel);
+                expr(fn, t);
+                a.bind(endLabel);
+                return true;
+            } else if ( o=="Call" || o=="FastCall" ) {
+                return call(n, t);
+            } else if ( o=="BoolAnd" || o=="BoolOr" ) {
+                if ( t!=JitType::tBool ) return false;
+                int falseLabel = a.newLabel(), endLabel = a.newLabel();
+                if ( !logicalCond(n, falseLabel) ) return false;
+                a.movImm(RAX, 1);
+                a.jmp(endLabel);
+                a.bind(falseLabel);
+                a.xor_(RAX, RAX, false);
+                a.bind(endLabel);
+                return true;
+            } else if ( o=="Unm" || o=="Unp" || o=="BoolNot" || o=="BinNot" ) {
+                if ( tt!=t || n->subs.size()!=1 ) return false;
+                JitSrc s = anySrc(n->subs[0]);
+                return unary(o, s, t);
+            } else if ( auto opn = plainOp2(o) ) {
+                if ( opn->isSet || n->subs.size()!=2 || tt==JitType::none ) return false;
+                if ( !opSupported(opn->op, tt) ) return false;
+                if ( (isCompare(opn->op) ? JitType::tBool : tt)!=t ) return false;
+                operands(anySrc(n->subs[0]), anySrc(n->subs[1]), tt);
+                binop(opn->op, tt, n);
+                return true;
+            }
+            // fused
+            const JitOpName * opn = nullptr;
+            JitFused f;
+            if ( decodeOp2(n, opn, f) ) {
+                if ( opn->isSet || tt==JitType::none || !opSupported(opn->op, tt) ) return false;
+                if ( (isCompare(opn->op) ? JitType::tBool : tt)!=t ) return false;
+                if ( f.next!=n->items.size() ) return false;
+                operands(f.src[0], f.src[1], tt);
+                binop(opn->op, tt, n);
+                return true;
+            } else if ( decodeOp1(n, f) ) {
+                if ( f.op=="Unm" || f.op=="Unp" || f.op=="BoolNot" || f.op=="BinNot" ) {
+                    if ( tt!=t || f.next!=n->items.size() ) return false;
+                    return unary(f.op, f.src[0], t);
+                } else if ( f.op=="Inc" || f.op=="Dec" || f.op=="IncPost" || f.op=="DecPost" ) {
+                    if ( tt!=t || f.next!=n->items.size() ) return false;
+                    return incDec(f.op, f.src[0], t);
+                } else if ( f.op=="FieldDerefR2V" || f.op=="PtrFieldDerefR2V" ) {
+                    // note: fused deref has no type when its not a scalar
+                    if ( (vt!=JitType::none && vt!=t) || f.next+1!=n->items.size() ) return false;
+                    auto & ofs = n->items[f.next];
+                    if ( ofs.kind!=JitItem::kArgU ) return false;
+                    const JitSrc & s = f.src[0];
+                    if ( s.kind==JitSrc::kAny || s.kind==JitSrc::kConst ) return false;
+                    a.load(RAX, srcMem(s, R8), true);
+                    if ( f.op=="PtrFieldDerefR2V" ) {
+                        a.test(RAX, RAX, true);
+                        a.jcc(cE, stub(&n->node->debugInfo, "dereferencing null pointer"));
+                    }
+                    loadMem(t, JitMem{RAX, int32_t(ofs.u)}, false);
+                    return true;
+                }
+            }
+            return false;
+        }
+        bool unary ( const string & op, const JitSrc & s, JitType t ) {
+            if ( op=="BoolNot" ) {
+                if ( t!=JitType::tBool ) return false;
+                loadSrc(s, t, false);
+                a.aluImm(6, RAX, 1, false);
+            } else if ( op=="BinNot" ) {
+                if ( !isInteger(t) ) return false;
+                loadSrc(s, t, false);
+                a.grp3(2, RAX, isWide(t));
+            } else if ( op=="Unp" ) {
+                if ( !isInteger(t) && !isFloat(t) ) return false;
+                loadSrc(s, t, false);
+            } else {
+                if ( isInteger(t) ) {
+                    loadSrc(s, t, false);
+                    a.grp3(3, RAX, isWide(t));
+                } else if ( isFloat(t) ) {
+                    loadSrc(s, t, false);
+                    a.movImm(RCX, t==JitType::tFloat ? 0x80000000ull : 0x8000000000000000ull);
+                    a.movq(XMM1, RCX, t==JitType::tDouble);
+                    a.xorps(XMM0, XMM1);
+                } else {
+                    return false;
+                }
+            }
+            return true;
+        }
+        bool incDec ( const string & op, const JitSrc & s, JitType t ) {
+            if ( !isInteger(t) || s.kind==JitSrc::kAny || s.kind==JitSrc::kConst ) return false;
+            bool w = isWide(t);
+            JitMem m = srcMem(s, R8);
+            a.load(RAX, m, w);
+            a.mov(RCX, RAX, w);
+            a.aluImm(op[0]=='I' ? 0 : 5, RCX, 1, w);
+            a.store(m, RCX, w);
+            if ( op=="Inc" || op=="Dec" ) a.mov(RAX, RCX, w);
+            return true;
+        }
+        static bool castSupported ( JitType from, JitType to ) {
+            if ( from==to ) return true;
+            if ( from==JitType::tUInt64 && isFloat(to) ) return false;
+            if ( to==JitType::tUInt64 && isFloat(from) ) return false;
+            return (isInteger(from) || isFloat(from)) && (isInteger(to) || isFloat(to));
+        }
+        void castValue ( JitType from, JitType to ) {
+            if ( from==to ) return;
+            if ( isFloat(from) && isFloat(to) ) {
+                a.cvts2s(from==JitType::tDouble, XMM0, XMM0);
+            } else if ( isInteger(from) && isFloat(to) ) {
+                bool w = from!=JitType::tInt;
+                if ( from==JitType::tUInt ) a.mov(RAX, RAX, false);    // zero extend, convert as 64 bit
+                a.xorps(XMM0, XMM0);
+                a.cvtsi2s(to==JitType::tDouble, XMM0, RAX, w);
+            } else if ( isFloat(from) && isInteger(to) ) {
+                bool w = to!=JitType::tInt;
+                a.cvtts2si(from==JitType::tDouble, RAX, XMM0, w);
+            } else {
+                // integer to integer, widening from signed 32 bits needs sign extension
+                if ( isWide(to) && !isWide(from) ) {
+                    if ( from==JitType::tInt ) a.movsxd(RAX, RAX);
+                    else a.mov(RAX, RAX, false);
+                }
+            }
+        }
+        SimFunction * findFunction ( const string & mangledName ) {
+            if ( functionByName.empty() ) {
+                for ( int32_t i=0; i!=target.totalFunctions; ++i ) {
+                    auto f = target.functions + i;
+                    if ( f->mangledName ) functionByName[f->mangledName] = f;
+                }
+            }
+            auto it = functionByName.find(mangledName);
+            return it!=functionByName.end() ? it->second : nullptr;
+        }
+        bool call ( JitNode * n, JitType t ) {
+            auto fnName = findItem(n, JitItem::kArgFn, "fnIndex");
+            auto args = group(n, "arguments");
+            if ( !fnName || !args || subNode(n, "cmresEval") ) return false;
+            SimFunction * callee = findFunction(fnName->s);
+            if ( !callee || !callee->debugInfo || callee->debugInfo->count!=args->count ) return false;
+            if ( t!=JitType::none && jitTypeFromInfo(callee->debugInfo->result)!=t ) return false;
+            int32_t slots = args->count ? allocSlot(uint32_t(args->count * sizeof(vec4f))) : 0;
+            for ( uint32_t i=0; i!=args->count; ++i ) {
+                JitNode * an = n->subs[args->sub + i];
+                JitType at = jitTypeFromInfo(callee->debugInfo->fields[i]);
+                JitMem slot = JitMem{RBP, slots + int32_t(i * sizeof(vec4f))};
+                if ( at==JitType::none ) {
+                    fallbackExpr(an, JitType::none);
+                    a.movups(slot, XMM0);
+                } else {
+                    expr(an, at);
+                    storeMem(at, slot, false);
+                }
+            }
+            int generic = a.newLabel(), done = a.newLabel();
+            bool fast = n->op=="FastCall";
+            if ( callee==fn && !fast ) {
+                nativeCall(callee, n, slots, fast, true, generic);
+            } else {
+                // callee may get compiled or uncompiled later, so check at the time of the call
+                static SimNodeJitLayout layout;
+                a.movImm(RAX, uint64_t(intptr_t(&callee->code)));
+                a.load(RAX, JitMem{RAX,0}, true);
+                int native = a.newLabel();
+                a.load(RCX, JitMem{RAX,0}, true);
+                a.movImm(RDX, uint64_t(intptr_t(layout.vtable)));
+                a.cmp(RCX, RDX, true);
+                a.jcc(cE, native);
+                a.movImm(RDX, uint64_t(intptr_t(layout.tieredVtable)));
+                a.cmp(RCX, RDX, true);
+                a.jcc(cNE, generic);
+                a.bind(native);
+                a.load(R15, JitMem{RAX,layout.funcOffset}, true);
+                nativeCall(callee, n, slots, fast, false, generic);
+            }
+            a.jmp(done);
+            a.bind(generic);
+            a.mov(RDI, R13);
+            a.movImm(RSI, uint64_t(intptr_t(callee)));
+            a.lea(RDX, JitMem{RBP, slots});
+            if ( fast ) {
+                callHelper((const void *)&jit_fast_call);
+            } else {
+                a.movImm(RCX, uint64_t(intptr_t(&n->node->debugInfo)));
+                callHelper((const void *)&jit_call);
+            }
+            a.bind(done);
+            if ( t!=JitType::none ) fromVec(t);
+            return true;
+        }
+        // same as Context::call and Context::callOrFastcall, with the jitted callee in r15 or at entryLabel
+        void nativeCall ( SimFunction * callee, JitNode * n, int32_t slots, bool fast, bool self, int overflowLabel ) {
+            uint32_t depth = pushDepth;
+            if ( !fast ) {
+                a.load(RAX, JitMem{R13, stackTopOffset}, true);
+                a.lea(RDX, JitMem{RAX, -int32_t(callee->stackSize)});
+                a.load(RCX, JitMem{R13, stackOffset}, true);
+                a.cmp(RDX, RCX, true);
+                a.jcc(cB, overflowLabel);       // generic call reports stack overflow
+                a.push(RAX); pushDepth ++;
+                a.load(RCX, JitMem{R13, spOffset}, true);
+                a.push(RCX); pushDepth ++;
+                a.store(JitMem{R13, stackTopOffset}, RDX, true);
+                a.store(JitMem{R13, spOffset}, RDX, true);
+#if DAS_ENABLE_STACK_WALK
+                a.movImm(RCX, uint64_t(intptr_t(callee->debugInfo)));
+                a.store(JitMem{RDX, int32_t(offsetof(Prologue,info))}, RCX, true);
+                a.lea(RCX, JitMem{RBP, slots});
+                a.store(JitMem{RDX, int32_t(offsetof(Prologue,arguments))}, RCX, true);
+                a.xor_(RCX, RCX, false);
+                a.store(JitMem{RDX, int32_t(offsetof(Prologue,cmres))}, RCX, true);
+                a.movImm(RCX, uint64_t(intptr_t(&n->node->debugInfo)));
+                a.store(JitMem{RDX, int32_t(offsetof(Prologue,line))}, RCX, true);
+#endif
+            }
+            a.load(RCX, JitMem{R13, abiArgOffset}, true);
+            a.push(RCX); pushDepth ++;
+            a.lea(RSI, JitMem{RBP, slots});
+            a.store(JitMem{R13, abiArgOffset}, RSI, true);
+            a.mov(RDI, R13);
+            a.xor_(RDX, RDX, false);
+            bool pad = (pushDepth & 1)!=0;
+            if ( pad ) a.aluImm(5, RSP, 8, true);
+            if ( self ) {
+                a.byte(0xE8);
+                a.rel32(entryLabel);
+            } else {
+                a.callR(R15);
+            }
+            if ( pad ) a.aluImm(0, RSP, 8, true);
+            a.aluImmMem(4, JitMem{R13, stopFlagsOffset}, 0);      // stopFlags = 0
+            popReg(RCX);
+            a.store(JitMem{R13, abiArgOffset}, RCX, true);
+            if ( !fast ) {
+                popReg(RCX);
+                a.store(JitMem{R13, spOffset}, RCX, true);
+                popReg(RCX);
+                a.store(JitMem{R13, stackTopOffset}, RCX, true);
+            }
+            DAS_ASSERT(depth==pushDepth);
+            (void)depth;
+        }
+        // conditions jump to falseLabel, or fall through
+        // short circuit && and ||, same as Sim_BoolAnd and Sim_BoolOr
+        bool logicalCond ( JitNode * n, int falseLabel ) {
+            if ( n->subs.size()!=2 ) return false;
+            if ( n->op=="BoolAnd" ) {
+                cond(n->subs[0], falseLabel);
+                cond(n->subs[1], falseLabel);
+            } else if ( n->op=="BoolOr" ) {
+                int trueLabel = a.newLabel(), rightLabel = a.newLabel();
+                cond(n->subs[0], rightLabel);
+                a.jmp(trueLabel);
+                a.bind(rightLabel);
+                cond(n->subs[1], falseLabel);
+                a.bind(trueLabel);
+            } else {
+                return false;
+            }
+            return true;
+        }
+        void cond ( JitNode * n, int falseLabel ) {
+            JitType tt = jitTypeFromName(n->tt);
+            const JitOpName * opn = nullptr;
+            JitFused f;
+            if ( (n->op=="BoolAnd" || n->op=="BoolOr") && logicalCond(n, falseLabel) ) {
+                stats.nativeNodes ++;
+                return;
+            }
+            if ( tt!=JitType::none && decodeOp2(n, opn, f) && isCompare(opn->op) && opSupported(opn->op, tt)
+                    && f.next==n->items.size() ) {
+                operands(f.src[0], f.src[1], tt);
+                jumpIfFalse(opn->op, tt, falseLabel);
+                stats.nativeNodes ++;
+                return;
+            }
+            opn = plainOp2(n->op);
+            if ( tt!=JitType::none && opn && isCompare(opn->op) && opSupported(opn->op, tt) && n->subs.size()==2 ) {
+                operands(anySrc(n->subs[0]), anySrc(n->subs[1]), tt);
+                jumpIfFalse(opn->op, tt, falseLabel);
+                stats.nativeNodes ++;
+                return;
+            }
+            expr(n, JitType::tBool);
+            a.test(RAX, RAX, false);
+            a.jcc(cE, falseLabel);
+        }
+        // value of IfZeroThen family condition in rax, returns type of the value
+        bool zeroCond ( JitNode * n, JitType tt, int falseLabel, bool zeroIsTrue ) {
+            if ( !isInteger(tt) && tt!=JitType::tBool ) return false;
+            JitFused f;
+            if ( decodeOp1(n, f) ) {
+                if ( f.src[0].kind==JitSrc::kAny ) return false;
+                loadSrc(f.src[0], tt, false);
+            } else {
+                auto c = subNode(n, "cond");
+                if ( !c ) return false;
+                expr(c, tt);
+            }
+            a.test(RAX, RAX, isWide(tt));
+            a.jcc(zeroIsTrue ? cNE : cE, falseLabel);
+            return true;
+        }
+    protected:
+        // statements
+        int stopLabel() {
+            if ( loops.empty() ) return exitResultLabel;
+            auto & l = loops.back();
+            if ( l.stopLabel==-1 ) l.stopLabel = a.newLabel();
+            return l.stopLabel;
+        }
+        void fallbackStmt ( JitNode * n ) {
+            stats.fallbackNodes ++;
+            a.mov(RDI, R13);
+            a.movImm(RSI, uint64_t(intptr_t(n->node)));
+            callHelper((const void *)&jit_eval_stmt);
+            a.test(RAX, RAX, false);
+            a.jcc(cNE, stopLabel());
+        }
+        void stmt ( JitNode * n ) {
+            uint32_t mark = uint32_t(a.code.size());
+            size_t fixups = a.fixups.size(), nstubs = stubs.size(), nloops = loops.size();
+            uint32_t depth = pushDepth;
+            JitStats saved = stats;
+            if ( tryStmt(n) ) {
+                stats.nativeNodes ++;
+                return;
+            }
+            a.code.resize(mark);
+            a.fixups.resize(fixups);
+            stubs.resize(nstubs);
+            loops.resize(nloops);
+            pushDepth = depth;
+            stats = saved;
+            fallbackStmt(n);
+        }
+        void stmts ( JitNode * n, const JitItem * g ) {
+            for ( uint32_t i=0; i!=g->count; ++i ) {
+                stmt(n->subs[g->sub + i]);
+            }
+        }
+        // loop body, with break \ continue \ stop flags of fallback statements
+        void loopBody ( JitNode * n, int breakLabel, int continueLabel ) {
+            loops.push_back({breakLabel, continueLabel, -1});
+            if ( auto body = group(n, "list") ) {
+                stmts(n, body);
+            } else if ( auto one = subNode(n, "list[0]") ) {
+                stmt(one);
+            }
+            Loop l = loops.back();
+            loops.pop_back();
+            if ( l.stopLabel!=-1 ) {
+                // eax is context.stopFlags
+                int skip = a.newLabel(), notContinue = a.newLabel();
+                a.jmp(skip);
+                a.bind(l.stopLabel);
+                a.testImm(RAX, EvalFlags::stopForContinue);
+                a.jcc(cE, notContinue);
+                a.aluImmMem(4, JitMem{R13, stopFlagsOffset}, ~int32_t(EvalFlags::stopForContinue));
+                a.jmp(continueLabel);
+                a.bind(notContinue);
+                a.testImm(RAX, EvalFlags::stopForReturn);
+                a.jcc(cNE, stopLabel());
+                a.aluImmMem(4, JitMem{R13, stopFlagsOffset}, ~int32_t(EvalFlags::stopForBreak | EvalFlags::stopForContinue));
+                a.jmp(breakLabel);
+                a.bind(skip);
+            }
+        }
+        bool forRange ( JitNode * n ) {
+            if ( !emptyGroup(n, "final") ) return false;
+            auto src = subNode(n, "sources[0]");
+            if ( n->items.empty() || n->items[0].kind!=JitItem::kSp || !src ) return false;
+            auto spi = &n->items[0];
+            bool isUnsigned = n->op.compare(0, 4, "ForU")==0;
+            int32_t counter = allocSlot(8);
+            JitMem iMem = JitMem{RBP, counter}, toMem = JitMem{RBP, counter + 4};
+            // range to eax - from, ecx - to
+            JitType countType = src->subs.size()==1 ? jitTypeFromName(src->subs[0]->tt) : JitType::none;
+            if ( src->op=="Range1Ctor" && (countType==JitType::tInt || countType==JitType::tUInt) ) {
+                expr(src->subs[0], countType);
+                a.mov(RCX, RAX, false);
+                a.xor_(RAX, RAX, false);
+            } else if ( src->op=="ConstValue" && hasItems(src, {JitItem::kArgV}) ) {
+                int32_t r[4];
+                memcpy(r, &src->items[0].v, sizeof(r));
+                a.movImm(RAX, uint32_t(r[0]));
+                a.movImm(RCX, uint32_t(r[1]));
+            } else {
+                fallbackExpr(src, JitType::none);
+                a.movq(RAX, XMM0, true);
+                a.mov(RCX, RAX, true);
+                a.shrImm(RCX, 32, true);
+            }
+            int top = a.newLabel(), cont = a.newLabel(), end = a.newLabel();
+            a.store(toMem, RCX, false);
+            a.cmp(RAX, RCX, false);
+            a.jcc(isUnsigned ? cAE : cGE, end);
+            a.store(iMem, RAX, false);
+            a.bind(top);
+            a.load(RAX, iMem, false);
+            a.store(JitMem{RBX, int32_t(spi->u)}, RAX, false);
+            loopBody(n, end, cont);
+            a.bind(cont);
+            a.load(RAX, iMem, false);
+            a.aluImm(0, RAX, 1, false);
+            a.store(iMem, RAX, false);
+            a.load(RCX, toMem, false);
+            a.cmp(RAX, RCX, false);
+            a.jcc(cNE, top);
+            a.bind(end);
+            return true;
+        }
+        bool whileLoop ( JitNode * n ) {
+            auto c = subNode(n, "cond");
+            if ( !c || !emptyGroup(n, "final") ) return false;
+            int top = a.newLabel(), end = a.newLabel();
+            a.bind(top);
+            cond(c, end);
+            loopBody(n, end, top);
+            a.jmp(top);
+            a.bind(end);
+            return true;
+        }
+        bool setOp ( const JitOpName * opn, const JitSrc & l, const JitSrc & r, JitType t, JitNode * n ) {
+            if ( !opSupported(opn->op, t) ) return false;
+            if ( l.kind==JitSrc::kConst ) return false;
+            JitMem m;
+            if ( l.kind==JitSrc::kAny ) {
+                expr(l.node, JitType::tPtr);
+                a.push(RAX); pushDepth ++;
+                if ( r.kind==JitSrc::kAny ) expr(r.node, t); else loadSrc(r, t, false);
+                toSecond(t);
+                popReg(R8);
+                m = JitMem{R8, 0};
+            } else if ( r.kind==JitSrc::kAny && !isPure(r.node) && l.kind!=JitSrc::kLoc && l.kind!=JitSrc::kArg ) {
+                m = srcMem(l, R8);
+                a.lea(R8, m);
+                a.push(R8); pushDepth ++;
+                expr(r.node, t);
+                toSecond(t);
+                popReg(R8);
+                m = JitMem{R8, 0};
+            } else {
+                if ( r.kind==JitSrc::kAny ) expr(r.node, t); else loadSrc(r, t, false);
+                toSecond(t);
+                m = srcMem(l, R8);
+            }
+            if ( opn->op==JitOp::set ) {
+                storeMem(t, m, true);
+            } else {
+                loadMem(t, m, false);
+                binop(opn->op, t, n);
+                storeMem(t, m, false);
+            }
+            return true;
+        }
+        // address of the copy operand, only locals and evaluated pointers
+        bool copySrcAddress ( const JitSrc & s, JitReg r ) {
+            switch ( s.kind ) {
+            case JitSrc::kAny:
+                expr(s.node, JitType::tPtr);
+                a.mov(r, RAX);
+                return true;
+            case JitSrc::kLoc:
+                a.lea(r, JitMem{RBX, int32_t(s.sp)});
+                return true;
+            case JitSrc::kLocro:
+                a.load(r, JitMem{RBX, int32_t(s.sp)}, true);
+                a.lea(r, JitMem{r, int32_t(s.offset)});
+                return true;
+            default:
+                return false;
+            }
+        }
+        // *l = *r, for values which fit a register
+        bool copyRefValue ( JitNode * n ) {
+            JitFused f;
+            if ( n->op=="CopyRefValue" ) {
+                if ( n->subs.size()!=2 ) return false;
+                f.src[0] = anySrc(n->subs[0]);
+                f.src[1] = anySrc(n->subs[1]);
+                f.next = 2;
+            } else if ( !decodeSources(n, n->op.substr(strlen("CopyRefValue")), 2, f) ) {
+                return false;
+            }
+            if ( f.next+1!=n->items.size() || n->items[f.next].kind!=JitItem::kArgU ) return false;
+            uint32_t size = n->items[f.next].u;
+            if ( size!=1 && size!=4 && size!=8 && size!=16 ) return false;
+            const JitSrc & l = f.src[0];
+            const JitSrc & r = f.src[1];
+            auto isAddr = [](const JitSrc & s) {
+                return s.kind==JitSrc::kAny || s.kind==JitSrc::kLoc || s.kind==JitSrc::kLocro;
+            };
+            if ( !isAddr(l) || !isAddr(r) ) return false;
+            // left is evaluated first, same as the interpreter
+            if ( l.kind==JitSrc::kAny && r.kind==JitSrc::kAny ) {
+                copySrcAddress(l, RAX);
+                a.push(RAX); pushDepth ++;
+                copySrcAddress(r, RCX);
+                popReg(R8);
+            } else if ( l.kind==JitSrc::kAny ) {
+                copySrcAddress(l, R8);
+                copySrcAddress(r, RCX);
+            } else {
+                copySrcAddress(r, RCX);
+                copySrcAddress(l, R8);
+            }
+            switch ( size ) {
+            case 1:     a.loadU8(RAX, JitMem{RCX,0}); a.store8(JitMem{R8,0}, RAX); break;
+            case 4:     a.load(RAX, JitMem{RCX,0}, false); a.store(JitMem{R8,0}, RAX, false); break;
+            case 8:     a.load(RAX, JitMem{RCX,0}, true); a.store(JitMem{R8,0}, RAX, true); break;
+            default:    a.movups(XMM0, JitMem{RCX,0}); a.movups(JitMem{R8,0}, XMM0); break;
+            }
+            return true;
+        }
+        bool tryStmt ( JitNode * n ) {
+            const string & o = n->op;
+            JitType tt = jitTypeFromName(n->tt);
+            JitType vt = jitValueTypeFromName(n->tt);
+            if ( o=="Block" || o=="Let" ) {
+                auto body = group(n, "block");
+                if ( !body || !emptyGroup(n, "final") ) return false;
+                stmts(n, body);
+                return true;
+            } else if ( o=="NOP" ) {
+                return true;
+            } else if ( o=="JitTierBackEdge" ) {
+                // loop counter of the interpreter tier, not needed once compiled
+                if ( n->subs.size()!=1 ) return false;
+                stmt(n->subs[0]);
+                return true;
+            } else if ( o=="While" || o=="WhileCmp" ) {
+                return whileLoop(n);
+            } else if ( o=="ForRange" || o=="ForURange" || o=="ForRangeNF" || o=="ForURangeNF"
+                    || o=="ForRange1" || o=="ForURange1" || o=="ForRangeNF1" || o=="ForURangeNF1" ) {
+                return forRange(n);
+            } else if ( o=="IfThenElse" || o=="IfThen" || o=="IfCmpThenElse" || o=="IfCmpThen" ) {
+                auto c = subNode(n, "cond"), tn = subNode(n, "if_true"), fn = subNode(n, "if_false");
+                if ( !c || !tn ) return false;
+                int elseLabel = a.newLabel(), endLabel = a.newLabel();
+                cond(c, elseLabel);
+                stmt(tn);
+                if ( fn ) a.jmp(endLabel);
+                a.bind(elseLabel);
+                if ( fn ) stmt(fn);
+                a.bind(endLabel);
+                return true;
+            } else if ( o=="Break" || o=="Continue" ) {
+                if ( loops.empty() ) return false;
+                a.jmp(o=="Break" ? loops.back().breakLabel : loops.back().continueLabel);
+                return true;
+            } else if ( o=="ReturnNothing" ) {
+                a.xorps(XMM0, XMM0);
+                a.jmp(exitLabel);
+                return true;
+            } else if ( o=="Return" ) {
+                auto sub = subNode(n, "subexpr");
+                if ( !sub ) {
+                    a.xorps(XMM0, XMM0);
+                    a.jmp(exitLabel);
+                    return true;
+                }
+                if ( resultType==JitType::none ) return false;
+                expr(sub, resultType);
+                returnValue(resultType);
+                return true;
+            } else if ( o=="ReturnConst" ) {
+                if ( resultType==JitType::none || !hasItems(n, {JitItem::kArgV}) ) return false;
+                loadConst(resultType, n->items[0].v, false);
+                returnValue(resultType);
+                return true;
+            } else if ( o=="Call" || o=="FastCall" ) {
+                return call(n, JitType::none);
+            } else if ( o.compare(0,12,"CopyRefValue")==0 ) {
+                return copyRefValue(n);
+            } else if ( o=="Set" ) {
+                if ( vt==JitType::none || n->subs.size()!=2 ) return false;
+                return setOp(plainOp2("Set"), anySrc(n->subs[0]), anySrc(n->subs[1]), vt, n);
+            } else if ( o=="IfZeroThen" || o=="IfNotZeroThen" || o=="IfZeroThenElse" || o=="IfNotZeroThenElse"
+                    || o.compare(0,10,"IfZeroThen")==0 || o.compare(0,13,"IfNotZeroThen")==0 ) {
+                auto tn = subNode(n, "if_true"), fn = subNode(n, "if_false");
+                if ( !tn ) return false;
+                int elseLabel = a.newLabel(), endLabel = a.newLabel();
+                if ( !zeroCond(n, tt, elseLabel, o.compare(0,6,"IfZero")==0) ) return false;
+                stmt(tn);
+                if ( fn ) a.jmp(endLabel);
+                a.bind(elseLabel);
+                if ( fn ) stmt(fn);
+                a.bind(endLabel);
+                return true;
+            }
+            const JitOpName * opn = nullptr;
+            JitFused f;
+            if ( decodeOp2(n, opn, f) ) {
+                JitType st = opn->op==JitOp::set ? vt : tt;
+                if ( !opn->isSet || st==JitType::none || f.next!=n->items.size() ) return false;
+                return setOp(opn, f.src[0], f.src[1], st, n);
+            } else if ( decodeOp1(n, f) ) {
+                if ( f.op=="Return" ) {
+                    if ( resultType==JitType::none || (vt!=JitType::none && vt!=resultType) ) return false;
+                    if ( f.next!=n->items.size() ) return false;
+                    loadSrc(f.src[0], resultType, false);
+                    returnValue(resultType);
+                    return true;
+                } else if ( f.op=="Inc" || f.op=="Dec" || f.op=="IncPost" || f.op=="DecPost" ) {
+                    if ( f.next!=n->items.size() ) return false;
+                    return incDec(f.op, f.src[0], tt);
+                }
+            }
+            // value, which is not used
+            if ( tt!=JitType::none ) {
+                uint32_t nn = stats.nativeNodes;
+                expr(n, tt);
+                return stats.nativeNodes!=nn;
+            }
+            return false;
+        }
+    };
+
+    static mutex g_jitMutex;
+
+    bool jitIsSupported() {
+        return true;
+    }
+
+    static bool jitCompileCode ( const JitTarget & target, SimFunction * fn, SimNode * root, vector<uint8_t> & code, JitStats & stats ) {
+        lock_guard<mutex> guard(g_jitMutex);
+        JitReader reader;
+        JitNode * tree = reader.read(root);
+        if ( !tree ) return false;
+        JitCompiler compiler(target, fn);
+        if ( !compiler.compile(tree, code) ) return false;
+        stats = compiler.stats;
+        return true;
+    }
+
+    static JitCodeArena * jitArena ( Context * context ) {
+        if ( !context->code->jitCode ) {
+            context->code->jitCode = make_shared<JitCodeArena>();
+        }
+        return context->code->jitCode.get();
+    }
+
+    static void jitInstall ( SimFunction * fn, SimNode_Jit * node ) {
+        node->saved_code = fn->code;
+        node->saved_aot = fn->aot;
+        node->saved_aot_function = fn->aotFunction;
+        fn->code = node;
+        fn->aot = false;
+        fn->aotFunction = nullptr;
+        fn->jit = true;
+    }
+
+    bool jitCompileFunction ( Context * context, SimFunction * fn, JitStats * stats ) {
+        if ( !fn || !fn->code || fn->aot || fn->code->rtti_node_isJit() ) return false;
+        vector<uint8_t> code;
+        JitStats jstats;
+        if ( !jitCompileCode(JitTarget(context), fn, fn->code, code, jstats) ) return false;
+        void * native = jitArena(context)->place(code.data(), code.size());
+        if ( !native ) return false;
+        jitInstall(fn, context->code->makeNode<SimNode_Jit>(fn->code->debugInfo, (JitFunction)native));
+        if ( stats ) *stats = jstats;
+        return true;
+    }
+
+    // tiered execution
+
+    enum class JitTierState : int32_t { interpreted, queued, ready, installed, failed, deopted };
+
+    // replaces function code, while the function is in the interpreter tier
+    struct SimNode_JitTier : SimNode {
+        SimNode_JitTier ( const LineInfo & at, JitTiering * t, SimFunction * f, SimNode * se )
+            : SimNode(at), tiering(t), fn(f), subexpr(se) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        __forceinline SimNode * tierUp ( Context & context );
+        virtual vec4f eval ( Context & context ) override {
+            DAS_PROFILE_NODE
+            if ( auto jitNode = tierUp(context) ) return jitNode->eval(context);
+            JitTierScope scope(tiering, JitTier::interpreter);
+            return subexpr->eval(context);
+        }
+#define EVAL_NODE(TYPE,CTYPE) \
+        virtual CTYPE eval##TYPE ( Context & context ) override { \
+                DAS_PROFILE_NODE \
+                if ( auto jitNode = tierUp(context) ) return jitNode->eval##TYPE(context); \
+                JitTierScope scope(tiering, JitTier::interpreter); \
+                return subexpr->eval##TYPE(context); \
+            }
+        DAS_EVAL_NODE
+#undef EVAL_NODE
+        JitTiering *            tiering;
+        SimFunction *           fn;
+        SimNode *               subexpr;
+        SimNode_JitTiered *     jitNode = nullptr;
+        void *                  native = nullptr;       // written by the background thread, before the state is ready
+        uint32_t                calls = 0;
+        uint32_t                backEdges = 0;
+        atomic<JitTierState>    state{JitTierState::interpreted};
+    };
+
+    // first statement of the loop body, counts iterations
+    struct SimNode_JitTierBackEdge : SimNode {
+        SimNode_JitTierBackEdge ( const LineInfo & at, SimNode_JitTier * o, SimNode * se )
+            : SimNode(at), owner(o), subexpr(se) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN();
+            V_OP(JitTierBackEdge);
+            V_SUB(subexpr);
+            V_END();
+        }
+        virtual vec4f eval ( Context & context ) override;
+        SimNode_JitTier *   owner;
+        SimNode *           subexpr;
+    };
+
+    SimNode * SimNode_JitTier::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(JitTier);
+        V_SUB(subexpr);
+        V_END();
+    }
+
+    // loop bodies are "list" and "list[0]" of the loop nodes
+    struct JitTierLoopVisitor : SimVisitor {
+        JitTierLoopVisitor ( NodeAllocator * c, SimNode_JitTier * o ) : code(c), owner(o) {}
+        virtual SimNode * sub ( SimNode * node, const char * name ) override {
+            node = node->visit(*this);
+            return strcmp(name, "list[0]")==0 ? wrap(node) : node;
+        }
+        virtual void sub ( SimNode ** list, uint32_t count, const char * name ) override {
+            SimVisitor::sub(list, count, name);
+            if ( count && strcmp(name, "list")==0 ) list[0] = wrap(list[0]);
+        }
+        SimNode * wrap ( SimNode * node ) {
+            return code->makeNode<SimNode_JitTierBackEdge>(node->debugInfo, owner, node);
+        }
+        NodeAllocator *     code;
+        SimNode_JitTier *   owner;
+    };
+
+    class JitTiering {
+    public:
+        JitTiering ( Context * ctx ) : target(ctx), que(1) {}
+        ~JitTiering() {
+            que.wait();
+            // this thread could be left inside of the tier, if context threw
+            if ( g_jitTierClock.owner==this ) g_jitTierClock = JitTierClock();
+        }
+        void enqueue ( SimNode_JitTier * node ) {
+            auto expected = JitTierState::interpreted;
+            if ( !node->state.compare_exchange_strong(expected, JitTierState::queued) ) return;
+            queued ++;
+            que.push([this,node]() {
+                int64_t t0 = ref_time_ticks();
+                vector<uint8_t> code;
+                JitStats stats;
+                void * native = nullptr;
+                if ( jitCompileCode(target, node->fn, node->subexpr, code, stats) ) {
+                    native = arena->place(code.data(), code.size());
+                }
+                compileTicks += ref_time_ticks() - t0;
+                node->native = native;
+                if ( native ) {
+                    node->state.store(JitTierState::ready, memory_order_release);
+                } else {
+                    failed ++;
+                    node->state.store(JitTierState::failed, memory_order_release);
+                }
+            }, 0, JobPriority::Low);
+        }
+        void charge ( JitTier tier, int64_t ticks ) {
+            if ( tier==JitTier::interpreter ) {
+                interpreterTicks.fetch_add(ticks, memory_order_relaxed);
+            } else if ( tier==JitTier::jit ) {
+                jitTicks.fetch_add(ticks, memory_order_relaxed);
+            }
+        }
+        void wait() { que.wait(); }
+        JitTarget               target;
+        JitCodeArena *          arena = nullptr;
+        uint32_t                callThreshold = 1000;
+        uint32_t                loopThreshold = 100000;
+        bool                    enabled = false;
+        atomic<uint64_t>        interpretedCalls{0};
+        atomic<uint32_t>        queued{0}, compiled{0}, failed{0}, deopted{0};
+        atomic<int64_t>         interpreterTicks{0}, jitTicks{0}, compileTicks{0};
+    protected:
+        JobQue                  que;
+    };
+
+    static void chargeJitTier ( JitTiering * owner, JitTier tier, int64_t ticks ) {
+        owner->charge(tier, ticks);
+    }
+
+    static void destroyJitTiering ( JitTiering * tiering ) {
+        delete tiering;
+    }
+
+    // swap happens on the thread which runs the function, between the calls
+    __forceinline SimNode * SimNode_JitTier::tierUp ( Context & context ) {
+        auto st = state.load(memory_order_acquire);
+        if ( st==JitTierState::interpreted ) {
+            tiering->interpretedCalls.fetch_add(1, memory_order_relaxed);
+            if ( tiering->enabled && ++calls>=tiering->callThreshold ) {
+                tiering->enqueue(this);
+            }
+        } else if ( st==JitTierState::ready ) {
+            jitNode = context.code->makeNode<SimNode_JitTiered>(debugInfo, (JitFunction)native, tiering);
+            state.store(JitTierState::installed, memory_order_release);
+            tiering->compiled ++;
+            if ( fn->code==this ) {
+                jitInstall(fn, jitNode);
+            } else {
+                // someone else wraps the function, i.e. profiler or debugger
+                jitNode->saved_code = subexpr;
+                subexpr = jitNode;
+            }
+            return jitNode;
+        } else if ( st==JitTierState::installed ) {
+            if ( fn->code==this ) {
+                // remove_jit restored us, back to the interpreter for good
+                state.store(JitTierState::deopted, memory_order_release);
+                tiering->deopted ++;
+            }
+        } else if ( st==JitTierState::queued || st==JitTierState::failed || st==JitTierState::deopted ) {
+            tiering->interpretedCalls.fetch_add(1, memory_order_relaxed);
+        }
+        return nullptr;
+    }
+
+    // long running loop queues the function without waiting for the next call
+    vec4f SimNode_JitTierBackEdge::eval ( Context & context ) {
+        DAS_PROFILE_NODE
+        auto tiering = owner->tiering;
+        if ( ++owner->backEdges==tiering->loopThreshold && tiering->enabled ) {
+            tiering->enqueue(owner);
+        }
+        return subexpr->eval(context);
+    }
+
+    static bool isJitTierNode ( SimNode * node ) {
+        alignas(SimNode_JitTier) static char buffer[sizeof(SimNode_JitTier)];
+        static void * vtable = *(void **)new (buffer) SimNode_JitTier(LineInfo(), nullptr, nullptr, nullptr);
+        return *(void **)node==vtable;
+    }
+
+    bool jitEnableTiering ( Context * context, bool enable, uint32_t callThreshold, uint32_t loopThreshold ) {
+        auto arena = jitArena(context);
+        if ( !arena->tiering ) {
+            if ( !enable ) return true;
+            arena->tiering = new JitTiering(context);
+            arena->tiering->arena = arena;
+        }
+        auto tiering = arena->tiering;
+        tiering->callThreshold = das::max(callThreshold, 1u);
+        tiering->loopThreshold = das::max(loopThreshold, 1u);
+        tiering->enabled = enable;
+        if ( !enable ) return true;
+        for ( int32_t fni=0, fnis=context->getTotalFunctions(); fni!=fnis; ++fni ) {
+            auto fn = context->getFunction(fni);
+            // aot and jit functions are already native, and [jit] ones are compiled eagerly
+            if ( !fn->code || fn->aot || fn->jit || fn->code->rtti_node_isJit() ) continue;
+            if ( isJitTierNode(fn->code) ) continue;
+            auto tier = context->code->makeNode<SimNode_JitTier>(fn->code->debugInfo, tiering, fn, fn->code);
+            JitTierLoopVisitor loops(context->code.get(), tier);
+            tier->subexpr = tier->subexpr->visit(loops);
+            fn->code = tier;
+        }
+        return true;
+    }
+
+    void jitWaitTiering ( Context * context ) {
+        if ( context->code->jitCode && context->code->jitCode->tiering ) {
+            context->code->jitCode->tiering->wait();
+        }
+    }
+
+    bool jitTieringStats ( Context * context, JitTierStats & stats ) {
+        if ( !context->code->jitCode || !context->code->jitCode->tiering ) return false;
+        auto tiering = context->code->jitCode->tiering;
+        stats.interpretedCalls = tiering->interpretedCalls;
+        stats.queued = tiering->queued;
+        stats.compiled = tiering->compiled;
+        stats.failed = tiering->failed;
+        stats.deopted = tiering->deopted;
+        stats.interpreterTicks = tiering->interpreterTicks;
+        stats.jitTicks = tiering->jitTicks;
+        stats.compileTicks = tiering->compileTicks;
+        return true;
+    }
+
+    void jitTieringReport ( Context * context, TextWriter & tout ) {
+        JitTierStats stats;
+        if ( !jitTieringStats(context, stats) ) return;
+        tout << "\nJIT TIERS:\n";
+        tout << "interpreter\t" << ref_time_delta_to_usec(stats.interpreterTicks) << " usec\t"
+            << stats.interpretedCalls << " calls\n";
+        tout << "jit\t\t" << ref_time_delta_to_usec(stats.jitTicks) << " usec\t"
+            << stats.compiled << " functions\n";
+        tout << "compile\t\t" << ref_time_delta_to_usec(stats.compileTicks) << " usec\t"
+            << stats.queued << " queued, " << stats.failed << " failed, " << stats.deopted << " deopted\n";
+    }
+
+#else
+
+    bool jitIsSupported() {
+        return false;
+    }
+
+    bool jitCompileFunction ( Context *, SimFunction *, JitStats * ) {
+        return false;
+    }
+
+    bool jitEnableTiering ( Context *, bool, uint32_t, uint32_t ) {
+        return false;
+    }
+
+    void jitWaitTiering ( Context * ) {
+    }
+
+    bool jitTieringStats ( Context *, JitTierStats & ) {
+        return false;
+    }
+
+    void jitTieringReport ( Context *, TextWriter & ) {
+    }
+
+#endif
+}
@@ -325,6 +325,21 @@ namespace das {
         V_END();
     }
 
+    SimNode * SimNode_StringBuilderFormat::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(StringBuilderFormat);
+        for ( int32_t i=0; i!=nParts; ++i ) {
+            if ( parts[i].kind==StringBuilderPartKind::Literal ) {
+                vis.arg(parts[i].text, "text");
+            } else {
+                vis.arg(uint32_t(parts[i].kind), "kind");
+                if ( parts[i].enumInfo ) vis.arg(parts[i].enumInfo->hash, "enum");
+            }
+        }
+        V_CALL();
+        V_END();
+    }
+
     SimNode * SimNode_Debug::visit ( SimVisitor & vis ) {
         V_BEGIN();
         V_OP(Debug);
@@ -833,6 +848,14 @@ namespace das {
         V_END();
     }
 
+    SimNode * SimNode_ProfileFunction::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(ProfileFunction);
+        vis.arg(func->name,"fnPtr");
+        V_SUB(subexpr);
+        V_END();
+    }
+
 #if DAS_DEBUGGER
     SimNode * SimNodeDebug_Instrument::visit ( SimVisitor & vis ) {
         V_BEGIN();
@@ -1,5 +1,7 @@
 #include "daScript/daScript.h"
 #include "daScript/simulate/fs_file_info.h"
+#include "daScript/simulate/simulate_jit.h"
+#include "daScript/ast/ast_compile_profile.h"
 
 using namespace das;
 
@@ -12,6 +14,10 @@ static bool debuggerRequired = false;
 static bool pauseAfterErrors = false;
 static bool quiet = false;
 static bool paranoid_validation = false;
+static bool jitTiering = false;
+static bool compileProfile = false;
+static CompileProfileFormat compileProfileFormat = CompileProfileFormat::text;
+static string compileProfileOut;
 
 das::Context * get_context ( int stackSize=0 );
 
@@ -29,6 +35,40 @@ bool saveToFile ( const string & fname, const string & str ) {
     return true;
 }
 
+bool parseCompileProfileFormat ( const char * fmt ) {
+    if ( strcmp(fmt,"text")==0 ) {
+        compileProfileFormat = CompileProfileFormat::text;
+    } else if ( strcmp(fmt,"json")==0 ) {
+        compileProfileFormat = CompileProfileFormat::json;
+    } else if ( strcmp(fmt,"trace")==0 ) {
+        compileProfileFormat = CompileProfileFormat::chromeTrace;
+    } else {
+        return false;
+    }
+    compileProfile = true;
+    return true;
+}
+
+unique_ptr<CompileProfiler> startCompileProfile() {
+    if ( !compileProfile ) return nullptr;
+    auto profiler = make_unique<CompileProfiler>();
+    profiler->install();
+    return profiler;
+}
+
+void finishCompileProfile ( unique_ptr<CompileProfiler> & profiler ) {
+    if ( !profiler ) return;
+    profiler->uninstall();
+    TextWriter tw;
+    profiler->report(tw, compileProfileFormat);
+    if ( compileProfileOut.empty() ) {
+        tout << tw.str();
+    } else {
+        saveToFile(compileProfileOut, tw.str());
+    }
+    profiler.reset();
+}
+
 bool compile ( const string & fn, const string & cppFn, bool dryRun ) {
     auto access = get_file_access(nullptr);
     ModuleGroup dummyGroup;
@@ -36,8 +76,10 @@ bool compile ( const string & fn, const string & cppFn, bool dryRun ) {
     policies.aot = false;
     policies.aot_module = true;
     policies.fail_on_lack_of_aot_export = true;
+    auto profiler = startCompileProfile();
     if ( auto program = compileDaScript(fn,access,tout,dummyGroup,false,policies) ) {
         if ( program->failed() ) {
+            finishCompileProfile(profiler);
             tout << "failed to compile\n";
             for ( auto & err : program->errors ) {
                 tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr);
@@ -81,9 +123,11 @@ bool compile ( const string & fn, const string & cppFn, bool dryRun ) {
                 return true;
             },"*");
             if (dryRun) {
+                finishCompileProfile(profiler);
                 tout << "dry run success, no changes will be written\n";
                 return true;
             }
+            if ( noAotOption || noAotModule ) finishCompileProfile(profiler);
             if (noAotOption) {
                 TextWriter noTw;
                 if (!noAotModule)
@@ -136,6 +180,7 @@ bool compile ( const string & fn, const string & cppFn, bool dryRun ) {
                 daScriptEnvironment::bound->g_Program = program;    // setting it for the AOT macros
                 program->aotCpp(*pctx, tw);
                 daScriptEnvironment::bound->g_Program.reset();
+                finishCompileProfile(profiler);
                 // list STUFF
                 tw << "\nstatic void registerAotFunctions ( AotLibrary & aotLib ) {\n";
                 program->registerAotCpp(tw, *pctx, false);
@@ -176,7 +221,7 @@ int das_aot_main ( int argc, char * argv[] ) {
     _set_abort_behavior(0, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
     #endif
     if ( argc<=3 ) {
-        tout << "daScript -aot <in_script.das> <out_script.das.cpp> [-q] [-j] [-dry-run]\n";
+        tout << "daScript -aot <in_script.das> <out_script.das.cpp> [-q] [-j] [-dry-run] [-compile-profile <text|json|trace>] [-compile-profile-out <file>]\n";
         return -1;
     }
     bool dryRun = false;
@@ -189,6 +234,13 @@ int das_aot_main ( int argc, char * argv[] ) {
                 paranoid_validation = true;
             } else if ( strcmp(argv[ai],"-dry-run")==0 ) {
                 dryRun = true;
+            } else if ( strcmp(argv[ai],"-compile-profile")==0 && ai+1!=argc ) {
+                if ( !parseCompileProfileFormat(argv[++ai]) ) {
+                    tout << "unsupported compile profile format " << argv[ai];
+                    return -1;
+                }
+            } else if ( strcmp(argv[ai],"-compile-profile-out")==0 && ai+1!=argc ) {
+                compileProfileOut = argv[++ai];
             } else if ( strcmp(argv[ai],"--")==0 ) {
                 scriptArgs = true;
             } else if ( !scriptArgs ) {
@@ -218,6 +270,8 @@ int das_aot_main ( int argc, char * argv[] ) {
     }
     if (!Module::require("network")) {
         NEED_MODULE(Module_Network);
+        NEED_MODULE(Module_JsonNative);
+        NEED_MODULE(Module_RegexNative);
     }
     if (!Module::require("uriparser")) {
         NEED_MODULE(Module_UriParser);
@@ -255,8 +309,10 @@ bool compile_and_run ( const string & fn, const string & mainFnName, bool output
     }
     policies.fail_on_no_aot = false;
     policies.fail_on_lack_of_aot_export = false;
+    auto profiler = startCompileProfile();
     if ( auto program = compileDaScript(fn,access,tout,dummyGroup,false,policies) ) {
         if ( program->failed() ) {
+            finishCompileProfile(profiler);
             for ( auto & err : program->errors ) {
                 tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr );
             }
@@ -267,7 +323,9 @@ bool compile_and_run ( const string & fn, const string & mainFnName, bool output
             if ( outputProgramCode )
                 tout << *program << "\n";
             smart_ptr<Context> pctx ( get_context(program->getContextStackSize()) );
-            if ( !program->simulate(*pctx, tout) ) {
+            bool simulated = program->simulate(*pctx, tout);
+            finishCompileProfile(profiler);
+            if ( !simulated ) {
                 tout << "failed to simulate\n";
                 for ( auto & err : program->errors ) {
                     tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr );
@@ -296,7 +354,12 @@ bool compile_and_run ( const string & fn, const string & mainFnName, bool output
                     success = true;
                     auto fnTest = fnMVec.back();
                     pctx->restart();
+                    if ( jitTiering ) jitEnableTiering(pctx.get(), true, 1000, 100000);
                     pctx->eval(fnTest, nullptr);
+                    if ( jitTiering ) {
+                        jitWaitTiering(pctx.get());
+                        jitTieringReport(pctx.get(), tout);
+                    }
                 }
             }
         }
@@ -317,10 +380,14 @@ void print_help() {
         << "    -log        output program code\n"
         << "    -pause      pause after errors and pause again before exiting program\n"
         << "    -dry-run    compile and simulate script without execution\n"
+        << "    -jit-tier   compile hot functions with jit in the background, report time of each tier\n"
+        << "    -compile-profile <text|json|trace>  report time and heap growth of each compilation pass, module and macro\n"
+        << "    -compile-profile-out <file>         write compile profile to the file, instead of the output\n"
         << "daScript -aot <in_script.das> <out_script.das.cpp> {-q} {-p}\n"
         << "    -p          paranoid validation of CPP AOT\n"
         << "    -q          supress all output\n"
         << "    -dry-run    no changes will be written\n"
+        << "    -compile-profile <text|json|trace> {-compile-profile-out <file>}\n"
     ;
 }
 
@@ -366,6 +433,21 @@ int MAIN_FUNC_NAME ( int argc, char * argv[] ) {
                 outputProgramCode = true;
             } else if ( cmd=="dry-run" ) {
                 dryRun = true;
+            } else if ( cmd=="jit-tier" ) {
+                jitTiering = true;
+            } else if ( cmd=="compile-profile" ) {
+                if ( i+1 >= argc || !parseCompileProfileFormat(argv[i+1]) ) {
+                    print_help();
+                    return -1;
+                }
+                i += 1;
+            } else if ( cmd=="compile-profile-out" ) {
+                if ( i+1 >= argc ) {
+                    print_help();
+                    return -1;
+                }
+                compileProfileOut = argv[i+1];
+                i += 1;
             } else if ( cmd=="args" ) {
                 break;
             } else if ( cmd=="pause" ) {
@@ -406,6 +488,8 @@ int MAIN_FUNC_NAME ( int argc, char * argv[] ) {
         NEED_MODULE(Module_Debugger);
     }
     NEED_MODULE(Module_Network);
+    NEED_MODULE(Module_JsonNative);
+    NEED_MODULE(Module_RegexNative);
     NEED_MODULE(Module_UriParser);
     NEED_MODULE(Module_JobQue);
     NEED_MODULE(Module_FIO);